@@ -1,7 +1,12 @@
 // cAudFrame.h
 #pragma once
+#include <math.h>
 #include "iFrame.h"
 
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+  #include <emmintrin.h>
+#endif
+
 class cAudFrame : public iFrame {
 public:
   static const int kMaxChannels = 6;
@@ -25,8 +30,9 @@ public:
       channels = kMaxChannels;
       }
 
+    // only grow, channel and sample count switches reuse the allocation
     auto numSampleBytes = channels * numSamples * 4;
-    if (!mSamples || (numSampleBytes != mNumSampleBytes)) {
+    if (!mSamples || (numSampleBytes > mNumSampleBytes)) {
       mSamples = (float*)realloc (mSamples, numSampleBytes);
       mNumSampleBytes = numSampleBytes;
       cLog::log (LOGINFO1, "cAudFrame::set - alloc samples " + dec(numSampleBytes));
@@ -40,6 +46,60 @@ public:
     }
   //}}}
   //{{{
+  void reserve (int channels, int numSamples) {
+  // preallocate for largest expected frame
+
+    auto numSampleBytes = channels * numSamples * 4;
+    if (numSampleBytes > mNumSampleBytes) {
+      mSamples = (float*)realloc (mSamples, numSampleBytes);
+      mNumSampleBytes = numSampleBytes;
+      }
+    }
+  //}}}
+  //{{{
+  void calcPower() {
+  // rms power per channel of interleaved samples
+
+    if (!mChannels)
+      return;
+
+    float sums[kMaxChannels] = { 0.f };
+    auto samples = mSamples;
+    auto numFloats = mChannels * mNumSamples;
+
+  #if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+    // block of lcm(channels,4) floats keeps every lane on a fixed channel
+    auto blockVecs = (mChannels % 4 == 0) ? mChannels / 4 : (mChannels % 2 == 0) ? mChannels / 2 : mChannels;
+    auto blockFloats = blockVecs * 4;
+
+    __m128 acc[kMaxChannels] = { _mm_setzero_ps() };
+
+    auto numBlocks = numFloats / blockFloats;
+    for (auto block = 0; block < numBlocks; block++, samples += blockFloats)
+      for (auto i = 0; i < blockVecs; i++) {
+        auto v = _mm_loadu_ps (samples + i*4);
+        acc[i] = _mm_add_ps (acc[i], _mm_mul_ps (v, v));
+        }
+
+    for (auto i = 0; i < blockVecs; i++) {
+      float lanes[4];
+      _mm_storeu_ps (lanes, acc[i]);
+      for (auto lane = 0; lane < 4; lane++)
+        sums[(i*4 + lane) % mChannels] += lanes[lane];
+      }
+
+    numFloats -= numBlocks * blockFloats;
+  #endif
+
+    // tail, or everything without simd, stays channel aligned
+    for (auto i = 0; i < numFloats; i++)
+      sums[i % mChannels] += samples[i] * samples[i];
+
+    for (auto chan = 0; chan < mChannels; chan++)
+      mPower[chan] = mNumSamples ? sqrtf (sums[chan] / mNumSamples) : 0.f;
+    }
+  //}}}
+  //{{{
   void invalidate() {
 
     mOk = false;
@@ -0,0 +1,92 @@
+// cAudFramePool.h - preallocated cAudFrame ring, single producer decoder, single consumer playout
+#pragma once
+#include <atomic>
+#include "cAudFrame.h"
+
+class cAudFramePool {
+public:
+  //{{{
+  cAudFramePool (int numFrames, int maxChannels, int maxSamples) : mNumFrames(numFrames) {
+
+    mFrames = new cAudFrame[numFrames];
+    for (auto i = 0; i < numFrames; i++)
+      mFrames[i].reserve (maxChannels, maxSamples);
+    }
+  //}}}
+  virtual ~cAudFramePool() { delete[] mFrames; }
+
+  int getNumFrames() { return mNumFrames; }
+  int getUsed() { return int(mWriteIndex.load (std::memory_order_acquire) - mReadIndex.load (std::memory_order_acquire)); }
+
+  // producer
+  //{{{
+  cAudFrame* getWriteFrame() {
+  // next free frame to decode into, nullptr if consumer hasn't released enough
+
+    auto writeIndex = mWriteIndex.load (std::memory_order_relaxed);
+    if (writeIndex - mReadIndex.load (std::memory_order_acquire) >= (uint32_t)mNumFrames)
+      return nullptr;
+
+    return &mFrames[writeIndex % mNumFrames];
+    }
+  //}}}
+  //{{{
+  void commitWrite() {
+  // publish frame from getWriteFrame, metering calculated here on decode thread
+
+    auto writeIndex = mWriteIndex.load (std::memory_order_relaxed);
+    mFrames[writeIndex % mNumFrames].calcPower();
+    mWriteIndex.store (writeIndex + 1, std::memory_order_release);
+    }
+  //}}}
+
+  // consumer
+  //{{{
+  cAudFrame* findPts (int64_t pts) {
+  // frame covering pts, O(1) guess from frame width, short scan on discontinuity
+
+    auto readIndex = mReadIndex.load (std::memory_order_relaxed);
+    auto writeIndex = mWriteIndex.load (std::memory_order_acquire);
+    if (readIndex == writeIndex)
+      return nullptr;
+
+    auto first = &mFrames[readIndex % mNumFrames];
+    auto ptsWidth = first->getPtsEnd() - first->getPts();
+    if (ptsWidth > 0) {
+      auto guess = (pts - first->getPts()) / ptsWidth;
+      if ((guess >= 0) && (guess < writeIndex - readIndex)) {
+        auto frame = &mFrames[(readIndex + guess) % mNumFrames];
+        if (frame->hasPts (pts))
+          return frame;
+        }
+      }
+
+    for (auto index = readIndex; index != writeIndex; index++)
+      if (mFrames[index % mNumFrames].hasPts (pts))
+        return &mFrames[index % mNumFrames];
+
+    return nullptr;
+    }
+  //}}}
+  //{{{
+  void releaseBefore (int64_t pts) {
+  // hand back frames ending before pts to producer, and any committed without being set
+
+    auto readIndex = mReadIndex.load (std::memory_order_relaxed);
+    auto writeIndex = mWriteIndex.load (std::memory_order_acquire);
+    while ((readIndex != writeIndex) &&
+           (!mFrames[readIndex % mNumFrames].isOk() || mFrames[readIndex % mNumFrames].after (pts)))
+      readIndex++;
+
+    mReadIndex.store (readIndex, std::memory_order_release);
+    }
+  //}}}
+
+private:
+  const int mNumFrames;
+  cAudFrame* mFrames = nullptr;
+
+  // free running, producer owns mWriteIndex, consumer owns mReadIndex
+  std::atomic<uint32_t> mWriteIndex = { 0 };
+  std::atomic<uint32_t> mReadIndex = { 0 };
+  };
@@ -0,0 +1,212 @@
+// cEpgStore.h - epg from cTsDemux eit events, per service events sorted by start for now, next and windows
+// - repeated eit section versions skipped, version counter bumped only on real change
+// - demux thread adds, ui threads query copies under mMutex
+#pragma once
+//{{{  includes
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <algorithm>
+
+#include "decoders/cTsDemux.h"
+//}}}
+
+class cEpgStore {
+public:
+  //{{{
+  struct sEpgEvent {
+    int64_t getEnd() const { return mStart + mDuration; }
+
+    int64_t mStart;  // unix seconds, utc
+    int mDuration;   // seconds
+    int mEventId;
+    std::string mTitle;
+    std::string mDescription;
+    };
+  //}}}
+
+  // bumped on every change, ui rebuilds when it differs from the version it last drew
+  uint32_t getVersion() { return mVersion.load (std::memory_order_acquire); }
+  //{{{
+  int getNumEvents() {
+
+    std::lock_guard<std::mutex> lockGuard (mMutex);
+
+    int numEvents = 0;
+    for (auto& service : mServices)
+      numEvents += (int)service.second.mEvents.size();
+    return numEvents;
+    }
+  //}}}
+
+  //{{{
+  void addEvent (const cTsDemux::sEitEvent& eitEvent) {
+  // from cTsDemux eit callback, events of a section already held at this version are skipped
+
+    std::lock_guard<std::mutex> lockGuard (mMutex);
+
+    auto& service = mServices[eitEvent.mServiceId];
+
+    // events of one section arrive together, the first decides for the rest
+    uint32_t sectionKey = (eitEvent.mTableId << 8) | eitEvent.mSection;
+    uint64_t fillingKey = ((uint64_t)eitEvent.mServiceId << 32) | sectionKey;
+    if (fillingKey != mFillingKey) {
+      auto it = service.mSectionVersions.find (sectionKey);
+      if ((it != service.mSectionVersions.end()) && (it->second == eitEvent.mVersion))
+        return;
+      service.mSectionVersions[sectionKey] = eitEvent.mVersion;
+      mFillingKey = fillingKey;
+      }
+
+    if (insert (service.mEvents, eitEvent))
+      mVersion.fetch_add (1, std::memory_order_release);
+    }
+  //}}}
+  //{{{
+  void prune (int64_t before) {
+  // drop events ended before, schedules otherwise only grow
+
+    std::lock_guard<std::mutex> lockGuard (mMutex);
+
+    bool changed = false;
+    for (auto& service : mServices) {
+      auto& events = service.second.mEvents;
+      auto it = std::find_if (events.begin(), events.end(),
+                              [before](const sEpgEvent& event) { return event.getEnd() > before; });
+      if (it != events.begin()) {
+        events.erase (events.begin(), it);
+        changed = true;
+        }
+      }
+
+    if (changed)
+      mVersion.fetch_add (1, std::memory_order_release);
+    }
+  //}}}
+  //{{{
+  void clear() {
+
+    std::lock_guard<std::mutex> lockGuard (mMutex);
+
+    mServices.clear();
+    mFillingKey = 0;
+    mVersion.fetch_add (1, std::memory_order_release);
+    }
+  //}}}
+
+  //{{{
+  bool getNow (int serviceId, int64_t time, sEpgEvent& event) {
+  // event covering time, O(log n)
+
+    std::lock_guard<std::mutex> lockGuard (mMutex);
+
+    auto events = findEvents (serviceId);
+    if (!events)
+      return false;
+
+    auto it = upperBound (*events, time);
+    if ((it == events->begin()) || ((it-1)->getEnd() <= time))
+      return false;
+
+    event = *(it-1);
+    return true;
+    }
+  //}}}
+  //{{{
+  bool getNext (int serviceId, int64_t time, sEpgEvent& event) {
+  // first event starting after time, O(log n)
+
+    std::lock_guard<std::mutex> lockGuard (mMutex);
+
+    auto events = findEvents (serviceId);
+    if (!events)
+      return false;
+
+    auto it = upperBound (*events, time);
+    if (it == events->end())
+      return false;
+
+    event = *it;
+    return true;
+    }
+  //}}}
+  //{{{
+  std::vector<sEpgEvent> getWindow (int serviceId, int64_t from, int64_t to) {
+  // events overlapping from..to, in start order
+
+    std::lock_guard<std::mutex> lockGuard (mMutex);
+
+    std::vector<sEpgEvent> window;
+    auto events = findEvents (serviceId);
+    if (events) {
+      auto it = upperBound (*events, from);
+      if ((it != events->begin()) && ((it-1)->getEnd() > from))
+        --it;
+      for (; (it != events->end()) && (it->mStart < to); ++it)
+        window.push_back (*it);
+      }
+
+    return window;
+    }
+  //}}}
+
+private:
+  //{{{
+  struct sService {
+    std::vector<sEpgEvent> mEvents;            // sorted by mStart, not overlapping
+    std::map<uint32_t,int> mSectionVersions;   // tableId << 8 | section, version
+    };
+  //}}}
+
+  //{{{
+  std::vector<sEpgEvent>* findEvents (int serviceId) {
+
+    auto it = mServices.find (serviceId);
+    return (it == mServices.end()) ? nullptr : &it->second.mEvents;
+    }
+  //}}}
+  //{{{
+  static std::vector<sEpgEvent>::iterator upperBound (std::vector<sEpgEvent>& events, int64_t time) {
+  // first event starting after time
+
+    return std::upper_bound (events.begin(), events.end(), time,
+                             [](int64_t time, const sEpgEvent& event) { return time < event.mStart; });
+    }
+  //}}}
+  //{{{
+  static bool insert (std::vector<sEpgEvent>& events, const cTsDemux::sEitEvent& eitEvent) {
+  // replace same eventId and anything it overlaps, rescheduled events move, returns false if unchanged
+
+    for (auto it = events.begin(); it != events.end(); ++it)
+      if (it->mEventId == eitEvent.mEventId) {
+        if ((it->mStart == eitEvent.mStartTime) && (it->mDuration == eitEvent.mDuration) &&
+            (it->mTitle == eitEvent.mTitle) && (it->mDescription == eitEvent.mDescription))
+          return false;
+        events.erase (it);
+        break;
+        }
+
+    // overlapped neighbours, at most a few around the insert point
+    int64_t end = eitEvent.mStartTime + eitEvent.mDuration;
+    auto it = upperBound (events, eitEvent.mStartTime);
+    if ((it != events.begin()) && ((it-1)->getEnd() > eitEvent.mStartTime))
+      --it;
+    auto last = it;
+    while ((last != events.end()) && (last->mStart < end))
+      ++last;
+    it = events.erase (it, last);
+
+    events.insert (it, { eitEvent.mStartTime, eitEvent.mDuration, eitEvent.mEventId,
+                         eitEvent.mTitle, eitEvent.mDescription });
+    return true;
+    }
+  //}}}
+
+  std::mutex mMutex;
+  std::map<int,sService> mServices;
+  uint64_t mFillingKey = 0;
+  std::atomic<uint32_t> mVersion = { 0 };
+  };
@@ -4,15 +4,16 @@
 
 #include "../common/cD2dWindow.h"
 #include "../../shared/dvb/cTransportStream.h"
+#include "cEpgStore.h"
 //}}}
 
 class cTsEpgBox : public cD2dWindow::cBox {
 public:
   //{{{
-  cTsEpgBox (cD2dWindow* window, float width, float height, cTransportStream* ts)
-      : cBox("tsEpg", window, width, height), mTs(ts) {}
+  cTsEpgBox (cD2dWindow* window, float width, float height, cTransportStream* ts, cEpgStore* epgStore)
+      : cBox("tsEpg", window, width, height), mTs(ts), mEpgStore(epgStore) {}
   //}}}
-  virtual ~cTsEpgBox() {}
+  virtual ~cTsEpgBox() { clear(); }
 
   //{{{
   bool onDown (bool right, cPoint pos)  {
@@ -20,9 +21,20 @@ public:
     if (!getTimedOn() || mWindow->getTimedMenuOn()) {
       pos += getTL();
 
+      {
+      // items laid out from a stale serviceMap would click a freed cService
+      std::lock_guard<std::mutex> lockGuard (mTs->mMutex);
+      if (servicesChanged()) {
+        mDirty = true;
+        getWindow()->changed();
+        return true;
+        }
+      }
+
       for (auto boxItem : mBoxItemVec)
         if (boxItem->inside (pos)) {
           boxItem->onDown();
+          mDirty = true;
           getWindow()->changed();
           return true;
           }
@@ -38,10 +50,28 @@ public:
 
     if (!getTimedOn() || mWindow->getTimedMenuOn()) {
       std::lock_guard<std::mutex> lockGuard (mTs->mMutex);
-      clear();
       if (mTs->mServiceMap.size() > 1) {
-        draw (dc, mRect);
+        //{{{  rebuild items only when epg, minute, services or layout changed
+        auto minute = std::chrono::duration_cast<std::chrono::minutes>(mTs->getTime().time_since_epoch()).count();
+        auto epgVersion = mEpgStore->getVersion();
+        if (mDirty || (epgVersion != mEpgVersion) || (minute != mMinute) || servicesChanged() ||
+            (mRect.getWidth() != mLayoutRect.getWidth()) || (mRect.getHeight() != mLayoutRect.getHeight()) ||
+            (mRect.left != mLayoutRect.left) || (mRect.top != mLayoutRect.top)) {
+          clear();
+          layout (mRect);
+          mServices.clear();
+          for (auto& service : mTs->mServiceMap)
+            mServices.push_back ({service.first, &service.second});
+          mDirty = false;
+          mEpgVersion = epgVersion;
+          mMinute = minute;
+          mLayoutRect = mRect;
+          }
+        //}}}
+        draw (dc);
         }
+      else
+        clear();
       }
     }
   //}}}
@@ -76,12 +106,14 @@ protected:
     };
   //}}}
   //{{{
-  void draw (ID2D1DeviceContext* dc, cRect r) {
+  void layout (cRect r) {
+  // services, now from ts, later today from epgStore window query
 
     auto todayTime = mTs->getTime();
     auto todayDatePoint = date::floor<date::days>(todayTime);
-    auto todayYearMonthDay = date::year_month_day{todayDatePoint};
-    auto today = todayYearMonthDay.day();
+    auto nowSeconds = std::chrono::duration_cast<std::chrono::seconds>(todayTime.time_since_epoch()).count();
+    auto midnightSeconds = std::chrono::duration_cast<std::chrono::seconds>(
+                             (todayDatePoint + date::days{1}).time_since_epoch()).count();
 
     const float kLineHeight = 16.f;
     const float kSmallLineHeight = 13.f;
@@ -102,26 +134,53 @@ protected:
         }
 
       if (service.second.getShowEpg()) {
-        for (auto epgItem : service.second.getEpgItemMap()) {
-          auto time = epgItem.second->getTime();
-          auto datePoint = date::floor<date::days>(time);
-          auto yearMonthDay = date::year_month_day{datePoint};
-          auto day = yearMonthDay.day();
-          if ((day == today) && (time > todayTime)) { // later today
+        for (auto& epgEvent : mEpgStore->getWindow (service.second.getSid(), nowSeconds, midnightSeconds))
+          if (epgEvent.mStart > nowSeconds) { // later today
             r.bottom = r.top + lineHeight;
-            mBoxItemVec.push_back (new cServiceEpg (this, &service.second, epgItem.second, lineHeight, r));
+            mBoxItemVec.push_back (new cServiceEpg (this, &service.second, epgEvent, lineHeight, r));
             r.top = r.bottom;
             }
-          }
         }
       r.top += lineHeight/4.f;
       r.bottom = r.top + lineHeight;
       }
 
-    // draw services boxItems
-    auto bgndRect = mRect;
-    bgndRect.bottom = r.bottom;
-    dc->FillRectangle (bgndRect, mWindow->getTransparentBgndBrush());
+    mBgndRect = mRect;
+    mBgndRect.bottom = r.bottom;
+    }
+  //}}}
+  //{{{
+  bool servicesChanged() {
+  // items hold cService pointers into mServiceMap, any add, remove or move rebuilds them
+
+    if (mTs->mServiceMap.size() != mServices.size())
+      return true;
+
+    auto it = mServices.begin();
+    for (auto& service : mTs->mServiceMap) {
+      if ((service.first != it->first) || (&service.second != it->second))
+        return true;
+      ++it;
+      }
+
+    return false;
+    }
+  //}}}
+  //{{{
+  static cEpgItem* findEpgItem (cService* service, int64_t start) {
+  // record flag lives on the ts epgItem, transport stream records from it
+
+    for (auto epgItem : service->getEpgItemMap())
+      if (std::chrono::duration_cast<std::chrono::seconds>(epgItem.second->getTime().time_since_epoch()).count() == start)
+        return epgItem.second;
+
+    return nullptr;
+    }
+  //}}}
+  //{{{
+  void draw (ID2D1DeviceContext* dc) {
+
+    dc->FillRectangle (mBgndRect, mWindow->getTransparentBgndBrush());
     for (auto boxItem : mBoxItemVec)
       boxItem->onDraw (dc);
     }
@@ -139,8 +198,17 @@ protected:
 
   // vars
   cTransportStream* mTs;
+  cEpgStore* mEpgStore;
   std::vector<cBoxItem*> mBoxItemVec;
 
+  // what the items were laid out from
+  bool mDirty = true;
+  uint32_t mEpgVersion = 0;
+  int64_t mMinute = 0;
+  std::vector<std::pair<int,cService*>> mServices;
+  cRect mLayoutRect;
+  cRect mBgndRect;
+
 private:
   //{{{
   class cServiceName : public cBoxItem {
@@ -186,18 +254,28 @@ private:
   //{{{
   class cServiceEpg : public cBoxItem {
   public:
-    cServiceEpg (cTsEpgBox* box, cService* service, cEpgItem* epgItem, float textHeight, cRect r) :
-        cBoxItem(box, service, textHeight, r), mEpgItem(epgItem) {
-      mStr = "  " + date::format ("%H:%M", floor<std::chrono::seconds>(mEpgItem->getTime())) +
-             " " + mEpgItem->getTitleString();
-      mBrush = mEpgItem->getRecord() ? mBox->getWindow()->getWhiteBrush() : mBox->getWindow()->getBlueBrush();
+    cServiceEpg (cTsEpgBox* box, cService* service, const cEpgStore::sEpgEvent& epgEvent, float textHeight, cRect r) :
+        cBoxItem(box, service, textHeight, r), mStart(epgEvent.mStart) {
+      mStr = "  " + date::format ("%H:%M", std::chrono::system_clock::time_point (std::chrono::seconds (epgEvent.mStart))) +
+             " " + epgEvent.mTitle;
+      auto epgItem = findEpgItem (mService, mStart);
+      mBrush = (epgItem && epgItem->getRecord()) ? mBox->getWindow()->getWhiteBrush() : mBox->getWindow()->getBlueBrush();
       }
     virtual ~cServiceEpg() {}
 
-    virtual void onDown() { mEpgItem->toggleRecord(); }
+    //{{{
+    virtual void onDown() {
+    // epgItem looked up on click, ts may have replaced it since layout
+
+      std::lock_guard<std::mutex> lockGuard (mBox->mTs->mMutex);
+      auto epgItem = findEpgItem (mService, mStart);
+      if (epgItem)
+        epgItem->toggleRecord();
+      }
+    //}}}
 
   private:
-    cEpgItem* mEpgItem;
+    int64_t mStart;
     };
   //}}}
   };
@@ -0,0 +1,562 @@
+// cYuvBgra.h - yuv420 planar or nv12 to bgra, row bands spread over a thread pool
+// - scalar, SSE2, AVX2, NEON kernels picked at runtime, same cpu checks as cMpeg2mc
+// - BT.601 or BT.709, limited or full range, 6 bit fixed point, chroma nearest sampled
+// - nv12 read in place, no deinterleave, writes caller buffer, streaming stores when aligned
+#pragma once
+//{{{  includes
+#include <stdint.h>
+#include <string.h>
+
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include "decoders/cMpeg2mc.h"
+//}}}
+
+class cYuvBgra {
+public:
+  enum eMatrix { eBt601, eBt709 };
+
+  //{{{
+  struct sCoefs {
+  // 6 bit fixed point, y = (Y - mYoff) * mY
+    int16_t mY;
+    int16_t mYoff;
+    int16_t mRv;
+    int16_t mGu;
+    int16_t mGv;
+    int16_t mBu;
+    };
+  //}}}
+  // convert row pair, y1/dst1 may alias y0/dst0 for odd last row, u is uv for nv12
+  typedef void (*tRows) (const uint8_t* y0, const uint8_t* y1, const uint8_t* u, const uint8_t* v,
+                         uint32_t* dst0, uint32_t* dst1, int width, const sCoefs& coefs);
+  //{{{
+  struct sKernels {
+    const char* mName;
+    tRows mRows[2][2]; // [nv12][stream]
+    };
+  //}}}
+
+  //{{{
+  cYuvBgra (int numThreads = 0) {
+  // numThreads including caller, 0 for all cores
+
+    if (numThreads <= 0)
+      numThreads = (int)std::thread::hardware_concurrency();
+    for (int i = 1; i < numThreads; i++)
+      mThreads.push_back (std::thread ([=]() { bandThread(); }));
+
+    setIsa (cMpeg2mc::getBestIsa());
+    }
+  //}}}
+  //{{{
+  ~cYuvBgra() {
+
+    {
+    std::unique_lock<std::mutex> lock (mMutex);
+    mExit = true;
+    mStart.notify_all();
+    }
+
+    for (auto& thread : mThreads)
+      thread.join();
+    }
+  //}}}
+
+  cYuvBgra (const cYuvBgra&) = delete;
+  cYuvBgra& operator = (const cYuvBgra&) = delete;
+
+  //{{{
+  static const sKernels* getKernels (cMpeg2mc::eIsa isa) {
+  // return kernels for isa, nullptr if not built for this target
+
+    static const sKernels kScalar = { "scalar", { { rowsScalar<false>, rowsScalar<false> },
+                                                  { rowsScalar<true>, rowsScalar<true> } } };
+  #if defined(MPEG2MC_SSE2)
+    static const sKernels kSse2 = { "sse2", { { rowsSse2<false,false>, rowsSse2<false,true> },
+                                              { rowsSse2<true,false>, rowsSse2<true,true> } } };
+    static const sKernels kAvx2 = { "avx2", { { rowsAvx2<false,false>, rowsAvx2<false,true> },
+                                              { rowsAvx2<true,false>, rowsAvx2<true,true> } } };
+  #elif defined(MPEG2MC_NEON)
+    static const sKernels kNeon = { "neon", { { rowsNeon<false>, rowsNeon<false> },
+                                              { rowsNeon<true>, rowsNeon<true> } } };
+  #endif
+
+    switch (isa) {
+      case cMpeg2mc::eScalar: return &kScalar;
+    #if defined(MPEG2MC_SSE2)
+      case cMpeg2mc::eSse2: return &kSse2;
+      case cMpeg2mc::eAvx2: return cMpeg2mc::hasAvx2() ? &kAvx2 : nullptr;
+    #elif defined(MPEG2MC_NEON)
+      case cMpeg2mc::eNeon: return &kNeon;
+    #endif
+      default: return nullptr;
+      }
+    }
+  //}}}
+  //{{{
+  static const sCoefs& getCoefs (eMatrix matrix, bool fullRange) {
+
+    static const sCoefs kCoefs[2][2] = {
+      // limited 16..235, full 0..255
+      { { 74, 16, 102, 25, 52, 129 }, { 64, 0,  90, 22, 46, 113 } },  // BT.601
+      { { 74, 16, 115, 14, 34, 135 }, { 64, 0, 101, 12, 30, 119 } } }; // BT.709
+
+    return kCoefs[matrix][fullRange ? 1 : 0];
+    }
+  //}}}
+  //{{{
+  bool setIsa (cMpeg2mc::eIsa isa) {
+
+    auto kernels = getKernels (isa);
+    if (!kernels)
+      return false;
+
+    mKernels = kernels;
+    return true;
+    }
+  //}}}
+  const char* getIsaName() { return mKernels->mName; }
+
+  //{{{
+  void convertNv12 (const uint8_t* y, int yStride, const uint8_t* uv, int uvStride, int width, int height,
+                    uint32_t* dst, int dstStride, eMatrix matrix = eBt601, bool fullRange = false) {
+  // dstStride in pixels
+
+    convert ({ y, uv, nullptr, yStride, uvStride, width, height, dst, dstStride, true }, matrix, fullRange);
+    }
+  //}}}
+  //{{{
+  void convertYuv420 (const uint8_t* y, int yStride, const uint8_t* u, const uint8_t* v, int uvStride,
+                      int width, int height, uint32_t* dst, int dstStride,
+                      eMatrix matrix = eBt601, bool fullRange = false) {
+  // dstStride in pixels
+
+    convert ({ y, u, v, yStride, uvStride, width, height, dst, dstStride, false }, matrix, fullRange);
+    }
+  //}}}
+
+private:
+  static const int kBandRows = 32;
+
+  //{{{
+  struct sJob {
+    const uint8_t* mY;
+    const uint8_t* mU;
+    const uint8_t* mV;
+    int mYStride;
+    int mUVStride;
+    int mWidth;
+    int mHeight;
+
+    uint32_t* mDst;
+    int mDstStride;
+
+    bool mNv12;
+    };
+  //}}}
+
+  //{{{
+  void convert (const sJob& job, eMatrix matrix, bool fullRange) {
+  // one conversion at a time, caller works bands alongside the pool
+
+    std::unique_lock<std::mutex> convertLock (mConvertMutex);
+
+    mJob = job;
+    mCoefs = getCoefs (matrix, fullRange);
+
+    // streaming stores need 64 byte aligned rows, they bypass cache on the way to an upload buffer
+    bool stream = !((uintptr_t)job.mDst & 63) && !(job.mDstStride & 15);
+    mRows = mKernels->mRows[job.mNv12 ? 1 : 0][stream ? 1 : 0];
+
+    mNumBands = (job.mHeight + kBandRows - 1) / kBandRows;
+    mNextBand = 0;
+
+    if (mThreads.empty() || (mNumBands == 1)) {
+      convertBands();
+      return;
+      }
+
+    {
+    std::unique_lock<std::mutex> lock (mMutex);
+    mBusyThreads = (int)mThreads.size();
+    mGeneration++;
+    mStart.notify_all();
+    }
+
+    convertBands();
+
+    std::unique_lock<std::mutex> lock (mMutex);
+    mDone.wait (lock, [&]() { return mBusyThreads == 0; });
+    }
+  //}}}
+  //{{{
+  void convertBands() {
+  // take bands until none left, bands write disjoint rows of dst
+
+    for (int band = mNextBand++; band < mNumBands; band = mNextBand++) {
+      int lastRow = std::min ((band + 1) * kBandRows, mJob.mHeight);
+      for (int row = band * kBandRows; row < lastRow; row += 2) {
+        int row1 = (row + 1 < lastRow) ? row + 1 : row;
+        auto u = mJob.mU + (row/2) * mJob.mUVStride;
+        auto v = mJob.mNv12 ? nullptr : mJob.mV + (row/2) * mJob.mUVStride;
+        mRows (mJob.mY + row * mJob.mYStride, mJob.mY + row1 * mJob.mYStride, u, v,
+               mJob.mDst + row * mJob.mDstStride, mJob.mDst + row1 * mJob.mDstStride, mJob.mWidth, mCoefs);
+        }
+      }
+
+  #if defined(MPEG2MC_SSE2)
+    // order any streaming stores before caller sees dst
+    _mm_sfence();
+  #endif
+    }
+  //}}}
+  //{{{
+  void bandThread() {
+
+    int generation = 0;
+    while (true) {
+      {
+      std::unique_lock<std::mutex> lock (mMutex);
+      mStart.wait (lock, [&]() { return mExit || (mGeneration != generation); });
+      if (mExit)
+        return;
+      generation = mGeneration;
+      }
+
+      convertBands();
+
+      std::unique_lock<std::mutex> lock (mMutex);
+      if (--mBusyThreads == 0)
+        mDone.notify_one();
+      }
+    }
+  //}}}
+
+  // scalar reference, SIMD kernels match it exactly
+  //{{{
+  static int16_t sat16 (int value) {
+    return (int16_t)((value < -32768) ? -32768 : (value > 32767) ? 32767 : value);
+    }
+  //}}}
+  //{{{
+  static uint32_t pack (int r, int g, int b) {
+
+    r = (r < 0) ? 0 : (r > 255) ? 255 : r;
+    g = (g < 0) ? 0 : (g > 255) ? 255 : g;
+    b = (b < 0) ? 0 : (b > 255) ? 255 : b;
+    return 0xFF000000 | (r << 16) | (g << 8) | b;
+    }
+  //}}}
+  //{{{
+  template <bool nv12>
+  static void rowsScalar (const uint8_t* y0, const uint8_t* y1, const uint8_t* u, const uint8_t* v,
+                          uint32_t* dst0, uint32_t* dst1, int width, const sCoefs& coefs) {
+
+    for (int x = 0; x < width; x++) {
+      int uu = (nv12 ? u[x & ~1] : u[x/2]) - 128;
+      int vv = (nv12 ? u[x | 1] : v[x/2]) - 128;
+      int rv = coefs.mRv * vv;
+      int gu = coefs.mGu * uu;
+      int gv = coefs.mGv * vv;
+      int bu = coefs.mBu * uu;
+
+      int yy = (y0[x] - coefs.mYoff) * coefs.mY + 32;
+      dst0[x] = pack (sat16 (yy + rv) >> 6, sat16 (sat16 (yy - gu) - gv) >> 6, sat16 (yy + bu) >> 6);
+      yy = (y1[x] - coefs.mYoff) * coefs.mY + 32;
+      dst1[x] = pack (sat16 (yy + rv) >> 6, sat16 (sat16 (yy - gu) - gv) >> 6, sat16 (yy + bu) >> 6);
+      }
+    }
+  //}}}
+
+#if defined(MPEG2MC_SSE2)
+  //{{{
+  template <bool stream>
+  static void storeSse2 (uint32_t* dst, __m128i ylo, __m128i yhi,
+                         __m128i rvlo, __m128i rvhi, __m128i gulo, __m128i guhi,
+                         __m128i gvlo, __m128i gvhi, __m128i bulo, __m128i buhi) {
+  // 16 pixels, 16 bit y terms plus chroma terms, saturate, shift, pack, interleave bgra
+
+    __m128i r = _mm_packus_epi16 (_mm_srai_epi16 (_mm_adds_epi16 (ylo, rvlo), 6),
+                                  _mm_srai_epi16 (_mm_adds_epi16 (yhi, rvhi), 6));
+    __m128i g = _mm_packus_epi16 (_mm_srai_epi16 (_mm_subs_epi16 (_mm_subs_epi16 (ylo, gulo), gvlo), 6),
+                                  _mm_srai_epi16 (_mm_subs_epi16 (_mm_subs_epi16 (yhi, guhi), gvhi), 6));
+    __m128i b = _mm_packus_epi16 (_mm_srai_epi16 (_mm_adds_epi16 (ylo, bulo), 6),
+                                  _mm_srai_epi16 (_mm_adds_epi16 (yhi, buhi), 6));
+
+    __m128i alpha = _mm_set1_epi8 ((char)0xFF);
+    __m128i bglo = _mm_unpacklo_epi8 (b, g);
+    __m128i bghi = _mm_unpackhi_epi8 (b, g);
+    __m128i ralo = _mm_unpacklo_epi8 (r, alpha);
+    __m128i rahi = _mm_unpackhi_epi8 (r, alpha);
+
+    __m128i* dst128 = (__m128i*)dst;
+    if (stream) {
+      _mm_stream_si128 (dst128, _mm_unpacklo_epi16 (bglo, ralo));
+      _mm_stream_si128 (dst128+1, _mm_unpackhi_epi16 (bglo, ralo));
+      _mm_stream_si128 (dst128+2, _mm_unpacklo_epi16 (bghi, rahi));
+      _mm_stream_si128 (dst128+3, _mm_unpackhi_epi16 (bghi, rahi));
+      }
+    else {
+      _mm_storeu_si128 (dst128, _mm_unpacklo_epi16 (bglo, ralo));
+      _mm_storeu_si128 (dst128+1, _mm_unpackhi_epi16 (bglo, ralo));
+      _mm_storeu_si128 (dst128+2, _mm_unpacklo_epi16 (bghi, rahi));
+      _mm_storeu_si128 (dst128+3, _mm_unpackhi_epi16 (bghi, rahi));
+      }
+    }
+  //}}}
+  //{{{
+  template <bool nv12, bool stream>
+  static void rowsSse2 (const uint8_t* y0, const uint8_t* y1, const uint8_t* u, const uint8_t* v,
+                        uint32_t* dst0, uint32_t* dst1, int width, const sCoefs& coefs) {
+  // 16 pixels of row pair per loop, chroma terms shared by both rows
+
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i uvOff = _mm_set1_epi16 (128);
+    const __m128i yOff = _mm_set1_epi16 (coefs.mYoff);
+    const __m128i round = _mm_set1_epi16 (32);
+    const __m128i cy = _mm_set1_epi16 (coefs.mY);
+    const __m128i crv = _mm_set1_epi16 (coefs.mRv);
+    const __m128i cgu = _mm_set1_epi16 (coefs.mGu);
+    const __m128i cgv = _mm_set1_epi16 (coefs.mGv);
+    const __m128i cbu = _mm_set1_epi16 (coefs.mBu);
+
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+      __m128i uu, vv;
+      if (nv12) {
+        // 8 uv pairs, u in low byte of each 16 bit lane, v in high byte
+        __m128i uv = _mm_loadu_si128 ((const __m128i*)(u + x));
+        uu = _mm_sub_epi16 (_mm_and_si128 (uv, _mm_set1_epi16 (0xFF)), uvOff);
+        vv = _mm_sub_epi16 (_mm_srli_epi16 (uv, 8), uvOff);
+        }
+      else {
+        uu = _mm_sub_epi16 (_mm_unpacklo_epi8 (_mm_loadl_epi64 ((const __m128i*)(u + x/2)), zero), uvOff);
+        vv = _mm_sub_epi16 (_mm_unpacklo_epi8 (_mm_loadl_epi64 ((const __m128i*)(v + x/2)), zero), uvOff);
+        }
+
+      // chroma to pixel pairs
+      __m128i ulo = _mm_unpacklo_epi16 (uu, uu);
+      __m128i uhi = _mm_unpackhi_epi16 (uu, uu);
+      __m128i vlo = _mm_unpacklo_epi16 (vv, vv);
+      __m128i vhi = _mm_unpackhi_epi16 (vv, vv);
+      __m128i rvlo = _mm_mullo_epi16 (vlo, crv);
+      __m128i rvhi = _mm_mullo_epi16 (vhi, crv);
+      __m128i gulo = _mm_mullo_epi16 (ulo, cgu);
+      __m128i guhi = _mm_mullo_epi16 (uhi, cgu);
+      __m128i gvlo = _mm_mullo_epi16 (vlo, cgv);
+      __m128i gvhi = _mm_mullo_epi16 (vhi, cgv);
+      __m128i bulo = _mm_mullo_epi16 (ulo, cbu);
+      __m128i buhi = _mm_mullo_epi16 (uhi, cbu);
+
+      __m128i yy = _mm_loadu_si128 ((const __m128i*)(y0 + x));
+      storeSse2<stream> (dst0 + x,
+        _mm_add_epi16 (_mm_mullo_epi16 (_mm_sub_epi16 (_mm_unpacklo_epi8 (yy, zero), yOff), cy), round),
+        _mm_add_epi16 (_mm_mullo_epi16 (_mm_sub_epi16 (_mm_unpackhi_epi8 (yy, zero), yOff), cy), round),
+        rvlo, rvhi, gulo, guhi, gvlo, gvhi, bulo, buhi);
+
+      yy = _mm_loadu_si128 ((const __m128i*)(y1 + x));
+      storeSse2<stream> (dst1 + x,
+        _mm_add_epi16 (_mm_mullo_epi16 (_mm_sub_epi16 (_mm_unpacklo_epi8 (yy, zero), yOff), cy), round),
+        _mm_add_epi16 (_mm_mullo_epi16 (_mm_sub_epi16 (_mm_unpackhi_epi8 (yy, zero), yOff), cy), round),
+        rvlo, rvhi, gulo, guhi, gvlo, gvhi, bulo, buhi);
+      }
+
+    if (x < width)
+      rowsScalar<nv12> (y0 + x, y1 + x, u + (nv12 ? x : x/2), nv12 ? nullptr : v + x/2,
+                        dst0 + x, dst1 + x, width - x, coefs);
+    }
+  //}}}
+
+  //{{{
+  template <bool stream>
+  MPEG2MC_AVX2_TARGET static void storeAvx2 (uint32_t* dst, __m256i ylo, __m256i yhi,
+                                             __m256i rvlo, __m256i rvhi, __m256i gulo, __m256i guhi,
+                                             __m256i gvlo, __m256i gvhi, __m256i bulo, __m256i buhi) {
+  // 32 pixels, lo/hi hold pixels 0-7,16-23 / 8-15,24-31 from in lane unpacks, packs restore order
+
+    __m256i r = _mm256_packus_epi16 (_mm256_srai_epi16 (_mm256_adds_epi16 (ylo, rvlo), 6),
+                                     _mm256_srai_epi16 (_mm256_adds_epi16 (yhi, rvhi), 6));
+    __m256i g = _mm256_packus_epi16 (
+      _mm256_srai_epi16 (_mm256_subs_epi16 (_mm256_subs_epi16 (ylo, gulo), gvlo), 6),
+      _mm256_srai_epi16 (_mm256_subs_epi16 (_mm256_subs_epi16 (yhi, guhi), gvhi), 6));
+    __m256i b = _mm256_packus_epi16 (_mm256_srai_epi16 (_mm256_adds_epi16 (ylo, bulo), 6),
+                                     _mm256_srai_epi16 (_mm256_adds_epi16 (yhi, buhi), 6));
+
+    __m256i alpha = _mm256_set1_epi8 ((char)0xFF);
+    __m256i bglo = _mm256_unpacklo_epi8 (b, g);
+    __m256i bghi = _mm256_unpackhi_epi8 (b, g);
+    __m256i ralo = _mm256_unpacklo_epi8 (r, alpha);
+    __m256i rahi = _mm256_unpackhi_epi8 (r, alpha);
+
+    // pixels 0-3,16-19  4-7,20-23  8-11,24-27  12-15,28-31
+    __m256i p0 = _mm256_unpacklo_epi16 (bglo, ralo);
+    __m256i p1 = _mm256_unpackhi_epi16 (bglo, ralo);
+    __m256i p2 = _mm256_unpacklo_epi16 (bghi, rahi);
+    __m256i p3 = _mm256_unpackhi_epi16 (bghi, rahi);
+
+    __m256i* dst256 = (__m256i*)dst;
+    if (stream) {
+      _mm256_stream_si256 (dst256, _mm256_permute2x128_si256 (p0, p1, 0x20));
+      _mm256_stream_si256 (dst256+1, _mm256_permute2x128_si256 (p2, p3, 0x20));
+      _mm256_stream_si256 (dst256+2, _mm256_permute2x128_si256 (p0, p1, 0x31));
+      _mm256_stream_si256 (dst256+3, _mm256_permute2x128_si256 (p2, p3, 0x31));
+      }
+    else {
+      _mm256_storeu_si256 (dst256, _mm256_permute2x128_si256 (p0, p1, 0x20));
+      _mm256_storeu_si256 (dst256+1, _mm256_permute2x128_si256 (p2, p3, 0x20));
+      _mm256_storeu_si256 (dst256+2, _mm256_permute2x128_si256 (p0, p1, 0x31));
+      _mm256_storeu_si256 (dst256+3, _mm256_permute2x128_si256 (p2, p3, 0x31));
+      }
+    }
+  //}}}
+  //{{{
+  template <bool nv12, bool stream>
+  MPEG2MC_AVX2_TARGET static void rowsAvx2 (const uint8_t* y0, const uint8_t* y1, const uint8_t* u, const uint8_t* v,
+                                            uint32_t* dst0, uint32_t* dst1, int width, const sCoefs& coefs) {
+  // 32 pixels of row pair per loop, chroma terms shared by both rows
+
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i uvOff = _mm256_set1_epi16 (128);
+    const __m256i yOff = _mm256_set1_epi16 (coefs.mYoff);
+    const __m256i round = _mm256_set1_epi16 (32);
+    const __m256i cy = _mm256_set1_epi16 (coefs.mY);
+    const __m256i crv = _mm256_set1_epi16 (coefs.mRv);
+    const __m256i cgu = _mm256_set1_epi16 (coefs.mGu);
+    const __m256i cgv = _mm256_set1_epi16 (coefs.mGv);
+    const __m256i cbu = _mm256_set1_epi16 (coefs.mBu);
+
+    int x = 0;
+    for (; x + 32 <= width; x += 32) {
+      // 16 chroma samples in order
+      __m256i uu, vv;
+      if (nv12) {
+        __m256i uv = _mm256_loadu_si256 ((const __m256i*)(u + x));
+        uu = _mm256_sub_epi16 (_mm256_and_si256 (uv, _mm256_set1_epi16 (0xFF)), uvOff);
+        vv = _mm256_sub_epi16 (_mm256_srli_epi16 (uv, 8), uvOff);
+        }
+      else {
+        uu = _mm256_sub_epi16 (_mm256_cvtepu8_epi16 (_mm_loadu_si128 ((const __m128i*)(u + x/2))), uvOff);
+        vv = _mm256_sub_epi16 (_mm256_cvtepu8_epi16 (_mm_loadu_si128 ((const __m128i*)(v + x/2))), uvOff);
+        }
+
+      // in lane unpacks line chroma pairs up with in lane y unpacks
+      __m256i ulo = _mm256_unpacklo_epi16 (uu, uu);
+      __m256i uhi = _mm256_unpackhi_epi16 (uu, uu);
+      __m256i vlo = _mm256_unpacklo_epi16 (vv, vv);
+      __m256i vhi = _mm256_unpackhi_epi16 (vv, vv);
+      __m256i rvlo = _mm256_mullo_epi16 (vlo, crv);
+      __m256i rvhi = _mm256_mullo_epi16 (vhi, crv);
+      __m256i gulo = _mm256_mullo_epi16 (ulo, cgu);
+      __m256i guhi = _mm256_mullo_epi16 (uhi, cgu);
+      __m256i gvlo = _mm256_mullo_epi16 (vlo, cgv);
+      __m256i gvhi = _mm256_mullo_epi16 (vhi, cgv);
+      __m256i bulo = _mm256_mullo_epi16 (ulo, cbu);
+      __m256i buhi = _mm256_mullo_epi16 (uhi, cbu);
+
+      __m256i yy = _mm256_loadu_si256 ((const __m256i*)(y0 + x));
+      storeAvx2<stream> (dst0 + x,
+        _mm256_add_epi16 (_mm256_mullo_epi16 (_mm256_sub_epi16 (_mm256_unpacklo_epi8 (yy, zero), yOff), cy), round),
+        _mm256_add_epi16 (_mm256_mullo_epi16 (_mm256_sub_epi16 (_mm256_unpackhi_epi8 (yy, zero), yOff), cy), round),
+        rvlo, rvhi, gulo, guhi, gvlo, gvhi, bulo, buhi);
+
+      yy = _mm256_loadu_si256 ((const __m256i*)(y1 + x));
+      storeAvx2<stream> (dst1 + x,
+        _mm256_add_epi16 (_mm256_mullo_epi16 (_mm256_sub_epi16 (_mm256_unpacklo_epi8 (yy, zero), yOff), cy), round),
+        _mm256_add_epi16 (_mm256_mullo_epi16 (_mm256_sub_epi16 (_mm256_unpackhi_epi8 (yy, zero), yOff), cy), round),
+        rvlo, rvhi, gulo, guhi, gvlo, gvhi, bulo, buhi);
+      }
+
+    if (x < width)
+      rowsSse2<nv12,false> (y0 + x, y1 + x, u + (nv12 ? x : x/2), nv12 ? nullptr : v + x/2,
+                            dst0 + x, dst1 + x, width - x, coefs);
+    }
+  //}}}
+#endif
+
+#if defined(MPEG2MC_NEON)
+  //{{{
+  static uint8x16_t channelNeon (int16x8_t lo, int16x8_t hi) {
+    return vcombine_u8 (vqmovun_s16 (vshrq_n_s16 (lo, 6)), vqmovun_s16 (vshrq_n_s16 (hi, 6)));
+    }
+  //}}}
+  //{{{
+  template <bool nv12>
+  static void rowsNeon (const uint8_t* y0, const uint8_t* y1, const uint8_t* u, const uint8_t* v,
+                        uint32_t* dst0, uint32_t* dst1, int width, const sCoefs& coefs) {
+  // 16 pixels of row pair per loop, vst4 interleaves bgra
+
+    const int16x8_t uvOff = vdupq_n_s16 (128);
+    const int16x8_t yOff = vdupq_n_s16 (coefs.mYoff);
+    const int16x8_t round = vdupq_n_s16 (32);
+    const int16x8_t cy = vdupq_n_s16 (coefs.mY);
+
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+      int16x8_t uu, vv;
+      if (nv12) {
+        uint8x8x2_t uv = vld2_u8 (u + x);
+        uu = vsubq_s16 (vreinterpretq_s16_u16 (vmovl_u8 (uv.val[0])), uvOff);
+        vv = vsubq_s16 (vreinterpretq_s16_u16 (vmovl_u8 (uv.val[1])), uvOff);
+        }
+      else {
+        uu = vsubq_s16 (vreinterpretq_s16_u16 (vmovl_u8 (vld1_u8 (u + x/2))), uvOff);
+        vv = vsubq_s16 (vreinterpretq_s16_u16 (vmovl_u8 (vld1_u8 (v + x/2))), uvOff);
+        }
+
+      // chroma to pixel pairs
+      int16x8x2_t uz = vzipq_s16 (uu, uu);
+      int16x8x2_t vz = vzipq_s16 (vv, vv);
+      int16x8_t rv[2], gu[2], gv[2], bu[2];
+      for (int i = 0; i < 2; i++) {
+        rv[i] = vmulq_n_s16 (vz.val[i], coefs.mRv);
+        gu[i] = vmulq_n_s16 (uz.val[i], coefs.mGu);
+        gv[i] = vmulq_n_s16 (vz.val[i], coefs.mGv);
+        bu[i] = vmulq_n_s16 (uz.val[i], coefs.mBu);
+        }
+
+      for (int row = 0; row < 2; row++) {
+        uint8x16_t yy = vld1q_u8 ((row ? y1 : y0) + x);
+        int16x8_t ylo = vaddq_s16 (vmulq_s16 (vsubq_s16 (vreinterpretq_s16_u16 (vmovl_u8 (vget_low_u8 (yy))), yOff), cy), round);
+        int16x8_t yhi = vaddq_s16 (vmulq_s16 (vsubq_s16 (vreinterpretq_s16_u16 (vmovl_u8 (vget_high_u8 (yy))), yOff), cy), round);
+
+        uint8x16x4_t bgra;
+        bgra.val[0] = channelNeon (vqaddq_s16 (ylo, bu[0]), vqaddq_s16 (yhi, bu[1]));
+        bgra.val[1] = channelNeon (vqsubq_s16 (vqsubq_s16 (ylo, gu[0]), gv[0]), vqsubq_s16 (vqsubq_s16 (yhi, gu[1]), gv[1]));
+        bgra.val[2] = channelNeon (vqaddq_s16 (ylo, rv[0]), vqaddq_s16 (yhi, rv[1]));
+        bgra.val[3] = vdupq_n_u8 (0xFF);
+        vst4q_u8 ((uint8_t*)((row ? dst1 : dst0) + x), bgra);
+        }
+      }
+
+    if (x < width)
+      rowsScalar<nv12> (y0 + x, y1 + x, u + (nv12 ? x : x/2), nv12 ? nullptr : v + x/2,
+                        dst0 + x, dst1 + x, width - x, coefs);
+    }
+  //}}}
+#endif
+
+  const sKernels* mKernels = nullptr;
+
+  // current conversion
+  std::mutex mConvertMutex;
+  sJob mJob;
+  sCoefs mCoefs;
+  tRows mRows = nullptr;
+  int mNumBands = 0;
+  std::atomic<int> mNextBand = { 0 };
+
+  // band threads, caller is the extra one
+  std::vector<std::thread> mThreads;
+  std::mutex mMutex;
+  std::condition_variable mStart;
+  std::condition_variable mDone;
+  int mGeneration = 0;
+  int mBusyThreads = 0;
+  bool mExit = false;
+  };
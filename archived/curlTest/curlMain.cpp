@@ -14,8 +14,10 @@
 #include <stdint.h>
 #include <string.h>
 
+#include <vector>
 #include <thread>
 
+#include "../../shared/utils/utils.h"
 #include "../../shared/utils/cLog.h"
 #include "../../shared/utils/cWinAudio.h"
 #include "../../shared/utils/cBipBuffer.h"
@@ -23,16 +25,19 @@
 #define CURL_STATICLIB
 #include "../../curl/include/curl/curl.h"
 
-extern "C" {
-  #include <libavcodec/avcodec.h>
-  #include <libavformat/avformat.h>
-  }
+#include "../decoders/cAudioFramer.h"
+#include "../decoders/cAacDecoder.h"
+#include "../decoders/cMp3Decoder.h"
+#include "../cAudFramePool.h"
 
 using namespace std;
 //}}}
 
 CURL* curl;
 cBipBuffer mBipBuffer;
+
+// decoded frames, read thread produces, play thread consumes, 5.1 aac he is 6 channels of 2048
+cAudFramePool mAudFramePool (32, 6, 2048);
 //{{{
 static size_t header (void* ptr, size_t size, size_t nmemb, void* stream) {
 
@@ -95,25 +100,36 @@ void readThread() {
     }
     //}}}
 
-  char* contentType = NULL;
-  bool ok = (curl_easy_getinfo (curl, CURLINFO_CONTENT_TYPE, &contentType) == 0);
-  bool aac = ok && contentType && (strcmp (contentType, "audio/aacp") == 0);
+  iAudioDecoder* decoder = nullptr;
 
-  AVCodecID streamType = aac ? AV_CODEC_ID_AAC : AV_CODEC_ID_MP3;
-  auto parser = av_parser_init (streamType);
-  auto codec = avcodec_find_decoder (streamType);
-  auto context = avcodec_alloc_context3 (codec);
-  avcodec_open2 (context, codec, NULL);
+  // pts counted in samples
+  int64_t pts = 0;
 
-  AVPacket avPacket;
-  av_init_packet (&avPacket);
-  avPacket.data = 0;
-  avPacket.size = 0;
+  // framer emits frames in place from the bipBuffer block, copies only frames straddling blocks
+  cAudioFramer framer ([&](eAudioFrameType frameType, const uint8_t* frame, int frameLength) {
+    if (!decoder) {
+      cLog::log (LOGINFO, "decoder %s", frameType == eAudioFrameType::eMp3 ? "mp3" : "aac");
+      decoder = (frameType == eAudioFrameType::eMp3) ? (iAudioDecoder*)new cMp3Decoder() : new cAacDecoder();
+      }
 
-  auto avFrame = av_frame_alloc();
-  auto samples = (int16_t*)malloc (2048 * 2 * 2);
+    auto pcm = decoder->decodeFrame (frame, frameLength, 0);
+    if (pcm) {
+      //{{{  copy into pool frame, wait for play thread to release one
+      auto numSamples = decoder->getNumSamplesPerFrame();
 
-  cWinAudio audio (2, 44100);
+      cAudFrame* audFrame;
+      while (!(audFrame = mAudFramePool.getWriteFrame()))
+        Sleep (10);
+
+      audFrame->set (pts, numSamples, pts, decoder->getNumChannels(), numSamples);
+      memcpy (audFrame->mSamples, pcm, audFrame->mChannels * numSamples * sizeof(float));
+      mAudFramePool.commitWrite();
+
+      pts += numSamples;
+      free (pcm);
+      }
+      //}}}
+    });
 
   while (true) {
     int srcSize = 0;
@@ -124,65 +140,48 @@ void readThread() {
       }
     else {
       cLog::log (LOGINFO, "body %d %x", srcSize, srcPtr);
-      //{{{  ffmpeg decode and play block
-      auto bytesLeft = srcSize;
-      while (bytesLeft) {
-        auto bytesUsed = av_parser_parse2 (parser, context, &avPacket.data, &avPacket.size, srcPtr, bytesLeft, 0, 0, AV_NOPTS_VALUE);
-        srcPtr += bytesUsed;
-        srcSize -= bytesUsed;
-        if (avPacket.size) {
-          auto ret = avcodec_send_packet (context, &avPacket);
-          while (ret >= 0) {
-            ret = avcodec_receive_frame (context, avFrame);
-            if (ret == AVERROR(EAGAIN) || ret == AVERROR_EOF || ret < 0)
-              break;
-
-            switch (context->sample_fmt) {
-              case AV_SAMPLE_FMT_S16P:
-                //{{{  16bit signed planar, copy planar to interleaved, calc channel power
-                for (auto channel = 0; channel < avFrame->channels; channel++) {
-                  auto srcPtr = (short*)avFrame->data[channel];
-                  auto dstPtr = (short*)(samples) + channel;
-                  for (auto i = 0; i < avFrame->nb_samples; i++) {
-                    auto sample = *srcPtr++;
-                    *dstPtr = sample;
-                    dstPtr += avFrame->channels;
-                    }
-                  }
-
-                break;
-                //}}}
-              case AV_SAMPLE_FMT_FLTP:
-                //{{{  32bit float planar, copy planar channel to interleaved, calc channel power
-                for (auto channel = 0; channel < avFrame->channels; channel++) {
-                  auto srcPtr = (float*)avFrame->data[channel];
-                  auto dstPtr = (short*)(samples) + channel;
-                  for (auto i = 0; i < avFrame->nb_samples; i++) {
-                    auto sample = (short)(*srcPtr++ * 0x8000);
-                    *dstPtr = sample;
-                    dstPtr += avFrame->channels;
-                    }
-                  }
-
-                break;
-                //}}}
-              default:;
-              }
-            audio.play (avFrame->channels, (int16_t*)samples, avFrame->nb_samples, 1.f);
-            }
-          }
-        }
-      //}}}
+      framer.push (srcPtr, srcSize);
       mBipBuffer.decommitBlock (srcSize);
       }
     }
 
-  free (samples);
-  av_frame_free (&avFrame);
-  if (context)
-    avcodec_close (context);
-  if (parser)
-    av_parser_close (parser);
+  delete decoder;
+
+  CoUninitialize();
+  }
+//}}}
+//{{{
+void playThread() {
+
+  CoInitializeEx (NULL, COINIT_MULTITHREADED);
+  cLog::setThreadName ("play");
+
+  cWinAudio audio (2, 44100);
+  vector<int16_t> samples;
+
+  int64_t playPts = 0;
+  while (true) {
+    auto audFrame = mAudFramePool.findPts (playPts);
+    if (!audFrame) {
+      Sleep (10);
+      continue;
+      }
+
+    //{{{  32bit float interleaved to 16bit signed interleaved, play
+    // sized per frame, 5.1 aac is 6 channels of 1024
+    samples.resize (audFrame->mChannels * audFrame->mNumSamples);
+    for (size_t i = 0; i < samples.size(); i++) {
+      auto sample = audFrame->mSamples[i] * 0x8000;
+      samples[i] = sample >= 32767.f ? 32767 : sample <= -32768.f ? -32768 : (int16_t)sample;
+      }
+    //}}}
+    cLog::log (LOGINFO1, "play %d power %4.3f %4.3f", (int)playPts, audFrame->mPower[0], audFrame->mPower[1]);
+    audio.play (audFrame->mChannels, samples.data(), audFrame->mNumSamples, 1.f);
+
+    // hand played frame back to read thread
+    playPts = audFrame->getPtsEnd();
+    mAudFramePool.releaseBefore (playPts);
+    }
 
   CoUninitialize();
   }
@@ -196,7 +195,6 @@ int main (int argc, char *argv[]) {
   const char* url = argc > 1 ? argv[1] : "http://stream.wqxr.org/wqxr.aac";
   cLog::log (LOGNOTICE, "curl test %s", url);
 
-  avcodec_register_all();
   mBipBuffer.allocateBuffer (8192 * 1024);
 
   WSADATA wsaData;
@@ -207,6 +205,7 @@ int main (int argc, char *argv[]) {
   if (curl) {
     thread ([=]() { httpThread (url); }).detach();
     thread ([=]() { readThread(); }).detach();
+    thread ([=]() { playThread(); }).detach();
     }
   else
     cLog::log (LOGERROR, "curl_easy_init error");
@@ -1,7 +1,9 @@
 // cAacDecoder.cpp - 32bit fixed point aac sbr, based on real networks helix 2005, slow but portable
 //{{{  includes
 #define _CRT_SECURE_NO_WARNINGS
+#include <cstring>
 #include <algorithm>
+#include <chrono>
 
 #include "cAacDecoder.h"
 
@@ -2403,9 +2405,9 @@ float* cAacDecoder::decodeFrame (const uint8_t* framePtr, int frameLen, int64_t
   mNumSamples = AAC_MAX_NSAMPS * (mSbrEnabled ? 2 : 1);
 
   auto took = duration_cast<microseconds>(system_clock::now() - timePoint).count();
-  cLog::log (LOGINFO1, "aac frameNum:%d %dx%d %3dus %c%c%c%c",
-             frameNum, mNumSamples, mNumChannels, int(took),
-             jumped ? 'j':' ', mSbrEnabled ? 's':' ', mTnsUsed ? 't':' ', mPnsUsed ? 'p':' ');
+  cLog::log (LOGINFO1, "aac pts:%lld %dx%d %3dus %c%c%c",
+             (long long)pts, mNumSamples, mNumChannels, int(took),
+             mSbrEnabled ? 's':' ', mTnsUsed ? 't':' ', mPnsUsed ? 'p':' ');
 
   return outBuffer;
   }
@@ -0,0 +1,327 @@
+// cAudioFrameIndex.cpp - sparse mp3/aac frame index for seeking
+//{{{  includes
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+
+#include "cAudioFrameIndex.h"
+#include "cAudioParser.h"
+
+#include "../utils/cLog.h"
+//}}}
+//{{{  sidecar defines
+// little endian fields written one by one, header then entries
+#define INDEX_MAGIC    0x58444941  // 'AIDX'
+#define INDEX_VERSION  2
+
+// magic, version, frameType, numChannels, sampleRate, samplesPerFrame, interval, numEntries 32 bit
+// numFrames, fileSize 64 bit
+#define HEADER_BYTES   (8*4 + 2*8)
+
+// entry packed as 4 bytes offset delta from previous entry, 2 bytes backBytes
+#define ENTRY_BYTES    6
+//}}}
+//{{{
+static void putBytes (uint8_t*& ptr, uint64_t value, int bytes) {
+
+  for (int i = 0; i < bytes; i++)
+    *ptr++ = uint8_t(value >> (i * 8));
+  }
+//}}}
+//{{{
+static uint64_t getBytes (const uint8_t*& ptr, int bytes) {
+
+  uint64_t value = 0;
+  for (int i = 0; i < bytes; i++)
+    value |= uint64_t(*ptr++) << (i * 8);
+  return value;
+  }
+//}}}
+
+// public
+//{{{
+int64_t cAudioFrameIndex::getFramePts (int64_t frameNum) {
+  return mSampleRate ? (frameNum * mSamplesPerFrame * 90000) / mSampleRate : 0;
+  }
+//}}}
+//{{{
+int64_t cAudioFrameIndex::getFrameNum (int64_t pts) {
+  return mSamplesPerFrame ? (pts * mSampleRate) / (int64_t(mSamplesPerFrame) * 90000) : 0;
+  }
+//}}}
+
+//{{{
+bool cAudioFrameIndex::build (uint8_t* buffer, uint8_t* bufferEnd) {
+// one pass over buffer, entry every mInterval frames
+
+  mEntries.clear();
+  mNumFrames = 0;
+  mFileSize = bufferEnd - buffer;
+
+  if (!parseHeader (buffer, bufferEnd))
+    return false;
+
+  sHistory history;
+  int frameLength = 0;
+  uint8_t* framePtr = cAudioParser::parseFrame (buffer, bufferEnd, frameLength);
+  while (framePtr && (frameLength > 0)) {
+    int mainDataBegin;
+    int payloadBytes;
+    parseReservoir (framePtr, frameLength, mainDataBegin, payloadBytes);
+
+    if ((mNumFrames % mInterval) == 0) {
+      int primeFrames;
+      uint8_t* primePtr = history.getPrimeFrame (mainDataBegin, primeFrames);
+      mEntries.push_back ({ uint64_t(framePtr - buffer), uint16_t(primePtr ? framePtr - primePtr : 0) });
+      }
+
+    history.push (framePtr, mainDataBegin, payloadBytes);
+    mNumFrames++;
+
+    framePtr = cAudioParser::parseFrame (framePtr + frameLength, bufferEnd, frameLength);
+    }
+
+  cLog::log (LOGINFO, "cAudioFrameIndex::build - frames:%lld entries:%d", mNumFrames, (int)mEntries.size());
+  return !mEntries.empty();
+  }
+//}}}
+
+//{{{
+bool cAudioFrameIndex::save (const std::string& fileName) {
+
+  FILE* file = fopen (fileName.c_str(), "wb");
+  if (!file) {
+    cLog::log (LOGERROR, "cAudioFrameIndex::save - failed to open " + fileName);
+    return false;
+    }
+
+  std::vector<uint8_t> sidecar (HEADER_BYTES + mEntries.size() * ENTRY_BYTES);
+  uint8_t* ptr = sidecar.data();
+  putBytes (ptr, INDEX_MAGIC, 4);
+  putBytes (ptr, INDEX_VERSION, 4);
+  putBytes (ptr, (uint32_t)mFrameType, 4);
+  putBytes (ptr, (uint32_t)mNumChannels, 4);
+  putBytes (ptr, (uint32_t)mSampleRate, 4);
+  putBytes (ptr, (uint32_t)mSamplesPerFrame, 4);
+  putBytes (ptr, (uint32_t)mInterval, 4);
+  putBytes (ptr, (uint32_t)mEntries.size(), 4);
+  putBytes (ptr, (uint64_t)mNumFrames, 8);
+  putBytes (ptr, mFileSize, 8);
+
+  uint64_t lastOffset = 0;
+  for (auto& entry : mEntries) {
+    putBytes (ptr, entry.mOffset - lastOffset, 4);
+    putBytes (ptr, entry.mBackBytes, 2);
+    lastOffset = entry.mOffset;
+    }
+
+  bool ok = fwrite (sidecar.data(), sidecar.size(), 1, file) == 1;
+  ok = (fclose (file) == 0) && ok;
+
+  return ok;
+  }
+//}}}
+//{{{
+bool cAudioFrameIndex::load (const std::string& fileName) {
+
+  FILE* file = fopen (fileName.c_str(), "rb");
+  if (!file)
+    return false;
+
+  uint8_t headerBytes [HEADER_BYTES] = { 0 };
+  const uint8_t* ptr = headerBytes;
+  bool ok = fread (headerBytes, HEADER_BYTES, 1, file) == 1;
+  uint32_t magic = (uint32_t)getBytes (ptr, 4);
+  uint32_t version = (uint32_t)getBytes (ptr, 4);
+  uint32_t frameType = (uint32_t)getBytes (ptr, 4);
+  uint32_t numChannels = (uint32_t)getBytes (ptr, 4);
+  uint32_t sampleRate = (uint32_t)getBytes (ptr, 4);
+  uint32_t samplesPerFrame = (uint32_t)getBytes (ptr, 4);
+  uint32_t interval = (uint32_t)getBytes (ptr, 4);
+  uint32_t numEntries = (uint32_t)getBytes (ptr, 4);
+  uint64_t numFrames = getBytes (ptr, 8);
+  uint64_t fileSize = getBytes (ptr, 8);
+
+  // entries must fit the rest of the sidecar, checked before sizing anything from it
+  // - one entry every interval frames, from frame 0
+  long entriesBytes = 0;
+  if (ok && !fseek (file, 0, SEEK_END))
+    entriesBytes = ftell (file) - HEADER_BYTES;
+
+  if (!ok || (magic != INDEX_MAGIC) || (version != INDEX_VERSION) ||
+      ((frameType != (uint32_t)eAudioFrameType::eMp3) && (frameType != (uint32_t)eAudioFrameType::eAacAdts) &&
+       (frameType != (uint32_t)eAudioFrameType::eAacLatm)) ||
+      !interval || !sampleRate || (sampleRate > 96000) || !samplesPerFrame || (samplesPerFrame > 1152) ||
+      !numEntries || (numFrames > fileSize) ||
+      (numFrames <= uint64_t(numEntries - 1) * interval) || (numFrames > uint64_t(numEntries) * interval) ||
+      (entriesBytes != (long)numEntries * ENTRY_BYTES) || fseek (file, HEADER_BYTES, SEEK_SET)) {
+    cLog::log (LOGERROR, "cAudioFrameIndex::load - bad sidecar " + fileName);
+    fclose (file);
+    return false;
+    }
+
+  std::vector<uint8_t> packed (numEntries * ENTRY_BYTES);
+  ok = packed.empty() || (fread (packed.data(), packed.size(), 1, file) == 1);
+  fclose (file);
+  if (!ok)
+    return false;
+
+  std::vector<sEntry> entries (numEntries);
+  ptr = packed.data();
+  uint64_t offset = 0;
+  for (auto& entry : entries) {
+    offset += getBytes (ptr, 4);
+    entry.mOffset = offset;
+    entry.mBackBytes = (uint16_t)getBytes (ptr, 2);
+    if ((offset >= fileSize) || (entry.mBackBytes > offset)) {
+      cLog::log (LOGERROR, "cAudioFrameIndex::load - bad entry " + fileName);
+      return false;
+      }
+    }
+
+  mFrameType = (eAudioFrameType)frameType;
+  mNumChannels = numChannels;
+  mSampleRate = sampleRate;
+  mSamplesPerFrame = samplesPerFrame;
+  mInterval = interval;
+  mNumFrames = numFrames;
+  mFileSize = fileSize;
+  mEntries.swap (entries);
+
+  return true;
+  }
+//}}}
+
+//{{{
+uint8_t* cAudioFrameIndex::seek (uint8_t* buffer, uint8_t* bufferEnd, int64_t pts, int& skipFrames, int64_t& firstPts) {
+// return first frame to decode to reach frame covering pts
+// - skipFrames priming frames, starting at firstPts, to decode and discard before frame covering pts
+
+  skipFrames = 0;
+  firstPts = 0;
+  if (mEntries.empty() || (uint64_t(bufferEnd - buffer) != mFileSize))
+    return nullptr;
+
+  int64_t frameNum = std::min (std::max (getFrameNum (pts), (int64_t)0), mNumFrames - 1);
+  size_t entryIndex = std::min ((size_t)(frameNum / mInterval), mEntries.size() - 1);
+  uint8_t* entryPtr = buffer + mEntries[entryIndex].mOffset;
+
+  // parse forward from entry priming frame, history of frames before target frame
+  sHistory history;
+  int frameLength = 0;
+  int mainDataBegin;
+  int payloadBytes;
+  uint8_t* framePtr = cAudioParser::parseFrame (entryPtr - mEntries[entryIndex].mBackBytes, bufferEnd, frameLength);
+  for (int64_t i = entryIndex * mInterval; framePtr && ((framePtr < entryPtr) || (i++ < frameNum));) {
+    parseReservoir (framePtr, frameLength, mainDataBegin, payloadBytes);
+    history.push (framePtr, mainDataBegin, payloadBytes);
+    framePtr = cAudioParser::parseFrame (framePtr + frameLength, bufferEnd, frameLength);
+    }
+
+  if (!framePtr)
+    return nullptr;
+
+  parseReservoir (framePtr, frameLength, mainDataBegin, payloadBytes);
+  uint8_t* primePtr = history.getPrimeFrame (mainDataBegin, skipFrames);
+  firstPts = getFramePts (frameNum - skipFrames);
+
+  return primePtr ? primePtr : framePtr;
+  }
+//}}}
+
+// private
+//{{{
+void cAudioFrameIndex::sHistory::push (uint8_t* framePtr, int mainDataBegin, int payloadBytes) {
+
+  mFramePtr [mCount % kSize] = framePtr;
+  mMainDataBegin [mCount % kSize] = mainDataBegin;
+  mPayloadBytes [mCount % kSize] = payloadBytes;
+  mCount++;
+  }
+//}}}
+//{{{
+uint8_t* cAudioFrameIndex::sHistory::getPrimeFrame (int mainDataBegin, int& primeFrames) {
+// return earliest previous frame needed to decode next frame exactly
+// - next frame's reservoir, and previous frame's reservoir so it decodes the imdct overlap, plus one more
+
+  int64_t available = std::min (mCount, (int64_t)kSize);
+
+  primeFrames = getReservoirFrames (0, mainDataBegin);
+  if (available)
+    primeFrames = std::max (primeFrames, 1 + getReservoirFrames (1, mMainDataBegin [(mCount - 1) % kSize]));
+
+  primeFrames = (int)std::min ((int64_t)primeFrames + 1, available);
+
+  return primeFrames ? mFramePtr [(mCount - primeFrames) % kSize] : nullptr;
+  }
+//}}}
+//{{{
+int cAudioFrameIndex::sHistory::getReservoirFrames (int back, int mainDataBegin) {
+// frames before the frame back frames from the end holding its mainDataBegin reservoir bytes
+
+  int64_t available = std::min (mCount, (int64_t)kSize);
+
+  int frames = 0;
+  while ((mainDataBegin > 0) && (back + frames < available))
+    mainDataBegin -= mPayloadBytes [(mCount - back - ++frames) % kSize];
+
+  return frames;
+  }
+//}}}
+
+//{{{
+bool cAudioFrameIndex::parseHeader (uint8_t* buffer, uint8_t* bufferEnd) {
+
+  mFrameType = cAudioParser::parseSomeFrames (buffer, bufferEnd, mNumChannels, mSampleRate);
+
+  int frameLength = 0;
+  uint8_t* framePtr = cAudioParser::parseFrame (buffer, bufferEnd, frameLength);
+  if (!framePtr)
+    return false;
+
+  switch (mFrameType) {
+    case eAudioFrameType::eMp3: {
+      bool mpeg1 = (framePtr[1] & 0x08) != 0;
+      bool mpeg25 = (framePtr[1] & 0x10) == 0;
+      int layer = 4 - ((framePtr[1] >> 1) & 3);
+      const int sampleRates[4] = { 44100, 48000, 32000, 0 };
+      mSampleRate = sampleRates [(framePtr[2] >> 2) & 3] >> (mpeg1 ? 0 : 1) >> (mpeg25 ? 1 : 0);
+      mNumChannels = ((framePtr[3] & 0xC0) == 0xC0) ? 1 : 2;
+      mSamplesPerFrame = (layer == 1) ? 384 : ((layer == 3) && !mpeg1) ? 576 : 1152;
+      break;
+      }
+
+    case eAudioFrameType::eAacAdts:
+    case eAudioFrameType::eAacLatm:
+      mSamplesPerFrame = 1024;
+      break;
+
+    default:
+      cLog::log (LOGERROR, "cAudioFrameIndex - unindexable frameType");
+      return false;
+    }
+
+  return mSampleRate > 0;
+  }
+//}}}
+//{{{
+void cAudioFrameIndex::parseReservoir (uint8_t* framePtr, int frameLength, int& mainDataBegin, int& payloadBytes) {
+// mp3 layer 3 bit reservoir back pointer and main data bytes carried by this frame
+
+  mainDataBegin = 0;
+  payloadBytes = 0;
+
+  if ((mFrameType != eAudioFrameType::eMp3) || (((framePtr[1] >> 1) & 3) != 1))
+    return;
+
+  bool mpeg1 = (framePtr[1] & 0x08) != 0;
+  bool mono = (framePtr[3] & 0xC0) == 0xC0;
+  int crcBytes = (framePtr[1] & 1) ? 0 : 2;
+
+  const uint8_t* sideInfo = framePtr + 4 + crcBytes;
+  mainDataBegin = mpeg1 ? (sideInfo[0] << 1) | (sideInfo[1] >> 7) : sideInfo[0];
+
+  int sideInfoBytes = mpeg1 ? (mono ? 17 : 32) : (mono ? 9 : 17);
+  payloadBytes = std::max (0, frameLength - 4 - crcBytes - sideInfoBytes);
+  }
+//}}}
@@ -0,0 +1,67 @@
+// cAudioFrameIndex.h - sparse mp3/aac frame index for seeking
+#pragma once
+#include <string>
+#include <vector>
+#include "iAudioDecoder.h"
+
+class cAudioFrameIndex {
+public:
+  cAudioFrameIndex (int interval = 64) : mInterval(interval) {}
+
+  eAudioFrameType getFrameType() { return mFrameType; }
+  int getNumChannels() { return mNumChannels; }
+  int getSampleRate() { return mSampleRate; }
+  int getSamplesPerFrame() { return mSamplesPerFrame; }
+  int64_t getNumFrames() { return mNumFrames; }
+
+  // pts in 90khz units, from start of file
+  int64_t getFramePts (int64_t frameNum);
+  int64_t getFrameNum (int64_t pts);
+
+  bool build (uint8_t* buffer, uint8_t* bufferEnd);
+
+  bool save (const std::string& fileName);
+  bool load (const std::string& fileName);
+
+  uint8_t* seek (uint8_t* buffer, uint8_t* bufferEnd, int64_t pts, int& skipFrames, int64_t& firstPts);
+
+private:
+  //{{{
+  struct sEntry {
+    uint64_t mOffset;     // offset of every mInterval'th frame
+    uint16_t mBackBytes;  // bytes back to first frame needed to prime decode of this frame
+    };
+  //}}}
+  //{{{
+  struct sHistory {
+  // last few frames parsed, enough to cover max mp3 bit reservoir
+    static const int kSize = 32;
+
+    void clear() { mCount = 0; }
+    void push (uint8_t* framePtr, int mainDataBegin, int payloadBytes);
+
+    uint8_t* getPrimeFrame (int mainDataBegin, int& primeFrames);
+    int getReservoirFrames (int back, int mainDataBegin);
+
+    uint8_t* mFramePtr [kSize];
+    int mMainDataBegin [kSize];
+    int mPayloadBytes [kSize];
+    int64_t mCount = 0;
+    };
+  //}}}
+
+  bool parseHeader (uint8_t* buffer, uint8_t* bufferEnd);
+  void parseReservoir (uint8_t* framePtr, int frameLength, int& mainDataBegin, int& payloadBytes);
+
+  // vars
+  int mInterval;
+
+  eAudioFrameType mFrameType = eAudioFrameType::eUnknown;
+  int mNumChannels = 0;
+  int mSampleRate = 0;
+  int mSamplesPerFrame = 0;
+  int64_t mNumFrames = 0;
+  uint64_t mFileSize = 0;
+
+  std::vector<sEntry> mEntries;
+  };
@@ -0,0 +1,214 @@
+// cAudioFramer.cpp - push framer, arbitrary byte chunks in, complete mp3/aacAdts/aacLatm frames out
+//{{{  includes
+#include <cstring>
+#include <algorithm>
+
+#include "cAudioFramer.h"
+
+#include "../utils/cLog.h"
+//}}}
+
+// public
+//{{{
+void cAudioFramer::push (const uint8_t* chunk, int chunkSize) {
+// frames wholly inside chunk are emitted in place, only frames straddling chunks are copied
+
+  // finish any partial frame carried from last chunk
+  if (mCarryBytes) {
+    int used = carry (chunk, chunkSize);
+    if (mCarryBytes)
+      return;
+    chunk += used;
+    chunkSize -= used;
+    }
+
+  const uint8_t* ptr = chunk;
+  const uint8_t* end = chunk + chunkSize;
+  while (end - ptr >= kHeaderBytes) {
+    int frameLength;
+    if (!acceptHeader (ptr, frameLength)) {
+      //{{{  no sync, resync byte by byte
+      mLocked = false;
+      mSkippedBytes++;
+      ptr++;
+      continue;
+      }
+      //}}}
+
+    // hunting needs the next header too, carried into the next push if it isn't here yet
+    if (end - ptr < frameLength + (mLocked ? 0 : kHeaderBytes))
+      break;
+
+    if (!mLocked && !isNextHeader (ptr + frameLength)) {
+      //{{{  false sync, hunt on
+      mSkippedBytes++;
+      ptr++;
+      continue;
+      }
+      //}}}
+
+    mLocked = true;
+    mFrameCallback (mFrameType, ptr, frameLength);
+    ptr += frameLength;
+    }
+
+  // keep tail for next push
+  mCarryBytes = int(end - ptr);
+  memcpy (mCarry, ptr, mCarryBytes);
+  }
+//}}}
+//{{{
+void cAudioFramer::reset() {
+
+  mFrameType = eAudioFrameType::eUnknown;
+  mLocked = false;
+  mSkippedBytes = 0;
+  mCarryBytes = 0;
+  }
+//}}}
+
+//{{{
+bool cAudioFramer::parseHeader (const uint8_t* ptr, eAudioFrameType& frameType, int& frameLength) {
+// validate sync and header fields, return frameLength including header
+
+  frameType = eAudioFrameType::eUnknown;
+  frameLength = 0;
+
+  if ((ptr[0] == 0x56) && ((ptr[1] & 0xE0) == 0xE0)) {
+    // aacLatm syncWord 0x2b7, 13 bit length
+    frameType = eAudioFrameType::eAacLatm;
+    frameLength = 3 + (((ptr[1] & 0x1F) << 8) | ptr[2]);
+    return true;
+    }
+
+  if ((ptr[0] != 0xFF) || ((ptr[1] & 0xE0) != 0xE0))
+    return false;
+
+  if ((ptr[1] & 0xF6) == 0xF0) {
+    //{{{  aacAdts, 12 bit sync, layer 0
+    if (((ptr[2] & 0x3C) >> 2) > 12)
+      return false;
+
+    frameType = eAudioFrameType::eAacAdts;
+    frameLength = ((ptr[3] & 0x3) << 11) | (ptr[4] << 3) | (ptr[5] >> 5);
+    return frameLength > ((ptr[1] & 1) ? 7 : 9);
+    }
+    //}}}
+
+  //{{{  mp3, 11 bit sync, any mpeg version and layer
+  static const int kBitRates [2][3][16] = {
+    // mpeg1 layer 1,2,3
+    { { 0,32,64,96,128,160,192,224,256,288,320,352,384,416,448,0 },
+      { 0,32,48,56, 64, 80, 96,112,128,160,192,224,256,320,384,0 },
+      { 0,32,40,48, 56, 64, 80, 96,112,128,160,192,224,256,320,0 } },
+    // mpeg2, 2.5 layer 1,2,3
+    { { 0,32,48,56, 64, 80, 96,112,128,144,160,176,192,224,256,0 },
+      { 0, 8,16,24, 32, 40, 48, 56, 64, 80, 96,112,128,144,160,0 },
+      { 0, 8,16,24, 32, 40, 48, 56, 64, 80, 96,112,128,144,160,0 } } };
+  static const int kSampleRates [3] = { 44100, 48000, 32000 };
+
+  int version = (ptr[1] >> 3) & 3;      // 0 = 2.5, 1 = reserved, 2 = mpeg2, 3 = mpeg1
+  int layer = 4 - ((ptr[1] >> 1) & 3);  // 4 = reserved
+  int bitrateIndex = ptr[2] >> 4;
+  int sampleRateIndex = (ptr[2] >> 2) & 3;
+  if ((version == 1) || (layer == 4) || !bitrateIndex || (bitrateIndex == 15) || (sampleRateIndex == 3))
+    return false;
+
+  bool mpeg1 = version == 3;
+  int bitrate = kBitRates [mpeg1 ? 0 : 1][layer - 1][bitrateIndex] * 1000;
+  int sampleRate = kSampleRates [sampleRateIndex] >> (mpeg1 ? 0 : 1) >> (version == 0 ? 1 : 0);
+  int pad = (ptr[2] >> 1) & 1;
+
+  frameType = eAudioFrameType::eMp3;
+  if (layer == 1)
+    frameLength = ((12 * bitrate / sampleRate) + pad) * 4;
+  else
+    frameLength = (((layer == 3) && !mpeg1) ? 72 : 144) * bitrate / sampleRate + pad;
+
+  return true;
+  //}}}
+  }
+//}}}
+
+// private
+//{{{
+int cAudioFramer::carry (const uint8_t* chunk, int chunkSize) {
+// complete frame started in last chunk, return chunk bytes used
+
+  int used = 0;
+  while (mCarryBytes && (used < chunkSize)) {
+    if (mCarryBytes < kHeaderBytes) {
+      //{{{  top up to header
+      int bytes = std::min (kHeaderBytes - mCarryBytes, chunkSize - used);
+      memcpy (mCarry + mCarryBytes, chunk + used, bytes);
+      mCarryBytes += bytes;
+      used += bytes;
+      continue;
+      }
+      //}}}
+
+    int frameLength;
+    if (!acceptHeader (mCarry, frameLength)) {
+      //{{{  lost sync in carry, drop a byte
+      mLocked = false;
+      mSkippedBytes++;
+      memmove (mCarry, mCarry + 1, --mCarryBytes);
+      continue;
+      }
+      //}}}
+
+    // hunting carries the next header as well, to confirm sync before emitting
+    // - carry can already hold more after dropping a byte, the header found may be shorter
+    int wanted = frameLength + (mLocked ? 0 : kHeaderBytes);
+    int bytes = std::max (0, std::min (wanted - mCarryBytes, chunkSize - used));
+    memcpy (mCarry + mCarryBytes, chunk + used, bytes);
+    mCarryBytes += bytes;
+    used += bytes;
+
+    if (mCarryBytes >= wanted) {
+      if (!mLocked && !isNextHeader (mCarry + frameLength)) {
+        //{{{  false sync in carry, drop a byte
+        mSkippedBytes++;
+        memmove (mCarry, mCarry + 1, --mCarryBytes);
+        continue;
+        }
+        //}}}
+
+      mLocked = true;
+      mFrameCallback (mFrameType, mCarry, frameLength);
+
+      // confirming header starts the next frame
+      mCarryBytes -= frameLength;
+      memmove (mCarry, mCarry + frameLength, mCarryBytes);
+      }
+    }
+
+  return used;
+  }
+//}}}
+//{{{
+bool cAudioFramer::acceptHeader (const uint8_t* ptr, int& frameLength) {
+// valid header of locked frameType, any valid header picks frameType while hunting
+
+  eAudioFrameType frameType;
+  if (!parseHeader (ptr, frameType, frameLength) ||
+      (frameLength < kHeaderBytes) || (frameLength > kMaxFrameBytes))
+    return false;
+
+  if (!mLocked && (frameType != mFrameType)) {
+    cLog::log (LOGINFO, "cAudioFramer - frameType %d", (int)frameType);
+    mFrameType = frameType;
+    }
+
+  return frameType == mFrameType;
+  }
+//}}}
+//{{{
+bool cAudioFramer::isNextHeader (const uint8_t* ptr) {
+// header following a hunted frame, same frameType confirms sync
+
+  eAudioFrameType frameType;
+  int frameLength;
+  return parseHeader (ptr, frameType, frameLength) && (frameType == mFrameType);
+  }
+//}}}
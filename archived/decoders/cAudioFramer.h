@@ -0,0 +1,39 @@
+// cAudioFramer.h - push framer, arbitrary byte chunks in, complete mp3/aacAdts/aacLatm frames out
+#pragma once
+#include <functional>
+#include "iAudioDecoder.h"
+
+class cAudioFramer {
+public:
+  // frame is only valid during the callback
+  using tFrameCallback = std::function<void (eAudioFrameType frameType, const uint8_t* frame, int frameLength)>;
+
+  cAudioFramer (tFrameCallback frameCallback) : mFrameCallback(frameCallback) {}
+
+  eAudioFrameType getFrameType() { return mFrameType; }
+  bool isLocked() { return mLocked; }
+  int64_t getSkippedBytes() { return mSkippedBytes; }
+
+  void push (const uint8_t* chunk, int chunkSize);
+  void reset();
+
+  static bool parseHeader (const uint8_t* ptr, eAudioFrameType& frameType, int& frameLength);
+
+private:
+  static const int kHeaderBytes = 7;
+  static const int kMaxFrameBytes = 8192 + 3;
+
+  int carry (const uint8_t* chunk, int chunkSize);
+  bool acceptHeader (const uint8_t* ptr, int& frameLength);
+  bool isNextHeader (const uint8_t* ptr);
+
+  tFrameCallback mFrameCallback;
+
+  eAudioFrameType mFrameType = eAudioFrameType::eUnknown;
+  bool mLocked = false;
+  int64_t mSkippedBytes = 0;
+
+  // partial frame straddling chunks, only copy made, plus the next header while hunting
+  int mCarryBytes = 0;
+  uint8_t mCarry [kMaxFrameBytes + kHeaderBytes];
+  };
@@ -2,6 +2,7 @@
 //{{{  includes
 #include <cstring>
 #include "cAudioParser.h"
+#include "cAudioFramer.h"
 
 #include "../utils/cLog.h"
 //}}}
@@ -11,6 +12,8 @@ static int mJpegLen = 0;
 
 //{{{
 uint8_t* cAudioParser::getJpeg (int& len) {
+// view into buffer given to parseSomeFrames, valid while that buffer or mapping lives
+
   len = mJpegLen;
   return mJpegPtr;
   }
@@ -42,11 +45,18 @@ eAudioFrameType cAudioParser::parseSomeFrames (uint8_t* framePtr, uint8_t* frame
   numChannels = 0;
   sampleRate = 0;
 
+  // no view into a previous buffer
+  mJpegPtr = nullptr;
+  mJpegLen = 0;
+
   while ((framePtr < frameEnd) &&
          ((frameType == eAudioFrameType::eUnknown) ||
           (frameType == eAudioFrameType::eId3Tag))) {
     int frameLen = 0;
     framePtr = parseFrame (framePtr, frameEnd, frameType, numChannels, sampleRate, frameLen);
+    if (!framePtr)
+      break;
+
     if (frameType == eAudioFrameType::eId3Tag) {
       if (parseId3Tag (framePtr, frameEnd))
         cLog::log (LOGINFO, "parseFrames found jpeg");
@@ -76,10 +86,12 @@ bool cAudioParser::parseId3Tag (uint8_t* framePtr, uint8_t* frameEnd) {
                          ptr[0], ptr[1], ptr[2], ptr[3], ptr[4], ptr[5], tagSize);
     ptr += 10;
 
-    while (ptr < framePtr + tagSize) {
+    // frames bounded by tag and by caller's buffer
+    uint8_t* tagEnd = (frameEnd - ptr > tagSize) ? ptr + tagSize : frameEnd;
+    while (tagEnd - ptr >= 10) {
       auto tag = (ptr[0] << 24) | (ptr[1] << 16) | (ptr[2] << 8) | ptr[3];
       auto frameSize = (ptr[4] << 24) | (ptr[5] << 16) | (ptr[6] << 8) | ptr[7];
-      if (!frameSize)
+      if ((frameSize <= 0) || (frameSize > tagEnd - ptr - 10))
         break;
 
       auto frameFlags1 = ptr[8];
@@ -92,13 +104,12 @@ bool cAudioParser::parseId3Tag (uint8_t* framePtr, uint8_t* frameEnd) {
       cLog::log (LOGINFO, "parseId3Tag - %c%c%c%c %02x %02x %d %s",
                            ptr[0], ptr[1], ptr[2], ptr[3], frameFlags1, frameFlags2, frameSize, info.c_str());
 
-      if (tag == 0x41504943) {
-        // APIC tag
+      if ((tag == 0x41504943) && (frameSize >= 14)) {
+        // APIC tag, 14 bytes of encoding, mimeType, pictureType, description before jpeg
         cLog::log (LOGINFO3, "parseId3Tag - APIC jpeg tag found");
+        // view into caller's buffer, no copy
         mJpegLen = frameSize - 14;
-        mJpegPtr = (uint8_t*)malloc (mJpegLen);
-        if (mJpegPtr)
-          memcpy (mJpegPtr, ptr + 10 + 14, mJpegLen);
+        mJpegPtr = ptr + 10 + 14;
         return true;
         }
 
@@ -263,26 +274,19 @@ uint8_t* cAudioParser::parseFrame (uint8_t* framePtr, uint8_t* frameLast,
 
         frameType = eAudioFrameType::eMp3;
 
-        //uint8_t version = (framePtr[1] & 0x08) >> 3;
-        uint8_t layer = (framePtr[1] & 0x06) >> 1;
-        int scale = (layer == 3) ? 48 : 144;
-
-        //uint8_t errp = framePtr[1] & 0x01;
-
-        const uint32_t bitRates[16] = {     0,  32000,  40000,  48000,  56000,  64000,  80000, 96000,
-                                       112000, 128000, 160000, 192000, 224000, 256000, 320000,     0 };
-        uint8_t bitrateIndex = (framePtr[2] & 0xf0) >> 4;
-        uint32_t bitrate = bitRates[bitrateIndex];
+        // frameLength and sampleRate for any mpeg version and layer, tables above are mpeg1 layer 3 only
+        eAudioFrameType headerFrameType;
+        if (!cAudioFramer::parseHeader (framePtr, headerFrameType, frameLength) ||
+            (headerFrameType != eAudioFrameType::eMp3)) {
+          frameType = eAudioFrameType::eUnknown;
+          framePtr++;
+          continue;
+          }
 
         const int sampleRates[4] = { 44100, 48000, 32000, 0};
-        uint8_t sampleRateIndex = (framePtr[2] & 0x0c) >> 2;
-        sampleRate = sampleRates[sampleRateIndex];
-
-        uint8_t pad = (framePtr[2] & 0x02) >> 1;
-
-        frameLength = (bitrate * scale) / sampleRate;
-        if (pad)
-          frameLength++;
+        bool mpeg1 = (framePtr[1] & 0x08) != 0;
+        bool mpeg25 = (framePtr[1] & 0x10) == 0;
+        sampleRate = sampleRates [(framePtr[2] & 0x0c) >> 2] >> (mpeg1 ? 0 : 1) >> (mpeg25 ? 1 : 0);
 
         //uint8_t priv = (framePtr[2] & 0x01);
         //uint8_t mode = (framePtr[3] & 0xc0) >> 6;
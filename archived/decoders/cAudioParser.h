@@ -3,6 +3,7 @@
 
 class cAudioParser {
 public:
+  // parsers only read, buffer can be a cMappedFile view
   static uint8_t* getJpeg (int& len);
 
   static uint8_t* parseFrame (uint8_t* framePtr, uint8_t* frameLast, int& frameLength);
@@ -1,12 +1,19 @@
 // cDecodePic.h - read .gif,.png,.jpg,.bmp file
+// - setPic decodes in each format's native layout, setPicRgba normalises to rgba for cVg::createImageRGBA
+// - setPicRgba jpeg decodes from the cheapest source covering the target size, see cJpegPic::decodeToSize
+// - bmp rows top down, channel swaps and expands through cPixelConvert
+// - threads is the jpeg restart interval decode threads, 1 from inside a worker pool
 #pragma once
+#include <thread>
 #include "cPngPic.h"
 #include "cGifPic.h"
 #include "cJpegPic.h"
+#include "cMappedFile.h"
+#include "cPixelConvert.h"
 
 class cDecodePic : public iPic {
 public:
-  cDecodePic()  {}
+  explicit cDecodePic (int threads = (int)std::thread::hardware_concurrency()) : mThreads(threads) {}
   virtual ~cDecodePic() {}
   void* operator new (std::size_t size) { return malloc (size); }
   void operator delete (void *ptr) { free (ptr); }
@@ -18,6 +25,43 @@ public:
   virtual uint8_t* getPic() { return mPic; }
 
   virtual void setPic (const uint8_t* buffer, int size, uint16_t components) {
+    decode (buffer, size, components, 0, 0, false);
+    }
+
+  //{{{
+  bool setPicRgba (const uint8_t* buffer, int size, uint32_t width = 0, uint32_t height = 0) {
+  // decode to malloced rgba, caller owns getPic, false on error
+  // - jpeg at least width x height when it can, 0 for full size, other formats full size
+
+    decode (buffer, size, 4, width, height, true);
+    return mPic != nullptr;
+    }
+  //}}}
+  //{{{
+  bool setFileName (std::string fileName) {
+  // map file, raw bmp pic can stay a view into the mapping
+
+    if (!mFile.open (fileName))
+      return false;
+
+    setPic (mFile.getBuffer(), (int)mFile.getSize(), 3);
+
+    // decoded pics own their buffer, unmap
+    if ((mPic < mFile.getBuffer()) || (mPic >= mFile.getEnd()))
+      mFile.close();
+
+    return true;
+    }
+  //}}}
+
+private:
+  //{{{
+  void decode (const uint8_t* buffer, int size, uint16_t components, uint32_t width, uint32_t height, bool rgba) {
+
+    mPic = nullptr;
+    if (size < 4)
+      return;
+
     if ((buffer[0] == 'G') && (buffer[1] == 'I') && (buffer[2] == 'F'))  {
       //{{{  load gif
       cGifPic gif;
@@ -26,90 +70,237 @@ public:
         mWidth = gif.getWidth();
         mHeight = gif.getHeight();
         mComponents = gif.getComponents();
-        if (gif.decodeBody (0) == cGifPic::GIF_OK)
+        if (gif.decodeBody (0) == cGifPic::GIF_OK) {
           mPic = gif.getPic();
+          if (rgba)
+            swapRedBlue (mPic, mWidth, mHeight);
+          }
+        else
+          free (gif.getPic());
         }
       }
       //}}}
     else if ((buffer[0] == 0x89) && (buffer[1] == 'P') && (buffer[2] == 'N') && (buffer[3] == 'G'))  {
       //{{{  load png
-      cPngPic png (buffer);
+      cPngPic png (buffer, size);
       if (png.readHeader()) {
         mWidth = png.getWidth();
         mHeight = png.getHeight();
         mComponents = png.getComponents();
         mPic = png.decodeBody();
+        if (rgba && mPic)
+          pngToRgba (png);
         }
       }
       //}}}
     else if ((buffer[0] == 0xFF) && (buffer[1] == 0xD8)) {
       //{{{  load jpeg
-      cJpegPic jpeg (components, (uint8_t*)buffer);
+      cJpegPic jpeg (components, (uint8_t*)buffer, size);
+      jpeg.setThreads (mThreads);
       if (jpeg.readHeader()) {
-        mWidth = jpeg.getWidth();
-        mHeight = jpeg.getHeight();
         mComponents = jpeg.getComponents();
-        mPic = jpeg.decodeBody (0);
+        if (width && height) {
+          mPic = jpeg.decodeToSize (width, height);
+          mWidth = jpeg.getFrameWidth();
+          mHeight = jpeg.getFrameHeight();
+          }
+        else {
+          mPic = jpeg.decodeBody (0);
+          mWidth = jpeg.getWidth();
+          mHeight = jpeg.getHeight();
+          }
+        if (rgba && mPic)
+          swapRedBlue (mPic, mWidth, mHeight);
         }
       }
       //}}}
-    else if ((buffer[0] == 'B') && (buffer[1] == 'M')) {
-      //{{{  load bmp
-      mWidth = buffer[0x12];
-      mHeight = buffer[0x16];
-      mComponents = components;
-
-      if (mComponents == 4) {
-        // expand BGR to temp RGBA
-        mPic = (uint8_t*)malloc (mWidth * mHeight * mComponents);
-        auto srcPtr = (uint8_t*)buffer + 54;
-        auto dstPtr = mPic;
-        for (int i = 0; i < mWidth * mHeight; i++) {
-          *dstPtr++ = *(srcPtr+2);
-          *dstPtr++ = *(srcPtr+1);
-          *dstPtr++ = *(srcPtr);
-          *dstPtr++ = 0xFF;
-          srcPtr += 3;
+    else if ((buffer[0] == 'B') && (buffer[1] == 'M'))
+      decodeBmp (buffer, size, components);
+    }
+  //}}}
+  //{{{
+  static void swapRedBlue (uint8_t* pic, uint32_t width, uint32_t height) {
+  // bgra <-> rgba in place
+
+    cPixelConvert::convert (pic, cPixelConvert::eBgra, width * 4, pic, cPixelConvert::eRgba, width * 4, width, height);
+    }
+  //}}}
+  //{{{
+  static uint32_t getLe32 (const uint8_t* ptr) {
+    return ptr[0] | (ptr[1] << 8) | (ptr[2] << 16) | ((uint32_t)ptr[3] << 24);
+    }
+  //}}}
+  //{{{
+  void decodeBmp (const uint8_t* buffer, int size, uint16_t components) {
+  // BITMAPINFOHEADER or later, 24 bit, 32 bit, 565 bitfields, rows padded to 4 bytes, bottom up unless height < 0
+  // - 3 components keeps 24 bit as bgr, a view into buffer when already top down and unpadded
+  // - 4 components converts to rgba, other sources to bgra
+
+    if (size < 0x36)
+      return;
+
+    uint32_t offset = getLe32 (buffer + 0x0A);
+    uint32_t headerSize = getLe32 (buffer + 0x0E);
+    int64_t width = (int32_t)getLe32 (buffer + 0x12);
+    int64_t height = (int32_t)getLe32 (buffer + 0x16);
+    uint32_t bitCount = buffer[0x1C] | (buffer[0x1D] << 8);
+    uint32_t compression = getLe32 (buffer + 0x1E);
+
+    bool topDown = height < 0;
+    if (topDown)
+      height = -height;
+    if ((headerSize < 40) || (width <= 0) || (width > 0xFFFF) || !height || (height > 0xFFFF))
+      return;
+
+    //{{{  pick source format, bitfields only in their standard layouts
+    cPixelConvert::eFormat format;
+    if ((bitCount == 24) && (compression == 0))
+      format = cPixelConvert::eBgr;
+    else if ((bitCount == 32) && (compression == 0))
+      format = cPixelConvert::eBgrx;
+    else if ((compression == 3) && (size >= 0x42)) {
+      // masks follow a 40 byte header, alpha mask only in a v3 header or later
+      uint32_t red = getLe32 (buffer + 0x36);
+      uint32_t green = getLe32 (buffer + 0x3A);
+      uint32_t blue = getLe32 (buffer + 0x3E);
+      uint32_t alpha = ((headerSize >= 56) && (size >= 0x46)) ? getLe32 (buffer + 0x42) : 0;
+      if ((bitCount == 32) && (red == 0xFF0000) && (green == 0xFF00) && (blue == 0xFF))
+        format = (alpha == 0xFF000000) ? cPixelConvert::eBgra : cPixelConvert::eBgrx;
+      else if ((bitCount == 16) && (red == 0xF800) && (green == 0x07E0) && (blue == 0x1F))
+        format = cPixelConvert::eRgb565;
+      else
+        return;
+      }
+    else
+      return;
+    //}}}
+
+    uint64_t stride = (((uint64_t)width * bitCount + 31) / 32) * 4;
+    uint64_t rowBytes = (uint64_t)width * (bitCount / 8);
+    if ((uint64_t)offset + stride * (height - 1) + rowBytes > (uint64_t)size)
+      return;
+
+    const uint8_t* src = buffer + offset;
+    mWidth = (uint16_t)width;
+    mHeight = (uint16_t)height;
+
+    if ((components != 4) && (format == cPixelConvert::eBgr)) {
+      mComponents = 3;
+      if (topDown && (stride == rowBytes)) {
+        mPic = (uint8_t*)src;
+        return;
+        }
+
+      mPic = (uint8_t*)malloc ((size_t)rowBytes * height);
+      if (mPic)
+        for (int64_t y = 0; y < height; y++)
+          memcpy (mPic + (topDown ? y : height - 1 - y) * rowBytes, src + y * stride, (size_t)rowBytes);
+      return;
+      }
+
+    mComponents = 4;
+    mPic = (uint8_t*)malloc ((size_t)width * height * 4);
+    if (mPic)
+      cPixelConvert::convert (src, format, (int)stride,
+                              mPic, (components == 4) ? cPixelConvert::eRgba : cPixelConvert::eBgra, (int)width * 4,
+                              (int)width, (int)height, !topDown);
+    }
+  //}}}
+  //{{{
+  void pngToRgba (cPngPic& png) {
+  // expand 8 bit bgr, bgra, lum, luma, palette or 16 bit rgb, rgba, lum, luma to rgba, 16 bit keeps the msb
+  // - 1,2,4 bit lum packed without row padding, scaled to 8 bit
+
+    uint32_t pixels = mWidth * mHeight;
+    uint32_t depth = png.getBitDepth();
+    if (png.isPalette()) {
+      //{{{  look up 1,2,4,8 bit indices, packed like lum
+      auto rgba = (uint8_t*)malloc (pixels * 4);
+      if (rgba) {
+        const uint8_t* palette = png.getPalette();
+        uint32_t mask = (1 << depth) - 1;
+        uint8_t* dst = rgba;
+        for (uint32_t i = 0, bit = 0; i < pixels; i++, bit += depth, dst += 4)
+          memcpy (dst, palette + ((mPic[bit / 8] >> (8 - depth - (bit & 7))) & mask) * 4, 4);
+        }
+
+      free (mPic);
+      mPic = rgba;
+      mComponents = 4;
+      return;
+      }
+      //}}}
+    if ((depth < 8) && (mComponents == 1)) {
+      //{{{  unpack lum bits
+      auto rgba = (uint8_t*)malloc (pixels * 4);
+      if (rgba) {
+        uint32_t mask = (1 << depth) - 1;
+        uint32_t scale = 255 / mask;
+        uint8_t* dst = rgba;
+        for (uint32_t i = 0, bit = 0; i < pixels; i++, bit += depth, dst += 4) {
+          uint8_t lum = (uint8_t)(((mPic[bit / 8] >> (8 - depth - (bit & 7))) & mask) * scale);
+          dst[0] = dst[1] = dst[2] = lum;
+          dst[3] = 0xFF;
           }
         }
-      else
-        mPic = (uint8_t*)buffer + 54;
+
+      free (mPic);
+      mPic = rgba;
+      mComponents = 4;
+      return;
       }
       //}}}
-    }
+    if (((depth != 8) && (depth != 16)) || !mComponents) {
+      free (mPic);
+      mPic = nullptr;
+      return;
+      }
 
-  //{{{
-  bool setFileName (std::string fileName) {
+    // 8 bit colour comes swizzled to bgr, bgra
+    uint32_t step = depth / 8;
+    if ((mComponents == 4) && (step == 1)) {
+      swapRedBlue (mPic, mWidth, mHeight);
+      return;
+      }
+    if ((mComponents == 3) && (step == 1)) {
+      auto rgba = (uint8_t*)malloc (pixels * 4);
+      if (rgba)
+        cPixelConvert::convert (mPic, cPixelConvert::eBgr, mWidth * 3, rgba, cPixelConvert::eRgba, mWidth * 4, mWidth, mHeight);
+      free (mPic);
+      mPic = rgba;
+      mComponents = 4;
+      return;
+      }
 
-  #ifdef WIN32
-    HANDLE mFileHandle = CreateFileA (fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, 0, NULL);
-    int mFileSize = (int)GetFileSize (mFileHandle, NULL);
-    uint8_t* mSrcBuffer = (uint8_t*)MapViewOfFile (CreateFileMapping (mFileHandle, NULL, PAGE_READONLY, 0, 0, NULL), FILE_MAP_READ, 0, 0, 0);
-    setPic (mSrcBuffer, mFileSize, 3);
-    UnmapViewOfFile (mSrcBuffer);
-    CloseHandle (mFileHandle);
-    return true;
-  #else
-    FILE* file = fopen (fileName.c_str(), "rb");
-    if (file) {
-      //printf ("loading %s\n", fileName.c_str());
-      //int fileSize = ;
-      //uint8_t* mSrcBuffer = (uint8_t*)bigMalloc (size, "fileBuf");
-      //fread (mSrcBuffer, 1, (unsigned long)0xFFFFFFFF, file);
-      //fclose (file);
-      //setPic (mSrcBuffer, mFileSize);
-      //bigFree (mSrcBuffer);
-      //mSrcBuffer = nullptr;
-      return true;
+    auto rgba = (uint8_t*)malloc (pixels * 4);
+    if (rgba) {
+      const uint8_t* src = mPic;
+      uint8_t* dst = rgba;
+      for (uint32_t i = 0; i < pixels; i++, dst += 4, src += mComponents * step) {
+        if (mComponents <= 2) {
+          dst[0] = dst[1] = dst[2] = src[0];
+          dst[3] = (mComponents == 2) ? src[step] : 0xFF;
+          }
+        else {
+          dst[0] = src[0];
+          dst[1] = src[step];
+          dst[2] = src[2*step];
+          dst[3] = (mComponents == 4) ? src[3*step] : 0xFF;
+          }
+        }
       }
-    return false;
-  #endif
+
+    free (mPic);
+    mPic = rgba;
+    mComponents = 4;
     }
   //}}}
 
-private:
   uint16_t mWidth = 0;
   uint16_t mHeight = 0;
   uint16_t mComponents = 0;
   uint8_t* mPic = nullptr;
+  int mThreads = 1;
+
+  cMappedFile mFile;
   };
@@ -0,0 +1,410 @@
+// cDecodeService.h - decode pics to rgba on a worker pool, off the ui thread
+// - requests taken visible first, then oldest, priority changeable while queued
+// - abandon drops queued requests without waiting, cancel also waits out a decode still reading the buffer
+// - decoded pics held in a byte budgeted lru cache keyed by source hash, target size and flip
+// - caller polls the request from its draw, uploads with cVg::createImageRGBA on the ui thread
+// - optional cPicDiskCache behind the lru, disk hits handed out as views into the mapping
+#pragma once
+//{{{  includes
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include <vector>
+#include <list>
+#include <map>
+#include <memory>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include "cDecodePic.h"
+#include "cPicDiskCache.h"
+//}}}
+
+class cDecodeService {
+public:
+  enum ePriority { eVisible, eNear, ePrefetch };  // lower taken first
+  enum eState { eQueued, eDecoding, eDone, eFailed, eCancelled };
+
+  //{{{
+  struct sPic {
+  // rgba, width * 4 stride, shared between cache and users, freed or unmapped with the last reference
+
+    sPic (uint8_t* pic, uint32_t width, uint32_t height) : mPic(pic), mWidth(width), mHeight(height) {}
+    //{{{
+    sPic (std::unique_ptr<cPicDiskCache::cEntry> entry)
+      : mPic((uint8_t*)entry->getLevel (0).mPic), mWidth(entry->getWidth()), mHeight(entry->getHeight()),
+        mEntry(std::move (entry)) {}
+    //}}}
+    ~sPic() {
+      if (!mEntry)
+        free (mPic);
+      }
+
+    size_t getBytes() const { return (size_t)mWidth * mHeight * 4; }
+
+    uint8_t* mPic;   // readonly when mapped
+    uint32_t mWidth;
+    uint32_t mHeight;
+    std::unique_ptr<cPicDiskCache::cEntry> mEntry;
+    };
+  //}}}
+  //{{{
+  class cRequest {
+  // poll isDone from the ui thread, getPic valid once eDone
+  public:
+    eState getState() const { return mState; }
+    bool isDone() const { return mState >= eDone; }
+    std::shared_ptr<sPic> getPic() const { return isDone() ? mPic : nullptr; }
+
+  private:
+    friend class cDecodeService;
+
+    const uint8_t* mBuffer = nullptr;
+    int mSize = 0;
+    uint64_t mKey = 0;
+    uint32_t mWidth = 0;
+    uint32_t mHeight = 0;
+    bool mFlip = false;
+
+    std::atomic<int> mPriority = { ePrefetch };
+    uint64_t mSequence = 0;
+
+    std::atomic<eState> mState = { eQueued };
+    std::shared_ptr<sPic> mPic;
+    };
+  //}}}
+
+  //{{{
+  cDecodeService (int numThreads = 0, size_t cacheBytes = 64 * 1024 * 1024) : mCacheBytes(cacheBytes) {
+  // numThreads 0 for all cores but one, leaves a core for the ui
+
+    if (numThreads <= 0)
+      numThreads = std::max (1, (int)std::thread::hardware_concurrency() - 1);
+    for (int i = 0; i < numThreads; i++)
+      mThreads.push_back (std::thread ([=]() { decodeThread(); }));
+    }
+  //}}}
+  //{{{
+  ~cDecodeService() {
+
+    {
+    std::unique_lock<std::mutex> lock (mMutex);
+    mExit = true;
+    for (auto& request : mQueue)
+      request->mState = eCancelled;
+    mQueue.clear();
+    mWake.notify_all();
+    }
+
+    for (auto& thread : mThreads)
+      thread.join();
+    }
+  //}}}
+
+  //{{{
+  std::shared_ptr<cRequest> request (const uint8_t* buffer, int size, uint32_t width, uint32_t height,
+                                     ePriority priority, bool flip = false) {
+  // decode buffer to rgba covering width x height, 0 for full size, cache hit returns done
+  // - buffer must stay valid until the request is done or cancel returns
+
+    auto request = std::make_shared<cRequest>();
+    request->mBuffer = buffer;
+    request->mSize = size;
+    request->mKey = getKey (buffer, size, width, height, flip);
+    request->mWidth = width;
+    request->mHeight = height;
+    request->mFlip = flip;
+    request->mPriority = priority;
+
+    std::unique_lock<std::mutex> lock (mMutex);
+
+    request->mPic = findCached (request->mKey);
+    if (request->mPic) {
+      request->mState = eDone;
+      return request;
+      }
+
+    request->mSequence = mSequence++;
+    mQueue.push_back (request);
+    mWake.notify_one();
+    return request;
+    }
+  //}}}
+  //{{{
+  void setPriority (const std::shared_ptr<cRequest>& request, ePriority priority) {
+  // widget scrolled into or out of view, only matters while queued
+
+    if (request)
+      request->mPriority = priority;
+    }
+  //}}}
+  //{{{
+  void abandon (const std::shared_ptr<cRequest>& request) {
+  // caller stopped wanting it, drop it if queued, never waits so safe from the ui thread
+  // - a decode in progress runs on into the cache, buffer must outlive it, cancel before freeing
+
+    if (!request)
+      return;
+
+    std::unique_lock<std::mutex> lock (mMutex);
+    dropQueued (request);
+    }
+  //}}}
+  //{{{
+  void cancel (const std::shared_ptr<cRequest>& request) {
+  // drop queued request, wait out a decode in progress so the caller can free the buffer
+
+    if (!request)
+      return;
+
+    std::unique_lock<std::mutex> lock (mMutex);
+    if (!dropQueued (request))
+      mDecoded.wait (lock, [&]() { return request->mState != eDecoding; });
+    }
+  //}}}
+
+  //{{{
+  void setDiskCache (cPicDiskCache* diskCache) {
+  // set before the first request, caller owns it and keeps it past the service
+
+    mDiskCache = diskCache;
+    }
+  //}}}
+  //{{{
+  void setCacheBytes (size_t bytes) {
+  // lru budget, pics still referenced by a request stay alive past eviction
+
+    std::unique_lock<std::mutex> lock (mMutex);
+    mCacheBytes = bytes;
+    trimCache();
+    }
+  //}}}
+  //{{{
+  size_t getCachedBytes() {
+    std::unique_lock<std::mutex> lock (mMutex);
+    return mCachedBytes;
+    }
+  //}}}
+
+private:
+  //{{{
+  struct sCached {
+    uint64_t mKey;
+    std::shared_ptr<sPic> mPic;
+    };
+  //}}}
+
+  //{{{
+  static uint64_t getKey (const uint8_t* buffer, int size, uint32_t width, uint32_t height, bool flip) {
+  // 64 bit multiply xor hash of the source, 8 bytes a step, mixed with the decode params
+
+    const uint64_t kMul = 0x9E3779B97F4A7C15ull;
+
+    uint64_t hash = (uint64_t)size * kMul;
+    int i = 0;
+    for (; i + 8 <= size; i += 8) {
+      uint64_t word;
+      memcpy (&word, buffer + i, 8);
+      hash = (hash ^ word) * kMul;
+      hash ^= hash >> 29;
+      }
+    for (; i < size; i++)
+      hash = (hash ^ buffer[i]) * kMul;
+
+    hash = (hash ^ (((uint64_t)width << 32) | height)) * kMul;
+    hash = (hash ^ (flip ? 1 : 0)) * kMul;
+    return hash ^ (hash >> 32);
+    }
+  //}}}
+
+  //{{{
+  std::shared_ptr<sPic> findCached (uint64_t key) {
+  // lock held, hit moves to the front of the lru
+
+    auto it = mCacheIndex.find (key);
+    if (it == mCacheIndex.end())
+      return nullptr;
+
+    mCache.splice (mCache.begin(), mCache, it->second);
+    return it->second->mPic;
+    }
+  //}}}
+  //{{{
+  void addCached (uint64_t key, const std::shared_ptr<sPic>& pic) {
+  // lock held, pics bigger than the whole budget are not cached
+
+    if ((pic->getBytes() > mCacheBytes) || (mCacheIndex.find (key) != mCacheIndex.end()))
+      return;
+
+    mCache.push_front ({ key, pic });
+    mCacheIndex[key] = mCache.begin();
+    mCachedBytes += pic->getBytes();
+    trimCache();
+    }
+  //}}}
+  //{{{
+  void trimCache() {
+  // lock held, evict least recently used until within budget
+
+    while ((mCachedBytes > mCacheBytes) && !mCache.empty()) {
+      mCachedBytes -= mCache.back().mPic->getBytes();
+      mCacheIndex.erase (mCache.back().mKey);
+      mCache.pop_back();
+      }
+    }
+  //}}}
+
+  //{{{
+  bool dropQueued (const std::shared_ptr<cRequest>& request) {
+  // lock held, true if it was still queued
+
+    auto it = std::find (mQueue.begin(), mQueue.end(), request);
+    if (it == mQueue.end())
+      return false;
+
+    mQueue.erase (it);
+    request->mState = eCancelled;
+    return true;
+    }
+  //}}}
+  //{{{
+  std::shared_ptr<cRequest> takeRequest() {
+  // lock held, lowest priority then oldest, queue is short so a scan beats reordering on setPriority
+
+    auto best = mQueue.begin();
+    for (auto it = mQueue.begin(); it != mQueue.end(); ++it)
+      if (((*it)->mPriority < (*best)->mPriority) ||
+          (((*it)->mPriority == (*best)->mPriority) && ((*it)->mSequence < (*best)->mSequence)))
+        best = it;
+
+    auto request = *best;
+    mQueue.erase (best);
+    return request;
+    }
+  //}}}
+  //{{{
+  static std::shared_ptr<sPic> decode (cRequest& request) {
+  // decode, halve while still covering the target size, flip, nullptr on error
+
+    // already on one of the pool threads, no nested jpeg threads
+    cDecodePic decodePic (1);
+    if (!decodePic.setPicRgba (request.mBuffer, request.mSize, request.mWidth, request.mHeight))
+      return nullptr;
+
+    uint32_t width = decodePic.getWidth();
+    uint32_t height = decodePic.getHeight();
+    uint8_t* pic = decodePic.getPic();
+
+    if (request.mWidth && request.mHeight)
+      while ((width / 2 >= request.mWidth) && (height / 2 >= request.mHeight)) {
+        halve (pic, width, height);
+        width /= 2;
+        height /= 2;
+        }
+
+    if (request.mFlip)
+      flip (pic, width, height);
+
+    return std::make_shared<sPic> (pic, width, height);
+    }
+  //}}}
+  //{{{
+  static void halve (uint8_t* pic, uint32_t width, uint32_t height) {
+  // 2x2 box filter in place, odd last row or column dropped
+
+    uint32_t stride = width * 4;
+    uint8_t* dst = pic;
+    for (uint32_t y = 0; y < height / 2; y++) {
+      const uint8_t* src0 = pic + (y * 2) * stride;
+      const uint8_t* src1 = src0 + stride;
+      for (uint32_t x = 0; x < width / 2; x++, src0 += 8, src1 += 8)
+        for (int c = 0; c < 4; c++)
+          *dst++ = (uint8_t)((src0[c] + src0[c+4] + src1[c] + src1[c+4] + 2) >> 2);
+      }
+    }
+  //}}}
+  //{{{
+  static void flip (uint8_t* pic, uint32_t width, uint32_t height) {
+  // swap rows top to bottom in place
+
+    uint32_t stride = width * 4;
+    std::vector<uint8_t> row (stride);
+    for (uint32_t y = 0; y < height / 2; y++) {
+      uint8_t* top = pic + y * stride;
+      uint8_t* bottom = pic + (height - 1 - y) * stride;
+      memcpy (row.data(), top, stride);
+      memcpy (top, bottom, stride);
+      memcpy (bottom, row.data(), stride);
+      }
+    }
+  //}}}
+  //{{{
+  void decodeThread() {
+
+    while (true) {
+      std::shared_ptr<cRequest> request;
+      {
+      std::unique_lock<std::mutex> lock (mMutex);
+      mWake.wait (lock, [&]() { return mExit || !mQueue.empty(); });
+      if (mExit)
+        return;
+
+      request = takeRequest();
+
+      // same source and size decoded meanwhile by an earlier request
+      request->mPic = findCached (request->mKey);
+      if (request->mPic) {
+        request->mState = eDone;
+        continue;
+        }
+      request->mState = eDecoding;
+      }
+
+      std::shared_ptr<sPic> pic;
+      if (mDiskCache) {
+        //{{{  try disk, store decode there
+        auto entry = mDiskCache->find (request->mKey, cPicDiskCache::eRgba);
+        if (entry)
+          pic = std::make_shared<sPic> (std::move (entry));
+        else {
+          pic = decode (*request);
+          if (pic)
+            mDiskCache->store (request->mKey, cPicDiskCache::eRgba, pic->mPic, pic->mWidth, pic->mHeight);
+          }
+        }
+        //}}}
+      else
+        pic = decode (*request);
+
+      std::unique_lock<std::mutex> lock (mMutex);
+      if (pic)
+        addCached (request->mKey, pic);
+      request->mPic = pic;
+      request->mState = pic ? eDone : eFailed;
+      mDecoded.notify_all();
+      }
+    }
+  //}}}
+
+  // requests
+  std::mutex mMutex;
+  std::condition_variable mWake;
+  std::condition_variable mDecoded;
+  std::vector<std::shared_ptr<cRequest>> mQueue;
+  uint64_t mSequence = 0;
+  bool mExit = false;
+
+  // lru cache, front most recent
+  size_t mCacheBytes;
+  size_t mCachedBytes = 0;
+  std::list<sCached> mCache;
+  std::map<uint64_t, std::list<sCached>::iterator> mCacheIndex;
+
+  cPicDiskCache* mDiskCache = nullptr;
+
+  std::vector<std::thread> mThreads;
+  };
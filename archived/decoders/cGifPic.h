@@ -1,5 +1,8 @@
 // cGifPic.h - remember the dodgy realloc
+// - frames composited sequentially onto a persistent BGRA canvas, disposal applied between frames
+// - bounded cache of composited frames, looping replays from cache, seeks restart from the nearest cached frame
 #pragma once
+#include <vector>
 #include "iPic.h"
 //{{{  defines
 /*  Maximum colour table size */
@@ -50,6 +53,10 @@ public:
 
     free (mGlobal_colour_table);
     mGlobal_colour_table = NULL;
+
+    // canvas mPicBuffer handed on by getPic, not freed
+    free (mRestoreBuffer);
+    setCacheBytes (0);
     }
   //}}}
   void* operator new (std::size_t size) { return malloc (size); }
@@ -81,6 +88,30 @@ public:
     }
   //}}}
 
+  // animation, valid after readHeader
+  int getFrameCount() { return mFrame_count; }
+  int getLoopCount() { return mloop_count; }
+  //{{{
+  int getFrameDelay (unsigned int frame) {
+  // ms to show frame, gif delays are in 1/100s
+
+    return (frame < mFrame_count) ? mFrames[frame].frame_delay * 10 : 0;
+    }
+  //}}}
+  //{{{
+  void setCacheBytes (size_t bytes) {
+  // bound composited frame cache, 0 frees it, frames cached in order while they fit
+
+    mCacheBytes = bytes;
+    for (auto& frame : mCache) {
+      free (frame);
+      frame = nullptr;
+      }
+    mCache.clear();
+    mCachedBytes = 0;
+    }
+  //}}}
+
   //{{{
   eGifResult readHeader(){
 
@@ -88,7 +119,6 @@ public:
     mGifData = mSrcBuffer;
 
     unsigned char* gifData;
-    unsigned int index;
     eGifResult return_value;
 
     if (buffer_size < 13)
@@ -184,19 +214,10 @@ public:
     if (mGlobal_colour_table[0] == GIF_PROCESS_COLOURS) {
       /*  Check for a global colour map signified by bit 7 */
       if (mGlobal_colours) {
-        if (buffer_size < (mcolour_table_size * 3 + 12))
+        if (buffer_size < (mcolour_table_size * 3 + 13))
           return GIF_INSUFFICIENT_DATA;
-        for (index = 0; index < mcolour_table_size; index++) {
-          /* Gif colour map contents are r,g,b.
-           * We want to pack them bytewise into the colour table, such that the red component
-           * is in byte 0 and the alpha component is in * byte 3. */
-          unsigned char *entry = (unsigned char*)&mGlobal_colour_table[index];
-          entry[0] = gifData[0]; /* r */
-          entry[1] = gifData[1]; /* g */
-          entry[2] = gifData[2]; /* b */
-          entry[3] = 0xff;  /* a */
-          gifData += 3;
-          }
+        gif_read_colour_table (mGlobal_colour_table, gifData, mcolour_table_size);
+        gifData += 3 * mcolour_table_size;
         buffer_position = (unsigned int)(gifData - mGifData);
         }
       else {
@@ -226,265 +247,58 @@ public:
   //}}}
   //{{{
   eGifResult decodeBody (unsigned int frame) {
+  // composite frame onto the mPicBuffer canvas as BGRA
+  // - next frame decodes just its own image, a seek restarts from the nearest cached frame or frame 0
 
-    unsigned int index = 0;
-    unsigned char* gifData, *gif_end;
-    int gif_bytes;
-    unsigned int width, height, offset_x, offset_y;
-    unsigned int flags, colour_table_size, interlace;
-    unsigned int *colour_table;
-    unsigned int *frame_data = 0; // Set to 0 for no warnings
-    unsigned int *frame_scanline;
-    unsigned int save_buffer_position;
-    unsigned int return_value = 0;
-    unsigned int x, y, decode_y, burst_bytes;
-    int last_undisposed_frame = (frame - 1);
-    unsigned char colour;
-
-    /*  Ensure this frame is supposed to be decoded */
-    if (mFrames[frame].display == false) {
-      mcurrent_error = GIF_FRAME_NO_DISPLAY;
-      return GIF_OK;
-      }
-
-    /*  Ensure we have a frame to decode */
-    if (frame > mFrame_count_partial)
+    if (frame >= mFrame_count_partial)
       return GIF_INSUFFICIENT_DATA;
-    if ((!clear_image) && ((int)frame == mdecoded_frame))
+    if ((int)frame == mdecoded_frame)
       return GIF_OK;
 
-    /*  Get the start of our frame data and the end of the GIF data */
-    gifData = mGifData + mFrames[frame].frame_pointer;
-    gif_end = mGifData + buffer_size;
-    gif_bytes = (unsigned int)(gif_end - gifData);
-
-    /*  Check if we have enough data The shortest block of data is a 10-byte image descriptor + 1-byte gif trailer */
-    if (gif_bytes < 12) return GIF_INSUFFICIENT_FRAME_DATA;
-
-    /*  Save the buffer position */
-    save_buffer_position = buffer_position;
-    buffer_position = (unsigned int)(gifData - mGifData);
-
-    /*  Skip any extensions because we all ready processed them */
-    if ((return_value = gif_skip_frame_extensions()) != GIF_OK)
-      goto gif_decode_frame_exit;
-    gifData = (mGifData + buffer_position);
-    gif_bytes = (unsigned int)(gif_end - gifData);
-
-    /*  Ensure we have enough data for the 10-byte image descriptor + 1-byte gif trailer */
-    if (gif_bytes < 12) {
-      return_value = GIF_INSUFFICIENT_FRAME_DATA;
-      goto gif_decode_frame_exit;
-      }
-
-    /* 10-byte Image Descriptor is:
-     *  +0  CHAR  Image Separator (0x2c)
-     *  +1  SHORT Image Left Position
-     *  +3  SHORT Image Top Position
-     *  +5  SHORT Width
-     *  +7  SHORT Height
-     *  +9  CHAR  __Packed Fields__
-     *      1BIT  Local Colour Table Flag
-     *      1BIT  Interlace Flag
-     *      1BIT  Sort Flag
-     *      2BITS Reserved
-     *      3BITS Size of Local Colour Table */
-    if (gifData[0] != GIF_IMAGE_SEPARATOR) {
-      return_value = GIF_DATA_ERROR;
-      goto gif_decode_frame_exit;
-      }
-    offset_x = gifData[1] | (gifData[2] << 8);
-    offset_y = gifData[3] | (gifData[4] << 8);
-    width = gifData[5] | (gifData[6] << 8);
-    height = gifData[7] | (gifData[8] << 8);
-
-    /*  Boundary checking - shouldn't ever happen except unless the data has been modified since initialisation. */
-    if ((offset_x + width > mWidth) || (offset_y + height > mHeight)) {
-      return_value = GIF_DATA_ERROR;
-      goto gif_decode_frame_exit;
-      }
-
-    /*  Decode the flags */
-    flags = gifData[9];
-    colour_table_size = 2 << (flags & GIF_COLOUR_TABLE_SIZE_MASK);
-    interlace = flags & GIF_INTERLACE_MASK;
-
-    /*  Move our pointer to the colour table or image data (if no colour table is given) */
-    gifData += 10;
-    gif_bytes = (unsigned int)(gif_end - gifData);
-
-    /*  Set up the colour table */
-    if (flags & GIF_COLOUR_TABLE_MASK) {
-      if (gif_bytes < (int)(3 * colour_table_size)) {
-        return_value = GIF_INSUFFICIENT_FRAME_DATA;
-        goto gif_decode_frame_exit;
-        }
-      colour_table = mlocal_colour_table;
-      if (!clear_image) {
-        for (index = 0; index < colour_table_size; index++) {
-          /* Gif colour map contents are r,g,b.
-           * We want to pack them bytewise into the colour table, such that the red component
-           * is in byte 0 and the alpha component is in * byte 3. */
-          unsigned char *entry = (unsigned char *) &colour_table[index];
-          entry[0] = gifData[0]; /* r */
-          entry[1] = gifData[1]; /* g */
-          entry[2] = gifData[2]; /* b */
-          entry[3] = 0xff;  /* a */
-          gifData += 3;
-          }
-        }
-      else {
-        gifData += 3 * colour_table_size;
-        }
-      gif_bytes = (unsigned int)(gif_end - gifData);
-      }
-    else
-      colour_table = mGlobal_colour_table;
-
-    /*  Check if we've finished */
-    if (gif_bytes < 1) {
-      return_value = GIF_INSUFFICIENT_FRAME_DATA;
-      goto gif_decode_frame_exit;
-      }
-    else if (gifData[0] == GIF_TRAILER) {
-      return_value = GIF_OK;
-      goto gif_decode_frame_exit;
+    unsigned int canvasBytes = mWidth * mHeight * 4;
+    if ((frame < mCache.size()) && mCache[frame]) {
+      // cached
+      memcpy (mPicBuffer, mCache[frame], canvasBytes);
+      mdecoded_frame = frame;
+      return GIF_OK;
       }
 
-    /*  Get the frame data */
-    frame_data = (unsigned int*)mPicBuffer;
-
-    /*  If we are clearing the image we just clear, if not decode */
-    if (!clear_image) {
-      /*  Ensure we have enough data for a 1-byte LZW code size + 1-byte gif trailer */
-      if (gif_bytes < 2) {
-        return_value = GIF_INSUFFICIENT_FRAME_DATA;
-        goto gif_decode_frame_exit;
-      /*  If we only have a 1-byte LZW code size + 1-byte gif trailer, we're finished */
-        }
-      else if ((gif_bytes == 2) && (gifData[1] == GIF_TRAILER)) {
-        return_value = GIF_OK;
-        goto gif_decode_frame_exit;
-        }
-
-      /*  If the previous frame's disposal method requires we restore the background
-       *  colour or this is the first frame, clear the frame data */
-      if ((frame == 0) || (mdecoded_frame == GIF_INVALID_FRAME)) {
-        memset((char*)frame_data, GIF_TRANSPARENT_COLOUR, mWidth * mHeight * sizeof(int));
-        mdecoded_frame = frame;
-        /* The line below would fill the image with its background color, but because GIFs support
-         * transparency we likely wouldn't want to do that. */
-        /* memset((char*)frame_data, colour_table[mbackground_index], mWidth * mHeight * sizeof(int)); */
-        }
-      else if ((frame != 0) && (mFrames[frame - 1].disposal_method == GIF_FRAME_CLEAR)) {
-        clear_image = true;
-        if ((return_value = decodeBody((frame - 1))) != GIF_OK)
-          goto gif_decode_frame_exit;
-        clear_image = false;
-      /*  If the previous frame's disposal method requires we restore the previous
-       *  image, find the last image set to "do not dispose" and get that frame data
-      */
-        }
-      else if ((frame != 0) && (mFrames[frame - 1].disposal_method == GIF_FRAME_RESTORE)) {
-        while ((last_undisposed_frame != -1) && (mFrames[--last_undisposed_frame].disposal_method == GIF_FRAME_RESTORE))
-          ;
-
-        /*  If we don't find one, clear the frame data */
-        if (last_undisposed_frame == -1)
-          /* see notes above on transparency vs. background color */
-          memset((char*)frame_data, GIF_TRANSPARENT_COLOUR, mWidth * mHeight * sizeof(int));
-
-        else {
-          if ((return_value = decodeBody(last_undisposed_frame)) != GIF_OK)
-            goto gif_decode_frame_exit;
-          /*  Get this frame's data */
-          frame_data = (unsigned int*)mPicBuffer;
-          }
+    // start from the canvas if it holds an earlier frame that can be disposed
+    int start = GIF_INVALID_FRAME;
+    if ((mdecoded_frame != GIF_INVALID_FRAME) && (mdecoded_frame < (int)frame) &&
+        ((mFrames[mdecoded_frame].disposal_method != GIF_FRAME_RESTORE) || (mRestoreFrame == mdecoded_frame)))
+      start = mdecoded_frame;
+
+    // or a later cached frame, restore disposal needs the canvas before it, not cached
+    for (int cached = (int)frame - 1; cached > start; cached--)
+      if ((cached < (int)mCache.size()) && mCache[cached] &&
+          (mFrames[cached].disposal_method != GIF_FRAME_RESTORE)) {
+        memcpy (mPicBuffer, mCache[cached], canvasBytes);
+        start = cached;
+        break;
         }
-      mdecoded_frame = frame;
 
-      /*  Initialise the LZW decoding */
-      set_code_size = gifData[0];
-      buffer_position = (unsigned int)(gifData - mGifData) + 1;
-
-      /*  Set our code variables */
-      code_size = set_code_size + 1;
-      clear_code = (1 << set_code_size);
-      end_code = clear_code + 1;
-      max_code_size = clear_code << 1;
-      max_code = clear_code + 2;
-      curbit = lastbit = 0;
-      last_byte = 2;
-      get_done = false;
-      direct = buf;
-      gif_init_LZW();
-
-      /*  Decompress the data */
-      for (y = 0; y < height; y++) {
-        if (interlace)
-          decode_y = gif_interlaced_line(height, y) + offset_y;
-        else
-          decode_y = y + offset_y;
-        frame_scanline = frame_data + offset_x + (decode_y * mWidth);
-
-        /*  Rather than decoding pixel by pixel, we try to burst out streams
-          of data to remove the need for end-of data checks every pixel. */
-        x = width;
-        while (x > 0) {
-          burst_bytes = (unsigned int)(mStackpointer - stack);
-          if (burst_bytes > 0) {
-            if (burst_bytes > x)
-              burst_bytes = x;
-            x -= burst_bytes;
-            while (burst_bytes-- > 0) {
-              colour = *--mStackpointer;
-              if (((mFrames[frame].transparency) &&
-                (colour != mFrames[frame].transparency_index)) ||
-                (!mFrames[frame].transparency))
-                  *frame_scanline = colour_table[colour];
-              frame_scanline++;
-              }
-            }
-          else {
-            if (!gif_next_LZW()) {
-              /*  Unexpected end of frame, try to recover */
-              if (mcurrent_error == GIF_END_OF_FRAME)
-                return_value = GIF_OK;
-              else
-                return_value = mcurrent_error;
-              goto gif_decode_frame_exit;
-              }
-            }
-         }
-        }
-      }
-    else {
-      /*  Clear our frame */
-      if (mFrames[frame].disposal_method == GIF_FRAME_CLEAR) {
-        for (y = 0; y < height; y++) {
-          frame_scanline = frame_data + offset_x + ((offset_y + y) * mWidth);
-          if (mFrames[frame].transparency)
-            memset(frame_scanline, GIF_TRANSPARENT_COLOUR, width * 4);
-          else
-            memset(frame_scanline, colour_table[mbackground_index], width * 4);
-          }
-        }
-      }
-  gif_decode_frame_exit:
-    /*  Check if we should test for optimisation */
-    if (mFrames[frame].virgin) {
-      mFrames[frame].opaque = false;
-      mFrames[frame].virgin = false;
+    // or a blank canvas
+    if (start == GIF_INVALID_FRAME)
+      memset (mPicBuffer, GIF_TRANSPARENT_COLOUR, canvasBytes);
+    else
+      gif_dispose_frame (start);
+
+    // frames before it draw what they can, as if played through
+    eGifResult return_value = GIF_OK;
+    for (int next = start + 1; next <= (int)frame; next++) {
+      mdecoded_frame = next;
+      return_value = gif_draw_frame (next);
+      if (next < (int)frame)
+        gif_dispose_frame (next);
+      else if (return_value == GIF_OK)
+        gif_cache_frame (next);
       }
 
-    buffer_position = save_buffer_position;
-
-    // twiddle RGBA to BGRA
-    auto rgbaBuf = (uint32_t*)getPic();
-    for (int i = 0; i < getWidth() * getHeight(); i++)
-      rgbaBuf[i] = (rgbaBuf[i] & 0xFF00FF00) | ((rgbaBuf[i] & 0x000000FF) << 16) | ((rgbaBuf[i] & 0x00FF0000) >> 16);
+    if (!mFrames[frame].display)
+      mcurrent_error = GIF_FRAME_NO_DISPLAY;
 
-    return (eGifResult)return_value;
+    return return_value;
     }
   //}}}
 
@@ -511,8 +325,11 @@ private:
     max_width = (width > mWidth) ? width : mWidth;
     max_height = (height > mHeight) ? height : mHeight;
 
-    /*  Allocate some more memory */
+    /*  Allocate some more memory, nothing decoded yet to keep */
+    free (mPicBuffer);
     mPicBuffer = malloc ((max_width * max_height * 4));
+    if (mPicBuffer == NULL)
+      return GIF_INSUFFICIENT_MEMORY;
     mWidth = max_width;
     mHeight = max_height;
 
@@ -675,6 +492,8 @@ private:
     mFrames[frame].transparency = false;
     mFrames[frame].frame_delay = 100;
     mFrames[frame].redraw_required = false;
+    mFrames[frame].rect_width = 0;
+    mFrames[frame].rect_height = 0;
 
     /*  Invalidate any previous decoding we have of this frame */
     if (mdecoded_frame == frame)
@@ -882,60 +701,309 @@ private:
     }
   //}}}
   //{{{
-  int gif_next_code (int code_size) {
+  eGifResult gif_draw_frame (unsigned int frame) {
+  // decode frame image onto the canvas, canvas under its rect saved first if its disposal restores it
 
-    int i, j, end, count, ret;
-    unsigned char *b;
+    unsigned char* gifData, *gif_end;
+    int gif_bytes;
+    unsigned int width, height, offset_x, offset_y;
+    unsigned int flags, colour_table_size, interlace;
+    unsigned int* colour_table;
+    unsigned int* frame_scanline;
+    unsigned int save_buffer_position;
+    eGifResult return_value = GIF_OK;
 
-    end = curbit + code_size;
-    if (end >= lastbit) {
-      if (get_done)
-        return GIF_END_OF_FRAME;
-      buf[0] = direct[last_byte - 2];
-      buf[1] = direct[last_byte - 1];
+    /*  Nothing to dispose until the rect is known */
+    mFrames[frame].rect_width = 0;
+    mFrames[frame].rect_height = 0;
 
-      /* get the next block */
-      direct = mGifData + buffer_position;
-      if (buffer_position >= buffer_size)
-        return GIF_INSUFFICIENT_FRAME_DATA;
-      zero_data_block = ((count = direct[0]) == 0);
-      if ((buffer_position + count) >= buffer_size)
+    /*  Ensure this frame is supposed to be decoded */
+    if (mFrames[frame].display == false)
+      return GIF_OK;
+
+    /*  Get the start of our frame data and the end of the GIF data */
+    gifData = mGifData + mFrames[frame].frame_pointer;
+    gif_end = mGifData + buffer_size;
+    gif_bytes = (unsigned int)(gif_end - gifData);
+
+    /*  Check if we have enough data The shortest block of data is a 10-byte image descriptor + 1-byte gif trailer */
+    if (gif_bytes < 12)
+      return GIF_INSUFFICIENT_FRAME_DATA;
+
+    /*  Save the buffer position */
+    save_buffer_position = buffer_position;
+    buffer_position = (unsigned int)(gifData - mGifData);
+
+    /*  Skip any extensions because we all ready processed them */
+    return_value = gif_skip_frame_extensions();
+    gifData = (mGifData + buffer_position);
+    gif_bytes = (unsigned int)(gif_end - gifData);
+    buffer_position = save_buffer_position;
+    if (return_value != GIF_OK)
+      return return_value;
+
+    /*  Ensure we have enough data for the 10-byte image descriptor + 1-byte gif trailer */
+    if (gif_bytes < 12)
+      return GIF_INSUFFICIENT_FRAME_DATA;
+
+    /* 10-byte Image Descriptor is:
+     *  +0  CHAR  Image Separator (0x2c)
+     *  +1  SHORT Image Left Position
+     *  +3  SHORT Image Top Position
+     *  +5  SHORT Width
+     *  +7  SHORT Height
+     *  +9  CHAR  __Packed Fields__
+     *      1BIT  Local Colour Table Flag
+     *      1BIT  Interlace Flag
+     *      1BIT  Sort Flag
+     *      2BITS Reserved
+     *      3BITS Size of Local Colour Table */
+    if (gifData[0] != GIF_IMAGE_SEPARATOR)
+      return GIF_DATA_ERROR;
+    offset_x = gifData[1] | (gifData[2] << 8);
+    offset_y = gifData[3] | (gifData[4] << 8);
+    width = gifData[5] | (gifData[6] << 8);
+    height = gifData[7] | (gifData[8] << 8);
+
+    /*  Boundary checking - shouldn't ever happen except unless the data has been modified since initialisation. */
+    if ((offset_x + width > mWidth) || (offset_y + height > mHeight))
+      return GIF_DATA_ERROR;
+
+    /*  Decode the flags */
+    flags = gifData[9];
+    colour_table_size = 2 << (flags & GIF_COLOUR_TABLE_SIZE_MASK);
+    interlace = flags & GIF_INTERLACE_MASK;
+
+    /*  Move our pointer to the colour table or image data (if no colour table is given) */
+    gifData += 10;
+    gif_bytes = (unsigned int)(gif_end - gifData);
+
+    /*  Set up the colour table */
+    if (flags & GIF_COLOUR_TABLE_MASK) {
+      if (gif_bytes < (int)(3 * colour_table_size))
         return GIF_INSUFFICIENT_FRAME_DATA;
-      if (count == 0)
-        get_done = true;
-      else {
-        if (buffer_position + 3 >= buffer_size)
-          return GIF_INSUFFICIENT_FRAME_DATA;
-        direct -= 1;
-        buf[2] = direct[2];
-        buf[3] = direct[3];
+      colour_table = mlocal_colour_table;
+      gif_read_colour_table (colour_table, gifData, colour_table_size);
+      gifData += 3 * colour_table_size;
+      gif_bytes = (unsigned int)(gif_end - gifData);
+      }
+    else
+      colour_table = mGlobal_colour_table;
+
+    /*  Remember the rect and colour to clear it to, for disposal */
+    mFrames[frame].rect_x = offset_x;
+    mFrames[frame].rect_y = offset_y;
+    mFrames[frame].rect_width = width;
+    mFrames[frame].rect_height = height;
+    mFrames[frame].clear_colour = mFrames[frame].transparency ? GIF_TRANSPARENT_COLOUR : colour_table[mbackground_index];
+
+    /*  Check if we've finished */
+    if (gif_bytes < 1)
+      return GIF_INSUFFICIENT_FRAME_DATA;
+    else if (gifData[0] == GIF_TRAILER)
+      return GIF_OK;
+
+    /*  Ensure we have enough data for a 1-byte LZW code size + 1-byte gif trailer */
+    if (gif_bytes < 2)
+      return GIF_INSUFFICIENT_FRAME_DATA;
+    /*  If we only have a 1-byte LZW code size + 1-byte gif trailer, we're finished */
+    else if ((gif_bytes == 2) && (gifData[1] == GIF_TRAILER))
+      return GIF_OK;
+
+    /*  Save what the frame covers if its disposal restores it */
+    if (mFrames[frame].disposal_method == GIF_FRAME_RESTORE) {
+      if (!mRestoreBuffer)
+        mRestoreBuffer = (unsigned int*)malloc (mWidth * mHeight * sizeof(int));
+      if (!mRestoreBuffer)
+        return GIF_INSUFFICIENT_MEMORY;
+      gif_copy_rect (mRestoreBuffer, (unsigned int*)mPicBuffer, frame);
+      mRestoreFrame = frame;
+      }
+
+    /*  Initialise the LZW decoding */
+    set_code_size = gifData[0];
+    clear_code = (1 << set_code_size);
+    end_code = clear_code + 1;
+    gif_init_codes (gifData + 1);
+    gif_init_LZW();
+
+    /*  Decompress the data */
+    unsigned int* frame_data = (unsigned int*)mPicBuffer;
+    bool transparency = mFrames[frame].transparency;
+    unsigned char transparency_index = mFrames[frame].transparency_index;
+    for (unsigned int y = 0; y < height; y++) {
+      unsigned int decode_y = (interlace ? gif_interlaced_line (height, y) : y) + offset_y;
+      frame_scanline = frame_data + offset_x + (decode_y * mWidth);
+
+      /*  Rather than decoding pixel by pixel, we try to burst out streams
+        of data to remove the need for end-of data checks every pixel. */
+      unsigned int x = width;
+      while (x > 0) {
+        unsigned int burst_bytes = (unsigned int)(mStackpointer - stack);
+        if (burst_bytes > 0) {
+          if (burst_bytes > x)
+            burst_bytes = x;
+          x -= burst_bytes;
+          if (transparency)
+            while (burst_bytes-- > 0) {
+              unsigned char colour = *--mStackpointer;
+              if (colour != transparency_index)
+                *frame_scanline = colour_table[colour];
+              frame_scanline++;
+              }
+          else
+            while (burst_bytes-- > 0)
+              *frame_scanline++ = colour_table[*--mStackpointer];
+          }
+        else if (!gif_next_LZW()) {
+          /*  Unexpected end of frame, try to recover */
+          return (mcurrent_error == GIF_END_OF_FRAME) ? GIF_OK : mcurrent_error;
+          }
         }
-      buffer_position += count + 1;
+      }
 
-      /* update our variables */
-      last_byte = 2 + count;
-      curbit = (curbit - lastbit) + 16;
-      lastbit = (2 + count) << 3;
-      end = curbit + code_size;
+    /*  Check if we should test for optimisation */
+    if (mFrames[frame].virgin) {
+      mFrames[frame].opaque = false;
+      mFrames[frame].virgin = false;
       }
 
-    i = curbit >> 3;
-    if (i < 2)
-      b = buf;
-    else
-      b = direct;
-
-    ret = b[i];
-    j = (end >> 3) - 1;
-    if (i <= j) {
-      ret |= (b[i + 1] << 8);
-      if (i < j)
-        ret |= (b[i + 2] << 16);
+    return GIF_OK;
+    }
+  //}}}
+  //{{{
+  void gif_dispose_frame (unsigned int frame) {
+  // apply frame disposal to the canvas before the next frame is drawn over it
+
+    if (!mFrames[frame].display)
+      return;
+
+    unsigned int* frame_data = (unsigned int*)mPicBuffer;
+    if (mFrames[frame].disposal_method == GIF_FRAME_CLEAR) {
+      for (unsigned int y = 0; y < mFrames[frame].rect_height; y++) {
+        unsigned int* frame_scanline = frame_data + mFrames[frame].rect_x + ((mFrames[frame].rect_y + y) * mWidth);
+        for (unsigned int x = 0; x < mFrames[frame].rect_width; x++)
+          frame_scanline[x] = mFrames[frame].clear_colour;
+        }
+      }
+    else if ((mFrames[frame].disposal_method == GIF_FRAME_RESTORE) && ((int)frame == mRestoreFrame))
+      gif_copy_rect (frame_data, mRestoreBuffer, frame);
+    }
+  //}}}
+  //{{{
+  void gif_copy_rect (unsigned int* dst, const unsigned int* src, unsigned int frame) {
+  // copy canvas rect of frame
+
+    for (unsigned int y = 0; y < mFrames[frame].rect_height; y++) {
+      unsigned int offset = mFrames[frame].rect_x + ((mFrames[frame].rect_y + y) * mWidth);
+      memcpy (dst + offset, src + offset, mFrames[frame].rect_width * sizeof(int));
+      }
+    }
+  //}}}
+  //{{{
+  void gif_cache_frame (unsigned int frame) {
+  // keep a copy of the composited frame if it fits the cache budget
+
+    size_t canvasBytes = mWidth * mHeight * 4;
+    if (mCachedBytes + canvasBytes > mCacheBytes)
+      return;
+
+    if (mCache.size() < mFrame_count_partial)
+      mCache.resize (mFrame_count_partial, nullptr);
+    if (mCache[frame])
+      return;
+
+    mCache[frame] = (uint8_t*)malloc (canvasBytes);
+    if (mCache[frame]) {
+      memcpy (mCache[frame], mPicBuffer, canvasBytes);
+      mCachedBytes += canvasBytes;
+      }
+    }
+  //}}}
+  //{{{
+  void gif_read_colour_table (unsigned int* colour_table, const unsigned char* gifData, unsigned int colour_table_size) {
+  // gif colour map contents are r,g,b, packed bytewise as the canvas, b in byte 0, alpha in byte 3
+
+    for (unsigned int index = 0; index < colour_table_size; index++) {
+      unsigned char* entry = (unsigned char*)&colour_table[index];
+      entry[0] = gifData[2]; /* b */
+      entry[1] = gifData[1]; /* g */
+      entry[2] = gifData[0]; /* r */
+      entry[3] = 0xff;  /* a */
+      gifData += 3;
+      }
+    }
+  //}}}
+  //{{{
+  void gif_init_codes (const unsigned char* blocks) {
+  // start code reader at the first data sub-block length byte
+
+    mCodePtr = blocks;
+    mCodeEnd = blocks;
+    mCodeBuf = 0;
+    mCodeBits = 0;
+    mCodesDone = false;
+    mCodesTruncated = false;
+    }
+  //}}}
+  //{{{
+  void gif_refill_codes() {
+  // top mCodeBuf up to more than 56 bits, 8 bytes at a time inside a sub-block, bytewise across them
+
+    if (mCodeEnd - mCodePtr >= 8) {
+      uint64_t bytes;
+      memcpy (&bytes, mCodePtr, 8);
+      mCodeBuf |= bytes << mCodeBits;
+      mCodePtr += (63 - mCodeBits) >> 3;
+      mCodeBits |= 56;
+      return;
+      }
+
+    while (mCodeBits <= 56) {
+      if (mCodePtr == mCodeEnd) {
+        // next sub-block, zero length ends the image data
+        if (mCodesDone)
+          return;
+
+        const unsigned char* gif_end = mGifData + buffer_size;
+        if (mCodePtr >= gif_end) {
+          mCodesDone = true;
+          mCodesTruncated = true;
+          return;
+          }
+
+        unsigned int count = *mCodePtr++;
+        if (count > (unsigned int)(gif_end - mCodePtr)) {
+          count = (unsigned int)(gif_end - mCodePtr);
+          mCodesTruncated = true;
+          }
+        mCodeEnd = mCodePtr + count;
+        if (count == 0) {
+          mCodesDone = true;
+          return;
+          }
+        continue;
+        }
+
+      mCodeBuf |= (uint64_t)*mCodePtr++ << mCodeBits;
+      mCodeBits += 8;
+      }
+    }
+  //}}}
+  //{{{
+  inline int gif_next_code() {
+  // lsb first code_size bits, GIF_END_OF_FRAME past the last sub-block, GIF_INSUFFICIENT_FRAME_DATA past the data
+
+    if (mCodeBits < (unsigned int)code_size) {
+      gif_refill_codes();
+      if (mCodeBits < (unsigned int)code_size)
+        return mCodesTruncated ? GIF_INSUFFICIENT_FRAME_DATA : GIF_END_OF_FRAME;
       }
-    ret = (ret >> (curbit % 8)) & maskTbl[code_size];
 
-    curbit += code_size;
-    return ret;
+    int code = (int)(mCodeBuf & ((1u << code_size) - 1));
+    mCodeBuf >>= code_size;
+    mCodeBits -= code_size;
+    return code;
     }
   //}}}
   //{{{
@@ -943,39 +1011,44 @@ private:
 
     int i;
     mcurrent_error = (eGifResult)0;
+    mStackpointer = stack;
     if (clear_code >= (1 << GIF_MAX_LZW)) {
-      mStackpointer = stack;
       mcurrent_error = GIF_FRAME_DATA_ERROR;
       return;
       }
 
-    /* initialise our table */
-    memset(table, 0x00, (1 << GIF_MAX_LZW) * 8);
+    /* initialise our table, codes past max_code are never read */
     for (i = 0; i < clear_code; ++i)
-      table[1][i] = i;
+      suffix[i] = (unsigned char)i;
 
     /* update our LZW parameters */
     code_size = set_code_size + 1;
     max_code_size = clear_code << 1;
     max_code = clear_code + 2;
-    mStackpointer = stack;
     do {
-      firstcode = oldcode = gif_next_code(code_size);
+      firstcode = oldcode = gif_next_code();
       } while (firstcode == clear_code);
 
-    *mStackpointer++ =firstcode;
+    /* error, or a first code outside the initial table */
+    if ((firstcode < 0) || (firstcode >= clear_code)) {
+      mcurrent_error = (firstcode < 0) ? (eGifResult)firstcode : GIF_FRAME_DATA_ERROR;
+      return;
+      }
+
+    *mStackpointer++ = firstcode;
     }
   //}}}
   //{{{
   bool gif_next_LZW () {
 
     int code, incode;
-    int block_size;
-    int new_code;
 
-    code = gif_next_code(code_size);
+    if (mcurrent_error != GIF_OK)
+      return false;
+
+    code = gif_next_code();
     if (code < 0) {
-        mcurrent_error = (eGifResult)code;
+      mcurrent_error = (eGifResult)code;
       return false;
       }
     else if (code == clear_code) {
@@ -983,70 +1056,33 @@ private:
       return true;
       }
     else if (code == end_code) {
-      /* skip to the end of our data so multi-image GIFs work */
-      if (zero_data_block) {
-        mcurrent_error = GIF_FRAME_DATA_ERROR;
-        return false;
-        }
-
-      block_size = 0;
-      while (block_size != 1 &&
-          buffer_position < buffer_size) {
-        block_size = mGifData[buffer_position] + 1;
-        buffer_position += block_size;
-        }
+      /* end before the image is complete */
       mcurrent_error = GIF_FRAME_DATA_ERROR;
       return false;
       }
 
+    /* a code past the next free one is corrupt, so every entry's prefix is a lower code,
+     * chains always end and the longest string fits the stack, no checks per pixel */
     incode = code;
-    if (code >= max_code) {
-      if (mStackpointer >= stack + ((1 << GIF_MAX_LZW) * 2)) {
-        mcurrent_error = GIF_FRAME_DATA_ERROR;
-        return false;
-        }
+    if (code > max_code) {
+      mcurrent_error = GIF_FRAME_DATA_ERROR;
+      return false;
+      }
+    else if (code == max_code) {
       *mStackpointer++ = firstcode;
       code = oldcode;
       }
 
-    /* The following loop is the most important in the GIF decoding cycle as every
-     * single pixel passes through it.
-     * Note: our stack is always big enough to hold a complete decompressed chunk. */
+    /* The following loop is the most important in the GIF decoding cycle as every single pixel passes through it. */
     while (code >= clear_code) {
-      if (mStackpointer >= stack + ((1 << GIF_MAX_LZW) * 2) ||
-          code >= (1 << GIF_MAX_LZW)) {
-        mcurrent_error = GIF_FRAME_DATA_ERROR;
-        return false;
-        }
-      *mStackpointer++ = table[1][code];
-      new_code = table[0][code];
-      if (new_code < clear_code) {
-        code = new_code;
-        break;
-        }
-
-      if (mStackpointer >= stack + ((1 << GIF_MAX_LZW) * 2) ||
-          new_code >= (1 << GIF_MAX_LZW)) {
-        mcurrent_error = GIF_FRAME_DATA_ERROR;
-        return false;
-        }
-      *mStackpointer++ = table[1][new_code];
-      code = table[0][new_code];
-      if (code == new_code) {
-          mcurrent_error = GIF_FRAME_DATA_ERROR;
-        return false;
-        }
+      *mStackpointer++ = suffix[code];
+      code = prefix[code];
       }
-
-    if (mStackpointer >= stack + ((1 << GIF_MAX_LZW) * 2)) {
-      mcurrent_error = GIF_FRAME_DATA_ERROR;
-      return false;
-      }
-    *mStackpointer++ = firstcode = table[1][code];
+    *mStackpointer++ = firstcode = suffix[code];
 
     if ((code = max_code) < (1 << GIF_MAX_LZW)) {
-      table[0][code] = oldcode;
-      table[1][code] = firstcode;
+      prefix[code] = (unsigned short)oldcode;
+      suffix[code] = (unsigned char)firstcode;
       ++max_code;
       if ((max_code >= max_code_size) && (max_code_size < (1 << GIF_MAX_LZW))) {
         max_code_size = max_code_size << 1;
@@ -1062,7 +1098,7 @@ private:
   //{{{  vars
   unsigned int mWidth;
   unsigned int mHeight;
-  void* mPicBuffer;
+  void* mPicBuffer = nullptr;
 
   unsigned int mFrame_count;         /**< number of frames decoded */
   unsigned int mFrame_count_partial; /**< number of frames partially decoded */
@@ -1086,36 +1122,51 @@ private:
     unsigned int redraw_y;            /**< y co-ordinate of redraw rectangle */
     unsigned int redraw_width;        /**< width of redraw rectangle */
     unsigned int redraw_height;       /**< height of redraw rectangle */
+    unsigned int rect_x;              /**< image rect, as last drawn, for disposal */
+    unsigned int rect_y;
+    unsigned int rect_width;
+    unsigned int rect_height;
+    unsigned int clear_colour;        /**< colour the rect clears to on GIF_FRAME_CLEAR disposal */
     };
   //}}}
-  tGifFrame* mFrames;                /**< decoded frames */
+  tGifFrame* mFrames = nullptr;      /**< decoded frames */
 
   eGifResult mcurrent_error;         /**< current error type, or 0 for none*/
-  unsigned char* mGifData;           /**< pointer to GIF data */
+  unsigned char* mGifData = nullptr; /**< pointer to GIF data */
   unsigned int buffer_size = 0;      /**< total number of bytes of GIF data available */
   unsigned int buffer_position = 0;  /**< current index into GIF data */
 
-  unsigned char buf[4];
-  unsigned char* direct;
-  int table[2][(1 << GIF_MAX_LZW)];
+  // lzw codes, read from the sub-blocks 8 bytes at a time
+  const unsigned char* mCodePtr = nullptr;
+  const unsigned char* mCodeEnd = nullptr;
+  uint64_t mCodeBuf = 0;
+  unsigned int mCodeBits = 0;
+  bool mCodesDone = false;
+  bool mCodesTruncated = false;
+
+  unsigned short prefix[(1 << GIF_MAX_LZW)];
+  unsigned char suffix[(1 << GIF_MAX_LZW)];
   unsigned char  stack[(1 << GIF_MAX_LZW) * 2];
-  unsigned char* mStackpointer;
+  unsigned char* mStackpointer = nullptr;
 
   int code_size, set_code_size;
   int max_code, max_code_size;
   int clear_code, end_code;
-  int curbit, lastbit, last_byte;
   int firstcode, oldcode;
-  bool zero_data_block = false;
-  bool get_done;
-  bool clear_image = false;
 
   unsigned int  mFrame_holders;       /**< current number of frame holders */
   unsigned int  mbackground_index;    /**< index in the colour table for the background colour */
   unsigned int  maspect_ratio;        /**< image aspect ratio (ignored) */
   unsigned int  mcolour_table_size;   /**< size of colour table (in entries) */
   bool          mGlobal_colours;      /**< whether the GIF has a global colour table */
-  unsigned int* mGlobal_colour_table; /**< global colour table */
-  unsigned int* mlocal_colour_table;  /**< local colour table */
+  unsigned int* mGlobal_colour_table = nullptr; /**< global colour table */
+  unsigned int* mlocal_colour_table = nullptr;  /**< local colour table */
+
+  unsigned int* mRestoreBuffer = nullptr; /**< canvas under mRestoreFrame, for GIF_FRAME_RESTORE disposal */
+  int mRestoreFrame = GIF_INVALID_FRAME;
+
+  std::vector<uint8_t*> mCache;        /**< composited frames, nullptr if not cached */
+  size_t mCacheBytes = 0;
+  size_t mCachedBytes = 0;
   //}}}
   };
@@ -0,0 +1,608 @@
+// cJpegKernels.h - jpeg idct and ycbcr to bgr(a) row kernels, scalar, SSE2, AVX2, NEON, picked at runtime by cpu
+// - aan idct of prescaled int32 coefficients, every isa bit exact with the scalar reference
+// - colour rows upsample chroma nearest neighbour, full or half width chroma, 3 or 4 bytes per pixel
+#pragma once
+#include <string.h>
+#include "cMpeg2mc.h"
+
+//{{{  aan butterfly, expanded per isa with that isa's add, sub and (a * k) >> 12
+#define JPEG_M2   4433  // 1.08239 * 4096
+#define JPEG_M4  10703  // 2.61313 * 4096
+#define JPEG_M5   7568  // 1.84776 * 4096
+#define JPEG_M13  5792  // 1.41421 * 4096
+
+#define JPEG_AAN(v, ADD, SUB, MUL) {                                                 \
+  auto v0 = v[0], v5 = v[1], v1 = v[2], v7 = v[3], v2 = v[4], v6 = v[5], v3 = v[6], v4 = v[7]; \
+  auto t10 = ADD (v0, v2);                                                          \
+  auto t12 = SUB (v0, v2);                                                          \
+  auto t11 = MUL (SUB (v1, v3), JPEG_M13);                                          \
+  v3 = ADD (v3, v1);                                                                \
+  t11 = SUB (t11, v3);                                                              \
+  v0 = ADD (t10, v3);                                                               \
+  v3 = SUB (t10, v3);                                                               \
+  v1 = ADD (t11, t12);                                                              \
+  v2 = SUB (t12, t11);                                                              \
+  t10 = SUB (v5, v4);                                                               \
+  t11 = ADD (v5, v4);                                                               \
+  t12 = SUB (v6, v7);                                                               \
+  v7 = ADD (v7, v6);                                                                \
+  v5 = MUL (SUB (t11, v7), JPEG_M13);                                               \
+  v7 = ADD (v7, t11);                                                               \
+  auto t13 = MUL (ADD (t10, t12), JPEG_M5);                                         \
+  v4 = SUB (t13, MUL (t10, JPEG_M2));                                               \
+  v6 = SUB (SUB (t13, MUL (t12, JPEG_M4)), v7);                                     \
+  v5 = SUB (v5, v6);                                                                \
+  v4 = SUB (v4, v5);                                                                \
+  v[0] = ADD (v0, v7);                                                              \
+  v[1] = ADD (v1, v6);                                                              \
+  v[2] = ADD (v2, v5);                                                              \
+  v[3] = ADD (v3, v4);                                                              \
+  v[4] = SUB (v3, v4);                                                              \
+  v[5] = SUB (v2, v5);                                                              \
+  v[6] = SUB (v1, v6);                                                              \
+  v[7] = SUB (v0, v7);                                                              \
+  }
+//}}}
+
+class cJpegKernels {
+public:
+  // src 64 dequantised prescaled coefficients, column pass in place, 8x8 pixels out to dst at stride
+  typedef void (*tIdct) (int32_t* src, uint8_t* dst, int stride);
+
+  // one row of pixels, chroma full or half width, bytesPerPixel 3 bgr or 4 bgra
+  typedef void (*tColour) (const uint8_t* y, const uint8_t* cb, const uint8_t* cr,
+                           uint8_t* dst, int width, int bytesPerPixel);
+
+  //{{{
+  struct sKernels {
+    const char* mName;
+    tIdct mIdct;
+    tColour mColour[2]; // [halfChroma]
+    };
+  //}}}
+
+  //{{{
+  static const sKernels* getKernels (cMpeg2mc::eIsa isa) {
+  // return kernels for isa, nullptr if not built for this target or not on this cpu
+
+    static const sKernels kScalar = { "scalar", idctScalar, { colourScalar<false>, colourScalar<true> } };
+  #if defined(MPEG2MC_SSE2)
+    static const sKernels kSse2 = { "sse2", idctSse2, { colourSse2<false>, colourSse2<true> } };
+    static const sKernels kAvx2 = { "avx2", idctAvx2, { colourAvx2<false>, colourAvx2<true> } };
+  #elif defined(MPEG2MC_NEON)
+    static const sKernels kNeon = { "neon", idctNeon, { colourNeon<false>, colourNeon<true> } };
+  #endif
+
+    switch (isa) {
+      case cMpeg2mc::eScalar: return &kScalar;
+    #if defined(MPEG2MC_SSE2)
+      case cMpeg2mc::eSse2: return &kSse2;
+      case cMpeg2mc::eAvx2: return cMpeg2mc::hasAvx2() ? &kAvx2 : nullptr;
+    #elif defined(MPEG2MC_NEON)
+      case cMpeg2mc::eNeon: return &kNeon;
+    #endif
+      default: return nullptr;
+      }
+    }
+  //}}}
+  //{{{
+  static const sKernels* getBestKernels() {
+
+    static const sKernels* kernels = getKernels (cMpeg2mc::getBestIsa());
+    return kernels;
+    }
+  //}}}
+
+  static uint8_t clip8 (int value) { return (value < 0) ? 0 : (value > 255) ? 255 : (uint8_t)value; }
+
+  // ycbcr to bgr, jfif full range, 10 bit fixed point
+  static const int kBcB = 1814; // 1.772 * 1024
+  static const int kGcB = 352;  // 0.344 * 1024
+  static const int kGcR = 731;  // 0.714 * 1024
+  static const int kRcR = 1435; // 1.402 * 1024
+
+private:
+  //{{{  scalar
+  //{{{
+  static void idctScalar (int32_t* src, uint8_t* dst, int stride) {
+  // reference, one column or row at a time in scalar registers
+
+    for (uint32_t i = 0; i < 8; i++, src++) {
+      //{{{  process columns
+      int32_t v0 = *src;
+      int32_t v5 = *(src+8);
+      int32_t v1 = *(src+16);
+      int32_t v7 = *(src+24);
+      int32_t v2 = *(src+32);
+      int32_t v6 = *(src+40);
+      int32_t v3 = *(src+48);
+      int32_t v4 = *(src+56);
+
+      // process even elements
+      int32_t t10 = v0 + v2;
+      int32_t t12 = v0 - v2;
+      int32_t t11 = (v1 - v3) * JPEG_M13 >> 12;
+
+      v3 += v1;
+      t11 -= v3;
+      v0 = t10 + v3;
+      v3 = t10 - v3;
+      v1 = t11 + t12;
+      v2 = t12 - t11;
+
+      // process odd elements
+      t10 = v5 - v4;
+      t11 = v5 + v4;
+      t12 = v6 - v7;
+      v7 += v6;
+      v5 = (t11 - v7) * JPEG_M13 >> 12;
+      v7 += t11;
+
+      int32_t t13 = (t10 + t12) * JPEG_M5 >> 12;
+      v4 = t13 - (t10 * JPEG_M2 >> 12);
+      v6 = t13 - (t12 * JPEG_M4 >> 12) - v7;
+      v5 -= v6;
+      v4 -= v5;
+
+      // writeback transformed values
+      *src = v0 + v7;
+      *(src+8) = v1 + v6;
+      *(src+16) = v2 + v5;
+      *(src+24) = v3 + v4;
+      *(src+32) = v3 - v4;
+      *(src+40) = v2 - v5;
+      *(src+48) = v1 - v6;
+      *(src+56) = v0 - v7;
+      }
+      //}}}
+
+    src -= 8;
+    for (uint32_t i = 0; i < 8; i++, dst += stride) {
+      //{{{  process rows
+      int32_t v0 = *src++ + (128L << 8);
+      int32_t v5 = *src++;
+      int32_t v1 = *src++;
+      int32_t v7 = *src++;
+      int32_t v2 = *src++;
+      int32_t v6 = *src++;
+      int32_t v3 = *src++;
+      int32_t v4 = *src++;
+
+      // process even elements
+      int32_t t10 = v0 + v2;
+      int32_t t12 = v0 - v2;
+      int32_t t11 = (v1 - v3) * JPEG_M13 >> 12;
+      v3 += v1;
+      t11 -= v3;
+      v0 = t10 + v3;
+      v3 = t10 - v3;
+      v1 = t11 + t12;
+      v2 = t12 - t11;
+
+      // process odd elements
+      t10 = v5 - v4;
+      t11 = v5 + v4;
+      t12 = v6 - v7;
+      v7 += v6;
+      v5 = (t11 - v7) * JPEG_M13 >> 12;
+      v7 += t11;
+
+      int32_t t13 = (t10 + t12) * JPEG_M5 >> 12;
+      v4 = t13 - (t10 * JPEG_M2 >> 12);
+      v6 = t13 - (t12 * JPEG_M4 >> 12) - v7;
+      v5 -= v6;
+      v4 -= v5;
+
+      // descale the transformed values 8 bits and output
+      dst[0] = clip8 ((v0 + v7) >> 8);
+      dst[1] = clip8 ((v1 + v6) >> 8);
+      dst[2] = clip8 ((v2 + v5) >> 8);
+      dst[3] = clip8 ((v3 + v4) >> 8);
+      dst[4] = clip8 ((v3 - v4) >> 8);
+      dst[5] = clip8 ((v2 - v5) >> 8);
+      dst[6] = clip8 ((v1 - v6) >> 8);
+      dst[7] = clip8 ((v0 - v7) >> 8);
+      }
+      //}}}
+    }
+  //}}}
+  //{{{
+  template <bool half> static void colourScalar (const uint8_t* y, const uint8_t* cb, const uint8_t* cr,
+                                                 uint8_t* dst, int width, int bytesPerPixel) {
+    for (int x = 0; x < width; x++) {
+      int32_t u = cb[half ? x >> 1 : x] - 128;
+      int32_t v = cr[half ? x >> 1 : x] - 128;
+      *dst++ = clip8 (y[x] + ((kBcB * u) >> 10));
+      *dst++ = clip8 (y[x] - (((kGcB * u) + (kGcR * v)) >> 10));
+      *dst++ = clip8 (y[x] + ((kRcR * v) >> 10));
+      if (bytesPerPixel == 4)
+        *dst++ = 0xFF;
+      }
+    }
+  //}}}
+  //}}}
+
+#if defined(MPEG2MC_SSE2)
+  //{{{  sse2
+  //{{{
+  static inline __m128i mulSse2 (__m128i a, int32_t k) {
+  // low 32 bits of signed product, SSE2 has no mullo_epi32
+
+    __m128i kk = _mm_set1_epi32 (k);
+    __m128i even = _mm_mul_epu32 (a, kk);
+    __m128i odd = _mm_mul_epu32 (_mm_srli_epi64 (a, 32), kk);
+    return _mm_srai_epi32 (_mm_unpacklo_epi32 (_mm_shuffle_epi32 (even, _MM_SHUFFLE (0,0,2,0)),
+                                               _mm_shuffle_epi32 (odd, _MM_SHUFFLE (0,0,2,0))), 12);
+    }
+  //}}}
+  //{{{
+  static inline void transpose4Sse2 (__m128i& a, __m128i& b, __m128i& c, __m128i& d) {
+
+    __m128i t0 = _mm_unpacklo_epi32 (a, b);
+    __m128i t1 = _mm_unpacklo_epi32 (c, d);
+    __m128i t2 = _mm_unpackhi_epi32 (a, b);
+    __m128i t3 = _mm_unpackhi_epi32 (c, d);
+    a = _mm_unpacklo_epi64 (t0, t1);
+    b = _mm_unpackhi_epi64 (t0, t1);
+    c = _mm_unpacklo_epi64 (t2, t3);
+    d = _mm_unpackhi_epi64 (t2, t3);
+    }
+  //}}}
+  //{{{
+  static inline void transpose8Sse2 (__m128i (&m)[8][2]) {
+  // m[row][half], four 4x4 transposes, off diagonal blocks swapped
+
+    transpose4Sse2 (m[0][0], m[1][0], m[2][0], m[3][0]);
+    transpose4Sse2 (m[4][1], m[5][1], m[6][1], m[7][1]);
+    transpose4Sse2 (m[0][1], m[1][1], m[2][1], m[3][1]);
+    transpose4Sse2 (m[4][0], m[5][0], m[6][0], m[7][0]);
+    for (int i = 0; i < 4; i++) {
+      __m128i t = m[i][1];
+      m[i][1] = m[4+i][0];
+      m[4+i][0] = t;
+      }
+    }
+  //}}}
+
+  //{{{
+  static void idctSse2 (int32_t* src, uint8_t* dst, int stride) {
+  // 4 columns or rows at a time
+
+    __m128i m[8][2];
+    for (int k = 0; k < 8; k++) {
+      m[k][0] = _mm_loadu_si128 ((const __m128i*)(src + k*8));
+      m[k][1] = _mm_loadu_si128 ((const __m128i*)(src + k*8 + 4));
+      }
+
+    for (int h = 0; h < 2; h++) {
+      // columns
+      __m128i v[8];
+      for (int k = 0; k < 8; k++)
+        v[k] = m[k][h];
+      JPEG_AAN (v, _mm_add_epi32, _mm_sub_epi32, mulSse2);
+      for (int k = 0; k < 8; k++)
+        m[k][h] = v[k];
+      }
+
+    transpose8Sse2 (m);
+    for (int h = 0; h < 2; h++) {
+      // rows, lanes are rows after transpose
+      __m128i v[8];
+      for (int k = 0; k < 8; k++)
+        v[k] = m[k][h];
+      v[0] = _mm_add_epi32 (v[0], _mm_set1_epi32 (128 << 8));
+      JPEG_AAN (v, _mm_add_epi32, _mm_sub_epi32, mulSse2);
+      for (int k = 0; k < 8; k++)
+        m[k][h] = _mm_srai_epi32 (v[k], 8);
+      }
+    transpose8Sse2 (m);
+
+    for (int k = 0; k < 8; k++, dst += stride) {
+      __m128i row = _mm_packs_epi32 (m[k][0], m[k][1]);
+      _mm_storel_epi64 ((__m128i*)dst, _mm_packus_epi16 (row, row));
+      }
+    }
+  //}}}
+  //{{{
+  template <bool half> static void colourSse2 (const uint8_t* y, const uint8_t* cb, const uint8_t* cr,
+                                               uint8_t* dst, int width, int bytesPerPixel) {
+  // 8 pixels at a time, madd of cb,cr pairs gives exactly the scalar products
+
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i c128 = _mm_set1_epi16 (128);
+    const __m128i kB = _mm_set1_epi32 (kBcB);
+    const __m128i kG = _mm_set1_epi32 ((kGcR << 16) | kGcB);
+    const __m128i kR = _mm_set1_epi32 (kRcR << 16);
+    const __m128i ff = _mm_set1_epi16 (0xFF);
+
+    int x = 0;
+    alignas(16) uint8_t bgra[32];
+    for (; x + 8 <= width; x += 8) {
+      __m128i u8;
+      __m128i v8;
+      if (half) {
+        int32_t u4, v4;
+        memcpy (&u4, cb + (x >> 1), 4);
+        memcpy (&v4, cr + (x >> 1), 4);
+        u8 = _mm_cvtsi32_si128 (u4);
+        v8 = _mm_cvtsi32_si128 (v4);
+        u8 = _mm_unpacklo_epi8 (u8, u8);
+        v8 = _mm_unpacklo_epi8 (v8, v8);
+        }
+      else {
+        u8 = _mm_loadl_epi64 ((const __m128i*)(cb + x));
+        v8 = _mm_loadl_epi64 ((const __m128i*)(cr + x));
+        }
+      __m128i y16 = _mm_unpacklo_epi8 (_mm_loadl_epi64 ((const __m128i*)(y + x)), zero);
+      __m128i u16 = _mm_sub_epi16 (_mm_unpacklo_epi8 (u8, zero), c128);
+      __m128i v16 = _mm_sub_epi16 (_mm_unpacklo_epi8 (v8, zero), c128);
+
+      __m128i uvLo = _mm_unpacklo_epi16 (u16, v16);
+      __m128i uvHi = _mm_unpackhi_epi16 (u16, v16);
+      __m128i b = _mm_packs_epi32 (_mm_srai_epi32 (_mm_madd_epi16 (uvLo, kB), 10),
+                                   _mm_srai_epi32 (_mm_madd_epi16 (uvHi, kB), 10));
+      __m128i g = _mm_packs_epi32 (_mm_srai_epi32 (_mm_madd_epi16 (uvLo, kG), 10),
+                                   _mm_srai_epi32 (_mm_madd_epi16 (uvHi, kG), 10));
+      __m128i r = _mm_packs_epi32 (_mm_srai_epi32 (_mm_madd_epi16 (uvLo, kR), 10),
+                                   _mm_srai_epi32 (_mm_madd_epi16 (uvHi, kR), 10));
+
+      // saturate, b r and g a byte pairs, interleave
+      __m128i br = _mm_packus_epi16 (_mm_add_epi16 (y16, b), _mm_add_epi16 (y16, r));
+      __m128i ga = _mm_packus_epi16 (_mm_sub_epi16 (y16, g), ff);
+      __m128i bg = _mm_unpacklo_epi8 (br, ga);
+      __m128i ra = _mm_unpackhi_epi8 (br, ga);
+      __m128i lo = _mm_unpacklo_epi16 (bg, ra);
+      __m128i hi = _mm_unpackhi_epi16 (bg, ra);
+
+      if (bytesPerPixel == 4) {
+        _mm_storeu_si128 ((__m128i*)dst, lo);
+        _mm_storeu_si128 ((__m128i*)(dst + 16), hi);
+        dst += 32;
+        }
+      else {
+        _mm_store_si128 ((__m128i*)bgra, lo);
+        _mm_store_si128 ((__m128i*)(bgra + 16), hi);
+        for (int i = 0; i < 8; i++, dst += 3)
+          memcpy (dst, bgra + i*4, 3);
+        }
+      }
+
+    if (x < width)
+      colourScalar<half> (y + x, cb + (half ? x >> 1 : x), cr + (half ? x >> 1 : x), dst, width - x, bytesPerPixel);
+    }
+  //}}}
+  //}}}
+  //{{{  avx2
+  //{{{
+  MPEG2MC_AVX2_TARGET static void idctAvx2 (int32_t* src, uint8_t* dst, int stride) {
+  // 8 columns or rows at a time
+
+    #define AVX2_MUL(a, k) _mm256_srai_epi32 (_mm256_mullo_epi32 (a, _mm256_set1_epi32 (k)), 12)
+    #define AVX2_TRANSPOSE(v) {                                                                    \
+      __m256i t0 = _mm256_unpacklo_epi32 (v[0], v[1]), t1 = _mm256_unpackhi_epi32 (v[0], v[1]);     \
+      __m256i t2 = _mm256_unpacklo_epi32 (v[2], v[3]), t3 = _mm256_unpackhi_epi32 (v[2], v[3]);     \
+      __m256i t4 = _mm256_unpacklo_epi32 (v[4], v[5]), t5 = _mm256_unpackhi_epi32 (v[4], v[5]);     \
+      __m256i t6 = _mm256_unpacklo_epi32 (v[6], v[7]), t7 = _mm256_unpackhi_epi32 (v[6], v[7]);     \
+      __m256i u0 = _mm256_unpacklo_epi64 (t0, t2), u1 = _mm256_unpackhi_epi64 (t0, t2);             \
+      __m256i u2 = _mm256_unpacklo_epi64 (t1, t3), u3 = _mm256_unpackhi_epi64 (t1, t3);             \
+      __m256i u4 = _mm256_unpacklo_epi64 (t4, t6), u5 = _mm256_unpackhi_epi64 (t4, t6);             \
+      __m256i u6 = _mm256_unpacklo_epi64 (t5, t7), u7 = _mm256_unpackhi_epi64 (t5, t7);             \
+      v[0] = _mm256_permute2x128_si256 (u0, u4, 0x20); v[4] = _mm256_permute2x128_si256 (u0, u4, 0x31); \
+      v[1] = _mm256_permute2x128_si256 (u1, u5, 0x20); v[5] = _mm256_permute2x128_si256 (u1, u5, 0x31); \
+      v[2] = _mm256_permute2x128_si256 (u2, u6, 0x20); v[6] = _mm256_permute2x128_si256 (u2, u6, 0x31); \
+      v[3] = _mm256_permute2x128_si256 (u3, u7, 0x20); v[7] = _mm256_permute2x128_si256 (u3, u7, 0x31); \
+      }
+
+    __m256i v[8];
+    for (int k = 0; k < 8; k++)
+      v[k] = _mm256_loadu_si256 ((const __m256i*)(src + k*8));
+
+    JPEG_AAN (v, _mm256_add_epi32, _mm256_sub_epi32, AVX2_MUL);
+    AVX2_TRANSPOSE (v);
+    v[0] = _mm256_add_epi32 (v[0], _mm256_set1_epi32 (128 << 8));
+    JPEG_AAN (v, _mm256_add_epi32, _mm256_sub_epi32, AVX2_MUL);
+    for (int k = 0; k < 8; k++)
+      v[k] = _mm256_srai_epi32 (v[k], 8);
+    AVX2_TRANSPOSE (v);
+
+    for (int k = 0; k < 8; k++, dst += stride) {
+      __m128i row = _mm_packs_epi32 (_mm256_castsi256_si128 (v[k]), _mm256_extracti128_si256 (v[k], 1));
+      _mm_storel_epi64 ((__m128i*)dst, _mm_packus_epi16 (row, row));
+      }
+
+    #undef AVX2_MUL
+    #undef AVX2_TRANSPOSE
+    }
+  //}}}
+  //{{{
+  template <bool half> MPEG2MC_AVX2_TARGET static void colourAvx2 (const uint8_t* y, const uint8_t* cb, const uint8_t* cr,
+                                                                   uint8_t* dst, int width, int bytesPerPixel) {
+  // 16 pixels at a time, in lane unpack and pack keep pixel order within each 128 bit lane
+
+    const __m256i c128 = _mm256_set1_epi16 (128);
+    const __m256i kB = _mm256_set1_epi32 (kBcB);
+    const __m256i kG = _mm256_set1_epi32 ((kGcR << 16) | kGcB);
+    const __m256i kR = _mm256_set1_epi32 (kRcR << 16);
+    const __m256i ff = _mm256_set1_epi16 (0xFF);
+
+    int x = 0;
+    alignas(32) uint8_t bgra[64];
+    for (; x + 16 <= width; x += 16) {
+      __m128i u8;
+      __m128i v8;
+      if (half) {
+        u8 = _mm_loadl_epi64 ((const __m128i*)(cb + (x >> 1)));
+        v8 = _mm_loadl_epi64 ((const __m128i*)(cr + (x >> 1)));
+        u8 = _mm_unpacklo_epi8 (u8, u8);
+        v8 = _mm_unpacklo_epi8 (v8, v8);
+        }
+      else {
+        u8 = _mm_loadu_si128 ((const __m128i*)(cb + x));
+        v8 = _mm_loadu_si128 ((const __m128i*)(cr + x));
+        }
+      __m256i y16 = _mm256_cvtepu8_epi16 (_mm_loadu_si128 ((const __m128i*)(y + x)));
+      __m256i u16 = _mm256_sub_epi16 (_mm256_cvtepu8_epi16 (u8), c128);
+      __m256i v16 = _mm256_sub_epi16 (_mm256_cvtepu8_epi16 (v8), c128);
+
+      __m256i uvLo = _mm256_unpacklo_epi16 (u16, v16);
+      __m256i uvHi = _mm256_unpackhi_epi16 (u16, v16);
+      __m256i b = _mm256_packs_epi32 (_mm256_srai_epi32 (_mm256_madd_epi16 (uvLo, kB), 10),
+                                      _mm256_srai_epi32 (_mm256_madd_epi16 (uvHi, kB), 10));
+      __m256i g = _mm256_packs_epi32 (_mm256_srai_epi32 (_mm256_madd_epi16 (uvLo, kG), 10),
+                                      _mm256_srai_epi32 (_mm256_madd_epi16 (uvHi, kG), 10));
+      __m256i r = _mm256_packs_epi32 (_mm256_srai_epi32 (_mm256_madd_epi16 (uvLo, kR), 10),
+                                      _mm256_srai_epi32 (_mm256_madd_epi16 (uvHi, kR), 10));
+
+      __m256i br = _mm256_packus_epi16 (_mm256_add_epi16 (y16, b), _mm256_add_epi16 (y16, r));
+      __m256i ga = _mm256_packus_epi16 (_mm256_sub_epi16 (y16, g), ff);
+      __m256i bg = _mm256_unpacklo_epi8 (br, ga);
+      __m256i ra = _mm256_unpackhi_epi8 (br, ga);
+      __m256i lo = _mm256_unpacklo_epi16 (bg, ra); // pixels 0..3, 8..11
+      __m256i hi = _mm256_unpackhi_epi16 (bg, ra); // pixels 4..7, 12..15
+      __m256i p0 = _mm256_permute2x128_si256 (lo, hi, 0x20);
+      __m256i p1 = _mm256_permute2x128_si256 (lo, hi, 0x31);
+
+      if (bytesPerPixel == 4) {
+        _mm256_storeu_si256 ((__m256i*)dst, p0);
+        _mm256_storeu_si256 ((__m256i*)(dst + 32), p1);
+        dst += 64;
+        }
+      else {
+        _mm256_store_si256 ((__m256i*)bgra, p0);
+        _mm256_store_si256 ((__m256i*)(bgra + 32), p1);
+        for (int i = 0; i < 16; i++, dst += 3)
+          memcpy (dst, bgra + i*4, 3);
+        }
+      }
+
+    if (x < width)
+      colourSse2<half> (y + x, cb + (half ? x >> 1 : x), cr + (half ? x >> 1 : x), dst, width - x, bytesPerPixel);
+    }
+  //}}}
+  //}}}
+#endif
+
+#if defined(MPEG2MC_NEON)
+  //{{{  neon
+  #define NEON_MUL(a, k) vshrq_n_s32 (vmulq_n_s32 (a, k), 12)
+  //{{{
+  static inline void transpose4Neon (int32x4_t& a, int32x4_t& b, int32x4_t& c, int32x4_t& d) {
+
+    int32x4x2_t ab = vtrnq_s32 (a, b);
+    int32x4x2_t cd = vtrnq_s32 (c, d);
+    a = vcombine_s32 (vget_low_s32 (ab.val[0]), vget_low_s32 (cd.val[0]));
+    b = vcombine_s32 (vget_low_s32 (ab.val[1]), vget_low_s32 (cd.val[1]));
+    c = vcombine_s32 (vget_high_s32 (ab.val[0]), vget_high_s32 (cd.val[0]));
+    d = vcombine_s32 (vget_high_s32 (ab.val[1]), vget_high_s32 (cd.val[1]));
+    }
+  //}}}
+  //{{{
+  static inline void transpose8Neon (int32x4_t (&m)[8][2]) {
+
+    transpose4Neon (m[0][0], m[1][0], m[2][0], m[3][0]);
+    transpose4Neon (m[4][1], m[5][1], m[6][1], m[7][1]);
+    transpose4Neon (m[0][1], m[1][1], m[2][1], m[3][1]);
+    transpose4Neon (m[4][0], m[5][0], m[6][0], m[7][0]);
+    for (int i = 0; i < 4; i++) {
+      int32x4_t t = m[i][1];
+      m[i][1] = m[4+i][0];
+      m[4+i][0] = t;
+      }
+    }
+  //}}}
+
+  //{{{
+  static void idctNeon (int32_t* src, uint8_t* dst, int stride) {
+
+    int32x4_t m[8][2];
+    for (int k = 0; k < 8; k++) {
+      m[k][0] = vld1q_s32 (src + k*8);
+      m[k][1] = vld1q_s32 (src + k*8 + 4);
+      }
+
+    for (int h = 0; h < 2; h++) {
+      int32x4_t v[8];
+      for (int k = 0; k < 8; k++)
+        v[k] = m[k][h];
+      JPEG_AAN (v, vaddq_s32, vsubq_s32, NEON_MUL);
+      for (int k = 0; k < 8; k++)
+        m[k][h] = v[k];
+      }
+
+    transpose8Neon (m);
+    for (int h = 0; h < 2; h++) {
+      int32x4_t v[8];
+      for (int k = 0; k < 8; k++)
+        v[k] = m[k][h];
+      v[0] = vaddq_s32 (v[0], vdupq_n_s32 (128 << 8));
+      JPEG_AAN (v, vaddq_s32, vsubq_s32, NEON_MUL);
+      for (int k = 0; k < 8; k++)
+        m[k][h] = vshrq_n_s32 (v[k], 8);
+      }
+    transpose8Neon (m);
+
+    for (int k = 0; k < 8; k++, dst += stride)
+      vst1_u8 (dst, vqmovun_s16 (vcombine_s16 (vqmovn_s32 (m[k][0]), vqmovn_s32 (m[k][1]))));
+    }
+  //}}}
+  //{{{
+  template <bool half> static void colourNeon (const uint8_t* y, const uint8_t* cb, const uint8_t* cr,
+                                               uint8_t* dst, int width, int bytesPerPixel) {
+  // 8 pixels at a time, widening multiplies give exactly the scalar products
+
+    const int16x8_t c128 = vdupq_n_s16 (128);
+
+    int x = 0;
+    for (; x + 8 <= width; x += 8) {
+      uint8x8_t u8;
+      uint8x8_t v8;
+      if (half) {
+        // chroma rows padded, 8 byte load for 4 values
+        u8 = vld1_u8 (cb + (x >> 1));
+        v8 = vld1_u8 (cr + (x >> 1));
+        u8 = vzip_u8 (u8, u8).val[0];
+        v8 = vzip_u8 (v8, v8).val[0];
+        }
+      else {
+        u8 = vld1_u8 (cb + x);
+        v8 = vld1_u8 (cr + x);
+        }
+      int16x8_t y16 = vreinterpretq_s16_u16 (vmovl_u8 (vld1_u8 (y + x)));
+      int16x8_t u16 = vsubq_s16 (vreinterpretq_s16_u16 (vmovl_u8 (u8)), c128);
+      int16x8_t v16 = vsubq_s16 (vreinterpretq_s16_u16 (vmovl_u8 (v8)), c128);
+
+      int16x8_t b = vcombine_s16 (vmovn_s32 (vshrq_n_s32 (vmull_n_s16 (vget_low_s16 (u16), kBcB), 10)),
+                                  vmovn_s32 (vshrq_n_s32 (vmull_n_s16 (vget_high_s16 (u16), kBcB), 10)));
+      int16x8_t g = vcombine_s16 (
+        vmovn_s32 (vshrq_n_s32 (vmlal_n_s16 (vmull_n_s16 (vget_low_s16 (u16), kGcB), vget_low_s16 (v16), kGcR), 10)),
+        vmovn_s32 (vshrq_n_s32 (vmlal_n_s16 (vmull_n_s16 (vget_high_s16 (u16), kGcB), vget_high_s16 (v16), kGcR), 10)));
+      int16x8_t r = vcombine_s16 (vmovn_s32 (vshrq_n_s32 (vmull_n_s16 (vget_low_s16 (v16), kRcR), 10)),
+                                  vmovn_s32 (vshrq_n_s32 (vmull_n_s16 (vget_high_s16 (v16), kRcR), 10)));
+
+      if (bytesPerPixel == 4) {
+        uint8x8x4_t bgra;
+        bgra.val[0] = vqmovun_s16 (vaddq_s16 (y16, b));
+        bgra.val[1] = vqmovun_s16 (vsubq_s16 (y16, g));
+        bgra.val[2] = vqmovun_s16 (vaddq_s16 (y16, r));
+        bgra.val[3] = vdup_n_u8 (0xFF);
+        vst4_u8 (dst, bgra);
+        dst += 32;
+        }
+      else {
+        uint8x8x3_t bgr;
+        bgr.val[0] = vqmovun_s16 (vaddq_s16 (y16, b));
+        bgr.val[1] = vqmovun_s16 (vsubq_s16 (y16, g));
+        bgr.val[2] = vqmovun_s16 (vaddq_s16 (y16, r));
+        vst3_u8 (dst, bgr);
+        dst += 24;
+        }
+      }
+
+    if (x < width)
+      colourScalar<half> (y + x, cb + (half ? x >> 1 : x), cr + (half ? x >> 1 : x), dst, width - x, bytesPerPixel);
+    }
+  //}}}
+  #undef NEON_MUL
+  //}}}
+#endif
+  };
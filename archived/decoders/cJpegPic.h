@@ -1,64 +1,21 @@
 // cJpeg.h - portable jpeg decoder - based on tiny jpeg decoder, jhead
+// - 64 bit bit buffer, 9 bit lookahead huffman tables, idct and colour rows from cJpegKernels
+// - DRI restart intervals prescanned and decoded on setThreads threads into disjoint frame pixels
+// - setCrop decodes only the MCUs of a rectangle, decodeToSize picks exif thumb, 1/8, 1/4, 1/2 or full
 #pragma once
 #include "iPic.h"
+#include <algorithm>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include "cJpegKernels.h"
 //{{{  static const
 static const int kBodyBufferSize = 0x200;
 static const int kPoolBufferSize = 0xB00;
 static const int kInputBufferSize = 0x10000;
 
-static const int kBcB = (int)(1.772 * 1024);
-static const int kGcB = (int)(0.344 * 1024);
-static const int kGcR = (int)(0.714 * 1024);
-static const int kRcR = (int)(1.402 * 1024);
-
-static const int32_t M2  = (int32_t)(1.08239 * 4096);
-static const int32_t M4  = (int32_t)(2.61313 * 4096);
-static const int32_t M5  = (int32_t)(1.84776 * 4096);
-static const int32_t M13 = (int32_t)(1.41421 * 4096);
-
-//{{{
-static const uint8_t  kClip8[1024] = {
-  // 0..255
-  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
-  32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
-  64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
-  96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
-  128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
-  160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
-  192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
-  224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255,
-
-  // 256..511
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-
-  // -512..-257
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-
-  // -256..-1
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
-};
-//}}}
+static const int kHuffFastBits = 9;
+static const uint8_t kThumbScale = 0xFF;  // getFrameScale when decodeToSize used the exif thumb
 //{{{
 static const uint8_t  kZigZag[64] = {
    0,  1,  8, 16,  9,  2,  3, 10, 17, 24, 32, 25, 18, 11,  4,  5,
@@ -304,13 +261,12 @@ public:
 class cJpegPic : public iPic {
 public:
   //{{{
-  cJpegPic (uint16_t components, uint8_t* buffer) : mBuffer(buffer), mBufferPtr(buffer), mBytesPerPixel(components)  {
+  cJpegPic (uint16_t components, uint8_t* buffer, size_t bufferSize = 0)
+    : mBuffer(buffer), mBufferPtr(buffer), mBufferSize(bufferSize), mBytesPerPixel(components)  {
+  // bufferSize, when buffer holds the whole file, lets setThreads prescan restart markers
 
-    memset (mQtable, 0, 4 * sizeof(int32_t));
-
-    memset (mHuffBits, 0, 2 * 2);
-    memset (mHuffData, 0, 2 * 2);
-    memset (mHuffCode, 0, 2 * 2 * sizeof(uint16_t));
+    memset (mQtable, 0, sizeof(mQtable));
+    memset (mHuffLoaded, 0, sizeof(mHuffLoaded));
 
     mPoolBuffer = (uint8_t*)malloc (kPoolBufferSize);
     mInputBuffer = (uint8_t*)malloc (kInputBufferSize);
@@ -330,13 +286,52 @@ public:
   virtual uint16_t getHeight() { return mHeight; }
   virtual uint16_t getComponents() { return mBytesPerPixel; }
   virtual uint8_t* getPic() { return mFrameBuffer; }
-  virtual void setPic (const uint8_t* buffer, int size, uint16_t components) {};
+  virtual void setPic (const uint8_t*, int, uint16_t) {};
 
   //{{{  gets
   uint32_t getPoolBytesLeft() { return mPoolBytesLeft; }
 
   int getThumbOffset() { return mThumbBytes > 0 ? mThumbOffset : 0; }
   int getThumbBytes() { return mThumbBytes; }
+
+  const char* getIsaName() { return mKernels->mName; }
+
+  // frame of the last decode, origin in the scaled image
+  uint32_t getFrameX() { return mFrameX; }
+  uint32_t getFrameY() { return mFrameY; }
+  uint32_t getFrameWidth() { return mFrameWidth; }
+  uint32_t getFrameHeight() { return mFrameHeight; }
+  uint8_t getFrameScale() { return mFrameScale; }
+  //}}}
+  //{{{
+  bool setIsa (cMpeg2mc::eIsa isa) {
+  // select idct and colour kernels, false leaves them unchanged if isa not available on this cpu
+
+    auto kernels = cJpegKernels::getKernels (isa);
+    if (!kernels)
+      return false;
+
+    mKernels = kernels;
+    return true;
+    }
+  //}}}
+  //{{{
+  void setThreads (int threads) {
+  // decode DRI restart intervals on threads including caller, needs the bufferSize constructor
+  // - no DRI, no bufferSize or restart markers not as expected decode serially
+
+    mThreads = std::max (1, threads);
+    }
+  //}}}
+  //{{{
+  void setCrop (uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+  // decode only this rectangle of image pixels, widened to whole MCUs, width 0 for whole image
+
+    mCropX = x;
+    mCropY = y;
+    mCropWidth = width;
+    mCropHeight = height;
+    }
   //}}}
   //{{{
   bool readHeader() {
@@ -382,10 +377,11 @@ public:
             return false;
 
           // Pre-load the JPEG data to extract it from the bit stream
+          mScanOffset = offset;
           offset %= kBodyBufferSize;
-          mDataCounter = offset ? read (mInputBuffer + length, kBodyBufferSize - offset) : 0;
-          mDataPtr = offset ? mInputBuffer + length - 1 : mInputBuffer;
-          mDataMask = 0;
+          mState.mRefill = true;
+          mState.mDataCounter = offset ? read (mInputBuffer + length, kBodyBufferSize - offset) : 0;
+          mState.mDataPtr = offset ? mInputBuffer + length - 1 : mInputBuffer;
           return true;
           //}}}
         case 0xC1: // SOF1
@@ -412,50 +408,70 @@ public:
 
   //{{{
   uint8_t* decodeBody (uint8_t scaleShift) {
+  // decode MCUs a row at a time into y, cb, cr planes, colour convert each row into mFrameBuffer
+  // - only the MCUs covering setCrop, frame is getFrameWidth x getFrameHeight at getFrameX, getFrameY
+  // - restart intervals decode in parallel when setThreads > 1, DRI is set and the buffer size is known
+  // - a crop with DRI and buffer size skips intervals outside it, otherwise huffman decodes up to it
+
+    if ((scaleShift > 3) || !mWidth || !mHeight)
+      return nullptr;
 
     mScaleShift = scaleShift;
-    mFrameWidth = mWidth >> scaleShift;
-    mFrameHeight = mHeight >> scaleShift;
-    mFrameBuffer = (uint8_t*)malloc (mFrameWidth * mFrameHeight * mBytesPerPixel);
+    mMcusPerRow = (mWidth + (msx * 8) - 1) / (msx * 8);
+    uint32_t mcuRows = (mHeight + (msy * 8) - 1) / (msy * 8);
+    mNumMcus = mMcusPerRow * mcuRows;
+
+    bool crop = mCropWidth && mCropHeight;
+    if (crop) {
+      //{{{  crop to whole MCUs
+      if ((mCropX >= mWidth) || (mCropY >= mHeight))
+        return nullptr;
+
+      mMcuX0 = mCropX / (msx * 8);
+      mMcuY0 = mCropY / (msy * 8);
+      mMcuX1 = std::min ((std::min (mCropX + mCropWidth, mWidth) + (msx * 8) - 1) / (msx * 8), mMcusPerRow);
+      mMcuY1 = std::min ((std::min (mCropY + mCropHeight, mHeight) + (msy * 8) - 1) / (msy * 8), mcuRows);
+      }
+      //}}}
+    else {
+      mMcuX0 = 0;
+      mMcuY0 = 0;
+      mMcuX1 = mMcusPerRow;
+      mMcuY1 = mcuRows;
+      }
 
-    // Initialize DC values
-    mDcValue[0] = 0;
-    mDcValue[1] = 0;
-    mDcValue[2] = 0;
+    mFrameScale = scaleShift;
+    mFrameX = (mMcuX0 * msx * 8) >> scaleShift;
+    mFrameY = (mMcuY0 * msy * 8) >> scaleShift;
+    mFrameWidth = (std::min (mMcuX1 * msx * 8, mWidth) >> scaleShift) - mFrameX;
+    mFrameHeight = (std::min (mMcuY1 * msy * 8, mHeight) >> scaleShift) - mFrameY;
+    mFrameBuffer = (uint8_t*)malloc (mFrameWidth * mFrameHeight * mBytesPerPixel);
 
-    uint16_t restartCount = 0;
-    uint16_t restartInterval = 0;
+    bool intervals = mNumRst && mBufferSize && ((mThreads > 1) || crop) && scanRestarts();
+    if (!(intervals ? decodeIntervals() : decodeSerial())) {
+      free (mFrameBuffer);
+      mFrameBuffer = nullptr;
+      }
 
-    // iterate MCUs
-    for (uint32_t y = 0; y < mHeight; y += msy*8) {
-      for (uint32_t x = 0; x < mWidth; x += msx*8) {
-        if (mNumRst && restartInterval++ == mNumRst) {
-          // process restart interval if DRI header found
-          if (!restart (restartCount++))  {
-            free (mFrameBuffer);
-            return nullptr;
-            }
-          restartInterval = 1;
-          }
+    return mFrameBuffer;
+    }
+  //}}}
+  //{{{
+  uint8_t* decodeToSize (uint32_t width, uint32_t height) {
+  // decode from the cheapest source at least width x height, exif thumb, 1/8 dc only, 1/4, 1/2, full
+  // - crop applies to the image sources, thumb only used uncropped and when it covers the whole size
+  // - getFrameScale says which, frame returned as decodeBody
 
-        // load MCU, decompress huffman coded stream and apply IDCT
-        if (!mcuLoad()) {
-          free (mFrameBuffer);
-          return nullptr;
-          }
+    uint32_t sourceWidth = (mCropWidth && mCropHeight) ? mCropWidth : mWidth;
+    uint32_t sourceHeight = (mCropWidth && mCropHeight) ? mCropHeight : mHeight;
 
-        // process MCU, color space conversion, scaling and output
-        if (!mcuProcess (x, y)) {
-          free (mFrameBuffer);
-          return nullptr;
-          }
-        }
-      }
+    if (!(mCropWidth && mCropHeight) && decodeThumb (width, height))
+      return mFrameBuffer;
 
-    //printf ("bytes left %d\n", mPoolBytesLeft);
-    return mFrameBuffer;
+    return decodeBody (getScaleShift (sourceWidth, sourceHeight, width, height));
     }
   //}}}
+
   // vars
   cExifInfo mExifInfo;
   cExifGpsInfo mExifGpsInfo;
@@ -463,6 +479,11 @@ public:
 protected:
   //{{{
   virtual uint32_t read (uint8_t* buffer, uint32_t bytes) {
+  // clamped to the end of buffer when bufferSize known, entropy refill asks past it
+
+    if (mBufferSize)
+      bytes = (uint32_t)std::min ((size_t)bytes, mBufferSize - std::min (mBufferSize, (size_t)(mBufferPtr - mBuffer)));
+
     memcpy (buffer, mBufferPtr, bytes);
     mBufferPtr += bytes;
     return bytes;
@@ -470,8 +491,44 @@ protected:
   //}}}
   uint8_t* mBuffer = nullptr;
   uint8_t* mBufferPtr = nullptr;
+  size_t mBufferSize = 0;
 
 private:
+  //{{{
+  struct sHuff {
+    uint16_t mFast[1 << kHuffFastBits]; // peeked bits to length << 8 | value, 0 if code longer
+    int32_t mMaxCode[18];               // per length, first code too long, left aligned to 16 bits
+    int32_t mDelta[17];                 // per length, value index minus code
+    uint8_t mValues[256];
+    };
+  //}}}
+  //{{{
+  struct sState {
+  // entropy decode state and MCU row planes, serial mState streams by read, parallel one per thread
+    uint8_t* mDataPtr = nullptr;  // Current data read ptr
+    uint32_t mDataCounter = 0;    // Number of bytes available after mDataPtr
+    bool mRefill = false;         // refill mInputBuffer by read when empty
+
+    uint64_t mBits = 0;           // bit buffer, next bit in the MSB
+    int mBitCount = 0;            // valid bits in mBits
+    int mMarker = 0;              // marker found by lookahead, zero bits fed past it
+    int16_t mDcValue[3] = { 0 };  // Previous DC element of each component
+    int32_t mCoefs[64];           // dequantised block, idct works in place
+
+    // one MCU row of planes, bgr lines for 1/2, 1/4 averaging
+    uint8_t* mRowY = nullptr;
+    uint8_t* mRowCb = nullptr;
+    uint8_t* mRowCr = nullptr;
+    uint8_t* mRowBgr = nullptr;
+    };
+  //}}}
+  //{{{
+  struct sInterval {
+    uint8_t* mStart;  // first byte after SOS or RSTn
+    uint8_t* mEnd;    // next RSTn
+    };
+  //}}}
+
   //{{{
   uint8_t* alloc (uint32_t bytes) {
 
@@ -724,7 +781,7 @@ private:
   //}}}
 
   //{{{
-  bool parseAPP (uint8_t* ptr, uint32_t length) {
+  bool parseAPP (uint8_t* ptr, uint32_t) {
   // find and read APP1 EXIF marker, return true if thumb, valid mThumbBuffer, mThumbLength
 
     // check exifId
@@ -794,6 +851,8 @@ private:
   //{{{
   bool parseHFT (uint8_t* ptr, uint32_t length) {
   // Create huffman code tables with a DHT segment
+  // - codes up to kHuffFastBits long decode with one lookup of the peeked bits
+  // - longer codes compare the peeked 16 bits against each length's left aligned code limit
 
     while (length) {
       if (length < 17)
@@ -809,43 +868,47 @@ private:
       if (d & 0xEE)
         return false;
 
-      auto bitDistributionTablePtr = (uint8_t*)alloc (16);
-      mHuffBits[num][cls] = bitDistributionTablePtr;
-
+      // number of codes of each length 1..16
+      uint8_t counts[17];
       uint32_t np = 0;
-      for (uint32_t i = 0; i < 16; i++) {
-        // load number of patterns for 1 to 16-bit code
-        uint32_t b = *ptr++;
-        bitDistributionTablePtr[i] = b;
-        // get sum of code words for each code
-        np += b;
-        }
-
-      auto codeWordTablePtr = (uint16_t*)alloc (np * sizeof (uint16_t));
-      mHuffCode[num][cls] = codeWordTablePtr;
-
-      uint16_t hc = 0;
-      uint32_t j = 0;
-      for (uint32_t i = 0; i < 16; i++, hc <<= 1) {
-        // rebuild huffman code word table
-        uint32_t b = bitDistributionTablePtr[i];
-        while (b--)
-          codeWordTablePtr[j++] = hc++;
+      for (uint32_t i = 1; i <= 16; i++) {
+        counts[i] = *ptr++;
+        np += counts[i];
         }
-
-      if (length < np)
+      if ((length < np) || (np > 256))
         return false;  // Err: wrong ptr size
       length -= np;
 
-      auto decodedDataPtr = (uint8_t*)alloc (np);
-      mHuffData[num][cls] = decodedDataPtr;
+      sHuff& huff = mHuff[num][cls];
+      memset (huff.mFast, 0, sizeof(huff.mFast));
       for (uint32_t i = 0; i < np; i++) {
-        // Load decoded data corresponds to each code ward
+        // Load decoded data corresponds to each code word
         uint8_t d = *ptr++;
         if (!cls && d > 11)
           return false;
-        *decodedDataPtr++ = d;
+        huff.mValues[i] = d;
+        }
+
+      // canonical codes, consecutive within a length, doubled moving to the next length
+      uint32_t code = 0;
+      uint32_t index = 0;
+      for (uint32_t bits = 1; bits <= 16; bits++) {
+        huff.mDelta[bits] = (int32_t)index - (int32_t)code;
+        for (uint32_t i = 0; i < counts[bits]; i++, code++, index++) {
+          if (code >= (1u << bits))
+            return false;  // Err: oversubscribed code lengths
+          if (bits <= kHuffFastBits) {
+            uint32_t shift = kHuffFastBits - bits;
+            for (uint32_t fill = 0; fill < (1u << shift); fill++)
+              huff.mFast[(code << shift) | fill] = (uint16_t)((bits << 8) | huff.mValues[index]);
+            }
+          }
+        huff.mMaxCode[bits] = code << (16 - bits);
+        code <<= 1;
         }
+      huff.mMaxCode[17] = 0x7FFFFFFF;
+
+      mHuffLoaded[num][cls] = true;
       }
 
     return true;
@@ -858,7 +921,7 @@ private:
     }
   //}}}
   //{{{
-  bool parseSOF (uint8_t* ptr, uint32_t length) {
+  bool parseSOF (uint8_t* ptr, uint32_t) {
 
     mHeight = ptr[1]<<8 | ptr[2];
     mWidth =  ptr[3]<<8 | ptr[4];
@@ -895,7 +958,7 @@ private:
     }
   //}}}
   //{{{
-  bool parseSOS (uint8_t* ptr, uint32_t length) {
+  bool parseSOS (uint8_t* ptr, uint32_t) {
 
     if (!mWidth || !mHeight)
       return false;
@@ -912,23 +975,15 @@ private:
 
       b = i ? 1 : 0;
       // Check huffman table for this component
-      if (!mHuffBits[b][0] || !mHuffBits[b][1])
+      if (!mHuffLoaded[b][0] || !mHuffLoaded[b][1])
         return false;
       if (!mQtable [mQtableId [i]])
         return false;
       }
 
-    // Allocate working buffer for MCU and RGB
-    uint32_t numYblocks = msy * msx; // Number of Y blocks in the MCU
-    if (!numYblocks) // SOF0 not loaded
+    // SOF0 not loaded
+    if (!msx || !msy)
       return false;
-    mMcuBuffer = (uint8_t*)alloc ((numYblocks + 2) * 64);
-
-    // allocate buffer for IDCT, RGB, at least 256 bytes for IDCT
-    auto idctRgbBufferSize = numYblocks * 64 * 2 + 64;
-    if (idctRgbBufferSize < 256)
-      idctRgbBufferSize = 256;
-    mIdctRgbBuffer = (uint8_t*)alloc (idctRgbBufferSize);
 
     // Initialization succeeded. Ready to decompress the JPEG image
     return true;
@@ -936,578 +991,589 @@ private:
   //}}}
 
   //{{{
-  int bitEtract (uint32_t nBits) {
-  // Extract N bits from input stream
-
-    auto msk = mDataMask;
-    uint32_t dc = mDataCounter;
-    auto dp = mDataPtr; // Bit mask, number of data available, read ptr
-    auto s = *dp;
-    uint32_t v = 0;
-    uint32_t f = 0;
-    do {
-      if (!msk) {
-        if (!dc) {
-          // No input data is available, re-fill input buffer
-          dp = mInputBuffer; // Top of input buffer
-          dc = read (dp, kBodyBufferSize);
-          if (!dc)
-            return false;
-          }
-        else
-          dp++;     // Next data ptr
-
-        dc--;       // Decrement number of available bytes
-        if (f) {
-          // In flag sequence?
-          f = 0;      // Exit flag sequence
-          if (*dp != 0)
-            return false; // Err: unexpected flag is detected (may be collapted data)
-          *dp = s = 0xFF;     // The flag is a data 0xFF
-          }
-        else {
-          s = *dp;        // Get next data byte
-          if (s == 0xFF) {
-            // start of flag sequence?
-            f = 1;
-            continue;  // Enter flag sequence
-            }
-          }
-        msk = 0x80;   // Read from MSB
-        }
+  inline int getByte (sState& s) {
+  // next entropy coded byte, serial refills mInputBuffer by read, -1 if no more input
+
+    if (!s.mDataCounter) {
+      if (!s.mRefill)
+        return -1;
+
+      // No input data is available, re-fill input buffer
+      s.mDataPtr = mInputBuffer;
+      s.mDataCounter = read (s.mDataPtr, kBodyBufferSize);
+      if (!s.mDataCounter)
+        return -1;
+      }
+    else
+      s.mDataPtr++;
 
-      v <<= 1;  // Get a bit
-      if (s & msk)
-        v++;
-      msk >>= 1;
-      nBits--;
-      } while (nBits);
-
-    mDataMask = msk;
-    mDataCounter = dc;
-    mDataPtr = dp;
-    return (int)v;
+    s.mDataCounter--;
+    return *s.mDataPtr;
     }
   //}}}
   //{{{
-  int huffExtract (const uint8_t* hbits, const uint16_t* hcode, const uint8_t* hdata) {
-  // Extract a huffman decoded data from input stream
-
-    auto msk = mDataMask;
-    uint32_t dc = mDataCounter;
-    auto dp = mDataPtr; // Bit mask, number of data available, read ptr
-    auto s = *dp;
-    uint32_t v = 0;
-    uint32_t f = 0;
-    uint32_t bl = 16;  // Max code lengthgth
-    do {
-      if (!msk) {
-        if (!dc) {
-          // No input data is available, re-fill input buffer
-          dp = mInputBuffer; // Top of input buffer
-          dc = read (dp, kBodyBufferSize);
-          if (!dc)
-            return false; // read error or wrong stream termination
-          }
-        else
-          dp++; // Next data ptr
-
-        dc--;   // Decrement number of available bytes
-        if (f) {
-          // In flag sequence?
-          f = 0;    // Exit flag sequence
-          if (*dp != 0)
-            return false; // unexpected flag is detected (may be collapted data)
-          *dp = s = 0xFF; // The flag is a data 0xFF
-          }
-        else {
-          s = *dp; // Get next data byte
-          if (s == 0xFF) {
-            // start of flag sequence
-            f = 1;
-            continue;  // Enter flag sequence, get trailing byte
+  void fillBits (sState& s) {
+  // top up mBits to more than 56 bits, unstuff 0xFF00, stop at a marker and feed zeros past it
+
+    while (s.mBitCount <= 56) {
+      int byte = 0;
+      if (!s.mMarker) {
+        byte = getByte (s);
+        if (byte == 0xFF) {
+          int next;
+          do {
+            next = getByte (s);
+            } while (next == 0xFF);
+          if (next) {
+            // marker, usually RSTn or EOI, left for restart
+            s.mMarker = (next < 0) ? 0xD9 : next;
+            byte = 0;
             }
           }
-        msk = 0x80;
-        }
-
-      // Get a bit
-      v <<= 1;
-      if (s & msk)
-        v++;
-      msk >>= 1;
-
-      for (uint32_t nd = *hbits++; nd; nd--) {
-        // Search the code word in this bit lengthgth
-        if (v == *hcode++) {
-          // Matched
-          mDataMask = msk;
-          mDataCounter = dc;
-          mDataPtr = dp;
-          return *hdata;
+        else if (byte < 0) {
+          s.mMarker = 0xD9;
+          byte = 0;
           }
-        hdata++;
         }
-      bl--;
-      } while (bl);
 
-    return true;
+      s.mBits |= (uint64_t)byte << (56 - s.mBitCount);
+      s.mBitCount += 8;
+      }
     }
   //}}}
   //{{{
-  void idct (int32_t* src, uint8_t* dst) {
-  // Apply Inverse-DCT in Arai Algorithm (see also aa_idct.png)
-
-    for (uint32_t i = 0; i < 8; i++, src++) {
-      //{{{  process columns
-      int32_t v0 = *src;
-      int32_t v5 = *(src+8);
-      int32_t v1 = *(src+16);
-      int32_t v7 = *(src+24);
-      int32_t v2 = *(src+32);
-      int32_t v6 = *(src+40);
-      int32_t v3 = *(src+48);
-      int32_t v4 = *(src+56);
-
-      // process even elements
-      int32_t t10 = v0 + v2;
-      int32_t t12 = v0 - v2;
-      int32_t t11 = (v1 - v3) * M13 >> 12;
-
-      v3 += v1;
-      t11 -= v3;
-      v0 = t10 + v3;
-      v3 = t10 - v3;
-      v1 = t11 + t12;
-      v2 = t12 - t11;
-
-      // process odd elements
-      t10 = v5 - v4;
-      t11 = v5 + v4;
-      t12 = v6 - v7;
-      v7 += v6;
-      v5 = (t11 - v7) * M13 >> 12;
-      v7 += t11;
-
-      int32_t t13 = (t10 + t12) * M5 >> 12;
-      v4 = t13 - (t10 * M2 >> 12);
-      v6 = t13 - (t12 * M4 >> 12) - v7;
-      v5 -= v6;
-      v4 -= v5;
-
-      // writeback transformed values
-      *src = v0 + v7;
-      *(src+8) = v1 + v6;
-      *(src+16) = v2 + v5;
-      *(src+24) = v3 + v4;
-      *(src+32) = v3 - v4;
-      *(src+40) = v2 - v5;
-      *(src+48) = v1 - v6;
-      *(src+56) = v0 - v7;
-      }
-      //}}}
-
-    src -= 8;
-    for (uint32_t i = 0; i < 8; i++) {
-      //{{{  process rows
-      int32_t v0 = *src++ + (128L << 8);
-      int32_t v5 = *src++;
-      int32_t v1 = *src++;
-      int32_t v7 = *src++;
-      int32_t v2 = *src++;
-      int32_t v6 = *src++;
-      int32_t v3 = *src++;
-      int32_t v4 = *src++;
-
-      // process even elements
-      int32_t t10 = v0 + v2;
-      int32_t t12 = v0 - v2;
-      int32_t t11 = (v1 - v3) * M13 >> 12;
-      v3 += v1;
-      t11 -= v3;
-      v0 = t10 + v3;
-      v3 = t10 - v3;
-      v1 = t11 + t12;
-      v2 = t12 - t11;
-
-      // process odd elements
-      t10 = v5 - v4;
-      t11 = v5 + v4;
-      t12 = v6 - v7;
-      v7 += v6;
-      v5 = (t11 - v7) * M13 >> 12;
-      v7 += t11;
-
-      int32_t t13 = (t10 + t12) * M5 >> 12;
-      v4 = t13 - (t10 * M2 >> 12);
-      v6 = t13 - (t12 * M4 >> 12) - v7;
-      v5 -= v6;
-      v4 -= v5;
-
-      // descale the transformed values 8 bits and output
-      *dst++ = kClip8 [(v0 + v7) >> 8];
-      *dst++ = kClip8 [(v1 + v6) >> 8];
-      *dst++ = kClip8 [(v2 + v5) >> 8];
-      *dst++ = kClip8 [(v3 + v4) >> 8];
-      *dst++ = kClip8 [(v3 - v4) >> 8];
-      *dst++ = kClip8 [(v2 - v5) >> 8];
-      *dst++ = kClip8 [(v1 - v6) >> 8];
-      *dst++ = kClip8 [(v0 - v7) >> 8];
-      }
-      //}}}
+  inline int32_t getBits (sState& s, uint32_t nBits) {
+  // Extract N bits from input stream, 0..16
+
+    if (!nBits)
+      return 0;
+    if (s.mBitCount < (int)nBits)
+      fillBits (s);
+
+    auto value = (int32_t)(s.mBits >> (64 - nBits));
+    s.mBits <<= nBits;
+    s.mBitCount -= nBits;
+    return value;
     }
   //}}}
+  //{{{
+  static inline int32_t extend (int32_t value, uint32_t nBits) {
+  // Restore sign, values below the MSB position are negative
 
+    return (value < (1 << (nBits - 1))) ? value - (1 << nBits) + 1 : value;
+    }
+  //}}}
   //{{{
-  bool restart (uint16_t rstn) {
-  // Process restart interval
-
-    // Discard padding bits and get two bytes from the input stream
-    auto dp = mDataPtr;
-    uint32_t dc = mDataCounter;
-    uint16_t d = 0;
-
-    for (uint32_t i = 0; i < 2; i++) {
-      if (!dc) {
-        // No input data is available, re-fill input buffer
-        dp = mInputBuffer;
-        dc = read (dp, kBodyBufferSize);
-        if (!dc)
-          return false;
-        }
-      else
-        dp++;
-      dc--;
-      // Get a byte
-      d = (d << 8) | *dp;
+  inline int huffDecode (sState& s, const sHuff& huff) {
+  // Extract a huffman decoded data from input stream, -1 if invalid code
+
+    if (s.mBitCount < 16)
+      fillBits (s);
+
+    uint32_t fast = huff.mFast[s.mBits >> (64 - kHuffFastBits)];
+    if (fast) {
+      uint32_t bits = fast >> 8;
+      s.mBits <<= bits;
+      s.mBitCount -= bits;
+      return fast & 0xFF;
       }
 
-    mDataPtr = dp;
-    mDataCounter = dc;
-    mDataMask = 0;
+    // longer code, find its length from the left aligned code limits
+    auto peek = (int32_t)(s.mBits >> 48);
+    uint32_t bits = kHuffFastBits + 1;
+    while (peek >= huff.mMaxCode[bits])
+      bits++;
+    if (bits > 16)
+      return -1;
+
+    s.mBits <<= bits;
+    s.mBitCount -= bits;
+    return huff.mValues[(peek >> (16 - bits)) + huff.mDelta[bits]];
+    }
+  //}}}
 
-    // Check the marker
-    if ((d & 0xFFD8) != 0xFFD0 || (d & 7) != (rstn & 7)) // expected RSTn marker is not detected
-      return false;
+  //{{{
+  void resetState (sState& s) {
+  // empty bit buffer, DC predictions back to 0, at scan start and each restart
+
+    s.mBits = 0;
+    s.mBitCount = 0;
+    s.mMarker = 0;
+    s.mDcValue[0] = 0;
+    s.mDcValue[1] = 0;
+    s.mDcValue[2] = 0;
+    }
+  //}}}
+  //{{{
+  bool restart (sState& s, uint16_t rstn) {
+  // Process restart interval, discard padding bits, expect RSTn, reset bit buffer and DC
 
-    // Reset DC offset
-    mDcValue[0] = 0;
-    mDcValue[1] = 0;
-    mDcValue[2] = 0;
+    if (!s.mMarker) {
+      // lookahead stopped short of the marker, it must be the next byte
+      if (getByte (s) != 0xFF)
+        return false;
+      int byte;
+      do {
+        byte = getByte (s);
+        } while (byte == 0xFF);
+      if (byte <= 0)
+        return false;
+      s.mMarker = byte;
+      }
 
-    return true;
+    // Check the marker
+    bool found = ((s.mMarker & 0xF8) == 0xD0) && ((s.mMarker & 7) == (rstn & 7));
+    resetState (s);
+    return found;
     }
   //}}}
   //{{{
-  bool mcuLoad() {
-
+  bool mcuLoad (sState& s, uint32_t mcuX, bool skip) {
+  // huffman decode, dequantise and idct one MCU into the row planes at mcuX
+  // - 1/8 huffman decodes the AC only to skip it, writes the DC pixel of each block
+  // - skip, outside the crop, huffman decodes only to keep the DC prediction and bit position
+
+    bool dcOnly = (mScaleShift == 3) || skip;
+    uint32_t planeX = mcuX - mMcuX0;
+    uint32_t blockSize = dcOnly ? 1 : 8;
     uint32_t nby = msx * msy;  // Number of Y blocks (1, 2 or 4)
     uint32_t nbc = 2;          // Number of C blocks (2)
-    auto mcuBuf = mMcuBuffer;  // Pointer to the first block
-    auto idctBuf = (int32_t*)mIdctRgbBuffer;
 
-    for (uint32_t blk = 0; blk < nby + nbc; blk++, mcuBuf += 64) {
+    for (uint32_t blk = 0; blk < nby + nbc; blk++) {
       uint32_t cmp = (blk < nby) ? 0 : blk - nby + 1;  // Component number 0:Y, 1:Cb, 2:Cr
       uint32_t id = cmp ? 1 : 0;                       // Huffman table ID of the component
-      auto dqf = mQtable[mQtableId[cmp]];   // De-quantize table ID for this component
-      //{{{  huffman decode DC from input
-      auto hb = mHuffBits[id][0];  // Huffman table for the DC element
-      auto hc = mHuffCode[id][0];
-      auto hd = mHuffData[id][0];
+      auto dqf = mQtable[mQtableId[cmp]];              // De-quantize table ID for this component
+
+      uint8_t* dst = nullptr;
+      int stride;
+      if (cmp) {
+        stride = mRowStrideC;
+        if (!skip)
+          dst = ((cmp == 1) ? s.mRowCb : s.mRowCr) + (planeX * blockSize);
+        }
+      else {
+        stride = mRowStrideY;
+        if (!skip)
+          dst = s.mRowY + ((blk / msx) * blockSize * stride) + ((planeX * msx) + (blk % msx)) * blockSize;
+        }
 
+      //{{{  huffman decode DC from input
       // Extract a huffman coded data (bit length)
-      int b = huffExtract (hb, hc, hd);
+      int b = huffDecode (s, mHuff[id][0]);
       if (b < 0)
         return false;  // invalid code or input
 
-      int d = mDcValue[cmp];         // DC value of previous block
-      if (b) {                  // If there is any difference from previous block
-        int e = bitEtract (b);  // Extract data bits
-        if (e < 0)
-          return false;
-
-        // MSB position
-        b = 1 << (b - 1);
-        if (!(e & b)) // Restore sign if needed
-          e -= (b << 1) - 1;
-
-        // Get current value
-        d += e;
-        mDcValue[cmp] = (int16_t)d;  // Save current DC value for next block
-        }
+      // Save current DC value for next block
+      if (b)
+        s.mDcValue[cmp] = (int16_t)(s.mDcValue[cmp] + extend (getBits (s, b), b));
 
       // De-quantize, apply scale factor of Arai algorithm and descale 8 bits
-      idctBuf[0] = d * dqf[0] >> 8;
+      int32_t dc = s.mDcValue[cmp] * dqf[0] >> 8;
       //}}}
       //{{{  huffman decode 63 AC from input
-      memset (idctBuf+1, 0, 63*sizeof(uint32_t));
-
-      hb = mHuffBits[id][1];
-      hc = mHuffCode[id][1];
-      hd = mHuffData[id][1];
+      const sHuff& acHuff = mHuff[id][1];
+      if (!dcOnly) {
+        s.mCoefs[0] = dc;
+        memset (s.mCoefs+1, 0, 63*sizeof(int32_t));
+        }
 
       // Top of the AC elements
-      uint32_t i = 1;
-      do {
-        // Extract a huffman coded value (zero runs and bit lengthgth)
-        int b = huffExtract (hb, hc, hd);
+      for (uint32_t i = 1; i < 64; i++) {
+        // Extract a huffman coded value (zero runs and bit length)
+        int b = huffDecode (s, acHuff);
         if (b == 0) // EOB
           break;
         if (b < 0)
           return false;
 
-        // Number of leading zero elements
-        auto z = (uint32_t)b >> 4;
-        if (z) {
-          // Skip zero elements
-          i += z;
-          if (i >= 64) // Too long zero run
-            return false;
-          }
+        // Skip zero elements
+        i += (uint32_t)b >> 4;
+        if (i >= 64) // Too long zero run
+          return false;
 
         // Bit length
         if (b &= 0x0F) {
-          // Extract data bits
-          d = bitEtract (b);
-          if (d < 0)
-            return false;
-
-          // MSB position
-          b = 1 << (b - 1);
-          if (!(d & b)) // Restore negative value if needed
-            d -= (b << 1) - 1;
-
-          // De-quantize, apply scale factor of Arai algorithm and descale 8 bits
-          z = kZigZag[i];
-          idctBuf[z] = d * dqf[z] >> 8;
+          int32_t d = extend (getBits (s, b), b);
+          if (!dcOnly) {
+            // De-quantize, apply scale factor of Arai algorithm and descale 8 bits
+            auto z = kZigZag[i];
+            s.mCoefs[z] = d * dqf[z] >> 8;
+            }
           }
-        } while (++i < 64);  // next AC element
+        }
       //}}}
 
-      if (mScaleShift == 3)  // only use DC element
-        *mcuBuf = uint8_t ((*idctBuf / 256) + 128);
+      if (skip)
+        continue;
+      else if (dcOnly)  // only use DC element
+        *dst = cJpegKernels::clip8 ((dc / 256) + 128);
       else
-        idct (idctBuf, mcuBuf);
+        mKernels->mIdct (s.mCoefs, dst, stride);
       }
 
     return true;
     }
   //}}}
   //{{{
-  bool mcuProcess (uint32_t x, uint32_t y) {
-
-    uint32_t mx = msx * 8;
-    uint32_t my = msy * 8;
-
-    uint32_t rx = (x + mx <= mWidth) ? mx : mWidth - x;
-    uint32_t ry = (y + my <= mHeight) ? my : mHeight - y;
-    if (!rx || !ry)
-      return true;
-
-    if (mScaleShift) {
-      // scaled
-      x >>= mScaleShift;
-      y >>= mScaleShift;
-      rx >>= mScaleShift;
-      ry >>= mScaleShift;
-      if (!rx || !ry)
-        return true;
-
-      if (mScaleShift == 3) {
-        //{{{  1/8 scaling, just use DC value
-        auto dstPtr = mFrameBuffer + ((y * mFrameWidth) + x) * mBytesPerPixel;
-        auto stride = (mFrameWidth - rx) * mBytesPerPixel;
-
-        auto chromaPtr = mMcuBuffer + (mx * my);
-        int32_t cb = *chromaPtr - 128;
-        int32_t cr = *(chromaPtr + 64) - 128;
-
-        for (uint32_t iy = 0; iy < my; iy += 8, dstPtr += stride) {
-          auto lumaPtr = mMcuBuffer;
-          if (iy == 8)
-            lumaPtr += 64 * 2;
-          for (uint32_t ix = 0; ix < mx; ix += 8, lumaPtr += 64) {
-            // convert YCbCr to BGRA
-            *dstPtr++ = kClip8 [*lumaPtr +  ((kBcB * cb) >> 10)];
-            *dstPtr++ = kClip8 [*lumaPtr - (((kGcB * cb) + (kGcR * cr)) >> 10)];
-            *dstPtr++ = kClip8 [*lumaPtr +  ((kRcR * cr) >> 10)];
-            if (mBytesPerPixel == 4)
-              *dstPtr++ = 0xFF;
-            }
-          }
+  void mcuRow (sState& s, uint32_t y, uint32_t mcuX0, uint32_t mcuX1) {
+  // colour convert MCUs mcuX0..mcuX1 of the MCU row at image line y into mFrameBuffer
+  // - 1/2, 1/4 average squares of full resolution bgr lines
+  // - MCU columns are multiples of the square, so intervals meeting mid row write disjoint pixels
+  // - frame starts at mFrameX, mFrameY of the scaled image, planes at mMcuX0
+
+    auto colour = mKernels->mColour[msx == 2];
+    uint32_t rowBytes = mFrameWidth * mBytesPerPixel;
+    uint32_t blockSize = (mScaleShift == 3) ? 1 : 8;
+    uint32_t planeX = (mcuX0 - mMcuX0) * msx * blockSize;
+    uint32_t chromaX = (mcuX0 - mMcuX0) * blockSize;
+    uint32_t frameX1 = mFrameX + mFrameWidth;
+    uint32_t frameY1 = mFrameY + mFrameHeight;
+
+    if (mScaleShift == 3) {
+      //{{{  1/8 scaling, one DC pixel per block, chroma per MCU
+      uint32_t x0 = mcuX0 * msx;
+      uint32_t x1 = std::min (mcuX1 * msx, frameX1);
+      uint32_t frameY = y >> 3;
+      if (x0 >= x1)
+        return;
+
+      for (uint32_t iy = 0; (iy < msy) && (frameY + iy < frameY1); iy++)
+        colour (s.mRowY + (iy * mRowStrideY) + planeX, s.mRowCb + chromaX, s.mRowCr + chromaX,
+                mFrameBuffer + ((frameY + iy - mFrameY) * rowBytes) + ((x0 - mFrameX) * mBytesPerPixel),
+                x1 - x0, mBytesPerPixel);
+      }
+      //}}}
+    else if (mScaleShift) {
+      //{{{  1/2, 1/4 scaling, full resolution bgr lines, then average squares
+      uint32_t x0 = (mcuX0 * msx * 8) >> mScaleShift;
+      uint32_t x1 = std::min ((mcuX1 * msx * 8) >> mScaleShift, frameX1);
+      uint32_t frameY = y >> mScaleShift;
+      if ((x0 >= x1) || (frameY >= frameY1))
+        return;
+
+      uint32_t rows = std::min ((msy * 8u) >> mScaleShift, frameY1 - frameY);
+      uint32_t width = (x1 - x0) << mScaleShift;
+      uint32_t bgrStride = width * 3;
+      for (uint32_t iy = 0; iy < (rows << mScaleShift); iy++) {
+        uint32_t chromaY = (iy / msy) * mRowStrideC;
+        colour (s.mRowY + (iy * mRowStrideY) + planeX,
+                s.mRowCb + chromaY + chromaX, s.mRowCr + chromaY + chromaX,
+                s.mRowBgr + (iy * bgrStride), width, 3);
         }
-        //}}}
-      else {
-        //{{{  1/2, 1/4 scaling
-        auto bgra = mIdctRgbBuffer;
-        for (uint32_t iy = 0; iy < my; iy++) {
-          auto chromaPtr = mMcuBuffer;
-          auto lumaPtr = chromaPtr + iy * 8;
-          if (my == 16) {
-            // Double block height?
-            chromaPtr += 64 * 4 + (iy >> 1) * 8;
-            if (iy >= 8)
-              lumaPtr += 64;
-            }
-          else
-            // Single block height
-            chromaPtr += mx * 8 + iy * 8;
-
-          for (uint32_t ix = 0; ix < mx; ix++) {
-            // Get CbCr component and restore right level
-            int32_t cb = *chromaPtr - 128;
-            int32_t cr = *(chromaPtr + 64) - 128;
-            if (mx == 16) {
-              // Double block width
-              if (ix == 8) // Jump to next block if double block heigt
-                lumaPtr += 64 - 8;
-
-              // Increase chroma pointer every two pixels
-              chromaPtr += ix & 1;
+
+      uint32_t sh = mScaleShift * 2;  // number of shifts for averaging
+      uint32_t w = 1 << mScaleShift;  // Width of square
+      for (uint32_t j = 0; j < rows; j++) {
+        auto dstPtr = mFrameBuffer + ((frameY + j - mFrameY) * rowBytes) + ((x0 - mFrameX) * mBytesPerPixel);
+        auto line = s.mRowBgr + ((j << mScaleShift) * bgrStride);
+        for (uint32_t i = x0; i < x1; i++, line += w * 3) {
+          // Accumulate BGR values in the square
+          uint32_t v1 = 0;
+          uint32_t v2 = 0;
+          uint32_t v3 = 0;
+          auto bgr = line;
+          for (uint32_t y = 0; y < w; y++, bgr += bgrStride)
+            for (uint32_t x = 0; x < w * 3; x += 3) {
+              v1 += bgr[x];
+              v2 += bgr[x+1];
+              v3 += bgr[x+2];
               }
-            else // Single block width, Increase chroma pointer every pixel
-              chromaPtr++;
 
-            // Convert YCbCr to BGRA
-            *bgra++ = kClip8 [*lumaPtr +  ((kBcB * cb) >> 10)];
-            *bgra++ = kClip8 [*lumaPtr - (((kGcB * cb) + (kGcR * cr)) >> 10)];
-            *bgra++ = kClip8 [*lumaPtr +  ((kRcR * cr) >> 10)];
-            }
+          // Put the averaged value as a pixel
+          *dstPtr++ = (uint8_t)(v1 >> sh);
+          *dstPtr++ = (uint8_t)(v2 >> sh);
+          *dstPtr++ = (uint8_t)(v3 >> sh);
+          if (mBytesPerPixel == 4)
+            *dstPtr++ = 0xFF;
           }
+        }
+      }
+      //}}}
+    else {
+      //{{{  1/1 scaling, nearest chroma
+      uint32_t x0 = mcuX0 * msx * 8;
+      uint32_t x1 = std::min (mcuX1 * msx * 8, frameX1);
+      uint32_t rows = std::min (msy * 8u, frameY1 - y);
+      for (uint32_t iy = 0; iy < rows; iy++) {
+        uint32_t chromaY = (iy / msy) * mRowStrideC;
+        colour (s.mRowY + (iy * mRowStrideY) + planeX, s.mRowCb + chromaY + chromaX, s.mRowCr + chromaY + chromaX,
+                mFrameBuffer + ((y + iy - mFrameY) * rowBytes) + ((x0 - mFrameX) * mBytesPerPixel),
+                x1 - x0, mBytesPerPixel);
+        }
+      }
+      //}}}
+    }
+  //}}}
 
-        //{{{  average scaleShift 1,2
-        uint32_t s = mScaleShift * 2;   // number of shifts for averaging
-        uint32_t w = 1 << mScaleShift;  // Width of square
-        uint32_t a = (mx - w) * 3;      // Bytes to skip for next line in the square
-
-        auto output = (uint8_t*)mIdctRgbBuffer;
-        for (uint32_t iy = 0; iy < my; iy += w) {
-          for (uint32_t ix = 0; ix < mx; ix += w) {
-            bgra = (uint8_t*)mIdctRgbBuffer + (iy * mx + ix) * 3;
-            uint32_t v1 = 0;
-            uint32_t v2 = 0;
-            uint32_t v3 = 0;
-            for (uint32_t y = 0; y < w; y++) {
-              // Accumulate BGR values in the square
-              for (uint32_t x = 0; x < w; x++) {
-                v1 += *bgra++;
-                v2 += *bgra++;
-                v3 += *bgra++;
-                }
-              bgra += a;
-              }
+  //{{{
+  bool allocPlanes (sState& s) {
+  // one MCU row of y, cb, cr planes across the crop, 1/8 keeps only the DC pixel of each block, chroma padded for simd overread
+
+    uint32_t mcus = mMcuX1 - mMcuX0;
+    uint32_t blockSize = (mScaleShift == 3) ? 1 : 8;
+    mRowStrideY = mcus * msx * blockSize;
+    mRowStrideC = mcus * blockSize;
+
+    uint32_t yBytes = mRowStrideY * msy * blockSize;
+    uint32_t cBytes = mRowStrideC * blockSize + 16;
+    uint32_t bgrBytes = ((mScaleShift == 1) || (mScaleShift == 2)) ? mcus * msx * 8 * msy * 8 * 3 : 0;
+
+    s.mRowY = (uint8_t*)malloc (yBytes + (2 * cBytes) + bgrBytes);
+    s.mRowCb = s.mRowY + yBytes;
+    s.mRowCr = s.mRowCb + cBytes;
+    s.mRowBgr = s.mRowCr + cBytes;
+    return s.mRowY != nullptr;
+    }
+  //}}}
+  //{{{
+  bool decodeSerial() {
+  // MCU rows in order on the caller, input streamed by read, stops after the last crop MCU
 
-            // Put the averaged value as a pixel
-            *output++ = (uint8_t)(v1 >> s);
-            *output++ = (uint8_t)(v2 >> s);
-            *output++ = (uint8_t)(v3 >> s);
-            }
-          }
-        //}}}
-        //{{{  squeeze up pixel table if a part of MCU is to be truncated
-        mx >>= mScaleShift;
-        if (rx < mx) {
-          auto src = (uint8_t*)mIdctRgbBuffer;
-          auto dst = (uint8_t*)mIdctRgbBuffer;
-          for (uint32_t y = 0; y < ry; y++, src += (mx - rx) * 3) {
-            for (uint32_t x = 0; x < rx; x++) {
-              *dst++ = *src++;
-              *dst++ = *src++;
-              *dst++ = *src++;
-              }
-            }
+    sState& s = mState;
+    if (!allocPlanes (s))
+      return false;
+    resetState (s);
+
+    uint16_t restartCount = 0;
+    uint16_t restartInterval = 0;
+
+    // iterate MCU rows
+    bool ok = true;
+    for (uint32_t mcuY = 0; ok && (mcuY < mMcuY1); mcuY++) {
+      bool skipRow = mcuY < mMcuY0;
+      uint32_t lastX = (mcuY + 1 == mMcuY1) ? mMcuX1 : mMcusPerRow;
+      for (uint32_t mcuX = 0; ok && (mcuX < lastX); mcuX++) {
+        if (mNumRst && restartInterval++ == mNumRst) {
+          // process restart interval if DRI header found
+          ok = restart (s, restartCount++);
+          restartInterval = 1;
           }
-        //}}}
 
-        auto src = mIdctRgbBuffer;
-        auto dstPtr = mFrameBuffer + ((y * mFrameWidth) + x) * mBytesPerPixel;
-        auto stride = (mFrameWidth - rx) * mBytesPerPixel;
-        for (uint32_t j = 0; j < ry; j++, dstPtr += stride)
-          for (uint32_t i = 0; i < rx; i++) {
-            *dstPtr++ = *src++; // B
-            *dstPtr++ = *src++; // G
-            *dstPtr++ = *src++; // R
-            if (mBytesPerPixel == 4)
-              *dstPtr++ = 0xFF;
-            }
+        // load MCU, decompress huffman coded stream and apply IDCT into row planes
+        ok = ok && mcuLoad (s, mcuX, skipRow || (mcuX < mMcuX0) || (mcuX >= mMcuX1));
         }
-        //}}}
+
+      // color space conversion, scaling and output
+      if (ok && !skipRow)
+        mcuRow (s, mcuY * msy * 8, mMcuX0, mMcuX1);
       }
-    else {
-      //{{{  1/1 scaling
-      auto dstPtr = mFrameBuffer + ((y * mFrameWidth) + x) * mBytesPerPixel;
-      auto stride = (mFrameWidth - rx) * mBytesPerPixel;
-
-      for (uint32_t iy = 0; iy < ry; iy++, dstPtr += stride) {
-        auto chromaPtr = mMcuBuffer;
-        auto lumaPtr = chromaPtr + iy * 8;
-        if (my == 16) {
-          // Double block height
-          chromaPtr += 64 * 4 + (iy >> 1) * 8;
-          if (iy >= 8)
-            lumaPtr += 64;
-          }
-        else
-          // Single block height
-          chromaPtr += mx * 8 + iy * 8;
-
-        for (uint32_t ix = 0; ix < rx; ix++, lumaPtr++) {
-          // get CbCr components as signed int
-          int32_t cb = *chromaPtr - 128;
-          int32_t cr = *(chromaPtr + 64) - 128;
-          if (mx == 16) {
-            // double block width, increase chroma pointer every two pixels
-            if (ix == 8) // jump to next block if double block height
-              lumaPtr += 64 - 8;
-            chromaPtr += ix & 1;
-            }
-          else // single block width, increase chroma pointer every pixel
-            chromaPtr++;
 
-          // convert YCbCr to BGRA
-          *dstPtr++ = kClip8 [*lumaPtr +  ((kBcB * cb) >> 10)];
-          *dstPtr++ = kClip8 [*lumaPtr - (((kGcB * cb) + (kGcR * cr)) >> 10)];
-          *dstPtr++ = kClip8 [*lumaPtr +  ((kRcR * cr) >> 10)];
-          if (mBytesPerPixel == 4)
-            *dstPtr++ = 0xFF;
-          }
+    free (s.mRowY);
+    s.mRowY = nullptr;
+    return ok;
+    }
+  //}}}
+
+  //{{{
+  bool scanRestarts() {
+  // find the RSTn ending each restart interval in the whole buffer, false if any missing or out of order
+
+    uint32_t numIntervals = (mNumMcus + mNumRst - 1) / mNumRst;
+    mIntervals.resize (numIntervals);
+
+    uint8_t* ptr = mBuffer + mScanOffset;
+    uint8_t* end = mBuffer + mBufferSize;
+    if (ptr >= end)
+      return false;
+
+    mIntervals[0].mStart = ptr;
+    for (uint32_t i = 1; i < numIntervals; ) {
+      ptr = (uint8_t*)memchr (ptr, 0xFF, end - ptr);
+      if (!ptr || (ptr + 1 >= end))
+        return false;
+
+      uint8_t marker = ptr[1];
+      if ((marker == 0x00) || (marker == 0xFF)) {
+        // stuffed 0xFF data or fill byte
+        ptr++;
+        continue;
         }
+      if (((marker & 0xF8) != 0xD0) || ((marker & 7) != ((i - 1) & 7)))
+        return false;
+
+      mIntervals[i-1].mEnd = ptr;
+      ptr += 2;
+      mIntervals[i++].mStart = ptr;
       }
-      //}}}
 
-    return y + ry <= mFrameHeight;
+    // last interval runs to EOI, bit reader stops at it
+    mIntervals[numIntervals-1].mEnd = end;
+    return true;
+    }
+  //}}}
+  //{{{
+  static uint8_t getScaleShift (uint32_t sourceWidth, uint32_t sourceHeight, uint32_t width, uint32_t height) {
+  // largest scaleShift still at least width x height
+
+    uint8_t scaleShift = 3;
+    while (scaleShift && (((sourceWidth >> scaleShift) < width) || ((sourceHeight >> scaleShift) < height)))
+      scaleShift--;
+
+    return scaleShift;
+    }
+  //}}}
+  //{{{
+  bool decodeThumb (uint32_t width, uint32_t height) {
+  // decode the exif thumb, at its own cheapest scale, if it is at least width x height
+  // - needs the bufferSize constructor, thumb read runs kBodyBufferSize past its end
+
+    if (!mThumbBytes || !mBufferSize || (mThumbOffset + mThumbBytes + kBodyBufferSize > mBufferSize))
+      return false;
+
+    cJpegPic thumb (mBytesPerPixel, mBuffer + mThumbOffset, mThumbBytes);
+    thumb.mKernels = mKernels;
+    if (!thumb.readHeader() || (thumb.getWidth() < width) || (thumb.getHeight() < height))
+      return false;
+
+    mFrameBuffer = thumb.decodeBody (getScaleShift (thumb.getWidth(), thumb.getHeight(), width, height));
+    if (!mFrameBuffer)
+      return false;
+
+    mFrameScale = kThumbScale;
+    mFrameX = 0;
+    mFrameY = 0;
+    mFrameWidth = thumb.getFrameWidth();
+    mFrameHeight = thumb.getFrameHeight();
+    return true;
+    }
+  //}}}
+  //{{{
+  bool intervalInCrop (uint32_t interval) {
+  // true if any MCU of restart interval lies inside the crop
+
+    uint32_t first = interval * mNumRst;
+    uint32_t last = std::min (first + mNumRst, mNumMcus) - 1;
+
+    uint32_t mcuY0 = std::max (first / mMcusPerRow, mMcuY0);
+    uint32_t mcuY1 = std::min (last / mMcusPerRow + 1, mMcuY1);
+    for (uint32_t mcuY = mcuY0; mcuY < mcuY1; mcuY++) {
+      uint32_t x0 = (mcuY == first / mMcusPerRow) ? first % mMcusPerRow : 0;
+      uint32_t x1 = (mcuY == last / mMcusPerRow) ? last % mMcusPerRow + 1 : mMcusPerRow;
+      if ((x0 < mMcuX1) && (x1 > mMcuX0))
+        return true;
+      }
+
+    return false;
+    }
+  //}}}
+  //{{{
+  bool decodeInterval (sState& s, uint32_t interval) {
+  // decode one restart interval from its own bytes, colour converting each MCU row piece as it completes
+
+    s.mRefill = false;
+    s.mDataPtr = mIntervals[interval].mStart - 1;
+    s.mDataCounter = (uint32_t)(mIntervals[interval].mEnd - mIntervals[interval].mStart);
+    resetState (s);
+
+    uint32_t mcu = interval * mNumRst;
+    uint32_t last = std::min (std::min (mcu + mNumRst, mNumMcus), ((mMcuY1 - 1) * mMcusPerRow) + mMcuX1);
+    while (mcu < last) {
+      uint32_t mcuY = mcu / mMcusPerRow;
+      uint32_t mcuX0 = mcu % mMcusPerRow;
+      uint32_t mcuX1 = std::min (mMcusPerRow, mcuX0 + (last - mcu));
+      bool skipRow = mcuY < mMcuY0;
+      for (uint32_t mcuX = mcuX0; mcuX < mcuX1; mcuX++)
+        if (!mcuLoad (s, mcuX, skipRow || (mcuX < mMcuX0) || (mcuX >= mMcuX1)))
+          return false;
+
+      // only the part of the row piece inside the crop
+      uint32_t cropX0 = std::max (mcuX0, mMcuX0);
+      uint32_t cropX1 = std::min (mcuX1, mMcuX1);
+      if (!skipRow && (cropX0 < cropX1))
+        mcuRow (s, mcuY * msy * 8, cropX0, cropX1);
+      mcu += mcuX1 - mcuX0;
+      }
+
+    return true;
+    }
+  //}}}
+  //{{{
+  bool decodeIntervals() {
+  // restart intervals touching the crop taken in turn by mThreads threads including caller
+  // - each thread with its own state and planes, intervals outside the crop never read
+
+    std::vector<uint32_t> intervals;
+    for (uint32_t interval = 0; interval < (uint32_t)mIntervals.size(); interval++)
+      if (intervalInCrop (interval))
+        intervals.push_back (interval);
+
+    uint32_t numIntervals = (uint32_t)intervals.size();
+    std::atomic<uint32_t> nextInterval = { 0 };
+    std::atomic<bool> failed = { false };
+
+    auto worker = [&]() {
+      sState s;
+      if (!allocPlanes (s)) {
+        failed = true;
+        return;
+        }
+
+      for (uint32_t i = nextInterval++; (i < numIntervals) && !failed; i = nextInterval++)
+        if (!decodeInterval (s, intervals[i]))
+          failed = true;
+
+      free (s.mRowY);
+      };
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 1; i < std::min ((uint32_t)mThreads, numIntervals); i++)
+      threads.push_back (std::thread (worker));
+    worker();
+    for (auto& thread : threads)
+      thread.join();
+
+    return !failed;
     }
   //}}}
 
   //{{{  private vars
-  uint32_t  mWidth;          // Size of the input image
-  uint32_t  mHeight;         // Size of the input image
+  uint32_t  mWidth = 0;      // Size of the input image
+  uint32_t  mHeight = 0;     // Size of the input image
   uint8_t   mScaleShift;     // Output scaling ratio
-  uint8_t   msx;             // MCU size in unit of block (width, height)
-  uint8_t   msy;             // MCU size in unit of block (width, height)
+  uint8_t   msx = 0;         // MCU size in unit of block (width, height)
+  uint8_t   msy = 0;         // MCU size in unit of block (width, height)
   uint16_t  mNumRst = 0;     // Restart inverval in MCUs
+  uint32_t  mMcusPerRow = 0;
+  uint32_t  mNumMcus = 0;
+
+  // crop in image pixels from setCrop, width 0 for whole image, decoded as MCUs mMcuX0..mMcuX1, mMcuY0..mMcuY1
+  uint32_t  mCropX = 0;
+  uint32_t  mCropY = 0;
+  uint32_t  mCropWidth = 0;
+  uint32_t  mCropHeight = 0;
+  uint32_t  mMcuX0 = 0;
+  uint32_t  mMcuX1 = 0;
+  uint32_t  mMcuY0 = 0;
+  uint32_t  mMcuY1 = 0;
 
   uint8_t*  mPoolBuffer;
   uint8_t*  mPoolPtr;
   uint32_t  mPoolBytesLeft;  // size of momory pool (bytes available)
-  uint8_t*  mMcuBuffer;      // working buffer for the MCU
-  uint8_t*  mIdctRgbBuffer;  // working buffer for IDCT and RGB output
 
   uint8_t*  mInputBuffer;    // bit stream input buffer
-  uint32_t  mDataCounter;    // Number of bytes available in the input buffer
-  uint8_t*  mDataPtr;        // Current data read ptr
-  uint8_t   mDataMask;       // Current bit in the current read byte
+  uint32_t  mScanOffset = 0; // offset of entropy coded data in mBuffer
+  sState    mState;          // serial decode state
 
-  int16_t   mDcValue[3];     // Previous DC element of each component
   uint8_t   mQtableId[3];    // Quantization table ID of each component
   int32_t*  mQtable[4];      // Dequaitizer tables [id]
 
-  uint8_t*  mHuffBits[2][2]; // Huffman bit distribution tables [id][dcac]
-  uint8_t*  mHuffData[2][2]; // Huffman decoded data tables [id][dcac]
-  uint16_t* mHuffCode[2][2]; // Huffman code word tables [id][dcac]
+  sHuff     mHuff[2][2];       // Huffman tables [id][dcac]
+  bool      mHuffLoaded[2][2];
+
+  const cJpegKernels::sKernels* mKernels = cJpegKernels::getBestKernels();
+
+  uint32_t  mRowStrideY = 0;
+  uint32_t  mRowStrideC = 0;
+
+  // parallel restart intervals
+  int mThreads = 1;
+  std::vector<sInterval> mIntervals;
 
+  uint32_t mFrameX = 0;       // frame origin in the scaled image, 0 for thumb
+  uint32_t mFrameY = 0;
   uint32_t mFrameWidth = 0;
   uint32_t mFrameHeight = 0;
+  uint8_t  mFrameScale = 0;   // scaleShift of the frame, kThumbScale if from the thumb
   uint8_t* mFrameBuffer = nullptr;
 
   // thumb
@@ -0,0 +1,140 @@
+// cMappedFile.h - read only memory mapped file, parsers and decoders get views into the mapping
+#pragma once
+//{{{  includes
+#include <stdint.h>
+#include <string>
+
+#ifdef _WIN32
+  #define WIN32_LEAN_AND_MEAN
+  #include <windows.h>
+#else
+  #include <fcntl.h>
+  #include <unistd.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+#endif
+//}}}
+
+class cMappedFile {
+public:
+  cMappedFile() {}
+  cMappedFile (const std::string& fileName, bool sequential = true) { open (fileName, sequential); }
+  ~cMappedFile() { close(); }
+
+  cMappedFile (const cMappedFile&) = delete;
+  cMappedFile& operator = (const cMappedFile&) = delete;
+
+  bool isOpen() { return mBuffer != nullptr; }
+
+  // views, valid until close
+  uint8_t* getBuffer() { return mBuffer; }
+  uint8_t* getEnd() { return mBuffer + mSize; }
+  size_t getSize() { return mSize; }
+
+  //{{{
+  bool open (const std::string& fileName, bool sequential = true) {
+  // map whole file readonly, sequential hints kernel to read ahead aggressively and drop behind
+
+    close();
+
+  #ifdef _WIN32
+    mFileHandle = CreateFileA (fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                               sequential ? FILE_FLAG_SEQUENTIAL_SCAN : FILE_FLAG_RANDOM_ACCESS, NULL);
+    if (mFileHandle == INVALID_HANDLE_VALUE) {
+      mFileHandle = NULL;
+      return false;
+      }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx (mFileHandle, &size) || !size.QuadPart) {
+      close();
+      return false;
+      }
+    mSize = (size_t)size.QuadPart;
+
+    mMapHandle = CreateFileMapping (mFileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mMapHandle)
+      mBuffer = (uint8_t*)MapViewOfFile (mMapHandle, FILE_MAP_READ, 0, 0, 0);
+  #else
+    mFile = ::open (fileName.c_str(), O_RDONLY);
+    if (mFile < 0)
+      return false;
+
+    struct stat st;
+    if ((fstat (mFile, &st) < 0) || !st.st_size) {
+      close();
+      return false;
+      }
+    mSize = (size_t)st.st_size;
+
+    void* buffer = mmap (NULL, mSize, PROT_READ, MAP_PRIVATE, mFile, 0);
+    if (buffer != MAP_FAILED) {
+      mBuffer = (uint8_t*)buffer;
+      madvise (mBuffer, mSize, sequential ? MADV_SEQUENTIAL : MADV_RANDOM);
+      }
+  #endif
+
+    if (!mBuffer) {
+      close();
+      return false;
+      }
+
+    return true;
+    }
+  //}}}
+  //{{{
+  void willNeed (const uint8_t* ptr, size_t bytes) {
+  // prefetch range, after a seek
+
+    if (!mBuffer || (ptr < mBuffer) || (ptr >= getEnd()))
+      return;
+    if (bytes > size_t(getEnd() - ptr))
+      bytes = getEnd() - ptr;
+
+  #ifdef _WIN32
+    WIN32_MEMORY_RANGE_ENTRY range = { (PVOID)ptr, bytes };
+    PrefetchVirtualMemory (GetCurrentProcess(), 1, &range, 0);
+  #else
+    // madvise wants page aligned address
+    uintptr_t pageMask = (uintptr_t)sysconf (_SC_PAGESIZE) - 1;
+    uint8_t* page = (uint8_t*)((uintptr_t)ptr & ~pageMask);
+    madvise (page, bytes + (ptr - page), MADV_WILLNEED);
+  #endif
+    }
+  //}}}
+  //{{{
+  void close() {
+
+  #ifdef _WIN32
+    if (mBuffer)
+      UnmapViewOfFile (mBuffer);
+    if (mMapHandle)
+      CloseHandle (mMapHandle);
+    if (mFileHandle)
+      CloseHandle (mFileHandle);
+    mMapHandle = NULL;
+    mFileHandle = NULL;
+  #else
+    if (mBuffer)
+      munmap (mBuffer, mSize);
+    if (mFile >= 0)
+      ::close (mFile);
+    mFile = -1;
+  #endif
+
+    mBuffer = nullptr;
+    mSize = 0;
+    }
+  //}}}
+
+private:
+#ifdef _WIN32
+  HANDLE mFileHandle = NULL;
+  HANDLE mMapHandle = NULL;
+#else
+  int mFile = -1;
+#endif
+
+  uint8_t* mBuffer = nullptr;
+  size_t mSize = 0;
+  };
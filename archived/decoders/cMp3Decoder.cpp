@@ -2,6 +2,7 @@
 //{{{  includes
 #include <cstring>
 #include <algorithm>
+#include <chrono>
 
 #include "cMp3Decoder.h"
 
@@ -40,6 +41,70 @@
 #define MAX_SCF                     (255 + BITS_DEQUANTIZER_OUT*4 - 210)
 #define MAX_SCFI                    ((MAX_SCF + 3) & ~3)
 //}}}
+//{{{  simd defines, 4 lane float SSE2 or NEON, AVX2 for synth and pcm out, picked at runtime by cpu
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+  #define USE_INTRINSICS
+  #define MP3_SSE2
+  #include <emmintrin.h>
+  #include <immintrin.h>
+  #ifdef _MSC_VER
+    #define MP3_AVX2_TARGET
+  #else
+    #define MP3_AVX2_TARGET __attribute__((target("avx2")))
+  #endif
+
+  #define VSTORE  _mm_storeu_ps
+  #define VLD     _mm_loadu_ps
+  #define VSET    _mm_set1_ps
+  #define VADD    _mm_add_ps
+  #define VSUB    _mm_sub_ps
+  #define VMUL    _mm_mul_ps
+
+  #define VMAC(a, x, y)  _mm_add_ps (a, _mm_mul_ps(x, y))
+  #define VMSB(a, x, y)  _mm_sub_ps (a, _mm_mul_ps(x, y))
+  #define VMUL_S(x, s)   _mm_mul_ps (x, _mm_set1_ps(s))
+
+  #define VREV(x) _mm_shuffle_ps (x, x, _MM_SHUFFLE(0, 1, 2, 3))
+  #define VSAVE2(i, v) _mm_storel_pi ((__m64*)(void*)&y[i*18], v)
+
+  typedef __m128 f4;
+
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+  #define USE_INTRINSICS
+  #define MP3_NEON
+  #include <arm_neon.h>
+
+  #define VSTORE  vst1q_f32
+  #define VLD     vld1q_f32
+  #define VSET    vmovq_n_f32
+  #define VADD    vaddq_f32
+  #define VSUB    vsubq_f32
+  #define VMUL    vmulq_f32
+
+  #define VMAC(a, x, y)  vmlaq_f32 (a, x, y)
+  #define VMSB(a, x, y)  vmlsq_f32 (a, x, y)
+  #define VMUL_S(x, s)   vmulq_f32 (x, vmovq_n_f32(s))
+
+  #define VREV(x) vcombine_f32 (vget_high_f32 (vrev64q_f32 (x)), vget_low_f32 (vrev64q_f32 (x)))
+  #define VSAVE2(i, v) vst1_f32 ((float32_t*)&y[i*18], vget_low_f32 (v))
+
+  typedef float32x4_t f4;
+#endif
+//}}}
+//{{{
+struct cMp3Decoder::sKernels {
+  const char* mName;
+  void (*mMidside) (float* left, int32_t n);
+  void (*mAntialias) (float* granuleBuffer, int32_t numBands);
+  void (*mImdct36) (float* granuleBuffer, float* overlap, const float* window, int32_t numBands);
+  void (*mDctII) (float* granuleBuf, int32_t numBands);
+  // polyphase window rows 14..0 of one band pair, lanes leftPair0 rightPair0 leftPair1 rightPair1
+  void (*mSynthWindow) (const float* zlin, float* dstLeft, float* dstRight, int32_t sampleStride);
+  // synth output, int16 scaled, to float -1..1 in place or to saturated int16
+  void (*mScalePcm) (float* pcm, int32_t n);
+  void (*mPackPcm) (int16_t* dst, const float* src, int32_t n);
+  };
+//}}}
 
 //{{{
 struct sScaleInfo {
@@ -554,9 +619,65 @@ void reorderL3 (float* granuleBuffer, float* scratch, const uint8_t* sfb) {
   }
 //}}}
 
+//{{{
+void midsideStereoL3Scalar (float* left, int32_t n) {
+
+  float* right = left + 576;
+  for (int32_t i = 0; i < n; i++) {
+    float a = left[i];
+    float b = right[i];
+    left[i] = a + b;
+    right[i] = a - b;
+    }
+  }
+//}}}
+//{{{
+void antialiasL3Scalar (float* granuleBuffer, int32_t numBands) {
+
+  for (; numBands > 0; numBands--, granuleBuffer += 18) {
+    for (int32_t i = 0; i < 8; i++) {
+      float u = granuleBuffer [18+i];
+      float d = granuleBuffer [17-i];
+      granuleBuffer [18+i] = u*kaa [0][i] - d*kaa [1][i];
+      granuleBuffer [17-i] = u*kaa [1][i] + d*kaa [0][i];
+      }
+    }
+  }
+//}}}
+//{{{
+void imdct36L3Scalar (float* granuleBuffer, float* overlap, const float* window, int32_t numBands) {
+
+  for (int32_t j = 0; j < numBands; j++, granuleBuffer += 18, overlap += 9) {
+    float co[9], si[9];
+    co[0] = -granuleBuffer[0];
+    si[0] = granuleBuffer[17];
+    for (int32_t i = 0; i < 4; i++) {
+      si[8 - 2*i] = granuleBuffer[4*i + 1] - granuleBuffer[4*i + 2];
+      co[1 + 2*i] = granuleBuffer[4*i + 1] + granuleBuffer[4*i + 2];
+      si[7 - 2*i] = granuleBuffer[4*i + 4] - granuleBuffer[4*i + 3];
+      co[2 + 2*i] = -(granuleBuffer[4*i + 3] + granuleBuffer[4*i + 4]);
+      }
+    dct39L3 (co);
+    dct39L3 (si);
+
+    si[1] = -si[1];
+    si[3] = -si[3];
+    si[5] = -si[5];
+    si[7] = -si[7];
+
+    for (int32_t i = 0; i < 9; i++) {
+      float ovl = overlap[i];
+      float sum = co[i] * ktwid9[9+i] + si[i] * ktwid9[i];
+      overlap[i] = co[i] * ktwid9[i] - si[i] * ktwid9[9+i];
+      granuleBuffer[i] = ovl * window[i] - sum * window[9+i];
+      granuleBuffer[17-i] = ovl * window[9+i] + sum * window[i];
+      }
+    }
+  }
+//}}}
 #ifdef USE_INTRINSICS
   //{{{
-  void midsideStereoL3 (float* left, int32_t n) {
+  void midsideStereoL3Simd (float* left, int32_t n) {
 
     float* right = left + 576;
 
@@ -577,7 +698,7 @@ void reorderL3 (float* granuleBuffer, float* scratch, const uint8_t* sfb) {
     }
   //}}}
   //{{{
-  void antialiasL3 (float* granuleBuffer, int32_t numBands) {
+  void antialiasL3Simd (float* granuleBuffer, int32_t numBands) {
 
     for (; numBands > 0; numBands--, granuleBuffer += 18) {
       for (int32_t i = 0; i < 8; i += 4) {
@@ -594,7 +715,7 @@ void reorderL3 (float* granuleBuffer, float* scratch, const uint8_t* sfb) {
     }
   //}}}
   //{{{
-  void imdct36L3 (float* granuleBuffer, float* overlap, const float* window, int32_t numBands) {
+  void imdct36L3Simd (float* granuleBuffer, float* overlap, const float* window, int32_t numBands) {
 
     for (int32_t j = 0; j < numBands; j++, granuleBuffer += 18, overlap += 9) {
       float co[9];
@@ -641,63 +762,6 @@ void reorderL3 (float* granuleBuffer, float* scratch, const uint8_t* sfb) {
       }
     }
   //}}}
-#else
-  //{{{
-  void midsideStereoL3 (float* left, int32_t n) {
-
-    float* right = left + 576;
-    for (int32_t i = 0; i < n; i++) {
-      float a = left[i];
-      float b = right[i];
-      left[i] = a + b;
-      right[i] = a - b;
-      }
-    }
-  //}}}
-  //{{{
-  void antialiasL3 (float* granuleBuffer, int32_t numBands) {
-
-    for (; numBands > 0; numBands--, granuleBuffer += 18) {
-      for (int32_t i = 0; i < 8; i++) {
-        float u = granuleBuffer [18+i];
-        float d = granuleBuffer [17-i];
-        granuleBuffer [18+i] = u*kaa [0][i] - d*kaa [1][i];
-        granuleBuffer [17-i] = u*kaa [1][i] + d*kaa [0][i];
-        }
-      }
-    }
-  //}}}
-  //{{{
-  void imdct36L3 (float* granuleBuffer, float* overlap, const float* window, int32_t numBands) {
-
-    for (int32_t j = 0; j < numBands; j++, granuleBuffer += 18, overlap += 9) {
-      float co[9], si[9];
-      co[0] = -granuleBuffer[0];
-      si[0] = granuleBuffer[17];
-      for (int32_t i = 0; i < 4; i++) {
-        si[8 - 2*i] = granuleBuffer[4*i + 1] - granuleBuffer[4*i + 2];
-        co[1 + 2*i] = granuleBuffer[4*i + 1] + granuleBuffer[4*i + 2];
-        si[7 - 2*i] = granuleBuffer[4*i + 4] - granuleBuffer[4*i + 3];
-        co[2 + 2*i] = -(granuleBuffer[4*i + 3] + granuleBuffer[4*i + 4]);
-        }
-      dct39L3 (co);
-      dct39L3 (si);
-
-      si[1] = -si[1];
-      si[3] = -si[3];
-      si[5] = -si[5];
-      si[7] = -si[7];
-
-      for (int32_t i = 0; i < 9; i++) {
-        float ovl = overlap[i];
-        float sum = co[i] * ktwid9[9+i] + si[i] * ktwid9[i];
-        overlap[i] = co[i] * ktwid9[i] - si[i] * ktwid9[9+i];
-        granuleBuffer[i] = ovl * window[i] - sum * window[9+i];
-        granuleBuffer[17-i] = ovl * window[9+i] + sum * window[i];
-        }
-      }
-    }
-  //}}}
 #endif
 
 //{{{
@@ -1045,8 +1109,8 @@ void stereoTopBandL3 (const float* right, const uint8_t* sfb, int32_t numBands,
   }
 //}}}
 //{{{
-void stereoProcessL3 (float* left, const uint8_t* istPos, const uint8_t* sfb, const uint8_t* header,
-                    int32_t max_band[3], int32_t mpeg2_sh) {
+void stereoProcessL3 (const cMp3Decoder::sKernels* kernels, float* left, const uint8_t* istPos, const uint8_t* sfb,
+                      const uint8_t* header, int32_t max_band[3], int32_t mpeg2_sh) {
 
   uint32_t max_pos = HDR_TEST_MPEG1 (header) ? 7 : 64;
 
@@ -1069,14 +1133,15 @@ void stereoProcessL3 (float* left, const uint8_t* istPos, const uint8_t* sfb, co
       intensityStereoBandL3 (left, sfb[i], kl * s, kr * s);
       }
     else if (HDR_TEST_MS_STEREO (header))
-      midsideStereoL3 (left, sfb[i]);
+      kernels->mMidside (left, sfb[i]);
 
     left += sfb[i];
     }
   }
 //}}}
 //{{{
-void intensityStereoL3 (float* left, uint8_t* istPos, const struct cMp3Decoder::sGranule* granule, const uint8_t* header) {
+void intensityStereoL3 (const cMp3Decoder::sKernels* kernels, float* left, uint8_t* istPos,
+                        const struct cMp3Decoder::sGranule* granule, const uint8_t* header) {
 
   int32_t maxBand[3];
   int32_t numSfb = granule->numLongSfb + granule->numShortSfb;
@@ -1093,7 +1158,7 @@ void intensityStereoL3 (float* left, uint8_t* istPos, const struct cMp3Decoder::
     istPos[itop] = maxBand[i] >= prev ? defaultPos : istPos[prev];
     }
 
-  stereoProcessL3 (left, istPos, granule->sfbtab, header, maxBand, granule[1].scalefac_compress & 1);
+  stereoProcessL3 (kernels, left, istPos, granule->sfbtab, header, maxBand, granule[1].scalefac_compress & 1);
   }
 //}}}
 
@@ -1142,10 +1207,11 @@ void imdctShortL3 (float* granuleBuffer, float* overlap, int32_t numBands) {
   }
 //}}}
 //{{{
-void imdctGranuleL3 (float* granuleBuffer, float* overlap, uint32_t blockType, uint32_t numLongBands) {
+void imdctGranuleL3 (const cMp3Decoder::sKernels* kernels, float* granuleBuffer, float* overlap,
+                     uint32_t blockType, uint32_t numLongBands) {
 
   if (numLongBands) {
-    imdct36L3 (granuleBuffer, overlap, kmdct_window[0], numLongBands);
+    kernels->mImdct36 (granuleBuffer, overlap, kmdct_window[0], numLongBands);
     granuleBuffer += 18 * numLongBands;
     overlap += 9 * numLongBands;
     }
@@ -1153,7 +1219,7 @@ void imdctGranuleL3 (float* granuleBuffer, float* overlap, uint32_t blockType, u
   if (blockType == SHORT_blockType)
     imdctShortL3 (granuleBuffer, overlap, 32 - numLongBands);
   else
-    imdct36L3 (granuleBuffer, overlap, kmdct_window[blockType == STOP_blockType], 32 - numLongBands);
+    kernels->mImdct36 (granuleBuffer, overlap, kmdct_window[blockType == STOP_blockType], 32 - numLongBands);
   }
 //}}}
 
@@ -1168,142 +1234,88 @@ void changeSignL3 (float* granuleBuffer) {
 //}}}
 //}}}
 
-#ifdef _WIN32
-  #define USE_INTRINSICS
-#endif
-
-#ifdef USE_INTRINSICS
-  //{{{  intrinsics defines
-  #include <intrin.h>
-  #include <immintrin.h>
-
-  #define VSTORE  _mm_storeu_ps
-  #define VLD     _mm_loadu_ps
-  #define VSET    _mm_set1_ps
-  #define VADD    _mm_add_ps
-  #define VSUB    _mm_sub_ps
-  #define VMUL    _mm_mul_ps
-
-  #define VMAC(a, x, y)  _mm_add_ps (a, _mm_mul_ps(x, y))
-  #define VMSB(a, x, y)  _mm_sub_ps (a, _mm_mul_ps(x, y))
-  #define VMUL_S(x, s)   _mm_mul_ps (x, _mm_set1_ps(s))
-
-  #define VREV(x) _mm_shuffle_ps (x, x, _MM_SHUFFLE(0, 1, 2, 3))
-
-  typedef __m128 f4;
-
-  static const f4 kMax = {  32767.0f,  32767.0f,  32767.0f,  32767.0f };
-  static const f4 kMin = { -32768.0f, -32768.0f, -32768.0f, -32768.0f };
-  //}}}
-  //{{{
-  int16_t scaleSample (float sample) {
-
-    if (sample >= 32766.5)
-      return (int16_t) 32767;
-    if (sample <= -32767.5)
-      return (int16_t)-32768;
-
-    // away from zero, to be compliant
-    int16_t s = (int16_t)(sample + .5f);
-    s -= (s < 0);
-
-    return s;
-    }
-  //}}}
-  //{{{
-  void synthPair (int16_t* pcm, int32_t numChannels, const float* z) {
-
-    float a = (z[14*64] - z[0]) * 29;
-    a += (z[1*64] + z[13*64]) * 213;
-    a += (z[12*64] - z[2*64]) * 459;
-    a += (z[3*64] + z[11*64]) * 2037;
-    a += (z[10*64] - z[4*64]) * 5153;
-    a += (z[5*64] + z[9*64]) * 6574;
-    a += (z[8*64] - z[6*64]) * 37489;
-    a +=  z[7*64] * 75038;
-    pcm[0] = scaleSample (a);
-
-    z += 2;
-    a  = z[14*64] * 104;
-    a += z[12*64] * 1567;
-    a += z[10*64] * 9727;
-    a += z[8*64] * 64019;
-    a += z[6*64] * -9975;
-    a += z[4*64] * -45;
-    a += z[2*64] * 146;
-    a += z[0*64] * -5;
-    pcm[16 * numChannels] = scaleSample (a);
-    }
-  //}}}
-  //{{{
-  void synthBand (float* xLeft, int16_t* dstLeft, int32_t numChannels, float* lins) {
-
-    float* xRight = xLeft + 576 * (numChannels - 1);
-    int16_t* dstRight = dstLeft + (numChannels - 1);
-
-    float* zlin = lins + 15*64;
-    const float* w = kwin;
-
-    zlin [4*15] = xLeft[18*16];
-    zlin [4*15 + 1] = xRight[18*16];
-    zlin [4*15 + 2] = xLeft[0];
-    zlin [4*15 + 3] = xRight[0];
-
-    zlin [4*31] = xLeft[1 + 18*16];
-    zlin [4*31 + 1] = xRight[1 + 18*16];
-    zlin [4*31 + 2] = xLeft[1];
-    zlin [4*31 + 3] = xRight[1];
+// synth
+//{{{
+void dctIIScalar (float* granuleBuf, int32_t numBands) {
+
+  for (int32_t k = 0; k < numBands; k++) {
+    float t[4][8];
+    float* y = granuleBuf + k;
+    float* x = t[0];
+    for (int32_t i = 0; i < 8; i++, x++) {
+      float x0 = y[i*18];
+      float x1 = y[(15-i)*18];
+      float x2 = y[(16+i)*18];
+      float x3 = y[(31-i)*18];
+      float t0 = x0 + x3;
+      float t1 = x1 + x2;
+      float t2 = (x1 - x2)*ksec[3*i + 0];
+      float t3 = (x0 - x3)*ksec[3*i + 1];
+      x[0] = t0 + t1;
+      x[8] = (t0 - t1)*ksec[3*i + 2];
+      x[16] = t3 + t2;
+      x[24] = (t3 - t2)*ksec[3*i + 2];
+      }
 
-    synthPair (dstRight, numChannels, lins + 4*15 + 1);
-    synthPair (dstRight + 32*numChannels, numChannels, lins + 4*15 + 64 + 1);
-    synthPair (dstLeft, numChannels, lins + 4*15);
-    synthPair (dstLeft + 32*numChannels, numChannels, lins + 4*15 + 64);
+    x = t[0];
+    for (int32_t i = 0; i < 4; i++, x += 8) {
+      float x0 = x[0];
+      float x1 = x[1];
+      float x2 = x[2];
+      float x3 = x[3];
+      float x4 = x[4];
+      float x5 = x[5];
+      float x6 = x[6];
+      float x7 = x[7];
+      float  xt = x0 - x7;
+      x0 += x7;
+      x7 = x1 - x6;
+      x1 += x6;
+      x6 = x2 - x5;
+      x2 += x5;
+      x5 = x3 - x4;
+      x3 += x4;
+      x4 = x0 - x3;
+      x0 += x3;
+      x3 = x1 - x2;
+      x1 += x2;
+      x[0] = x0 + x1;
+      x[4] = (x0 - x1) * 0.70710677f;
+      x5 =  x5 + x6;
+      x6 = (x6 + x7) * 0.70710677f;
+      x7 =  x7 + xt;
+      x3 = (x3 + x4) * 0.70710677f;
+      x5 -= x7 * 0.198912367f;  /* rotate by PI/8 */
+      x7 += x5 * 0.382683432f;
+      x5 -= x7 * 0.198912367f;
+      x0 = xt - x6; xt += x6;
+      x[1] = (xt + x7) * 0.50979561f;
+      x[2] = (x4 + x3) * 0.54119611f;
+      x[3] = (x0 - x5) * 0.60134488f;
+      x[5] = (x0 + x5) * 0.89997619f;
+      x[6] = (x4 - x3) * 1.30656302f;
+      x[7] = (xt - x7) * 2.56291556f;
+      }
 
-    for (int32_t i = 14; i >= 0; i--) {
-      zlin [4*i] = xLeft[18*(31 - i)];
-      zlin [4*i + 1] = xRight[18*(31 - i)];
-      zlin [4*i + 2] = xLeft[1 + 18*(31-i)];
-      zlin [4*i + 3] = xRight[1 + 18*(31-i)];
-      zlin [4*i + 64] = xLeft[1 + 18*(1+i)];
-      zlin [4*i + 64 + 1] = xRight[1+18*(1+i)];
-      zlin [4*i - 64 + 2] = xLeft[18*(1+i)];
-      zlin [4*i - 64 + 3] = xRight[18*(1+i)];
-
-      #define VLOAD(k) f4 w0 = VSET (*w++); \
-                       f4 w1 = VSET (*w++); \
-                       f4 vz = VLD (&zlin[4*i - 64*k]); \
-                       f4 vy = VLD (&zlin[4*i - 64*(15-k)]);
-      #define V0(k) { VLOAD (k) \
-                      b = VADD (VMUL (vz, w1), VMUL (vy, w0)); \
-                      a = VSUB (VMUL (vz, w0), VMUL (vy, w1)); }
-      #define V1(k) { VLOAD (k) \
-                      b = VADD (b, VADD (VMUL (vz, w1), VMUL (vy, w0)));  \
-                      a = VADD (a, VSUB (VMUL (vz, w0), VMUL (vy, w1))); }
-      #define V2(k) { VLOAD (k) \
-                      b = VADD (b, VADD (VMUL (vz, w1), VMUL (vy, w0))); \
-                      a = VADD (a, VSUB (VMUL (vy, w1), VMUL (vz, w0))); }
-      f4 a, b;
-      V0(0) V2(1) V1(2) V2(3) V1(4) V2(5) V1(6) V2(7)
-        {
-        __m128i pcm8 = _mm_packs_epi32 (_mm_cvtps_epi32 (_mm_max_ps (_mm_min_ps (a, kMax), kMin)),
-                                        _mm_cvtps_epi32 (_mm_max_ps (_mm_min_ps (b, kMax), kMin)));
-        dstRight [(15 - i) * numChannels] = _mm_extract_epi16 (pcm8, 1);
-        dstRight [(17 + i) * numChannels] = _mm_extract_epi16 (pcm8, 5);
-
-        dstLeft [(15 - i) * numChannels] = _mm_extract_epi16 (pcm8, 0);
-        dstLeft [(17 + i) * numChannels] = _mm_extract_epi16 (pcm8, 4);
-
-        dstRight [(47 - i) * numChannels] = _mm_extract_epi16 (pcm8, 3);
-        dstRight [(49 + i) * numChannels] = _mm_extract_epi16 (pcm8, 7);
-
-        dstLeft [(47 - i) * numChannels] = _mm_extract_epi16 (pcm8, 2);
-        dstLeft [(49 + i) * numChannels] = _mm_extract_epi16 (pcm8, 6);
-        }
+    // same sums as the simd, bit exact
+    for (int32_t i = 0; i < 7; i++, y += 4*18) {
+      float s = t[3][i] + t[3][i + 1];
+      y[0*18] = t[0][i];
+      y[1*18] = t[2][i] + s;
+      y[2*18] = t[1][i] + t[1][i + 1];
+      y[3*18] = t[2][i + 1] + s;
       }
+
+    y[0*18] = t[0][7];
+    y[1*18] = t[2][7] + t[3][7];
+    y[2*18] = t[1][7];
+    y[3*18] = t[3][7];
     }
-  //}}}
+  }
+//}}}
+#ifdef USE_INTRINSICS
   //{{{
-  void dctII (float* granuleBuf, int32_t numBands) {
+  void dctIISimd (float* granuleBuf, int32_t numBands) {
 
     for (int32_t k = 0; k < numBands; k += 4) {
       f4 t[4][8];
@@ -1366,7 +1378,6 @@ void changeSignL3 (float* granuleBuffer) {
         x[7] = VMUL_S (VSUB(xt, x7), 2.56291556f);
         }
 
-      #define VSAVE2(i, v) _mm_storel_pi ((__m64*)(void*)&y[i*18], v)
       #define VSAVE4(i, v) VSTORE (&y[i*18], v)
 
       if (k > numBands - 3) {
@@ -1398,228 +1409,422 @@ void changeSignL3 (float* granuleBuffer) {
       }
     }
   //}}}
-  //{{{
-  void synth (float* qmfState, float* granuleBuf, int32_t numBands, int32_t numChannels, int16_t* pcm, float* lins) {
+#endif
 
-    for (int32_t channel = 0; channel < numChannels; channel++)
-      dctII (granuleBuf + 576 * channel, numBands);
+//{{{
+inline void storeRow (float* dstLeft, float* dstRight, int32_t sampleStride, int32_t i, const float* a, const float* b) {
+// one polyphase window row, lanes leftPair0 rightPair0 leftPair1 rightPair1
+
+  dstRight[(15 - i) * sampleStride] = a[1];
+  dstRight[(17 + i) * sampleStride] = b[1];
+  dstLeft[(15 - i) * sampleStride] = a[0];
+  dstLeft[(17 + i) * sampleStride] = b[0];
+  dstRight[(47 - i) * sampleStride] = a[3];
+  dstRight[(49 + i) * sampleStride] = b[3];
+  dstLeft[(47 - i) * sampleStride] = a[2];
+  dstLeft[(49 + i) * sampleStride] = b[2];
+  }
+//}}}
+//{{{
+void synthWindowScalar (const float* zlin, float* dstLeft, float* dstRight, int32_t sampleStride) {
 
-    memcpy (lins, qmfState, sizeof(float) * 15 * 64);
+  const float* w = kwin;
+  for (int32_t i = 14; i >= 0; i--) {
+    float a[4], b[4];
+    //{{{
+    #define LOAD(k) \
+      float w0 = *w++; \
+      float w1 = *w++; \
+      const float* vz = &zlin [4*i - k*64]; \
+      const float* vy = &zlin [4*i - (15 - k)*64];
+    //}}}
+    //{{{
+    #define S0(k) { \
+      LOAD(k); \
+      for (int32_t j = 0; j < 4; j++) {       \
+        b[j]  = vz[j]*w1 + vy[j]*w0;  \
+        a[j]  = vz[j]*w0 - vy[j]*w1;  \
+        }                             \
+      }
+    //}}}
+    //{{{
+    #define S1(k) { \
+      LOAD(k); \
+      for (int32_t j = 0; j < 4; j++) {       \
+        b[j] += vz[j]*w1 + vy[j]*w0;  \
+        a[j] += vz[j]*w0 - vy[j]*w1;  \
+        }                             \
+      }
+    //}}}
+    //{{{
+    #define S2(k) { \
+      LOAD(k); \
+      for (int32_t j = 0; j < 4; j++) {       \
+        b[j] += vz[j]*w1 + vy[j]*w0;  \
+        a[j] += vy[j]*w1 - vz[j]*w0;  \
+        }                             \
+      }
+    //}}}
+    S0(0) S2(1) S1(2) S2(3) S1(4) S2(5) S1(6) S2(7)
 
-    for (int32_t band = 0; band < numBands; band += 2)
-      synthBand (granuleBuf + band, pcm + 32 * numChannels * band, numChannels, lins + band * 64);
+    storeRow (dstLeft, dstRight, sampleStride, i, a, b);
+    }
+  }
+//}}}
+//{{{
+void scalePcmScalar (float* pcm, int32_t n) {
+// float pcm, -1..1
 
-    memcpy (qmfState, lins + numBands * 64, sizeof(float) * 15 * 64);
+  for (int32_t i = 0; i < n; i++)
+    pcm[i] *= 1.f / 0x8000;
+  }
+//}}}
+//{{{
+void packPcmScalar (int16_t* dst, const float* src, int32_t n) {
+// int16 pcm, saturated, rounded away from zero to be compliant
+
+  for (int32_t i = 0; i < n; i++) {
+    float sample = src[i];
+    if (sample >= 32766.5f)
+      dst[i] = (int16_t)32767;
+    else if (sample <= -32767.5f)
+      dst[i] = (int16_t)-32768;
+    else {
+      int16_t s = (int16_t)(sample + .5f);
+      s -= (s < 0);
+      dst[i] = s;
+      }
+    }
+  }
+//}}}
+
+#ifdef USE_INTRINSICS
+  //{{{
+  inline void windowRowSimd (const float* zlin, const float* w, int32_t i, float* a, float* b) {
+  // lanes leftPair0 rightPair0 leftPair1 rightPair1
+
+    #define VLOAD(k) f4 w0 = VSET (*w++); \
+                     f4 w1 = VSET (*w++); \
+                     f4 vz = VLD (&zlin[4*i - 64*k]); \
+                     f4 vy = VLD (&zlin[4*i - 64*(15-k)]);
+    #define V0(k) { VLOAD (k) \
+                    vb = VADD (VMUL (vz, w1), VMUL (vy, w0)); \
+                    va = VSUB (VMUL (vz, w0), VMUL (vy, w1)); }
+    #define V1(k) { VLOAD (k) \
+                    vb = VADD (vb, VADD (VMUL (vz, w1), VMUL (vy, w0)));  \
+                    va = VADD (va, VSUB (VMUL (vz, w0), VMUL (vy, w1))); }
+    #define V2(k) { VLOAD (k) \
+                    vb = VADD (vb, VADD (VMUL (vz, w1), VMUL (vy, w0))); \
+                    va = VADD (va, VSUB (VMUL (vy, w1), VMUL (vz, w0))); }
+    f4 va, vb;
+    V0(0) V2(1) V1(2) V2(3) V1(4) V2(5) V1(6) V2(7)
+
+    VSTORE (a, va);
+    VSTORE (b, vb);
     }
   //}}}
-#else
   //{{{
-  void synthPair (float* pcm, int32_t numChannels, const float* z) {
-
-    float a = (z[14*64] - z[0]) * 29;
-    a += (z[1*64] + z[13*64]) * 213;
-    a += (z[12*64] - z[2*64]) * 459;
-    a += (z[3*64] + z[11*64]) * 2037;
-    a += (z[10*64] - z[4*64]) * 5153;
-    a += (z[5*64] + z[9*64]) * 6574;
-    a += (z[8*64] - z[6*64]) * 37489;
-    a +=  z[7*64] * 75038;
-    pcm[0] = a / 0x8000;
-
-    z += 2;
-    a  = z[14*64] * 104;
-    a += z[12*64] * 1567;
-    a += z[10*64] * 9727;
-    a += z[8*64] * 64019;
-    a += z[6*64] * -9975;
-    a += z[4*64] * -45;
-    a += z[2*64] * 146;
-    a += z[0*64] * -5;
-    pcm[16 * numChannels] = a / 0x8000;
+  void synthWindowSimd (const float* zlin, float* dstLeft, float* dstRight, int32_t sampleStride) {
+
+    for (int32_t i = 14; i >= 0; i--) {
+      float a[4], b[4];
+      windowRowSimd (zlin, kwin + 16 * (14 - i), i, a, b);
+      storeRow (dstLeft, dstRight, sampleStride, i, a, b);
+      }
     }
   //}}}
+#endif
+
+#if defined(MP3_SSE2)
   //{{{
-  void synthBand (float* xLeft, float* dstLeft, int32_t numChannels, float* lins) {
+  inline __m128i roundSse2 (__m128 sample) {
+  // clamped so the truncating convert can't overflow, + .5 and -1 if negative rounds as packPcmScalar
 
-    float* xRight = xLeft + 576 * (numChannels - 1);
-    float* dstRight = dstLeft + (numChannels - 1);
+    __m128i s = _mm_cvttps_epi32 (_mm_add_ps (_mm_min_ps (_mm_max_ps (sample, _mm_set1_ps (-32768.f)),
+                                                          _mm_set1_ps (32768.f)), _mm_set1_ps (.5f)));
+    return _mm_add_epi32 (s, _mm_srai_epi32 (s, 31));
+    }
+  //}}}
+  //{{{
+  void scalePcmSse2 (float* pcm, int32_t n) {
 
-    float* zlin = lins + 15 * 64;
-    const float* w = kwin;
+    int32_t i = 0;
+    for (; i < n - 3; i += 4)
+      _mm_storeu_ps (pcm + i, _mm_mul_ps (_mm_loadu_ps (pcm + i), _mm_set1_ps (1.f / 0x8000)));
 
-    zlin [4*15] = xLeft[18*16];
-    zlin [4*15 + 1] = xRight[18 * 16];
-    zlin [4*15 + 2] = xLeft[0];
-    zlin [4*15 + 3] = xRight[0];
+    scalePcmScalar (pcm + i, n - i);
+    }
+  //}}}
+  //{{{
+  void packPcmSse2 (int16_t* dst, const float* src, int32_t n) {
+  // 8 samples a store, saturated by the pack
 
-    zlin [4*31] = xLeft[1 + 18 * 16];
-    zlin [4*31 + 1] = xRight[1 + 18 * 16];
-    zlin [4*31 + 2] = xLeft[1];
-    zlin [4*31 + 3] = xRight[1];
+    int32_t i = 0;
+    for (; i < n - 7; i += 8)
+      _mm_storeu_si128 ((__m128i*)(dst + i), _mm_packs_epi32 (roundSse2 (_mm_loadu_ps (src + i)),
+                                                              roundSse2 (_mm_loadu_ps (src + i + 4))));
 
-    synthPair (dstRight, numChannels, lins + 4*15 + 1);
-    synthPair (dstRight + 32*numChannels, numChannels, lins + 4*15 + 64 + 1);
-    synthPair (dstLeft, numChannels, lins + 4*15);
-    synthPair (dstLeft + 32* numChannels, numChannels, lins + 4*15 + 64);
+    packPcmScalar (dst + i, src + i, n - i);
+    }
+  //}}}
 
-    for (int32_t i = 14; i >= 0; i--) {
-      zlin[4*i] = xLeft[18 * (31 - i)];
-      zlin[4*i + 1] = xRight[18 * (31 - i)];
-      zlin[4*i + 2] = xLeft[1 + 18 * (31 - i)];
-      zlin[4*i + 3] = xRight[1 + 18 * (31 - i)];
-      zlin[4*(i+16)]   = xLeft[1 + 18 * (1 + i)];
-      zlin[4*(i+16) + 1] = xRight[1 + 18 * (1 + i)];
-      zlin[4*(i-16) + 2] = xLeft[18 * (1 + i)];
-      zlin[4*(i-16) + 3] = xRight[18 * (1 + i)];
+  //{{{
+  MP3_AVX2_TARGET void synthWindowAvx2 (const float* zlin, float* dstLeft, float* dstRight, int32_t sampleStride) {
+  // rows i and i - 1 in the high and low halves, row 0 on its own, lanes and sums as windowRowSimd
 
-      float a[4], b[4];
-      //{{{
-      #define LOAD(k) \
-        float w0 = *w++; \
-        float w1 = *w++; \
-        float* vz = &zlin [4*i - k*64]; \
-        float* vy = &zlin [4*i - (15 - k)*64];
-      //}}}
-      //{{{
-      #define S0(k) { \
-        LOAD(k); \
-        for (int32_t j = 0; j < 4; j++) {       \
-          b[j]  = vz[j]*w1 + vy[j]*w0;  \
-          a[j]  = vz[j]*w0 - vy[j]*w1;  \
-          }                             \
-        }
-      //}}}
-      //{{{
-      #define S1(k) { \
-        LOAD(k); \
-        for (int32_t j = 0; j < 4; j++) {       \
-          b[j] += vz[j]*w1 + vy[j]*w0;  \
-          a[j] += vz[j]*w0 - vy[j]*w1;  \
-          }                             \
-        }
-      //}}}
-      //{{{
-      #define S2(k) { \
-        LOAD(k); \
-        for (int32_t j = 0; j < 4; j++) {       \
-          b[j] += vz[j]*w1 + vy[j]*w0;  \
-          a[j] += vy[j]*w1 - vz[j]*w0;  \
-          }                             \
+    const float* w = kwin;
+    for (int32_t i = 14; i > 0; i -= 2, w += 32) {
+      __m256 va = _mm256_setzero_ps();
+      __m256 vb = _mm256_setzero_ps();
+      for (int32_t k = 0; k < 8; k++) {
+        // row i window comes 16 before row i - 1
+        __m256 w0 = _mm256_blend_ps (_mm256_broadcast_ss (w + 16 + 2*k), _mm256_broadcast_ss (w + 2*k), 0xF0);
+        __m256 w1 = _mm256_blend_ps (_mm256_broadcast_ss (w + 17 + 2*k), _mm256_broadcast_ss (w + 1 + 2*k), 0xF0);
+        __m256 vz = _mm256_loadu_ps (zlin + 4*(i - 1) - 64*k);
+        __m256 vy = _mm256_loadu_ps (zlin + 4*(i - 1) - 64*(15 - k));
+        __m256 b = _mm256_add_ps (_mm256_mul_ps (vz, w1), _mm256_mul_ps (vy, w0));
+        __m256 a = (k & 1) ? _mm256_sub_ps (_mm256_mul_ps (vy, w1), _mm256_mul_ps (vz, w0))
+                           : _mm256_sub_ps (_mm256_mul_ps (vz, w0), _mm256_mul_ps (vy, w1));
+        va = k ? _mm256_add_ps (va, a) : a;
+        vb = k ? _mm256_add_ps (vb, b) : b;
         }
-      //}}}
-      S0(0) S2(1) S1(2) S2(3) S1(4) S2(5) S1(6) S2(7)
-
-      dstRight[(15 - i) * numChannels] = a[1] / 0x8000;
-      dstRight[(17 + i) * numChannels] = b[1] / 0x8000;
-      dstLeft[(15 - i) * numChannels] = a[0] / 0x8000;
-      dstLeft[(17 + i) * numChannels] = b[0] / 0x8000;
-      dstRight[(47 - i) * numChannels] = a[3] / 0x8000;
-      dstRight[(49 + i) * numChannels] = b[3] / 0x8000;
-      dstLeft[(47 - i) * numChannels] = a[2] / 0x8000;
-      dstLeft[(49 + i) * numChannels] = b[2] / 0x8000;
+
+      float a[8], b[8];
+      _mm256_storeu_ps (a, va);
+      _mm256_storeu_ps (b, vb);
+      storeRow (dstLeft, dstRight, sampleStride, i, a + 4, b + 4);
+      storeRow (dstLeft, dstRight, sampleStride, i - 1, a, b);
       }
+
+    float a[4], b[4];
+    windowRowSimd (zlin, w, 0, a, b);
+    storeRow (dstLeft, dstRight, sampleStride, 0, a, b);
     }
   //}}}
   //{{{
-  void dctII (float* granuleBuf, int32_t numBands) {
-
-    for (int32_t k = 0; k < numBands; k++) {
-      float t[4][8];
-      float* y = granuleBuf + k;
-      float* x = t[0];
-      for (int32_t i = 0; i < 8; i++, x++) {
-        float x0 = y[i*18];
-        float x1 = y[(15-i)*18];
-        float x2 = y[(16+i)*18];
-        float x3 = y[(31-i)*18];
-        float t0 = x0 + x3;
-        float t1 = x1 + x2;
-        float t2 = (x1 - x2)*ksec[3*i + 0];
-        float t3 = (x0 - x3)*ksec[3*i + 1];
-        x[0] = t0 + t1;
-        x[8] = (t0 - t1)*ksec[3*i + 2];
-        x[16] = t3 + t2;
-        x[24] = (t3 - t2)*ksec[3*i + 2];
-        }
+  MP3_AVX2_TARGET void scalePcmAvx2 (float* pcm, int32_t n) {
 
-      x = t[0];
-      for (int32_t i = 0; i < 4; i++, x += 8) {
-        float x0 = x[0];
-        float x1 = x[1];
-        float x2 = x[2];
-        float x3 = x[3];
-        float x4 = x[4];
-        float x5 = x[5];
-        float x6 = x[6];
-        float x7 = x[7];
-        float  xt = x0 - x7;
-        x0 += x7;
-        x7 = x1 - x6;
-        x1 += x6;
-        x6 = x2 - x5;
-        x2 += x5;
-        x5 = x3 - x4;
-        x3 += x4;
-        x4 = x0 - x3;
-        x0 += x3;
-        x3 = x1 - x2;
-        x1 += x2;
-        x[0] = x0 + x1;
-        x[4] = (x0 - x1) * 0.70710677f;
-        x5 =  x5 + x6;
-        x6 = (x6 + x7) * 0.70710677f;
-        x7 =  x7 + xt;
-        x3 = (x3 + x4) * 0.70710677f;
-        x5 -= x7 * 0.198912367f;  /* rotate by PI/8 */
-        x7 += x5 * 0.382683432f;
-        x5 -= x7 * 0.198912367f;
-        x0 = xt - x6; xt += x6;
-        x[1] = (xt + x7) * 0.50979561f;
-        x[2] = (x4 + x3) * 0.54119611f;
-        x[3] = (x0 - x5) * 0.60134488f;
-        x[5] = (x0 + x5) * 0.89997619f;
-        x[6] = (x4 - x3) * 1.30656302f;
-        x[7] = (xt - x7) * 2.56291556f;
-        }
+    int32_t i = 0;
+    for (; i < n - 7; i += 8)
+      _mm256_storeu_ps (pcm + i, _mm256_mul_ps (_mm256_loadu_ps (pcm + i), _mm256_set1_ps (1.f / 0x8000)));
 
-      for (int32_t i = 0; i < 7; i++, y += 4*18) {
-        y[0*18] = t[0][i];
-        y[1*18] = t[2][i] + t[3][i] + t[3][i + 1];
-        y[2*18] = t[1][i] + t[1][i + 1];
-        y[3*18] = t[2][i + 1] + t[3][i] + t[3][i + 1];
-        }
+    scalePcmScalar (pcm + i, n - i);
+    }
+  //}}}
+  //{{{
+  MP3_AVX2_TARGET void packPcmAvx2 (int16_t* dst, const float* src, int32_t n) {
+  // 16 samples a store, pack interleaves the 128 bit lanes, permute puts them back in order
 
-      y[0*18] = t[0][7];
-      y[1*18] = t[2][7] + t[3][7];
-      y[2*18] = t[1][7];
-      y[3*18] = t[3][7];
+    int32_t i = 0;
+    for (; i < n - 15; i += 16) {
+      __m256i lo = _mm256_cvttps_epi32 (_mm256_add_ps (
+        _mm256_min_ps (_mm256_max_ps (_mm256_loadu_ps (src + i), _mm256_set1_ps (-32768.f)), _mm256_set1_ps (32768.f)),
+        _mm256_set1_ps (.5f)));
+      __m256i hi = _mm256_cvttps_epi32 (_mm256_add_ps (
+        _mm256_min_ps (_mm256_max_ps (_mm256_loadu_ps (src + i + 8), _mm256_set1_ps (-32768.f)), _mm256_set1_ps (32768.f)),
+        _mm256_set1_ps (.5f)));
+      lo = _mm256_add_epi32 (lo, _mm256_srai_epi32 (lo, 31));
+      hi = _mm256_add_epi32 (hi, _mm256_srai_epi32 (hi, 31));
+      _mm256_storeu_si256 ((__m256i*)(dst + i), _mm256_permute4x64_epi64 (_mm256_packs_epi32 (lo, hi), 0xD8));
       }
+
+    packPcmSse2 (dst + i, src + i, n - i);
+    }
+  //}}}
+
+#elif defined(MP3_NEON)
+  //{{{
+  inline int32x4_t roundNeon (float32x4_t sample) {
+  // clamped, + .5 and -1 if negative rounds as packPcmScalar
+
+    int32x4_t s = vcvtq_s32_f32 (vaddq_f32 (vminq_f32 (vmaxq_f32 (sample, vdupq_n_f32 (-32768.f)),
+                                                       vdupq_n_f32 (32768.f)), vdupq_n_f32 (.5f)));
+    return vaddq_s32 (s, vshrq_n_s32 (s, 31));
     }
   //}}}
   //{{{
-  void synth (float* qmfState, float* granuleBuf, int32_t numBands, int32_t numChannels, float* pcm, float* lins) {
+  void scalePcmNeon (float* pcm, int32_t n) {
 
-    for (int32_t channel = 0; channel < numChannels; channel++)
-      dctII (granuleBuf + 576 * channel, numBands);
+    int32_t i = 0;
+    for (; i < n - 3; i += 4)
+      vst1q_f32 (pcm + i, vmulq_n_f32 (vld1q_f32 (pcm + i), 1.f / 0x8000));
 
-    memcpy (lins, qmfState, 15 * 64 * sizeof(float));
+    scalePcmScalar (pcm + i, n - i);
+    }
+  //}}}
+  //{{{
+  void packPcmNeon (int16_t* dst, const float* src, int32_t n) {
+  // 8 samples a store, saturating narrow
 
-    for (int32_t band = 0; band < numBands; band += 2)
-      synthBand (granuleBuf + band, pcm + 32 * numChannels * band, numChannels, lins + band * 64);
+    int32_t i = 0;
+    for (; i < n - 7; i += 8)
+      vst1q_s16 (dst + i, vcombine_s16 (vqmovn_s32 (roundNeon (vld1q_f32 (src + i))),
+                                        vqmovn_s32 (roundNeon (vld1q_f32 (src + i + 4)))));
 
-    memcpy (qmfState, lins + numBands * 64, 15 * 64 * sizeof(float));
+    packPcmScalar (dst + i, src + i, n - i);
     }
   //}}}
 #endif
 
+//{{{
+void synthPair (float* pcm, int32_t sampleStride, const float* z) {
+
+  float a = (z[14*64] - z[0]) * 29;
+  a += (z[1*64] + z[13*64]) * 213;
+  a += (z[12*64] - z[2*64]) * 459;
+  a += (z[3*64] + z[11*64]) * 2037;
+  a += (z[10*64] - z[4*64]) * 5153;
+  a += (z[5*64] + z[9*64]) * 6574;
+  a += (z[8*64] - z[6*64]) * 37489;
+  a +=  z[7*64] * 75038;
+  *pcm = a;
+
+  z += 2;
+  a  = z[14*64] * 104;
+  a += z[12*64] * 1567;
+  a += z[10*64] * 9727;
+  a += z[8*64] * 64019;
+  a += z[6*64] * -9975;
+  a += z[4*64] * -45;
+  a += z[2*64] * 146;
+  a += z[0*64] * -5;
+  pcm[16 * sampleStride] = a;
+  }
+//}}}
+//{{{
+void synthBand (const cMp3Decoder::sKernels* kernels, float* xLeft, float* dstLeft, int32_t numChannels,
+                int32_t channelStride, int32_t sampleStride, float* lins) {
+// one band pair to int16 scaled float, interleaved or planar pcm
+// - interleaved: channelStride 1, sampleStride numChannels
+// - planar:      channelStride numSamples, sampleStride 1
+
+  float* xRight = xLeft + 576 * (numChannels - 1);
+  float* dstRight = dstLeft + (numChannels - 1) * channelStride;
+
+  float* zlin = lins + 15 * 64;
+
+  zlin [4*15] = xLeft[18*16];
+  zlin [4*15 + 1] = xRight[18 * 16];
+  zlin [4*15 + 2] = xLeft[0];
+  zlin [4*15 + 3] = xRight[0];
+
+  zlin [4*31] = xLeft[1 + 18 * 16];
+  zlin [4*31 + 1] = xRight[1 + 18 * 16];
+  zlin [4*31 + 2] = xLeft[1];
+  zlin [4*31 + 3] = xRight[1];
+
+  synthPair (dstRight, sampleStride, lins + 4*15 + 1);
+  synthPair (dstRight + 32*sampleStride, sampleStride, lins + 4*15 + 64 + 1);
+  synthPair (dstLeft, sampleStride, lins + 4*15);
+  synthPair (dstLeft + 32*sampleStride, sampleStride, lins + 4*15 + 64);
+
+  // row i of the window only reads what row i writes, so all rows load before the window kernel
+  for (int32_t i = 14; i >= 0; i--) {
+    zlin[4*i] = xLeft[18 * (31 - i)];
+    zlin[4*i + 1] = xRight[18 * (31 - i)];
+    zlin[4*i + 2] = xLeft[1 + 18 * (31 - i)];
+    zlin[4*i + 3] = xRight[1 + 18 * (31 - i)];
+    zlin[4*(i+16)]   = xLeft[1 + 18 * (1 + i)];
+    zlin[4*(i+16) + 1] = xRight[1 + 18 * (1 + i)];
+    zlin[4*(i-16) + 2] = xLeft[18 * (1 + i)];
+    zlin[4*(i-16) + 3] = xRight[18 * (1 + i)];
+    }
+
+  kernels->mSynthWindow (zlin, dstLeft, dstRight, sampleStride);
+  }
+//}}}
+//{{{
+void synth (const cMp3Decoder::sKernels* kernels, float* qmfState, float* granuleBuf, int32_t numBands,
+            int32_t numChannels, int32_t channelStride, int32_t sampleStride, float* pcm, float* lins) {
+
+  for (int32_t channel = 0; channel < numChannels; channel++)
+    kernels->mDctII (granuleBuf + 576 * channel, numBands);
+
+  memcpy (lins, qmfState, 15 * 64 * sizeof(float));
+
+  for (int32_t band = 0; band < numBands; band += 2)
+    synthBand (kernels, granuleBuf + band, pcm + 32 * sampleStride * band, numChannels, channelStride, sampleStride,
+               lins + band * 64);
+
+  memcpy (qmfState, lins + numBands * 64, 15 * 64 * sizeof(float));
+  }
+//}}}
+
+//{{{
+static const cMp3Decoder::sKernels* getKernels (cMpeg2mc::eIsa isa) {
+// return kernels for isa, nullptr if not built for this target or not on this cpu
+// - avx2 widens the synth window and pcm out, the layer 3 stages and dctII stay sse2
+
+  static const cMp3Decoder::sKernels kScalar = {
+    "scalar", midsideStereoL3Scalar, antialiasL3Scalar, imdct36L3Scalar,
+    dctIIScalar, synthWindowScalar, scalePcmScalar, packPcmScalar };
+#if defined(MP3_SSE2)
+  static const cMp3Decoder::sKernels kSse2 = {
+    "sse2", midsideStereoL3Simd, antialiasL3Simd, imdct36L3Simd,
+    dctIISimd, synthWindowSimd, scalePcmSse2, packPcmSse2 };
+  static const cMp3Decoder::sKernels kAvx2 = {
+    "avx2", midsideStereoL3Simd, antialiasL3Simd, imdct36L3Simd,
+    dctIISimd, synthWindowAvx2, scalePcmAvx2, packPcmAvx2 };
+#elif defined(MP3_NEON)
+  static const cMp3Decoder::sKernels kNeon = {
+    "neon", midsideStereoL3Simd, antialiasL3Simd, imdct36L3Simd,
+    dctIISimd, synthWindowSimd, scalePcmNeon, packPcmNeon };
+#endif
+
+  switch (isa) {
+    case cMpeg2mc::eScalar: return &kScalar;
+  #if defined(MP3_SSE2)
+    case cMpeg2mc::eSse2: return &kSse2;
+    case cMpeg2mc::eAvx2: return cMpeg2mc::hasAvx2() ? &kAvx2 : nullptr;
+  #elif defined(MP3_NEON)
+    case cMpeg2mc::eNeon: return &kNeon;
+  #endif
+    default: return nullptr;
+    }
+  }
+//}}}
+
 // public members
 //{{{
 cMp3Decoder::cMp3Decoder() {
+
+  static const sKernels* bestKernels = getKernels (cMpeg2mc::getBestIsa());
+  mKernels = bestKernels;
+
   clear();
   }
 //}}}
 //{{{
+bool cMp3Decoder::setIsa (cMpeg2mc::eIsa isa) {
+// select kernels, false leaves them unchanged if isa not available on this cpu
+
+  auto kernels = getKernels (isa);
+  if (!kernels)
+    return false;
+
+  mKernels = kernels;
+  return true;
+  }
+//}}}
+//{{{
+const char* cMp3Decoder::getIsaName() {
+  return mKernels->mName;
+  }
+//}}}
+//{{{
 float* cMp3Decoder::decodeFrame (const uint8_t* framePtr, int frameLen, int64_t pts) {
+  return decode<float> (framePtr, frameLen, pts);
+  }
+//}}}
+//{{{
+int16_t* cMp3Decoder::decodeFrame16 (const uint8_t* framePtr, int frameLen, int64_t pts) {
+  return decode<int16_t> (framePtr, frameLen, pts);
+  }
+//}}}
+
+// private members
+//{{{
+template <typename tSample> tSample* cMp3Decoder::decode (const uint8_t* framePtr, int frameLen, int64_t pts) {
 
   auto timePoint = std::chrono::system_clock::now();
 
@@ -1635,27 +1840,20 @@ float* cMp3Decoder::decodeFrame (const uint8_t* framePtr, int frameLen, int64_t
   mSampleRate = headerSampleRate (mHeader);
   mNumSamples = headerNumSamples (mHeader);
 
-  float* outBuffer = nullptr;
+  // interleaved or planar pcm layout
+  int32_t channelStride = mPlanar ? mNumSamples : 1;
+  int32_t sampleStride = mPlanar ? 1 : mNumChannels;
+
+  tSample* outBuffer = nullptr;
   if (layer == 3) {
     //{{{  layer 3 decode
     // parse fixed readSideInfo from frameBitStream
     int32_t needReservoirBytes = readSideInfoL3 (mHeader, &frameBitStream, mGranules);
 
-    if (frameNum && (frameNum != mLastFrameNum + 1)) {
-      //{{{  jump, no decode unless reservoirBytesNeeded = 0 ???
-      cLog::log (LOGINFO, "mp3 jump %d to %d", mLastFrameNum, frameNum);
-      mNumSamples = 0;
-      }
-      //}}}
-    else if (restoreReservoir (&frameBitStream, needReservoirBytes)) {
-      outBuffer = (float*)malloc (mNumSamples * mNumChannels * sizeof(float));
-      #ifdef USE_INTRINSICS
-        // !!!! remove int16_t !!!
-        int16_t samples16 [2048*2];
-        int16_t* pcm = samples16;
-      #else
-        float* pcm = outBuffer;
-      #endif
+    // after a seek, reservoir is primed by decoding cAudioFrameIndex skipFrames first
+    if (restoreReservoir (&frameBitStream, needReservoirBytes)) {
+      outBuffer = (tSample*)malloc (mNumSamples * mNumChannels * sizeof(tSample));
+      float* pcm = getSynthBuf (outBuffer);
 
       for (int32_t granuleIndex = 0; granuleIndex < (HDR_TEST_MPEG1 (mHeader) ? 2 : 1); granuleIndex++) {
         struct sGranule* granule = mGranules + (granuleIndex * mNumChannels);
@@ -1667,9 +1865,9 @@ float* cMp3Decoder::decodeFrame (const uint8_t* framePtr, int frameLen, int64_t
           }
 
         if (HDR_TEST_I_STEREO (mHeader))
-          intensityStereoL3 (mGranuleBuf[0], mIstPos[1], granule, mHeader);
+          intensityStereoL3 (mKernels, mGranuleBuf[0], mIstPos[1], granule, mHeader);
         else if (HDR_IS_MS_STEREO (mHeader))
-          midsideStereoL3 (mGranuleBuf[0], 576);
+          mKernels->mMidside (mGranuleBuf[0], 576);
 
         for (int32_t channel = 0; channel < mNumChannels; channel++, granule++) {
           int32_t aaBands = 31;
@@ -1679,23 +1877,14 @@ float* cMp3Decoder::decodeFrame (const uint8_t* framePtr, int frameLen, int64_t
             reorderL3 (mGranuleBuf[channel] + numLongBands * 18, mSyn[0], granule->sfbtab + granule->numLongSfb);
             }
 
-          antialiasL3 (mGranuleBuf[channel], aaBands);
-          imdctGranuleL3 (mGranuleBuf[channel], mMdctOverlap[channel], granule->blockType, numLongBands);
+          mKernels->mAntialias (mGranuleBuf[channel], aaBands);
+          imdctGranuleL3 (mKernels, mGranuleBuf[channel], mMdctOverlap[channel], granule->blockType, numLongBands);
           changeSignL3 (mGranuleBuf[channel]);
           }
 
-        synth (mQmfState, mGranuleBuf[0], 18, mNumChannels, pcm, mSyn[0]);
-        pcm += 576 * mNumChannels;
+        synth (mKernels, mQmfState, mGranuleBuf[0], 18, mNumChannels, channelStride, sampleStride, pcm, mSyn[0]);
+        pcm += 576 * sampleStride;
         }
-
-      #ifdef USE_INTRINSICS
-        //{{{  convert 16bit to 32bit float
-        float* dstPtr = outBuffer;
-        int16_t* srcPtr = samples16;
-        for (int32_t sample = 0; sample < mNumSamples * mNumChannels; sample++)
-          *dstPtr++ = *srcPtr++ / (float)0x8000;
-        //}}}
-      #endif
       }
     else // not enough bytes in reservoir to decode
       mNumSamples = 0;
@@ -1703,18 +1892,12 @@ float* cMp3Decoder::decodeFrame (const uint8_t* framePtr, int frameLen, int64_t
     // save unused bitStream to reservoir, if decode abandoned far too much but gets lost on restore
     // - needs reservoir size = maxReservoir + maxPacket
     saveReservoir();
-    mLastFrameNum = frameNum;
     }
     //}}}
   else {
     //{{{  layer 12 decode
-    outBuffer = (float*)malloc (mNumSamples * mNumChannels * sizeof(float));
-    #ifdef USE_INTRINSICS
-      int16_t samples16 [2048*2];
-      int16_t* pcm = samples16;
-    #else
-      float* pcm = outBuffer;
-    #endif
+    outBuffer = (tSample*)malloc (mNumSamples * mNumChannels * sizeof(tSample));
+    float* pcm = getSynthBuf (outBuffer);
 
     sScaleInfo scaleInfo;
     readScaleInfoL12 (mHeader, &frameBitStream, &scaleInfo);
@@ -1738,9 +1921,9 @@ float* cMp3Decoder::decodeFrame (const uint8_t* framePtr, int frameLen, int64_t
           scf += 6;
           }
 
-        synth (mQmfState, mGranuleBuf[0], 12, mNumChannels, pcm, mSyn[0]);
+        synth (mKernels, mQmfState, mGranuleBuf[0], 12, mNumChannels, channelStride, sampleStride, pcm, mSyn[0]);
         memset (mGranuleBuf[0], 0, 576 * 2 * sizeof(float));
-        pcm += 384 * mNumChannels;
+        pcm += 384 * sampleStride;
         }
 
       if (frameBitStream.getPosition() > frameBitStream.getLimit()) {
@@ -1750,17 +1933,13 @@ float* cMp3Decoder::decodeFrame (const uint8_t* framePtr, int frameLen, int64_t
         return nullptr;
         }
       }
-
-    #ifdef USE_INTRINSICS
-      float* dstPtr = outBuffer;
-      int16_t* srcPtr = samples16;
-      for (int32_t sample = 0; sample < mNumSamples * 2; sample++)
-        *dstPtr++ = *srcPtr++ / (float)0x8000;
-    #endif
     }
     //}}}
 
   if (outBuffer) {
+    // scale or pack the int16 scaled synth output in one pass
+    storePcm (outBuffer, mNumSamples * mNumChannels);
+
     auto took = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now() - timePoint);
     cLog::log (mNumSamples ? LOGINFO1 : LOGERROR, "mp3:%d %4d:%3dk %dx%d@%dhz rsvr:%3d %3dus",
                layer, frameLen, bitrate_kbps, mNumSamples, mNumChannels, mSampleRate,
@@ -1770,8 +1949,29 @@ float* cMp3Decoder::decodeFrame (const uint8_t* framePtr, int frameLen, int64_t
   return outBuffer;
   }
 //}}}
+//{{{
+float* cMp3Decoder::getSynthBuf (float* outBuffer) {
+// float synthesizes straight into the output
+  return outBuffer;
+  }
+//}}}
+//{{{
+float* cMp3Decoder::getSynthBuf (int16_t* outBuffer) {
+  (void)outBuffer;
+  return mSynthBuf;
+  }
+//}}}
+//{{{
+void cMp3Decoder::storePcm (float* outBuffer, int32_t numSamples) {
+  mKernels->mScalePcm (outBuffer, numSamples);
+  }
+//}}}
+//{{{
+void cMp3Decoder::storePcm (int16_t* outBuffer, int32_t numSamples) {
+  mKernels->mPackPcm (outBuffer, mSynthBuf, numSamples);
+  }
+//}}}
 
-// private members
 //{{{
 void cMp3Decoder::clear() {
 
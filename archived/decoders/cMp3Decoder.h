@@ -1,6 +1,7 @@
 // cMp3Decoder.h
 #pragma once
 #include "iAudioDecoder.h"
+#include "cMpeg2mc.h"
 
 //{{{  defines
 #define MAX_FREE_FORMAT_FRAME_SIZE  2304  // more than ISO spec's
@@ -109,14 +110,28 @@ public:
   cMp3Decoder();
   ~cMp3Decoder() {}
 
+  // simd kernels, best for this cpu unless setIsa, false if isa not available
+  struct sKernels;
+  bool setIsa (cMpeg2mc::eIsa isa);
+  const char* getIsaName();
+
   int32_t getNumChannels() { return mNumChannels; }
   int32_t getSampleRate() { return mSampleRate; }
   int32_t getNumSamplesPerFrame() { return mNumSamples; }
 
+  // decodeFrame returns interleaved samples unless planar, float or saturated int16
+  void setPlanar (bool planar) { mPlanar = planar; }
+
   float* decodeFrame (const uint8_t* framePtr, int frameLen, int64_t pts);
+  int16_t* decodeFrame16 (const uint8_t* framePtr, int frameLen, int64_t pts);
 
 private:
   // private members
+  template <typename tSample> tSample* decode (const uint8_t* framePtr, int frameLen, int64_t pts);
+  float* getSynthBuf (float* outBuffer);
+  float* getSynthBuf (int16_t* outBuffer);
+  void storePcm (float* outBuffer, int32_t numSamples);
+  void storePcm (int16_t* outBuffer, int32_t numSamples);
   void clear();
   void saveReservoir();
   bool restoreReservoir (class cBitStream* bitStream, int32_t needReservoirBytes);
@@ -125,6 +140,8 @@ private:
   int32_t mNumChannels = 0;
   int32_t mSampleRate = 0;
   int32_t mNumSamples = 0;
+  bool mPlanar = false;
+  const sKernels* mKernels = nullptr;
 
   struct sGranule mGranules [4];
   float mGranuleBuf [2][576];
@@ -134,6 +151,7 @@ private:
 
   float mScf [40];
   float mSyn [18+15][2*32];
+  float mSynthBuf [MINIMP3_MAX_SAMPLES_PER_FRAME]; // int16 scaled synth output for decodeFrame16
   uint8_t mIstPos [2][39];
 
   uint8_t mHeader[4];
@@ -142,5 +160,4 @@ private:
   int32_t mSavedReservoirBytes = 0;
   uint8_t mReservoirBuf [MAX_BITRESERVOIR_BYTES + MAX_L3_FRAME_PAYLOAD_BYTES];
 
-  int32_t mLastFrameNum = -1;
   };
@@ -3,10 +3,25 @@
 #define _CRT_SECURE_NO_WARNINGS
 #include <stdio.h>
 #include <stdlib.h>
-#include <ctype.h>
-#include <fcntl.h>
-#include <io.h>
-#include "../video/cYuvFrame.h"
+#include <stdint.h>
+#include <string.h>
+#ifdef _WIN32
+  #include <malloc.h>
+#endif
+
+#include <vector>
+#include <deque>
+#include <map>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <chrono>
+#include <climits>
+
+#include "cMpeg2idct.h"
 //}}}
 //{{{  const
 #define SLICE_START_CODE_MIN     0x101
@@ -457,176 +472,197 @@ static const DCTtab DCTtab6[16] =
   {30,1,16}, {29,1,16}, {28,1,16}, {27,1,16}
 };
 //}}}
-
-//{{{
-static __declspec(align(64)) const int16_t sse2_tab_i_04[] = {
-  16384, 21407, 16384,  8867, 16384, -8867, 16384,-21407,  // w05 w04 w01 w00 w13 w12 w09 w08
-  16384,  8867,-16384,-21407,-16384, 21407, 16384, -8867,  // w07 w06 w03 w02 w15 w14 w11 w10
-  22725, 19266, 19266, -4520, 12873,-22725,  4520,-12873,
-  12873,  4520,-22725,-12873,  4520, 19266, 19266,-22725 };
 //}}}
+#define maxVidFrames 40
+
 //{{{
-static __declspec(align(64)) const int16_t sse2_tab_i_17[] = {
-  22725, 29692, 22725, 12299, 22725,-12299, 22725,-29692,
-  22725, 12299,-22725,-29692,-22725, 29692, 22725,-12299,
-  31521, 26722, 26722, -6270, 17855,-31521,  6270,-17855,
-  17855,  6270,-31521,-17855,  6270, 26722, 26722,-31521 };
+inline void* mpeg2AlignedMalloc (size_t size, size_t alignment) {
+
+#ifdef _WIN32
+  return _aligned_malloc (size, alignment);
+#else
+  void* ptr = nullptr;
+  return posix_memalign (&ptr, alignment, size) ? nullptr : ptr;
+#endif
+  }
 //}}}
 //{{{
-static __declspec(align(64)) const int16_t sse2_tab_i_26[] = {
-  21407, 27969, 21407, 11585, 21407,-11585, 21407,-27969,
-  21407, 11585,-21407,-27969,-21407, 27969, 21407,-11585,
-  29692, 25172, 25172, -5906, 16819,-29692,  5906,-16819,
-  16819,  5906,-29692,-16819,  5906, 25172, 25172,-29692 };
+inline void mpeg2AlignedFree (void* ptr) {
+
+#ifdef _WIN32
+  _aligned_free (ptr);
+#else
+  free (ptr);
+#endif
+  }
 //}}}
 //{{{
-static __declspec(align(64)) const int16_t sse2_tab_i_35[] = {
-  19266, 25172, 19266, 10426, 19266,-10426, 19266,-25172,
-  19266, 10426,-19266,-25172,-19266, 25172, 19266,-10426,
-  26722, 22654, 22654, -5315, 15137,-26722,  5315,-15137,
-  15137,  5315,-26722,-15137,  5315, 22654, 22654,-26722 };
-//}}}
-//}}}
-static uint8_t* Clip;
-#define maxVidFrames 40
-
-class cMpeg2decoder {
+class cMpeg2frame {
+// refcounted picture buffer, rows of decoded macroblocks signalled for frame threaded motion compensation
+// - output frames are handed to consumers as views, released back to the decoder pool when done
 public:
   //{{{
-  cMpeg2decoder() {
-
-    if (!Clip) {
-      Clip = (uint8_t*)malloc(1024);
-      Clip += 384;
-      for (int i = -384; i < 640; i++)
-        Clip[i] = (i < 0) ? 0 : ((i > 255) ? 255 : i);
-      }
+  cMpeg2frame (int width, int height) : mWidth(width), mHeight(height) {
 
-    mBlock[0] = (int16_t*)_aligned_malloc (128 * sizeof(int16_t) * 6, 128);
-    for (int i = 1; i < 6; i++)
-      mBlock[i] = mBlock[i-1] + 128;
+    mLinesize[0] = width;
+    mLinesize[1] = width/2;
 
+    // guard line either side, reduced resolution prediction can round a pel outside the plane
+    int guard = (width + 16 + 127) & ~127;
     for (int i = 0; i < 3; i++) {
-      mAuxFrame[i] = nullptr;
-      mCurrentFrame[i] = nullptr;
-      mForwardRefFrame[i] = nullptr;
-      mBackwardRefFrame[i] = nullptr;
+      mAlloc[i] = (uint8_t*)mpeg2AlignedMalloc ((i ? (width/2) * (height/2) : width * height) + 2 * guard, 128);
+      mPlanes[i] = mAlloc[i] + guard;
       }
     }
   //}}}
   //{{{
-  ~cMpeg2decoder() {
+  ~cMpeg2frame() {
 
-    for (int i = 0; i < 3; i++) {
-      _aligned_free (mBackwardRefFrame[i]);
-      _aligned_free (mForwardRefFrame[i]);
-      _aligned_free (mAuxFrame[i]);
-      }
+    for (int i = 0; i < 3; i++)
+      mpeg2AlignedFree (mAlloc[i]);
+    }
+  //}}}
+
+  //{{{
+  void setRows (int rows) {
+  // rows of macroblocks decoded, wakes anyone waiting on them
 
-    _aligned_free (mBlock[0]);
+    std::unique_lock<std::mutex> lock (mRowsMutex);
+    if (rows > mRows) {
+      mRows = rows;
+      mRowsCond.notify_all();
+      }
     }
   //}}}
   //{{{
-  cYuvFrame* getYuvFrame (int i) {
-    return &mYuvFrames[i];
+  void waitRows (int rows) {
+
+    std::unique_lock<std::mutex> lock (mRowsMutex);
+    mRowsCond.wait (lock, [&]() { return mRows >= rows; });
     }
   //}}}
+
+  // output view, pts and pictureType set when frame is decoded, frameNum when it is output
+  uint64_t getPts() { return mPts; }
+  int getFrameNum() { return mFrameNum; }
+  int getWidth() { return mWidth; }
+  int getHeight() { return mHeight; }
+  uint8_t** getPlanes() { return mPlanes; }
+  int32_t* getLinesize() { return mLinesize; }
+  int getPictureType() { return mPictureType; }
+  int getPesSize() { return mPesSize; }
+
+  uint8_t* mPlanes[3];
+
+private:
+  friend class cMpeg2framePool;
+  friend class cMpeg2decoder;
+
+  const int mWidth;
+  const int mHeight;
+  int32_t mLinesize[2];
+  uint8_t* mAlloc[3];
+
+  uint64_t mPts = 0;
+  int mFrameNum = 0;
+  int mPictureType = 0;
+  int mPesSize = 0;
+
+  int mRefCount = 0; // guarded by pool mutex
+  int mRows = 0;
+
+  std::mutex mRowsMutex;
+  std::condition_variable mRowsCond;
+  };
+//}}}
+//{{{
+class cMpeg2framePool {
+// fixed set of frames, acquire waits for a frame to be released, bounds pictures in flight
+public:
+  ~cMpeg2framePool() { free(); }
+
   //{{{
-  cYuvFrame* getNearestVidFrame (uint64_t pts) {
-  // find nearestVidFrame to pts
-  // - can return nullPtr if no frame loaded yet
+  void allocate (int numFrames, int width, int height) {
 
-    cYuvFrame* yuvFrame = nullptr;
+    free();
+    for (int i = 0; i < numFrames; i++)
+      mFrames.push_back (new cMpeg2frame (width, height));
+    }
+  //}}}
 
-    int64_t nearest = 0;
-    for (int i = 0; i < maxVidFrames; i++) {
-      if (mYuvFrames[i].mPts) {
-        int64_t absDiff = mYuvFrames[i].mPts < pts ? pts - mYuvFrames[i].mPts : mYuvFrames[i].mPts - pts;
-        if (!yuvFrame || (absDiff < nearest)) {
-          yuvFrame = &mYuvFrames[i];
-          nearest = absDiff;
+  //{{{
+  cMpeg2frame* acquire (std::chrono::milliseconds timeout) {
+  // nullptr after timeout, consumers can hold every frame
+
+    auto until = std::chrono::steady_clock::now() + timeout;
+
+    std::unique_lock<std::mutex> lock (mMutex);
+    while (true) {
+      for (auto frame : mFrames)
+        if (!frame->mRefCount) {
+          frame->mRefCount = 1;
+          frame->mRows = 0;
+          return frame;
           }
-        }
+      if (mReleased.wait_until (lock, until) == std::cv_status::timeout)
+        return nullptr;
       }
-    return yuvFrame;
     }
   //}}}
   //{{{
-  void invalidateFrames() {
+  cMpeg2frame* addRef (cMpeg2frame* frame) {
 
-    for (auto i= 0; i < maxVidFrames; i++)
-      mYuvFrames[i].invalidate();
-
-    mLoadVidFrame = 0;
+    if (frame) {
+      std::unique_lock<std::mutex> lock (mMutex);
+      frame->mRefCount++;
+      }
+    return frame;
     }
   //}}}
   //{{{
-  bool decodePes (uint8_t* pesBuffer, uint8_t* pesBufferEnd, uint64_t vidPts, uint8_t*& pesPtr) {
-  // decode a frame of video, usually a pes packet
+  void release (cMpeg2frame* frame) {
 
-    mBufferPtr = pesBuffer;
-    mBufferEnd = pesBufferEnd;
-    pesPtr = pesBuffer;
+    if (frame) {
+      std::unique_lock<std::mutex> lock (mMutex);
+      if (--frame->mRefCount == 0)
+        mReleased.notify_all();
+      }
+    }
+  //}}}
 
-    m32bits = 0;
-    mBitCount = 0;
-    consumeBits (0);
+private:
+  //{{{
+  void free() {
 
-    if (!mGotSequenceHeader)
-      while (mBufferPtr < mBufferEnd)
-        if (getHeader (false) == 0x1B3) { // sequenceHeaderCode
-          //{{{  allocate buffers from sequenceHeader width, height
-          for (int i = 0; i < 3; i++) {
-            int size = (i == 0) ? mWidth * mHeight : mChromaWidth * mChromaHeight;
-            mAuxFrame[i] = (uint8_t*)_aligned_malloc (size, 128);
-            mForwardRefFrame[i] = (uint8_t*)_aligned_malloc (size, 128);
-            mBackwardRefFrame[i] = (uint8_t*)_aligned_malloc (size, 128);
-            }
-          mGotSequenceHeader = true;
-          //}}}
-          break;
-          }
+    for (auto frame : mFrames)
+      delete frame;
+    mFrames.clear();
+    }
+  //}}}
 
-    while (mBufferPtr < mBufferEnd)
-      if (getHeader (true) == 0x100) // pictureStartCode
-        break;
+  std::mutex mMutex;
+  std::condition_variable mReleased;
+  std::vector<cMpeg2frame*> mFrames;
+  };
+//}}}
 
-    if (mBufferPtr < mBufferEnd) {
-      //{{{  updatePictureBuffers description
-      // B pics do not need to be save for future reference
-      // the previously decoded reference frame is stored coincident with the location where the backward
-      // reference frame is stored (backwards prediction is not needed in P pictures)
-      // update pointer for potential future B pictures
-      // can erase over old backward reference frame since it is not used in a P picture
-      // - since any subsequent B pictures will use the previously decoded I or P frame as the backward_reference_frame
-      //}}}
-      for (int i = 0; i < 3; i++)
-        if (mPictureCodingType == B_TYPE)
-          mCurrentFrame[i] = mAuxFrame[i];
-        else {
-          uint8_t* tmp = mForwardRefFrame[i];
-          mForwardRefFrame[i] = mBackwardRefFrame[i];
-          mBackwardRefFrame[i] = tmp;
-          mCurrentFrame[i] = mBackwardRefFrame[i];
-          }
+//{{{
+class cMpeg2bitStream {
+// bitStream reader, decoder parses headers with one, each slice decoder has its own
+public:
+  //{{{
+  void setBuffer (uint8_t* buffer, uint8_t* bufferEnd) {
 
-      decodeSlices();
+    mBufferPtr = buffer;
+    mBufferEnd = bufferEnd;
 
-      // reorderFrames write or display current or previously decoded reference frame
-      int32_t linesize[2] = { mWidth,  mChromaWidth};
-      mYuvFrames[mLoadVidFrame % maxVidFrames].set (vidPts,
-        (mPictureCodingType == B_TYPE) ? mAuxFrame : mForwardRefFrame, linesize,
-        mWidth, mHeight, (int)(pesBufferEnd - pesBuffer), mPictureCodingType);
-      mLoadVidFrame++;
-      pesPtr = mBufferPtr - 4;
-      return true;
-      }
-    else
-      return false;
+    m32bits = 0;
+    mBitCount = 0;
+    consumeBits (0);
     }
   //}}}
 
-private:
+protected:
   //{{{
   void consumeBits (int8_t numBits) {
 
@@ -663,88 +699,164 @@ private:
     }
   //}}}
 
+  //{{{  vars
+  int8_t mBitCount = 0;
+  uint32_t m32bits = 0;
+  uint8_t* mBufferPtr = NULL;
+  uint8_t* mBufferEnd = NULL;
+  //}}}
+  };
+//}}}
+//{{{
+struct sMpeg2picture {
+// sequence and picture header state, copied to each slice decoder before decoding slices
   //{{{
-  void picture_coding_extension() {
-
-    mFcode[0][0] = getBits(4);
-    mFcode[0][1] = getBits(4);
-    mFcode[1][0] = getBits(4);
-    mFcode[1][1] = getBits(4);
+  void setFrames (cMpeg2frame* current, cMpeg2frame* forward, cMpeg2frame* backward) {
 
-    mIntraDcPrecision      = getBits(2);
-    auto picture_structure = getBits(2);
-    auto top_field_first   = getBits(1);
-    mFramePredFrameDct     = getBits(1);
-    mConcealmentMotionVecs = getBits(1);
-    qScaleType             = getBits(1);
-    mIntraVlcFormat        = getBits(1);
-    mAlternateScan         = getBits(1);
+    mCurrent = current;
+    mForward = forward;
+    mBackward = backward;
+    for (int i = 0; i < 3; i++) {
+      mCurrentFrame[i] = current ? current->mPlanes[i] : nullptr;
+      mForwardRefFrame[i] = forward ? forward->mPlanes[i] : nullptr;
+      mBackwardRefFrame[i] = backward ? backward->mPlanes[i] : nullptr;
+      }
     }
   //}}}
+
+  // refcounted frames behind plane pointers
+  cMpeg2frame* mCurrent = nullptr;
+  cMpeg2frame* mForward = nullptr;
+  cMpeg2frame* mBackward = nullptr;
+  bool mFrameThreaded = false;
+
+  uint8_t* mCurrentFrame[3] = { nullptr, nullptr, nullptr };
+  uint8_t* mForwardRefFrame[3] = { nullptr, nullptr, nullptr };
+  uint8_t* mBackwardRefFrame[3] = { nullptr, nullptr, nullptr };
+
+  // pic size
+  int mWidth = 0;
+  int mHeight = 0;
+  int mChromaWidth = 0;
+  int mChromaHeight = 0;
+  int mMbWidth = 0;
+  int mMbHeight = 0;
+
+  // header values
+  int mTemporalReference = 0;
+  int mPictureCodingType = 0;
+
+  int qScaleType = 0;
+  int mAlternateScan = 0;
+  int mFcode[2][2];
+  int mIntraDcPrecision = 0;
+  int mFramePredFrameDct = 0;
+  int mConcealmentMotionVecs = 0;
+  int mIntraVlcFormat = 0;
+
+  // reduced resolution decode, frames are mWidth >> mScaleShift by mHeight >> mScaleShift
+  int mScaleShift = 0;
+  };
+//}}}
+//{{{
+class cMpeg2slice : public cMpeg2bitStream, public sMpeg2picture {
+// slice decoder, own bitStream, predictors and block scratch, slices of a picture decode on any thread
+public:
   //{{{
-  void extension_and_user_data() {
-  // decode extension and user data
+  cMpeg2slice() {
 
-    auto code = getStartCode();
-    while (code == EXTENSION_START_CODE || code == USER_DATA_START_CODE) {
-      consumeBits (32);
-      if (code == EXTENSION_START_CODE) {
-        int ext_ID = getBits (4);
-        switch (ext_ID) {
-          case PICTURE_CODING_EXTENSION_ID:
-            picture_coding_extension();
-            break;
-          default:
-            //printf ("reserved extension start code ID %d\n", ext_ID);
-            break;
-          }
-        }
-      // else // userData skip ahead to the next start code
+    mBlock[0] = (int16_t*)mpeg2AlignedMalloc (128 * sizeof(int16_t) * 6, 128);
+    for (int i = 1; i < 6; i++)
+      mBlock[i] = mBlock[i-1] + 128;
 
-      code = getStartCode();
-      }
+    setIsa (cMpeg2mc::getBestIsa());
     }
   //}}}
-  //{{{
-  void sequenceHeader() {
+  ~cMpeg2slice() { mpeg2AlignedFree (mBlock[0]); }
 
-    auto horizontal_size = getBits (12);
-    auto vertical_size = getBits (12);
+  cMpeg2slice (const cMpeg2slice&) = delete;
+  cMpeg2slice& operator = (const cMpeg2slice&) = delete;
 
-    mMbWidth = (horizontal_size + 15) / 16;
-    mMbHeight = 2 * ((vertical_size + 31) / 32);
-    mWidth = 16 * mMbWidth;
-    mHeight = 16 * mMbHeight;
-    mChromaWidth = mWidth >> 1;
-    mChromaHeight = mHeight >> 1;
+  //{{{
+  bool setIsa (cMpeg2mc::eIsa isa) {
+  // select motion compensation and idct kernels, false if isa not available
 
-    extension_and_user_data();
+    auto mc = cMpeg2mc::getKernels (isa);
+    auto idct = cMpeg2idct::getIdct (isa);
+    if (!mc || !idct)
+      return false;
+
+    mMc = mc;
+    mIdct = idct;
+    mIdctScaled = cMpeg2idct::getIdctScaled (isa);
+    return true;
     }
   //}}}
+
   //{{{
-  void pictureHeader() {
+  void decodeSlice (uint8_t* slice, uint8_t* bufferEnd) {
+  // decode slice from its start code, macroblocks up to next start code or end of picture
 
-    mTemporalReference = getBits (10);
-    mPictureCodingType = getBits (3);
-    auto vbv_delay = getBits (16);
+    setBuffer (slice, bufferEnd);
+    auto code = getBits (32);
+    sliceHeader();
 
-    if (mPictureCodingType == P_TYPE || mPictureCodingType == B_TYPE) {
-      auto fullPelForwardVector = getBits(1);
-      auto forwardFcode = getBits(3);
-      }
+    int mbRow = (code & 255) - 1;
+    if (mFrameThreaded)
+      waitRefRows (mbRow);
 
-    if (mPictureCodingType == B_TYPE) {
-      auto fullPelBackwardVector = getBits(1);
-      auto backwardFcode = getBits(3);
+    int dcDctPred[3] = {0,0,0};
+    int PMV[2][2][2] = {0,0,0,0,0,0,0,0};
+
+    // skipped macroBlocks reuse previous macroBlock's type and motion
+    int mBtype = 0, motionType = MC_FRAME, dctType = 0, motionVertField[2][2] = {0,0,0,0};
+
+    // first increment places the slice in its row, not skipped macroblocks, another slice may own those
+    int mbAddress = mbRow * mMbWidth - 1 + std::min (getMacroBlockAddressInc(), mMbWidth);
+    int mbAddressInc = 1;
+    for (; mbAddress < (mMbWidth * mMbHeight); mbAddress++) {
+      if (mbAddressInc == 0) {
+        if (peekBits(23) == 0)
+          break;
+        else
+          mbAddressInc = getMacroBlockAddressInc();
+        }
+
+      if (mbAddressInc == 1)
+        decodeMacroblock (mBtype, motionType, dctType, PMV, dcDctPred, motionVertField);
+      else { // skip macroBlock
+        dcDctPred[0] = dcDctPred[1] = dcDctPred[2] = 0;
+        memset (mBlock[0], 0, 128 * sizeof(int16_t) * 6);
+        if (mPictureCodingType == P_TYPE)
+          PMV[0][0][0] = PMV[0][0][1] = PMV[1][0][0] = PMV[1][0][1] = 0;
+        motionType = MC_FRAME;
+        mBtype &= ~MACROBLOCK_INTRA;
+        }
+
+      motionCompensation (mbAddress, mBtype, motionType, PMV, motionVertField, dctType);
+      mbAddressInc--;
       }
 
-    // consume extraBytes
-    auto Extra_Information_Byte_Count = 0;
-    while (getBits (1)) {
-      consumeBits (8);
-      Extra_Information_Byte_Count++;
+    // frame threaded slices decode in order, rows above where this slice stopped are done
+    if (mFrameThreaded)
+      mCurrent->setRows (mbAddress / mMbWidth);
+    }
+  //}}}
+
+private:
+  //{{{
+  void waitRefRows (int mbRow) {
+  // wait for reference rows this row's motion vectors can reach
+  // - vertical range 16 << (fcode-1) frame lines for field vectors, plus a halfpel line
+
+    if (mPictureCodingType == I_TYPE)
+      return;
+
+    for (int s = 0; s < ((mPictureCodingType == B_TYPE) ? 2 : 1); s++) {
+      int fcode = mFcode[s][1];
+      int rows = ((fcode < 1) || (fcode > 9)) ? mMbHeight : mbRow + 1 + ((16 << (fcode - 1)) + 1 + 15) / 16;
+      (s ? mBackward : mForward)->waitRows (std::min (rows, mMbHeight));
       }
-    extension_and_user_data();
     }
   //}}}
   //{{{
@@ -769,36 +881,6 @@ private:
       }
     }
   //}}}
-  //{{{
-  uint32_t getHeader (bool reportUnexpected) {
-
-    getStartCode();
-    auto code = getBits (32);
-    switch (code) {
-      case 0x100 : // PICTURE_START_CODE:
-        pictureHeader();
-        break;
-
-      case 0x1B3 : // SEQUENCE_HEADER_CODE:
-        sequenceHeader();
-        break;
-
-      case 0x1B7: // SEQUENCE_END_CODE:
-        printf ("getHeader %08x SEQUENCE_END_CODE\n", code);
-        break;
-
-      case 0x1B8 : // GROUP_START_CODE:
-        break;
-
-      default:
-        if (reportUnexpected)
-          printf ("getHeader unexpected %08x\n", code);
-        break;
-      }
-
-    return code;
-    }
-  //}}}
 
   //{{{
   int getMacroBlockType() {
@@ -1256,129 +1338,17 @@ private:
   //*  This implementation design (implicitly different than the spec) was chosen for its elegance. */
   //}}}
 
+    if (mScaleShift) {
+      formPredictionScaled (src, sfield, dfield, lx, lx2, h, x, y, dx, dy, average);
+      return;
+      }
+
+    // luma 16 wide
     int srcOffset = (sfield ? lx2 >> 1 : 0) + lx * (y + (dy >> 1)) + x + (dx >> 1);
-    uint8_t* sY = src[0] + srcOffset;
-    uint8_t* dY = mCurrentFrame[0] + (dfield ? lx2 >> 1 : 0) + lx * y + x;
-    switch ((average << 2) + ((dx & 1) << 1) + (dy & 1)) {
-      //{{{
-      case 0: { // d[i] = s[i];
-        for (int loop = 0; loop < h; loop++) {
-          *(__m128i*)dY = _mm_loadu_si128 ((__m128i*)sY);
-          sY += lx2;
-          dY += lx2;
-          }
-        }
-        break;
-      //}}}
-      //{{{
-      case 1: { // d[i] = (s[i]+s[i+lx]+1)>>1;
-        for (int loop = 0; loop < h; loop++) {
-          *(__m128i*)dY = _mm_avg_epu8 (_mm_loadu_si128((__m128i*)sY), _mm_loadu_si128 ((__m128i*)(sY+lx)));
-          sY += lx2;
-          dY += lx2;
-          }
-        }
-        break;
-      //}}}
-      //{{{
-      case 2: { // d[i] = (s[i]+s[i+1]+1)>>1;
-        for (int loop = 0; loop < h; loop++) {
-          *(__m128i*)dY = _mm_avg_epu8 (_mm_loadu_si128 ((__m128i*)sY), _mm_loadu_si128 ((__m128i*)(sY+1)));
-          sY += lx2;
-          dY += lx2;
-          }
-        }
-        break;
-      //}}}
-      //{{{
-      case 3: { // d[i] = (s[i]+s[i+1]+s[i+lx]+s[i+lx+1]+2)>>2;
-        // (a+b+c+d+2)>>2 = avg(avg(a,b)+avg(c,d)) - (a^b)|(c^d) & avg(a,b)^avg(c,d) & 0x01
-        __m128i shade = _mm_set1_epi8(1);
-        for (int loop = 0; loop < h; loop++) {
-          __m128i pixel1 = _mm_loadu_si128 ((__m128i*)sY);
-          __m128i pixel2 = _mm_loadu_si128 ((__m128i*)(sY + 1));
-          __m128i pixel3 = _mm_loadu_si128 ((__m128i*)(sY + lx));
-          __m128i pixel4 = _mm_loadu_si128 ((__m128i*)(sY + lx + 1));
-
-          __m128i avg12 = _mm_avg_epu8 (pixel1, pixel2);
-          __m128i avg34 = _mm_avg_epu8 (pixel3, pixel4);
-          __m128i avg = _mm_avg_epu8 (avg12, avg34);
-
-          __m128i xor12 = _mm_xor_si128 (pixel1, pixel2);
-          __m128i xor34 = _mm_xor_si128 (pixel3, pixel4);
-          __m128i or1234 = _mm_or_si128 (xor12, xor34);
-          __m128i xoravg = _mm_xor_si128 (avg12, avg34);
-          __m128i offset = _mm_and_si128 (_mm_and_si128(or1234, xoravg), shade);
-
-          *(__m128i*)dY = _mm_sub_epi8 (avg, offset);
-
-          sY += lx2;
-          dY += lx2;
-          }
-        }
-        break;
-      //}}}
-      //{{{
-      case 4: { // d[i] = (s[i]+d[i]+1)>>1;
-        for (int loop = 0; loop < h; loop++) {
-          *(__m128i*)dY = _mm_avg_epu8 (_mm_loadu_si128 ((__m128i*)sY), *(__m128i*)dY);
-          sY += lx2;
-          dY += lx2;
-          }
-        }
-        break;
-      //}}}
-      //{{{
-      case 5: { // d[i] = ((s[i]+s[i+lx]+1)>>1) + d[i] + 1)>>1;
-        for (int loop = 0; loop < h; loop++) {
-          __m128i avg = _mm_avg_epu8 (_mm_loadu_si128 ((__m128i*)sY), _mm_loadu_si128 ((__m128i*)(sY+lx)));
-          *(__m128i*)dY = _mm_avg_epu8 (avg , *(__m128i*)dY);
-          sY += lx2;
-          dY += lx2;
-          }
-        }
-        break;
-      //}}}
-      //{{{
-      case 6: { // d[i] = (((s[i]+s[i+1]+1)>>1) + d[1] + 1)>>1;
-        for (int loop = 0; loop < h; loop++) {
-          __m128i avg = _mm_avg_epu8 (_mm_loadu_si128 ((__m128i*)sY), _mm_loadu_si128 ((__m128i*)(sY+1)));
-          *(__m128i*)dY = _mm_avg_epu8 (avg, *(__m128i*)dY);
-          sY += lx2;
-          dY += lx2;
-          }
-        }
-        break;
-      //}}}
-      //{{{
-      case 7: { // d[i] = (((s[i]+s[i+1]+s[i+lx]+s[i+lx+1]+2)>>2) + d[i] + 1)>>1;
-        __m128i shade = _mm_set1_epi8 (1);
-        for (int loop = 0; loop < h; loop++) {
-          __m128i pixel1 = _mm_loadu_si128 ((__m128i*)sY);
-          __m128i pixel2 = _mm_loadu_si128 ((__m128i*)(sY + 1));
-          __m128i pixel3 = _mm_loadu_si128 ((__m128i*)(sY + lx));
-          __m128i pixel4 = _mm_loadu_si128 ((__m128i*)(sY + lx + 1));
-
-          __m128i avg12 = _mm_avg_epu8 (pixel1, pixel2);
-          __m128i avg34 = _mm_avg_epu8 (pixel3, pixel4);
-          __m128i avg = _mm_avg_epu8 (avg12, avg34);
-
-          __m128i xor12 = _mm_xor_si128 (pixel1, pixel2);
-          __m128i xor34 = _mm_xor_si128 (pixel3, pixel4);
-          __m128i or1234 = _mm_or_si128 (xor12, xor34);
-          __m128i xoravg = _mm_xor_si128 (avg12, avg34);
-          __m128i offset = _mm_and_si128 (_mm_and_si128(or1234, xoravg), shade);
-
-          *(__m128i*)dY = _mm_avg_epu8 (_mm_sub_epi8(avg, offset), *(__m128i*)dY);
-
-          sY += lx2;
-          dY += lx2;
-          }
-        }
-        break;
-      //}}}
-      }
+    int dstOffset = (dfield ? lx2 >> 1 : 0) + lx * y + x;
+    mMc->mPredict[average][0][((dx & 1) << 1) | (dy & 1)] (mCurrentFrame[0] + dstOffset, src[0] + srcOffset, lx, lx2, h);
 
+    // chroma 8 wide, half size, vector truncated towards zero
     lx >>= 1;
     lx2 >>= 1;
     x >>= 1;
@@ -1386,291 +1356,59 @@ private:
     h >>= 1;
     y >>= 1;
     dy /= 2;
-    int sOffset = (sfield ? lx2 >> 1: 0) + lx * (y + (dy >> 1)) + x + (dx >> 1);
-    int dOffset = (dfield ? lx2 >> 1: 0) + lx * y + x;
-    uint8_t* sCr = src[1] + sOffset;
-    uint8_t* dCr = mCurrentFrame[1] + dOffset;
-    uint8_t* sCb = src[2] + sOffset;
-    uint8_t* dCb = mCurrentFrame[2] + dOffset;
-
-    switch ((average << 2) + ((dx & 1) << 1) + (dy & 1)) {
-  #ifdef _M_IX86
-      //{{{
-      case 0: {
-        for (int loop = 0; loop < h; loop++) {
-          *(__m64*)dCb = *(__m64*)sCb;
-          sCb += lx2;
-          dCb += lx2;
-
-          *(__m64*)dCr = *(__m64*)sCr;
-          sCr += lx2;
-          dCr += lx2;
-          }
-        }
-        break;
-      //}}}
-      //{{{
-      case 1:
-        for (int loop = 0; loop < h; loop++) {
-          *(__m64*)dCr = _m_pavgb(*(__m64*)sCr, *(__m64*)(sCr+lx));
-          sCr += lx2;
-          dCr += lx2;
-
-          *(__m64*)dCb = _m_pavgb(*(__m64*)sCb, *(__m64*)(sCb+lx));
-          sCb += lx2;
-          dCb += lx2;
-          }
-        break;
-      //}}}
-      //{{{
-      case 2:
-        for (int loop = 0; loop < h; loop++) {
-          *(__m64*)dCr = _m_pavgb(*(__m64*)sCr, *(__m64*)(sCr+1));
-          sCr += lx2;
-          dCr += lx2;
-
-          *(__m64*)dCb = _m_pavgb(*(__m64*)sCb, *(__m64*)(sCb+1));
-          sCb += lx2;
-          dCb += lx2;
-          }
-        break;
-      //}}}
-      //{{{
-      case 3: {
-        __m64 shade = _mm_set1_pi8(1);
-        for (int loop = 0; loop < h; loop++) {
-          __m64 pixel1 = *(__m64*)sCr;
-          __m64 pixel2 = *(__m64*)(sCr+1);
-          __m64 pixel3 = *(__m64*)(sCr+lx);
-          __m64 pixel4 = *(__m64*)(sCr+lx+1);
-
-          __m64 avg12 = _m_pavgb(pixel1, pixel2);
-          __m64 avg34 = _m_pavgb(pixel3, pixel4);
-          __m64 avg =   _m_pavgb(avg12, avg34);
-
-          __m64 xor12 = _m_pxor(pixel1, pixel2);
-          __m64 xor34 = _m_pxor(pixel3, pixel4);
-          __m64 or1234 = _m_por(xor12, xor34);
-          __m64 xoravg = _m_pxor(avg12, avg34);
-
-          __m64 offset = _m_pand(_m_pand(or1234, xoravg), shade);
-          *(__m64*)dCr = _m_psubb(avg, offset);
-          sCr += lx2;
-          dCr += lx2;
-
-          pixel1 = *(__m64*)sCb;
-          pixel2 = *(__m64*)(sCb+1);
-          pixel3 = *(__m64*)(sCb+lx);
-          pixel4 = *(__m64*)(sCb+lx+1);
-
-          avg12 = _m_pavgb(pixel1, pixel2);
-          avg34 = _m_pavgb(pixel3, pixel4);
-          avg =   _m_pavgb(avg12, avg34);
-          xor12 = _m_pxor(pixel1, pixel2);
-
-          xor34 = _m_pxor(pixel3, pixel4);
-          or1234 = _m_por(xor12, xor34);
-          xoravg = _m_pxor(avg12, avg34);
-
-          offset = _m_pand(_m_pand(or1234, xoravg), shade);
-          *(__m64*)dCb = _m_psubb(avg, offset);
-          sCb += lx2;
-          dCb += lx2;
-          }
-        }
-        break;
-      //}}}
-      //{{{
-      case 4:
-        for (int loop = 0; loop < h; loop++) {
-          *(__m64*)dCr = _m_pavgb(*(__m64*)sCr, *(__m64*)dCr);
-          sCr += lx2;
-          dCr += lx2;
-
-          *(__m64*)dCb = _m_pavgb(*(__m64*)sCb, *(__m64*)dCb);
-          sCb += lx2;
-          dCb += lx2;
-          }
-        break;
-      //}}}
-      //{{{
-      case 5:
-        for (int loop = 0; loop < h; loop++) {
-          *(__m64*)dCr = _m_pavgb (_m_pavgb(*(__m64*)sCr, *(__m64*)(sCr+lx)), *(__m64*)dCr);
-          sCr += lx2;
-          dCr += lx2;
-
-          *(__m64*)dCb = _m_pavgb (_m_pavgb(*(__m64*)sCb, *(__m64*)(sCb+lx)), *(__m64*)dCb);
-          sCb += lx2;
-          dCb += lx2;
-          }
-        break;
-      //}}}
-      //{{{
-      case 6:
-        for (int loop = 0; loop < h; loop++) {
-          *(__m64*)dCr = _m_pavgb (_m_pavgb (*(__m64*)sCr, *(__m64*)(sCr+1)), *(__m64*)dCr);
-          sCr += lx2;
-          dCr += lx2;
-
-          *(__m64*)dCb = _m_pavgb (_m_pavgb (*(__m64*)sCb, *(__m64*)(sCb+1)), *(__m64*)dCb);
-          sCb += lx2;
-          dCb += lx2;
-          }
-        break;
-      //}}}
-      //{{{
-      case 7: {
-        __m64 shade = _mm_set1_pi8(1);
-
-        for (int loop = 0; loop < h; loop++) {
-          __m64 pixel1 = *(__m64*)sCr;
-          __m64 pixel2 = *(__m64*)(sCr+1);
-          __m64 pixel3 = *(__m64*)(sCr+lx);
-          __m64 pixel4 = *(__m64*)(sCr+lx+1);
-
-          __m64 avg12 = _m_pavgb (pixel1, pixel2);
-          __m64 avg34 = _m_pavgb (pixel3, pixel4);
-          __m64 avg =   _m_pavgb (avg12, avg34);
-          __m64 xor12 = _m_pxor (pixel1, pixel2);
-          __m64 xor34 = _m_pxor (pixel3, pixel4);
-
-          __m64 or1234 = _m_por (xor12, xor34);
-          __m64 xoravg = _m_pxor (avg12, avg34);
-          __m64 offset = _m_pand (_m_pand (or1234, xoravg), shade);
-
-          *(__m64*)dCr = _m_pavgb (_m_psubb (avg, offset), *(__m64*)dCr);
-          sCr += lx2;
-          dCr += lx2;
-
-          pixel1 = *(__m64*)sCb;
-          pixel2 = *(__m64*)(sCb+1);
-          pixel3 = *(__m64*)(sCb+lx);
-          pixel4 = *(__m64*)(sCb+lx+1);
-
-          avg12 = _m_pavgb (pixel1, pixel2);
-          avg34 = _m_pavgb (pixel3, pixel4);
-          avg =   _m_pavgb (avg12, avg34);
-          xor12 = _m_pxor (pixel1, pixel2);
-          xor34 = _m_pxor (pixel3, pixel4);
-
-          or1234 = _m_por (xor12, xor34);
-          xoravg = _m_pxor (avg12, avg34);
-          offset = _m_pand (_m_pand (or1234, xoravg), shade);
-
-          *(__m64*)dCb = _m_pavgb (_m_psubb (avg, offset), *(__m64*)dCb);
-          sCb += lx2;
-          dCb += lx2;
-          }
-        }
-        break;
-      //}}}
-      }
-  #else
-      //{{{
-      case 0: case 1: case 2: case 3: case 4: case 5: case 6: case 7:
-        for (int loop = 0; loop < h; loop++) {
-          *(__m64*)dCb = *(__m64*)sCb;
-          sCb += lx2;
-          dCb += lx2;
-          *(__m64*)dCr = *(__m64*)sCr;
-          sCr += lx2;
-          dCr += lx2;
-          }
-        break;
+    srcOffset = (sfield ? lx2 >> 1: 0) + lx * (y + (dy >> 1)) + x + (dx >> 1);
+    dstOffset = (dfield ? lx2 >> 1: 0) + lx * y + x;
+    auto predict = mMc->mPredict[average][1][((dx & 1) << 1) | (dy & 1)];
+    predict (mCurrentFrame[1] + dstOffset, src[1] + srcOffset, lx, lx2, h);
+    predict (mCurrentFrame[2] + dstOffset, src[2] + srcOffset, lx, lx2, h);
+    }
+  //}}}
+  //{{{
+  cMpeg2mc::tPredict getScaledPredict (int width, bool average, int halfpel) {
+  // isa kernels 8 and 4 wide, scalar narrower
 
-      //if (!xh && !yh) {
-        //{{{  no horizontal nor vertical half-pel
-        //if (average_flag) {
-          //for (int j = 0; j < h; j++) {
-            //for (int i = 0; i < w; i++) {
-              //int v = d[i] + s[i];
-              //d[i] = (v + (v >= 0 ? 1 : 0)) >> 1;
-              //}
-            //s += lx2;
-            //d += lx2;
-            //}
-          //}
-
-        //else {
-          //for (int j = 0; j < h; j++) {
-            //for (int i = 0; i < w; i++)
-              //d[i] = s[i];
-            //s += lx2;
-            //d += lx2;
-            //}
-          //}
-        //}
-        //}}}
-      //else if (!xh && yh) {
-        //{{{  no horizontal but vertical half-pel
-        //if (average_flag) {
-          //for (int j = 0; j < h; j++) {
-            //for (int i = 0; i < w; i++) {
-              //int v = d[i] + ((uint32_t)(s[i] + s[i+lx] +1) >>1);
-              //d[i]= (v + (v >= 0 ? 1 : 0)) >> 1;
-              //}
-            //s += lx2;
-            //d += lx2;
-            //}
-          //}
-        //else {
-          //for (int j = 0; j < h; j++) {
-            //for (int i = 0; i < w; i++)
-              //d[i] = (uint32_t)(s[i] + s[i+lx] + 1) >> 1;
-            //s += lx2;
-            //d += lx2;
-            //}
-          //}
-        //}
-        //}}}
-      //else if (xh && !yh) {
-        //{{{  horizontal but no vertical half-pel
-        //if (average_flag) {
-          //for (int j = 0; j < h; j++) {
-            //for (int i = 0; i < w; i++) {
-              //int v = d[i] + ((uint32_t)(s[i] + s[i+1] + 1) >> 1);
-              //d[i] = (v + (v >= 0 ? 1 : 0)) >> 1;
-              //}
-            //s += lx2;
-            //d += lx2;
-            //}
-          //}
-        //else {
-          //for (int j = 0; j < h; j++) {
-            //for (int i = 0; i < w; i++)
-              //d[i] = (uint32_t)(s[i] + s[i+1] + 1) >> 1;
-            //s += lx2;
-            //d += lx2;
-            //}
-          //}
-        //}
-        //}}}
-      //else {
-        //{{{  horizontal and vertical half-pel
-        //if (average_flag) {
-          //for (int j = 0; j < h; j++) {
-            //for (int i = 0; i < w; i++) {
-              //int v = d[i] + ((uint32_t)(s[i] + s[i+1] + s[i+lx] + s[i+lx+1] + 2) >> 2);
-              //d[i] = (v + (v >= 0 ? 1 : 0)) >> 1;
-              //}
-            //s += lx2;
-            //d += lx2;
-            //}
-          //}
-        //else {
-          //for (int j = 0; j < h; j++) {
-            //for (int i = 0; i < w; i++)
-              //d[i] = (uint32_t)(s[i] + s[i+1] + s[i+lx] + s[i+lx+1] + 2) >> 2;
-            //s += lx2;
-            //d += lx2;
-            //}
-          //}
-        //}
-        //}}}
-      //}}}
+    if (width >= 4)
+      return mMc->mPredictScaled[average][width == 4][halfpel];
+    return cMpeg2mc::getScaledPredict (width, average, halfpel);
+    }
+  //}}}
+  //{{{
+  void formPredictionScaled (uint8_t* src[], int sfield, int dfield, int lx, int lx2, int h, int x, int y, int dx, int dy, bool average) {
+  // reduced resolution formPrediction, positions and vectors scaled down keeping halfpel precision
+
+    lx >>= mScaleShift;
+    lx2 >>= mScaleShift;
+    h >>= mScaleShift;
+    x >>= mScaleShift;
+    y >>= mScaleShift;
+    dx >>= mScaleShift;
+    dy >>= mScaleShift;
+
+    // luma
+    int srcOffset = (sfield ? lx2 >> 1 : 0) + lx * (y + (dy >> 1)) + x + (dx >> 1);
+    int dstOffset = (dfield ? lx2 >> 1 : 0) + lx * y + x;
+    getScaledPredict (16 >> mScaleShift, average, ((dx & 1) << 1) | (dy & 1))
+      (mCurrentFrame[0] + dstOffset, src[0] + srcOffset, lx, lx2, h);
+
+    // chroma
+    lx >>= 1;
+    lx2 >>= 1;
+    x >>= 1;
+    dx /= 2;
+    h >>= 1;
+    y >>= 1;
+    dy /= 2;
+    if (!h) {
+      // less than a line per field, predict whole block from first field
+      if (dfield)
+        return;
+      h = 1;
       }
-  #endif
+    srcOffset = (sfield ? lx2 >> 1: 0) + lx * (y + (dy >> 1)) + x + (dx >> 1);
+    dstOffset = (dfield ? lx2 >> 1: 0) + lx * y + x;
+    auto predict = getScaledPredict (8 >> mScaleShift, average, ((dx & 1) << 1) | (dy & 1));
+    predict (mCurrentFrame[1] + dstOffset, src[1] + srcOffset, lx, lx2, h);
+    predict (mCurrentFrame[2] + dstOffset, src[2] + srcOffset, lx, lx2, h);
     }
   //}}}
   //{{{
@@ -1712,114 +1450,6 @@ private:
     }
   //}}}
   //{{{
-  void idctSSE2 (int16_t* block) {
-
-    //{{{  DCT_8_INV_ROWX2 macro
-    #define DCT_8_INV_ROWX2(tab1, tab2) {  \
-      r1 = _mm_shufflelo_epi16 (r1, _MM_SHUFFLE(3, 1, 2, 0));  \
-      r1 = _mm_shufflehi_epi16 (r1, _MM_SHUFFLE(3, 1, 2, 0));  \
-      a0 = _mm_madd_epi16 (_mm_shuffle_epi32 (r1, _MM_SHUFFLE(0, 0, 0, 0)), *(__m128i*)(tab1+8*0));  \
-      a1 = _mm_madd_epi16 (_mm_shuffle_epi32 (r1, _MM_SHUFFLE(1, 1, 1, 1)), *(__m128i*)(tab1+8*2));  \
-      a2 = _mm_madd_epi16 (_mm_shuffle_epi32 (r1, _MM_SHUFFLE(2, 2, 2, 2)), *(__m128i*)(tab1+8*1));  \
-      a3 = _mm_madd_epi16 (_mm_shuffle_epi32 (r1, _MM_SHUFFLE(3, 3, 3, 3)), *(__m128i*)(tab1+8*3));  \
-      s0 = _mm_add_epi32 (_mm_add_epi32 (a0, round_row), a2);  \
-      s1 = _mm_add_epi32 (a1, a3);  \
-      p0 = _mm_srai_epi32 (_mm_add_epi32 (s0, s1), 11);  \
-      p1 = _mm_shuffle_epi32 (_mm_srai_epi32 (_mm_sub_epi32(s0, s1), 11), _MM_SHUFFLE(0, 1, 2, 3));  \
-      r2 = _mm_shufflelo_epi16 (r2, _MM_SHUFFLE(3, 1, 2, 0));  \
-      r2 = _mm_shufflehi_epi16 (r2, _MM_SHUFFLE(3, 1, 2, 0));  \
-      b0 = _mm_madd_epi16 (_mm_shuffle_epi32 (r2, _MM_SHUFFLE(0, 0, 0, 0)), *(__m128i*)(tab2+8*0));  \
-      b1 = _mm_madd_epi16 (_mm_shuffle_epi32 (r2, _MM_SHUFFLE(1, 1, 1, 1)), *(__m128i*)(tab2+8*2));  \
-      b2 = _mm_madd_epi16 (_mm_shuffle_epi32 (r2, _MM_SHUFFLE(2, 2, 2, 2)), *(__m128i*)(tab2+8*1));  \
-      b3 = _mm_madd_epi16 (_mm_shuffle_epi32 (r2, _MM_SHUFFLE(3, 3, 3, 3)), *(__m128i*)(tab2+8*3));  \
-      s2 = _mm_add_epi32 (_mm_add_epi32 (b0, round_row), b2);  \
-      s3 = _mm_add_epi32 (b3, b1);  \
-      p2 = _mm_srai_epi32 (_mm_add_epi32 (s2, s3), 11);  \
-      p3 = _mm_shuffle_epi32 (_mm_srai_epi32 (_mm_sub_epi32(s2, s3), 11), _MM_SHUFFLE(0, 1, 2, 3));  \
-      r1 = _mm_packs_epi32 (p0, p1);  \
-      r2 = _mm_packs_epi32 (p2, p3);  \
-    }
-    //}}}
-    __m128i r1, r2, a0, a1, a2, a3, b0, b1, b2, b3, s0, s1, s2, s3, p0, p1, p2, p3;
-    __m128i round_row = _mm_set_epi16 (0, 1024, 0, 1024, 0, 1024, 0, 1024);
-
-    r1 = *(__m128i*)(block+8*0);
-    r2 = *(__m128i*)(block+8*1);
-    DCT_8_INV_ROWX2(sse2_tab_i_04, sse2_tab_i_17);
-    *(__m128i*)(block+8*0) = r1;
-    *(__m128i*)(block+8*1) = r2;
-
-    r1 = *(__m128i*)(block+8*4);
-    r2 = *(__m128i*)(block+8*7);
-    DCT_8_INV_ROWX2(sse2_tab_i_04, sse2_tab_i_17);
-    *(__m128i*)(block+8*4) = r1;
-    *(__m128i*)(block+8*7) = r2;
-
-    r1 = *(__m128i*)(block+8*2);
-    r2 = *(__m128i*)(block+8*3);
-    DCT_8_INV_ROWX2(sse2_tab_i_26, sse2_tab_i_35);
-    *(__m128i*)(block+8*2) = r1;
-    *(__m128i*)(block+8*3) = r2;
-
-    r1 = *(__m128i*)(block+8*6);
-    r2 = *(__m128i*)(block+8*5);
-    DCT_8_INV_ROWX2(sse2_tab_i_26, sse2_tab_i_35);
-    *(__m128i*)(block+8*6) = r1;
-    *(__m128i*)(block+8*5) = r2;
-
-    __m128i x0 = *(__m128i*)(block+8*0);
-    __m128i x1 = *(__m128i*)(block+8*1);
-    __m128i x2 = *(__m128i*)(block+8*2);
-    __m128i x3 = *(__m128i*)(block+8*3);
-    __m128i x4 = *(__m128i*)(block+8*4);
-    __m128i x5 = *(__m128i*)(block+8*5);
-    __m128i x6 = *(__m128i*)(block+8*6);
-    __m128i x7 = *(__m128i*)(block+8*7);
-
-    __m128i tan1 = _mm_set1_epi16 (13036);
-    __m128i tan2 = _mm_set1_epi16 (27146);
-    __m128i tan3 = _mm_set1_epi16 (-21746);
-    __m128i cos4 = _mm_set1_epi16 (-19195);
-    __m128i round_err = _mm_set1_epi16 (1);
-    __m128i round_col = _mm_set1_epi16 (32);
-    __m128i round_corr = _mm_set1_epi16 (31);
-
-    __m128i tp765 = _mm_adds_epi16 (_mm_mulhi_epi16 (x7, tan1), x1);
-    __m128i tp465 = _mm_subs_epi16 (_mm_mulhi_epi16 (x1, tan1), x7);
-    __m128i tm765 = _mm_adds_epi16 (_mm_mulhi_epi16 (x5, tan3), _mm_adds_epi16 (x5, x3));
-    __m128i tm465 = _mm_subs_epi16 (x5, _mm_adds_epi16 (_mm_mulhi_epi16 (x3, tan3), x3));
-
-    __m128i t7 = _mm_adds_epi16 (_mm_adds_epi16(tp765, tm765), round_err);
-    __m128i tp65 = _mm_subs_epi16 (tp765, tm765);
-    __m128i t4 = _mm_adds_epi16 (tp465, tm465);
-    __m128i tm65 = _mm_adds_epi16 (_mm_subs_epi16(tp465, tm465), round_err);
-
-    __m128i tmp1 = _mm_adds_epi16 (tp65, tm65);
-    __m128i t6 = _mm_or_si128 (_mm_adds_epi16(_mm_mulhi_epi16 (tmp1, cos4), tmp1), round_err);
-    __m128i tmp2 = _mm_subs_epi16 (tp65, tm65);
-    __m128i t5 = _mm_or_si128 (_mm_adds_epi16(_mm_mulhi_epi16 (tmp2, cos4), tmp2), round_err);
-
-    __m128i tp03 = _mm_adds_epi16 (x0, x4);
-    __m128i tp12 = _mm_subs_epi16 (x0, x4);
-    __m128i tm03 = _mm_adds_epi16 (_mm_mulhi_epi16( x6, tan2), x2);
-    __m128i tm12 = _mm_subs_epi16 (_mm_mulhi_epi16 (x2, tan2), x6);
-
-    __m128i t0 = _mm_adds_epi16 (_mm_adds_epi16 (tp03, tm03), round_col);
-    __m128i t3 = _mm_adds_epi16 (_mm_subs_epi16 (tp03, tm03), round_corr);
-    __m128i t1 = _mm_adds_epi16 (_mm_adds_epi16 (tp12, tm12), round_col);
-    __m128i t2 = _mm_adds_epi16 (_mm_subs_epi16 (tp12, tm12), round_corr);
-
-    *(__m128i*)(block+8*0) = _mm_srai_epi16 (_mm_adds_epi16(t0, t7), 6);
-    *(__m128i*)(block+8*7) = _mm_srai_epi16 (_mm_subs_epi16(t0, t7), 6);
-    *(__m128i*)(block+8*1) = _mm_srai_epi16 (_mm_adds_epi16(t1, t6), 6);
-    *(__m128i*)(block+8*6) = _mm_srai_epi16 (_mm_subs_epi16(t1, t6), 6);
-    *(__m128i*)(block+8*2) = _mm_srai_epi16 (_mm_adds_epi16(t2, t5), 6);
-    *(__m128i*)(block+8*5) = _mm_srai_epi16 (_mm_subs_epi16(t2, t5), 6);
-    *(__m128i*)(block+8*3) = _mm_srai_epi16 (_mm_adds_epi16(t3, t4), 6);
-    *(__m128i*)(block+8*4) = _mm_srai_epi16 (_mm_subs_epi16(t3, t4), 6);
-    }
-  //}}}
-  //{{{
   void addBlock (int16_t* block, bool luma, int comp, int bx, int by, int dctType, int intra) {
   // move/add 8x8-Block from block[comp] to backward_reference_frame
   // copy reconstructed 8x8 block from block[comp] to current_frame[]
@@ -1844,64 +1474,65 @@ private:
       refFramePtr = mCurrentFrame[(comp & 1) + 1] + mChromaWidth * ((by >> 1) + ((comp & 2) << 2)) + (bx >> 1) + (comp & 8);
       }
 
-  //#ifdef _M_X64
-  #ifdef _M_IX86
-    //{{{  x86 intrinsics
-    __m64 *src = (__m64*)block;
-    if (intra) {
-      __m64 offset = _mm_set1_pi16 (128);
-      for (int loop = 0; loop < 8; loop++) {
-        __m64 sum1 = _m_paddw (*src++, offset);
-        __m64 sum2 = _m_paddw (*src++, offset);
-        *(__m64*)refFramePtr = _m_packuswb (sum1, sum2);
-        refFramePtr += lineInc;
+    if (intra)
+      mMc->mPutBlock (refFramePtr, block, lineInc);
+    else
+      mMc->mAddBlock (refFramePtr, block, lineInc);
+    }
+  //}}}
+  //{{{
+  void addBlockScaled (const int16_t* block, bool luma, int comp, int bx, int by, int dctType, int intra) {
+  // reduced resolution addBlock, n x n block from low frequency coefficients, n = 8 >> mScaleShift
+
+    int n = 8 >> mScaleShift;
+    if (!intra) {
+      //{{{  no low frequency coefficients, nothing to add, uncoded and skipped blocks
+      uint64_t coefs = 0;
+      for (int row = 0; row < n; row++) {
+        uint64_t rowCoefs = 0;
+        memcpy (&rowCoefs, block + row * 8, n * sizeof(int16_t));
+        coefs |= rowCoefs;
         }
+      if (!coefs)
+        return;
       }
-    else {
-       __m64 zero = _mm_setzero_si64();
-      for (int loop = 0; loop < 8; loop++) {
-        __m64 sum1 = _m_paddw (*src++, _m_punpcklbw (*(__m64*)refFramePtr, zero));
-        __m64 sum2 = _m_paddw (*src++, _m_punpckhbw (*(__m64*)refFramePtr, zero));
-        *(__m64*)refFramePtr = _m_packuswb (sum1, sum2);
-        refFramePtr += lineInc;
+      //}}}
+
+    alignas(16) int16_t pixels[16];
+    mIdctScaled (block, mScaleShift, pixels);
+
+    int width = mWidth >> mScaleShift;
+    bx >>= mScaleShift;
+    by >>= mScaleShift;
+
+    int lineInc;
+    uint8_t* refFramePtr;
+    if (luma) {
+      if (dctType) {
+        lineInc = width << 1;
+        refFramePtr = mCurrentFrame[0] + width * (by + ((comp & 2) >> 1)) + bx + (comp & 1) * n;
         }
-      }
-    //}}}
-  #else
-    //{{{
-    //lineInc -= 8;
-    //if (intra)
-      //for (int j = 0; j < 8; j++) {
-        //for (int i = 0; i < 8; i++)
-          //*refFramePtr++ = *block++ + 128;
-        //refFramePtr += lineInc;
-        //}
-    //else
-      //for (int j = 0; j < 8; j++) {
-        //for (int i = 0; i < 8; i++)
-          //*refFramePtr++ += *block++;
-        //refFramePtr += lineInc;
-        //}
-    //}}}
-    //{{{
-    lineInc -= 8;
-
-    if (intra) {
-      for (int j = 0; j < 8; j++) {
-        for (int i = 0; i < 8; i++)
-          *refFramePtr++ = Clip [*block++ + 128];
-        refFramePtr += lineInc;
+      else {
+        lineInc = width;
+        refFramePtr = mCurrentFrame[0] + width * (by + ((comp & 2) ? n : 0)) + bx + (comp & 1) * n;
         }
       }
     else {
-      for (int j = 0; j < 8; j++) {
-        for (int i = 0; i < 8; i++)
-          *refFramePtr++ = Clip [*block++ + *refFramePtr];
-        refFramePtr += lineInc;
-        }
+      lineInc = width >> 1;
+      refFramePtr = mCurrentFrame[(comp & 1) + 1] + lineInc * (by >> 1) + (bx >> 1);
       }
-    //}}}
-  #endif
+
+    if (n == 4) {
+      (intra ? mMc->mPutBlock4 : mMc->mAddBlock4) (refFramePtr, pixels, lineInc);
+      return;
+      }
+
+    const int16_t* pixel = pixels;
+    for (int j = 0; j < n; j++, refFramePtr += lineInc)
+      for (int i = 0; i < n; i++) {
+        int v = *pixel++ + (intra ? 128 : refFramePtr[i]);
+        refFramePtr[i] = (v < 0) ? 0 : ((v > 255) ? 255 : v);
+        }
     }
   //}}}
   //{{{
@@ -1915,10 +1546,13 @@ private:
     if (!(mbType & MACROBLOCK_INTRA))
       formPredictions (bx, by, mbType, motionType, PMV, motionVertField);
 
-    for (int i = 0; i < 6; i++) {
-      idctSSE2 (mBlock[i]);
-      addBlock (mBlock[i], i < 4, i, bx, by, dctType, mbType & MACROBLOCK_INTRA);
-      }
+    for (int i = 0; i < 6; i++)
+      if (mScaleShift)
+        addBlockScaled (mBlock[i], i < 4, i, bx, by, dctType, mbType & MACROBLOCK_INTRA);
+      else {
+        mIdct (mBlock[i]);
+        addBlock (mBlock[i], i < 4, i, bx, by, dctType, mbType & MACROBLOCK_INTRA);
+        }
     }
   //}}}
   //{{{
@@ -1975,87 +1609,690 @@ private:
       }
     }
   //}}}
+
+  //{{{  vars
+  int16_t* mBlock[6];
+  int mQuantizerScale = 0;
+
+  const cMpeg2mc::sKernels* mMc = nullptr;
+  cMpeg2idct::tIdct mIdct = nullptr;
+  cMpeg2idct::tIdctScaled mIdctScaled = nullptr;
+  //}}}
+  };
+//}}}
+
+//{{{
+struct sMpeg2job {
+// picture to decode, holds a ref on each of its frames until decoded and output
+  sMpeg2picture mPicture;
+  cMpeg2frame* mOutput = nullptr;
+
+  std::vector<uint8_t*> mSlicePtrs;
+  uint8_t* mSliceEnd = nullptr;
+  std::vector<uint8_t> mData; // copy of slices when frame threaded, pes buffer is reused by caller
+  };
+//}}}
+//{{{
+struct sMpeg2pictureThread {
+// frame threading, queue of pictures decoded in order by one thread with its own slice decoder
+  std::thread mThread;
+  std::mutex mMutex;
+  std::condition_variable mCond;
+  std::deque<sMpeg2job*> mJobs;
+  int mPending = 0; // queued or decoding
+  bool mExit = false;
+  cMpeg2slice mSlice;
+  };
+//}}}
+
+class cMpeg2decoder : public cMpeg2bitStream, public sMpeg2picture {
+public:
+  // called as each frame is output, in frameNum order unless frame threaded, planes valid only during call
+  using tFrameCallback = std::function<void (int frameNum, uint64_t pts, uint8_t** planes, int32_t* linesize,
+                                             int width, int height, int pictureType)>;
+
+  // trick play, skipped pictures are not decoded or output
+  enum eDecodeMode { eDecodeAll, eDecodeSkipB, eDecodeIonly };
   //{{{
-  void decodeSlices() {
+  cMpeg2decoder() {
 
-    auto code = getStartCode();
-    while ((code >= SLICE_START_CODE_MIN) && (code <= SLICE_START_CODE_MAX)) {
-      consumeBits (32);
-      sliceHeader();
-
-      int dcDctPred[3] = {0,0,0};
-      int PMV[2][2][2] = {0,0,0,0,0,0,0,0};
-
-      int mbAddressInc = getMacroBlockAddressInc();
-      for (int mbAddress = ((code & 255) - 1) * mMbWidth; mbAddress < (mMbWidth * mMbHeight); mbAddress++) {
-        if (mbAddressInc == 0) {
-          if (peekBits(23) == 0)
-            goto getNextStartCode;
-          else
-            mbAddressInc = getMacroBlockAddressInc();
-          }
+    mSlices.push_back (new cMpeg2slice());
+    mIsa = cMpeg2mc::getBestIsa();
+    }
+  //}}}
+  //{{{
+  ~cMpeg2decoder() {
+  // any frames from getNearestVidFrame must be released before this
 
-        int mBtype, motionType, dctType, motionVertField[2][2];
-        if (mbAddressInc == 1)
-          decodeMacroblock (mBtype, motionType, dctType, PMV, dcDctPred, motionVertField);
-        else { // skip macroBlock
-          dcDctPred[0] = dcDctPred[1] = dcDctPred[2] = 0;
-          memset (mBlock[0], 0, 128 * sizeof(int16_t) * 6);
-          if (mPictureCodingType == P_TYPE)
-            PMV[0][0][0] = PMV[0][0][1] = PMV[1][0][0] = PMV[1][0][1] = 0;
-          motionType = MC_FRAME;
-          mBtype &= ~MACROBLOCK_INTRA;
-          }
+    stopPictureThreads();
+    stopSliceThreads();
+    for (auto slice : mSlices)
+      delete slice;
 
-        motionCompensation (mbAddress, mBtype, motionType, PMV, motionVertField, dctType);
-        mbAddressInc--;
+    for (auto& vidFrame : mVidFrames)
+      mFramePool.release (vidFrame.second);
+    mFramePool.release (mForward);
+    mFramePool.release (mBackward);
+    }
+  //}}}
+
+  int getNumVidFrames() { return (int)mVidFrames.size(); }
+  int getDroppedPictures() { return mDroppedPictures; }
+  //{{{
+  cMpeg2frame* getNearestVidFrame (uint64_t pts) {
+  // output frame with pts nearest to pts, O(log n) in pts index
+  // - returns a ref, caller must releaseVidFrame, nullptr if no frame output yet
+
+    std::unique_lock<std::mutex> lock (mVidFramesMutex);
+    if (mVidFrames.empty())
+      return nullptr;
+
+    // first after pts, or the latest of any frames sharing pts
+    auto it = mVidFrames.upper_bound ({ pts, INT_MAX });
+    if (it == mVidFrames.end())
+      --it;
+    else if (it != mVidFrames.begin()) {
+      auto prev = std::prev (it);
+      if (pts - prev->first.first < it->first.first - pts)
+        it = prev;
+      }
+
+    return mFramePool.addRef (it->second);
+    }
+  //}}}
+  void releaseVidFrame (cMpeg2frame* frame) { mFramePool.release (frame); }
+  //{{{
+  void invalidateFrames() {
+
+    flush();
+
+    std::unique_lock<std::mutex> lock (mVidFramesMutex);
+    for (auto& vidFrame : mVidFrames)
+      mFramePool.release (vidFrame.second);
+    mVidFrames.clear();
+
+    mLoadVidFrame = 0;
+    mGoodAnchors = 0;
+    }
+  //}}}
+  //{{{
+  void setSliceThreads (int numThreads) {
+  // decode slices of each picture on numThreads including caller, 1 decodes serially on caller
+  // - not used when frame threaded
+
+    stopSliceThreads();
+
+    numThreads = (numThreads < 1) ? 1 : numThreads;
+    while ((int)mSlices.size() < numThreads) {
+      mSlices.push_back (new cMpeg2slice());
+      mSlices.back()->setIsa (mIsa);
+      }
+
+    for (int i = 1; i < numThreads; i++)
+      mSliceThreads.push_back (std::thread ([=]() { sliceThread (i); }));
+    }
+  //}}}
+  //{{{
+  void setFrameThreads (bool frameThreads) {
+  // decode I/P and B pictures on their own threads, caller thread only parses headers
+  // - B motion compensation waits on reference frame rows as they are decoded
+  // - set before first decodePes, sizes the frame pool for pictures in flight
+
+    stopPictureThreads();
+
+    mFrameThreaded = frameThreads;
+    if (frameThreads)
+      for (int i = 0; i < 2; i++) {
+        mPictureThreads[i].mExit = false;
+        mPictureThreads[i].mThread = std::thread ([=]() { pictureThread (mPictureThreads[i]); });
         }
+    }
+  //}}}
+  //{{{
+  bool setIsa (cMpeg2mc::eIsa isa) {
+  // force kernel isa for all slices, false leaves kernels unchanged if isa not available on this cpu
+  // - set before decoding, not while pictures are in flight
+
+    if (!cMpeg2mc::getKernels (isa) || !cMpeg2idct::getIdct (isa))
+      return false;
+
+    mIsa = isa;
+    for (auto slice : mSlices)
+      slice->setIsa (isa);
+    for (auto& thread : mPictureThreads)
+      thread.mSlice.setIsa (isa);
+    return true;
+    }
+  //}}}
+  cMpeg2mc::eIsa getIsa() { return mIsa; }
+
+  //{{{
+  void setDecodeMode (eDecodeMode decodeMode) {
+  // skip B pictures, or P and B pictures, from next picture
+  // - leaving eDecodeIonly, P and B pictures wait for references decoded since
+
+    mDecodeMode = decodeMode;
+    }
+  //}}}
+  eDecodeMode getDecodeMode() { return mDecodeMode; }
+  //{{{
+  void setScaleShift (int scaleShift) {
+  // reduced resolution, 1 half, 2 quarter, 3 eighth dc only, straight from the dct, 0 full resolution
+  // - restarts decode at next sequence header with smaller frames
+  // - frames from getNearestVidFrame must be released first, the frame pool is reallocated
+
+    scaleShift = (scaleShift < 0) ? 0 : (scaleShift > 3) ? 3 : scaleShift;
+    if (scaleShift == mScaleShift)
       return;
 
-   getNextStartCode:
+    invalidateFrames();
+    mFramePool.release (mForward);
+    mFramePool.release (mBackward);
+    setFrames (nullptr, nullptr, nullptr);
+
+    mScaleShift = scaleShift;
+    mGotSequenceHeader = false;
+    }
+  //}}}
+  int getScaleShift() { return mScaleShift; }
+  void setFrameCallback (tFrameCallback frameCallback) { mFrameCallback = frameCallback; }
+
+  //{{{
+  void flush (bool endOfStream = false) {
+  // wait for queued pictures to be decoded and output
+  // - endOfStream also outputs the last anchor, held until the next anchor otherwise
+  //   next picture must be an I, decode starts again as if from the beginning of a stream
+
+    for (auto& thread : mPictureThreads) {
+      std::unique_lock<std::mutex> lock (thread.mMutex);
+      thread.mCond.wait (lock, [&]() { return thread.mPending == 0; });
+      }
+
+    if (endOfStream && mBackward) {
+      mBackward->mFrameNum = mLoadVidFrame++;
+      outputFrame (mBackward);
+      mBackward = nullptr;
+
+      mFramePool.release (mForward);
+      mForward = nullptr;
+      mGoodAnchors = 0;
+      }
+    }
+  //}}}
+  //{{{
+  bool decodePes (uint8_t* pesBuffer, uint8_t* pesBufferEnd, uint64_t vidPts, uint8_t*& pesPtr) {
+  // decode a frame of video, usually a pes packet
+  // - frame threaded, picture is queued and decoded later, output appears in mVidFrames when done
+
+    setBuffer (pesBuffer, pesBufferEnd);
+    pesPtr = pesBuffer;
+
+    if (!mGotSequenceHeader)
+      while (mBufferPtr < mBufferEnd)
+        if (getHeader (false) == 0x1B3) { // sequenceHeaderCode
+          // frames from sequenceHeader width, height
+          mFramePool.allocate ((mFrameThreaded ? kFrameThreadedFrames : kFrames) + maxVidFrames + kConsumerFrames,
+                               mWidth >> mScaleShift, mHeight >> mScaleShift);
+          mGotSequenceHeader = true;
+          break;
+          }
+
+    while (mBufferPtr < mBufferEnd)
+      if (getHeader (true) == 0x100) // pictureStartCode
+        break;
+
+    if (mBufferPtr >= mBufferEnd)
+      return false;
+
+    // skipped pictures only scan for the next picture, never copied or queued
+    bool skip = skipPicture();
+    auto job = (mFrameThreaded && !skip) ? new sMpeg2job() : &mJob;
+    scanSlices (job, mFrameThreaded && !skip);
+    pesPtr = mBufferPtr - 4;
+    if (skip)
+      return true;
+
+    //{{{  updatePictureBuffers description
+    // B pics do not need to be save for future reference
+    // the previously decoded reference frame is stored coincident with the location where the backward
+    // reference frame is stored (backwards prediction is not needed in P pictures)
+    // update pointer for potential future B pictures
+    // can erase over old backward reference frame since it is not used in a P picture
+    // - since any subsequent B pictures will use the previously decoded I or P frame as the backward_reference_frame
+    //}}}
+    cMpeg2frame* current = mFramePool.acquire (std::chrono::milliseconds (kAcquireTimeoutMs));
+    if (!current) {
+      //{{{  no free frame, consumer holding them all, drop picture, anchors stale until next I
+      mDroppedPictures++;
+      if (mPictureCodingType != B_TYPE)
+        mGoodAnchors = 0;
+      if (job != &mJob)
+        delete job;
+      return true;
+      }
+      //}}}
+
+    // frame carries its own pts, anchors are output a picture later under the next anchor's pts
+    current->mPts = vidPts;
+    current->mPesSize = (int)(pesBufferEnd - pesBuffer);
+    current->mPictureType = mPictureCodingType;
+
+    if (mPictureCodingType != B_TYPE) {
+      mFramePool.release (mForward);
+      mForward = mBackward;
+      mBackward = current;
+      current = mFramePool.addRef (mBackward);
+      }
+    setFrames (current, mFramePool.addRef (mForward), mFramePool.addRef (mBackward));
+
+    // reorderFrames write or display current or previously decoded reference frame
+    job->mPicture = *this;
+    job->mOutput = mFramePool.addRef ((mPictureCodingType == B_TYPE) ? current : mForward);
+    if (job->mOutput)
+      job->mOutput->mFrameNum = mLoadVidFrame++;
+
+    if (mFrameThreaded)
+      queueJob (job);
+    else
+      decodeJob (job, nullptr);
+
+    return true;
+    }
+  //}}}
+
+private:
+  void picture_coding_extension() {
+
+    mFcode[0][0] = getBits(4);
+    mFcode[0][1] = getBits(4);
+    mFcode[1][0] = getBits(4);
+    mFcode[1][1] = getBits(4);
+
+    mIntraDcPrecision      = getBits(2);
+    auto picture_structure = getBits(2);
+    auto top_field_first   = getBits(1);
+    mFramePredFrameDct     = getBits(1);
+    mConcealmentMotionVecs = getBits(1);
+    qScaleType             = getBits(1);
+    mIntraVlcFormat        = getBits(1);
+    mAlternateScan         = getBits(1);
+    }
+  //}}}
+  //{{{
+  void extension_and_user_data() {
+  // decode extension and user data
+
+    auto code = getStartCode();
+    while (code == EXTENSION_START_CODE || code == USER_DATA_START_CODE) {
+      consumeBits (32);
+      if (code == EXTENSION_START_CODE) {
+        int ext_ID = getBits (4);
+        switch (ext_ID) {
+          case PICTURE_CODING_EXTENSION_ID:
+            picture_coding_extension();
+            break;
+          default:
+            //printf ("reserved extension start code ID %d\n", ext_ID);
+            break;
+          }
+        }
+      // else // userData skip ahead to the next start code
+
       code = getStartCode();
       }
     }
   //}}}
+  //{{{
+  void sequenceHeader() {
+
+    auto horizontal_size = getBits (12);
+    auto vertical_size = getBits (12);
+
+    mMbWidth = (horizontal_size + 15) / 16;
+    mMbHeight = 2 * ((vertical_size + 31) / 32);
+    mWidth = 16 * mMbWidth;
+    mHeight = 16 * mMbHeight;
+    mChromaWidth = mWidth >> 1;
+    mChromaHeight = mHeight >> 1;
+
+    extension_and_user_data();
+    }
+  //}}}
+  //{{{
+  void pictureHeader() {
+
+    mTemporalReference = getBits (10);
+    mPictureCodingType = getBits (3);
+    auto vbv_delay = getBits (16);
+
+    if (mPictureCodingType == P_TYPE || mPictureCodingType == B_TYPE) {
+      auto fullPelForwardVector = getBits(1);
+      auto forwardFcode = getBits(3);
+      }
+
+    if (mPictureCodingType == B_TYPE) {
+      auto fullPelBackwardVector = getBits(1);
+      auto backwardFcode = getBits(3);
+      }
+
+    // consume extraBytes
+    auto Extra_Information_Byte_Count = 0;
+    while (getBits (1)) {
+      consumeBits (8);
+      Extra_Information_Byte_Count++;
+      }
+    extension_and_user_data();
+    }
+  //}}}
+  //{{{
+  uint32_t getHeader (bool reportUnexpected) {
+
+    getStartCode();
+    auto code = getBits (32);
+    switch (code) {
+      case 0x100 : // PICTURE_START_CODE:
+        pictureHeader();
+        break;
+
+      case 0x1B3 : // SEQUENCE_HEADER_CODE:
+        sequenceHeader();
+        break;
+
+      case 0x1B7: // SEQUENCE_END_CODE:
+        printf ("getHeader %08x SEQUENCE_END_CODE\n", code);
+        break;
+
+      case 0x1B8 : // GROUP_START_CODE:
+        break;
+
+      default:
+        if (reportUnexpected)
+          printf ("getHeader unexpected %08x\n", code);
+        break;
+      }
+
+    return code;
+    }
+  //}}}
+
+  //{{{
+  uint8_t* findStartCode (uint8_t* ptr) {
+  // return next 00 00 01 xx startCode at or after ptr, mBufferEnd if none
+
+    for (; ptr + 3 < mBufferEnd; ptr++)
+      if (!ptr[2])
+        continue;
+      else if ((ptr[2] == 1) && !ptr[1] && !ptr[0])
+        return ptr;
+      else // ptr[2] can't be part of a prefix, step past it
+        ptr += 2;
+
+    return mBufferEnd;
+    }
+  //}}}
+  //{{{
+  bool skipPicture() {
+  // skip for decodeMode, or if references are missing or were themselves skipped
+  // - mGoodAnchors, 0 none, 1 backward good, 2 forward and backward good
+
+    if (!mGotSequenceHeader)
+      return true;
+
+    bool skip;
+    switch (mPictureCodingType) {
+      case I_TYPE:
+        // forward becomes previous anchor, good if it was
+        mGoodAnchors = mGoodAnchors ? 2 : 1;
+        return false;
+
+      case P_TYPE:
+        skip = (mDecodeMode == eDecodeIonly) || !mBackward || !mGoodAnchors;
+        mGoodAnchors = skip ? 0 : 2;
+        return skip;
+
+      case B_TYPE:
+        return (mDecodeMode != eDecodeAll) || !mForward || !mBackward || (mGoodAnchors < 2);
+
+      default:
+        return true;
+      }
+    }
+  //}}}
+  //{{{
+  void scanSlices (sMpeg2job* job, bool copy) {
+  // prescan slice startCodes, leave bitStream at startCode after last slice
+  // - copy for frame threaded, slices copied to job, caller reuses pes buffer
+
+    job->mSlicePtrs.clear();
+
+    getStartCode();
+    uint8_t* slicesBegin = mBufferPtr - 4;
+    uint8_t* ptr = slicesBegin;
+    while ((ptr < mBufferEnd) && (ptr[3] >= (SLICE_START_CODE_MIN & 0xFF)) && (ptr[3] <= (SLICE_START_CODE_MAX & 0xFF))) {
+      job->mSlicePtrs.push_back (ptr);
+      ptr = findStartCode (ptr + 4);
+      }
+    job->mSliceEnd = ptr;
+
+    if (copy) {
+      //{{{  copy slices, zero padded so bitStream readahead stops at a startCode
+      job->mData.assign (slicesBegin, ptr);
+      job->mData.resize (job->mData.size() + 8, 0);
+
+      for (auto& slicePtr : job->mSlicePtrs)
+        slicePtr = job->mData.data() + (slicePtr - slicesBegin);
+      job->mSliceEnd = job->mData.data() + (ptr - slicesBegin);
+      }
+      //}}}
+
+    setBuffer (ptr, mBufferEnd);
+    }
+  //}}}
+  //{{{
+  void decodeJob (sMpeg2job* job, cMpeg2slice* slice) {
+  // decode slices serially on slice, or across slice threads if no slice, then output and release frames
+
+    if (slice) {
+      static_cast<sMpeg2picture&>(*slice) = job->mPicture;
+      for (auto slicePtr : job->mSlicePtrs)
+        slice->decodeSlice (slicePtr, job->mSliceEnd);
+      }
+    else
+      decodeSlices (job);
+
+    // missing or broken slices still complete the frame for anyone waiting on its rows
+    auto& picture = job->mPicture;
+    picture.mCurrent->setRows (picture.mMbHeight);
+
+    if (job->mOutput)
+      outputFrame (job->mOutput);
+
+    mFramePool.release (picture.mCurrent);
+    mFramePool.release (picture.mForward);
+    mFramePool.release (picture.mBackward);
+    }
+  //}}}
+  //{{{
+  void outputFrame (cMpeg2frame* output) {
+  // output frame with its own pts, pictureType and frameNum, takes over caller's ref
+
+    if (mFrameCallback)
+      mFrameCallback (output->mFrameNum, output->mPts, output->mPlanes, output->mLinesize,
+                      output->mWidth, output->mHeight, output->mPictureType);
+
+    // output ref moves to pts index, oldest pts evicted back to pool
+    std::unique_lock<std::mutex> lock (mVidFramesMutex);
+    mVidFrames[{ output->mPts, output->mFrameNum }] = output;
+    if (mVidFrames.size() > maxVidFrames) {
+      mFramePool.release (mVidFrames.begin()->second);
+      mVidFrames.erase (mVidFrames.begin());
+      }
+    }
+  //}}}
+  //{{{
+  void decodeSlices (sMpeg2job* job) {
+  // decode slices serially or spread across slice threads
+
+    // slice decoders see this picture's header values and frame pointers
+    for (auto slice : mSlices)
+      static_cast<sMpeg2picture&>(*slice) = job->mPicture;
+
+    mSliceJob = job;
+    mNextSlice = 0;
+    if (mSliceThreads.empty())
+      decodeSliceList (mSlices[0]);
+    else {
+      //{{{  wake slice threads, help out, wait for them
+      {
+      std::unique_lock<std::mutex> lock (mSliceMutex);
+      mBusySliceThreads = (int)mSliceThreads.size();
+      mSliceGeneration++;
+      }
+      mSliceStart.notify_all();
+
+      decodeSliceList (mSlices[0]);
+
+      std::unique_lock<std::mutex> lock (mSliceMutex);
+      mSliceDone.wait (lock, [&]() { return mBusySliceThreads == 0; });
+      }
+      //}}}
+    }
+  //}}}
+  //{{{
+  void decodeSliceList (cMpeg2slice* slice) {
+  // take slices until none left, slices write disjoint macroblock rows of mCurrentFrame
+
+    auto& slicePtrs = mSliceJob->mSlicePtrs;
+    for (int i = mNextSlice++; i < (int)slicePtrs.size(); i = mNextSlice++)
+      slice->decodeSlice (slicePtrs[i], mSliceJob->mSliceEnd);
+    }
+  //}}}
+  //{{{
+  void sliceThread (int index) {
+
+    int generation = 0;
+    while (true) {
+      {
+      std::unique_lock<std::mutex> lock (mSliceMutex);
+      mSliceStart.wait (lock, [&]() { return mExitSliceThreads || (mSliceGeneration != generation); });
+      if (mExitSliceThreads)
+        return;
+      generation = mSliceGeneration;
+      }
+
+      decodeSliceList (mSlices[index]);
+
+      std::unique_lock<std::mutex> lock (mSliceMutex);
+      if (--mBusySliceThreads == 0)
+        mSliceDone.notify_one();
+      }
+    }
+  //}}}
+  //{{{
+  void stopSliceThreads() {
+
+    {
+    std::unique_lock<std::mutex> lock (mSliceMutex);
+    mExitSliceThreads = true;
+    }
+    mSliceStart.notify_all();
+
+    for (auto& thread : mSliceThreads)
+      thread.join();
+    mSliceThreads.clear();
+
+    mExitSliceThreads = false;
+    }
+  //}}}
+
+  //{{{
+  void queueJob (sMpeg2job* job) {
+  // I/P pictures decode in order on one thread, B pictures on the other
+
+    auto& thread = mPictureThreads[(job->mPicture.mPictureCodingType == B_TYPE) ? 1 : 0];
+
+    std::unique_lock<std::mutex> lock (thread.mMutex);
+    thread.mJobs.push_back (job);
+    thread.mPending++;
+    thread.mCond.notify_all();
+    }
+  //}}}
+  //{{{
+  void pictureThread (sMpeg2pictureThread& thread) {
+
+    while (true) {
+      sMpeg2job* job;
+      {
+      std::unique_lock<std::mutex> lock (thread.mMutex);
+      thread.mCond.wait (lock, [&]() { return thread.mExit || !thread.mJobs.empty(); });
+      if (thread.mJobs.empty())
+        return;
+      job = thread.mJobs.front();
+      thread.mJobs.pop_front();
+      }
+
+      decodeJob (job, &thread.mSlice);
+      delete job;
+
+      std::unique_lock<std::mutex> lock (thread.mMutex);
+      thread.mPending--;
+      thread.mCond.notify_all();
+      }
+    }
+  //}}}
+  //{{{
+  void stopPictureThreads() {
+  // picture threads drain their queues before exiting
+
+    for (auto& thread : mPictureThreads)
+      if (thread.mThread.joinable()) {
+        {
+        std::unique_lock<std::mutex> lock (thread.mMutex);
+        thread.mExit = true;
+        }
+        thread.mCond.notify_all();
+        thread.mThread.join();
+        }
+    }
+  //}}}
 
   //{{{  vars
-  int16_t* mBlock[6];
+  static const int kFrames = 3;              // forward, backward, B
+  static const int kFrameThreadedFrames = 8; // plus queued pictures
+  static const int kConsumerFrames = 4;      // held from getNearestVidFrame, plus maxVidFrames in pts index
+  static constexpr int kAcquireTimeoutMs = 500; // then picture dropped, consumer holding every frame
 
-  uint8_t* mAuxFrame[3];
-  uint8_t* mCurrentFrame[3];
-  uint8_t* mForwardRefFrame[3];
-  uint8_t* mBackwardRefFrame[3];
+  cMpeg2framePool mFramePool;
+  sMpeg2job mJob;
 
   int mLoadVidFrame = 0;
-  int mMaxVidFrame = maxVidFrames;
-  cYuvFrame mYuvFrames[maxVidFrames];
+  int mDroppedPictures = 0;
 
-  // bitStream
-  int8_t mBitCount = 0;
-  uint32_t m32bits = 0;
-  uint8_t* mBufferPtr = NULL;
-  uint8_t* mBufferEnd = NULL;
-  bool mGotSequenceHeader = false;
+  // output frames by pts then frameNum, es input can repeat a pts, each holds a ref
+  std::mutex mVidFramesMutex;
+  std::map<std::pair<uint64_t,int>, cMpeg2frame*> mVidFrames;
 
-  // pic size
-  int mWidth = 0;
-  int mHeight = 0;
-  int mChromaWidth = 0;
-  int mChromaHeight = 0;
-  int mMbWidth = 0;
-  int mMbHeight = 0;
-
-  // header values
-  int mTemporalReference = 0;
-  int mPictureCodingType = 0;
+  bool mGotSequenceHeader = false;
 
-  int qScaleType = 0;
-  int mAlternateScan = 0;
-  int mQuantizerScale = 0;
-  int mFcode[2][2];
-  int mIntraDcPrecision = 0;
-  int mFramePredFrameDct = 0;
-  int mConcealmentMotionVecs = 0;
-  int mIntraVlcFormat = 0;
+  cMpeg2mc::eIsa mIsa = cMpeg2mc::eScalar;
+  eDecodeMode mDecodeMode = eDecodeAll;
+  int mGoodAnchors = 0;
+  tFrameCallback mFrameCallback;
+
+  // slices, mSlices[0] decodes on caller thread
+  std::vector<cMpeg2slice*> mSlices;
+  sMpeg2job* mSliceJob = nullptr;
+  std::atomic<int> mNextSlice = { 0 };
+
+  std::vector<std::thread> mSliceThreads;
+  std::mutex mSliceMutex;
+  std::condition_variable mSliceStart;
+  std::condition_variable mSliceDone;
+  int mSliceGeneration = 0;
+  int mBusySliceThreads = 0;
+  bool mExitSliceThreads = false;
+
+  // frame threading, [0] I/P pictures, [1] B pictures
+  sMpeg2pictureThread mPictureThreads[2];
   //}}}
   };
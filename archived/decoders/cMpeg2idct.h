@@ -0,0 +1,557 @@
+// cMpeg2idct.h - mpeg2 8x8 inverse dct, scalar, SSE2, AVX2, NEON, picked at runtime by cpu
+// - AP-922 row pass, tangent column pass, every isa bit exact with the scalar reference
+#pragma once
+#include "cMpeg2mc.h"
+
+//{{{  row tables, pairs of coefficients for each row, w05 w04 w01 w00 w13 w12 w09 w08 ...
+//{{{
+alignas(64) static const int16_t kIdctTab04[] = {
+  16384, 21407, 16384,  8867, 16384, -8867, 16384,-21407,  // w05 w04 w01 w00 w13 w12 w09 w08
+  16384,  8867,-16384,-21407,-16384, 21407, 16384, -8867,  // w07 w06 w03 w02 w15 w14 w11 w10
+  22725, 19266, 19266, -4520, 12873,-22725,  4520,-12873,
+  12873,  4520,-22725,-12873,  4520, 19266, 19266,-22725 };
+//}}}
+//{{{
+alignas(64) static const int16_t kIdctTab17[] = {
+  22725, 29692, 22725, 12299, 22725,-12299, 22725,-29692,
+  22725, 12299,-22725,-29692,-22725, 29692, 22725,-12299,
+  31521, 26722, 26722, -6270, 17855,-31521,  6270,-17855,
+  17855,  6270,-31521,-17855,  6270, 26722, 26722,-31521 };
+//}}}
+//{{{
+alignas(64) static const int16_t kIdctTab26[] = {
+  21407, 27969, 21407, 11585, 21407,-11585, 21407,-27969,
+  21407, 11585,-21407,-27969,-21407, 27969, 21407,-11585,
+  29692, 25172, 25172, -5906, 16819,-29692,  5906,-16819,
+  16819,  5906,-29692,-16819,  5906, 25172, 25172,-29692 };
+//}}}
+//{{{
+alignas(64) static const int16_t kIdctTab35[] = {
+  19266, 25172, 19266, 10426, 19266,-10426, 19266,-25172,
+  19266, 10426,-19266,-25172,-19266, 25172, 19266,-10426,
+  26722, 22654, 22654, -5315, 15137,-26722,  5315,-15137,
+  15137,  5315,-26722,-15137,  5315, 22654, 22654,-26722 };
+//}}}
+
+// table for each row
+static const int16_t* const kIdctRowTab[8] = {
+  kIdctTab04, kIdctTab17, kIdctTab26, kIdctTab35, kIdctTab04, kIdctTab35, kIdctTab26, kIdctTab17 };
+//}}}
+//{{{  column pass constants
+#define IDCT_TAN1        13036
+#define IDCT_TAN2        27146
+#define IDCT_TAN3       -21746
+#define IDCT_COS4       -19195
+#define IDCT_ROUND_ERR   1
+#define IDCT_ROUND_COL   32
+#define IDCT_ROUND_CORR  31
+//}}}
+//{{{  reduced resolution 4 point constants, 13 bit, basis scaled by sqrt(4/8)
+#define IDCT4_A          2896  // sqrt(1/8)
+#define IDCT4_B          3784  // cos(pi/8) / 2
+#define IDCT4_C          1567  // sin(pi/8) / 2
+#define IDCT4_ROW_SHIFT  10
+#define IDCT4_COL_SHIFT  16
+//}}}
+
+class cMpeg2idct {
+public:
+  // in place, block 16 byte aligned
+  typedef void (*tIdct) (int16_t* block);
+  // reduced resolution, low frequency n x n coefficients to n x n pixels in dst, n = 8 >> scaleShift
+  typedef void (*tIdctScaled) (const int16_t* block, int scaleShift, int16_t* dst);
+
+  //{{{
+  static tIdct getIdct (cMpeg2mc::eIsa isa) {
+  // return idct for isa, nullptr if not built for this target
+
+    switch (isa) {
+      case cMpeg2mc::eScalar: return idctScalar;
+    #if defined(MPEG2MC_SSE2)
+      case cMpeg2mc::eSse2: return idctSse2;
+      case cMpeg2mc::eAvx2: return cMpeg2mc::hasAvx2() ? idctAvx2 : nullptr;
+    #elif defined(MPEG2MC_NEON)
+      case cMpeg2mc::eNeon: return idctNeon;
+    #endif
+      default: return nullptr;
+      }
+    }
+  //}}}
+  static tIdct getBestIdct() { return getIdct (cMpeg2mc::getBestIsa()); }
+  //{{{
+  static tIdctScaled getIdctScaled (cMpeg2mc::eIsa isa) {
+  // return reduced resolution idct for isa, every isa bit exact with the scalar, neon uses the scalar
+
+    switch (isa) {
+    #if defined(MPEG2MC_SSE2)
+      case cMpeg2mc::eSse2:
+      case cMpeg2mc::eAvx2: return idctScaledSse2;
+    #endif
+      default: return idctScaledScalar;
+      }
+    }
+  //}}}
+
+private:
+  // reduced resolution, n point idct scaled by sqrt(n/8) each way, dc gain matches the 8x8 idct
+  //{{{
+  static void idctScaledScalar (const int16_t* block, int scaleShift, int16_t* dst) {
+  // scaleShift 3 is dc only
+
+    if (scaleShift >= 3)
+      dst[0] = (int16_t)((block[0] + 4) >> 3);
+    else if (scaleShift == 2)
+      idct2x2 (block, dst);
+    else
+      idct4x4 (block, dst);
+    }
+  //}}}
+  //{{{
+  static void idct2x2 (const int16_t* block, int16_t* dst) {
+  // every basis value is sqrt(1/8), sums of four coefficients over 8, rounded
+
+    int s0 = block[0] + block[1];
+    int d0 = block[0] - block[1];
+    int s1 = block[8] + block[9];
+    int d1 = block[8] - block[9];
+
+    dst[0] = sat16 ((s0 + s1 + 4) >> 3);
+    dst[1] = sat16 ((d0 + d1 + 4) >> 3);
+    dst[2] = sat16 ((s0 - s1 + 4) >> 3);
+    dst[3] = sat16 ((d0 - d1 + 4) >> 3);
+    }
+  //}}}
+  //{{{
+  static void idct4x4 (const int16_t* block, int16_t* dst) {
+  // fixed point 4 point butterflies, rows kept with IDCT4_ROW_BITS extra bits for the columns
+
+    int rows[4][4];
+    for (int row = 0; row < 4; row++) {
+      const int16_t* r = block + row * 8;
+      int e0 = (r[0] + r[2]) * IDCT4_A;
+      int e1 = (r[0] - r[2]) * IDCT4_A;
+      int o0 = r[1] * IDCT4_B + r[3] * IDCT4_C;
+      int o1 = r[1] * IDCT4_C - r[3] * IDCT4_B;
+
+      const int round = 1 << (IDCT4_ROW_SHIFT - 1);
+      rows[row][0] = (e0 + o0 + round) >> IDCT4_ROW_SHIFT;
+      rows[row][1] = (e1 + o1 + round) >> IDCT4_ROW_SHIFT;
+      rows[row][2] = (e1 - o1 + round) >> IDCT4_ROW_SHIFT;
+      rows[row][3] = (e0 - o0 + round) >> IDCT4_ROW_SHIFT;
+      }
+
+    for (int col = 0; col < 4; col++) {
+      int e0 = (rows[0][col] + rows[2][col]) * IDCT4_A;
+      int e1 = (rows[0][col] - rows[2][col]) * IDCT4_A;
+      int o0 = rows[1][col] * IDCT4_B + rows[3][col] * IDCT4_C;
+      int o1 = rows[1][col] * IDCT4_C - rows[3][col] * IDCT4_B;
+
+      const int round = 1 << (IDCT4_COL_SHIFT - 1);
+      dst[col]      = sat16 ((e0 + o0 + round) >> IDCT4_COL_SHIFT);
+      dst[4 + col]  = sat16 ((e1 + o1 + round) >> IDCT4_COL_SHIFT);
+      dst[8 + col]  = sat16 ((e1 - o1 + round) >> IDCT4_COL_SHIFT);
+      dst[12 + col] = sat16 ((e0 - o0 + round) >> IDCT4_COL_SHIFT);
+      }
+    }
+  //}}}
+
+  // scalar reference, sse2 arithmetic one lane at a time
+  //{{{
+  static inline int16_t sat16 (int value) {
+    return (int16_t)((value < -32768) ? -32768 : ((value > 32767) ? 32767 : value));
+    }
+  //}}}
+  static inline int16_t adds (int a, int b) { return sat16 (a + b); }
+  static inline int16_t subs (int a, int b) { return sat16 (a - b); }
+  static inline int16_t mulhi (int a, int b) { return (int16_t)((a * b) >> 16); }
+  //{{{
+  static void idctScalar (int16_t* block) {
+
+    // rows, even and odd coefficient sums, rounded and narrowed
+    for (int row = 0; row < 8; row++) {
+      int16_t* r = block + 8 * row;
+      const int16_t* tab = kIdctRowTab[row];
+
+      int even[4];
+      int odd[4];
+      for (int i = 0; i < 4; i++) {
+        even[i] = r[0] * tab[2*i] + r[2] * tab[2*i+1] + r[4] * tab[8+2*i] + r[6] * tab[9+2*i] + 1024;
+        odd[i] = r[1] * tab[16+2*i] + r[3] * tab[17+2*i] + r[5] * tab[24+2*i] + r[7] * tab[25+2*i];
+        }
+      for (int i = 0; i < 4; i++) {
+        r[i] = sat16 ((even[i] + odd[i]) >> 11);
+        r[7-i] = sat16 ((even[i] - odd[i]) >> 11);
+        }
+      }
+
+    // columns
+    for (int col = 0; col < 8; col++) {
+      int16_t* c = block + col;
+      int x0 = c[8*0], x1 = c[8*1], x2 = c[8*2], x3 = c[8*3], x4 = c[8*4], x5 = c[8*5], x6 = c[8*6], x7 = c[8*7];
+
+      int tp765 = adds (mulhi (x7, IDCT_TAN1), x1);
+      int tp465 = subs (mulhi (x1, IDCT_TAN1), x7);
+      int tm765 = adds (mulhi (x5, IDCT_TAN3), adds (x5, x3));
+      int tm465 = subs (x5, adds (mulhi (x3, IDCT_TAN3), x3));
+
+      int t7 = adds (adds (tp765, tm765), IDCT_ROUND_ERR);
+      int tp65 = subs (tp765, tm765);
+      int t4 = adds (tp465, tm465);
+      int tm65 = adds (subs (tp465, tm465), IDCT_ROUND_ERR);
+
+      int tmp1 = adds (tp65, tm65);
+      int t6 = (int16_t)(adds (mulhi (tmp1, IDCT_COS4), tmp1) | IDCT_ROUND_ERR);
+      int tmp2 = subs (tp65, tm65);
+      int t5 = (int16_t)(adds (mulhi (tmp2, IDCT_COS4), tmp2) | IDCT_ROUND_ERR);
+
+      int tp03 = adds (x0, x4);
+      int tp12 = subs (x0, x4);
+      int tm03 = adds (mulhi (x6, IDCT_TAN2), x2);
+      int tm12 = subs (mulhi (x2, IDCT_TAN2), x6);
+
+      int t0 = adds (adds (tp03, tm03), IDCT_ROUND_COL);
+      int t3 = adds (subs (tp03, tm03), IDCT_ROUND_CORR);
+      int t1 = adds (adds (tp12, tm12), IDCT_ROUND_COL);
+      int t2 = adds (subs (tp12, tm12), IDCT_ROUND_CORR);
+
+      c[8*0] = adds (t0, t7) >> 6;
+      c[8*7] = subs (t0, t7) >> 6;
+      c[8*1] = adds (t1, t6) >> 6;
+      c[8*6] = subs (t1, t6) >> 6;
+      c[8*2] = adds (t2, t5) >> 6;
+      c[8*5] = subs (t2, t5) >> 6;
+      c[8*3] = adds (t3, t4) >> 6;
+      c[8*4] = subs (t3, t4) >> 6;
+      }
+    }
+  //}}}
+
+#if defined(MPEG2MC_SSE2)
+  //{{{
+  static inline void transpose4x4Sse2 (__m128i w01, __m128i w23, __m128i& v01, __m128i& v23) {
+  // 4x4 int16, rows w0|w1, w2|w3 in, columns v0|v1, v2|v3 out
+
+    __m128i a = _mm_unpacklo_epi16 (w01, _mm_srli_si128 (w01, 8));
+    __m128i b = _mm_unpacklo_epi16 (w23, _mm_srli_si128 (w23, 8));
+    v01 = _mm_unpacklo_epi32 (a, b);
+    v23 = _mm_unpackhi_epi32 (a, b);
+    }
+  //}}}
+  //{{{
+  template <int shift> static inline void idct4Sse2 (__m128i v01, __m128i v23, __m128i& w01, __m128i& w23) {
+  // 4 point idct down the lanes of v0..v3, madd of interleaved pairs, same sums as idct4x4
+
+    const __m128i kAA = _mm_set_epi16 (IDCT4_A, IDCT4_A, IDCT4_A, IDCT4_A, IDCT4_A, IDCT4_A, IDCT4_A, IDCT4_A);
+    const __m128i kAmA = _mm_set_epi16 (-IDCT4_A, IDCT4_A, -IDCT4_A, IDCT4_A, -IDCT4_A, IDCT4_A, -IDCT4_A, IDCT4_A);
+    const __m128i kBC = _mm_set_epi16 (IDCT4_C, IDCT4_B, IDCT4_C, IDCT4_B, IDCT4_C, IDCT4_B, IDCT4_C, IDCT4_B);
+    const __m128i kCmB = _mm_set_epi16 (-IDCT4_B, IDCT4_C, -IDCT4_B, IDCT4_C, -IDCT4_B, IDCT4_C, -IDCT4_B, IDCT4_C);
+    const __m128i round = _mm_set1_epi32 (1 << (shift - 1));
+
+    __m128i v02 = _mm_unpacklo_epi16 (v01, v23);
+    __m128i v13 = _mm_unpackhi_epi16 (v01, v23);
+    __m128i e0 = _mm_add_epi32 (_mm_madd_epi16 (v02, kAA), round);
+    __m128i e1 = _mm_add_epi32 (_mm_madd_epi16 (v02, kAmA), round);
+    __m128i o0 = _mm_madd_epi16 (v13, kBC);
+    __m128i o1 = _mm_madd_epi16 (v13, kCmB);
+
+    w01 = _mm_packs_epi32 (_mm_srai_epi32 (_mm_add_epi32 (e0, o0), shift), _mm_srai_epi32 (_mm_add_epi32 (e1, o1), shift));
+    w23 = _mm_packs_epi32 (_mm_srai_epi32 (_mm_sub_epi32 (e1, o1), shift), _mm_srai_epi32 (_mm_sub_epi32 (e0, o0), shift));
+    }
+  //}}}
+  //{{{
+  static void idctScaledSse2 (const int16_t* block, int scaleShift, int16_t* dst) {
+  // 4x4 as two transposes and two passes down the lanes, 2x2 and dc scalar, already a handful of adds
+
+    if (scaleShift != 1) {
+      idctScaledScalar (block, scaleShift, dst);
+      return;
+      }
+
+    __m128i r01 = _mm_unpacklo_epi64 (_mm_loadl_epi64 ((const __m128i*)block), _mm_loadl_epi64 ((const __m128i*)(block + 8)));
+    __m128i r23 = _mm_unpacklo_epi64 (_mm_loadl_epi64 ((const __m128i*)(block + 16)), _mm_loadl_epi64 ((const __m128i*)(block + 24)));
+
+    // rows, lanes are rows after transpose, rows of coefficients to rows of idct outputs
+    __m128i v01, v23, w01, w23;
+    transpose4x4Sse2 (r01, r23, v01, v23);
+    idct4Sse2<IDCT4_ROW_SHIFT> (v01, v23, w01, w23);
+
+    // columns, lanes are columns after transpose back, output rows in order
+    transpose4x4Sse2 (w01, w23, v01, v23);
+    idct4Sse2<IDCT4_COL_SHIFT> (v01, v23, w01, w23);
+
+    _mm_storeu_si128 ((__m128i*)dst, w01);
+    _mm_storeu_si128 ((__m128i*)(dst + 8), w23);
+    }
+  //}}}
+  //{{{
+  static inline void idctColumnsSse2 (int16_t* block) {
+
+    __m128i x0 = *(__m128i*)(block+8*0);
+    __m128i x1 = *(__m128i*)(block+8*1);
+    __m128i x2 = *(__m128i*)(block+8*2);
+    __m128i x3 = *(__m128i*)(block+8*3);
+    __m128i x4 = *(__m128i*)(block+8*4);
+    __m128i x5 = *(__m128i*)(block+8*5);
+    __m128i x6 = *(__m128i*)(block+8*6);
+    __m128i x7 = *(__m128i*)(block+8*7);
+
+    __m128i tan1 = _mm_set1_epi16 (IDCT_TAN1);
+    __m128i tan2 = _mm_set1_epi16 (IDCT_TAN2);
+    __m128i tan3 = _mm_set1_epi16 (IDCT_TAN3);
+    __m128i cos4 = _mm_set1_epi16 (IDCT_COS4);
+    __m128i round_err = _mm_set1_epi16 (IDCT_ROUND_ERR);
+    __m128i round_col = _mm_set1_epi16 (IDCT_ROUND_COL);
+    __m128i round_corr = _mm_set1_epi16 (IDCT_ROUND_CORR);
+
+    __m128i tp765 = _mm_adds_epi16 (_mm_mulhi_epi16 (x7, tan1), x1);
+    __m128i tp465 = _mm_subs_epi16 (_mm_mulhi_epi16 (x1, tan1), x7);
+    __m128i tm765 = _mm_adds_epi16 (_mm_mulhi_epi16 (x5, tan3), _mm_adds_epi16 (x5, x3));
+    __m128i tm465 = _mm_subs_epi16 (x5, _mm_adds_epi16 (_mm_mulhi_epi16 (x3, tan3), x3));
+
+    __m128i t7 = _mm_adds_epi16 (_mm_adds_epi16(tp765, tm765), round_err);
+    __m128i tp65 = _mm_subs_epi16 (tp765, tm765);
+    __m128i t4 = _mm_adds_epi16 (tp465, tm465);
+    __m128i tm65 = _mm_adds_epi16 (_mm_subs_epi16(tp465, tm465), round_err);
+
+    __m128i tmp1 = _mm_adds_epi16 (tp65, tm65);
+    __m128i t6 = _mm_or_si128 (_mm_adds_epi16(_mm_mulhi_epi16 (tmp1, cos4), tmp1), round_err);
+    __m128i tmp2 = _mm_subs_epi16 (tp65, tm65);
+    __m128i t5 = _mm_or_si128 (_mm_adds_epi16(_mm_mulhi_epi16 (tmp2, cos4), tmp2), round_err);
+
+    __m128i tp03 = _mm_adds_epi16 (x0, x4);
+    __m128i tp12 = _mm_subs_epi16 (x0, x4);
+    __m128i tm03 = _mm_adds_epi16 (_mm_mulhi_epi16( x6, tan2), x2);
+    __m128i tm12 = _mm_subs_epi16 (_mm_mulhi_epi16 (x2, tan2), x6);
+
+    __m128i t0 = _mm_adds_epi16 (_mm_adds_epi16 (tp03, tm03), round_col);
+    __m128i t3 = _mm_adds_epi16 (_mm_subs_epi16 (tp03, tm03), round_corr);
+    __m128i t1 = _mm_adds_epi16 (_mm_adds_epi16 (tp12, tm12), round_col);
+    __m128i t2 = _mm_adds_epi16 (_mm_subs_epi16 (tp12, tm12), round_corr);
+
+    *(__m128i*)(block+8*0) = _mm_srai_epi16 (_mm_adds_epi16(t0, t7), 6);
+    *(__m128i*)(block+8*7) = _mm_srai_epi16 (_mm_subs_epi16(t0, t7), 6);
+    *(__m128i*)(block+8*1) = _mm_srai_epi16 (_mm_adds_epi16(t1, t6), 6);
+    *(__m128i*)(block+8*6) = _mm_srai_epi16 (_mm_subs_epi16(t1, t6), 6);
+    *(__m128i*)(block+8*2) = _mm_srai_epi16 (_mm_adds_epi16(t2, t5), 6);
+    *(__m128i*)(block+8*5) = _mm_srai_epi16 (_mm_subs_epi16(t2, t5), 6);
+    *(__m128i*)(block+8*3) = _mm_srai_epi16 (_mm_adds_epi16(t3, t4), 6);
+    *(__m128i*)(block+8*4) = _mm_srai_epi16 (_mm_subs_epi16(t3, t4), 6);
+    }
+  //}}}
+  //{{{
+  static void idctSse2 (int16_t* block) {
+
+    //{{{  DCT_8_INV_ROWX2 macro
+    #define DCT_8_INV_ROWX2(tab1, tab2) {  \
+      r1 = _mm_shufflelo_epi16 (r1, _MM_SHUFFLE(3, 1, 2, 0));  \
+      r1 = _mm_shufflehi_epi16 (r1, _MM_SHUFFLE(3, 1, 2, 0));  \
+      a0 = _mm_madd_epi16 (_mm_shuffle_epi32 (r1, _MM_SHUFFLE(0, 0, 0, 0)), *(__m128i*)(tab1+8*0));  \
+      a1 = _mm_madd_epi16 (_mm_shuffle_epi32 (r1, _MM_SHUFFLE(1, 1, 1, 1)), *(__m128i*)(tab1+8*2));  \
+      a2 = _mm_madd_epi16 (_mm_shuffle_epi32 (r1, _MM_SHUFFLE(2, 2, 2, 2)), *(__m128i*)(tab1+8*1));  \
+      a3 = _mm_madd_epi16 (_mm_shuffle_epi32 (r1, _MM_SHUFFLE(3, 3, 3, 3)), *(__m128i*)(tab1+8*3));  \
+      s0 = _mm_add_epi32 (_mm_add_epi32 (a0, round_row), a2);  \
+      s1 = _mm_add_epi32 (a1, a3);  \
+      p0 = _mm_srai_epi32 (_mm_add_epi32 (s0, s1), 11);  \
+      p1 = _mm_shuffle_epi32 (_mm_srai_epi32 (_mm_sub_epi32(s0, s1), 11), _MM_SHUFFLE(0, 1, 2, 3));  \
+      r2 = _mm_shufflelo_epi16 (r2, _MM_SHUFFLE(3, 1, 2, 0));  \
+      r2 = _mm_shufflehi_epi16 (r2, _MM_SHUFFLE(3, 1, 2, 0));  \
+      b0 = _mm_madd_epi16 (_mm_shuffle_epi32 (r2, _MM_SHUFFLE(0, 0, 0, 0)), *(__m128i*)(tab2+8*0));  \
+      b1 = _mm_madd_epi16 (_mm_shuffle_epi32 (r2, _MM_SHUFFLE(1, 1, 1, 1)), *(__m128i*)(tab2+8*2));  \
+      b2 = _mm_madd_epi16 (_mm_shuffle_epi32 (r2, _MM_SHUFFLE(2, 2, 2, 2)), *(__m128i*)(tab2+8*1));  \
+      b3 = _mm_madd_epi16 (_mm_shuffle_epi32 (r2, _MM_SHUFFLE(3, 3, 3, 3)), *(__m128i*)(tab2+8*3));  \
+      s2 = _mm_add_epi32 (_mm_add_epi32 (b0, round_row), b2);  \
+      s3 = _mm_add_epi32 (b3, b1);  \
+      p2 = _mm_srai_epi32 (_mm_add_epi32 (s2, s3), 11);  \
+      p3 = _mm_shuffle_epi32 (_mm_srai_epi32 (_mm_sub_epi32(s2, s3), 11), _MM_SHUFFLE(0, 1, 2, 3));  \
+      r1 = _mm_packs_epi32 (p0, p1);  \
+      r2 = _mm_packs_epi32 (p2, p3);  \
+    }
+    //}}}
+    __m128i r1, r2, a0, a1, a2, a3, b0, b1, b2, b3, s0, s1, s2, s3, p0, p1, p2, p3;
+    __m128i round_row = _mm_set_epi16 (0, 1024, 0, 1024, 0, 1024, 0, 1024);
+
+    r1 = *(__m128i*)(block+8*0);
+    r2 = *(__m128i*)(block+8*1);
+    DCT_8_INV_ROWX2(kIdctTab04, kIdctTab17);
+    *(__m128i*)(block+8*0) = r1;
+    *(__m128i*)(block+8*1) = r2;
+
+    r1 = *(__m128i*)(block+8*4);
+    r2 = *(__m128i*)(block+8*7);
+    DCT_8_INV_ROWX2(kIdctTab04, kIdctTab17);
+    *(__m128i*)(block+8*4) = r1;
+    *(__m128i*)(block+8*7) = r2;
+
+    r1 = *(__m128i*)(block+8*2);
+    r2 = *(__m128i*)(block+8*3);
+    DCT_8_INV_ROWX2(kIdctTab26, kIdctTab35);
+    *(__m128i*)(block+8*2) = r1;
+    *(__m128i*)(block+8*3) = r2;
+
+    r1 = *(__m128i*)(block+8*6);
+    r2 = *(__m128i*)(block+8*5);
+    DCT_8_INV_ROWX2(kIdctTab26, kIdctTab35);
+    *(__m128i*)(block+8*6) = r1;
+    *(__m128i*)(block+8*5) = r2;
+    #undef DCT_8_INV_ROWX2
+
+    idctColumnsSse2 (block);
+    }
+  //}}}
+
+  //{{{
+  MPEG2MC_AVX2_TARGET static void idctAvx2 (int16_t* block) {
+  // row pass two row pairs per ymm, rows sharing tables side by side, columns already fill an xmm
+
+    //{{{  DCT_8_INV_ROWX4 macro
+    #define DCT_8_INV_ROWX4(tab1, tab2) {  \
+      __m256i t1a = _mm256_broadcastsi128_si256 (*(__m128i*)(tab1+8*0));  \
+      __m256i t1b = _mm256_broadcastsi128_si256 (*(__m128i*)(tab1+8*1));  \
+      __m256i t1c = _mm256_broadcastsi128_si256 (*(__m128i*)(tab1+8*2));  \
+      __m256i t1d = _mm256_broadcastsi128_si256 (*(__m128i*)(tab1+8*3));  \
+      __m256i t2a = _mm256_broadcastsi128_si256 (*(__m128i*)(tab2+8*0));  \
+      __m256i t2b = _mm256_broadcastsi128_si256 (*(__m128i*)(tab2+8*1));  \
+      __m256i t2c = _mm256_broadcastsi128_si256 (*(__m128i*)(tab2+8*2));  \
+      __m256i t2d = _mm256_broadcastsi128_si256 (*(__m128i*)(tab2+8*3));  \
+      r1 = _mm256_shufflelo_epi16 (r1, _MM_SHUFFLE(3, 1, 2, 0));  \
+      r1 = _mm256_shufflehi_epi16 (r1, _MM_SHUFFLE(3, 1, 2, 0));  \
+      a0 = _mm256_madd_epi16 (_mm256_shuffle_epi32 (r1, _MM_SHUFFLE(0, 0, 0, 0)), t1a);  \
+      a1 = _mm256_madd_epi16 (_mm256_shuffle_epi32 (r1, _MM_SHUFFLE(1, 1, 1, 1)), t1c);  \
+      a2 = _mm256_madd_epi16 (_mm256_shuffle_epi32 (r1, _MM_SHUFFLE(2, 2, 2, 2)), t1b);  \
+      a3 = _mm256_madd_epi16 (_mm256_shuffle_epi32 (r1, _MM_SHUFFLE(3, 3, 3, 3)), t1d);  \
+      s0 = _mm256_add_epi32 (_mm256_add_epi32 (a0, round_row), a2);  \
+      s1 = _mm256_add_epi32 (a1, a3);  \
+      p0 = _mm256_srai_epi32 (_mm256_add_epi32 (s0, s1), 11);  \
+      p1 = _mm256_shuffle_epi32 (_mm256_srai_epi32 (_mm256_sub_epi32(s0, s1), 11), _MM_SHUFFLE(0, 1, 2, 3));  \
+      r2 = _mm256_shufflelo_epi16 (r2, _MM_SHUFFLE(3, 1, 2, 0));  \
+      r2 = _mm256_shufflehi_epi16 (r2, _MM_SHUFFLE(3, 1, 2, 0));  \
+      b0 = _mm256_madd_epi16 (_mm256_shuffle_epi32 (r2, _MM_SHUFFLE(0, 0, 0, 0)), t2a);  \
+      b1 = _mm256_madd_epi16 (_mm256_shuffle_epi32 (r2, _MM_SHUFFLE(1, 1, 1, 1)), t2c);  \
+      b2 = _mm256_madd_epi16 (_mm256_shuffle_epi32 (r2, _MM_SHUFFLE(2, 2, 2, 2)), t2b);  \
+      b3 = _mm256_madd_epi16 (_mm256_shuffle_epi32 (r2, _MM_SHUFFLE(3, 3, 3, 3)), t2d);  \
+      s2 = _mm256_add_epi32 (_mm256_add_epi32 (b0, round_row), b2);  \
+      s3 = _mm256_add_epi32 (b3, b1);  \
+      p2 = _mm256_srai_epi32 (_mm256_add_epi32 (s2, s3), 11);  \
+      p3 = _mm256_shuffle_epi32 (_mm256_srai_epi32 (_mm256_sub_epi32(s2, s3), 11), _MM_SHUFFLE(0, 1, 2, 3));  \
+      r1 = _mm256_packs_epi32 (p0, p1);  \
+      r2 = _mm256_packs_epi32 (p2, p3);  \
+    }
+    //}}}
+    //{{{  LOAD_ROWS, STORE_ROWS macros
+    #define LOAD_ROWS(lo, hi) _mm256_inserti128_si256 (_mm256_castsi128_si256 (*(__m128i*)(block+8*lo)), *(__m128i*)(block+8*hi), 1)
+    #define STORE_ROWS(value, lo, hi) {  \
+      *(__m128i*)(block+8*lo) = _mm256_castsi256_si128 (value);  \
+      *(__m128i*)(block+8*hi) = _mm256_extracti128_si256 (value, 1);  \
+    }
+    //}}}
+    __m256i r1, r2, a0, a1, a2, a3, b0, b1, b2, b3, s0, s1, s2, s3, p0, p1, p2, p3;
+    __m256i round_row = _mm256_set1_epi32 (1024);
+
+    r1 = LOAD_ROWS (0, 4);
+    r2 = LOAD_ROWS (1, 7);
+    DCT_8_INV_ROWX4(kIdctTab04, kIdctTab17);
+    STORE_ROWS (r1, 0, 4);
+    STORE_ROWS (r2, 1, 7);
+
+    r1 = LOAD_ROWS (2, 6);
+    r2 = LOAD_ROWS (3, 5);
+    DCT_8_INV_ROWX4(kIdctTab26, kIdctTab35);
+    STORE_ROWS (r1, 2, 6);
+    STORE_ROWS (r2, 3, 5);
+
+    #undef DCT_8_INV_ROWX4
+    #undef LOAD_ROWS
+    #undef STORE_ROWS
+
+    idctColumnsSse2 (block);
+    }
+  //}}}
+#endif
+
+#if defined(MPEG2MC_NEON)
+  //{{{
+  static inline int16x8_t mulhiNeon (int16x8_t a, int16x8_t b) {
+  // (a * b) >> 16, as _mm_mulhi_epi16
+
+    return vcombine_s16 (vshrn_n_s32 (vmull_s16 (vget_low_s16 (a), vget_low_s16 (b)), 16),
+                         vshrn_n_s32 (vmull_s16 (vget_high_s16 (a), vget_high_s16 (b)), 16));
+    }
+  //}}}
+  //{{{
+  static void idctNeon (int16_t* block) {
+
+    // rows, table pairs deinterleaved to coefficient per input
+    for (int row = 0; row < 8; row++) {
+      int16_t* r = block + 8 * row;
+      const int16_t* tab = kIdctRowTab[row];
+
+      int16x4x2_t t02 = vld2_s16 (tab);
+      int16x4x2_t t46 = vld2_s16 (tab + 8);
+      int16x4x2_t t13 = vld2_s16 (tab + 16);
+      int16x4x2_t t57 = vld2_s16 (tab + 24);
+
+      int32x4_t even = vmlal_n_s16 (vmlal_n_s16 (vmlal_n_s16 (vmlal_n_s16 (vdupq_n_s32 (1024),
+                         t02.val[0], r[0]), t02.val[1], r[2]), t46.val[0], r[4]), t46.val[1], r[6]);
+      int32x4_t odd = vmlal_n_s16 (vmlal_n_s16 (vmlal_n_s16 (vmull_n_s16 (
+                         t13.val[0], r[1]), t13.val[1], r[3]), t57.val[0], r[5]), t57.val[1], r[7]);
+
+      int16x4_t lo = vqmovn_s32 (vshrq_n_s32 (vaddq_s32 (even, odd), 11));
+      int16x4_t hi = vrev64_s16 (vqmovn_s32 (vshrq_n_s32 (vsubq_s32 (even, odd), 11)));
+      vst1q_s16 (r, vcombine_s16 (lo, hi));
+      }
+
+    // columns, eight at once
+    int16x8_t x0 = vld1q_s16 (block+8*0);
+    int16x8_t x1 = vld1q_s16 (block+8*1);
+    int16x8_t x2 = vld1q_s16 (block+8*2);
+    int16x8_t x3 = vld1q_s16 (block+8*3);
+    int16x8_t x4 = vld1q_s16 (block+8*4);
+    int16x8_t x5 = vld1q_s16 (block+8*5);
+    int16x8_t x6 = vld1q_s16 (block+8*6);
+    int16x8_t x7 = vld1q_s16 (block+8*7);
+
+    int16x8_t tan1 = vdupq_n_s16 (IDCT_TAN1);
+    int16x8_t tan2 = vdupq_n_s16 (IDCT_TAN2);
+    int16x8_t tan3 = vdupq_n_s16 (IDCT_TAN3);
+    int16x8_t cos4 = vdupq_n_s16 (IDCT_COS4);
+    int16x8_t round_err = vdupq_n_s16 (IDCT_ROUND_ERR);
+    int16x8_t round_col = vdupq_n_s16 (IDCT_ROUND_COL);
+    int16x8_t round_corr = vdupq_n_s16 (IDCT_ROUND_CORR);
+
+    int16x8_t tp765 = vqaddq_s16 (mulhiNeon (x7, tan1), x1);
+    int16x8_t tp465 = vqsubq_s16 (mulhiNeon (x1, tan1), x7);
+    int16x8_t tm765 = vqaddq_s16 (mulhiNeon (x5, tan3), vqaddq_s16 (x5, x3));
+    int16x8_t tm465 = vqsubq_s16 (x5, vqaddq_s16 (mulhiNeon (x3, tan3), x3));
+
+    int16x8_t t7 = vqaddq_s16 (vqaddq_s16 (tp765, tm765), round_err);
+    int16x8_t tp65 = vqsubq_s16 (tp765, tm765);
+    int16x8_t t4 = vqaddq_s16 (tp465, tm465);
+    int16x8_t tm65 = vqaddq_s16 (vqsubq_s16 (tp465, tm465), round_err);
+
+    int16x8_t tmp1 = vqaddq_s16 (tp65, tm65);
+    int16x8_t t6 = vorrq_s16 (vqaddq_s16 (mulhiNeon (tmp1, cos4), tmp1), round_err);
+    int16x8_t tmp2 = vqsubq_s16 (tp65, tm65);
+    int16x8_t t5 = vorrq_s16 (vqaddq_s16 (mulhiNeon (tmp2, cos4), tmp2), round_err);
+
+    int16x8_t tp03 = vqaddq_s16 (x0, x4);
+    int16x8_t tp12 = vqsubq_s16 (x0, x4);
+    int16x8_t tm03 = vqaddq_s16 (mulhiNeon (x6, tan2), x2);
+    int16x8_t tm12 = vqsubq_s16 (mulhiNeon (x2, tan2), x6);
+
+    int16x8_t t0 = vqaddq_s16 (vqaddq_s16 (tp03, tm03), round_col);
+    int16x8_t t3 = vqaddq_s16 (vqsubq_s16 (tp03, tm03), round_corr);
+    int16x8_t t1 = vqaddq_s16 (vqaddq_s16 (tp12, tm12), round_col);
+    int16x8_t t2 = vqaddq_s16 (vqsubq_s16 (tp12, tm12), round_corr);
+
+    vst1q_s16 (block+8*0, vshrq_n_s16 (vqaddq_s16 (t0, t7), 6));
+    vst1q_s16 (block+8*7, vshrq_n_s16 (vqsubq_s16 (t0, t7), 6));
+    vst1q_s16 (block+8*1, vshrq_n_s16 (vqaddq_s16 (t1, t6), 6));
+    vst1q_s16 (block+8*6, vshrq_n_s16 (vqsubq_s16 (t1, t6), 6));
+    vst1q_s16 (block+8*2, vshrq_n_s16 (vqaddq_s16 (t2, t5), 6));
+    vst1q_s16 (block+8*5, vshrq_n_s16 (vqsubq_s16 (t2, t5), 6));
+    vst1q_s16 (block+8*3, vshrq_n_s16 (vqaddq_s16 (t3, t4), 6));
+    vst1q_s16 (block+8*4, vshrq_n_s16 (vqsubq_s16 (t3, t4), 6));
+    }
+  //}}}
+#endif
+  };
@@ -0,0 +1,419 @@
+// cMpeg2mc.h - mpeg2 motion compensation kernels, scalar, SSE2, AVX2, NEON, picked at runtime by cpu
+// - halfpel prediction {full, halfx, halfy, halfxy} x {put, average} x {16, 8} wide
+// - idct block put for intra, add for non intra, saturated to 0..255
+// - reduced resolution prediction 8 and 4 wide, narrower is scalar
+#pragma once
+//{{{  includes
+#include <stdint.h>
+#include <string.h>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+  #define MPEG2MC_SSE2
+  #include <emmintrin.h>
+  #include <immintrin.h>
+  #ifdef _MSC_VER
+    #include <intrin.h>
+    #define MPEG2MC_AVX2_TARGET
+  #else
+    #define MPEG2MC_AVX2_TARGET __attribute__((target("avx2")))
+  #endif
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+  #define MPEG2MC_NEON
+  #include <arm_neon.h>
+#endif
+//}}}
+//{{{  kernel table macros
+#define MPEG2MC_PREDICT_HALFPEL(fn, width, average) \
+  { fn<width,average,false,false>, fn<width,average,false,true>, fn<width,average,true,false>, fn<width,average,true,true> }
+
+#define MPEG2MC_PREDICT_TABLE(fn16, fn8) \
+  { { MPEG2MC_PREDICT_HALFPEL(fn16, 16, false), MPEG2MC_PREDICT_HALFPEL(fn8, 8, false) }, \
+    { MPEG2MC_PREDICT_HALFPEL(fn16, 16, true),  MPEG2MC_PREDICT_HALFPEL(fn8, 8, true) } }
+
+#define MPEG2MC_PREDICT_SCALED_TABLE(fn8, fn4) \
+  { { MPEG2MC_PREDICT_HALFPEL(fn8, 8, false), MPEG2MC_PREDICT_HALFPEL(fn4, 4, false) }, \
+    { MPEG2MC_PREDICT_HALFPEL(fn8, 8, true),  MPEG2MC_PREDICT_HALFPEL(fn4, 4, true) } }
+//}}}
+
+class cMpeg2mc {
+public:
+  // dst, src at block origin, lx offset to halfpel line below, lx2 line step, h lines
+  typedef void (*tPredict) (uint8_t* dst, const uint8_t* src, int lx, int lx2, int h);
+  // 8x8 idct block to dst, lineInc line step, 4x4 for reduced resolution
+  typedef void (*tBlock) (uint8_t* dst, const int16_t* block, int lineInc);
+
+  //{{{
+  struct sKernels {
+    const char* mName;
+    tPredict mPredict[2][2][4]; // [average][16 wide, 8 wide][(halfx << 1) | halfy]
+    tBlock mPutBlock;           // intra, dst = sat (block + 128)
+    tBlock mAddBlock;           // non intra, dst = sat (dst + block)
+    tPredict mPredictScaled[2][2][4]; // reduced resolution [average][8 wide, 4 wide][(halfx << 1) | halfy]
+    tBlock mPutBlock4;                // reduced resolution 4x4 intra
+    tBlock mAddBlock4;                // reduced resolution 4x4 non intra
+    };
+  //}}}
+  enum eIsa { eScalar, eSse2, eAvx2, eNeon };
+
+  //{{{
+  static const sKernels* getKernels (eIsa isa) {
+  // return kernels for isa, nullptr if not built for this target
+
+    static const sKernels kScalar = { "scalar", MPEG2MC_PREDICT_TABLE (predictScalar, predictScalar),
+                                      putBlockScalar<8>, addBlockScalar<8>,
+                                      MPEG2MC_PREDICT_SCALED_TABLE (predictScalar, predictScalar),
+                                      putBlockScalar<4>, addBlockScalar<4> };
+  #if defined(MPEG2MC_SSE2)
+    static const sKernels kSse2 = { "sse2", MPEG2MC_PREDICT_TABLE (predictSse2, predictSse2),
+                                    putBlockSse2, addBlockSse2,
+                                    MPEG2MC_PREDICT_SCALED_TABLE (predictSse2, predictSse2),
+                                    putBlock4Sse2, addBlock4Sse2 };
+    // 16 wide gain from two lines per ymm, 8 wide and blocks too narrow, stay sse2
+    static const sKernels kAvx2 = { "avx2", MPEG2MC_PREDICT_TABLE (predictAvx2, predictSse2),
+                                    putBlockSse2, addBlockSse2,
+                                    MPEG2MC_PREDICT_SCALED_TABLE (predictSse2, predictSse2),
+                                    putBlock4Sse2, addBlock4Sse2 };
+  #elif defined(MPEG2MC_NEON)
+    // 4 wide would need lane loads, stays scalar
+    static const sKernels kNeon = { "neon", MPEG2MC_PREDICT_TABLE (predictNeon, predictNeon),
+                                    putBlockNeon, addBlockNeon,
+                                    MPEG2MC_PREDICT_SCALED_TABLE (predictNeon, predictScalar),
+                                    putBlockScalar<4>, addBlockScalar<4> };
+  #endif
+
+    switch (isa) {
+      case eScalar: return &kScalar;
+    #if defined(MPEG2MC_SSE2)
+      case eSse2: return &kSse2;
+      case eAvx2: return hasAvx2() ? &kAvx2 : nullptr;
+    #elif defined(MPEG2MC_NEON)
+      case eNeon: return &kNeon;
+    #endif
+      default: return nullptr;
+      }
+    }
+  //}}}
+  //{{{
+  static tPredict getScaledPredict (int width, bool average, int halfpel) {
+  // scalar prediction for reduced resolution decode, width 1,2,4,8, halfpel (halfx << 1) | halfy
+  // - 8 and 4 wide have simd kernels in mPredictScaled
+
+    static const tPredict kPredict[4][2][4] = {
+      { MPEG2MC_PREDICT_HALFPEL (predictScalar, 1, false), MPEG2MC_PREDICT_HALFPEL (predictScalar, 1, true) },
+      { MPEG2MC_PREDICT_HALFPEL (predictScalar, 2, false), MPEG2MC_PREDICT_HALFPEL (predictScalar, 2, true) },
+      { MPEG2MC_PREDICT_HALFPEL (predictScalar, 4, false), MPEG2MC_PREDICT_HALFPEL (predictScalar, 4, true) },
+      { MPEG2MC_PREDICT_HALFPEL (predictScalar, 8, false), MPEG2MC_PREDICT_HALFPEL (predictScalar, 8, true) } };
+
+    int widthIndex = (width >= 8) ? 3 : (width >= 4) ? 2 : (width >= 2) ? 1 : 0;
+    return kPredict[widthIndex][average ? 1 : 0][halfpel];
+    }
+  //}}}
+  //{{{
+  static eIsa getBestIsa() {
+
+  #if defined(MPEG2MC_SSE2)
+    return hasAvx2() ? eAvx2 : eSse2;
+  #elif defined(MPEG2MC_NEON)
+    return eNeon;
+  #else
+    return eScalar;
+  #endif
+    }
+  //}}}
+  //{{{
+  static const sKernels* getBestKernels() {
+
+    static const sKernels* kernels = getKernels (getBestIsa());
+    return kernels;
+    }
+  //}}}
+
+  //{{{
+  static bool hasAvx2() {
+
+  #if defined(MPEG2MC_SSE2)
+    #ifdef _MSC_VER
+      int info[4];
+      __cpuid (info, 0);
+      if (info[0] < 7)
+        return false;
+
+      // avx and osxsave, os saves ymm state, then avx2
+      __cpuid (info, 1);
+      if ((info[2] & 0x18000000) != 0x18000000)
+        return false;
+      if ((_xgetbv (0) & 6) != 6)
+        return false;
+
+      __cpuidex (info, 7, 0);
+      return (info[1] & (1 << 5)) != 0;
+    #else
+      return __builtin_cpu_supports ("avx2");
+    #endif
+  #else
+    return false;
+  #endif
+    }
+  //}}}
+
+private:
+  // scalar reference
+  //{{{
+  template <int width, bool average, bool halfx, bool halfy>
+  static void predictScalar (uint8_t* dst, const uint8_t* src, int lx, int lx2, int h) {
+
+    for (int j = 0; j < h; j++) {
+      for (int i = 0; i < width; i++) {
+        int v;
+        if (halfx && halfy)
+          v = (src[i] + src[i+1] + src[i+lx] + src[i+lx+1] + 2) >> 2;
+        else if (halfx)
+          v = (src[i] + src[i+1] + 1) >> 1;
+        else if (halfy)
+          v = (src[i] + src[i+lx] + 1) >> 1;
+        else
+          v = src[i];
+        dst[i] = average ? (dst[i] + v + 1) >> 1 : v;
+        }
+      src += lx2;
+      dst += lx2;
+      }
+    }
+  //}}}
+  //{{{
+  template <int n> static void putBlockScalar (uint8_t* dst, const int16_t* block, int lineInc) {
+
+    for (int j = 0; j < n; j++) {
+      for (int i = 0; i < n; i++) {
+        int v = block[i] + 128;
+        dst[i] = (v < 0) ? 0 : ((v > 255) ? 255 : v);
+        }
+      block += n;
+      dst += lineInc;
+      }
+    }
+  //}}}
+  //{{{
+  template <int n> static void addBlockScalar (uint8_t* dst, const int16_t* block, int lineInc) {
+
+    for (int j = 0; j < n; j++) {
+      for (int i = 0; i < n; i++) {
+        int v = block[i] + dst[i];
+        dst[i] = (v < 0) ? 0 : ((v > 255) ? 255 : v);
+        }
+      block += n;
+      dst += lineInc;
+      }
+    }
+  //}}}
+
+#if defined(MPEG2MC_SSE2)
+  //{{{
+  template <int width> static inline __m128i load (const uint8_t* src) {
+
+    if (width == 16)
+      return _mm_loadu_si128 ((const __m128i*)src);
+    if (width == 8)
+      return _mm_loadl_epi64 ((const __m128i*)src);
+
+    int32_t value;
+    memcpy (&value, src, 4);
+    return _mm_cvtsi32_si128 (value);
+    }
+  //}}}
+  //{{{
+  template <int width> static inline void store (uint8_t* dst, __m128i value) {
+
+    if (width == 16)
+      _mm_storeu_si128 ((__m128i*)dst, value);
+    else if (width == 8)
+      _mm_storel_epi64 ((__m128i*)dst, value);
+    else {
+      int32_t low = _mm_cvtsi128_si32 (value);
+      memcpy (dst, &low, 4);
+      }
+    }
+  //}}}
+  //{{{
+  template <int width, bool average, bool halfx, bool halfy>
+  static void predictSse2 (uint8_t* dst, const uint8_t* src, int lx, int lx2, int h) {
+
+    const __m128i one = _mm_set1_epi8 (1);
+    for (int j = 0; j < h; j++) {
+      __m128i v = load<width> (src);
+      if (halfx && halfy) {
+        // (a+b+c+d+2)>>2 = avg(avg(a,b),avg(c,d)) - ((a^b)|(c^d)) & (avg(a,b)^avg(c,d)) & 1
+        __m128i b = load<width> (src + 1);
+        __m128i c = load<width> (src + lx);
+        __m128i d = load<width> (src + lx + 1);
+        __m128i ab = _mm_avg_epu8 (v, b);
+        __m128i cd = _mm_avg_epu8 (c, d);
+        __m128i offset = _mm_and_si128 (_mm_and_si128 (_mm_or_si128 (_mm_xor_si128 (v, b), _mm_xor_si128 (c, d)),
+                                                       _mm_xor_si128 (ab, cd)), one);
+        v = _mm_sub_epi8 (_mm_avg_epu8 (ab, cd), offset);
+        }
+      else if (halfx)
+        v = _mm_avg_epu8 (v, load<width> (src + 1));
+      else if (halfy)
+        v = _mm_avg_epu8 (v, load<width> (src + lx));
+
+      if (average)
+        v = _mm_avg_epu8 (v, load<width> (dst));
+      store<width> (dst, v);
+
+      src += lx2;
+      dst += lx2;
+      }
+    }
+  //}}}
+  //{{{
+  static void putBlockSse2 (uint8_t* dst, const int16_t* block, int lineInc) {
+
+    const __m128i offset = _mm_set1_epi16 (128);
+    for (int j = 0; j < 8; j++) {
+      __m128i v = _mm_add_epi16 (_mm_loadu_si128 ((const __m128i*)block), offset);
+      _mm_storel_epi64 ((__m128i*)dst, _mm_packus_epi16 (v, v));
+      block += 8;
+      dst += lineInc;
+      }
+    }
+  //}}}
+  //{{{
+  static void addBlockSse2 (uint8_t* dst, const int16_t* block, int lineInc) {
+
+    const __m128i zero = _mm_setzero_si128();
+    for (int j = 0; j < 8; j++) {
+      __m128i pixels = _mm_unpacklo_epi8 (_mm_loadl_epi64 ((const __m128i*)dst), zero);
+      __m128i v = _mm_add_epi16 (_mm_loadu_si128 ((const __m128i*)block), pixels);
+      _mm_storel_epi64 ((__m128i*)dst, _mm_packus_epi16 (v, v));
+      block += 8;
+      dst += lineInc;
+      }
+    }
+  //}}}
+
+  //{{{
+  static void putBlock4Sse2 (uint8_t* dst, const int16_t* block, int lineInc) {
+
+    const __m128i offset = _mm_set1_epi16 (128);
+    for (int j = 0; j < 4; j++) {
+      __m128i v = _mm_add_epi16 (_mm_loadl_epi64 ((const __m128i*)block), offset);
+      store<4> (dst, _mm_packus_epi16 (v, v));
+      block += 4;
+      dst += lineInc;
+      }
+    }
+  //}}}
+  //{{{
+  static void addBlock4Sse2 (uint8_t* dst, const int16_t* block, int lineInc) {
+
+    const __m128i zero = _mm_setzero_si128();
+    for (int j = 0; j < 4; j++) {
+      __m128i pixels = _mm_unpacklo_epi8 (load<4> (dst), zero);
+      __m128i v = _mm_add_epi16 (_mm_loadl_epi64 ((const __m128i*)block), pixels);
+      store<4> (dst, _mm_packus_epi16 (v, v));
+      block += 4;
+      dst += lineInc;
+      }
+    }
+  //}}}
+
+  //{{{
+  template <int width, bool average, bool halfx, bool halfy>
+  MPEG2MC_AVX2_TARGET static void predictAvx2 (uint8_t* dst, const uint8_t* src, int lx, int lx2, int h) {
+  // 16 wide, two lines per ymm, odd last line left to sse2
+
+    #define LOAD2(ptr) _mm256_inserti128_si256 (_mm256_castsi128_si256 (_mm_loadu_si128 ((const __m128i*)(ptr))), \
+                                                _mm_loadu_si128 ((const __m128i*)((ptr) + lx2)), 1)
+
+    const __m256i one = _mm256_set1_epi8 (1);
+    int j = 0;
+    for (; j + 1 < h; j += 2) {
+      __m256i v = LOAD2 (src);
+      if (halfx && halfy) {
+        __m256i b = LOAD2 (src + 1);
+        __m256i c = LOAD2 (src + lx);
+        __m256i d = LOAD2 (src + lx + 1);
+        __m256i ab = _mm256_avg_epu8 (v, b);
+        __m256i cd = _mm256_avg_epu8 (c, d);
+        __m256i offset = _mm256_and_si256 (_mm256_and_si256 (_mm256_or_si256 (_mm256_xor_si256 (v, b), _mm256_xor_si256 (c, d)),
+                                                             _mm256_xor_si256 (ab, cd)), one);
+        v = _mm256_sub_epi8 (_mm256_avg_epu8 (ab, cd), offset);
+        }
+      else if (halfx)
+        v = _mm256_avg_epu8 (v, LOAD2 (src + 1));
+      else if (halfy)
+        v = _mm256_avg_epu8 (v, LOAD2 (src + lx));
+
+      if (average)
+        v = _mm256_avg_epu8 (v, LOAD2 (dst));
+      _mm_storeu_si128 ((__m128i*)dst, _mm256_castsi256_si128 (v));
+      _mm_storeu_si128 ((__m128i*)(dst + lx2), _mm256_extracti128_si256 (v, 1));
+
+      src += 2 * lx2;
+      dst += 2 * lx2;
+      }
+
+    #undef LOAD2
+
+    if (j < h)
+      predictSse2<width, average, halfx, halfy> (dst, src, lx, lx2, 1);
+    }
+  //}}}
+#endif
+
+#if defined(MPEG2MC_NEON)
+  //{{{
+  static inline uint8x8_t avg4 (uint8x8_t a, uint8x8_t b, uint8x8_t c, uint8x8_t d) {
+    return vrshrn_n_u16 (vaddq_u16 (vaddl_u8 (a, b), vaddl_u8 (c, d)), 2);
+    }
+  //}}}
+  //{{{
+  template <int width, bool average, bool halfx, bool halfy>
+  static void predictNeon (uint8_t* dst, const uint8_t* src, int lx, int lx2, int h) {
+  // 8 wide in d registers, 16 wide as two halves for the widening halfxy sum
+
+    for (int j = 0; j < h; j++) {
+      for (int i = 0; i < width; i += 8) {
+        uint8x8_t v = vld1_u8 (src + i);
+        if (halfx && halfy)
+          v = avg4 (v, vld1_u8 (src + i + 1), vld1_u8 (src + i + lx), vld1_u8 (src + i + lx + 1));
+        else if (halfx)
+          v = vrhadd_u8 (v, vld1_u8 (src + i + 1));
+        else if (halfy)
+          v = vrhadd_u8 (v, vld1_u8 (src + i + lx));
+
+        if (average)
+          v = vrhadd_u8 (v, vld1_u8 (dst + i));
+        vst1_u8 (dst + i, v);
+        }
+
+      src += lx2;
+      dst += lx2;
+      }
+    }
+  //}}}
+  //{{{
+  static void putBlockNeon (uint8_t* dst, const int16_t* block, int lineInc) {
+
+    const int16x8_t offset = vdupq_n_s16 (128);
+    for (int j = 0; j < 8; j++) {
+      vst1_u8 (dst, vqmovun_s16 (vaddq_s16 (vld1q_s16 (block), offset)));
+      block += 8;
+      dst += lineInc;
+      }
+    }
+  //}}}
+  //{{{
+  static void addBlockNeon (uint8_t* dst, const int16_t* block, int lineInc) {
+
+    for (int j = 0; j < 8; j++) {
+      int16x8_t pixels = vreinterpretq_s16_u16 (vmovl_u8 (vld1_u8 (dst)));
+      vst1_u8 (dst, vqmovun_s16 (vaddq_s16 (vld1q_s16 (block), pixels)));
+      block += 8;
+      dst += lineInc;
+      }
+    }
+  //}}}
+#endif
+  };
@@ -0,0 +1,433 @@
+// cPicDiskCache.h - decoded pics kept on disk as raw mappable files, repeat loads are a page cache hit
+// - one file per pic, 64 byte header then each level 64 byte aligned, rgba or premultiplied bgra, optional mips
+// - keyed by caller's 64 bit key, which should cover source hash and decode params, see cDecodeService
+// - index file holds bytes and last use of each entry, least recently used evicted past the byte cap
+// - stores and evictions append to the index, rewritten compacted when it has grown or on exit
+// - one process per cache dir, threads share it through its mutex
+#pragma once
+//{{{  includes
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <memory>
+#include <algorithm>
+#include <mutex>
+
+#include "cMappedFile.h"
+//}}}
+
+class cPicDiskCache {
+public:
+  enum eFormat { eRgba, eBgraPremultiplied };
+  static constexpr int kMaxLevels = 16;
+
+  //{{{
+  struct sHeader {
+  // file starts with it, native endian
+    uint32_t mMagic;
+    uint32_t mVersion;
+    uint64_t mKey;
+    uint32_t mFormat;
+    uint32_t mLevels;
+    uint32_t mWidth;
+    uint32_t mHeight;
+    uint64_t mBytes;    // whole file, catches truncation
+    uint8_t mPad[24];
+    };
+  //}}}
+  //{{{
+  struct sLevel {
+    const uint8_t* mPic;
+    uint32_t mWidth;
+    uint32_t mHeight;
+    };
+  //}}}
+  //{{{
+  class cEntry {
+  // mapped pic, levels are views valid while the entry lives
+  public:
+    eFormat getFormat() { return (eFormat)mHeader.mFormat; }
+    int getLevels() { return (int)mHeader.mLevels; }
+    uint32_t getWidth() { return mHeader.mWidth; }
+    uint32_t getHeight() { return mHeader.mHeight; }
+
+    //{{{
+    sLevel getLevel (int level) {
+
+      uint32_t width = mHeader.mWidth;
+      uint32_t height = mHeader.mHeight;
+      size_t offset = getLevelOffset (width, height, level);
+      return { mFile.getBuffer() + offset, width, height };
+      }
+    //}}}
+
+  private:
+    friend class cPicDiskCache;
+    cMappedFile mFile;
+    sHeader mHeader;
+    };
+  //}}}
+
+  //{{{
+  cPicDiskCache (const std::string& dirName, uint64_t maxBytes) : mDirName(dirName), mMaxBytes(maxBytes) {
+
+    makeDirs (mDirName);
+    readIndex();
+    }
+  //}}}
+  //{{{
+  ~cPicDiskCache() {
+  // keep last use order for next run
+
+    std::unique_lock<std::mutex> lock (mMutex);
+    if (mIndexChanged)
+      writeIndex();
+    if (mIndexLog)
+      fclose (mIndexLog);
+    }
+  //}}}
+
+  //{{{
+  std::unique_ptr<cEntry> find (uint64_t key, eFormat format) {
+  // map cached pic, nullptr if absent, wrong format or truncated
+
+    std::unique_lock<std::mutex> lock (mMutex);
+
+    auto it = mIndex.find (key);
+    if (it == mIndex.end())
+      return nullptr;
+
+    std::unique_ptr<cEntry> entry (new cEntry());
+    if (!entry->mFile.open (getFileName (key), false) || (entry->mFile.getSize() < sizeof(sHeader))) {
+      removeEntry (it);
+      return nullptr;
+      }
+
+    memcpy (&entry->mHeader, entry->mFile.getBuffer(), sizeof(sHeader));
+    const sHeader& header = entry->mHeader;
+    if ((header.mMagic != kMagic) || (header.mVersion != kVersion) || (header.mKey != key) ||
+        !header.mWidth || !header.mHeight || (header.mLevels < 1) || (header.mLevels > kMaxLevels) ||
+        (header.mBytes != getFileBytes (header.mWidth, header.mHeight, header.mLevels)) ||
+        (header.mBytes != entry->mFile.getSize())) {
+      entry->mFile.close();
+      removeEntry (it);
+      return nullptr;
+      }
+
+    if (header.mFormat != (uint32_t)format)
+      return nullptr;
+
+    it->second.mLastUse = ++mUse;
+    mIndexChanged = true;
+    return entry;
+    }
+  //}}}
+  //{{{
+  bool store (uint64_t key, eFormat format, const uint8_t* pic, uint32_t width, uint32_t height, int levels = 1) {
+  // write width * 4 stride pic, levels > 1 box filters mips from it, written to a temp file then renamed
+  // - key already cached or being stored by another thread is left to that one
+
+    if (!width || !height)
+      return false;
+
+    uint64_t tempId;
+    {
+    std::unique_lock<std::mutex> lock (mMutex);
+    if ((mIndex.find (key) != mIndex.end()) || !mStoring.insert (key).second)
+      return true;
+    tempId = ++mTempId;
+    }
+    levels = std::max (1, std::min (levels, std::min (kMaxLevels, getMaxLevels (width, height))));
+
+    sHeader header;
+    memset (&header, 0, sizeof(header));
+    header.mMagic = kMagic;
+    header.mVersion = kVersion;
+    header.mKey = key;
+    header.mFormat = (uint32_t)format;
+    header.mLevels = (uint32_t)levels;
+    header.mWidth = width;
+    header.mHeight = height;
+    header.mBytes = getFileBytes (width, height, levels);
+
+    // temp name unique per store, a failed store never removes another's file
+    std::string fileName = getFileName (key);
+    std::string tempName = fileName + "." + std::to_string (tempId) + ".tmp";
+    FILE* file = fopen (tempName.c_str(), "wb");
+    if (!file) {
+      std::unique_lock<std::mutex> lock (mMutex);
+      mStoring.erase (key);
+      return false;
+      }
+
+    bool ok = fwrite (&header, sizeof(header), 1, file) == 1;
+    //{{{  write levels, padded to 64 bytes
+    std::vector<uint8_t> mip;
+    std::vector<uint8_t> nextMip;
+    uint32_t levelWidth = width;
+    uint32_t levelHeight = height;
+    size_t offset = sizeof(header);
+
+    for (int level = 0; ok && (level < levels); level++) {
+      if (level) {
+        nextMip.resize ((size_t)std::max (1u, levelWidth / 2) * std::max (1u, levelHeight / 2) * 4);
+        halve (level == 1 ? pic : mip.data(), levelWidth, levelHeight, nextMip.data());
+        mip.swap (nextMip);
+        levelWidth = std::max (1u, levelWidth / 2);
+        levelHeight = std::max (1u, levelHeight / 2);
+        }
+
+      static const uint8_t kPad[kAlign] = { 0 };
+      uint32_t offsetWidth = width;
+      uint32_t offsetHeight = height;
+      size_t padBytes = getLevelOffset (offsetWidth, offsetHeight, level) - offset;
+      size_t levelBytes = (size_t)levelWidth * levelHeight * 4;
+      ok = (fwrite (kPad, 1, padBytes, file) == padBytes) &&
+           (fwrite (level ? mip.data() : pic, 1, levelBytes, file) == levelBytes);
+      offset += padBytes + levelBytes;
+      }
+    //}}}
+    ok = (fclose (file) == 0) && ok;
+
+    std::unique_lock<std::mutex> lock (mMutex);
+    mStoring.erase (key);
+
+    // unindexed file left by an earlier run or a still mapped evicted entry, windows rename won't overwrite
+    remove (fileName.c_str());
+
+    if (!ok || (rename (tempName.c_str(), fileName.c_str()) != 0)) {
+      remove (tempName.c_str());
+      return false;
+      }
+
+    mIndex[key] = { header.mBytes, ++mUse };
+    mCachedBytes += header.mBytes;
+    appendIndex (key, header.mBytes, mUse);
+    trim();
+
+    // superseded and evicted records past the live ones, compact
+    if (mIndexRecords > 2 * mIndex.size() + 64)
+      writeIndex();
+    return true;
+    }
+  //}}}
+
+  //{{{
+  uint64_t getCachedBytes() {
+    std::unique_lock<std::mutex> lock (mMutex);
+    return mCachedBytes;
+    }
+  //}}}
+
+private:
+  static constexpr uint32_t kMagic = 0x43495063;  // "cPIC"
+  static constexpr uint32_t kVersion = 1;
+  static constexpr size_t kAlign = 64;
+
+  //{{{
+  struct sIndexEntry {
+    uint64_t mBytes;
+    uint64_t mLastUse;
+    };
+  //}}}
+
+  //{{{
+  static int getMaxLevels (uint32_t width, uint32_t height) {
+
+    int levels = 1;
+    while ((width > 1) || (height > 1)) {
+      width = std::max (1u, width / 2);
+      height = std::max (1u, height / 2);
+      levels++;
+      }
+    return levels;
+    }
+  //}}}
+  //{{{
+  static size_t getLevelOffset (uint32_t& width, uint32_t& height, int level) {
+  // offset of level, width and height updated to its size
+
+    size_t offset = sizeof(sHeader);
+    for (int i = 0; i < level; i++) {
+      offset += (size_t)width * height * 4;
+      offset = (offset + kAlign - 1) & ~(kAlign - 1);
+      width = std::max (1u, width / 2);
+      height = std::max (1u, height / 2);
+      }
+    return (offset + kAlign - 1) & ~(kAlign - 1);
+    }
+  //}}}
+  //{{{
+  static uint64_t getFileBytes (uint32_t width, uint32_t height, int levels) {
+
+    size_t offset = getLevelOffset (width, height, levels - 1);
+    return offset + (size_t)width * height * 4;
+    }
+  //}}}
+  //{{{
+  static void halve (const uint8_t* src, uint32_t width, uint32_t height, uint8_t* dst) {
+  // 2x2 box filter, odd last row or column folded into the one before, 1 pixel edges kept
+
+    uint32_t dstWidth = std::max (1u, width / 2);
+    uint32_t dstHeight = std::max (1u, height / 2);
+    uint32_t stride = width * 4;
+
+    for (uint32_t y = 0; y < dstHeight; y++) {
+      const uint8_t* src0 = src + std::min (y * 2, height - 1) * stride;
+      const uint8_t* src1 = src + std::min (y * 2 + 1, height - 1) * stride;
+      for (uint32_t x = 0; x < dstWidth; x++) {
+        uint32_t x0 = std::min (x * 2, width - 1) * 4;
+        uint32_t x1 = std::min (x * 2 + 1, width - 1) * 4;
+        for (int c = 0; c < 4; c++)
+          *dst++ = (uint8_t)((src0[x0+c] + src0[x1+c] + src1[x0+c] + src1[x1+c] + 2) >> 2);
+        }
+      }
+    }
+  //}}}
+
+  //{{{
+  static void makeDirs (const std::string& dirName) {
+  // create each missing directory along the path, existing ones fail harmlessly
+
+    for (size_t i = 1; i <= dirName.size(); i++)
+      if ((i == dirName.size()) || (dirName[i] == '/') || (dirName[i] == '\\')) {
+        std::string path = dirName.substr (0, i);
+      #ifdef _WIN32
+        CreateDirectoryA (path.c_str(), NULL);
+      #else
+        mkdir (path.c_str(), 0755);
+      #endif
+        }
+    }
+  //}}}
+  //{{{
+  std::string getFileName (uint64_t key) {
+
+    char name[32];
+    snprintf (name, sizeof(name), "/%016llx.pic", (unsigned long long)key);
+    return mDirName + name;
+    }
+  //}}}
+  //{{{
+  void removeEntry (std::map<uint64_t, sIndexEntry>::iterator it) {
+  // lock held, a windows file still mapped by a live entry stays behind, overwritten if stored again
+
+    uint64_t key = it->first;
+    remove (getFileName (key).c_str());
+    mCachedBytes -= it->second.mBytes;
+    mIndex.erase (it);
+    mIndexChanged = true;
+    appendIndex (key, 0, 0);
+    }
+  //}}}
+  //{{{
+  void trim() {
+  // lock held, evict least recently used past the cap, scan is fine at cache entry counts
+
+    while ((mCachedBytes > mMaxBytes) && !mIndex.empty()) {
+      auto oldest = mIndex.begin();
+      for (auto it = mIndex.begin(); it != mIndex.end(); ++it)
+        if (it->second.mLastUse < oldest->second.mLastUse)
+          oldest = it;
+      removeEntry (oldest);
+      }
+    }
+  //}}}
+  //{{{
+  void readIndex() {
+  // key, bytes, last use records in write order, later ones replace earlier, 0 bytes removes
+  // - missing index starts empty, unindexed files are orphans
+  // - a torn last record is dropped and the index rewritten, so appends stay record aligned
+
+    FILE* file = fopen ((mDirName + "/index").c_str(), "rb");
+    if (!file)
+      return;
+
+    uint64_t record[3];
+    while (fread (record, sizeof(record), 1, file) == 1) {
+      mIndexRecords++;
+      auto it = mIndex.find (record[0]);
+      if (it != mIndex.end()) {
+        mCachedBytes -= it->second.mBytes;
+        mIndex.erase (it);
+        }
+      if (record[1]) {
+        mIndex[record[0]] = { record[1], record[2] };
+        mCachedBytes += record[1];
+        mUse = std::max (mUse, record[2]);
+        }
+      }
+    bool torn = ftell (file) != (long)(mIndexRecords * sizeof(record));
+    fclose (file);
+
+    if (torn)
+      writeIndex();
+
+    trim();
+    mIndexChanged = mIndexChanged || (mIndexRecords != mIndex.size());
+    }
+  //}}}
+  //{{{
+  void appendIndex (uint64_t key, uint64_t bytes, uint64_t lastUse) {
+  // lock held, flushed so a crash loses at most the record being written
+  // - a failed write may leave part of a record, rewrite the whole index to stay aligned
+
+    if (!mIndexLog)
+      mIndexLog = fopen ((mDirName + "/index").c_str(), "ab");
+
+    uint64_t record[3] = { key, bytes, lastUse };
+    if (mIndexLog && (fwrite (record, sizeof(record), 1, mIndexLog) == 1) && (fflush (mIndexLog) == 0))
+      mIndexRecords++;
+    else
+      writeIndex();
+    }
+  //}}}
+  //{{{
+  void writeIndex() {
+  // lock held, compacted to one record per entry
+
+    if (mIndexLog) {
+      fclose (mIndexLog);
+      mIndexLog = nullptr;
+      }
+
+    std::string tempName = mDirName + "/index.tmp";
+    FILE* file = fopen (tempName.c_str(), "wb");
+    if (!file)
+      return;
+
+    bool ok = true;
+    for (auto& entry : mIndex) {
+      uint64_t record[3] = { entry.first, entry.second.mBytes, entry.second.mLastUse };
+      ok = ok && (fwrite (record, sizeof(record), 1, file) == 1);
+      }
+    ok = (fclose (file) == 0) && ok;
+
+    std::string indexName = mDirName + "/index";
+    remove (indexName.c_str());
+    if (ok && (rename (tempName.c_str(), indexName.c_str()) == 0)) {
+      mIndexRecords = mIndex.size();
+      mIndexChanged = false;
+      }
+    }
+  //}}}
+
+  std::string mDirName;
+  uint64_t mMaxBytes;
+
+  std::mutex mMutex;
+  std::map<uint64_t, sIndexEntry> mIndex;
+  std::set<uint64_t> mStoring;
+  uint64_t mTempId = 0;
+  uint64_t mCachedBytes = 0;
+  uint64_t mUse = 0;
+  bool mIndexChanged = false;
+  FILE* mIndexLog = nullptr;
+  uint64_t mIndexRecords = 0;
+  };
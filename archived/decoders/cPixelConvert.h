@@ -0,0 +1,549 @@
+// cPixelConvert.h - pixel format conversion to 4 byte rgba, bgra or premultiplied, rows with stride and flip
+// - bgr, rgb, rgb565, bgrx, rgbx, bgra, rgba, premultiplied sources, scalar, SSSE3, AVX2, NEON kernels picked at runtime
+// - 3 byte expand and channel swaps as byte shuffles, 565 widened with bit replication, premultiply rounds c*a/255
+// - every isa bit exact with the scalar reference, same cpu checks as cMpeg2mc plus ssse3 in its sse2 slot
+#pragma once
+//{{{  includes
+#include <stdint.h>
+#include <string.h>
+#include "cMpeg2mc.h"
+
+#if defined(MPEG2MC_SSE2)
+  #include <tmmintrin.h>
+  #ifdef _MSC_VER
+    #define PIXEL_SSSE3_TARGET
+  #else
+    #define PIXEL_SSSE3_TARGET __attribute__((target("ssse3")))
+  #endif
+#endif
+//}}}
+
+class cPixelConvert {
+public:
+  // rgb565 little endian, red in the top bits, x formats have an unused 4th byte written as opaque alpha
+  enum eFormat { eBgr, eRgb, eRgb565, eBgrx, eRgbx, eBgra, eRgba, eBgraPremultiplied, eRgbaPremultiplied };
+
+  // convert one row of width pixels, src == dst allowed for 4 byte sources
+  typedef void (*tRow) (const uint8_t* src, uint8_t* dst, int width);
+  //{{{
+  struct sKernels {
+    const char* mName;
+    tRow mExpand3[2];     // [swap] 3 byte to 4, opaque
+    tRow mExpand565[2];   // [swap] 565 to bgra, swap to rgba
+    tRow mSwizzle[2][2];  // [swap][opaque] 4 byte to 4
+    tRow mPremultiply[2]; // [swap] straight alpha to premultiplied
+    };
+  //}}}
+
+  //{{{
+  static const sKernels* getKernels (cMpeg2mc::eIsa isa) {
+  // return kernels for isa, nullptr if not built for this target or not on this cpu
+  // - sse2 slot gets the ssse3 kernels, shuffles need pshufb
+
+    static const sKernels kScalar = { "scalar",
+      { expand3Scalar<false>, expand3Scalar<true> }, { expand565Scalar<false>, expand565Scalar<true> },
+      { { swizzleScalar<false,false>, swizzleScalar<false,true> }, { swizzleScalar<true,false>, swizzleScalar<true,true> } },
+      { premultiplyScalar<false>, premultiplyScalar<true> } };
+  #if defined(MPEG2MC_SSE2)
+    static const sKernels kSsse3 = { "ssse3",
+      { expand3Ssse3<false>, expand3Ssse3<true> }, { expand565Ssse3<false>, expand565Ssse3<true> },
+      { { swizzleSsse3<false,false>, swizzleSsse3<false,true> }, { swizzleSsse3<true,false>, swizzleSsse3<true,true> } },
+      { premultiplySsse3<false>, premultiplySsse3<true> } };
+    static const sKernels kAvx2 = { "avx2",
+      { expand3Avx2<false>, expand3Avx2<true> }, { expand565Avx2<false>, expand565Avx2<true> },
+      { { swizzleAvx2<false,false>, swizzleAvx2<false,true> }, { swizzleAvx2<true,false>, swizzleAvx2<true,true> } },
+      { premultiplyAvx2<false>, premultiplyAvx2<true> } };
+  #elif defined(MPEG2MC_NEON)
+    static const sKernels kNeon = { "neon",
+      { expand3Neon<false>, expand3Neon<true> }, { expand565Neon<false>, expand565Neon<true> },
+      { { swizzleNeon<false,false>, swizzleNeon<false,true> }, { swizzleNeon<true,false>, swizzleNeon<true,true> } },
+      { premultiplyNeon<false>, premultiplyNeon<true> } };
+  #endif
+
+    switch (isa) {
+      case cMpeg2mc::eScalar: return &kScalar;
+    #if defined(MPEG2MC_SSE2)
+      case cMpeg2mc::eSse2: return hasSsse3() ? &kSsse3 : nullptr;
+      case cMpeg2mc::eAvx2: return cMpeg2mc::hasAvx2() ? &kAvx2 : nullptr;
+    #elif defined(MPEG2MC_NEON)
+      case cMpeg2mc::eNeon: return &kNeon;
+    #endif
+      default: return nullptr;
+      }
+    }
+  //}}}
+  //{{{
+  static const sKernels* getBestKernels() {
+  // sse2 only cpus have no pshufb, fall back to scalar
+
+    static const sKernels* kernels = getKernels (cMpeg2mc::getBestIsa()) ? getKernels (cMpeg2mc::getBestIsa())
+                                                                       : getKernels (cMpeg2mc::eScalar);
+    return kernels;
+    }
+  //}}}
+  //{{{
+  static bool hasSsse3() {
+
+  #if defined(MPEG2MC_SSE2)
+    #ifdef _MSC_VER
+      int info[4];
+      __cpuid (info, 1);
+      return (info[2] & (1 << 9)) != 0;
+    #else
+      return __builtin_cpu_supports ("ssse3");
+    #endif
+  #else
+    return false;
+  #endif
+    }
+  //}}}
+
+  //{{{
+  static int getBytes (eFormat format) {
+    switch (format) {
+      case eBgr:
+      case eRgb: return 3;
+      case eRgb565: return 2;
+      default: return 4;
+      }
+    }
+  //}}}
+  //{{{
+  static tRow getRow (eFormat srcFormat, eFormat dstFormat, const sKernels* kernels = nullptr) {
+  // row kernel for the pair, nullptr when rows just copy, pairs convert refuses are not checked here
+  // - dst must be bgra, rgba or premultiplied, premultiplied src only to premultiplied dst
+
+    if (!kernels)
+      kernels = getBestKernels();
+
+    bool dstPremultiplied = (dstFormat == eBgraPremultiplied) || (dstFormat == eRgbaPremultiplied);
+    bool swap = isRedFirst (srcFormat) != isRedFirst (dstFormat);
+
+    switch (srcFormat) {
+      case eBgr:
+      case eRgb: return kernels->mExpand3[swap];
+      case eRgb565: return kernels->mExpand565[swap];
+      case eBgrx:
+      case eRgbx: return kernels->mSwizzle[swap][1];
+      case eBgra:
+      case eRgba:
+        if (dstPremultiplied)
+          return kernels->mPremultiply[swap];
+        return swap ? kernels->mSwizzle[1][0] : nullptr;
+      default:
+        return swap ? kernels->mSwizzle[1][0] : nullptr;
+      }
+    }
+  //}}}
+  //{{{
+  static bool convert (const uint8_t* src, eFormat srcFormat, int srcStride,
+                       uint8_t* dst, eFormat dstFormat, int dstStride,
+                       int width, int height, bool flip = false, const sKernels* kernels = nullptr) {
+  // convert width x height, strides in bytes, flip writes src row 0 to the last dst row, false if unsupported
+  // - in place when src == dst, same stride, 4 byte src and no flip
+
+    if ((getBytes (dstFormat) != 4) || (dstFormat == eBgrx) || (dstFormat == eRgbx))
+      return false;
+    bool srcPremultiplied = (srcFormat == eBgraPremultiplied) || (srcFormat == eRgbaPremultiplied);
+    bool dstPremultiplied = (dstFormat == eBgraPremultiplied) || (dstFormat == eRgbaPremultiplied);
+    if (srcPremultiplied && !dstPremultiplied)
+      return false;
+    if ((width <= 0) || (height <= 0))
+      return true;
+
+    tRow row = getRow (srcFormat, dstFormat, kernels);
+    for (int y = 0; y < height; y++) {
+      const uint8_t* srcRow = src + (size_t)y * srcStride;
+      uint8_t* dstRow = dst + (size_t)(flip ? height - 1 - y : y) * dstStride;
+      if (row)
+        row (srcRow, dstRow, width);
+      else if (srcRow != dstRow)
+        memcpy (dstRow, srcRow, (size_t)width * 4);
+      }
+
+    return true;
+    }
+  //}}}
+
+private:
+  //{{{
+  static bool isRedFirst (eFormat format) {
+  // 565 widens to b,g,r byte order
+    return (format == eRgb) || (format == eRgbx) || (format == eRgba) || (format == eRgbaPremultiplied);
+    }
+  //}}}
+  //{{{
+  static inline uint8_t div255 (uint32_t x) {
+  // round (x / 255) for x up to 255 * 255, what the vector kernels do in 16 bits
+    x += 128;
+    return (uint8_t)((x + (x >> 8)) >> 8);
+    }
+  //}}}
+
+  //{{{  scalar
+  //{{{
+  template <bool swap> static void expand3Scalar (const uint8_t* src, uint8_t* dst, int width) {
+
+    for (int x = 0; x < width; x++, src += 3, dst += 4) {
+      dst[0] = src[swap ? 2 : 0];
+      dst[1] = src[1];
+      dst[2] = src[swap ? 0 : 2];
+      dst[3] = 0xFF;
+      }
+    }
+  //}}}
+  //{{{
+  template <bool swap> static void expand565Scalar (const uint8_t* src, uint8_t* dst, int width) {
+
+    for (int x = 0; x < width; x++, src += 2, dst += 4) {
+      uint32_t v = src[0] | (src[1] << 8);
+      uint32_t b = v & 0x1F;
+      uint32_t g = (v >> 5) & 0x3F;
+      uint32_t r = v >> 11;
+      b = (b << 3) | (b >> 2);
+      g = (g << 2) | (g >> 4);
+      r = (r << 3) | (r >> 2);
+      dst[0] = (uint8_t)(swap ? r : b);
+      dst[1] = (uint8_t)g;
+      dst[2] = (uint8_t)(swap ? b : r);
+      dst[3] = 0xFF;
+      }
+    }
+  //}}}
+  //{{{
+  template <bool swap, bool opaque> static void swizzleScalar (const uint8_t* src, uint8_t* dst, int width) {
+
+    for (int x = 0; x < width; x++, src += 4, dst += 4) {
+      uint8_t c0 = src[0];
+      uint8_t c2 = src[2];
+      uint8_t a = src[3];
+      dst[0] = swap ? c2 : c0;
+      dst[1] = src[1];
+      dst[2] = swap ? c0 : c2;
+      dst[3] = opaque ? 0xFF : a;
+      }
+    }
+  //}}}
+  //{{{
+  template <bool swap> static void premultiplyScalar (const uint8_t* src, uint8_t* dst, int width) {
+
+    for (int x = 0; x < width; x++, src += 4, dst += 4) {
+      uint32_t a = src[3];
+      uint8_t c0 = div255 (src[0] * a);
+      uint8_t c1 = div255 (src[1] * a);
+      uint8_t c2 = div255 (src[2] * a);
+      dst[0] = swap ? c2 : c0;
+      dst[1] = c1;
+      dst[2] = swap ? c0 : c2;
+      dst[3] = (uint8_t)a;
+      }
+    }
+  //}}}
+  //}}}
+#if defined(MPEG2MC_SSE2)
+  //{{{  ssse3
+  //{{{
+  template <bool swap> static inline __m128i expand3Mask() {
+    return swap ? _mm_setr_epi8 (2,1,0,-1, 5,4,3,-1, 8,7,6,-1, 11,10,9,-1)
+                : _mm_setr_epi8 (0,1,2,-1, 3,4,5,-1, 6,7,8,-1, 9,10,11,-1);
+    }
+  //}}}
+  //{{{
+  template <bool swap> PIXEL_SSSE3_TARGET static void expand3Ssse3 (const uint8_t* src, uint8_t* dst, int width) {
+  // 16 pixels from 48 bytes, realigned so each shuffle sees 4 whole pixels
+
+    const __m128i mask = expand3Mask<swap>();
+    const __m128i alpha = _mm_set1_epi32 ((int)0xFF000000);
+
+    int x = 0;
+    for (; x + 16 <= width; x += 16, src += 48, dst += 64) {
+      __m128i a = _mm_loadu_si128 ((const __m128i*)src);
+      __m128i b = _mm_loadu_si128 ((const __m128i*)(src + 16));
+      __m128i c = _mm_loadu_si128 ((const __m128i*)(src + 32));
+      _mm_storeu_si128 ((__m128i*)dst, _mm_or_si128 (_mm_shuffle_epi8 (a, mask), alpha));
+      _mm_storeu_si128 ((__m128i*)(dst + 16), _mm_or_si128 (_mm_shuffle_epi8 (_mm_alignr_epi8 (b, a, 12), mask), alpha));
+      _mm_storeu_si128 ((__m128i*)(dst + 32), _mm_or_si128 (_mm_shuffle_epi8 (_mm_alignr_epi8 (c, b, 8), mask), alpha));
+      _mm_storeu_si128 ((__m128i*)(dst + 48), _mm_or_si128 (_mm_shuffle_epi8 (_mm_srli_si128 (c, 4), mask), alpha));
+      }
+
+    expand3Scalar<swap> (src, dst, width - x);
+    }
+  //}}}
+  //{{{
+  template <bool swap> static inline void widen565 (__m128i v, __m128i& lo, __m128i& hi) {
+  // 8 565 pixels to two registers of 4 bgra, or rgba if swap
+
+    const __m128i mask5 = _mm_set1_epi16 (0x1F);
+    const __m128i mask6 = _mm_set1_epi16 (0x3F);
+
+    __m128i b = _mm_and_si128 (v, mask5);
+    __m128i g = _mm_and_si128 (_mm_srli_epi16 (v, 5), mask6);
+    __m128i r = _mm_srli_epi16 (v, 11);
+    b = _mm_or_si128 (_mm_slli_epi16 (b, 3), _mm_srli_epi16 (b, 2));
+    g = _mm_or_si128 (_mm_slli_epi16 (g, 2), _mm_srli_epi16 (g, 4));
+    r = _mm_or_si128 (_mm_slli_epi16 (r, 3), _mm_srli_epi16 (r, 2));
+
+    __m128i first = _mm_or_si128 (swap ? r : b, _mm_slli_epi16 (g, 8));
+    __m128i second = _mm_or_si128 (swap ? b : r, _mm_set1_epi16 ((short)0xFF00));
+    lo = _mm_unpacklo_epi16 (first, second);
+    hi = _mm_unpackhi_epi16 (first, second);
+    }
+  //}}}
+  //{{{
+  template <bool swap> static void expand565Ssse3 (const uint8_t* src, uint8_t* dst, int width) {
+
+    int x = 0;
+    for (; x + 8 <= width; x += 8, src += 16, dst += 32) {
+      __m128i lo, hi;
+      widen565<swap> (_mm_loadu_si128 ((const __m128i*)src), lo, hi);
+      _mm_storeu_si128 ((__m128i*)dst, lo);
+      _mm_storeu_si128 ((__m128i*)(dst + 16), hi);
+      }
+
+    expand565Scalar<swap> (src, dst, width - x);
+    }
+  //}}}
+  //{{{
+  template <bool swap, bool opaque> PIXEL_SSSE3_TARGET static void swizzleSsse3 (const uint8_t* src, uint8_t* dst, int width) {
+
+    const __m128i mask = _mm_setr_epi8 (2,1,0,3, 6,5,4,7, 10,9,8,11, 14,13,12,15);
+    const __m128i alpha = _mm_set1_epi32 ((int)0xFF000000);
+
+    int x = 0;
+    for (; x + 4 <= width; x += 4, src += 16, dst += 16) {
+      __m128i v = _mm_loadu_si128 ((const __m128i*)src);
+      if (swap)
+        v = _mm_shuffle_epi8 (v, mask);
+      if (opaque)
+        v = _mm_or_si128 (v, alpha);
+      _mm_storeu_si128 ((__m128i*)dst, v);
+      }
+
+    swizzleScalar<swap,opaque> (src, dst, width - x);
+    }
+  //}}}
+  //{{{
+  static inline __m128i premultiply16 (__m128i v) {
+  // 2 pixels of 16 bit channels, alpha lane multiplied by 255 so div255 gives it back
+
+    const __m128i keepAlpha = _mm_setr_epi16 (0,0,0,255, 0,0,0,255);
+    const __m128i colourMask = _mm_setr_epi16 (-1,-1,-1,0, -1,-1,-1,0);
+
+    __m128i a = _mm_shufflehi_epi16 (_mm_shufflelo_epi16 (v, 0xFF), 0xFF);
+    a = _mm_or_si128 (_mm_and_si128 (a, colourMask), keepAlpha);
+    __m128i t = _mm_add_epi16 (_mm_mullo_epi16 (v, a), _mm_set1_epi16 (128));
+    return _mm_srli_epi16 (_mm_add_epi16 (t, _mm_srli_epi16 (t, 8)), 8);
+    }
+  //}}}
+  //{{{
+  template <bool swap> PIXEL_SSSE3_TARGET static void premultiplySsse3 (const uint8_t* src, uint8_t* dst, int width) {
+
+    const __m128i mask = _mm_setr_epi8 (2,1,0,3, 6,5,4,7, 10,9,8,11, 14,13,12,15);
+    const __m128i zero = _mm_setzero_si128();
+
+    int x = 0;
+    for (; x + 4 <= width; x += 4, src += 16, dst += 16) {
+      __m128i v = _mm_loadu_si128 ((const __m128i*)src);
+      if (swap)
+        v = _mm_shuffle_epi8 (v, mask);
+      __m128i lo = premultiply16 (_mm_unpacklo_epi8 (v, zero));
+      __m128i hi = premultiply16 (_mm_unpackhi_epi8 (v, zero));
+      _mm_storeu_si128 ((__m128i*)dst, _mm_packus_epi16 (lo, hi));
+      }
+
+    premultiplyScalar<swap> (src, dst, width - x);
+    }
+  //}}}
+  //}}}
+  //{{{  avx2
+  //{{{
+  template <bool swap> MPEG2MC_AVX2_TARGET static void expand3Avx2 (const uint8_t* src, uint8_t* dst, int width) {
+  // 16 pixels, 4 overlapping 16 byte loads of 4 pixels, last load reads 4 bytes past them, loop leaves 2 pixels spare
+
+    const __m256i mask = _mm256_broadcastsi128_si256 (expand3Mask<swap>());
+    const __m256i alpha = _mm256_set1_epi32 ((int)0xFF000000);
+
+    int x = 0;
+    for (; x + 18 <= width; x += 16, src += 48, dst += 64) {
+      __m256i v0 = _mm256_inserti128_si256 (_mm256_castsi128_si256 (_mm_loadu_si128 ((const __m128i*)src)),
+                                            _mm_loadu_si128 ((const __m128i*)(src + 12)), 1);
+      __m256i v1 = _mm256_inserti128_si256 (_mm256_castsi128_si256 (_mm_loadu_si128 ((const __m128i*)(src + 24))),
+                                            _mm_loadu_si128 ((const __m128i*)(src + 36)), 1);
+      _mm256_storeu_si256 ((__m256i*)dst, _mm256_or_si256 (_mm256_shuffle_epi8 (v0, mask), alpha));
+      _mm256_storeu_si256 ((__m256i*)(dst + 32), _mm256_or_si256 (_mm256_shuffle_epi8 (v1, mask), alpha));
+      }
+
+    expand3Ssse3<swap> (src, dst, width - x);
+    }
+  //}}}
+  //{{{
+  template <bool swap> MPEG2MC_AVX2_TARGET static void expand565Avx2 (const uint8_t* src, uint8_t* dst, int width) {
+  // 16 pixels, unpack works in lanes, permute puts pixels 0..7 then 8..15 back in order
+
+    const __m256i mask5 = _mm256_set1_epi16 (0x1F);
+    const __m256i mask6 = _mm256_set1_epi16 (0x3F);
+    const __m256i alpha = _mm256_set1_epi16 ((short)0xFF00);
+
+    int x = 0;
+    for (; x + 16 <= width; x += 16, src += 32, dst += 64) {
+      __m256i v = _mm256_loadu_si256 ((const __m256i*)src);
+      __m256i b = _mm256_and_si256 (v, mask5);
+      __m256i g = _mm256_and_si256 (_mm256_srli_epi16 (v, 5), mask6);
+      __m256i r = _mm256_srli_epi16 (v, 11);
+      b = _mm256_or_si256 (_mm256_slli_epi16 (b, 3), _mm256_srli_epi16 (b, 2));
+      g = _mm256_or_si256 (_mm256_slli_epi16 (g, 2), _mm256_srli_epi16 (g, 4));
+      r = _mm256_or_si256 (_mm256_slli_epi16 (r, 3), _mm256_srli_epi16 (r, 2));
+
+      __m256i first = _mm256_or_si256 (swap ? r : b, _mm256_slli_epi16 (g, 8));
+      __m256i second = _mm256_or_si256 (swap ? b : r, alpha);
+      __m256i lo = _mm256_unpacklo_epi16 (first, second);
+      __m256i hi = _mm256_unpackhi_epi16 (first, second);
+      _mm256_storeu_si256 ((__m256i*)dst, _mm256_permute2x128_si256 (lo, hi, 0x20));
+      _mm256_storeu_si256 ((__m256i*)(dst + 32), _mm256_permute2x128_si256 (lo, hi, 0x31));
+      }
+
+    expand565Ssse3<swap> (src, dst, width - x);
+    }
+  //}}}
+  //{{{
+  template <bool swap, bool opaque> MPEG2MC_AVX2_TARGET static void swizzleAvx2 (const uint8_t* src, uint8_t* dst, int width) {
+
+    const __m256i mask = _mm256_setr_epi8 (2,1,0,3, 6,5,4,7, 10,9,8,11, 14,13,12,15,
+                                           2,1,0,3, 6,5,4,7, 10,9,8,11, 14,13,12,15);
+    const __m256i alpha = _mm256_set1_epi32 ((int)0xFF000000);
+
+    int x = 0;
+    for (; x + 8 <= width; x += 8, src += 32, dst += 32) {
+      __m256i v = _mm256_loadu_si256 ((const __m256i*)src);
+      if (swap)
+        v = _mm256_shuffle_epi8 (v, mask);
+      if (opaque)
+        v = _mm256_or_si256 (v, alpha);
+      _mm256_storeu_si256 ((__m256i*)dst, v);
+      }
+
+    swizzleSsse3<swap,opaque> (src, dst, width - x);
+    }
+  //}}}
+  //{{{
+  template <bool swap> MPEG2MC_AVX2_TARGET static void premultiplyAvx2 (const uint8_t* src, uint8_t* dst, int width) {
+  // unpack and pack both work in lanes, pixel order survives
+
+    const __m256i mask = _mm256_setr_epi8 (2,1,0,3, 6,5,4,7, 10,9,8,11, 14,13,12,15,
+                                           2,1,0,3, 6,5,4,7, 10,9,8,11, 14,13,12,15);
+    const __m256i keepAlpha = _mm256_setr_epi16 (0,0,0,255, 0,0,0,255, 0,0,0,255, 0,0,0,255);
+    const __m256i colourMask = _mm256_setr_epi16 (-1,-1,-1,0, -1,-1,-1,0, -1,-1,-1,0, -1,-1,-1,0);
+    const __m256i round = _mm256_set1_epi16 (128);
+    const __m256i zero = _mm256_setzero_si256();
+
+    int x = 0;
+    for (; x + 8 <= width; x += 8, src += 32, dst += 32) {
+      __m256i v = _mm256_loadu_si256 ((const __m256i*)src);
+      if (swap)
+        v = _mm256_shuffle_epi8 (v, mask);
+
+      __m256i half[2] = { _mm256_unpacklo_epi8 (v, zero), _mm256_unpackhi_epi8 (v, zero) };
+      for (auto& h : half) {
+        __m256i a = _mm256_shufflehi_epi16 (_mm256_shufflelo_epi16 (h, 0xFF), 0xFF);
+        a = _mm256_or_si256 (_mm256_and_si256 (a, colourMask), keepAlpha);
+        __m256i t = _mm256_add_epi16 (_mm256_mullo_epi16 (h, a), round);
+        h = _mm256_srli_epi16 (_mm256_add_epi16 (t, _mm256_srli_epi16 (t, 8)), 8);
+        }
+      _mm256_storeu_si256 ((__m256i*)dst, _mm256_packus_epi16 (half[0], half[1]));
+      }
+
+    premultiplySsse3<swap> (src, dst, width - x);
+    }
+  //}}}
+  //}}}
+#endif
+#if defined(MPEG2MC_NEON)
+  //{{{  neon
+  //{{{
+  template <bool swap> static void expand3Neon (const uint8_t* src, uint8_t* dst, int width) {
+
+    int x = 0;
+    for (; x + 16 <= width; x += 16, src += 48, dst += 64) {
+      uint8x16x3_t v = vld3q_u8 (src);
+      uint8x16x4_t out;
+      out.val[0] = v.val[swap ? 2 : 0];
+      out.val[1] = v.val[1];
+      out.val[2] = v.val[swap ? 0 : 2];
+      out.val[3] = vdupq_n_u8 (0xFF);
+      vst4q_u8 (dst, out);
+      }
+
+    expand3Scalar<swap> (src, dst, width - x);
+    }
+  //}}}
+  //{{{
+  template <bool swap> static void expand565Neon (const uint8_t* src, uint8_t* dst, int width) {
+
+    int x = 0;
+    for (; x + 8 <= width; x += 8, src += 16, dst += 32) {
+      uint16x8_t v = vld1q_u16 ((const uint16_t*)src);
+      uint16x8_t b = vandq_u16 (v, vdupq_n_u16 (0x1F));
+      uint16x8_t g = vandq_u16 (vshrq_n_u16 (v, 5), vdupq_n_u16 (0x3F));
+      uint16x8_t r = vshrq_n_u16 (v, 11);
+
+      uint8x8x4_t out;
+      uint8x8_t b8 = vmovn_u16 (vorrq_u16 (vshlq_n_u16 (b, 3), vshrq_n_u16 (b, 2)));
+      uint8x8_t r8 = vmovn_u16 (vorrq_u16 (vshlq_n_u16 (r, 3), vshrq_n_u16 (r, 2)));
+      out.val[0] = swap ? r8 : b8;
+      out.val[1] = vmovn_u16 (vorrq_u16 (vshlq_n_u16 (g, 2), vshrq_n_u16 (g, 4)));
+      out.val[2] = swap ? b8 : r8;
+      out.val[3] = vdup_n_u8 (0xFF);
+      vst4_u8 (dst, out);
+      }
+
+    expand565Scalar<swap> (src, dst, width - x);
+    }
+  //}}}
+  //{{{
+  template <bool swap, bool opaque> static void swizzleNeon (const uint8_t* src, uint8_t* dst, int width) {
+
+    int x = 0;
+    for (; x + 16 <= width; x += 16, src += 64, dst += 64) {
+      uint8x16x4_t v = vld4q_u8 (src);
+      if (swap) {
+        uint8x16_t c0 = v.val[0];
+        v.val[0] = v.val[2];
+        v.val[2] = c0;
+        }
+      if (opaque)
+        v.val[3] = vdupq_n_u8 (0xFF);
+      vst4q_u8 (dst, v);
+      }
+
+    swizzleScalar<swap,opaque> (src, dst, width - x);
+    }
+  //}}}
+  //{{{
+  static inline uint8x16_t premultiplyNeon16 (uint8x16_t c, uint8x16_t a) {
+  // raddhn (t, rshr (t, 8)) is (t + ((t + 128) >> 8) + 128) >> 8, same rounding as div255
+
+    uint16x8_t lo = vmull_u8 (vget_low_u8 (c), vget_low_u8 (a));
+    uint16x8_t hi = vmull_u8 (vget_high_u8 (c), vget_high_u8 (a));
+    return vcombine_u8 (vraddhn_u16 (lo, vrshrq_n_u16 (lo, 8)), vraddhn_u16 (hi, vrshrq_n_u16 (hi, 8)));
+    }
+  //}}}
+  //{{{
+  template <bool swap> static void premultiplyNeon (const uint8_t* src, uint8_t* dst, int width) {
+
+    int x = 0;
+    for (; x + 16 <= width; x += 16, src += 64, dst += 64) {
+      uint8x16x4_t v = vld4q_u8 (src);
+      uint8x16x4_t out;
+      out.val[0] = premultiplyNeon16 (v.val[swap ? 2 : 0], v.val[3]);
+      out.val[1] = premultiplyNeon16 (v.val[1], v.val[3]);
+      out.val[2] = premultiplyNeon16 (v.val[swap ? 0 : 2], v.val[3]);
+      out.val[3] = v.val[3];
+      vst4q_u8 (dst, out);
+      }
+
+    premultiplyScalar<swap> (src, dst, width - x);
+    }
+  //}}}
+  //}}}
+#endif
+  };
@@ -0,0 +1,415 @@
+// cPngKernels.h - png unfilter row kernels, scalar, SSE2, NEON, picked at runtime by cpu
+// - Sub of 4 byte pixels as a 16 byte prefix sum, Average, Paeth and 3 byte Sub a pixel at a time in vector
+//   registers, scalar for other pixel sizes
+// - Up 16 bytes at a time, every isa bit exact with the scalar reference
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#include "cMpeg2mc.h"
+
+class cPngKernels {
+public:
+  // recon from filtered scanline and unfiltered previous row precon, zeros for the first row
+  // - bytewidth is bytes per pixel, 1 for sub byte pixels, length is row bytes without the filter type byte
+  typedef void (*tUnfilter) (uint8_t* recon, const uint8_t* scanline, const uint8_t* precon,
+                             uint32_t bytewidth, uint32_t length);
+
+  //{{{
+  struct sKernels {
+    const char* mName;
+    tUnfilter mUnfilter[5]; // [filterType] none, sub, up, average, paeth
+    };
+  //}}}
+
+  //{{{
+  static const sKernels* getKernels (cMpeg2mc::eIsa isa) {
+  // return kernels for isa, nullptr if not built for this target or not on this cpu
+  // - avx2 gets the sse2 kernels, the filters are serial a pixel at a time and gain nothing wider
+
+    static const sKernels kScalar = { "scalar", { noneScalar, subScalar, upScalar, averageScalar, paethScalar } };
+  #if defined(MPEG2MC_SSE2)
+    static const sKernels kSse2 = { "sse2", { noneScalar, subSse2, upSse2, averageSse2, paethSse2 } };
+  #elif defined(MPEG2MC_NEON)
+    static const sKernels kNeon = { "neon", { noneScalar, subNeon, upNeon, averageNeon, paethNeon } };
+  #endif
+
+    switch (isa) {
+      case cMpeg2mc::eScalar: return &kScalar;
+    #if defined(MPEG2MC_SSE2)
+      case cMpeg2mc::eSse2: return &kSse2;
+      case cMpeg2mc::eAvx2: return cMpeg2mc::hasAvx2() ? &kSse2 : nullptr;
+    #elif defined(MPEG2MC_NEON)
+      case cMpeg2mc::eNeon: return &kNeon;
+    #endif
+      default: return nullptr;
+      }
+    }
+  //}}}
+  //{{{
+  static const sKernels* getBestKernels() {
+
+    static const sKernels* kernels = getKernels (cMpeg2mc::getBestIsa());
+    return kernels;
+    }
+  //}}}
+
+private:
+  //{{{  scalar
+  //{{{
+  static inline int paethPredictor (int a, int b, int c) {
+  // Paeth predicter, used by PNG filter type 4
+
+    int p = a + b - c;
+    int pa = p > a ? p - a : a - p;
+    int pb = p > b ? p - b : b - p;
+    int pc = p > c ? p - c : c - p;
+
+    if (pa <= pb && pa <= pc)
+      return a;
+    else if (pb <= pc)
+      return b;
+    else
+      return c;
+    }
+  //}}}
+
+  //{{{
+  static void noneScalar (uint8_t* recon, const uint8_t* scanline, const uint8_t*, uint32_t, uint32_t length) {
+
+    memcpy (recon, scanline, length);
+    }
+  //}}}
+  //{{{
+  static void subScalar (uint8_t* recon, const uint8_t* scanline, const uint8_t*, uint32_t bytewidth, uint32_t length) {
+
+    uint32_t i;
+    for (i = 0; i < bytewidth; i++)
+      recon[i] = scanline[i];
+    for (i = bytewidth; i < length; i++)
+      recon[i] = scanline[i] + recon[i - bytewidth];
+    }
+  //}}}
+  //{{{
+  static void upScalar (uint8_t* recon, const uint8_t* scanline, const uint8_t* precon, uint32_t, uint32_t length) {
+
+    for (uint32_t i = 0; i < length; i++)
+      recon[i] = scanline[i] + precon[i];
+    }
+  //}}}
+  //{{{
+  static void averageScalar (uint8_t* recon, const uint8_t* scanline, const uint8_t* precon, uint32_t bytewidth, uint32_t length) {
+
+    uint32_t i;
+    for (i = 0; i < bytewidth; i++)
+      recon[i] = scanline[i] + precon[i] / 2;
+    for (i = bytewidth; i < length; i++)
+      recon[i] = scanline[i] + ((recon[i - bytewidth] + precon[i]) / 2);
+    }
+  //}}}
+  //{{{
+  static void paethScalar (uint8_t* recon, const uint8_t* scanline, const uint8_t* precon, uint32_t bytewidth, uint32_t length) {
+
+    uint32_t i;
+    for (i = 0; i < bytewidth; i++)
+      recon[i] = (uint8_t)(scanline[i] + paethPredictor (0, precon[i], 0));
+    for (i = bytewidth; i < length; i++)
+      recon[i] = (uint8_t)(scanline[i] + paethPredictor (recon[i - bytewidth], precon[i], precon[i - bytewidth]));
+    }
+  //}}}
+  //}}}
+
+#if defined(MPEG2MC_SSE2)
+  //{{{  sse2
+  //{{{
+  template <uint32_t kBytes> static inline __m128i loadPixelSse2 (const uint8_t* src) {
+  // 3 or 4 bytes into the low lane, no overread, 3 assembled in a register to avoid a store forward stall
+
+    int32_t pixel;
+    if (kBytes == 4)
+      memcpy (&pixel, src, 4);
+    else
+      pixel = src[0] | (src[1] << 8) | (src[2] << 16);
+    return _mm_cvtsi32_si128 (pixel);
+    }
+  //}}}
+  //{{{
+  template <uint32_t kBytes> static inline void storePixelSse2 (uint8_t* dst, __m128i pixel) {
+
+    int32_t value = _mm_cvtsi128_si32 (pixel);
+    if (kBytes == 4)
+      memcpy (dst, &value, 4);
+    else {
+      dst[0] = (uint8_t)value;
+      dst[1] = (uint8_t)(value >> 8);
+      dst[2] = (uint8_t)(value >> 16);
+      }
+    }
+  //}}}
+  //{{{
+  static inline __m128i absSse2 (__m128i x) {
+  // 16 bit abs, SSE2 has no abs_epi16
+
+    return _mm_max_epi16 (x, _mm_sub_epi16 (_mm_setzero_si128(), x));
+    }
+  //}}}
+  //{{{
+  static inline __m128i selectSse2 (__m128i mask, __m128i a, __m128i b) {
+
+    return _mm_or_si128 (_mm_and_si128 (mask, a), _mm_andnot_si128 (mask, b));
+    }
+  //}}}
+
+  //{{{
+  template <uint32_t kBytes> static void subPixelsSse2 (uint8_t* recon, const uint8_t* scanline, uint32_t length) {
+
+    __m128i a = _mm_setzero_si128();
+    for (uint32_t i = 0; i < length; i += kBytes) {
+      a = _mm_add_epi8 (loadPixelSse2<kBytes> (scanline + i), a);
+      storePixelSse2<kBytes> (recon + i, a);
+      }
+    }
+  //}}}
+  //{{{
+  static void subSse2 (uint8_t* recon, const uint8_t* scanline, const uint8_t* precon, uint32_t bytewidth, uint32_t length) {
+  // 4 byte pixels as a prefix sum, 4 pixels at a time, carried by the last pixel broadcast
+
+    if (bytewidth == 3)
+      subPixelsSse2<3> (recon, scanline, length);
+
+    else if (bytewidth == 4) {
+      __m128i a = _mm_setzero_si128();
+      uint32_t i = 0;
+      for (; i + 16 <= length; i += 16) {
+        __m128i x = _mm_loadu_si128 ((const __m128i*)(scanline + i));
+        x = _mm_add_epi8 (x, _mm_slli_si128 (x, 4));
+        x = _mm_add_epi8 (x, _mm_slli_si128 (x, 8));
+        x = _mm_add_epi8 (x, a);
+        _mm_storeu_si128 ((__m128i*)(recon + i), x);
+        a = _mm_shuffle_epi32 (x, _MM_SHUFFLE (3,3,3,3));
+        }
+      for (; i < length; i += 4) {
+        a = _mm_add_epi8 (loadPixelSse2<4> (scanline + i), a);
+        storePixelSse2<4> (recon + i, a);
+        }
+      }
+
+    else
+      subScalar (recon, scanline, precon, bytewidth, length);
+    }
+  //}}}
+  //{{{
+  static void upSse2 (uint8_t* recon, const uint8_t* scanline, const uint8_t* precon, uint32_t, uint32_t length) {
+
+    uint32_t i = 0;
+    for (; i + 16 <= length; i += 16)
+      _mm_storeu_si128 ((__m128i*)(recon + i), _mm_add_epi8 (_mm_loadu_si128 ((const __m128i*)(scanline + i)),
+                                                             _mm_loadu_si128 ((const __m128i*)(precon + i))));
+    for (; i < length; i++)
+      recon[i] = scanline[i] + precon[i];
+    }
+  //}}}
+  //{{{
+  template <uint32_t kBytes> static void averagePixelsSse2 (uint8_t* recon, const uint8_t* scanline, const uint8_t* precon, uint32_t length) {
+  // avg_epu8 rounds up, take off the odd bit to floor
+
+    __m128i one = _mm_set1_epi8 (1);
+    __m128i a = _mm_setzero_si128();
+    for (uint32_t i = 0; i < length; i += kBytes) {
+      __m128i b = loadPixelSse2<kBytes> (precon + i);
+      __m128i average = _mm_sub_epi8 (_mm_avg_epu8 (a, b), _mm_and_si128 (_mm_xor_si128 (a, b), one));
+      a = _mm_add_epi8 (loadPixelSse2<kBytes> (scanline + i), average);
+      storePixelSse2<kBytes> (recon + i, a);
+      }
+    }
+  //}}}
+  //{{{
+  static void averageSse2 (uint8_t* recon, const uint8_t* scanline, const uint8_t* precon, uint32_t bytewidth, uint32_t length) {
+
+    if (bytewidth == 3)
+      averagePixelsSse2<3> (recon, scanline, precon, length);
+    else if (bytewidth == 4)
+      averagePixelsSse2<4> (recon, scanline, precon, length);
+    else
+      averageScalar (recon, scanline, precon, bytewidth, length);
+    }
+  //}}}
+  //{{{
+  template <uint32_t kBytes> static void paethPixelsSse2 (uint8_t* recon, const uint8_t* scanline, const uint8_t* precon, uint32_t length) {
+  // 16 bit lanes, pa = |b - c|, pb = |a - c|, pc = |a + b - 2c|, nearest of a, b, c in that order on ties
+
+    __m128i zero = _mm_setzero_si128();
+    __m128i a = zero;
+    __m128i c = zero;
+    for (uint32_t i = 0; i < length; i += kBytes) {
+      __m128i b = _mm_unpacklo_epi8 (loadPixelSse2<kBytes> (precon + i), zero);
+
+      __m128i pa = _mm_sub_epi16 (b, c);
+      __m128i pb = _mm_sub_epi16 (a, c);
+      __m128i pc = absSse2 (_mm_add_epi16 (pa, pb));
+      pa = absSse2 (pa);
+      pb = absSse2 (pb);
+
+      __m128i smallest = _mm_min_epi16 (pc, _mm_min_epi16 (pa, pb));
+      __m128i nearest = selectSse2 (_mm_cmpeq_epi16 (smallest, pa), a,
+                                    selectSse2 (_mm_cmpeq_epi16 (smallest, pb), b, c));
+
+      __m128i x = _mm_add_epi8 (loadPixelSse2<kBytes> (scanline + i), _mm_packus_epi16 (nearest, nearest));
+      storePixelSse2<kBytes> (recon + i, x);
+
+      a = _mm_unpacklo_epi8 (x, zero);
+      c = b;
+      }
+    }
+  //}}}
+  //{{{
+  static void paethSse2 (uint8_t* recon, const uint8_t* scanline, const uint8_t* precon, uint32_t bytewidth, uint32_t length) {
+
+    if (bytewidth == 3)
+      paethPixelsSse2<3> (recon, scanline, precon, length);
+    else if (bytewidth == 4)
+      paethPixelsSse2<4> (recon, scanline, precon, length);
+    else
+      paethScalar (recon, scanline, precon, bytewidth, length);
+    }
+  //}}}
+  //}}}
+#endif
+
+#if defined(MPEG2MC_NEON)
+  //{{{  neon
+  //{{{
+  template <uint32_t kBytes> static inline uint8x8_t loadPixelNeon (const uint8_t* src) {
+  // 3 or 4 bytes into the low lane, no overread, 3 assembled in a register to avoid a store forward stall
+
+    uint32_t pixel;
+    if (kBytes == 4)
+      memcpy (&pixel, src, 4);
+    else
+      pixel = src[0] | (src[1] << 8) | (src[2] << 16);
+    return vreinterpret_u8_u32 (vdup_n_u32 (pixel));
+    }
+  //}}}
+  //{{{
+  template <uint32_t kBytes> static inline void storePixelNeon (uint8_t* dst, uint8x8_t pixel) {
+
+    uint32_t value = vget_lane_u32 (vreinterpret_u32_u8 (pixel), 0);
+    if (kBytes == 4)
+      memcpy (dst, &value, 4);
+    else {
+      dst[0] = (uint8_t)value;
+      dst[1] = (uint8_t)(value >> 8);
+      dst[2] = (uint8_t)(value >> 16);
+      }
+    }
+  //}}}
+
+  //{{{
+  template <uint32_t kBytes> static void subPixelsNeon (uint8_t* recon, const uint8_t* scanline, uint32_t length) {
+
+    uint8x8_t a = vdup_n_u8 (0);
+    for (uint32_t i = 0; i < length; i += kBytes) {
+      a = vadd_u8 (loadPixelNeon<kBytes> (scanline + i), a);
+      storePixelNeon<kBytes> (recon + i, a);
+      }
+    }
+  //}}}
+  //{{{
+  static void subNeon (uint8_t* recon, const uint8_t* scanline, const uint8_t* precon, uint32_t bytewidth, uint32_t length) {
+  // 4 byte pixels as a prefix sum, 4 pixels at a time, carried by the last pixel broadcast
+
+    if (bytewidth == 3)
+      subPixelsNeon<3> (recon, scanline, length);
+
+    else if (bytewidth == 4) {
+      uint8x16_t zero = vdupq_n_u8 (0);
+      uint8x16_t a = zero;
+      uint32_t i = 0;
+      for (; i + 16 <= length; i += 16) {
+        uint8x16_t x = vld1q_u8 (scanline + i);
+        x = vaddq_u8 (x, vextq_u8 (zero, x, 12));
+        x = vaddq_u8 (x, vextq_u8 (zero, x, 8));
+        x = vaddq_u8 (x, a);
+        vst1q_u8 (recon + i, x);
+        a = vreinterpretq_u8_u32 (vdupq_n_u32 (vgetq_lane_u32 (vreinterpretq_u32_u8 (x), 3)));
+        }
+      uint8x8_t pixel = vget_low_u8 (a);
+      for (; i < length; i += 4) {
+        pixel = vadd_u8 (loadPixelNeon<4> (scanline + i), pixel);
+        storePixelNeon<4> (recon + i, pixel);
+        }
+      }
+
+    else
+      subScalar (recon, scanline, precon, bytewidth, length);
+    }
+  //}}}
+  //{{{
+  static void upNeon (uint8_t* recon, const uint8_t* scanline, const uint8_t* precon, uint32_t, uint32_t length) {
+
+    uint32_t i = 0;
+    for (; i + 16 <= length; i += 16)
+      vst1q_u8 (recon + i, vaddq_u8 (vld1q_u8 (scanline + i), vld1q_u8 (precon + i)));
+    for (; i < length; i++)
+      recon[i] = scanline[i] + precon[i];
+    }
+  //}}}
+  //{{{
+  template <uint32_t kBytes> static void averagePixelsNeon (uint8_t* recon, const uint8_t* scanline, const uint8_t* precon, uint32_t length) {
+  // vhadd floors, as the png average
+
+    uint8x8_t a = vdup_n_u8 (0);
+    for (uint32_t i = 0; i < length; i += kBytes) {
+      a = vadd_u8 (loadPixelNeon<kBytes> (scanline + i), vhadd_u8 (a, loadPixelNeon<kBytes> (precon + i)));
+      storePixelNeon<kBytes> (recon + i, a);
+      }
+    }
+  //}}}
+  //{{{
+  static void averageNeon (uint8_t* recon, const uint8_t* scanline, const uint8_t* precon, uint32_t bytewidth, uint32_t length) {
+
+    if (bytewidth == 3)
+      averagePixelsNeon<3> (recon, scanline, precon, length);
+    else if (bytewidth == 4)
+      averagePixelsNeon<4> (recon, scanline, precon, length);
+    else
+      averageScalar (recon, scanline, precon, bytewidth, length);
+    }
+  //}}}
+  //{{{
+  template <uint32_t kBytes> static void paethPixelsNeon (uint8_t* recon, const uint8_t* scanline, const uint8_t* precon, uint32_t length) {
+  // pa = |b - c|, pb = |a - c| as 8 bit absolute differences, pc = |a + b - 2c| in 16 bits
+
+    uint8x8_t a = vdup_n_u8 (0);
+    uint8x8_t c = vdup_n_u8 (0);
+    for (uint32_t i = 0; i < length; i += kBytes) {
+      uint8x8_t b = loadPixelNeon<kBytes> (precon + i);
+
+      uint16x8_t pa = vabdl_u8 (b, c);
+      uint16x8_t pb = vabdl_u8 (a, c);
+      int16x8_t pcs = vsubq_s16 (vreinterpretq_s16_u16 (vaddl_u8 (a, b)), vreinterpretq_s16_u16 (vshll_n_u8 (c, 1)));
+      uint16x8_t pc = vreinterpretq_u16_s16 (vabsq_s16 (pcs));
+
+      uint8x8_t useA = vmovn_u16 (vandq_u16 (vcleq_u16 (pa, pb), vcleq_u16 (pa, pc)));
+      uint8x8_t useB = vmovn_u16 (vcleq_u16 (pb, pc));
+      uint8x8_t nearest = vbsl_u8 (useA, a, vbsl_u8 (useB, b, c));
+
+      a = vadd_u8 (loadPixelNeon<kBytes> (scanline + i), nearest);
+      storePixelNeon<kBytes> (recon + i, a);
+      c = b;
+      }
+    }
+  //}}}
+  //{{{
+  static void paethNeon (uint8_t* recon, const uint8_t* scanline, const uint8_t* precon, uint32_t bytewidth, uint32_t length) {
+
+    if (bytewidth == 3)
+      paethPixelsNeon<3> (recon, scanline, precon, length);
+    else if (bytewidth == 4)
+      paethPixelsNeon<4> (recon, scanline, precon, length);
+    else
+      paethScalar (recon, scanline, precon, bytewidth, length);
+    }
+  //}}}
+  //}}}
+#endif
+  };
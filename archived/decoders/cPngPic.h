@@ -1,6 +1,13 @@
 // cPng.h
+// - streaming inflate, IDAT chunks read in place, rows unfiltered one at a time into decodeBody or a row callback
+// - table driven inflate, 64 bit bit buffer, lookahead decodes up to two literals, unfilter kernels from cPngKernels
 #pragma once
 #include "iPic.h"
+#include <limits.h>
+#include <algorithm>
+#include <functional>
+
+#include "cPngKernels.h"
 //{{{  defines
 #define MAKE_BYTE(b) ((b) & 0xFF)
 #define MAKE_DWORD(a,b,c,d) ((MAKE_BYTE(a) << 24) | (MAKE_BYTE(b) << 16) | (MAKE_BYTE(c) << 8) | MAKE_BYTE(d))
@@ -9,6 +16,8 @@
 #define CHUNK_IHDR MAKE_DWORD('I','H','D','R')
 #define CHUNK_IDAT MAKE_DWORD('I','D','A','T')
 #define CHUNK_IEND MAKE_DWORD('I','E','N','D')
+#define CHUNK_PLTE MAKE_DWORD('P','L','T','E')
+#define CHUNK_tRNS MAKE_DWORD('t','R','N','S')
 
 #define FIRST_LENGTH_CODE_INDEX 257
 #define LAST_LENGTH_CODE_INDEX 285
@@ -18,19 +27,16 @@
 #define NUM_CODE_LENGTH_CODES 19  /*the code length codes. 0-15: code lengths, 16: copy previous 3-6 times, 17: 3-10 zeros, 18: 11-138 zeros */
 #define MAX_SYMBOLS 288 /* largest number of symbols used by any tree type */
 
-#define DEFLATE_CODE_BITLEN 15
-#define DISTANCE_BITLEN 15
-#define CODE_LENGTH_BITLEN 7
 #define MAX_BIT_LENGTH 15 /* largest bitlen used by any tree type */
 
-#define DEFLATE_CODE_BUFFER_SIZE (NUM_DEFLATE_CODE_SYMBOLS * 2)
-#define DISTANCE_BUFFER_SIZE (NUM_DISTANCE_SYMBOLS * 2)
-#define CODE_LENGTH_BUFFER_SIZE (NUM_DISTANCE_SYMBOLS * 2)
-
 #define upng_chunk_length(chunk) MAKE_DWORD_PTR(chunk)
 #define upng_chunk_type(chunk) MAKE_DWORD_PTR((chunk) + 4)
 #define upng_chunk_critical(chunk) (((chunk)[4] & 32) == 0)
 //}}}
+static const uint32_t kPngWindowSize = 0x8000;  // deflate window
+static const uint32_t kPngMaxMatch = 258;       // longest deflate match
+static const uint32_t kPngFastBits = 10;        // huffman lookahead bits
+static const uint32_t kPngPair = 0x20;          // lookahead entry flag, two literals
 
 class cPngPic : public iPic {
 public:
@@ -61,19 +67,27 @@ public:
     PNG_LUMINANCE_ALPHA1,
     PNG_LUMINANCE_ALPHA2,
     PNG_LUMINANCE_ALPHA4,
-    PNG_LUMINANCE_ALPHA8
+    PNG_LUMINANCE_ALPHA8,
+    PNG_PALETTE1,
+    PNG_PALETTE2,
+    PNG_PALETTE4,
+    PNG_PALETTE8
     };
   //}}}
   //{{{
   enum ePngColor {
     PNG_LUM    = 0,
     PNG_RGB    = 2,
+    PNG_PALETTE = 3,
     PNG_LUMA   = 4,
     PNG_RGBA   = 6
     };
   //}}}
+  // row is mWidth pixels of getBpp bits, padded to whole bytes, valid only during the callback
+  using tRowCallback = std::function<void (uint32_t y, const uint8_t* row)>;
+
   cPngPic() {}
-  cPngPic (const uint8_t* buffer) : mSrcBuffer(buffer) {}
+  cPngPic (const uint8_t* buffer, size_t size = 0) : mSrcBuffer(buffer), mSrcSize(size) {}
   virtual ~cPngPic() {}
   void* operator new (std::size_t size) { return malloc (size); }
   void operator delete (void *ptr) { free (ptr); }
@@ -85,6 +99,7 @@ public:
   virtual uint16_t getComponents() {
     switch (mColourType) {
       case PNG_LUM:
+      case PNG_PALETTE:
         return 1;
       case PNG_RGB:
         return 3;
@@ -102,6 +117,8 @@ public:
 
   uint16_t getBitDepth() { return mColourDepth; }
   ePngFormat getFormat() { return mFormat; }
+  bool isPalette() { return mColourType == PNG_PALETTE; }
+  const uint8_t* getPalette() { return &mPalette[0][0]; }  // 256 rgba, tRNS alpha, unused entries opaque black
   //{{{
   uint16_t getPixelSize() {
     uint32_t bits = getBitDepth() * getComponents();
@@ -111,11 +128,31 @@ public:
   //}}}
   uint16_t getBpp() { return getBitDepth() * getComponents(); }
   ePngError getError() { return mError; }
+  const char* getIsaName() { return mKernels->mName; }
+
+  //{{{
+  bool setIsa (cMpeg2mc::eIsa isa) {
+  // select unfilter kernels, false leaves them unchanged if isa not available on this cpu
+
+    auto kernels = cPngKernels::getKernels (isa);
+    if (!kernels)
+      return false;
+
+    mKernels = kernels;
+    return true;
+    }
+  //}}}
 
   //{{{
   bool readHeader() {
   //read the information from the header and store it in the upng_Info. return value is error
 
+    // signature 8, IHDR length, type, 13 bytes data, crc
+    if (mSrcSize < 33) {
+      mError = PNG_EMALFORMED;
+      return false;
+      }
+
     /* check that PNG header matches expected value */
     if (mSrcBuffer[0] != 137 || mSrcBuffer[1] != 80 || mSrcBuffer[2] != 78 || mSrcBuffer[3] != 71 ||
         mSrcBuffer[4] != 13  || mSrcBuffer[5] != 10 || mSrcBuffer[6] != 26 || mSrcBuffer[7] != 10) {
@@ -135,6 +172,11 @@ public:
     mColourDepth = mSrcBuffer[24];
     mColourType = (ePngColor)mSrcBuffer[25];
 
+    if (mSrcBuffer[28] != 0) {
+      mError = PNG_EUNINTERLACED;
+      return false;
+      }
+
     // determine our color format
     mFormat = determineFormat();
     if (mFormat == PNG_BADFORMAT) {
@@ -147,116 +189,81 @@ public:
   //}}}
   //{{{
   uint8_t* decodeBody() {
-  /*read a PNG, the result will be in the same color type as the PNG (hence "generic")*/
+  // decode into one malloced pic, BGRA for RGBA8, BGR for RGB8, other formats as stored, palette as indices
+  // - sub byte formats packed without row padding
 
-    // point to first byte of first chunk after header
-    auto chunk = mSrcBuffer + 33;
-    //{{{  scan chunks, find size of all IDAT chunks, verify well-formed-ness
-    uint32_t compressed_size = 0;
-    while (true) {
-      uint32_t length;
-
-      /* get length; sanity check it */
-      length = upng_chunk_length (chunk);
-      if (length > INT_MAX) {
-        mError = PNG_EMALFORMED;
-        return nullptr;
-        }
-
-      /* parse chunks */
-      if (upng_chunk_type (chunk) == CHUNK_IDAT)
-        compressed_size += length;
-      else if (upng_chunk_type (chunk) == CHUNK_IEND)
-        break;
-      else if (upng_chunk_critical (chunk)) {
-        mError = PNG_EUNSUPPORTED;
-        return nullptr;
-        }
-
-      chunk += upng_chunk_length(chunk) + 12;
-      }
-    //}}}
-
-    auto compressed = (uint8_t*)malloc (compressed_size);
-    if (compressed == NULL) {
-      //{{{  error
+    uint64_t picSize = ((uint64_t)mHeight * mWidth * getBpp() + 7) / 8;
+    if (picSize > UINT32_MAX) {
       mError = PNG_ENOMEM;
       return nullptr;
       }
-      //}}}
-    //{{{  scan again, copy chunks into compressed
-    // scan through the chunks again, copying into our compressed buffer
-    chunk = mSrcBuffer + 33;
-    uint32_t compressed_index = 0;
-    while (true) {
-      uint32_t length = upng_chunk_length (chunk);
-      auto data = chunk + 8;
 
-      // parse chunks
-      if (upng_chunk_type(chunk) == CHUNK_IDAT) {
-        memcpy (compressed + compressed_index, data, length);
-        compressed_index += length;
-        }
-      else if (upng_chunk_type (chunk) == CHUNK_IEND)
-        break;
-
-      chunk += upng_chunk_length (chunk) + 12;
-      }
-    //}}}
-
-    // allocate inflated,filtered image
-    uint32_t inflated_size = ((mWidth * (mHeight * getBpp() + 7)) / 8) + mHeight;
-    auto inflated = (uint8_t*)malloc (inflated_size);
-    if (inflated == NULL) {
-      //{{{  error
-      free (compressed);
-      mError = PNG_ENOMEM;
-      return nullptr;
-      }
-      //}}}
-
-    // decompress image data
-    mError = uzInflate (inflated, inflated_size, compressed, compressed_size);
-    if (mError != PNG_EOK) {
-      free (compressed);
-      free (inflated);
-      return nullptr;
-      }
-    // free compressed image
-    free (compressed);
-
-    // allocate final image
-    mPicSize = (mHeight * mWidth * getBpp() + 7) / 8;
+    mPicSize = (uint32_t)picSize;
     mPicBuf = (uint8_t*)malloc (mPicSize);
     if (mPicBuf == NULL) {
       //{{{  error
-      free (inflated);
       mPicSize = 0;
       mError = PNG_ENOMEM;
       return nullptr;
       }
       //}}}
 
-    // unfilter scanlines
-    postProcessScanlines (mPicBuf, inflated);
-    free (inflated);
-
-    if (mError != PNG_EOK) {
+    uint32_t lineBits = mWidth * getBpp();
+    bool pack = lineBits & 7;
+    if (pack) // bits past the last pixel
+      mPicBuf[mPicSize - 1] = 0;
+    if (!decodeRows ([&](uint32_t y, const uint8_t* row) {
+          if (pack)
+            packRowBits (mPicBuf, row, y * lineBits, lineBits);
+          else
+            memcpy (mPicBuf + (y * (lineBits / 8)), row, lineBits / 8);
+          })) {
       free (mPicBuf);
       mPicBuf = NULL;
       mPicSize = 0;
       }
 
-    auto rgbaBuf = (uint32_t*)mPicBuf;
-    for (int i = 0; i < mWidth * mHeight; i++)
-      rgbaBuf[i] = (rgbaBuf[i] & 0xFF00FF00) | ((rgbaBuf[i] & 0x000000FF) << 16) | ((rgbaBuf[i] & 0x00FF0000) >> 16);
-
     return mPicBuf;
     }
   //}}}
+  //{{{
+  bool decodeRows (tRowCallback rowCallback) {
+  // streaming decode, IDAT chunks inflated in place, rows unfiltered and passed to rowCallback top down
+  // - working set a 32k window plus a few rows, row valid only during the callback
+
+    mRowCallback = rowCallback;
+    mRowBytes = (mWidth * getBpp() + 7) / 8;
+    mRowY = 0;
+    if (!mRowBytes) {
+      mError = PNG_EMALFORMED;
+      return false;
+      }
+
+    // inflate output holds the window and any partial row, drained well before a match can overflow it
+    // - 16 bytes slack for the 8 byte match copy overrun
+    mOutSize = (4 * std::max (kPngWindowSize, mRowBytes + 1)) + kPngMaxMatch;
+    mOutBuf = (uint8_t*)malloc (mOutSize + 16);
+    mRows = (uint8_t*)calloc (4, mRowBytes);
+    if (!mOutBuf || !mRows)
+      mError = PNG_ENOMEM;
+    else if (firstIdat())
+      uzInflate();
+
+    if ((mError == PNG_EOK) && (mRowY < mHeight))
+      mError = PNG_EMALFORMED;
+
+    free (mOutBuf);
+    free (mRows);
+    mOutBuf = nullptr;
+    mRows = nullptr;
+    mRowCallback = nullptr;
+    return mError == PNG_EOK;
+    }
+  //}}}
 
 protected:
   const uint8_t* mSrcBuffer = nullptr;
+  size_t mSrcSize = 0;  // readHeader needs at least signature and IHDR
 
 private:
   //{{{  const
@@ -293,80 +300,78 @@ private:
   /*the order in which "code length alphabet code lengths" are stored, out of this the huffman tree of the dynamic huffman tree lengths is generated */
   = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
   //}}}
-  //{{{
-  const uint32_t FIXED_DEFLATE_CODE_TREE[NUM_DEFLATE_CODE_SYMBOLS * 2] = {
-    289, 370, 290, 307, 546, 291, 561, 292, 293, 300, 294, 297, 295, 296, 0, 1,
-    2, 3, 298, 299, 4, 5, 6, 7, 301, 304, 302, 303, 8, 9, 10, 11, 305, 306, 12,
-    13, 14, 15, 308, 339, 309, 324, 310, 317, 311, 314, 312, 313, 16, 17, 18,
-    19, 315, 316, 20, 21, 22, 23, 318, 321, 319, 320, 24, 25, 26, 27, 322, 323,
-    28, 29, 30, 31, 325, 332, 326, 329, 327, 328, 32, 33, 34, 35, 330, 331, 36,
-    37, 38, 39, 333, 336, 334, 335, 40, 41, 42, 43, 337, 338, 44, 45, 46, 47,
-    340, 355, 341, 348, 342, 345, 343, 344, 48, 49, 50, 51, 346, 347, 52, 53,
-    54, 55, 349, 352, 350, 351, 56, 57, 58, 59, 353, 354, 60, 61, 62, 63, 356,
-    363, 357, 360, 358, 359, 64, 65, 66, 67, 361, 362, 68, 69, 70, 71, 364,
-    367, 365, 366, 72, 73, 74, 75, 368, 369, 76, 77, 78, 79, 371, 434, 372,
-    403, 373, 388, 374, 381, 375, 378, 376, 377, 80, 81, 82, 83, 379, 380, 84,
-    85, 86, 87, 382, 385, 383, 384, 88, 89, 90, 91, 386, 387, 92, 93, 94, 95,
-    389, 396, 390, 393, 391, 392, 96, 97, 98, 99, 394, 395, 100, 101, 102, 103,
-    397, 400, 398, 399, 104, 105, 106, 107, 401, 402, 108, 109, 110, 111, 404,
-    419, 405, 412, 406, 409, 407, 408, 112, 113, 114, 115, 410, 411, 116, 117,
-    118, 119, 413, 416, 414, 415, 120, 121, 122, 123, 417, 418, 124, 125, 126,
-    127, 420, 427, 421, 424, 422, 423, 128, 129, 130, 131, 425, 426, 132, 133,
-    134, 135, 428, 431, 429, 430, 136, 137, 138, 139, 432, 433, 140, 141, 142,
-    143, 435, 483, 436, 452, 568, 437, 438, 445, 439, 442, 440, 441, 144, 145,
-    146, 147, 443, 444, 148, 149, 150, 151, 446, 449, 447, 448, 152, 153, 154,
-    155, 450, 451, 156, 157, 158, 159, 453, 468, 454, 461, 455, 458, 456, 457,
-    160, 161, 162, 163, 459, 460, 164, 165, 166, 167, 462, 465, 463, 464, 168,
-    169, 170, 171, 466, 467, 172, 173, 174, 175, 469, 476, 470, 473, 471, 472,
-    176, 177, 178, 179, 474, 475, 180, 181, 182, 183, 477, 480, 478, 479, 184,
-    185, 186, 187, 481, 482, 188, 189, 190, 191, 484, 515, 485, 500, 486, 493,
-    487, 490, 488, 489, 192, 193, 194, 195, 491, 492, 196, 197, 198, 199, 494,
-    497, 495, 496, 200, 201, 202, 203, 498, 499, 204, 205, 206, 207, 501, 508,
-    502, 505, 503, 504, 208, 209, 210, 211, 506, 507, 212, 213, 214, 215, 509,
-    512, 510, 511, 216, 217, 218, 219, 513, 514, 220, 221, 222, 223, 516, 531,
-    517, 524, 518, 521, 519, 520, 224, 225, 226, 227, 522, 523, 228, 229, 230,
-    231, 525, 528, 526, 527, 232, 233, 234, 235, 529, 530, 236, 237, 238, 239,
-    532, 539, 533, 536, 534, 535, 240, 241, 242, 243, 537, 538, 244, 245, 246,
-    247, 540, 543, 541, 542, 248, 249, 250, 251, 544, 545, 252, 253, 254, 255,
-    547, 554, 548, 551, 549, 550, 256, 257, 258, 259, 552, 553, 260, 261, 262,
-    263, 555, 558, 556, 557, 264, 265, 266, 267, 559, 560, 268, 269, 270, 271,
-    562, 565, 563, 564, 272, 273, 274, 275, 566, 567, 276, 277, 278, 279, 569,
-    572, 570, 571, 280, 281, 282, 283, 573, 574, 284, 285, 286, 287, 0, 0
-  };
   //}}}
   //{{{
-  const uint32_t FIXED_DISTANCE_TREE[NUM_DISTANCE_SYMBOLS * 2] = {
-    33, 48, 34, 41, 35, 38, 36, 37, 0, 1, 2, 3, 39, 40, 4, 5, 6, 7, 42, 45, 43,
-    44, 8, 9, 10, 11, 46, 47, 12, 13, 14, 15, 49, 56, 50, 53, 51, 52, 16, 17,
-    18, 19, 54, 55, 20, 21, 22, 23, 57, 60, 58, 59, 24, 25, 26, 27, 61, 62, 28,
-    29, 30, 31, 0, 0
-  };
+  struct sHuff {
+  // canonical huffman, lsb first lookahead, entry is symbol << 16 | bits, or two literals for litlen
+  // - codes longer than kPngFastBits, or not in the table, found from left aligned code limits per length
+    uint32_t mFast[1 << kPngFastBits];
+    int32_t mMaxCode[17];  // [bits] left aligned 16 bit code limit, [16] sentinel
+    int32_t mDelta[16];    // [bits] mSymbols index minus first code
+    uint16_t mSymbols[NUM_DEFLATE_CODE_SYMBOLS];
+    };
   //}}}
+
+  //{{{
+  int getInByte() {
+  // next byte of the concatenated IDAT data, walks on into following IDAT chunks, -1 past the last
+
+    while (mInPtr == mInEnd)
+      if (!nextIdat())
+        return -1;
+
+    return *mInPtr++;
+    }
   //}}}
   //{{{
-  typedef struct tHuffTree {
-    uint32_t* tree2d;
-    uint32_t maxbitlen; /*maximum number of bits a single code can get */
-    uint32_t numcodes;  /*number of symbols in the alphabet = number of codes */
-    } tHuffTree;
+  inline void refill() {
+  // top mBitBuf up to more than 56 bits, 8 bytes at a time inside a chunk
+  // - past the end of the IDAT data feeds zeros, counted in mPadBits, overrun if any get consumed
+
+    if (mInEnd - mInPtr >= 8) {
+      uint64_t bytes;
+      memcpy (&bytes, mInPtr, 8);
+      mBitBuf |= bytes << mBitCount;
+      mInPtr += (63 - mBitCount) >> 3;
+      mBitCount |= 56;
+      }
+    else
+      while (mBitCount <= 56) {
+        int byte = getInByte();
+        if (byte < 0) {
+          byte = 0;
+          mPadBits += 8;
+          }
+        mBitBuf |= (uint64_t)byte << mBitCount;
+        mBitCount += 8;
+        }
+    }
   //}}}
-
   //{{{
-  uint8_t readBit (uint32_t* bitPointer, const uint8_t* bitstream) {
+  inline void consume (uint32_t nbits) {
 
-    uint8_t result = (uint8_t)((bitstream [(*bitPointer) >> 3] >> ((*bitPointer) & 0x7)) & 1);
-    (*bitPointer)++;
+    mBitBuf >>= nbits;
+    mBitCount -= nbits;
+    }
+  //}}}
+  //{{{
+  bool overrun() {
+  // true, and malformed, if bits past the end of the IDAT data were used
 
-    return result;
+    if (mPadBits > mBitCount)
+      mError = PNG_EMALFORMED;
+    return mError != PNG_EOK;
     }
   //}}}
   //{{{
-  uint32_t readBits (uint32_t* bitPointer, const uint8_t* bitstream, uint32_t nbits) {
+  inline uint32_t readBits (uint32_t nbits) {
+  // lsb first, 0..16 bits
 
-    uint32_t result = 0;
-    for (uint32_t i = 0; i < nbits; i++)
-      result |= ((uint32_t)readBit (bitPointer, bitstream)) << i;
+    if (mBitCount < nbits)
+      refill();
 
+    uint32_t result = (uint32_t)mBitBuf & ((1u << nbits) - 1);
+    consume (nbits);
     return result;
     }
   //}}}
@@ -401,6 +406,21 @@ private:
           }
       //}}}
       //{{{
+      case PNG_PALETTE:
+        switch (mColourDepth) {
+          case 1:
+            return PNG_PALETTE1;
+          case 2:
+            return PNG_PALETTE2;
+          case 4:
+            return PNG_PALETTE4;
+          case 8:
+            return PNG_PALETTE8;
+          default:
+            return PNG_BADFORMAT;
+          }
+      //}}}
+      //{{{
       case PNG_LUMA:
         switch (mColourDepth) {
           case 1:
@@ -433,140 +453,134 @@ private:
   //}}}
 
   //{{{
-  void huffTreeInit (tHuffTree* tree, uint32_t* buffer, uint32_t numcodes, uint32_t maxbitlen) {
-  /* the buffer must be numcodes*2 in size! */
-
-    tree->tree2d = buffer;
-    tree->numcodes = numcodes;
-    tree->maxbitlen = maxbitlen;
+  static inline uint32_t reverseBits (uint32_t code, uint32_t nbits) {
+  // deflate sends huffman codes msb first into an lsb first stream
+
+    code = ((code & 0x5555) << 1) | ((code >> 1) & 0x5555);
+    code = ((code & 0x3333) << 2) | ((code >> 2) & 0x3333);
+    code = ((code & 0x0F0F) << 4) | ((code >> 4) & 0x0F0F);
+    code = ((code & 0x00FF) << 8) | ((code >> 8) & 0x00FF);
+    return code >> (16 - nbits);
     }
   //}}}
   //{{{
-  void huffTreeCreateLengths (tHuffTree* tree, const uint32_t* bitlen) {
-  /*given the code lengths (as stored in the PNG file), generate the tree as defined by Deflate. maxbitlen is the maximum bits that a code in the tree can have. return value is error.*/
-
-    uint32_t tree1d[MAX_SYMBOLS];
-    uint32_t blcount[MAX_BIT_LENGTH];
-    uint32_t nextcode[MAX_BIT_LENGTH+1];
-    uint32_t bits, n, i;
-    uint32_t nodefilled = 0;  /*up to which node it is filled */
-    uint32_t treepos = 0; /*position in the tree (1 of the numcodes columns) */
-
-    // initialize local vectors
-    memset (blcount, 0, sizeof(blcount));
-    memset (nextcode, 0, sizeof(nextcode));
-
-    // step 1: count number of instances of each code length
-    for (bits = 0; bits < tree->numcodes; bits++)
-      blcount[bitlen[bits]]++;
-
-    // step 2: generate the nextcode values
-    for (bits = 1; bits <= tree->maxbitlen; bits++)
-      nextcode[bits] = (nextcode[bits - 1] + blcount[bits - 1]) << 1;
-
-    // step 3: generate all the codes
-    for (n = 0; n < tree->numcodes; n++)
-      if (bitlen[n] != 0)
-        tree1d[n] = nextcode[bitlen[n]]++;
-
-    // convert tree1d[] to tree2d[][]. In the 2D array, a value of 32767 means uninited,
-    // a value >= numcodes is an address to another bit, a value < numcodes is a code.
-    // The 2 rows are the 2 possible bit values (0 or 1), there are as many columns as codes - 1
-    // a good huffmann tree has N * 2 - 1 nodes, of which N - 1 are internal nodes.
-    // Here, the internal nodes are stored (what their 0 and 1 option point to).
-    // There is only memory for such good tree currently,
-    // if there are more nodes (due to too long length codes), error 55 will happen
-    for (n = 0; n < tree->numcodes * 2; n++)
-      tree->tree2d[n] = 32767;  /*32767 here means the tree2d isn't filled there yet */
-
-    for (n = 0; n < tree->numcodes; n++) {  /*the codes */
-      for (i = 0; i < bitlen[n]; i++) { /*the bits for this code */
-        uint8_t bit = (uint8_t)((tree1d[n] >> (bitlen[n] - i - 1)) & 1);
-        /* check if oversubscribed */
-        if (treepos > tree->numcodes - 2) {
-          mError = PNG_EMALFORMED;
-          return;
-          }
+  void buildHuff (sHuff& huff, const uint32_t* bitlen, uint32_t numcodes, bool pairs) {
+  // canonical codes from code lengths, fill lookahead table, reject oversubscribed codes
+  // - pairs packs a second literal into litlen entries when both codes fit the lookahead
+
+    uint32_t count[MAX_BIT_LENGTH+1];
+    memset (count, 0, sizeof(count));
+    for (uint32_t n = 0; n < numcodes; n++)
+      count[bitlen[n]]++;
+    count[0] = 0;
+
+    // limits, deltas, symbols sorted by length
+    int32_t left = 1;
+    uint32_t code = 0;
+    uint32_t index = 0;
+    uint32_t offset[MAX_BIT_LENGTH+1];
+    for (uint32_t bits = 1; bits <= MAX_BIT_LENGTH; bits++) {
+      left = (left << 1) - count[bits];
+      if (left < 0) {
+        mError = PNG_EMALFORMED;
+        return;
+        }
 
-        if (tree->tree2d[2 * treepos + bit] == 32767) { /*not yet filled in */
-          if (i + 1 == bitlen[n]) { /*last bit */
-            tree->tree2d[2 * treepos + bit] = n;  /*put the current code in it */
-            treepos = 0;
-            }
-          else {  /*put address of the next step in here, first that address has to be found of course (it's just nodefilled + 1)... */
-            nodefilled++;
-            tree->tree2d[2 * treepos + bit] = nodefilled + tree->numcodes;  /*addresses encoded with numcodes added to it */
-            treepos = nodefilled;
-            }
+      offset[bits] = index;
+      huff.mDelta[bits] = index - code;
+      code += count[bits];
+      index += count[bits];
+      huff.mMaxCode[bits] = code << (16 - bits);
+      code <<= 1;
+      }
+    huff.mMaxCode[16] = 0x7FFFFFFF;
+
+    memset (huff.mFast, 0, sizeof(huff.mFast));
+    for (uint32_t n = 0; n < numcodes; n++) {
+      uint32_t bits = bitlen[n];
+      if (bits) {
+        uint32_t index = offset[bits]++;
+        huff.mSymbols[index] = (uint16_t)n;
+        if (bits <= kPngFastBits) {
+          // every lookahead starting with this code, reversed for lsb first
+          uint32_t code = index - huff.mDelta[bits];
+          for (uint32_t i = reverseBits (code, bits); i < (1u << kPngFastBits); i += 1 << bits)
+            huff.mFast[i] = (n << 16) | bits;
           }
-        else
-          treepos = tree->tree2d[2 * treepos + bit] - tree->numcodes;
         }
       }
 
-    for (n = 0; n < tree->numcodes * 2; n++)
-      if (tree->tree2d[n] == 32767)
-        tree->tree2d[n] = 0;  /*remove possible remaining 32767's */
+    if (pairs)
+      // top down, so the second code is looked up before its own entry becomes a pair
+      for (uint32_t i = (1 << kPngFastBits); i-- > 0; ) {
+        uint32_t first = huff.mFast[i];
+        uint32_t bits = first & 0x1F;
+        if (first && ((first >> 16) < 256) && (bits < kPngFastBits)) {
+          uint32_t second = huff.mFast[i >> bits];
+          uint32_t secondBits = second & 0x1F;
+          if (second && !(second & kPngPair) && ((second >> 16) < 256) && (bits + secondBits <= kPngFastBits))
+            huff.mFast[i] = (((second >> 16) << 24) | ((first >> 16) << 16)) | kPngPair | (bits + secondBits);
+          }
+        }
     }
   //}}}
   //{{{
-  uint32_t huffDecodeSymbol (const uint8_t* in, uint32_t* bp, const tHuffTree* codetree, uint32_t inlength) {
+  uint32_t decodeSlow (const sHuff& huff) {
+  // code longer than the lookahead, or invalid, msb first 16 bit peek against the left aligned limits
+
+    int32_t peek = (int32_t)reverseBits ((uint32_t)mBitBuf & 0xFFFF, 16);
+    uint32_t bits = kPngFastBits + 1;
+    while (peek >= huff.mMaxCode[bits])
+      bits++;
+    if (bits > MAX_BIT_LENGTH) {
+      mError = PNG_EMALFORMED;
+      return 0;
+      }
 
-    uint32_t treepos = 0;
-    while (true) {
-      /* error: end of input memory reached without endcode */
-      if (((*bp) & 0x07) == 0 && ((*bp) >> 3) > inlength) {
-        mError = PNG_EMALFORMED;
-        return 0;
-        }
+    consume (bits);
+    return huff.mSymbols[(peek >> (16 - bits)) + huff.mDelta[bits]];
+    }
+  //}}}
+  //{{{
+  inline uint32_t decodeSymbol (const sHuff& huff) {
+  // needs 15 bits in mBitBuf, no pairs
 
-      uint8_t bit = readBit(bp, in);
-      uint32_t ct = codetree->tree2d[(treepos << 1) | bit];
-      if (ct < codetree->numcodes)
-        return ct;
+    uint32_t entry = huff.mFast[mBitBuf & ((1 << kPngFastBits) - 1)];
+    if (!entry)
+      return decodeSlow (huff);
 
-      treepos = ct - codetree->numcodes;
-      if (treepos >= codetree->numcodes) {
-        mError = PNG_EMALFORMED;
-        return 0;
-        }
-      }
+    consume (entry & 0x1F);
+    return entry >> 16;
     }
   //}}}
   //{{{
-  void getTreeInflateDynamic (tHuffTree* codetree, tHuffTree* codetreeD, tHuffTree* codelengthcodetree,
-                              const uint8_t* in, uint32_t* bp, uint32_t inlength) {
+  void getTreeInflateDynamic (sHuff& codetree, sHuff& codetreeD) {
   /* get the tree of a deflated block with dynamic tree, the tree itself is also Huffman compressed with a known tree*/
 
     uint32_t codelengthcode[NUM_CODE_LENGTH_CODES];
     uint32_t bitlen[NUM_DEFLATE_CODE_SYMBOLS];
     uint32_t bitlenD[NUM_DISTANCE_SYMBOLS];
     uint32_t n, hlit, hdist, hclen, i;
+    sHuff codelengthcodetree;
 
     /*make sure that length values that aren't filled in will be 0, or a wrong tree will be generated */
-    /*C-code note: use no "return" between ctor and dtor of an uivector! */
-    if ((*bp) >> 3 >= inlength - 2) {
-      mError = PNG_EMALFORMED;
-      return;
-      }
-
     /* clear bitlen arrays */
     memset (bitlen, 0, sizeof(bitlen));
     memset (bitlenD, 0, sizeof(bitlenD));
 
     /*the bit pointer is or will go past the memory */
-    hlit = readBits (bp, in, 5) + 257;  /*number of literal/length codes + 257. Unlike the spec, the value 257 is added to it here already */
-    hdist = readBits (bp, in, 5) + 1; /*number of distance codes. Unlike the spec, the value 1 is added to it here already */
-    hclen = readBits (bp, in, 4) + 4; /*number of code length codes. Unlike the spec, the value 4 is added to it here already */
+    hlit = readBits (5) + 257;  /*number of literal/length codes + 257. Unlike the spec, the value 257 is added to it here already */
+    hdist = readBits (5) + 1; /*number of distance codes. Unlike the spec, the value 1 is added to it here already */
+    hclen = readBits (4) + 4; /*number of code length codes. Unlike the spec, the value 4 is added to it here already */
 
     for (i = 0; i < NUM_CODE_LENGTH_CODES; i++) {
       if (i < hclen)
-        codelengthcode[CLCL[i]] = readBits(bp, in, 3);
+        codelengthcode[CLCL[i]] = readBits (3);
       else
         codelengthcode[CLCL[i]] = 0;  /*if not, it must stay 0 */
       }
 
-    huffTreeCreateLengths (codelengthcodetree, codelengthcode);
+    buildHuff (codelengthcodetree, codelengthcode, NUM_CODE_LENGTH_CODES, false);
 
     /* bail now if we encountered an error earlier */
     if (mError != PNG_EOK)
@@ -575,7 +589,8 @@ private:
     /*now we can use this tree to read the lengths for the tree that this function will return */
     i = 0;
     while (i < hlit + hdist) {  /*i is the current symbol we're reading in the part that contains the code lengths of lit/len codes and dist codes */
-      uint32_t code = huffDecodeSymbol (in, bp, codelengthcodetree, inlength);
+      refill();
+      uint32_t code = decodeSymbol (codelengthcodetree);
       if (mError != PNG_EOK) {
         break;
         }
@@ -591,12 +606,13 @@ private:
         uint32_t replength = 3; /*read in the 2 bits that indicate repeat length (3-6) */
         uint32_t value; /*set value to the previous code */
 
-        if ((*bp) >> 3 >= inlength) {
+        replength += readBits (2);
+
+        /* no previous code to repeat */
+        if (i == 0) {
           mError = PNG_EMALFORMED;
           break;
           }
-        /*error, bit pointer jumps past memory */
-        replength += readBits (bp, in, 2);
 
         if ((i - 1) < hlit)
           value = bitlen[i - 1];
@@ -620,13 +636,8 @@ private:
         }
       else if (code == 17) {  /*repeat "0" 3-10 times */
         uint32_t replength = 3; /*read in the bits that indicate repeat length */
-        if ((*bp) >> 3 >= inlength) {
-          mError = PNG_EMALFORMED;
-          break;
-          }
 
-        /*error, bit pointer jumps past memory */
-        replength += readBits (bp, in, 3);
+        replength += readBits (3);
 
         /*repeat this value in the next lengths */
         for (n = 0; n < replength; n++) {
@@ -645,13 +656,8 @@ private:
         }
       else if (code == 18) {  /*repeat "0" 11-138 times */
         uint32_t replength = 11;  /*read in the bits that indicate repeat length */
-        /* error, bit pointer jumps past memory */
-        if ((*bp) >> 3 >= inlength) {
-          mError = PNG_EMALFORMED;
-          break;
-          }
 
-        replength += readBits(bp, in, 7);
+        replength += readBits (7);
 
         /*repeat this value in the next lengths */
         for (n = 0; n < replength; n++) {
@@ -680,182 +686,178 @@ private:
     /*the length of the end code 256 must be larger than 0 */
     /*now we've finally got hlit and hdist, so generate the code trees, and the function is done */
     if (mError == PNG_EOK)
-      huffTreeCreateLengths (codetree, bitlen);
+      buildHuff (codetree, bitlen, NUM_DEFLATE_CODE_SYMBOLS, true);
 
     if (mError == PNG_EOK)
-      huffTreeCreateLengths (codetreeD, bitlenD);
+      buildHuff (codetreeD, bitlenD, NUM_DISTANCE_SYMBOLS, false);
     }
   //}}}
 
   //{{{
-  void inflateHuff (uint8_t* out, uint32_t outsize, const uint8_t *in, uint32_t *bp, uint32_t *pos, uint32_t inlength, uint32_t btype) {
-  // inflate a block with dynamic of fixed Huffman tree
-
-    uint32_t codetree_buffer[DEFLATE_CODE_BUFFER_SIZE];
-    uint32_t codetreeD_buffer[DISTANCE_BUFFER_SIZE];
-    uint32_t done = 0;
-
-    tHuffTree codetree;
-    tHuffTree codetreeD;
+  void inflateHuff (uint32_t btype) {
+  // inflate a block with dynamic or fixed Huffman tree
+  // - refill once per symbol, 56 bits cover litlen, length extra, distance and distance extra
 
     if (btype == 1) {
-      // fixed trees
-      huffTreeInit (&codetree, (uint32_t*)FIXED_DEFLATE_CODE_TREE, NUM_DEFLATE_CODE_SYMBOLS, DEFLATE_CODE_BITLEN);
-      huffTreeInit (&codetreeD, (uint32_t*)FIXED_DISTANCE_TREE, NUM_DISTANCE_SYMBOLS, DISTANCE_BITLEN);
+      // fixed trees, built once
+      if (!mFixedBuilt) {
+        uint32_t bitlen[NUM_DEFLATE_CODE_SYMBOLS];
+        for (uint32_t n = 0; n < NUM_DEFLATE_CODE_SYMBOLS; n++)
+          bitlen[n] = (n < 144) ? 8 : (n < 256) ? 9 : (n < 280) ? 7 : 8;
+        buildHuff (mFixedLit, bitlen, NUM_DEFLATE_CODE_SYMBOLS, true);
+        for (uint32_t n = 0; n < NUM_DISTANCE_SYMBOLS; n++)
+          bitlen[n] = 5;
+        buildHuff (mFixedDist, bitlen, NUM_DISTANCE_SYMBOLS, false);
+        mFixedBuilt = true;
+        }
       }
-    else if (btype == 2) {
+    else {
       // dynamic trees
-      uint32_t codelengthcodetree_buffer[CODE_LENGTH_BUFFER_SIZE];
-      tHuffTree codelengthcodetree;
-
-      huffTreeInit (&codetree, codetree_buffer, NUM_DEFLATE_CODE_SYMBOLS, DEFLATE_CODE_BITLEN);
-      huffTreeInit (&codetreeD, codetreeD_buffer, NUM_DISTANCE_SYMBOLS, DISTANCE_BITLEN);
-      huffTreeInit (&codelengthcodetree, codelengthcodetree_buffer, NUM_CODE_LENGTH_CODES, CODE_LENGTH_BITLEN);
-      getTreeInflateDynamic (&codetree, &codetreeD, &codelengthcodetree, in, bp, inlength);
-      }
-
-    while (done == 0) {
-      uint32_t code = huffDecodeSymbol (in, bp, &codetree, inlength);
+      getTreeInflateDynamic (mLit, mDist);
       if (mError != PNG_EOK)
         return;
+      }
 
-      if (code == 256) // end code
-        done = 1;
-      else if (code <= 255) { // literal symbol
-        if ((*pos) >= outsize) {
-          mError = PNG_EMALFORMED;
+    const sHuff& codetree = (btype == 1) ? mFixedLit : mLit;
+    const sHuff& codetreeD = (btype == 1) ? mFixedDist : mDist;
+    while (true) {
+      // room for the longest match
+      if (mOutPos + kPngMaxMatch > mOutSize) {
+        drain();
+        if (overrun())
           return;
-          }
-
-        // store output
-        out[(*pos)++] = (uint8_t)(code);
         }
-      else if (code >= FIRST_LENGTH_CODE_INDEX && code <= LAST_LENGTH_CODE_INDEX) { // length code
-        // part 1: get length base */
-        uint32_t length = LENGTH_BASE[code - FIRST_LENGTH_CODE_INDEX];
-        uint32_t codeD, distance, numextrabitsD;
-        uint32_t start, forward, backward, numextrabits;
 
-        // part 2: get extra bits and add the value of that to length
-        numextrabits = LENGTH_EXTRA[code - FIRST_LENGTH_CODE_INDEX];
-
-        // error, bit pointer will jump past memory
-        if (((*bp) >> 3) >= inlength) {
-          mError = PNG_EMALFORMED;
-          return;
+      refill();
+      uint32_t entry = codetree.mFast[mBitBuf & ((1 << kPngFastBits) - 1)];
+      uint32_t code;
+      if (entry) {
+        consume (entry & 0x1F);
+        if (entry & kPngPair) {
+          // two literals
+          mOutBuf[mOutPos] = (uint8_t)(entry >> 16);
+          mOutBuf[mOutPos+1] = (uint8_t)(entry >> 24);
+          mOutPos += 2;
+          continue;
           }
-        length += readBits(bp, in, numextrabits);
-
-        // part 3: get distance code
-        codeD = huffDecodeSymbol(in, bp, &codetreeD, inlength);
+        code = entry >> 16;
+        }
+      else {
+        code = decodeSlow (codetree);
         if (mError != PNG_EOK)
           return;
+        }
 
-        // invalid distance code (30-31 are never used)
-        if (codeD > 29) {
-          mError = PNG_EMALFORMED;
-          return;
-          }
-
-        distance = DISTANCE_BASE[codeD];
+      if (code <= 255) // literal symbol
+        mOutBuf[mOutPos++] = (uint8_t)(code);
+      else if (code == 256) // end code
+        return;
+      else if (code <= LAST_LENGTH_CODE_INDEX) { // length code
+        // part 1,2: get length base and extra bits
+        uint32_t length = LENGTH_BASE[code - FIRST_LENGTH_CODE_INDEX];
+        uint32_t numextrabits = LENGTH_EXTRA[code - FIRST_LENGTH_CODE_INDEX];
+        length += (uint32_t)mBitBuf & ((1u << numextrabits) - 1);
+        consume (numextrabits);
 
-        // part 4: get extra bits from distance
-        numextrabitsD = DISTANCE_EXTRA[codeD];
+        // part 3: get distance code
+        uint32_t codeD = decodeSymbol (codetreeD);
 
-        // error, bit pointer will jump past memory
-        if (((*bp) >> 3) >= inlength) {
+        // invalid distance code (30-31 are never used)
+        if ((mError != PNG_EOK) || (codeD > 29)) {
           mError = PNG_EMALFORMED;
           return;
           }
 
-        distance += readBits(bp, in, numextrabitsD);
-
-        // part 5: fill in all the out[n] values based on the length and dist
-        start = (*pos);
-        backward = start - distance;
+        // part 4: get extra bits from distance
+        uint32_t numextrabitsD = DISTANCE_EXTRA[codeD];
+        uint32_t distance = DISTANCE_BASE[codeD] + ((uint32_t)mBitBuf & ((1u << numextrabitsD) - 1));
+        consume (numextrabitsD);
 
-        if ((*pos) + length >= outsize) {
+        // distance back past the start of the data, mOutBuf always keeps the last kPngWindowSize bytes
+        if (distance > mOutPos) {
           mError = PNG_EMALFORMED;
           return;
           }
 
-        for (forward = 0; forward < length; forward++) {
-          out[(*pos)++] = out[backward];
-          backward++;
-
-          if (backward >= start)
-            backward = start - distance;
-          }
+        // part 5: copy, 8 bytes at a time unless the match overlaps them, may write 8 bytes past the end
+        uint8_t* out = mOutBuf + mOutPos;
+        const uint8_t* backward = out - distance;
+        mOutPos += length;
+        if (distance >= 8)
+          for (uint32_t forward = 0; forward < length; forward += 8)
+            memcpy (out + forward, backward + forward, 8);
+        else if (distance == 1)
+          memset (out, *backward, length);
+        else
+          for (uint32_t forward = 0; forward < length; forward++)
+            out[forward] = backward[forward];
+        }
+      else {
+        mError = PNG_EMALFORMED;
+        return;
         }
       }
     }
   //}}}
   //{{{
-  void inflateUncompressed (uint8_t* out, uint32_t outsize, const uint8_t* in, uint32_t* bp, uint32_t* pos, uint32_t inlength) {
-
-    uint32_t p;
-    uint32_t len, nlen, n;
+  void inflateUncompressed() {
 
-    // go to first boundary of byte
-    while (((*bp) & 0x7) != 0)
-      (*bp)++;
-    p = (*bp) / 8;    /*byte position */
+    // go to first boundary of byte, whole bytes left in mBitBuf are copied from there first
+    consume (mBitCount & 7);
 
     // read len (2 bytes) and nlen (2 bytes)
-    if (p >= inlength - 4) {
-      mError = PNG_EMALFORMED;
-      return;
-      }
-
-    len = in[p] + 256 * in[p + 1];
-    p += 2;
-    nlen = in[p] + 256 * in[p + 1];
-    p += 2;
+    uint32_t len = readBits (16);
+    uint32_t nlen = readBits (16);
 
     // check if 16-bit nlen is really the one's complement of len
-    if (len + nlen != 65535) {
-      mError = PNG_EMALFORMED;
-      return;
-      }
-
-    if ((*pos) + len >= outsize) {
+    if (overrun() || (len + nlen != 65535)) {
       mError = PNG_EMALFORMED;
       return;
       }
 
     /* read the literal data: len bytes are now stored in the out buffer */
-    if (p + len > inlength) {
-      mError = PNG_EMALFORMED;
-      return;
-      }
+    while (len) {
+      if (mOutPos == mOutSize) {
+        drain();
+        if (mError != PNG_EOK)
+          return;
+        }
 
-    for (n = 0; n < len; n++)
-      out[(*pos)++] = in[p++];
+      if (mBitCount) {
+        mOutBuf[mOutPos++] = (uint8_t)readBits (8);
+        len--;
+        }
+      else if (mInPtr == mInEnd) {
+        if (!nextIdat()) {
+          mError = PNG_EMALFORMED;
+          return;
+          }
+        }
+      else {
+        // bits above mBitCount are lookahead of the bytes copied here, drop them
+        mBitBuf = 0;
+        uint32_t bytes = std::min (std::min (len, mOutSize - mOutPos), (uint32_t)(mInEnd - mInPtr));
+        memcpy (mOutBuf + mOutPos, mInPtr, bytes);
+        mInPtr += bytes;
+        mOutPos += bytes;
+        len -= bytes;
+        }
+      }
 
-    (*bp) = p * 8;
+    overrun();
     }
   //}}}
   //{{{
-  ePngError uzInflateData (uint8_t* out, uint32_t outsize, const uint8_t* in, uint32_t insize, uint32_t inpos) {
+  ePngError uzInflateData() {
   // inflate the deflated data (cfr. deflate spec); return value is the error
 
-    // bit pointer in the "in" data, current byte is bp >> 3, current bit is bp & 0x7 (from lsb to msb of the byte)
-    uint32_t bp = 0;
-
-    // byte position in the out buffer
-    uint32_t pos = 0;
-
     uint32_t done = 0;
     while (done == 0) {
-      // ensure next bit doesn't point past the end of the buffer
-      if ((bp >> 3) >= insize) {
-        mError = PNG_EMALFORMED;
-        return mError;
-        }
-
       // read block control bits */
-      done = readBit (&bp, &in[inpos]);
-      uint32_t btype = readBit (&bp, &in[inpos]) | (readBit(&bp, &in[inpos]) << 1);
+      done = readBits (1);
+      uint32_t btype = readBits (2);
+      if (overrun())
+        return mError;
 
       // process control type appropriateyly
       if (btype == 3) {
@@ -863,216 +865,206 @@ private:
         return mError;
         }
       else if (btype == 0)
-        inflateUncompressed (out, outsize, &in[inpos], &bp, &pos, insize);  // no compression
+        inflateUncompressed();  // no compression
       else
-        inflateHuff (out, outsize, &in[inpos], &bp, &pos, insize, btype);  //compression, btype 01 or 10
+        inflateHuff (btype);  //compression, btype 01 or 10
 
-      // stop if an error has occured */
-      if (mError != PNG_EOK)
+      // stop if an error has occured, or the input ran out */
+      if (overrun())
         return mError;
       }
 
+    // rows of the last window
+    emitRows();
     return mError;
     }
   //}}}
   //{{{
-  ePngError uzInflate (uint8_t* out, uint32_t outsize, const uint8_t* in, uint32_t insize) {
+  ePngError uzInflate() {
 
     // we require two bytes for the zlib data header
-    if (insize < 2) {
-      mError = PNG_EMALFORMED;
+    uint32_t cmf = readBits (8);
+    uint32_t flg = readBits (8);
+    if (mError != PNG_EOK)
       return mError;
-      }
 
     // 256 * in[0] + in[1] must be a multiple of 31, the FCHECK value is supposed to be made that way
-    if ((in[0] * 256 + in[1]) % 31 != 0) {
+    if ((cmf * 256 + flg) % 31 != 0) {
       mError = PNG_EMALFORMED;
       return mError;
       }
 
     // error: only compression method 8: inflate with sliding window of 32k is supported by the PNG spec
-    if ((in[0] & 15) != 8 || ((in[0] >> 4) & 15) > 7) {
+    if ((cmf & 15) != 8 || ((cmf >> 4) & 15) > 7) {
       mError = PNG_EMALFORMED;
       return mError;
       }
 
     // the specification of PNG says about the zlib stream: "The additional flags shall not specify a preset dictionary."
-    if (((in[1] >> 5) & 1) != 0) {
+    if (((flg >> 5) & 1) != 0) {
       mError = PNG_EMALFORMED;
       return mError;
       }
 
-    // create output buffer
-    uzInflateData (out, outsize, in, insize, 2);
+    mOutPos = 0;
+    mRowPos = 0;
+    uzInflateData();
 
     return mError;
     }
   //}}}
 
   //{{{
-  int paeth_predictor (int a, int b, int c) {
-  /*Paeth predicter, used by PNG filter type 4*/
-
-    int p = a + b - c;
-    int pa = p > a ? p - a : a - p;
-    int pb = p > b ? p - b : b - p;
-    int pc = p > c ? p - c : c - p;
-
-    if (pa <= pb && pa <= pc)
-      return a;
-    else if (pb <= pc)
-      return b;
-    else
-      return c;
+  void packRowBits (uint8_t* out, const uint8_t* in, uint32_t obp, uint32_t bits) {
+  // copy a row of bits to bit obp of out, drops the padding bits at the end of sub byte rows
+
+    for (uint32_t ibp = 0; ibp < bits; ibp++, obp++) {
+      uint8_t bit = (uint8_t)((in[ibp >> 3] >> (7 - (ibp & 0x7))) & 1);
+      if (bit == 0)
+        out[obp >> 3] &= (uint8_t)(~(1 << (7 - (obp & 0x7))));
+      else
+        out[obp >> 3] |= (1 << (7 - (obp & 0x7)));
+      }
     }
   //}}}
+
   //{{{
-  void unfilterScanline (uint8_t* recon, const uint8_t* scanline, const uint8_t* precon, uint32_t bytewidth, uint8_t filterType, uint32_t length) {
-  // For PNG filter method 0
-  //   unfilter a PNG image scanline by scanline. when the pixels are smaller than 1 byte, the filter works byte per byte (bytewidth = 1)
-  //   precon is the previous unfiltered scanline, recon the result, scanline the current one
-  //   the incoming scanlines do NOT include the filtertype byte, that one is given in the parameter filterType instead
-  //   recon and scanline MAY be the same memory address! precon must be disjoint.
-
-    uint32_t i;
-    switch (filterType) {
-      //{{{
-      case 0:
-        for (i = 0; i < length; i++)
-          recon[i] = scanline[i];
-        break;
-      //}}}
-      //{{{
-      case 1:
-        for (i = 0; i < bytewidth; i++)
-          recon[i] = scanline[i];
-        for (i = bytewidth; i < length; i++)
-          recon[i] = scanline[i] + recon[i - bytewidth];
-        break;
-      //}}}
-      //{{{
-      case 2:
-        if (precon)
-          for (i = 0; i < length; i++)
-            recon[i] = scanline[i] + precon[i];
-        else
-          for (i = 0; i < length; i++)
-            recon[i] = scanline[i];
-        break;
-      //}}}
-      //{{{
-      case 3:
-        if (precon) {
-          for (i = 0; i < bytewidth; i++)
-            recon[i] = scanline[i] + precon[i] / 2;
-          for (i = bytewidth; i < length; i++)
-            recon[i] = scanline[i] + ((recon[i - bytewidth] + precon[i]) / 2);
-          }
-        else {
-          for (i = 0; i < bytewidth; i++)
-            recon[i] = scanline[i];
-          for (i = bytewidth; i < length; i++)
-            recon[i] = scanline[i] + recon[i - bytewidth] / 2;
-          }
-        break;
-      //}}}
-      //{{{
-      case 4:
-        if (precon) {
-          for (i = 0; i < bytewidth; i++)
-            recon[i] = (uint8_t)(scanline[i] + paeth_predictor (0, precon[i], 0));
-          for (i = bytewidth; i < length; i++)
-            recon[i] = (uint8_t)(scanline[i] + paeth_predictor (recon[i - bytewidth], precon[i], precon[i - bytewidth]));
-          }
-        else {
-          for (i = 0; i < bytewidth; i++)
-            recon[i] = scanline[i];
-          for (i = bytewidth; i < length; i++)
-            recon[i] = (uint8_t)(scanline[i] + paeth_predictor (recon[i - bytewidth], 0, 0));
-          }
-        break;
-      //}}}
-      //{{{
-      default:
-        mError = PNG_EMALFORMED;
-        break;
-      //}}}
-      }
+  bool chunkFits (const uint8_t* chunk) {
+  // chunk length sane, and inside the buffer when its size is known
+
+    if (!mSrcSize)
+      return (uint32_t)upng_chunk_length (chunk) <= (uint32_t)INT_MAX;
+
+    size_t left = mSrcBuffer + mSrcSize - chunk;
+    return (chunk <= mSrcBuffer + mSrcSize) && (left >= 12) && ((size_t)(uint32_t)upng_chunk_length (chunk) <= left - 12);
     }
   //}}}
   //{{{
-  void unfilter (uint8_t* out, const uint8_t* in, uint32_t w, uint32_t h, uint32_t bpp) {
-  //  For PNG filter method 0
-  //   this function unfilters a single image (e.g. without interlacing this is called once, with Adam7 it's called 7 times)
-  //   out must have enough bytes allocated already, in must have the scanlines + 1 filtertype byte per scanline
-  //   w and h are image dimensions or dimensions of reduced image, bpp is bpp per pixel
-  //   in and out are allowed to be the same memory address!
-
-    uint8_t* prevline = 0;
+  bool firstIdat() {
+  // walk chunks from the one after IHDR to the first IDAT, verify well-formed-ness, pick up PLTE, tRNS
 
-    /*bytewidth is used for filtering, is 1 when bpp < 8, number of bytes per pixel otherwise */
-    uint32_t bytewidth = (bpp + 7) / 8;
-    uint32_t linebytes = (w * bpp + 7) / 8;
+    for (int i = 0; i < 256; i++) {
+      mPalette[i][0] = mPalette[i][1] = mPalette[i][2] = 0;
+      mPalette[i][3] = 0xFF;
+      }
+    bool palette = false;
 
-    for (uint32_t y = 0; y < h; y++) {
-      uint32_t outindex = linebytes * y;
-      uint32_t inindex = (1 + linebytes) * y;  /*the extra filterbyte added to each row */
-      uint8_t filterType = in[inindex];
+    mChunk = mSrcBuffer + 33;
+    while (true) {
+      /* get length; sanity check it */
+      if (!chunkFits (mChunk)) {
+        mError = PNG_EMALFORMED;
+        return false;
+        }
 
-      unfilterScanline (&out[outindex], &in[inindex + 1], prevline, bytewidth, filterType, linebytes);
-      if (mError != PNG_EOK)
-        return;
+      /* parse chunks */
+      if (upng_chunk_type (mChunk) == CHUNK_IDAT) {
+        if ((mColourType == PNG_PALETTE) && !palette) {
+          mError = PNG_EMALFORMED;
+          return false;
+          }
+        mInPtr = mChunk + 8;
+        mInEnd = mInPtr + upng_chunk_length (mChunk);
+        mBitBuf = 0;
+        mBitCount = 0;
+        mPadBits = 0;
+        return true;
+        }
+      else if (upng_chunk_type (mChunk) == CHUNK_IEND) {
+        mError = PNG_EMALFORMED;
+        return false;
+        }
+      else if (upng_chunk_type (mChunk) == CHUNK_PLTE) {
+        //{{{  palette, also allowed as a suggestion for truecolour
+        uint32_t length = upng_chunk_length (mChunk);
+        if ((length % 3) || !length || (length > 256 * 3)) {
+          mError = PNG_EMALFORMED;
+          return false;
+          }
+        for (uint32_t i = 0; i < length / 3; i++)
+          memcpy (mPalette[i], mChunk + 8 + i * 3, 3);
+        palette = true;
+        }
+        //}}}
+      else if ((upng_chunk_type (mChunk) == CHUNK_tRNS) && (mColourType == PNG_PALETTE)) {
+        //{{{  palette alpha, entries past the end stay opaque
+        uint32_t length = std::min (upng_chunk_length (mChunk), 256);
+        for (uint32_t i = 0; i < length; i++)
+          mPalette[i][3] = mChunk[8 + i];
+        }
+        //}}}
+      else if (upng_chunk_critical (mChunk)) {
+        mError = PNG_EUNSUPPORTED;
+        return false;
+        }
 
-      prevline = &out[outindex];
+      mChunk += upng_chunk_length (mChunk) + 12;
       }
     }
   //}}}
+  //{{{
+  bool nextIdat() {
+  // step to the next chunk, false unless it continues the IDAT data, mChunk left on the last IDAT
+
+    auto chunk = mChunk + upng_chunk_length (mChunk) + 12;
+    if (!chunkFits (chunk) || (upng_chunk_type (chunk) != CHUNK_IDAT))
+      return false;
 
+    mChunk = chunk;
+    mInPtr = mChunk + 8;
+    mInEnd = mInPtr + upng_chunk_length (mChunk);
+    return true;
+    }
+  //}}}
   //{{{
-  void removePaddingBits (uint8_t* out, const uint8_t *in, uint32_t olinebits, uint32_t ilinebits, uint32_t h) {
-  // After filtering there are still padding bpp if scanlines have non multiple of 8 bit amounts. They need to be removed (except at last scanline of (Adam7-reduced) image) before working with pure image buffers for the Adam7 code, the color convert code and the output to the user.
-  // in and out are allowed to be the same buffer, in may also be higher but still overlapping; in must have >= ilinebits*h bpp, out must have >= olinebits*h bpp, olinebits must be <= ilinebits
-  // also used to move bpp after earlier such operations happened, e.g. in a sequence of reduced images from Adam7
-  // only useful if (ilinebits - olinebits) is a value in the range 1..7
-
-    uint32_t ibp = 0;
-    uint32_t obp = 0;
-    uint32_t diff = ilinebits - olinebits;
-
-    for (uint32_t y = 0; y < h; y++) {
-      for (uint32_t x = 0; x < olinebits; x++) {
-        uint8_t bit = (uint8_t)((in[(ibp) >> 3] >> (7 - ((ibp) & 0x7))) & 1);
-        ibp++;
-
-        if (bit == 0)
-          out[(obp) >> 3] &= (uint8_t)(~(1 << (7 - ((obp) & 0x7))));
-        else
-          out[(obp) >> 3] |= (1 << (7 - ((obp) & 0x7)));
-        ++obp;
+  void emitRows() {
+  // unfilter each complete row in mOutBuf, swizzle RGBA8, RGB8 to BGRA, BGR, pass to mRowCallback
+
+    uint32_t bytewidth = (getBpp() + 7) / 8;
+    while ((mOutPos - mRowPos > mRowBytes) && (mRowY < mHeight)) {
+      uint8_t* row = mRows + ((mRowY & 1) * mRowBytes);
+      uint8_t* prevRow = mRows + ((mRowY ? ((mRowY + 1) & 1) : 3) * mRowBytes);
+      uint8_t filterType = mOutBuf[mRowPos];
+      if (filterType > 4) {
+        mError = PNG_EMALFORMED;
+        return;
+        }
+      mKernels->mUnfilter[filterType] (row, mOutBuf + mRowPos + 1, prevRow, bytewidth, mRowBytes);
+      mRowPos += mRowBytes + 1;
+
+      if ((mFormat == PNG_RGBA8) || (mFormat == PNG_RGB8)) {
+        // row stays unfiltered for the next, swizzle a copy
+        uint8_t* bgrRow = mRows + (2 * mRowBytes);
+        for (uint32_t i = 0; i < mRowBytes; i += bytewidth) {
+          bgrRow[i] = row[i+2];
+          bgrRow[i+1] = row[i+1];
+          bgrRow[i+2] = row[i];
+          if (bytewidth == 4)
+            bgrRow[i+3] = row[i+3];
+          }
+        mRowCallback (mRowY++, bgrRow);
         }
-      ibp += diff;
+      else
+        mRowCallback (mRowY++, row);
       }
+
+    // anything past the last row is ignored
+    if (mRowY == mHeight)
+      mRowPos = mOutPos;
     }
   //}}}
   //{{{
-  void postProcessScanlines (uint8_t* out, uint8_t* in) {
-  // out must be buffer big enough to contain full image, and in must contain the full decompressed data from the IDAT chunks
+  void drain() {
+  // emit complete rows, slide the window and any partial row down to the start of mOutBuf
 
-    uint32_t bpp = getBpp();
-    if (bpp == 0) {
-      mError = PNG_EMALFORMED;
+    emitRows();
+    if (mError != PNG_EOK)
       return;
-      }
 
-    if ((bpp < 8) && (mWidth * bpp != ((mWidth * bpp + 7) / 8) * 8)) {
-      unfilter (in, in, mWidth, mHeight, bpp);
-      if (mError != PNG_EOK)
-        return;
-      removePaddingBits (out, in, mWidth * bpp, ((mWidth * bpp + 7) / 8) * 8, mHeight);
-      }
-    else
-      // filter into the out buffer
-      unfilter (out, in, mWidth, mHeight, bpp);
+    uint32_t keepFrom = std::min (mRowPos, (mOutPos > kPngWindowSize) ? mOutPos - kPngWindowSize : 0);
+    memmove (mOutBuf, mOutBuf + keepFrom, mOutPos - keepFrom);
+    mOutPos -= keepFrom;
+    mRowPos -= keepFrom;
     }
   //}}}
 
@@ -1086,6 +1078,35 @@ private:
 
   uint8_t* mPicBuf = nullptr;
   uint32_t mPicSize = 0;
+  uint8_t mPalette[256][4];
+
+  // IDAT input, current chunk and data left in it
+  const uint8_t* mChunk = nullptr;
+  const uint8_t* mInPtr = nullptr;
+  const uint8_t* mInEnd = nullptr;
+  uint64_t mBitBuf = 0;    // lsb first
+  uint32_t mBitCount = 0;
+  uint32_t mPadBits = 0;   // zero bits fed past the end of the IDAT data
+
+  // huffman tables of the current block, fixed tables built on first use
+  sHuff mLit;
+  sHuff mDist;
+  sHuff mFixedLit;
+  sHuff mFixedDist;
+  bool mFixedBuilt = false;
+  const cPngKernels::sKernels* mKernels = cPngKernels::getBestKernels();
+
+  // inflate output, last kPngWindowSize bytes and the unconsumed rows
+  uint8_t* mOutBuf = nullptr;
+  uint32_t mOutSize = 0;
+  uint32_t mOutPos = 0;
+  uint32_t mRowPos = 0;    // filter byte of the next row in mOutBuf
+
+  // unfiltered rows, current, previous, swizzled and a zero row above the first
+  uint8_t* mRows = nullptr;
+  uint32_t mRowBytes = 0;
+  uint32_t mRowY = 0;
+  tRowCallback mRowCallback;
 
   ePngError mError = PNG_EOK;
   };
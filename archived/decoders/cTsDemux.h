@@ -0,0 +1,549 @@
+// cTsDemux.h - transport stream demux, pid bitmap filter, pes reassembly, pat pmt eit sections
+// - push any number of 188 byte packets per call, unfiltered pids cost a sync check and a bit test
+// - pes reassembled in a reused per pid buffer, zero padded so decoders can read ahead past the end
+// - sections reassembled per pid, unchanged versions skipped before crc or parse
+#pragma once
+//{{{  includes
+#include <stdint.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+#include <array>
+#include <map>
+#include <unordered_map>
+#include <functional>
+#include <algorithm>
+//}}}
+
+class cTsDemux {
+public:
+  static const int kPacketSize = 188;
+
+  //{{{
+  struct sEitEvent {
+    int mTableId;     // 0x4E 0x4F present following, 0x50..0x6F schedule
+    int mSection;
+    int mVersion;
+    int mServiceId;
+    int mEventId;
+    int64_t mStartTime; // unix seconds, utc
+    int mDuration;      // seconds
+    int mRunning;       // running_status, 4 running
+    std::string mTitle;
+    std::string mDescription;
+    };
+  //}}}
+
+  // es is the pes payload after the pes header, zero padded, valid only during the callback
+  // - bounded pes delivered as soon as complete, unbounded video pes when the next one starts or on flush
+  // - pts, dts 90khz, -1 if absent, dts = pts if only pts
+  using tPesCallback = std::function<void (int pid, int streamType, uint8_t* es, int size, int64_t pts, int64_t dts)>;
+  using tStreamCallback = std::function<void (int programNumber, int pid, int streamType)>;
+  using tEitCallback = std::function<void (const sEitEvent& event)>;
+
+  cTsDemux() { memset (mPidMask, 0, sizeof(mPidMask)); memset (mPids, 0, sizeof(mPids)); enableSection (0); }
+  //{{{
+  ~cTsDemux() {
+    for (auto pid : mPids)
+      delete pid;
+    }
+  //}}}
+
+  void setPesCallback (tPesCallback pesCallback) { mPesCallback = pesCallback; }
+  void setStreamCallback (tStreamCallback streamCallback) { mStreamCallback = streamCallback; }
+  //{{{
+  void setEitCallback (tEitCallback eitCallback) {
+  // eit pid 0x12 is only filtered once someone wants events
+
+    mEitCallback = eitCallback;
+    if (eitCallback)
+      enableSection (0x12);
+    }
+  //}}}
+  void setAutoPes (bool autoPes) { mAutoPes = autoPes; }
+
+  // stats
+  int64_t getPackets() { return mPackets; }
+  int64_t getSyncErrors() { return mSyncErrors; }
+  int64_t getErrors() { return mErrors; }
+  uint32_t getPidPackets (int pid) { return mPidPackets[pid & 0x1FFF]; }
+  const std::map<int,int>& getPrograms() { return mPrograms; }
+  int getStreamType (int pid) { return mPids[pid & 0x1FFF] ? mPids[pid & 0x1FFF]->mStreamType : -1; }
+
+  //{{{
+  static bool isVideo (int streamType) {
+    return (streamType == 0x01) || (streamType == 0x02) || (streamType == 0x1B) || (streamType == 0x24);
+    }
+  //}}}
+  //{{{
+  static bool isAudio (int streamType) {
+    return (streamType == 0x03) || (streamType == 0x04) || (streamType == 0x0F) || (streamType == 0x11) ||
+           (streamType == 0x81);
+    }
+  //}}}
+
+  //{{{
+  void enablePes (int pid, int streamType) {
+  // reassemble pes on pid, streamType passed back to the pes callback
+
+    auto info = getPid (pid);
+    if (info->mType != ePes) {
+      info->mType = ePes;
+      info->mStarted = false;
+      }
+    info->mStreamType = streamType;
+    mPidMask[pid >> 6] |= 1ull << (pid & 63);
+    }
+  //}}}
+  //{{{
+  void disable (int pid) {
+
+    mPidMask[pid >> 6] &= ~(1ull << (pid & 63));
+    if (mPids[pid])
+      mPids[pid]->mStarted = false;
+    }
+  //}}}
+
+  //{{{
+  size_t push (uint8_t* buffer, size_t size) {
+  // demux whole packets, returns bytes consumed, caller carries the remainder into the next push
+
+    auto ptr = buffer;
+    auto end = buffer + size;
+
+    while (ptr + kPacketSize <= end) {
+      if (ptr[0] != 0x47) {
+        //{{{  lost sync, next 0x47 followed by another a packet later, or the last one in buffer
+        mSyncErrors++;
+        ptr++;
+        while ((ptr + kPacketSize <= end) &&
+               !((ptr[0] == 0x47) && ((ptr + 2*kPacketSize > end) || (ptr[kPacketSize] == 0x47))))
+          ptr++;
+        continue;
+        }
+        //}}}
+
+      int pid = ((ptr[1] & 0x1F) << 8) | ptr[2];
+      mPidPackets[pid]++;
+      if (mPidMask[pid >> 6] & (1ull << (pid & 63)))
+        packet (ptr, pid);
+      ptr += kPacketSize;
+      }
+
+    mPackets += (ptr - buffer) / kPacketSize;
+    return ptr - buffer;
+    }
+  //}}}
+  //{{{
+  void flush() {
+  // deliver unbounded pes in progress, end of stream
+
+    for (int pid = 0; pid < 0x2000; pid++)
+      if (mPids[pid] && (mPids[pid]->mType == ePes) && mPids[pid]->mStarted) {
+        deliver (pid, *mPids[pid]);
+        mPids[pid]->mStarted = false;
+        }
+    }
+  //}}}
+  //{{{
+  void reset() {
+  // after a seek, drop partial pes and sections, forget section versions so tables are parsed again
+
+    for (auto pid : mPids)
+      if (pid) {
+        pid->mStarted = false;
+        pid->mContinuity = -1;
+        }
+    mSectionVersions.clear();
+    }
+  //}}}
+
+private:
+  enum eType { eNone, ePes, eSection };
+  //{{{
+  struct sPid {
+    eType mType = eNone;
+    int mStreamType = 0;
+    int mContinuity = -1;
+
+    // pes or section in progress
+    bool mStarted = false;
+    std::vector<uint8_t> mBuffer;
+    int mSize = 0;
+    int mLength = 0; // expected es or section length, 0 unbounded pes
+    int64_t mPts = -1;
+    int64_t mDts = -1;
+    };
+  //}}}
+
+  //{{{
+  sPid* getPid (int pid) {
+
+    if (!mPids[pid])
+      mPids[pid] = new sPid();
+    return mPids[pid];
+    }
+  //}}}
+  //{{{
+  void enableSection (int pid) {
+
+    auto info = getPid (pid);
+    if (info->mType == ePes)
+      return;
+    info->mType = eSection;
+    mPidMask[pid >> 6] |= 1ull << (pid & 63);
+    }
+  //}}}
+
+  //{{{
+  void packet (uint8_t* ts, int pid) {
+
+    if (ts[1] & 0x80) {
+      //{{{  transport error indicator
+      mErrors++;
+      return;
+      }
+      //}}}
+
+    auto& info = *mPids[pid];
+    int adaption = (ts[3] >> 4) & 3;
+    if (!(adaption & 1))
+      return;
+
+    auto ptr = ts + 4;
+    bool discontinuity = false;
+    if (adaption == 3) {
+      discontinuity = (ptr[0] > 0) && (ptr[1] & 0x80);
+      ptr += 1 + ptr[0];
+      }
+    auto end = ts + kPacketSize;
+    if (ptr >= end)
+      return;
+
+    //{{{  continuity, duplicates skipped, gaps drop what is in progress
+    int continuity = ts[3] & 0x0F;
+    if ((info.mContinuity >= 0) && !discontinuity) {
+      if (continuity == info.mContinuity)
+        return;
+      if (continuity != ((info.mContinuity + 1) & 0x0F)) {
+        mErrors++;
+        info.mStarted = false;
+        }
+      }
+    info.mContinuity = continuity;
+    //}}}
+
+    bool start = (ts[1] & 0x40) != 0;
+    if (info.mType == ePes)
+      pesPayload (pid, info, ptr, end, start);
+    else
+      sectionPayload (info, ptr, end, start);
+    }
+  //}}}
+
+  //{{{
+  void pesPayload (int pid, sPid& info, uint8_t* ptr, uint8_t* end, bool start) {
+
+    if (start) {
+      if (info.mStarted) {
+        // unbounded pes ends where the next starts
+        deliver (pid, info);
+        info.mStarted = false;
+        }
+
+      if ((end - ptr < 9) || ptr[0] || ptr[1] || (ptr[2] != 1) || (end - ptr < 9 + ptr[8])) {
+        //{{{  not a pes start or header spans packets, skip to next start
+        mErrors++;
+        return;
+        }
+        //}}}
+
+      int pesLength = (ptr[4] << 8) | ptr[5];
+      info.mPts = (ptr[7] & 0x80) ? getTimestamp (ptr + 9) : -1;
+      info.mDts = (ptr[7] & 0x40) ? getTimestamp (ptr + 14) : info.mPts;
+      info.mLength = pesLength ? pesLength - 3 - ptr[8] : 0;
+      ptr += 9 + ptr[8];
+      if (info.mLength < 0) {
+        mErrors++;
+        return;
+        }
+
+      info.mStarted = true;
+      info.mSize = 0;
+      }
+    else if (!info.mStarted)
+      return;
+
+    //{{{  append, grow only, bounded pes takes only its own bytes
+    int size = int(end - ptr);
+    if (info.mLength)
+      size = std::min (size, info.mLength - info.mSize);
+    if ((int)info.mBuffer.size() < info.mSize + size + kPadding)
+      info.mBuffer.resize ((info.mSize + size + kPadding) * 2);
+    memcpy (info.mBuffer.data() + info.mSize, ptr, size);
+    info.mSize += size;
+    //}}}
+
+    if (info.mLength && (info.mSize >= info.mLength)) {
+      info.mSize = info.mLength;
+      deliver (pid, info);
+      info.mStarted = false;
+      }
+    }
+  //}}}
+  //{{{
+  void deliver (int pid, sPid& info) {
+  // zero padded, decoders read ahead past the end
+
+    memset (info.mBuffer.data() + info.mSize, 0, kPadding);
+    if (mPesCallback)
+      mPesCallback (pid, info.mStreamType, info.mBuffer.data(), info.mSize, info.mPts, info.mDts);
+    }
+  //}}}
+  //{{{
+  static int64_t getTimestamp (const uint8_t* ptr) {
+    return ((int64_t)(ptr[0] & 0x0E) << 29) | (ptr[1] << 22) | ((ptr[2] & 0xFE) << 14) | (ptr[3] << 7) | (ptr[4] >> 1);
+    }
+  //}}}
+
+  //{{{
+  void sectionPayload (sPid& info, uint8_t* ptr, uint8_t* end, bool start) {
+  // pointer_field finishes the previous section, then any number of sections, 0xFF stuffing ends the packet
+
+    if (start) {
+      int pointer = *ptr++;
+      if (ptr + pointer > end)
+        return;
+      if (info.mStarted)
+        appendSection (info, ptr, ptr + pointer);
+      ptr += pointer;
+      info.mStarted = true;
+      info.mSize = 0;
+      }
+    else if (!info.mStarted)
+      return;
+
+    appendSection (info, ptr, end);
+    }
+  //}}}
+  //{{{
+  void appendSection (sPid& info, uint8_t* ptr, uint8_t* end) {
+
+    while (ptr < end) {
+      if (info.mSize == 0) {
+        if (*ptr == 0xFF) {
+          //{{{  stuffing
+          info.mStarted = false;
+          return;
+          }
+          //}}}
+        if (end - ptr >= 3) {
+          int length = 3 + (((ptr[1] & 0x0F) << 8) | ptr[2]);
+          if (end - ptr >= length) {
+            //{{{  whole section in packet, in place
+            section (ptr, length);
+            ptr += length;
+            continue;
+            }
+            //}}}
+          }
+        }
+
+      // header bytes first, then the rest once the length is known
+      int want = (info.mSize < 3) ? 3 : info.mLength;
+      int size = std::min (want - info.mSize, int(end - ptr));
+      if ((int)info.mBuffer.size() < want)
+        info.mBuffer.resize (kMaxSection);
+      memcpy (info.mBuffer.data() + info.mSize, ptr, size);
+      info.mSize += size;
+      ptr += size;
+
+      if (info.mSize == 3) {
+        info.mLength = 3 + (((info.mBuffer[1] & 0x0F) << 8) | info.mBuffer[2]);
+        if ((info.mLength < 3 + 9) || (info.mLength > kMaxSection)) {
+          //{{{  corrupt length, skip to next start
+          mErrors++;
+          info.mStarted = false;
+          return;
+          }
+          //}}}
+        }
+      else if ((info.mSize > 3) && (info.mSize == info.mLength)) {
+        section (info.mBuffer.data(), info.mLength);
+        info.mSize = 0;
+        }
+      }
+    }
+  //}}}
+  //{{{
+  void section (const uint8_t* buf, int length) {
+  // long form sections only, version check before crc so repeated tables cost a map lookup
+
+    if ((length < 12) || !(buf[1] & 0x80) || !(buf[5] & 0x01)) // too short, short form, not current
+      return;
+
+    int tableId = buf[0];
+    bool pat = tableId == 0x00;
+    bool pmt = tableId == 0x02;
+    bool eit = (tableId >= 0x4E) && (tableId <= 0x6F);
+    if (!pat && !pmt && !(eit && mEitCallback))
+      return;
+
+    // tableId, extension, section number, eit adds transport stream id
+    uint64_t key = ((uint64_t)tableId << 40) | ((uint64_t)((buf[3] << 8) | buf[4]) << 24) | buf[6];
+    if (eit)
+      key |= (uint64_t)((buf[8] << 8) | buf[9]) << 8;
+    int version = (buf[5] >> 1) & 0x1F;
+    auto it = mSectionVersions.find (key);
+    if ((it != mSectionVersions.end()) && (it->second == version))
+      return;
+
+    if (getCrc32 (buf, length)) {
+      mErrors++;
+      return;
+      }
+    mSectionVersions[key] = (uint8_t)version;
+
+    if (pat)
+      parsePat (buf, length);
+    else if (pmt)
+      parsePmt (buf, length);
+    else
+      parseEit (buf, length);
+    }
+  //}}}
+
+  //{{{
+  void parsePat (const uint8_t* buf, int length) {
+
+    for (int i = 8; i + 4 <= length - 4; i += 4) {
+      int programNumber = (buf[i] << 8) | buf[i+1];
+      int pid = ((buf[i+2] & 0x1F) << 8) | buf[i+3];
+      if (programNumber) { // 0 is nit
+        mPrograms[programNumber] = pid;
+        enableSection (pid);
+        }
+      }
+    }
+  //}}}
+  //{{{
+  void parsePmt (const uint8_t* buf, int length) {
+
+    int programNumber = (buf[3] << 8) | buf[4];
+    int i = 12 + (((buf[10] & 0x0F) << 8) | buf[11]);
+    while (i + 5 <= length - 4) {
+      int streamType = buf[i];
+      int pid = ((buf[i+1] & 0x1F) << 8) | buf[i+2];
+      i += 5 + (((buf[i+3] & 0x0F) << 8) | buf[i+4]);
+
+      if (mAutoPes && (isVideo (streamType) || isAudio (streamType)))
+        enablePes (pid, streamType);
+      else
+        getPid (pid)->mStreamType = streamType;
+      if (mStreamCallback)
+        mStreamCallback (programNumber, pid, streamType);
+      }
+    }
+  //}}}
+  //{{{
+  void parseEit (const uint8_t* buf, int length) {
+
+    sEitEvent event;
+    event.mTableId = buf[0];
+    event.mSection = buf[6];
+    event.mVersion = (buf[5] >> 1) & 0x1F;
+    event.mServiceId = (buf[3] << 8) | buf[4];
+
+    int i = 14;
+    while (i + 12 <= length - 4) {
+      event.mEventId = (buf[i] << 8) | buf[i+1];
+
+      //{{{  mjd date, bcd time, bcd duration
+      int mjd = (buf[i+2] << 8) | buf[i+3];
+      event.mStartTime = (int64_t)(mjd - 40587) * 86400 +
+                         bcd (buf[i+4]) * 3600 + bcd (buf[i+5]) * 60 + bcd (buf[i+6]);
+      event.mDuration = bcd (buf[i+7]) * 3600 + bcd (buf[i+8]) * 60 + bcd (buf[i+9]);
+      //}}}
+      event.mRunning = buf[i+10] >> 5;
+      event.mTitle.clear();
+      event.mDescription.clear();
+
+      int descriptorsEnd = i + 12 + (((buf[i+10] & 0x0F) << 8) | buf[i+11]);
+      if (descriptorsEnd > length - 4)
+        break;
+
+      for (int d = i + 12; d + 2 <= descriptorsEnd; d += 2 + buf[d+1])
+        if ((buf[d] == 0x4D) && (d + 2 + buf[d+1] <= descriptorsEnd)) {
+          //{{{  short event, lang[3] nameLength name textLength text
+          int nameLength = buf[d+5];
+          if (d + 6 + nameLength + 1 > descriptorsEnd)
+            continue;
+          event.mTitle = getDvbString (buf + d + 6, nameLength);
+          int textLength = buf[d+6+nameLength];
+          if (d + 7 + nameLength + textLength <= descriptorsEnd)
+            event.mDescription = getDvbString (buf + d + 7 + nameLength, textLength);
+          }
+          //}}}
+
+      mEitCallback (event);
+      i = descriptorsEnd;
+      }
+    }
+  //}}}
+  static int bcd (uint8_t value) { return (value >> 4) * 10 + (value & 0x0F); }
+  //{{{
+  static std::string getDvbString (const uint8_t* buf, int length) {
+  // drop leading charset selector and control codes, bytes otherwise as broadcast
+
+    std::string str;
+    str.reserve (length);
+    for (int i = 0; i < length; i++)
+      if ((buf[i] >= 0x20) && ((buf[i] < 0x80) || (buf[i] > 0x9F)))
+        str += (char)buf[i];
+    return str;
+    }
+  //}}}
+
+  //{{{
+  static uint32_t getCrc32 (const uint8_t* buf, int length) {
+  // mpeg2 crc, msb first, zero over a section including its crc
+
+    static const std::array<uint32_t,256> table = []() {
+      std::array<uint32_t,256> table;
+      for (uint32_t i = 0; i < 256; i++) {
+        uint32_t crc = i << 24;
+        for (int bit = 0; bit < 8; bit++)
+          crc = (crc << 1) ^ ((crc & 0x80000000) ? 0x04C11DB7 : 0);
+        table[i] = crc;
+        }
+      return table;
+      }();
+
+    uint32_t crc = 0xFFFFFFFF;
+    for (int i = 0; i < length; i++)
+      crc = (crc << 8) ^ table[(crc >> 24) ^ buf[i]];
+    return crc;
+    }
+  //}}}
+
+  // vars
+  static const int kPadding = 8;
+  static const int kMaxSection = 4096 + 3;
+
+  uint64_t mPidMask[0x2000 / 64];
+  sPid* mPids[0x2000];
+  uint32_t mPidPackets[0x2000] = { 0 };
+
+  bool mAutoPes = true;
+  std::map<int,int> mPrograms; // programNumber, pmt pid
+  std::unordered_map<uint64_t,uint8_t> mSectionVersions;
+
+  tPesCallback mPesCallback;
+  tStreamCallback mStreamCallback;
+  tEitCallback mEitCallback;
+
+  int64_t mPackets = 0;
+  int64_t mSyncErrors = 0;
+  int64_t mErrors = 0;
+  };
@@ -0,0 +1,173 @@
+// gifMain.cpp - play animated gifs flat out, no display
+// - reports frames/s played in order uncached and through the frame cache, looping each file
+// - checks looped, cached and seeked frames are byte identical to the first uncached pass
+// - linux: g++ -O2 -std=c++17 -I../decoders gifMain.cpp -o gifTest
+// - gifTest [-n loops] [-c cacheMB] [-o out.bgra] file.gif ...
+//{{{  includes
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include <string>
+#include <vector>
+#include <chrono>
+
+#include "../decoders/cMappedFile.h"
+#include "../decoders/cGifPic.h"
+
+using namespace std;
+//}}}
+
+//{{{
+struct sGif {
+  string mFileName;
+  vector<uint8_t> mBuffer;
+  size_t mFrameBytes = 0;
+  vector<vector<uint8_t>> mFrames;  // first uncached pass, reference for the rest
+  };
+//}}}
+//{{{
+static cGifPic* openGif (sGif& gif, size_t cacheBytes) {
+// returns gif with header read, nullptr on error
+
+  cGifPic* pic = new cGifPic();
+  pic->setPic (gif.mBuffer.data(), (int)gif.mBuffer.size(), 4);
+  if (pic->readHeader() != cGifPic::GIF_OK) {
+    free (pic->getPic());
+    delete pic;
+    return nullptr;
+    }
+
+  pic->setCacheBytes (cacheBytes);
+  gif.mFrameBytes = pic->getWidth() * pic->getHeight() * 4;
+  return pic;
+  }
+//}}}
+//{{{
+static int check (sGif& gif, cGifPic* pic, int frame, const char* pass) {
+// compare frame with the reference, keep it as the reference on the first pass, returns mismatches
+
+  if ((int)gif.mFrames.size() <= frame) {
+    gif.mFrames.emplace_back (pic->getPic(), pic->getPic() + gif.mFrameBytes);
+    return 0;
+    }
+
+  if (!memcmp (gif.mFrames[frame].data(), pic->getPic(), gif.mFrameBytes))
+    return 0;
+
+  printf ("gifTest - %s frame %d %s differs\n", gif.mFileName.c_str(), frame, pass);
+  return 1;
+  }
+//}}}
+
+int main (int argc, char* argv[]) {
+
+  //{{{  parse args
+  vector<string> fileNames;
+  string outName;
+  int loops = 4;
+  size_t cacheBytes = 64 * 1024 * 1024;
+
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp (argv[i], "-n") && (i+1 < argc))
+      loops = max (1, atoi (argv[++i]));
+    else if (!strcmp (argv[i], "-c") && (i+1 < argc))
+      cacheBytes = (size_t)max (0, atoi (argv[++i])) * 1024 * 1024;
+    else if (!strcmp (argv[i], "-o") && (i+1 < argc))
+      outName = argv[++i];
+    else
+      fileNames.push_back (argv[i]);
+    }
+
+  if (fileNames.empty()) {
+    printf ("gifTest [-n loops] [-c cacheMB] [-o out.bgra] file.gif ...\n"
+            "  default 4 loops through a 64MB frame cache\n"
+            "  -o writes every frame of the last file\n");
+    return 1;
+    }
+  //}}}
+  //{{{  load files
+  vector<sGif> gifs;
+  for (auto& fileName : fileNames) {
+    cMappedFile file (fileName);
+    if (!file.isOpen()) {
+      printf ("gifTest - can't open %s\n", fileName.c_str());
+      return 1;
+      }
+
+    sGif gif;
+    gif.mFileName = fileName;
+    gif.mBuffer.assign (file.getBuffer(), file.getEnd());
+    gifs.push_back (move (gif));
+    }
+  //}}}
+
+  int mismatches = 0;
+  int errors = 0;
+  for (int cached = 0; cached < 2; cached++) {
+    double seconds = 0;
+    double frames = 0;
+    for (auto& gif : gifs) {
+      auto time = chrono::steady_clock::now();
+      cGifPic* pic = openGif (gif, cached ? cacheBytes : 0);
+      if (!pic) {
+        //{{{  error
+        if (!cached)
+          printf ("gifTest - %s failed header\n", gif.mFileName.c_str());
+        errors++;
+        continue;
+        }
+        //}}}
+
+      for (int loop = 0; loop < loops; loop++)
+        for (int frame = 0; frame < pic->getFrameCount(); frame++) {
+          if (pic->decodeBody (frame) != cGifPic::GIF_OK) {
+            //{{{  error
+            if (!cached && !loop)
+              printf ("gifTest - %s failed frame %d\n", gif.mFileName.c_str(), frame);
+            errors++;
+            }
+            //}}}
+          frames++;
+
+          // compare outside the timing
+          seconds += chrono::duration<double>(chrono::steady_clock::now() - time).count();
+          mismatches += check (gif, pic, frame, cached ? "cached" : "looped");
+          time = chrono::steady_clock::now();
+          }
+      seconds += chrono::duration<double>(chrono::steady_clock::now() - time).count();
+
+      if (cached) {
+        //{{{  seek backwards, restarts from cached frames
+        for (int frame = pic->getFrameCount() - 1; frame >= 0; frame--) {
+          pic->decodeBody (frame);
+          mismatches += check (gif, pic, frame, "seeked");
+          }
+        }
+        //}}}
+
+      free (pic->getPic());
+      delete pic;
+      }
+
+    printf ("%-8s %8.1f frames/s  %d files x %d loops\n",
+            cached ? "cached" : "uncached", seconds > 0 ? frames / seconds : 0.0, (int)gifs.size(), loops);
+    }
+
+  if (!outName.empty() && !gifs.empty()) {
+    //{{{  write last file
+    FILE* outFile = fopen (outName.c_str(), "wb");
+    if (outFile) {
+      for (auto& frame : gifs.back().mFrames)
+        fwrite (frame.data(), 1, frame.size(), outFile);
+      fclose (outFile);
+      }
+    }
+    //}}}
+
+  if (mismatches || errors)
+    printf ("gifTest - %d mismatches, %d errors\n", mismatches, errors);
+  return (mismatches || errors) ? 1 : 0;
+  }
@@ -0,0 +1,181 @@
+// jpegMain.cpp - decode jpegs flat out per kernel isa, no display
+// - reports source MPixel/s per isa and scale, checks every isa output is byte identical to scalar
+// - -t decodes restart intervals of DRI jpegs on threads, output still checked against serial scalar
+// - linux: g++ -O2 -std=c++17 -I../decoders jpegMain.cpp -o jpegTest
+// - jpegTest [-i scalar|sse2|avx2|neon] [-s 0..3] [-n repeats] [-t threads] [-o out.bgra] file.jpg ...
+//{{{  includes
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+
+#include <string>
+#include <sstream>
+#include <vector>
+#include <chrono>
+
+#include "../decoders/cMappedFile.h"
+#include "../decoders/cJpegPic.h"
+
+using namespace std;
+//}}}
+
+//{{{
+struct sJpeg {
+  string mFileName;
+  vector<uint8_t> mBuffer;
+  size_t mSize = 0;
+  int mWidth = 0;
+  int mHeight = 0;
+  vector<uint8_t> mScalar[4];  // scalar output per scale, reference for the other isas
+  };
+//}}}
+//{{{
+static uint8_t* decode (sJpeg& jpeg, cMpeg2mc::eIsa isa, int scaleShift, int components, int threads) {
+// returns malloced pic, nullptr on error
+
+  cJpegPic pic (components, jpeg.mBuffer.data(), jpeg.mSize);
+  pic.setThreads (threads);
+  if (!pic.setIsa (isa) || !pic.readHeader())
+    return nullptr;
+
+  jpeg.mWidth = pic.getWidth();
+  jpeg.mHeight = pic.getHeight();
+  return pic.decodeBody (scaleShift);
+  }
+//}}}
+
+int main (int argc, char* argv[]) {
+
+  //{{{  parse args
+  vector<string> fileNames;
+  string isaName;
+  string outName;
+  int scaleShift = -1;
+  int repeats = 1;
+  int components = 4;
+  int threads = 1;
+
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp (argv[i], "-i") && (i+1 < argc))
+      isaName = argv[++i];
+    else if (!strcmp (argv[i], "-s") && (i+1 < argc))
+      scaleShift = atoi (argv[++i]);
+    else if (!strcmp (argv[i], "-n") && (i+1 < argc))
+      repeats = max (1, atoi (argv[++i]));
+    else if (!strcmp (argv[i], "-t") && (i+1 < argc))
+      threads = max (1, atoi (argv[++i]));
+    else if (!strcmp (argv[i], "-o") && (i+1 < argc))
+      outName = argv[++i];
+    else if (!strcmp (argv[i], "-3"))
+      components = 3;
+    else
+      fileNames.push_back (argv[i]);
+    }
+
+  if (fileNames.empty()) {
+    printf ("jpegTest [-i scalar|sse2|avx2|neon] [-s 0..3] [-n repeats] [-t threads] [-3] [-o out.bgra] file.jpg ...\n"
+            "  default every available isa and scale, -3 decodes bgr instead of bgra\n"
+            "  -o writes the last file decoded by the last isa\n");
+    return 1;
+    }
+  //}}}
+  //{{{  load files, padded, cJpegPic reads its body in whole blocks past the end
+  vector<sJpeg> jpegs;
+  for (auto& fileName : fileNames) {
+    cMappedFile file (fileName);
+    if (!file.isOpen()) {
+      printf ("jpegTest - can't open %s\n", fileName.c_str());
+      return 1;
+      }
+
+    sJpeg jpeg;
+    jpeg.mFileName = fileName;
+    jpeg.mBuffer.assign (file.getBuffer(), file.getEnd());
+    jpeg.mSize = jpeg.mBuffer.size();
+    jpeg.mBuffer.resize (jpeg.mBuffer.size() + kBodyBufferSize, 0);
+    jpegs.push_back (move (jpeg));
+    }
+  //}}}
+  //{{{  isas
+  static const char* kIsaNames[] = { "scalar", "sse2", "avx2", "neon" };
+
+  vector<cMpeg2mc::eIsa> isas;
+  for (int i = 0; i < 4; i++)
+    if ((isaName.empty() || (isaName == kIsaNames[i])) && cJpegKernels::getKernels ((cMpeg2mc::eIsa)i))
+      isas.push_back ((cMpeg2mc::eIsa)i);
+
+  if (isas.empty()) {
+    printf ("jpegTest - isa %s not available\n", isaName.c_str());
+    return 1;
+    }
+  //}}}
+
+  int mismatches = 0;
+  int errors = 0;
+  for (int scale = 0; scale < 4; scale++) {
+    if ((scaleShift >= 0) && (scale != scaleShift))
+      continue;
+
+    for (auto isa : isas) {
+      double seconds = 0;
+      double pixels = 0;
+      for (auto& jpeg : jpegs)
+        for (int repeat = 0; repeat < repeats; repeat++) {
+          auto time = chrono::steady_clock::now();
+          uint8_t* pic = decode (jpeg, isa, scale, components, threads);
+          seconds += chrono::duration<double>(chrono::steady_clock::now() - time).count();
+          if (!pic) {
+            //{{{  error
+            if (!repeat)
+              printf ("jpegTest - %s failed %s scale %d\n", jpeg.mFileName.c_str(), kIsaNames[isa], scale);
+            errors++;
+            break;
+            }
+            //}}}
+          pixels += (double)jpeg.mWidth * jpeg.mHeight;
+
+          if (!repeat) {
+            //{{{  compare with scalar, keep scalar as reference, write
+            size_t bytes = (size_t)(jpeg.mWidth >> scale) * (jpeg.mHeight >> scale) * components;
+            auto& scalar = jpeg.mScalar[scale];
+            if ((isa == cMpeg2mc::eScalar) && (threads == 1))
+              scalar.assign (pic, pic + bytes);
+            else if ((isa == cMpeg2mc::eScalar) || scalar.empty()) {
+              // threaded, reference from a serial scalar decode
+              uint8_t* serial = decode (jpeg, cMpeg2mc::eScalar, scale, components, 1);
+              if (serial)
+                scalar.assign (serial, serial + bytes);
+              free (serial);
+              }
+            if ((isa != cMpeg2mc::eScalar) || (threads > 1))
+              if (!scalar.empty() && memcmp (scalar.data(), pic, bytes)) {
+                printf ("jpegTest - %s %s scale %d differs from scalar\n", jpeg.mFileName.c_str(), kIsaNames[isa], scale);
+                mismatches++;
+                }
+
+            if (!outName.empty() && (&jpeg == &jpegs.back()) && (isa == isas.back())) {
+              FILE* outFile = fopen (outName.c_str(), "wb");
+              if (outFile) {
+                fwrite (pic, 1, bytes, outFile);
+                fclose (outFile);
+                }
+              }
+            }
+            //}}}
+
+          free (pic);
+          }
+
+      printf ("scale 1/%d %-6s %8.1f MPixel/s  %d files x %d\n",
+              1 << scale, kIsaNames[isa], seconds > 0 ? pixels / seconds / 1e6 : 0.0, (int)jpegs.size(), repeats);
+      }
+    }
+
+  if (mismatches || errors)
+    printf ("jpegTest - %d mismatches, %d errors\n", mismatches, errors);
+  return (mismatches || errors) ? 1 : 0;
+  }
@@ -0,0 +1,322 @@
+// mp3Main.cpp - decode mp3 flat out per output stage, no audio out
+// - reports frames/s for float interleaved, float planar and int16 per isa, checks int16 against float
+// - every isa available on this cpu in one run, float and int16 must match the first isa exactly, -i picks one
+// - -s seeks random pts through a cAudioFrameIndex sidecar, checks each seek against the linear decode
+// - linux: g++ -O2 -std=c++17 -I../inc mp3Main.cpp ../decoders/cAudioFramer.cpp ../decoders/cMp3Decoder.cpp
+//            ../decoders/cAudioParser.cpp ../decoders/cAudioFrameIndex.cpp ../../shared/utils/cLog.cpp -o mp3Test
+// - mp3Test [-n repeats] [-s seeks] [-i scalar|sse2|avx2|neon] [-o out.pcm] file.mp3 ...
+//{{{  includes
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include <string>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <memory>
+
+#include "../decoders/cMappedFile.h"
+#include "../decoders/cAudioFramer.h"
+#include "../decoders/cMp3Decoder.h"
+#include "../decoders/cAudioParser.h"
+#include "../decoders/cAudioFrameIndex.h"
+
+using namespace std;
+//}}}
+
+//{{{
+struct sMp3 {
+  string mFileName;
+  unique_ptr<cMappedFile> mFile; // frames parsed and decoded in place, no copy
+  vector<pair<int,int>> mFrames; // offset, length
+  vector<float> mFloat;          // interleaved float output of the first isa, reference for int16 and seeks
+  vector<int64_t> mFloatStarts;  // first mFloat sample of each frame, -1 if it decoded to nothing
+  vector<int16_t> mInt16;        // int16 output of the first isa
+  };
+//}}}
+enum eStage { eFloat, ePlanar, eInt16 };
+static const char* kStageNames[] = { "float", "planar", "int16" };
+
+//{{{
+static int64_t decode (sMp3& mp3, cMpeg2mc::eIsa isa, eStage stage, bool keep,
+                       vector<float>& floatPcm, vector<int64_t>& floatStarts, vector<int16_t>& int16Pcm) {
+// decode every frame, returns samples per channel, -1 if nothing decoded
+// - frames before the bit reservoir fills decode to nothing, same for every stage
+
+  int64_t numSamples = 0;
+
+  cMp3Decoder decoder;
+  decoder.setIsa (isa);
+  decoder.setPlanar (stage == ePlanar);
+  for (auto& frame : mp3.mFrames) {
+    const uint8_t* ptr = mp3.mFile->getBuffer() + frame.first;
+    void* pcm = (stage == eInt16) ? (void*)decoder.decodeFrame16 (ptr, frame.second, 0)
+                                  : (void*)decoder.decodeFrame (ptr, frame.second, 0);
+    if (keep && (stage == eFloat))
+      floatStarts.push_back (pcm ? (int64_t)floatPcm.size() : -1);
+    if (!pcm)
+      continue;
+
+    int samples = decoder.getNumSamplesPerFrame() * decoder.getNumChannels();
+    if (keep) {
+      if (stage == eFloat)
+        floatPcm.insert (floatPcm.end(), (float*)pcm, (float*)pcm + samples);
+      else if (stage == eInt16)
+        int16Pcm.insert (int16Pcm.end(), (int16_t*)pcm, (int16_t*)pcm + samples);
+      }
+
+    numSamples += decoder.getNumSamplesPerFrame();
+    free (pcm);
+    }
+
+  return numSamples ? numSamples : -1;
+  }
+//}}}
+
+//{{{
+static bool seek (sMp3& mp3, int numSeeks, double& buildSeconds, double& seekSeconds, float& maxError) {
+// index, save and reload sidecar, decode from random seeks, compare target frame with linear decode
+
+  uint8_t* buffer = mp3.mFile->getBuffer();
+  uint8_t* bufferEnd = mp3.mFile->getEnd();
+
+  cAudioFrameIndex index;
+  auto time = chrono::steady_clock::now();
+  if (!index.build (buffer, bufferEnd))
+    return false;
+  buildSeconds += chrono::duration<double>(chrono::steady_clock::now() - time).count();
+
+  string sidecarName = mp3.mFileName + ".aidx";
+  cAudioFrameIndex sidecar;
+  bool ok = index.save (sidecarName) && sidecar.load (sidecarName) && (sidecar.getNumFrames() == index.getNumFrames());
+  remove (sidecarName.c_str());
+  if (!ok)
+    return false;
+
+  for (int i = 0; i < numSeeks; i++) {
+    int64_t frameNum = rand() % sidecar.getNumFrames();
+
+    time = chrono::steady_clock::now();
+    //{{{  seek, decode priming frames and target frame
+    int skipFrames;
+    int64_t firstPts;
+    uint8_t* framePtr = sidecar.seek (buffer, bufferEnd, sidecar.getFramePts (frameNum), skipFrames, firstPts);
+    if (!framePtr)
+      return false;
+
+    cMp3Decoder decoder;
+    float* pcm = nullptr;
+    int frameLength = 0;
+    for (int frame = 0; frame <= skipFrames; frame++) {
+      free (pcm);
+      pcm = nullptr;
+      framePtr = cAudioParser::parseFrame (framePtr, bufferEnd, frameLength);
+      if (!framePtr)
+        return false;
+      pcm = decoder.decodeFrame (framePtr, frameLength, 0);
+      if (frame < skipFrames)
+        framePtr += frameLength;
+      }
+    //}}}
+    seekSeconds += chrono::duration<double>(chrono::steady_clock::now() - time).count();
+
+    // target frame in linear decode, by its offset
+    auto it = lower_bound (mp3.mFrames.begin(), mp3.mFrames.end(), make_pair ((int)(framePtr - buffer), 0));
+    if (!pcm || (it == mp3.mFrames.end()) || (it->first != framePtr - buffer) ||
+        (mp3.mFloatStarts[it - mp3.mFrames.begin()] < 0)) {
+      free (pcm);
+      return false;
+      }
+
+    const float* linear = mp3.mFloat.data() + mp3.mFloatStarts[it - mp3.mFrames.begin()];
+    for (int sample = 0; sample < decoder.getNumSamplesPerFrame() * decoder.getNumChannels(); sample++)
+      maxError = max (maxError, fabsf (pcm[sample] - linear[sample]));
+    free (pcm);
+    }
+
+  return true;
+  }
+//}}}
+
+int main (int argc, char* argv[]) {
+
+  //{{{  parse args
+  vector<string> fileNames;
+  string outName;
+  string isaName;
+  int repeats = 1;
+  int numSeeks = 0;
+
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp (argv[i], "-n") && (i+1 < argc))
+      repeats = max (1, atoi (argv[++i]));
+    else if (!strcmp (argv[i], "-s") && (i+1 < argc))
+      numSeeks = max (0, atoi (argv[++i]));
+    else if (!strcmp (argv[i], "-o") && (i+1 < argc))
+      outName = argv[++i];
+    else if (!strcmp (argv[i], "-i") && (i+1 < argc))
+      isaName = argv[++i];
+    else
+      fileNames.push_back (argv[i]);
+    }
+
+  if (fileNames.empty()) {
+    printf ("mp3Test [-n repeats] [-s seeks] [-i scalar|sse2|avx2|neon] [-o out.pcm] file.mp3 ...\n"
+            "  -s seeks random pts per file through a frame index sidecar\n"
+            "  -i one isa, default every isa this cpu has\n"
+            "  -o writes int16 pcm of the last file\n");
+    return 1;
+    }
+  //}}}
+  //{{{  load and frame files
+  vector<sMp3> mp3s;
+  for (auto& fileName : fileNames) {
+    sMp3 mp3;
+    mp3.mFileName = fileName;
+    mp3.mFile = make_unique<cMappedFile>(fileName);
+    if (!mp3.mFile->isOpen()) {
+      printf ("mp3Test - can't open %s\n", fileName.c_str());
+      return 1;
+      }
+
+    // framer emits in place, offsets into the mapping, whole file pushed as one chunk
+    const uint8_t* buffer = mp3.mFile->getBuffer();
+    cAudioFramer framer ([&](eAudioFrameType frameType, const uint8_t* frame, int frameLength) {
+      if (frameType == eAudioFrameType::eMp3)
+        mp3.mFrames.push_back ({ (int)(frame - buffer), frameLength });
+      });
+    framer.push (buffer, (int)mp3.mFile->getSize());
+
+    if (mp3.mFrames.empty()) {
+      printf ("mp3Test - no mp3 frames in %s\n", fileName.c_str());
+      return 1;
+      }
+    mp3s.push_back (move (mp3));
+    }
+  //}}}
+
+  //{{{  isas
+  static const char* kIsaNames[] = { "scalar", "sse2", "avx2", "neon" };
+
+  vector<cMpeg2mc::eIsa> isas;
+  for (int i = 0; i < 4; i++) {
+    cMp3Decoder decoder;
+    if ((isaName.empty() || (isaName == kIsaNames[i])) && decoder.setIsa ((cMpeg2mc::eIsa)i))
+      isas.push_back ((cMpeg2mc::eIsa)i);
+    }
+
+  if (isas.empty()) {
+    printf ("mp3Test - isa %s not available\n", isaName.c_str());
+    return 1;
+    }
+  //}}}
+
+  int errors = 0;
+  int mismatches = 0;
+  vector<float> floatPcm;
+  vector<int64_t> floatStarts;
+  vector<int16_t> int16Pcm;
+  for (auto isa : isas)
+    for (int stage = eFloat; stage <= eInt16; stage++) {
+      double seconds = 0;
+      int64_t numFrames = 0;
+      int64_t numSamples = 0;
+      for (auto& mp3 : mp3s)
+        for (int repeat = 0; repeat < repeats; repeat++) {
+          floatPcm.clear();
+          floatStarts.clear();
+          int16Pcm.clear();
+          auto time = chrono::steady_clock::now();
+          int64_t samples = decode (mp3, isa, (eStage)stage, !repeat, floatPcm, floatStarts, int16Pcm);
+          seconds += chrono::duration<double>(chrono::steady_clock::now() - time).count();
+          if (samples < 0) {
+            //{{{  error
+            if (!repeat)
+              printf ("mp3Test - %s failed %s %s\n", mp3.mFileName.c_str(), kIsaNames[isa], kStageNames[stage]);
+            errors++;
+            break;
+            }
+            //}}}
+          numFrames += mp3.mFrames.size();
+          numSamples += samples;
+
+          if (!repeat && (stage == eFloat)) {
+            //{{{  keep first isa as reference, compare others
+            if (isa == isas.front()) {
+              mp3.mFloat.swap (floatPcm);
+              mp3.mFloatStarts.swap (floatStarts);
+              }
+            else if (floatPcm != mp3.mFloat) {
+              printf ("mp3Test - %s %s float differs from %s\n",
+                      mp3.mFileName.c_str(), kIsaNames[isa], kIsaNames[isas.front()]);
+              mismatches++;
+              }
+            }
+            //}}}
+          if (!repeat && (stage == eInt16)) {
+            //{{{  compare with float, int16 rounding near zero differs by up to 1.5
+            if (int16Pcm.size() != mp3.mFloat.size()) {
+              printf ("mp3Test - %s int16 %d samples, float %d\n",
+                      mp3.mFileName.c_str(), (int)int16Pcm.size(), (int)mp3.mFloat.size());
+              mismatches++;
+              }
+            else
+              for (size_t i = 0; i < int16Pcm.size(); i++) {
+                float sample = min (32767.f, max (-32768.f, mp3.mFloat[i] * 0x8000));
+                if (fabsf (int16Pcm[i] - sample) > 1.5f) {
+                  printf ("mp3Test - %s int16 differs from float at %d\n", mp3.mFileName.c_str(), (int)i);
+                  mismatches++;
+                  break;
+                  }
+                }
+            //}}}
+            //{{{  keep first isa as reference, compare others
+            if (isa == isas.front())
+              mp3.mInt16 = int16Pcm;
+            else if (int16Pcm != mp3.mInt16) {
+              printf ("mp3Test - %s %s int16 differs from %s\n",
+                      mp3.mFileName.c_str(), kIsaNames[isa], kIsaNames[isas.front()]);
+              mismatches++;
+              }
+            //}}}
+            if (!outName.empty() && (isa == isas.front())) {
+              //{{{  write
+              FILE* file = fopen (outName.c_str(), "wb");
+              if (file) {
+                fwrite (int16Pcm.data(), sizeof(int16_t), int16Pcm.size(), file);
+                fclose (file);
+                }
+              }
+              //}}}
+            }
+          }
+
+      printf ("  %-6s %-6s %9.1f frames/s %7.2f Msamples/s, %lld frames\n", kIsaNames[isa],
+              kStageNames[stage], numFrames / seconds, numSamples / seconds / 1e6, (long long)numFrames);
+      }
+
+  if (numSeeks) {
+    //{{{  seek
+    double buildSeconds = 0;
+    double seekSeconds = 0;
+    float maxError = 0.f;
+    for (auto& mp3 : mp3s)
+      if (!seek (mp3, numSeeks, buildSeconds, seekSeconds, maxError)) {
+        printf ("mp3Test - %s seek failed\n", mp3.mFileName.c_str());
+        errors++;
+        }
+
+    // priming covers the bit reservoir of the target frame and of the frame before, for its imdct overlap
+    printf ("  seek   %9.1f us/seek, index build %.1f ms, max error %g\n",
+            seekSeconds * 1e6 / (numSeeks * mp3s.size()), buildSeconds * 1e3, maxError);
+    }
+    //}}}
+
+  if (errors || mismatches)
+    printf ("mp3Test - %d errors, %d mismatches\n", errors, mismatches);
+  return (errors || mismatches) ? 1 : 0;
+  }
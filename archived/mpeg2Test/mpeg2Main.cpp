@@ -0,0 +1,571 @@
+// mpeg2Main.cpp - decode mpeg2 es or ts, video and audio flat out, no display or audio out
+// - reports per stage throughput, peak rss, allocations per frame, md5 of each output frame
+// - linux: g++ -O2 -std=c++17 -pthread -I../inc mpeg2Main.cpp ../decoders/cAudioFramer.cpp
+//            ../decoders/cAacDecoder.cpp ../decoders/cMp3Decoder.cpp ../../shared/utils/cLog.cpp -o mpeg2Test
+// - mpeg2Test [-o out.yuv] [-t sliceThreads] [-f] [-i scalar|sse2|avx2|neon] [-b] [-k]
+//             [-w golden.md5] [-c golden.md5] [-m all|skipb|ionly] [-s 0..3] file.{m2v,ts}
+// - ts reports demux only Gbit/s, pes payload counted but not kept
+//{{{  includes
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <algorithm>
+#include <new>
+
+#ifdef _WIN32
+  #define WIN32_LEAN_AND_MEAN
+  #include <windows.h>
+  #include <psapi.h>
+  #pragma comment (lib, "psapi.lib")
+#else
+  #include <sys/resource.h>
+#endif
+
+#include "../decoders/cMappedFile.h"
+#include "../decoders/cTsDemux.h"
+#include "../decoders/cMpeg2decoder.h"
+#include "../decoders/cAudioFramer.h"
+#include "../decoders/cAacDecoder.h"
+#include "../decoders/cMp3Decoder.h"
+#include "../cYuvBgra.h"
+
+using namespace std;
+//}}}
+
+//{{{  allocation counter
+static atomic<int64_t> gAllocs = { 0 };
+
+void* operator new (size_t size) {
+  gAllocs++;
+  if (void* ptr = malloc (size ? size : 1))
+    return ptr;
+  throw bad_alloc();
+  }
+
+void operator delete (void* ptr) noexcept { free (ptr); }
+void operator delete (void* ptr, size_t) noexcept { free (ptr); }
+//}}}
+//{{{
+static int64_t getPeakRss() {
+// peak resident bytes
+
+#ifdef _WIN32
+  PROCESS_MEMORY_COUNTERS counters;
+  return GetProcessMemoryInfo (GetCurrentProcess(), &counters, sizeof(counters)) ? counters.PeakWorkingSetSize : 0;
+#else
+  struct rusage usage;
+  return getrusage (RUSAGE_SELF, &usage) ? 0 : (int64_t)usage.ru_maxrss * 1024;
+#endif
+  }
+//}}}
+//{{{
+class cMd5 {
+// rfc1321, enough to checksum output frames
+public:
+  //{{{
+  void update (const uint8_t* data, size_t bytes) {
+
+    size_t used = mBytes & 63;
+    mBytes += bytes;
+    if (used) {
+      size_t fill = min (bytes, 64 - used);
+      memcpy (mBlock + used, data, fill);
+      data += fill;
+      bytes -= fill;
+      if (used + fill < 64)
+        return;
+      transform (mBlock);
+      }
+
+    for (; bytes >= 64; data += 64, bytes -= 64)
+      transform (data);
+    memcpy (mBlock, data, bytes);
+    }
+  //}}}
+  //{{{
+  string finish() {
+
+    uint64_t bits = mBytes * 8;
+    uint8_t pad[72] = { 0x80 };
+    size_t padBytes = ((mBytes & 63) < 56) ? 56 - (mBytes & 63) : 120 - (mBytes & 63);
+    for (int i = 0; i < 8; i++)
+      pad[padBytes + i] = (uint8_t)(bits >> (i * 8));
+    update (pad, padBytes + 8);
+
+    char hex[33];
+    for (int i = 0; i < 16; i++)
+      sprintf (hex + i*2, "%02x", (mState[i/4] >> ((i%4) * 8)) & 0xFF);
+    return hex;
+    }
+  //}}}
+
+private:
+  //{{{
+  void transform (const uint8_t* block) {
+
+    static const uint32_t kK[64] = {
+      0xd76aa478,0xe8c7b756,0x242070db,0xc1bdceee,0xf57c0faf,0x4787c62a,0xa8304613,0xfd469501,
+      0x698098d8,0x8b44f7af,0xffff5bb1,0x895cd7be,0x6b901122,0xfd987193,0xa679438e,0x49b40821,
+      0xf61e2562,0xc040b340,0x265e5a51,0xe9b6c7aa,0xd62f105d,0x02441453,0xd8a1e681,0xe7d3fbc8,
+      0x21e1cde6,0xc33707d6,0xf4d50d87,0x455a14ed,0xa9e3e905,0xfcefa3f8,0x676f02d9,0x8d2a4c8a,
+      0xfffa3942,0x8771f681,0x6d9d6122,0xfde5380c,0xa4beea44,0x4bdecfa9,0xf6bb4b60,0xbebfbc70,
+      0x289b7ec6,0xeaa127fa,0xd4ef3085,0x04881d05,0xd9d4d039,0xe6db99e5,0x1fa27cf8,0xc4ac5665,
+      0xf4292244,0x432aff97,0xab9423a7,0xfc93a039,0x655b59c3,0x8f0ccc92,0xffeff47d,0x85845dd1,
+      0x6fa87e4f,0xfe2ce6e0,0xa3014314,0x4e0811a1,0xf7537e82,0xbd3af235,0x2ad7d2bb,0xeb86d391 };
+    static const int kShift[16] = { 7,12,17,22, 5,9,14,20, 4,11,16,23, 6,10,15,21 };
+
+    uint32_t m[16];
+    for (int i = 0; i < 16; i++)
+      m[i] = block[i*4] | (block[i*4+1] << 8) | (block[i*4+2] << 16) | ((uint32_t)block[i*4+3] << 24);
+
+    uint32_t a = mState[0];
+    uint32_t b = mState[1];
+    uint32_t c = mState[2];
+    uint32_t d = mState[3];
+    for (int i = 0; i < 64; i++) {
+      uint32_t f;
+      int g;
+      switch (i / 16) {
+        case 0:  f = (b & c) | (~b & d); g = i; break;
+        case 1:  f = (d & b) | (~d & c); g = (5*i + 1) & 15; break;
+        case 2:  f = b ^ c ^ d;          g = (3*i + 5) & 15; break;
+        default: f = c ^ (b | ~d);       g = (7*i) & 15; break;
+        }
+      f += a + kK[i] + m[g];
+      a = d;
+      d = c;
+      c = b;
+      int shift = kShift[(i / 16) * 4 + (i & 3)];
+      b += (f << shift) | (f >> (32 - shift));
+      }
+
+    mState[0] += a;
+    mState[1] += b;
+    mState[2] += c;
+    mState[3] += d;
+    }
+  //}}}
+
+  uint32_t mState[4] = { 0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476 };
+  uint64_t mBytes = 0;
+  uint8_t mBlock[64];
+  };
+//}}}
+
+//{{{
+struct sPesPts {
+// es offset of a video pes start and its pts
+  size_t mOffset;
+  uint64_t mPts;
+  };
+//}}}
+//{{{
+static bool tsDemux (uint8_t* ts, uint8_t* tsEnd, vector<uint8_t>& es, vector<sPesPts>& pesPts,
+                     vector<uint8_t>& audioEs, double& demuxOnlySeconds) {
+// es of first video pid in pmt, mpeg1/2 only, and first mpeg audio or aac pid
+// - times a demux only pass first, payload counted not kept
+
+  //{{{  demux only
+  int64_t esBytes = 0;
+  auto time = chrono::steady_clock::now();
+  {
+  cTsDemux demux;
+  demux.setPesCallback ([&](int pid, int streamType, uint8_t* es, int size, int64_t pts, int64_t dts) {
+    esBytes += size;
+    });
+  demux.push (ts, tsEnd - ts);
+  demux.flush();
+  }
+  demuxOnlySeconds = chrono::duration<double>(chrono::steady_clock::now() - time).count();
+  //}}}
+
+  int videoPid = -1;
+  int audioPid = -1;
+  cTsDemux demux;
+  demux.setPesCallback ([&](int pid, int streamType, uint8_t* pes, int size, int64_t pts, int64_t dts) {
+    if ((videoPid < 0) && ((streamType == 0x01) || (streamType == 0x02)))
+      videoPid = pid;
+    else if ((audioPid < 0) && cTsDemux::isAudio (streamType) && (streamType != 0x81))
+      audioPid = pid;
+
+    if (pid == videoPid) {
+      pesPts.push_back ({ es.size(), (uint64_t)max (pts, (int64_t)0) });
+      es.insert (es.end(), pes, pes + size);
+      }
+    else if (pid == audioPid)
+      audioEs.insert (audioEs.end(), pes, pes + size);
+    });
+
+  demux.push (ts, tsEnd - ts);
+  demux.flush();
+  return videoPid >= 0;
+  }
+//}}}
+
+//{{{
+static void benchKernels() {
+// idct and 16x16 halfxy motion compensation kernels per isa on synthetic blocks
+
+  const int kBlocks = 1 << 20;
+
+  alignas(64) int16_t block[64];
+  alignas(64) uint8_t ref[32 * 17];
+  alignas(64) uint8_t dst[16 * 16];
+  for (int i = 0; i < 64; i++)
+    block[i] = (int16_t)((i * 37) % 61 - 30);
+  for (int i = 0; i < 32 * 17; i++)
+    ref[i] = (uint8_t)(i * 13);
+
+  for (int isa = cMpeg2mc::eScalar; isa <= cMpeg2mc::eNeon; isa++) {
+    auto idct = cMpeg2idct::getIdct ((cMpeg2mc::eIsa)isa);
+    auto mc = cMpeg2mc::getKernels ((cMpeg2mc::eIsa)isa);
+    if (!idct || !mc)
+      continue;
+
+    auto time = chrono::steady_clock::now();
+    for (int i = 0; i < kBlocks; i++) {
+      block[0] = (int16_t)i;
+      idct (block);
+      }
+    double idctSeconds = chrono::duration<double>(chrono::steady_clock::now() - time).count();
+
+    time = chrono::steady_clock::now();
+    for (int i = 0; i < kBlocks; i++)
+      mc->mPredict[i & 1][0][3] (dst, ref + (i & 7), 32, 32, 16);
+    double mcSeconds = chrono::duration<double>(chrono::steady_clock::now() - time).count();
+
+    printf ("kernels %-6s idct %6.1f Mblocks/s  mc16 %6.1f Mblocks/s (%d)\n", mc->mName,
+            kBlocks / idctSeconds / 1e6, kBlocks / mcSeconds / 1e6, block[0] + dst[0]);
+    }
+  }
+//}}}
+
+int main (int argc, char* argv[]) {
+
+  //{{{  parse args
+  string fileName;
+  string outName;
+  string writeMd5Name;
+  string checkMd5Name;
+  int sliceThreads = 1;
+  bool frameThreads = false;
+  bool bgra = false;
+  bool kernels = false;
+  string isaName;
+  string modeName;
+  int scaleShift = 0;
+
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp (argv[i], "-o") && (i+1 < argc))
+      outName = argv[++i];
+    else if (!strcmp (argv[i], "-t") && (i+1 < argc))
+      sliceThreads = atoi (argv[++i]);
+    else if (!strcmp (argv[i], "-f"))
+      frameThreads = true;
+    else if (!strcmp (argv[i], "-i") && (i+1 < argc))
+      isaName = argv[++i];
+    else if (!strcmp (argv[i], "-b"))
+      bgra = true;
+    else if (!strcmp (argv[i], "-k"))
+      kernels = true;
+    else if (!strcmp (argv[i], "-w") && (i+1 < argc))
+      writeMd5Name = argv[++i];
+    else if (!strcmp (argv[i], "-c") && (i+1 < argc))
+      checkMd5Name = argv[++i];
+    else if (!strcmp (argv[i], "-m") && (i+1 < argc))
+      modeName = argv[++i];
+    else if (!strcmp (argv[i], "-s") && (i+1 < argc))
+      scaleShift = atoi (argv[++i]);
+    else
+      fileName = argv[i];
+    }
+
+  if (kernels)
+    benchKernels();
+
+  if (fileName.empty()) {
+    if (kernels)
+      return 0;
+    printf ("mpeg2Test [-o out.yuv] [-t sliceThreads] [-f] [-i scalar|sse2|avx2|neon] [-b] [-k]\n"
+            "          [-w golden.md5] [-c golden.md5] [-m all|skipb|ionly] [-s 0..3] file.{m2v,ts}\n"
+            "  -b convert each frame to bgra, -k time idct and mc kernels\n"
+            "  -w write md5 per frame, -c check md5 per frame against golden file\n"
+            "  -m trick play decode mode, -s reduced resolution 1/2, 1/4, 1/8 dc only\n");
+    return 1;
+    }
+  //}}}
+  //{{{  map file, demux if ts
+  cMappedFile file (fileName);
+  if (!file.isOpen()) {
+    printf ("mpeg2Test - can't open %s\n", fileName.c_str());
+    return 1;
+    }
+
+  double demuxOnlySeconds = 0;
+  auto demuxTime = chrono::steady_clock::now();
+
+  vector<uint8_t> es;
+  vector<sPesPts> pesPts;
+  vector<uint8_t> audioEs;
+  if ((file.getSize() >= 188*2) && (file.getBuffer()[0] == 0x47) && (file.getBuffer()[188] == 0x47)) {
+    if (!tsDemux (file.getBuffer(), file.getEnd(), es, pesPts, audioEs, demuxOnlySeconds)) {
+      printf ("mpeg2Test - no video pes in %s\n", fileName.c_str());
+      return 1;
+      }
+    }
+  else
+    es.assign (file.getBuffer(), file.getEnd());
+
+  // zero padding, bitstream reads ahead past end
+  es.resize (es.size() + 8, 0);
+  uint8_t* esBuffer = es.data();
+  uint8_t* esEnd = es.data() + es.size() - 8;
+
+  double demuxSeconds = chrono::duration<double>(chrono::steady_clock::now() - demuxTime).count() - demuxOnlySeconds;
+  //}}}
+
+  cMpeg2decoder decoder;
+  //{{{  select isa
+  cMpeg2mc::eIsa isa = cMpeg2mc::getBestIsa();
+  if (!isaName.empty()) {
+    static const char* kIsaNames[] = { "scalar", "sse2", "avx2", "neon" };
+    int i = 0;
+    while ((i < 4) && (isaName != kIsaNames[i]))
+      i++;
+    if ((i == 4) || !decoder.setIsa ((cMpeg2mc::eIsa)i)) {
+      printf ("mpeg2Test - isa %s not available\n", isaName.c_str());
+      return 1;
+      }
+    isa = (cMpeg2mc::eIsa)i;
+    }
+  //}}}
+  //{{{  select decode mode, scale
+  if (!modeName.empty()) {
+    static const char* kModeNames[] = { "all", "skipb", "ionly" };
+    int i = 0;
+    while ((i < 3) && (modeName != kModeNames[i]))
+      i++;
+    if (i == 3) {
+      printf ("mpeg2Test - unknown decode mode %s\n", modeName.c_str());
+      return 1;
+      }
+    decoder.setDecodeMode ((cMpeg2decoder::eDecodeMode)i);
+    }
+
+  decoder.setScaleShift (scaleShift);
+  //}}}
+  decoder.setFrameThreads (frameThreads);
+  decoder.setSliceThreads (sliceThreads);
+
+  cYuvBgra yuvBgra;
+  yuvBgra.setIsa (isa);
+  vector<uint32_t> bgraBuffer;
+
+  //{{{  frame callback, md5, bgra, reorder frame threaded output by frameNum, write yuv
+  FILE* outFile = outName.empty() ? nullptr : fopen (outName.c_str(), "wb");
+  bool md5 = !writeMd5Name.empty() || !checkMd5Name.empty();
+
+  mutex outMutex;
+  map<int, vector<uint8_t>> pending;
+  int nextFrame = 0;
+  map<int, string> md5s;
+  int numFrames = 0;
+  double callbackSeconds = 0;
+  double bgraSeconds = 0;
+
+  auto writeFrame = [&](vector<uint8_t>& frame) { fwrite (frame.data(), 1, frame.size(), outFile); };
+
+  decoder.setFrameCallback (
+    [&](int frameNum, uint64_t pts, uint8_t** planes, int32_t* linesize, int width, int height, int pictureType) {
+      (void)pts;
+      (void)pictureType;
+
+      lock_guard<mutex> lock (outMutex);
+      auto time = chrono::steady_clock::now();
+      numFrames++;
+
+      if (md5) {
+        //{{{  md5 of visible I420, planes are only valid during callback
+        cMd5 frameMd5;
+        for (int y = 0; y < height; y++)
+          frameMd5.update (planes[0] + y * linesize[0], width);
+        for (int plane = 1; plane < 3; plane++)
+          for (int y = 0; y < height/2; y++)
+            frameMd5.update (planes[plane] + y * linesize[1], width/2);
+        md5s[frameNum] = frameMd5.finish();
+        }
+        //}}}
+
+      if (bgra) {
+        //{{{  colour convert, same converter cVidFrame::getBgra uses
+        auto bgraTime = chrono::steady_clock::now();
+        if ((int)bgraBuffer.size() < width * height + 16)
+          bgraBuffer.resize (width * height + 16);
+        // 64 byte align for streaming stores, as an upload buffer would be
+        auto dst = (uint32_t*)(((uintptr_t)bgraBuffer.data() + 63) & ~(uintptr_t)63);
+        yuvBgra.convertYuv420 (planes[0], linesize[0], planes[1], planes[2], linesize[1],
+                               width, height, dst, width);
+        bgraSeconds += chrono::duration<double>(chrono::steady_clock::now() - bgraTime).count();
+        }
+        //}}}
+
+      if (outFile) {
+        //{{{  copy packed I420
+        auto& frame = pending[frameNum];
+        frame.resize (width * height * 3 / 2);
+        uint8_t* dst = frame.data();
+        for (int y = 0; y < height; y++, dst += width)
+          memcpy (dst, planes[0] + y * linesize[0], width);
+        for (int plane = 1; plane < 3; plane++)
+          for (int y = 0; y < height/2; y++, dst += width/2)
+            memcpy (dst, planes[plane] + y * linesize[1], width/2);
+
+        // frame threaded can complete out of order, write in frameNum order as each next frame arrives
+        for (auto it = pending.find (nextFrame); it != pending.end(); it = pending.find (++nextFrame)) {
+          writeFrame (it->second);
+          pending.erase (it);
+          }
+        }
+        //}}}
+
+      callbackSeconds += chrono::duration<double>(chrono::steady_clock::now() - time).count();
+      });
+  //}}}
+
+  int64_t startAllocs = gAllocs;
+  auto startTime = chrono::steady_clock::now();
+  //{{{  decode video
+  uint8_t* ptr = esBuffer;
+  while (ptr < esEnd) {
+    uint64_t pts = 0;
+    if (!pesPts.empty()) {
+      auto it = upper_bound (pesPts.begin(), pesPts.end(), size_t(ptr - esBuffer),
+                             [](size_t offset, const sPesPts& pes) { return offset < pes.mOffset; });
+      if (it != pesPts.begin())
+        pts = (it-1)->mPts;
+      }
+
+    uint8_t* nextPtr;
+    if (!decoder.decodePes (ptr, esEnd, pts, nextPtr) || (nextPtr <= ptr))
+      break;
+    ptr = nextPtr;
+    }
+
+  decoder.flush (true);
+  //}}}
+  double videoSeconds = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+  int64_t videoAllocs = gAllocs - startAllocs;
+
+  //{{{  decode audio
+  int numAudioFrames[2] = { 0, 0 }; // aac, mp3
+  double audioSeconds[2] = { 0, 0 };
+  iAudioDecoder* audioDecoder = nullptr;
+  bool mp3 = false;
+
+  cAudioFramer framer ([&](eAudioFrameType frameType, const uint8_t* frame, int frameLength) {
+    if (!audioDecoder) {
+      mp3 = frameType == eAudioFrameType::eMp3;
+      audioDecoder = mp3 ? (iAudioDecoder*)new cMp3Decoder() : new cAacDecoder();
+      }
+
+    auto time = chrono::steady_clock::now();
+    auto pcm = audioDecoder->decodeFrame (frame, frameLength, 0);
+    audioSeconds[mp3] += chrono::duration<double>(chrono::steady_clock::now() - time).count();
+    if (pcm) {
+      numAudioFrames[mp3]++;
+      free (pcm);
+      }
+    });
+
+  if (!audioEs.empty())
+    framer.push (audioEs.data(), (int)audioEs.size());
+  delete audioDecoder;
+  //}}}
+
+  //{{{  write remaining, close
+  if (outFile) {
+    for (auto& frame : pending)
+      writeFrame (frame.second);
+    fclose (outFile);
+    }
+  //}}}
+  //{{{  report
+  // serial decode runs the callback inline, take it out of video decode
+  double decodeSeconds = frameThreads ? videoSeconds : videoSeconds - callbackSeconds;
+
+  printf ("%s isa:%s sliceThreads:%d frameThreads:%d\n",
+          fileName.c_str(), cMpeg2mc::getKernels (decoder.getIsa())->mName, sliceThreads, frameThreads);
+  if (demuxOnlySeconds > 0)
+    printf ("  ts     %8.2f Gbit/s demux only %.3fs\n", file.getSize() * 8 / demuxOnlySeconds / 1e9, demuxOnlySeconds);
+  printf ("  demux  %8.1f MB/s %.3fs\n", file.getSize() / demuxSeconds / 1e6, demuxSeconds);
+  printf ("  video  %8.1f fps  %d frames %.3fs %.1f allocs/frame\n",
+          decodeSeconds > 0 ? numFrames / decodeSeconds : 0.0, numFrames, decodeSeconds,
+          numFrames ? (double)videoAllocs / numFrames : 0.0);
+  if (decoder.getDroppedPictures())
+    printf ("  video  %d pictures dropped, no free frame\n", decoder.getDroppedPictures());
+  if (bgra)
+    printf ("  bgra   %8.1f fps  %s\n", bgraSeconds > 0 ? numFrames / bgraSeconds : 0.0, yuvBgra.getIsaName());
+  if (numAudioFrames[0])
+    printf ("  aac    %8.1f frames/s %d frames\n", numAudioFrames[0] / audioSeconds[0], numAudioFrames[0]);
+  if (numAudioFrames[1])
+    printf ("  mp3    %8.1f frames/s %d frames\n", numAudioFrames[1] / audioSeconds[1], numAudioFrames[1]);
+  printf ("  peak rss %.1f MB\n", getPeakRss() / 1e6);
+  //}}}
+
+  int result = 0;
+  if (!writeMd5Name.empty()) {
+    //{{{  write golden md5s, one per line in frameNum order
+    FILE* md5File = fopen (writeMd5Name.c_str(), "w");
+    if (!md5File) {
+      printf ("mpeg2Test - can't write %s\n", writeMd5Name.c_str());
+      return 1;
+      }
+    for (auto& frameMd5 : md5s)
+      fprintf (md5File, "%s\n", frameMd5.second.c_str());
+    fclose (md5File);
+    }
+    //}}}
+  if (!checkMd5Name.empty()) {
+    //{{{  check md5s against golden, exit code 2 on mismatch
+    FILE* md5File = fopen (checkMd5Name.c_str(), "r");
+    if (!md5File) {
+      printf ("mpeg2Test - can't read %s\n", checkMd5Name.c_str());
+      return 1;
+      }
+
+    int frame = 0;
+    int mismatches = 0;
+    char line[64];
+    auto it = md5s.begin();
+    for (; fgets (line, sizeof(line), md5File); frame++) {
+      line[strcspn (line, "\r\n")] = 0;
+      if ((it == md5s.end()) || (it->second != line)) {
+        if (!mismatches)
+          printf ("  md5 first mismatch at frame %d\n", frame);
+        mismatches++;
+        }
+      if (it != md5s.end())
+        ++it;
+      }
+    fclose (md5File);
+
+    if ((frame != (int)md5s.size()) || mismatches) {
+      printf ("  md5 FAIL %d of %d frames differ, golden %d frames\n", mismatches, (int)md5s.size(), frame);
+      result = 2;
+      }
+    else
+      printf ("  md5 ok %d frames\n", frame);
+    }
+    //}}}
+
+  return result;
+  }
@@ -0,0 +1,157 @@
+// pngMain.cpp - decode pngs flat out per unfilter kernel isa, no display
+// - reports decoded MB/s per isa over the corpus, checks every isa output is byte identical to scalar
+// - linux: g++ -O2 -std=c++17 -I../decoders pngMain.cpp -o pngTest
+// - pngTest [-i scalar|sse2|avx2|neon] [-n repeats] [-o out.raw] file.png ...
+//{{{  includes
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include <string>
+#include <vector>
+#include <chrono>
+
+#include "../decoders/cMappedFile.h"
+#include "../decoders/cPngPic.h"
+
+using namespace std;
+//}}}
+
+//{{{
+struct sPng {
+  string mFileName;
+  vector<uint8_t> mBuffer;
+  size_t mBytes = 0;
+  vector<uint8_t> mScalar;  // scalar output, reference for the other isas
+  };
+//}}}
+//{{{
+static uint8_t* decode (sPng& png, cMpeg2mc::eIsa isa) {
+// returns malloced pic, nullptr on error
+
+  cPngPic* pic = new cPngPic (png.mBuffer.data(), png.mBuffer.size());
+  uint8_t* buffer = nullptr;
+  if (pic->setIsa (isa) && pic->readHeader()) {
+    png.mBytes = (pic->getWidth() * pic->getHeight() * pic->getBpp() + 7) / 8;
+    buffer = pic->decodeBody();
+    }
+
+  delete pic;
+  return buffer;
+  }
+//}}}
+
+int main (int argc, char* argv[]) {
+
+  //{{{  parse args
+  vector<string> fileNames;
+  string isaName;
+  string outName;
+  int repeats = 1;
+
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp (argv[i], "-i") && (i+1 < argc))
+      isaName = argv[++i];
+    else if (!strcmp (argv[i], "-n") && (i+1 < argc))
+      repeats = max (1, atoi (argv[++i]));
+    else if (!strcmp (argv[i], "-o") && (i+1 < argc))
+      outName = argv[++i];
+    else
+      fileNames.push_back (argv[i]);
+    }
+
+  if (fileNames.empty()) {
+    printf ("pngTest [-i scalar|sse2|avx2|neon] [-n repeats] [-o out.raw] file.png ...\n"
+            "  default every available isa\n"
+            "  -o writes the last file decoded by the last isa\n");
+    return 1;
+    }
+  //}}}
+  //{{{  load files
+  vector<sPng> pngs;
+  for (auto& fileName : fileNames) {
+    cMappedFile file (fileName);
+    if (!file.isOpen()) {
+      printf ("pngTest - can't open %s\n", fileName.c_str());
+      return 1;
+      }
+
+    sPng png;
+    png.mFileName = fileName;
+    png.mBuffer.assign (file.getBuffer(), file.getEnd());
+    pngs.push_back (move (png));
+    }
+  //}}}
+  //{{{  isas
+  static const char* kIsaNames[] = { "scalar", "sse2", "avx2", "neon" };
+
+  vector<cMpeg2mc::eIsa> isas;
+  for (int i = 0; i < 4; i++)
+    if ((isaName.empty() || (isaName == kIsaNames[i])) && cPngKernels::getKernels ((cMpeg2mc::eIsa)i))
+      isas.push_back ((cMpeg2mc::eIsa)i);
+
+  if (isas.empty()) {
+    printf ("pngTest - isa %s not available\n", isaName.c_str());
+    return 1;
+    }
+  //}}}
+
+  int mismatches = 0;
+  int errors = 0;
+  for (auto isa : isas) {
+    double seconds = 0;
+    double bytes = 0;
+    for (auto& png : pngs)
+      for (int repeat = 0; repeat < repeats; repeat++) {
+        auto time = chrono::steady_clock::now();
+        uint8_t* pic = decode (png, isa);
+        seconds += chrono::duration<double>(chrono::steady_clock::now() - time).count();
+        if (!pic) {
+          //{{{  error
+          if (!repeat)
+            printf ("pngTest - %s failed %s\n", png.mFileName.c_str(), kIsaNames[isa]);
+          errors++;
+          break;
+          }
+          //}}}
+        bytes += (double)png.mBytes;
+
+        if (!repeat) {
+          //{{{  compare with scalar, keep scalar as reference, write
+          if (isa == cMpeg2mc::eScalar)
+            png.mScalar.assign (pic, pic + png.mBytes);
+          else if (png.mScalar.empty()) {
+            uint8_t* scalar = decode (png, cMpeg2mc::eScalar);
+            if (scalar)
+              png.mScalar.assign (scalar, scalar + png.mBytes);
+            free (scalar);
+            }
+
+          if ((isa != cMpeg2mc::eScalar) && !png.mScalar.empty() && memcmp (png.mScalar.data(), pic, png.mBytes)) {
+            printf ("pngTest - %s %s differs from scalar\n", png.mFileName.c_str(), kIsaNames[isa]);
+            mismatches++;
+            }
+
+          if (!outName.empty() && (&png == &pngs.back()) && (isa == isas.back())) {
+            FILE* outFile = fopen (outName.c_str(), "wb");
+            if (outFile) {
+              fwrite (pic, 1, png.mBytes, outFile);
+              fclose (outFile);
+              }
+            }
+          }
+          //}}}
+
+        free (pic);
+        }
+
+    printf ("%-6s %8.1f MB/s  %d files x %d\n",
+            kIsaNames[isa], seconds > 0 ? bytes / seconds / 1e6 : 0.0, (int)pngs.size(), repeats);
+    }
+
+  if (mismatches || errors)
+    printf ("pngTest - %d mismatches, %d errors\n", mismatches, errors);
+  return (mismatches || errors) ? 1 : 0;
+  }
@@ -0,0 +1,293 @@
+// resPackMain.cpp - build one indexed resource pack for cResourcePack from resource files
+// - entries named by file name, lz compressed when that saves an eighth, stored otherwise
+// - -d pre-decodes .bmp .png .jpg .gif to rgba so startup skips the decode
+// - -s writes a gcc/clang .S that incbins the pack, -r a win32 .rc that links it as RCDATA
+// - linux: g++ -O2 -std=c++17 resPackMain.cpp -o resPack -lpthread
+// - resPack [-d] [-s pack.S] [-r pack.rc] -o resources.pack file ...
+// - from resources: resPack -d -s resources.S -r resources.rc -o resources.pack *.bmp *.ttf mondaine.jpg
+//{{{  includes
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include <string>
+#include <sstream>
+#include <vector>
+#include <algorithm>
+
+#include "../resources/cResourcePack.h"
+#include "../decoders/cDecodePic.h"
+
+using namespace std;
+//}}}
+
+//{{{
+struct sResource {
+  string mName;
+  cResourcePack::sEntry mEntry;
+  vector<uint8_t> mData;  // as stored in the pack
+  };
+//}}}
+
+//{{{
+static vector<uint8_t> lzCompress (const uint8_t* src, size_t size) {
+// greedy lz4 style sequences for cResourcePack::lzExpand, 4 byte hash chain of one, 64k window
+
+  const int kHashBits = 14;
+  const size_t kMinMatch = 4;
+  const size_t kMaxOffset = 65535;
+
+  vector<uint8_t> dst;
+  vector<size_t> table (1 << kHashBits, SIZE_MAX);
+
+  //{{{
+  auto putLength = [&](size_t length) {
+    // nibble already 15, rest in 255 bytes
+    for (length -= 15; length >= 255; length -= 255)
+      dst.push_back (255);
+    dst.push_back ((uint8_t)length);
+    };
+  //}}}
+  //{{{
+  auto putSequence = [&](size_t literalStart, size_t literals, size_t offset, size_t match) {
+    // match 0 for the final literals only sequence
+
+    size_t matchCode = match ? match - kMinMatch : 0;
+    dst.push_back ((uint8_t)((min (literals, (size_t)15) << 4) | min (matchCode, (size_t)15)));
+    if (literals >= 15)
+      putLength (literals);
+    dst.insert (dst.end(), src + literalStart, src + literalStart + literals);
+
+    if (match) {
+      dst.push_back ((uint8_t)offset);
+      dst.push_back ((uint8_t)(offset >> 8));
+      if (matchCode >= 15)
+        putLength (matchCode);
+      }
+    };
+  //}}}
+
+  size_t literalStart = 0;
+  size_t pos = 0;
+  while (pos + kMinMatch <= size) {
+    uint32_t word;
+    memcpy (&word, src + pos, 4);
+    uint32_t hash = (word * 2654435761u) >> (32 - kHashBits);
+    size_t candidate = table[hash];
+    table[hash] = pos;
+
+    if ((candidate != SIZE_MAX) && (pos - candidate <= kMaxOffset) && !memcmp (src + candidate, src + pos, 4)) {
+      size_t match = kMinMatch;
+      while ((pos + match < size) && (src[candidate + match] == src[pos + match]))
+        match++;
+
+      putSequence (literalStart, pos - literalStart, pos - candidate, match);
+      pos += match;
+      literalStart = pos;
+      }
+    else
+      pos++;
+    }
+
+  putSequence (literalStart, size - literalStart, 0, 0);
+  return dst;
+  }
+//}}}
+//{{{
+static bool isImage (const string& fileName) {
+
+  string ext = fileName.substr (fileName.find_last_of ('.') + 1);
+  transform (ext.begin(), ext.end(), ext.begin(), ::tolower);
+  return (ext == "bmp") || (ext == "png") || (ext == "jpg") || (ext == "jpeg") || (ext == "gif");
+  }
+//}}}
+//{{{
+static bool writeText (const string& fileName, const string& text) {
+
+  FILE* file = fopen (fileName.c_str(), "wb");
+  if (!file)
+    return false;
+  fwrite (text.data(), 1, text.size(), file);
+  return fclose (file) == 0;
+  }
+//}}}
+
+int main (int argc, char* argv[]) {
+
+  //{{{  parse args
+  vector<string> fileNames;
+  string outName;
+  string asmName;
+  string rcName;
+  bool decode = false;
+
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp (argv[i], "-o") && (i+1 < argc))
+      outName = argv[++i];
+    else if (!strcmp (argv[i], "-s") && (i+1 < argc))
+      asmName = argv[++i];
+    else if (!strcmp (argv[i], "-r") && (i+1 < argc))
+      rcName = argv[++i];
+    else if (!strcmp (argv[i], "-d"))
+      decode = true;
+    else
+      fileNames.push_back (argv[i]);
+    }
+
+  if (fileNames.empty() || outName.empty()) {
+    printf ("resPack [-d] [-s pack.S] [-r pack.rc] -o resources.pack file ...\n"
+            "  -d pre-decodes images to rgba\n"
+            "  -s incbin .S defining resourcePack, resourcePackEnd for gcc/clang links\n"
+            "  -r .rc linking the pack as RCDATA resourcePack for cResourcePack::openResource\n");
+    return 1;
+    }
+  //}}}
+  //{{{  load, decode, compress
+  vector<sResource> resources;
+  size_t rawBytes = 0;
+
+  for (auto& fileName : fileNames) {
+    cMappedFile file (fileName);
+    if (!file.isOpen()) {
+      printf ("resPack - can't open %s\n", fileName.c_str());
+      return 1;
+      }
+
+    sResource resource;
+    resource.mName = fileName.substr (fileName.find_last_of ("/\\") + 1);
+    memset (&resource.mEntry, 0, sizeof(resource.mEntry));
+    for (auto& other : resources)
+      if (other.mName == resource.mName) {
+        printf ("resPack - %s named twice\n", resource.mName.c_str());
+        return 1;
+        }
+
+    vector<uint8_t> data (file.getBuffer(), file.getEnd());
+    if (decode && isImage (fileName)) {
+      cDecodePic pic;
+      if (!pic.setPicRgba (file.getBuffer(), (int)file.getSize())) {
+        printf ("resPack - can't decode %s\n", fileName.c_str());
+        return 1;
+        }
+      resource.mEntry.mType = cResourcePack::eRgba;
+      resource.mEntry.mWidth = pic.getWidth();
+      resource.mEntry.mHeight = pic.getHeight();
+      data.assign (pic.getPic(), pic.getPic() + (size_t)pic.getWidth() * pic.getHeight() * 4);
+      free (pic.getPic());
+      }
+
+    resource.mEntry.mBytes = (uint32_t)data.size();
+    rawBytes += data.size();
+
+    vector<uint8_t> compressed = lzCompress (data.data(), data.size());
+    if (compressed.size() <= data.size() - data.size() / 8) {
+      resource.mEntry.mCodec = cResourcePack::eLz;
+      resource.mData.swap (compressed);
+      }
+    else {
+      resource.mEntry.mCodec = cResourcePack::eStored;
+      resource.mData.swap (data);
+      }
+    resource.mEntry.mStoredBytes = (uint32_t)resource.mData.size();
+
+    printf ("%-24s %8u -> %8u %s%s\n", resource.mName.c_str(), resource.mEntry.mBytes, resource.mEntry.mStoredBytes,
+            resource.mEntry.mCodec == cResourcePack::eLz ? "lz" : "stored",
+            resource.mEntry.mType == cResourcePack::eRgba ? " rgba" : "");
+    resources.push_back (move (resource));
+    }
+  //}}}
+  //{{{  layout header, entries, slots, names, data 16 byte aligned
+  cResourcePack::sHeader header;
+  memset (&header, 0, sizeof(header));
+  header.mMagic = cResourcePack::kMagic;
+  header.mVersion = cResourcePack::kVersion;
+  header.mNumEntries = (uint32_t)resources.size();
+
+  // at most half full, short probe runs
+  header.mNumSlots = 1;
+  while (header.mNumSlots < resources.size() * 2)
+    header.mNumSlots *= 2;
+
+  header.mEntriesOffset = sizeof(header);
+  header.mSlotsOffset = header.mEntriesOffset + header.mNumEntries * sizeof(cResourcePack::sEntry);
+  header.mNamesOffset = header.mSlotsOffset + header.mNumSlots * 4;
+
+  size_t offset = header.mNamesOffset;
+  for (auto& resource : resources) {
+    resource.mEntry.mNameOffset = (uint32_t)offset;
+    resource.mEntry.mNameLength = (uint16_t)resource.mName.size();
+    offset += resource.mName.size();
+    }
+  for (auto& resource : resources) {
+    offset = (offset + 15) & ~(size_t)15;
+    resource.mEntry.mDataOffset = (uint32_t)offset;
+    offset += resource.mData.size();
+    }
+  header.mBytes = (uint32_t)offset;
+  //}}}
+  //{{{  build pack
+  vector<uint8_t> pack (header.mBytes, 0);
+  memcpy (pack.data(), &header, sizeof(header));
+
+  for (size_t i = 0; i < resources.size(); i++) {
+    auto& resource = resources[i];
+    memcpy (pack.data() + header.mEntriesOffset + i * sizeof(cResourcePack::sEntry), &resource.mEntry, sizeof(resource.mEntry));
+    memcpy (pack.data() + resource.mEntry.mNameOffset, resource.mName.data(), resource.mName.size());
+    memcpy (pack.data() + resource.mEntry.mDataOffset, resource.mData.data(), resource.mData.size());
+
+    // linear probe from the name hash to a free slot
+    uint32_t mask = header.mNumSlots - 1;
+    uint32_t slot = cResourcePack::getHash (resource.mName.c_str(), resource.mName.size()) & mask;
+    uint32_t index;
+    for (;; slot = (slot + 1) & mask) {
+      memcpy (&index, pack.data() + header.mSlotsOffset + slot * 4, 4);
+      if (!index)
+        break;
+      }
+    index = (uint32_t)i + 1;
+    memcpy (pack.data() + header.mSlotsOffset + slot * 4, &index, 4);
+    }
+  //}}}
+  //{{{  write pack, check it reads back
+  FILE* outFile = fopen (outName.c_str(), "wb");
+  if (!outFile || (fwrite (pack.data(), 1, pack.size(), outFile) != pack.size()) || fclose (outFile)) {
+    printf ("resPack - can't write %s\n", outName.c_str());
+    return 1;
+    }
+
+  cResourcePack check;
+  if (!check.open (pack.data(), pack.size())) {
+    printf ("resPack - %s doesn't open\n", outName.c_str());
+    return 1;
+    }
+  for (auto& resource : resources)
+    if (!check.get (resource.mName.c_str()).mData) {
+      printf ("resPack - %s doesn't read back\n", resource.mName.c_str());
+      return 1;
+      }
+  //}}}
+
+  string packName = outName.substr (outName.find_last_of ("/\\") + 1);
+  if (!asmName.empty() &&
+      !writeText (asmName, "  .section .rodata\n"
+                           "  .balign 16\n"
+                           "  .global resourcePack\n"
+                           "  .global resourcePackEnd\n"
+                           "resourcePack:\n"
+                           "  .incbin \"" + packName + "\"\n"
+                           "resourcePackEnd:\n"
+                           "  .section .note.GNU-stack,\"\",@progbits\n")) {
+    printf ("resPack - can't write %s\n", asmName.c_str());
+    return 1;
+    }
+  if (!rcName.empty() && !writeText (rcName, "resourcePack RCDATA \"" + packName + "\"\n")) {
+    printf ("resPack - can't write %s\n", rcName.c_str());
+    return 1;
+    }
+
+  printf ("%s %d entries %zu -> %u bytes\n", outName.c_str(), (int)resources.size(), rawBytes, header.mBytes);
+  return 0;
+  }
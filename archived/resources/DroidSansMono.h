@@ -1,7466 +0,0 @@
-#pragma once
-#include <stdint.h>
-
-const uint8_t droidSansMono[]  = {
-  0x00,0x01,0x00,0x00,0x00,0x0E,0x00,0x80,0x00,0x03,0x00,0x60,0x4F,0x53,0x2F,0x32,
-  0xA0,0xCB,0x95,0xC0,0x00,0x00,0x01,0x68,0x00,0x00,0x00,0x60,0x63,0x6D,0x61,0x70,
-  0x57,0x0E,0x33,0x5E,0x00,0x00,0x08,0xD4,0x00,0x00,0x0F,0xD2,0x63,0x76,0x74,0x20,
-  0x44,0x9D,0x4D,0x72,0x00,0x00,0x22,0x30,0x00,0x00,0x02,0x10,0x66,0x70,0x67,0x6D,
-  0x73,0xD3,0x23,0xB0,0x00,0x00,0x18,0xA8,0x00,0x00,0x07,0x05,0x67,0x61,0x73,0x70,
-  0x00,0x04,0x00,0x07,0x00,0x01,0xD2,0x48,0x00,0x00,0x00,0x0C,0x67,0x6C,0x79,0x66,
-  0x94,0x99,0xBD,0x91,0x00,0x00,0x2B,0x4C,0x00,0x01,0x82,0xD8,0x68,0x65,0x61,0x64,
-  0xEE,0x64,0xA2,0x51,0x00,0x00,0x00,0xEC,0x00,0x00,0x00,0x36,0x68,0x68,0x65,0x61,
-  0x0B,0x5B,0x02,0x96,0x00,0x00,0x01,0x24,0x00,0x00,0x00,0x24,0x68,0x6D,0x74,0x78,
-  0xF9,0x57,0xF4,0xC1,0x00,0x00,0x01,0xC8,0x00,0x00,0x07,0x0A,0x6C,0x6F,0x63,0x61,
-  0xB6,0xAF,0x56,0x31,0x00,0x00,0x24,0x40,0x00,0x00,0x07,0x0A,0x6D,0x61,0x78,0x70,
-  0x05,0xED,0x02,0x77,0x00,0x00,0x01,0x48,0x00,0x00,0x00,0x20,0x6E,0x61,0x6D,0x65,
-  0x7B,0xF4,0xE2,0x28,0x00,0x01,0xAE,0x24,0x00,0x00,0x06,0xCC,0x70,0x6F,0x73,0x74,
-  0x67,0x8C,0x4E,0x51,0x00,0x01,0xB4,0xF0,0x00,0x00,0x1D,0x55,0x70,0x72,0x65,0x70,
-  0x41,0xBD,0xDA,0x82,0x00,0x00,0x1F,0xB0,0x00,0x00,0x02,0x7E,0x00,0x01,0x00,0x00,
-  0x00,0x01,0x00,0x00,0xD0,0x1C,0x4E,0x14,0x5F,0x0F,0x3C,0xF5,0x00,0x0B,0x08,0x00,
-  0x00,0x00,0x00,0x00,0xC1,0xC7,0xE9,0x54,0x00,0x00,0x00,0x00,0xC9,0x92,0x6D,0xB7,
-  0xFE,0xC8,0xFD,0xD5,0x05,0x23,0x08,0x73,0x00,0x00,0x00,0x09,0x00,0x02,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x07,0x6D,0xFE,0x1D,0x00,0x00,0x04,0xCD,
-  0xFE,0xC8,0xFF,0xAA,0x05,0x23,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x00,0x03,0x84,0x00,0x90,
-  0x00,0x12,0x00,0x52,0x00,0x05,0x00,0x02,0x00,0x10,0x00,0x2F,0x00,0x5A,0x00,0x00,
-  0x01,0xE4,0x01,0x63,0x00,0x03,0x00,0x01,0x00,0x03,0x04,0xCD,0x01,0x90,0x00,0x05,
-  0x00,0x08,0x05,0x9A,0x05,0x33,0x00,0x00,0x01,0x1E,0x05,0x9A,0x05,0x33,0x00,0x00,
-  0x03,0xD0,0x00,0x66,0x01,0xF2,0x00,0x00,0x02,0x0B,0x06,0x09,0x03,0x08,0x04,0x02,
-  0x02,0x04,0xE0,0x00,0x02,0xEF,0x40,0x00,0x20,0x5B,0x00,0x00,0x00,0x28,0x00,0x00,
-  0x00,0x00,0x31,0x41,0x53,0x43,0x00,0x40,0x00,0x20,0xFF,0xFD,0x06,0x1F,0xFE,0x14,
-  0x00,0x84,0x07,0x6D,0x01,0xE3,0x20,0x00,0x01,0x9F,0x00,0x00,0x00,0x00,0x04,0x4A,
-  0x05,0xB6,0x00,0x00,0x00,0x20,0x00,0x00,0x04,0xCD,0x00,0xC1,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x01,0xE7,0x01,0x1D,0x00,0x2D,0x00,0xB6,0x00,0x00,0x00,0x3D,0x01,0xF0,
-  0x01,0x27,0x01,0x29,0x00,0x85,0x00,0x98,0x01,0xB8,0x01,0x1D,0x01,0xCF,0x00,0xD3,
-  0x00,0x93,0x00,0xE1,0x00,0x9E,0x00,0x83,0x00,0x3D,0x00,0xAC,0x00,0x9A,0x00,0x8F,
-  0x00,0x9C,0x00,0x9A,0x01,0xE7,0x01,0x9A,0x00,0x98,0x00,0x98,0x00,0x98,0x00,0xA8,
-  0x00,0x1F,0x00,0x21,0x00,0x87,0x00,0x81,0x00,0x87,0x00,0xD9,0x00,0xF4,0x00,0x75,
-  0x00,0x87,0x00,0xE1,0x00,0x89,0x00,0xD3,0x00,0xE9,0x00,0x71,0x00,0x87,0x00,0x54,
-  0x00,0xB0,0x00,0x54,0x00,0xBA,0x00,0x8D,0x00,0x66,0x00,0x7D,0x00,0x21,0x00,0x02,
-  0x00,0x35,0x00,0x21,0x00,0x66,0x01,0x9C,0x00,0xD3,0x01,0x21,0x00,0x6F,0xFF,0xF0,
-  0x01,0xA2,0x00,0x87,0x00,0x9E,0x00,0xAC,0x00,0x89,0x00,0x85,0x00,0x9C,0x00,0x66,
-  0x00,0xA0,0x00,0xC5,0x00,0x87,0x00,0xD7,0x00,0xBC,0x00,0x5C,0x00,0xA0,0x00,0x73,
-  0x00,0x9E,0x00,0x89,0x01,0x08,0x00,0xCB,0x00,0x8B,0x00,0xA0,0x00,0x52,0xFF,0xFC,
-  0x00,0x60,0x00,0x52,0x00,0xB6,0x00,0xE1,0x02,0x1B,0x00,0xE3,0x00,0x98,0x00,0x00,
-  0x01,0xE7,0x00,0xAC,0x00,0x77,0x00,0xAE,0x00,0x4E,0x02,0x1B,0x00,0xF4,0x01,0x4A,
-  0x00,0x06,0x01,0x14,0x00,0xC5,0x00,0x98,0x01,0x1D,0x00,0x06,0xFF,0xEC,0x01,0x2B,
-  0x00,0x98,0x01,0x5C,0x01,0x56,0x01,0xA2,0x00,0xB4,0x00,0x42,0x01,0xE7,0x01,0xAC,
-  0x01,0x6F,0x01,0x19,0x00,0xC5,0x00,0x16,0x00,0x03,0x00,0x15,0x00,0xA8,0x00,0x21,
-  0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x81,0x00,0xD9,
-  0x00,0xD9,0x00,0xD9,0x00,0xD9,0x00,0xE1,0x00,0xE1,0x00,0xE1,0x00,0xE1,0x00,0x00,
-  0x00,0x87,0x00,0x54,0x00,0x54,0x00,0x54,0x00,0x54,0x00,0x54,0x00,0xBE,0x00,0x50,
-  0x00,0x7D,0x00,0x7D,0x00,0x7D,0x00,0x7D,0x00,0x21,0x00,0xB0,0x00,0xA4,0x00,0x87,
-  0x00,0x87,0x00,0x87,0x00,0x87,0x00,0x87,0x00,0x87,0x00,0x2D,0x00,0xAC,0x00,0x85,
-  0x00,0x85,0x00,0x85,0x00,0x85,0x00,0xC5,0x00,0xC5,0x00,0xC5,0x00,0xC5,0x00,0x87,
-  0x00,0xA0,0x00,0x73,0x00,0x73,0x00,0x73,0x00,0x73,0x00,0x73,0x00,0x98,0x00,0x73,
-  0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0x52,0x00,0x9E,0x00,0x52,0x00,0x21,
-  0x00,0x87,0x00,0x21,0x00,0x87,0x00,0x21,0x00,0x87,0x00,0x81,0x00,0xAC,0x00,0x81,
-  0x00,0xAC,0x00,0x81,0x00,0xAC,0x00,0x81,0x00,0xAC,0x00,0x87,0x00,0x4F,0x00,0x00,
-  0x00,0x89,0x00,0xD9,0x00,0x85,0x00,0xD9,0x00,0x85,0x00,0xD9,0x00,0x85,0x00,0xD9,
-  0x00,0x85,0x00,0xD9,0x00,0x85,0x00,0x75,0x00,0x66,0x00,0x75,0x00,0x66,0x00,0x75,
-  0x00,0x66,0x00,0x75,0x00,0x66,0x00,0x87,0x00,0xA0,0x00,0x00,0x00,0x04,0x00,0xE1,
-  0x00,0xC5,0x00,0xE1,0x00,0xC5,0x00,0xE1,0x00,0xC5,0x00,0xE1,0x00,0xC5,0x00,0xE1,
-  0x00,0xC5,0x00,0x9C,0x00,0xBC,0x00,0x89,0x00,0x87,0x00,0xD3,0x00,0xD7,0x00,0xD7,
-  0x00,0xE9,0x00,0xBC,0x00,0xE9,0x00,0xBC,0x00,0xE9,0x00,0xBC,0x00,0xE9,0x00,0xBC,
-  0x00,0x48,0x00,0xBC,0x00,0x87,0x00,0xA0,0x00,0x87,0x00,0xA0,0x00,0x87,0x00,0xA0,
-  0xFF,0xF0,0x00,0x87,0x00,0xA0,0x00,0x54,0x00,0x73,0x00,0x54,0x00,0x73,0x00,0x54,
-  0x00,0x73,0x00,0x14,0x00,0x39,0x00,0xBA,0x01,0x08,0x00,0xBA,0x00,0xBB,0x00,0xBA,
-  0x01,0x08,0x00,0x8D,0x00,0xCB,0x00,0x8D,0x00,0xCB,0x00,0x8D,0x00,0xCB,0x00,0x8D,
-  0x00,0xCB,0x00,0x66,0x00,0x8B,0x00,0x66,0x00,0x8B,0x00,0x66,0x00,0x8B,0x00,0x7D,
-  0x00,0xA0,0x00,0x7D,0x00,0xA0,0x00,0x7D,0x00,0xA0,0x00,0x7D,0x00,0xA0,0x00,0x7D,
-  0x00,0xA0,0x00,0x7D,0x00,0xA0,0x00,0x02,0xFF,0xFC,0x00,0x21,0x00,0x52,0x00,0x21,
-  0x00,0x66,0x00,0xB6,0x00,0x66,0x00,0xB6,0x00,0x66,0x00,0xB6,0x01,0x64,0x00,0xD7,
-  0x00,0x21,0x00,0x87,0x00,0x00,0x00,0x2D,0x00,0x50,0x00,0x73,0x00,0x8D,0x00,0xCB,
-  0x01,0x1B,0x01,0x1B,0x01,0x46,0x01,0x39,0x01,0xFC,0x01,0x83,0x01,0x9E,0x00,0xFE,
-  0x00,0xF6,0x01,0xDF,0x01,0x2B,0x00,0x21,0x01,0xE7,0xFF,0x8E,0xFF,0x65,0xFF,0xA3,
-  0xFF,0x7C,0xFF,0x13,0xFF,0x7A,0x00,0xF1,0x00,0x21,0x00,0x87,0x00,0xF6,0x00,0x44,
-  0x00,0xD9,0x00,0x66,0x00,0x87,0x00,0x54,0x00,0xE1,0x00,0xD3,0x00,0x21,0x00,0x71,
-  0x00,0x87,0x00,0x6F,0x00,0x54,0x00,0x87,0x00,0xB0,0x00,0x83,0x00,0x66,0x00,0x21,
-  0x00,0x1B,0x00,0x35,0x00,0x39,0x00,0x4A,0x00,0xE1,0x00,0x21,0x00,0x79,0x00,0xC9,
-  0x00,0xA0,0x01,0xAC,0x00,0xA0,0x00,0x79,0x00,0x9E,0x00,0x52,0x00,0x87,0x00,0xC9,
-  0x00,0xA2,0x00,0xA0,0x00,0x93,0x01,0xAC,0x00,0xD7,0x00,0x3D,0x00,0xA0,0x00,0x3D,
-  0x00,0xAC,0x00,0x73,0x00,0x0E,0x00,0x9E,0x00,0xAC,0x00,0x81,0x00,0x6A,0x00,0xA0,
-  0x00,0x4A,0x00,0x2B,0x00,0x50,0x00,0x5A,0x01,0x03,0x00,0xA0,0x00,0x73,0x00,0xA0,
-  0x00,0x5A,0x00,0xD9,0x00,0x17,0x00,0xF6,0x00,0x81,0x00,0x8D,0x00,0xE1,0x00,0xE1,
-  0x00,0x89,0x00,0x00,0x00,0x42,0x00,0x17,0x00,0xD3,0x00,0x1B,0x00,0x87,0x00,0x21,
-  0x00,0x87,0x00,0x87,0x00,0xF6,0x00,0x06,0x00,0xD9,0x00,0x00,0x00,0x8B,0x00,0x89,
-  0x00,0x89,0x00,0xD3,0x00,0x04,0x00,0x71,0x00,0x87,0x00,0x54,0x00,0x87,0x00,0xB0,
-  0x00,0x81,0x00,0x66,0x00,0x1B,0x00,0x1B,0x00,0x35,0x00,0x87,0x00,0x87,0x00,0x79,
-  0x00,0x3D,0x00,0x1B,0x00,0x60,0x00,0xB0,0x00,0x44,0x00,0x62,0x00,0x39,0x00,0x87,
-  0x00,0x8F,0x00,0xB0,0x01,0x23,0x00,0x21,0x00,0x85,0x00,0x00,0x00,0xC9,0x00,0xA0,
-  0x00,0xA0,0x00,0xD7,0x00,0x1F,0x00,0x73,0x00,0xA0,0x00,0x73,0x00,0xA0,0x00,0x9E,
-  0x00,0xAC,0x00,0x79,0x00,0x52,0x00,0x4A,0x00,0x60,0x00,0x98,0x00,0x98,0x00,0x7D,
-  0x00,0x6D,0x00,0x2B,0x00,0x71,0x00,0xD9,0x00,0xB8,0x00,0x7B,0x00,0x73,0x00,0x85,
-  0x00,0x04,0x01,0x23,0x00,0xAC,0x00,0xCB,0x00,0xC5,0x00,0xC5,0x00,0x87,0x00,0x00,
-  0x00,0x6A,0x00,0x04,0x00,0xD7,0x00,0x52,0x00,0xA0,0x00,0xF6,0x01,0x23,0x00,0x02,
-  0xFF,0xFC,0x00,0x02,0xFF,0xFC,0x00,0x02,0xFF,0xFC,0x00,0x21,0x00,0x52,0x00,0xB8,
-  0xFF,0xFA,0xFF,0xFA,0xFF,0xEC,0x01,0xBE,0x01,0xBE,0x01,0xC9,0x01,0xBE,0x00,0xE9,
-  0x00,0xE9,0x00,0xF4,0x00,0xF0,0x00,0xE5,0x01,0x7B,0x00,0x4E,0x00,0x04,0x01,0xF0,
-  0x01,0x1D,0x01,0x91,0x01,0x91,0x00,0xFF,0x00,0xAA,0x01,0x3D,0x00,0x81,0x00,0x77,
-  0x00,0x52,0x00,0x60,0x00,0x08,0x00,0xE3,0x00,0x19,0x00,0x00,0x00,0x4A,0x00,0x52,
-  0x00,0x12,0x00,0x0B,0x00,0x18,0x00,0x1C,0x00,0x79,0x00,0x4A,0x00,0x9C,0x00,0x4A,
-  0x00,0x98,0x00,0x17,0x00,0x46,0x00,0xEC,0x00,0x98,0x00,0x98,0x00,0x98,0x00,0x98,
-  0x00,0x7D,0x00,0x31,0x00,0x31,0x00,0xE7,0x00,0x87,0x01,0xEE,0x01,0xE3,0x01,0xE3,
-  0x01,0x39,0x01,0x25,0x01,0x50,0x01,0x39,0x01,0x6F,0x01,0x31,0x01,0x39,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0x00,0x04,0x00,0x87,0x01,0xBE,
-  0x00,0x0A,0x00,0x1F,0x00,0x12,0x00,0x71,0x00,0x5C,0x00,0x21,0x00,0x87,0xFE,0xC8,
-  0x01,0x83,0x01,0x2D,0x00,0x42,0x00,0x42,0x00,0x54,0x00,0x73,0x00,0x7D,0x00,0xA0,
-  0x01,0xA2,0x01,0xA2,0x00,0xFE,0x01,0xAC,0x01,0xFC,0x00,0xD9,0x00,0x89,0x00,0x85,
-  0x00,0xA0,0x00,0x52,0xFF,0xFC,0x00,0x14,0x00,0x14,0x00,0x62,0x00,0xA0,0x00,0x00,
-  0x00,0x3D,0x00,0x62,0x00,0x7B,0x00,0x00,0x00,0x0A,0x00,0x5C,0x00,0x7B,0x00,0x75,
-  0x00,0x8F,0x00,0x39,0x00,0x50,0x00,0x54,0x00,0x73,0x00,0x3F,0x00,0x52,0x00,0x3F,
-  0x00,0x52,0x00,0x46,0x00,0x50,0x00,0x54,0x00,0x73,0x00,0x52,0x00,0x58,0x00,0x52,
-  0xFF,0xFC,0x00,0x81,0x00,0xAC,0x00,0x5E,0x00,0xF2,0x00,0xF2,0x01,0xE1,0x01,0xE1,
-  0x00,0x29,0x00,0x29,0x00,0x89,0x00,0xB2,0x00,0x2F,0x00,0x3D,0x00,0xB0,0x00,0x9E,
-  0x00,0x93,0x00,0x87,0x00,0xA0,0x00,0xD7,0x00,0x00,0x00,0x00,0x00,0x8B,0x00,0xC9,
-  0x00,0xD3,0x00,0xD7,0x00,0xD3,0x00,0xD7,0x00,0x3B,0x00,0x3B,0x00,0x17,0x00,0x2B,
-  0x00,0x87,0x00,0xA0,0x00,0x87,0x00,0xA0,0x00,0x6A,0x00,0x7F,0x00,0x54,0x00,0x73,
-  0x00,0x81,0x00,0xAC,0x00,0x66,0x00,0x79,0x00,0x21,0x00,0x52,0x00,0x21,0x00,0x52,
-  0x00,0x35,0x00,0x60,0x00,0x17,0x00,0x14,0x00,0x87,0x00,0x98,0x00,0x87,0x00,0x98,
-  0x00,0x87,0x00,0xA8,0xFF,0xF8,0xFF,0xD5,0xFF,0xF8,0xFF,0xD5,0x00,0xE1,0x00,0x00,
-  0x00,0x00,0x00,0x87,0x00,0xD7,0x00,0x04,0x00,0x1F,0x00,0x87,0x00,0xA0,0x00,0x87,
-  0x00,0xA0,0x00,0x87,0x00,0x98,0x00,0x71,0x00,0x73,0x00,0xE1,0x00,0x21,0x00,0x87,
-  0x00,0x21,0x00,0x87,0x00,0x00,0x00,0x2D,0x00,0xD9,0x00,0x85,0x00,0x54,0x00,0x85,
-  0x00,0x54,0x00,0x85,0x00,0x00,0x00,0x00,0x00,0x8B,0x00,0xC9,0x00,0x9E,0x00,0xAA,
-  0x00,0x89,0x00,0xA0,0x00,0x89,0x00,0xA0,0x00,0x54,0x00,0x73,0x00,0x54,0x00,0x73,
-  0x00,0x54,0x00,0x73,0x00,0x44,0x00,0xB8,0x00,0x1B,0x00,0x52,0x00,0x1B,0x00,0x52,
-  0x00,0x1B,0x00,0x52,0x00,0x87,0x00,0x98,0x01,0x2B,0x01,0x23,0x00,0x60,0x00,0x71,
-  0x00,0x93,0x00,0x87,0x00,0x35,0x00,0x60,0x00,0x35,0x00,0x60,0x00,0x89,0x00,0x89,
-  0x00,0x31,0x00,0x31,0x00,0x23,0x00,0x2B,0x00,0x27,0x00,0x50,0x00,0x00,0x00,0x00,
-  0x00,0x79,0x00,0x7B,0x00,0x75,0x00,0x71,0x00,0x14,0x00,0x29,0x00,0xA6,0x00,0xC9,
-  0x00,0x04,0x00,0x1F,0x00,0x21,0x00,0x87,0x00,0x21,0x00,0x87,0x00,0x21,0x00,0x87,
-  0x00,0x21,0x00,0x55,0x00,0x21,0x00,0x87,0x00,0x21,0x00,0x87,0x00,0x21,0x00,0x87,
-  0x00,0x21,0x00,0x87,0x00,0x21,0x00,0x87,0x00,0x21,0x00,0x87,0x00,0x21,0x00,0x87,
-  0x00,0x21,0x00,0x87,0x00,0xD9,0x00,0x85,0x00,0xD9,0x00,0x85,0x00,0xD9,0x00,0x85,
-  0x00,0xD9,0x00,0x85,0x00,0x59,0x00,0x4C,0x00,0xD9,0x00,0x85,0x00,0xD9,0x00,0x85,
-  0x00,0xD9,0x00,0x85,0x00,0xE1,0x00,0xC5,0x00,0xE1,0x00,0xC5,0x00,0x54,0x00,0x73,
-  0x00,0x54,0x00,0x73,0x00,0x54,0x00,0x73,0x00,0x4A,0x00,0x4A,0x00,0x54,0x00,0x73,
-  0x00,0x54,0x00,0x73,0x00,0x54,0x00,0x73,0x00,0x54,0x00,0x73,0x00,0x54,0x00,0x73,
-  0x00,0x54,0x00,0x73,0x00,0x54,0x00,0x73,0x00,0x54,0x00,0x73,0x00,0x7D,0x00,0xA0,
-  0x00,0x7D,0x00,0xA0,0x00,0x7D,0x00,0xA0,0x00,0x7D,0x00,0xA0,0x00,0x7D,0x00,0xA0,
-  0x00,0x7D,0x00,0xA0,0x00,0x7D,0x00,0xA0,0x00,0x21,0x00,0x52,0x00,0x21,0x00,0x52,
-  0x00,0x21,0x00,0x52,0x00,0x89,0x00,0xCD,0x00,0xBC,0x00,0xBC,0x00,0xDD,0x01,0x23,
-  0x01,0x39,0x01,0x39,0x01,0x39,0x01,0x23,0x01,0xC7,0x01,0xB2,0x01,0xB2,0x00,0x66,
-  0x00,0x8B,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x1C,
-  0x00,0x01,0x00,0x00,0x00,0x00,0x06,0xF2,0x00,0x03,0x00,0x01,0x00,0x00,0x08,0xFC,
-  0x00,0x04,0x06,0xD6,0x00,0x00,0x00,0x86,0x00,0x80,0x00,0x06,0x00,0x06,0x00,0x7E,
-  0x01,0x7F,0x01,0x92,0x01,0xA1,0x01,0xB0,0x01,0xF0,0x01,0xFF,0x02,0x1B,0x02,0xBC,
-  0x02,0xC7,0x02,0xC9,0x02,0xDD,0x02,0xF3,0x03,0x01,0x03,0x03,0x03,0x09,0x03,0x0F,
-  0x03,0x23,0x03,0x8A,0x03,0x8C,0x03,0xA1,0x03,0xCE,0x03,0xD2,0x03,0xD6,0x04,0x86,
-  0x05,0x13,0x1E,0x01,0x1E,0x3F,0x1E,0x85,0x1E,0xF9,0x1F,0x4D,0x20,0x0B,0x20,0x15,
-  0x20,0x1E,0x20,0x22,0x20,0x26,0x20,0x30,0x20,0x33,0x20,0x3A,0x20,0x3C,0x20,0x44,
-  0x20,0x7F,0x20,0xA4,0x20,0xA7,0x20,0xAC,0x21,0x05,0x21,0x13,0x21,0x16,0x21,0x22,
-  0x21,0x26,0x21,0x2E,0x21,0x5E,0x22,0x02,0x22,0x06,0x22,0x0F,0x22,0x12,0x22,0x1A,
-  0x22,0x1E,0x22,0x2B,0x22,0x48,0x22,0x60,0x22,0x65,0x25,0xCA,0xFB,0x04,0xFE,0xFF,
-  0xFF,0xFD,0xFF,0xFF,0x00,0x00,0x00,0x20,0x00,0xA0,0x01,0x92,0x01,0xA0,0x01,0xAF,
-  0x01,0xF0,0x01,0xFA,0x02,0x18,0x02,0xBC,0x02,0xC6,0x02,0xC9,0x02,0xD8,0x02,0xF3,
-  0x03,0x00,0x03,0x03,0x03,0x09,0x03,0x0F,0x03,0x23,0x03,0x84,0x03,0x8C,0x03,0x8E,
-  0x03,0xA3,0x03,0xD1,0x03,0xD6,0x04,0x00,0x04,0x88,0x1E,0x00,0x1E,0x3E,0x1E,0x80,
-  0x1E,0xA0,0x1F,0x4D,0x20,0x00,0x20,0x13,0x20,0x17,0x20,0x20,0x20,0x26,0x20,0x30,
-  0x20,0x32,0x20,0x39,0x20,0x3C,0x20,0x44,0x20,0x7F,0x20,0xA3,0x20,0xA7,0x20,0xAB,
-  0x21,0x05,0x21,0x13,0x21,0x16,0x21,0x22,0x21,0x26,0x21,0x2E,0x21,0x5B,0x22,0x02,
-  0x22,0x06,0x22,0x0F,0x22,0x11,0x22,0x1A,0x22,0x1E,0x22,0x2B,0x22,0x48,0x22,0x60,
-  0x22,0x64,0x25,0xCA,0xFB,0x01,0xFE,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xE3,0x00,0x00,
-  0xFF,0xB0,0x00,0xBF,0x00,0xB2,0x00,0x61,0xFF,0x49,0x00,0x00,0xFF,0x96,0xFE,0x85,
-  0xFE,0x84,0xFE,0x76,0xFF,0x68,0xFF,0x63,0xFF,0x62,0xFF,0x5D,0x00,0x67,0xFF,0x44,
-  0xFD,0xD0,0xFD,0xCF,0xFD,0xCE,0xFD,0xCD,0xFE,0x82,0xFE,0x7F,0x00,0x00,0x00,0x00,
-  0xE4,0x58,0xE4,0x18,0xE3,0x7A,0x00,0x00,0xE3,0x0D,0xE2,0x42,0xE1,0xEF,0xE1,0xEE,
-  0xE1,0xED,0xE1,0xEA,0xE1,0xE1,0xE1,0xE0,0xE1,0xDB,0xE1,0xDA,0xE1,0xD3,0xE1,0x99,
-  0xE1,0x76,0xE1,0x74,0x00,0x00,0xE1,0x18,0xE1,0x0B,0xE1,0x09,0xE0,0xFE,0xE0,0xFB,
-  0xE0,0xF4,0xE0,0xC8,0xE0,0x25,0xE0,0x22,0xE0,0x1A,0xE0,0x19,0xE0,0x12,0xE0,0x0F,
-  0xE0,0x03,0xDF,0xE7,0xDF,0xD0,0xDF,0xCD,0xDC,0x69,0x00,0x00,0x03,0x4F,0x02,0x53,
-  0x00,0x01,0x00,0x00,0x00,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x02,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x02,0x1E,0x03,0x2A,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x3A,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xD0,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x04,0xAE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x00,0x63,0x00,0x64,0x00,0x65,
-  0x00,0x66,0x00,0x67,0x00,0x68,0x00,0x69,0x00,0x6A,0x00,0x6B,0x00,0x6C,0x00,0x6D,
-  0x00,0x6E,0x00,0x6F,0x00,0x70,0x00,0x71,0x00,0x72,0x00,0x73,0x00,0x74,0x00,0x75,
-  0x00,0x76,0x00,0x77,0x00,0x78,0x00,0x79,0x00,0x7A,0x00,0x7B,0x00,0x7C,0x00,0x7D,
-  0x00,0x7E,0x00,0x7F,0x00,0x80,0x00,0x81,0x00,0x82,0x00,0x83,0x00,0x84,0x00,0x85,
-  0x00,0x86,0x00,0x87,0x00,0x88,0x00,0x89,0x00,0x8A,0x00,0x8B,0x00,0x8C,0x00,0x8D,
-  0x00,0x8E,0x00,0x8F,0x00,0x90,0x00,0x91,0x00,0x92,0x00,0x93,0x00,0x94,0x00,0x95,
-  0x00,0x96,0x00,0x97,0x00,0x98,0x00,0x99,0x00,0x9A,0x00,0x9B,0x00,0x9C,0x00,0x9D,
-  0x00,0x9E,0x00,0x9F,0x00,0xA0,0x00,0xA1,0x00,0xA2,0x00,0xA3,0x00,0xA4,0x00,0xA5,
-  0x00,0xA6,0x00,0xA7,0x00,0xA8,0x00,0xA9,0x00,0xAA,0x00,0xAB,0x00,0xAC,0x00,0xAD,
-  0x00,0xAE,0x00,0xAF,0x00,0xB0,0x00,0xB1,0x00,0xB2,0x00,0xB3,0x00,0xB4,0x00,0xB5,
-  0x00,0xB6,0x00,0xB7,0x00,0xB8,0x00,0xB9,0x00,0xBA,0x00,0xBB,0x00,0xBC,0x00,0xBD,
-  0x00,0xBE,0x00,0xBF,0x00,0xC0,0x00,0xC1,0x00,0xC2,0x00,0xC3,0x00,0xC4,0x00,0xC5,
-  0x00,0xC6,0x00,0xC7,0x00,0xC8,0x00,0xC9,0x00,0xCA,0x00,0xCB,0x00,0xCC,0x00,0xCD,
-  0x00,0xCE,0x00,0xCF,0x00,0xD0,0x00,0xD1,0x00,0xD2,0x00,0xD3,0x00,0xD4,0x00,0xD5,
-  0x00,0xD6,0x00,0xD7,0x00,0xD8,0x00,0xD9,0x00,0xDA,0x00,0xDB,0x00,0xDC,0x00,0xDD,
-  0x00,0xDE,0x00,0xDF,0x00,0xE0,0x00,0xE1,0x00,0xE2,0x00,0xE3,0x00,0xE4,0x00,0xE5,
-  0x00,0xE6,0x00,0xE7,0x00,0xE8,0x00,0xE9,0x00,0xEA,0x00,0xEB,0x00,0xEC,0x00,0xED,
-  0x00,0xEE,0x00,0xEF,0x00,0xF0,0x00,0xF1,0x00,0xF2,0x00,0xF3,0x00,0xF4,0x00,0xF5,
-  0x00,0xF6,0x00,0xF7,0x00,0xF8,0x00,0xF9,0x00,0xFA,0x00,0xFB,0x00,0xFC,0x00,0xFD,
-  0x00,0xFE,0x00,0xFF,0x01,0x00,0x01,0x01,0x01,0x02,0x01,0x03,0x01,0x04,0x01,0x05,
-  0x01,0x06,0x01,0x07,0x01,0x08,0x01,0x09,0x01,0x0A,0x01,0x0B,0x01,0x0C,0x01,0x0D,
-  0x01,0x0E,0x01,0x0F,0x01,0x10,0x01,0x11,0x01,0x12,0x01,0x13,0x01,0x14,0x01,0x15,
-  0x01,0x16,0x01,0x17,0x01,0x18,0x01,0x19,0x01,0x1A,0x01,0x1B,0x01,0x1C,0x01,0x1D,
-  0x01,0x1E,0x01,0x1F,0x01,0x20,0x01,0x21,0x01,0x22,0x01,0x23,0x03,0x82,0x03,0x83,
-  0x01,0x26,0x01,0x27,0x01,0x28,0x01,0x29,0x01,0x2A,0x01,0x2B,0x01,0x2C,0x01,0x2D,
-  0x01,0x2E,0x01,0x2F,0x01,0x30,0x01,0x31,0x01,0x32,0x01,0x33,0x01,0x34,0x01,0x35,
-  0x01,0x36,0x01,0x37,0x01,0x38,0x01,0x39,0x01,0x3A,0x01,0x3B,0x01,0x3C,0x01,0x3D,
-  0x01,0x3E,0x01,0x3F,0x01,0x40,0x01,0x41,0x01,0x49,0x01,0x4A,0x01,0x24,0x01,0x25,
-  0x02,0x68,0x01,0x9C,0x01,0x9D,0x01,0x9E,0x01,0x9F,0x01,0xA0,0x01,0xA1,0x01,0xA2,
-  0x01,0xA3,0x01,0xA4,0x01,0xA5,0x01,0xA6,0x01,0xA7,0x02,0x69,0x01,0xA8,0x01,0xA9,
-  0x01,0xAA,0x01,0xAB,0x01,0xAC,0x01,0xAD,0x01,0xAE,0x01,0xAF,0x01,0xB0,0x01,0xB1,
-  0x01,0xB2,0x01,0xB3,0x01,0xB4,0x01,0xB5,0x01,0xB6,0x01,0xB7,0x01,0xB8,0x01,0xB9,
-  0x01,0xBA,0x01,0xBB,0x01,0xBC,0x01,0xBD,0x01,0xBE,0x01,0xBF,0x01,0xC0,0x01,0xC1,
-  0x01,0xC2,0x01,0xC3,0x01,0xC4,0x01,0xC5,0x01,0xC6,0x01,0xC7,0x01,0xC8,0x01,0xC9,
-  0x01,0xCA,0x01,0xCB,0x01,0xCC,0x01,0xCD,0x01,0xCE,0x01,0xCF,0x01,0xD0,0x01,0xD1,
-  0x01,0xD2,0x01,0xD3,0x01,0xD4,0x01,0xD5,0x01,0xD6,0x01,0xD7,0x01,0xD8,0x01,0xD9,
-  0x01,0xDA,0x01,0xDB,0x01,0xDC,0x01,0xDD,0x01,0xDE,0x01,0xDF,0x01,0xE0,0x01,0xE1,
-  0x01,0xE2,0x01,0xE3,0x01,0xE4,0x01,0xE5,0x01,0xE6,0x01,0xE7,0x01,0xE8,0x01,0xE9,
-  0x02,0x6A,0x01,0xEA,0x01,0xEB,0x01,0xEC,0x01,0xED,0x01,0xEE,0x01,0xEF,0x01,0xF0,
-  0x01,0xF1,0x01,0xF2,0x01,0xF3,0x01,0xF4,0x01,0xF5,0x02,0x6B,0x01,0xF6,0x01,0xF7,
-  0x02,0x6C,0x02,0x6D,0x02,0x6E,0x02,0x6F,0x02,0x70,0x02,0x71,0x02,0x72,0x02,0x73,
-  0x02,0x74,0x02,0x75,0x02,0x76,0x02,0x77,0x02,0x78,0x02,0x79,0x02,0x7A,0x02,0x7B,
-  0x02,0x7C,0x02,0x7D,0x02,0x7E,0x02,0x7F,0x02,0x80,0x02,0x81,0x02,0x82,0x02,0x83,
-  0x02,0x84,0x02,0x85,0x02,0x86,0x02,0x87,0x02,0x88,0x02,0x89,0x02,0x8A,0x02,0x8B,
-  0x02,0x8C,0x02,0x8D,0x02,0x8E,0x02,0x8F,0x02,0x90,0x02,0x91,0x02,0x92,0x02,0x93,
-  0x02,0x94,0x02,0x95,0x02,0x96,0x02,0x97,0x02,0x98,0x02,0x99,0x02,0x9A,0x01,0xF8,
-  0x01,0xF9,0x02,0x9B,0x02,0x9C,0x02,0x9D,0x02,0x9E,0x02,0x9F,0x02,0xA0,0x02,0xA1,
-  0x02,0xA2,0x02,0xA3,0x02,0xA4,0x02,0xA5,0x02,0xA6,0x02,0xA7,0x02,0xA8,0x02,0xA9,
-  0x02,0xAA,0x02,0xAB,0x02,0xAC,0x02,0xAD,0x02,0xAE,0x02,0xAF,0x02,0xB0,0x02,0xB1,
-  0x02,0xB2,0x02,0xB3,0x02,0xB4,0x02,0xB5,0x02,0xB6,0x02,0xB7,0x02,0xB8,0x02,0xB9,
-  0x02,0xBA,0x02,0xBB,0x02,0xBC,0x02,0xBD,0x02,0xBE,0x02,0xBF,0x02,0xC0,0x02,0xC1,
-  0x02,0xC2,0x02,0xC3,0x02,0xC4,0x02,0xC5,0x02,0xC6,0x02,0xC7,0x02,0xC8,0x02,0xC9,
-  0x02,0xCA,0x02,0xCB,0x02,0xCC,0x02,0xCD,0x02,0xCE,0x02,0xCF,0x02,0xD0,0x02,0xD1,
-  0x02,0xD2,0x02,0xD3,0x02,0xD4,0x02,0xD5,0x02,0xD6,0x02,0xD7,0x02,0xD8,0x02,0xD9,
-  0x02,0xDA,0x02,0xDB,0x02,0xDC,0x02,0xDD,0x02,0xDE,0x02,0xDF,0x02,0xE0,0x02,0xE1,
-  0x02,0xE2,0x02,0xE3,0x02,0xE4,0x02,0xE5,0x02,0xE6,0x02,0xE7,0x02,0xE8,0x02,0xE9,
-  0x02,0xEA,0x02,0xEB,0x02,0xEC,0x02,0xED,0x02,0xEE,0x02,0xEF,0x02,0xF0,0x02,0xF1,
-  0x02,0xF2,0x02,0xF3,0x02,0xF4,0x02,0xF5,0x02,0xF6,0x02,0xF7,0x02,0xF8,0x02,0xF9,
-  0x02,0xFA,0x02,0xFB,0x02,0xFC,0x02,0xFD,0x02,0xFE,0x02,0xFF,0x03,0x00,0x03,0x01,
-  0x03,0x02,0x03,0x03,0x03,0x04,0x03,0x05,0x03,0x06,0x03,0x07,0x03,0x08,0x03,0x09,
-  0x03,0x0A,0x03,0x0B,0x03,0x0C,0x03,0x0D,0x03,0x0E,0x03,0x0F,0x03,0x10,0x03,0x11,
-  0x03,0x12,0x03,0x13,0x03,0x14,0x03,0x15,0x03,0x16,0x03,0x17,0x03,0x18,0x03,0x19,
-  0x03,0x1A,0x03,0x1B,0x03,0x1C,0x03,0x1D,0x03,0x1E,0x03,0x1F,0x03,0x20,0x03,0x21,
-  0x03,0x22,0x03,0x23,0x03,0x24,0x03,0x25,0x03,0x26,0x03,0x27,0x03,0x28,0x03,0x29,
-  0x03,0x2A,0x03,0x2B,0x03,0x2C,0x03,0x2D,0x03,0x2E,0x03,0x2F,0x03,0x30,0x03,0x31,
-  0x03,0x32,0x03,0x33,0x03,0x34,0x03,0x35,0x03,0x36,0x03,0x37,0x03,0x38,0x03,0x39,
-  0x03,0x3A,0x03,0x3B,0x03,0x3C,0x03,0x3D,0x03,0x3E,0x03,0x3F,0x03,0x40,0x03,0x41,
-  0x03,0x42,0x03,0x43,0x03,0x44,0x03,0x45,0x03,0x46,0x03,0x47,0x03,0x48,0x03,0x49,
-  0x03,0x4A,0x03,0x4B,0x03,0x4C,0x03,0x4D,0x03,0x4E,0x03,0x4F,0x03,0x50,0x03,0x51,
-  0x03,0x52,0x03,0x53,0x03,0x54,0x03,0x55,0x03,0x56,0x03,0x57,0x03,0x58,0x03,0x59,
-  0x03,0x5A,0x03,0x5B,0x03,0x5C,0x03,0x5D,0x03,0x5E,0x03,0x5F,0x03,0x60,0x03,0x61,
-  0x03,0x62,0x03,0x63,0x03,0x64,0x03,0x65,0x03,0x66,0x03,0x67,0x03,0x68,0x03,0x69,
-  0x03,0x6A,0x03,0x6B,0x03,0x6C,0x03,0x6D,0x03,0x6E,0x02,0x00,0x02,0x01,0x03,0x6F,
-  0x03,0x70,0x03,0x71,0x03,0x72,0x03,0x73,0x03,0x74,0x03,0x75,0x02,0x1C,0x02,0x34,
-  0x02,0x35,0x02,0x5D,0x02,0x5E,0x00,0x06,0x02,0x0A,0x00,0x00,0x00,0x00,0x01,0x00,
-  0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
-  0x00,0x03,0x00,0x04,0x00,0x05,0x00,0x06,0x00,0x07,0x00,0x08,0x00,0x09,0x00,0x0A,
-  0x00,0x0B,0x00,0x0C,0x00,0x0D,0x00,0x0E,0x00,0x0F,0x00,0x10,0x00,0x11,0x00,0x12,
-  0x00,0x13,0x00,0x14,0x00,0x15,0x00,0x16,0x00,0x17,0x00,0x18,0x00,0x19,0x00,0x1A,
-  0x00,0x1B,0x00,0x1C,0x00,0x1D,0x00,0x1E,0x00,0x1F,0x00,0x20,0x00,0x21,0x00,0x22,
-  0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x27,0x00,0x28,0x00,0x29,0x00,0x2A,
-  0x00,0x2B,0x00,0x2C,0x00,0x2D,0x00,0x2E,0x00,0x2F,0x00,0x30,0x00,0x31,0x00,0x32,
-  0x00,0x33,0x00,0x34,0x00,0x35,0x00,0x36,0x00,0x37,0x00,0x38,0x00,0x39,0x00,0x3A,
-  0x00,0x3B,0x00,0x3C,0x00,0x3D,0x00,0x3E,0x00,0x3F,0x00,0x40,0x00,0x41,0x00,0x42,
-  0x00,0x43,0x00,0x44,0x00,0x45,0x00,0x46,0x00,0x47,0x00,0x48,0x00,0x49,0x00,0x4A,
-  0x00,0x4B,0x00,0x4C,0x00,0x4D,0x00,0x4E,0x00,0x4F,0x00,0x50,0x00,0x51,0x00,0x52,
-  0x00,0x53,0x00,0x54,0x00,0x55,0x00,0x56,0x00,0x57,0x00,0x58,0x00,0x59,0x00,0x5A,
-  0x00,0x5B,0x00,0x5C,0x00,0x5D,0x00,0x5E,0x00,0x5F,0x00,0x60,0x00,0x61,0x00,0x00,
-  0x00,0x86,0x00,0x87,0x00,0x89,0x00,0x8B,0x00,0x93,0x00,0x98,0x00,0x9E,0x00,0xA3,
-  0x00,0xA2,0x00,0xA4,0x00,0xA6,0x00,0xA5,0x00,0xA7,0x00,0xA9,0x00,0xAB,0x00,0xAA,
-  0x00,0xAC,0x00,0xAD,0x00,0xAF,0x00,0xAE,0x00,0xB0,0x00,0xB1,0x00,0xB3,0x00,0xB5,
-  0x00,0xB4,0x00,0xB6,0x00,0xB8,0x00,0xB7,0x00,0xBC,0x00,0xBB,0x00,0xBD,0x00,0xBE,
-  0x02,0x0D,0x00,0x72,0x00,0x64,0x00,0x65,0x00,0x69,0x02,0x0F,0x00,0x78,0x00,0xA1,
-  0x00,0x70,0x00,0x6B,0x02,0x20,0x00,0x76,0x00,0x6A,0x02,0x30,0x00,0x88,0x00,0x9A,
-  0x02,0x2D,0x00,0x73,0x02,0x31,0x02,0x32,0x00,0x67,0x00,0x77,0x02,0x27,0x02,0x2A,
-  0x02,0x29,0x01,0x8D,0x02,0x2E,0x00,0x6C,0x00,0x7C,0x02,0x21,0x00,0xA8,0x00,0xBA,
-  0x00,0x81,0x00,0x63,0x00,0x6E,0x02,0x2C,0x01,0x42,0x02,0x2F,0x02,0x28,0x00,0x6D,
-  0x00,0x7D,0x02,0x10,0x00,0x03,0x00,0x82,0x00,0x85,0x00,0x97,0x01,0x14,0x01,0x15,
-  0x02,0x02,0x02,0x03,0x02,0x0A,0x02,0x0B,0x02,0x06,0x02,0x07,0x00,0xB9,0x02,0x33,
-  0x00,0xC1,0x01,0x3A,0x02,0x17,0x00,0x66,0x02,0x14,0x02,0x15,0x02,0x34,0x02,0x35,
-  0x02,0x0E,0x00,0x79,0x02,0x08,0x02,0x0C,0x02,0x11,0x00,0x84,0x00,0x8C,0x00,0x83,
-  0x00,0x8D,0x00,0x8A,0x00,0x8F,0x00,0x90,0x00,0x91,0x00,0x8E,0x00,0x95,0x00,0x96,
-  0x00,0x00,0x00,0x94,0x00,0x9C,0x00,0x9D,0x00,0x9B,0x00,0xF3,0x01,0x4B,0x01,0x52,
-  0x00,0x71,0x01,0x4E,0x01,0x4F,0x01,0x50,0x00,0x7A,0x01,0x53,0x01,0x51,0x01,0x4C,
-  0x00,0x04,0x06,0xD6,0x00,0x00,0x00,0x86,0x00,0x80,0x00,0x06,0x00,0x06,0x00,0x7E,
-  0x01,0x7F,0x01,0x92,0x01,0xA1,0x01,0xB0,0x01,0xF0,0x01,0xFF,0x02,0x1B,0x02,0xBC,
-  0x02,0xC7,0x02,0xC9,0x02,0xDD,0x02,0xF3,0x03,0x01,0x03,0x03,0x03,0x09,0x03,0x0F,
-  0x03,0x23,0x03,0x8A,0x03,0x8C,0x03,0xA1,0x03,0xCE,0x03,0xD2,0x03,0xD6,0x04,0x86,
-  0x05,0x13,0x1E,0x01,0x1E,0x3F,0x1E,0x85,0x1E,0xF9,0x1F,0x4D,0x20,0x0B,0x20,0x15,
-  0x20,0x1E,0x20,0x22,0x20,0x26,0x20,0x30,0x20,0x33,0x20,0x3A,0x20,0x3C,0x20,0x44,
-  0x20,0x7F,0x20,0xA4,0x20,0xA7,0x20,0xAC,0x21,0x05,0x21,0x13,0x21,0x16,0x21,0x22,
-  0x21,0x26,0x21,0x2E,0x21,0x5E,0x22,0x02,0x22,0x06,0x22,0x0F,0x22,0x12,0x22,0x1A,
-  0x22,0x1E,0x22,0x2B,0x22,0x48,0x22,0x60,0x22,0x65,0x25,0xCA,0xFB,0x04,0xFE,0xFF,
-  0xFF,0xFD,0xFF,0xFF,0x00,0x00,0x00,0x20,0x00,0xA0,0x01,0x92,0x01,0xA0,0x01,0xAF,
-  0x01,0xF0,0x01,0xFA,0x02,0x18,0x02,0xBC,0x02,0xC6,0x02,0xC9,0x02,0xD8,0x02,0xF3,
-  0x03,0x00,0x03,0x03,0x03,0x09,0x03,0x0F,0x03,0x23,0x03,0x84,0x03,0x8C,0x03,0x8E,
-  0x03,0xA3,0x03,0xD1,0x03,0xD6,0x04,0x00,0x04,0x88,0x1E,0x00,0x1E,0x3E,0x1E,0x80,
-  0x1E,0xA0,0x1F,0x4D,0x20,0x00,0x20,0x13,0x20,0x17,0x20,0x20,0x20,0x26,0x20,0x30,
-  0x20,0x32,0x20,0x39,0x20,0x3C,0x20,0x44,0x20,0x7F,0x20,0xA3,0x20,0xA7,0x20,0xAB,
-  0x21,0x05,0x21,0x13,0x21,0x16,0x21,0x22,0x21,0x26,0x21,0x2E,0x21,0x5B,0x22,0x02,
-  0x22,0x06,0x22,0x0F,0x22,0x11,0x22,0x1A,0x22,0x1E,0x22,0x2B,0x22,0x48,0x22,0x60,
-  0x22,0x64,0x25,0xCA,0xFB,0x01,0xFE,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xE3,0x00,0x00,
-  0xFF,0xB0,0x00,0xBF,0x00,0xB2,0x00,0x61,0xFF,0x49,0x00,0x00,0xFF,0x96,0xFE,0x85,
-  0xFE,0x84,0xFE,0x76,0xFF,0x68,0xFF,0x63,0xFF,0x62,0xFF,0x5D,0x00,0x67,0xFF,0x44,
-  0xFD,0xD0,0xFD,0xCF,0xFD,0xCE,0xFD,0xCD,0xFE,0x82,0xFE,0x7F,0x00,0x00,0x00,0x00,
-  0xE4,0x58,0xE4,0x18,0xE3,0x7A,0x00,0x00,0xE3,0x0D,0xE2,0x42,0xE1,0xEF,0xE1,0xEE,
-  0xE1,0xED,0xE1,0xEA,0xE1,0xE1,0xE1,0xE0,0xE1,0xDB,0xE1,0xDA,0xE1,0xD3,0xE1,0x99,
-  0xE1,0x76,0xE1,0x74,0x00,0x00,0xE1,0x18,0xE1,0x0B,0xE1,0x09,0xE0,0xFE,0xE0,0xFB,
-  0xE0,0xF4,0xE0,0xC8,0xE0,0x25,0xE0,0x22,0xE0,0x1A,0xE0,0x19,0xE0,0x12,0xE0,0x0F,
-  0xE0,0x03,0xDF,0xE7,0xDF,0xD0,0xDF,0xCD,0xDC,0x69,0x00,0x00,0x03,0x4F,0x02,0x53,
-  0x00,0x01,0x00,0x00,0x00,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x02,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x02,0x1E,0x03,0x2A,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x3A,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xD0,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x04,0xAE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x00,0x63,0x00,0x64,0x00,0x65,
-  0x00,0x66,0x00,0x67,0x00,0x68,0x00,0x69,0x00,0x6A,0x00,0x6B,0x00,0x6C,0x00,0x6D,
-  0x00,0x6E,0x00,0x6F,0x00,0x70,0x00,0x71,0x00,0x72,0x00,0x73,0x00,0x74,0x00,0x75,
-  0x00,0x76,0x00,0x77,0x00,0x78,0x00,0x79,0x00,0x7A,0x00,0x7B,0x00,0x7C,0x00,0x7D,
-  0x00,0x7E,0x00,0x7F,0x00,0x80,0x00,0x81,0x00,0x82,0x00,0x83,0x00,0x84,0x00,0x85,
-  0x00,0x86,0x00,0x87,0x00,0x88,0x00,0x89,0x00,0x8A,0x00,0x8B,0x00,0x8C,0x00,0x8D,
-  0x00,0x8E,0x00,0x8F,0x00,0x90,0x00,0x91,0x00,0x92,0x00,0x93,0x00,0x94,0x00,0x95,
-  0x00,0x96,0x00,0x97,0x00,0x98,0x00,0x99,0x00,0x9A,0x00,0x9B,0x00,0x9C,0x00,0x9D,
-  0x00,0x9E,0x00,0x9F,0x00,0xA0,0x00,0xA1,0x00,0xA2,0x00,0xA3,0x00,0xA4,0x00,0xA5,
-  0x00,0xA6,0x00,0xA7,0x00,0xA8,0x00,0xA9,0x00,0xAA,0x00,0xAB,0x00,0xAC,0x00,0xAD,
-  0x00,0xAE,0x00,0xAF,0x00,0xB0,0x00,0xB1,0x00,0xB2,0x00,0xB3,0x00,0xB4,0x00,0xB5,
-  0x00,0xB6,0x00,0xB7,0x00,0xB8,0x00,0xB9,0x00,0xBA,0x00,0xBB,0x00,0xBC,0x00,0xBD,
-  0x00,0xBE,0x00,0xBF,0x00,0xC0,0x00,0xC1,0x00,0xC2,0x00,0xC3,0x00,0xC4,0x00,0xC5,
-  0x00,0xC6,0x00,0xC7,0x00,0xC8,0x00,0xC9,0x00,0xCA,0x00,0xCB,0x00,0xCC,0x00,0xCD,
-  0x00,0xCE,0x00,0xCF,0x00,0xD0,0x00,0xD1,0x00,0xD2,0x00,0xD3,0x00,0xD4,0x00,0xD5,
-  0x00,0xD6,0x00,0xD7,0x00,0xD8,0x00,0xD9,0x00,0xDA,0x00,0xDB,0x00,0xDC,0x00,0xDD,
-  0x00,0xDE,0x00,0xDF,0x00,0xE0,0x00,0xE1,0x00,0xE2,0x00,0xE3,0x00,0xE4,0x00,0xE5,
-  0x00,0xE6,0x00,0xE7,0x00,0xE8,0x00,0xE9,0x00,0xEA,0x00,0xEB,0x00,0xEC,0x00,0xED,
-  0x00,0xEE,0x00,0xEF,0x00,0xF0,0x00,0xF1,0x00,0xF2,0x00,0xF3,0x00,0xF4,0x00,0xF5,
-  0x00,0xF6,0x00,0xF7,0x00,0xF8,0x00,0xF9,0x00,0xFA,0x00,0xFB,0x00,0xFC,0x00,0xFD,
-  0x00,0xFE,0x00,0xFF,0x01,0x00,0x01,0x01,0x01,0x02,0x01,0x03,0x01,0x04,0x01,0x05,
-  0x01,0x06,0x01,0x07,0x01,0x08,0x01,0x09,0x01,0x0A,0x01,0x0B,0x01,0x0C,0x01,0x0D,
-  0x01,0x0E,0x01,0x0F,0x01,0x10,0x01,0x11,0x01,0x12,0x01,0x13,0x01,0x14,0x01,0x15,
-  0x01,0x16,0x01,0x17,0x01,0x18,0x01,0x19,0x01,0x1A,0x01,0x1B,0x01,0x1C,0x01,0x1D,
-  0x01,0x1E,0x01,0x1F,0x01,0x20,0x01,0x21,0x01,0x22,0x01,0x23,0x03,0x82,0x03,0x83,
-  0x01,0x26,0x01,0x27,0x01,0x28,0x01,0x29,0x01,0x2A,0x01,0x2B,0x01,0x2C,0x01,0x2D,
-  0x01,0x2E,0x01,0x2F,0x01,0x30,0x01,0x31,0x01,0x32,0x01,0x33,0x01,0x34,0x01,0x35,
-  0x01,0x36,0x01,0x37,0x01,0x38,0x01,0x39,0x01,0x3A,0x01,0x3B,0x01,0x3C,0x01,0x3D,
-  0x01,0x3E,0x01,0x3F,0x01,0x40,0x01,0x41,0x01,0x49,0x01,0x4A,0x01,0x24,0x01,0x25,
-  0x02,0x68,0x01,0x9C,0x01,0x9D,0x01,0x9E,0x01,0x9F,0x01,0xA0,0x01,0xA1,0x01,0xA2,
-  0x01,0xA3,0x01,0xA4,0x01,0xA5,0x01,0xA6,0x01,0xA7,0x02,0x69,0x01,0xA8,0x01,0xA9,
-  0x01,0xAA,0x01,0xAB,0x01,0xAC,0x01,0xAD,0x01,0xAE,0x01,0xAF,0x01,0xB0,0x01,0xB1,
-  0x01,0xB2,0x01,0xB3,0x01,0xB4,0x01,0xB5,0x01,0xB6,0x01,0xB7,0x01,0xB8,0x01,0xB9,
-  0x01,0xBA,0x01,0xBB,0x01,0xBC,0x01,0xBD,0x01,0xBE,0x01,0xBF,0x01,0xC0,0x01,0xC1,
-  0x01,0xC2,0x01,0xC3,0x01,0xC4,0x01,0xC5,0x01,0xC6,0x01,0xC7,0x01,0xC8,0x01,0xC9,
-  0x01,0xCA,0x01,0xCB,0x01,0xCC,0x01,0xCD,0x01,0xCE,0x01,0xCF,0x01,0xD0,0x01,0xD1,
-  0x01,0xD2,0x01,0xD3,0x01,0xD4,0x01,0xD5,0x01,0xD6,0x01,0xD7,0x01,0xD8,0x01,0xD9,
-  0x01,0xDA,0x01,0xDB,0x01,0xDC,0x01,0xDD,0x01,0xDE,0x01,0xDF,0x01,0xE0,0x01,0xE1,
-  0x01,0xE2,0x01,0xE3,0x01,0xE4,0x01,0xE5,0x01,0xE6,0x01,0xE7,0x01,0xE8,0x01,0xE9,
-  0x02,0x6A,0x01,0xEA,0x01,0xEB,0x01,0xEC,0x01,0xED,0x01,0xEE,0x01,0xEF,0x01,0xF0,
-  0x01,0xF1,0x01,0xF2,0x01,0xF3,0x01,0xF4,0x01,0xF5,0x02,0x6B,0x01,0xF6,0x01,0xF7,
-  0x02,0x6C,0x02,0x6D,0x02,0x6E,0x02,0x6F,0x02,0x70,0x02,0x71,0x02,0x72,0x02,0x73,
-  0x02,0x74,0x02,0x75,0x02,0x76,0x02,0x77,0x02,0x78,0x02,0x79,0x02,0x7A,0x02,0x7B,
-  0x02,0x7C,0x02,0x7D,0x02,0x7E,0x02,0x7F,0x02,0x80,0x02,0x81,0x02,0x82,0x02,0x83,
-  0x02,0x84,0x02,0x85,0x02,0x86,0x02,0x87,0x02,0x88,0x02,0x89,0x02,0x8A,0x02,0x8B,
-  0x02,0x8C,0x02,0x8D,0x02,0x8E,0x02,0x8F,0x02,0x90,0x02,0x91,0x02,0x92,0x02,0x93,
-  0x02,0x94,0x02,0x95,0x02,0x96,0x02,0x97,0x02,0x98,0x02,0x99,0x02,0x9A,0x01,0xF8,
-  0x01,0xF9,0x02,0x9B,0x02,0x9C,0x02,0x9D,0x02,0x9E,0x02,0x9F,0x02,0xA0,0x02,0xA1,
-  0x02,0xA2,0x02,0xA3,0x02,0xA4,0x02,0xA5,0x02,0xA6,0x02,0xA7,0x02,0xA8,0x02,0xA9,
-  0x02,0xAA,0x02,0xAB,0x02,0xAC,0x02,0xAD,0x02,0xAE,0x02,0xAF,0x02,0xB0,0x02,0xB1,
-  0x02,0xB2,0x02,0xB3,0x02,0xB4,0x02,0xB5,0x02,0xB6,0x02,0xB7,0x02,0xB8,0x02,0xB9,
-  0x02,0xBA,0x02,0xBB,0x02,0xBC,0x02,0xBD,0x02,0xBE,0x02,0xBF,0x02,0xC0,0x02,0xC1,
-  0x02,0xC2,0x02,0xC3,0x02,0xC4,0x02,0xC5,0x02,0xC6,0x02,0xC7,0x02,0xC8,0x02,0xC9,
-  0x02,0xCA,0x02,0xCB,0x02,0xCC,0x02,0xCD,0x02,0xCE,0x02,0xCF,0x02,0xD0,0x02,0xD1,
-  0x02,0xD2,0x02,0xD3,0x02,0xD4,0x02,0xD5,0x02,0xD6,0x02,0xD7,0x02,0xD8,0x02,0xD9,
-  0x02,0xDA,0x02,0xDB,0x02,0xDC,0x02,0xDD,0x02,0xDE,0x02,0xDF,0x02,0xE0,0x02,0xE1,
-  0x02,0xE2,0x02,0xE3,0x02,0xE4,0x02,0xE5,0x02,0xE6,0x02,0xE7,0x02,0xE8,0x02,0xE9,
-  0x02,0xEA,0x02,0xEB,0x02,0xEC,0x02,0xED,0x02,0xEE,0x02,0xEF,0x02,0xF0,0x02,0xF1,
-  0x02,0xF2,0x02,0xF3,0x02,0xF4,0x02,0xF5,0x02,0xF6,0x02,0xF7,0x02,0xF8,0x02,0xF9,
-  0x02,0xFA,0x02,0xFB,0x02,0xFC,0x02,0xFD,0x02,0xFE,0x02,0xFF,0x03,0x00,0x03,0x01,
-  0x03,0x02,0x03,0x03,0x03,0x04,0x03,0x05,0x03,0x06,0x03,0x07,0x03,0x08,0x03,0x09,
-  0x03,0x0A,0x03,0x0B,0x03,0x0C,0x03,0x0D,0x03,0x0E,0x03,0x0F,0x03,0x10,0x03,0x11,
-  0x03,0x12,0x03,0x13,0x03,0x14,0x03,0x15,0x03,0x16,0x03,0x17,0x03,0x18,0x03,0x19,
-  0x03,0x1A,0x03,0x1B,0x03,0x1C,0x03,0x1D,0x03,0x1E,0x03,0x1F,0x03,0x20,0x03,0x21,
-  0x03,0x22,0x03,0x23,0x03,0x24,0x03,0x25,0x03,0x26,0x03,0x27,0x03,0x28,0x03,0x29,
-  0x03,0x2A,0x03,0x2B,0x03,0x2C,0x03,0x2D,0x03,0x2E,0x03,0x2F,0x03,0x30,0x03,0x31,
-  0x03,0x32,0x03,0x33,0x03,0x34,0x03,0x35,0x03,0x36,0x03,0x37,0x03,0x38,0x03,0x39,
-  0x03,0x3A,0x03,0x3B,0x03,0x3C,0x03,0x3D,0x03,0x3E,0x03,0x3F,0x03,0x40,0x03,0x41,
-  0x03,0x42,0x03,0x43,0x03,0x44,0x03,0x45,0x03,0x46,0x03,0x47,0x03,0x48,0x03,0x49,
-  0x03,0x4A,0x03,0x4B,0x03,0x4C,0x03,0x4D,0x03,0x4E,0x03,0x4F,0x03,0x50,0x03,0x51,
-  0x03,0x52,0x03,0x53,0x03,0x54,0x03,0x55,0x03,0x56,0x03,0x57,0x03,0x58,0x03,0x59,
-  0x03,0x5A,0x03,0x5B,0x03,0x5C,0x03,0x5D,0x03,0x5E,0x03,0x5F,0x03,0x60,0x03,0x61,
-  0x03,0x62,0x03,0x63,0x03,0x64,0x03,0x65,0x03,0x66,0x03,0x67,0x03,0x68,0x03,0x69,
-  0x03,0x6A,0x03,0x6B,0x03,0x6C,0x03,0x6D,0x03,0x6E,0x02,0x00,0x02,0x01,0x03,0x6F,
-  0x03,0x70,0x03,0x71,0x03,0x72,0x03,0x73,0x03,0x74,0x03,0x75,0x02,0x1C,0x02,0x34,
-  0x02,0x35,0x02,0x5D,0x02,0x5E,0x00,0x00,0x40,0x45,0x59,0x58,0x55,0x54,0x53,0x52,
-  0x51,0x50,0x4F,0x4E,0x4D,0x4C,0x4B,0x4A,0x49,0x48,0x47,0x46,0x45,0x44,0x43,0x42,
-  0x41,0x40,0x3F,0x3E,0x3D,0x3C,0x3B,0x3A,0x39,0x38,0x37,0x36,0x35,0x31,0x30,0x2F,
-  0x2E,0x2D,0x2C,0x28,0x27,0x26,0x25,0x24,0x23,0x22,0x21,0x1F,0x18,0x14,0x11,0x10,
-  0x0F,0x0E,0x0D,0x0B,0x0A,0x09,0x08,0x07,0x06,0x05,0x04,0x03,0x02,0x01,0x00,0x2C,
-  0x45,0x23,0x46,0x60,0x20,0xB0,0x26,0x60,0xB0,0x04,0x26,0x23,0x48,0x48,0x2D,0x2C,
-  0x45,0x23,0x46,0x23,0x61,0x20,0xB0,0x26,0x61,0xB0,0x04,0x26,0x23,0x48,0x48,0x2D,
-  0x2C,0x45,0x23,0x46,0x60,0xB0,0x20,0x61,0x20,0xB0,0x46,0x60,0xB0,0x04,0x26,0x23,
-  0x48,0x48,0x2D,0x2C,0x45,0x23,0x46,0x23,0x61,0xB0,0x20,0x60,0x20,0xB0,0x26,0x61,
-  0xB0,0x20,0x61,0xB0,0x04,0x26,0x23,0x48,0x48,0x2D,0x2C,0x45,0x23,0x46,0x60,0xB0,
-  0x40,0x61,0x20,0xB0,0x66,0x60,0xB0,0x04,0x26,0x23,0x48,0x48,0x2D,0x2C,0x45,0x23,
-  0x46,0x23,0x61,0xB0,0x40,0x60,0x20,0xB0,0x26,0x61,0xB0,0x40,0x61,0xB0,0x04,0x26,
-  0x23,0x48,0x48,0x2D,0x2C,0x01,0x10,0x20,0x3C,0x00,0x3C,0x2D,0x2C,0x20,0x45,0x23,
-  0x20,0xB0,0xCD,0x44,0x23,0x20,0xB8,0x01,0x5A,0x51,0x58,0x23,0x20,0xB0,0x8D,0x44,
-  0x23,0x59,0x20,0xB0,0xED,0x51,0x58,0x23,0x20,0xB0,0x4D,0x44,0x23,0x59,0x20,0xB0,
-  0x04,0x26,0x51,0x58,0x23,0x20,0xB0,0x0D,0x44,0x23,0x59,0x21,0x21,0x2D,0x2C,0x20,
-  0x20,0x45,0x18,0x68,0x44,0x20,0xB0,0x01,0x60,0x20,0x45,0xB0,0x46,0x76,0x68,0x8A,
-  0x45,0x60,0x44,0x2D,0x2C,0x01,0xB1,0x0B,0x0A,0x43,0x23,0x43,0x65,0x0A,0x2D,0x2C,
-  0x00,0xB1,0x0A,0x0B,0x43,0x23,0x43,0x0B,0x2D,0x2C,0x00,0xB0,0x28,0x23,0x70,0xB1,
-  0x01,0x28,0x3E,0x01,0xB0,0x28,0x23,0x70,0xB1,0x02,0x28,0x45,0x3A,0xB1,0x02,0x00,
-  0x08,0x0D,0x2D,0x2C,0x20,0x45,0xB0,0x03,0x25,0x45,0x61,0x64,0xB0,0x50,0x51,0x58,
-  0x45,0x44,0x1B,0x21,0x21,0x59,0x2D,0x2C,0x49,0xB0,0x0E,0x23,0x44,0x2D,0x2C,0x20,
-  0x45,0xB0,0x00,0x43,0x60,0x44,0x2D,0x2C,0x01,0xB0,0x06,0x43,0xB0,0x07,0x43,0x65,
-  0x0A,0x2D,0x2C,0x20,0x69,0xB0,0x40,0x61,0xB0,0x00,0x8B,0x20,0xB1,0x2C,0xC0,0x8A,
-  0x8C,0xB8,0x10,0x00,0x62,0x60,0x2B,0x0C,0x64,0x23,0x64,0x61,0x5C,0x58,0xB0,0x03,
-  0x61,0x59,0x2D,0x2C,0x8A,0x03,0x45,0x8A,0x8A,0x87,0xB0,0x11,0x2B,0xB0,0x29,0x23,
-  0x44,0xB0,0x29,0x7A,0xE4,0x18,0x2D,0x2C,0x45,0x65,0xB0,0x2C,0x23,0x44,0x45,0xB0,
-  0x2B,0x23,0x44,0x2D,0x2C,0x4B,0x52,0x58,0x45,0x44,0x1B,0x21,0x21,0x59,0x2D,0x2C,
-  0x4B,0x51,0x58,0x45,0x44,0x1B,0x21,0x21,0x59,0x2D,0x2C,0x01,0xB0,0x05,0x25,0x10,
-  0x23,0x20,0x8A,0xF5,0x00,0xB0,0x01,0x60,0x23,0xED,0xEC,0x2D,0x2C,0x01,0xB0,0x05,
-  0x25,0x10,0x23,0x20,0x8A,0xF5,0x00,0xB0,0x01,0x61,0x23,0xED,0xEC,0x2D,0x2C,0x01,
-  0xB0,0x06,0x25,0x10,0xF5,0x00,0xED,0xEC,0x2D,0x2C,0x46,0x23,0x46,0x60,0x8A,0x8A,
-  0x46,0x23,0x20,0x46,0x8A,0x60,0x8A,0x61,0xB8,0xFF,0x80,0x62,0x23,0x20,0x10,0x23,
-  0x8A,0xB1,0x0C,0x0C,0x8A,0x70,0x45,0x60,0x20,0xB0,0x00,0x50,0x58,0xB0,0x01,0x61,
-  0xB8,0xFF,0xBA,0x8B,0x1B,0xB0,0x46,0x8C,0x59,0xB0,0x10,0x60,0x68,0x01,0x3A,0x2D,
-  0x2C,0x20,0x45,0xB0,0x03,0x25,0x46,0x52,0x4B,0xB0,0x13,0x51,0x5B,0x58,0xB0,0x02,
-  0x25,0x46,0x20,0x68,0x61,0xB0,0x03,0x25,0xB0,0x03,0x25,0x3F,0x23,0x21,0x38,0x1B,
-  0x21,0x11,0x59,0x2D,0x2C,0x20,0x45,0xB0,0x03,0x25,0x46,0x50,0x58,0xB0,0x02,0x25,
-  0x46,0x20,0x68,0x61,0xB0,0x03,0x25,0xB0,0x03,0x25,0x3F,0x23,0x21,0x38,0x1B,0x21,
-  0x11,0x59,0x2D,0x2C,0x00,0xB0,0x07,0x43,0xB0,0x06,0x43,0x0B,0x2D,0x2C,0x21,0x21,
-  0x0C,0x64,0x23,0x64,0x8B,0xB8,0x40,0x00,0x62,0x2D,0x2C,0x21,0xB0,0x80,0x51,0x58,
-  0x0C,0x64,0x23,0x64,0x8B,0xB8,0x20,0x00,0x62,0x1B,0xB2,0x00,0x40,0x2F,0x2B,0x59,
-  0xB0,0x02,0x60,0x2D,0x2C,0x21,0xB0,0xC0,0x51,0x58,0x0C,0x64,0x23,0x64,0x8B,0xB8,
-  0x15,0x55,0x62,0x1B,0xB2,0x00,0x80,0x2F,0x2B,0x59,0xB0,0x02,0x60,0x2D,0x2C,0x0C,
-  0x64,0x23,0x64,0x8B,0xB8,0x40,0x00,0x62,0x60,0x23,0x21,0x2D,0x2C,0x4B,0x53,0x58,
-  0x8A,0xB0,0x04,0x25,0x49,0x64,0x23,0x45,0x69,0xB0,0x40,0x8B,0x61,0xB0,0x80,0x62,
-  0xB0,0x20,0x61,0x6A,0xB0,0x0E,0x23,0x44,0x23,0x10,0xB0,0x0E,0xF6,0x1B,0x21,0x23,
-  0x8A,0x12,0x11,0x20,0x39,0x2F,0x59,0x2D,0x2C,0x4B,0x53,0x58,0x20,0xB0,0x03,0x25,
-  0x49,0x64,0x69,0x20,0xB0,0x05,0x26,0xB0,0x06,0x25,0x49,0x64,0x23,0x61,0xB0,0x80,
-  0x62,0xB0,0x20,0x61,0x6A,0xB0,0x0E,0x23,0x44,0xB0,0x04,0x26,0x10,0xB0,0x0E,0xF6,
-  0x8A,0x10,0xB0,0x0E,0x23,0x44,0xB0,0x0E,0xF6,0xB0,0x0E,0x23,0x44,0xB0,0x0E,0xED,
-  0x1B,0x8A,0xB0,0x04,0x26,0x11,0x12,0x20,0x39,0x23,0x20,0x39,0x2F,0x2F,0x59,0x2D,
-  0x2C,0x45,0x23,0x45,0x60,0x23,0x45,0x60,0x23,0x45,0x60,0x23,0x76,0x68,0x18,0xB0,
-  0x80,0x62,0x20,0x2D,0x2C,0xB0,0x48,0x2B,0x2D,0x2C,0x20,0x45,0xB0,0x00,0x54,0x58,
-  0xB0,0x40,0x44,0x20,0x45,0xB0,0x40,0x61,0x44,0x1B,0x21,0x21,0x59,0x2D,0x2C,0x45,
-  0xB1,0x30,0x2F,0x45,0x23,0x45,0x61,0x60,0xB0,0x01,0x60,0x69,0x44,0x2D,0x2C,0x4B,
-  0x51,0x58,0xB0,0x2F,0x23,0x70,0xB0,0x14,0x23,0x42,0x1B,0x21,0x21,0x59,0x2D,0x2C,
-  0x4B,0x51,0x58,0x20,0xB0,0x03,0x25,0x45,0x69,0x53,0x58,0x44,0x1B,0x21,0x21,0x59,
-  0x1B,0x21,0x21,0x59,0x2D,0x2C,0x45,0xB0,0x14,0x43,0xB0,0x00,0x60,0x63,0xB0,0x01,
-  0x60,0x69,0x44,0x2D,0x2C,0xB0,0x2F,0x45,0x44,0x2D,0x2C,0x45,0x23,0x20,0x45,0x8A,
-  0x60,0x44,0x2D,0x2C,0x45,0x23,0x45,0x60,0x44,0x2D,0x2C,0x4B,0x23,0x51,0x58,0xB9,
-  0x00,0x33,0xFF,0xE0,0xB1,0x34,0x20,0x1B,0xB3,0x33,0x00,0x34,0x00,0x59,0x44,0x44,
-  0x2D,0x2C,0xB0,0x16,0x43,0x58,0xB0,0x03,0x26,0x45,0x8A,0x58,0x64,0x66,0xB0,0x1F,
-  0x60,0x1B,0x64,0xB0,0x20,0x60,0x66,0x20,0x58,0x1B,0x21,0xB0,0x40,0x59,0xB0,0x01,
-  0x61,0x59,0x23,0x58,0x65,0x59,0xB0,0x29,0x23,0x44,0x23,0x10,0xB0,0x29,0xE0,0x1B,
-  0x21,0x21,0x21,0x21,0x21,0x59,0x2D,0x2C,0xB0,0x02,0x43,0x54,0x58,0x4B,0x53,0x23,
-  0x4B,0x51,0x5A,0x58,0x38,0x1B,0x21,0x21,0x59,0x1B,0x21,0x21,0x21,0x21,0x59,0x2D,
-  0x2C,0xB0,0x16,0x43,0x58,0xB0,0x04,0x25,0x45,0x64,0xB0,0x20,0x60,0x66,0x20,0x58,
-  0x1B,0x21,0xB0,0x40,0x59,0xB0,0x01,0x61,0x23,0x58,0x1B,0x65,0x59,0xB0,0x29,0x23,
-  0x44,0xB0,0x05,0x25,0xB0,0x08,0x25,0x08,0x20,0x58,0x02,0x1B,0x03,0x59,0xB0,0x04,
-  0x25,0x10,0xB0,0x05,0x25,0x20,0x46,0xB0,0x04,0x25,0x23,0x42,0x3C,0xB0,0x04,0x25,
-  0xB0,0x07,0x25,0x08,0xB0,0x07,0x25,0x10,0xB0,0x06,0x25,0x20,0x46,0xB0,0x04,0x25,
-  0xB0,0x01,0x60,0x23,0x42,0x3C,0x20,0x58,0x01,0x1B,0x00,0x59,0xB0,0x04,0x25,0x10,
-  0xB0,0x05,0x25,0xB0,0x29,0xE0,0xB0,0x29,0x20,0x45,0x65,0x44,0xB0,0x07,0x25,0x10,
-  0xB0,0x06,0x25,0xB0,0x29,0xE0,0xB0,0x05,0x25,0xB0,0x08,0x25,0x08,0x20,0x58,0x02,
-  0x1B,0x03,0x59,0xB0,0x05,0x25,0xB0,0x03,0x25,0x43,0x48,0xB0,0x04,0x25,0xB0,0x07,
-  0x25,0x08,0xB0,0x06,0x25,0xB0,0x03,0x25,0xB0,0x01,0x60,0x43,0x48,0x1B,0x21,0x59,
-  0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x2D,0x2C,0x02,0xB0,0x04,0x25,0x20,0x20,0x46,
-  0xB0,0x04,0x25,0x23,0x42,0xB0,0x05,0x25,0x08,0xB0,0x03,0x25,0x45,0x48,0x21,0x21,
-  0x21,0x21,0x2D,0x2C,0x02,0xB0,0x03,0x25,0x20,0xB0,0x04,0x25,0x08,0xB0,0x02,0x25,
-  0x43,0x48,0x21,0x21,0x21,0x2D,0x2C,0x45,0x23,0x20,0x45,0x18,0x20,0xB0,0x00,0x50,
-  0x20,0x58,0x23,0x65,0x23,0x59,0x23,0x68,0x20,0xB0,0x40,0x50,0x58,0x21,0xB0,0x40,
-  0x59,0x23,0x58,0x65,0x59,0x8A,0x60,0x44,0x2D,0x2C,0x4B,0x53,0x23,0x4B,0x51,0x5A,
-  0x58,0x20,0x45,0x8A,0x60,0x44,0x1B,0x21,0x21,0x59,0x2D,0x2C,0x4B,0x54,0x58,0x20,
-  0x45,0x8A,0x60,0x44,0x1B,0x21,0x21,0x59,0x2D,0x2C,0x4B,0x53,0x23,0x4B,0x51,0x5A,
-  0x58,0x38,0x1B,0x21,0x21,0x59,0x2D,0x2C,0xB0,0x00,0x21,0x4B,0x54,0x58,0x38,0x1B,
-  0x21,0x21,0x59,0x2D,0x2C,0xB0,0x02,0x43,0x54,0x58,0xB0,0x46,0x2B,0x1B,0x21,0x21,
-  0x21,0x21,0x59,0x2D,0x2C,0xB0,0x02,0x43,0x54,0x58,0xB0,0x47,0x2B,0x1B,0x21,0x21,
-  0x21,0x59,0x2D,0x2C,0xB0,0x02,0x43,0x54,0x58,0xB0,0x48,0x2B,0x1B,0x21,0x21,0x21,
-  0x21,0x59,0x2D,0x2C,0xB0,0x02,0x43,0x54,0x58,0xB0,0x49,0x2B,0x1B,0x21,0x21,0x21,
-  0x59,0x2D,0x2C,0x20,0x8A,0x08,0x23,0x4B,0x53,0x8A,0x4B,0x51,0x5A,0x58,0x23,0x38,
-  0x1B,0x21,0x21,0x59,0x2D,0x2C,0x00,0xB0,0x02,0x25,0x49,0xB0,0x00,0x53,0x58,0x20,
-  0xB0,0x40,0x38,0x11,0x1B,0x21,0x59,0x2D,0x2C,0x01,0x46,0x23,0x46,0x60,0x23,0x46,
-  0x61,0x23,0x20,0x10,0x20,0x46,0x8A,0x61,0xB8,0xFF,0x80,0x62,0x8A,0xB1,0x40,0x40,
-  0x8A,0x70,0x45,0x60,0x68,0x3A,0x2D,0x2C,0x20,0x8A,0x23,0x49,0x64,0x8A,0x23,0x53,
-  0x58,0x3C,0x1B,0x21,0x59,0x2D,0x2C,0x4B,0x52,0x58,0x7D,0x1B,0x7A,0x59,0x2D,0x2C,
-  0xB0,0x12,0x00,0x4B,0x01,0x4B,0x54,0x42,0x2D,0x2C,0xB1,0x02,0x00,0x42,0xB1,0x23,
-  0x01,0x88,0x51,0xB1,0x40,0x01,0x88,0x53,0x5A,0x58,0xB9,0x10,0x00,0x00,0x20,0x88,
-  0x54,0x58,0xB2,0x02,0x01,0x02,0x43,0x60,0x42,0x59,0xB1,0x24,0x01,0x88,0x51,0x58,
-  0xB9,0x20,0x00,0x00,0x40,0x88,0x54,0x58,0xB2,0x02,0x02,0x02,0x43,0x60,0x42,0xB1,
-  0x24,0x01,0x88,0x54,0x58,0xB2,0x02,0x20,0x02,0x43,0x60,0x42,0x00,0x4B,0x01,0x4B,
-  0x52,0x58,0xB2,0x02,0x08,0x02,0x43,0x60,0x42,0x59,0x1B,0xB9,0x40,0x00,0x00,0x80,
-  0x88,0x54,0x58,0xB2,0x02,0x04,0x02,0x43,0x60,0x42,0x59,0xB9,0x40,0x00,0x00,0x80,
-  0x63,0xB8,0x01,0x00,0x88,0x54,0x58,0xB2,0x02,0x08,0x02,0x43,0x60,0x42,0x59,0xB9,
-  0x40,0x00,0x01,0x00,0x63,0xB8,0x02,0x00,0x88,0x54,0x58,0xB2,0x02,0x10,0x02,0x43,
-  0x60,0x42,0x59,0xB9,0x40,0x00,0x02,0x00,0x63,0xB8,0x04,0x00,0x88,0x54,0x58,0xB2,
-  0x02,0x40,0x02,0x43,0x60,0x42,0x59,0x59,0x59,0x59,0x59,0x2D,0x2C,0x45,0x18,0x68,
-  0x23,0x4B,0x51,0x58,0x23,0x20,0x45,0x20,0x64,0xB0,0x40,0x50,0x58,0x7C,0x59,0x68,
-  0x8A,0x60,0x59,0x44,0x2D,0x2C,0xB0,0x00,0x16,0xB0,0x02,0x25,0xB0,0x02,0x25,0x01,
-  0xB0,0x01,0x23,0x3E,0x00,0xB0,0x02,0x23,0x3E,0xB1,0x01,0x02,0x06,0x0C,0xB0,0x0A,
-  0x23,0x65,0x42,0xB0,0x0B,0x23,0x42,0x01,0xB0,0x01,0x23,0x3F,0x00,0xB0,0x02,0x23,
-  0x3F,0xB1,0x01,0x02,0x06,0x0C,0xB0,0x06,0x23,0x65,0x42,0xB0,0x07,0x23,0x42,0xB0,
-  0x01,0x16,0x01,0x2D,0x2C,0x7A,0x8A,0x10,0x45,0x23,0xF5,0x18,0x2D,0x00,0x00,0x00,
-  0x40,0x15,0xF8,0x03,0xFF,0x1F,0xF1,0x6F,0x1A,0x1F,0x2F,0xEF,0x6F,0xEF,0x02,0xE6,
-  0xE4,0x33,0x1F,0xE5,0xE4,0x19,0x1F,0xB8,0x01,0x00,0x40,0x10,0x33,0xFF,0x55,0xDF,
-  0x33,0xDD,0x55,0xDE,0x33,0x03,0x55,0xB0,0xFF,0xD0,0xFF,0x02,0xB8,0xFF,0xC0,0x40,
-  0x68,0xFF,0x09,0x11,0x46,0x00,0xDD,0x20,0xDD,0x70,0xDD,0x03,0xDD,0x01,0x03,0x55,
-  0xDC,0x03,0xFF,0x1F,0xD6,0xD5,0x33,0x1F,0xD3,0xD2,0x19,0x1F,0x87,0xD2,0x01,0xFE,
-  0xC2,0x19,0x1F,0x06,0xBA,0x16,0xBA,0xE6,0xBA,0xF6,0xBA,0x04,0x0F,0xB2,0x1F,0xB2,
-  0x2F,0xB2,0x03,0x40,0xB2,0x0F,0x13,0x46,0xA7,0xB1,0x01,0xAF,0x53,0x19,0x1F,0xAE,
-  0xAD,0x19,0x1F,0xAC,0x4A,0x19,0x1F,0xAB,0xAA,0x19,0x1F,0xA9,0x03,0xFF,0x1F,0x9E,
-  0x9D,0x19,0x1F,0x1F,0x9D,0x01,0x70,0x9C,0x80,0x9C,0x90,0x9C,0xD0,0x9C,0xE0,0x9C,
-  0xF0,0x9C,0x06,0x0F,0x99,0x01,0x97,0x98,0x01,0xB8,0xFF,0xF8,0x40,0x38,0x98,0x09,
-  0x0F,0x46,0x20,0x97,0x80,0x97,0x90,0x97,0xF0,0x97,0x04,0xA9,0x96,0xB9,0x96,0x02,
-  0x38,0x96,0x01,0xF0,0x95,0x01,0xBF,0x95,0x01,0x20,0x95,0x30,0x95,0x40,0x95,0x80,
-  0x95,0x90,0x95,0xA0,0x95,0x06,0x94,0x92,0x19,0x1F,0x93,0x53,0x19,0x1F,0x0F,0x92,
-  0x01,0x85,0x47,0x19,0x1F,0xC5,0xBD,0x01,0x07,0x00,0x01,0x00,0xA6,0x01,0x07,0x00,
-  0xB6,0x01,0x07,0xB2,0x02,0x03,0x80,0xBA,0x01,0x07,0x00,0x90,0x01,0x07,0x40,0xA8,
-  0x02,0x76,0x75,0x19,0x1F,0x74,0x50,0x19,0x1F,0x73,0x50,0x19,0x1F,0x6F,0x48,0x19,
-  0x1F,0x6E,0x47,0x19,0x1F,0x1A,0x01,0x18,0x55,0x19,0x13,0xFF,0x1F,0x07,0x04,0xFF,
-  0x1F,0x06,0x03,0xFF,0x1F,0x61,0x60,0x19,0x1F,0x65,0x60,0x01,0x64,0x5F,0x01,0xFF,
-  0xFB,0x01,0xEF,0xFB,0x01,0x79,0xFB,0x01,0x3F,0xFB,0x4F,0xFB,0x02,0x18,0xFA,0x12,
-  0x18,0x46,0x4F,0xFA,0x5F,0xFA,0x6F,0xFA,0x03,0xD4,0x5B,0xE4,0x5B,0x02,0x5B,0x5A,
-  0x10,0x1F,0x39,0x5A,0x01,0x06,0x5A,0x01,0x06,0x13,0x33,0x12,0x55,0x05,0x01,0x03,
-  0x55,0x04,0x33,0x03,0x55,0x0F,0x03,0x7F,0x03,0xEF,0x03,0x03,0xE0,0xFD,0x01,0xDF,
-  0xFD,0x01,0x51,0x50,0x19,0x1F,0x0F,0xFC,0xBF,0xFC,0xCF,0xFC,0xDF,0xFC,0x04,0x03,
-  0x40,0xFC,0x0C,0x10,0x46,0x49,0x46,0x19,0x1F,0x60,0x48,0x01,0x3B,0x47,0x01,0x06,
-  0x1C,0x1B,0xFF,0x1F,0x16,0x33,0x15,0x55,0x11,0x01,0x0F,0x55,0x10,0x33,0x0F,0x55,
-  0x02,0x01,0x00,0x55,0x01,0x47,0x00,0x55,0xB8,0x01,0x06,0x40,0x1E,0x1B,0x12,0x1F,
-  0x9F,0x0F,0xDF,0x0F,0x02,0xCF,0x0F,0xEF,0x0F,0x02,0x6F,0x00,0x7F,0x00,0xAF,0x00,
-  0xEF,0x00,0x04,0x10,0x00,0x01,0x80,0x16,0x01,0x05,0x01,0xB8,0x01,0x90,0xB1,0x54,
-  0x53,0x2B,0x2B,0x4B,0xB8,0x07,0xFF,0x52,0x4B,0xB0,0x09,0x50,0x5B,0xB0,0x01,0x88,
-  0xB0,0x25,0x53,0xB0,0x01,0x88,0xB0,0x40,0x51,0x5A,0xB0,0x06,0x88,0xB0,0x00,0x55,
-  0x5A,0x5B,0x58,0xB1,0x01,0x01,0x8E,0x59,0x85,0x8D,0x8D,0x00,0x42,0x1D,0x4B,0xB0,
-  0x32,0x53,0x58,0xB0,0x60,0x1D,0x59,0x4B,0xB0,0x64,0x53,0x58,0xB0,0x40,0x1D,0x59,
-  0x4B,0xB0,0x80,0x53,0x58,0xB0,0x10,0x1D,0xB1,0x16,0x00,0x42,0x59,0x73,0x73,0x73,
-  0x74,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0x01,0x5F,0x73,0x73,0x2B,0x2B,0x5F,0x73,
-  0x00,0x2B,0x73,0x73,0x73,0x2B,0x2B,0x2B,0x01,0x5F,0x73,0x73,0x2B,0x73,0x73,0x2B,
-  0x73,0x73,0x73,0x73,0x00,0x73,0x73,0x2B,0x2B,0x2B,0x2B,0x2B,0x01,0x2B,0x2B,0x00,
-  0x2B,0x2B,0x2B,0x73,0x5F,0x73,0x73,0x01,0x2B,0x00,0x73,0x2B,0x2B,0x01,0x73,0x73,
-  0x73,0x73,0x73,0x73,0x2B,0x73,0x73,0x00,0x73,0x73,0x2B,0x2B,0x01,0x2B,0x2B,0x00,
-  0x2B,0x2B,0x01,0x73,0x00,0x2B,0x73,0x73,0x2B,0x01,0x73,0x2B,0x00,0x2B,0x2B,0x2B,
-  0x73,0x2B,0x73,0x2B,0x2B,0x2B,0x2B,0x2B,0x73,0x01,0x2B,0x00,0x2B,0x18,0x00,0x00,
-  0x06,0x14,0x00,0x0B,0x00,0x51,0x05,0xB6,0x00,0x17,0x00,0x75,0x05,0xB6,0x05,0xCD,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x4A,
-  0x00,0x14,0x00,0x8F,0x00,0x00,0xFF,0xEC,0x00,0x00,0x00,0x00,0xFF,0xEC,0x00,0x00,
-  0x00,0x00,0xFF,0xEC,0x00,0x00,0xFE,0x14,0xFE,0x14,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x08,0x73,0x00,0x00,0x00,0xB2,0x00,0xB6,
-  0x00,0xBC,0x00,0x9C,0x00,0xD5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0x00,0x83,
-  0x00,0x97,0x00,0x9F,0x00,0x7D,0x00,0xE5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0xBA,0x00,0xC5,0x00,0xBA,0x00,0x00,0x00,0x00,0x00,0xA4,
-  0x00,0x9F,0x00,0x8F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB0,0x00,0xB9,
-  0x00,0x8A,0x00,0x00,0x00,0x00,0x00,0x9B,0x00,0xA6,0x00,0x8F,0x00,0x77,0x00,0x55,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x69,0x00,0x6E,0x00,0x90,0x00,0xC0,0x01,0x89,0x00,0xDB,
-  0x00,0xAC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x00,0x6F,0x00,0x78,0x00,0x96,
-  0x00,0xC0,0x00,0xD5,0x01,0x48,0x00,0xCD,0x01,0x15,0x02,0x97,0x00,0xFE,0x01,0x2F,
-  0x00,0xED,0x01,0x4E,0x00,0x79,0x01,0x16,0x01,0x4C,0x01,0xF5,0x02,0x27,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0xFF,0xE2,0x05,0xB6,0x00,0x96,0x00,0x8C,0x00,0xE5,0x00,0x96,0x00,0x89,0x00,0xFA,
-  0x00,0x00,0x01,0x18,0x01,0x0C,0x03,0x1D,0x00,0x99,0x02,0x4A,0x00,0x78,0x02,0xB6,
-  0x00,0x8D,0x00,0xA8,0x00,0x8C,0x00,0x00,0x00,0x00,0x02,0x79,0x00,0xD9,0x00,0xB4,
-  0x00,0x00,0x00,0x00,0x01,0x5A,0x00,0x6D,0x00,0x7F,0x00,0xA0,0x00,0x00,0x00,0x00,
-  0x00,0x6D,0x00,0x88,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x8C,0x00,0xA0,0x00,0x00,0x00,0x82,0x00,0x89,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xB6,0xFC,0xEA,0x00,0x11,0xFF,0xEB,
-  0x00,0x96,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0x00,0x65,0x00,0x78,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBC,0x01,0xAA,0x03,0x54,0x01,0xAA,0x02,0x1D,
-  0x00,0xBC,0x00,0xB6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0x00,0x00,0x00,0x00,
-  0x05,0xB6,0xFE,0xBC,0x00,0x98,0x00,0xAC,0x01,0x39,0x01,0xF5,0x01,0x83,0x03,0x1D,
-  0xFF,0xF3,0x00,0x83,0x00,0x7A,0x00,0x86,0x00,0x00,0x00,0x00,0xFE,0x6F,0x00,0x89,
-  0x00,0x00,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x5A,0x00,0x87,0x01,0x1C,
-  0x01,0xC1,0x02,0x6C,0x03,0x27,0x03,0x42,0x03,0x6F,0x03,0x9C,0x03,0xD2,0x03,0xFA,
-  0x04,0x2D,0x04,0x4A,0x04,0x69,0x04,0x87,0x04,0xCD,0x04,0xFA,0x05,0x4D,0x05,0xB2,
-  0x06,0x02,0x06,0x55,0x06,0xB3,0x06,0xE9,0x07,0x67,0x07,0xC4,0x07,0xF5,0x08,0x34,
-  0x08,0x7A,0x08,0xAE,0x08,0xF3,0x09,0x4B,0x09,0xEA,0x0A,0x61,0x0A,0xBE,0x0A,0xFF,
-  0x0B,0x37,0x0B,0x6F,0x0B,0xAF,0x0B,0xFC,0x0C,0x33,0x0C,0x6E,0x0C,0x9C,0x0D,0x1C,
-  0x0D,0x42,0x0D,0xC2,0x0E,0x1A,0x0E,0x55,0x0E,0x93,0x0E,0xEE,0x0F,0x4F,0x0F,0x9C,
-  0x0F,0xCC,0x0F,0xFE,0x10,0x65,0x11,0x47,0x11,0xC4,0x12,0x36,0x12,0x6F,0x12,0x9C,
-  0x12,0xBA,0x12,0xE7,0x13,0x16,0x13,0x2D,0x13,0x4F,0x13,0xA4,0x13,0xF1,0x14,0x2C,
-  0x14,0x7A,0x14,0xC9,0x15,0x11,0x15,0x9F,0x15,0xDD,0x16,0x19,0x16,0x5D,0x16,0xB9,
-  0x16,0xE7,0x17,0x4D,0x17,0x86,0x17,0xC0,0x18,0x10,0x18,0x5F,0x18,0x95,0x18,0xE2,
-  0x19,0x31,0x19,0x68,0x19,0xBD,0x1A,0x82,0x1A,0xF6,0x1B,0x57,0x1B,0x91,0x1B,0xED,
-  0x1C,0x05,0x1C,0x60,0x1C,0x95,0x1C,0x95,0x1C,0xBF,0x1D,0x0F,0x1D,0x62,0x1D,0xD0,
-  0x1E,0x57,0x1E,0x7B,0x1F,0x04,0x1F,0x3A,0x1F,0xC2,0x20,0x16,0x20,0x5E,0x20,0x84,
-  0x20,0x8C,0x21,0x29,0x21,0x3E,0x21,0xA9,0x21,0xDD,0x22,0x28,0x22,0x96,0x22,0xB8,
-  0x22,0xFA,0x23,0x3D,0x23,0x5F,0x23,0x9C,0x23,0xC4,0x23,0xFC,0x24,0x44,0x24,0x73,
-  0x24,0xA6,0x24,0xD3,0x25,0x33,0x25,0x4B,0x25,0x62,0x25,0x79,0x25,0x91,0x25,0xAB,
-  0x25,0xD1,0x26,0x3A,0x26,0x4C,0x26,0x64,0x26,0x7B,0x26,0x92,0x26,0xAB,0x26,0xC3,
-  0x26,0xDA,0x26,0xF1,0x27,0x0A,0x27,0x5A,0x27,0x71,0x27,0x89,0x27,0xA0,0x27,0xB8,
-  0x27,0xCF,0x27,0xE8,0x28,0x37,0x28,0xA5,0x28,0xBD,0x28,0xD4,0x28,0xEB,0x29,0x04,
-  0x29,0x1B,0x29,0x5D,0x29,0xD3,0x29,0xEA,0x2A,0x02,0x2A,0x1A,0x2A,0x36,0x2A,0x54,
-  0x2A,0x6C,0x2A,0xED,0x2A,0xFF,0x2B,0x16,0x2B,0x32,0x2B,0x48,0x2B,0x60,0x2B,0x77,
-  0x2B,0x8D,0x2B,0xA4,0x2B,0xBD,0x2C,0x35,0x2C,0x4B,0x2C,0x62,0x2C,0x78,0x2C,0x8F,
-  0x2C,0xA5,0x2C,0xBE,0x2D,0x09,0x2D,0x7F,0x2D,0x96,0x2D,0xAC,0x2D,0xC2,0x2D,0xDA,
-  0x2D,0xF0,0x2E,0x41,0x2E,0x59,0x2E,0x71,0x2E,0x87,0x2E,0x9F,0x2E,0xB5,0x2E,0xCE,
-  0x2E,0xED,0x2F,0x04,0x2F,0x1B,0x2F,0x3C,0x2F,0x52,0x2F,0x69,0x2F,0x7F,0x2F,0x96,
-  0x2F,0xAC,0x2F,0xC4,0x2F,0xE0,0x2F,0xE8,0x30,0x4E,0x30,0x66,0x30,0x7C,0x30,0x93,
-  0x30,0xA9,0x30,0xC0,0x30,0xD6,0x30,0xEA,0x30,0xFE,0x31,0x15,0x31,0x2B,0x31,0x42,
-  0x31,0x59,0x31,0x74,0x31,0x8B,0x31,0xA2,0x31,0xB8,0x31,0xCE,0x31,0xE4,0x31,0xFB,
-  0x32,0x12,0x32,0x64,0x32,0xB6,0x32,0xCD,0x32,0xE4,0x32,0xFB,0x33,0x12,0x33,0x29,
-  0x33,0x3F,0x33,0x52,0x33,0x65,0x33,0x7C,0x33,0xA8,0x33,0xE6,0x34,0x4B,0x34,0x62,
-  0x34,0x79,0x34,0x90,0x34,0xA7,0x35,0x04,0x35,0x1C,0x35,0x33,0x35,0x4A,0x35,0x61,
-  0x35,0x75,0x35,0x8B,0x35,0x9F,0x35,0xB7,0x36,0x12,0x36,0x7C,0x36,0x93,0x36,0xA9,
-  0x36,0xC0,0x36,0xD7,0x36,0xEF,0x37,0x05,0x37,0x4E,0x37,0xA8,0x37,0xEE,0x38,0x05,
-  0x38,0x1B,0x38,0x33,0x38,0x49,0x38,0x62,0x38,0x7A,0x38,0xD0,0x39,0x49,0x39,0x61,
-  0x39,0x77,0x39,0x8E,0x39,0xAE,0x39,0xC6,0x39,0xDD,0x39,0xF4,0x3A,0x0A,0x3A,0x21,
-  0x3A,0x37,0x3A,0x4A,0x3A,0x5F,0x3A,0x76,0x3A,0x8C,0x3A,0xA3,0x3A,0xB9,0x3A,0xD0,
-  0x3A,0xE6,0x3B,0x30,0x3B,0x93,0x3B,0xAA,0x3B,0xC0,0x3B,0xD8,0x3B,0xEE,0x3C,0x06,
-  0x3C,0x1C,0x3C,0x35,0x3C,0x4E,0x3C,0x67,0x3C,0x7F,0x3C,0x92,0x3C,0xAB,0x3C,0xC2,
-  0x3C,0xD9,0x3C,0xF0,0x3D,0x06,0x3D,0x1F,0x3D,0x36,0x3D,0x4C,0x3D,0x63,0x3D,0x79,
-  0x3D,0x90,0x3D,0xA6,0x3D,0xD7,0x3E,0x2F,0x3E,0x68,0x3E,0x9C,0x3E,0xB3,0x3E,0xC9,
-  0x3E,0xE0,0x3E,0xF6,0x3F,0x0C,0x3F,0x23,0x3F,0x57,0x3F,0x8B,0x3F,0xB9,0x3F,0xF8,
-  0x40,0x2E,0x40,0x9A,0x40,0xD0,0x41,0x09,0x41,0x49,0x41,0x6E,0x41,0xC1,0x41,0xDA,
-  0x41,0xFC,0x42,0x1A,0x42,0x38,0x42,0x51,0x42,0x68,0x42,0x7F,0x42,0x96,0x42,0xAB,
-  0x42,0xB3,0x42,0xBB,0x42,0xE8,0x43,0x6F,0x43,0x77,0x43,0x7F,0x43,0x87,0x43,0xE7,
-  0x43,0xEF,0x43,0xF7,0x44,0x6F,0x44,0x77,0x44,0x7F,0x44,0xBE,0x44,0xC6,0x44,0xEB,
-  0x44,0xF3,0x45,0x4E,0x45,0x56,0x45,0x5E,0x45,0xF1,0x45,0xF9,0x46,0x5F,0x46,0xC9,
-  0x46,0xE2,0x46,0xFB,0x47,0x12,0x47,0x28,0x47,0x3E,0x47,0x54,0x47,0x6D,0x47,0xC7,
-  0x48,0x2B,0x48,0x81,0x48,0xE2,0x49,0x39,0x49,0xB0,0x49,0xE8,0x4A,0x41,0x4A,0x6C,
-  0x4A,0x74,0x4A,0xD3,0x4B,0x14,0x4B,0x6B,0x4B,0xF8,0x4C,0x00,0x4C,0x5E,0x4C,0xA7,
-  0x4D,0x04,0x4D,0x47,0x4D,0x8F,0x4D,0xC8,0x4E,0x2A,0x4E,0xD3,0x4F,0x33,0x4F,0xBB,
-  0x4F,0xD3,0x4F,0xEC,0x50,0x02,0x50,0x18,0x50,0x2E,0x50,0x47,0x50,0xAF,0x50,0xC6,
-  0x51,0x13,0x51,0x1B,0x51,0x23,0x51,0x3C,0x51,0x44,0x51,0xBC,0x52,0x08,0x52,0x5D,
-  0x52,0x74,0x52,0x8B,0x52,0xC4,0x52,0xCC,0x53,0x09,0x53,0x11,0x53,0x19,0x53,0x80,
-  0x53,0x88,0x54,0x15,0x54,0x74,0x54,0xC5,0x54,0xDD,0x55,0x37,0x55,0x8D,0x55,0x95,
-  0x55,0x9D,0x55,0xA5,0x55,0xAD,0x55,0xB5,0x55,0xBD,0x55,0xC5,0x56,0x42,0x56,0x4A,
-  0x56,0x52,0x56,0x87,0x56,0xBC,0x57,0x01,0x57,0x5D,0x57,0x9F,0x57,0xEF,0x58,0x2C,
-  0x58,0x7C,0x58,0xE8,0x59,0x47,0x59,0x4F,0x59,0xA6,0x5A,0x05,0x5A,0x2D,0x5A,0x8B,
-  0x5A,0x93,0x5B,0x3E,0x5B,0x99,0x5B,0xF6,0x5C,0x12,0x5C,0x71,0x5C,0xF6,0x5D,0x80,
-  0x5D,0xB8,0x5D,0xC0,0x5D,0xE7,0x5D,0xEF,0x5D,0xF7,0x5E,0x28,0x5E,0x30,0x5E,0x90,
-  0x5E,0x98,0x5E,0xCC,0x5F,0x01,0x5F,0x45,0x5F,0x98,0x5F,0xDC,0x60,0x34,0x60,0x73,
-  0x60,0xD1,0x61,0x33,0x61,0x8E,0x61,0xA6,0x62,0x0A,0x62,0x20,0x62,0x79,0x62,0x81,
-  0x62,0x89,0x62,0xA2,0x62,0xAA,0x63,0x1A,0x63,0x70,0x63,0x78,0x63,0x8E,0x63,0xA4,
-  0x63,0xDE,0x64,0x10,0x64,0x3A,0x64,0x52,0x64,0x69,0x64,0x80,0x64,0x96,0x64,0xAF,
-  0x64,0xC8,0x64,0xE0,0x64,0xF7,0x65,0x10,0x65,0x26,0x65,0x3C,0x65,0x6E,0x65,0x96,
-  0x65,0xC5,0x65,0xF9,0x66,0x20,0x66,0x63,0x66,0xB0,0x66,0xFD,0x67,0x31,0x67,0x7A,
-  0x67,0xA4,0x67,0xF6,0x68,0xB9,0x68,0xC1,0x68,0xC9,0x68,0xFE,0x69,0x26,0x69,0x44,
-  0x69,0x64,0x69,0xA2,0x69,0xF2,0x6A,0x67,0x6A,0xDD,0x6B,0x50,0x6B,0xE4,0x6C,0x4F,
-  0x6D,0x0A,0x6D,0x6D,0x6D,0x75,0x6D,0xC3,0x6D,0xFE,0x6E,0x35,0x6E,0x6E,0x6E,0xA7,
-  0x6E,0xFA,0x6F,0x7C,0x6F,0xA8,0x70,0x01,0x70,0x1B,0x70,0x48,0x70,0xB2,0x70,0xE8,
-  0x71,0x41,0x71,0x9D,0x71,0xEB,0x72,0x37,0x72,0x76,0x72,0xD4,0x73,0x1F,0x73,0x4E,
-  0x73,0x82,0x73,0xA2,0x73,0xC3,0x73,0xE4,0x74,0x16,0x74,0x61,0x74,0xB6,0x74,0xFF,
-  0x75,0x2D,0x75,0xA1,0x75,0xEF,0x75,0xEF,0x75,0xEF,0x75,0xEF,0x75,0xEF,0x75,0xEF,
-  0x75,0xEF,0x75,0xEF,0x75,0xEF,0x75,0xEF,0x75,0xEF,0x75,0xEF,0x75,0xEF,0x75,0xEF,
-  0x77,0x43,0x77,0xC0,0x77,0xD2,0x77,0xDA,0x78,0x77,0x78,0xF1,0x79,0x7A,0x79,0x91,
-  0x79,0xA7,0x79,0xBF,0x79,0xD7,0x79,0xFC,0x7A,0x53,0x7A,0x9D,0x7B,0x19,0x7B,0x94,
-  0x7B,0xFD,0x7C,0x59,0x7C,0xAD,0x7D,0x11,0x7D,0x19,0x7D,0x21,0x7D,0x29,0x7D,0x6C,
-  0x7D,0x8C,0x7D,0xA4,0x7D,0xBC,0x7D,0xD3,0x7D,0xEA,0x7E,0x7E,0x7F,0x02,0x7F,0x56,
-  0x7F,0xAC,0x80,0x1B,0x80,0x88,0x81,0x06,0x81,0x9B,0x82,0x51,0x82,0xEB,0x83,0x55,
-  0x83,0xD0,0x84,0x51,0x84,0xE2,0x85,0xBE,0x86,0xA2,0x86,0xAA,0x86,0xB2,0x87,0x0D,
-  0x87,0x59,0x87,0xB3,0x88,0x12,0x88,0x2C,0x88,0x45,0x88,0xE9,0x89,0x90,0x8A,0x1C,
-  0x8A,0x9B,0x8B,0x84,0x8C,0x56,0x8D,0x1A,0x8D,0xDB,0x8E,0x2D,0x8E,0x78,0x8E,0xF9,
-  0x8F,0x29,0x8F,0x5A,0x8F,0x8A,0x8F,0xBC,0x90,0x64,0x91,0x0D,0x91,0x87,0x92,0x16,
-  0x92,0x68,0x92,0xC0,0x93,0x30,0x93,0xC1,0x93,0xF4,0x94,0x26,0x94,0x7D,0x94,0xD5,
-  0x95,0x3A,0x95,0x97,0x95,0xAA,0x95,0xBF,0x96,0x19,0x96,0x5F,0x96,0xC7,0x97,0x2B,
-  0x97,0x8A,0x97,0xF1,0x98,0x3F,0x98,0x8A,0x98,0xCE,0x99,0x15,0x99,0x55,0x99,0x8C,
-  0x99,0xE5,0x9A,0x4A,0x9A,0xF5,0x9B,0xAA,0x9B,0xBE,0x9B,0xD1,0x9C,0x0D,0x9C,0x3F,
-  0x9C,0x47,0x9C,0x9E,0x9D,0x24,0x9D,0x94,0x9E,0x08,0x9E,0x8B,0x9E,0xC4,0x9F,0x00,
-  0x9F,0x47,0x9F,0x92,0x9F,0xE9,0xA0,0x46,0xA0,0x7D,0xA0,0xC0,0xA1,0x3C,0xA1,0xB9,
-  0xA2,0x43,0xA2,0xCC,0xA2,0xD4,0xA2,0xEB,0xA3,0x01,0xA3,0x68,0xA3,0xC7,0xA4,0x25,
-  0xA4,0x70,0xA4,0xC4,0xA5,0x15,0xA5,0x5D,0xA5,0x9F,0xA5,0xEB,0xA6,0x3C,0xA6,0xDC,
-  0xA7,0x7E,0xA7,0x86,0xA7,0x9E,0xA7,0xB4,0xA7,0xCE,0xA7,0xE6,0xA7,0xEE,0xA7,0xF6,
-  0xA8,0x0E,0xA8,0x24,0xA8,0x85,0xA8,0xE6,0xA8,0xFF,0xA9,0x17,0xA9,0x31,0xA9,0x4A,
-  0xA9,0x64,0xA9,0x7D,0xA9,0xD4,0xAA,0x2E,0xAA,0x45,0xAA,0x5B,0xAA,0x74,0xAA,0x8C,
-  0xAA,0xA5,0xAA,0xBE,0xAA,0xC6,0xAA,0xCE,0xAA,0xE7,0xAB,0x00,0xAB,0x1A,0xAB,0x33,
-  0xAB,0x4A,0xAB,0x60,0xAB,0x7A,0xAB,0x92,0xAB,0xAB,0xAB,0xC3,0xAB,0xDC,0xAB,0xF4,
-  0xAC,0x25,0xAC,0x51,0xAC,0x6A,0xAC,0x82,0xAC,0xD4,0xAD,0x25,0xAD,0x3E,0xAD,0x5A,
-  0xAD,0xD4,0xAE,0x5D,0xAE,0x9C,0xAE,0xA4,0xAF,0x09,0xAF,0x7F,0xAF,0xF6,0xB0,0x69,
-  0xB0,0xD5,0xB1,0x3E,0xB1,0xAF,0xB2,0x12,0xB2,0x64,0xB2,0xBA,0xB3,0x1C,0xB3,0x78,
-  0xB3,0xC1,0xB4,0x0A,0xB4,0x7F,0xB4,0x87,0xB4,0x8F,0xB4,0x97,0xB4,0xAD,0xB4,0xC3,
-  0xB4,0xDA,0xB4,0xF0,0xB5,0x09,0xB5,0x21,0xB5,0x3B,0xB5,0x54,0xB5,0x6D,0xB5,0x85,
-  0xB5,0x9E,0xB5,0xB6,0xB5,0xD7,0xB5,0xF7,0xB6,0x10,0xB6,0x28,0xB6,0x41,0xB6,0x59,
-  0xB6,0x72,0xB6,0x8A,0xB6,0xA4,0xB6,0xBC,0xB6,0xDF,0xB6,0xFF,0xB7,0x15,0xB7,0x2B,
-  0xB7,0x42,0xB7,0x58,0xB7,0x6F,0xB7,0x85,0xB7,0x9E,0xB7,0xB6,0xB7,0xD0,0xB7,0xE9,
-  0xB8,0x02,0xB8,0x1A,0xB8,0x34,0xB8,0x4C,0xB8,0x6D,0xB8,0x8D,0xB8,0xA4,0xB8,0xBA,
-  0xB8,0xD0,0xB8,0xE7,0xB8,0xFE,0xB9,0x14,0xB9,0x2B,0xB9,0x41,0xB9,0x5A,0xB9,0x72,
-  0xB9,0x8C,0xB9,0xA5,0xB9,0xBE,0xB9,0xD6,0xB9,0xEF,0xBA,0x07,0xBA,0x2B,0xBA,0x4B,
-  0xBA,0x62,0xBA,0x75,0xBA,0x8D,0xBA,0xA2,0xBA,0xBA,0xBA,0xD1,0xBA,0xE9,0xBA,0xFE,
-  0xBB,0x15,0xBB,0x2C,0xBB,0x42,0xBB,0x58,0xBB,0x6F,0xBB,0x85,0xBB,0x9D,0xBB,0xB2,
-  0xBB,0xCA,0xBB,0xE0,0xBB,0xF8,0xBC,0x0F,0xBC,0x26,0xBC,0x39,0xBC,0x50,0xBC,0x67,
-  0xBC,0x7D,0xBC,0x93,0xBC,0xAA,0xBC,0xC0,0xBC,0xD7,0xBC,0xED,0xBD,0x7E,0xBD,0xC3,
-  0xBE,0x15,0xBE,0x67,0xBE,0xD8,0xBF,0x4F,0xBF,0x98,0xBF,0xE1,0xC0,0x4D,0xC0,0xBE,
-  0xC0,0xF1,0xC1,0x1C,0xC1,0x47,0xC1,0x59,0xC1,0x6C,0x00,0x00,0x00,0x02,0x00,0xC1,
-  0x00,0x00,0x04,0x0A,0x05,0xB6,0x00,0x03,0x00,0x07,0x00,0x27,0x40,0x15,0x05,0x60,
-  0x02,0x01,0x02,0x02,0x09,0x04,0x00,0x03,0x70,0x03,0x80,0x03,0x03,0x03,0x04,0x03,
-  0x07,0x00,0x03,0x00,0x3F,0x32,0x2F,0x33,0x01,0x2F,0x5D,0x33,0x11,0x33,0x2F,0x5D,
-  0x33,0x31,0x30,0x13,0x21,0x11,0x21,0x37,0x21,0x11,0x21,0xC1,0x03,0x49,0xFC,0xB7,
-  0x68,0x02,0x79,0xFD,0x87,0x05,0xB6,0xFA,0x4A,0x68,0x04,0xE6,0x00,0x02,0x01,0xE7,
-  0xFF,0xE3,0x02,0xE5,0x05,0xB6,0x00,0x03,0x00,0x0B,0x00,0x34,0x40,0x1C,0x01,0x00,
-  0x03,0x06,0x96,0x02,0x0A,0x0A,0x0C,0x0D,0x2F,0x00,0x01,0x00,0x00,0x02,0x15,0x04,
-  0x01,0x06,0x04,0x01,0x04,0x9B,0x08,0xA8,0x02,0x03,0x00,0x3F,0x3F,0xE1,0x5D,0x5D,
-  0x11,0x39,0x2F,0x5D,0x11,0x12,0x01,0x39,0x2F,0x33,0xE1,0x32,0x39,0x39,0x31,0x30,
-  0x01,0x23,0x03,0x33,0x03,0x32,0x15,0x14,0x23,0x22,0x35,0x34,0x02,0xA4,0x79,0x33,
-  0xDF,0x71,0x7F,0x7F,0x7F,0x01,0x9E,0x04,0x18,0xFB,0x44,0x8B,0x8C,0x8C,0x8B,0x00,
-  0x00,0x02,0x01,0x1D,0x03,0xA6,0x03,0xB0,0x05,0xB6,0x00,0x03,0x00,0x07,0x00,0x2E,
-  0x40,0x1C,0x04,0xCF,0x07,0x01,0xA0,0x07,0x01,0x4F,0x07,0x01,0x07,0x00,0x20,0x03,
-  0x30,0x03,0x90,0x03,0xA0,0x03,0x04,0x03,0x06,0x01,0x9E,0x07,0x00,0x03,0x00,0x3F,
-  0x32,0xED,0x32,0x01,0x2F,0x5D,0xC1,0x2F,0x5D,0x5D,0x5D,0xC1,0x31,0x30,0x01,0x03,
-  0x23,0x03,0x21,0x03,0x23,0x03,0x02,0x0A,0x29,0x9B,0x29,0x02,0x93,0x29,0x9B,0x29,
-  0x05,0xB6,0xFD,0xF0,0x02,0x10,0xFD,0xF0,0x02,0x10,0x00,0x02,0x00,0x2D,0x00,0x00,
-  0x04,0xA0,0x05,0xB6,0x00,0x1B,0x00,0x1F,0x00,0xB8,0x40,0x73,0x1C,0x08,0x14,0x09,
-  0xAB,0x0A,0x12,0x0F,0x0E,0x0B,0x04,0x0A,0x13,0xAA,0x14,0x04,0x01,0x00,0x19,0x04,
-  0x18,0x05,0xAA,0x06,0x16,0x1E,0x1D,0x07,0x04,0x06,0x17,0xAB,0x18,0x1F,0x15,0x0A,
-  0x14,0x40,0x02,0x50,0x02,0x02,0x10,0x0A,0x14,0x06,0x18,0x02,0x02,0x18,0x06,0x14,
-  0x0A,0x10,0x06,0xD0,0x1A,0xF0,0x1A,0x02,0x7F,0x1A,0x9F,0x1A,0x02,0x1A,0xE0,0x0C,
-  0xF0,0x0C,0x02,0x0C,0x08,0x04,0x0C,0xAE,0x0D,0x1C,0x01,0x0D,0x1F,0x00,0x10,0xAE,
-  0x11,0x19,0x15,0x11,0x3F,0x11,0x4F,0x11,0x7F,0x11,0x8F,0x11,0x9F,0x11,0x05,0x3F,
-  0x0D,0x4F,0x0D,0x02,0x0D,0x11,0x0D,0x11,0x05,0x17,0x13,0x03,0x0A,0x05,0x12,0x00,
-  0x3F,0x33,0x3F,0x33,0x12,0x39,0x39,0x2F,0x2F,0x5D,0x5D,0x11,0x33,0x33,0x10,0xE1,
-  0x32,0x32,0x11,0x33,0x33,0x10,0xE1,0x32,0x32,0x01,0x2F,0x5D,0x2F,0x5D,0x5D,0x17,
-  0x39,0x2F,0x2F,0x2F,0x2F,0x2F,0x2F,0x5D,0x11,0x12,0x39,0x39,0x10,0xE1,0x11,0x17,
-  0x39,0x10,0xE1,0x11,0x17,0x39,0x10,0xE1,0x11,0x17,0x39,0x10,0xE1,0x11,0x39,0x39,
-  0x31,0x30,0x01,0x03,0x33,0x15,0x21,0x03,0x23,0x13,0x21,0x03,0x23,0x13,0x23,0x35,
-  0x33,0x13,0x23,0x35,0x21,0x13,0x33,0x03,0x21,0x13,0x33,0x03,0x33,0x15,0x01,0x21,
-  0x13,0x21,0x03,0xA8,0x40,0xF0,0xFE,0xF6,0x52,0x94,0x54,0xFE,0xDE,0x52,0x90,0x4E,
-  0xD9,0xF4,0x41,0xE9,0x01,0x02,0x52,0x93,0x52,0x01,0x25,0x54,0x90,0x54,0xDD,0xFD,
-  0x14,0x01,0x23,0x40,0xFE,0xDD,0x03,0x7D,0xFE,0xB8,0x89,0xFE,0x54,0x01,0xAC,0xFE,
-  0x54,0x01,0xAC,0x89,0x01,0x48,0x89,0x01,0xB0,0xFE,0x50,0x01,0xB0,0xFE,0x50,0x89,
-  0xFE,0xB8,0x01,0x48,0x00,0x03,0x00,0xB6,0xFF,0x89,0x04,0x14,0x06,0x12,0x00,0x1C,
-  0x00,0x22,0x00,0x27,0x00,0xCD,0x40,0x86,0x13,0x24,0x01,0x04,0x24,0x01,0x13,0x23,
-  0x01,0x04,0x23,0x01,0x13,0x09,0x01,0x06,0x09,0x01,0x03,0x08,0x13,0x08,0x02,0x02,
-  0x03,0x12,0x03,0x02,0x02,0x02,0x12,0x02,0x02,0x04,0x01,0x14,0x01,0x02,0x04,0x00,
-  0x14,0x00,0x02,0x24,0x18,0x12,0x01,0x70,0x1D,0x0F,0x08,0x02,0x02,0x05,0x48,0x26,
-  0x58,0x26,0x78,0x26,0x03,0x26,0x6E,0x14,0x1B,0x40,0x11,0x14,0x48,0x40,0x1B,0x50,
-  0x1B,0x02,0x1B,0x29,0x05,0x05,0x20,0x6E,0x00,0x0C,0x90,0x0C,0xA0,0x0C,0xD0,0x0C,
-  0x04,0x0C,0x17,0x1E,0x73,0x0F,0x26,0x23,0x09,0x18,0x1D,0x20,0x06,0x03,0x15,0x12,
-  0x0F,0x5F,0x10,0x6F,0x10,0x7F,0x10,0x03,0x10,0x10,0x0F,0x0F,0x2F,0x0F,0x3F,0x0F,
-  0x5F,0x0F,0x04,0x0F,0x24,0x08,0x73,0x03,0x06,0x03,0x02,0x02,0x00,0x03,0xB8,0xFF,
-  0xC0,0xB3,0x0A,0x0E,0x48,0x03,0x00,0x2F,0x2B,0x33,0x33,0x2F,0x11,0x33,0x10,0xE1,
-  0x32,0x2F,0x5D,0x33,0x2F,0x5D,0x11,0x33,0x33,0x12,0x17,0x39,0x10,0xE1,0x32,0x01,
-  0x2F,0x5D,0xE1,0x33,0x2F,0x10,0xDE,0x5D,0x2B,0x32,0xE1,0x5D,0x11,0x39,0x2F,0x33,
-  0x33,0x33,0xE1,0x32,0x32,0x32,0x31,0x30,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,
-  0x5D,0x5D,0x5D,0x25,0x15,0x23,0x35,0x22,0x27,0x35,0x16,0x33,0x11,0x26,0x26,0x35,
-  0x34,0x36,0x37,0x35,0x33,0x15,0x16,0x17,0x07,0x26,0x27,0x11,0x16,0x16,0x15,0x10,
-  0x01,0x11,0x06,0x15,0x14,0x16,0x17,0x11,0x36,0x35,0x34,0x02,0xAC,0x89,0xE4,0x89,
-  0xC4,0xA9,0xC1,0x9B,0xB8,0xA4,0x89,0xBB,0x95,0x42,0x8C,0x82,0xC7,0xA1,0xFE,0x0F,
-  0xAC,0x51,0xE4,0xB8,0x6F,0xE6,0xDD,0x46,0xAC,0x5C,0x01,0xB2,0x40,0xA3,0x8A,0x83,
-  0xAC,0x14,0xB4,0xB0,0x09,0x45,0x91,0x3E,0x0A,0xFE,0x5A,0x44,0xA1,0x82,0xFE,0xE8,
-  0x02,0xB0,0x01,0x71,0x1D,0x91,0x4E,0x56,0xFA,0xFE,0x8B,0x1C,0x9C,0x7F,0x00,0x05,
-  0x00,0x00,0xFF,0xEE,0x04,0xCD,0x05,0xC7,0x00,0x0B,0x00,0x13,0x00,0x17,0x00,0x23,
-  0x00,0x2B,0x00,0xCF,0xB9,0x00,0x22,0xFF,0xE0,0xB3,0x09,0x0D,0x48,0x20,0xB8,0xFF,
-  0xE0,0x40,0x0E,0x09,0x0D,0x48,0x1C,0x20,0x09,0x0D,0x48,0x1A,0x20,0x09,0x0D,0x48,
-  0x0A,0xB8,0xFF,0xE0,0xB3,0x09,0x0D,0x48,0x08,0xB8,0xFF,0xE0,0x40,0x21,0x09,0x0D,
-  0x48,0x04,0x20,0x09,0x0D,0x48,0x02,0x20,0x09,0x0D,0x48,0x67,0x2A,0x97,0x2A,0xA7,
-  0x2A,0x03,0x2A,0xB4,0x1B,0xB5,0x21,0x15,0x16,0x17,0x14,0x00,0x16,0x01,0x16,0xB8,
-  0xFF,0xC0,0x40,0x1A,0x15,0x18,0x48,0x0F,0x14,0x01,0x14,0x40,0x15,0x18,0x48,0x16,
-  0x14,0x16,0x14,0x03,0x68,0x26,0x98,0x26,0xA8,0x26,0x03,0x26,0xB4,0x21,0xB8,0xFF,
-  0xC0,0x40,0x2E,0x15,0x18,0x48,0x21,0x2D,0x68,0x0E,0x98,0x0E,0xA8,0x0E,0x03,0x0E,
-  0xB4,0x09,0xB5,0x67,0x12,0x97,0x12,0xA7,0x12,0x03,0x12,0xB4,0x03,0x28,0xB6,0x1E,
-  0xB7,0x24,0xB6,0x18,0x19,0x17,0x06,0x15,0x18,0x0C,0xB6,0x00,0xB7,0x10,0xB6,0x06,
-  0x07,0x00,0x3F,0xE1,0xF4,0xE1,0x3F,0x3F,0x3F,0xE1,0xF4,0xE1,0x01,0x2F,0xE1,0x5D,
-  0xF4,0xE1,0x5D,0x10,0xD4,0x2B,0xE1,0x5D,0x12,0x39,0x39,0x2F,0x2F,0x2B,0x5D,0x2B,
-  0x5D,0x11,0x33,0x11,0x33,0x10,0xF4,0xE1,0x5D,0x31,0x30,0x2B,0x2B,0x2B,0x2B,0x2B,
-  0x2B,0x2B,0x2B,0x01,0x22,0x26,0x35,0x34,0x36,0x33,0x32,0x16,0x15,0x14,0x06,0x27,
-  0x32,0x35,0x34,0x23,0x22,0x15,0x14,0x01,0x01,0x23,0x01,0x13,0x22,0x26,0x35,0x34,
-  0x36,0x33,0x32,0x16,0x15,0x14,0x06,0x27,0x32,0x35,0x34,0x23,0x22,0x15,0x14,0x01,
-  0x23,0x83,0xA0,0x9E,0x89,0x81,0xA2,0x9D,0x88,0x8B,0x8B,0x8D,0x03,0x89,0xFD,0x27,
-  0x9E,0x02,0xD9,0x23,0x82,0xA1,0x9E,0x89,0x81,0xA2,0x9D,0x88,0x8B,0x8B,0x8D,0x03,
-  0x10,0xBD,0xA0,0xA4,0xB6,0xBA,0xA0,0xA2,0xBB,0x77,0xE6,0xE1,0xE1,0xE6,0x02,0x2F,
-  0xFA,0x4A,0x05,0xB6,0xFA,0x38,0xBD,0x9F,0xA4,0xB6,0xBA,0xA0,0xA1,0xBB,0x76,0xE6,
-  0xE1,0xE1,0xE6,0x00,0x00,0x03,0x00,0x3D,0xFF,0xEC,0x04,0xCB,0x05,0xCD,0x00,0x1A,
-  0x00,0x25,0x00,0x2D,0x00,0xE5,0x40,0x0F,0x11,0x27,0x26,0x09,0x04,0x08,0x13,0x08,
-  0x1B,0x00,0x01,0x06,0x04,0x07,0x24,0xB8,0xFF,0xF0,0x40,0x30,0x0E,0x11,0x48,0x40,
-  0x24,0x01,0x34,0x24,0x01,0x24,0x47,0x13,0x1E,0x10,0x0E,0x11,0x48,0x4F,0x1E,0x01,
-  0x3B,0x1E,0x01,0x06,0x1E,0x47,0x19,0x20,0x13,0x30,0x13,0x02,0xC0,0x19,0xD0,0x19,
-  0x02,0x13,0x19,0x13,0x19,0x0E,0x79,0x03,0x01,0x03,0x47,0x04,0xB8,0xFF,0xC0,0x40,
-  0x1C,0x09,0x12,0x48,0x04,0x04,0x07,0x07,0x2F,0x29,0x48,0x0E,0x40,0x0A,0x10,0x48,
-  0x0E,0x46,0x06,0x01,0x46,0x01,0x56,0x01,0x02,0x37,0x01,0x01,0x1B,0xB8,0xFF,0xF8,
-  0x40,0x37,0x0B,0x0E,0x48,0x1B,0x00,0x01,0x06,0x04,0x08,0x21,0x50,0x16,0x58,0x09,
-  0x01,0x58,0x26,0x01,0x38,0x27,0x58,0x27,0x02,0x29,0x27,0x01,0x28,0x11,0x01,0x11,
-  0x27,0x26,0x09,0x04,0x08,0x16,0x0F,0x03,0x1F,0x03,0x4F,0x03,0x7F,0x03,0x04,0x03,
-  0x03,0x16,0x04,0x2C,0x51,0x0B,0x16,0x08,0x15,0x00,0x3F,0x3F,0xE1,0x3F,0x39,0x2F,
-  0x5D,0x11,0x12,0x17,0x39,0x5D,0x5D,0x5D,0x5D,0x5D,0x10,0xE1,0x11,0x17,0x39,0x2B,
-  0x5D,0x5D,0x5D,0x01,0x2F,0x2B,0xE1,0x11,0x33,0x2F,0x33,0x2F,0x2B,0xE1,0x5D,0x12,
-  0x39,0x39,0x2F,0x2F,0x5D,0x5D,0x10,0xE1,0x5F,0x5D,0x5D,0x2B,0x10,0xE1,0x5D,0x5D,
-  0x2B,0x11,0x17,0x39,0x33,0x11,0x12,0x17,0x39,0x31,0x30,0x01,0x01,0x36,0x37,0x33,
-  0x06,0x07,0x13,0x23,0x27,0x06,0x23,0x22,0x26,0x35,0x34,0x36,0x37,0x26,0x35,0x34,
-  0x36,0x33,0x32,0x16,0x15,0x14,0x05,0x36,0x36,0x35,0x34,0x26,0x23,0x22,0x06,0x15,
-  0x14,0x01,0x01,0x06,0x15,0x14,0x16,0x33,0x32,0x02,0x5A,0x01,0x19,0x47,0x21,0xB8,
-  0x35,0x7D,0xEA,0xD9,0x83,0xAE,0xEE,0xBD,0xD9,0x7F,0xAC,0xA3,0xBF,0xB3,0xA8,0xB9,
-  0xFE,0x64,0x86,0x63,0x63,0x51,0x57,0x63,0x01,0x93,0xFE,0xBD,0xCB,0x86,0x5D,0xA0,
-  0x03,0x08,0xFE,0xA4,0x79,0x91,0xEA,0xA9,0xFE,0xDD,0xA6,0xBA,0xD6,0xBB,0x83,0xC3,
-  0x66,0xC0,0xA4,0x94,0xAC,0xAB,0x95,0xCB,0x41,0x4F,0x77,0x4A,0x4A,0x5C,0x59,0x51,
-  0x76,0xFD,0x08,0x01,0x91,0x7B,0xB2,0x69,0x8D,0x00,0x00,0x01,0x01,0xF0,0x03,0xA6,
-  0x02,0xDD,0x05,0xB6,0x00,0x03,0x00,0x18,0x40,0x0D,0x00,0xA0,0x03,0xE0,0x03,0xF0,
-  0x03,0x03,0x03,0x01,0x9E,0x00,0x03,0x00,0x3F,0xED,0x01,0x2F,0x5D,0xC1,0x31,0x30,
-  0x01,0x03,0x23,0x03,0x02,0xDD,0x29,0x9B,0x29,0x05,0xB6,0xFD,0xF0,0x02,0x10,0x00,
-  0x00,0x01,0x01,0x27,0xFE,0xBC,0x03,0xA4,0x05,0xB6,0x00,0x09,0x00,0x27,0x40,0x15,
-  0x06,0x05,0x05,0x00,0x01,0x01,0x0B,0x03,0xF0,0x1F,0x08,0x7F,0x08,0x8F,0x08,0x03,
-  0x08,0x06,0xF9,0x00,0xF8,0x00,0x3F,0x3F,0x01,0x2F,0x5D,0xE1,0x11,0x33,0x2F,0x33,
-  0x33,0x11,0x33,0x31,0x30,0x01,0x33,0x00,0x11,0x10,0x01,0x23,0x00,0x11,0x10,0x02,
-  0xE3,0xC1,0xFE,0x3F,0x01,0xBF,0xBF,0xFE,0x44,0x05,0xB6,0xFE,0x88,0xFD,0xFB,0xFD,
-  0xF7,0xFE,0x8C,0x01,0x61,0x02,0x1A,0x02,0x14,0x00,0x00,0x01,0x01,0x29,0xFE,0xBC,
-  0x03,0xA6,0x05,0xB6,0x00,0x09,0x00,0x27,0x40,0x15,0x03,0xF0,0x10,0x08,0x70,0x08,
-  0x80,0x08,0x03,0x08,0x08,0x0B,0x00,0x01,0x01,0x06,0x05,0x06,0xF8,0x00,0xF9,0x00,
-  0x3F,0x3F,0x01,0x2F,0x33,0x33,0x11,0x33,0x11,0x33,0x2F,0x5D,0xE1,0x31,0x30,0x01,
-  0x23,0x00,0x11,0x10,0x01,0x33,0x00,0x11,0x10,0x01,0xE9,0xBE,0x01,0xBE,0xFE,0x40,
-  0xC0,0x01,0xBD,0xFE,0xBC,0x01,0x73,0x02,0x0A,0x02,0x06,0x01,0x77,0xFE,0x97,0xFD,
-  0xEA,0xFD,0xE4,0x00,0x00,0x01,0x00,0x85,0x02,0x77,0x04,0x48,0x06,0x14,0x00,0x0E,
-  0x00,0x24,0x40,0x15,0xF4,0x07,0x01,0x07,0x05,0x09,0x07,0x04,0x0A,0x03,0x0B,0x01,
-  0x0D,0x02,0x0C,0x0B,0x08,0x06,0x06,0x00,0x00,0x00,0x3F,0x32,0x2F,0x33,0x17,0x39,
-  0x01,0x19,0x2F,0x5D,0x31,0x30,0x01,0x03,0x25,0x17,0x05,0x13,0x07,0x03,0x03,0x27,
-  0x13,0x25,0x37,0x05,0x03,0x02,0xCB,0x2B,0x01,0x8D,0x1B,0xFE,0x85,0xF6,0xB3,0xB0,
-  0x9D,0xB9,0xF2,0xFE,0x89,0x1D,0x01,0x87,0x2B,0x06,0x14,0xFE,0x77,0x6F,0xC1,0x1C,
-  0xFE,0xBA,0x60,0x01,0x66,0xFE,0x9A,0x60,0x01,0x46,0x1C,0xC1,0x6F,0x01,0x89,0x00,
-  0x00,0x01,0x00,0x98,0x01,0x06,0x04,0x33,0x04,0xA2,0x00,0x0B,0x00,0x1F,0x40,0x10,
-  0x09,0x06,0xAA,0x00,0xC0,0x03,0xD0,0x03,0x02,0x03,0x09,0x00,0xAD,0x06,0x03,0xB3,
-  0x00,0x3F,0x33,0xE1,0x32,0x01,0x2F,0x5D,0x33,0xE1,0x32,0x31,0x30,0x01,0x21,0x35,
-  0x21,0x11,0x33,0x11,0x21,0x15,0x21,0x11,0x23,0x02,0x1B,0xFE,0x7D,0x01,0x83,0x95,
-  0x01,0x83,0xFE,0x7D,0x95,0x02,0x87,0x96,0x01,0x85,0xFE,0x7B,0x96,0xFE,0x7F,0x00,
-  0x00,0x01,0x01,0xB8,0xFE,0xDF,0x03,0x12,0x01,0x06,0x00,0x06,0x00,0x3F,0x40,0x19,
-  0x19,0x06,0x29,0x06,0xE9,0x06,0xF9,0x06,0x04,0x06,0x98,0x01,0x99,0x70,0x04,0x80,
-  0x04,0xD0,0x04,0xE0,0x04,0xF0,0x04,0x05,0x04,0xB8,0xFF,0xC0,0x40,0x0F,0x09,0x0C,
-  0x48,0x04,0x04,0x07,0x08,0x03,0x9E,0x1F,0x06,0x2F,0x06,0x02,0x06,0x00,0x2F,0x5D,
-  0xED,0x11,0x12,0x01,0x39,0x2F,0x2B,0x5D,0xFD,0xE1,0x5D,0x31,0x30,0x01,0x17,0x06,
-  0x03,0x23,0x12,0x37,0x03,0x02,0x10,0x39,0x89,0x98,0x4C,0x23,0x01,0x06,0x18,0xE0,
-  0xFE,0xD1,0x01,0x43,0xE4,0x00,0x00,0x01,0x01,0x1D,0x01,0xD1,0x03,0xB0,0x02,0x79,
-  0x00,0x03,0x00,0x20,0x40,0x12,0x80,0x02,0x90,0x02,0x02,0x02,0x02,0x05,0x20,0x00,
-  0x30,0x00,0x02,0x00,0x00,0xB9,0x01,0xBD,0x00,0x3F,0xE1,0x01,0x2F,0x5D,0x11,0x33,
-  0x2F,0x5D,0x31,0x30,0x01,0x35,0x21,0x15,0x01,0x1D,0x02,0x93,0x01,0xD1,0xA8,0xA8,
-  0x00,0x01,0x01,0xCF,0xFF,0xE1,0x02,0xFE,0x01,0x2D,0x00,0x07,0x00,0x1D,0x40,0x0F,
-  0x02,0x97,0x30,0x06,0xB0,0x06,0x02,0x06,0x06,0x08,0x09,0x00,0x9C,0x04,0xA8,0x00,
-  0x3F,0xED,0x11,0x12,0x01,0x39,0x2F,0x5D,0xED,0x31,0x30,0x01,0x32,0x15,0x14,0x23,
-  0x22,0x35,0x34,0x02,0x66,0x98,0x98,0x97,0x01,0x2D,0xA6,0xA6,0xA6,0xA6,0x00,0x01,
-  0x00,0xD3,0x00,0x00,0x03,0xF8,0x05,0xB6,0x00,0x03,0x00,0x1C,0x40,0x0C,0x03,0x00,
-  0x00,0x05,0x01,0x02,0x02,0x04,0x03,0x03,0x01,0x12,0x00,0x3F,0x3F,0x11,0x01,0x33,
-  0x2F,0x33,0x11,0x33,0x2F,0x32,0x31,0x30,0x01,0x01,0x23,0x01,0x03,0xF8,0xFD,0x8D,
-  0xB2,0x02,0x73,0x05,0xB6,0xFA,0x4A,0x05,0xB6,0x00,0x00,0x02,0x00,0x93,0xFF,0xEC,
-  0x04,0x39,0x05,0xCD,0x00,0x09,0x00,0x15,0x00,0x36,0x40,0x12,0x0D,0x6F,0xD0,0x08,
-  0x01,0x08,0x17,0x13,0x6F,0x00,0x03,0x10,0x03,0x20,0x03,0x03,0x07,0x03,0xB8,0xFF,
-  0xC0,0x40,0x0C,0x15,0x18,0x48,0x03,0x10,0x73,0x05,0x07,0x0A,0x73,0x00,0x19,0x00,
-  0x3F,0xE1,0x3F,0xE1,0x01,0x2F,0x2B,0x5E,0x5D,0xE1,0x10,0xDE,0x5D,0xE1,0x31,0x30,
-  0x05,0x22,0x02,0x11,0x10,0x21,0x32,0x12,0x11,0x10,0x25,0x32,0x12,0x11,0x10,0x02,
-  0x23,0x22,0x02,0x11,0x10,0x12,0x02,0x64,0xE5,0xEC,0x01,0xD1,0xE8,0xED,0xFE,0x2B,
-  0x93,0x8A,0x8A,0x93,0x91,0x87,0x87,0x14,0x01,0x83,0x01,0x6E,0x02,0xF0,0xFE,0x7D,
-  0xFE,0x93,0xFD,0x0F,0x9B,0x01,0x19,0x01,0x3D,0x01,0x3B,0x01,0x19,0xFE,0xE9,0xFE,
-  0xC3,0xFE,0xC2,0xFE,0xE8,0x00,0x00,0x01,0x00,0xE1,0x00,0x00,0x02,0xF6,0x05,0xB6,
-  0x00,0x0A,0x00,0x2B,0x40,0x16,0x09,0x01,0x08,0x08,0x00,0x6E,0x00,0x01,0x10,0x01,
-  0x02,0x06,0x01,0x01,0x0C,0x0B,0x04,0x07,0x09,0x06,0x00,0x18,0x00,0x3F,0x3F,0xCD,
-  0x39,0x11,0x12,0x01,0x39,0x2F,0x5E,0x5D,0xE1,0x33,0x2F,0x11,0x33,0x31,0x30,0x21,
-  0x23,0x11,0x34,0x37,0x06,0x07,0x07,0x27,0x01,0x33,0x02,0xF6,0xB0,0x08,0x27,0x52,
-  0x93,0x61,0x01,0x7F,0x96,0x03,0x91,0x7A,0xEF,0x2B,0x46,0x79,0x7B,0x01,0x2B,0x00,
-  0x00,0x01,0x00,0x9E,0x00,0x00,0x04,0x2D,0x05,0xCB,0x00,0x17,0x00,0x55,0x40,0x1D,
-  0x90,0x17,0xA0,0x17,0xB0,0x17,0x03,0x17,0x17,0x06,0x6F,0xFF,0x11,0x01,0x11,0x40,
-  0x0F,0x13,0x48,0x11,0x19,0xD5,0x16,0xE5,0x16,0xF5,0x16,0x03,0x16,0xB8,0xFF,0xE8,
-  0x40,0x17,0x09,0x0C,0x48,0x16,0x0C,0x00,0x01,0xB0,0x01,0x02,0x01,0x06,0x01,0x0B,
-  0x09,0x73,0x0E,0x07,0x02,0x16,0x74,0x01,0x18,0x00,0x3F,0xE1,0x32,0x3F,0xE1,0x33,
-  0x12,0x39,0x01,0x2F,0x5D,0x32,0x32,0x2B,0x5D,0x10,0xDE,0x2B,0x5D,0xE1,0x33,0x2F,
-  0x5D,0x31,0x30,0x21,0x21,0x35,0x01,0x36,0x36,0x35,0x34,0x26,0x23,0x22,0x07,0x27,
-  0x36,0x33,0x32,0x16,0x15,0x14,0x06,0x07,0x01,0x15,0x21,0x04,0x2D,0xFC,0x71,0x01,
-  0x5E,0xC3,0x7C,0x7F,0x6C,0xA0,0x9E,0x66,0xC0,0xE6,0xC2,0xE0,0x76,0xE8,0xFE,0xE7,
-  0x02,0xB0,0x9C,0x01,0x7D,0xD5,0xD1,0x7E,0x71,0x83,0x89,0x77,0xAC,0xD4,0xB3,0x77,
-  0xFA,0xFA,0xFE,0xD5,0x08,0x00,0x00,0x01,0x00,0x83,0xFF,0xEC,0x04,0x1F,0x05,0xCB,
-  0x00,0x22,0x00,0x5F,0x40,0x3A,0x0B,0x13,0x1B,0x13,0x02,0x00,0x10,0x15,0x6F,0x20,
-  0x20,0x03,0x5F,0x10,0x01,0x10,0x10,0x08,0x0D,0x6F,0x9F,0x03,0xAF,0x03,0x02,0x03,
-  0x24,0x1B,0xCF,0x08,0xDF,0x08,0xEF,0x08,0x03,0x00,0x08,0x01,0x08,0x00,0x10,0x73,
-  0x68,0x11,0x01,0x11,0x11,0x0B,0x1A,0x18,0x73,0x1D,0x07,0x0B,0x73,0x09,0x06,0x19,
-  0x00,0x3F,0x33,0xE1,0x3F,0xE1,0x33,0x12,0x39,0x2F,0x5D,0xE1,0x39,0x01,0x2F,0x5D,
-  0x5D,0x33,0x10,0xDE,0x5D,0xE1,0x11,0x39,0x2F,0x5D,0x11,0x33,0x2F,0xE1,0x12,0x39,
-  0x31,0x30,0x5D,0x01,0x15,0x04,0x11,0x14,0x04,0x21,0x22,0x27,0x35,0x16,0x33,0x20,
-  0x11,0x10,0x21,0x23,0x35,0x33,0x32,0x36,0x35,0x34,0x26,0x23,0x22,0x07,0x27,0x36,
-  0x33,0x32,0x16,0x15,0x14,0x06,0x02,0xB6,0x01,0x69,0xFE,0xEC,0xFE,0xFB,0xF2,0x91,
-  0xB8,0xC7,0x01,0x62,0xFE,0x83,0x85,0x85,0xA0,0xB0,0x88,0x72,0xB2,0xA6,0x5C,0xBB,
-  0xF9,0xCE,0xE7,0xA4,0x03,0x02,0x06,0x2F,0xFE,0xD3,0xCB,0xE9,0x4F,0xAA,0x60,0x01,
-  0x21,0x01,0x02,0x97,0x98,0x7D,0x66,0x77,0x79,0x7D,0x96,0xC6,0xA5,0x8A,0xBA,0x00,
-  0x00,0x02,0x00,0x3D,0x00,0x00,0x04,0x66,0x05,0xBE,0x00,0x0A,0x00,0x12,0x00,0x56,
-  0x40,0x18,0x07,0x10,0x09,0x0F,0x48,0x0B,0x07,0x03,0x6E,0x09,0x00,0x02,0x40,0x10,
-  0x13,0x48,0x00,0x02,0x01,0x02,0x02,0x13,0x14,0x12,0xB8,0xFF,0xF0,0x40,0x18,0x0B,
-  0x0F,0x48,0x12,0x05,0x40,0x0A,0x10,0x48,0x05,0x01,0x04,0x74,0x09,0x06,0x0E,0x07,
-  0x0B,0x0B,0x02,0x07,0x06,0x02,0x18,0x00,0x3F,0x3F,0x12,0x39,0x2F,0x12,0x39,0x33,
-  0x33,0xE1,0x32,0x01,0x2F,0x2B,0x33,0x2B,0x11,0x12,0x39,0x2F,0x5D,0x2B,0x33,0x33,
-  0xE1,0x32,0x32,0x31,0x30,0x2B,0x01,0x23,0x11,0x23,0x11,0x21,0x35,0x01,0x33,0x11,
-  0x33,0x21,0x11,0x34,0x13,0x23,0x06,0x07,0x01,0x04,0x66,0xD5,0xB0,0xFD,0x5C,0x02,
-  0x98,0xBC,0xD5,0xFE,0x7B,0x0D,0x09,0x24,0x36,0xFE,0x65,0x01,0x48,0xFE,0xB8,0x01,
-  0x48,0x9F,0x03,0xD7,0xFC,0x30,0x01,0x64,0xB0,0x01,0x00,0x66,0x4E,0xFD,0xA0,0x00,
-  0x00,0x01,0x00,0xAC,0xFF,0xEC,0x04,0x1F,0x05,0xB6,0x00,0x18,0x00,0x52,0x40,0x31,
-  0x0D,0x40,0x0B,0x0F,0x48,0x0D,0x0D,0x00,0x05,0x6F,0x9F,0x14,0xAF,0x14,0x02,0x14,
-  0x1A,0x0E,0x0F,0x0F,0x0B,0x09,0x0A,0x0A,0x00,0x00,0x90,0x00,0xA0,0x00,0xB0,0x00,
-  0x04,0x00,0x09,0x07,0x73,0x11,0x11,0x0B,0x03,0x73,0x01,0x17,0x19,0x0E,0x74,0x0B,
-  0x06,0x00,0x3F,0xE1,0x3F,0x33,0xE1,0x11,0x39,0x2F,0xE1,0x33,0x01,0x2F,0x5D,0x33,
-  0x2F,0x33,0x33,0x33,0x11,0x33,0x10,0xDE,0x5D,0xE1,0x12,0x39,0x2F,0x2B,0x31,0x30,
-  0x37,0x35,0x16,0x33,0x20,0x11,0x10,0x21,0x22,0x07,0x27,0x13,0x21,0x15,0x21,0x03,
-  0x36,0x33,0x32,0x04,0x15,0x14,0x04,0x23,0x22,0xAC,0x90,0xD8,0x01,0x50,0xFE,0xA8,
-  0x59,0x8E,0x5A,0x37,0x02,0xB2,0xFD,0xEC,0x27,0x6B,0x66,0xD2,0x01,0x03,0xFE,0xEC,
-  0xFB,0xE0,0x3B,0xAC,0x60,0x01,0x3A,0x01,0x26,0x1A,0x39,0x02,0xB0,0xA6,0xFE,0x5D,
-  0x14,0xE5,0xC7,0xEA,0xFF,0x00,0x00,0x02,0x00,0x9A,0xFF,0xEC,0x04,0x33,0x05,0xCB,
-  0x00,0x15,0x00,0x21,0x00,0x4F,0x40,0x16,0x01,0x40,0x0B,0x0F,0x48,0x01,0x01,0x12,
-  0x16,0x6E,0xBF,0x0C,0x01,0x0C,0x23,0x06,0x1C,0x6F,0x00,0x12,0x01,0x12,0xB8,0xFF,
-  0xC0,0x40,0x16,0x14,0x18,0x48,0x12,0x06,0x19,0x75,0x7F,0x09,0x01,0x09,0x09,0x1F,
-  0x03,0x73,0x01,0x14,0x07,0x1F,0x73,0x0F,0x19,0x00,0x3F,0xE1,0x3F,0x33,0xE1,0x12,
-  0x39,0x2F,0x5D,0xE1,0x32,0x01,0x2F,0x2B,0x5D,0xE1,0x32,0x10,0xDE,0x5D,0xE1,0x12,
-  0x39,0x2F,0x2B,0x31,0x30,0x01,0x15,0x26,0x23,0x22,0x02,0x03,0x33,0x36,0x33,0x32,
-  0x16,0x15,0x14,0x02,0x23,0x22,0x00,0x11,0x10,0x21,0x32,0x13,0x34,0x26,0x23,0x22,
-  0x06,0x15,0x14,0x16,0x33,0x32,0x36,0x03,0xC5,0x47,0x5F,0xE0,0xE1,0x0A,0x0C,0x5F,
-  0xD4,0xC3,0xDD,0xF1,0xCB,0xDA,0xFE,0xFD,0x02,0x7F,0x68,0x02,0x89,0x7F,0x7F,0xAC,
-  0xA2,0x83,0x7F,0x8F,0x05,0xB8,0x9B,0x18,0xFE,0xE6,0xFE,0xCE,0xAA,0xEE,0xCE,0xE4,
-  0xFE,0xF9,0x01,0x51,0x01,0x34,0x03,0x5A,0xFC,0x0C,0x91,0x9C,0xA2,0x68,0x98,0xDD,
-  0xB0,0x00,0x00,0x01,0x00,0x8F,0x00,0x00,0x04,0x3B,0x05,0xB6,0x00,0x06,0x00,0x47,
-  0x40,0x30,0x79,0x06,0x89,0x06,0x02,0x47,0x06,0x57,0x06,0x02,0x07,0x06,0x17,0x06,
-  0x27,0x06,0x03,0x06,0x00,0x00,0x02,0x08,0x01,0x18,0x01,0x28,0x01,0x03,0x01,0x05,
-  0x08,0x00,0x02,0xD0,0x02,0xE0,0x02,0xF0,0x02,0x04,0x02,0x05,0x02,0x74,0x03,0x06,
-  0x00,0x18,0x00,0x3F,0x3F,0xE1,0x32,0x01,0x2F,0x5D,0x10,0xCE,0x32,0x5D,0x11,0x39,
-  0x2F,0x33,0x5D,0x31,0x30,0x5D,0x5D,0x21,0x01,0x21,0x35,0x21,0x15,0x01,0x01,0x4E,
-  0x02,0x33,0xFD,0x0E,0x03,0xAC,0xFD,0xD5,0x05,0x10,0xA6,0x91,0xFA,0xDB,0x00,0x03,
-  0x00,0x9C,0xFF,0xEC,0x04,0x31,0x05,0xCD,0x00,0x13,0x00,0x1E,0x00,0x29,0x00,0x7C,
-  0x40,0x1F,0x0A,0x1F,0x0C,0x26,0x6E,0x02,0x14,0x00,0x02,0x1C,0x6E,0x0C,0x16,0x6E,
-  0x12,0x0C,0x12,0x0C,0x12,0x08,0xBF,0x02,0x01,0x02,0x2B,0x21,0x6E,0x00,0x08,0x01,
-  0x08,0xB8,0xFF,0xC0,0xB7,0x14,0x18,0x48,0x08,0xD7,0x14,0x01,0x14,0xB8,0xFF,0xF0,
-  0x40,0x22,0x0C,0x0F,0x48,0x07,0x14,0x17,0x14,0x02,0x39,0x1F,0x59,0x1F,0x69,0x1F,
-  0x79,0x1F,0x04,0x2A,0x1F,0x01,0x1F,0x0A,0x00,0x14,0x04,0x23,0x19,0x73,0x0F,0x07,
-  0x23,0x73,0x05,0x19,0x00,0x3F,0xE1,0x3F,0xE1,0x12,0x17,0x39,0x5D,0x5D,0x5D,0x2B,
-  0x5D,0x01,0x2F,0x2B,0x5D,0xE1,0x10,0xCE,0x5D,0x11,0x39,0x39,0x2F,0x2F,0x10,0xE1,
-  0x10,0xE1,0x11,0x39,0x39,0x10,0xE1,0x11,0x39,0x39,0x31,0x30,0x01,0x04,0x15,0x14,
-  0x06,0x23,0x22,0x26,0x35,0x10,0x25,0x26,0x35,0x34,0x36,0x33,0x32,0x16,0x15,0x14,
-  0x05,0x36,0x35,0x34,0x26,0x23,0x22,0x06,0x15,0x14,0x16,0x17,0x06,0x15,0x14,0x21,
-  0x32,0x36,0x35,0x34,0x26,0x27,0x02,0xFC,0x01,0x35,0xFC,0xCF,0xD8,0xF2,0x01,0x1A,
-  0xEB,0xE9,0xB2,0xB8,0xE4,0xFE,0x66,0xE8,0x7E,0x6E,0x6A,0x7D,0x63,0x6C,0xFE,0x01,
-  0x14,0x88,0x95,0x7E,0x97,0x03,0x06,0xA0,0xE9,0xB5,0xDC,0xCF,0xBA,0x01,0x01,0x88,
-  0x92,0xDF,0xA1,0xBD,0xBE,0xA2,0xE6,0x37,0x67,0xAF,0x65,0x6A,0x6A,0x65,0x5A,0x7D,
-  0xD7,0x79,0xCC,0xF0,0x83,0x75,0x5A,0x8B,0x4A,0x00,0x00,0x02,0x00,0x9A,0xFF,0xEC,
-  0x04,0x33,0x05,0xCB,0x00,0x15,0x00,0x21,0x00,0x4E,0xB9,0x00,0x01,0xFF,0xC0,0x40,
-  0x14,0x0B,0x0F,0x48,0x01,0x01,0x0C,0x06,0x1C,0x6F,0xBF,0x12,0x01,0x12,0x23,0x16,
-  0x6E,0x00,0x0C,0x01,0x0C,0xB8,0xFF,0xC0,0x40,0x13,0x14,0x18,0x48,0x0C,0x06,0x19,
-  0x75,0x09,0x09,0x0F,0x03,0x75,0x01,0x14,0x19,0x1F,0x73,0x0F,0x07,0x00,0x3F,0xE1,
-  0x3F,0x33,0xE1,0x11,0x39,0x2F,0xE1,0x32,0x01,0x2F,0x2B,0x5D,0xE1,0x10,0xDE,0x5D,
-  0xE1,0x32,0x12,0x39,0x2F,0x2B,0x31,0x30,0x05,0x35,0x16,0x33,0x32,0x12,0x13,0x23,
-  0x06,0x23,0x22,0x26,0x35,0x34,0x12,0x33,0x32,0x00,0x11,0x10,0x21,0x22,0x03,0x14,
-  0x16,0x33,0x32,0x36,0x35,0x34,0x26,0x23,0x22,0x06,0x01,0x08,0x43,0x63,0xE0,0xE1,
-  0x0A,0x0C,0x60,0xD4,0xC2,0xDD,0xF1,0xCB,0xDC,0x01,0x01,0xFD,0x81,0x69,0x01,0x89,
-  0x7F,0x7F,0xAC,0xA0,0x85,0x80,0x8E,0x02,0x9C,0x19,0x01,0x1A,0x01,0x32,0xAA,0xEC,
-  0xD0,0xE4,0x01,0x08,0xFE,0xAA,0xFE,0xD1,0xFC,0xA6,0x03,0xF3,0x91,0x9C,0xA3,0x67,
-  0x97,0xDE,0xAE,0x00,0x00,0x02,0x01,0xE7,0xFF,0xE3,0x02,0xE5,0x04,0x66,0x00,0x07,
-  0x00,0x0F,0x00,0x2D,0x40,0x1B,0x0A,0x02,0x96,0x0E,0x30,0x06,0x60,0x06,0xB0,0x06,
-  0xE0,0x06,0xF0,0x06,0x05,0x06,0x06,0x10,0x11,0x08,0x9B,0x0C,0xA8,0x04,0x9B,0x00,
-  0x10,0x00,0x3F,0xED,0x3F,0xED,0x11,0x12,0x01,0x39,0x2F,0x5D,0x33,0xED,0x32,0x31,
-  0x30,0x01,0x32,0x15,0x14,0x23,0x22,0x35,0x34,0x13,0x32,0x15,0x14,0x23,0x22,0x35,
-  0x34,0x02,0x66,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x04,0x66,0x8B,0x8B,0x8B,0x8B,
-  0xFC,0x94,0x8B,0x8C,0x8C,0x8B,0x00,0x02,0x01,0x9A,0xFE,0xF8,0x02,0xEC,0x04,0x66,
-  0x00,0x07,0x00,0x0E,0x00,0x44,0x40,0x2E,0x19,0x0E,0x29,0x0E,0xE9,0x0E,0xF9,0x0E,
-  0x04,0x0E,0x98,0x0C,0x99,0x09,0x09,0x02,0x96,0x30,0x06,0x60,0x06,0xB0,0x06,0xE0,
-  0x06,0xF0,0x06,0x05,0x06,0x06,0x0F,0x10,0x0B,0x9D,0x1F,0x0E,0x2F,0x0E,0x3F,0x0E,
-  0x03,0x0E,0x04,0x9B,0x00,0x10,0x00,0x3F,0xED,0x2F,0x5D,0xED,0x11,0x12,0x01,0x39,
-  0x2F,0x5D,0xED,0x32,0x2F,0xED,0xE1,0x5D,0x31,0x30,0x01,0x32,0x15,0x14,0x23,0x22,
-  0x35,0x34,0x13,0x17,0x06,0x03,0x23,0x36,0x37,0x02,0x6D,0x7F,0x7F,0x7F,0xD7,0x0E,
-  0x33,0x7D,0x89,0x3E,0x26,0x04,0x66,0x8B,0x8B,0x8B,0x8B,0xFC,0x88,0x17,0xC5,0xFE,
-  0xE6,0xFF,0xF7,0x00,0x00,0x01,0x00,0x98,0x00,0xDD,0x04,0x33,0x04,0xC9,0x00,0x06,
-  0x00,0x61,0x40,0x3D,0x67,0x06,0x77,0x06,0x87,0x06,0x03,0x68,0x04,0x78,0x04,0x88,
-  0x04,0x03,0x76,0x05,0x86,0x05,0x02,0x05,0x04,0x01,0x04,0x00,0x08,0x01,0x01,0x07,
-  0x02,0x01,0x05,0x05,0x03,0x06,0xE0,0x00,0x01,0xDF,0x00,0x01,0x40,0x00,0x01,0x3F,
-  0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x04,0x20,0x03,0xC0,0x03,0x02,0x0F,0x03,0x01,
-  0x03,0x00,0x2F,0x5D,0x5D,0x33,0x33,0x2F,0x5D,0x5D,0x5D,0x5D,0x5D,0x32,0x12,0x39,
-  0x11,0x33,0x33,0x11,0x01,0x33,0x2F,0x10,0xCE,0x32,0x11,0x12,0x39,0x5D,0x31,0x30,
-  0x00,0x5D,0x5D,0x25,0x01,0x35,0x01,0x15,0x01,0x01,0x04,0x33,0xFC,0x65,0x03,0x9B,
-  0xFD,0x35,0x02,0xCB,0xDD,0x01,0xC3,0x66,0x01,0xC3,0xA0,0xFE,0xAA,0xFE,0xAA,0x00,
-  0x00,0x02,0x00,0x98,0x01,0xBA,0x04,0x33,0x03,0xE9,0x00,0x03,0x00,0x07,0x00,0x40,
-  0x40,0x27,0x07,0x02,0x09,0x04,0x00,0x01,0x01,0x01,0x01,0x08,0x05,0xAD,0x70,0x04,
-  0x01,0x4F,0x04,0x5F,0x04,0x6F,0x04,0x03,0x00,0x04,0x01,0x04,0x04,0x00,0xAD,0x8F,
-  0x01,0x01,0x50,0x01,0x01,0x0F,0x01,0x01,0x01,0x00,0x2F,0x5D,0x5D,0x5D,0xE1,0x33,
-  0x2F,0x5D,0x5D,0x5D,0xE1,0x11,0x01,0x33,0x2F,0x5D,0x33,0x10,0xCE,0x32,0x31,0x30,
-  0x13,0x35,0x21,0x15,0x01,0x35,0x21,0x15,0x98,0x03,0x9B,0xFC,0x65,0x03,0x9B,0x03,
-  0x54,0x95,0x95,0xFE,0x66,0x96,0x96,0x00,0x00,0x01,0x00,0x98,0x00,0xDD,0x04,0x33,
-  0x04,0xC9,0x00,0x06,0x00,0x5F,0x40,0x3C,0x68,0x02,0x78,0x02,0x88,0x02,0x03,0x67,
-  0x00,0x77,0x00,0x87,0x00,0x03,0x79,0x01,0x89,0x01,0x02,0x01,0x06,0x04,0x08,0x02,
-  0x06,0x06,0x07,0x05,0x04,0x01,0x01,0x03,0x00,0xE0,0x06,0x01,0xDF,0x06,0x01,0x40,
-  0x06,0x01,0x3F,0x06,0x01,0x00,0x06,0x01,0x06,0x06,0x02,0x20,0x03,0xC0,0x03,0x02,
-  0x0F,0x03,0x01,0x03,0x00,0x2F,0x5D,0x5D,0x33,0x33,0x2F,0x5D,0x5D,0x5D,0x5D,0x5D,
-  0x33,0x12,0x39,0x11,0x33,0x33,0x11,0x01,0x33,0x2F,0x33,0x10,0xCE,0x11,0x39,0x5D,
-  0x31,0x30,0x00,0x5D,0x5D,0x13,0x01,0x01,0x35,0x01,0x15,0x01,0x98,0x02,0xCA,0xFD,
-  0x36,0x03,0x9B,0xFC,0x65,0x01,0x7D,0x01,0x56,0x01,0x56,0xA0,0xFE,0x3D,0x66,0xFE,
-  0x3D,0x00,0x00,0x02,0x00,0xA8,0xFF,0xE3,0x04,0x23,0x05,0xCB,0x00,0x19,0x00,0x21,
-  0x00,0x4A,0x40,0x2A,0x19,0x00,0x00,0x1C,0x96,0x20,0x20,0x0D,0x07,0x47,0x12,0x23,
-  0x20,0x23,0x01,0x00,0x0D,0x01,0x0D,0x07,0x0F,0x2F,0x00,0x01,0x00,0x00,0x0F,0x15,
-  0x1A,0x01,0x06,0x1A,0x01,0x1A,0x9B,0x1E,0xA8,0x0C,0x0A,0x51,0x0F,0x04,0x00,0x3F,
-  0xE1,0x33,0x3F,0xE1,0x5D,0x5D,0x11,0x39,0x2F,0x5D,0x12,0x39,0x01,0x2F,0x5D,0x5D,
-  0x10,0xDE,0xE1,0x11,0x39,0x2F,0xE5,0x33,0x11,0x33,0x31,0x30,0x01,0x35,0x34,0x36,
-  0x37,0x36,0x36,0x35,0x34,0x26,0x23,0x22,0x07,0x27,0x36,0x33,0x32,0x16,0x15,0x14,
-  0x06,0x07,0x06,0x06,0x15,0x15,0x07,0x32,0x15,0x14,0x23,0x22,0x35,0x34,0x01,0xD1,
-  0x5C,0x73,0x82,0x53,0x95,0x84,0xAE,0xC5,0x41,0xD1,0xD9,0xD6,0xFB,0x6B,0x8F,0x76,
-  0x42,0x48,0x7F,0x7F,0x7F,0x01,0x9E,0x25,0x78,0x96,0x52,0x61,0x74,0x64,0x5C,0x73,
-  0x5A,0x99,0x61,0xC3,0xA4,0x85,0xA6,0x6C,0x57,0x6C,0x5A,0x12,0xA4,0x8B,0x8C,0x8C,
-  0x8B,0x00,0x00,0x02,0x00,0x1F,0xFF,0x4A,0x04,0xAE,0x05,0xB6,0x00,0x2E,0x00,0x38,
-  0x00,0x8F,0x40,0x5A,0x16,0x34,0x01,0x34,0xD3,0x06,0x00,0x2F,0x18,0x38,0x01,0x38,
-  0xD3,0x0E,0x0B,0x1E,0x0E,0x1C,0x06,0x01,0xD4,0x0E,0x01,0x60,0x0E,0x01,0x19,0x0E,
-  0x01,0x04,0x0E,0x01,0x06,0x0E,0x06,0x0E,0x24,0x09,0x13,0x01,0x13,0xD2,0x2A,0x3A,
-  0x06,0x19,0x01,0x19,0xD2,0x24,0x11,0x36,0xD5,0x03,0x2D,0x03,0x31,0xD5,0x09,0x3F,
-  0x03,0x4F,0x03,0x8F,0x03,0xCF,0x03,0xDF,0x03,0x05,0x30,0x09,0x40,0x09,0xD0,0x09,
-  0x03,0x03,0x09,0x03,0x09,0x1C,0x16,0xD6,0x27,0x03,0x1C,0xD6,0x1E,0x21,0x00,0x2F,
-  0x33,0xE1,0x3F,0xE1,0x12,0x39,0x39,0x2F,0x2F,0x5D,0x5D,0x10,0xE1,0x11,0x33,0x10,
-  0xE1,0x32,0x01,0x2F,0xE1,0x5D,0x10,0xD6,0xE1,0x5D,0x11,0x39,0x39,0x2F,0x2F,0x5D,
-  0x5D,0x5D,0x5D,0x5D,0x11,0x39,0x33,0x10,0xE1,0x5D,0x32,0x39,0x10,0xE1,0x5D,0x31,
-  0x30,0x01,0x23,0x06,0x23,0x22,0x26,0x35,0x34,0x36,0x33,0x32,0x17,0x03,0x06,0x15,
-  0x15,0x14,0x33,0x32,0x11,0x10,0x02,0x23,0x22,0x02,0x11,0x10,0x00,0x33,0x32,0x37,
-  0x15,0x06,0x23,0x20,0x00,0x11,0x10,0x00,0x21,0x32,0x00,0x11,0x14,0x02,0x23,0x22,
-  0x03,0x26,0x23,0x22,0x06,0x15,0x14,0x33,0x32,0x13,0x03,0x1F,0x04,0x4A,0x9C,0x78,
-  0x8C,0xC2,0x9E,0x89,0x77,0x16,0x02,0x48,0x64,0xDE,0xBC,0xE2,0xFD,0x01,0x03,0xEF,
-  0xB5,0xA5,0x9E,0xC2,0xFE,0xD6,0xFE,0xB1,0x01,0x4E,0x01,0x20,0xF8,0x01,0x29,0x80,
-  0x72,0x80,0x4C,0x36,0x31,0x59,0x5F,0x7F,0x83,0x0E,0x01,0x91,0xB4,0xD1,0xB0,0xCE,
-  0xFD,0x2F,0xFE,0x60,0x26,0x1F,0x07,0xB0,0x01,0x7F,0x01,0x16,0x01,0x3C,0xFE,0x80,
-  0xFE,0xB1,0xFE,0xC8,0xFE,0xAB,0x4E,0x85,0x52,0x01,0x9E,0x01,0x72,0x01,0x8D,0x01,
-  0xCF,0xFE,0x78,0xFE,0xAD,0xE7,0xFE,0xE9,0x02,0xB6,0x15,0xBB,0x93,0xFC,0x01,0x38,
-  0x00,0x02,0x00,0x21,0x00,0x00,0x04,0xAC,0x05,0xBC,0x00,0x07,0x00,0x0E,0x00,0xA8,
-  0x40,0x0A,0x02,0x0E,0x03,0x08,0x01,0x00,0xB7,0x06,0x01,0x06,0xB8,0xFF,0xF8,0x40,
-  0x62,0x0E,0x11,0x48,0x47,0x06,0x01,0x26,0x06,0x01,0x17,0x06,0x01,0x06,0x06,0x01,
-  0x06,0xB8,0x05,0x01,0x05,0x08,0x0E,0x11,0x48,0x48,0x05,0x01,0x29,0x05,0x01,0x18,
-  0x05,0x01,0x09,0x05,0x01,0x05,0x0B,0x0B,0x04,0x58,0x00,0x01,0x48,0x00,0x01,0x2A,
-  0x00,0x01,0x09,0x00,0x19,0x00,0x02,0x00,0x07,0x07,0x10,0x57,0x03,0x01,0x47,0x03,
-  0x01,0x25,0x03,0x01,0x06,0x03,0x16,0x03,0x02,0x03,0x04,0x02,0x5F,0x0B,0x10,0x11,
-  0x14,0x48,0x0B,0x10,0x0B,0x0E,0x48,0x1D,0x0B,0x01,0x0B,0x05,0x0E,0x0E,0x05,0x03,
-  0x04,0x00,0x12,0x00,0x3F,0x32,0x3F,0x39,0x2F,0x12,0x39,0x5D,0x2B,0x2B,0xE1,0x01,
-  0x2F,0x33,0x5D,0x5D,0x5D,0x5D,0x11,0x33,0x2F,0x33,0x5D,0x5D,0x5D,0x5D,0x12,0x39,
-  0x3D,0x2F,0x33,0x5D,0x5D,0x5D,0x5D,0x2B,0x5D,0x33,0x5D,0x5D,0x5D,0x5D,0x2B,0x5D,
-  0x12,0x39,0x39,0x12,0x39,0x39,0x31,0x30,0x21,0x03,0x21,0x03,0x23,0x01,0x33,0x01,
-  0x01,0x03,0x26,0x27,0x06,0x07,0x03,0x03,0xEC,0x90,0xFE,0x15,0x92,0xBE,0x01,0xE3,
-  0xC3,0x01,0xE5,0xFE,0x7B,0x85,0x27,0x17,0x14,0x1A,0x90,0x01,0xC5,0xFE,0x3B,0x05,
-  0xBC,0xFA,0x44,0x02,0x6A,0x01,0xA8,0x7C,0x66,0x63,0x54,0xFE,0x2D,0x00,0x00,0x03,
-  0x00,0x87,0x00,0x00,0x04,0x71,0x05,0xB6,0x00,0x0E,0x00,0x17,0x00,0x1E,0x00,0x52,
-  0x40,0x32,0x13,0x5B,0x14,0x07,0x24,0x07,0x02,0x07,0x04,0x04,0x0E,0x1C,0x5B,0x0A,
-  0x20,0x0F,0x19,0x5A,0x00,0x0E,0x01,0x00,0x0E,0x10,0x0E,0xF0,0x0E,0x03,0x08,0x0E,
-  0x07,0x18,0x60,0x9F,0x0F,0x01,0x68,0x0F,0x01,0x0F,0x0F,0x00,0x19,0x60,0x0E,0x12,
-  0x17,0x60,0x00,0x03,0x00,0x3F,0xE1,0x3F,0xE1,0x11,0x39,0x2F,0x5D,0x5D,0xE1,0x39,
-  0x01,0x2F,0x5E,0x5D,0x71,0xE1,0x32,0x10,0xDE,0xE1,0x12,0x39,0x2F,0x39,0x5D,0xE1,
-  0x31,0x30,0x13,0x21,0x20,0x16,0x15,0x14,0x06,0x07,0x15,0x04,0x11,0x14,0x06,0x23,
-  0x21,0x13,0x21,0x32,0x36,0x35,0x34,0x26,0x23,0x21,0x11,0x11,0x21,0x20,0x11,0x34,
-  0x21,0x87,0x01,0xB8,0x01,0x12,0xF7,0x9D,0x86,0x01,0x4C,0xFF,0xDC,0xFD,0xF1,0xBB,
-  0x01,0x1C,0x9C,0x8F,0x99,0xA6,0xFE,0xF8,0x01,0x33,0x01,0x37,0xFE,0xBC,0x05,0xB6,
-  0xAF,0xC3,0x80,0xAA,0x12,0x0A,0x36,0xFE,0xE0,0xC6,0xE2,0x03,0x4A,0x6E,0x7F,0x78,
-  0x68,0xFD,0x97,0xFD,0xF0,0x01,0x12,0xFE,0x00,0x01,0x00,0x81,0xFF,0xEC,0x04,0x9C,
-  0x05,0xCB,0x00,0x15,0x00,0x31,0x40,0x1C,0x01,0x40,0x14,0x18,0x48,0x01,0x01,0x06,
-  0x0B,0x17,0x11,0x5B,0x00,0x06,0xF0,0x06,0x02,0x06,0x0C,0x0E,0x5F,0x09,0x04,0x00,
-  0x14,0x5F,0x03,0x13,0x00,0x3F,0xE1,0x32,0x3F,0xE1,0x32,0x01,0x2F,0x5D,0xE1,0x10,
-  0xCE,0x11,0x39,0x2F,0x2B,0x31,0x30,0x25,0x15,0x06,0x23,0x20,0x00,0x11,0x10,0x00,
-  0x21,0x32,0x17,0x07,0x26,0x23,0x22,0x00,0x11,0x10,0x12,0x33,0x32,0x04,0x64,0x92,
-  0xD4,0xFE,0xCB,0xFE,0xB8,0x01,0x66,0x01,0x36,0xDC,0xA3,0x4E,0x9A,0x97,0xD7,0xFF,
-  0x00,0xF0,0xE7,0x82,0xC9,0xA2,0x3B,0x01,0x88,0x01,0x69,0x01,0x5A,0x01,0x94,0x56,
-  0x9C,0x4E,0xFE,0xC3,0xFE,0xF1,0xFE,0xE1,0xFE,0xD3,0x00,0x02,0x00,0x87,0x00,0x00,
-  0x04,0x7B,0x05,0xB6,0x00,0x08,0x00,0x0F,0x00,0x2C,0x40,0x1A,0x0D,0x5B,0x05,0x11,
-  0x0A,0x5A,0x00,0x00,0x01,0x00,0x00,0x10,0x00,0xF0,0x00,0x03,0x08,0x00,0x09,0x60,
-  0x01,0x03,0x0A,0x60,0x00,0x12,0x00,0x3F,0xE1,0x3F,0xE1,0x01,0x2F,0x5E,0x5D,0x71,
-  0xE1,0x10,0xDE,0xE1,0x31,0x30,0x33,0x11,0x21,0x20,0x00,0x11,0x10,0x00,0x21,0x03,
-  0x11,0x33,0x20,0x11,0x10,0x21,0x87,0x01,0x56,0x01,0x3D,0x01,0x61,0xFE,0x92,0xFE,
-  0xA7,0x72,0x60,0x02,0x14,0xFE,0x13,0x05,0xB6,0xFE,0x86,0xFE,0xAD,0xFE,0x97,0xFE,
-  0x80,0x05,0x17,0xFB,0x89,0x02,0x43,0x02,0x34,0x00,0x00,0x01,0x00,0xD9,0x00,0x00,
-  0x04,0x23,0x05,0xB6,0x00,0x0B,0x00,0x40,0x40,0x25,0x08,0x08,0x01,0x04,0x00,0x40,
-  0x12,0x16,0x48,0x00,0x0D,0x06,0x0A,0x5A,0xF0,0x01,0x01,0x00,0x01,0x01,0x01,0x09,
-  0x5F,0x68,0x06,0x01,0x06,0x06,0x0A,0x05,0x5F,0x02,0x03,0x0A,0x5F,0x01,0x12,0x00,
-  0x3F,0xE1,0x3F,0xE1,0x12,0x39,0x2F,0x5D,0xE1,0x01,0x2F,0x5D,0x5D,0xE1,0x32,0x10,
-  0xCE,0x2B,0x32,0x11,0x39,0x2F,0x31,0x30,0x21,0x21,0x11,0x21,0x15,0x21,0x11,0x21,
-  0x15,0x21,0x11,0x21,0x04,0x23,0xFC,0xB6,0x03,0x4A,0xFD,0x70,0x02,0x69,0xFD,0x97,
-  0x02,0x90,0x05,0xB6,0xA4,0xFE,0x3C,0xA2,0xFD,0xF8,0x00,0x01,0x00,0xF4,0x00,0x00,
-  0x04,0x3D,0x05,0xB6,0x00,0x09,0x00,0x57,0x40,0x16,0x08,0x08,0x01,0xDF,0x03,0x01,
-  0xC0,0x03,0x01,0x03,0x0B,0x06,0x00,0x5A,0x00,0x01,0x40,0x01,0x50,0x01,0x03,0x01,
-  0xB8,0xFF,0xC0,0x40,0x20,0x15,0x18,0x48,0x01,0x09,0x5F,0x68,0x06,0x01,0x2F,0x06,
-  0x5F,0x06,0xEF,0x06,0xFF,0x06,0x04,0x06,0x40,0x10,0x15,0x48,0x06,0x06,0x00,0x05,
-  0x5F,0x02,0x03,0x00,0x12,0x00,0x3F,0x3F,0xE1,0x12,0x39,0x2F,0x2B,0x5D,0x5D,0xE1,
-  0x01,0x2F,0x2B,0x5D,0xE1,0x32,0x10,0xCE,0x5D,0x5D,0x11,0x39,0x2F,0x30,0x31,0x21,
-  0x23,0x11,0x21,0x15,0x21,0x11,0x21,0x15,0x21,0x01,0xAE,0xBA,0x03,0x49,0xFD,0x71,
-  0x02,0x69,0xFD,0x97,0x05,0xB6,0xA4,0xFD,0xFC,0xA4,0x00,0x01,0x00,0x75,0xFF,0xEC,
-  0x04,0x46,0x05,0xCB,0x00,0x18,0x00,0x3F,0x40,0x25,0x00,0x07,0x16,0x5A,0x0C,0x02,
-  0x1A,0x12,0x5B,0x00,0x07,0x01,0x07,0x18,0x5F,0x2F,0x00,0x5F,0x00,0x02,0x00,0x40,
-  0x10,0x18,0x48,0x00,0x00,0x14,0x0F,0x5F,0x0D,0x0A,0x04,0x14,0x5F,0x04,0x13,0x00,
-  0x3F,0xE1,0x3F,0x33,0xE1,0x12,0x39,0x2F,0x2B,0x5D,0xE1,0x01,0x2F,0x5D,0xE1,0x10,
-  0xDE,0x32,0xE1,0x12,0x39,0x31,0x30,0x01,0x21,0x11,0x06,0x23,0x20,0x00,0x11,0x10,
-  0x00,0x21,0x32,0x17,0x07,0x26,0x23,0x22,0x02,0x11,0x10,0x21,0x32,0x37,0x11,0x23,
-  0x02,0xA0,0x01,0xA6,0xC3,0xE1,0xFE,0xFA,0xFE,0xD9,0x01,0x44,0x01,0x1C,0xC0,0x9A,
-  0x48,0x92,0x86,0xC0,0xD6,0x01,0x8A,0x61,0x69,0xED,0x03,0x04,0xFD,0x33,0x4B,0x01,
-  0x8F,0x01,0x62,0x01,0x5F,0x01,0x8F,0x56,0xA2,0x54,0xFE,0xC9,0xFE,0xEB,0xFD,0xB4,
-  0x1D,0x01,0xB4,0x00,0x00,0x01,0x00,0x87,0x00,0x00,0x04,0x46,0x05,0xB6,0x00,0x0B,
-  0x00,0x3F,0x40,0x26,0x09,0x01,0x5A,0x00,0x0D,0x08,0x04,0x5A,0x10,0x05,0x20,0x05,
-  0x02,0x20,0x05,0x30,0x05,0x02,0x05,0x03,0x5F,0x98,0x08,0x01,0x0F,0x08,0x2F,0x08,
-  0x02,0x06,0x08,0x08,0x0A,0x06,0x03,0x05,0x00,0x12,0x00,0x3F,0x32,0x3F,0x33,0x39,
-  0x2F,0x5E,0x5D,0x5D,0xE1,0x01,0x2F,0x5D,0x71,0xE1,0x32,0x10,0xDE,0xE1,0x32,0x31,
-  0x30,0x21,0x23,0x11,0x21,0x11,0x23,0x11,0x33,0x11,0x21,0x11,0x33,0x04,0x46,0xBB,
-  0xFD,0xB7,0xBB,0xBB,0x02,0x49,0xBB,0x02,0xAA,0xFD,0x56,0x05,0xB6,0xFD,0x98,0x02,
-  0x68,0x00,0x00,0x01,0x00,0xE1,0x00,0x00,0x03,0xE9,0x05,0xB6,0x00,0x0B,0x00,0x43,
-  0x40,0x28,0x0B,0x08,0x0A,0x5A,0x05,0x02,0xD0,0x03,0x01,0xA2,0x03,0x01,0x93,0x03,
-  0x01,0x03,0x8E,0x03,0x01,0x04,0x63,0x03,0x01,0x05,0x10,0x03,0x50,0x03,0x02,0x03,
-  0x09,0x04,0x61,0x06,0x03,0x03,0x0A,0x61,0x00,0x12,0x00,0x3F,0xE1,0x32,0x3F,0xE1,
-  0x32,0x01,0x2F,0x5D,0x5F,0x5D,0x5F,0x5D,0x5F,0x5D,0x5D,0x5D,0x33,0x33,0xE1,0x32,
-  0x32,0x31,0x30,0x21,0x21,0x35,0x25,0x11,0x25,0x35,0x21,0x15,0x05,0x11,0x05,0x03,
-  0xE9,0xFC,0xF8,0x01,0x27,0xFE,0xD9,0x03,0x08,0xFE,0xDA,0x01,0x26,0x7B,0x14,0x04,
-  0x98,0x14,0x7B,0x7B,0x14,0xFB,0x68,0x14,0x00,0x01,0x00,0x89,0xFF,0xEC,0x03,0xD3,
-  0x05,0xB6,0x00,0x0D,0x00,0x2B,0xB2,0x06,0x5A,0x09,0xB8,0xFF,0xC0,0x40,0x14,0x09,
-  0x0C,0x48,0x09,0x0F,0x00,0x00,0xE0,0x00,0xF0,0x00,0x03,0x00,0x03,0x5F,0x01,0x0C,
-  0x13,0x07,0x03,0x00,0x3F,0x3F,0x33,0xE1,0x01,0x2F,0x5D,0x10,0xDE,0x2B,0xE1,0x31,
-  0x30,0x37,0x35,0x16,0x33,0x32,0x36,0x35,0x11,0x33,0x11,0x14,0x04,0x23,0x22,0x89,
-  0xA2,0x93,0xA1,0xBA,0xBA,0xFE,0xE7,0xED,0xD9,0x27,0xA6,0x3E,0x9F,0x93,0x03,0xF5,
-  0xFC,0x0D,0xD8,0xFF,0x00,0x01,0x00,0xD3,0x00,0x00,0x04,0xAE,0x05,0xB6,0x00,0x0C,
-  0x00,0xC9,0xB7,0x26,0x0C,0x36,0x0C,0x46,0x0C,0x03,0x0C,0xB8,0xFF,0xF0,0x40,0x89,
-  0x10,0x18,0x48,0xF8,0x0A,0x01,0xD9,0x0A,0xE9,0x0A,0x02,0xC8,0x0A,0x01,0xB9,0x0A,
-  0x01,0xA8,0x0A,0x01,0x89,0x0A,0x01,0x0A,0x08,0x0C,0x10,0x48,0x79,0x09,0x01,0x58,
-  0x09,0x01,0x19,0x09,0x01,0x0A,0x09,0x01,0x88,0x01,0x01,0x01,0x08,0x14,0x18,0x48,
-  0x01,0x08,0x0C,0x0F,0x48,0xE8,0x02,0x01,0x02,0x10,0x0B,0x16,0x48,0x47,0x02,0x01,
-  0x02,0x0C,0x00,0x08,0x04,0x5A,0x00,0x05,0x60,0x05,0x70,0x05,0x80,0x05,0x04,0x05,
-  0x0B,0x10,0x0B,0x0B,0xD0,0x00,0xF0,0x00,0x02,0x7F,0x00,0x01,0x00,0x00,0x10,0x00,
-  0x40,0x00,0x60,0x00,0x04,0x00,0x10,0x00,0xA6,0x08,0xB6,0x08,0xC6,0x08,0x03,0x77,
-  0x08,0x87,0x08,0x02,0x26,0x08,0x36,0x08,0x56,0x08,0x66,0x08,0x04,0x03,0x02,0x08,
-  0x0C,0x04,0x05,0x0A,0x06,0x03,0x05,0x00,0x12,0x00,0x3F,0x32,0x3F,0x33,0x12,0x17,
-  0x39,0x5D,0x5D,0x5D,0x01,0x2F,0x38,0x5D,0x5D,0x5D,0x33,0x2F,0x38,0x2F,0x5D,0xE1,
-  0x32,0x11,0x39,0x39,0x5D,0x31,0x30,0x00,0x2B,0x5D,0x01,0x2B,0x2B,0x5D,0x5D,0x5D,
-  0x5D,0x5D,0x2B,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x2B,0x5D,0x21,0x23,0x01,0x07,0x11,
-  0x23,0x11,0x33,0x11,0x37,0x01,0x33,0x01,0x04,0xAE,0xD3,0xFE,0x3E,0x8C,0xBA,0xBA,
-  0x79,0x01,0xC5,0xD1,0xFD,0xF7,0x02,0xBA,0x72,0xFD,0xB8,0x05,0xB6,0xFD,0x25,0xA8,
-  0x02,0x33,0xFD,0x83,0x00,0x01,0x00,0xE9,0x00,0x00,0x04,0x1F,0x05,0xB6,0x00,0x05,
-  0x00,0x2E,0x40,0x1F,0x05,0x40,0x12,0x16,0x48,0x05,0x07,0x03,0x5A,0x00,0x00,0x50,
-  0x00,0x60,0x00,0x70,0x00,0xD0,0x00,0xE0,0x00,0xF0,0x00,0x07,0x00,0x01,0x03,0x03,
-  0x5F,0x00,0x12,0x00,0x3F,0xE1,0x3F,0x01,0x2F,0x5D,0xE1,0x10,0xCE,0x2B,0x31,0x30,
-  0x33,0x11,0x33,0x11,0x21,0x15,0xE9,0xBB,0x02,0x7B,0x05,0xB6,0xFA,0xF0,0xA6,0x00,
-  0x00,0x01,0x00,0x71,0x00,0x00,0x04,0x5C,0x05,0xB6,0x00,0x13,0x00,0xB6,0x40,0x0C,
-  0xF7,0x13,0x01,0xB6,0x13,0x01,0x97,0x13,0xA7,0x13,0x02,0x13,0xB8,0xFF,0xF0,0x40,
-  0x25,0x0D,0x11,0x48,0x27,0x13,0x01,0x06,0x13,0x16,0x13,0x02,0xE9,0x0B,0xF9,0x0B,
-  0x02,0x0B,0x20,0x0D,0x16,0x48,0x3A,0x0B,0x01,0x09,0x0B,0x19,0x0B,0x29,0x0B,0x03,
-  0xE6,0x08,0xF6,0x08,0x02,0x08,0xB8,0xFF,0xE0,0x40,0x4D,0x0D,0x16,0x48,0x35,0x08,
-  0x01,0x06,0x08,0x16,0x08,0x26,0x08,0x03,0xF8,0x00,0x01,0xB9,0x00,0x01,0x98,0x00,
-  0xA8,0x00,0x02,0x00,0x10,0x0D,0x11,0x48,0x28,0x00,0x01,0x09,0x00,0x19,0x00,0x02,
-  0x11,0x0E,0xFA,0xE0,0x0D,0xF0,0x0D,0x02,0x0F,0x0D,0x01,0x0D,0x15,0x02,0x05,0xFA,
-  0x00,0x06,0x10,0x06,0x40,0x06,0x50,0x06,0x04,0x06,0x0B,0x01,0x07,0x03,0x12,0x02,
-  0x0E,0x59,0x09,0x01,0x09,0x06,0x00,0x12,0x00,0x3F,0x32,0x32,0x5D,0x32,0x2E,0x33,
-  0x3F,0x33,0x33,0x01,0x2F,0x5D,0xE1,0x32,0x10,0xDE,0x5D,0x5D,0xE1,0x32,0x31,0x30,
-  0x5D,0x5D,0x2B,0x5D,0x5D,0x5D,0x5D,0x5D,0x2B,0x5D,0x5D,0x5D,0x2B,0x5D,0x5D,0x5D,
-  0x2B,0x5D,0x5D,0x5D,0x21,0x01,0x23,0x12,0x15,0x11,0x23,0x11,0x33,0x13,0x33,0x13,
-  0x33,0x11,0x23,0x11,0x34,0x13,0x23,0x01,0x02,0x14,0xFE,0xEA,0x08,0x12,0x97,0xF7,
-  0xF8,0x06,0xFA,0xFC,0x99,0x0E,0x08,0xFE,0xE5,0x05,0x00,0xFE,0xF6,0x8C,0xFC,0x96,
-  0x05,0xB6,0xFB,0x58,0x04,0xA8,0xFA,0x4A,0x03,0x77,0x66,0x01,0x21,0xFB,0x02,0x00,
-  0x00,0x01,0x00,0x87,0x00,0x00,0x04,0x44,0x05,0xB6,0x00,0x0F,0x00,0x73,0xB9,0x00,
-  0x09,0xFF,0xF0,0x40,0x4E,0x10,0x18,0x48,0x45,0x09,0x55,0x09,0x65,0x09,0x03,0x34,
-  0x09,0x01,0x15,0x09,0x25,0x09,0x02,0x06,0x09,0x01,0x01,0x10,0x10,0x18,0x48,0x4A,
-  0x01,0x5A,0x01,0x6A,0x01,0x03,0x3B,0x01,0x01,0x1A,0x01,0x2A,0x01,0x02,0x09,0x01,
-  0x01,0x01,0x0E,0xFB,0x0F,0x11,0x09,0x06,0xFB,0x00,0x07,0xE0,0x07,0xF0,0x07,0x03,
-  0x07,0x0E,0x49,0x02,0x59,0x02,0x02,0x02,0x08,0x03,0x46,0x0A,0x56,0x0A,0x02,0x0A,
-  0x07,0x00,0x12,0x00,0x3F,0x32,0x32,0x5D,0x3F,0x33,0x5D,0x33,0x01,0x2F,0x5D,0xE1,
-  0x32,0x10,0xDE,0xE1,0x32,0x31,0x30,0x5D,0x5D,0x5D,0x5D,0x2B,0x5D,0x5D,0x5D,0x5D,
-  0x2B,0x21,0x23,0x01,0x23,0x12,0x15,0x11,0x23,0x11,0x33,0x01,0x33,0x02,0x35,0x11,
-  0x33,0x04,0x44,0xD7,0xFD,0xBC,0x08,0x12,0xAC,0xD5,0x02,0x42,0x06,0x0E,0xAE,0x04,
-  0xBA,0xFE,0xEB,0x8C,0xFC,0xE7,0x05,0xB6,0xFB,0x4C,0x01,0x2F,0x65,0x03,0x20,0x00,
-  0x00,0x02,0x00,0x54,0xFF,0xEC,0x04,0x7B,0x05,0xCD,0x00,0x09,0x00,0x13,0x00,0x24,
-  0x40,0x14,0x0D,0x5B,0x07,0x15,0x12,0x5B,0x1F,0x02,0x2F,0x02,0x02,0x02,0x10,0x5F,
-  0x04,0x04,0x0A,0x5F,0x00,0x13,0x00,0x3F,0xE1,0x3F,0xE1,0x01,0x2F,0x5D,0xE1,0x10,
-  0xDE,0xE1,0x31,0x30,0x05,0x20,0x11,0x10,0x21,0x20,0x00,0x11,0x10,0x00,0x27,0x32,
-  0x12,0x11,0x10,0x02,0x23,0x20,0x11,0x10,0x02,0x68,0xFD,0xEC,0x02,0x16,0x01,0x00,
-  0x01,0x11,0xFE,0xEC,0xFF,0xAD,0xA1,0xA3,0xA9,0xFE,0xAF,0x14,0x02,0xF3,0x02,0xEE,
-  0xFE,0x79,0xFE,0x97,0xFE,0x97,0xFE,0x78,0xA3,0x01,0x22,0x01,0x2C,0x01,0x2F,0x01,
-  0x1D,0xFD,0xB4,0xFD,0xB2,0x00,0x00,0x02,0x00,0xB0,0x00,0x00,0x04,0x46,0x05,0xB6,
-  0x00,0x09,0x00,0x11,0x00,0x38,0x40,0x22,0x0E,0x5B,0xEF,0x06,0xFF,0x06,0x02,0x06,
-  0x13,0x0A,0x01,0x5A,0x00,0x02,0x90,0x02,0xA0,0x02,0x03,0x02,0x00,0x60,0x9F,0x0A,
-  0x01,0x0A,0x0A,0x01,0x11,0x60,0x03,0x03,0x01,0x12,0x00,0x3F,0x3F,0xE1,0x12,0x39,
-  0x2F,0x5D,0xE1,0x01,0x2F,0x5D,0xE1,0x32,0x10,0xDE,0x5D,0xE1,0x31,0x30,0x01,0x11,
-  0x23,0x11,0x21,0x20,0x11,0x14,0x04,0x21,0x27,0x33,0x32,0x36,0x35,0x10,0x21,0x23,
-  0x01,0x6A,0xBA,0x01,0x94,0x02,0x02,0xFE,0xEB,0xFE,0xF8,0xBF,0xAA,0xC6,0xAB,0xFE,
-  0xAE,0xC9,0x02,0x39,0xFD,0xC7,0x05,0xB6,0xFE,0x54,0xDB,0xF6,0x9E,0x90,0x99,0x01,
-  0x17,0x00,0x00,0x02,0x00,0x54,0xFE,0x62,0x04,0x7B,0x05,0xCD,0x00,0x0F,0x00,0x19,
-  0x00,0x55,0xB9,0x00,0x00,0xFF,0xF0,0x40,0x30,0x0D,0x11,0x48,0x05,0x00,0x09,0x13,
-  0x5B,0x0E,0x6C,0x03,0x7C,0x03,0x8C,0x03,0x03,0x03,0x18,0x0B,0x0E,0x48,0x03,0x02,
-  0x02,0x0E,0x1B,0x18,0x5B,0x1F,0x09,0x2F,0x09,0x02,0x09,0x16,0x5F,0x0B,0x04,0x10,
-  0x5F,0x07,0x05,0x07,0x03,0x03,0x00,0x07,0x13,0x00,0x3F,0x33,0x33,0x2F,0x11,0x33,
-  0x10,0xE1,0x3F,0xE1,0x01,0x2F,0x5D,0xE1,0x10,0xCE,0x32,0x2F,0x33,0x2B,0x5D,0x10,
-  0xE1,0x12,0x39,0x39,0x31,0x30,0x2B,0x25,0x16,0x17,0x07,0x26,0x27,0x06,0x23,0x20,
-  0x11,0x10,0x21,0x20,0x00,0x11,0x10,0x05,0x32,0x12,0x11,0x10,0x02,0x23,0x20,0x11,
-  0x10,0x03,0x5E,0x55,0xC2,0x79,0xEC,0x5C,0x24,0x28,0xFD,0xEC,0x02,0x16,0x01,0x00,
-  0x01,0x11,0xFD,0xED,0xAD,0xA1,0xA3,0xA9,0xFE,0xAF,0x27,0xB4,0x83,0x8E,0xAB,0xE5,
-  0x06,0x02,0xF3,0x02,0xEE,0xFE,0x79,0xFE,0x97,0xFD,0xF2,0x40,0x01,0x22,0x01,0x2C,
-  0x01,0x2F,0x01,0x1D,0xFD,0xB4,0xFD,0xB2,0x00,0x02,0x00,0xBA,0x00,0x00,0x04,0x93,
-  0x05,0xB6,0x00,0x0B,0x00,0x14,0x00,0x73,0x40,0x4B,0x2B,0x0E,0x01,0x1A,0x0E,0x01,
-  0x0B,0x08,0x10,0x18,0x48,0x29,0x0B,0x01,0x18,0x0B,0x01,0x0A,0x08,0x12,0x18,0x48,
-  0x29,0x0A,0x01,0x08,0x0A,0x01,0x0A,0x09,0x10,0x09,0x09,0x46,0x08,0x01,0x0B,0x08,
-  0x01,0x10,0x5B,0x06,0x40,0x13,0x16,0x48,0x06,0x16,0x0C,0x01,0x5A,0x00,0x02,0x80,
-  0x02,0x90,0x02,0xA0,0x02,0x04,0x02,0x08,0x03,0x00,0x60,0x0C,0x0C,0x01,0x14,0x60,
-  0x03,0x03,0x0A,0x01,0x12,0x00,0x3F,0x33,0x3F,0xE1,0x12,0x39,0x2F,0xE1,0x11,0x39,
-  0x01,0x2F,0x5D,0xE1,0x32,0x10,0xDE,0x2B,0xE1,0x12,0x39,0x39,0x5D,0x33,0x2F,0x38,
-  0x33,0x31,0x30,0x5D,0x5D,0x2B,0x5D,0x5D,0x2B,0x5D,0x5D,0x01,0x11,0x23,0x11,0x21,
-  0x20,0x11,0x10,0x05,0x01,0x23,0x01,0x27,0x33,0x32,0x36,0x35,0x34,0x26,0x23,0x23,
-  0x01,0x75,0xBB,0x01,0x65,0x02,0x08,0xFE,0xDF,0x01,0x8D,0xDB,0xFE,0xA2,0xE5,0xA4,
-  0xAB,0xA2,0xA0,0xB2,0x9F,0x02,0x5C,0xFD,0xA4,0x05,0xB6,0xFE,0x61,0xFE,0xE1,0x69,
-  0xFD,0x71,0x02,0x5C,0x9E,0x84,0x90,0x8D,0x7C,0x00,0x00,0x01,0x00,0x8D,0xFF,0xEC,
-  0x04,0x3F,0x05,0xCB,0x00,0x1F,0x00,0x38,0x40,0x1F,0x10,0x10,0x05,0x5A,0xB0,0x1B,
-  0xC0,0x1B,0x02,0x1B,0x21,0x15,0x5A,0x0B,0x00,0x00,0x00,0x0B,0x01,0x0B,0x15,0x05,
-  0x0E,0x03,0x60,0x1E,0x13,0x13,0x5F,0x0E,0x04,0x00,0x3F,0xE1,0x3F,0xE1,0x12,0x39,
-  0x39,0x01,0x2F,0x5D,0x33,0x2F,0x10,0xE1,0x10,0xDE,0x5D,0xE1,0x33,0x2F,0x31,0x30,
-  0x37,0x35,0x16,0x33,0x20,0x35,0x34,0x26,0x27,0x26,0x26,0x35,0x34,0x24,0x33,0x32,
-  0x17,0x07,0x26,0x23,0x20,0x15,0x14,0x16,0x17,0x16,0x16,0x15,0x14,0x04,0x23,0x20,
-  0x8D,0xD3,0xCB,0x01,0x5E,0x8D,0xD7,0xD0,0xB5,0x01,0x01,0xE0,0xE5,0xBB,0x40,0xC1,
-  0xA7,0xFE,0xDB,0x83,0xCD,0xF6,0xA5,0xFE,0xEB,0xFF,0xFE,0xF7,0x31,0xB2,0x56,0xF0,
-  0x68,0x70,0x4D,0x49,0xCB,0xA2,0xAE,0xC5,0x4E,0xA4,0x4E,0xD1,0x66,0x7C,0x47,0x58,
-  0xBB,0x93,0xC0,0xDB,0x00,0x01,0x00,0x66,0x00,0x00,0x04,0x64,0x05,0xB6,0x00,0x07,
-  0x00,0x3C,0x40,0x24,0x06,0x06,0x00,0x5A,0x03,0xD0,0x01,0x01,0xA2,0x01,0x01,0x93,
-  0x01,0x01,0x03,0x8E,0x01,0x01,0x04,0x63,0x01,0x01,0x05,0x10,0x01,0x50,0x01,0x02,
-  0x01,0x07,0x03,0x5F,0x04,0x03,0x00,0x12,0x00,0x3F,0x3F,0xE1,0x32,0x01,0x2F,0x5D,
-  0x5F,0x5D,0x5F,0x5D,0x5F,0x5D,0x5D,0x5D,0xC6,0xF1,0xC2,0x2F,0x31,0x30,0x21,0x23,
-  0x11,0x21,0x35,0x21,0x15,0x21,0x02,0xC3,0xBB,0xFE,0x5E,0x03,0xFE,0xFE,0x5F,0x05,
-  0x12,0xA4,0xA4,0x00,0x00,0x01,0x00,0x7D,0xFF,0xEC,0x04,0x50,0x05,0xB8,0x00,0x0E,
-  0x00,0x27,0x40,0x16,0x0D,0x5A,0xE0,0x01,0xF0,0x01,0x02,0x01,0x10,0x09,0x5A,0x00,
-  0x06,0x01,0x06,0x0B,0x5F,0x04,0x13,0x07,0x00,0x03,0x00,0x3F,0x32,0x3F,0xE1,0x01,
-  0x2F,0x5D,0xE1,0x10,0xDE,0x5D,0xE1,0x31,0x30,0x01,0x11,0x10,0x02,0x23,0x20,0x11,
-  0x11,0x33,0x11,0x10,0x21,0x20,0x13,0x11,0x04,0x50,0xFC,0xF4,0xFE,0x1D,0xBA,0x01,
-  0x33,0x01,0x27,0x05,0x05,0xB8,0xFC,0x4C,0xFE,0xFC,0xFE,0xEC,0x02,0x1C,0x03,0xAE,
-  0xFC,0x5C,0xFE,0x7D,0x01,0x85,0x03,0xA4,0x00,0x01,0x00,0x21,0x00,0x00,0x04,0xAC,
-  0x05,0xB6,0x00,0x0A,0x00,0x99,0x40,0x18,0x67,0x05,0x01,0xB8,0x03,0x01,0x03,0x08,
-  0x0D,0x11,0x48,0x29,0x03,0x01,0x18,0x03,0x01,0x09,0x03,0x01,0xB7,0x02,0x01,0x02,
-  0xB8,0xFF,0xF8,0x40,0x3B,0x0D,0x11,0x48,0x26,0x02,0x01,0x17,0x02,0x01,0x06,0x02,
-  0x01,0x68,0x00,0x01,0xE8,0x03,0x01,0x03,0xE7,0x02,0x01,0x02,0x08,0x08,0x04,0x48,
-  0x00,0x58,0x00,0x02,0x2A,0x00,0x01,0x09,0x00,0x19,0x00,0x02,0x00,0x01,0x01,0x0C,
-  0x47,0x05,0x57,0x05,0x02,0x25,0x05,0x01,0x06,0x05,0x16,0x05,0x02,0x05,0x04,0x08,
-  0xB8,0xFF,0xF0,0x40,0x0E,0x0B,0x18,0x48,0x12,0x08,0x01,0x08,0x03,0x01,0x04,0x03,
-  0x02,0x03,0x12,0x00,0x3F,0x33,0x3F,0x33,0x12,0x39,0x5D,0x2B,0x01,0x2F,0x33,0x5D,
-  0x5D,0x5D,0x11,0x33,0x2F,0x33,0x5D,0x5D,0x5D,0x12,0x39,0x3D,0x2F,0x33,0x5D,0x33,
-  0x5D,0x31,0x30,0x5D,0x5D,0x5D,0x5D,0x2B,0x5D,0x5D,0x5D,0x5D,0x2B,0x5D,0x5D,0x01,
-  0x33,0x01,0x23,0x01,0x33,0x01,0x16,0x17,0x36,0x37,0x03,0xE5,0xC7,0xFE,0x17,0xBB,
-  0xFE,0x19,0xC4,0x01,0x27,0x29,0x2F,0x1F,0x3E,0x05,0xB6,0xFA,0x4A,0x05,0xB6,0xFC,
-  0x61,0x7F,0xCF,0x91,0xC3,0x00,0x00,0x01,0x00,0x02,0x00,0x00,0x04,0xCB,0x05,0xB6,
-  0x00,0x19,0x01,0x63,0x40,0x54,0x29,0x19,0x39,0x19,0x02,0x08,0x19,0x18,0x19,0x02,
-  0x27,0x15,0x01,0x15,0x15,0x01,0x06,0x15,0x01,0x07,0x14,0x17,0x14,0x27,0x14,0x03,
-  0x26,0x10,0x36,0x10,0x02,0x29,0x0A,0x39,0x0A,0x02,0x28,0x06,0x01,0x19,0x06,0x01,
-  0x08,0x06,0x01,0x26,0x02,0x36,0x02,0x02,0x07,0x02,0x17,0x02,0x02,0x48,0x11,0x68,
-  0x11,0xA8,0x11,0xB8,0x11,0x04,0x29,0x11,0x39,0x11,0x02,0x11,0xE7,0x10,0xF7,0x10,
-  0x02,0xC6,0x10,0xD6,0x10,0x02,0xB4,0x10,0x01,0x10,0xB8,0xFF,0xF0,0x40,0x21,0x0F,
-  0x13,0x48,0x54,0x10,0x01,0x45,0x10,0x01,0x10,0x17,0xE6,0x01,0x01,0xC7,0x01,0xD7,
-  0x01,0x02,0xA5,0x01,0xB5,0x01,0x02,0x96,0x01,0x01,0x77,0x01,0x87,0x01,0x02,0x01,
-  0xB8,0xFF,0xF0,0x40,0x8C,0x09,0x0F,0x48,0x01,0xE9,0x00,0x01,0xC8,0x00,0xD8,0x00,
-  0x02,0xAA,0x00,0xBA,0x00,0x02,0x99,0x00,0x01,0x78,0x00,0x88,0x00,0x02,0x00,0x10,
-  0x09,0x0F,0x48,0x00,0x0D,0xE8,0x0A,0xF8,0x0A,0x02,0xC9,0x0A,0xD9,0x0A,0x02,0xBB,
-  0x0A,0x01,0x88,0x0A,0xA8,0x0A,0x02,0x69,0x0A,0x79,0x0A,0x02,0x5B,0x0A,0x01,0x4A,
-  0x0A,0x01,0x0A,0x67,0x09,0xA7,0x09,0xB7,0x09,0x03,0x26,0x09,0x36,0x09,0x46,0x09,
-  0x03,0x09,0x04,0x24,0x17,0x34,0x17,0x94,0x17,0xA4,0x17,0x04,0x04,0x04,0x14,0x04,
-  0x64,0x04,0xC4,0x04,0xD4,0x04,0x05,0x17,0x0D,0x04,0x04,0x0D,0x17,0x03,0x12,0x28,
-  0x07,0x01,0x07,0x10,0x08,0x01,0x08,0x08,0x1B,0x27,0x13,0x01,0x13,0x12,0x04,0x17,
-  0x4B,0x0D,0x5B,0x0D,0x02,0x0D,0x17,0x11,0x00,0x00,0x07,0x0A,0x11,0x12,0x12,0x07,
-  0x03,0x00,0x3F,0x33,0x3F,0x33,0x12,0x39,0x2F,0x12,0x39,0x39,0x5D,0x11,0x33,0x01,
-  0x2F,0x33,0x5D,0x11,0x33,0x2F,0x5D,0x33,0x5D,0x12,0x17,0x39,0x3D,0x2F,0x2F,0x2F,
-  0x5D,0x5D,0x11,0x33,0x5D,0x5D,0x33,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x11,0x33,
-  0x2B,0x5D,0x5D,0x5D,0x5D,0x5D,0x33,0x2B,0x5D,0x5D,0x5D,0x5D,0x5D,0x11,0x33,0x5D,
-  0x5D,0x2B,0x5D,0x5D,0x5D,0x33,0x5D,0x5D,0x31,0x30,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,
-  0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x01,0x33,0x13,0x16,0x17,0x36,0x13,0x13,0x33,
-  0x03,0x23,0x03,0x26,0x27,0x06,0x07,0x03,0x23,0x03,0x33,0x13,0x16,0x12,0x15,0x36,
-  0x37,0x02,0x10,0xB1,0x91,0x3D,0x0B,0x02,0x3F,0x46,0xAA,0xBB,0xBE,0xA8,0x28,0x1A,
-  0x20,0x21,0x9C,0xBE,0xCB,0xAA,0x58,0x17,0x22,0x18,0x2E,0x03,0xF0,0xFD,0xF7,0xDB,
-  0x58,0x35,0x02,0x36,0x02,0x97,0xFA,0x4A,0x02,0x44,0x8A,0x90,0xAD,0x6F,0xFD,0xBE,
-  0x05,0xB6,0xFD,0x69,0xB0,0xFE,0x6C,0x27,0x97,0xA1,0x00,0x01,0x00,0x35,0x00,0x00,
-  0x04,0x96,0x05,0xB6,0x00,0x0B,0x00,0xBE,0x40,0x24,0x08,0x08,0x09,0x0B,0x0B,0x0A,
-  0x00,0x07,0x00,0x05,0x05,0x04,0x02,0x02,0x03,0x01,0x06,0x01,0x08,0x08,0x07,0x05,
-  0x05,0x06,0x04,0x09,0x04,0x0B,0x0B,0x00,0x02,0x02,0x01,0x03,0x0A,0x07,0xB8,0xFF,
-  0xF8,0x40,0x17,0x0C,0x0F,0x48,0x06,0x07,0x16,0x07,0x26,0x07,0x03,0x09,0x08,0x0C,
-  0x0F,0x48,0x09,0x09,0x19,0x09,0x29,0x09,0x03,0x03,0xB8,0xFF,0xF8,0x40,0x3C,0x0C,
-  0x0F,0x48,0x06,0x03,0x16,0x03,0x26,0x03,0x03,0x01,0x08,0x0C,0x0F,0x48,0x09,0x01,
-  0x19,0x01,0x29,0x01,0x03,0x0B,0x08,0x02,0x05,0x04,0x04,0x09,0x0A,0x01,0x0A,0xAF,
-  0x00,0x01,0x00,0x00,0x0D,0x07,0x06,0x03,0x06,0x04,0x02,0x05,0x0B,0x08,0x04,0x07,
-  0x09,0x0A,0x03,0x06,0x03,0x01,0x03,0x04,0x03,0x00,0x12,0x00,0x3F,0x17,0x32,0x3F,
-  0x17,0x33,0x17,0x39,0x01,0x2F,0x33,0x33,0x2F,0x33,0x11,0x33,0x2F,0x5D,0x32,0x32,
-  0x2F,0x33,0x11,0x17,0x39,0x5D,0x2B,0x5D,0x2B,0x5D,0x2B,0x5D,0x2B,0x31,0x30,0x87,
-  0x08,0xC0,0x08,0xC0,0x10,0x87,0x08,0xC0,0x08,0xC0,0x10,0x87,0x08,0xC0,0x08,0xC0,
-  0x10,0x87,0x08,0xC0,0x08,0xC0,0x21,0x23,0x01,0x01,0x23,0x01,0x01,0x33,0x01,0x01,
-  0x33,0x01,0x04,0x96,0xD3,0xFE,0x9D,0xFE,0x92,0xBD,0x01,0xC5,0xFE,0x5A,0xC7,0x01,
-  0x4B,0x01,0x4E,0xBF,0xFE,0x5A,0x02,0x7B,0xFD,0x85,0x02,0xFC,0x02,0xBA,0xFD,0xD1,
-  0x02,0x2F,0xFD,0x4C,0x00,0x01,0x00,0x21,0x00,0x00,0x04,0xAA,0x05,0xB6,0x00,0x08,
-  0x00,0xB5,0xB9,0x00,0x08,0xFF,0xF8,0x40,0x24,0x0D,0x10,0x48,0x26,0x08,0x36,0x08,
-  0x02,0x17,0x08,0x01,0x68,0x01,0x78,0x01,0x02,0x5A,0x01,0x01,0x48,0x01,0x01,0x29,
-  0x01,0x39,0x01,0x02,0x18,0x01,0x01,0x27,0x00,0xB7,0x00,0x02,0x00,0xB8,0xFF,0xF8,
-  0xB3,0x0D,0x11,0x48,0x08,0xB8,0xFF,0xF8,0x40,0x4A,0x14,0x18,0x48,0x08,0xAF,0x07,
-  0xFF,0x07,0x02,0x59,0x07,0x01,0x07,0x05,0x01,0x08,0x14,0x18,0x48,0x01,0xE0,0x02,
-  0xF0,0x02,0x02,0x7B,0x02,0x01,0x50,0x02,0x01,0x02,0x02,0x00,0x04,0x5A,0xD0,0x05,
-  0x01,0xA2,0x05,0x01,0x93,0x05,0x01,0x03,0x8E,0x05,0x01,0x04,0x63,0x05,0x01,0x05,
-  0x10,0x05,0x50,0x05,0x02,0x05,0x06,0x06,0x34,0x00,0x01,0x00,0x03,0x03,0x01,0x04,
-  0x12,0x07,0x01,0x03,0x00,0x3F,0x33,0x3F,0x12,0x39,0x2F,0x33,0x5D,0x33,0x2F,0x01,
-  0x2F,0x5D,0x5F,0x5D,0x5F,0x5D,0x5F,0x5D,0x5D,0x5D,0xF1,0x39,0xC2,0x2F,0x5D,0x5D,
-  0x5D,0x32,0x2B,0x10,0xC6,0x5D,0x5D,0x32,0x2B,0x31,0x30,0x00,0x2B,0x5D,0x01,0x5D,
-  0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x2B,0x01,0x01,0x33,0x01,0x11,0x23,0x11,0x01,0x33,
-  0x02,0x64,0x01,0x7D,0xC9,0xFE,0x19,0xBB,0xFE,0x19,0xCB,0x02,0xD3,0x02,0xE3,0xFC,
-  0x83,0xFD,0xC7,0x02,0x2F,0x03,0x87,0x00,0x00,0x01,0x00,0x66,0x00,0x00,0x04,0x64,
-  0x05,0xB6,0x00,0x09,0x00,0x44,0x40,0x28,0x26,0x08,0x01,0x07,0x08,0x17,0x08,0x02,
-  0x29,0x03,0x01,0x08,0x03,0x18,0x03,0x02,0x03,0x07,0x07,0x00,0x00,0x01,0x00,0x00,
-  0x0B,0x08,0x02,0x04,0x04,0x02,0x07,0x04,0x5F,0x05,0x03,0x02,0x08,0x5F,0x01,0x12,
-  0x00,0x3F,0xE1,0x32,0x3F,0xE1,0x32,0x01,0x2F,0x33,0x2F,0x11,0x33,0x11,0x33,0x2F,
-  0x5D,0x33,0x2F,0x33,0x31,0x30,0x5D,0x5D,0x5D,0x5D,0x21,0x21,0x35,0x01,0x21,0x35,
-  0x21,0x15,0x01,0x21,0x04,0x64,0xFC,0x02,0x03,0x19,0xFC,0xFC,0x03,0xD5,0xFC,0xE7,
-  0x03,0x2D,0x91,0x04,0x7F,0xA6,0x91,0xFB,0x81,0x00,0x00,0x01,0x01,0x9C,0xFE,0xBC,
-  0x03,0xAC,0x05,0xB6,0x00,0x07,0x00,0x33,0x40,0x20,0x04,0x00,0x00,0x01,0x00,0x00,
-  0x09,0x06,0xF1,0x7F,0x01,0x8F,0x01,0xBF,0x01,0xCF,0x01,0xDF,0x01,0x05,0x00,0x01,
-  0x01,0x01,0x05,0xF5,0x02,0xF8,0x06,0xF5,0x01,0xF9,0x00,0x3F,0xE1,0x3F,0xE1,0x01,
-  0x2F,0x5D,0x5D,0xE1,0x11,0x33,0x2F,0x5D,0x33,0x31,0x30,0x01,0x21,0x11,0x21,0x15,
-  0x21,0x11,0x21,0x03,0xAC,0xFD,0xF0,0x02,0x10,0xFE,0xA6,0x01,0x5A,0xFE,0xBC,0x06,
-  0xFA,0x95,0xFA,0x31,0x00,0x01,0x00,0xD3,0x00,0x00,0x03,0xF8,0x05,0xB6,0x00,0x03,
-  0x00,0x1C,0x40,0x0C,0x02,0x01,0x01,0x05,0x00,0x03,0x03,0x04,0x02,0x12,0x00,0x03,
-  0x00,0x3F,0x3F,0x11,0x01,0x33,0x2F,0x33,0x11,0x33,0x2F,0x33,0x31,0x30,0x01,0x01,
-  0x23,0x01,0x01,0x85,0x02,0x73,0xB2,0xFD,0x8D,0x05,0xB6,0xFA,0x4A,0x05,0xB6,0x00,
-  0x00,0x01,0x01,0x21,0xFE,0xBC,0x03,0x31,0x05,0xB6,0x00,0x07,0x00,0x34,0xB7,0x01,
-  0xF1,0x70,0x06,0x80,0x06,0x02,0x06,0xB8,0xFF,0xC0,0x40,0x15,0x14,0x18,0x48,0x06,
-  0x06,0x09,0x03,0xE0,0x00,0xF0,0x00,0x02,0x00,0x01,0xF5,0x06,0xF9,0x02,0xF5,0x05,
-  0xF8,0x00,0x3F,0xE1,0x3F,0xE1,0x01,0x2F,0x5D,0x33,0x11,0x33,0x2F,0x2B,0x5D,0xE1,
-  0x31,0x30,0x05,0x21,0x11,0x21,0x35,0x21,0x11,0x21,0x01,0x21,0x01,0x5A,0xFE,0xA6,
-  0x02,0x10,0xFD,0xF0,0xAE,0x05,0xCF,0x95,0xF9,0x06,0x00,0x01,0x00,0x6F,0x02,0x25,
-  0x04,0x5E,0x05,0xC1,0x00,0x06,0x00,0x33,0x40,0x19,0x02,0x01,0x05,0x20,0x14,0x18,
-  0x48,0x05,0x05,0x00,0x04,0x03,0x08,0x06,0x00,0x00,0x07,0x04,0x00,0x00,0x05,0x0F,
-  0x01,0x01,0x01,0x00,0x2F,0x5D,0x33,0x33,0x2F,0x32,0x11,0x01,0x33,0x2F,0x32,0x10,
-  0xCE,0x32,0x11,0x39,0x3D,0x2F,0x2B,0x33,0x33,0x31,0x30,0x13,0x01,0x33,0x01,0x23,
-  0x01,0x01,0x6F,0x01,0xA8,0x66,0x01,0xE1,0xA2,0xFE,0x90,0xFE,0xC2,0x02,0x25,0x03,
-  0x9C,0xFC,0x64,0x02,0xDF,0xFD,0x21,0x00,0x00,0x01,0xFF,0xF0,0xFE,0xBC,0x04,0xDB,
-  0xFF,0x48,0x00,0x03,0x00,0x12,0xB6,0x00,0x00,0x05,0x01,0x01,0xBA,0x02,0x00,0x2F,
-  0xE1,0x01,0x2F,0x11,0x33,0x2F,0x31,0x30,0x01,0x21,0x35,0x21,0x04,0xDB,0xFB,0x15,
-  0x04,0xEB,0xFE,0xBC,0x8C,0x00,0x00,0x01,0x01,0xA2,0x04,0xD9,0x03,0x2B,0x06,0x21,
-  0x00,0x07,0x00,0x1F,0x40,0x10,0x05,0x87,0x04,0x86,0x01,0x00,0x00,0x09,0x05,0x92,
-  0x0F,0x01,0x5F,0x01,0x02,0x01,0x00,0x2F,0x5D,0xED,0x11,0x01,0x33,0x2F,0x33,0xFD,
-  0xE1,0x31,0x30,0x01,0x23,0x26,0x27,0x35,0x33,0x16,0x17,0x03,0x2B,0x79,0xA6,0x6A,
-  0xDB,0x56,0x58,0x04,0xD9,0x8E,0xA5,0x15,0xB2,0x7B,0x00,0x02,0x00,0x87,0xFF,0xEC,
-  0x04,0x02,0x04,0x5E,0x00,0x17,0x00,0x21,0x00,0x42,0x40,0x26,0x0B,0x01,0x21,0x47,
-  0x8F,0x17,0x9F,0x17,0x02,0x17,0x23,0x1C,0x48,0x11,0x00,0x08,0x10,0x08,0x02,0x08,
-  0x08,0x18,0x52,0x0B,0x0B,0x1E,0x10,0x0E,0x50,0x13,0x10,0x01,0x1E,0x4E,0x05,0x16,
-  0x00,0x15,0x00,0x3F,0x3F,0xE1,0x32,0x3F,0xE1,0x33,0x12,0x39,0x2F,0xE1,0x01,0x2F,
-  0x5E,0x5D,0x33,0xE1,0x10,0xDE,0x5D,0xE1,0x32,0x32,0x31,0x30,0x21,0x27,0x23,0x06,
-  0x06,0x23,0x22,0x26,0x35,0x10,0x25,0x37,0x35,0x34,0x23,0x22,0x07,0x27,0x36,0x33,
-  0x32,0x16,0x15,0x11,0x03,0x07,0x06,0x06,0x15,0x14,0x33,0x32,0x36,0x35,0x03,0x7F,
-  0x25,0x08,0x4D,0xA2,0x80,0xA3,0xB9,0x01,0xFE,0xCB,0xF4,0x93,0xB5,0x3F,0xC4,0xBB,
-  0xE3,0xCB,0xB4,0xA2,0xC4,0xA4,0xC8,0x93,0xAF,0x98,0x61,0x4B,0xAC,0x9B,0x01,0x4C,
-  0x10,0x07,0x45,0xEC,0x52,0x89,0x60,0xAE,0xC0,0xFD,0x10,0x02,0x19,0x07,0x08,0x6B,
-  0x6E,0xB2,0xA3,0x94,0x00,0x02,0x00,0x9E,0xFF,0xEC,0x04,0x44,0x06,0x14,0x00,0x12,
-  0x00,0x1C,0x00,0x3A,0x40,0x22,0x18,0x48,0xEF,0x0E,0xFF,0x0E,0x02,0x0E,0x1E,0x01,
-  0x08,0x06,0x13,0x47,0x00,0x03,0xB0,0x03,0x02,0x03,0x01,0x16,0x50,0x11,0x16,0x08,
-  0x1A,0x50,0x0B,0x10,0x04,0x00,0x03,0x15,0x00,0x3F,0x3F,0x3F,0xE1,0x32,0x3F,0xE1,
-  0x32,0x01,0x2F,0x5D,0xE1,0x32,0x32,0x39,0x10,0xDE,0x5D,0xE1,0x31,0x30,0x25,0x23,
-  0x07,0x23,0x11,0x33,0x11,0x14,0x07,0x33,0x36,0x33,0x32,0x12,0x11,0x10,0x02,0x23,
-  0x22,0x03,0x14,0x16,0x33,0x20,0x11,0x10,0x21,0x22,0x06,0x01,0x54,0x0C,0x25,0x85,
-  0xB6,0x08,0x08,0x6B,0xD7,0xC9,0xE5,0xE6,0xC8,0xCF,0x73,0x8B,0x98,0x01,0x10,0xFE,
-  0xEE,0x9B,0x86,0x8B,0x8B,0x06,0x14,0xFE,0x88,0x51,0x91,0xA4,0xFE,0xD5,0xFE,0xF4,
-  0xFE,0xF2,0xFE,0xD3,0x02,0x3B,0xE3,0xC1,0x01,0xA6,0x01,0x9E,0xBC,0x00,0x00,0x01,
-  0x00,0xAC,0xFF,0xEC,0x04,0x25,0x04,0x5E,0x00,0x13,0x00,0x2B,0x40,0x17,0x00,0x00,
-  0x8F,0x09,0x01,0x09,0x15,0x05,0x48,0x00,0x0F,0x01,0x0F,0x03,0x51,0x01,0x12,0x10,
-  0x09,0x07,0x51,0x0C,0x16,0x00,0x3F,0xE1,0x33,0x3F,0x33,0xE1,0x01,0x2F,0x5D,0xE1,
-  0x10,0xCE,0x5D,0x32,0x2F,0x31,0x30,0x01,0x07,0x26,0x23,0x20,0x11,0x10,0x21,0x32,
-  0x37,0x15,0x06,0x23,0x20,0x00,0x11,0x10,0x00,0x21,0x32,0x04,0x25,0x3E,0x96,0x76,
-  0xFE,0x8D,0x01,0x69,0x9D,0xA4,0x86,0xC3,0xFE,0xFF,0xFE,0xE4,0x01,0x22,0x01,0x07,
-  0xB2,0x04,0x23,0x9E,0x39,0xFE,0x63,0xFE,0x6A,0x3E,0xA0,0x3D,0x01,0x23,0x01,0x10,
-  0x01,0x19,0x01,0x26,0x00,0x02,0x00,0x89,0xFF,0xEC,0x04,0x2F,0x06,0x14,0x00,0x12,
-  0x00,0x1D,0x00,0x3A,0x40,0x23,0x14,0x00,0x0E,0x47,0x90,0x11,0xA0,0x11,0x02,0x11,
-  0x1F,0x19,0x48,0x00,0x06,0xE0,0x06,0xF0,0x06,0x03,0x06,0x0F,0x00,0x0B,0x17,0x50,
-  0x09,0x10,0x01,0x1B,0x50,0x03,0x16,0x12,0x15,0x00,0x3F,0x3F,0xE1,0x32,0x3F,0xE1,
-  0x32,0x3F,0x01,0x2F,0x5D,0xE1,0x10,0xDE,0x5D,0xE1,0x32,0x32,0x31,0x30,0x25,0x23,
-  0x06,0x23,0x22,0x02,0x11,0x10,0x12,0x33,0x32,0x17,0x33,0x26,0x35,0x11,0x33,0x11,
-  0x23,0x03,0x35,0x34,0x26,0x23,0x20,0x11,0x10,0x21,0x32,0x36,0x03,0x81,0x08,0x71,
-  0xD1,0xC9,0xE5,0xE6,0xC8,0xCE,0x74,0x0C,0x0C,0xB6,0x93,0x23,0x8B,0x98,0xFE,0xF0,
-  0x01,0x12,0x98,0x85,0x93,0xA7,0x01,0x2B,0x01,0x0C,0x01,0x0E,0x01,0x2D,0xA0,0x81,
-  0x21,0x01,0xB4,0xF9,0xEC,0x01,0xFA,0x29,0xE3,0xC1,0xFE,0x5A,0xFE,0x62,0xB1,0x00,
-  0x00,0x02,0x00,0x85,0xFF,0xEC,0x04,0x48,0x04,0x5E,0x00,0x11,0x00,0x16,0x00,0x47,
-  0x40,0x2C,0x13,0x48,0x05,0x0F,0x00,0x1F,0x00,0x02,0x00,0x18,0x12,0x01,0x48,0x00,
-  0x0B,0x10,0x0B,0x02,0x10,0x0B,0x20,0x0B,0x02,0x0B,0x01,0x50,0x0F,0x12,0x1F,0x12,
-  0x02,0x07,0x12,0x12,0x03,0x15,0x50,0x0E,0x10,0x03,0x51,0x05,0x08,0x16,0x00,0x3F,
-  0x33,0xE1,0x3F,0xE1,0x12,0x39,0x2F,0x5E,0x5D,0xE1,0x01,0x2F,0x5D,0x71,0xE1,0x32,
-  0x10,0xDE,0x71,0x32,0xE1,0x31,0x30,0x01,0x21,0x12,0x21,0x32,0x37,0x15,0x06,0x23,
-  0x22,0x00,0x11,0x10,0x00,0x33,0x32,0x12,0x15,0x25,0x21,0x10,0x21,0x20,0x04,0x48,
-  0xFC,0xFA,0x08,0x01,0x50,0xC3,0xAF,0xA6,0xC6,0xF5,0xFE,0xDA,0x01,0x0F,0xE3,0xD4,
-  0xFD,0xFC,0xFE,0x02,0x3D,0xFE,0xF0,0xFE,0xED,0x02,0x02,0xFE,0x89,0x4C,0xA0,0x4B,
-  0x01,0x2B,0x01,0x06,0x01,0x0A,0x01,0x37,0xFE,0xF4,0xDF,0x23,0x01,0x31,0x00,0x01,
-  0x00,0x9C,0x00,0x00,0x04,0x5A,0x06,0x1F,0x00,0x15,0x00,0x46,0x40,0x28,0x00,0x00,
-  0x0D,0x0D,0x17,0x14,0x02,0x47,0x03,0x07,0x03,0x8F,0x05,0xEF,0x05,0x02,0x05,0x05,
-  0x00,0x03,0xB0,0x03,0xF0,0x03,0x03,0x03,0x04,0x01,0x4E,0x07,0x06,0x14,0x0F,0x10,
-  0x50,0x0E,0x0B,0x01,0x02,0x15,0x00,0x3F,0x3F,0x33,0xE1,0x3F,0x33,0x33,0xE1,0x32,
-  0x01,0x2F,0x5D,0x33,0x2F,0x5D,0x11,0x33,0x10,0xE1,0x32,0x11,0x33,0x2F,0x39,0x2F,
-  0x31,0x30,0x01,0x21,0x11,0x23,0x11,0x21,0x35,0x25,0x35,0x34,0x36,0x33,0x32,0x17,
-  0x07,0x26,0x23,0x22,0x06,0x15,0x15,0x21,0x04,0x14,0xFE,0x7B,0xB6,0xFE,0xC3,0x01,
-  0x3D,0xB4,0xD1,0x81,0x7B,0x29,0x68,0x67,0x7B,0x58,0x01,0x85,0x03,0xC1,0xFC,0x3F,
-  0x03,0xC1,0x6E,0x21,0x60,0xC1,0xAE,0x23,0x8F,0x1C,0x64,0x73,0x68,0x00,0x00,0x03,
-  0x00,0x66,0xFE,0x14,0x04,0x66,0x04,0x5E,0x00,0x24,0x00,0x2C,0x00,0x36,0x00,0x80,
-  0x40,0x2F,0x34,0x11,0x11,0x02,0x24,0x09,0x1C,0x04,0x1F,0x27,0x46,0x01,0x5F,0x04,
-  0xDF,0x04,0xEF,0x04,0xFF,0x04,0x04,0x04,0x38,0x0B,0x1A,0x1A,0x1F,0x30,0x3F,0x16,
-  0x4F,0x16,0x5F,0x16,0x03,0x16,0x16,0x2B,0x46,0x80,0x1F,0x90,0x1F,0xA0,0x1F,0x03,
-  0x1F,0xB8,0xFF,0xC0,0x40,0x1D,0x06,0x09,0x48,0x1F,0x1C,0x04,0x22,0x25,0x52,0x07,
-  0x07,0x2E,0x29,0x4F,0x22,0x18,0x2E,0x51,0x0D,0x0D,0x22,0x10,0x32,0x4E,0x13,0x1B,
-  0x02,0x00,0x0F,0x00,0x3F,0x32,0x3F,0xE1,0x3F,0x39,0x2F,0xE1,0x32,0x10,0xE1,0x11,
-  0x39,0x2F,0xE1,0x12,0x39,0x39,0x01,0x2F,0x2B,0x5D,0xE1,0x33,0x2F,0x5D,0xC1,0x11,
-  0x33,0x2F,0xC1,0x10,0xDE,0x5D,0x32,0xE1,0x12,0x17,0x39,0x33,0x2F,0xC1,0x31,0x30,
-  0x01,0x15,0x07,0x16,0x15,0x14,0x06,0x23,0x22,0x27,0x06,0x15,0x14,0x33,0x33,0x32,
-  0x16,0x15,0x10,0x21,0x22,0x26,0x35,0x34,0x37,0x26,0x35,0x34,0x37,0x26,0x26,0x35,
-  0x34,0x36,0x33,0x32,0x17,0x03,0x32,0x35,0x34,0x23,0x22,0x15,0x14,0x01,0x23,0x22,
-  0x15,0x14,0x21,0x20,0x35,0x34,0x26,0x04,0x66,0xC4,0x41,0xD5,0xBE,0x37,0x1F,0x64,
-  0xA1,0xBB,0xAE,0xB8,0xFD,0xCB,0xDA,0xE3,0xF0,0x60,0x85,0x59,0x66,0xD5,0xC5,0x56,
-  0x40,0x9A,0xDF,0xE1,0xE1,0x01,0x45,0xBC,0xE6,0x01,0x0F,0x01,0x8B,0x64,0x04,0x4A,
-  0x71,0x1B,0x55,0x80,0xA1,0xBF,0x06,0x38,0x4D,0x54,0x9A,0x8F,0xFE,0x87,0xA1,0x91,
-  0xD4,0x3A,0x2F,0x6B,0x70,0x50,0x25,0xAB,0x65,0xB6,0xC5,0x14,0xFD,0xBC,0xE6,0xEF,
-  0xF2,0xE3,0xFE,0x0C,0xC6,0xAE,0xDF,0x58,0x3D,0x00,0x00,0x01,0x00,0xA0,0x00,0x00,
-  0x04,0x2D,0x06,0x14,0x00,0x11,0x00,0x3C,0x40,0x26,0x24,0x0F,0x34,0x0F,0x02,0x00,
-  0x47,0xB0,0x11,0xC0,0x11,0x02,0x11,0x13,0x0A,0x06,0x47,0x00,0x07,0x10,0x07,0x20,
-  0x07,0xD0,0x07,0x04,0x07,0x07,0x04,0x03,0x50,0x0E,0x10,0x08,0x00,0x07,0x00,0x15,
-  0x00,0x3F,0x32,0x3F,0x3F,0xE1,0x32,0x01,0x2F,0x5E,0x5D,0xE1,0x32,0x10,0xDE,0x5D,
-  0xE1,0x31,0x30,0x5D,0x21,0x11,0x10,0x23,0x20,0x11,0x11,0x23,0x11,0x33,0x11,0x07,
-  0x33,0x36,0x33,0x20,0x11,0x11,0x03,0x77,0xEE,0xFE,0xCD,0xB6,0xB6,0x08,0x0A,0x67,
-  0xE9,0x01,0x85,0x02,0xC3,0x01,0x04,0xFE,0x72,0xFD,0xC7,0x06,0x14,0xFE,0x32,0x90,
-  0xA8,0xFE,0x6F,0xFD,0x33,0x00,0x00,0x02,0x00,0xC5,0x00,0x00,0x04,0x33,0x06,0x0E,
-  0x00,0x08,0x00,0x12,0x00,0x33,0x40,0x1C,0x0E,0x02,0x0D,0x47,0x07,0x0A,0x11,0x03,
-  0x56,0x12,0x01,0x12,0x12,0x14,0x13,0x0D,0x12,0x4E,0x10,0x15,0x09,0x4E,0x0B,0x0F,
-  0x05,0x53,0x00,0x00,0x00,0x3F,0xED,0x3F,0xE1,0x3F,0xE1,0x32,0x11,0x12,0x01,0x39,
-  0x2F,0x5D,0x17,0x33,0xE1,0x32,0x32,0x31,0x30,0x01,0x32,0x15,0x14,0x06,0x23,0x22,
-  0x35,0x34,0x13,0x25,0x35,0x21,0x11,0x05,0x15,0x21,0x35,0x25,0x02,0x79,0x6A,0x3F,
-  0x2B,0x6B,0x0F,0xFE,0xF3,0x01,0xC3,0x01,0x60,0xFC,0x92,0x01,0x58,0x06,0x0E,0x72,
-  0x3A,0x39,0x73,0x72,0xFD,0xAC,0x15,0x7B,0xFC,0x45,0x14,0x7B,0x7B,0x14,0x00,0x02,
-  0x00,0x87,0xFE,0x14,0x03,0x56,0x06,0x0E,0x00,0x07,0x00,0x17,0x00,0x39,0x40,0x20,
-  0x10,0x08,0x06,0x0E,0x47,0x02,0x90,0x13,0xA0,0x13,0x02,0x13,0x13,0x19,0x18,0x00,
-  0x08,0x01,0x08,0x0B,0x50,0x09,0x16,0x1B,0x0F,0x4E,0x12,0x0F,0x04,0x53,0x00,0x00,
-  0x00,0x3F,0xE5,0x3F,0xE1,0x3F,0x33,0xE1,0x01,0x2F,0x5D,0x11,0x12,0x39,0x2F,0x5D,
-  0x33,0xE1,0x32,0x11,0x39,0x31,0x30,0x01,0x32,0x15,0x14,0x23,0x22,0x35,0x34,0x01,
-  0x35,0x16,0x33,0x32,0x36,0x35,0x11,0x25,0x35,0x21,0x11,0x14,0x06,0x23,0x22,0x02,
-  0xE7,0x6B,0x6B,0x6A,0xFE,0x0A,0x86,0x9B,0x75,0x83,0xFE,0x5C,0x02,0x5A,0xE2,0xCE,
-  0xA4,0x06,0x0E,0x72,0x73,0x73,0x72,0xF8,0x29,0x9A,0x27,0x72,0x65,0x04,0x39,0x15,
-  0x7B,0xFB,0x41,0xB4,0xC3,0x00,0x00,0x01,0x00,0xD7,0x00,0x00,0x04,0x8B,0x06,0x14,
-  0x00,0x0E,0x00,0x76,0x40,0x0B,0x19,0x06,0x29,0x06,0x39,0x06,0x03,0x08,0x06,0x01,
-  0x04,0xB8,0xFF,0xE0,0x40,0x3E,0x10,0x14,0x48,0x46,0x04,0x56,0x04,0x02,0x09,0x02,
-  0x01,0x09,0x01,0x01,0x1B,0x07,0x2B,0x07,0x3B,0x07,0x03,0x04,0x07,0x02,0x03,0x03,
-  0x06,0x05,0x20,0x10,0x13,0x48,0x00,0x05,0x60,0x05,0x02,0x05,0x05,0x10,0x0C,0x00,
-  0x09,0x47,0x00,0x0A,0x60,0x0A,0x02,0x0A,0x0B,0x00,0x04,0x07,0x00,0x07,0x02,0x0A,
-  0x05,0x15,0x02,0x0F,0x00,0x3F,0x3F,0x33,0x12,0x39,0x39,0x11,0x33,0x3F,0x01,0x2F,
-  0x5D,0xE1,0x32,0x32,0x11,0x33,0x2F,0x5D,0x2B,0x33,0x33,0x2F,0x33,0x39,0x39,0x31,
-  0x30,0x00,0x5D,0x01,0x5D,0x5D,0x5D,0x2B,0x5D,0x5D,0x01,0x37,0x01,0x33,0x01,0x01,
-  0x23,0x01,0x07,0x11,0x23,0x11,0x33,0x11,0x03,0x01,0x7F,0x87,0x01,0x8B,0xDE,0xFE,
-  0x12,0x02,0x0A,0xD5,0xFE,0x56,0x81,0xB4,0xB4,0x10,0x02,0x29,0x98,0x01,0x89,0xFE,
-  0x25,0xFD,0x91,0x01,0xF8,0x52,0xFE,0x5A,0x06,0x14,0xFD,0x36,0xFE,0xDF,0x00,0x01,
-  0x00,0xBC,0x00,0x00,0x04,0x2B,0x06,0x14,0x00,0x09,0x00,0x2D,0x40,0x18,0x05,0x04,
-  0x47,0x08,0x01,0x5D,0x09,0x01,0x4F,0x09,0x01,0x09,0x09,0x0B,0x0A,0x09,0x04,0x4E,
-  0x06,0x15,0x00,0x4E,0x02,0x00,0x00,0x3F,0xE1,0x3F,0xE1,0x32,0x11,0x12,0x01,0x39,
-  0x2F,0x5D,0x5D,0x33,0x33,0xE1,0x32,0x31,0x30,0x01,0x25,0x35,0x21,0x11,0x05,0x15,
-  0x21,0x35,0x25,0x02,0x14,0xFE,0xF4,0x01,0xC3,0x01,0x60,0xFC,0x91,0x01,0x58,0x05,
-  0x85,0x15,0x7A,0xFA,0x7B,0x14,0x7B,0x7B,0x14,0x00,0x00,0x01,0x00,0x5C,0x00,0x00,
-  0x04,0x73,0x04,0x5E,0x00,0x20,0x00,0x6B,0x40,0x45,0x19,0x85,0x08,0x01,0x76,0x08,
-  0x01,0x65,0x08,0x01,0x56,0x08,0x01,0x37,0x08,0x47,0x08,0x02,0x08,0x47,0x8B,0x09,
-  0x01,0x7A,0x09,0x01,0x09,0x09,0x11,0x00,0x47,0x90,0x20,0xA0,0x20,0xC0,0x20,0xD0,
-  0x20,0x04,0x0F,0x20,0x01,0x20,0x22,0x14,0x10,0x47,0x40,0x11,0x50,0x11,0x02,0x11,
-  0x1A,0x14,0x11,0x04,0x0C,0x50,0x1C,0x17,0x10,0x12,0x0F,0x11,0x09,0x00,0x15,0x00,
-  0x3F,0x32,0x32,0x3F,0x3F,0x33,0xE1,0x32,0x12,0x39,0x39,0x01,0x2F,0x5D,0xE1,0x32,
-  0x10,0xDE,0x5D,0x5D,0xE1,0x11,0x39,0x2F,0x5D,0x5D,0xE1,0x5D,0x5D,0x5D,0x5D,0x5D,
-  0x32,0x31,0x30,0x21,0x11,0x34,0x26,0x23,0x22,0x06,0x15,0x11,0x23,0x11,0x10,0x23,
-  0x22,0x06,0x15,0x11,0x23,0x11,0x33,0x17,0x33,0x36,0x33,0x32,0x17,0x33,0x36,0x33,
-  0x32,0x16,0x15,0x11,0x03,0xD1,0x35,0x3E,0x57,0x4F,0xA1,0x7D,0x54,0x48,0xA2,0x7F,
-  0x1B,0x0A,0x43,0x86,0xA3,0x32,0x06,0x4C,0x8F,0x80,0x74,0x02,0xC3,0x92,0x72,0xA6,
-  0xC3,0xFD,0xA2,0x02,0xC3,0x01,0x04,0x9F,0xEF,0xFD,0xC7,0x04,0x4A,0x94,0xA8,0xB6,
-  0xB6,0xB9,0xD8,0xFD,0x33,0x00,0x00,0x01,0x00,0xA0,0x00,0x00,0x04,0x2D,0x04,0x5E,
-  0x00,0x10,0x00,0x36,0x40,0x21,0x00,0x47,0xB0,0x10,0xC0,0x10,0x02,0x10,0x12,0x0A,
-  0x06,0x47,0x00,0x07,0x10,0x07,0x20,0x07,0xD0,0x07,0x04,0x07,0x07,0x0B,0x03,0x50,
-  0x0D,0x10,0x08,0x0F,0x07,0x00,0x15,0x00,0x3F,0x32,0x3F,0x3F,0xE1,0x32,0x01,0x2F,
-  0x5E,0x5D,0xE1,0x32,0x10,0xDE,0x5D,0xE1,0x31,0x30,0x21,0x11,0x10,0x23,0x20,0x11,
-  0x11,0x23,0x11,0x33,0x17,0x33,0x36,0x33,0x20,0x11,0x11,0x03,0x77,0xEE,0xFE,0xCD,
-  0xB6,0x93,0x1B,0x0A,0x67,0xE9,0x01,0x85,0x02,0xC3,0x01,0x04,0xFE,0x72,0xFD,0xC7,
-  0x04,0x4A,0x94,0xA8,0xFE,0x6F,0xFD,0x33,0x00,0x02,0x00,0x73,0xFF,0xEC,0x04,0x58,
-  0x04,0x5E,0x00,0x0B,0x00,0x13,0x00,0x22,0x40,0x12,0x0E,0x48,0x09,0x15,0x12,0x48,
-  0x00,0x03,0x01,0x03,0x10,0x50,0x06,0x10,0x0C,0x50,0x00,0x16,0x00,0x3F,0xE1,0x3F,
-  0xE1,0x01,0x2F,0x5D,0xE1,0x10,0xDE,0xE1,0x31,0x30,0x05,0x22,0x00,0x11,0x10,0x00,
-  0x33,0x32,0x00,0x11,0x10,0x00,0x27,0x20,0x11,0x10,0x21,0x20,0x11,0x10,0x02,0x62,
-  0xD8,0xFE,0xE9,0x01,0x0F,0xE6,0xDA,0x01,0x16,0xFE,0xEE,0xE0,0x01,0x36,0xFE,0xC8,
-  0xFE,0xCB,0x14,0x01,0x37,0x01,0x04,0x01,0x07,0x01,0x30,0xFE,0xCA,0xFE,0xFF,0xFE,
-  0xF7,0xFE,0xCE,0x97,0x01,0xA4,0x01,0xA0,0xFE,0x60,0xFE,0x5C,0x00,0x02,0x00,0x9E,
-  0xFE,0x14,0x04,0x44,0x04,0x5E,0x00,0x12,0x00,0x1D,0x00,0x3E,0x40,0x26,0x19,0x48,
-  0x0F,0x0E,0x1F,0x0E,0x02,0x0E,0x1F,0x14,0x01,0x04,0x47,0x00,0x05,0x10,0x05,0x20,
-  0x05,0xD0,0x05,0x04,0x07,0x05,0x00,0x17,0x50,0x11,0x16,0x08,0x1B,0x50,0x0B,0x10,
-  0x06,0x0F,0x04,0x1B,0x00,0x3F,0x3F,0x3F,0xE1,0x32,0x3F,0xE1,0x32,0x01,0x2F,0x5E,
-  0x5D,0xE1,0x32,0x32,0x10,0xDE,0x71,0xE1,0x31,0x30,0x25,0x23,0x16,0x15,0x11,0x23,
-  0x11,0x33,0x17,0x33,0x36,0x33,0x32,0x12,0x11,0x10,0x02,0x23,0x22,0x03,0x15,0x14,
-  0x16,0x33,0x20,0x11,0x10,0x21,0x22,0x06,0x01,0x54,0x0C,0x0C,0xB6,0x93,0x1B,0x08,
-  0x6E,0xD4,0xC9,0xE5,0xE6,0xC8,0xCF,0x73,0x8B,0x98,0x01,0x10,0xFE,0xEE,0x98,0x85,
-  0x8B,0x81,0x21,0xFE,0x2B,0x06,0x36,0x94,0xA8,0xFE,0xD5,0xFE,0xF4,0xFE,0xF2,0xFE,
-  0xD3,0x02,0x64,0x29,0xE3,0xC1,0x01,0xA6,0x01,0x9E,0xB0,0x00,0x00,0x02,0x00,0x89,
-  0xFE,0x14,0x04,0x2F,0x04,0x5E,0x00,0x12,0x00,0x1D,0x00,0x3C,0x40,0x25,0x01,0x08,
-  0x13,0x03,0x05,0x47,0x90,0x04,0xA0,0x04,0x02,0x04,0x1F,0x19,0x48,0x00,0x0E,0xE0,
-  0x0E,0xF0,0x0E,0x03,0x0E,0x08,0x1B,0x50,0x0B,0x16,0x04,0x1B,0x01,0x17,0x50,0x11,
-  0x10,0x02,0x0F,0x00,0x3F,0x3F,0xE1,0x32,0x3F,0x3F,0xE1,0x32,0x01,0x2F,0x5D,0xE1,
-  0x10,0xDE,0x5D,0xE1,0x17,0x32,0x31,0x30,0x01,0x33,0x37,0x33,0x11,0x23,0x11,0x34,
-  0x37,0x23,0x06,0x23,0x22,0x02,0x11,0x10,0x12,0x33,0x32,0x13,0x35,0x34,0x26,0x23,
-  0x20,0x11,0x10,0x21,0x32,0x36,0x03,0x79,0x08,0x1B,0x93,0xB6,0x0C,0x0C,0x71,0xD1,
-  0xC9,0xE5,0xE6,0xC8,0xCF,0x73,0x8B,0x98,0xFE,0xF0,0x01,0x12,0x98,0x85,0x03,0xB6,
-  0x94,0xF9,0xCA,0x01,0xD5,0x29,0x81,0xA7,0x01,0x2B,0x01,0x0C,0x01,0x0E,0x01,0x2D,
-  0xFD,0x9C,0x29,0xE3,0xC1,0xFE,0x5A,0xFE,0x62,0xB1,0x00,0x01,0x01,0x08,0x00,0x00,
-  0x04,0x23,0x04,0x5E,0x00,0x10,0x00,0x31,0x40,0x1B,0x90,0x00,0x01,0x00,0x00,0x12,
-  0x0B,0x07,0x47,0x2F,0x08,0x01,0x00,0x08,0x01,0x08,0x0B,0x07,0x03,0x51,0x01,0x0F,
-  0x10,0x09,0x0F,0x07,0x15,0x00,0x3F,0x3F,0x3F,0x33,0xE1,0x12,0x39,0x01,0x2F,0x5D,
-  0x5D,0xE1,0x32,0x11,0x33,0x2F,0x5D,0x31,0x30,0x01,0x07,0x26,0x23,0x22,0x06,0x15,
-  0x11,0x23,0x11,0x33,0x17,0x33,0x36,0x36,0x33,0x32,0x04,0x23,0x31,0x7B,0x65,0xA3,
-  0xB1,0xB6,0x94,0x16,0x08,0x4C,0xAE,0x7F,0x76,0x04,0x31,0xA6,0x2D,0xB9,0xAF,0xFD,
-  0xB0,0x04,0x4A,0xC9,0x77,0x66,0x00,0x01,0x00,0xCB,0xFF,0xEC,0x04,0x02,0x04,0x5E,
-  0x00,0x1F,0x00,0x3C,0x40,0x22,0x10,0x10,0x05,0x46,0x1B,0x21,0x15,0x46,0x0B,0x00,
-  0x00,0x00,0x0B,0x50,0x0B,0x60,0x0B,0xF0,0x0B,0x04,0x0B,0x15,0x05,0x0E,0x03,0x50,
-  0x01,0x1E,0x16,0x13,0x50,0x11,0x0E,0x10,0x00,0x3F,0x33,0xE1,0x3F,0x33,0xE1,0x12,
-  0x39,0x39,0x01,0x2F,0x5D,0x33,0x2F,0x10,0xE1,0x10,0xDE,0xE1,0x33,0x2F,0x31,0x30,
-  0x37,0x35,0x16,0x33,0x20,0x35,0x34,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x33,0x32,
-  0x17,0x07,0x26,0x23,0x22,0x15,0x14,0x16,0x17,0x16,0x16,0x15,0x14,0x06,0x23,0x22,
-  0xCB,0xC1,0xB1,0x01,0x13,0x62,0xB1,0xE9,0x79,0xDF,0xC5,0xC6,0xAB,0x3C,0xB6,0x89,
-  0xEC,0x65,0xB6,0xD3,0x8B,0xEA,0xD6,0xF8,0x31,0xA6,0x56,0xA2,0x39,0x54,0x40,0x57,
-  0x91,0x63,0x88,0x9B,0x4A,0x95,0x48,0x85,0x3D,0x49,0x41,0x4D,0x95,0x6C,0x96,0xAB,
-  0x00,0x01,0x00,0x8B,0xFF,0xEC,0x04,0x02,0x05,0x6F,0x00,0x13,0x00,0x59,0x40,0x37,
-  0x0C,0x10,0x47,0x05,0x09,0x05,0x20,0x07,0x01,0x07,0x07,0x2F,0x05,0x3F,0x05,0x7F,
-  0x05,0x8F,0x05,0xCF,0x05,0xDF,0x05,0x06,0x00,0x05,0x01,0x05,0x05,0x14,0x15,0x0E,
-  0x0E,0x7F,0x01,0x8F,0x01,0xAF,0x01,0x03,0x01,0x15,0x06,0x0F,0x4E,0x0B,0x09,0x08,
-  0x0C,0x0F,0x12,0x50,0x00,0x03,0x16,0x00,0x3F,0x33,0xE1,0x3F,0x33,0x33,0x33,0xE1,
-  0x32,0x01,0x10,0xCE,0x5D,0x32,0x2F,0x11,0x12,0x39,0x2F,0x5D,0x5D,0x33,0x2F,0x5D,
-  0x11,0x33,0x10,0xE1,0x32,0x31,0x30,0x25,0x15,0x06,0x23,0x20,0x11,0x11,0x21,0x35,
-  0x25,0x13,0x33,0x11,0x21,0x15,0x21,0x11,0x14,0x33,0x32,0x03,0xFC,0x82,0x7A,0xFE,
-  0x96,0xFE,0xF5,0x01,0x0B,0x4D,0x69,0x01,0xB6,0xFE,0x4A,0xC0,0x5D,0x96,0x8A,0x20,
-  0x01,0x58,0x02,0x7D,0x5E,0x31,0x01,0x1F,0xFE,0xDB,0x89,0xFD,0x83,0xC3,0x00,0x01,
-  0x00,0xA0,0xFF,0xEC,0x04,0x2D,0x04,0x4A,0x00,0x11,0x00,0x30,0x40,0x1C,0x01,0x0E,
-  0x47,0x90,0x11,0xA0,0x11,0x02,0x11,0x13,0x09,0x47,0x00,0x06,0xB0,0x06,0x02,0x06,
-  0x0F,0x07,0x0F,0x01,0x0B,0x50,0x04,0x16,0x00,0x15,0x00,0x3F,0x3F,0xE1,0x32,0x3F,
-  0x33,0x01,0x2F,0x5D,0xE1,0x10,0xDE,0x5D,0xE1,0x32,0x31,0x30,0x21,0x27,0x23,0x06,
-  0x23,0x20,0x11,0x11,0x33,0x11,0x10,0x33,0x32,0x36,0x35,0x11,0x33,0x11,0x03,0x9A,
-  0x1B,0x0A,0x69,0xE5,0xFE,0x79,0xB6,0xEC,0xA1,0x94,0xB6,0x93,0xA7,0x01,0x91,0x02,
-  0xCD,0xFD,0x3D,0xFE,0xFC,0xB9,0xD4,0x02,0x3A,0xFB,0xB6,0x00,0x00,0x01,0x00,0x52,
-  0x00,0x00,0x04,0x79,0x04,0x4A,0x00,0x0B,0x00,0x73,0x40,0x38,0x26,0x0B,0x01,0x29,
-  0x00,0x01,0x37,0x0B,0x67,0x0B,0xE7,0x0B,0xF7,0x0B,0x04,0x06,0x0B,0x16,0x0B,0x02,
-  0x0B,0x38,0x00,0x68,0x00,0xE8,0x00,0xF8,0x00,0x04,0x09,0x00,0x19,0x00,0x02,0x00,
-  0x05,0x05,0x01,0x09,0x08,0x09,0x0C,0x48,0x09,0x10,0x0A,0x20,0x0A,0x30,0x0A,0x03,
-  0x0A,0x0A,0x0D,0x02,0xB8,0xFF,0xF8,0x40,0x15,0x09,0x0C,0x48,0x02,0x2F,0x01,0x3F,
-  0x01,0x02,0x01,0x46,0x05,0x56,0x05,0x02,0x05,0x09,0x01,0x0F,0x00,0x15,0x00,0x3F,
-  0x3F,0x33,0x39,0x5D,0x01,0x2F,0x5D,0x33,0x2B,0x11,0x33,0x2F,0x5D,0x33,0x2B,0x12,
-  0x39,0x3D,0x2F,0x33,0x5D,0x5D,0x33,0x5D,0x5D,0x31,0x30,0x5D,0x5D,0x21,0x01,0x33,
-  0x13,0x16,0x17,0x33,0x36,0x13,0x13,0x33,0x01,0x01,0xF2,0xFE,0x60,0xBC,0xF0,0x55,
-  0x0F,0x06,0x07,0x5E,0xEF,0xBD,0xFE,0x60,0x04,0x4A,0xFD,0x74,0xE7,0x5E,0x2C,0x01,
-  0x19,0x02,0x8C,0xFB,0xB6,0x00,0x00,0x01,0xFF,0xFC,0x00,0x00,0x04,0xD1,0x04,0x4A,
-  0x00,0x19,0x01,0x2B,0xB9,0x00,0x19,0xFF,0xF0,0xB6,0x14,0x18,0x48,0xA7,0x19,0x01,
-  0x19,0xB8,0xFF,0xF0,0x40,0x18,0x0D,0x12,0x48,0x09,0x16,0x19,0x16,0x29,0x16,0x03,
-  0x29,0x15,0x01,0x27,0x11,0x57,0x11,0x02,0x06,0x11,0x16,0x11,0x02,0x10,0xB8,0xFF,
-  0xF0,0x40,0x42,0x0D,0x18,0x48,0x27,0x10,0x37,0x10,0x02,0x0F,0x10,0x0D,0x18,0x48,
-  0x28,0x0F,0x38,0x0F,0x02,0x28,0x0E,0x58,0x0E,0x02,0x09,0x0E,0x19,0x0E,0x02,0x28,
-  0x0D,0x01,0x26,0x0A,0x01,0x06,0x09,0x16,0x09,0x26,0x09,0x03,0x06,0x10,0x14,0x18,
-  0x48,0xA8,0x06,0x01,0x79,0x06,0x89,0x06,0x99,0x06,0x03,0x28,0x06,0x48,0x06,0x58,
-  0x06,0x68,0x06,0x04,0x05,0xB8,0xFF,0xF0,0x40,0x0A,0x14,0x18,0x48,0xA7,0x05,0x01,
-  0x26,0x05,0x01,0x05,0xB8,0xFF,0xF0,0x40,0x2A,0x0D,0x12,0x48,0x07,0x05,0x01,0x00,
-  0x10,0x14,0x18,0x48,0xA8,0x00,0x01,0x29,0x00,0x01,0x00,0x10,0x0D,0x12,0x48,0x08,
-  0x00,0x01,0x06,0x05,0x0B,0x10,0x0F,0x02,0x19,0x00,0x14,0x94,0x0B,0xA4,0x0B,0xB4,
-  0x0B,0x03,0x0B,0xB8,0xFF,0xE0,0x40,0x30,0x0B,0x0E,0x48,0x9B,0x14,0xAB,0x14,0xBB,
-  0x14,0x03,0x14,0x20,0x0B,0x0E,0x48,0x0B,0x02,0x14,0x14,0x02,0x0B,0x03,0x07,0x17,
-  0x10,0x18,0x01,0x18,0x08,0x07,0x14,0x0B,0x5B,0x02,0x01,0x54,0x0B,0x01,0x02,0x0B,
-  0x06,0x17,0x0F,0x07,0x0F,0x00,0x06,0x15,0x00,0x3F,0x33,0x3F,0x33,0x33,0x12,0x39,
-  0x39,0x5D,0x5D,0x11,0x33,0x01,0x2F,0x33,0x2F,0x5D,0x33,0x12,0x17,0x39,0x3D,0x2F,
-  0x2F,0x2F,0x2B,0x5D,0x2B,0x5D,0x11,0x33,0x33,0x11,0x33,0x33,0x11,0x33,0x33,0x31,
-  0x30,0x5D,0x2B,0x5D,0x5D,0x2B,0x5D,0x2B,0x5D,0x5D,0x2B,0x5D,0x5D,0x5D,0x2B,0x5D,
-  0x5D,0x5D,0x5D,0x5D,0x5D,0x2B,0x5D,0x2B,0x5D,0x5D,0x5D,0x5D,0x2B,0x5D,0x2B,0x21,
-  0x03,0x03,0x23,0x03,0x03,0x23,0x03,0x33,0x13,0x16,0x17,0x33,0x36,0x37,0x13,0x33,
-  0x13,0x16,0x17,0x33,0x36,0x37,0x13,0x33,0x03,0x03,0x2D,0x83,0x44,0x06,0x41,0x87,
-  0xBD,0xDF,0xA2,0x62,0x22,0x17,0x06,0x1F,0x25,0x85,0xC1,0x7F,0x2B,0x18,0x06,0x1F,
-  0x1D,0x66,0x9E,0xE1,0x02,0x54,0x01,0x4A,0xFE,0xB2,0xFD,0xB0,0x04,0x4A,0xFD,0xE1,
-  0xBA,0xCF,0xB9,0xAD,0x02,0x42,0xFD,0xBE,0xC3,0xA3,0xF2,0x97,0x02,0x1F,0xFB,0xB6,
-  0x00,0x01,0x00,0x60,0x00,0x00,0x04,0x6A,0x04,0x4A,0x00,0x0B,0x00,0xA9,0xB7,0xC4,
-  0x0A,0xD4,0x0A,0xE4,0x0A,0x03,0x0A,0xB8,0xFF,0xF0,0x40,0x24,0x0B,0x0E,0x48,0xCB,
-  0x08,0xDB,0x08,0xEB,0x08,0x03,0x08,0x10,0x0B,0x0E,0x48,0xCB,0x04,0xDB,0x04,0xEB,
-  0x04,0x03,0x04,0x10,0x0B,0x0E,0x48,0xC4,0x02,0xD4,0x02,0xE4,0x02,0x03,0x06,0x02,
-  0xB8,0xFF,0xF0,0x40,0x14,0x0B,0x0E,0x48,0x49,0x09,0x01,0x09,0x10,0x12,0x17,0x48,
-  0x0A,0x09,0x1A,0x09,0x02,0x46,0x03,0x01,0x03,0xB8,0xFF,0xF0,0x40,0x2D,0x12,0x17,
-  0x48,0x05,0x03,0x15,0x03,0x02,0x04,0x05,0x05,0x06,0x03,0x09,0x00,0x04,0x0B,0x08,
-  0x00,0x07,0x10,0x07,0x02,0x07,0x07,0x0D,0x02,0x01,0x0A,0x1F,0x0B,0x01,0x0B,0x09,
-  0x06,0x00,0x03,0x04,0x01,0x0B,0x07,0x15,0x04,0x01,0x0F,0x00,0x3F,0x33,0x3F,0x33,
-  0x12,0x17,0x39,0x01,0x2F,0x5D,0x33,0x33,0x32,0x11,0x33,0x2F,0x5D,0x33,0x12,0x17,
-  0x39,0x33,0x11,0x33,0x31,0x30,0x00,0x5D,0x2B,0x5D,0x5D,0x2B,0x5D,0x01,0x2B,0x5F,
-  0x5D,0x2B,0x5D,0x2B,0x5D,0x2B,0x5D,0x01,0x01,0x33,0x01,0x01,0x33,0x01,0x01,0x23,
-  0x01,0x01,0x23,0x01,0xFE,0xFE,0x77,0xCF,0x01,0x22,0x01,0x23,0xCF,0xFE,0x75,0x01,
-  0x9D,0xCE,0xFE,0xCA,0xFE,0xC9,0xCF,0x02,0x33,0x02,0x17,0xFE,0x66,0x01,0x9A,0xFD,
-  0xE9,0xFD,0xCD,0x01,0xB4,0xFE,0x4C,0x00,0x00,0x01,0x00,0x52,0xFE,0x14,0x04,0x79,
-  0x04,0x4A,0x00,0x16,0x00,0x71,0x40,0x1E,0x38,0x08,0x01,0x09,0x08,0x19,0x08,0x29,
-  0x08,0x03,0x37,0x01,0x01,0x06,0x01,0x16,0x01,0x26,0x01,0x03,0x16,0x10,0x09,0x0C,
-  0x48,0x16,0x04,0x04,0x08,0x09,0xB8,0xFF,0xC0,0x40,0x12,0x09,0x0C,0x48,0x09,0x09,
-  0x18,0x0F,0x0F,0x01,0x1F,0x00,0x2F,0x00,0x3F,0x00,0x03,0x00,0x04,0xB8,0xFF,0xF0,
-  0x40,0x14,0x0B,0x0E,0x48,0x04,0x04,0x14,0x04,0x02,0x04,0x00,0x16,0x16,0x12,0x50,
-  0x10,0x0D,0x1B,0x08,0x00,0x0F,0x00,0x3F,0x32,0x3F,0x33,0xE1,0x3F,0x12,0x39,0x5D,
-  0x2B,0x01,0x2F,0x5D,0x32,0x32,0x2F,0x11,0x33,0x2F,0x2B,0x33,0x39,0x3D,0x2F,0x33,
-  0x2B,0x31,0x30,0x5D,0x5D,0x5D,0x5D,0x13,0x33,0x01,0x16,0x17,0x33,0x36,0x37,0x13,
-  0x33,0x01,0x06,0x06,0x23,0x22,0x27,0x35,0x16,0x33,0x32,0x36,0x37,0x37,0x52,0xBC,
-  0x01,0x06,0x52,0x07,0x06,0x17,0x43,0xEF,0xBD,0xFE,0x25,0x43,0xB2,0x9D,0x56,0x52,
-  0x3E,0x4A,0x60,0x6B,0x2A,0x3A,0x04,0x4A,0xFD,0x72,0xCD,0x55,0x70,0xB4,0x02,0x8C,
-  0xFB,0x27,0xAE,0xAF,0x11,0x91,0x0C,0x52,0x64,0x96,0x00,0x01,0x00,0xB6,0x00,0x00,
-  0x04,0x14,0x04,0x4A,0x00,0x09,0x00,0x46,0x40,0x0E,0x03,0x08,0x09,0x0C,0x48,0x03,
-  0x07,0x07,0x70,0x00,0x01,0x00,0x0B,0x08,0xB8,0xFF,0xF8,0x40,0x18,0x09,0x0C,0x48,
-  0x08,0x02,0x04,0x04,0x7F,0x02,0x01,0x00,0x02,0x01,0x02,0x07,0x04,0x4E,0x05,0x0F,
-  0x02,0x08,0x4E,0x01,0x15,0x00,0x3F,0xE1,0x32,0x3F,0xE1,0x32,0x01,0x2F,0x5D,0x5D,
-  0x33,0x2F,0x11,0x33,0x2B,0x10,0xCE,0x5D,0x32,0x2F,0x33,0x2B,0x31,0x30,0x21,0x21,
-  0x35,0x01,0x21,0x35,0x21,0x15,0x01,0x21,0x04,0x14,0xFC,0xA2,0x02,0x94,0xFD,0x8D,
-  0x03,0x2B,0xFD,0x79,0x02,0x99,0x7D,0x03,0x44,0x89,0x92,0xFC,0xD1,0x00,0x00,0x01,
-  0x00,0xE1,0xFE,0xBC,0x03,0xE9,0x05,0xB6,0x00,0x19,0x00,0x62,0x40,0x3F,0x14,0x00,
-  0xF1,0x0C,0x16,0x09,0x70,0x06,0x80,0x06,0x02,0x06,0x06,0x09,0x10,0x5F,0x03,0x01,
-  0x40,0x03,0x01,0x03,0x1B,0xE0,0x09,0xF0,0x09,0x02,0x1F,0x09,0x01,0x09,0x16,0x09,
-  0xF5,0xEF,0x0A,0xFF,0x0A,0x02,0xD9,0x0A,0x01,0x0F,0x0A,0x2F,0x0A,0xAF,0x0A,0xBF,
-  0x0A,0x04,0x0A,0x0A,0x03,0x10,0xF5,0x0F,0xF8,0x03,0xF5,0x04,0xF9,0x00,0x3F,0xE1,
-  0x3F,0xE1,0x12,0x39,0x2F,0x5D,0x5D,0x5D,0xE1,0x39,0x01,0x2F,0x5D,0x5D,0x10,0xCE,
-  0x5D,0x5D,0x32,0x11,0x39,0x2F,0x5D,0x12,0x39,0x33,0xE1,0x32,0x31,0x30,0x05,0x14,
-  0x16,0x17,0x15,0x24,0x11,0x11,0x34,0x21,0x35,0x20,0x35,0x11,0x10,0x25,0x15,0x06,
-  0x06,0x15,0x11,0x14,0x07,0x15,0x16,0x15,0x02,0xE9,0x70,0x90,0xFE,0x4A,0xFE,0xAE,
-  0x01,0x52,0x01,0xB6,0x90,0x70,0xE9,0xE9,0x10,0x51,0x4B,0x02,0x96,0x06,0x01,0x1F,
-  0x01,0x4E,0xBD,0x9B,0xBD,0x01,0x4D,0x01,0x1F,0x06,0x95,0x02,0x4B,0x51,0xFE,0xB4,
-  0xCF,0x29,0x0C,0x29,0xCF,0x00,0x00,0x01,0x02,0x1B,0xFE,0x14,0x02,0xB0,0x06,0x14,
-  0x00,0x03,0x00,0x15,0x40,0x0A,0x02,0xAA,0x4F,0x03,0x01,0x03,0x02,0x1B,0x00,0x00,
-  0x00,0x3F,0x3F,0x01,0x2F,0x5D,0xE1,0x31,0x30,0x01,0x33,0x11,0x23,0x02,0x1B,0x95,
-  0x95,0x06,0x14,0xF8,0x00,0x00,0x00,0x01,0x00,0xE3,0xFE,0xBC,0x03,0xEC,0x05,0xB6,
-  0x00,0x19,0x00,0x60,0x40,0x3E,0x05,0x19,0xF1,0x0D,0x03,0x7F,0x13,0x8F,0x13,0x02,
-  0x13,0x13,0x09,0xEF,0x0F,0xFF,0x0F,0x02,0x10,0x0F,0x01,0x0F,0x1B,0x15,0x50,0x09,
-  0x01,0x4F,0x09,0x01,0x09,0x03,0x10,0xF5,0xEF,0x0F,0xFF,0x0F,0x02,0xD9,0x0F,0x01,
-  0x0F,0x0F,0x2F,0x0F,0xAF,0x0F,0xBF,0x0F,0x04,0x0F,0x0F,0x0A,0x16,0xF5,0x15,0xF9,
-  0x09,0xF5,0x0A,0xF8,0x00,0x3F,0xE1,0x3F,0xE1,0x11,0x39,0x2F,0x5D,0x5D,0x5D,0xE1,
-  0x39,0x01,0x2F,0x5D,0x5D,0x33,0x10,0xCE,0x5D,0x5D,0x11,0x39,0x2F,0x5D,0x39,0x33,
-  0xE1,0x32,0x31,0x30,0x01,0x34,0x37,0x35,0x26,0x35,0x11,0x34,0x26,0x27,0x35,0x04,
-  0x11,0x11,0x14,0x21,0x15,0x20,0x15,0x11,0x10,0x05,0x35,0x36,0x36,0x35,0x01,0xE3,
-  0xEA,0xEA,0x71,0x8F,0x01,0xB7,0x01,0x52,0xFE,0xAE,0xFE,0x49,0x8F,0x71,0x01,0x3B,
-  0xCF,0x29,0x0C,0x29,0xCF,0x01,0x4C,0x51,0x4C,0x01,0x95,0x06,0xFE,0xE1,0xFE,0xB3,
-  0xBD,0x9B,0xBD,0xFE,0xB2,0xFE,0xE1,0x06,0x96,0x01,0x4C,0x51,0x00,0x01,0x00,0x98,
-  0x02,0x4A,0x04,0x33,0x03,0x5A,0x00,0x11,0x00,0x2F,0x40,0x1A,0x09,0x13,0x00,0x00,
-  0x01,0x00,0x00,0x12,0x10,0xAD,0x09,0x03,0xB2,0x07,0xAD,0x00,0xDF,0x0C,0x01,0x70,
-  0x0C,0x01,0x3F,0x0C,0x01,0x0C,0x00,0x2F,0x5D,0x5D,0x5D,0x33,0xE1,0xFD,0x32,0xE1,
-  0x11,0x01,0x33,0x2F,0x5D,0x10,0xCE,0x31,0x30,0x13,0x35,0x36,0x33,0x32,0x17,0x16,
-  0x33,0x32,0x37,0x15,0x06,0x23,0x22,0x27,0x26,0x23,0x22,0x98,0x63,0x94,0x64,0x94,
-  0x82,0x47,0x6C,0x77,0x63,0x95,0x64,0x93,0x83,0x46,0x6C,0x02,0x4A,0xA2,0x6C,0x3F,
-  0x38,0x79,0xA2,0x6C,0x3F,0x38,0x00,0x02,0x01,0xE7,0xFE,0x8B,0x02,0xE5,0x04,0x5E,
-  0x00,0x07,0x00,0x0B,0x00,0x25,0x40,0x11,0x08,0x09,0x0A,0x06,0x96,0x0B,0x02,0x02,
-  0x0C,0x0D,0x08,0x08,0x0A,0x00,0x9B,0x04,0x10,0x00,0x3F,0xED,0x2F,0x39,0x2F,0x11,
-  0x12,0x01,0x39,0x2F,0x33,0xE1,0x32,0x39,0x39,0x31,0x30,0x01,0x22,0x35,0x34,0x33,
-  0x32,0x15,0x14,0x07,0x33,0x13,0x23,0x02,0x66,0x7F,0x7F,0x7F,0xBC,0x79,0x33,0xDF,
-  0x03,0x48,0x8B,0x8B,0x8B,0x8B,0xA4,0xFB,0xE7,0x00,0x00,0x01,0x00,0xAC,0xFF,0xEC,
-  0x04,0x25,0x05,0xCB,0x00,0x17,0x00,0x4E,0x40,0x18,0x00,0x0E,0x46,0x15,0x20,0x11,
-  0x30,0x11,0x02,0x11,0x11,0x13,0x02,0x8F,0x0C,0x01,0x0C,0x19,0x07,0x48,0x00,0x13,
-  0x01,0x13,0xB8,0xFF,0xC0,0x40,0x12,0x15,0x18,0x48,0x13,0x05,0x50,0x00,0x15,0x15,
-  0x16,0x07,0x11,0x09,0x51,0x0E,0x0E,0x0F,0x16,0x00,0x3F,0x33,0x2F,0xE1,0x33,0x3F,
-  0x33,0x2F,0x33,0xE1,0x01,0x2F,0x2B,0x5D,0xE1,0x10,0xCE,0x5D,0x32,0x11,0x39,0x2F,
-  0x5D,0x33,0xE1,0x32,0x31,0x30,0x01,0x16,0x17,0x07,0x26,0x23,0x20,0x11,0x10,0x21,
-  0x32,0x37,0x15,0x06,0x07,0x15,0x23,0x35,0x24,0x11,0x10,0x25,0x35,0x33,0x02,0xE7,
-  0xA2,0x9C,0x3E,0x96,0x76,0xFE,0x8D,0x01,0x69,0x99,0xA8,0x7A,0xB1,0x89,0xFE,0x4E,
-  0x01,0xB2,0x89,0x05,0x27,0x03,0x38,0x9E,0x39,0xFE,0x62,0xFE,0x6B,0x3D,0x9F,0x3B,
-  0x03,0xC8,0xCE,0x45,0x01,0xE8,0x01,0xEE,0x4A,0xAC,0x00,0x01,0x00,0x77,0x00,0x00,
-  0x04,0x56,0x05,0xC9,0x00,0x1B,0x00,0x52,0x40,0x31,0x06,0x0A,0x6F,0x16,0x12,0x08,
-  0x12,0x08,0x0F,0x00,0x0D,0x1D,0x14,0x00,0x0F,0x01,0x0F,0x09,0x14,0x75,0x06,0x2F,
-  0x15,0x5F,0x15,0x7F,0x15,0x8F,0x15,0xAF,0x15,0xBF,0x15,0xDF,0x15,0x07,0x15,0x15,
-  0x0C,0x03,0x73,0x01,0x1A,0x07,0x10,0x0C,0x74,0x0F,0x18,0x00,0x3F,0xE1,0x32,0x3F,
-  0x33,0xE1,0x12,0x39,0x2F,0x5D,0x33,0xE1,0x32,0x01,0x2F,0x5D,0x33,0x10,0xCE,0x32,
-  0x11,0x39,0x39,0x2F,0x2F,0x33,0xE1,0x32,0x31,0x30,0x01,0x07,0x26,0x23,0x22,0x15,
-  0x11,0x21,0x15,0x21,0x15,0x14,0x07,0x21,0x15,0x21,0x35,0x36,0x35,0x35,0x23,0x35,
-  0x33,0x11,0x34,0x36,0x33,0x32,0x04,0x27,0x42,0x8D,0x83,0xDF,0x01,0x79,0xFE,0x87,
-  0x8C,0x02,0xEC,0xFC,0x21,0xC8,0xC6,0xC6,0xD9,0xB5,0xC0,0x05,0x79,0x90,0x48,0xF6,
-  0xFE,0xD9,0x89,0xD3,0xC4,0x4E,0xA6,0x9A,0x31,0xEB,0xD5,0x89,0x01,0x44,0xA8,0xC9,
-  0x00,0x02,0x00,0xAE,0x01,0x1D,0x04,0x1F,0x04,0x8B,0x00,0x1B,0x00,0x27,0x00,0x5E,
-  0x40,0x0A,0x25,0xAB,0x00,0x1A,0xB0,0x1A,0xE0,0x1A,0x03,0x1A,0xB8,0xFF,0xC0,0x40,
-  0x1D,0x0B,0x0F,0x48,0x1A,0x1A,0x1F,0xAB,0xC0,0x0C,0x01,0x4F,0x0C,0x5F,0x0C,0x6F,
-  0x0C,0x03,0x0C,0x29,0x1C,0xAE,0x00,0x13,0xB0,0x13,0xE0,0x13,0x03,0x13,0xB8,0xFF,
-  0xC0,0x40,0x15,0x0B,0x0F,0x48,0x13,0x13,0x22,0xAE,0x1F,0x05,0x3F,0x05,0x4F,0x05,
-  0x6F,0x05,0xBF,0x05,0xEF,0x05,0x06,0x05,0x00,0x2F,0x5D,0xE1,0x33,0x2F,0x2B,0x5D,
-  0xE1,0x01,0x10,0xDE,0x5D,0x5D,0xE1,0x33,0x2F,0x2B,0x5D,0xE1,0x31,0x30,0x01,0x27,
-  0x37,0x17,0x36,0x33,0x32,0x17,0x37,0x17,0x07,0x16,0x15,0x14,0x07,0x17,0x07,0x27,
-  0x06,0x23,0x22,0x27,0x07,0x27,0x37,0x26,0x35,0x34,0x01,0x32,0x36,0x35,0x34,0x26,
-  0x23,0x22,0x06,0x15,0x14,0x16,0x01,0x2F,0x81,0x62,0x7F,0x65,0x72,0x72,0x63,0x81,
-  0x63,0x81,0x43,0x43,0x7F,0x61,0x81,0x63,0x72,0x76,0x61,0x7F,0x60,0x7F,0x41,0x01,
-  0x78,0x64,0x90,0x8F,0x65,0x63,0x8C,0x8D,0x03,0xA8,0x81,0x62,0x81,0x44,0x44,0x81,
-  0x60,0x81,0x65,0x72,0x78,0x5F,0x7F,0x60,0x7F,0x42,0x44,0x7F,0x60,0x7F,0x5F,0x76,
-  0x72,0xFE,0x9E,0x8C,0x64,0x65,0x8F,0x8E,0x66,0x64,0x8C,0x00,0x00,0x01,0x00,0x4E,
-  0x00,0x00,0x04,0x7D,0x05,0xB6,0x00,0x16,0x00,0xBD,0xB9,0x00,0x16,0xFF,0xF8,0x40,
-  0x09,0x0A,0x0D,0x48,0x01,0x08,0x0A,0x0D,0x48,0x00,0xB8,0xFF,0xE8,0x40,0x3C,0x15,
-  0x18,0x48,0x66,0x00,0x76,0x00,0x02,0x12,0x0E,0x12,0x0E,0x0C,0x16,0xCF,0x15,0x01,
-  0x8B,0x15,0x01,0x74,0x15,0x01,0x15,0x15,0x0C,0x05,0x09,0x05,0x09,0x01,0x02,0x02,
-  0x67,0x00,0x01,0x00,0x07,0x03,0x0B,0x6E,0x14,0x10,0xC0,0x0C,0xD0,0x0C,0x02,0x67,
-  0x0C,0x01,0x10,0x0C,0x01,0x0C,0x0C,0x17,0x18,0x07,0x0F,0xB8,0x01,0x07,0xB4,0x0E,
-  0x0A,0x0E,0x06,0x12,0xB8,0x01,0x07,0x40,0x1D,0x13,0x03,0x00,0x13,0x9F,0x0E,0x01,
-  0x30,0x0E,0x40,0x0E,0x02,0x0F,0x13,0x1F,0x13,0x9F,0x13,0x03,0x0E,0x13,0x0E,0x13,
-  0x01,0x0B,0x12,0x16,0x01,0x06,0x00,0x3F,0x33,0x3F,0x12,0x39,0x39,0x2F,0x2F,0x5D,
-  0x5D,0x5D,0x11,0x33,0x33,0x10,0xE1,0x32,0x11,0x33,0x10,0xE1,0x32,0x11,0x12,0x01,
-  0x39,0x2F,0x5D,0x5D,0x5D,0x33,0x33,0xE1,0x32,0x32,0x39,0x5D,0x32,0x2F,0x33,0x39,
-  0x39,0x2F,0x2F,0x11,0x33,0x2F,0x5D,0x5D,0x5D,0x33,0x12,0x39,0x39,0x2F,0x2F,0x31,
-  0x30,0x00,0x5D,0x2B,0x01,0x2B,0x2B,0x01,0x01,0x33,0x01,0x33,0x15,0x21,0x15,0x21,
-  0x15,0x21,0x11,0x23,0x11,0x21,0x35,0x21,0x35,0x21,0x35,0x33,0x01,0x33,0x02,0x64,
-  0x01,0x5A,0xBF,0xFE,0x7F,0xF0,0xFE,0xD2,0x01,0x2E,0xFE,0xD2,0xB2,0xFE,0xD3,0x01,
-  0x2D,0xFE,0xD3,0xEA,0xFE,0x85,0xC0,0x02,0xD3,0x02,0xE3,0xFD,0x00,0x89,0x9E,0x89,
-  0xFE,0xFA,0x01,0x06,0x89,0x9E,0x89,0x03,0x00,0x00,0x00,0x02,0x02,0x1B,0xFE,0x14,
-  0x02,0xB0,0x06,0x14,0x00,0x03,0x00,0x07,0x00,0x21,0x40,0x10,0x02,0x06,0xAA,0x03,
-  0x4F,0x07,0x01,0x07,0x04,0x03,0x04,0x03,0x06,0x1B,0x00,0x00,0x00,0x3F,0x3F,0x39,
-  0x39,0x2F,0x2F,0x01,0x2F,0x5D,0x33,0xE1,0x32,0x31,0x30,0x01,0x33,0x11,0x23,0x11,
-  0x33,0x11,0x23,0x02,0x1B,0x95,0x95,0x95,0x95,0x06,0x14,0xFC,0xF4,0xFE,0x19,0xFC,
-  0xF3,0x00,0x00,0x02,0x00,0xF4,0xFF,0xF6,0x03,0xD9,0x06,0x1F,0x00,0x27,0x00,0x32,
-  0x00,0x7D,0x40,0x2B,0x08,0x00,0x01,0x06,0x14,0x01,0x09,0x00,0x01,0x28,0x14,0x2F,
-  0x16,0x00,0x2D,0x02,0x48,0x2A,0x01,0x2A,0x49,0x12,0x12,0x20,0x46,0x07,0x16,0x34,
-  0x47,0x2F,0x01,0x2F,0x49,0x26,0x0C,0x46,0x02,0x02,0x1B,0x00,0x26,0x01,0x26,0xB8,
-  0xFF,0xC0,0x40,0x1A,0x0C,0x0F,0x48,0x26,0x26,0x33,0x14,0x28,0x00,0x2D,0x0C,0x2D,
-  0x28,0x20,0x04,0x05,0x1E,0x4E,0x1C,0x19,0x16,0x0A,0x4E,0x08,0x05,0x01,0x00,0x3F,
-  0x33,0xE1,0x3F,0x33,0xE1,0x11,0x17,0x39,0x11,0x33,0x11,0x33,0x11,0x01,0x33,0x2F,
-  0x2B,0x5D,0x33,0x33,0x2F,0xE1,0x10,0xE1,0x5D,0x10,0xDE,0x32,0xE1,0x33,0x2F,0xE1,
-  0x5D,0x11,0x39,0x39,0x11,0x12,0x39,0x39,0x31,0x30,0x00,0x5D,0x5D,0x01,0x5D,0x01,
-  0x26,0x35,0x34,0x36,0x33,0x32,0x17,0x07,0x26,0x23,0x22,0x15,0x14,0x16,0x17,0x16,
-  0x16,0x15,0x14,0x07,0x16,0x15,0x14,0x06,0x23,0x22,0x27,0x35,0x16,0x33,0x32,0x35,
-  0x34,0x26,0x27,0x26,0x26,0x35,0x34,0x01,0x36,0x35,0x34,0x26,0x27,0x06,0x15,0x14,
-  0x16,0x17,0x01,0xA4,0xA0,0xD0,0xAD,0xA2,0xA4,0x38,0x9C,0x78,0xC9,0x63,0x93,0x9D,
-  0x94,0x91,0x91,0xDD,0xC5,0xCC,0x77,0xAB,0x98,0xF0,0x56,0x98,0xC5,0x70,0x01,0xC5,
-  0x72,0x93,0x85,0x85,0x71,0x97,0x04,0x2B,0x50,0x9C,0x78,0x90,0x48,0x8B,0x43,0x74,
-  0x36,0x4E,0x3D,0x3E,0x9B,0x71,0xB6,0x58,0x50,0x91,0x8A,0xA1,0x41,0x9E,0x52,0x8D,
-  0x39,0x50,0x3E,0x54,0x96,0x68,0xB3,0xFE,0x61,0x4C,0x6D,0x59,0x6F,0x30,0x30,0x7F,
-  0x49,0x6B,0x3F,0x00,0x00,0x02,0x01,0x4A,0x05,0x0C,0x03,0x81,0x05,0xD9,0x00,0x07,
-  0x00,0x0F,0x00,0x37,0x40,0x24,0x02,0x85,0x00,0x06,0x70,0x06,0xE0,0x06,0x03,0x06,
-  0x06,0x0E,0x85,0x0A,0x0A,0x11,0x08,0x00,0x93,0x0C,0x4F,0x04,0x6F,0x04,0x7F,0x04,
-  0x9F,0x04,0xAF,0x04,0xCF,0x04,0xDF,0x04,0x07,0x04,0x00,0x2F,0x5D,0x33,0xED,0x32,
-  0x11,0x01,0x33,0x2F,0xE1,0x33,0x2F,0x5D,0xE1,0x31,0x30,0x01,0x32,0x15,0x14,0x23,
-  0x22,0x35,0x34,0x21,0x32,0x15,0x14,0x23,0x22,0x35,0x34,0x01,0xAA,0x60,0x60,0x60,
-  0x01,0xD7,0x60,0x60,0x60,0x05,0xD9,0x66,0x67,0x67,0x66,0x66,0x67,0x67,0x66,0x00,
-  0x00,0x03,0x00,0x06,0xFF,0xEC,0x04,0xC7,0x05,0xCB,0x00,0x0B,0x00,0x17,0x00,0x2C,
-  0x00,0x6F,0x40,0x46,0x29,0xC5,0x23,0x19,0x1F,0x1E,0x2F,0x1E,0x3F,0x1E,0x03,0x1E,
-  0x19,0x1E,0x19,0x09,0x0F,0xC3,0x03,0x2E,0x15,0xC3,0x09,0x2B,0xC9,0x1B,0x18,0x1B,
-  0x26,0xC9,0x21,0x24,0x21,0x6F,0x1B,0x7F,0x1B,0x8F,0x1B,0x03,0x0D,0x1B,0x1D,0x1B,
-  0x02,0x60,0x21,0x70,0x21,0x80,0x21,0x03,0x02,0x21,0x12,0x21,0x02,0x1B,0x21,0x1B,
-  0x21,0x00,0x0C,0xC8,0x06,0x13,0x12,0xC8,0x00,0x04,0x00,0x3F,0xE1,0x3F,0xE1,0x11,
-  0x39,0x39,0x2F,0x2F,0x5D,0x5D,0x5D,0x5D,0x11,0x33,0x10,0xE1,0x11,0x33,0x10,0xE1,
-  0x01,0x2F,0xE1,0x10,0xD6,0xE1,0x11,0x39,0x39,0x2F,0x2F,0x5D,0x11,0x33,0xE1,0x31,
-  0x30,0x01,0x20,0x00,0x11,0x10,0x00,0x21,0x20,0x00,0x11,0x10,0x00,0x01,0x32,0x00,
-  0x11,0x10,0x00,0x23,0x22,0x00,0x11,0x10,0x00,0x01,0x15,0x06,0x23,0x22,0x26,0x35,
-  0x34,0x36,0x33,0x32,0x17,0x07,0x26,0x23,0x22,0x06,0x15,0x10,0x33,0x32,0x02,0x66,
-  0x01,0x1E,0x01,0x43,0xFE,0xBC,0xFE,0xE3,0xFE,0xE2,0xFE,0xBE,0x01,0x41,0x01,0x1F,
-  0xF0,0x01,0x04,0xFE,0xFC,0xF0,0xF0,0xFE,0xFD,0x01,0x03,0x01,0xF4,0x6B,0x72,0xC3,
-  0xD2,0xDC,0xBF,0x80,0x7E,0x3D,0x6E,0x53,0x79,0x82,0xFB,0x5E,0x05,0xCB,0xFE,0x68,
-  0xFE,0xA8,0xFE,0xA7,0xFE,0x6A,0x01,0x97,0x01,0x58,0x01,0x57,0x01,0x99,0xFA,0x8D,
-  0x01,0x55,0x01,0x2E,0x01,0x2E,0x01,0x55,0xFE,0xAA,0xFE,0xD3,0xFE,0xD3,0xFE,0xAA,
-  0x01,0x6D,0x83,0x32,0xF7,0xD6,0xD1,0xF6,0x3E,0x7F,0x36,0xAB,0x97,0xFE,0xBD,0x00,
-  0x00,0x02,0x01,0x14,0x03,0x10,0x03,0x8D,0x05,0xC7,0x00,0x14,0x00,0x1E,0x00,0x47,
-  0x40,0x25,0x1E,0x01,0x09,0xE0,0xC0,0x13,0x01,0x2F,0x13,0x7F,0x13,0x02,0x13,0x13,
-  0x18,0xE0,0x0F,0x30,0x05,0xA0,0x05,0x02,0x05,0x1E,0xE5,0x09,0x09,0x1A,0x0E,0x0C,
-  0xE4,0x11,0xDE,0x01,0x1A,0xE4,0x03,0xB8,0x01,0x00,0xB1,0x00,0xFF,0x00,0x3F,0x3F,
-  0xE1,0x32,0x3F,0xE1,0x33,0x12,0x39,0x2F,0xE1,0x01,0x2F,0x5D,0x33,0xE1,0x33,0x2F,
-  0x5D,0x5D,0xE1,0x32,0x32,0x31,0x30,0x01,0x27,0x06,0x23,0x22,0x35,0x34,0x36,0x37,
-  0x37,0x35,0x34,0x23,0x22,0x07,0x27,0x36,0x33,0x20,0x15,0x11,0x03,0x06,0x06,0x15,
-  0x14,0x33,0x32,0x36,0x35,0x35,0x03,0x1F,0x21,0x68,0xA4,0xDE,0xAA,0xBF,0x7D,0x98,
-  0x70,0x85,0x29,0x8A,0x9C,0x01,0x23,0xF7,0x72,0x78,0x68,0x69,0x7D,0x03,0x1D,0x76,
-  0x83,0xCD,0x74,0x67,0x06,0x05,0x0A,0x85,0x33,0x6E,0x3A,0xEE,0xFE,0x44,0x01,0x3F,
-  0x02,0x34,0x4B,0x5A,0x6E,0x5B,0x14,0x00,0x00,0x02,0x00,0xC5,0x00,0x73,0x04,0x06,
-  0x03,0xC7,0x00,0x06,0x00,0x0D,0x00,0x47,0x40,0x2A,0x0A,0xEB,0x07,0xEC,0x0B,0x8F,
-  0x09,0x01,0x60,0x09,0x01,0x09,0x0F,0x03,0xEB,0x00,0xEC,0x40,0x04,0x00,0x02,0x30,
-  0x02,0x60,0x02,0xA0,0x02,0x04,0x02,0x0C,0x05,0xEE,0x08,0x01,0xEE,0x20,0x00,0x06,
-  0x0A,0x03,0x03,0xEF,0x00,0x19,0x3F,0x17,0x33,0x1A,0xED,0x32,0xED,0x32,0x01,0x18,
-  0x2F,0x5D,0x33,0x1A,0xFD,0xE1,0x10,0xDE,0x5D,0x5D,0x32,0xFD,0xE1,0x31,0x30,0x13,
-  0x01,0x17,0x03,0x13,0x07,0x01,0x25,0x01,0x17,0x03,0x13,0x07,0x01,0xC5,0x01,0x35,
-  0x75,0xEE,0xEE,0x75,0xFE,0xCB,0x01,0x97,0x01,0x35,0x75,0xED,0xED,0x75,0xFE,0xCB,
-  0x02,0x29,0x01,0x9E,0x4E,0xFE,0xA4,0xFE,0xA4,0x4E,0x01,0x9B,0x1B,0x01,0x9E,0x4E,
-  0xFE,0xA4,0xFE,0xA4,0x4E,0x01,0x9B,0x00,0x00,0x01,0x00,0x98,0x01,0x06,0x04,0x33,
-  0x03,0x1D,0x00,0x05,0x00,0x2C,0xB7,0x03,0xAA,0x00,0x07,0x00,0x05,0x01,0x05,0xB8,
-  0xFF,0xC0,0x40,0x0D,0x15,0x18,0x48,0x05,0x05,0x06,0x03,0xAD,0x00,0x01,0x01,0x00,
-  0xB3,0x00,0x3F,0x32,0x2F,0x10,0xE1,0x11,0x01,0x33,0x2F,0x2B,0x5D,0x10,0xDE,0xE1,
-  0x31,0x30,0x01,0x11,0x23,0x11,0x21,0x35,0x04,0x33,0x95,0xFC,0xFA,0x03,0x1D,0xFD,
-  0xE9,0x01,0x81,0x96,0xFF,0xFF,0x01,0x1D,0x01,0xD1,0x03,0xB0,0x02,0x79,0x02,0x06,
-  0x00,0x10,0x00,0x00,0x00,0x04,0x00,0x06,0xFF,0xEC,0x04,0xC7,0x05,0xCB,0x00,0x0B,
-  0x00,0x17,0x00,0x23,0x00,0x2B,0x00,0x96,0x40,0x5E,0x18,0x22,0x24,0x1D,0xC5,0x1E,
-  0x1A,0x19,0x19,0x27,0xC5,0x22,0x1B,0x22,0x60,0x1E,0x01,0x60,0x22,0x01,0x1B,0x22,
-  0x01,0x1E,0x22,0x1E,0x22,0x09,0x0F,0xC3,0x03,0x2D,0x15,0xC3,0x09,0x1A,0x1E,0x15,
-  0x24,0x01,0x24,0xC9,0x1C,0x18,0x1C,0x2B,0xC9,0x1F,0xF0,0x1E,0x01,0x6F,0x1E,0x7F,
-  0x1E,0x8F,0x1E,0x03,0x0D,0x1E,0x1D,0x1E,0x02,0x22,0x1C,0x01,0x60,0x1F,0x70,0x1F,
-  0x80,0x1F,0x03,0x02,0x1F,0x12,0x1F,0x02,0x1E,0x1C,0x1F,0x1F,0x1C,0x1E,0x03,0x00,
-  0x0C,0xC8,0x06,0x13,0x12,0xC8,0x00,0x04,0x00,0x3F,0xE1,0x3F,0xE1,0x11,0x17,0x39,
-  0x2F,0x2F,0x2F,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x10,0xE1,0x11,0x33,0x10,0xE1,0x5D,
-  0x11,0x33,0x01,0x2F,0xE1,0x10,0xD6,0xE1,0x11,0x39,0x39,0x2F,0x2F,0x5D,0x5D,0x5D,
-  0x12,0x39,0x10,0xE1,0x33,0x11,0x33,0x10,0xE1,0x32,0x11,0x39,0x31,0x30,0x01,0x20,
-  0x00,0x11,0x10,0x00,0x21,0x20,0x00,0x11,0x10,0x00,0x01,0x32,0x00,0x11,0x10,0x00,
-  0x23,0x22,0x00,0x11,0x10,0x00,0x01,0x13,0x23,0x03,0x23,0x11,0x23,0x11,0x33,0x20,
-  0x11,0x14,0x25,0x33,0x32,0x35,0x34,0x26,0x23,0x23,0x02,0x66,0x01,0x1E,0x01,0x43,
-  0xFE,0xBC,0xFE,0xE3,0xFE,0xE2,0xFE,0xBE,0x01,0x41,0x01,0x1F,0xF0,0x01,0x04,0xFE,
-  0xFC,0xF0,0xF0,0xFE,0xFD,0x01,0x03,0x01,0x76,0xED,0xB2,0xCF,0x5E,0x9E,0xEA,0x01,
-  0x45,0xFE,0x6F,0x48,0xAA,0x54,0x59,0x45,0x05,0xCB,0xFE,0x68,0xFE,0xA8,0xFE,0xA7,
-  0xFE,0x6A,0x01,0x97,0x01,0x58,0x01,0x57,0x01,0x99,0xFA,0x8D,0x01,0x55,0x01,0x2E,
-  0x01,0x2E,0x01,0x55,0xFE,0xAA,0xFE,0xD3,0xFE,0xD3,0xFE,0xAA,0x02,0x50,0xFE,0x75,
-  0x01,0x60,0xFE,0xA0,0x03,0x7D,0xFE,0xF7,0xA3,0x12,0x8D,0x4A,0x3B,0x00,0x00,0x01,
-  0xFF,0xEC,0x06,0x14,0x04,0xE1,0x06,0xA0,0x00,0x03,0x00,0x0F,0xB5,0x01,0x00,0x03,
-  0xBA,0x00,0x00,0x00,0x3F,0xE1,0x01,0x2F,0x2F,0x31,0x30,0x01,0x21,0x35,0x21,0x04,
-  0xE1,0xFB,0x0B,0x04,0xF5,0x06,0x14,0x8C,0x00,0x02,0x01,0x2B,0x03,0x56,0x03,0xA2,
-  0x05,0xCB,0x00,0x0B,0x00,0x17,0x00,0x89,0x40,0x1A,0xA9,0x0A,0xB9,0x0A,0x02,0x0A,
-  0x10,0x09,0x0F,0x48,0xA9,0x08,0xB9,0x08,0x02,0x08,0x10,0x09,0x0F,0x48,0xA6,0x04,
-  0xB6,0x04,0x02,0x04,0xB8,0xFF,0xF0,0x40,0x09,0x09,0x0F,0x48,0xA6,0x02,0xB6,0x02,
-  0x02,0x02,0xB8,0xFF,0xF0,0x40,0x21,0x09,0x0F,0x48,0x0F,0xAB,0x9F,0x03,0xAF,0x03,
-  0xFF,0x03,0x03,0x03,0x19,0x15,0xAB,0x00,0x09,0x20,0x09,0x30,0x09,0x90,0x09,0xA0,
-  0x09,0xB0,0x09,0xF0,0x09,0x07,0x09,0x0C,0xB8,0x01,0x02,0x40,0x0C,0x00,0x06,0x10,
-  0x06,0x20,0x06,0xE0,0x06,0xF0,0x06,0x05,0x06,0xB8,0xFF,0xC0,0xB4,0x10,0x15,0x48,
-  0x06,0x12,0xB8,0x01,0x02,0xB1,0x00,0x04,0x00,0x3F,0xE1,0xD4,0x2B,0x5D,0xE1,0x01,
-  0x2F,0x5D,0xE1,0x10,0xDE,0x5D,0xE1,0x31,0x30,0x2B,0x5D,0x2B,0x5D,0x2B,0x5D,0x2B,
-  0x5D,0x01,0x32,0x16,0x15,0x14,0x06,0x23,0x22,0x26,0x35,0x34,0x36,0x13,0x32,0x36,
-  0x35,0x34,0x26,0x23,0x22,0x06,0x15,0x14,0x16,0x02,0x66,0x81,0xBB,0xBA,0x82,0x83,
-  0xB8,0xB9,0x82,0x4F,0x72,0x73,0x4E,0x4F,0x71,0x70,0x05,0xCB,0xBB,0x81,0x81,0xB8,
-  0xB9,0x80,0x81,0xBB,0xFE,0x06,0x70,0x4E,0x51,0x72,0x73,0x50,0x4E,0x70,0x00,0x02,
-  0x00,0x98,0x00,0x00,0x04,0x33,0x04,0xA2,0x00,0x0B,0x00,0x0F,0x00,0x29,0x40,0x16,
-  0x0E,0x09,0x06,0xAA,0x0D,0x00,0xC0,0x03,0xD0,0x03,0x02,0x03,0x0D,0xAD,0x0C,0x18,
-  0x09,0x00,0xAD,0x06,0x03,0xB3,0x00,0x3F,0x33,0xE1,0x32,0x3F,0xE1,0x01,0x2F,0x5D,
-  0x33,0x33,0xE1,0x32,0x32,0x31,0x30,0x01,0x21,0x35,0x21,0x11,0x33,0x11,0x21,0x15,
-  0x21,0x11,0x23,0x01,0x35,0x21,0x15,0x02,0x1B,0xFE,0x7D,0x01,0x83,0x95,0x01,0x83,
-  0xFE,0x7D,0x95,0xFE,0x7D,0x03,0x9B,0x02,0x87,0x96,0x01,0x85,0xFE,0x7B,0x96,0xFE,
-  0x7F,0xFE,0xFA,0x96,0x96,0x00,0x00,0x01,0x01,0x5C,0x02,0xA0,0x03,0x6F,0x05,0xC5,
-  0x00,0x15,0x00,0x4D,0x40,0x33,0x15,0x15,0x06,0xE0,0x0F,0x10,0x1F,0x10,0x4F,0x10,
-  0x5F,0x10,0x7F,0x10,0x8F,0x10,0x9F,0x10,0x07,0x10,0x10,0x14,0x0B,0x0B,0x00,0x01,
-  0x60,0x01,0x70,0x01,0x80,0x01,0x04,0x01,0x06,0x01,0x0A,0x10,0x11,0x18,0x48,0x0A,
-  0x08,0xE4,0x0D,0xDE,0x02,0x14,0xE4,0x01,0xDD,0x00,0x3F,0xE1,0x32,0x3F,0xE1,0x33,
-  0x2B,0x12,0x39,0x01,0x2F,0x5D,0x32,0x2F,0x32,0x32,0x2F,0x5D,0xE1,0x33,0x2F,0x31,
-  0x30,0x01,0x21,0x35,0x37,0x36,0x36,0x35,0x34,0x23,0x22,0x07,0x27,0x36,0x33,0x32,
-  0x16,0x15,0x14,0x06,0x07,0x07,0x21,0x03,0x6F,0xFD,0xED,0xBB,0x6F,0x3D,0x6F,0x51,
-  0x53,0x4E,0x75,0x83,0x76,0x82,0x46,0x81,0x87,0x01,0x6B,0x02,0xA0,0x66,0xC7,0x76,
-  0x65,0x39,0x73,0x4C,0x56,0x67,0x78,0x68,0x42,0x88,0x81,0x88,0x00,0x01,0x01,0x56,
-  0x02,0x8F,0x03,0x4E,0x05,0xC5,0x00,0x1E,0x00,0x84,0x40,0x4F,0x00,0x10,0x13,0xE0,
-  0x17,0x1D,0x01,0x1D,0x1D,0x02,0x10,0x10,0x07,0x0C,0xE0,0x0F,0x02,0x1F,0x02,0x4F,
-  0x02,0x5F,0x02,0x7F,0x02,0x8F,0x02,0x9F,0x02,0x07,0x02,0x02,0x07,0x18,0x18,0x00,
-  0x07,0x60,0x07,0x70,0x07,0x03,0x07,0x00,0x0F,0xE5,0xFA,0x10,0x01,0xE9,0x10,0x01,
-  0xA8,0x10,0x01,0x6F,0x10,0x01,0x0B,0x10,0x1B,0x10,0x02,0x10,0x10,0x0A,0x17,0x10,
-  0x11,0x18,0x48,0x17,0x15,0xE4,0x1A,0xDE,0x0A,0xE4,0x08,0xB8,0xFF,0xF0,0xB5,0x11,
-  0x18,0x48,0x08,0x05,0xDF,0x00,0x3F,0x33,0x2B,0xE1,0x3F,0xE1,0x33,0x2B,0x12,0x39,
-  0x2F,0x5D,0x5D,0x5D,0x5D,0x5D,0xE1,0x39,0x01,0x2F,0x5D,0x33,0x2F,0x11,0x33,0x2F,
-  0x5D,0xE1,0x12,0x39,0x2F,0x11,0x33,0x2F,0x5D,0xE1,0x12,0x39,0x31,0x30,0x01,0x16,
-  0x15,0x14,0x06,0x23,0x22,0x27,0x35,0x16,0x33,0x32,0x35,0x34,0x23,0x23,0x35,0x33,
-  0x32,0x35,0x34,0x23,0x22,0x07,0x27,0x36,0x33,0x32,0x16,0x15,0x14,0x02,0x9E,0xB0,
-  0x95,0x8C,0x83,0x54,0x6E,0x5D,0x95,0x93,0x48,0x46,0x7B,0x61,0x47,0x5A,0x42,0x6F,
-  0x7F,0x6D,0x80,0x04,0x3D,0x27,0x93,0x74,0x80,0x32,0x7C,0x41,0x89,0x7D,0x68,0x7F,
-  0x6F,0x46,0x56,0x5D,0x6D,0x5E,0x8B,0x00,0x00,0x01,0x01,0xA2,0x04,0xD9,0x03,0x2B,
-  0x06,0x21,0x00,0x07,0x00,0x1F,0x40,0x10,0x06,0x07,0x86,0x02,0x87,0x03,0x03,0x09,
-  0x02,0x92,0x0F,0x06,0x5F,0x06,0x02,0x06,0x00,0x2F,0x5D,0xED,0x11,0x01,0x33,0x2F,
-  0xE1,0xED,0x32,0x31,0x30,0x01,0x36,0x37,0x33,0x15,0x06,0x07,0x23,0x01,0xA2,0x5E,
-  0x50,0xDB,0x70,0xA0,0x79,0x04,0xF4,0x85,0xA8,0x15,0xAD,0x86,0x00,0x01,0x00,0xB4,
-  0xFE,0x14,0x04,0x19,0x04,0x4A,0x00,0x15,0x00,0x3D,0x40,0x10,0x0A,0x05,0x47,0x8F,
-  0x08,0x01,0x08,0x17,0x0F,0x00,0x12,0x47,0x00,0x13,0x01,0x13,0xB8,0xFF,0xC0,0x40,
-  0x10,0x11,0x14,0x48,0x13,0x12,0x1B,0x0A,0x02,0x50,0x0D,0x16,0x09,0x15,0x14,0x06,
-  0x0F,0x00,0x3F,0x33,0x3F,0x3F,0xE1,0x32,0x3F,0x01,0x2F,0x2B,0x5D,0xE1,0x32,0x32,
-  0x10,0xDE,0x5D,0xE1,0x32,0x31,0x30,0x01,0x10,0x33,0x32,0x36,0x35,0x11,0x33,0x11,
-  0x23,0x27,0x23,0x06,0x23,0x22,0x27,0x16,0x15,0x11,0x23,0x11,0x33,0x01,0x6A,0xDA,
-  0x94,0x8A,0xB7,0x94,0x1B,0x0A,0x60,0xC7,0x8B,0x4A,0x06,0xB6,0xB6,0x01,0x87,0xFE,
-  0xFC,0xB6,0xD7,0x02,0x3A,0xFB,0xB6,0x93,0xA7,0x58,0x99,0x57,0xFE,0xC0,0x06,0x36,
-  0x00,0x01,0x00,0x42,0xFE,0xFC,0x04,0x37,0x06,0x14,0x00,0x0E,0x00,0x4D,0xB7,0x04,
-  0x9A,0x60,0x05,0xF0,0x05,0x02,0x05,0xB8,0xFF,0xC0,0x40,0x25,0x12,0x16,0x48,0x22,
-  0x05,0x32,0x05,0x02,0x04,0x05,0x14,0x05,0x02,0x05,0x05,0x0A,0x01,0x9A,0x00,0x10,
-  0x0A,0x40,0x0A,0x0F,0x48,0x0A,0x0A,0x0F,0x08,0x08,0x00,0x02,0x51,0x0E,0x00,0x05,
-  0x00,0x00,0x2F,0x32,0x3F,0xE1,0x12,0x39,0x2F,0x11,0x01,0x33,0x2F,0x2B,0x10,0xDE,
-  0xE1,0x11,0x39,0x2F,0x5D,0x5D,0x2B,0x5D,0xE1,0x31,0x30,0x01,0x23,0x11,0x23,0x11,
-  0x23,0x11,0x06,0x23,0x20,0x11,0x10,0x36,0x33,0x21,0x04,0x37,0x79,0xCE,0x79,0x3D,
-  0x55,0xFE,0x5D,0xD9,0xE9,0x02,0x33,0xFE,0xFC,0x06,0x79,0xF9,0x87,0x03,0x33,0x12,
-  0x01,0xF5,0x01,0x03,0xFF,0x00,0x00,0x01,0x01,0xE7,0x02,0x48,0x02,0xE5,0x03,0x5E,
-  0x00,0x07,0x00,0x22,0x40,0x14,0x02,0x96,0x30,0x06,0x60,0x06,0xB0,0x06,0xE0,0x06,
-  0xF0,0x06,0x05,0x06,0x06,0x08,0x09,0x00,0x9B,0x04,0x00,0x2F,0xED,0x11,0x12,0x01,
-  0x39,0x2F,0x5D,0xED,0x31,0x30,0x01,0x32,0x15,0x14,0x23,0x22,0x35,0x34,0x02,0x66,
-  0x7F,0x7F,0x7F,0x03,0x5E,0x8B,0x8B,0x8B,0x8B,0x00,0x00,0x01,0x01,0xAC,0xFE,0x14,
-  0x03,0x21,0x00,0x00,0x00,0x0F,0x00,0x43,0xB9,0x00,0x0D,0xFF,0xB0,0x40,0x21,0x0B,
-  0x13,0x48,0x07,0x30,0x09,0x0E,0x48,0x08,0x07,0x09,0x0A,0x07,0x0A,0x00,0x05,0x84,
-  0x0C,0x5F,0x00,0x01,0x00,0x00,0x0C,0x0C,0x11,0x0A,0x07,0x08,0x03,0x8D,0x0E,0x08,
-  0x00,0x2F,0x2F,0xE1,0x11,0x39,0x39,0x11,0x01,0x33,0x2F,0x33,0x2F,0x5D,0x10,0xE1,
-  0x11,0x39,0x39,0x11,0x33,0x11,0x33,0x31,0x30,0x2B,0x2B,0x01,0x35,0x16,0x33,0x32,
-  0x35,0x34,0x27,0x37,0x33,0x07,0x16,0x15,0x14,0x21,0x22,0x01,0xAC,0x21,0x2F,0x97,
-  0xAC,0x5B,0x78,0x39,0xA0,0xFE,0xDD,0x22,0xFE,0x1D,0x6C,0x06,0x5C,0x4A,0x27,0xB0,
-  0x73,0x25,0x87,0xCD,0x00,0x01,0x01,0x6F,0x02,0xA0,0x02,0xD1,0x05,0xB4,0x00,0x0A,
-  0x00,0x21,0x40,0x0F,0x0A,0x0A,0x02,0xE0,0x00,0x03,0x03,0x0B,0x0C,0x02,0xDD,0x06,
-  0x09,0x00,0xDC,0x00,0x3F,0xCD,0x39,0x3F,0x11,0x12,0x01,0x39,0x2F,0x33,0xE1,0x33,
-  0x2F,0x31,0x30,0x01,0x33,0x11,0x23,0x11,0x34,0x37,0x06,0x07,0x07,0x27,0x02,0x4A,
-  0x87,0x92,0x09,0x29,0x21,0x46,0x49,0x05,0xB4,0xFC,0xEC,0x01,0xD1,0x45,0x83,0x2C,
-  0x15,0x33,0x58,0x00,0x00,0x02,0x01,0x19,0x03,0x10,0x03,0xB4,0x05,0xC7,0x00,0x0B,
-  0x00,0x13,0x00,0x30,0x40,0x1B,0x0E,0xE0,0xB0,0x09,0x01,0x7F,0x09,0x01,0x09,0x09,
-  0x12,0xE0,0x20,0x03,0x30,0x03,0xA0,0x03,0x03,0x03,0x10,0xE6,0x06,0xDE,0x0C,0xE6,
-  0x00,0xB8,0x01,0x00,0x00,0x3F,0xE1,0x3F,0xE1,0x01,0x2F,0x5D,0xE1,0x33,0x2F,0x5D,
-  0x5D,0xE1,0x31,0x30,0x01,0x22,0x26,0x35,0x34,0x36,0x33,0x32,0x16,0x15,0x14,0x06,
-  0x27,0x32,0x35,0x34,0x23,0x22,0x15,0x14,0x02,0x64,0x90,0xBB,0xB4,0x9B,0x91,0xBB,
-  0xB8,0x96,0xB5,0xB5,0xB6,0x03,0x10,0xBA,0xA3,0xA2,0xB8,0xB9,0xA1,0xA5,0xB8,0x77,
-  0xE6,0xE1,0xE1,0xE6,0x00,0x02,0x00,0xC5,0x00,0x73,0x04,0x06,0x03,0xC7,0x00,0x06,
-  0x00,0x0D,0x00,0x47,0x40,0x2A,0x02,0x04,0xEC,0x03,0xEB,0x3F,0x06,0x8F,0x06,0x9F,
-  0x06,0xAF,0x06,0x04,0x06,0x0F,0x09,0x0B,0xEC,0x40,0x0A,0xEB,0x9F,0x0D,0x01,0x00,
-  0x0D,0x01,0x0D,0x0C,0x05,0xEE,0x08,0x01,0xEE,0x20,0x00,0x06,0x0A,0x03,0x03,0xEF,
-  0x00,0x19,0x3F,0x17,0x33,0x1A,0xED,0x32,0xED,0x32,0x01,0x18,0x2F,0x5D,0x5D,0xE1,
-  0x1A,0xED,0x32,0x10,0xDE,0x5D,0xE1,0xED,0x32,0x31,0x30,0x01,0x01,0x27,0x13,0x03,
-  0x37,0x01,0x05,0x01,0x27,0x13,0x03,0x37,0x01,0x04,0x06,0xFE,0xCB,0x75,0xEE,0xEE,
-  0x75,0x01,0x35,0xFE,0x69,0xFE,0xCA,0x74,0xED,0xED,0x74,0x01,0x36,0x02,0x0E,0xFE,
-  0x65,0x4E,0x01,0x5C,0x01,0x5C,0x4E,0xFE,0x62,0x1B,0xFE,0x65,0x4E,0x01,0x5C,0x01,
-  0x5C,0x4E,0xFE,0x62,0xFF,0xFF,0x00,0x16,0x00,0x00,0x04,0xB8,0x05,0xB6,0x02,0x27,
-  0x00,0x7B,0xFE,0xA7,0x00,0x00,0x00,0x26,0x02,0x17,0x00,0x00,0x01,0x07,0x02,0x3C,
-  0x01,0x39,0xFD,0x59,0x00,0x3C,0x40,0x27,0x03,0x02,0x12,0x18,0x03,0x02,0xF0,0x12,
-  0x01,0xE0,0x12,0x01,0x80,0x12,0x01,0x7F,0x12,0x01,0x10,0x12,0x01,0x12,0x00,0xF0,
-  0x00,0x01,0xE0,0x00,0x01,0xB0,0x00,0x01,0x50,0x00,0x01,0x40,0x00,0x01,0x00,0x11,
-  0x5D,0x5D,0x5D,0x5D,0x5D,0x35,0x11,0x5D,0x5D,0x5D,0x5D,0x5D,0x35,0x35,0x00,0x3F,
-  0x35,0x35,0xFF,0xFF,0x00,0x03,0x00,0x00,0x04,0xC9,0x05,0xB6,0x02,0x27,0x00,0x7B,
-  0xFE,0x94,0x00,0x00,0x00,0x26,0x02,0x17,0xBF,0x00,0x01,0x07,0x00,0x74,0x01,0x5A,
-  0xFD,0x61,0x00,0x44,0x40,0x2D,0x02,0x10,0x18,0x02,0xF0,0x10,0x01,0xE0,0x10,0x01,
-  0xD0,0x10,0x01,0xC0,0x10,0x01,0x10,0x10,0x01,0x00,0x10,0x01,0x10,0x01,0xAF,0x0D,
-  0x01,0x8F,0x0D,0x01,0x0D,0x00,0xF0,0x00,0x01,0xE0,0x00,0x01,0x50,0x00,0x01,0x40,
-  0x00,0x01,0x00,0x11,0x5D,0x5D,0x5D,0x5D,0x35,0x11,0x5D,0x5D,0x35,0x11,0x5D,0x5D,
-  0x5D,0x5D,0x5D,0x5D,0x35,0x00,0x3F,0x35,0xFF,0xFF,0x00,0x15,0x00,0x00,0x04,0xCD,
-  0x05,0xC5,0x02,0x27,0x00,0x75,0xFE,0xBF,0x00,0x00,0x00,0x26,0x02,0x17,0x35,0x00,
-  0x01,0x07,0x02,0x3C,0x01,0x4E,0xFD,0x59,0x00,0x38,0x40,0x24,0x03,0x02,0x26,0x18,
-  0x03,0x02,0xF0,0x26,0x01,0xE0,0x26,0x01,0x80,0x26,0x01,0x10,0x26,0x01,0x26,0x01,
-  0xF4,0x21,0x01,0xE4,0x21,0x01,0xD4,0x21,0x01,0xC4,0x21,0x01,0xB0,0x21,0x01,0x21,
-  0x11,0x5D,0x5D,0x5D,0x5D,0x5D,0x35,0x11,0x5D,0x5D,0x5D,0x5D,0x35,0x35,0x00,0x3F,
-  0x35,0x35,0x00,0x02,0x00,0xA8,0xFE,0x77,0x04,0x1F,0x04,0x5E,0x00,0x07,0x00,0x21,
-  0x00,0x5B,0x40,0x37,0x21,0x08,0x08,0x06,0x96,0x40,0x02,0x50,0x02,0x02,0x02,0x02,
-  0x0F,0x9F,0x15,0x01,0x15,0x23,0x20,0x23,0x01,0x0F,0x47,0x9F,0x1A,0x01,0x00,0x1A,
-  0x01,0x1A,0x0F,0x17,0x20,0x08,0x01,0x08,0x08,0x00,0x14,0x12,0x51,0x30,0x17,0x01,
-  0x17,0x1A,0x00,0x01,0x09,0x00,0x01,0x00,0x9B,0x04,0x10,0x00,0x3F,0xE1,0x5D,0x5D,
-  0x2F,0x5D,0xE1,0x33,0x12,0x39,0x2F,0x5D,0x12,0x39,0x01,0x2F,0x5D,0x5D,0xE1,0x5D,
-  0x10,0xCE,0x5D,0x11,0x39,0x2F,0x5D,0xE5,0x32,0x11,0x33,0x31,0x30,0x01,0x22,0x35,
-  0x34,0x33,0x32,0x15,0x14,0x07,0x15,0x14,0x06,0x07,0x06,0x06,0x15,0x14,0x16,0x33,
-  0x32,0x37,0x17,0x06,0x23,0x22,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x35,0x35,0x02,
-  0xA2,0x7F,0x7F,0x7F,0x27,0x59,0x76,0x81,0x54,0x95,0x84,0xB5,0xBD,0x3E,0xDB,0xCB,
-  0xD9,0xF8,0x6B,0x8F,0x77,0x41,0x03,0x48,0x8B,0x8B,0x8B,0x8B,0xA4,0x25,0x77,0x95,
-  0x54,0x61,0x74,0x65,0x5D,0x71,0x5A,0x90,0x6A,0xC3,0xA3,0x86,0xA6,0x6C,0x57,0x6B,
-  0x5A,0x13,0xFF,0xFF,0x00,0x21,0x00,0x00,0x04,0xAC,0x07,0x73,0x02,0x26,0x00,0x24,
-  0x00,0x00,0x01,0x07,0x00,0x43,0xFF,0xB3,0x01,0x52,0x00,0x15,0xB4,0x02,0x0F,0x05,
-  0x26,0x02,0xB8,0xFF,0xB3,0xB4,0x12,0x0F,0x04,0x07,0x25,0x01,0x2B,0x35,0x00,0x2B,
-  0x35,0x00,0xFF,0xFF,0x00,0x21,0x00,0x00,0x04,0xAC,0x07,0x73,0x02,0x26,0x00,0x24,
-  0x00,0x00,0x01,0x07,0x00,0x76,0x00,0x66,0x01,0x52,0x00,0x13,0x40,0x0B,0x02,0x15,
-  0x05,0x26,0x02,0x66,0x0F,0x12,0x04,0x07,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,
-  0xFF,0xFF,0x00,0x21,0x00,0x00,0x04,0xAC,0x07,0x73,0x02,0x26,0x00,0x24,0x00,0x00,
-  0x01,0x07,0x01,0x4B,0x00,0x00,0x01,0x52,0x00,0x13,0x40,0x0B,0x02,0x0F,0x05,0x26,
-  0x02,0x00,0x15,0x0F,0x04,0x07,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,
-  0x00,0x21,0x00,0x00,0x04,0xAC,0x07,0x35,0x02,0x26,0x00,0x24,0x00,0x00,0x01,0x07,
-  0x01,0x52,0xFF,0xFF,0x01,0x52,0x00,0x15,0xB4,0x02,0x0F,0x05,0x26,0x02,0xB8,0xFF,
-  0xFE,0xB4,0x10,0x19,0x04,0x07,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,
-  0x00,0x21,0x00,0x00,0x04,0xAC,0x07,0x2B,0x02,0x26,0x00,0x24,0x00,0x00,0x01,0x07,
-  0x00,0x6A,0x00,0x00,0x01,0x52,0x00,0x19,0xB6,0x03,0x02,0x13,0x05,0x26,0x03,0x02,
-  0xB8,0xFF,0xFF,0xB4,0x15,0x19,0x04,0x07,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,
-  0x35,0x00,0xFF,0xFF,0x00,0x21,0x00,0x00,0x04,0xAC,0x07,0x04,0x02,0x26,0x00,0x24,
-  0x00,0x00,0x01,0x06,0x01,0x50,0x00,0x7D,0x00,0x34,0x40,0x1A,0x03,0x02,0xEF,0x1A,
-  0x01,0xDF,0x1A,0x01,0x50,0x1A,0x01,0x40,0x1A,0x01,0x20,0x1A,0x01,0x10,0x1A,0x01,
-  0x00,0x1A,0x01,0x1A,0x03,0x02,0xB8,0xFF,0xFF,0xB4,0x12,0x18,0x04,0x07,0x25,0x01,
-  0x2B,0x35,0x35,0x00,0x11,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x35,0x35,0x00,0x02,
-  0x00,0x00,0x00,0x00,0x04,0xBA,0x05,0xB6,0x00,0x0F,0x00,0x13,0x00,0x86,0x40,0x54,
-  0x06,0x08,0x0B,0x0E,0x48,0x10,0x03,0x13,0x04,0xC9,0x13,0xD9,0x13,0xE9,0x13,0x03,
-  0x37,0x13,0x01,0x13,0x06,0x0A,0x0E,0x5A,0x01,0x11,0x01,0x0F,0x01,0x01,0x4F,0x01,
-  0x5F,0x01,0x7F,0x01,0x8F,0x01,0xEF,0x01,0xFF,0x01,0x06,0x06,0x01,0x0B,0x0B,0x01,
-  0x06,0x03,0x05,0x08,0x00,0x15,0x04,0x05,0x03,0x5F,0x10,0x0D,0x5F,0x0A,0x9F,0x10,
-  0xCF,0x10,0x02,0x68,0x0A,0x01,0x10,0x0A,0x10,0x0A,0x0E,0x13,0x09,0x5F,0x06,0x03,
-  0x0E,0x5F,0x04,0x01,0x00,0x2F,0x33,0xE1,0x3F,0xE1,0x32,0x12,0x39,0x39,0x2F,0x2F,
-  0x5D,0x5D,0x10,0xE1,0x10,0xE1,0x01,0x2F,0x33,0x10,0xCE,0x32,0x11,0x17,0x39,0x2F,
-  0x2F,0x2F,0x5D,0x71,0x11,0x33,0x10,0xE1,0x32,0x11,0x33,0x5D,0x5D,0x11,0x12,0x39,
-  0x39,0x2B,0x31,0x30,0x21,0x21,0x11,0x21,0x03,0x23,0x01,0x21,0x15,0x21,0x11,0x21,
-  0x15,0x21,0x11,0x21,0x01,0x33,0x11,0x23,0x04,0xBA,0xFD,0x73,0xFE,0xDF,0x60,0xAC,
-  0x01,0x52,0x03,0x68,0xFE,0x23,0x01,0xB6,0xFE,0x4A,0x01,0xDD,0xFC,0x77,0xFC,0x6A,
-  0x01,0xC5,0xFE,0x3B,0x05,0xB6,0xA4,0xFE,0x3C,0xA2,0xFD,0xF8,0x01,0xC6,0x02,0xA8,
-  0xFF,0xFF,0x00,0x81,0xFE,0x14,0x04,0x9C,0x05,0xCB,0x02,0x26,0x00,0x26,0x00,0x00,
-  0x01,0x06,0x00,0x7A,0x50,0x00,0x00,0x0B,0xB6,0x01,0x28,0x16,0x22,0x06,0x0B,0x25,
-  0x01,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xD9,0x00,0x00,0x04,0x23,0x07,0x73,0x02,0x26,
-  0x00,0x28,0x00,0x00,0x01,0x07,0x00,0x43,0xFF,0xB7,0x01,0x52,0x00,0x15,0xB4,0x01,
-  0x0C,0x05,0x26,0x01,0xB8,0xFF,0xA0,0xB4,0x0F,0x0C,0x01,0x00,0x25,0x01,0x2B,0x35,
-  0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xD9,0x00,0x00,0x04,0x23,0x07,0x73,0x02,0x26,
-  0x00,0x28,0x00,0x00,0x01,0x07,0x00,0x76,0x00,0x3F,0x01,0x52,0x00,0x13,0x40,0x0B,
-  0x01,0x12,0x05,0x26,0x01,0x27,0x0C,0x0F,0x01,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,
-  0x35,0x00,0xFF,0xFF,0x00,0xD9,0x00,0x00,0x04,0x23,0x07,0x73,0x02,0x26,0x00,0x28,
-  0x00,0x00,0x01,0x07,0x01,0x4B,0x00,0x23,0x01,0x52,0x00,0x13,0x40,0x0B,0x01,0x0C,
-  0x05,0x26,0x01,0x0B,0x12,0x0C,0x01,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,
-  0xFF,0xFF,0x00,0xD9,0x00,0x00,0x04,0x23,0x07,0x2B,0x02,0x26,0x00,0x28,0x00,0x00,
-  0x01,0x07,0x00,0x6A,0x00,0x19,0x01,0x52,0x00,0x17,0x40,0x0D,0x02,0x01,0x10,0x05,
-  0x26,0x02,0x01,0x00,0x12,0x16,0x01,0x00,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,
-  0x35,0x00,0xFF,0xFF,0x00,0xE1,0x00,0x00,0x03,0xE9,0x07,0x73,0x02,0x26,0x00,0x2C,
-  0x00,0x00,0x01,0x07,0x00,0x43,0xFF,0x94,0x01,0x52,0x00,0x15,0xB4,0x01,0x0C,0x05,
-  0x26,0x01,0xB8,0xFF,0x96,0xB4,0x0F,0x0C,0x01,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,
-  0x35,0x00,0xFF,0xFF,0x00,0xE1,0x00,0x00,0x03,0xE9,0x07,0x73,0x02,0x26,0x00,0x2C,
-  0x00,0x00,0x01,0x07,0x00,0x76,0x00,0x77,0x01,0x52,0x00,0x13,0x40,0x0B,0x01,0x12,
-  0x05,0x26,0x01,0x78,0x0C,0x0F,0x01,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,
-  0xFF,0xFF,0x00,0xE1,0x00,0x00,0x03,0xE9,0x07,0x73,0x02,0x26,0x00,0x2C,0x00,0x00,
-  0x01,0x07,0x01,0x4B,0x00,0x00,0x01,0x52,0x00,0x13,0x40,0x0B,0x01,0x0C,0x05,0x26,
-  0x01,0x01,0x12,0x0C,0x01,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,
-  0x00,0xE1,0x00,0x00,0x03,0xE9,0x07,0x2B,0x02,0x26,0x00,0x2C,0x00,0x00,0x01,0x07,
-  0x00,0x6A,0x00,0x02,0x01,0x52,0x00,0x17,0x40,0x0D,0x02,0x01,0x10,0x05,0x26,0x02,
-  0x01,0x02,0x12,0x16,0x01,0x00,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,
-  0x00,0x02,0x00,0x00,0x00,0x00,0x04,0x7B,0x05,0xB6,0x00,0x0C,0x00,0x17,0x00,0x49,
-  0x40,0x2C,0x10,0x00,0x15,0x5B,0x09,0x19,0x0E,0x12,0x5A,0x04,0x02,0x00,0x00,0xE0,
-  0x00,0xF0,0x00,0x03,0x00,0x11,0x02,0x5F,0x0E,0x68,0x03,0x01,0x2F,0x03,0x9F,0x03,
-  0xCF,0x03,0x03,0x03,0x03,0x12,0x0D,0x60,0x05,0x03,0x12,0x60,0x00,0x12,0x00,0x3F,
-  0xE1,0x3F,0xE1,0x12,0x39,0x2F,0x5D,0x5D,0x33,0xE1,0x32,0x01,0x2F,0x5D,0xC6,0x33,
-  0xE1,0x32,0x10,0xDE,0xE1,0x11,0x39,0x31,0x30,0x33,0x11,0x23,0x35,0x33,0x11,0x21,
-  0x20,0x00,0x11,0x10,0x00,0x21,0x03,0x11,0x21,0x15,0x21,0x11,0x33,0x20,0x11,0x10,
-  0x21,0x87,0x87,0x87,0x01,0x56,0x01,0x3D,0x01,0x61,0xFE,0x92,0xFE,0xA7,0x72,0x01,
-  0x7C,0xFE,0x84,0x60,0x02,0x14,0xFE,0x13,0x02,0x93,0xA2,0x02,0x81,0xFE,0x86,0xFE,
-  0xAD,0xFE,0x97,0xFE,0x80,0x05,0x17,0xFE,0x1E,0xA2,0xFE,0x0D,0x02,0x43,0x02,0x34,
-  0xFF,0xFF,0x00,0x87,0x00,0x00,0x04,0x44,0x07,0x35,0x02,0x26,0x00,0x31,0x00,0x00,
-  0x01,0x07,0x01,0x52,0x00,0x04,0x01,0x52,0x00,0x13,0x40,0x0B,0x01,0x10,0x05,0x26,
-  0x01,0x04,0x11,0x1A,0x07,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,
-  0x00,0x54,0xFF,0xEC,0x04,0x7B,0x07,0x73,0x02,0x26,0x00,0x32,0x00,0x00,0x01,0x07,
-  0x00,0x43,0xFF,0xAF,0x01,0x52,0x00,0x15,0xB4,0x02,0x14,0x05,0x26,0x02,0xB8,0xFF,
-  0xAE,0xB4,0x17,0x14,0x02,0x07,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,
-  0x00,0x54,0xFF,0xEC,0x04,0x7B,0x07,0x73,0x02,0x26,0x00,0x32,0x00,0x00,0x01,0x07,
-  0x00,0x76,0x00,0x5A,0x01,0x52,0x00,0x13,0x40,0x0B,0x02,0x1A,0x05,0x26,0x02,0x59,
-  0x14,0x17,0x02,0x07,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x54,
-  0xFF,0xEC,0x04,0x7B,0x07,0x73,0x02,0x26,0x00,0x32,0x00,0x00,0x01,0x07,0x01,0x4B,
-  0x00,0x00,0x01,0x52,0x00,0x15,0xB4,0x02,0x14,0x05,0x26,0x02,0xB8,0xFF,0xFF,0xB4,
-  0x1A,0x14,0x02,0x07,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x54,
-  0xFF,0xEC,0x04,0x7B,0x07,0x35,0x02,0x26,0x00,0x32,0x00,0x00,0x01,0x07,0x01,0x52,
-  0x00,0x08,0x01,0x52,0x00,0x13,0x40,0x0B,0x02,0x14,0x05,0x26,0x02,0x06,0x15,0x1E,
-  0x02,0x07,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x54,0xFF,0xEC,
-  0x04,0x7B,0x07,0x2B,0x02,0x26,0x00,0x32,0x00,0x00,0x01,0x07,0x00,0x6A,0x00,0x02,
-  0x01,0x52,0x00,0x17,0x40,0x0D,0x03,0x02,0x18,0x05,0x26,0x03,0x02,0x00,0x1A,0x1E,
-  0x02,0x07,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,0x00,0x01,0x00,0xBE,
-  0x01,0x2D,0x04,0x0E,0x04,0x7B,0x00,0x0B,0x00,0x5C,0xB9,0x00,0x06,0xFF,0xF0,0xB3,
-  0x0F,0x16,0x48,0x06,0xB8,0xFF,0xF8,0x40,0x18,0x0A,0x0E,0x48,0x00,0x10,0x0F,0x16,
-  0x48,0x00,0x08,0x0A,0x0E,0x48,0x09,0x10,0x0F,0x16,0x48,0x09,0x08,0x0A,0x0E,0x48,
-  0x03,0xB8,0xFF,0xF0,0xB3,0x0F,0x16,0x48,0x03,0xB8,0xFF,0xF8,0x40,0x14,0x0A,0x0E,
-  0x48,0x80,0x03,0xC0,0x03,0xD0,0x03,0xF0,0x03,0x04,0x1F,0x03,0x01,0x03,0xDF,0x00,
-  0x01,0x00,0x00,0x19,0x2F,0x5D,0x01,0x2F,0x5D,0x5D,0x31,0x30,0x00,0x2B,0x2B,0x2B,
-  0x2B,0x01,0x2B,0x2B,0x2B,0x2B,0x01,0x01,0x37,0x01,0x01,0x17,0x01,0x01,0x07,0x01,
-  0x01,0x27,0x01,0xFC,0xFE,0xC2,0x69,0x01,0x3D,0x01,0x42,0x68,0xFE,0xBF,0x01,0x3F,
-  0x66,0xFE,0xBE,0xFE,0xC3,0x66,0x02,0xD3,0x01,0x3F,0x69,0xFE,0xC2,0x01,0x3E,0x67,
-  0xFE,0xBF,0xFE,0xC0,0x66,0x01,0x3D,0xFE,0xC5,0x67,0x00,0x03,0x00,0x50,0xFF,0xB4,
-  0x04,0x85,0x05,0xFC,0x00,0x12,0x00,0x19,0x00,0x21,0x00,0x60,0xB9,0x00,0x13,0xFF,
-  0xE0,0x40,0x38,0x09,0x17,0x48,0x1A,0x20,0x09,0x17,0x48,0x1A,0x14,0x1B,0x13,0x04,
-  0x18,0x20,0x5B,0x0C,0x09,0x00,0x03,0x04,0x05,0x0B,0x0E,0x23,0x18,0x5B,0x02,0x1F,
-  0x05,0x2F,0x05,0x02,0x05,0x1B,0x13,0x1A,0x14,0x04,0x16,0x1D,0x5F,0x00,0x03,0x0C,
-  0x09,0x04,0x07,0x01,0x11,0x13,0x16,0x5F,0x0A,0x07,0x04,0x00,0x3F,0x33,0xE1,0x3F,
-  0x33,0x12,0x17,0x39,0xE1,0x11,0x17,0x39,0x01,0x2F,0x5D,0x33,0xE1,0x10,0xDE,0x32,
-  0x11,0x17,0x39,0xE1,0x11,0x17,0x39,0x31,0x30,0x00,0x2B,0x2B,0x25,0x07,0x27,0x37,
-  0x26,0x11,0x10,0x21,0x32,0x17,0x37,0x17,0x07,0x16,0x11,0x10,0x00,0x23,0x22,0x03,
-  0x01,0x26,0x23,0x20,0x11,0x14,0x01,0x01,0x16,0x33,0x32,0x12,0x11,0x34,0x01,0x35,
-  0x5C,0x89,0x79,0x75,0x02,0x16,0xBA,0x7C,0x5C,0x89,0x7D,0x73,0xFE,0xEC,0xFF,0xBD,
-  0x6C,0x02,0x03,0x50,0x88,0xFE,0xAF,0x02,0x7A,0xFE,0x00,0x50,0x85,0xAD,0xA1,0x4A,
-  0x96,0x4E,0xC5,0xB8,0x01,0x60,0x02,0xEE,0x69,0x98,0x4E,0xC9,0xBC,0xFE,0xB4,0xFE,
-  0x97,0xFE,0x78,0x01,0x9B,0x03,0x44,0x5E,0xFD,0xB4,0xD4,0x02,0x1C,0xFC,0xC0,0x56,
-  0x01,0x22,0x01,0x2C,0xD1,0x00,0xFF,0xFF,0x00,0x7D,0xFF,0xEC,0x04,0x50,0x07,0x73,
-  0x02,0x26,0x00,0x38,0x00,0x00,0x01,0x07,0x00,0x43,0xFF,0xBB,0x01,0x52,0x00,0x15,
-  0xB4,0x01,0x0F,0x05,0x26,0x01,0xB8,0xFF,0xBB,0xB4,0x12,0x0F,0x06,0x00,0x25,0x01,
-  0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x7D,0xFF,0xEC,0x04,0x50,0x07,0x73,
-  0x02,0x26,0x00,0x38,0x00,0x00,0x01,0x07,0x00,0x76,0x00,0x4C,0x01,0x52,0x00,0x13,
-  0x40,0x0B,0x01,0x15,0x05,0x26,0x01,0x4C,0x0F,0x12,0x06,0x00,0x25,0x01,0x2B,0x35,
-  0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x7D,0xFF,0xEC,0x04,0x50,0x07,0x73,0x02,0x26,
-  0x00,0x38,0x00,0x00,0x01,0x07,0x01,0x4B,0x00,0x00,0x01,0x52,0x00,0x13,0x40,0x0B,
-  0x01,0x0F,0x05,0x26,0x01,0x00,0x15,0x0F,0x06,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,
-  0x35,0x00,0xFF,0xFF,0x00,0x7D,0xFF,0xEC,0x04,0x50,0x07,0x2B,0x02,0x26,0x00,0x38,
-  0x00,0x00,0x01,0x07,0x00,0x6A,0x00,0x02,0x01,0x52,0x00,0x17,0x40,0x0D,0x02,0x01,
-  0x13,0x05,0x26,0x02,0x01,0x01,0x15,0x19,0x06,0x00,0x25,0x01,0x2B,0x35,0x35,0x00,
-  0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0x21,0x00,0x00,0x04,0xAA,0x07,0x73,0x02,0x26,
-  0x00,0x3C,0x00,0x00,0x01,0x07,0x00,0x76,0x00,0x4C,0x01,0x52,0x00,0x13,0x40,0x0B,
-  0x01,0x0F,0x05,0x26,0x01,0x4D,0x09,0x0C,0x07,0x02,0x25,0x01,0x2B,0x35,0x00,0x2B,
-  0x35,0x00,0x00,0x02,0x00,0xB0,0x00,0x00,0x04,0x46,0x05,0xB6,0x00,0x0B,0x00,0x13,
-  0x00,0x3E,0x40,0x24,0x10,0x5B,0xEF,0x08,0xFF,0x08,0x02,0x08,0x15,0x0C,0x05,0x01,
-  0x5A,0x00,0x02,0x90,0x02,0xA0,0x02,0x03,0x02,0x0C,0x60,0x00,0x13,0x60,0x05,0x00,
-  0x05,0x00,0x05,0x01,0x03,0x03,0x01,0x12,0x00,0x3F,0x3F,0x12,0x39,0x39,0x2F,0x2F,
-  0x10,0xE1,0x10,0xE1,0x01,0x2F,0x5D,0xE1,0x32,0x32,0x10,0xDE,0x5D,0xE1,0x31,0x30,
-  0x01,0x11,0x23,0x11,0x33,0x15,0x33,0x20,0x11,0x14,0x04,0x21,0x27,0x33,0x32,0x36,
-  0x35,0x10,0x21,0x23,0x01,0x6A,0xBA,0xBA,0xDA,0x02,0x02,0xFE,0xEB,0xFE,0xF8,0xBF,
-  0xAA,0xC6,0xAB,0xFE,0xAE,0xC9,0x01,0x3D,0xFE,0xC3,0x05,0xB6,0xFC,0xFE,0x54,0xDB,
-  0xF6,0x9E,0x90,0x99,0x01,0x17,0x00,0x01,0x00,0xA4,0xFF,0xEC,0x04,0x7F,0x06,0x1F,
-  0x00,0x2A,0x00,0x72,0x40,0x4B,0x10,0x16,0x01,0x0B,0x46,0x20,0x0F,0x47,0x1B,0x1D,
-  0x00,0x01,0x0F,0x00,0x01,0x4F,0x20,0x5F,0x20,0x02,0x1D,0x20,0x01,0x0F,0x20,0x01,
-  0x0F,0x1B,0x1F,0x1B,0xBF,0x1B,0xCF,0x1B,0xDF,0x1B,0x05,0x00,0x20,0x1B,0x1B,0x20,
-  0x00,0x03,0x15,0x05,0x47,0x26,0x2C,0x14,0x47,0x00,0x15,0xA0,0x15,0xB0,0x15,0x03,
-  0x15,0x05,0x20,0x0F,0x03,0x18,0x03,0x50,0x01,0x29,0x16,0x11,0x50,0x18,0x01,0x15,
-  0x15,0x00,0x3F,0x3F,0xE1,0x3F,0x33,0xE1,0x12,0x17,0x39,0x01,0x2F,0x5D,0xE1,0x10,
-  0xDE,0xE1,0x12,0x17,0x39,0x2F,0x2F,0x2F,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x10,0xE1,
-  0x10,0xE1,0x31,0x30,0x00,0x5D,0x25,0x35,0x16,0x33,0x32,0x35,0x34,0x26,0x27,0x26,
-  0x26,0x35,0x34,0x37,0x36,0x35,0x34,0x23,0x22,0x15,0x11,0x23,0x11,0x10,0x21,0x32,
-  0x16,0x15,0x14,0x07,0x06,0x06,0x15,0x14,0x16,0x17,0x16,0x16,0x15,0x14,0x06,0x23,
-  0x22,0x01,0xDF,0x8F,0x86,0xD5,0x5B,0x62,0x7B,0x64,0x81,0x81,0xE3,0xF2,0xB6,0x01,
-  0xA8,0xC2,0xD9,0x85,0x54,0x31,0x3A,0x7A,0x90,0x5E,0xC8,0xB7,0xB6,0x31,0xA6,0x56,
-  0xAE,0x51,0x66,0x3D,0x4E,0x7A,0x57,0x75,0x6A,0x6A,0x5A,0xA4,0xD7,0xFB,0x4E,0x04,
-  0xB0,0x01,0x6F,0x9F,0x94,0x84,0x75,0x4A,0x3E,0x21,0x27,0x3C,0x51,0x5F,0x9C,0x62,
-  0xA2,0xAB,0xFF,0xFF,0x00,0x87,0xFF,0xEC,0x04,0x02,0x06,0x21,0x02,0x26,0x00,0x44,
-  0x00,0x00,0x01,0x06,0x00,0x43,0xAB,0x00,0x00,0x15,0xB4,0x02,0x22,0x11,0x26,0x02,
-  0xB8,0xFF,0xCD,0xB4,0x25,0x22,0x08,0x16,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,
-  0xFF,0xFF,0x00,0x87,0xFF,0xEC,0x04,0x02,0x06,0x21,0x02,0x26,0x00,0x44,0x00,0x00,
-  0x01,0x06,0x00,0x76,0x54,0x00,0x00,0x17,0x40,0x0E,0x02,0x28,0x11,0x26,0x02,0x50,
-  0x22,0x01,0x76,0x22,0x25,0x08,0x16,0x25,0x01,0x2B,0x5D,0x35,0x00,0x2B,0x35,0x00,
-  0xFF,0xFF,0x00,0x87,0xFF,0xEC,0x04,0x02,0x06,0x21,0x02,0x26,0x00,0x44,0x00,0x00,
-  0x01,0x06,0x01,0x4B,0x08,0x00,0x00,0x17,0x40,0x0E,0x02,0x22,0x11,0x26,0x02,0x60,
-  0x28,0x01,0x2A,0x28,0x22,0x08,0x16,0x25,0x01,0x2B,0x5D,0x35,0x00,0x2B,0x35,0x00,
-  0xFF,0xFF,0x00,0x87,0xFF,0xEC,0x04,0x02,0x05,0xE3,0x02,0x26,0x00,0x44,0x00,0x00,
-  0x01,0x06,0x01,0x52,0x0A,0x00,0x00,0x1F,0x40,0x14,0x02,0x22,0x11,0x26,0x02,0x80,
-  0x23,0x01,0x70,0x23,0x01,0x60,0x23,0x01,0x2B,0x23,0x2C,0x08,0x16,0x25,0x01,0x2B,
-  0x5D,0x5D,0x5D,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x87,0xFF,0xEC,0x04,0x02,
-  0x05,0xD9,0x02,0x26,0x00,0x44,0x00,0x00,0x01,0x06,0x00,0x6A,0x0C,0x00,0x00,0x23,
-  0x40,0x16,0x03,0x02,0x26,0x11,0x26,0x03,0x02,0x50,0x28,0x01,0x40,0x28,0x01,0x30,
-  0x28,0x01,0x2D,0x28,0x2C,0x08,0x16,0x25,0x01,0x2B,0x5D,0x5D,0x5D,0x35,0x35,0x00,
-  0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0x87,0xFF,0xEC,0x04,0x02,0x06,0x87,0x02,0x26,
-  0x00,0x44,0x00,0x00,0x01,0x06,0x01,0x50,0xFF,0x00,0x00,0x17,0x40,0x0D,0x03,0x02,
-  0x22,0x11,0x26,0x03,0x02,0x20,0x25,0x2B,0x08,0x16,0x25,0x01,0x2B,0x35,0x35,0x00,
-  0x2B,0x35,0x35,0x00,0x00,0x03,0x00,0x2D,0xFF,0xEC,0x04,0xA2,0x04,0x5E,0x00,0x22,
-  0x00,0x29,0x00,0x33,0x00,0x68,0x40,0x3C,0x1B,0x0A,0x23,0x11,0x47,0x00,0x10,0x33,
-  0xC0,0x33,0x02,0x33,0x33,0x20,0x24,0x46,0x17,0x10,0x40,0x0A,0x16,0x48,0x0B,0x10,
-  0x01,0x10,0x35,0x2D,0x47,0x06,0xE0,0x20,0xF0,0x20,0x02,0x20,0x2A,0x11,0x50,0x00,
-  0x23,0x23,0x08,0x1B,0x14,0x30,0x50,0x16,0x19,0x19,0x1D,0x16,0x27,0x0A,0x03,0x50,
-  0x0C,0x05,0x08,0x10,0x00,0x3F,0x33,0x33,0xE1,0x32,0x32,0x3F,0x33,0x11,0x33,0xE1,
-  0x32,0x32,0x11,0x39,0x2F,0x33,0xE1,0x32,0x01,0x2F,0x5D,0x33,0xE1,0x10,0xDE,0x5D,
-  0x2B,0x32,0xE1,0x11,0x39,0x2F,0x5D,0x33,0xE1,0x32,0x39,0x39,0x31,0x30,0x01,0x35,
-  0x34,0x23,0x22,0x07,0x27,0x36,0x33,0x32,0x17,0x36,0x33,0x32,0x12,0x15,0x15,0x21,
-  0x16,0x16,0x33,0x32,0x37,0x15,0x06,0x23,0x22,0x27,0x06,0x23,0x22,0x26,0x35,0x10,
-  0x25,0x25,0x21,0x34,0x26,0x23,0x22,0x06,0x03,0x07,0x06,0x15,0x14,0x16,0x33,0x32,
-  0x36,0x35,0x02,0x0A,0x8B,0x6B,0x68,0x39,0x83,0x91,0xBC,0x3A,0x4E,0xA2,0x89,0xAC,
-  0xFE,0x10,0x03,0x80,0x69,0x6F,0x7A,0x6B,0x86,0xDE,0x5E,0x69,0xC4,0x73,0x8D,0x01,
-  0x48,0x01,0x41,0x01,0x3C,0x51,0x47,0x44,0x5A,0xB4,0x58,0xD9,0x40,0x37,0x52,0x68,
-  0x02,0x96,0x45,0xEC,0x52,0x89,0x60,0xB2,0xB2,0xFE,0xF1,0xDC,0x71,0xC0,0xB7,0x4C,
-  0xA2,0x49,0xE5,0xE5,0xAD,0x9A,0x01,0x4C,0x10,0x07,0x8D,0xA4,0x9C,0xFE,0xEE,0x07,
-  0x11,0xD0,0x53,0x5F,0xA5,0x92,0xFF,0xFF,0x00,0xAC,0xFE,0x14,0x04,0x25,0x04,0x5E,
-  0x02,0x26,0x00,0x46,0x00,0x00,0x01,0x06,0x00,0x7A,0x31,0x00,0x00,0x0B,0xB6,0x01,
-  0x2F,0x14,0x20,0x0F,0x00,0x25,0x01,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x85,0xFF,0xEC,
-  0x04,0x48,0x06,0x21,0x02,0x26,0x00,0x48,0x00,0x00,0x01,0x06,0x00,0x43,0xD4,0x00,
-  0x00,0x15,0xB4,0x02,0x17,0x11,0x26,0x02,0xB8,0xFF,0xD4,0xB4,0x1A,0x17,0x0B,0x00,
-  0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x85,0xFF,0xEC,0x04,0x48,
-  0x06,0x21,0x02,0x26,0x00,0x48,0x00,0x00,0x01,0x06,0x00,0x76,0x52,0x00,0x00,0x1F,
-  0x40,0x14,0x02,0x1D,0x11,0x26,0x02,0xA0,0x17,0x01,0x10,0x17,0x01,0x00,0x17,0x01,
-  0x52,0x17,0x1A,0x0B,0x00,0x25,0x01,0x2B,0x5D,0x5D,0x5D,0x35,0x00,0x2B,0x35,0x00,
-  0xFF,0xFF,0x00,0x85,0xFF,0xEC,0x04,0x48,0x06,0x21,0x02,0x26,0x00,0x48,0x00,0x00,
-  0x01,0x06,0x01,0x4B,0x10,0x00,0x00,0x13,0x40,0x0B,0x02,0x17,0x11,0x26,0x02,0x10,
-  0x1D,0x17,0x0B,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x85,
-  0xFF,0xEC,0x04,0x48,0x05,0xD9,0x02,0x26,0x00,0x48,0x00,0x00,0x01,0x06,0x00,0x6A,
-  0x12,0x00,0x00,0x17,0x40,0x0D,0x03,0x02,0x1B,0x11,0x26,0x03,0x02,0x11,0x1D,0x21,
-  0x0B,0x00,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0xC5,
-  0x00,0x00,0x04,0x33,0x06,0x21,0x02,0x26,0x00,0xF3,0x00,0x00,0x01,0x06,0x00,0x43,
-  0xAB,0x00,0x00,0x15,0xB4,0x01,0x0A,0x11,0x26,0x01,0xB8,0xFF,0x96,0xB4,0x0D,0x0A,
-  0x07,0x05,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xC5,0x00,0x00,
-  0x04,0x33,0x06,0x21,0x02,0x26,0x00,0xF3,0x00,0x00,0x01,0x06,0x00,0x76,0x71,0x00,
-  0x00,0x13,0x40,0x0B,0x01,0x10,0x11,0x26,0x01,0x5B,0x0A,0x0D,0x07,0x05,0x25,0x01,
-  0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xC5,0x00,0x00,0x04,0x33,0x06,0x21,
-  0x02,0x26,0x00,0xF3,0x00,0x00,0x01,0x06,0x01,0x4B,0x00,0x00,0x00,0x15,0xB4,0x01,
-  0x0A,0x11,0x26,0x01,0xB8,0xFF,0xEB,0xB4,0x10,0x0A,0x07,0x05,0x25,0x01,0x2B,0x35,
-  0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xC5,0x00,0x00,0x04,0x33,0x05,0xD9,0x02,0x26,
-  0x00,0xF3,0x00,0x00,0x01,0x06,0x00,0x6A,0x00,0x00,0x00,0x19,0xB6,0x02,0x01,0x0E,
-  0x11,0x26,0x02,0x01,0xB8,0xFF,0xEA,0xB4,0x10,0x14,0x07,0x05,0x25,0x01,0x2B,0x35,
-  0x35,0x00,0x2B,0x35,0x35,0x00,0x00,0x02,0x00,0x87,0xFF,0xEC,0x04,0x46,0x06,0x23,
-  0x00,0x1A,0x00,0x24,0x00,0x70,0xB9,0x00,0x0B,0xFF,0xE0,0x40,0x41,0x0F,0x14,0x48,
-  0x06,0x20,0x0F,0x13,0x48,0x01,0x22,0x48,0x10,0x0E,0x0B,0x03,0x06,0x08,0x05,0x0D,
-  0x05,0x0D,0x05,0x0D,0x16,0xEF,0x10,0xFF,0x10,0x02,0x10,0x26,0x1D,0x48,0x00,0x16,
-  0xE0,0x16,0xF0,0x16,0x03,0x16,0x00,0x1B,0x50,0x19,0x0E,0x06,0x0B,0x03,0x30,0x19,
-  0x01,0x04,0x19,0x04,0x19,0x09,0x1F,0x50,0x13,0x16,0x0C,0x0C,0x09,0x01,0x00,0x3F,
-  0x33,0x2F,0x3F,0xE1,0x12,0x39,0x39,0x2F,0x2F,0x5D,0x17,0x39,0x10,0xE1,0x32,0x01,
-  0x2F,0x5D,0xE1,0x10,0xCE,0x5D,0x11,0x39,0x39,0x2F,0x2F,0x12,0x17,0x39,0x10,0xE1,
-  0x32,0x31,0x30,0x2B,0x00,0x2B,0x01,0x37,0x26,0x27,0x05,0x27,0x37,0x26,0x27,0x37,
-  0x16,0x17,0x37,0x17,0x07,0x00,0x11,0x10,0x00,0x23,0x22,0x00,0x35,0x34,0x12,0x33,
-  0x32,0x07,0x20,0x11,0x10,0x21,0x32,0x36,0x35,0x34,0x26,0x03,0x79,0x08,0x3A,0xB8,
-  0xFF,0x00,0x49,0xD9,0x68,0x44,0x45,0x8F,0x67,0xE3,0x4A,0xC2,0x01,0x2D,0xFE,0xFF,
-  0xE1,0xD5,0xFE,0xF8,0xF1,0xD6,0xD3,0xBB,0xFE,0xE2,0x01,0x20,0x9A,0x87,0x9B,0x03,
-  0x54,0x04,0xE2,0xA5,0x99,0x72,0x83,0x47,0x26,0x7B,0x46,0x4E,0x8A,0x71,0x75,0xFE,
-  0xDD,0xFE,0x2D,0xFE,0xEB,0xFE,0xC4,0x01,0x0B,0xE6,0xEA,0x01,0x04,0x94,0xFE,0xA0,
-  0xFE,0xAC,0xC7,0xC4,0x81,0xA8,0xFF,0xFF,0x00,0xA0,0x00,0x00,0x04,0x2D,0x05,0xE3,
-  0x02,0x26,0x00,0x51,0x00,0x00,0x01,0x06,0x01,0x52,0x06,0x00,0x00,0x13,0x40,0x0B,
-  0x01,0x11,0x11,0x26,0x01,0x05,0x12,0x1B,0x07,0x0F,0x25,0x01,0x2B,0x35,0x00,0x2B,
-  0x35,0x00,0xFF,0xFF,0x00,0x73,0xFF,0xEC,0x04,0x58,0x06,0x21,0x02,0x26,0x00,0x52,
-  0x00,0x00,0x01,0x06,0x00,0x43,0xD8,0x00,0x00,0x15,0xB4,0x02,0x14,0x11,0x26,0x02,
-  0xB8,0xFF,0xD9,0xB4,0x17,0x14,0x03,0x09,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,
-  0xFF,0xFF,0x00,0x73,0xFF,0xEC,0x04,0x58,0x06,0x21,0x02,0x26,0x00,0x52,0x00,0x00,
-  0x01,0x06,0x00,0x76,0x50,0x00,0x00,0x13,0x40,0x0B,0x02,0x1A,0x11,0x26,0x02,0x51,
-  0x14,0x17,0x03,0x09,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x73,
-  0xFF,0xEC,0x04,0x58,0x06,0x21,0x02,0x26,0x00,0x52,0x00,0x00,0x01,0x06,0x01,0x4B,
-  0xFB,0x00,0x00,0x15,0xB4,0x02,0x14,0x11,0x26,0x02,0xB8,0xFF,0xFC,0xB4,0x1A,0x14,
-  0x03,0x09,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x73,0xFF,0xEC,
-  0x04,0x58,0x05,0xE3,0x02,0x26,0x00,0x52,0x00,0x00,0x01,0x06,0x01,0x52,0x00,0x00,
-  0x00,0x13,0x40,0x0B,0x02,0x14,0x11,0x26,0x02,0x00,0x15,0x1E,0x03,0x09,0x25,0x01,
-  0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x73,0xFF,0xEC,0x04,0x58,0x05,0xD9,
-  0x02,0x26,0x00,0x52,0x00,0x00,0x01,0x06,0x00,0x6A,0xF9,0x00,0x00,0x19,0xB6,0x03,
-  0x02,0x18,0x11,0x26,0x03,0x02,0xB8,0xFF,0xF9,0xB4,0x1A,0x1E,0x03,0x09,0x25,0x01,
-  0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,0x00,0x03,0x00,0x98,0x00,0xF8,0x04,0x33,
-  0x04,0xAC,0x00,0x07,0x00,0x0B,0x00,0x13,0x00,0x53,0x40,0x37,0x40,0x0A,0x01,0x0F,
-  0x0A,0x01,0x0A,0x0A,0x0E,0x12,0x06,0x50,0x09,0xF0,0x09,0x02,0x09,0x09,0x02,0xAC,
-  0x1F,0x06,0x5F,0x06,0x9F,0x06,0x03,0x06,0x0C,0xAF,0x00,0x10,0x40,0x10,0x70,0x10,
-  0x90,0x10,0xA0,0x10,0xB0,0x10,0xF0,0x10,0x07,0x10,0x10,0x08,0x04,0xAF,0x00,0x08,
-  0xAD,0x09,0xB3,0x00,0x3F,0xE1,0xDC,0xE1,0x10,0xC8,0x2F,0x5D,0xE1,0x01,0x2F,0x5D,
-  0xE1,0x33,0x2F,0x5D,0x11,0x33,0x32,0x32,0x2F,0x5D,0x5D,0x31,0x30,0x01,0x32,0x15,
-  0x14,0x23,0x22,0x35,0x34,0x01,0x35,0x21,0x15,0x05,0x32,0x15,0x14,0x23,0x22,0x35,
-  0x34,0x02,0x64,0x73,0x73,0x72,0xFE,0xA6,0x03,0x9B,0xFE,0x31,0x73,0x73,0x72,0x04,
-  0xAC,0x7D,0x7D,0x7D,0x7D,0xFD,0xDB,0x96,0x96,0x95,0x7D,0x7D,0x7D,0x7D,0x00,0x03,
-  0x00,0x73,0xFF,0xAA,0x04,0x58,0x04,0x9C,0x00,0x13,0x00,0x1B,0x00,0x23,0x00,0x6E,
-  0xB5,0x15,0x10,0x09,0x15,0x48,0x1D,0xB8,0xFF,0xF0,0xB3,0x09,0x15,0x48,0x14,0xB8,
-  0xFF,0xF0,0x40,0x36,0x0F,0x14,0x48,0x1C,0x10,0x0F,0x14,0x48,0x1C,0x15,0x1D,0x14,
-  0x04,0x1A,0x22,0x48,0x0D,0x0A,0x00,0x03,0x04,0x05,0x0C,0x0F,0x25,0x1A,0x48,0x02,
-  0x00,0x05,0x01,0x05,0x1D,0x14,0x1C,0x15,0x04,0x17,0x1F,0x50,0x0A,0x0D,0x03,0x00,
-  0x04,0x08,0x01,0x12,0x16,0x17,0x50,0x0B,0x08,0x10,0x00,0x3F,0x33,0xE1,0x3F,0x33,
-  0x12,0x17,0x39,0xE1,0x11,0x17,0x39,0x01,0x2F,0x5D,0x33,0xE1,0x10,0xDE,0x32,0x11,
-  0x17,0x39,0xE1,0x11,0x17,0x39,0x31,0x30,0x00,0x2B,0x2B,0x01,0x2B,0x2B,0x25,0x07,
-  0x27,0x37,0x26,0x11,0x10,0x00,0x33,0x32,0x17,0x37,0x17,0x07,0x16,0x11,0x10,0x00,
-  0x23,0x22,0x03,0x01,0x26,0x23,0x22,0x06,0x15,0x14,0x01,0x01,0x16,0x33,0x32,0x36,
-  0x35,0x34,0x01,0x79,0x4C,0x83,0x54,0x8B,0x01,0x0A,0xEB,0x80,0x6C,0x4C,0x83,0x54,
-  0x89,0xFE,0xF3,0xE9,0x81,0x7D,0x01,0x96,0x42,0x5A,0xA1,0x8E,0x02,0x39,0xFE,0x6B,
-  0x3D,0x5D,0xA1,0x8E,0x21,0x77,0x54,0x83,0x9E,0x01,0x08,0x01,0x0A,0x01,0x2D,0x39,
-  0x77,0x54,0x83,0x9C,0xFE,0xFE,0xFE,0xF1,0xFE,0xD4,0x01,0x28,0x02,0x90,0x23,0xCF,
-  0xD1,0xB4,0x01,0xBE,0xFD,0x73,0x21,0xD3,0xD1,0xA4,0xFF,0xFF,0x00,0xA0,0xFF,0xEC,
-  0x04,0x2D,0x06,0x21,0x02,0x26,0x00,0x58,0x00,0x00,0x01,0x06,0x00,0x43,0xB3,0x00,
-  0x00,0x15,0xB4,0x01,0x12,0x11,0x26,0x01,0xB8,0xFF,0xB3,0xB4,0x15,0x12,0x06,0x10,
-  0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xA0,0xFF,0xEC,0x04,0x2D,
-  0x06,0x21,0x02,0x26,0x00,0x58,0x00,0x00,0x01,0x06,0x00,0x76,0x52,0x00,0x00,0x13,
-  0x40,0x0B,0x01,0x18,0x11,0x26,0x01,0x52,0x12,0x15,0x06,0x10,0x25,0x01,0x2B,0x35,
-  0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xA0,0xFF,0xEC,0x04,0x2D,0x06,0x21,0x02,0x26,
-  0x00,0x58,0x00,0x00,0x01,0x06,0x01,0x4B,0x08,0x00,0x00,0x13,0x40,0x0B,0x01,0x12,
-  0x11,0x26,0x01,0x08,0x18,0x12,0x06,0x10,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,
-  0xFF,0xFF,0x00,0xA0,0xFF,0xEC,0x04,0x2D,0x05,0xD9,0x02,0x26,0x00,0x58,0x00,0x00,
-  0x01,0x06,0x00,0x6A,0x02,0x00,0x00,0x17,0x40,0x0D,0x02,0x01,0x16,0x11,0x26,0x02,
-  0x01,0x01,0x18,0x1C,0x06,0x10,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,
-  0xFF,0xFF,0x00,0x52,0xFE,0x14,0x04,0x79,0x06,0x21,0x02,0x26,0x00,0x5C,0x00,0x00,
-  0x01,0x06,0x00,0x76,0x4C,0x00,0x00,0x13,0x40,0x0B,0x01,0x1D,0x11,0x26,0x01,0x4D,
-  0x17,0x1A,0x00,0x09,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0x00,0x02,0x00,0x9E,
-  0xFE,0x14,0x04,0x44,0x06,0x14,0x00,0x13,0x00,0x1E,0x00,0x3B,0x40,0x24,0x1A,0x48,
-  0xEF,0x05,0xFF,0x05,0x02,0x05,0x20,0x0B,0x11,0x13,0x15,0x04,0x0E,0x47,0x00,0x0F,
-  0xB0,0x0F,0x02,0x0F,0x10,0x00,0x0E,0x1B,0x0A,0x18,0x50,0x08,0x16,0x00,0x1C,0x50,
-  0x02,0x10,0x00,0x3F,0xE1,0x32,0x3F,0xE1,0x32,0x3F,0x3F,0x01,0x2F,0x5D,0xE1,0x17,
-  0x32,0x10,0xDE,0x5D,0xE1,0x31,0x30,0x01,0x36,0x33,0x32,0x12,0x11,0x10,0x02,0x23,
-  0x22,0x27,0x23,0x16,0x15,0x11,0x23,0x11,0x33,0x11,0x07,0x13,0x15,0x14,0x16,0x33,
-  0x20,0x11,0x10,0x21,0x22,0x06,0x01,0x54,0x6E,0xD4,0xC9,0xE5,0xE6,0xC8,0xCF,0x73,
-  0x0C,0x0C,0xB6,0xB6,0x08,0x08,0x8B,0x98,0x01,0x10,0xFE,0xEE,0x98,0x85,0x03,0xB6,
-  0xA8,0xFE,0xD5,0xFE,0xF4,0xFE,0xF2,0xFE,0xD3,0x9F,0x81,0x21,0xFE,0x2B,0x08,0x00,
-  0xFE,0x36,0x94,0xFE,0x9A,0x29,0xE3,0xC1,0x01,0xA6,0x01,0x9E,0xB0,0x00,0xFF,0xFF,
-  0x00,0x52,0xFE,0x14,0x04,0x79,0x05,0xD9,0x02,0x26,0x00,0x5C,0x00,0x00,0x01,0x06,
-  0x00,0x6A,0x08,0x00,0x00,0x17,0x40,0x0D,0x02,0x01,0x1B,0x11,0x26,0x02,0x01,0x08,
-  0x1D,0x21,0x00,0x09,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,0xFF,0xFF,
-  0x00,0x21,0x00,0x00,0x04,0xAC,0x06,0xC1,0x02,0x26,0x00,0x24,0x00,0x00,0x01,0x07,
-  0x01,0x4D,0x00,0x00,0x01,0x52,0x00,0x15,0xB4,0x02,0x11,0x05,0x26,0x02,0xB8,0xFF,
-  0xFF,0xB4,0x0F,0x10,0x04,0x07,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,
-  0x00,0x87,0xFF,0xEC,0x04,0x02,0x05,0x6F,0x02,0x26,0x00,0x44,0x00,0x00,0x01,0x06,
-  0x01,0x4D,0xF7,0x00,0x00,0x13,0x40,0x0B,0x02,0x24,0x11,0x26,0x02,0x18,0x22,0x23,
-  0x08,0x16,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x21,0x00,0x00,
-  0x04,0xAC,0x07,0x40,0x02,0x26,0x00,0x24,0x00,0x00,0x01,0x07,0x01,0x4E,0xFF,0xFD,
-  0x01,0x52,0x00,0x15,0xB4,0x02,0x12,0x05,0x26,0x02,0xB8,0xFF,0xFD,0xB4,0x14,0x0F,
-  0x04,0x07,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x87,0xFF,0xEC,
-  0x04,0x02,0x05,0xEE,0x02,0x26,0x00,0x44,0x00,0x00,0x01,0x06,0x01,0x4E,0xF5,0x00,
-  0x00,0x13,0x40,0x0B,0x02,0x25,0x11,0x26,0x02,0x16,0x27,0x22,0x08,0x16,0x25,0x01,
-  0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x21,0xFE,0x39,0x04,0xBE,0x05,0xBC,
-  0x02,0x26,0x00,0x24,0x00,0x00,0x01,0x07,0x01,0x51,0x01,0x8F,0x00,0x00,0x00,0x18,
-  0x40,0x10,0x02,0x20,0x17,0x01,0x10,0x17,0x01,0x00,0x17,0x01,0x00,0x17,0x17,0x00,
-  0x00,0x25,0x01,0x2B,0x5D,0x5D,0x5D,0x35,0xFF,0xFF,0x00,0x87,0xFE,0x39,0x04,0x52,
-  0x04,0x5E,0x02,0x26,0x00,0x44,0x00,0x00,0x01,0x07,0x01,0x51,0x01,0x23,0x00,0x00,
-  0x00,0x24,0x40,0x19,0x02,0x80,0x2A,0x01,0x70,0x2A,0x01,0x60,0x2A,0x01,0x20,0x2A,
-  0x01,0x10,0x2A,0x01,0x00,0x2A,0x01,0x00,0x2A,0x2A,0x00,0x00,0x25,0x01,0x2B,0x5D,
-  0x5D,0x5D,0x5D,0x5D,0x5D,0x35,0xFF,0xFF,0x00,0x81,0xFF,0xEC,0x04,0x9C,0x07,0x73,
-  0x02,0x26,0x00,0x26,0x00,0x00,0x01,0x07,0x00,0x76,0x00,0xF2,0x01,0x52,0x00,0x13,
-  0x40,0x0B,0x01,0x1C,0x05,0x26,0x01,0xCA,0x16,0x19,0x06,0x0B,0x25,0x01,0x2B,0x35,
-  0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xAC,0xFF,0xEC,0x04,0x25,0x06,0x21,0x02,0x26,
-  0x00,0x46,0x00,0x00,0x01,0x07,0x00,0x76,0x00,0xA0,0x00,0x00,0x00,0x13,0x40,0x0B,
-  0x01,0x1A,0x11,0x26,0x01,0x9E,0x14,0x17,0x0F,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,
-  0x35,0x00,0xFF,0xFF,0x00,0x81,0xFF,0xEC,0x04,0x9C,0x07,0x73,0x02,0x26,0x00,0x26,
-  0x00,0x00,0x01,0x07,0x01,0x4B,0x00,0xA0,0x01,0x52,0x00,0x27,0x40,0x1A,0x01,0x16,
-  0x05,0x26,0x01,0xD0,0x1C,0x01,0xB0,0x1C,0x01,0x80,0x1C,0x01,0x70,0x1C,0x01,0x50,
-  0x1C,0x01,0x78,0x1C,0x16,0x06,0x0B,0x25,0x01,0x2B,0x5D,0x5D,0x5D,0x5D,0x5D,0x35,
-  0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xAC,0xFF,0xEC,0x04,0x25,0x06,0x21,0x02,0x26,
-  0x00,0x46,0x00,0x00,0x01,0x06,0x01,0x4B,0x54,0x00,0x00,0x13,0x40,0x0B,0x01,0x14,
-  0x11,0x26,0x01,0x52,0x1A,0x14,0x0F,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,
-  0xFF,0xFF,0x00,0x81,0xFF,0xEC,0x04,0x9C,0x07,0x37,0x02,0x26,0x00,0x26,0x00,0x00,
-  0x01,0x07,0x01,0x4F,0x00,0xA4,0x01,0x52,0x00,0x13,0x40,0x0B,0x01,0x1A,0x05,0x26,
-  0x01,0x7C,0x1C,0x18,0x06,0x0B,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,
-  0x00,0xAC,0xFF,0xEC,0x04,0x25,0x05,0xE5,0x02,0x26,0x00,0x46,0x00,0x00,0x01,0x06,
-  0x01,0x4F,0x54,0x00,0x00,0x13,0x40,0x0B,0x01,0x18,0x11,0x26,0x01,0x52,0x1A,0x16,
-  0x0F,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x81,0xFF,0xEC,
-  0x04,0x9C,0x07,0x73,0x02,0x26,0x00,0x26,0x00,0x00,0x01,0x07,0x01,0x4C,0x00,0x9A,
-  0x01,0x52,0x00,0x13,0x40,0x0B,0x01,0x1A,0x05,0x26,0x01,0x72,0x1E,0x16,0x06,0x0B,
-  0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xAC,0xFF,0xEC,0x04,0x25,
-  0x06,0x21,0x02,0x26,0x00,0x46,0x00,0x00,0x01,0x06,0x01,0x4C,0x5C,0x00,0x00,0x13,
-  0x40,0x0B,0x01,0x18,0x11,0x26,0x01,0x5A,0x1C,0x14,0x0F,0x00,0x25,0x01,0x2B,0x35,
-  0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x87,0x00,0x00,0x04,0x7B,0x07,0x73,0x02,0x26,
-  0x00,0x27,0x00,0x00,0x01,0x07,0x01,0x4C,0xFF,0xF7,0x01,0x52,0x00,0x15,0xB4,0x02,
-  0x14,0x05,0x26,0x02,0xB8,0xFF,0xDD,0xB4,0x18,0x10,0x00,0x05,0x25,0x01,0x2B,0x35,
-  0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x4F,0xFF,0xEC,0x05,0x23,0x06,0x14,0x00,0x26,
-  0x00,0x47,0xC6,0x00,0x01,0x07,0x02,0x38,0x02,0x44,0x00,0x00,0x00,0x1E,0x40,0x0B,
-  0x02,0x02,0x7F,0x1E,0x01,0x6F,0x1E,0x01,0x4F,0x1E,0x01,0xB8,0x02,0x88,0xB4,0x1E,
-  0x22,0x06,0x10,0x25,0x01,0x2B,0x5D,0x5D,0x5D,0x35,0x00,0x35,0xFF,0xFF,0x00,0x00,
-  0x00,0x00,0x04,0x7B,0x05,0xB6,0x02,0x06,0x00,0x92,0x00,0x00,0x00,0x02,0x00,0x89,
-  0xFF,0xEC,0x04,0xCB,0x06,0x14,0x00,0x1A,0x00,0x25,0x00,0x59,0x40,0x37,0x10,0x06,
-  0x00,0x0C,0x0F,0x12,0x04,0x1B,0x47,0x17,0x15,0x90,0x19,0xA0,0x19,0x02,0x19,0x27,
-  0x21,0x48,0x00,0x06,0xE0,0x06,0xF0,0x06,0x03,0x06,0x18,0x10,0x4F,0x15,0x11,0x11,
-  0x13,0x0C,0x1F,0x50,0x00,0x09,0x10,0x09,0x20,0x09,0x03,0x09,0x09,0x13,0x00,0x23,
-  0x50,0x03,0x16,0x1A,0x15,0x00,0x3F,0x3F,0xE1,0x3F,0x39,0x2F,0x5D,0xE1,0x32,0x12,
-  0x39,0x2F,0x33,0xE1,0x32,0x01,0x2F,0x5D,0xE1,0x10,0xDE,0x5D,0x32,0x32,0xE1,0x17,
-  0x32,0x11,0x39,0x31,0x30,0x25,0x23,0x06,0x23,0x22,0x02,0x11,0x10,0x12,0x33,0x32,
-  0x17,0x33,0x26,0x35,0x35,0x21,0x35,0x21,0x35,0x33,0x15,0x33,0x15,0x23,0x11,0x23,
-  0x03,0x35,0x34,0x26,0x23,0x20,0x11,0x10,0x21,0x32,0x36,0x03,0x81,0x08,0x71,0xD1,
-  0xC9,0xE5,0xE6,0xC8,0xD0,0x72,0x0C,0x0C,0xFE,0x85,0x01,0x7B,0xB6,0x9C,0x9C,0x93,
-  0x23,0x8B,0x98,0xFE,0xF0,0x01,0x12,0x97,0x86,0x93,0xA7,0x01,0x20,0x01,0x02,0x01,
-  0x04,0x01,0x23,0x9F,0x7E,0x23,0x9E,0x89,0xB6,0xB6,0x89,0xFB,0x2B,0x01,0xE7,0x27,
-  0xD8,0xB8,0xFE,0x6E,0xFE,0x77,0xA6,0x00,0xFF,0xFF,0x00,0xD9,0x00,0x00,0x04,0x23,
-  0x06,0xC1,0x02,0x26,0x00,0x28,0x00,0x00,0x01,0x07,0x01,0x4D,0x00,0x0A,0x01,0x52,
-  0x00,0x15,0xB4,0x01,0x0E,0x05,0x26,0x01,0xB8,0xFF,0xF2,0xB4,0x0C,0x0D,0x01,0x00,
-  0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x85,0xFF,0xEC,0x04,0x48,
-  0x05,0x6F,0x02,0x26,0x00,0x48,0x00,0x00,0x01,0x06,0x01,0x4D,0x14,0x00,0x00,0x13,
-  0x40,0x0B,0x02,0x19,0x11,0x26,0x02,0x13,0x17,0x18,0x0B,0x00,0x25,0x01,0x2B,0x35,
-  0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xD9,0x00,0x00,0x04,0x23,0x07,0x40,0x02,0x26,
-  0x00,0x28,0x00,0x00,0x01,0x07,0x01,0x4E,0x00,0x1D,0x01,0x52,0x00,0x13,0x40,0x0B,
-  0x01,0x0F,0x05,0x26,0x01,0x05,0x11,0x0C,0x01,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,
-  0x35,0x00,0xFF,0xFF,0x00,0x85,0xFF,0xEC,0x04,0x48,0x05,0xEE,0x02,0x26,0x00,0x48,
-  0x00,0x00,0x01,0x06,0x01,0x4E,0x10,0x00,0x00,0x13,0x40,0x0B,0x02,0x1A,0x11,0x26,
-  0x02,0x0F,0x1C,0x17,0x0B,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,
-  0x00,0xD9,0x00,0x00,0x04,0x23,0x07,0x1A,0x02,0x26,0x00,0x28,0x00,0x00,0x01,0x07,
-  0x01,0x4F,0x00,0x23,0x01,0x35,0x00,0x13,0x40,0x0B,0x01,0x10,0x05,0x26,0x01,0x0B,
-  0x12,0x0E,0x01,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x85,
-  0xFF,0xEC,0x04,0x48,0x05,0xE5,0x02,0x26,0x00,0x48,0x00,0x00,0x01,0x06,0x01,0x4F,
-  0x17,0x00,0x00,0x13,0x40,0x0B,0x02,0x1B,0x11,0x26,0x02,0x17,0x1D,0x19,0x0B,0x00,
-  0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xD9,0xFE,0x39,0x04,0x23,
-  0x05,0xB6,0x02,0x26,0x00,0x28,0x00,0x00,0x01,0x07,0x01,0x51,0x00,0xCD,0x00,0x00,
-  0x00,0x0E,0xB7,0x01,0x01,0xB5,0x12,0x0C,0x01,0x00,0x25,0x01,0x2B,0x35,0x00,0x35,
-  0xFF,0xFF,0x00,0x85,0xFE,0x58,0x04,0x48,0x04,0x5E,0x02,0x26,0x00,0x48,0x00,0x00,
-  0x01,0x07,0x01,0x51,0x00,0xE3,0x00,0x1F,0x00,0x0E,0xB7,0x02,0x02,0xE3,0x1D,0x17,
-  0x0B,0x00,0x25,0x01,0x2B,0x35,0x00,0x35,0xFF,0xFF,0x00,0xD9,0x00,0x00,0x04,0x23,
-  0x07,0x73,0x02,0x26,0x00,0x28,0x00,0x00,0x01,0x07,0x01,0x4C,0x00,0x23,0x01,0x52,
-  0x00,0x13,0x40,0x0B,0x01,0x10,0x05,0x26,0x01,0x0B,0x14,0x0C,0x01,0x00,0x25,0x01,
-  0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x85,0xFF,0xEC,0x04,0x48,0x06,0x21,
-  0x02,0x26,0x00,0x48,0x00,0x00,0x01,0x06,0x01,0x4C,0x19,0x00,0x00,0x13,0x40,0x0B,
-  0x02,0x1B,0x11,0x26,0x02,0x19,0x1F,0x17,0x0B,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,
-  0x35,0x00,0xFF,0xFF,0x00,0x75,0xFF,0xEC,0x04,0x46,0x07,0x73,0x02,0x26,0x00,0x2A,
-  0x00,0x00,0x01,0x07,0x01,0x4B,0x00,0x50,0x01,0x52,0x00,0x13,0x40,0x0B,0x01,0x19,
-  0x05,0x26,0x01,0x59,0x1F,0x19,0x07,0x01,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,
-  0xFF,0xFF,0x00,0x66,0xFE,0x14,0x04,0x66,0x06,0x21,0x02,0x26,0x00,0x4A,0x00,0x00,
-  0x01,0x06,0x01,0x4B,0xF7,0x00,0x00,0x15,0xB4,0x03,0x37,0x11,0x26,0x03,0xB8,0xFF,
-  0xF8,0xB4,0x3D,0x37,0x16,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,
-  0x00,0x75,0xFF,0xEC,0x04,0x46,0x07,0x40,0x02,0x26,0x00,0x2A,0x00,0x00,0x01,0x07,
-  0x01,0x4E,0x00,0x62,0x01,0x52,0x00,0x1B,0x40,0x11,0x01,0x1C,0x05,0x26,0x01,0x10,
-  0x1E,0x01,0x00,0x1E,0x01,0x6A,0x1E,0x19,0x07,0x01,0x25,0x01,0x2B,0x5D,0x5D,0x35,
-  0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x66,0xFE,0x14,0x04,0x66,0x05,0xEE,0x02,0x26,
-  0x00,0x4A,0x00,0x00,0x01,0x06,0x01,0x4E,0xF3,0x00,0x00,0x15,0xB4,0x03,0x3A,0x11,
-  0x26,0x03,0xB8,0xFF,0xF3,0xB4,0x3C,0x37,0x16,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,
-  0x35,0x00,0xFF,0xFF,0x00,0x75,0xFF,0xEC,0x04,0x46,0x07,0x37,0x02,0x26,0x00,0x2A,
-  0x00,0x00,0x01,0x07,0x01,0x4F,0x00,0x6D,0x01,0x52,0x00,0x13,0x40,0x0B,0x01,0x1D,
-  0x05,0x26,0x01,0x76,0x1F,0x1B,0x07,0x01,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,
-  0xFF,0xFF,0x00,0x66,0xFE,0x14,0x04,0x66,0x05,0xE5,0x02,0x26,0x00,0x4A,0x00,0x00,
-  0x01,0x06,0x01,0x4F,0xFF,0x00,0x00,0x13,0x40,0x0B,0x03,0x3B,0x11,0x26,0x03,0x00,
-  0x3D,0x39,0x16,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x75,
-  0xFE,0x3B,0x04,0x46,0x05,0xCB,0x02,0x26,0x00,0x2A,0x00,0x00,0x01,0x06,0x02,0x39,
-  0x39,0x00,0x00,0x13,0x40,0x0B,0x01,0x1B,0x14,0x27,0x01,0x41,0x19,0x1C,0x07,0x01,
-  0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x66,0xFE,0x14,0x04,0x66,
-  0x06,0x21,0x02,0x26,0x00,0x4A,0x00,0x00,0x01,0x06,0x02,0x3A,0x2D,0x00,0x00,0x13,
-  0x40,0x0B,0x03,0x39,0x11,0x26,0x03,0x2D,0x3A,0x37,0x16,0x00,0x25,0x01,0x2B,0x35,
-  0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x87,0x00,0x00,0x04,0x46,0x07,0x73,0x02,0x26,
-  0x00,0x2B,0x00,0x00,0x01,0x07,0x01,0x4B,0x00,0x00,0x01,0x52,0x00,0x13,0x40,0x0B,
-  0x01,0x0C,0x05,0x26,0x01,0x00,0x12,0x0C,0x05,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,
-  0x35,0x00,0xFF,0xFF,0x00,0xA0,0x00,0x00,0x04,0x2D,0x07,0xAA,0x02,0x26,0x00,0x4B,
-  0x00,0x00,0x01,0x07,0x01,0x4B,0x00,0x0E,0x01,0x89,0x00,0x13,0x40,0x0B,0x01,0x12,
-  0x02,0x26,0x01,0x0E,0x18,0x12,0x07,0x10,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,
-  0x00,0x02,0x00,0x00,0x00,0x00,0x04,0xCD,0x05,0xB6,0x00,0x13,0x00,0x17,0x00,0x58,
-  0x40,0x30,0x14,0x04,0x0C,0x5A,0x09,0x07,0x0B,0x19,0x17,0x03,0x0F,0x5A,0x12,0x00,
-  0xE0,0x10,0xF0,0x10,0x02,0x10,0x0E,0x5F,0x17,0x16,0x0A,0x68,0x12,0x01,0x12,0x60,
-  0x13,0x07,0x03,0x13,0x68,0x17,0x01,0x17,0x13,0x17,0x13,0x01,0x10,0x0B,0x12,0x05,
-  0x01,0x03,0x00,0x3F,0x33,0x3F,0x33,0x12,0x39,0x39,0x2F,0x2F,0x5D,0x11,0x33,0x33,
-  0x10,0xE1,0x5D,0x32,0x32,0x10,0xE1,0x01,0x2F,0x5D,0x33,0x33,0xE1,0x32,0x32,0x10,
-  0xDE,0x32,0x32,0xE1,0x32,0x32,0x31,0x30,0x13,0x35,0x33,0x15,0x21,0x35,0x33,0x15,
-  0x33,0x15,0x23,0x11,0x23,0x11,0x21,0x11,0x23,0x11,0x23,0x35,0x01,0x35,0x21,0x15,
-  0x87,0xBB,0x02,0x49,0xBB,0x87,0x87,0xBB,0xFD,0xB7,0xBB,0x87,0x03,0x8B,0xFD,0xB7,
-  0x04,0xC3,0xF3,0xF3,0xF3,0xF3,0x96,0xFB,0xD3,0x02,0xAA,0xFD,0x56,0x04,0x2D,0x96,
-  0xFE,0x8B,0xDF,0xDF,0x00,0x01,0x00,0x04,0x00,0x00,0x04,0x2D,0x06,0x14,0x00,0x1B,
-  0x00,0x52,0x40,0x31,0x11,0x08,0x00,0x47,0x90,0x1B,0xA0,0x1B,0x02,0x1B,0x1D,0x0F,
-  0x13,0x14,0x03,0x07,0x47,0x0C,0x0A,0x00,0x08,0xB0,0x08,0x02,0x08,0x12,0x0A,0x4F,
-  0x0F,0x0B,0x0B,0x0D,0x14,0x03,0x50,0x00,0x17,0x10,0x17,0x20,0x17,0x03,0x17,0x17,
-  0x0D,0x00,0x08,0x00,0x15,0x00,0x3F,0x32,0x3F,0x39,0x2F,0x5D,0xE1,0x32,0x12,0x39,
-  0x2F,0x33,0xE1,0x32,0x01,0x2F,0x5D,0x33,0x33,0xE1,0x17,0x32,0x10,0xDE,0x5D,0xE1,
-  0x12,0x39,0x31,0x30,0x21,0x11,0x10,0x23,0x22,0x06,0x15,0x11,0x23,0x11,0x23,0x35,
-  0x33,0x35,0x33,0x15,0x21,0x15,0x21,0x15,0x07,0x33,0x36,0x33,0x32,0x16,0x15,0x11,
-  0x03,0x77,0xEC,0xA2,0x93,0xB6,0x9C,0x9C,0xB8,0x01,0xA2,0xFE,0x5C,0x0A,0x0A,0x6C,
-  0xEE,0xC0,0xBD,0x02,0x9A,0x01,0x04,0xBB,0xD3,0xFD,0xF0,0x04,0xD5,0x89,0xB6,0xB6,
-  0x89,0xB8,0x90,0xA8,0xBF,0xD2,0xFD,0x5C,0xFF,0xFF,0x00,0xE1,0x00,0x00,0x03,0xE9,
-  0x07,0x35,0x02,0x26,0x00,0x2C,0x00,0x00,0x01,0x07,0x01,0x52,0x00,0x00,0x01,0x52,
-  0x00,0x13,0x40,0x0B,0x01,0x0C,0x05,0x26,0x01,0x00,0x0D,0x16,0x01,0x00,0x25,0x01,
-  0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xC5,0x00,0x00,0x04,0x33,0x05,0xE3,
-  0x02,0x26,0x00,0xF3,0x00,0x00,0x01,0x06,0x01,0x52,0xFD,0x00,0x00,0x15,0xB4,0x01,
-  0x0A,0x11,0x26,0x01,0xB8,0xFF,0xE7,0xB4,0x0B,0x14,0x07,0x05,0x25,0x01,0x2B,0x35,
-  0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xE1,0x00,0x00,0x03,0xE9,0x06,0xC1,0x02,0x26,
-  0x00,0x2C,0x00,0x00,0x01,0x07,0x01,0x4D,0x00,0x02,0x01,0x52,0x00,0x13,0x40,0x0B,
-  0x01,0x0E,0x05,0x26,0x01,0x02,0x0C,0x0D,0x01,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,
-  0x35,0x00,0xFF,0xFF,0x00,0xC5,0x00,0x00,0x04,0x33,0x05,0x6F,0x02,0x26,0x00,0xF3,
-  0x00,0x00,0x01,0x06,0x01,0x4D,0x00,0x00,0x00,0x15,0xB4,0x01,0x0C,0x11,0x26,0x01,
-  0xB8,0xFF,0xEA,0xB4,0x0A,0x0B,0x07,0x05,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,
-  0xFF,0xFF,0x00,0xE1,0x00,0x00,0x03,0xE9,0x07,0x40,0x02,0x26,0x00,0x2C,0x00,0x00,
-  0x01,0x07,0x01,0x4E,0x00,0x00,0x01,0x52,0x00,0x13,0x40,0x0B,0x01,0x0F,0x05,0x26,
-  0x01,0x01,0x11,0x0C,0x01,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,
-  0x00,0xC5,0x00,0x00,0x04,0x33,0x05,0xEE,0x02,0x26,0x00,0xF3,0x00,0x00,0x01,0x06,
-  0x01,0x4E,0x19,0x00,0x00,0x13,0x40,0x0B,0x01,0x0D,0x11,0x26,0x01,0x03,0x0F,0x00,
-  0x03,0x05,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xE1,0xFE,0x39,
-  0x03,0xE9,0x05,0xB6,0x02,0x26,0x00,0x2C,0x00,0x00,0x01,0x06,0x01,0x51,0x08,0x00,
-  0x00,0x0E,0xB7,0x01,0x01,0x09,0x12,0x0C,0x01,0x00,0x25,0x01,0x2B,0x35,0x00,0x35,
-  0xFF,0xFF,0x00,0xC5,0xFE,0x39,0x04,0x33,0x06,0x0E,0x02,0x26,0x00,0x4C,0x00,0x00,
-  0x01,0x06,0x01,0x51,0x19,0x00,0x00,0x0E,0xB7,0x02,0x02,0x03,0x19,0x13,0x10,0x0E,
-  0x25,0x01,0x2B,0x35,0x00,0x35,0xFF,0xFF,0x00,0xE1,0x00,0x00,0x03,0xE9,0x07,0x37,
-  0x02,0x26,0x00,0x2C,0x00,0x00,0x01,0x07,0x01,0x4F,0x00,0x00,0x01,0x52,0x00,0x13,
-  0x40,0x0B,0x01,0x10,0x05,0x26,0x01,0x01,0x12,0x0E,0x01,0x00,0x25,0x01,0x2B,0x35,
-  0x00,0x2B,0x35,0x00,0x00,0x01,0x00,0xC5,0x00,0x00,0x04,0x33,0x04,0x4A,0x00,0x09,
-  0x00,0x29,0x40,0x15,0x05,0x04,0x47,0x08,0x01,0x56,0x09,0x01,0x09,0x09,0x0A,0x0B,
-  0x04,0x09,0x4E,0x07,0x15,0x00,0x4E,0x02,0x0F,0x00,0x3F,0xE1,0x3F,0xE1,0x32,0x11,
-  0x12,0x01,0x39,0x2F,0x5D,0x33,0x33,0xE1,0x32,0x31,0x30,0x01,0x25,0x35,0x21,0x11,
-  0x05,0x15,0x21,0x35,0x25,0x02,0x1D,0xFE,0xF3,0x01,0xC3,0x01,0x60,0xFC,0x92,0x01,
-  0x58,0x03,0xBA,0x15,0x7B,0xFC,0x45,0x14,0x7B,0x7B,0x14,0x00,0x00,0x02,0x00,0x9C,
-  0xFF,0xEC,0x04,0x23,0x05,0xB6,0x00,0x03,0x00,0x0F,0x00,0x42,0x40,0x28,0x02,0x5A,
-  0x01,0x0A,0x5A,0x0B,0x1F,0x04,0x01,0x9F,0x0B,0xAF,0x0B,0x02,0x00,0x01,0xE0,0x01,
-  0xF0,0x01,0x03,0x01,0x04,0x0B,0x0B,0x04,0x01,0x03,0x10,0x11,0x07,0x60,0x05,0x0E,
-  0x13,0x0A,0x01,0x03,0x00,0x12,0x00,0x3F,0x3F,0x33,0x3F,0x33,0xE1,0x11,0x12,0x01,
-  0x17,0x39,0x2F,0x2F,0x2F,0x5D,0x5D,0x5D,0x10,0xE1,0x10,0xE1,0x31,0x30,0x33,0x11,
-  0x33,0x11,0x37,0x35,0x16,0x33,0x32,0x11,0x11,0x33,0x11,0x10,0x21,0x22,0x9C,0xBA,
-  0x96,0x5D,0x5D,0xC2,0xBB,0xFE,0x93,0x85,0x05,0xB6,0xFA,0x4A,0x17,0xA3,0x2D,0x01,
-  0x1B,0x04,0x0E,0xFB,0xFE,0xFE,0x38,0x00,0x00,0x04,0x00,0xBC,0xFE,0x14,0x04,0x0E,
-  0x06,0x0E,0x00,0x08,0x00,0x11,0x00,0x15,0x00,0x24,0x00,0x58,0x40,0x32,0x02,0x14,
-  0x47,0x15,0x07,0x15,0x10,0x1B,0x47,0x20,0x0B,0x20,0x00,0x1E,0x01,0x00,0x16,0x01,
-  0x00,0x15,0x01,0x15,0x16,0x1E,0x20,0x20,0x1E,0x16,0x15,0x04,0x25,0x26,0x19,0x50,
-  0x17,0x23,0x1B,0x1C,0x4E,0x12,0x1E,0x0F,0x15,0x15,0x0E,0x05,0x53,0x09,0x00,0x00,
-  0x00,0x3F,0x32,0xE5,0x32,0x3F,0x3F,0x33,0xE1,0x3F,0x33,0xE1,0x11,0x12,0x01,0x17,
-  0x39,0x2F,0x2F,0x2F,0x2F,0x5D,0x5D,0x5D,0x11,0x33,0x10,0xE1,0x32,0x11,0x33,0x10,
-  0xE1,0x32,0x31,0x30,0x01,0x32,0x15,0x14,0x06,0x23,0x22,0x35,0x34,0x21,0x32,0x15,
-  0x14,0x06,0x23,0x22,0x35,0x34,0x01,0x33,0x11,0x23,0x01,0x35,0x16,0x33,0x32,0x35,
-  0x11,0x27,0x35,0x21,0x11,0x14,0x06,0x23,0x22,0x01,0x27,0x6A,0x3F,0x2B,0x6B,0x02,
-  0xE4,0x6A,0x3F,0x2B,0x6B,0xFD,0x96,0xB6,0xB6,0x01,0x2B,0x58,0x66,0xA4,0xD7,0x01,
-  0x8D,0xAA,0x97,0x7B,0x06,0x0E,0x72,0x3A,0x39,0x73,0x72,0x72,0x3A,0x39,0x73,0x72,
-  0xFE,0x3C,0xFB,0xB6,0xFE,0x37,0x9A,0x27,0xD7,0x04,0x39,0x15,0x7B,0xFB,0x41,0xB6,
-  0xC1,0x00,0xFF,0xFF,0x00,0x89,0xFF,0xEC,0x04,0xBE,0x07,0x73,0x02,0x26,0x00,0x2D,
-  0x00,0x00,0x01,0x07,0x01,0x4B,0x01,0x0C,0x01,0x52,0x00,0x13,0x40,0x0B,0x01,0x0E,
-  0x05,0x26,0x01,0x00,0x14,0x0E,0x07,0x08,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,
-  0xFF,0xFF,0x00,0x87,0xFE,0x14,0x03,0xC6,0x06,0x21,0x02,0x26,0x01,0x4B,0x14,0x00,
-  0x01,0x06,0x02,0x37,0x00,0x00,0x00,0x15,0xB4,0x01,0x19,0x17,0x27,0x01,0xB8,0xFF,
-  0x74,0xB4,0x10,0x1A,0x06,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,
-  0x00,0xD3,0xFE,0x3B,0x04,0xAE,0x05,0xB6,0x02,0x26,0x00,0x2E,0x00,0x00,0x01,0x06,
-  0x02,0x39,0x1B,0x00,0x00,0x15,0xB4,0x01,0x0F,0x14,0x27,0x01,0xB8,0xFF,0xC1,0xB4,
-  0x0D,0x10,0x05,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xD7,
-  0xFE,0x3B,0x04,0x8B,0x06,0x14,0x02,0x26,0x00,0x4E,0x00,0x00,0x01,0x06,0x02,0x39,
-  0x02,0x00,0x00,0x15,0xB4,0x01,0x11,0x17,0x27,0x01,0xB8,0xFF,0xB7,0xB4,0x0F,0x12,
-  0x0A,0x05,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0x00,0x01,0x00,0xD7,0x00,0x00,
-  0x04,0x8B,0x04,0x4A,0x00,0x0E,0x00,0x77,0x40,0x0B,0x19,0x06,0x29,0x06,0x39,0x06,
-  0x03,0x08,0x06,0x01,0x04,0xB8,0xFF,0xE0,0x40,0x3E,0x10,0x14,0x48,0x46,0x04,0x56,
-  0x04,0x02,0x09,0x02,0x01,0x09,0x01,0x01,0x1B,0x07,0x2B,0x07,0x3B,0x07,0x03,0x07,
-  0x04,0x05,0x02,0x03,0x03,0x06,0x05,0x20,0x10,0x13,0x48,0x00,0x05,0x60,0x05,0x02,
-  0x05,0x05,0x10,0x0D,0x00,0x09,0x46,0x00,0x0A,0x60,0x0A,0x02,0x0A,0x04,0x07,0x07,
-  0x00,0x02,0x0A,0x05,0x15,0x0B,0x02,0x0F,0x00,0x3F,0x33,0x3F,0x33,0x12,0x39,0x39,
-  0x11,0x33,0x01,0x2F,0x5D,0xE1,0x32,0x32,0x11,0x33,0x2F,0x5D,0x2B,0x33,0x33,0x2F,
-  0x33,0x11,0x39,0x39,0x31,0x30,0x00,0x5D,0x01,0x5D,0x5D,0x5D,0x2B,0x5D,0x5D,0x01,
-  0x37,0x01,0x33,0x01,0x01,0x23,0x01,0x07,0x11,0x23,0x11,0x33,0x11,0x03,0x01,0x7F,
-  0x89,0x01,0x92,0xD5,0xFE,0x12,0x02,0x0A,0xD5,0xFE,0x56,0x81,0xB4,0xB4,0x10,0x01,
-  0xFC,0xA6,0x01,0xA8,0xFE,0x02,0xFD,0xB4,0x01,0xD5,0x52,0xFE,0x7D,0x04,0x4A,0xFE,
-  0xDD,0xFE,0xD5,0x00,0xFF,0xFF,0x00,0xE9,0x00,0x00,0x04,0x1F,0x07,0x73,0x02,0x26,
-  0x00,0x2F,0x00,0x00,0x01,0x07,0x00,0x76,0xFF,0x65,0x01,0x52,0x00,0x15,0xB4,0x01,
-  0x0C,0x05,0x26,0x01,0xB8,0xFF,0x48,0xB4,0x06,0x09,0x00,0x04,0x25,0x01,0x2B,0x35,
-  0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xBC,0x00,0x00,0x04,0x2B,0x07,0xAC,0x02,0x26,
-  0x00,0x4F,0x00,0x00,0x01,0x07,0x00,0x76,0x00,0x4E,0x01,0x8B,0x00,0x13,0x40,0x0B,
-  0x01,0x10,0x02,0x26,0x01,0x41,0x0A,0x0D,0x07,0x05,0x25,0x01,0x2B,0x35,0x00,0x2B,
-  0x35,0x00,0xFF,0xFF,0x00,0xE9,0xFE,0x3B,0x04,0x1F,0x05,0xB6,0x02,0x26,0x00,0x2F,
-  0x00,0x00,0x01,0x06,0x02,0x39,0x08,0x00,0x00,0x15,0xB4,0x01,0x08,0x14,0x27,0x01,
-  0xB8,0xFF,0xEA,0xB4,0x06,0x09,0x00,0x04,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,
-  0xFF,0xFF,0x00,0xBC,0xFE,0x3B,0x04,0x2B,0x06,0x14,0x02,0x26,0x00,0x4F,0x00,0x00,
-  0x01,0x06,0x02,0x39,0xEA,0x00,0x00,0x15,0xB4,0x01,0x0C,0x17,0x27,0x01,0xB8,0xFF,
-  0xDD,0xB4,0x0A,0x0D,0x07,0x05,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,
-  0x00,0xE9,0x00,0x00,0x04,0x1F,0x05,0xB7,0x02,0x26,0x00,0x2F,0x00,0x00,0x01,0x07,
-  0x02,0x38,0x01,0x00,0xFF,0xA3,0x00,0x0E,0xB7,0x01,0x01,0xE2,0x06,0x0A,0x00,0x04,
-  0x25,0x01,0x2B,0x35,0x00,0x35,0xFF,0xFF,0x00,0xBC,0x00,0x00,0x04,0x52,0x06,0x14,
-  0x02,0x26,0x00,0x4F,0x00,0x00,0x01,0x07,0x02,0x38,0x01,0x73,0x00,0x00,0x00,0x11,
-  0xB1,0x01,0x01,0xB8,0x01,0x66,0xB4,0x0A,0x0E,0x07,0x05,0x25,0x01,0x2B,0x35,0x00,
-  0x35,0x00,0xFF,0xFF,0x00,0xE9,0x00,0x00,0x04,0x1F,0x05,0xB6,0x02,0x26,0x00,0x2F,
-  0x00,0x00,0x01,0x07,0x01,0x4F,0x00,0xF2,0xFD,0x94,0x00,0x0E,0xB7,0x01,0x01,0xD4,
-  0x0C,0x08,0x00,0x04,0x25,0x01,0x2B,0x35,0x00,0x35,0xFF,0xFF,0x00,0xBC,0x00,0x00,
-  0x04,0x37,0x06,0x14,0x02,0x26,0x00,0x4F,0x00,0x00,0x01,0x07,0x01,0x4F,0x01,0x66,
-  0xFD,0x38,0x00,0x15,0xB4,0x01,0x01,0x7F,0x10,0x01,0xB8,0x01,0x59,0xB4,0x10,0x0C,
-  0x07,0x05,0x25,0x01,0x2B,0x5D,0x35,0x00,0x35,0x00,0x00,0x01,0x00,0x48,0x00,0x00,
-  0x04,0x44,0x05,0xB6,0x00,0x0D,0x00,0x7D,0x40,0x36,0x0A,0x01,0x02,0x09,0x02,0x07,
-  0x04,0x03,0x08,0x03,0x79,0x08,0x89,0x08,0x99,0x08,0x03,0x0A,0x08,0x1A,0x08,0x2A,
-  0x08,0x03,0x76,0x02,0x86,0x02,0x96,0x02,0x03,0x05,0x02,0x15,0x02,0x25,0x02,0x03,
-  0x09,0x09,0x00,0x0D,0x0F,0x07,0x0B,0x5A,0x00,0x03,0x04,0x03,0x00,0x00,0x01,0x00,
-  0xB8,0xFF,0xC0,0x40,0x15,0x0C,0x0F,0x48,0x00,0x01,0x0A,0x04,0x07,0x04,0x02,0x08,
-  0x02,0x08,0x02,0x00,0x05,0x03,0x0B,0x5F,0x00,0x12,0x00,0x3F,0xE1,0x3F,0x12,0x39,
-  0x39,0x2F,0x2F,0x12,0x17,0x39,0x01,0x2F,0x2B,0x5D,0x33,0x33,0x2F,0x10,0xE1,0x32,
-  0x10,0xCE,0x11,0x39,0x2F,0x31,0x30,0x5D,0x5D,0x5D,0x5D,0x10,0x7D,0x87,0x04,0xC4,
-  0xC4,0x10,0x87,0xC4,0xC4,0x21,0x11,0x07,0x27,0x37,0x11,0x33,0x11,0x25,0x17,0x05,
-  0x11,0x21,0x15,0x01,0x0E,0x7D,0x49,0xC6,0xBB,0x01,0x2B,0x4E,0xFE,0x87,0x02,0x7B,
-  0x01,0xEC,0x4E,0x7D,0x7D,0x03,0x1E,0xFD,0x58,0xBD,0x7D,0xEE,0xFE,0x46,0xA6,0x00,
-  0x00,0x01,0x00,0xBC,0x00,0x00,0x04,0x2B,0x06,0x14,0x00,0x11,0x00,0x8D,0x40,0x16,
-  0x69,0x0B,0x01,0x66,0x03,0x01,0x0B,0x00,0x01,0x0A,0x01,0x08,0x03,0x02,0x09,0x02,
-  0x0A,0x18,0x0D,0x16,0x48,0x02,0xB8,0xFF,0xE8,0x40,0x3C,0x0D,0x16,0x48,0x0D,0x6F,
-  0x0A,0x7F,0x0A,0x02,0x0A,0x0A,0x08,0x0C,0x47,0x11,0x03,0x05,0x10,0x03,0x11,0x40,
-  0x02,0xD0,0x02,0xE0,0x02,0x03,0x02,0x02,0x5D,0x11,0x01,0x4F,0x11,0x01,0x11,0x11,
-  0x12,0x13,0x11,0x0C,0x4E,0x0E,0x00,0x0B,0x03,0x08,0x04,0x01,0x09,0x01,0x09,0x01,
-  0x06,0x0E,0x15,0x04,0x4E,0x06,0x00,0x00,0x3F,0xE1,0x3F,0x12,0x39,0x39,0x2F,0x2F,
-  0x12,0x17,0x39,0x10,0xE1,0x32,0x11,0x12,0x01,0x39,0x2F,0x5D,0x5D,0x33,0x2F,0x5D,
-  0x11,0x17,0x33,0x10,0xE1,0x32,0x32,0x2F,0x5D,0x32,0x31,0x30,0x00,0x2B,0x2B,0x10,
-  0x7D,0x87,0xC4,0xC4,0x10,0x87,0xC4,0xC4,0x00,0x5D,0x5D,0x01,0x07,0x27,0x37,0x11,
-  0x25,0x35,0x21,0x11,0x37,0x17,0x07,0x11,0x05,0x15,0x21,0x35,0x25,0x02,0x14,0x8D,
-  0x4E,0xDB,0xFE,0xF4,0x01,0xC3,0xA4,0x4D,0xF1,0x01,0x60,0xFC,0x91,0x01,0x58,0x02,
-  0x50,0x5C,0x79,0x8F,0x02,0x89,0x15,0x7A,0xFD,0x5F,0x6C,0x79,0x9F,0xFD,0xC8,0x14,
-  0x7B,0x7B,0x14,0x00,0xFF,0xFF,0x00,0x87,0x00,0x00,0x04,0x44,0x07,0x73,0x02,0x26,
-  0x00,0x31,0x00,0x00,0x01,0x07,0x00,0x76,0x00,0x62,0x01,0x52,0x00,0x13,0x40,0x0B,
-  0x01,0x16,0x05,0x26,0x01,0x63,0x10,0x13,0x07,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,
-  0x35,0x00,0xFF,0xFF,0x00,0xA0,0x00,0x00,0x04,0x2D,0x06,0x21,0x02,0x26,0x00,0x51,
-  0x00,0x00,0x01,0x06,0x00,0x76,0x6F,0x00,0x00,0x13,0x40,0x0B,0x01,0x17,0x11,0x26,
-  0x01,0x6F,0x11,0x14,0x07,0x0F,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,
-  0x00,0x87,0xFE,0x3B,0x04,0x44,0x05,0xB6,0x02,0x26,0x00,0x31,0x00,0x00,0x01,0x06,
-  0x02,0x39,0xCE,0x00,0x00,0x15,0xB4,0x01,0x12,0x14,0x27,0x01,0xB8,0xFF,0xCF,0xB4,
-  0x10,0x13,0x07,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xA0,
-  0xFE,0x3B,0x04,0x2D,0x04,0x5E,0x02,0x26,0x00,0x51,0x00,0x00,0x01,0x06,0x02,0x39,
-  0xE4,0x00,0x00,0x15,0xB4,0x01,0x13,0x17,0x27,0x01,0xB8,0xFF,0xE4,0xB4,0x11,0x14,
-  0x07,0x0F,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x87,0x00,0x00,
-  0x04,0x44,0x07,0x73,0x02,0x26,0x00,0x31,0x00,0x00,0x01,0x07,0x01,0x4C,0xFF,0xFD,
-  0x01,0x52,0x00,0x15,0xB4,0x01,0x14,0x05,0x26,0x01,0xB8,0xFF,0xFE,0xB4,0x18,0x10,
-  0x07,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xA0,0x00,0x00,
-  0x04,0x2D,0x06,0x21,0x02,0x26,0x00,0x51,0x00,0x00,0x01,0x06,0x01,0x4C,0x0C,0x00,
-  0x00,0x13,0x40,0x0B,0x01,0x15,0x11,0x26,0x01,0x0C,0x19,0x11,0x07,0x0F,0x25,0x01,
-  0x2B,0x35,0x00,0x2B,0x35,0x00,0x00,0x02,0xFF,0xF0,0x00,0x00,0x04,0x6A,0x05,0xB6,
-  0x00,0x06,0x00,0x18,0x00,0x37,0x40,0x1E,0x07,0x47,0x18,0x1A,0x11,0x0D,0x47,0x2F,
-  0x0E,0x01,0x0E,0x06,0x01,0xFC,0x03,0x04,0x11,0x0A,0x50,0x15,0x10,0x0F,0x0F,0x18,
-  0x0E,0x15,0x03,0xFD,0x06,0x00,0x00,0x3F,0xED,0x3F,0x33,0x3F,0x3F,0xE1,0x32,0x01,
-  0x2F,0x33,0xED,0x32,0x2F,0x5D,0xE1,0x32,0x10,0xDE,0xE1,0x31,0x30,0x01,0x17,0x06,
-  0x03,0x23,0x36,0x13,0x01,0x11,0x10,0x23,0x20,0x11,0x11,0x23,0x11,0x33,0x17,0x33,
-  0x36,0x36,0x33,0x20,0x11,0x11,0x01,0x1B,0x0E,0x32,0x7E,0x89,0x3C,0x28,0x03,0x60,
-  0xDB,0xFE,0xE3,0xB6,0x94,0x1A,0x0A,0x2A,0xAD,0x67,0x01,0x6E,0x05,0xB6,0x16,0xC5,
-  0xFE,0xE6,0xF2,0x01,0x03,0xFA,0x4A,0x02,0xC3,0x01,0x04,0xFE,0x72,0xFD,0xC7,0x04,
-  0x4A,0x94,0x4E,0x5A,0xFE,0x6F,0xFD,0x33,0x00,0x01,0x00,0x87,0xFE,0x7B,0x04,0x44,
-  0x05,0xB6,0x00,0x18,0x00,0x62,0xB5,0x18,0x08,0x0E,0x18,0x48,0x07,0xB8,0xFF,0xF0,
-  0x40,0x36,0x10,0x18,0x48,0x45,0x07,0x55,0x07,0x65,0x07,0x03,0x34,0x07,0x01,0x15,
-  0x07,0x25,0x07,0x02,0x06,0x07,0x01,0x13,0x13,0x05,0x18,0x08,0x0C,0xFB,0x0D,0x1A,
-  0x07,0x01,0x04,0xFB,0x00,0x05,0xE0,0x05,0xF0,0x05,0x03,0x05,0x16,0x5F,0x14,0x11,
-  0x0C,0x00,0x06,0x03,0x18,0x08,0x05,0x12,0x00,0x3F,0x33,0x33,0x3F,0x33,0x33,0x2F,
-  0x33,0xE1,0x01,0x2F,0x5D,0xE1,0x32,0x32,0x10,0xDE,0xE1,0x32,0x32,0x11,0x39,0x2F,
-  0x31,0x30,0x5D,0x5D,0x5D,0x5D,0x2B,0x2B,0x01,0x23,0x12,0x15,0x11,0x23,0x11,0x33,
-  0x01,0x33,0x02,0x35,0x11,0x33,0x11,0x14,0x06,0x23,0x22,0x27,0x35,0x16,0x33,0x32,
-  0x35,0x01,0x29,0x08,0x12,0xAC,0xD5,0x02,0x42,0x0A,0x12,0xAE,0xC8,0xBB,0x5E,0x3E,
-  0x4D,0x51,0xD3,0x04,0xBA,0xFE,0xEB,0x8C,0xFC,0xE7,0x05,0xB6,0xFB,0x98,0x01,0x12,
-  0x81,0x02,0xD5,0xFA,0x5E,0xC6,0xD3,0x18,0xA0,0x14,0xE1,0x00,0x00,0x01,0x00,0xA0,
-  0xFE,0x14,0x04,0x2D,0x04,0x5E,0x00,0x18,0x00,0x3C,0x40,0x23,0x0E,0x0E,0x01,0x13,
-  0x47,0x90,0x0A,0xA0,0x0A,0x02,0x0A,0x1A,0x04,0x00,0x47,0x00,0x01,0xB0,0x01,0x02,
-  0x01,0x11,0x50,0x0F,0x0C,0x1B,0x04,0x16,0x50,0x07,0x10,0x02,0x0F,0x01,0x15,0x00,
-  0x3F,0x3F,0x3F,0xE1,0x32,0x3F,0x33,0xE1,0x01,0x2F,0x5D,0xE1,0x32,0x10,0xDE,0x5D,
-  0xE1,0x11,0x39,0x2F,0x31,0x30,0x21,0x23,0x11,0x33,0x17,0x33,0x36,0x33,0x20,0x11,
-  0x11,0x10,0x21,0x22,0x27,0x35,0x16,0x33,0x32,0x35,0x11,0x10,0x23,0x20,0x11,0x01,
-  0x56,0xB6,0x93,0x1B,0x0A,0x67,0xE9,0x01,0x85,0xFE,0xDD,0x51,0x34,0x36,0x3D,0x7F,
-  0xEE,0xFE,0xCD,0x04,0x4A,0x94,0xA8,0xFE,0x6F,0xFC,0x95,0xFE,0xB2,0x19,0x94,0x15,
-  0xAA,0x03,0x6D,0x01,0x04,0xFE,0x72,0x00,0xFF,0xFF,0x00,0x54,0xFF,0xEC,0x04,0x7B,
-  0x06,0xC1,0x02,0x26,0x00,0x32,0x00,0x00,0x01,0x07,0x01,0x4D,0x00,0x04,0x01,0x52,
-  0x00,0x13,0x40,0x0B,0x02,0x16,0x05,0x26,0x02,0x02,0x14,0x15,0x02,0x07,0x25,0x01,
-  0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x73,0xFF,0xEC,0x04,0x58,0x05,0x6F,
-  0x02,0x26,0x00,0x52,0x00,0x00,0x01,0x06,0x01,0x4D,0x00,0x00,0x00,0x13,0x40,0x0B,
-  0x02,0x16,0x11,0x26,0x02,0x00,0x14,0x15,0x03,0x09,0x25,0x01,0x2B,0x35,0x00,0x2B,
-  0x35,0x00,0xFF,0xFF,0x00,0x54,0xFF,0xEC,0x04,0x7B,0x07,0x40,0x02,0x26,0x00,0x32,
-  0x00,0x00,0x01,0x07,0x01,0x4E,0xFF,0xFF,0x01,0x52,0x00,0x15,0xB4,0x02,0x17,0x05,
-  0x26,0x02,0xB8,0xFF,0xFE,0xB4,0x19,0x14,0x02,0x07,0x25,0x01,0x2B,0x35,0x00,0x2B,
-  0x35,0x00,0xFF,0xFF,0x00,0x73,0xFF,0xEC,0x04,0x58,0x05,0xEE,0x02,0x26,0x00,0x52,
-  0x00,0x00,0x01,0x06,0x01,0x4E,0x00,0x00,0x00,0x13,0x40,0x0B,0x02,0x17,0x11,0x26,
-  0x02,0x00,0x19,0x14,0x03,0x09,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,
-  0x00,0x54,0xFF,0xEC,0x04,0x7B,0x07,0x73,0x02,0x26,0x00,0x32,0x00,0x00,0x01,0x07,
-  0x01,0x53,0x00,0x50,0x01,0x52,0x00,0x17,0x40,0x0D,0x03,0x02,0x1A,0x05,0x26,0x03,
-  0x02,0x4E,0x14,0x1F,0x02,0x07,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,
-  0xFF,0xFF,0x00,0x73,0xFF,0xEC,0x04,0x58,0x06,0x21,0x02,0x26,0x00,0x52,0x00,0x00,
-  0x01,0x06,0x01,0x53,0x52,0x00,0x00,0x17,0x40,0x0D,0x03,0x02,0x1A,0x11,0x26,0x03,
-  0x02,0x52,0x14,0x1F,0x03,0x09,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,
-  0x00,0x02,0x00,0x14,0xFF,0xEC,0x04,0xCB,0x05,0xCD,0x00,0x13,0x00,0x1C,0x00,0x49,
-  0x40,0x29,0x0E,0x12,0x5A,0x10,0x14,0x01,0x14,0x10,0x14,0x10,0x06,0x0C,0x00,0x1E,
-  0x19,0x5A,0x06,0x11,0x5F,0x68,0x0E,0x01,0x0E,0x0E,0x13,0x0C,0x5F,0x0B,0x03,0x17,
-  0x5F,0x08,0x04,0x1B,0x5F,0x04,0x13,0x13,0x5F,0x00,0x12,0x00,0x3F,0xE1,0x3F,0xE1,
-  0x3F,0xE1,0x3F,0xE1,0x12,0x39,0x2F,0x5D,0xE1,0x01,0x2F,0xE1,0x10,0xCE,0x32,0x11,
-  0x39,0x39,0x2F,0x2F,0x5D,0xE1,0x32,0x31,0x30,0x21,0x21,0x07,0x06,0x23,0x20,0x11,
-  0x10,0x21,0x32,0x17,0x21,0x15,0x21,0x11,0x21,0x15,0x21,0x11,0x21,0x25,0x11,0x26,
-  0x23,0x20,0x11,0x10,0x21,0x32,0x04,0xCB,0xFD,0xC2,0x30,0x33,0x2E,0xFE,0x18,0x02,
-  0x00,0x52,0x48,0x02,0x1D,0xFE,0x72,0x01,0x67,0xFE,0x99,0x01,0x8E,0xFD,0xC0,0x3A,
-  0x49,0xFE,0xC9,0x01,0x35,0x46,0x0A,0x0A,0x02,0xF3,0x02,0xEE,0x17,0xA4,0xFE,0x3C,
-  0xA2,0xFD,0xF8,0x0C,0x04,0x58,0x21,0xFD,0xB4,0xFD,0xB2,0x00,0x00,0x03,0x00,0x39,
-  0xFF,0xEC,0x04,0x96,0x04,0x5E,0x00,0x1A,0x00,0x24,0x00,0x29,0x00,0x6C,0x40,0x29,
-  0x0A,0x00,0x29,0x11,0x47,0x10,0x1D,0x40,0x1D,0x50,0x1D,0x70,0x1D,0x80,0x1D,0xB0,
-  0x1D,0xC0,0x1D,0xD0,0x1D,0x08,0x1D,0x1D,0x05,0x25,0x46,0x16,0x10,0x40,0x0A,0x16,
-  0x48,0x0B,0x10,0x01,0x10,0x2B,0x22,0x47,0x05,0xB8,0xFF,0xC0,0x40,0x18,0x12,0x18,
-  0x48,0x05,0x11,0x50,0x29,0x29,0x1B,0x27,0x0A,0x1F,0x50,0x0C,0x08,0x10,0x13,0x00,
-  0x1B,0x50,0x18,0x15,0x02,0x16,0x00,0x3F,0x33,0x33,0xE1,0x32,0x32,0x3F,0x33,0xE1,
-  0x32,0x32,0x12,0x39,0x2F,0xE1,0x01,0x2F,0x2B,0xE1,0x10,0xDE,0x5D,0x2B,0x32,0xE1,
-  0x11,0x39,0x2F,0x5D,0xE1,0x32,0x39,0x39,0x31,0x30,0x25,0x06,0x23,0x22,0x02,0x11,
-  0x10,0x12,0x33,0x32,0x17,0x36,0x33,0x32,0x12,0x15,0x15,0x21,0x12,0x33,0x32,0x37,
-  0x15,0x06,0x23,0x22,0x26,0x25,0x32,0x11,0x10,0x23,0x22,0x06,0x15,0x14,0x16,0x01,
-  0x10,0x23,0x22,0x03,0x02,0x8B,0x58,0xB2,0x92,0xB6,0xB0,0x9A,0xAB,0x59,0x54,0x9E,
-  0x83,0x9A,0xFE,0x49,0x03,0xBA,0x6C,0x60,0x5E,0x7B,0x57,0x8F,0xFE,0xE4,0xA8,0xAA,
-  0x5A,0x4E,0x4F,0x02,0xB3,0x7B,0x7D,0x0C,0xC9,0xDD,0x01,0x33,0x01,0x08,0x01,0x0C,
-  0x01,0x2B,0xD9,0xD9,0xFE,0xF5,0xE0,0x71,0xFE,0x89,0x4C,0xA2,0x49,0x76,0x21,0x01,
-  0x9A,0x01,0xAA,0xCE,0xD2,0xD3,0xD1,0x02,0x13,0x01,0x31,0xFE,0xCF,0x00,0xFF,0xFF,
-  0x00,0xBA,0x00,0x00,0x04,0x93,0x07,0x73,0x02,0x26,0x00,0x35,0x00,0x00,0x01,0x07,
-  0x00,0x76,0x00,0x1D,0x01,0x52,0x00,0x15,0xB4,0x02,0x1B,0x05,0x26,0x02,0xB8,0xFF,
-  0xDD,0xB4,0x15,0x18,0x02,0x09,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,
-  0x01,0x08,0x00,0x00,0x04,0x23,0x06,0x21,0x02,0x26,0x00,0x55,0x00,0x00,0x01,0x06,
-  0x00,0x76,0x5C,0x00,0x00,0x13,0x40,0x0B,0x01,0x17,0x11,0x26,0x01,0x2D,0x11,0x14,
-  0x08,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xBA,0xFE,0x3B,
-  0x04,0x93,0x05,0xB6,0x02,0x26,0x00,0x35,0x00,0x00,0x01,0x06,0x02,0x39,0xFD,0x00,
-  0x00,0x15,0xB4,0x02,0x17,0x14,0x27,0x02,0xB8,0xFF,0xBD,0xB4,0x15,0x18,0x02,0x09,
-  0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xBB,0xFE,0x3B,0x04,0x23,
-  0x04,0x5E,0x02,0x26,0x00,0x55,0x00,0x00,0x01,0x07,0x02,0x39,0xFE,0xD8,0x00,0x00,
-  0x00,0x26,0x40,0x11,0x01,0x13,0x17,0x27,0x01,0x5F,0x11,0x01,0x3F,0x11,0x01,0x1F,
-  0x11,0x01,0x0F,0x11,0x01,0xB8,0xFE,0xA9,0xB4,0x11,0x14,0x08,0x00,0x25,0x01,0x2B,
-  0x5D,0x5D,0x5D,0x5D,0x35,0x00,0x2B,0x35,0xFF,0xFF,0x00,0xBA,0x00,0x00,0x04,0x93,
-  0x07,0x73,0x02,0x26,0x00,0x35,0x00,0x00,0x01,0x07,0x01,0x4C,0xFF,0xE2,0x01,0x52,
-  0x00,0x15,0xB4,0x02,0x19,0x05,0x26,0x02,0xB8,0xFF,0xA2,0xB4,0x1D,0x15,0x02,0x09,
-  0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x01,0x08,0x00,0x00,0x04,0x23,
-  0x06,0x21,0x02,0x26,0x00,0x55,0x00,0x00,0x01,0x06,0x01,0x4C,0x0C,0x00,0x00,0x15,
-  0xB4,0x01,0x15,0x11,0x26,0x01,0xB8,0xFF,0xDD,0xB4,0x19,0x11,0x08,0x00,0x25,0x01,
-  0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x8D,0xFF,0xEC,0x04,0x3F,0x07,0x73,
-  0x02,0x26,0x00,0x36,0x00,0x00,0x01,0x07,0x00,0x76,0x00,0x60,0x01,0x52,0x00,0x13,
-  0x40,0x0B,0x01,0x26,0x05,0x26,0x01,0x60,0x20,0x23,0x00,0x1B,0x25,0x01,0x2B,0x35,
-  0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xCB,0xFF,0xEC,0x04,0x02,0x06,0x21,0x02,0x26,
-  0x00,0x56,0x00,0x00,0x01,0x06,0x00,0x76,0x5E,0x00,0x00,0x13,0x40,0x0B,0x01,0x26,
-  0x11,0x26,0x01,0x5E,0x20,0x23,0x00,0x1B,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,
-  0xFF,0xFF,0x00,0x8D,0xFF,0xEC,0x04,0x3F,0x07,0x73,0x02,0x26,0x00,0x36,0x00,0x00,
-  0x01,0x07,0x01,0x4B,0x00,0x14,0x01,0x52,0x00,0x13,0x40,0x0B,0x01,0x20,0x05,0x26,
-  0x01,0x14,0x26,0x20,0x00,0x1B,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,
-  0x00,0xCB,0xFF,0xEC,0x04,0x02,0x06,0x21,0x02,0x26,0x00,0x56,0x00,0x00,0x01,0x06,
-  0x01,0x4B,0x17,0x00,0x00,0x13,0x40,0x0B,0x01,0x20,0x11,0x26,0x01,0x17,0x26,0x20,
-  0x00,0x1B,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x8D,0xFE,0x14,
-  0x04,0x3F,0x05,0xCB,0x02,0x26,0x00,0x36,0x00,0x00,0x01,0x06,0x00,0x7A,0xEA,0x00,
-  0x00,0x0E,0xB9,0x00,0x01,0xFF,0xEB,0xB4,0x20,0x2C,0x00,0x1B,0x25,0x01,0x2B,0x35,
-  0xFF,0xFF,0x00,0xCB,0xFE,0x14,0x04,0x02,0x04,0x5E,0x02,0x26,0x00,0x56,0x00,0x00,
-  0x01,0x06,0x00,0x7A,0xF7,0x00,0x00,0x11,0xB1,0x01,0x01,0xB8,0xFF,0xF7,0xB4,0x20,
-  0x2C,0x00,0x1B,0x25,0x01,0x2B,0x35,0x00,0x35,0x00,0xFF,0xFF,0x00,0x8D,0xFF,0xEC,
-  0x04,0x3F,0x07,0x73,0x02,0x26,0x00,0x36,0x00,0x00,0x01,0x07,0x01,0x4C,0x00,0x1F,
-  0x01,0x52,0x00,0x13,0x40,0x0B,0x01,0x24,0x05,0x26,0x01,0x1F,0x28,0x20,0x00,0x1B,
-  0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xCB,0xFF,0xEC,0x04,0x02,
-  0x06,0x21,0x02,0x26,0x00,0x56,0x00,0x00,0x01,0x06,0x01,0x4C,0x0A,0x00,0x00,0x13,
-  0x40,0x0B,0x01,0x24,0x11,0x26,0x01,0x0A,0x28,0x20,0x00,0x1B,0x25,0x01,0x2B,0x35,
-  0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x66,0xFE,0x3B,0x04,0x64,0x05,0xB6,0x02,0x26,
-  0x00,0x37,0x00,0x00,0x01,0x06,0x02,0x39,0xDE,0x00,0x00,0x15,0xB4,0x01,0x0A,0x14,
-  0x27,0x01,0xB8,0xFF,0xDF,0xB4,0x08,0x0B,0x03,0x05,0x25,0x01,0x2B,0x35,0x00,0x2B,
-  0x35,0x00,0xFF,0xFF,0x00,0x8B,0xFE,0x3B,0x04,0x02,0x05,0x6F,0x02,0x26,0x00,0x57,
-  0x00,0x00,0x01,0x06,0x02,0x39,0x06,0x00,0x00,0x13,0x40,0x0B,0x01,0x16,0x17,0x27,
-  0x01,0x25,0x14,0x17,0x07,0x0D,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,
-  0x00,0x66,0x00,0x00,0x04,0x64,0x07,0x73,0x02,0x26,0x00,0x37,0x00,0x00,0x01,0x07,
-  0x01,0x4C,0xFF,0xFF,0x01,0x52,0x00,0x13,0x40,0x0B,0x01,0x0C,0x05,0x26,0x01,0x00,
-  0x10,0x08,0x03,0x05,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x8B,
-  0xFF,0xEC,0x04,0x10,0x06,0x14,0x02,0x26,0x00,0x57,0x00,0x00,0x01,0x07,0x02,0x38,
-  0x01,0x31,0x00,0x00,0x00,0x11,0xB1,0x01,0x01,0xB8,0x01,0x51,0xB4,0x14,0x18,0x07,
-  0x0D,0x25,0x01,0x2B,0x35,0x00,0x35,0x00,0x00,0x01,0x00,0x66,0x00,0x00,0x04,0x64,
-  0x05,0xB6,0x00,0x0F,0x00,0x59,0x40,0x33,0x09,0x09,0x0B,0x05,0x05,0x07,0x0B,0x5A,
-  0x0C,0x0E,0x0E,0x02,0x00,0xD0,0x0C,0x01,0xA2,0x0C,0x01,0x93,0x0C,0x01,0x03,0x8E,
-  0x0C,0x01,0x04,0x63,0x0C,0x01,0x05,0x10,0x0C,0x50,0x0C,0x02,0x0C,0x0A,0x0E,0x60,
-  0x07,0x0F,0x0F,0x03,0x0B,0x12,0x06,0x02,0x5F,0x03,0x03,0x00,0x3F,0xE1,0x32,0x3F,
-  0x12,0x39,0x2F,0x33,0xE1,0x32,0x01,0x2F,0x5D,0x5F,0x5D,0x5F,0x5D,0x5F,0x5D,0x5D,
-  0x5D,0x33,0xC4,0x39,0x2F,0x10,0xF1,0x32,0xC0,0x2F,0x11,0x39,0x2F,0x31,0x30,0x01,
-  0x11,0x21,0x35,0x21,0x15,0x21,0x11,0x21,0x15,0x21,0x11,0x23,0x11,0x21,0x35,0x02,
-  0x08,0xFE,0x5E,0x03,0xFE,0xFE,0x5F,0x01,0x26,0xFE,0xDA,0xBB,0xFE,0xD7,0x03,0x33,
-  0x01,0xDF,0xA4,0xA4,0xFE,0x21,0x95,0xFD,0x62,0x02,0x9E,0x95,0x00,0x01,0x00,0x8B,
-  0xFF,0xEC,0x04,0x02,0x05,0x6F,0x00,0x1B,0x00,0x70,0x40,0x43,0x16,0x12,0x14,0x10,
-  0x18,0x47,0x05,0x07,0x05,0x20,0x0B,0x01,0x0B,0x0B,0x0D,0x09,0x2F,0x05,0x3F,0x05,
-  0x7F,0x05,0x8F,0x05,0xCF,0x05,0xDF,0x05,0x06,0x00,0x05,0x01,0x05,0x05,0x1C,0x1D,
-  0x12,0x12,0x7F,0x01,0x8F,0x01,0xAF,0x01,0x03,0x01,0x1D,0x06,0x17,0x4E,0x09,0x14,
-  0x14,0x1A,0x0A,0x13,0x4E,0x0F,0x0D,0x0C,0x10,0x0F,0x1A,0x50,0x00,0x03,0x16,0x00,
-  0x3F,0x33,0xE1,0x3F,0x33,0x33,0x33,0xE1,0x32,0x12,0x39,0x2F,0x33,0xE1,0x32,0x01,
-  0x10,0xCE,0x5D,0x32,0x2F,0x11,0x12,0x39,0x2F,0x5D,0x5D,0x33,0x33,0x33,0x2F,0x5D,
-  0x12,0x39,0x10,0xE1,0x32,0x32,0x11,0x39,0x31,0x30,0x25,0x15,0x06,0x23,0x20,0x11,
-  0x35,0x23,0x35,0x33,0x35,0x21,0x35,0x25,0x13,0x33,0x11,0x21,0x15,0x21,0x15,0x21,
-  0x15,0x21,0x15,0x14,0x33,0x32,0x03,0xFC,0x82,0x7A,0xFE,0x96,0xA2,0xA2,0xFE,0xF5,
-  0x01,0x0B,0x4D,0x69,0x01,0xB6,0xFE,0x4A,0x01,0x33,0xFE,0xCD,0xC0,0x5D,0x96,0x8A,
-  0x20,0x01,0x58,0xFB,0x8A,0xF8,0x5E,0x31,0x01,0x1F,0xFE,0xDB,0x89,0xF8,0x8A,0xFB,
-  0xC3,0x00,0xFF,0xFF,0x00,0x7D,0xFF,0xEC,0x04,0x50,0x07,0x35,0x02,0x26,0x00,0x38,
-  0x00,0x00,0x01,0x07,0x01,0x52,0x00,0x06,0x01,0x52,0x00,0x13,0x40,0x0B,0x01,0x0F,
-  0x05,0x26,0x01,0x05,0x10,0x19,0x06,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,
-  0xFF,0xFF,0x00,0xA0,0xFF,0xEC,0x04,0x2D,0x05,0xE3,0x02,0x26,0x00,0x58,0x00,0x00,
-  0x01,0x06,0x01,0x52,0x02,0x00,0x00,0x13,0x40,0x0B,0x01,0x12,0x11,0x26,0x01,0x01,
-  0x13,0x1C,0x06,0x10,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x7D,
-  0xFF,0xEC,0x04,0x50,0x06,0xC1,0x02,0x26,0x00,0x38,0x00,0x00,0x01,0x07,0x01,0x4D,
-  0x00,0x00,0x01,0x52,0x00,0x15,0xB4,0x01,0x11,0x05,0x26,0x01,0xB8,0xFF,0xFF,0xB4,
-  0x0F,0x10,0x06,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xA0,
-  0xFF,0xEC,0x04,0x2D,0x05,0x6F,0x02,0x26,0x00,0x58,0x00,0x00,0x01,0x06,0x01,0x4D,
-  0x02,0x00,0x00,0x13,0x40,0x0B,0x01,0x14,0x11,0x26,0x01,0x01,0x12,0x13,0x06,0x10,
-  0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x7D,0xFF,0xEC,0x04,0x50,
-  0x07,0x40,0x02,0x26,0x00,0x38,0x00,0x00,0x01,0x07,0x01,0x4E,0xFF,0xFF,0x01,0x52,
-  0x00,0x15,0xB4,0x01,0x12,0x05,0x26,0x01,0xB8,0xFF,0xFF,0xB4,0x14,0x0F,0x06,0x00,
-  0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xA0,0xFF,0xEC,0x04,0x2D,
-  0x05,0xEE,0x02,0x26,0x00,0x58,0x00,0x00,0x01,0x06,0x01,0x4E,0x00,0x00,0x00,0x13,
-  0x40,0x0B,0x01,0x15,0x11,0x26,0x01,0x00,0x17,0x12,0x06,0x10,0x25,0x01,0x2B,0x35,
-  0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x7D,0xFF,0xEC,0x04,0x50,0x07,0xD9,0x02,0x26,
-  0x00,0x38,0x00,0x00,0x01,0x07,0x01,0x50,0x00,0x02,0x01,0x52,0x00,0x17,0x40,0x0D,
-  0x02,0x01,0x0F,0x05,0x26,0x02,0x01,0x01,0x12,0x18,0x06,0x00,0x25,0x01,0x2B,0x35,
-  0x35,0x00,0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0xA0,0xFF,0xEC,0x04,0x2D,0x06,0x87,
-  0x02,0x26,0x00,0x58,0x00,0x00,0x01,0x06,0x01,0x50,0xFD,0x00,0x00,0x19,0xB6,0x02,
-  0x01,0x12,0x11,0x26,0x02,0x01,0xB8,0xFF,0xFC,0xB4,0x15,0x1B,0x06,0x10,0x25,0x01,
-  0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0x7D,0xFF,0xEC,0x04,0x50,
-  0x07,0x73,0x02,0x26,0x00,0x38,0x00,0x00,0x01,0x07,0x01,0x53,0x00,0x4C,0x01,0x52,
-  0x00,0x17,0x40,0x0D,0x02,0x01,0x15,0x05,0x26,0x02,0x01,0x4B,0x0F,0x1A,0x06,0x00,
-  0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0xA0,0xFF,0xEC,
-  0x04,0x2D,0x06,0x21,0x02,0x26,0x00,0x58,0x00,0x00,0x01,0x06,0x01,0x53,0x50,0x00,
-  0x00,0x17,0x40,0x0D,0x02,0x01,0x18,0x11,0x26,0x02,0x01,0x4F,0x12,0x1D,0x06,0x10,
-  0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0x7D,0xFE,0x39,
-  0x04,0x50,0x05,0xB8,0x02,0x26,0x00,0x38,0x00,0x00,0x01,0x06,0x01,0x51,0x1B,0x00,
-  0x00,0x0E,0xB7,0x01,0x01,0x1B,0x15,0x0F,0x06,0x00,0x25,0x01,0x2B,0x35,0x00,0x35,
-  0xFF,0xFF,0x00,0xA0,0xFE,0x39,0x04,0x64,0x04,0x4A,0x02,0x26,0x00,0x58,0x00,0x00,
-  0x01,0x07,0x01,0x51,0x01,0x35,0x00,0x00,0x00,0x17,0x40,0x0E,0x01,0x01,0x10,0x1A,
-  0x01,0x00,0x1A,0x01,0x00,0x1A,0x1A,0x00,0x00,0x25,0x01,0x2B,0x5D,0x5D,0x35,0x00,
-  0x35,0x00,0xFF,0xFF,0x00,0x02,0x00,0x00,0x04,0xCB,0x07,0x73,0x02,0x26,0x00,0x3A,
-  0x00,0x00,0x01,0x07,0x01,0x4B,0x00,0x02,0x01,0x52,0x00,0x13,0x40,0x0B,0x01,0x1A,
-  0x05,0x26,0x01,0x02,0x20,0x1A,0x12,0x08,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,
-  0xFF,0xFF,0xFF,0xFC,0x00,0x00,0x04,0xD1,0x06,0x21,0x02,0x26,0x00,0x5A,0x00,0x00,
-  0x01,0x06,0x01,0x4B,0xFD,0x00,0x00,0x15,0xB4,0x01,0x1A,0x11,0x26,0x01,0xB8,0xFF,
-  0xFD,0xB4,0x20,0x1A,0x07,0x18,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,
-  0x00,0x21,0x00,0x00,0x04,0xAA,0x07,0x73,0x02,0x26,0x00,0x3C,0x00,0x00,0x01,0x07,
-  0x01,0x4B,0xFF,0xFF,0x01,0x52,0x00,0x13,0x40,0x0B,0x01,0x09,0x05,0x26,0x01,0x00,
-  0x0F,0x09,0x07,0x02,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x52,
-  0xFE,0x14,0x04,0x79,0x06,0x21,0x02,0x26,0x00,0x5C,0x00,0x00,0x01,0x06,0x01,0x4B,
-  0x02,0x00,0x00,0x13,0x40,0x0B,0x01,0x17,0x11,0x26,0x01,0x03,0x1D,0x17,0x00,0x09,
-  0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x21,0x00,0x00,0x04,0xAA,
-  0x07,0x2B,0x02,0x26,0x00,0x3C,0x00,0x00,0x01,0x07,0x00,0x6A,0x00,0x02,0x01,0x52,
-  0x00,0x17,0x40,0x0D,0x02,0x01,0x0D,0x05,0x26,0x02,0x01,0x02,0x0F,0x13,0x07,0x02,
-  0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0x66,0x00,0x00,
-  0x04,0x64,0x07,0x73,0x02,0x26,0x00,0x3D,0x00,0x00,0x01,0x07,0x00,0x76,0x00,0x39,
-  0x01,0x52,0x00,0x13,0x40,0x0B,0x01,0x10,0x05,0x26,0x01,0x3A,0x0A,0x0D,0x01,0x00,
-  0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xB6,0x00,0x00,0x04,0x14,
-  0x06,0x21,0x02,0x26,0x00,0x5D,0x00,0x00,0x01,0x06,0x00,0x76,0x4E,0x00,0x00,0x13,
-  0x40,0x0B,0x01,0x10,0x11,0x26,0x01,0x4F,0x0A,0x0D,0x01,0x00,0x25,0x01,0x2B,0x35,
-  0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x66,0x00,0x00,0x04,0x64,0x07,0x37,0x02,0x26,
-  0x00,0x3D,0x00,0x00,0x01,0x07,0x01,0x4F,0x00,0x10,0x01,0x52,0x00,0x13,0x40,0x0B,
-  0x01,0x0E,0x05,0x26,0x01,0x11,0x10,0x0C,0x01,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,
-  0x35,0x00,0xFF,0xFF,0x00,0xB6,0x00,0x00,0x04,0x14,0x05,0xE5,0x02,0x26,0x00,0x5D,
-  0x00,0x00,0x01,0x06,0x01,0x4F,0x10,0x00,0x00,0x13,0x40,0x0B,0x01,0x0E,0x11,0x26,
-  0x01,0x11,0x10,0x0C,0x01,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,
-  0x00,0x66,0x00,0x00,0x04,0x64,0x07,0x73,0x02,0x26,0x00,0x3D,0x00,0x00,0x01,0x07,
-  0x01,0x4C,0xFF,0xFF,0x01,0x52,0x00,0x13,0x40,0x0B,0x01,0x0E,0x05,0x26,0x01,0x00,
-  0x12,0x0A,0x01,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xB6,
-  0x00,0x00,0x04,0x14,0x06,0x21,0x02,0x26,0x00,0x5D,0x00,0x00,0x01,0x06,0x01,0x4C,
-  0x0C,0x00,0x00,0x13,0x40,0x0B,0x01,0x0E,0x11,0x26,0x01,0x0D,0x12,0x0A,0x01,0x00,
-  0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0x00,0x01,0x01,0x64,0x00,0x00,0x03,0xFA,
-  0x06,0x1F,0x00,0x0D,0x00,0x2E,0x40,0x1C,0x07,0x47,0x4F,0x08,0x5F,0x08,0xBF,0x08,
-  0xEF,0x08,0xFF,0x08,0x05,0x08,0x08,0x0E,0x20,0x00,0x01,0x00,0x0F,0x03,0x50,0x01,
-  0x0C,0x01,0x07,0x15,0x00,0x3F,0x3F,0x33,0xE1,0x01,0x10,0xCE,0x5D,0x12,0x39,0x2F,
-  0x5D,0xE1,0x31,0x30,0x01,0x07,0x26,0x23,0x22,0x06,0x15,0x11,0x23,0x11,0x34,0x36,
-  0x33,0x32,0x03,0xFA,0x29,0x69,0x7A,0x77,0x5C,0xB7,0xB4,0xD1,0x7D,0x05,0xFC,0x8F,
-  0x1C,0x60,0x77,0xFB,0x4E,0x04,0xB0,0xBE,0xB1,0x00,0x00,0x01,0x00,0xD7,0xFE,0x14,
-  0x03,0xF6,0x05,0xCB,0x00,0x1F,0x00,0x52,0x40,0x2A,0x16,0x1E,0x16,0x1E,0x21,0x00,
-  0x0E,0x07,0x0E,0x07,0x20,0x1D,0x00,0x6F,0x0D,0x0E,0x0E,0x10,0x1F,0x0D,0x01,0x0D,
-  0x0D,0x20,0x21,0x0D,0x00,0x75,0x10,0x1D,0x1D,0x09,0x19,0x73,0x17,0x14,0x07,0x09,
-  0x73,0x07,0x04,0x1B,0x00,0x3F,0x33,0xE1,0x3F,0x33,0xE1,0x12,0x39,0x2F,0x33,0xE1,
-  0x32,0x11,0x12,0x01,0x39,0x2F,0x5D,0x33,0x33,0x2F,0x10,0xE1,0x32,0x12,0x39,0x39,
-  0x2F,0x2F,0x11,0x12,0x39,0x39,0x2F,0x2F,0x31,0x30,0x01,0x11,0x14,0x06,0x23,0x22,
-  0x27,0x35,0x16,0x33,0x32,0x36,0x35,0x11,0x23,0x35,0x37,0x35,0x34,0x36,0x33,0x32,
-  0x17,0x07,0x26,0x23,0x22,0x06,0x15,0x15,0x33,0x15,0x02,0x9C,0x99,0xB3,0x33,0x46,
-  0x3B,0x38,0x5C,0x3F,0xC2,0xC2,0x99,0xB3,0x61,0x64,0x2F,0x4F,0x41,0x5C,0x3F,0xF5,
-  0x03,0x44,0xFC,0x3F,0xBE,0xB1,0x0F,0x99,0x12,0x66,0x71,0x03,0xC3,0x4B,0x44,0x89,
-  0xBE,0xB1,0x25,0x8D,0x1C,0x66,0x71,0x91,0x89,0x00,0xFF,0xFF,0x00,0x21,0x00,0x00,
-  0x04,0xAC,0x08,0x73,0x02,0x26,0x00,0x24,0x00,0x00,0x00,0x26,0x01,0x50,0x02,0x7D,
-  0x01,0x07,0x00,0x76,0x00,0x48,0x02,0x52,0x00,0x52,0x40,0x30,0x04,0xB0,0x28,0x01,
-  0x60,0x28,0x01,0x50,0x28,0x01,0x40,0x28,0x01,0x28,0x44,0x03,0x02,0xEF,0x1A,0x01,
-  0xDF,0x1A,0x01,0x50,0x1A,0x01,0x40,0x1A,0x01,0x20,0x1A,0x01,0x10,0x1A,0x01,0x00,
-  0x1A,0x01,0x1A,0x04,0x1E,0x26,0x29,0x12,0x18,0x25,0x03,0x02,0xB8,0xFF,0xFF,0xB4,
-  0x12,0x18,0x04,0x07,0x25,0x01,0x2B,0x35,0x35,0x2B,0x35,0x00,0x11,0x5D,0x5D,0x5D,
-  0x5D,0x5D,0x5D,0x5D,0x35,0x35,0x3F,0x5D,0x5D,0x5D,0x5D,0x35,0xFF,0xFF,0x00,0x87,
-  0xFF,0xEC,0x04,0x02,0x08,0x00,0x02,0x26,0x00,0x44,0x00,0x00,0x00,0x26,0x01,0x50,
-  0x00,0x00,0x01,0x07,0x00,0x76,0x00,0x5E,0x01,0xDF,0x00,0x48,0x40,0x31,0x04,0xF0,
-  0x40,0x01,0xEF,0x40,0x01,0xDF,0x40,0x01,0xCF,0x40,0x01,0x60,0x40,0x01,0x1F,0x40,
-  0x01,0x40,0x03,0x02,0xF0,0x22,0x01,0xE0,0x22,0x01,0xD0,0x22,0x01,0x22,0x11,0x26,
-  0x04,0x1E,0x40,0x3C,0x25,0x2B,0x25,0x03,0x02,0x21,0x25,0x2B,0x08,0x16,0x25,0x01,
-  0x2B,0x35,0x35,0x2B,0x35,0x00,0x2B,0x5D,0x5D,0x5D,0x35,0x35,0x11,0x5D,0x5D,0x5D,
-  0x5D,0x5D,0x5D,0x35,0xFF,0xFF,0x00,0x00,0x00,0x00,0x04,0xBA,0x07,0x73,0x02,0x26,
-  0x00,0x88,0x00,0x00,0x01,0x07,0x00,0x76,0x00,0xD5,0x01,0x52,0x00,0x13,0x40,0x0B,
-  0x02,0x1A,0x05,0x26,0x02,0xDE,0x14,0x17,0x05,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,
-  0x35,0x00,0xFF,0xFF,0x00,0x2D,0xFF,0xEC,0x04,0xA2,0x06,0x21,0x02,0x26,0x00,0xA8,
-  0x00,0x00,0x01,0x06,0x00,0x76,0x71,0x00,0x00,0x13,0x40,0x0B,0x03,0x3A,0x11,0x26,
-  0x03,0x70,0x34,0x37,0x20,0x0F,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,
-  0x00,0x50,0xFF,0xB4,0x04,0x85,0x07,0x73,0x02,0x26,0x00,0x9A,0x00,0x00,0x01,0x07,
-  0x00,0x76,0x00,0x39,0x01,0x52,0x00,0x13,0x40,0x0B,0x03,0x28,0x05,0x26,0x03,0x35,
-  0x22,0x25,0x02,0x0B,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x73,
-  0xFF,0xAA,0x04,0x58,0x06,0x21,0x02,0x26,0x00,0xBA,0x00,0x00,0x01,0x06,0x00,0x76,
-  0x50,0x00,0x00,0x13,0x40,0x0B,0x03,0x2A,0x11,0x26,0x03,0x51,0x24,0x27,0x05,0x0F,
-  0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x8D,0xFE,0x3B,0x04,0x3F,
-  0x05,0xCB,0x02,0x26,0x00,0x36,0x00,0x00,0x01,0x06,0x02,0x39,0x00,0x00,0x00,0x13,
-  0x40,0x0B,0x01,0x22,0x14,0x27,0x01,0x00,0x20,0x23,0x00,0x1B,0x25,0x01,0x2B,0x35,
-  0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xCB,0xFE,0x3B,0x04,0x02,0x04,0x5E,0x02,0x26,
-  0x00,0x56,0x00,0x00,0x01,0x06,0x02,0x39,0xE4,0x00,0x00,0x15,0xB4,0x01,0x22,0x17,
-  0x27,0x01,0xB8,0xFF,0xE4,0xB4,0x20,0x23,0x00,0x1B,0x25,0x01,0x2B,0x35,0x00,0x2B,
-  0x35,0x00,0x00,0x01,0x01,0x1B,0x04,0xD9,0x03,0xB2,0x06,0x21,0x00,0x0F,0x00,0x2B,
-  0x40,0x15,0x0C,0x0B,0x03,0x03,0x05,0x06,0x95,0x01,0x00,0x00,0x11,0x03,0x0B,0x92,
-  0x06,0x0F,0x00,0x5F,0x00,0x02,0x00,0x00,0x2F,0x5D,0x32,0xED,0x39,0x11,0x01,0x33,
-  0x2F,0x33,0xE4,0x32,0x39,0x19,0x2F,0x33,0x33,0x31,0x30,0x01,0x23,0x26,0x27,0x06,
-  0x07,0x23,0x35,0x36,0x37,0x36,0x37,0x33,0x16,0x17,0x17,0x03,0xB2,0x79,0x55,0x7E,
-  0x85,0x4E,0x78,0x19,0x22,0x8B,0x25,0xC1,0x25,0x8B,0x3B,0x04,0xD9,0x38,0x82,0x88,
-  0x32,0x1B,0x1D,0x26,0x9B,0x4F,0x4F,0x9B,0x43,0x00,0x00,0x01,0x01,0x1B,0x04,0xD9,
-  0x03,0xB2,0x06,0x21,0x00,0x0F,0x00,0x2B,0x40,0x15,0x05,0x04,0x0C,0x0C,0x0A,0x09,
-  0x95,0x0E,0x0F,0x0F,0x11,0x0C,0x0E,0x09,0x92,0x0F,0x05,0x5F,0x05,0x02,0x05,0x00,
-  0x2F,0x5D,0xE4,0x32,0x39,0x11,0x01,0x33,0x2F,0x33,0xE4,0x32,0x39,0x19,0x2F,0x33,
-  0x33,0x31,0x30,0x01,0x06,0x07,0x06,0x07,0x23,0x26,0x27,0x27,0x35,0x33,0x16,0x17,
-  0x36,0x37,0x33,0x03,0xB2,0x19,0x22,0x8D,0x23,0xC1,0x23,0x8D,0x3B,0x78,0x52,0x81,
-  0x7A,0x59,0x79,0x06,0x06,0x1D,0x26,0x9E,0x4C,0x4C,0x9E,0x43,0x1B,0x36,0x85,0x80,
-  0x3B,0x00,0x00,0x01,0x01,0x46,0x04,0xD9,0x03,0x85,0x05,0x6F,0x00,0x03,0x00,0x41,
-  0x40,0x18,0x1F,0x01,0xDF,0x01,0xEF,0x01,0xFF,0x01,0x04,0x01,0x01,0x05,0x70,0x00,
-  0x80,0x00,0xD0,0x00,0xE0,0x00,0xF0,0x00,0x05,0x00,0xB8,0xFF,0xC0,0x40,0x11,0x09,
-  0x0C,0x48,0x00,0x00,0x04,0x01,0x8F,0x0F,0x02,0x01,0x02,0x40,0x0C,0x18,0x48,0x02,
-  0x00,0x2F,0x2B,0x5D,0xE1,0x11,0x01,0x33,0x2F,0x2B,0x5D,0x11,0x33,0x2F,0x5D,0x31,
-  0x30,0x01,0x21,0x15,0x21,0x01,0x46,0x02,0x3F,0xFD,0xC1,0x05,0x6F,0x96,0x00,0x01,
-  0x01,0x39,0x04,0xD9,0x03,0x93,0x05,0xEE,0x00,0x0B,0x00,0x4C,0x40,0x12,0x06,0x83,
-  0x00,0x05,0x10,0x05,0x20,0x05,0x60,0x05,0x70,0x05,0x80,0x05,0xA0,0x05,0x07,0x05,
-  0xB8,0xFF,0xC0,0x40,0x20,0x15,0x18,0x48,0x05,0x05,0x0B,0x83,0x1F,0x00,0x8F,0x00,
-  0xAF,0x00,0xEF,0x00,0xFF,0x00,0x05,0x00,0x00,0x0D,0x0B,0x05,0x94,0x09,0x8F,0x0F,
-  0x03,0x5F,0x03,0x02,0x03,0x00,0x2F,0x5D,0xE1,0xED,0x32,0x11,0x01,0x33,0x2F,0x5D,
-  0xE1,0x33,0x2F,0x2B,0x5D,0xE1,0x31,0x30,0x01,0x06,0x06,0x23,0x20,0x03,0x33,0x16,
-  0x16,0x33,0x32,0x37,0x03,0x93,0x09,0xA0,0x88,0xFE,0xE8,0x11,0x6D,0x07,0x4F,0x68,
-  0xB5,0x0A,0x05,0xEE,0x7F,0x96,0x01,0x15,0x4C,0x31,0x7D,0x00,0x00,0x01,0x01,0xFC,
-  0x05,0x00,0x02,0xD1,0x05,0xE5,0x00,0x07,0x00,0x4A,0x40,0x34,0xE6,0x06,0x01,0x06,
-  0x85,0x02,0xDB,0x02,0x01,0xC9,0x02,0x01,0xAD,0x02,0x01,0x89,0x02,0x01,0x5B,0x02,
-  0x01,0x42,0x02,0x01,0x26,0x02,0x01,0x1B,0x02,0x01,0x02,0x09,0x00,0x93,0x4F,0x04,
-  0x6F,0x04,0x7F,0x04,0x9F,0x04,0xAF,0x04,0xCF,0x04,0xDF,0x04,0xEF,0x04,0x08,0x04,
-  0x00,0x2F,0x5D,0xED,0x11,0x01,0x33,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x10,
-  0xE1,0x5D,0x31,0x30,0x01,0x32,0x15,0x14,0x23,0x22,0x35,0x34,0x02,0x66,0x6B,0x6B,
-  0x6A,0x05,0xE5,0x72,0x73,0x73,0x72,0x00,0x00,0x02,0x01,0x83,0x04,0xD9,0x03,0x48,
-  0x06,0x87,0x00,0x0B,0x00,0x16,0x00,0x8D,0xB5,0xA4,0x0A,0xB4,0x0A,0x02,0x0A,0xB8,
-  0xFF,0xE0,0x40,0x09,0x0C,0x0F,0x48,0xA4,0x08,0xB4,0x08,0x02,0x08,0xB8,0xFF,0xE0,
-  0x40,0x18,0x0C,0x0F,0x48,0xAB,0x04,0xBB,0x04,0x02,0x04,0x20,0x0C,0x0F,0x48,0xAB,
-  0x02,0xBB,0x02,0x02,0x02,0x20,0x0C,0x0F,0x48,0x0F,0xB8,0xFF,0xF0,0x40,0x2A,0x13,
-  0x18,0x48,0x0F,0x83,0x00,0x03,0x10,0x03,0x20,0x03,0x03,0x03,0x14,0x10,0x13,0x18,
-  0x48,0x14,0x83,0x09,0x18,0x0C,0x08,0x15,0x18,0x48,0x0C,0x8C,0x0F,0x06,0x1F,0x06,
-  0x2F,0x06,0x7F,0x06,0xCF,0x06,0x05,0x06,0x11,0xB8,0xFF,0xF0,0x40,0x0B,0x15,0x18,
-  0x48,0x11,0x8C,0x0F,0x00,0x5F,0x00,0x02,0x00,0x00,0x2F,0x5D,0xE1,0x2B,0xDC,0x5D,
-  0xE1,0x2B,0x01,0x10,0xDE,0xE1,0x2B,0xDC,0x5D,0xE1,0x2B,0x31,0x30,0x2B,0x5D,0x2B,
-  0x5D,0x2B,0x5D,0x2B,0x5D,0x01,0x22,0x26,0x35,0x34,0x36,0x33,0x32,0x16,0x15,0x14,
-  0x06,0x03,0x22,0x06,0x15,0x14,0x33,0x32,0x36,0x35,0x34,0x26,0x02,0x62,0x66,0x79,
-  0x79,0x66,0x65,0x81,0x7F,0x67,0x31,0x3F,0x70,0x32,0x3F,0x3F,0x04,0xD9,0x74,0x63,
-  0x63,0x74,0x76,0x5F,0x62,0x77,0x01,0x48,0x3C,0x35,0x71,0x3C,0x35,0x35,0x3C,0x00,
-  0x00,0x01,0x01,0x9E,0xFE,0x39,0x03,0x2F,0x00,0x00,0x00,0x0E,0x00,0x38,0x40,0x22,
-  0x2D,0x07,0x3D,0x07,0x4D,0x07,0x03,0x05,0x30,0x0B,0x13,0x48,0x08,0x09,0x00,0x0B,
-  0x84,0x4F,0x06,0x5F,0x06,0x02,0x06,0x06,0x00,0x00,0x10,0x08,0x0D,0x8E,0x20,0x03,
-  0x01,0x03,0x00,0x2F,0x5D,0xE1,0x2F,0x11,0x01,0x33,0x2F,0x33,0x2F,0x5D,0xE1,0x11,
-  0x39,0x39,0x31,0x30,0x2B,0x5D,0x01,0x15,0x06,0x23,0x22,0x26,0x35,0x34,0x37,0x33,
-  0x06,0x15,0x14,0x33,0x32,0x03,0x2F,0x49,0x53,0x77,0x7E,0xBE,0x83,0xAA,0x7F,0x42,
-  0xFE,0xC1,0x71,0x17,0x6D,0x5E,0x90,0x6C,0x7D,0x71,0x60,0x00,0x00,0x01,0x00,0xFE,
-  0x04,0xD9,0x03,0xCD,0x05,0xE3,0x00,0x11,0x00,0x33,0x40,0x1E,0x00,0x82,0x00,0x01,
-  0x90,0x01,0xB0,0x01,0xC0,0x01,0x04,0x01,0x01,0x09,0x82,0x0A,0x0A,0x13,0x10,0x8F,
-  0x09,0x03,0x94,0x07,0x8F,0x00,0x0F,0x0C,0x01,0x0C,0x00,0x2F,0x5D,0x33,0xE1,0xFD,
-  0x32,0xE1,0x11,0x01,0x33,0x2F,0xE1,0x33,0x2F,0x5D,0xE1,0x31,0x30,0x01,0x23,0x12,
-  0x33,0x32,0x17,0x16,0x33,0x32,0x37,0x33,0x02,0x23,0x22,0x27,0x26,0x23,0x22,0x01,
-  0x66,0x68,0x19,0xBA,0x3A,0x67,0x66,0x22,0x50,0x1A,0x69,0x1B,0xB8,0x39,0x64,0x64,
-  0x28,0x52,0x04,0xD9,0x01,0x08,0x38,0x38,0x72,0xFE,0xF8,0x39,0x38,0x00,0x00,0x02,
-  0x00,0xF6,0x04,0xD9,0x03,0xD5,0x06,0x21,0x00,0x07,0x00,0x0F,0x00,0x43,0x40,0x2A,
-  0x0E,0x0F,0x86,0x0B,0x06,0x07,0x86,0x02,0x87,0x40,0x03,0x50,0x03,0x02,0x03,0x03,
-  0x0A,0x87,0x4F,0x0B,0x5F,0x0B,0x6F,0x0B,0xAF,0x0B,0xDF,0x0B,0x05,0x0B,0x0B,0x11,
-  0x0A,0x02,0x92,0x0E,0x0F,0x06,0x5F,0x06,0x02,0x06,0x00,0x2F,0x5D,0x33,0xED,0x32,
-  0x11,0x01,0x33,0x2F,0x5D,0xE1,0x33,0x2F,0x5D,0xE1,0xED,0x32,0x10,0xED,0x32,0x31,
-  0x30,0x13,0x36,0x37,0x33,0x15,0x06,0x07,0x23,0x25,0x36,0x37,0x33,0x15,0x06,0x07,
-  0x23,0xF6,0x5E,0x50,0xC6,0x70,0xA0,0x64,0x01,0x6A,0x57,0x57,0xC7,0x70,0xA0,0x65,
-  0x04,0xF4,0x85,0xA8,0x15,0xAD,0x86,0x1B,0x76,0xB7,0x15,0xAD,0x86,0x00,0x00,0x01,
-  0x01,0xDF,0x04,0xD9,0x02,0xEC,0x06,0x21,0x00,0x09,0x00,0x20,0x40,0x10,0x08,0x09,
-  0x09,0x03,0x85,0x04,0x04,0x0B,0x03,0x92,0x0F,0x08,0x5F,0x08,0x02,0x08,0x00,0x2F,
-  0x5D,0xED,0x11,0x01,0x33,0x2F,0xE1,0x33,0x2F,0x33,0x31,0x30,0x01,0x37,0x36,0x37,
-  0x33,0x15,0x14,0x06,0x07,0x23,0x01,0xDF,0x1E,0x1E,0x0A,0xC7,0x63,0x3D,0x6D,0x04,
-  0xF4,0x6B,0x72,0x50,0x15,0x10,0xD0,0x53,0x00,0x03,0x01,0x2B,0x05,0x0C,0x03,0xA0,
-  0x06,0xB4,0x00,0x07,0x00,0x10,0x00,0x18,0x00,0x57,0x40,0x39,0x06,0x07,0x02,0x87,
-  0x03,0x06,0x07,0x16,0x07,0x02,0x07,0x03,0x07,0x03,0x13,0x0A,0x85,0x00,0x0F,0x10,
-  0x0F,0x20,0x0F,0xE0,0x0F,0xF0,0x0F,0x05,0x0F,0x0F,0x17,0x85,0x13,0x02,0x92,0x06,
-  0x06,0x11,0x08,0x93,0x15,0x4F,0x0D,0x6F,0x0D,0x7F,0x0D,0x9F,0x0D,0xAF,0x0D,0xCF,
-  0x0D,0xDF,0x0D,0x07,0x0D,0x00,0x2F,0x5D,0x33,0xED,0x32,0x39,0x2F,0xED,0x01,0x2F,
-  0xE1,0x33,0x2F,0x5D,0xE1,0x12,0x39,0x39,0x2F,0x2F,0x5D,0x10,0xE1,0x11,0x33,0x31,
-  0x30,0x01,0x36,0x37,0x33,0x15,0x06,0x07,0x23,0x27,0x32,0x15,0x14,0x06,0x23,0x22,
-  0x35,0x34,0x21,0x32,0x15,0x14,0x23,0x22,0x35,0x34,0x02,0x14,0x32,0x29,0xCE,0x5D,
-  0x7A,0x52,0x89,0x61,0x38,0x29,0x60,0x02,0x14,0x61,0x61,0x60,0x05,0x87,0x8B,0xA2,
-  0x14,0xA4,0x8F,0x6C,0x66,0x31,0x36,0x67,0x66,0x66,0x67,0x67,0x66,0x00,0xFF,0xFF,
-  0x00,0x21,0x00,0x00,0x04,0xAC,0x05,0xBC,0x02,0x26,0x00,0x24,0x00,0x00,0x01,0x07,
-  0x01,0x54,0xFE,0x45,0xFF,0x97,0x00,0x18,0xB6,0x02,0x12,0x03,0x02,0x10,0x0F,0x01,
-  0xB8,0xFE,0x44,0xB4,0x0F,0x13,0x04,0x07,0x25,0x01,0x2B,0x5D,0x35,0x00,0x3F,0x35,
-  0x00,0x01,0x01,0xE7,0x02,0x48,0x02,0xE5,0x03,0x5E,0x00,0x07,0x00,0x22,0x40,0x14,
-  0x02,0x96,0x30,0x06,0x60,0x06,0xB0,0x06,0xE0,0x06,0xF0,0x06,0x05,0x06,0x06,0x08,
-  0x09,0x00,0x9B,0x04,0x00,0x2F,0xED,0x11,0x12,0x01,0x39,0x2F,0x5D,0xED,0x31,0x30,
-  0x01,0x32,0x15,0x14,0x23,0x22,0x35,0x34,0x02,0x66,0x7F,0x7F,0x7F,0x03,0x5E,0x8B,
-  0x8B,0x8B,0x8B,0x00,0xFF,0xFF,0xFF,0x8E,0x00,0x00,0x04,0x23,0x05,0xB8,0x02,0x26,
-  0x00,0x28,0x00,0x00,0x01,0x07,0x01,0x54,0xFD,0xAF,0xFF,0x97,0x00,0x21,0x40,0x0D,
-  0x01,0x0F,0x03,0x01,0x20,0x0C,0x01,0x10,0x0C,0x01,0x00,0x0C,0x01,0xB8,0xFD,0x97,
-  0xB4,0x0C,0x10,0x01,0x00,0x25,0x01,0x2B,0x5D,0x5D,0x5D,0x35,0x00,0x3F,0x35,0x00,
-  0xFF,0xFF,0xFF,0x65,0x00,0x00,0x04,0x46,0x05,0xB8,0x02,0x26,0x00,0x2B,0x00,0x00,
-  0x01,0x07,0x01,0x54,0xFD,0x86,0xFF,0x97,0x00,0x21,0x40,0x0D,0x01,0x0F,0x03,0x01,
-  0x20,0x0C,0x01,0x10,0x0C,0x01,0x00,0x0C,0x01,0xB8,0xFD,0x85,0xB4,0x0C,0x10,0x05,
-  0x00,0x25,0x01,0x2B,0x5D,0x5D,0x5D,0x35,0x00,0x3F,0x35,0x00,0xFF,0xFF,0xFF,0xA3,
-  0x00,0x00,0x03,0xE9,0x05,0xB8,0x02,0x26,0x00,0x2C,0x00,0x00,0x01,0x07,0x01,0x54,
-  0xFD,0xC4,0xFF,0x97,0x00,0x18,0xB6,0x01,0x0F,0x03,0x01,0x00,0x0C,0x01,0xB8,0xFD,
-  0xC5,0xB4,0x0C,0x10,0x01,0x00,0x25,0x01,0x2B,0x5D,0x35,0x00,0x3F,0x35,0xFF,0xFF,
-  0xFF,0x7C,0xFF,0xEC,0x04,0x7B,0x05,0xCD,0x02,0x26,0x00,0x32,0x00,0x00,0x01,0x07,
-  0x01,0x54,0xFD,0x9D,0xFF,0x97,0x00,0x14,0xB3,0x02,0x17,0x03,0x02,0xB8,0xFD,0x9B,
-  0xB4,0x14,0x18,0x02,0x07,0x25,0x01,0x2B,0x35,0x00,0x3F,0x35,0xFF,0xFF,0xFF,0x13,
-  0x00,0x00,0x04,0xAA,0x05,0xB8,0x02,0x26,0x00,0x3C,0x00,0x00,0x01,0x07,0x01,0x54,
-  0xFD,0x34,0xFF,0x97,0x00,0x14,0xB3,0x01,0x0C,0x03,0x01,0xB8,0xFD,0x34,0xB4,0x09,
-  0x0D,0x07,0x02,0x25,0x01,0x2B,0x35,0x00,0x3F,0x35,0xFF,0xFF,0xFF,0x7A,0x00,0x00,
-  0x04,0x87,0x05,0xCD,0x02,0x26,0x01,0x76,0x00,0x00,0x01,0x07,0x01,0x54,0xFD,0x9B,
-  0xFF,0x97,0x00,0x14,0xB3,0x01,0x1D,0x03,0x01,0xB8,0xFD,0x98,0xB4,0x1A,0x1E,0x02,
-  0x0F,0x25,0x01,0x2B,0x35,0x00,0x3F,0x35,0xFF,0xFF,0x00,0xF1,0xFF,0xEC,0x03,0xF8,
-  0x06,0xB4,0x02,0x26,0x01,0x86,0x00,0x00,0x01,0x06,0x01,0x55,0xC6,0x00,0x00,0x12,
-  0xB2,0x03,0x02,0x01,0xB8,0xFF,0x5A,0xB4,0x1B,0x1F,0x0A,0x05,0x25,0x01,0x2B,0x35,
-  0x35,0x35,0xFF,0xFF,0x00,0x21,0x00,0x00,0x04,0xAC,0x05,0xBC,0x02,0x06,0x00,0x24,
-  0x00,0x00,0xFF,0xFF,0x00,0x87,0x00,0x00,0x04,0x71,0x05,0xB6,0x02,0x06,0x00,0x25,
-  0x00,0x00,0x00,0x01,0x00,0xF6,0x00,0x00,0x04,0x2F,0x05,0xB6,0x00,0x05,0x00,0x39,
-  0x40,0x10,0x00,0x40,0x12,0x16,0x48,0x00,0x07,0x03,0x5A,0x50,0x04,0x01,0x00,0x04,
-  0x01,0x04,0xB8,0xFF,0xC0,0xB3,0x15,0x18,0x48,0x04,0xB8,0xFF,0xC0,0x40,0x0A,0x0D,
-  0x10,0x48,0x04,0x02,0x5F,0x05,0x03,0x03,0x12,0x00,0x3F,0x3F,0xE1,0x01,0x2F,0x2B,
-  0x2B,0x5D,0x71,0xE1,0x10,0xCE,0x2B,0x31,0x30,0x01,0x15,0x21,0x11,0x23,0x11,0x04,
-  0x2F,0xFD,0x81,0xBA,0x05,0xB6,0xA6,0xFA,0xF0,0x05,0xB6,0x00,0x00,0x02,0x00,0x44,
-  0x00,0x00,0x04,0x87,0x05,0xB6,0x00,0x05,0x00,0x0C,0x00,0xD5,0xB9,0x00,0x09,0xFF,
-  0xF0,0x40,0x1B,0x0F,0x13,0x48,0xB8,0x04,0x01,0x04,0x08,0x0E,0x11,0x48,0x48,0x04,
-  0x01,0x29,0x04,0x01,0x18,0x04,0x01,0x09,0x04,0x01,0xB7,0x05,0x01,0x05,0xB8,0xFF,
-  0xF8,0x40,0x20,0x0E,0x11,0x48,0x47,0x05,0x01,0x26,0x05,0x01,0x17,0x05,0x01,0x06,
-  0x05,0x01,0x0A,0x10,0x0F,0x13,0x48,0xE8,0x04,0x01,0xE7,0x05,0x01,0x05,0x04,0x06,
-  0x06,0x01,0x09,0xB8,0xFF,0xF0,0x40,0x54,0x14,0x18,0x48,0x57,0x09,0x01,0x47,0x09,
-  0x01,0x25,0x09,0x01,0x06,0x09,0x16,0x09,0x02,0x09,0x60,0x02,0x01,0x02,0x0A,0x10,
-  0x14,0x18,0x48,0x58,0x0A,0x01,0x48,0x0A,0x01,0x2A,0x0A,0x01,0x09,0x0A,0x19,0x0A,
-  0x02,0x0A,0x80,0x01,0xA0,0x01,0xF0,0x01,0x03,0x2F,0x01,0x4F,0x01,0x6F,0x01,0x03,
-  0x01,0x5B,0x06,0x01,0x29,0x06,0x39,0x06,0x49,0x06,0x03,0x06,0x10,0x11,0x14,0x48,
-  0x1D,0x06,0x01,0x06,0x04,0x03,0x00,0x03,0x09,0x5F,0x02,0x12,0x00,0x3F,0xE1,0x39,
-  0x39,0x3F,0x33,0x5D,0x2B,0x5D,0x5D,0x01,0x2F,0x5D,0x5D,0x33,0x5D,0x5D,0x5D,0x5D,
-  0x2B,0x2F,0x5D,0x33,0x5D,0x5D,0x5D,0x5D,0x2B,0x12,0x39,0x3D,0x2F,0x33,0x33,0x5D,
-  0x5D,0x31,0x30,0x2B,0x5D,0x5D,0x5D,0x5D,0x2B,0x5D,0x5D,0x5D,0x5D,0x5D,0x2B,0x5D,
-  0x2B,0x25,0x15,0x21,0x35,0x01,0x33,0x07,0x06,0x07,0x03,0x21,0x03,0x26,0x04,0x87,
-  0xFB,0xBD,0x01,0xC2,0xBB,0x5F,0x33,0x25,0xFE,0x02,0xAE,0xFC,0x34,0x7D,0x7D,0x85,
-  0x05,0x31,0xCD,0xDF,0x6E,0xFD,0x0A,0x02,0xF0,0x9B,0xFF,0xFF,0x00,0xD9,0x00,0x00,
-  0x04,0x23,0x05,0xB6,0x02,0x06,0x00,0x28,0x00,0x00,0xFF,0xFF,0x00,0x66,0x00,0x00,
-  0x04,0x64,0x05,0xB6,0x02,0x06,0x00,0x3D,0x00,0x00,0xFF,0xFF,0x00,0x87,0x00,0x00,
-  0x04,0x46,0x05,0xB6,0x02,0x06,0x00,0x2B,0x00,0x00,0x00,0x03,0x00,0x54,0xFF,0xEC,
-  0x04,0x7B,0x05,0xCD,0x00,0x09,0x00,0x13,0x00,0x17,0x00,0x61,0x40,0x40,0x74,0x15,
-  0x84,0x15,0x02,0x2F,0x15,0x3F,0x15,0x02,0x7B,0x14,0x8B,0x14,0x02,0x20,0x14,0x30,
-  0x14,0x02,0x15,0x14,0x15,0x14,0x02,0x58,0x0D,0x01,0x0D,0x5B,0x07,0x19,0x57,0x12,
-  0x01,0x12,0x5B,0x1F,0x02,0x2F,0x02,0x02,0x02,0x17,0x60,0x9F,0x14,0xCF,0x14,0x02,
-  0x68,0x14,0x01,0x14,0x14,0x0A,0x10,0x5F,0x04,0x04,0x0A,0x5F,0x00,0x13,0x00,0x3F,
-  0xE1,0x3F,0xE1,0x12,0x39,0x2F,0x5D,0x5D,0xE1,0x01,0x2F,0x5D,0xE1,0x5D,0x10,0xDE,
-  0xE1,0x5D,0x12,0x39,0x39,0x2F,0x2F,0x5D,0x5D,0x5D,0x5D,0x31,0x30,0x05,0x20,0x11,
-  0x10,0x21,0x20,0x00,0x11,0x10,0x00,0x27,0x32,0x12,0x11,0x10,0x02,0x23,0x20,0x11,
-  0x10,0x13,0x21,0x15,0x21,0x02,0x68,0xFD,0xEC,0x02,0x16,0x01,0x00,0x01,0x11,0xFE,
-  0xEC,0xFF,0xAD,0xA1,0xA3,0xA9,0xFE,0xAF,0x81,0x01,0x9B,0xFE,0x65,0x14,0x02,0xF3,
-  0x02,0xEE,0xFE,0x79,0xFE,0x97,0xFE,0x97,0xFE,0x78,0xA3,0x01,0x22,0x01,0x2C,0x01,
-  0x2F,0x01,0x1D,0xFD,0xB4,0xFD,0xB2,0x02,0xAA,0xA1,0xFF,0xFF,0x00,0xE1,0x00,0x00,
-  0x03,0xE9,0x05,0xB6,0x02,0x06,0x00,0x2C,0x00,0x00,0xFF,0xFF,0x00,0xD3,0x00,0x00,
-  0x04,0xAE,0x05,0xB6,0x02,0x06,0x00,0x2E,0x00,0x00,0x00,0x01,0x00,0x21,0x00,0x00,
-  0x04,0xAC,0x05,0xB6,0x00,0x0A,0x00,0xBE,0xB9,0x00,0x07,0xFF,0xF0,0x40,0x1B,0x0F,
-  0x13,0x48,0xB8,0x09,0x01,0x09,0x08,0x0E,0x11,0x48,0x48,0x09,0x01,0x29,0x09,0x01,
-  0x18,0x09,0x01,0x09,0x09,0x01,0xB7,0x0A,0x01,0x0A,0xB8,0xFF,0xF8,0x40,0x1F,0x0E,
-  0x11,0x48,0x47,0x0A,0x01,0x26,0x0A,0x01,0x17,0x0A,0x01,0x06,0x0A,0x01,0x02,0x10,
-  0x0F,0x13,0x48,0xE8,0x09,0x01,0xE7,0x0A,0x01,0x0A,0x09,0x04,0x04,0x07,0xB8,0xFF,
-  0xF0,0x40,0x44,0x14,0x18,0x48,0x57,0x07,0x01,0x47,0x07,0x01,0x25,0x07,0x01,0x06,
-  0x07,0x16,0x07,0x02,0x07,0x08,0x01,0x10,0x14,0x18,0x48,0x58,0x01,0x01,0x48,0x01,
-  0x01,0x2A,0x01,0x01,0x09,0x01,0x19,0x01,0x02,0x01,0x2F,0x00,0x7F,0x00,0xCF,0x00,
-  0xEF,0x00,0x04,0x00,0x04,0x10,0x11,0x14,0x48,0x04,0x10,0x0B,0x0E,0x48,0x1D,0x04,
-  0x01,0x04,0x09,0x03,0x08,0x00,0x12,0x00,0x3F,0x32,0x3F,0x33,0x5D,0x2B,0x2B,0x01,
-  0x2F,0x5D,0x32,0x5D,0x5D,0x5D,0x5D,0x2B,0x2F,0x33,0x5D,0x5D,0x5D,0x5D,0x2B,0x39,
-  0x3D,0x2F,0x33,0x33,0x5D,0x5D,0x31,0x30,0x2B,0x5D,0x5D,0x5D,0x5D,0x2B,0x5D,0x5D,
-  0x5D,0x5D,0x5D,0x2B,0x5D,0x2B,0x21,0x23,0x01,0x26,0x27,0x06,0x07,0x01,0x23,0x01,
-  0x33,0x04,0xAC,0xC7,0xFE,0xDC,0x3F,0x1E,0x2D,0x2B,0xFE,0xD9,0xC4,0x01,0xE7,0xBB,
-  0x03,0x9A,0xC7,0x8D,0xC8,0x86,0xFC,0x60,0x05,0xB6,0xFF,0xFF,0x00,0x71,0x00,0x00,
-  0x04,0x5C,0x05,0xB6,0x02,0x06,0x00,0x30,0x00,0x00,0xFF,0xFF,0x00,0x87,0x00,0x00,
-  0x04,0x44,0x05,0xB6,0x02,0x06,0x00,0x31,0x00,0x00,0x00,0x03,0x00,0x6F,0x00,0x00,
-  0x04,0x5C,0x05,0xB6,0x00,0x03,0x00,0x07,0x00,0x0B,0x00,0x47,0x40,0x29,0x2F,0x05,
-  0x3F,0x05,0x02,0x20,0x04,0x30,0x04,0x02,0x04,0x05,0x04,0x05,0x0A,0x01,0x01,0x09,
-  0x0D,0x00,0x00,0x01,0x00,0x00,0x0A,0x07,0x5F,0x68,0x04,0x01,0x04,0x04,0x00,0x0B,
-  0x5F,0x0A,0x12,0x03,0x5F,0x00,0x03,0x00,0x3F,0xE1,0x3F,0xE1,0x11,0x39,0x2F,0x5D,
-  0xE1,0x01,0x2F,0x33,0x2F,0x71,0x10,0xCE,0x32,0x2F,0x11,0x39,0x39,0x2F,0x2F,0x5D,
-  0x5D,0x31,0x30,0x13,0x21,0x15,0x21,0x13,0x21,0x15,0x21,0x01,0x15,0x21,0x35,0x98,
-  0x03,0x9B,0xFC,0x65,0x51,0x02,0xF8,0xFD,0x08,0x03,0x73,0xFC,0x13,0x05,0xB6,0xA4,
-  0xFE,0x3C,0xA2,0xFD,0xF8,0xA4,0xA4,0x00,0xFF,0xFF,0x00,0x54,0xFF,0xEC,0x04,0x7B,
-  0x05,0xCD,0x02,0x06,0x00,0x32,0x00,0x00,0x00,0x01,0x00,0x87,0x00,0x00,0x04,0x46,
-  0x05,0xB6,0x00,0x07,0x00,0x25,0x40,0x15,0x01,0x5A,0x00,0x09,0x04,0x5A,0x00,0x05,
-  0xE0,0x05,0xF0,0x05,0x03,0x05,0x03,0x5F,0x06,0x03,0x05,0x00,0x12,0x00,0x3F,0x32,
-  0x3F,0xE1,0x01,0x2F,0x5D,0xE1,0x10,0xDE,0xE1,0x31,0x30,0x21,0x23,0x11,0x21,0x11,
-  0x23,0x11,0x21,0x04,0x46,0xBB,0xFD,0xB7,0xBB,0x03,0xBF,0x05,0x12,0xFA,0xEE,0x05,
-  0xB6,0x00,0xFF,0xFF,0x00,0xB0,0x00,0x00,0x04,0x46,0x05,0xB6,0x02,0x06,0x00,0x33,
-  0x00,0x00,0x00,0x01,0x00,0x83,0x00,0x00,0x04,0x48,0x05,0xB6,0x00,0x0B,0x00,0x80,
-  0x40,0x57,0x37,0x09,0xD7,0x09,0xE7,0x09,0xF7,0x09,0x04,0x26,0x09,0x01,0x07,0x09,
-  0x17,0x09,0x02,0x37,0x07,0xD7,0x07,0xE7,0x07,0xF7,0x07,0x04,0x26,0x07,0x01,0x07,
-  0x07,0x17,0x07,0x02,0x38,0x02,0xD8,0x02,0xE8,0x02,0xF8,0x02,0x04,0x19,0x02,0x29,
-  0x02,0x02,0x08,0x02,0x01,0x08,0x02,0x02,0x00,0x06,0xEF,0x0A,0xFF,0x0A,0x02,0x0A,
-  0x0D,0x07,0x03,0x03,0x09,0x00,0x00,0xF0,0x00,0x02,0x00,0x03,0x07,0x5F,0x04,0x08,
-  0x02,0x02,0x04,0x03,0x01,0x09,0x5F,0x00,0x12,0x00,0x3F,0xE1,0x39,0x3F,0x39,0x3D,
-  0x2F,0x33,0x10,0xE1,0x39,0x01,0x18,0x2F,0x5D,0x33,0x33,0x11,0x33,0x10,0xCE,0x5D,
-  0x32,0x11,0x39,0x2F,0x33,0x31,0x30,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,
-  0x33,0x35,0x01,0x01,0x35,0x21,0x15,0x21,0x01,0x01,0x21,0x15,0x83,0x01,0x9E,0xFE,
-  0x6E,0x03,0x7D,0xFD,0x58,0x01,0x85,0xFE,0x67,0x02,0xF8,0x98,0x02,0x66,0x02,0x25,
-  0x93,0xA4,0xFD,0xEE,0xFD,0xA4,0xA4,0x00,0xFF,0xFF,0x00,0x66,0x00,0x00,0x04,0x64,
-  0x05,0xB6,0x02,0x06,0x00,0x37,0x00,0x00,0xFF,0xFF,0x00,0x21,0x00,0x00,0x04,0xAA,
-  0x05,0xB6,0x02,0x06,0x00,0x3C,0x00,0x00,0x00,0x03,0x00,0x1B,0xFF,0xEC,0x04,0xB4,
-  0x05,0xCB,0x00,0x15,0x00,0x1E,0x00,0x27,0x00,0xB4,0x40,0x59,0x06,0x13,0x16,0x13,
-  0x26,0x13,0x03,0x09,0x0F,0x19,0x0F,0x29,0x0F,0x03,0x09,0x08,0x19,0x08,0x29,0x08,
-  0x03,0x06,0x04,0x16,0x04,0x26,0x04,0x03,0x16,0x02,0x0B,0x5A,0x27,0x15,0xA9,0x0C,
-  0x01,0x9A,0x0C,0x01,0x8B,0x0C,0x01,0x03,0x72,0x0C,0x01,0x05,0x40,0x0C,0x50,0x0C,
-  0x60,0x0C,0x03,0x34,0x0C,0x01,0x06,0x0C,0x0C,0x11,0x1A,0x08,0x0C,0x11,0x48,0x1A,
-  0x5A,0x0F,0x06,0x2F,0x06,0x3F,0x06,0x6F,0x06,0x8F,0x06,0xBF,0x06,0xEF,0x06,0xFF,
-  0x06,0x08,0x06,0x29,0x23,0xB8,0xFF,0xF8,0x40,0x24,0x0C,0x11,0x48,0x23,0x5A,0x11,
-  0x27,0x16,0x60,0x0D,0x50,0x0A,0xE0,0x0A,0xF0,0x0A,0x03,0x0A,0x0A,0x0B,0x13,0x1E,
-  0x1F,0x60,0x02,0x60,0x15,0x70,0x15,0x80,0x15,0x03,0x15,0x15,0x00,0x04,0x00,0x3F,
-  0x32,0x2F,0x5D,0x33,0xE1,0x32,0x3F,0x33,0x2F,0x5D,0x33,0xE1,0x32,0x01,0x2F,0xE1,
-  0x2B,0x10,0xDE,0x5D,0xE1,0x2B,0x12,0x39,0x2F,0x5F,0x5D,0x5D,0x5F,0x5D,0x5F,0x5D,
-  0x5D,0x5D,0x33,0x33,0xE1,0x32,0x32,0x31,0x30,0x00,0x5D,0x5D,0x5D,0x5D,0x01,0x33,
-  0x15,0x33,0x32,0x12,0x15,0x14,0x02,0x23,0x23,0x15,0x23,0x35,0x23,0x22,0x02,0x35,
-  0x34,0x12,0x33,0x33,0x13,0x33,0x32,0x36,0x35,0x34,0x26,0x2B,0x03,0x22,0x06,0x15,
-  0x14,0x16,0x33,0x33,0x02,0x14,0xA6,0x2F,0xD5,0xF6,0xFD,0xE4,0x19,0xA6,0x18,0xE6,
-  0xFB,0xF5,0xD5,0x2F,0xA6,0x07,0x9B,0xAC,0x9E,0x8F,0x21,0xA6,0x20,0x8F,0x9E,0xAC,
-  0x9B,0x06,0x05,0xCB,0xB4,0xFE,0xCB,0xEC,0xEC,0xFE,0xC3,0xE1,0xE1,0x01,0x3E,0xEB,
-  0xEB,0x01,0x36,0xFC,0x53,0xD5,0xBB,0xAC,0xD1,0xD1,0xAC,0xBB,0xD5,0x00,0xFF,0xFF,
-  0x00,0x35,0x00,0x00,0x04,0x96,0x05,0xB6,0x02,0x06,0x00,0x3B,0x00,0x00,0x00,0x01,
-  0x00,0x39,0x00,0x00,0x04,0x96,0x05,0xB6,0x00,0x1B,0x00,0x75,0x40,0x4E,0x15,0x05,
-  0x5A,0x12,0xA9,0x06,0x01,0x06,0x16,0x12,0x49,0x8B,0x06,0x01,0x03,0x72,0x06,0x01,
-  0x05,0x50,0x06,0x60,0x06,0x02,0x34,0x06,0x44,0x06,0x02,0x06,0x06,0x06,0x0B,0x19,
-  0x5A,0x0F,0x00,0x2F,0x00,0x3F,0x00,0x6F,0x00,0x8F,0x00,0x05,0x00,0x1D,0x0E,0x5A,
-  0x90,0x0B,0xA0,0x0B,0xC0,0x0B,0xD0,0x0B,0x04,0x0B,0x15,0x77,0x12,0x87,0x12,0x02,
-  0x12,0x60,0x04,0x07,0x07,0x05,0x1A,0x13,0x0C,0x03,0x05,0x12,0x00,0x3F,0x3F,0x33,
-  0x33,0x12,0x39,0x2F,0x33,0xE1,0x5D,0x32,0x01,0x2F,0x5D,0xE1,0x10,0xDE,0x5D,0xE1,
-  0x11,0x39,0x2F,0x5F,0x5D,0x5D,0x5F,0x5D,0x5F,0x5D,0x2B,0x5D,0x33,0xE1,0x32,0x31,
-  0x30,0x01,0x10,0x06,0x23,0x23,0x11,0x23,0x11,0x23,0x22,0x26,0x11,0x11,0x33,0x11,
-  0x14,0x16,0x33,0x33,0x11,0x33,0x11,0x33,0x32,0x36,0x35,0x11,0x33,0x04,0x96,0xE8,
-  0xE3,0x11,0xA6,0x10,0xE6,0xE5,0xAC,0x8A,0x95,0x10,0xA6,0x11,0x95,0x89,0xAD,0x03,
-  0xD7,0xFE,0xE1,0xFA,0xFE,0x42,0x01,0xBE,0xFB,0x01,0x1A,0x01,0xE3,0xFE,0x21,0xE7,
-  0x94,0x03,0x5A,0xFC,0xA6,0x90,0xE7,0x01,0xE3,0x00,0x00,0x01,0x00,0x4A,0x00,0x00,
-  0x04,0x87,0x05,0xCD,0x00,0x19,0x00,0x77,0xB9,0x00,0x0E,0xFF,0xE8,0x40,0x4E,0x0A,
-  0x14,0x48,0x0E,0xC0,0x12,0xD0,0x12,0x02,0x4F,0x12,0x5F,0x12,0x7F,0x12,0x8F,0x12,
-  0xBF,0x12,0x05,0x09,0x12,0x19,0x12,0x02,0x12,0x04,0x18,0x0A,0x14,0x48,0x04,0x40,
-  0x00,0x50,0x00,0x02,0x03,0x00,0x13,0x00,0x02,0x00,0x00,0x06,0x58,0x14,0x01,0x14,
-  0x5B,0x0F,0x0C,0x1B,0x57,0x18,0x01,0x18,0x5B,0x03,0x1F,0x06,0x2F,0x06,0x02,0x06,
-  0x16,0x5F,0x09,0x04,0x00,0x0E,0x12,0x03,0x03,0x5F,0x11,0x02,0x12,0x00,0x3F,0x33,
-  0xE1,0x17,0x32,0x3F,0xE1,0x01,0x2F,0x5D,0x33,0xE1,0x5D,0x10,0xDE,0x32,0xE1,0x5D,
-  0x12,0x39,0x2F,0x5D,0x5D,0x33,0x2B,0xC6,0x5D,0x5D,0x5D,0x32,0x2B,0x31,0x30,0x25,
-  0x15,0x21,0x35,0x21,0x26,0x11,0x10,0x00,0x33,0x32,0x00,0x11,0x10,0x05,0x21,0x15,
-  0x21,0x35,0x24,0x11,0x10,0x21,0x20,0x11,0x10,0x02,0x1D,0xFE,0x2D,0x01,0x0A,0xFE,
-  0x01,0x18,0xFA,0xFA,0x01,0x19,0xFF,0x00,0x01,0x0C,0xFE,0x2B,0x01,0x04,0xFE,0xB0,
-  0xFE,0xB1,0x93,0x93,0xA4,0xEB,0x01,0xAA,0x01,0x38,0x01,0x5C,0xFE,0xA4,0xFE,0xC8,
-  0xFE,0x53,0xE8,0xA4,0x93,0xE7,0x01,0xBB,0x01,0xF4,0xFE,0x0C,0xFE,0x45,0xFF,0xFF,
-  0x00,0xE1,0x00,0x00,0x03,0xE9,0x07,0x2B,0x02,0x26,0x00,0x2C,0x00,0x00,0x01,0x07,
-  0x00,0x6A,0x00,0x02,0x01,0x52,0x00,0x17,0x40,0x0D,0x02,0x01,0x10,0x05,0x26,0x02,
-  0x01,0x02,0x12,0x16,0x01,0x00,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,
-  0xFF,0xFF,0x00,0x21,0x00,0x00,0x04,0xAA,0x07,0x2B,0x02,0x26,0x00,0x3C,0x00,0x00,
-  0x01,0x07,0x00,0x6A,0x00,0x02,0x01,0x52,0x00,0x17,0x40,0x0D,0x02,0x01,0x0D,0x05,
-  0x26,0x02,0x01,0x02,0x0F,0x13,0x07,0x02,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,
-  0x35,0x00,0xFF,0xFF,0x00,0x79,0xFF,0xEC,0x04,0x9A,0x06,0x21,0x02,0x26,0x01,0x7E,
-  0x00,0x00,0x01,0x06,0x01,0x54,0x10,0x00,0x00,0x15,0xB4,0x02,0x2E,0x11,0x26,0x02,
-  0xB8,0xFF,0xEC,0xB4,0x26,0x2A,0x16,0x0B,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,
-  0xFF,0xFF,0x00,0xC9,0xFF,0xEC,0x04,0x08,0x06,0x21,0x02,0x26,0x01,0x82,0x00,0x00,
-  0x01,0x06,0x01,0x54,0x60,0x00,0x00,0x13,0x40,0x0B,0x01,0x28,0x11,0x26,0x01,0x5D,
-  0x20,0x24,0x0E,0x18,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xA0,
-  0xFE,0x14,0x04,0x2D,0x06,0x21,0x02,0x26,0x01,0x84,0x00,0x00,0x01,0x06,0x01,0x54,
-  0x50,0x00,0x00,0x13,0x40,0x0B,0x01,0x19,0x11,0x26,0x01,0x4F,0x11,0x15,0x07,0x0F,
-  0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x01,0xAC,0xFF,0xEC,0x03,0xF8,
-  0x06,0x21,0x02,0x26,0x01,0x86,0x00,0x00,0x01,0x06,0x01,0x54,0xF7,0x00,0x00,0x13,
-  0x40,0x0B,0x01,0x14,0x11,0x26,0x01,0x2A,0x0C,0x0C,0x0B,0x0B,0x25,0x01,0x2B,0x35,
-  0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xA0,0xFF,0xEC,0x04,0x3B,0x06,0xB4,0x02,0x26,
-  0x01,0x92,0x00,0x00,0x01,0x06,0x01,0x55,0xFD,0x00,0x00,0x19,0xB5,0x03,0x02,0x01,
-  0x03,0x02,0x01,0xB8,0xFF,0xF5,0xB4,0x21,0x25,0x00,0x0C,0x25,0x01,0x2B,0x35,0x35,
-  0x35,0x00,0x35,0x35,0x35,0x00,0x00,0x02,0x00,0x79,0xFF,0xEC,0x04,0x9A,0x04,0x5E,
-  0x00,0x1A,0x00,0x25,0x00,0x3D,0x40,0x22,0x10,0x00,0x1C,0x47,0x0B,0x7F,0x07,0x8F,
-  0x07,0x02,0x07,0x27,0x21,0x48,0x00,0x16,0x01,0x16,0x10,0x09,0x23,0x50,0x0B,0x0E,
-  0x0E,0x13,0x16,0x00,0x1F,0x50,0x19,0x10,0x03,0x0F,0x00,0x3F,0x3F,0xE1,0x32,0x3F,
-  0x33,0x11,0x33,0xE1,0x32,0x32,0x01,0x2F,0x5D,0xE1,0x10,0xDC,0x5D,0x32,0xE1,0x32,
-  0x32,0x31,0x30,0x01,0x33,0x36,0x37,0x33,0x06,0x11,0x11,0x14,0x33,0x32,0x37,0x15,
-  0x06,0x23,0x22,0x27,0x23,0x06,0x23,0x22,0x02,0x11,0x10,0x12,0x33,0x32,0x13,0x35,
-  0x34,0x26,0x23,0x20,0x11,0x10,0x21,0x32,0x36,0x03,0x5E,0x0C,0x1E,0x26,0x8F,0x33,
-  0x54,0x1D,0x1F,0x34,0x3F,0x9F,0x28,0x0C,0x6C,0xCD,0xC3,0xDF,0xE6,0xCE,0xD2,0x55,
-  0x86,0x93,0xFE,0xFA,0x01,0x08,0x94,0x7F,0x03,0xB6,0x67,0x2D,0xA6,0xFE,0xEF,0xFE,
-  0x5D,0x6F,0x0A,0x85,0x1A,0xA7,0xA7,0x01,0x29,0x01,0x0E,0x01,0x11,0x01,0x2A,0xFD,
-  0xB6,0x0F,0xE3,0xC1,0xFE,0x5A,0xFE,0x62,0xB8,0x00,0x00,0x02,0x00,0x9E,0xFE,0x14,
-  0x04,0x50,0x06,0x1F,0x00,0x13,0x00,0x26,0x00,0x51,0x40,0x2E,0x2A,0x1F,0x01,0x00,
-  0x11,0x0F,0x1D,0x01,0x1D,0x1D,0x09,0x21,0x48,0x11,0x11,0x18,0x47,0x03,0x28,0x14,
-  0x09,0x47,0x00,0x0A,0xB0,0x0A,0x02,0x0A,0x00,0x1C,0x50,0x1D,0x1D,0x06,0x0E,0x09,
-  0x1B,0x16,0x50,0x14,0x06,0x16,0x24,0x50,0x0E,0x01,0x00,0x3F,0xE1,0x3F,0x33,0xE1,
-  0x3F,0x11,0x12,0x39,0x2F,0xE1,0x39,0x01,0x2F,0x5D,0xE1,0x32,0x10,0xDE,0xE1,0x33,
-  0x2F,0xE1,0x12,0x39,0x2F,0x5D,0x12,0x39,0x31,0x30,0x5D,0x01,0x15,0x04,0x11,0x14,
-  0x06,0x23,0x22,0x27,0x11,0x23,0x11,0x34,0x36,0x33,0x32,0x16,0x15,0x14,0x06,0x01,
-  0x16,0x33,0x20,0x11,0x34,0x26,0x23,0x23,0x35,0x33,0x32,0x36,0x35,0x34,0x26,0x23,
-  0x20,0x11,0x02,0xD3,0x01,0x7D,0xF5,0xD8,0xBA,0x75,0xB6,0xEE,0xD0,0xC6,0xEC,0xA1,
-  0xFD,0xE7,0x87,0x9A,0x01,0x25,0xBE,0x9F,0x5E,0x46,0x8E,0xA1,0x86,0x72,0xFE,0xF8,
-  0x03,0x3D,0x06,0x30,0xFE,0x97,0xCD,0xE5,0x3F,0xFD,0xE9,0x06,0x34,0xE2,0xF5,0xD2,
-  0xB7,0x88,0xB6,0xFD,0x79,0x50,0x01,0x2B,0x92,0xA5,0x98,0x96,0x7E,0x76,0x84,0xFE,
-  0xB6,0x00,0x00,0x01,0x00,0x52,0xFE,0x14,0x04,0x79,0x04,0x4A,0x00,0x0F,0x00,0x6B,
-  0x40,0x25,0x02,0x48,0x03,0x05,0x00,0x03,0x44,0x0A,0x54,0x0A,0x74,0x0A,0x84,0x0A,
-  0xB4,0x0A,0x05,0x0A,0x0A,0x06,0x0E,0x08,0x09,0x0C,0x48,0x0E,0x10,0x0F,0x20,0x0F,
-  0x30,0x0F,0x03,0x0F,0x0F,0x11,0x07,0xB8,0xFF,0xF8,0x40,0x10,0x09,0x0C,0x48,0x07,
-  0x2F,0x06,0x3F,0x06,0x02,0x06,0x06,0x10,0x0E,0x06,0x0F,0x0A,0xB8,0xFF,0xF0,0x40,
-  0x09,0x09,0x0C,0x48,0x0A,0x00,0x05,0x15,0x02,0x1B,0x00,0x3F,0x3F,0x33,0x33,0x2B,
-  0x3F,0x33,0x11,0x01,0x33,0x2F,0x5D,0x33,0x2B,0x11,0x33,0x2F,0x5D,0x33,0x2B,0x12,
-  0x39,0x19,0x2F,0x5D,0x39,0x33,0x33,0x10,0xE1,0x31,0x30,0x25,0x02,0x11,0x23,0x34,
-  0x13,0x01,0x33,0x13,0x16,0x17,0x33,0x36,0x37,0x13,0x33,0x02,0xE3,0x6E,0xBF,0x65,
-  0xFE,0x37,0xC0,0xF2,0x47,0x24,0x06,0x1A,0x48,0xE5,0xBD,0x3F,0xFE,0xE8,0xFE,0xED,
-  0xCF,0x01,0x29,0x04,0x3E,0xFD,0xB0,0xAE,0x92,0x68,0xBF,0x02,0x69,0x00,0x00,0x02,
-  0x00,0x87,0xFF,0xEC,0x04,0x46,0x06,0x1F,0x00,0x19,0x00,0x22,0x00,0x4F,0x40,0x31,
-  0x2B,0x00,0x01,0x09,0x00,0x19,0x00,0x02,0x0D,0x46,0x00,0x1A,0x02,0x02,0x18,0x21,
-  0x48,0x07,0xEF,0x12,0xFF,0x12,0x02,0x12,0x24,0x1C,0x48,0x00,0x18,0xE0,0x18,0xF0,
-  0x18,0x03,0x18,0x10,0x00,0x1A,0x03,0x05,0x1F,0x50,0x15,0x16,0x0A,0x50,0x08,0x05,
-  0x01,0x00,0x3F,0x33,0xE1,0x3F,0xE1,0x11,0x17,0x39,0x01,0x2F,0x5D,0xE1,0x10,0xDE,
-  0x5D,0x32,0xE1,0x11,0x39,0x2F,0x39,0x39,0xE1,0x31,0x30,0x5D,0x5D,0x01,0x26,0x35,
-  0x34,0x36,0x33,0x32,0x17,0x07,0x26,0x23,0x22,0x06,0x15,0x14,0x16,0x17,0x04,0x11,
-  0x14,0x00,0x23,0x22,0x24,0x35,0x10,0x25,0x04,0x11,0x14,0x16,0x33,0x20,0x11,0x34,
-  0x02,0x2D,0xFE,0xB6,0xA0,0xC7,0xC2,0x49,0xA9,0x9F,0x4A,0x56,0x54,0xAC,0x01,0x69,
-  0xFE,0xFD,0xE1,0xD5,0xFE,0xFA,0x02,0x25,0xFE,0x9C,0x98,0x82,0x01,0x27,0x03,0xAA,
-  0x91,0xCB,0x85,0x94,0x6D,0x91,0x6A,0x49,0x40,0x3F,0x67,0x64,0xCE,0xFE,0xC8,0xF6,
-  0xFE,0xF0,0xF7,0xD3,0x01,0x74,0x2C,0x64,0xFE,0xC0,0x87,0xA8,0x01,0x5E,0xF4,0x00,
-  0x00,0x01,0x00,0xC9,0xFF,0xEC,0x04,0x08,0x04,0x5E,0x00,0x1F,0x00,0x51,0x40,0x2F,
-  0x11,0x13,0x00,0x00,0x0E,0x18,0x7F,0x09,0x8F,0x09,0x02,0x09,0x21,0x1D,0x47,0x13,
-  0x13,0x04,0x47,0x00,0x0E,0x01,0x0E,0x11,0x02,0x50,0xBF,0x1F,0x01,0x79,0x1F,0x89,
-  0x1F,0x02,0x1F,0x1F,0x06,0x1B,0x50,0x19,0x16,0x10,0x06,0x50,0x08,0x0B,0x16,0x00,
-  0x3F,0x33,0xE1,0x3F,0x33,0xE1,0x12,0x39,0x2F,0x5D,0x5D,0xE1,0x39,0x01,0x2F,0x5D,
-  0xE1,0x33,0x2F,0xE1,0x10,0xCE,0x5D,0x32,0x11,0x39,0x2F,0x12,0x39,0x31,0x30,0x01,
-  0x15,0x23,0x20,0x15,0x14,0x21,0x32,0x37,0x15,0x06,0x23,0x22,0x26,0x35,0x34,0x37,
-  0x35,0x26,0x35,0x34,0x36,0x33,0x32,0x17,0x07,0x26,0x23,0x22,0x15,0x14,0x21,0x03,
-  0x48,0xA0,0xFE,0xD3,0x01,0x1B,0xC4,0xAA,0x86,0xF3,0xD3,0xEF,0xED,0xCA,0xE0,0xBD,
-  0xD8,0xA7,0x3F,0xA1,0x9B,0xF3,0x01,0x14,0x02,0x87,0x99,0xB9,0xB4,0x56,0xA0,0x4B,
-  0xA8,0x97,0xC1,0x4B,0x0B,0x42,0xB7,0x87,0x9C,0x4C,0x93,0x48,0x9A,0xA6,0x00,0x01,
-  0x00,0xA2,0xFE,0x6F,0x04,0x2B,0x06,0x14,0x00,0x1C,0x00,0x89,0x40,0x57,0x0A,0x14,
-  0x1A,0x14,0x2A,0x14,0x03,0x06,0x09,0x16,0x09,0x26,0x09,0x03,0x0B,0x19,0x1B,0x19,
-  0x2B,0x19,0x03,0x19,0x02,0x02,0x10,0x10,0x09,0x0E,0x48,0x10,0x46,0x0E,0x90,0x0B,
-  0x01,0x0B,0x1E,0x1C,0x05,0x48,0x00,0x16,0xA0,0x16,0x02,0x16,0x99,0x13,0x01,0x7B,
-  0x13,0x8B,0x13,0x02,0x6D,0x13,0x01,0x49,0x13,0x01,0x3B,0x13,0x01,0x2D,0x13,0x01,
-  0x79,0x08,0x89,0x08,0x02,0x6B,0x08,0x01,0x49,0x08,0x01,0x3B,0x08,0x01,0x2D,0x08,
-  0x01,0x13,0x08,0x00,0x0D,0xB8,0x01,0x06,0xB4,0x02,0x1C,0x50,0x00,0x00,0x00,0x3F,
-  0xE1,0x32,0x3F,0x12,0x39,0x39,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,
-  0x5D,0x01,0x2F,0x5D,0xE1,0x33,0x10,0xDE,0x5D,0x32,0xE1,0x2B,0x33,0x2F,0x33,0x5D,
-  0x31,0x30,0x00,0x5D,0x5D,0x13,0x21,0x15,0x00,0x00,0x11,0x14,0x16,0x17,0x16,0x16,
-  0x15,0x14,0x07,0x23,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x35,0x10,0x00,0x25,0x06,
-  0x23,0x21,0xDF,0x03,0x46,0xFE,0x74,0xFE,0xC5,0xA6,0xE5,0xAB,0x97,0x79,0xAA,0x79,
-  0x67,0xC2,0xE5,0xD1,0x01,0x42,0x01,0x78,0xD7,0x89,0xFE,0xE3,0x06,0x14,0x8D,0xFE,
-  0xE0,0xFE,0x76,0xFF,0x00,0x99,0x81,0x27,0x1E,0x65,0x6F,0x95,0xA6,0xA2,0x62,0x39,
-  0x41,0x1D,0x23,0xDF,0xC9,0x01,0x01,0x01,0xBA,0xF7,0x0C,0x00,0x00,0x01,0x00,0xA0,
-  0xFE,0x14,0x04,0x2D,0x04,0x5E,0x00,0x10,0x00,0x31,0x40,0x1D,0x00,0x47,0x90,0x10,
-  0xA0,0x10,0x02,0x10,0x12,0x0B,0x06,0x47,0x00,0x07,0xB0,0x07,0x02,0x07,0x0B,0x03,
-  0x50,0x0D,0x10,0x08,0x0F,0x07,0x15,0x00,0x1B,0x00,0x3F,0x3F,0x3F,0x3F,0xE1,0x32,
-  0x01,0x2F,0x5D,0xE1,0x32,0x10,0xDE,0x5D,0xE1,0x31,0x30,0x01,0x11,0x10,0x23,0x20,
-  0x11,0x11,0x23,0x11,0x33,0x17,0x33,0x36,0x33,0x20,0x11,0x11,0x03,0x77,0xEE,0xFE,
-  0xCD,0xB6,0x93,0x1B,0x0A,0x66,0xEA,0x01,0x85,0xFE,0x14,0x04,0xAF,0x01,0x04,0xFE,
-  0x72,0xFD,0xC7,0x04,0x4A,0x94,0xA8,0xFE,0x6F,0xFB,0x47,0x00,0x00,0x03,0x00,0x93,
-  0xFF,0xEC,0x04,0x39,0x05,0xC3,0x00,0x0A,0x00,0x11,0x00,0x18,0x00,0x4F,0x40,0x32,
-  0x0C,0x3B,0x12,0x01,0x06,0x28,0x12,0x01,0x12,0x48,0x09,0x1A,0x0B,0x27,0x13,0x37,
-  0x13,0x02,0x13,0x47,0x00,0x03,0x01,0x03,0x13,0x4F,0xCA,0x0B,0xEA,0x0B,0x02,0x98,
-  0x0B,0x01,0x2F,0x0B,0xFF,0x0B,0x02,0x0B,0x0B,0x16,0x0F,0x50,0x06,0x04,0x16,0x50,
-  0x00,0x16,0x00,0x3F,0xE1,0x3F,0xE1,0x12,0x39,0x2F,0x5D,0x5D,0x5D,0xE1,0x01,0x2F,
-  0x5D,0xE1,0x5D,0x32,0x10,0xDE,0xE1,0x5D,0x5F,0x5D,0x32,0x31,0x30,0x05,0x22,0x02,
-  0x11,0x10,0x12,0x33,0x32,0x12,0x11,0x10,0x01,0x21,0x02,0x02,0x23,0x22,0x06,0x01,
-  0x21,0x12,0x12,0x33,0x32,0x12,0x02,0x64,0xE5,0xEC,0xE4,0xED,0xE7,0xEE,0xFD,0x13,
-  0x02,0x33,0x07,0x85,0x8F,0x8B,0x85,0x02,0x2B,0xFD,0xCD,0x06,0x84,0x8E,0x8E,0x87,
-  0x14,0x01,0x7F,0x01,0x6E,0x01,0x7C,0x01,0x6E,0xFE,0x83,0xFE,0x93,0xFD,0x13,0x03,
-  0x3B,0x01,0x04,0x01,0x00,0xFA,0xFE,0x6D,0xFE,0xEA,0xFE,0xFB,0x01,0x00,0x00,0x01,
-  0x01,0xAC,0xFF,0xEC,0x03,0xF8,0x04,0x4A,0x00,0x0B,0x00,0x26,0x40,0x14,0x01,0x47,
-  0x00,0x0A,0x01,0x0A,0x0A,0x0C,0x6F,0x05,0x01,0x05,0x0D,0x05,0x03,0x50,0x08,0x16,
-  0x00,0x0F,0x00,0x3F,0x3F,0xE1,0x33,0x01,0x10,0xCE,0x5D,0x12,0x39,0x2F,0x5D,0xE1,
-  0x31,0x30,0x01,0x11,0x14,0x33,0x32,0x37,0x15,0x06,0x23,0x20,0x11,0x11,0x02,0x62,
-  0xC1,0x70,0x65,0x5D,0x84,0xFE,0x95,0x04,0x4A,0xFC,0xFA,0xC3,0x15,0x8A,0x20,0x01,
-  0x58,0x03,0x06,0x00,0xFF,0xFF,0x00,0xD7,0x00,0x00,0x04,0x8B,0x04,0x4A,0x02,0x06,
-  0x00,0xFA,0x00,0x00,0x00,0x01,0x00,0x3D,0xFF,0xEC,0x04,0xA0,0x06,0x21,0x00,0x1F,
-  0x00,0x55,0x40,0x33,0x0D,0x01,0x1B,0x18,0x0E,0x1B,0x0E,0x00,0x12,0x14,0x12,0x24,
-  0x12,0x02,0x06,0x12,0x01,0x12,0x21,0x1F,0x07,0x00,0x20,0x0D,0x10,0x48,0x2F,0x00,
-  0x3F,0x00,0x02,0x00,0x1F,0x15,0x48,0x1B,0x01,0x1B,0x01,0x0D,0x03,0x0A,0x10,0x50,
-  0x12,0x15,0x16,0x05,0x50,0x0A,0x01,0x00,0x3F,0xE1,0x3F,0x33,0xE1,0x11,0x17,0x39,
-  0x5D,0x3F,0x01,0x2F,0x5D,0x2B,0x33,0x33,0x11,0x33,0x5D,0x5D,0x11,0x12,0x39,0x39,
-  0x11,0x33,0x11,0x33,0x33,0x31,0x30,0x33,0x01,0x27,0x26,0x26,0x23,0x22,0x07,0x35,
-  0x36,0x33,0x32,0x16,0x17,0x01,0x16,0x33,0x32,0x37,0x15,0x06,0x23,0x22,0x26,0x27,
-  0x03,0x26,0x27,0x23,0x06,0x07,0x01,0x3D,0x01,0xF8,0x35,0x22,0x56,0x49,0x38,0x30,
-  0x41,0x3E,0x8E,0x8E,0x46,0x01,0x46,0x25,0x41,0x1D,0x1F,0x32,0x41,0x52,0x57,0x1C,
-  0x87,0x45,0x19,0x06,0x24,0x53,0xFE,0xF4,0x04,0x3B,0xA0,0x68,0x48,0x0C,0x91,0x11,
-  0x87,0xD3,0xFC,0x29,0x6F,0x0A,0x85,0x1A,0x50,0x57,0x01,0xA2,0xD6,0x7A,0x8A,0xB7,
-  0xFD,0xBC,0x00,0x01,0x00,0xA0,0xFE,0x14,0x04,0x2D,0x04,0x4A,0x00,0x15,0x00,0x3A,
-  0x40,0x23,0x0A,0x05,0x47,0x90,0x08,0xA0,0x08,0x02,0x08,0x17,0x00,0x12,0x47,0x00,
-  0x13,0xB0,0x13,0x02,0x13,0x12,0x1B,0x00,0x05,0x0A,0x0F,0x04,0x02,0x50,0x0D,0x16,
-  0x09,0x15,0x14,0x06,0x0F,0x00,0x3F,0x33,0x3F,0x3F,0xE1,0x17,0x32,0x3F,0x01,0x2F,
-  0x5D,0xE1,0x32,0x10,0xDE,0x5D,0xE1,0x32,0x31,0x30,0x01,0x10,0x33,0x32,0x36,0x35,
-  0x11,0x33,0x11,0x23,0x27,0x23,0x06,0x23,0x22,0x27,0x16,0x15,0x11,0x23,0x11,0x33,
-  0x01,0x56,0xEE,0xA0,0x93,0xB6,0x93,0x1B,0x0A,0x61,0xCC,0xAD,0x4B,0x06,0xB6,0xB6,
-  0x01,0x87,0xFE,0xFC,0xBA,0xD3,0x02,0x3A,0xFB,0xB6,0x93,0xA7,0x58,0x99,0x57,0xFE,
-  0xC0,0x06,0x36,0x00,0x00,0x01,0x00,0x3D,0x00,0x00,0x04,0x4A,0x04,0x4A,0x00,0x0D,
-  0x00,0x74,0x40,0x46,0x0D,0x10,0x0A,0x10,0x48,0x08,0x0D,0x01,0x35,0x0C,0x45,0x0C,
-  0x55,0x0C,0x03,0x24,0x0C,0x01,0x15,0x0C,0x01,0x19,0x06,0x29,0x06,0x39,0x06,0x03,
-  0x0D,0x95,0x0C,0xA5,0x0C,0x02,0x86,0x0C,0x01,0x63,0x0C,0x73,0x0C,0x02,0x05,0x0C,
-  0x01,0x0C,0x14,0x04,0x44,0x04,0x74,0x04,0x03,0x04,0x04,0x00,0x08,0x47,0x09,0x0F,
-  0x07,0x01,0x01,0x01,0x00,0x40,0x0A,0x10,0x48,0x00,0xB8,0xFF,0xF0,0xB6,0x00,0x04,
-  0x0D,0x15,0x08,0x00,0x0F,0x00,0x3F,0x32,0x3F,0x33,0x01,0x2F,0x38,0x2B,0x32,0x5D,
-  0x10,0xDE,0xE1,0x12,0x39,0x3D,0x2F,0x5D,0x33,0x5D,0x5D,0x5D,0x5D,0x33,0x31,0x30,
-  0x5D,0x5D,0x5D,0x5D,0x5D,0x2B,0x13,0x33,0x13,0x12,0x17,0x33,0x36,0x12,0x11,0x33,
-  0x10,0x02,0x07,0x23,0x3D,0xBD,0xDF,0x6E,0x0B,0x06,0x9D,0x9E,0xB7,0xC9,0xE1,0xBB,
-  0x04,0x4A,0xFD,0xB6,0xFE,0xDF,0x45,0xA4,0x01,0x9A,0x01,0x72,0xFE,0x93,0xFE,0x16,
-  0xF3,0x00,0x00,0x01,0x00,0xAC,0xFE,0x6F,0x04,0x2B,0x06,0x14,0x00,0x2C,0x00,0x97,
-  0x40,0x5F,0x29,0x46,0x22,0x1A,0x1F,0x00,0x9F,0x24,0x01,0x5F,0x1C,0x01,0x9F,0x00,
-  0x01,0x1C,0x00,0x24,0x24,0x00,0x1C,0x03,0x16,0x11,0x46,0x90,0x0C,0x01,0x0C,0x2E,
-  0x05,0x48,0x00,0x16,0x01,0x16,0x7B,0x14,0x01,0x6D,0x14,0x01,0x49,0x14,0x01,0x3B,
-  0x14,0x01,0x2D,0x14,0x01,0x08,0x14,0x18,0x14,0x02,0x14,0x08,0x15,0x18,0x48,0x79,
-  0x09,0x01,0x6B,0x09,0x01,0x49,0x09,0x01,0x3B,0x09,0x01,0x2D,0x09,0x01,0x14,0x09,
-  0x0E,0x23,0x1A,0x02,0x4F,0x2F,0x2C,0x01,0x2C,0x2C,0x0E,0x25,0x22,0x50,0x23,0x00,
-  0x0E,0xB8,0x01,0x06,0x00,0x3F,0x3F,0xE1,0x32,0x12,0x39,0x2F,0x5D,0xE1,0x39,0x11,
-  0x12,0x39,0x39,0x5D,0x5D,0x5D,0x5D,0x5D,0x2B,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x01,
-  0x2F,0x5D,0xE1,0x10,0xDE,0x5D,0xE1,0x12,0x17,0x39,0x2F,0x2F,0x2F,0x5D,0x5D,0x5D,
-  0x12,0x39,0x39,0x33,0xE1,0x31,0x30,0x01,0x15,0x23,0x22,0x06,0x15,0x14,0x16,0x16,
-  0x17,0x16,0x16,0x15,0x14,0x07,0x23,0x36,0x35,0x34,0x26,0x27,0x24,0x11,0x34,0x36,
-  0x37,0x35,0x26,0x35,0x34,0x36,0x37,0x06,0x23,0x23,0x35,0x21,0x15,0x23,0x22,0x04,
-  0x15,0x14,0x16,0x33,0x03,0xD9,0xC9,0xCF,0xD9,0x4C,0x8B,0xB3,0xA2,0x97,0x79,0xAA,
-  0x79,0x63,0xBC,0xFE,0x4A,0x97,0x84,0xD7,0x96,0xB9,0xB0,0x68,0x3E,0x02,0xFC,0x45,
-  0xD9,0xFE,0xD9,0xB7,0xC4,0x03,0x77,0x89,0xA3,0x95,0x5B,0x69,0x38,0x20,0x1D,0x64,
-  0x6F,0x95,0xA6,0xA2,0x64,0x35,0x41,0x1D,0x44,0x01,0x5A,0x86,0xD3,0x2A,0x0C,0x3B,
-  0xDC,0x72,0x96,0x33,0x0C,0x99,0x99,0xA0,0x8B,0x71,0x68,0x00,0xFF,0xFF,0x00,0x73,
-  0xFF,0xEC,0x04,0x58,0x04,0x5E,0x02,0x06,0x00,0x52,0x00,0x00,0x00,0x01,0x00,0x0E,
-  0xFF,0xEC,0x04,0xBE,0x04,0x4A,0x00,0x14,0x00,0x79,0x40,0x35,0x4B,0x0B,0x5B,0x0B,
-  0x6B,0x0B,0x03,0x3A,0x0B,0x01,0x28,0x0B,0x01,0x0B,0x0B,0x01,0x0B,0x08,0x47,0x09,
-  0x54,0x0F,0x01,0x45,0x0F,0x01,0x36,0x0F,0x01,0x27,0x0F,0x01,0x04,0x0F,0x14,0x0F,
-  0x02,0x0F,0x00,0x00,0x05,0x47,0x11,0x00,0x09,0x40,0x09,0x50,0x09,0x60,0x09,0x04,
-  0x11,0xB8,0xFF,0xC0,0x40,0x17,0x12,0x16,0x48,0x09,0x11,0x09,0x11,0x15,0x16,0x0C,
-  0x10,0x07,0x0A,0x50,0x0D,0x0F,0x09,0x15,0x13,0x50,0x00,0x03,0x16,0x00,0x3F,0x33,
-  0xE1,0x3F,0x3F,0xE1,0x32,0x32,0x39,0x11,0x12,0x01,0x39,0x39,0x2F,0x2F,0x2B,0x5D,
-  0x10,0xE1,0x33,0x11,0x33,0x5D,0x5D,0x5D,0x5D,0x5D,0x10,0xE1,0x33,0x5D,0x5D,0x5D,
-  0x5D,0x31,0x30,0x25,0x15,0x06,0x23,0x22,0x11,0x11,0x21,0x11,0x23,0x11,0x23,0x35,
-  0x37,0x21,0x15,0x23,0x11,0x14,0x33,0x32,0x04,0xA0,0x34,0x55,0xE2,0xFE,0x6D,0xB6,
-  0xDE,0x8A,0x04,0x26,0xD2,0x5A,0x2E,0x96,0x90,0x1A,0x01,0x06,0x02,0xBE,0xFC,0x50,
-  0x03,0xB0,0x4A,0x50,0x9A,0xFD,0x4E,0x7D,0x00,0x02,0x00,0x9E,0xFE,0x14,0x04,0x3B,
-  0x04,0x5E,0x00,0x10,0x00,0x1B,0x00,0x35,0x40,0x1F,0x16,0x48,0x0C,0x40,0x15,0x18,
-  0x48,0x0C,0x1D,0x11,0x01,0x04,0x47,0x00,0x05,0xB0,0x05,0x02,0x05,0x11,0x00,0x13,
-  0x50,0x0F,0x16,0x19,0x50,0x09,0x10,0x04,0x1B,0x00,0x3F,0x3F,0xE1,0x3F,0xE1,0x32,
-  0x32,0x01,0x2F,0x5D,0xE1,0x32,0x32,0x10,0xDE,0x2B,0xE1,0x31,0x30,0x25,0x23,0x16,
-  0x15,0x11,0x23,0x11,0x10,0x12,0x33,0x32,0x12,0x11,0x10,0x02,0x23,0x22,0x27,0x16,
-  0x33,0x32,0x36,0x35,0x34,0x26,0x23,0x20,0x11,0x01,0x54,0x06,0x06,0xB6,0xFD,0xDA,
-  0xCE,0xF8,0xF7,0xD7,0xA8,0x71,0x70,0xAB,0x90,0x80,0x82,0x90,0xFE,0xE7,0x46,0xAE,
-  0x61,0xFE,0xDD,0x04,0x13,0x01,0x07,0x01,0x30,0xFE,0xCD,0xFE,0xFC,0xFE,0xF2,0xFE,
-  0xD3,0xFB,0x64,0xD3,0xD1,0xD1,0xCF,0xFE,0x74,0x00,0x00,0x01,0x00,0xAC,0xFE,0x6F,
-  0x04,0x29,0x04,0x5E,0x00,0x17,0x00,0x67,0x40,0x42,0x0C,0x03,0x46,0x01,0x90,0x16,
-  0x01,0x16,0x19,0x11,0x48,0x00,0x08,0x01,0x08,0x99,0x06,0x01,0x7B,0x06,0x8B,0x06,
-  0x02,0x6D,0x06,0x01,0x49,0x06,0x01,0x3B,0x06,0x01,0x2C,0x06,0x01,0x08,0x06,0x18,
-  0x06,0x02,0x79,0x14,0x89,0x14,0x02,0x6B,0x14,0x01,0x49,0x14,0x01,0x3B,0x14,0x01,
-  0x2C,0x14,0x01,0x06,0x14,0x00,0x0F,0x51,0x0D,0x0A,0x10,0x00,0xB8,0x01,0x06,0x00,
-  0x3F,0x3F,0x33,0xE1,0x12,0x39,0x39,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,
-  0x5D,0x5D,0x5D,0x01,0x2F,0x5D,0xE1,0x10,0xDE,0x5D,0x32,0xE1,0x33,0x31,0x30,0x01,
-  0x23,0x36,0x35,0x34,0x26,0x27,0x24,0x11,0x10,0x21,0x32,0x17,0x07,0x26,0x23,0x20,
-  0x11,0x14,0x16,0x17,0x04,0x15,0x14,0x03,0xAC,0xA6,0x79,0x84,0xA3,0xFE,0x54,0x02,
-  0x37,0xA4,0x9E,0x3E,0x9E,0x72,0xFE,0x91,0x9B,0xC0,0x01,0x66,0xFE,0x6F,0xA3,0x63,
-  0x3C,0x3B,0x1C,0x47,0x01,0xB5,0x02,0x5A,0x3B,0x9E,0x39,0xFE,0x48,0xBB,0x86,0x23,
-  0x42,0xBA,0x8D,0x00,0x00,0x02,0x00,0x81,0xFF,0xEC,0x04,0x96,0x04,0x4A,0x00,0x0C,
-  0x00,0x18,0x00,0x32,0x40,0x1E,0x02,0x17,0x48,0x01,0xDF,0x04,0xEF,0x04,0xFF,0x04,
-  0x03,0x04,0x1A,0x11,0x48,0x00,0x0A,0xF0,0x0A,0x02,0x0A,0x02,0x0E,0x50,0x0C,0x0F,
-  0x14,0x50,0x07,0x16,0x00,0x3F,0xE1,0x3F,0xE1,0x32,0x01,0x2F,0x5D,0xE1,0x10,0xDE,
-  0x5D,0x32,0xE1,0x39,0x31,0x30,0x01,0x15,0x21,0x16,0x15,0x14,0x00,0x23,0x22,0x02,
-  0x11,0x10,0x21,0x17,0x23,0x22,0x06,0x15,0x14,0x16,0x33,0x32,0x36,0x35,0x10,0x04,
-  0x96,0xFE,0xF5,0xB2,0xFE,0xFF,0xE0,0xDD,0xFE,0x02,0x2B,0x3B,0x3B,0xC7,0xA8,0x99,
-  0x8E,0x8B,0x92,0x04,0x4A,0x9A,0xC3,0xF5,0xEB,0xFE,0xDF,0x01,0x1F,0x01,0x01,0x02,
-  0x3E,0x9A,0xC3,0xE1,0xB9,0xD0,0xBF,0xAE,0x01,0x0D,0x00,0x01,0x00,0x6A,0xFF,0xE5,
-  0x04,0x39,0x04,0x4A,0x00,0x10,0x00,0x53,0x40,0x1D,0x0A,0x0E,0x1A,0x0E,0x02,0x0E,
-  0x03,0x47,0xFD,0x0C,0x01,0x0C,0x40,0x14,0x17,0x48,0x3D,0x0C,0x01,0x2F,0x0C,0x01,
-  0x00,0x0C,0x01,0x0C,0x0C,0x11,0x01,0xB8,0xFF,0xE8,0x40,0x14,0x09,0x12,0x48,0x01,
-  0x5F,0x07,0x01,0x07,0x12,0x0F,0x02,0x0D,0x50,0x10,0x0F,0x07,0x05,0x50,0x0A,0x16,
-  0x00,0x3F,0xE1,0x33,0x3F,0xE1,0x32,0x39,0x01,0x10,0xCE,0x5D,0x32,0x2B,0x12,0x39,
-  0x2F,0x5D,0x5D,0x5D,0x2B,0x5D,0xE1,0x33,0x5D,0x31,0x30,0x01,0x15,0x21,0x11,0x14,
-  0x33,0x32,0x37,0x15,0x06,0x23,0x20,0x11,0x11,0x21,0x35,0x37,0x04,0x39,0xFE,0x25,
-  0xD1,0x6B,0x54,0x54,0x88,0xFE,0x96,0xFE,0xC2,0x86,0x04,0x4A,0x9A,0xFD,0xA2,0xD7,
-  0x14,0x87,0x23,0x01,0x58,0x02,0x73,0x4A,0x50,0x00,0x00,0x01,0x00,0xA0,0xFF,0xEC,
-  0x04,0x3B,0x04,0x4A,0x00,0x11,0x00,0x33,0xB3,0x0A,0x46,0x09,0x09,0xB8,0xFF,0xD0,
-  0x40,0x17,0x10,0x18,0x48,0x09,0x07,0x47,0x0C,0x13,0x02,0x47,0x00,0x11,0xB0,0x11,
-  0x02,0x11,0x04,0x50,0x0F,0x16,0x09,0x00,0x0F,0x00,0x3F,0x32,0x3F,0xE1,0x01,0x2F,
-  0x5D,0xE1,0x10,0xDE,0xE1,0x33,0x2B,0x10,0xE5,0x31,0x30,0x13,0x33,0x11,0x10,0x21,
-  0x32,0x36,0x35,0x34,0x27,0x33,0x16,0x15,0x10,0x02,0x23,0x20,0x11,0xA0,0xB6,0x01,
-  0x12,0x96,0x87,0x3F,0xB6,0x3F,0xE6,0xF3,0xFE,0x3E,0x04,0x4A,0xFD,0xB2,0xFE,0x85,
-  0xE8,0xF7,0xED,0xFD,0xF5,0xFD,0xFE,0xC2,0xFE,0xD2,0x02,0x06,0x00,0x02,0x00,0x4A,
-  0xFE,0x14,0x04,0x83,0x04,0x5E,0x00,0x15,0x00,0x1C,0x00,0x5C,0x40,0x3A,0x16,0x56,
-  0x15,0x66,0x15,0x02,0x47,0x15,0x01,0x15,0x49,0x0B,0x06,0x00,0x00,0x03,0x18,0x46,
-  0x0F,0x11,0x01,0x11,0x1E,0x09,0x49,0x50,0x03,0x90,0x03,0xA0,0x03,0xC0,0x03,0xD0,
-  0x03,0x05,0x2F,0x03,0x3F,0x03,0x02,0x03,0x06,0x1A,0x50,0x0E,0x05,0x05,0x0E,0x10,
-  0x16,0x0B,0x50,0x14,0x01,0x16,0x00,0x1B,0x00,0x3F,0x3F,0x33,0xE1,0x32,0x3F,0x33,
-  0x2F,0x10,0xE1,0x39,0x01,0x2F,0x5D,0x5D,0xE1,0x10,0xDE,0x5D,0xE1,0x11,0x39,0x2F,
-  0x33,0x33,0xE1,0x5D,0x5D,0x32,0x31,0x30,0x01,0x11,0x24,0x11,0x10,0x37,0x17,0x06,
-  0x06,0x15,0x10,0x05,0x11,0x10,0x21,0x32,0x12,0x15,0x10,0x02,0x07,0x11,0x11,0x24,
-  0x11,0x10,0x23,0x22,0x15,0x02,0x0C,0xFE,0x3E,0xCF,0x78,0x61,0x44,0x01,0x20,0x01,
-  0x19,0xA4,0xBA,0xFA,0xDF,0x01,0x31,0xB0,0x81,0xFE,0x14,0x01,0xDA,0x19,0x02,0x1C,
-  0x01,0x3A,0xF5,0x5A,0x81,0xCE,0x86,0xFE,0x81,0x21,0x02,0x5E,0x01,0x7D,0xFE,0xD9,
-  0xFC,0xFE,0xF8,0xFE,0xC9,0x0E,0xFE,0x26,0x02,0x6F,0x1D,0x01,0x99,0x01,0x8E,0xE4,
-  0x00,0x01,0x00,0x2B,0xFE,0x14,0x04,0x8D,0x04,0x4E,0x00,0x1E,0x00,0xE6,0x40,0x5C,
-  0x03,0x1E,0x04,0x10,0x14,0x0F,0x11,0x02,0x11,0x00,0x1E,0x04,0x13,0x14,0x0F,0x12,
-  0x01,0x12,0x10,0x13,0x14,0x0F,0x14,0x03,0x00,0x1E,0x04,0x1E,0x06,0x1E,0x16,0x1E,
-  0x26,0x1E,0x03,0x49,0x14,0x59,0x14,0xC9,0x14,0x03,0x15,0x11,0x01,0x06,0x11,0x26,
-  0x11,0xC6,0x11,0x03,0x09,0x0F,0x19,0x0F,0x29,0x0F,0x03,0x46,0x04,0x56,0x04,0xC6,
-  0x04,0x03,0x1A,0x01,0x01,0x09,0x01,0x29,0x01,0xC9,0x01,0x03,0x14,0x1E,0x04,0x0F,
-  0x1E,0x0F,0x19,0x09,0x13,0x10,0x00,0x03,0x04,0x12,0x01,0x02,0xB8,0xFF,0xC0,0xB5,
-  0x0D,0x10,0x48,0x02,0x02,0x09,0xB8,0xFF,0xC0,0x40,0x2B,0x09,0x0C,0x48,0x09,0x09,
-  0x20,0x11,0x12,0x12,0x00,0x19,0x01,0x19,0x19,0x1F,0x14,0x0F,0x0C,0x16,0x50,0x1E,
-  0x04,0x09,0x18,0x1B,0x0F,0x00,0x13,0x03,0x10,0x04,0x01,0x11,0x12,0x1B,0x09,0x07,
-  0x50,0x0C,0x1B,0x02,0x01,0x0F,0x00,0x3F,0x33,0x3F,0xE1,0x33,0x3F,0x33,0x12,0x17,
-  0x39,0x3F,0x33,0x12,0x39,0x39,0xE1,0x11,0x39,0x39,0x11,0x01,0x33,0x2F,0x5D,0x33,
-  0x2F,0x33,0x11,0x33,0x2F,0x2B,0x33,0x2F,0x2B,0x33,0x12,0x17,0x39,0x11,0x12,0x39,
-  0x39,0x11,0x33,0x11,0x33,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x10,0x7D,0x87,
-  0xC4,0xC4,0x10,0x87,0xC4,0xC4,0x10,0x87,0x08,0xC4,0x08,0xC4,0x10,0x87,0x08,0xC4,
-  0x08,0xC4,0x31,0x30,0x01,0x01,0x33,0x01,0x13,0x16,0x16,0x33,0x32,0x37,0x15,0x06,
-  0x23,0x22,0x26,0x27,0x03,0x01,0x23,0x01,0x03,0x26,0x23,0x22,0x07,0x35,0x36,0x33,
-  0x32,0x16,0x17,0x02,0x7D,0x01,0x37,0xB2,0xFE,0x5F,0xBA,0x2E,0x50,0x40,0x2C,0x24,
-  0x42,0x34,0x66,0x87,0x47,0x93,0xFE,0x9E,0xC3,0x01,0xDB,0xB4,0x44,0x54,0x1D,0x22,
-  0x35,0x4C,0x51,0x6E,0x37,0x01,0xFA,0x02,0x50,0xFC,0xF8,0xFE,0x33,0x72,0x59,0x08,
-  0x8B,0x13,0x5A,0xB1,0x01,0x79,0xFD,0x7C,0x03,0x3E,0x01,0xBE,0xA8,0x0A,0x8F,0x11,
-  0x6D,0x8B,0x00,0x01,0x00,0x50,0xFE,0x14,0x04,0x83,0x06,0x12,0x00,0x16,0x00,0x69,
-  0x40,0x16,0x01,0x56,0x0B,0x66,0x0B,0x02,0x47,0x0B,0x01,0x0B,0x49,0x15,0x0C,0x0C,
-  0x10,0x03,0x46,0x08,0x06,0x46,0x05,0x05,0xB8,0xFF,0xD0,0x40,0x2B,0x10,0x18,0x48,
-  0x05,0x0F,0x08,0x01,0x08,0x18,0x13,0x46,0x40,0x10,0x50,0x10,0x90,0x10,0xA0,0x10,
-  0xC0,0x10,0xD0,0x10,0x06,0x2F,0x10,0x3F,0x10,0x02,0x10,0x06,0x11,0x0F,0x01,0x15,
-  0x50,0x0A,0x0D,0x16,0x0B,0x1B,0x00,0x00,0x00,0x3F,0x3F,0x3F,0x33,0xE1,0x32,0x3F,
-  0x33,0x01,0x2F,0x5D,0x5D,0xE1,0x10,0xCE,0x5D,0x32,0x2B,0x10,0xE5,0x10,0xE1,0x11,
-  0x39,0x2F,0x33,0xE1,0x5D,0x5D,0x32,0x31,0x30,0x01,0x11,0x24,0x11,0x34,0x03,0x33,
-  0x12,0x15,0x10,0x05,0x11,0x23,0x11,0x26,0x02,0x11,0x11,0x33,0x11,0x10,0x05,0x11,
-  0x02,0xAA,0x01,0x2D,0x3F,0xAC,0x3F,0xFE,0x27,0x9E,0xE9,0xD3,0xAC,0x01,0x10,0x06,
-  0x12,0xFA,0x73,0x1C,0x01,0x98,0xFA,0x01,0x17,0xFE,0xEC,0xF7,0xFD,0xC9,0x1A,0xFE,
-  0x26,0x01,0xDA,0x08,0x01,0x0E,0x01,0x27,0x02,0x1F,0xFD,0xEF,0xFE,0x5A,0x10,0x05,
-  0x8F,0x00,0x00,0x01,0x00,0x5A,0xFF,0xEC,0x04,0x75,0x04,0x4A,0x00,0x1F,0x00,0xAA,
-  0x40,0x10,0x56,0x13,0xE6,0x13,0xF6,0x13,0x03,0x47,0x13,0x01,0x36,0x13,0x01,0x13,
-  0x12,0x12,0xB8,0xFF,0xF0,0x40,0x63,0x0F,0x12,0x48,0x57,0x12,0x01,0x36,0x12,0x46,
-  0x12,0x02,0x12,0x15,0x19,0x56,0x0B,0x66,0x0B,0x02,0x47,0x0B,0x01,0x0B,0x49,0x08,
-  0x08,0x1E,0x10,0x49,0x0F,0x15,0x3F,0x15,0x02,0x15,0x21,0x59,0x00,0xE9,0x00,0xF9,
-  0x00,0x03,0x48,0x00,0x01,0x39,0x00,0x01,0x00,0x01,0x01,0x10,0x0F,0x12,0x48,0x58,
-  0x01,0x01,0x39,0x01,0x49,0x01,0x02,0x01,0x03,0x49,0x30,0x1E,0x40,0x1E,0x50,0x1E,
-  0x90,0x1E,0xA0,0x1E,0xC0,0x1E,0xD0,0x1E,0x07,0x2F,0x1E,0x01,0x1E,0x09,0x09,0x00,
-  0x19,0x0E,0x05,0x50,0x17,0x1C,0x16,0x12,0x00,0x0F,0x00,0x3F,0x32,0x3F,0x33,0xE1,
-  0x32,0x32,0x11,0x39,0x2F,0x01,0x2F,0x5D,0x5D,0xE1,0x33,0x5D,0x5D,0x2B,0x11,0x33,
-  0x5D,0x5D,0x5D,0x10,0xDE,0x5D,0xE1,0x11,0x39,0x2F,0xE1,0x5D,0x5D,0x39,0x11,0x33,
-  0x5D,0x5D,0x2B,0x11,0x33,0x5D,0x5D,0x5D,0x31,0x30,0x13,0x33,0x02,0x11,0x10,0x33,
-  0x32,0x36,0x35,0x11,0x33,0x11,0x14,0x16,0x33,0x32,0x11,0x10,0x03,0x33,0x12,0x11,
-  0x10,0x21,0x22,0x27,0x23,0x06,0x23,0x20,0x11,0x10,0xC3,0xA5,0x68,0x8B,0x43,0x4B,
-  0x9D,0x4F,0x3F,0x8B,0x69,0xA6,0x69,0xFE,0xDF,0xB5,0x32,0x0B,0x32,0xB5,0xFE,0xDF,
-  0x04,0x4A,0xFE,0xFA,0xFE,0xD0,0xFE,0x6F,0x8E,0x7E,0x01,0x32,0xFE,0xCE,0x82,0x8A,
-  0x01,0x91,0x01,0x32,0x01,0x04,0xFE,0xFE,0xFE,0xCC,0xFD,0xD8,0xB2,0xB2,0x02,0x28,
-  0x01,0x2E,0xFF,0xFF,0x01,0x03,0xFF,0xEC,0x03,0xF8,0x05,0xD9,0x02,0x26,0x01,0x86,
-  0x00,0x00,0x01,0x06,0x00,0x6A,0xB9,0x00,0x00,0x17,0x40,0x0D,0x02,0x01,0x10,0x11,
-  0x26,0x02,0x01,0x17,0x12,0x16,0x0B,0x00,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,
-  0x35,0x00,0xFF,0xFF,0x00,0xA0,0xFF,0xEC,0x04,0x3B,0x05,0xD9,0x02,0x26,0x01,0x92,
-  0x00,0x00,0x01,0x06,0x00,0x6A,0x00,0x00,0x00,0x19,0xB6,0x02,0x01,0x16,0x11,0x26,
-  0x02,0x01,0xB8,0xFF,0xF8,0xB4,0x18,0x1C,0x00,0x0C,0x25,0x01,0x2B,0x35,0x35,0x00,
-  0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0x73,0xFF,0xEC,0x04,0x58,0x06,0x21,0x02,0x26,
-  0x00,0x52,0x00,0x00,0x01,0x06,0x01,0x54,0x48,0x00,0x00,0x13,0x40,0x0B,0x02,0x1C,
-  0x11,0x26,0x02,0x48,0x14,0x18,0x03,0x09,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,
-  0xFF,0xFF,0x00,0xA0,0xFF,0xEC,0x04,0x3B,0x06,0x21,0x02,0x26,0x01,0x92,0x00,0x00,
-  0x01,0x06,0x01,0x54,0x27,0x00,0x00,0x13,0x40,0x0B,0x01,0x1A,0x11,0x26,0x01,0x1F,
-  0x12,0x16,0x00,0x0C,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x5A,
-  0xFF,0xEC,0x04,0x75,0x06,0x21,0x02,0x26,0x01,0x96,0x00,0x00,0x01,0x06,0x01,0x54,
-  0x33,0x00,0x00,0x13,0x40,0x0B,0x01,0x28,0x11,0x26,0x01,0x31,0x20,0x24,0x1E,0x15,
-  0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xD9,0x00,0x00,0x04,0x23,
-  0x07,0x2B,0x02,0x26,0x00,0x28,0x00,0x00,0x01,0x07,0x00,0x6A,0x00,0x19,0x01,0x52,
-  0x00,0x17,0x40,0x0D,0x02,0x01,0x10,0x05,0x26,0x02,0x01,0x00,0x12,0x16,0x01,0x00,
-  0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,0x00,0x01,0x00,0x17,0xFF,0xEC,
-  0x04,0x8D,0x05,0xB6,0x00,0x1B,0x00,0x7D,0xB6,0x12,0x10,0x10,0x80,0x10,0x02,0x10,
-  0xB8,0xFF,0xC0,0x40,0x49,0x15,0x18,0x48,0x10,0x10,0x0A,0x5A,0x0B,0xFF,0x0D,0x01,
-  0x0D,0x0D,0xE0,0x0B,0xF0,0x0B,0x02,0x46,0x0B,0x56,0x0B,0x02,0x37,0x0B,0x01,0x2F,
-  0x00,0x3F,0x00,0x02,0x0B,0x00,0x01,0x0B,0x00,0x0B,0x00,0x1C,0x05,0x5A,0x17,0x1D,
-  0x09,0x5F,0x40,0x12,0xA0,0x12,0xB0,0x12,0xD0,0x12,0xE0,0x12,0xF0,0x12,0x06,0x12,
-  0x12,0x0E,0x03,0x5F,0x01,0x1A,0x13,0x11,0x0C,0x5F,0x0E,0x03,0x0B,0x12,0x00,0x3F,
-  0x3F,0xE1,0x32,0x3F,0x33,0xE1,0x11,0x39,0x2F,0x5D,0xE1,0x01,0x10,0xDE,0xE1,0x12,
-  0x39,0x39,0x2F,0x2F,0x5D,0x5D,0x5D,0x5D,0x5D,0x33,0x2F,0x5D,0x10,0xE1,0x32,0x2F,
-  0x2B,0x5D,0x32,0x31,0x30,0x25,0x35,0x16,0x33,0x32,0x35,0x35,0x34,0x23,0x23,0x11,
-  0x23,0x11,0x21,0x35,0x21,0x15,0x21,0x11,0x21,0x32,0x16,0x15,0x15,0x14,0x06,0x23,
-  0x22,0x02,0x98,0x44,0x43,0xB4,0xE3,0xF4,0xBA,0xFE,0xD5,0x03,0x49,0xFE,0x9C,0x01,
-  0x08,0xBB,0xCE,0xBD,0xAB,0x58,0x04,0xA0,0x15,0xE2,0x85,0xE7,0xFD,0x23,0x05,0x12,
-  0xA4,0xA4,0xFE,0x6F,0xC1,0xB2,0x89,0xC4,0xD5,0x00,0xFF,0xFF,0x00,0xF6,0x00,0x00,
-  0x04,0x2F,0x07,0x73,0x02,0x26,0x01,0x61,0x00,0x00,0x01,0x07,0x00,0x76,0x00,0x6D,
-  0x01,0x52,0x00,0x13,0x40,0x0B,0x01,0x0C,0x05,0x26,0x01,0x3A,0x06,0x09,0x04,0x00,
-  0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0x00,0x01,0x00,0x81,0xFF,0xEC,0x04,0x9C,
-  0x05,0xCB,0x00,0x17,0x00,0x44,0x40,0x27,0x07,0x40,0x14,0x18,0x48,0x07,0x01,0x07,
-  0x01,0x0D,0x12,0x19,0x00,0x03,0x5B,0x00,0x0D,0xF0,0x0D,0x02,0x0D,0x03,0x5F,0x68,
-  0x00,0x01,0x00,0x00,0x05,0x15,0x5F,0x13,0x10,0x04,0x05,0x5F,0x07,0x0A,0x13,0x00,
-  0x3F,0x33,0xE1,0x3F,0x33,0xE1,0x12,0x39,0x2F,0x5D,0xE1,0x01,0x2F,0x5D,0xE1,0x32,
-  0x10,0xCE,0x11,0x39,0x39,0x2F,0x2F,0x2B,0x31,0x30,0x01,0x21,0x15,0x21,0x12,0x21,
-  0x32,0x37,0x15,0x06,0x23,0x20,0x00,0x11,0x10,0x00,0x21,0x32,0x17,0x07,0x26,0x23,
-  0x22,0x06,0x01,0x4C,0x02,0x75,0xFD,0x85,0x17,0x01,0xC0,0x82,0xC5,0x92,0xD4,0xFE,
-  0xCB,0xFE,0xB8,0x01,0x66,0x01,0x36,0xDC,0xA3,0x4E,0x9A,0x97,0xBC,0xFA,0x03,0x4E,
-  0xA2,0xFD,0xE3,0x3A,0xA2,0x3B,0x01,0x88,0x01,0x69,0x01,0x5A,0x01,0x94,0x56,0x9C,
-  0x4E,0xF9,0xFF,0xFF,0x00,0x8D,0xFF,0xEC,0x04,0x3F,0x05,0xCB,0x02,0x06,0x00,0x36,
-  0x00,0x00,0xFF,0xFF,0x00,0xE1,0x00,0x00,0x03,0xE9,0x05,0xB6,0x02,0x06,0x00,0x2C,
-  0x00,0x00,0xFF,0xFF,0x00,0xE1,0x00,0x00,0x03,0xE9,0x07,0x2B,0x02,0x26,0x00,0x2C,
-  0x00,0x00,0x01,0x07,0x00,0x6A,0x00,0x02,0x01,0x52,0x00,0x17,0x40,0x0D,0x02,0x01,
-  0x10,0x05,0x26,0x02,0x01,0x02,0x12,0x16,0x01,0x00,0x25,0x01,0x2B,0x35,0x35,0x00,
-  0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0x89,0xFF,0xEC,0x03,0xD3,0x05,0xB6,0x02,0x06,
-  0x00,0x2D,0x00,0x00,0x00,0x02,0x00,0x00,0xFF,0xEC,0x04,0xB8,0x05,0xB6,0x00,0x18,
-  0x00,0x20,0x00,0x84,0x40,0x58,0x01,0x08,0x09,0x0E,0x48,0x01,0x78,0x00,0x01,0x57,
-  0x00,0x67,0x00,0x02,0x00,0xFA,0x0E,0x0C,0x08,0x14,0x18,0x48,0x99,0x0C,0xA9,0x0C,
-  0x02,0x78,0x0C,0x88,0x0C,0x02,0x0C,0x10,0x09,0x0F,0x48,0x0C,0x0E,0x10,0x19,0x5A,
-  0x17,0x60,0x0E,0x90,0x0E,0xA0,0x0E,0xE0,0x0E,0xF0,0x0E,0x05,0x47,0x17,0x01,0x0E,
-  0x17,0x0E,0x17,0x06,0x1C,0xFB,0x13,0x22,0x00,0x06,0x01,0x06,0x20,0x5F,0x10,0x10,
-  0x0E,0x19,0x60,0x17,0x12,0x00,0x5F,0x0E,0x03,0x09,0x61,0x07,0x04,0x13,0x00,0x3F,
-  0x33,0xE1,0x3F,0xE1,0x3F,0xE1,0x11,0x39,0x2F,0xE1,0x01,0x2F,0x5D,0x10,0xD6,0xE1,
-  0x11,0x39,0x39,0x2F,0x2F,0x5D,0x5D,0x10,0xE1,0x32,0x11,0x33,0x2B,0x5D,0x5D,0x2B,
-  0x10,0xE1,0x5D,0x5D,0x32,0x2B,0x31,0x30,0x01,0x03,0x02,0x06,0x23,0x22,0x27,0x35,
-  0x16,0x33,0x32,0x36,0x36,0x12,0x37,0x21,0x11,0x33,0x20,0x11,0x14,0x06,0x23,0x23,
-  0x11,0x13,0x33,0x20,0x11,0x34,0x26,0x23,0x23,0x01,0x77,0x14,0x14,0x7F,0x70,0x38,
-  0x28,0x20,0x24,0x23,0x35,0x19,0x29,0x03,0x01,0xF2,0x27,0x01,0xBE,0xE4,0xD8,0xCF,
-  0xA6,0x2D,0x01,0x0C,0x8A,0x9B,0x14,0x05,0x12,0xFD,0xDC,0xFD,0xC3,0xC5,0x12,0x91,
-  0x0E,0x46,0xB8,0x03,0x61,0xD6,0xFD,0x98,0xFE,0x5E,0xD0,0xDC,0x05,0x12,0xFB,0x8E,
-  0x01,0x0C,0x86,0x78,0x00,0x02,0x00,0x42,0x00,0x00,0x04,0xB0,0x05,0xB6,0x00,0x12,
-  0x00,0x1A,0x00,0x43,0x40,0x25,0x0B,0x13,0x5A,0x08,0x00,0x00,0x04,0x16,0xFB,0x0F,
-  0x1C,0x07,0x03,0x5A,0x04,0x40,0x0A,0x0F,0x48,0x04,0x1A,0x02,0x5F,0x0B,0x68,0x07,
-  0x01,0x07,0x07,0x09,0x05,0x03,0x13,0x60,0x03,0x00,0x12,0x00,0x3F,0x32,0xE1,0x3F,
-  0x33,0x39,0x2F,0x5D,0x33,0xE1,0x32,0x01,0x2F,0x2B,0xE1,0x32,0x10,0xD6,0xE1,0x11,
-  0x39,0x2F,0x33,0xE1,0x32,0x31,0x30,0x21,0x11,0x21,0x11,0x23,0x11,0x33,0x11,0x21,
-  0x11,0x33,0x11,0x33,0x32,0x16,0x15,0x14,0x06,0x23,0x27,0x33,0x20,0x11,0x34,0x26,
-  0x23,0x23,0x02,0x25,0xFE,0xC2,0xA5,0xA5,0x01,0x3E,0xA6,0x27,0xDB,0xE3,0xE4,0xD8,
-  0x29,0x2D,0x01,0x0C,0x8A,0x9B,0x14,0x02,0xAA,0xFD,0x56,0x05,0xB6,0xFD,0x98,0x02,
-  0x68,0xFD,0x98,0xD7,0xCB,0xD0,0xDC,0xA0,0x01,0x0C,0x86,0x78,0x00,0x01,0x00,0x17,
-  0x00,0x00,0x04,0x8D,0x05,0xB6,0x00,0x12,0x00,0x69,0xB5,0x10,0x11,0x80,0x11,0x02,
-  0x11,0xB8,0xFF,0xC0,0x40,0x3B,0x15,0x18,0x48,0x11,0x11,0x00,0x0B,0x5A,0x0C,0xFF,
-  0x0E,0x01,0x0E,0x0E,0xE0,0x0C,0xF0,0x0C,0x02,0x46,0x0C,0x56,0x0C,0x02,0x37,0x0C,
-  0x01,0x0C,0x0C,0x13,0x06,0x5A,0x05,0x14,0x12,0x0D,0x5F,0x0F,0x0A,0x5F,0x30,0x00,
-  0x40,0x00,0xA0,0x00,0xB0,0x00,0xD0,0x00,0x05,0x00,0x00,0x0C,0x0F,0x03,0x06,0x0C,
-  0x12,0x00,0x3F,0x33,0x3F,0x12,0x39,0x2F,0x5D,0xE1,0x10,0xE1,0x32,0x01,0x10,0xDE,
-  0xE1,0x12,0x39,0x2F,0x5D,0x5D,0x5D,0x33,0x2F,0x5D,0x10,0xE1,0x32,0x32,0x2F,0x2B,
-  0x5D,0x31,0x30,0x01,0x21,0x32,0x16,0x15,0x11,0x23,0x11,0x34,0x23,0x23,0x11,0x23,
-  0x11,0x21,0x35,0x21,0x15,0x21,0x01,0xFC,0x01,0x08,0xBB,0xCE,0xBA,0xE3,0xF4,0xBA,
-  0xFE,0xD5,0x03,0x49,0xFE,0x9C,0x03,0x81,0xC1,0xB2,0xFD,0xF2,0x01,0xF6,0xE7,0xFD,
-  0x23,0x05,0x12,0xA4,0xA4,0x00,0xFF,0xFF,0x00,0xD3,0x00,0x00,0x04,0xAE,0x07,0x73,
-  0x02,0x26,0x01,0xB4,0x00,0x00,0x01,0x07,0x00,0x76,0x00,0x9C,0x01,0x52,0x00,0x13,
-  0x40,0x0B,0x01,0x11,0x05,0x26,0x01,0x42,0x0B,0x0E,0x04,0x00,0x25,0x01,0x2B,0x35,
-  0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x1B,0xFF,0xEC,0x04,0xB0,0x07,0x69,0x02,0x26,
-  0x01,0xBD,0x00,0x00,0x01,0x07,0x02,0x36,0x00,0x06,0x01,0x52,0x00,0x13,0x40,0x0B,
-  0x01,0x1A,0x05,0x26,0x01,0x06,0x1D,0x18,0x0E,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,
-  0x35,0x00,0x00,0x01,0x00,0x87,0xFE,0x7F,0x04,0x46,0x05,0xB6,0x00,0x0B,0x00,0x43,
-  0x40,0x2A,0x02,0x5A,0x00,0x03,0x10,0x03,0x90,0x03,0xA0,0x03,0xC0,0x03,0xD0,0x03,
-  0x06,0x03,0x03,0x05,0x09,0x5A,0x00,0x0D,0x08,0x5A,0x00,0x05,0xE0,0x05,0xF0,0x05,
-  0x03,0x05,0x0A,0x06,0x03,0x08,0x5F,0x05,0x03,0x03,0x01,0x05,0x00,0x2F,0x33,0x33,
-  0x2F,0x10,0xE1,0x3F,0x33,0x01,0x2F,0x5D,0xE1,0x10,0xDE,0xE1,0x11,0x39,0x2F,0x5D,
-  0xE1,0x31,0x30,0x21,0x21,0x11,0x23,0x11,0x21,0x11,0x33,0x11,0x21,0x11,0x33,0x04,
-  0x46,0xFE,0x76,0xB0,0xFE,0x7B,0xBB,0x02,0x49,0xBB,0xFE,0x7F,0x01,0x81,0x05,0xB6,
-  0xFA,0xF0,0x05,0x10,0xFF,0xFF,0x00,0x21,0x00,0x00,0x04,0xAC,0x05,0xBC,0x02,0x06,
-  0x00,0x24,0x00,0x00,0x00,0x02,0x00,0x87,0x00,0x00,0x04,0x6F,0x05,0xB6,0x00,0x0B,
-  0x00,0x13,0x00,0x33,0x40,0x1D,0x0F,0x5B,0x03,0x08,0x15,0x05,0x0C,0x5A,0x00,0x00,
-  0xE0,0x00,0xF0,0x00,0x03,0x00,0x13,0x5F,0x05,0x05,0x0C,0x04,0x5F,0x01,0x03,0x0C,
-  0x60,0x00,0x12,0x00,0x3F,0xE1,0x3F,0xE1,0x12,0x39,0x2F,0xE1,0x01,0x2F,0x5D,0xE1,
-  0x32,0x10,0xDE,0x32,0xE1,0x31,0x30,0x33,0x11,0x21,0x15,0x21,0x11,0x21,0x20,0x11,
-  0x14,0x04,0x23,0x25,0x21,0x20,0x11,0x34,0x26,0x23,0x23,0x87,0x03,0x90,0xFD,0x2B,
-  0x01,0x10,0x02,0x1D,0xFE,0xF9,0xFB,0xFE,0xD5,0x01,0x1A,0x01,0x52,0xAB,0xC6,0xFB,
-  0x05,0xB6,0xA4,0xFE,0x3C,0xFE,0x5E,0xD0,0xDC,0xA0,0x01,0x0C,0x85,0x79,0xFF,0xFF,
-  0x00,0x87,0x00,0x00,0x04,0x71,0x05,0xB6,0x02,0x06,0x00,0x25,0x00,0x00,0xFF,0xFF,
-  0x00,0xF6,0x00,0x00,0x04,0x2F,0x05,0xB6,0x02,0x06,0x01,0x61,0x00,0x00,0x00,0x02,
-  0x00,0x06,0xFE,0x7F,0x04,0xC5,0x05,0xB6,0x00,0x0D,0x00,0x13,0x00,0x81,0x40,0x19,
-  0x09,0x10,0x12,0x18,0x48,0x0B,0x12,0x01,0x12,0x20,0x0B,0x18,0x48,0x0B,0x08,0x01,
-  0x08,0x20,0x0B,0x18,0x48,0x19,0x0A,0x01,0x13,0xB8,0xFF,0xF0,0x40,0x0D,0x09,0x18,
-  0x48,0x13,0x5B,0x07,0x10,0x5A,0x0A,0x14,0x07,0x01,0x0A,0xB8,0xFF,0xC0,0x40,0x25,
-  0x0A,0x18,0x48,0x02,0x0A,0x01,0x07,0x0A,0x07,0x0A,0x05,0x0C,0x01,0xFB,0x00,0x00,
-  0x0E,0x5A,0x0C,0x15,0x04,0xFB,0x05,0x10,0x5F,0x0A,0x03,0x13,0x0C,0x06,0x5F,0x03,
-  0x00,0x05,0x05,0x03,0x12,0x00,0x3F,0x33,0x2F,0x33,0x10,0xE1,0x32,0x32,0x3F,0xE1,
-  0x01,0x2F,0xE1,0x10,0xDC,0xE1,0x33,0x2F,0xE1,0x11,0x12,0x39,0x39,0x2F,0x2F,0x5D,
-  0x2B,0x5D,0x10,0xE1,0x10,0xE1,0x2B,0x5D,0x31,0x30,0x2B,0x5D,0x2B,0x5D,0x2B,0x01,
-  0x23,0x11,0x21,0x11,0x23,0x11,0x33,0x36,0x12,0x13,0x21,0x11,0x33,0x21,0x11,0x23,
-  0x02,0x02,0x07,0x04,0xC5,0xB1,0xFC,0xA2,0xB0,0x71,0x81,0xAE,0x0C,0x02,0x50,0xC3,
-  0xFE,0x83,0xF2,0x11,0xA3,0x6B,0xFE,0x7F,0x01,0x81,0xFE,0x7F,0x02,0x27,0xEC,0x02,
-  0xCC,0x01,0x58,0xFA,0xF0,0x04,0x6A,0xFE,0xF6,0xFD,0x6B,0xCB,0xFF,0xFF,0x00,0xD9,
-  0x00,0x00,0x04,0x23,0x05,0xB6,0x02,0x06,0x00,0x28,0x00,0x00,0x00,0x01,0x00,0x00,
-  0x00,0x00,0x04,0xCD,0x05,0xB6,0x00,0x11,0x00,0xCB,0x40,0x4C,0x67,0x09,0x77,0x09,
-  0x87,0x09,0x03,0x06,0x09,0x16,0x09,0x36,0x09,0x46,0x09,0x56,0x09,0x05,0x09,0x05,
-  0x05,0x46,0x0D,0x56,0x0D,0xF6,0x0D,0x03,0x37,0x0D,0x01,0x05,0x0D,0x15,0x0D,0x02,
-  0x0D,0x5A,0x68,0x00,0x78,0x00,0x88,0x00,0x03,0x09,0x00,0x19,0x00,0x39,0x00,0x49,
-  0x00,0x59,0x00,0x05,0x00,0x04,0x04,0x67,0x0E,0x01,0x09,0x0E,0x19,0x0E,0x02,0x0E,
-  0x0E,0x11,0x0A,0x67,0x02,0x01,0x02,0x01,0xB8,0xFF,0xF0,0x40,0x09,0x01,0x01,0x67,
-  0x10,0x87,0x10,0x02,0x10,0x11,0xB8,0xFF,0xF0,0x40,0x32,0x11,0x68,0x07,0x88,0x07,
-  0x02,0x07,0x08,0x10,0x08,0x08,0x68,0x0B,0x88,0x0B,0x02,0x0B,0x10,0x0A,0x40,0x0A,
-  0x50,0x0A,0x90,0x0A,0xA0,0x0A,0xC0,0x0A,0xD0,0x0A,0x07,0x0A,0x10,0x0A,0x0C,0x0F,
-  0x06,0x03,0x0F,0x03,0x01,0x11,0x0E,0x0A,0x12,0x07,0x04,0x01,0x03,0x00,0x3F,0x33,
-  0x33,0x3F,0x33,0x33,0x12,0x39,0x39,0x11,0x33,0x11,0x33,0x01,0x2F,0x38,0x5D,0x33,
-  0x5D,0x33,0x2F,0x38,0x33,0x5D,0x2F,0x38,0x33,0x5D,0x33,0x2F,0x38,0x32,0x5D,0x11,
-  0x12,0x39,0x2F,0x5D,0x5D,0x33,0x11,0x33,0x5D,0x5D,0xE1,0x5D,0x5D,0x5D,0x32,0x11,
-  0x33,0x5D,0x5D,0x31,0x30,0x01,0x01,0x33,0x01,0x11,0x33,0x11,0x01,0x33,0x01,0x01,
-  0x23,0x01,0x11,0x23,0x11,0x01,0x23,0x01,0x75,0xFE,0x97,0xB2,0x01,0x5D,0x9B,0x01,
-  0x56,0xB2,0xFE,0x9C,0x01,0x73,0xB9,0xFE,0xA2,0x9B,0xFE,0x9B,0xB6,0x02,0xF2,0x02,
-  0xC4,0xFD,0x3C,0x02,0xC4,0xFD,0x3C,0x02,0xC4,0xFD,0x3C,0xFD,0x0E,0x02,0xE5,0xFD,
-  0x1B,0x02,0xE5,0xFD,0x1B,0x00,0x00,0x01,0x00,0x8B,0xFF,0xEC,0x04,0x2F,0x05,0xCB,
-  0x00,0x23,0x00,0x51,0x40,0x2E,0x06,0x00,0x16,0x00,0x02,0x00,0x11,0x16,0x5B,0x21,
-  0x21,0x04,0x11,0x11,0x09,0x0E,0x5B,0x04,0x25,0x1C,0x00,0x09,0x01,0x09,0x00,0x11,
-  0x60,0x68,0x12,0x01,0x9F,0x12,0x01,0x12,0x12,0x0C,0x1B,0x19,0x60,0x1E,0x04,0x0C,
-  0x60,0x0A,0x07,0x13,0x00,0x3F,0x33,0xE1,0x3F,0xE1,0x33,0x12,0x39,0x2F,0x5D,0x5D,
-  0xE1,0x39,0x01,0x2F,0x5D,0x33,0x10,0xDE,0xE1,0x11,0x39,0x2F,0x11,0x33,0x2F,0xE1,
-  0x12,0x39,0x5D,0x31,0x30,0x01,0x15,0x16,0x16,0x15,0x14,0x04,0x21,0x22,0x27,0x35,
-  0x16,0x33,0x20,0x11,0x10,0x21,0x23,0x35,0x33,0x32,0x36,0x35,0x34,0x26,0x23,0x22,
-  0x07,0x27,0x36,0x21,0x32,0x16,0x15,0x14,0x06,0x02,0xBE,0xB2,0xBF,0xFE,0xE4,0xFE,
-  0xFB,0xF2,0x91,0xB8,0xC7,0x01,0x63,0xFE,0x76,0xBE,0xB0,0xB4,0xC9,0x8C,0x76,0xBA,
-  0xA8,0x5D,0xC2,0x01,0x05,0xD1,0xEB,0xB3,0x03,0x02,0x06,0x17,0xB6,0x8F,0xCB,0xE9,
-  0x4F,0xAA,0x60,0x01,0x1B,0x01,0x08,0x97,0x94,0x7D,0x67,0x7A,0x79,0x7D,0x96,0xC6,
-  0xA5,0x89,0xBA,0x00,0x00,0x01,0x00,0x89,0x00,0x00,0x04,0x46,0x05,0xB6,0x00,0x10,
-  0x00,0x62,0xB9,0x00,0x0F,0xFF,0xF0,0x40,0x40,0x0E,0x18,0x48,0x35,0x0F,0x45,0x0F,
-  0x02,0x07,0x10,0x0E,0x18,0x48,0x3A,0x07,0x4A,0x07,0x02,0x0D,0x09,0x07,0x19,0x07,
-  0x29,0x07,0x03,0x07,0x0A,0xFB,0xE0,0x09,0xF0,0x09,0x02,0x09,0x69,0x12,0x06,0x0F,
-  0x16,0x0F,0x26,0x0F,0x03,0x0F,0x05,0x01,0xFB,0x00,0x00,0xE0,0x00,0xF0,0x00,0x03,
-  0x00,0x10,0x05,0x09,0x12,0x0D,0x07,0x00,0x03,0x00,0x3F,0x32,0x32,0x3F,0x33,0x33,
-  0x01,0x2F,0x5D,0xE1,0x32,0x32,0x5D,0x10,0xFE,0x5D,0xE1,0x32,0x5D,0x32,0x31,0x30,
-  0x5D,0x2B,0x5D,0x2B,0x13,0x33,0x11,0x14,0x07,0x07,0x33,0x01,0x33,0x11,0x23,0x11,
-  0x34,0x13,0x23,0x01,0x23,0x89,0xAE,0x07,0x07,0x06,0x02,0x42,0xD5,0xAC,0x12,0x08,
-  0xFD,0xBC,0xD7,0x05,0xB6,0xFC,0xE0,0x8E,0x70,0x96,0x04,0xB4,0xFA,0x4A,0x03,0x19,
-  0x8C,0x01,0x15,0xFB,0x46,0x00,0xFF,0xFF,0x00,0x89,0x00,0x00,0x04,0x46,0x07,0x69,
-  0x02,0x26,0x01,0xB2,0x00,0x00,0x01,0x07,0x02,0x36,0x00,0x00,0x01,0x52,0x00,0x15,
-  0xB4,0x01,0x13,0x05,0x26,0x01,0xB8,0xFF,0xFF,0xB4,0x16,0x11,0x00,0x08,0x25,0x01,
-  0x2B,0x35,0x00,0x2B,0x35,0x00,0x00,0x01,0x00,0xD3,0x00,0x00,0x04,0xAE,0x05,0xB6,
-  0x00,0x0A,0x00,0x82,0x40,0x60,0x05,0x07,0x15,0x07,0x25,0x07,0xD5,0x07,0xE5,0x07,
-  0xF5,0x07,0x06,0x0A,0x02,0x1A,0x02,0x2A,0x02,0xDA,0x02,0xEA,0x02,0xFA,0x02,0x06,
-  0x27,0x0A,0x01,0x0A,0x07,0x07,0x03,0x5A,0x00,0x04,0x60,0x04,0x70,0x04,0x80,0x04,
-  0x04,0x04,0x29,0x08,0xD9,0x08,0xE9,0x08,0xF9,0x08,0x04,0x08,0x09,0x10,0x09,0x09,
-  0x29,0x01,0xD9,0x01,0xE9,0x01,0xF9,0x01,0x04,0x01,0xD0,0x00,0xF0,0x00,0x02,0x7F,
-  0x00,0x01,0x00,0x00,0x10,0x00,0x40,0x00,0x60,0x00,0x04,0x00,0x10,0x00,0x07,0x02,
-  0x08,0x05,0x03,0x04,0x00,0x12,0x00,0x3F,0x32,0x3F,0x33,0x39,0x39,0x01,0x2F,0x38,
-  0x5D,0x5D,0x5D,0x32,0x5D,0x32,0x2F,0x38,0x33,0x5D,0x2F,0x5D,0xE1,0x32,0x11,0x33,
-  0x5D,0x31,0x30,0x00,0x5D,0x5D,0x21,0x23,0x01,0x11,0x23,0x11,0x33,0x11,0x01,0x33,
-  0x01,0x04,0xAE,0xDB,0xFD,0xBA,0xBA,0xBA,0x02,0x36,0xCE,0xFD,0xCB,0x02,0xE5,0xFD,
-  0x1B,0x05,0xB6,0xFD,0x3C,0x02,0xC4,0xFD,0x42,0x00,0x00,0x01,0x00,0x04,0xFF,0xE9,
-  0x04,0x46,0x05,0xB6,0x00,0x0F,0x00,0x6F,0x40,0x21,0x0D,0x40,0x14,0x18,0x48,0xAD,
-  0x0D,0x01,0x7C,0x0D,0x8C,0x0D,0x9C,0x0D,0x03,0x5A,0x0D,0x6A,0x0D,0x02,0x2D,0x0D,
-  0x3D,0x0D,0x4D,0x0D,0x03,0x0B,0x0D,0x1B,0x0D,0x02,0x05,0xB8,0xFF,0xF0,0x40,0x10,
-  0x09,0x18,0x48,0x04,0x18,0x09,0x18,0x48,0x03,0x5A,0x00,0x0E,0x10,0x0E,0x02,0x0E,
-  0xB8,0xFF,0xC0,0x40,0x16,0x0D,0x18,0x48,0x0E,0x0E,0x08,0x01,0x5A,0x00,0x11,0x08,
-  0x03,0x5F,0x0E,0x03,0x0B,0x60,0x09,0x06,0x13,0x00,0x12,0x00,0x3F,0x3F,0x33,0xE1,
-  0x3F,0xE1,0x01,0x2F,0x10,0xDE,0xE1,0x12,0x39,0x2F,0x2B,0x5D,0xE1,0x31,0x30,0x2B,
-  0x2B,0x5D,0x5D,0x5D,0x5D,0x5D,0x2B,0x21,0x23,0x11,0x21,0x02,0x02,0x23,0x22,0x27,
-  0x35,0x16,0x33,0x32,0x12,0x13,0x21,0x04,0x46,0xBB,0xFE,0xD7,0x75,0xB1,0xAF,0x47,
-  0x42,0x39,0x38,0x66,0x6E,0x7E,0x02,0x7F,0x05,0x12,0xFC,0x2F,0xFE,0xA8,0x19,0x96,
-  0x19,0x01,0x69,0x03,0xCE,0x00,0xFF,0xFF,0x00,0x71,0x00,0x00,0x04,0x5C,0x05,0xB6,
-  0x02,0x06,0x00,0x30,0x00,0x00,0xFF,0xFF,0x00,0x87,0x00,0x00,0x04,0x46,0x05,0xB6,
-  0x02,0x06,0x00,0x2B,0x00,0x00,0xFF,0xFF,0x00,0x54,0xFF,0xEC,0x04,0x7B,0x05,0xCD,
-  0x02,0x06,0x00,0x32,0x00,0x00,0xFF,0xFF,0x00,0x87,0x00,0x00,0x04,0x46,0x05,0xB6,
-  0x02,0x06,0x01,0x6E,0x00,0x00,0xFF,0xFF,0x00,0xB0,0x00,0x00,0x04,0x46,0x05,0xB6,
-  0x02,0x06,0x00,0x33,0x00,0x00,0xFF,0xFF,0x00,0x81,0xFF,0xEC,0x04,0x9C,0x05,0xCB,
-  0x02,0x06,0x00,0x26,0x00,0x00,0xFF,0xFF,0x00,0x66,0x00,0x00,0x04,0x64,0x05,0xB6,
-  0x02,0x06,0x00,0x37,0x00,0x00,0x00,0x01,0x00,0x1B,0xFF,0xEC,0x04,0xB0,0x05,0xB6,
-  0x00,0x17,0x00,0xA2,0x40,0x09,0x08,0x0D,0x18,0x0D,0x02,0x0D,0x01,0x14,0x14,0xB8,
-  0xFF,0xE0,0xB3,0x14,0x18,0x48,0x14,0xB8,0xFF,0xE0,0x40,0x59,0x0F,0x12,0x48,0x07,
-  0x14,0x07,0x14,0x0E,0xE8,0x17,0x01,0x49,0x17,0x59,0x17,0x02,0x38,0x17,0x01,0x29,
-  0x17,0x01,0x1A,0x17,0x01,0x09,0x17,0x01,0x17,0x00,0x00,0x19,0xE7,0x0F,0x01,0x46,
-  0x0F,0x56,0x0F,0x02,0x37,0x0F,0x01,0x26,0x0F,0x01,0x15,0x0F,0x01,0x06,0x0F,0x01,
-  0x0F,0x1F,0x0E,0x4F,0x0E,0x5F,0x0E,0x6F,0x0E,0x04,0x0E,0x0E,0x18,0x65,0x14,0x01,
-  0x36,0x14,0xE6,0x14,0x02,0x25,0x14,0x01,0x0D,0x01,0x14,0x03,0x00,0x0A,0x5F,0x08,
-  0x05,0x13,0x0E,0x00,0x03,0x00,0x3F,0x32,0x3F,0x33,0xE1,0x11,0x17,0x39,0x5D,0x5D,
-  0x5D,0x11,0x01,0x33,0x2F,0x5D,0x33,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x11,0x33,0x2F,
-  0x33,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x12,0x39,0x39,0x3D,0x2F,0x18,0x2F,0x2B,0x2B,
-  0x11,0x33,0x33,0x5D,0x31,0x30,0x01,0x01,0x0E,0x02,0x23,0x22,0x27,0x35,0x16,0x33,
-  0x32,0x36,0x37,0x01,0x33,0x01,0x16,0x17,0x16,0x17,0x33,0x37,0x01,0x04,0xB0,0xFE,
-  0x54,0x4C,0x78,0xB2,0x7E,0x68,0x4A,0x55,0x5D,0x6E,0x79,0x36,0xFD,0xEE,0xCC,0x01,
-  0x7F,0x0C,0x08,0x08,0x09,0x02,0x27,0x01,0x38,0x05,0xB6,0xFB,0xFA,0xB7,0xAB,0x62,
-  0x1E,0xB9,0x2D,0x67,0x7A,0x04,0x3F,0xFC,0xD7,0x19,0x16,0x19,0x14,0x6D,0x03,0x18,
-  0xFF,0xFF,0x00,0x1B,0xFF,0xEC,0x04,0xB4,0x05,0xCB,0x02,0x06,0x01,0x73,0x00,0x00,
-  0xFF,0xFF,0x00,0x35,0x00,0x00,0x04,0x96,0x05,0xB6,0x02,0x06,0x00,0x3B,0x00,0x00,
-  0x00,0x01,0x00,0x87,0xFE,0x7F,0x04,0xBA,0x05,0xB6,0x00,0x0B,0x00,0x3A,0x40,0x22,
-  0x03,0xFB,0x02,0x02,0x09,0x5A,0x7F,0x00,0x8F,0x00,0x02,0x00,0x0D,0x08,0x5A,0x00,
-  0x05,0xE0,0x05,0xF0,0x05,0x03,0x05,0x0A,0x06,0x03,0x00,0x08,0x5F,0x05,0x03,0x03,
-  0x05,0x12,0x00,0x3F,0x33,0x2F,0x10,0xE1,0x32,0x3F,0x33,0x01,0x2F,0x5D,0xE1,0x10,
-  0xDC,0x5D,0xE1,0x33,0x2F,0xE1,0x31,0x30,0x25,0x33,0x11,0x23,0x11,0x21,0x11,0x33,
-  0x11,0x21,0x11,0x33,0x04,0x0A,0xB0,0xB0,0xFC,0x7D,0xBB,0x02,0x0E,0xBA,0xA6,0xFD,
-  0xD9,0x01,0x81,0x05,0xB6,0xFA,0xF0,0x05,0x10,0x00,0x00,0x01,0x00,0x87,0x00,0x00,
-  0x04,0x46,0x05,0xB6,0x00,0x10,0x00,0x2F,0x40,0x1A,0x0E,0x01,0x5A,0x00,0x12,0x09,
-  0x5A,0x00,0x06,0xE0,0x06,0xF0,0x06,0x03,0x06,0x0E,0x0C,0x5F,0x04,0x04,0x01,0x0F,
-  0x07,0x03,0x01,0x12,0x00,0x3F,0x3F,0x33,0x12,0x39,0x2F,0xE1,0x33,0x01,0x2F,0x5D,
-  0xE1,0x10,0xDE,0xE1,0x32,0x31,0x30,0x21,0x23,0x11,0x06,0x23,0x20,0x11,0x11,0x33,
-  0x11,0x14,0x16,0x33,0x32,0x37,0x11,0x33,0x04,0x46,0xBB,0xE3,0xA6,0xFE,0x85,0xBB,
-  0x67,0x6E,0x99,0xDB,0xBB,0x02,0x56,0x5A,0x01,0x73,0x02,0x47,0xFD,0xD1,0x82,0x65,
-  0x50,0x02,0xC6,0x00,0x00,0x01,0x00,0x79,0x00,0x00,0x04,0x56,0x05,0xB6,0x00,0x0B,
-  0x00,0x5C,0x40,0x40,0x65,0x08,0x01,0x56,0x08,0x01,0x37,0x08,0x47,0x08,0xF7,0x08,
-  0x03,0x7B,0x05,0x8B,0x05,0x02,0x08,0x5A,0x05,0x05,0x01,0x09,0x5A,0xC0,0x00,0xD0,
-  0x00,0x02,0x0F,0x00,0x3F,0x00,0x02,0x00,0x0D,0x04,0x5A,0x00,0x01,0x10,0x01,0x30,
-  0x01,0x40,0x01,0x50,0x01,0x90,0x01,0xA0,0x01,0x07,0x01,0x0A,0x06,0x02,0x03,0x08,
-  0x04,0x5F,0x01,0x12,0x00,0x3F,0xE1,0x32,0x3F,0x33,0x33,0x01,0x2F,0x5D,0xE1,0x10,
-  0xDE,0x5D,0x5D,0xE1,0x11,0x39,0x2F,0xE1,0x5D,0x5D,0x5D,0x5D,0x31,0x30,0x21,0x21,
-  0x11,0x33,0x11,0x33,0x11,0x33,0x11,0x33,0x11,0x33,0x04,0x56,0xFC,0x23,0xA6,0xF5,
-  0xA6,0xF6,0xA6,0x05,0xB6,0xFA,0xF0,0x05,0x10,0xFA,0xF0,0x05,0x10,0x00,0x00,0x01,
-  0x00,0x3D,0xFE,0x7F,0x04,0xCD,0x05,0xB6,0x00,0x0F,0x00,0x7F,0x40,0x59,0x65,0x0C,
-  0x01,0x56,0x0C,0x01,0x37,0x0C,0x47,0x0C,0xF7,0x0C,0x03,0x7B,0x09,0x8B,0x09,0x02,
-  0x0C,0x5A,0x09,0x09,0x05,0x00,0x03,0xFB,0x00,0x02,0x90,0x02,0xA0,0x02,0xB0,0x02,
-  0xE0,0x02,0xF0,0x02,0x06,0x02,0x02,0x0D,0x5A,0xBF,0x00,0xEF,0x00,0xFF,0x00,0x03,
-  0x0F,0x00,0x3F,0x00,0x9F,0x00,0xAF,0x00,0x04,0x00,0x11,0x08,0x5A,0x90,0x05,0xA0,
-  0x05,0x02,0x2F,0x05,0x6F,0x05,0x7F,0x05,0x03,0x05,0x0E,0x0A,0x06,0x03,0x0C,0x00,
-  0x08,0x5F,0x05,0x03,0x03,0x05,0x12,0x00,0x3F,0x33,0x2F,0x10,0xE1,0x32,0x32,0x3F,
-  0x33,0x33,0x01,0x2F,0x5D,0x5D,0xE1,0x10,0xDD,0x5D,0x5D,0xE1,0x33,0x2F,0x5D,0xE1,
-  0x11,0x12,0x39,0x2F,0xE1,0x5D,0x5D,0x5D,0x5D,0x31,0x30,0x25,0x33,0x11,0x23,0x11,
-  0x21,0x11,0x33,0x11,0x33,0x11,0x33,0x11,0x33,0x11,0x33,0x04,0x1B,0xB2,0xB0,0xFC,
-  0x20,0xA6,0xF6,0xA6,0xF6,0xA6,0xA6,0xFD,0xD9,0x01,0x81,0x05,0xB6,0xFA,0xF0,0x05,
-  0x10,0xFA,0xF0,0x05,0x10,0x00,0x00,0x02,0x00,0x1B,0x00,0x00,0x04,0x75,0x05,0xB6,
-  0x00,0x0C,0x00,0x14,0x00,0x3B,0x40,0x21,0x05,0x0D,0x5A,0x1F,0x00,0x8F,0x00,0xFF,
-  0x00,0x03,0x00,0x00,0x02,0x10,0x5B,0x09,0x16,0x02,0x02,0x15,0x14,0x5F,0x05,0x05,
-  0x0D,0x02,0x5F,0x03,0x03,0x0D,0x60,0x00,0x12,0x00,0x3F,0xE1,0x3F,0xE1,0x12,0x39,
-  0x2F,0xE1,0x11,0x01,0x33,0x2F,0x10,0xDE,0xE1,0x11,0x39,0x2F,0x5D,0xE1,0x32,0x31,
-  0x30,0x21,0x11,0x21,0x35,0x21,0x11,0x33,0x20,0x04,0x15,0x14,0x04,0x21,0x27,0x33,
-  0x20,0x11,0x34,0x26,0x23,0x23,0x01,0x46,0xFE,0xD5,0x01,0xE5,0x44,0x01,0x0E,0x01,
-  0x23,0xFE,0xEB,0xFE,0xFE,0x5E,0x62,0x01,0x52,0xAB,0xC5,0x44,0x05,0x12,0xA4,0xFD,
-  0x98,0xDA,0xC8,0xCA,0xE2,0xA0,0x01,0x0C,0x84,0x7A,0x00,0x03,0x00,0x60,0x00,0x00,
-  0x04,0x6D,0x05,0xB6,0x00,0x09,0x00,0x11,0x00,0x15,0x00,0x53,0x40,0x35,0x49,0x0D,
-  0x01,0x0D,0xFB,0x00,0x06,0x10,0x06,0x30,0x06,0x70,0x06,0x80,0x06,0xF0,0x06,0x06,
-  0x06,0x06,0x00,0x12,0xFB,0x0F,0x15,0x3F,0x15,0x02,0x15,0x17,0x03,0x0A,0x5A,0x20,
-  0x00,0x30,0x00,0x02,0x00,0x00,0x16,0x11,0x5F,0x03,0x03,0x13,0x01,0x03,0x0A,0x60,
-  0x12,0x00,0x12,0x00,0x3F,0x32,0xE1,0x3F,0x33,0x39,0x2F,0xE1,0x11,0x01,0x33,0x2F,
-  0x5D,0xE1,0x32,0x10,0xDE,0x5D,0xE1,0x11,0x39,0x2F,0x5D,0xE1,0x5D,0x31,0x30,0x33,
-  0x11,0x33,0x11,0x33,0x20,0x11,0x14,0x04,0x23,0x27,0x33,0x20,0x11,0x34,0x26,0x23,
-  0x23,0x01,0x11,0x33,0x11,0x60,0xA6,0x2F,0x02,0x1D,0xFE,0xF9,0xFB,0x4A,0x4E,0x01,
-  0x52,0xAB,0xC6,0x2F,0x02,0xC1,0xA6,0x05,0xB6,0xFD,0x98,0xFE,0x5E,0xD0,0xDC,0xA0,
-  0x01,0x0C,0x85,0x79,0xFD,0x56,0x05,0xB6,0xFA,0x4A,0x00,0x02,0x00,0xB0,0x00,0x00,
-  0x04,0x46,0x05,0xB6,0x00,0x09,0x00,0x11,0x00,0x3C,0x40,0x10,0x0D,0x5B,0xEF,0x06,
-  0xFF,0x06,0x02,0x06,0x13,0x03,0x0A,0x5A,0x00,0x00,0x01,0x00,0xB8,0xFF,0xC0,0x40,
-  0x10,0x12,0x16,0x48,0x00,0x00,0x12,0x11,0x5F,0x03,0x03,0x01,0x03,0x0A,0x60,0x00,
-  0x12,0x00,0x3F,0xE1,0x3F,0x39,0x2F,0xE1,0x11,0x01,0x33,0x2F,0x2B,0x5D,0xE1,0x32,
-  0x10,0xDE,0x5D,0xE1,0x31,0x30,0x33,0x11,0x33,0x11,0x33,0x20,0x11,0x14,0x04,0x23,
-  0x27,0x33,0x20,0x11,0x34,0x26,0x23,0x23,0xB0,0xBA,0xBF,0x02,0x1D,0xFE,0xF9,0xFB,
-  0xDA,0xC9,0x01,0x52,0xAB,0xC6,0xAA,0x05,0xB6,0xFD,0x98,0xFE,0x5E,0xD0,0xDC,0xA0,
-  0x01,0x0C,0x85,0x79,0x00,0x01,0x00,0x44,0xFF,0xEC,0x04,0x4C,0x05,0xCB,0x00,0x17,
-  0x00,0x4A,0x40,0x2B,0x7F,0x11,0x8F,0x11,0x02,0x11,0x11,0x0B,0x13,0x10,0x5B,0xFF,
-  0x06,0x01,0x06,0x19,0x01,0x1F,0x0B,0x2F,0x0B,0x02,0x0B,0x0B,0x18,0x11,0x5F,0x68,
-  0x12,0x01,0x12,0x12,0x03,0x0E,0x5F,0x0C,0x09,0x13,0x16,0x5F,0x00,0x03,0x04,0x00,
-  0x3F,0x33,0xE1,0x3F,0x33,0xE1,0x11,0x39,0x2F,0x5D,0xE1,0x11,0x01,0x33,0x2F,0x5D,
-  0x33,0x10,0xDE,0x5D,0xE1,0x32,0x12,0x39,0x2F,0x5D,0x31,0x30,0x13,0x27,0x36,0x33,
-  0x20,0x00,0x11,0x10,0x00,0x21,0x22,0x27,0x35,0x16,0x33,0x20,0x13,0x21,0x35,0x21,
-  0x26,0x26,0x23,0x22,0x91,0x4D,0xA1,0xDE,0x01,0x30,0x01,0x59,0xFE,0xAA,0xFE,0xC4,
-  0xD4,0x92,0xC5,0x83,0x01,0xD9,0x10,0xFD,0x8B,0x02,0x71,0x13,0xED,0xBE,0x98,0x04,
-  0xD9,0x9C,0x56,0xFE,0x7B,0xFE,0xB0,0xFE,0x8B,0xFE,0x6B,0x3B,0xA2,0x3A,0x02,0x1D,
-  0xA2,0xDE,0xFB,0x00,0x00,0x02,0x00,0x62,0xFF,0xEC,0x04,0x87,0x05,0xCD,0x00,0x12,
-  0x00,0x1E,0x00,0x6E,0x40,0x2B,0x1C,0xFB,0x07,0x0F,0x00,0x2F,0x00,0x4F,0x00,0x5F,
-  0x00,0x7F,0x00,0x8F,0x00,0x06,0x00,0x40,0x15,0x18,0x48,0x00,0x00,0x03,0x16,0xFB,
-  0x0D,0x40,0x09,0x0E,0x48,0x0D,0x20,0x06,0x37,0x02,0x01,0x02,0x5A,0x66,0x03,0x01,
-  0x03,0xB8,0xFF,0xC0,0x40,0x1A,0x0B,0x0E,0x48,0x03,0x03,0x1F,0x01,0x5F,0x68,0x06,
-  0x01,0x06,0x06,0x0A,0x13,0x5F,0x10,0x13,0x19,0x5F,0x0A,0x04,0x04,0x03,0x02,0x12,
-  0x00,0x3F,0x3F,0x3F,0xE1,0x3F,0xE1,0x11,0x39,0x2F,0x5D,0xE1,0x11,0x01,0x33,0x2F,
-  0x2B,0x5D,0xE1,0x5D,0x32,0x10,0xDE,0x2B,0xE1,0x12,0x39,0x2F,0x2B,0x5D,0x33,0xE1,
-  0x31,0x30,0x01,0x23,0x11,0x23,0x11,0x33,0x11,0x33,0x12,0x12,0x33,0x32,0x12,0x11,
-  0x10,0x02,0x23,0x22,0x02,0x05,0x32,0x36,0x11,0x10,0x26,0x23,0x22,0x06,0x11,0x10,
-  0x16,0x01,0x93,0x8B,0xA6,0xA6,0x90,0x12,0xAF,0xB7,0xC0,0xB7,0xB8,0xC1,0xBE,0xB3,
-  0x01,0x71,0x6A,0x5F,0x60,0x69,0x6C,0x5E,0x5D,0x02,0xAA,0xFD,0x56,0x05,0xB6,0xFD,
-  0x98,0x01,0x5D,0x01,0x22,0xFE,0x9F,0xFE,0x71,0xFE,0x73,0xFE,0x9C,0x01,0x3B,0x98,
-  0xE9,0x01,0x65,0x01,0x68,0xE4,0xED,0xFE,0xA1,0xFE,0xA4,0xF2,0x00,0x02,0x00,0x39,
-  0x00,0x00,0x04,0x12,0x05,0xB6,0x00,0x0B,0x00,0x13,0x00,0x71,0x40,0x1F,0x0B,0x04,
-  0x1B,0x04,0x02,0x0B,0x06,0x1B,0x06,0x02,0x03,0x10,0x0C,0x11,0x48,0x03,0x00,0x05,
-  0x13,0x0A,0x5A,0x8F,0x09,0x9F,0x09,0xAF,0x09,0x03,0x09,0x15,0x01,0xB8,0xFF,0xF0,
-  0xB4,0x0C,0x11,0x48,0x01,0x02,0xB8,0xFF,0xF0,0xB7,0x02,0x02,0x0F,0x5B,0x00,0x05,
-  0x01,0x05,0xB8,0xFF,0xC0,0x40,0x13,0x13,0x16,0x48,0x05,0x05,0x14,0x03,0x00,0x60,
-  0x12,0x12,0x01,0x0D,0x60,0x07,0x03,0x0A,0x01,0x12,0x00,0x3F,0x33,0x3F,0xE1,0x12,
-  0x39,0x2F,0xE1,0x32,0x11,0x01,0x33,0x2F,0x2B,0x5D,0xE1,0x33,0x2F,0x38,0x33,0x2B,
-  0x10,0xDE,0x5D,0xE1,0x32,0x11,0x39,0x39,0x2B,0x31,0x30,0x5D,0x5D,0x01,0x01,0x23,
-  0x01,0x24,0x11,0x10,0x21,0x21,0x11,0x23,0x11,0x11,0x23,0x20,0x11,0x14,0x16,0x33,
-  0x33,0x02,0x62,0xFE,0xB2,0xDB,0x01,0x7D,0xFE,0xF0,0x01,0xF8,0x01,0x74,0xBA,0xBC,
-  0xFE,0xCA,0xA4,0x9A,0xB4,0x02,0x5C,0xFD,0xA4,0x02,0x8F,0x62,0x01,0x36,0x01,0x8F,
-  0xFA,0x4A,0x02,0x5C,0x02,0xBB,0xFF,0x00,0x89,0x94,0xFF,0xFF,0x00,0x87,0xFF,0xEC,
-  0x04,0x02,0x04,0x5E,0x02,0x06,0x00,0x44,0x00,0x00,0x00,0x02,0x00,0x8F,0xFF,0xEC,
-  0x04,0x3B,0x06,0x23,0x00,0x16,0x00,0x1F,0x00,0x3E,0x40,0x25,0x1B,0x48,0x01,0x0B,
-  0x40,0x15,0x18,0x48,0x0B,0x21,0x05,0x17,0x48,0x00,0x11,0xD0,0x11,0xE0,0x11,0xF0,
-  0x11,0x04,0x11,0x17,0x05,0x1D,0x50,0x08,0x08,0x00,0x19,0x50,0x0E,0x16,0x01,0x00,
-  0x01,0x00,0x3F,0x32,0x3F,0xE1,0x11,0x39,0x2F,0xE1,0x32,0x32,0x01,0x2F,0x5D,0xE1,
-  0x32,0x10,0xDE,0x2B,0x32,0xE1,0x31,0x30,0x01,0x17,0x04,0x06,0x06,0x07,0x33,0x36,
-  0x33,0x32,0x12,0x15,0x10,0x02,0x23,0x22,0x02,0x11,0x34,0x12,0x3E,0x02,0x01,0x10,
-  0x21,0x20,0x11,0x10,0x23,0x22,0x06,0x04,0x10,0x21,0xFE,0x73,0xCD,0x7F,0x08,0x0C,
-  0x74,0xDC,0xBA,0xD5,0xFA,0xDD,0xDB,0xFA,0x3E,0x68,0x8A,0xCA,0xFE,0xC3,0x01,0x25,
-  0x01,0x0A,0xF0,0x5F,0xB1,0x06,0x23,0xA0,0x43,0x41,0xD9,0xD2,0xAA,0xFE,0xF9,0xE5,
-  0xFE,0xFC,0xFE,0xDE,0x01,0x68,0x01,0x3F,0xD4,0x01,0x20,0xB0,0x6A,0x39,0xFC,0xB5,
-  0xFD,0xF4,0x01,0x77,0x01,0x6C,0x7F,0x00,0x00,0x03,0x00,0xB0,0x00,0x00,0x04,0x54,
-  0x04,0x4A,0x00,0x0C,0x00,0x14,0x00,0x1C,0x00,0x5B,0xB5,0x04,0x04,0x14,0x04,0x02,
-  0x0A,0xB8,0xFF,0xD0,0x40,0x31,0x09,0x0C,0x48,0x00,0x0E,0x12,0x46,0x0B,0x0B,0x19,
-  0x46,0x03,0x1E,0x0E,0x16,0x47,0x00,0x07,0x90,0x07,0xA0,0x07,0xB0,0x07,0x04,0x07,
-  0x00,0x15,0x50,0xBF,0x0E,0x01,0x89,0x0E,0x01,0x78,0x0E,0x01,0x0E,0x0E,0x16,0x0D,
-  0x50,0x08,0x0F,0x16,0x50,0x07,0x15,0x00,0x3F,0xE1,0x3F,0xE1,0x12,0x39,0x2F,0x5D,
-  0x5D,0x5D,0xE1,0x39,0x01,0x2F,0x5D,0xE1,0x32,0x10,0xDE,0xE1,0x33,0x2F,0xE1,0x12,
-  0x39,0x31,0x30,0x2B,0x5D,0x01,0x15,0x04,0x15,0x14,0x06,0x23,0x21,0x11,0x21,0x20,
-  0x11,0x14,0x01,0x11,0x21,0x32,0x36,0x35,0x34,0x23,0x01,0x11,0x21,0x32,0x35,0x34,
-  0x26,0x23,0x03,0x4C,0x01,0x08,0xD4,0xD0,0xFE,0x00,0x01,0xFE,0x01,0x83,0xFD,0x35,
-  0x01,0x25,0x86,0x72,0xD9,0xFE,0xBC,0x01,0x3E,0xFE,0x82,0x80,0x02,0x46,0x07,0x23,
-  0xDF,0x95,0xA8,0x04,0x4A,0xFE,0xEB,0xC5,0x01,0x40,0xFE,0xD7,0x48,0x54,0x8D,0xFE,
-  0x3E,0xFE,0xA8,0xB4,0x5C,0x48,0x00,0x01,0x01,0x23,0x00,0x00,0x04,0x0E,0x04,0x4A,
-  0x00,0x05,0x00,0x2E,0x40,0x1C,0x02,0x47,0x1F,0x03,0x6F,0x03,0x7F,0x03,0x8F,0x03,
-  0x04,0x7F,0x00,0x8F,0x00,0x02,0x03,0x00,0x03,0x00,0x06,0x07,0x01,0x50,0x04,0x0F,
-  0x02,0x15,0x00,0x3F,0x3F,0xE1,0x11,0x12,0x01,0x39,0x39,0x2F,0x2F,0x5D,0x5D,0xE1,
-  0x31,0x30,0x01,0x21,0x11,0x23,0x11,0x21,0x04,0x0E,0xFD,0xCB,0xB6,0x02,0xEB,0x03,
-  0xB0,0xFC,0x50,0x04,0x4A,0x00,0x00,0x02,0x00,0x21,0xFE,0x83,0x04,0x68,0x04,0x4A,
-  0x00,0x0C,0x00,0x11,0x00,0x74,0x40,0x09,0x28,0x08,0x01,0x09,0x08,0x19,0x08,0x02,
-  0x11,0xB8,0xFF,0xF0,0xB3,0x0F,0x18,0x48,0x11,0xB8,0xFF,0xE0,0x40,0x35,0x0B,0x0E,
-  0x48,0x11,0x07,0x0F,0x09,0x50,0x09,0x80,0x09,0x02,0x12,0x09,0x01,0x07,0x09,0x07,
-  0x09,0x05,0x0B,0x01,0x46,0x00,0x00,0x0D,0x47,0x4F,0x0B,0x5F,0x0B,0x6F,0x0B,0x03,
-  0x0B,0x13,0x04,0x47,0x05,0x0F,0x4E,0x09,0x0F,0x11,0x0B,0x06,0x50,0x03,0x01,0x04,
-  0x04,0x03,0x15,0x00,0x3F,0x33,0x2F,0x33,0x10,0xE1,0x32,0x32,0x3F,0xE1,0x01,0x2F,
-  0xE1,0x10,0xDC,0x5D,0xE1,0x33,0x2F,0xE1,0x11,0x12,0x39,0x39,0x2F,0x2F,0x5D,0x5D,
-  0x11,0x33,0x11,0x33,0x2B,0x2B,0x31,0x30,0x5D,0x5D,0x01,0x23,0x11,0x21,0x11,0x23,
-  0x11,0x33,0x00,0x13,0x21,0x11,0x33,0x21,0x11,0x23,0x02,0x03,0x04,0x68,0xB0,0xFD,
-  0x19,0xB0,0x56,0x01,0x06,0x04,0x02,0x50,0x97,0xFE,0xB3,0xFA,0x24,0xC6,0xFE,0x83,
-  0x01,0x7D,0xFE,0x83,0x02,0x17,0x01,0x85,0x02,0x2B,0xFC,0x50,0x03,0x24,0xFE,0x1F,
-  0xFE,0xBD,0xFF,0xFF,0x00,0x85,0xFF,0xEC,0x04,0x48,0x04,0x5E,0x02,0x06,0x00,0x48,
-  0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x04,0xCD,0x04,0x4A,0x00,0x11,0x01,0x08,
-  0x40,0x8C,0x69,0x0F,0x79,0x0F,0x89,0x0F,0x03,0x4B,0x0F,0x5B,0x0F,0x02,0x29,0x0F,
-  0x39,0x0F,0x02,0x1A,0x0F,0x01,0x09,0x0F,0x01,0x66,0x06,0x76,0x06,0x86,0x06,0x03,
-  0x44,0x06,0x54,0x06,0x02,0x26,0x06,0x36,0x06,0x02,0x15,0x06,0x01,0x06,0x06,0x01,
-  0xA6,0x06,0x01,0x06,0x03,0xF7,0x0A,0x01,0x56,0x0A,0x66,0x0A,0x02,0x17,0x0A,0x37,
-  0x0A,0x47,0x0A,0x03,0x06,0x0A,0x01,0x0A,0x47,0xA9,0x0F,0x01,0x0F,0x00,0x18,0x0B,
-  0x01,0x09,0x0B,0x01,0x0B,0x0B,0x0E,0x07,0x68,0x04,0x78,0x04,0x88,0x04,0x03,0x04,
-  0x10,0x0B,0x0E,0x48,0x04,0x05,0x10,0x05,0x05,0x88,0x08,0x01,0x08,0x10,0x0B,0x10,
-  0x48,0x08,0x10,0x07,0x40,0x07,0x50,0x07,0x90,0x07,0xA0,0x07,0xC0,0x07,0xD0,0x07,
-  0x07,0x07,0x10,0x07,0x07,0x13,0x67,0x11,0x77,0x11,0x87,0x11,0x03,0x11,0xB8,0xFF,
-  0xF0,0xB4,0x0B,0x0E,0x48,0x11,0x10,0xB8,0xFF,0xF0,0xB5,0x10,0x10,0x87,0x0D,0x01,
-  0x0D,0xB8,0xFF,0xF0,0xB4,0x0B,0x10,0x48,0x0D,0x0E,0xB8,0xFF,0xF0,0x40,0x12,0x0E,
-  0x0E,0x12,0x09,0x0C,0x03,0x00,0x0C,0x00,0x01,0x0E,0x0B,0x07,0x15,0x10,0x04,0x01,
-  0x0F,0x00,0x3F,0x33,0x33,0x3F,0x33,0x33,0x12,0x39,0x39,0x11,0x33,0x11,0x33,0x11,
-  0x01,0x33,0x2F,0x38,0x33,0x2B,0x5D,0x33,0x2F,0x38,0x33,0x2B,0x5D,0x11,0x33,0x2F,
-  0x38,0x5D,0x33,0x2B,0x5D,0x33,0x2F,0x38,0x33,0x2B,0x5D,0x11,0x12,0x39,0x2F,0x5D,
-  0x5D,0x33,0x33,0x5D,0xE1,0x5D,0x5D,0x5D,0x5D,0x32,0x32,0x5D,0x31,0x30,0x5D,0x5D,
-  0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x01,0x11,0x33,0x11,0x01,0x33,0x01,0x01,
-  0x23,0x01,0x11,0x23,0x11,0x01,0x23,0x01,0x01,0x33,0x02,0x17,0x9F,0x01,0x5E,0xB9,
-  0xFE,0x91,0x01,0x6D,0xC3,0xFE,0xAE,0x9F,0xFE,0xAE,0xC3,0x01,0x6F,0xFE,0x8F,0xB8,
-  0x02,0x35,0x02,0x15,0xFD,0xEB,0x02,0x15,0xFD,0xEB,0xFD,0xCB,0x02,0x2D,0xFD,0xD3,
-  0x02,0x2D,0xFD,0xD3,0x02,0x35,0x02,0x15,0x00,0x01,0x00,0xC9,0xFF,0xEC,0x04,0x08,
-  0x04,0x5E,0x00,0x20,0x00,0x57,0x40,0x33,0x0F,0x0D,0x20,0x20,0x08,0x03,0x46,0x0D,
-  0x0D,0x1C,0x46,0x12,0x22,0x08,0x00,0x17,0x60,0x17,0x70,0x17,0x80,0x17,0x04,0x17,
-  0x17,0x21,0x0F,0x1F,0x50,0xBF,0x20,0x01,0x89,0x20,0x01,0x78,0x20,0x01,0x20,0x20,
-  0x0A,0x1A,0x50,0x18,0x15,0x16,0x07,0x05,0x50,0x0A,0x10,0x00,0x3F,0xE1,0x33,0x3F,
-  0x33,0xE1,0x11,0x39,0x2F,0x5D,0x5D,0x5D,0xE1,0x39,0x11,0x01,0x33,0x2F,0x5D,0x33,
-  0x10,0xDE,0xE1,0x33,0x2F,0xE1,0x11,0x39,0x2F,0x12,0x39,0x31,0x30,0x01,0x32,0x36,
-  0x35,0x34,0x23,0x22,0x07,0x27,0x36,0x33,0x32,0x16,0x15,0x14,0x07,0x15,0x16,0x15,
-  0x14,0x06,0x23,0x22,0x27,0x35,0x16,0x33,0x20,0x35,0x34,0x21,0x23,0x35,0x01,0xFA,
-  0xAC,0x91,0xFA,0x86,0xAF,0x3F,0xA0,0xD2,0xCD,0xDD,0xC0,0xE3,0xF1,0xE0,0xEB,0x7F,
-  0xB4,0xBA,0x01,0x1B,0xFE,0xC9,0x96,0x02,0x87,0x4F,0x57,0x9A,0x48,0x93,0x4C,0x95,
-  0x8C,0xBA,0x39,0x0B,0x41,0xCF,0x97,0xAC,0x45,0xA6,0x56,0xB4,0xB9,0x99,0x00,0x01,
-  0x00,0xA0,0x00,0x00,0x04,0x2D,0x04,0x4A,0x00,0x0B,0x00,0x84,0xB9,0x00,0x09,0xFF,
-  0xF0,0xB3,0x12,0x18,0x48,0x09,0xB8,0xFF,0xE0,0x40,0x50,0x0B,0x0E,0x48,0x05,0x09,
-  0x15,0x09,0x02,0x03,0x10,0x12,0x18,0x48,0x03,0x20,0x0B,0x0E,0x48,0x0A,0x03,0x1A,
-  0x03,0x02,0x8B,0x08,0x01,0x69,0x08,0x79,0x08,0x02,0x84,0x02,0x01,0x66,0x02,0x76,
-  0x02,0x02,0x08,0x88,0x03,0x01,0x69,0x03,0x01,0x03,0x06,0x46,0x90,0x05,0xA0,0x05,
-  0x02,0x05,0x0D,0x87,0x09,0x01,0x66,0x09,0x01,0x09,0x02,0x00,0x46,0x00,0x0B,0xB0,
-  0x0B,0x02,0x0B,0x08,0x03,0x0B,0x0F,0x06,0x02,0x0A,0x15,0x00,0x3F,0x33,0x33,0x3F,
-  0x33,0x33,0x01,0x2F,0x5D,0xE1,0x32,0x32,0x5D,0x5D,0x10,0xDE,0x5D,0xE1,0x32,0x5D,
-  0x5D,0x32,0x31,0x30,0x00,0x5D,0x5D,0x5D,0x5D,0x01,0x5D,0x2B,0x2B,0x5D,0x2B,0x2B,
-  0x01,0x11,0x07,0x01,0x33,0x11,0x23,0x11,0x13,0x01,0x23,0x11,0x01,0x4C,0x0D,0x02,
-  0x05,0xE9,0xAC,0x0A,0xFD,0xFE,0xE9,0x04,0x4A,0xFD,0x64,0xFC,0x03,0x98,0xFB,0xB6,
-  0x02,0x87,0x01,0x0F,0xFC,0x6A,0x04,0x4A,0xFF,0xFF,0x00,0xA0,0x00,0x00,0x04,0x2D,
-  0x06,0x17,0x02,0x26,0x01,0xD2,0x00,0x00,0x01,0x06,0x02,0x36,0x25,0x00,0x00,0x1F,
-  0x40,0x14,0x01,0x0E,0x11,0x26,0x01,0xB0,0x11,0x01,0x80,0x11,0x01,0x70,0x11,0x01,
-  0x24,0x11,0x0C,0x0A,0x04,0x25,0x01,0x2B,0x5D,0x5D,0x5D,0x35,0x00,0x2B,0x35,0x00,
-  0x00,0x01,0x00,0xD7,0x00,0x00,0x04,0x96,0x04,0x4A,0x00,0x0A,0x00,0x8B,0x40,0x4E,
-  0x58,0x04,0x01,0x04,0x10,0x0A,0x0D,0x48,0xE6,0x02,0xF6,0x02,0x02,0xD4,0x02,0x01,
-  0x96,0x02,0xA6,0x02,0xC6,0x02,0x03,0x85,0x02,0x01,0x76,0x02,0x01,0x65,0x02,0x01,
-  0x46,0x02,0x56,0x02,0x02,0x35,0x02,0x01,0x16,0x02,0x26,0x02,0x02,0x07,0x02,0x01,
-  0x58,0x00,0x01,0x00,0x10,0x0A,0x0D,0x48,0x06,0x0A,0x01,0x09,0x05,0x01,0x00,0x01,
-  0x01,0x04,0x03,0x0C,0x0A,0x02,0x06,0x47,0x00,0x07,0xF0,0x07,0x02,0x07,0xB8,0xFF,
-  0xC0,0x40,0x0E,0x0F,0x14,0x48,0x07,0x05,0x0A,0x02,0x03,0x07,0x03,0x15,0x08,0x00,
-  0x0F,0x00,0x3F,0x32,0x3F,0x33,0x17,0x39,0x01,0x2F,0x2B,0x5D,0xE1,0x32,0x32,0x10,
-  0xCE,0x32,0x32,0x2F,0x33,0x31,0x30,0x00,0x5D,0x5D,0x01,0x2B,0x5D,0x5D,0x5D,0x5D,
-  0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x2B,0x5D,0x01,0x33,0x01,0x01,0x23,0x01,0x11,
-  0x23,0x11,0x33,0x11,0x03,0x91,0xDE,0xFD,0xF1,0x02,0x36,0xE8,0xFD,0xDD,0xB4,0xB4,
-  0x04,0x4A,0xFD,0xF1,0xFD,0xC5,0x02,0x2D,0xFD,0xD3,0x04,0x4A,0xFD,0xEB,0x00,0x01,
-  0x00,0x1F,0xFF,0xF2,0x04,0x10,0x04,0x4A,0x00,0x0F,0x00,0xCE,0x40,0x0B,0x0C,0x20,
-  0x14,0x18,0x48,0x99,0x0C,0xA9,0x0C,0x02,0x05,0xB8,0xFF,0xF0,0x40,0x6F,0x15,0x18,
-  0x48,0xB5,0x05,0x01,0xA6,0x05,0x01,0x95,0x05,0x01,0x54,0x05,0x64,0x05,0x02,0x32,
-  0x05,0x42,0x05,0x02,0x04,0x05,0x14,0x05,0x24,0x05,0x03,0x04,0x20,0x0C,0x18,0x48,
-  0x09,0x04,0x19,0x04,0x29,0x04,0x03,0x04,0x03,0x99,0x03,0x01,0x78,0x03,0x88,0x03,
-  0x02,0x39,0x03,0x49,0x03,0x69,0x03,0x03,0x03,0xEB,0x0D,0xFB,0x0D,0x02,0xCA,0x0D,
-  0xDA,0x0D,0x02,0x99,0x0D,0xA9,0x0D,0xB9,0x0D,0x03,0x8A,0x0D,0x01,0x0D,0x20,0x0D,
-  0x10,0x48,0x19,0x0D,0x29,0x0D,0x39,0x0D,0x03,0x08,0x0D,0x01,0x0D,0xC0,0x0E,0xD0,
-  0x0E,0x02,0xA1,0x0E,0x01,0x10,0x0E,0x20,0x0E,0x30,0x0E,0x03,0x0E,0xB8,0xFF,0xC0,
-  0x40,0x19,0x0F,0x12,0x48,0x0E,0x0E,0x08,0x01,0x47,0x8F,0x00,0x01,0x00,0x11,0x08,
-  0x03,0x50,0x0E,0x0F,0x0B,0x4F,0x09,0x06,0x16,0x00,0x15,0x00,0x3F,0x3F,0x33,0xE1,
-  0x3F,0xE1,0x01,0x2F,0x10,0xDE,0x5D,0xE1,0x12,0x39,0x2F,0x2B,0x5D,0x5D,0x5D,0x33,
-  0x5D,0x5D,0x2B,0x5D,0x5D,0x5D,0x5D,0x33,0x5D,0x5D,0x5D,0x11,0x33,0x5D,0x2B,0x31,
-  0x30,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x2B,0x5D,0x2B,0x21,0x23,0x11,0x21,0x02,0x02,
-  0x23,0x22,0x27,0x35,0x16,0x33,0x32,0x12,0x13,0x21,0x04,0x10,0xB6,0xFE,0xAC,0x25,
-  0xB2,0xB4,0x3E,0x1E,0x15,0x1C,0x6F,0x87,0x24,0x02,0xA6,0x03,0xB0,0xFE,0x13,0xFE,
-  0x2F,0x0C,0x83,0x06,0x01,0xDB,0x01,0xF4,0x00,0x01,0x00,0x73,0x00,0x00,0x04,0x5A,
-  0x04,0x4A,0x00,0x18,0x00,0xBB,0x40,0x1B,0x18,0x08,0x48,0x08,0x02,0x17,0x07,0x47,
-  0x07,0x02,0xEA,0x08,0xFA,0x08,0x02,0x08,0x08,0x11,0x14,0x48,0x08,0xE5,0x07,0xF5,
-  0x07,0x02,0x07,0xB8,0xFF,0xF8,0x40,0x37,0x11,0x14,0x48,0x07,0x12,0x12,0x0D,0xDA,
-  0x17,0xEA,0x17,0xFA,0x17,0x03,0x17,0x10,0x11,0x15,0x48,0x5C,0x17,0x6C,0x17,0x7C,
-  0x17,0x03,0x3A,0x17,0x4A,0x17,0x02,0x19,0x17,0x29,0x17,0x02,0x17,0x01,0x49,0xB0,
-  0x00,0x01,0x0F,0x00,0x01,0x00,0x1A,0xD5,0x0F,0xE5,0x0F,0xF5,0x0F,0x03,0x0F,0xB8,
-  0xFF,0xF0,0x40,0x30,0x11,0x15,0x48,0x53,0x0F,0x63,0x0F,0x73,0x0F,0x03,0x35,0x0F,
-  0x45,0x0F,0x02,0x16,0x0F,0x26,0x0F,0x02,0x0F,0x0C,0x49,0x00,0x0D,0x10,0x0D,0x40,
-  0x0D,0x50,0x0D,0x70,0x0D,0x80,0x0D,0x06,0x0D,0x02,0x0B,0x0B,0x17,0x0E,0x0F,0x12,
-  0x08,0x01,0x0D,0x15,0x00,0x3F,0x33,0x33,0x33,0x3F,0x33,0x33,0x11,0x33,0x01,0x2F,
-  0x5D,0xE1,0x32,0x5D,0x5D,0x5D,0x2B,0x5D,0x10,0xDE,0x5D,0x5D,0xE1,0x32,0x5D,0x5D,
-  0x5D,0x2B,0x5D,0x12,0x39,0x3D,0x2F,0x33,0x2B,0x5D,0x33,0x2B,0x5D,0x31,0x30,0x5D,
-  0x5D,0x21,0x23,0x11,0x06,0x07,0x06,0x07,0x03,0x23,0x03,0x26,0x27,0x11,0x23,0x11,
-  0x33,0x13,0x16,0x17,0x36,0x37,0x36,0x37,0x13,0x33,0x04,0x5A,0x97,0x08,0x19,0x16,
-  0x0D,0xD5,0x87,0xD5,0x08,0x3C,0x97,0xD3,0xD7,0x19,0x30,0x05,0x30,0x0A,0x0B,0xDB,
-  0xCF,0x03,0x81,0x1B,0x64,0x55,0x26,0xFD,0x79,0x02,0x87,0x19,0xE1,0xFC,0x7F,0x04,
-  0x4A,0xFD,0x70,0x4D,0xBF,0x0D,0xB2,0x27,0x22,0x02,0x94,0x00,0x00,0x01,0x00,0xA0,
-  0x00,0x00,0x04,0x2D,0x04,0x4A,0x00,0x0B,0x00,0x3F,0x40,0x26,0x02,0x06,0x47,0x90,
-  0x05,0xA0,0x05,0x02,0x05,0x0D,0x01,0x09,0x47,0x00,0x0A,0xB0,0x0A,0x02,0x0A,0x08,
-  0x50,0xBF,0x01,0x01,0x89,0x01,0x01,0x78,0x01,0x01,0x01,0x01,0x0A,0x05,0x15,0x03,
-  0x00,0x0F,0x00,0x3F,0x32,0x3F,0x33,0x39,0x2F,0x5D,0x5D,0x5D,0xE1,0x01,0x2F,0x5D,
-  0xE1,0x32,0x10,0xDE,0x5D,0xE1,0x32,0x31,0x30,0x01,0x11,0x21,0x11,0x33,0x11,0x23,
-  0x11,0x21,0x11,0x23,0x11,0x01,0x56,0x02,0x21,0xB6,0xB6,0xFD,0xDF,0xB6,0x04,0x4A,
-  0xFE,0x39,0x01,0xC7,0xFB,0xB6,0x01,0xE9,0xFE,0x17,0x04,0x4A,0xFF,0xFF,0x00,0x73,
-  0xFF,0xEC,0x04,0x58,0x04,0x5E,0x02,0x06,0x00,0x52,0x00,0x00,0x00,0x01,0x00,0xA0,
-  0x00,0x00,0x04,0x2D,0x04,0x4A,0x00,0x07,0x00,0x29,0x40,0x18,0x05,0x47,0x90,0x04,
-  0xA0,0x04,0x02,0x04,0x09,0x00,0x47,0x00,0x01,0xB0,0x01,0x02,0x01,0x07,0x50,0x02,
-  0x0F,0x05,0x00,0x15,0x00,0x3F,0x32,0x3F,0xE1,0x01,0x2F,0x5D,0xE1,0x10,0xDE,0x5D,
-  0xE1,0x31,0x30,0x21,0x23,0x11,0x21,0x11,0x23,0x11,0x21,0x01,0x56,0xB6,0x03,0x8D,
-  0xB6,0xFD,0xDF,0x04,0x4A,0xFB,0xB6,0x03,0xB0,0x00,0xFF,0xFF,0x00,0x9E,0xFE,0x14,
-  0x04,0x44,0x04,0x5E,0x02,0x06,0x00,0x53,0x00,0x00,0xFF,0xFF,0x00,0xAC,0xFF,0xEC,
-  0x04,0x25,0x04,0x5E,0x02,0x06,0x00,0x46,0x00,0x00,0x00,0x01,0x00,0x79,0x00,0x00,
-  0x04,0x52,0x04,0x4A,0x00,0x07,0x00,0x3C,0x40,0x25,0x9F,0x00,0xAF,0x00,0x02,0x00,
-  0x00,0x02,0x47,0x03,0xE0,0x05,0x01,0x05,0x05,0x10,0x03,0x90,0x03,0xA0,0x03,0xC0,
-  0x03,0xD0,0x03,0x05,0x03,0x03,0x08,0x09,0x01,0x05,0x50,0x06,0x0F,0x02,0x15,0x00,
-  0x3F,0x3F,0xE1,0x32,0x11,0x12,0x01,0x39,0x2F,0x5D,0x33,0x2F,0x5D,0x10,0xE1,0x32,
-  0x2F,0x5D,0x31,0x30,0x01,0x21,0x11,0x23,0x11,0x21,0x35,0x21,0x04,0x52,0xFE,0x6F,
-  0xB7,0xFE,0x6F,0x03,0xD9,0x03,0xB0,0xFC,0x50,0x03,0xB0,0x9A,0xFF,0xFF,0x00,0x52,
-  0xFE,0x14,0x04,0x79,0x04,0x4A,0x02,0x06,0x00,0x5C,0x00,0x00,0x00,0x03,0x00,0x4A,
-  0xFE,0x14,0x04,0x81,0x06,0x14,0x00,0x0D,0x00,0x12,0x00,0x17,0x00,0x5D,0x40,0x3B,
-  0x14,0x00,0x56,0x05,0x66,0x05,0x02,0x47,0x05,0x01,0x05,0x49,0x0E,0x0B,0x06,0x06,
-  0x09,0x16,0x49,0x0F,0x02,0x01,0x02,0x19,0x11,0x49,0x50,0x09,0x90,0x09,0xA0,0x09,
-  0xC0,0x09,0xD0,0x09,0x05,0x2F,0x09,0x3F,0x09,0x02,0x09,0x0C,0x00,0x13,0x0F,0x50,
-  0x00,0x0B,0x10,0x14,0x0E,0x50,0x04,0x07,0x16,0x05,0x1B,0x00,0x3F,0x3F,0x33,0xE1,
-  0x32,0x3F,0x33,0xE1,0x32,0x3F,0x01,0x2F,0x5D,0x5D,0xE1,0x10,0xDE,0x5D,0xE1,0x11,
-  0x39,0x2F,0x33,0x33,0xE1,0x5D,0x5D,0x32,0x32,0x31,0x30,0x01,0x04,0x11,0x10,0x05,
-  0x11,0x23,0x11,0x24,0x11,0x10,0x25,0x11,0x33,0x03,0x11,0x04,0x11,0x10,0x01,0x11,
-  0x24,0x11,0x10,0x02,0xB6,0x01,0xCB,0xFE,0x35,0x9D,0xFE,0x31,0x01,0xCF,0x9D,0x9D,
-  0xFE,0xD9,0x01,0xC4,0x01,0x23,0x04,0x5A,0x32,0xFD,0xFF,0xFD,0xF3,0x2A,0xFE,0x24,
-  0x01,0xDC,0x2D,0x02,0x0A,0x02,0x0A,0x29,0x01,0xBA,0xFA,0x73,0x03,0x3C,0x1D,0xFE,
-  0x81,0xFE,0x7E,0x03,0x1C,0xFC,0xC6,0x21,0x01,0x7F,0x01,0x79,0xFF,0xFF,0x00,0x60,
-  0x00,0x00,0x04,0x6A,0x04,0x4A,0x02,0x06,0x00,0x5B,0x00,0x00,0x00,0x01,0x00,0x98,
-  0xFE,0x83,0x04,0x9C,0x04,0x4A,0x00,0x0B,0x00,0x38,0x40,0x20,0x01,0x47,0x00,0x00,
-  0x07,0x47,0x6F,0x0A,0x7F,0x0A,0x8F,0x0A,0x03,0x0A,0x0D,0x06,0x47,0x00,0x03,0x01,
-  0x03,0x08,0x04,0x0F,0x0A,0x06,0x50,0x03,0x01,0x01,0x03,0x15,0x00,0x3F,0x33,0x2F,
-  0x10,0xE1,0x32,0x3F,0x33,0x01,0x2F,0x5D,0xE1,0x10,0xDC,0x5D,0xE1,0x33,0x2F,0xE1,
-  0x31,0x30,0x01,0x23,0x11,0x21,0x11,0x33,0x11,0x21,0x11,0x33,0x11,0x33,0x04,0x9C,
-  0xB0,0xFC,0xAC,0xB6,0x01,0xF8,0xB6,0xA0,0xFE,0x83,0x01,0x7D,0x04,0x4A,0xFC,0x50,
-  0x03,0xB0,0xFC,0x50,0x00,0x01,0x00,0x98,0x00,0x00,0x04,0x25,0x04,0x4A,0x00,0x10,
-  0x00,0x2F,0x40,0x19,0x05,0x09,0x47,0x90,0x08,0x01,0x08,0x12,0x01,0x47,0x00,0x0F,
-  0x01,0x0F,0x0A,0x05,0x03,0x50,0x0C,0x0C,0x08,0x15,0x06,0x00,0x0F,0x00,0x3F,0x32,
-  0x3F,0x39,0x2F,0xE1,0x32,0x32,0x01,0x2F,0x5D,0xE1,0x10,0xDE,0x5D,0xE1,0x32,0x31,
-  0x30,0x01,0x11,0x14,0x33,0x32,0x37,0x11,0x33,0x11,0x23,0x11,0x06,0x23,0x22,0x26,
-  0x35,0x11,0x01,0x4E,0xCD,0xAB,0xA9,0xB6,0xB6,0xB5,0xC8,0xA0,0xBA,0x04,0x4A,0xFE,
-  0x66,0xAE,0x73,0x01,0xD5,0xFB,0xB6,0x01,0xE9,0x7F,0xAF,0x8B,0x01,0xA6,0x00,0x01,
-  0x00,0x7D,0x00,0x00,0x04,0x52,0x04,0x4A,0x00,0x0B,0x00,0x5A,0x40,0x3F,0x46,0x00,
-  0x56,0x00,0x66,0x00,0x03,0x00,0x49,0x09,0x09,0x05,0x37,0x01,0xF7,0x01,0x02,0x01,
-  0x49,0xC0,0x04,0xD0,0x04,0x02,0x0F,0x04,0x3F,0x04,0x02,0x04,0x0D,0x38,0x08,0xF8,
-  0x08,0x02,0x08,0x49,0x00,0x05,0x10,0x05,0x30,0x05,0x40,0x05,0x50,0x05,0x90,0x05,
-  0xA0,0x05,0x07,0x05,0x00,0x08,0x50,0x05,0x15,0x0A,0x06,0x02,0x0F,0x00,0x3F,0x33,
-  0x33,0x3F,0xE1,0x32,0x01,0x2F,0x5D,0xE1,0x5D,0x10,0xDE,0x5D,0x5D,0xE1,0x5D,0x11,
-  0x39,0x2F,0xE1,0x5D,0x31,0x30,0x25,0x33,0x11,0x33,0x11,0x21,0x11,0x33,0x11,0x33,
-  0x11,0x33,0x02,0xB8,0xF8,0xA2,0xFC,0x2B,0xA2,0xF8,0xA1,0x9A,0x03,0xB0,0xFB,0xB6,
-  0x04,0x4A,0xFC,0x50,0x03,0xB0,0x00,0x01,0x00,0x6D,0xFE,0x83,0x04,0xB8,0x04,0x4A,
-  0x00,0x0F,0x00,0x6D,0x40,0x49,0x07,0x49,0x06,0x06,0x04,0x46,0x00,0x56,0x00,0x66,
-  0x00,0x03,0x00,0x49,0x0D,0x0D,0x09,0x37,0x01,0xF7,0x01,0x02,0x01,0x49,0xEF,0x04,
-  0xFF,0x04,0x02,0xC0,0x04,0x01,0x0F,0x04,0x3F,0x04,0x02,0x04,0x11,0x38,0x0C,0xF8,
-  0x0C,0x02,0x0C,0x49,0x10,0x09,0x30,0x09,0x40,0x09,0x50,0x09,0x90,0x09,0xA0,0x09,
-  0x06,0x09,0x04,0x00,0x0C,0x50,0x09,0x07,0x07,0x09,0x15,0x0E,0x0A,0x02,0x0F,0x00,
-  0x3F,0x33,0x33,0x3F,0x33,0x2F,0x10,0xE1,0x32,0x32,0x01,0x2F,0x5D,0xE1,0x5D,0x10,
-  0xDC,0x5D,0x5D,0x5D,0xE1,0x5D,0x11,0x39,0x2F,0xE1,0x5D,0x11,0x33,0x2F,0xE1,0x31,
-  0x30,0x25,0x33,0x11,0x33,0x11,0x33,0x11,0x23,0x11,0x21,0x11,0x33,0x11,0x33,0x11,
-  0x33,0x02,0xA8,0xF8,0xA2,0x76,0xA1,0xFC,0x56,0xA1,0xF8,0xA2,0x9A,0x03,0xB0,0xFC,
-  0x50,0xFD,0xE9,0x01,0x7D,0x04,0x4A,0xFC,0x50,0x03,0xB0,0x00,0x00,0x02,0x00,0x2B,
-  0x00,0x00,0x04,0x83,0x04,0x4A,0x00,0x0A,0x00,0x12,0x00,0x43,0x40,0x29,0x00,0x0C,
-  0x47,0xB0,0x06,0xC0,0x06,0xD0,0x06,0x03,0x06,0x06,0x08,0x0F,0x49,0x03,0x14,0xCF,
-  0x08,0xDF,0x08,0xEF,0x08,0x03,0x08,0x0B,0x50,0xBF,0x00,0x01,0x00,0x00,0x0C,0x08,
-  0x50,0x09,0x0F,0x0C,0x50,0x06,0x15,0x00,0x3F,0xE1,0x3F,0xE1,0x12,0x39,0x2F,0x5D,
-  0xE1,0x01,0x2F,0x5D,0x10,0xDE,0xE1,0x11,0x39,0x2F,0x5D,0xE1,0x32,0x31,0x30,0x01,
-  0x33,0x20,0x11,0x10,0x21,0x21,0x11,0x21,0x35,0x21,0x11,0x11,0x33,0x32,0x35,0x34,
-  0x26,0x23,0x02,0x4A,0x99,0x01,0xA0,0xFE,0x5C,0xFE,0xB4,0xFE,0x98,0x02,0x1F,0x89,
-  0xFE,0x76,0x8C,0x02,0x87,0xFE,0xC9,0xFE,0xB0,0x03,0xB0,0x9A,0xFD,0xA4,0xFE,0xA8,
-  0xAC,0x5A,0x52,0x00,0x00,0x03,0x00,0x71,0x00,0x00,0x04,0x5A,0x04,0x4A,0x00,0x08,
-  0x00,0x10,0x00,0x14,0x00,0x63,0x40,0x42,0x49,0x0D,0x59,0x0D,0x69,0x0D,0x03,0x0D,
-  0x49,0x60,0x03,0x70,0x03,0x80,0x03,0x03,0x06,0x03,0x01,0x03,0x03,0x06,0x37,0x12,
-  0xF7,0x12,0x02,0x12,0x49,0x38,0x11,0x01,0x11,0x16,0x00,0x38,0x0A,0xF8,0x0A,0x02,
-  0x0A,0x49,0x37,0x06,0x01,0x00,0x06,0x10,0x06,0x02,0x06,0x09,0x50,0xBF,0x00,0x01,
-  0x00,0x00,0x13,0x07,0x0F,0x0A,0x50,0x12,0x06,0x15,0x00,0x3F,0x33,0xE1,0x3F,0x33,
-  0x39,0x2F,0x5D,0xE1,0x01,0x2F,0x5D,0x5D,0xE1,0x5D,0x32,0x10,0xDE,0x5D,0xE1,0x5D,
-  0x11,0x39,0x2F,0x5D,0x5D,0xE1,0x5D,0x31,0x30,0x01,0x33,0x20,0x11,0x10,0x21,0x21,
-  0x11,0x33,0x11,0x11,0x33,0x32,0x35,0x34,0x26,0x23,0x01,0x23,0x11,0x33,0x01,0x12,
-  0x86,0x01,0x9F,0xFE,0x5C,0xFE,0xDE,0xA1,0x8A,0xFE,0x76,0x8C,0x02,0xC2,0xA2,0xA2,
-  0x02,0x87,0xFE,0xC9,0xFE,0xB0,0x04,0x4A,0xFD,0xA4,0xFE,0xA8,0xAC,0x5A,0x52,0xFE,
-  0x12,0x04,0x4A,0x00,0x00,0x02,0x00,0xD9,0x00,0x00,0x04,0x44,0x04,0x4A,0x00,0x08,
-  0x00,0x10,0x00,0x3E,0x40,0x12,0x0D,0x46,0xEF,0x03,0xFF,0x03,0x02,0x03,0x12,0x00,
-  0x0A,0x47,0x00,0x06,0xF0,0x06,0x02,0x06,0xB8,0xFF,0xC0,0x40,0x11,0x0F,0x14,0x48,
-  0x06,0x09,0x50,0xBF,0x00,0x01,0x00,0x00,0x07,0x0F,0x0A,0x50,0x06,0x15,0x00,0x3F,
-  0xE1,0x3F,0x39,0x2F,0x5D,0xE1,0x01,0x2F,0x2B,0x5D,0xE1,0x32,0x10,0xDE,0x5D,0xE1,
-  0x31,0x30,0x01,0x21,0x20,0x11,0x10,0x21,0x21,0x11,0x33,0x11,0x11,0x21,0x32,0x35,
-  0x34,0x26,0x23,0x01,0x8F,0x01,0x15,0x01,0xA0,0xFE,0x5C,0xFE,0x39,0xB6,0x01,0x04,
-  0xFE,0x76,0x8C,0x02,0x87,0xFE,0xC9,0xFE,0xB0,0x04,0x4A,0xFD,0xA4,0xFE,0xA8,0xAC,
-  0x5A,0x52,0x00,0x01,0x00,0xB8,0xFF,0xEC,0x04,0x25,0x04,0x5E,0x00,0x16,0x00,0x69,
-  0xB6,0x36,0x01,0x01,0x39,0x0C,0x01,0x14,0xB8,0xFF,0xE0,0xB3,0x09,0x0C,0x48,0x10,
-  0xB8,0xFF,0xE0,0x40,0x31,0x09,0x0C,0x48,0x07,0x07,0x00,0x08,0x05,0x48,0x90,0x12,
-  0x01,0x12,0x18,0x0D,0x00,0x00,0x80,0x00,0x02,0x00,0x00,0x17,0x06,0x51,0x2F,0x07,
-  0xBF,0x07,0x02,0x89,0x07,0x01,0x78,0x07,0x01,0x07,0x07,0x0F,0x03,0x51,0x01,0x15,
-  0x16,0x0C,0x0A,0x51,0x0F,0x10,0x00,0x3F,0xE1,0x33,0x3F,0x33,0xE1,0x11,0x39,0x2F,
-  0x5D,0x5D,0x5D,0xE1,0x11,0x01,0x33,0x2F,0x5D,0x33,0x10,0xDE,0x5D,0xE1,0x32,0x12,
-  0x39,0x2F,0x31,0x30,0x2B,0x2B,0x00,0x5D,0x5D,0x37,0x35,0x16,0x33,0x20,0x13,0x21,
-  0x35,0x21,0x02,0x21,0x22,0x07,0x27,0x36,0x33,0x20,0x00,0x11,0x10,0x00,0x21,0x22,
-  0xBE,0xA3,0x99,0x01,0x5F,0x11,0xFD,0xE6,0x02,0x18,0x1B,0xFE,0xAF,0x6C,0x9A,0x3E,
-  0x99,0xB3,0x01,0x0B,0x01,0x16,0xFE,0xE2,0xFE,0xF7,0xBB,0x29,0xA0,0x3E,0x01,0x5C,
-  0x9A,0x01,0x3D,0x39,0x9E,0x3B,0xFE,0xDC,0xFE,0xE5,0xFE,0xF1,0xFE,0xDC,0x00,0x02,
-  0x00,0x7B,0xFF,0xEC,0x04,0x8D,0x04,0x5E,0x00,0x0F,0x00,0x1B,0x00,0x66,0x40,0x21,
-  0x19,0x49,0x00,0x7F,0x07,0x8F,0x07,0xCF,0x07,0xDF,0x07,0x04,0x07,0x07,0x03,0x13,
-  0x49,0x0C,0x40,0x09,0x11,0x48,0x0C,0x1D,0x06,0x38,0x02,0xF8,0x02,0x02,0x02,0x49,
-  0x03,0xB8,0xFF,0xC0,0x40,0x1E,0x09,0x11,0x48,0x03,0x01,0x50,0xBF,0x06,0x01,0x89,
-  0x06,0x01,0x78,0x06,0x01,0x06,0x06,0x09,0x10,0x50,0x0E,0x16,0x16,0x50,0x09,0x10,
-  0x04,0x0F,0x03,0x15,0x00,0x3F,0x3F,0x3F,0xE1,0x3F,0xE1,0x11,0x39,0x2F,0x5D,0x5D,
-  0x5D,0xE1,0x01,0x2F,0x2B,0xE1,0x5D,0x32,0x10,0xDE,0x2B,0xE1,0x12,0x39,0x2F,0x5D,
-  0x33,0xE1,0x31,0x30,0x01,0x23,0x11,0x23,0x11,0x33,0x11,0x33,0x12,0x21,0x32,0x12,
-  0x11,0x10,0x21,0x20,0x25,0x32,0x36,0x35,0x34,0x26,0x23,0x22,0x06,0x15,0x14,0x16,
-  0x01,0xB2,0x95,0xA2,0xA2,0x97,0x23,0x01,0x4C,0xAB,0xBF,0xFE,0x90,0xFE,0xB1,0x01,
-  0x53,0x67,0x5D,0x5C,0x6A,0x68,0x5D,0x5D,0x01,0xE9,0xFE,0x17,0x04,0x4A,0xFE,0x39,
-  0x01,0xDB,0xFE,0xD8,0xFE,0xF1,0xFD,0xC5,0x97,0xC3,0xE1,0xDA,0xC6,0xC0,0xE0,0xDD,
-  0xC7,0x00,0x00,0x02,0x00,0x73,0x00,0x00,0x04,0x0A,0x04,0x4A,0x00,0x0C,0x00,0x13,
-  0x00,0x6F,0x40,0x24,0x02,0x08,0x0F,0x12,0x48,0x29,0x02,0x01,0x18,0x02,0x01,0x09,
-  0x02,0x01,0x02,0x0C,0x04,0x0D,0x0A,0x47,0x7F,0x09,0x8F,0x09,0x02,0x09,0x15,0x57,
-  0x00,0x77,0x00,0x87,0x00,0x03,0x00,0x01,0xB8,0xFF,0xF0,0x40,0x20,0xAF,0x01,0x01,
-  0x01,0x01,0x37,0x11,0x01,0x11,0x47,0x00,0x04,0x90,0x04,0xA0,0x04,0x03,0x04,0x02,
-  0x07,0x0C,0x50,0x13,0x13,0x00,0x0F,0x50,0x07,0x0F,0x0A,0x00,0x15,0x00,0x3F,0x32,
-  0x3F,0xE1,0x12,0x39,0x2F,0xE1,0x11,0x39,0x01,0x2F,0x5D,0xE1,0x5D,0x33,0x2F,0x5D,
-  0x38,0x33,0x5D,0x10,0xDE,0x5D,0xE1,0x32,0x11,0x39,0x39,0x5D,0x5D,0x5D,0x2B,0x31,
-  0x30,0x21,0x23,0x01,0x26,0x35,0x34,0x36,0x33,0x21,0x11,0x23,0x11,0x21,0x25,0x11,
-  0x21,0x22,0x15,0x14,0x33,0x01,0x39,0xC6,0x01,0x23,0xEA,0xCC,0xAD,0x01,0xE5,0xB6,
-  0xFE,0xE3,0x01,0x1D,0xFE,0xD9,0xD3,0xEE,0x01,0xCD,0x43,0xF8,0x96,0xAC,0xFB,0xB6,
-  0x01,0xB0,0x9A,0x01,0x66,0xAC,0xBA,0x00,0xFF,0xFF,0x00,0x85,0xFF,0xEC,0x04,0x48,
-  0x05,0xD9,0x02,0x26,0x00,0x48,0x00,0x00,0x01,0x06,0x00,0x6A,0x12,0x00,0x00,0x17,
-  0x40,0x0D,0x03,0x02,0x1B,0x11,0x26,0x03,0x02,0x11,0x1D,0x21,0x0B,0x00,0x25,0x01,
-  0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,0x00,0x01,0x00,0x04,0xFE,0x14,0x04,0x2D,
-  0x06,0x14,0x00,0x22,0x00,0x62,0x40,0x3A,0x16,0x1F,0x0D,0x00,0x00,0x0D,0x05,0x47,
-  0x90,0x1F,0xA0,0x1F,0x02,0x1F,0x24,0x14,0x18,0x19,0x03,0x0C,0x47,0x11,0x00,0x0D,
-  0xB0,0x0D,0x02,0x0D,0x03,0x50,0x21,0x1B,0x19,0x08,0x50,0x1C,0x17,0x0F,0x4F,0x10,
-  0x14,0x10,0x00,0x1C,0x10,0x1C,0x20,0x1C,0x03,0x1C,0x10,0x1C,0x10,0x0D,0x12,0x00,
-  0x0D,0x15,0x00,0x3F,0x3F,0x12,0x39,0x39,0x2F,0x2F,0x5D,0x11,0x33,0x10,0xE1,0x32,
-  0x10,0xE1,0x33,0x3F,0xED,0x01,0x2F,0x5D,0x33,0xE1,0x17,0x32,0x10,0xDE,0x5D,0xE1,
-  0x11,0x39,0x2F,0x11,0x12,0x39,0x31,0x30,0x01,0x35,0x16,0x33,0x32,0x35,0x11,0x10,
-  0x23,0x22,0x06,0x15,0x11,0x23,0x11,0x23,0x35,0x33,0x35,0x33,0x15,0x21,0x15,0x21,
-  0x15,0x07,0x33,0x36,0x33,0x20,0x11,0x11,0x10,0x21,0x22,0x02,0x85,0x36,0x3D,0x7F,
-  0xEC,0xA2,0x93,0xB6,0x9C,0x9C,0xB6,0x01,0x7B,0xFE,0x85,0x08,0x0A,0x6A,0xE4,0x01,
-  0x87,0xFE,0xDD,0x51,0xFE,0x2D,0x94,0x15,0xAA,0x03,0x44,0x01,0x04,0xBB,0xD3,0xFD,
-  0xF0,0x04,0xD5,0x89,0xB6,0xB6,0x89,0xB8,0x90,0xA8,0xFE,0x6F,0xFC,0xBE,0xFE,0xB2,
-  0xFF,0xFF,0x01,0x23,0x00,0x00,0x04,0x0E,0x06,0x21,0x02,0x26,0x01,0xCD,0x00,0x00,
-  0x01,0x06,0x00,0x76,0x68,0x00,0x00,0x13,0x40,0x0B,0x01,0x0C,0x11,0x26,0x01,0x36,
-  0x06,0x09,0x03,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0x00,0x01,0x00,0xAC,
-  0xFF,0xEC,0x04,0x25,0x04,0x5E,0x00,0x16,0x00,0x5D,0x40,0x3A,0x36,0x01,0x01,0x39,
-  0x0C,0x01,0x0B,0x14,0x1B,0x14,0x02,0x0B,0x10,0x1B,0x10,0x02,0x07,0x07,0x12,0x00,
-  0x8F,0x0D,0x01,0x0D,0x18,0x05,0x08,0x48,0x00,0x12,0x01,0x12,0x08,0x51,0x2F,0x05,
-  0xBF,0x05,0x02,0x89,0x05,0x01,0x78,0x05,0x01,0x05,0x05,0x0A,0x03,0x51,0x01,0x15,
-  0x10,0x0A,0x51,0x0C,0x0F,0x16,0x00,0x3F,0x33,0xE1,0x3F,0x33,0xE1,0x12,0x39,0x2F,
-  0x5D,0x5D,0x5D,0xE1,0x01,0x2F,0x5D,0xE1,0x32,0x10,0xCE,0x5D,0x32,0x11,0x39,0x2F,
-  0x31,0x30,0x5D,0x5D,0x00,0x5D,0x5D,0x01,0x07,0x26,0x23,0x20,0x03,0x21,0x15,0x21,
-  0x12,0x21,0x32,0x37,0x15,0x06,0x23,0x20,0x00,0x11,0x10,0x00,0x21,0x32,0x04,0x25,
-  0x3E,0x96,0x70,0xFE,0xA5,0x1E,0x02,0x19,0xFD,0xE5,0x14,0x01,0x5D,0x99,0xA2,0x85,
-  0xBA,0xFE,0xF7,0xFE,0xE2,0x01,0x23,0x01,0x0C,0xB2,0x04,0x23,0x9E,0x39,0xFE,0xC3,
-  0x9A,0xFE,0xA4,0x3E,0xA0,0x3D,0x01,0x24,0x01,0x0F,0x01,0x1B,0x01,0x24,0xFF,0xFF,
-  0x00,0xCB,0xFF,0xEC,0x04,0x02,0x04,0x5E,0x02,0x06,0x00,0x56,0x00,0x00,0xFF,0xFF,
-  0x00,0xC5,0x00,0x00,0x04,0x33,0x06,0x0E,0x02,0x06,0x00,0x4C,0x00,0x00,0xFF,0xFF,
-  0x00,0xC5,0x00,0x00,0x04,0x33,0x05,0xD9,0x02,0x26,0x00,0xF3,0x00,0x00,0x01,0x06,
-  0x00,0x6A,0x00,0x00,0x00,0x19,0xB6,0x02,0x01,0x0E,0x11,0x26,0x02,0x01,0xB8,0xFF,
-  0xEA,0xB4,0x10,0x14,0x07,0x05,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,
-  0xFF,0xFF,0x00,0x87,0xFE,0x14,0x03,0x56,0x06,0x0E,0x02,0x06,0x00,0x4D,0x00,0x00,
-  0x00,0x02,0x00,0x00,0xFF,0xF2,0x04,0x9C,0x04,0x4A,0x00,0x16,0x00,0x1E,0x00,0x79,
-  0x40,0x4E,0xD8,0x09,0xE8,0x09,0xF8,0x09,0x03,0x09,0x10,0x11,0x15,0x48,0x7A,0x09,
-  0x01,0x09,0x10,0x09,0x0E,0x48,0x09,0x08,0x08,0x14,0x18,0x12,0x18,0x48,0x14,0x10,
-  0x09,0x11,0x48,0x14,0x15,0x00,0x18,0x47,0x06,0x60,0x15,0x01,0x15,0x06,0x15,0x06,
-  0x0E,0x1B,0x49,0xCF,0x03,0xDF,0x03,0x02,0x03,0x20,0x00,0x0E,0x01,0x0E,0x17,0x50,
-  0x00,0x00,0x11,0x08,0x50,0x15,0x0F,0x11,0x4F,0x0F,0x0C,0x16,0x18,0x50,0x06,0x15,
-  0x00,0x3F,0xE1,0x3F,0x33,0xE1,0x3F,0xE1,0x12,0x39,0x2F,0xE1,0x01,0x2F,0x5D,0x10,
-  0xD6,0x5D,0xE1,0x11,0x39,0x39,0x2F,0x2F,0x5D,0x10,0xE1,0x32,0x11,0x33,0x2B,0x2B,
-  0x33,0x11,0x33,0x2B,0x31,0x30,0x5D,0x2B,0x5D,0x01,0x33,0x20,0x11,0x10,0x21,0x23,
-  0x11,0x23,0x02,0x02,0x06,0x23,0x22,0x27,0x35,0x16,0x33,0x32,0x36,0x12,0x13,0x21,
-  0x11,0x11,0x33,0x32,0x35,0x34,0x26,0x23,0x02,0xC9,0x33,0x01,0xA0,0xFE,0x5C,0xD1,
-  0xBA,0x21,0x34,0x5C,0x60,0x3E,0x1E,0x16,0x1B,0x29,0x31,0x2D,0x23,0x01,0xEE,0x37,
-  0xFE,0x76,0x8C,0x02,0x87,0xFE,0xC9,0xFE,0xB0,0x03,0xB0,0xFE,0x26,0xFE,0x87,0x6B,
-  0x0C,0x83,0x06,0x54,0x01,0x7E,0x01,0xFD,0xFD,0xA4,0xFE,0xA8,0xAC,0x5A,0x52,0x00,
-  0x00,0x02,0x00,0x6A,0x00,0x00,0x04,0xAC,0x04,0x4A,0x00,0x10,0x00,0x18,0x00,0x56,
-  0x40,0x19,0x05,0x38,0x12,0xF8,0x12,0x02,0x12,0x49,0x02,0x0B,0x0B,0x0F,0x15,0x49,
-  0x08,0x1A,0x01,0x38,0x0E,0xF8,0x0E,0x02,0x0E,0x49,0x0F,0xB8,0xFF,0xC0,0x40,0x17,
-  0x0A,0x0D,0x48,0x0F,0x0F,0x15,0x11,0x0D,0x50,0x05,0xBF,0x01,0x01,0x01,0x01,0x00,
-  0x12,0x50,0x0B,0x15,0x03,0x00,0x0F,0x00,0x3F,0x32,0x3F,0xE1,0x11,0x39,0x2F,0x5D,
-  0x33,0xE1,0x32,0x3F,0x01,0x2F,0x2B,0xE1,0x5D,0x32,0x10,0xD6,0xE1,0x11,0x39,0x2F,
-  0x33,0xE1,0x5D,0x32,0x31,0x30,0x01,0x11,0x21,0x11,0x33,0x11,0x33,0x20,0x11,0x10,
-  0x21,0x23,0x11,0x21,0x11,0x23,0x11,0x01,0x11,0x33,0x32,0x35,0x34,0x26,0x23,0x01,
-  0x0C,0x01,0x2B,0xA2,0x33,0x01,0xA0,0xFE,0x5C,0xD1,0xFE,0xD5,0xA2,0x02,0x6F,0x37,
-  0xFE,0x76,0x8C,0x04,0x4A,0xFE,0x39,0x01,0xC7,0xFE,0x3D,0xFE,0xC9,0xFE,0xB0,0x01,
-  0xE9,0xFE,0x17,0x04,0x4A,0xFD,0xA4,0xFE,0xA8,0xAC,0x5A,0x52,0xFF,0xFF,0x00,0x04,
-  0x00,0x00,0x04,0x2D,0x06,0x14,0x02,0x06,0x00,0xE9,0x00,0x00,0xFF,0xFF,0x00,0xD7,
-  0x00,0x00,0x04,0x8B,0x06,0x21,0x02,0x26,0x00,0xFA,0x00,0x00,0x01,0x06,0x00,0x76,
-  0x5A,0x00,0x00,0x13,0x40,0x0B,0x01,0x15,0x11,0x26,0x01,0x0F,0x0F,0x12,0x0A,0x05,
-  0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x52,0xFE,0x14,0x04,0x79,
-  0x06,0x17,0x02,0x26,0x00,0x5C,0x00,0x00,0x01,0x06,0x02,0x36,0x0A,0x00,0x00,0x13,
-  0x40,0x0B,0x01,0x19,0x11,0x26,0x01,0x0A,0x1C,0x17,0x00,0x09,0x25,0x01,0x2B,0x35,
-  0x00,0x2B,0x35,0x00,0x00,0x01,0x00,0xA0,0xFE,0x83,0x04,0x2D,0x04,0x4A,0x00,0x0B,
-  0x00,0x44,0x40,0x2B,0x06,0x47,0x00,0x07,0x10,0x07,0xB0,0x07,0xC0,0x07,0xD0,0x07,
-  0x05,0x07,0x07,0x09,0x01,0x47,0x90,0x04,0xA0,0x04,0x02,0x04,0x0D,0x00,0x47,0x00,
-  0x09,0xB0,0x09,0x02,0x09,0x07,0x07,0x05,0x00,0x50,0x09,0x15,0x0A,0x02,0x0F,0x00,
-  0x3F,0x33,0x3F,0xE1,0x33,0x33,0x2F,0x01,0x2F,0x5D,0xE1,0x10,0xDE,0x5D,0xE1,0x11,
-  0x39,0x2F,0x5D,0xE1,0x31,0x30,0x25,0x21,0x11,0x33,0x11,0x21,0x11,0x23,0x11,0x21,
-  0x11,0x33,0x01,0x56,0x02,0x21,0xB6,0xFE,0x9E,0xB7,0xFE,0x8C,0xB6,0x9A,0x03,0xB0,
-  0xFB,0xB6,0xFE,0x83,0x01,0x7D,0x04,0x4A,0x00,0x01,0x00,0xF6,0x00,0x00,0x04,0x23,
-  0x06,0xE3,0x00,0x07,0x00,0x3E,0x40,0x0F,0x00,0xFB,0x03,0x40,0x12,0x16,0x48,0x03,
-  0x09,0x05,0x5A,0x00,0x06,0x01,0x06,0xB8,0xFF,0xC0,0xB3,0x15,0x18,0x48,0x06,0xB8,
-  0xFF,0xC0,0x40,0x0D,0x0D,0x10,0x48,0x06,0x04,0x5F,0x07,0x01,0x01,0x07,0x03,0x05,
-  0x12,0x00,0x3F,0x3F,0x33,0x2F,0x10,0xE1,0x01,0x2F,0x2B,0x2B,0x5D,0xE1,0x10,0xDE,
-  0x2B,0xE1,0x31,0x30,0x01,0x11,0x33,0x11,0x21,0x11,0x23,0x11,0x03,0x73,0xB0,0xFD,
-  0x8D,0xBA,0x05,0xB6,0x01,0x2D,0xFE,0x2D,0xFA,0xF0,0x05,0xB6,0x00,0x01,0x01,0x23,
-  0x00,0x00,0x03,0xFA,0x05,0x89,0x00,0x07,0x00,0x2D,0x40,0x1B,0x05,0x47,0x6F,0x00,
-  0x7F,0x00,0x8F,0x00,0x03,0x00,0x09,0x02,0x47,0x7F,0x03,0x8F,0x03,0x02,0x03,0x06,
-  0x06,0x01,0x4F,0x04,0x0F,0x02,0x15,0x00,0x3F,0x3F,0xE1,0x33,0x2F,0x01,0x2F,0x5D,
-  0xE1,0x10,0xDE,0x5D,0xE1,0x31,0x30,0x01,0x21,0x11,0x23,0x11,0x21,0x11,0x33,0x03,
-  0xFA,0xFD,0xDF,0xB6,0x02,0x21,0xB6,0x03,0xC1,0xFC,0x3F,0x04,0x4A,0x01,0x3F,0x00,
-  0xFF,0xFF,0x00,0x02,0x00,0x00,0x04,0xCB,0x07,0x73,0x02,0x26,0x00,0x3A,0x00,0x00,
-  0x01,0x07,0x00,0x43,0xFF,0xAF,0x01,0x52,0x00,0x15,0xB4,0x01,0x1A,0x05,0x26,0x01,
-  0xB8,0xFF,0xAF,0xB4,0x1D,0x1A,0x12,0x08,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,
-  0xFF,0xFF,0xFF,0xFC,0x00,0x00,0x04,0xD1,0x06,0x21,0x02,0x26,0x00,0x5A,0x00,0x00,
-  0x01,0x06,0x00,0x43,0x8E,0x00,0x00,0x15,0xB4,0x01,0x1A,0x11,0x26,0x01,0xB8,0xFF,
-  0x8E,0xB4,0x1D,0x1A,0x07,0x18,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,
-  0x00,0x02,0x00,0x00,0x04,0xCB,0x07,0x73,0x02,0x26,0x00,0x3A,0x00,0x00,0x01,0x07,
-  0x00,0x76,0x00,0x52,0x01,0x52,0x00,0x13,0x40,0x0B,0x01,0x20,0x05,0x26,0x01,0x52,
-  0x1A,0x1D,0x12,0x08,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0xFF,0xFC,
-  0x00,0x00,0x04,0xD1,0x06,0x21,0x02,0x26,0x00,0x5A,0x00,0x00,0x01,0x06,0x00,0x76,
-  0x68,0x00,0x00,0x13,0x40,0x0B,0x01,0x20,0x11,0x26,0x01,0x68,0x1A,0x1D,0x07,0x18,
-  0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x02,0x00,0x00,0x04,0xCB,
-  0x07,0x2B,0x02,0x26,0x00,0x3A,0x00,0x00,0x01,0x07,0x00,0x6A,0x00,0x04,0x01,0x52,
-  0x00,0x17,0x40,0x0D,0x02,0x01,0x1E,0x05,0x26,0x02,0x01,0x03,0x20,0x24,0x12,0x08,
-  0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,0xFF,0xFF,0xFF,0xFC,0x00,0x00,
-  0x04,0xD1,0x05,0xD9,0x02,0x26,0x00,0x5A,0x00,0x00,0x01,0x06,0x00,0x6A,0xFF,0x00,
-  0x00,0x19,0xB6,0x02,0x01,0x1E,0x11,0x26,0x02,0x01,0xB8,0xFF,0xFE,0xB4,0x20,0x24,
-  0x07,0x18,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0x21,
-  0x00,0x00,0x04,0xAA,0x07,0x73,0x02,0x26,0x00,0x3C,0x00,0x00,0x01,0x07,0x00,0x43,
-  0xFF,0x8E,0x01,0x52,0x00,0x15,0xB4,0x01,0x09,0x05,0x26,0x01,0xB8,0xFF,0x8F,0xB4,
-  0x0C,0x09,0x07,0x02,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x52,
-  0xFE,0x14,0x04,0x79,0x06,0x21,0x02,0x26,0x00,0x5C,0x00,0x00,0x01,0x06,0x00,0x43,
-  0x97,0x00,0x00,0x15,0xB4,0x01,0x17,0x11,0x26,0x01,0xB8,0xFF,0x98,0xB4,0x1A,0x17,
-  0x00,0x09,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0x00,0x01,0x00,0xB8,0x01,0xD1,
-  0x04,0x14,0x02,0x79,0x00,0x03,0x00,0x18,0x40,0x0B,0x02,0x02,0x05,0x00,0x00,0x01,
-  0x00,0x00,0xB9,0x01,0xBD,0x00,0x3F,0xE1,0x01,0x2F,0x5D,0x11,0x33,0x2F,0x31,0x30,
-  0x13,0x35,0x21,0x15,0xB8,0x03,0x5C,0x01,0xD1,0xA8,0xA8,0x00,0x00,0x01,0xFF,0xFA,
-  0x01,0xD1,0x04,0xD3,0x02,0x79,0x00,0x03,0x00,0x13,0xB7,0x02,0x02,0x05,0x00,0x00,
-  0xB9,0x01,0xBD,0x00,0x3F,0xE1,0x01,0x2F,0x11,0x33,0x2F,0x31,0x30,0x03,0x35,0x21,
-  0x15,0x06,0x04,0xD9,0x01,0xD1,0xA8,0xA8,0x00,0x01,0xFF,0xFA,0x01,0xD1,0x04,0xD3,
-  0x02,0x79,0x00,0x03,0x00,0x13,0xB7,0x02,0x02,0x05,0x00,0x00,0xB9,0x01,0xBD,0x00,
-  0x3F,0xE1,0x01,0x2F,0x11,0x33,0x2F,0x31,0x30,0x03,0x35,0x21,0x15,0x06,0x04,0xD9,
-  0x01,0xD1,0xA8,0xA8,0x00,0x02,0xFF,0xEC,0xFE,0x31,0x04,0xE1,0xFF,0xD3,0x00,0x03,
-  0x00,0x07,0x00,0x3C,0x40,0x25,0x04,0x00,0x09,0x05,0x01,0xF7,0x06,0x01,0x26,0x06,
-  0x01,0x17,0x06,0x01,0x06,0xBA,0x20,0x05,0xF0,0x05,0x02,0x05,0xF8,0x01,0x01,0x29,
-  0x01,0x01,0x18,0x01,0x01,0x01,0xBA,0xEF,0x02,0x01,0x02,0x00,0x2F,0x5D,0xE1,0x5D,
-  0x5D,0x5D,0x2F,0x5D,0xE1,0x5D,0x5D,0x5D,0x01,0x2F,0x33,0x10,0xC4,0x32,0x31,0x30,
-  0x05,0x21,0x35,0x21,0x11,0x21,0x35,0x21,0x04,0xE1,0xFB,0x0B,0x04,0xF5,0xFB,0x0B,
-  0x04,0xF5,0xB8,0x8B,0xFE,0x5E,0x8B,0x00,0x00,0x01,0x01,0xBE,0x03,0xC1,0x03,0x0C,
-  0x05,0xB6,0x00,0x06,0x00,0x2A,0x40,0x1A,0x16,0x06,0x26,0x06,0xE6,0x06,0xF6,0x06,
-  0x04,0x06,0x98,0x04,0x99,0x6F,0x01,0xBF,0x01,0x02,0x01,0x01,0x07,0x08,0x06,0x9D,
-  0x03,0xA9,0x00,0x3F,0xED,0x11,0x12,0x01,0x39,0x2F,0x5D,0xED,0xE1,0x5D,0x31,0x30,
-  0x01,0x27,0x36,0x13,0x33,0x06,0x07,0x01,0xCD,0x0F,0x36,0x7B,0x9D,0x3E,0x26,0x03,
-  0xC1,0x16,0xCE,0x01,0x11,0xFF,0xF6,0x00,0x00,0x01,0x01,0xBE,0x03,0xC1,0x03,0x0C,
-  0x05,0xB6,0x00,0x06,0x00,0x38,0x40,0x28,0x19,0x06,0x29,0x06,0xE9,0x06,0xF9,0x06,
-  0x04,0x06,0x98,0x01,0x99,0x00,0x04,0x20,0x04,0x30,0x04,0x70,0x04,0x80,0x04,0x90,
-  0x04,0xD0,0x04,0xE0,0x04,0xF0,0x04,0x09,0x04,0x04,0x07,0x08,0x03,0x9D,0x06,0xA9,
-  0x00,0x3F,0xED,0x11,0x12,0x01,0x39,0x2F,0x5D,0xFD,0xE1,0x5D,0x31,0x30,0x01,0x17,
-  0x06,0x03,0x23,0x12,0x37,0x02,0xFE,0x0E,0x37,0x79,0x9E,0x41,0x24,0x05,0xB6,0x16,
-  0xD5,0xFE,0xF6,0x01,0x0A,0xEB,0x00,0x01,0x01,0xC9,0xFE,0xF8,0x03,0x02,0x00,0xEE,
-  0x00,0x06,0x00,0x43,0x40,0x31,0x19,0x06,0x29,0x06,0xE9,0x06,0xF9,0x06,0x04,0x06,
-  0x98,0x01,0x99,0x00,0x04,0x20,0x04,0x30,0x04,0x70,0x04,0x80,0x04,0x90,0x04,0xD0,
-  0x04,0xE0,0x04,0xF0,0x04,0x09,0x04,0x04,0x07,0x08,0x03,0x9E,0xD1,0x06,0x01,0x1F,
-  0x06,0x2F,0x06,0x3F,0x06,0x03,0x06,0x00,0x2F,0x5D,0x5D,0xED,0x11,0x12,0x01,0x39,
-  0x2F,0x5D,0xFD,0xE1,0x5D,0x31,0x30,0x25,0x17,0x06,0x03,0x23,0x12,0x37,0x02,0xF4,
-  0x0E,0x37,0x79,0x89,0x47,0x1D,0xEE,0x17,0xD5,0xFE,0xF6,0x01,0x24,0xD2,0x00,0x01,
-  0x01,0xBE,0x03,0xC1,0x03,0x0C,0x05,0xB6,0x00,0x06,0x00,0x28,0x40,0x18,0x16,0x00,
-  0x26,0x00,0xE6,0x00,0xF6,0x00,0x04,0x00,0x98,0x02,0x99,0x6F,0x05,0x01,0x05,0x05,
-  0x07,0x08,0x03,0x9D,0x00,0xA9,0x00,0x3F,0xED,0x11,0x12,0x01,0x39,0x2F,0x5D,0xED,
-  0xE1,0x5D,0x31,0x30,0x01,0x12,0x17,0x23,0x02,0x27,0x37,0x02,0xA8,0x28,0x3C,0x9D,
-  0x7C,0x35,0x0F,0x05,0xB6,0xFE,0xFD,0xF2,0x01,0x12,0xCD,0x16,0x00,0x02,0x00,0xE9,
-  0x03,0xC1,0x03,0xE1,0x05,0xB6,0x00,0x06,0x00,0x0D,0x00,0x4A,0x40,0x32,0x16,0x06,
-  0x26,0x06,0xE6,0x06,0xF6,0x06,0x04,0x06,0x98,0x04,0x99,0x2F,0x01,0x7F,0x01,0x02,
-  0x01,0x01,0x16,0x0D,0x26,0x0D,0xE6,0x0D,0xF6,0x0D,0x04,0x0D,0x98,0x0B,0x99,0x00,
-  0x08,0xE0,0x08,0xF0,0x08,0x03,0x08,0x08,0x0F,0x0E,0x0D,0x06,0x9D,0x0A,0x03,0xA9,
-  0x00,0x3F,0x33,0xED,0x32,0x11,0x12,0x01,0x39,0x2F,0x5D,0xED,0xE1,0x5D,0x33,0x2F,
-  0x5D,0xED,0xE1,0x5D,0x31,0x30,0x01,0x27,0x36,0x13,0x33,0x06,0x07,0x21,0x27,0x36,
-  0x13,0x33,0x06,0x07,0x02,0xA2,0x0F,0x36,0x7B,0x9D,0x3E,0x26,0xFD,0x7B,0x0F,0x36,
-  0x7B,0x9D,0x3E,0x26,0x03,0xC1,0x16,0xCE,0x01,0x11,0xFF,0xF6,0x16,0xCE,0x01,0x11,
-  0xFF,0xF6,0x00,0x02,0x00,0xE9,0x03,0xC1,0x03,0xE1,0x05,0xB6,0x00,0x06,0x00,0x0D,
-  0x00,0x5C,0x40,0x41,0x19,0x0D,0x29,0x0D,0xE9,0x0D,0xF9,0x0D,0x04,0x0D,0x98,0x08,
-  0x99,0x2F,0x0B,0x7F,0x0B,0x02,0x0B,0x0B,0x04,0x19,0x06,0x29,0x06,0xE9,0x06,0xF9,
-  0x06,0x04,0x06,0x98,0x01,0x99,0xE0,0x04,0xF0,0x04,0x02,0xBF,0x04,0xCF,0x04,0x02,
-  0x00,0x04,0x40,0x04,0x50,0x04,0x70,0x04,0x80,0x04,0x05,0x04,0x04,0x0F,0x0E,0x0A,
-  0x03,0x9D,0x0D,0x06,0xA9,0x00,0x3F,0x33,0xED,0x32,0x11,0x12,0x01,0x39,0x2F,0x5D,
-  0x5D,0x5D,0xFD,0xE1,0x5D,0x11,0x33,0x2F,0x5D,0xFD,0xE1,0x5D,0x31,0x30,0x01,0x17,
-  0x06,0x03,0x23,0x12,0x37,0x21,0x17,0x06,0x03,0x23,0x12,0x37,0x02,0x29,0x0E,0x37,
-  0x79,0x9E,0x41,0x24,0x02,0x85,0x0E,0x37,0x79,0x9E,0x41,0x24,0x05,0xB6,0x16,0xD5,
-  0xFE,0xF6,0x01,0x0A,0xEB,0x16,0xD5,0xFE,0xF6,0x01,0x0A,0xEB,0x00,0x02,0x00,0xF4,
-  0xFE,0xF8,0x03,0xD7,0x00,0xEE,0x00,0x06,0x00,0x0D,0x00,0x5D,0x40,0x40,0x19,0x0D,
-  0x29,0x0D,0x02,0x0D,0x98,0x08,0x99,0x3F,0x0B,0x01,0x0B,0x0B,0x04,0x19,0x06,0x29,
-  0x06,0x02,0x06,0x98,0x01,0x99,0xE0,0x04,0xF0,0x04,0x02,0xBF,0x04,0xCF,0x04,0x02,
-  0x00,0x04,0x40,0x04,0x50,0x04,0x70,0x04,0x80,0x04,0x05,0x04,0x04,0x0F,0x0E,0x0A,
-  0x03,0x9E,0x0D,0xD0,0x06,0x01,0x1F,0x06,0x2F,0x06,0x3F,0x06,0x03,0x06,0x00,0x2F,
-  0x5D,0x5D,0x33,0xED,0x32,0x11,0x12,0x01,0x39,0x2F,0x5D,0x5D,0x5D,0xFD,0xE1,0x5D,
-  0x11,0x33,0x2F,0x5D,0xFD,0xE1,0x5D,0x31,0x30,0x25,0x17,0x06,0x03,0x23,0x12,0x37,
-  0x21,0x17,0x06,0x03,0x23,0x12,0x37,0x02,0x1F,0x0E,0x37,0x79,0x89,0x47,0x1D,0x02,
-  0x71,0x0E,0x33,0x7D,0x89,0x47,0x1D,0xEE,0x17,0xD5,0xFE,0xF6,0x01,0x24,0xD2,0x17,
-  0xC5,0xFE,0xE6,0x01,0x24,0xD2,0x00,0x01,0x00,0xF0,0x00,0x00,0x03,0xDD,0x06,0x14,
-  0x00,0x0B,0x00,0x2F,0x40,0x19,0x09,0x00,0x02,0xBE,0x08,0x05,0x9F,0x03,0xAF,0x03,
-  0x02,0x03,0x03,0x0C,0x0D,0x00,0x05,0xBF,0x0B,0x06,0xFE,0x08,0x00,0x02,0x15,0x00,
-  0x3F,0x3F,0xF6,0x32,0xE1,0x32,0x11,0x12,0x01,0x39,0x2F,0x5D,0x33,0x33,0xE1,0x32,
-  0x32,0x31,0x30,0x01,0x25,0x13,0x23,0x13,0x05,0x35,0x05,0x03,0x33,0x03,0x25,0x03,
-  0xDD,0xFE,0xB4,0x38,0xD9,0x37,0xFE,0xC9,0x01,0x37,0x37,0xD9,0x38,0x01,0x4C,0x03,
-  0xDD,0x1F,0xFC,0x04,0x03,0xFC,0x1F,0xB4,0x1E,0x01,0xA1,0xFE,0x5F,0x1E,0x00,0x01,
-  0x00,0xE5,0x00,0x00,0x03,0xE7,0x06,0x14,0x00,0x15,0x00,0x37,0x40,0x1C,0x13,0x10,
-  0x02,0x04,0xBE,0x0F,0x0C,0x07,0x05,0x05,0x16,0x17,0x13,0x0C,0xBF,0x12,0x0D,0xC2,
-  0x0F,0x00,0x08,0x01,0xBF,0x07,0x02,0xC2,0x04,0x15,0x00,0x3F,0xF6,0x32,0xE1,0x32,
-  0x3F,0xF6,0x32,0xE1,0x32,0x11,0x12,0x01,0x39,0x2F,0x33,0x33,0x33,0xE1,0x32,0x32,
-  0x32,0x31,0x30,0x01,0x25,0x15,0x25,0x13,0x23,0x13,0x05,0x35,0x05,0x03,0x13,0x05,
-  0x35,0x05,0x03,0x33,0x03,0x25,0x15,0x25,0x13,0x02,0x9C,0x01,0x4B,0xFE,0xB5,0x37,
-  0xD9,0x37,0xFE,0xB4,0x01,0x4C,0x2F,0x2F,0xFE,0xB4,0x01,0x4C,0x37,0xD9,0x37,0x01,
-  0x4B,0xFE,0xB5,0x2F,0x01,0xF0,0x1E,0xB4,0x1F,0xFE,0x87,0x01,0x79,0x1F,0xB4,0x1E,
-  0x01,0x22,0x01,0x13,0x1F,0xB4,0x1E,0x01,0x78,0xFE,0x88,0x1E,0xB4,0x1F,0xFE,0xED,
-  0x00,0x01,0x01,0x7B,0x01,0xE5,0x03,0x52,0x03,0xF2,0x00,0x09,0x00,0x2A,0x40,0x1C,
-  0x10,0x08,0x50,0x08,0x60,0x08,0x90,0x08,0xA0,0x08,0xE0,0x08,0x06,0x08,0x5F,0x02,
-  0x6F,0x02,0xAF,0x02,0x03,0x40,0x02,0x01,0x02,0x0B,0x00,0x05,0x00,0x2F,0xCD,0x01,
-  0x10,0xDE,0x5D,0x5D,0xCD,0x5D,0x31,0x30,0x01,0x32,0x11,0x14,0x06,0x23,0x22,0x26,
-  0x35,0x10,0x02,0x66,0xEC,0x7F,0x6D,0x6F,0x7C,0x03,0xF2,0xFE,0xFA,0x80,0x87,0x86,
-  0x81,0x01,0x06,0x00,0x00,0x03,0x00,0x4E,0xFF,0xE3,0x04,0x7F,0x00,0xFA,0x00,0x07,
-  0x00,0x0F,0x00,0x17,0x00,0x5F,0x40,0x3D,0x34,0x12,0x01,0x25,0x12,0x01,0x06,0x12,
-  0x16,0x12,0x02,0x12,0x96,0x16,0x16,0x0E,0x34,0x02,0x01,0x25,0x02,0x01,0x06,0x02,
-  0x16,0x02,0x02,0x02,0x96,0x06,0x06,0x34,0x0A,0x01,0x25,0x0A,0x01,0x06,0x0A,0x16,
-  0x0A,0x02,0x0A,0x96,0xE0,0x0E,0xF0,0x0E,0x02,0x0E,0x0E,0x18,0x19,0x10,0x00,0x08,
-  0x9B,0x14,0x04,0x0C,0xA8,0x00,0x3F,0x33,0x33,0xE1,0x32,0x32,0x11,0x12,0x01,0x39,
-  0x2F,0x5D,0xE1,0x5D,0x5D,0x5D,0x33,0x2F,0xE1,0x5D,0x5D,0x5D,0x11,0x33,0x2F,0xE1,
-  0x5D,0x5D,0x5D,0x31,0x30,0x37,0x32,0x15,0x14,0x23,0x22,0x35,0x34,0x21,0x32,0x15,
-  0x14,0x23,0x22,0x35,0x34,0x21,0x32,0x15,0x14,0x23,0x22,0x35,0x34,0xCD,0x7F,0x7F,
-  0x7F,0x02,0x18,0x7F,0x7F,0x7F,0x02,0x19,0x7F,0x7F,0x7F,0xFA,0x8B,0x8C,0x8C,0x8B,
-  0x8B,0x8C,0x8C,0x8B,0x8B,0x8C,0x8C,0x8B,0x00,0x07,0x00,0x04,0x00,0x00,0x04,0xB8,
-  0x05,0xC9,0x00,0x09,0x00,0x15,0x00,0x19,0x00,0x23,0x00,0x2F,0x00,0x39,0x00,0x45,
-  0x00,0xB4,0x40,0x76,0x43,0xB4,0x00,0x33,0x10,0x33,0x02,0x33,0x38,0x2D,0xB4,0x00,
-  0x1D,0x10,0x1D,0x02,0x1D,0x27,0xB4,0x19,0x16,0x90,0x22,0xA0,0x22,0x02,0x6F,0x22,
-  0x7F,0x22,0x8F,0x22,0x03,0x8F,0x16,0x9F,0x16,0xAF,0x16,0xCF,0x16,0x04,0x22,0x16,
-  0x22,0x16,0x03,0x3D,0xB4,0x0F,0x38,0x01,0x38,0x47,0x17,0x18,0x18,0x03,0x0D,0xB4,
-  0x0F,0x08,0x1F,0x08,0x02,0x08,0x13,0xB4,0x03,0x3A,0x24,0xB6,0x1A,0x40,0x2A,0xB6,
-  0x35,0x1F,0x1A,0x16,0x19,0x18,0x17,0x70,0x19,0x80,0x19,0xC0,0x19,0xE0,0x19,0xF0,
-  0x19,0x05,0xAF,0x17,0xBF,0x17,0xEF,0x17,0xFF,0x17,0x04,0x19,0x17,0x19,0x17,0x05,
-  0x30,0x1A,0x19,0x0A,0xB6,0x00,0x10,0xB6,0x05,0x07,0x00,0x3F,0xE1,0xD4,0xE1,0x3F,
-  0x33,0x12,0x39,0x39,0x2F,0x2F,0x5D,0x5D,0x11,0x33,0x11,0x33,0x10,0xD4,0x32,0xE1,
-  0x32,0x10,0xE1,0x32,0x01,0x2F,0xE1,0xD4,0x5D,0xE1,0x11,0x33,0x2F,0x33,0x10,0xDE,
-  0x5D,0xE1,0x12,0x39,0x39,0x2F,0x2F,0x5D,0x5D,0x5D,0x11,0x33,0xE1,0xD4,0x5D,0xE1,
-  0x10,0xD4,0x5D,0xE1,0x31,0x30,0x01,0x22,0x26,0x35,0x10,0x33,0x32,0x16,0x15,0x10,
-  0x27,0x32,0x36,0x35,0x34,0x26,0x23,0x22,0x06,0x15,0x14,0x16,0x05,0x01,0x27,0x01,
-  0x01,0x22,0x26,0x35,0x10,0x33,0x32,0x16,0x15,0x10,0x27,0x32,0x36,0x35,0x34,0x26,
-  0x23,0x22,0x06,0x15,0x14,0x16,0x05,0x22,0x26,0x35,0x10,0x33,0x32,0x16,0x15,0x10,
-  0x27,0x32,0x36,0x35,0x34,0x26,0x23,0x22,0x06,0x15,0x14,0x16,0x01,0x04,0x72,0x7E,
-  0xF4,0x71,0x7F,0xF2,0x3F,0x2A,0x2F,0x3A,0x3B,0x2F,0x2B,0x02,0x20,0xFD,0x46,0x29,
-  0x02,0xBA,0xFE,0xF4,0x72,0x7D,0xF3,0x71,0x7F,0xF2,0x3F,0x2A,0x2F,0x3A,0x3B,0x2F,
-  0x2B,0x02,0x50,0x73,0x7D,0xF4,0x70,0x7F,0xF1,0x3F,0x29,0x2C,0x3C,0x3C,0x2F,0x2C,
-  0x03,0x5C,0xA3,0x94,0x01,0x36,0xA1,0x95,0xFE,0xC9,0x6B,0x64,0x68,0x74,0x55,0x59,
-  0x70,0x68,0x64,0x7B,0xFE,0xE1,0x62,0x01,0x21,0xFC,0x50,0xA3,0x94,0x01,0x36,0xA1,
-  0x95,0xFE,0xC9,0x6A,0x65,0x68,0x74,0x55,0x59,0x70,0x68,0x65,0x6A,0xA3,0x94,0x01,
-  0x36,0xA2,0x94,0xFE,0xC9,0x6A,0x65,0x68,0x72,0x57,0x58,0x71,0x68,0x65,0xFF,0xFF,
-  0x01,0xF0,0x03,0xA6,0x02,0xDD,0x05,0xB6,0x02,0x06,0x00,0x0A,0x00,0x00,0xFF,0xFF,
-  0x01,0x1D,0x03,0xA6,0x03,0xB0,0x05,0xB6,0x02,0x06,0x00,0x05,0x00,0x00,0x00,0x01,
-  0x01,0x91,0x00,0x73,0x03,0x3B,0x03,0xC7,0x00,0x06,0x00,0x3F,0x40,0x26,0x03,0xEB,
-  0x00,0xEC,0x04,0xEF,0x02,0xFF,0x02,0x02,0xC0,0x02,0x01,0x9F,0x02,0xAF,0x02,0x02,
-  0x70,0x02,0x01,0x4F,0x02,0x5F,0x02,0x02,0x02,0x08,0x40,0x06,0x05,0xEE,0x01,0xEE,
-  0x20,0x00,0x03,0xEF,0x00,0x19,0x3F,0x33,0x1A,0xED,0xED,0x33,0x01,0x1A,0x18,0x10,
-  0xDE,0x5D,0x5D,0x5D,0x5D,0x5D,0x32,0xFD,0xE1,0x31,0x30,0x01,0x01,0x17,0x03,0x13,
-  0x07,0x01,0x01,0x91,0x01,0x36,0x74,0xED,0xED,0x74,0xFE,0xCA,0x02,0x29,0x01,0x9E,
-  0x4E,0xFE,0xA4,0xFE,0xA4,0x4E,0x01,0x9B,0x00,0x01,0x01,0x91,0x00,0x73,0x03,0x3B,
-  0x03,0xC7,0x00,0x06,0x00,0x25,0x40,0x11,0x02,0x04,0xEC,0x03,0xEB,0x00,0x08,0x40,
-  0x06,0x05,0xEE,0x01,0xEE,0x20,0x00,0x03,0xEF,0x00,0x19,0x3F,0x33,0x1A,0xED,0xED,
-  0x33,0x01,0x1A,0x18,0x10,0xDE,0xE1,0xED,0x32,0x31,0x30,0x01,0x01,0x27,0x13,0x03,
-  0x37,0x01,0x03,0x3B,0xFE,0xCB,0x75,0xEE,0xEE,0x75,0x01,0x35,0x02,0x0E,0xFE,0x65,
-  0x4E,0x01,0x5C,0x01,0x5C,0x4E,0xFE,0x62,0xFF,0xFF,0x00,0xFF,0xFF,0xE3,0x03,0xCC,
-  0x05,0xB6,0x02,0x27,0x00,0x04,0x00,0xE7,0x00,0x00,0x01,0x07,0x00,0x04,0xFF,0x18,
-  0x00,0x00,0x00,0x20,0x40,0x15,0x03,0x02,0xD0,0x16,0x01,0xC0,0x16,0x01,0xB0,0x16,
-  0x01,0x40,0x16,0x01,0x30,0x16,0x01,0x20,0x16,0x01,0x16,0x11,0x5D,0x5D,0x5D,0x5D,
-  0x5D,0x5D,0x35,0x35,0x00,0x01,0x00,0xAA,0x00,0x00,0x04,0x21,0x05,0xB6,0x00,0x03,
-  0x00,0x20,0x40,0x0F,0x03,0x00,0x00,0x05,0x01,0x00,0x02,0x01,0x02,0x02,0x04,0x03,
-  0x06,0x01,0x18,0x00,0x3F,0x3F,0x11,0x01,0x33,0x2F,0x5D,0x33,0x11,0x33,0x2F,0x32,
-  0x31,0x30,0x01,0x01,0x23,0x01,0x04,0x21,0xFD,0x27,0x9E,0x02,0xD9,0x05,0xB6,0xFA,
-  0x4A,0x05,0xB6,0x00,0x00,0x01,0x01,0x3D,0x03,0x1D,0x03,0x8F,0x05,0xC7,0x00,0x12,
-  0x00,0x3C,0x40,0x28,0x00,0xE0,0x2F,0x12,0x3F,0x12,0x02,0x12,0x12,0x0B,0x07,0xE0,
-  0x10,0x08,0x20,0x08,0x30,0x08,0x80,0x08,0x90,0x08,0xA0,0x08,0xE0,0x08,0xF0,0x08,
-  0x08,0x08,0x0B,0x03,0xE6,0x0E,0xDE,0x09,0xDC,0x07,0x00,0xFF,0x00,0x3F,0x32,0x3F,
-  0x3F,0xE1,0x32,0x01,0x2F,0x5D,0xE1,0x32,0x33,0x2F,0x5D,0xE1,0x31,0x30,0x01,0x11,
-  0x34,0x23,0x22,0x06,0x15,0x11,0x23,0x11,0x33,0x17,0x33,0x36,0x33,0x32,0x16,0x15,
-  0x11,0x02,0xFC,0x7F,0x64,0x48,0x94,0x7D,0x11,0x08,0x44,0x8B,0x6E,0x7F,0x03,0x1D,
-  0x01,0x9D,0x96,0x6A,0x77,0xFE,0xAE,0x02,0x99,0x68,0x79,0x82,0x78,0xFE,0x50,0x00,
-  0x00,0x01,0x00,0x81,0x00,0x00,0x04,0x21,0x05,0xB6,0x00,0x11,0x00,0x60,0x40,0x3A,
-  0x02,0x04,0x10,0x10,0x05,0x9F,0x0B,0xAF,0x0B,0x02,0x0B,0x13,0x0E,0x00,0x04,0x6E,
-  0x09,0x07,0x80,0x05,0xF0,0x05,0x02,0x05,0x09,0x00,0x75,0x03,0x06,0x03,0x11,0x74,
-  0x0E,0x2F,0x0E,0x5F,0x0E,0xEF,0x0E,0xFF,0x0E,0x04,0x0E,0x40,0x10,0x15,0x48,0x03,
-  0x0E,0x03,0x0E,0x04,0x0D,0x74,0x0A,0x03,0x04,0x12,0x00,0x3F,0x3F,0xE1,0x12,0x39,
-  0x39,0x2F,0x2F,0x2B,0x5D,0x10,0xE1,0x11,0x33,0x10,0xE1,0x32,0x01,0x2F,0x5D,0xC6,
-  0x33,0xE1,0x32,0x32,0x10,0xCE,0x5D,0x11,0x39,0x2F,0x12,0x39,0x31,0x30,0x01,0x21,
-  0x15,0x21,0x11,0x23,0x11,0x23,0x35,0x33,0x11,0x21,0x15,0x21,0x11,0x21,0x15,0x21,
-  0x01,0xE3,0x01,0x25,0xFE,0xDB,0xB2,0xB0,0xB0,0x02,0xF0,0xFD,0xC2,0x02,0x17,0xFD,
-  0xE9,0x01,0x8F,0x89,0xFE,0xFA,0x01,0x06,0x89,0x04,0x27,0xA4,0xFD,0xFC,0xA4,0x00,
-  0x00,0x01,0x00,0x77,0x00,0x00,0x04,0x56,0x05,0xC9,0x00,0x23,0x00,0x85,0x40,0x51,
-  0x09,0x06,0x0E,0x6F,0x1E,0x1B,0x17,0x0C,0x07,0x17,0x07,0x17,0x07,0x13,0x00,0x12,
-  0x25,0x1D,0x18,0x10,0x00,0x13,0x01,0x13,0x09,0x1C,0x75,0x1D,0x06,0x1D,0x0A,0x19,
-  0x75,0x18,0x0E,0x18,0x0F,0x1D,0x1F,0x1D,0x3F,0x1D,0x4F,0x1D,0x7F,0x1D,0x8F,0x1D,
-  0xAF,0x1D,0xBF,0x1D,0xCF,0x1D,0x09,0x86,0x18,0x96,0x18,0x02,0x77,0x18,0x01,0x6F,
-  0x18,0x01,0x1D,0x18,0x1D,0x18,0x10,0x03,0x73,0x01,0x22,0x07,0x14,0x10,0x74,0x13,
-  0x18,0x00,0x3F,0xE1,0x32,0x3F,0x33,0xE1,0x12,0x39,0x39,0x2F,0x2F,0x5D,0x5D,0x5D,
-  0x5D,0x11,0x33,0x10,0xE1,0x32,0x11,0x33,0x10,0xE1,0x32,0x01,0x2F,0x5D,0x33,0x33,
-  0x33,0x10,0xCE,0x32,0x11,0x39,0x39,0x2F,0x2F,0x11,0x33,0x11,0x33,0x33,0xE1,0x32,
-  0x32,0x31,0x30,0x01,0x07,0x26,0x23,0x22,0x15,0x15,0x21,0x15,0x21,0x15,0x21,0x15,
-  0x21,0x15,0x14,0x07,0x21,0x15,0x21,0x35,0x36,0x35,0x35,0x23,0x35,0x33,0x35,0x23,
-  0x35,0x33,0x35,0x34,0x36,0x33,0x32,0x04,0x27,0x42,0x8D,0x83,0xDF,0x01,0x79,0xFE,
-  0x87,0x01,0x79,0xFE,0x87,0x8C,0x02,0xEC,0xFC,0x21,0xC8,0xC6,0xC6,0xC6,0xC6,0xD9,
-  0xB5,0xC0,0x05,0x79,0x90,0x48,0xF6,0xC0,0x89,0x9E,0x89,0x13,0xC4,0x4E,0xA6,0x9A,
-  0x31,0xEB,0x15,0x89,0x9E,0x89,0xDD,0xA8,0xC9,0x00,0x00,0x03,0x00,0x52,0xFF,0xEC,
-  0x04,0xA6,0x05,0xB6,0x00,0x09,0x00,0x10,0x00,0x24,0x00,0x7A,0x40,0x4B,0x06,0x5A,
-  0x0D,0x1A,0x18,0x16,0x70,0x21,0x1D,0x21,0x21,0x40,0x10,0x13,0x48,0x20,0x0D,0x30,
-  0x0D,0x02,0x0D,0x21,0x0D,0x21,0x02,0x1F,0x1F,0x11,0x40,0x09,0x0E,0x48,0x11,0x26,
-  0x0A,0x01,0x5A,0x1F,0x02,0x2F,0x02,0x3F,0x02,0x03,0x02,0x23,0x75,0x11,0x14,0x19,
-  0x17,0x20,0x75,0x19,0x1A,0x1C,0x03,0x1D,0x1D,0x00,0x75,0x0F,0x0A,0x1F,0x0A,0x02,
-  0x0A,0x0A,0x02,0x10,0x60,0x03,0x06,0x02,0x18,0x00,0x3F,0x3F,0xE1,0x12,0x39,0x2F,
-  0x5D,0xE1,0x33,0x2F,0x17,0x33,0xE1,0x32,0x3F,0x33,0xE1,0x01,0x2F,0x5D,0xE1,0x32,
-  0x10,0xCE,0x2B,0x32,0x2F,0x11,0x39,0x39,0x2F,0x2F,0x5D,0x2B,0x11,0x33,0x10,0xE1,
-  0x32,0x32,0x10,0xE1,0x31,0x30,0x13,0x11,0x23,0x11,0x33,0x20,0x11,0x14,0x06,0x23,
-  0x27,0x33,0x20,0x11,0x10,0x21,0x23,0x01,0x15,0x06,0x23,0x22,0x11,0x11,0x23,0x35,
-  0x37,0x37,0x33,0x15,0x33,0x15,0x23,0x11,0x14,0x33,0x32,0xF0,0x9E,0xCD,0x01,0xC2,
-  0xE6,0xE2,0x29,0x29,0x01,0x24,0xFE,0xF4,0x41,0x03,0xB6,0x40,0x66,0xDD,0x73,0x73,
-  0x41,0x56,0xD1,0xD1,0x71,0x3E,0x02,0x39,0xFD,0xC7,0x05,0xB6,0xFE,0x54,0xDD,0xF4,
-  0x92,0x01,0x35,0x01,0x23,0xFB,0x66,0x7D,0x20,0x01,0x1A,0x01,0x64,0x46,0x33,0xD7,
-  0xD3,0x7D,0xFE,0xA4,0x99,0x00,0x00,0x01,0x00,0x60,0xFF,0xEC,0x04,0x6A,0x05,0xCB,
-  0x00,0x27,0x00,0x6A,0x40,0x14,0x0B,0x02,0x02,0x07,0x22,0x11,0x29,0x1B,0x16,0x16,
-  0x0C,0x00,0x07,0x5A,0x1D,0x19,0x15,0x18,0x09,0x17,0xB8,0x01,0x07,0xB4,0x16,0x0C,
-  0x16,0x03,0x1B,0xB8,0x01,0x07,0x40,0x1D,0x1C,0x00,0x1C,0x0F,0x1C,0x1F,0x1C,0x2F,
-  0x1C,0x5F,0x1C,0x9F,0x1C,0xDF,0x1C,0x06,0x16,0x1C,0x16,0x1C,0x0E,0x25,0x5F,0x20,
-  0x04,0x0E,0x5F,0x13,0x13,0x00,0x3F,0xE1,0x3F,0xE1,0x12,0x39,0x39,0x2F,0x2F,0x5D,
-  0x11,0x33,0x10,0xE1,0x32,0x11,0x33,0x10,0xE1,0x32,0x01,0x2F,0x33,0x33,0x33,0xE1,
-  0x32,0x32,0x33,0x2F,0x33,0x10,0xCE,0x32,0x11,0x39,0x11,0x33,0x31,0x30,0x01,0x21,
-  0x15,0x21,0x14,0x07,0x07,0x15,0x14,0x17,0x21,0x15,0x21,0x12,0x21,0x32,0x37,0x15,
-  0x06,0x23,0x20,0x03,0x23,0x35,0x33,0x27,0x37,0x23,0x35,0x33,0x12,0x00,0x33,0x32,
-  0x17,0x07,0x26,0x23,0x22,0x06,0x01,0xBA,0x01,0xB0,0xFE,0x42,0x01,0x01,0x02,0x01,
-  0x81,0xFE,0x91,0x49,0x01,0x28,0x88,0x84,0x7A,0xA0,0xFE,0x41,0x5E,0xA4,0x94,0x02,
-  0x02,0x94,0xA0,0x27,0x01,0x19,0xDB,0xBF,0x90,0x4F,0x7A,0x78,0x88,0xC2,0x03,0xA6,
-  0x89,0x0F,0x0E,0x19,0x3E,0x14,0x16,0x89,0xFE,0x99,0x3A,0xA2,0x3B,0x02,0x0A,0x89,
-  0x26,0x78,0x89,0x01,0x06,0x01,0x1F,0x5C,0x92,0x4A,0xC7,0x00,0x00,0x04,0x00,0x08,
-  0xFF,0xF8,0x04,0xC7,0x05,0xC1,0x00,0x13,0x00,0x17,0x00,0x23,0x00,0x2B,0x00,0xA4,
-  0xB9,0x00,0x22,0xFF,0xE0,0xB3,0x09,0x0D,0x48,0x20,0xB8,0xFF,0xE0,0x40,0x1E,0x09,
-  0x0D,0x48,0x1C,0x20,0x09,0x0D,0x48,0x1A,0x20,0x09,0x0D,0x48,0x66,0x2A,0x96,0x2A,
-  0xA6,0x2A,0x03,0x2A,0xB4,0x1B,0xB5,0x21,0x15,0x16,0x17,0x14,0x16,0xB8,0xFF,0xC0,
-  0x40,0x45,0x15,0x18,0x48,0x14,0x40,0x15,0x18,0x48,0x16,0x14,0x16,0x14,0x0F,0x69,
-  0x26,0x99,0x26,0xA9,0x26,0x03,0x26,0xB4,0x21,0x2D,0x00,0x10,0x09,0x20,0x09,0x50,
-  0x09,0x90,0x09,0xA0,0x09,0x05,0x09,0x66,0x05,0x96,0x05,0xA6,0x05,0x03,0x05,0xB4,
-  0x0F,0x28,0xB6,0x1E,0xB7,0x24,0xB6,0x18,0x19,0x17,0x06,0x15,0x18,0x09,0x07,0xB6,
-  0x0C,0xB7,0x03,0xB6,0x01,0x12,0x07,0x00,0x3F,0x33,0xE1,0xF4,0xE1,0x33,0x3F,0x3F,
-  0x3F,0xE1,0xF4,0xE1,0x01,0x2F,0xE1,0x5D,0xC4,0x5D,0x32,0x10,0xD6,0xE1,0x5D,0x12,
-  0x39,0x39,0x2F,0x2F,0x2B,0x2B,0x11,0x33,0x11,0x33,0x10,0xF4,0xE1,0x5D,0x31,0x30,
-  0x2B,0x2B,0x2B,0x2B,0x01,0x07,0x26,0x23,0x22,0x15,0x14,0x33,0x32,0x37,0x15,0x06,
-  0x23,0x22,0x26,0x35,0x34,0x36,0x33,0x32,0x05,0x01,0x23,0x01,0x13,0x22,0x26,0x35,
-  0x34,0x36,0x33,0x32,0x16,0x15,0x14,0x06,0x27,0x32,0x35,0x34,0x23,0x22,0x15,0x14,
-  0x02,0x14,0x20,0x52,0x44,0xC6,0xC2,0x67,0x49,0x4A,0x6C,0x9C,0xB0,0xB4,0xA2,0x63,
-  0x02,0x51,0xFD,0x27,0x9D,0x02,0xD9,0x21,0x84,0xAA,0xA6,0x8C,0x83,0xAA,0xA4,0x8B,
-  0x9B,0x9B,0x9E,0x05,0x9C,0x6B,0x21,0xEA,0xE5,0x21,0x6B,0x25,0xAF,0xA3,0xAB,0xB0,
-  0x0B,0xFA,0x4A,0x05,0xB6,0xFA,0x42,0xB9,0x9D,0xA1,0xB5,0xBB,0x9B,0x9E,0xB8,0x6C,
-  0xEA,0xE7,0xE7,0xEA,0x00,0x02,0x00,0xE3,0xFF,0xEC,0x03,0xE7,0x05,0xCB,0x00,0x19,
-  0x00,0x21,0x00,0x6A,0x40,0x3E,0x1A,0x16,0x6E,0x06,0x0C,0x06,0x09,0x09,0x06,0x1C,
-  0x70,0x13,0x00,0x70,0x01,0x3F,0x06,0x01,0x00,0x06,0x01,0x3F,0x13,0x9F,0x13,0xAF,
-  0x13,0xBF,0x13,0x04,0x20,0x01,0x01,0x06,0x13,0x01,0x01,0x13,0x06,0x03,0x22,0x23,
-  0x09,0x07,0x15,0x76,0x0C,0x0A,0x1A,0x1A,0x18,0x1E,0x76,0x10,0x06,0x18,0x75,0x03,
-  0x01,0x01,0x03,0x19,0x00,0x3F,0x33,0x2F,0x10,0xE1,0x3F,0xE1,0x12,0x39,0x2F,0x33,
-  0x33,0xE1,0x32,0x32,0x11,0x12,0x01,0x17,0x39,0x2F,0x2F,0x2F,0x5D,0x5D,0x5D,0x5D,
-  0x10,0xE1,0x10,0xE1,0x11,0x33,0x2F,0x11,0x33,0x10,0xE1,0x32,0x31,0x30,0x01,0x33,
-  0x02,0x21,0x22,0x26,0x35,0x35,0x06,0x07,0x35,0x36,0x37,0x11,0x34,0x36,0x33,0x32,
-  0x16,0x15,0x10,0x05,0x11,0x14,0x33,0x32,0x01,0x36,0x11,0x34,0x23,0x22,0x06,0x15,
-  0x03,0x75,0x72,0x12,0xFE,0xF4,0x8B,0x9A,0x56,0x6B,0x48,0x79,0x89,0x85,0x6E,0x7E,
-  0xFE,0xAC,0x91,0x90,0xFE,0xDF,0xCF,0x67,0x35,0x33,0x01,0x4C,0xFE,0xA0,0xB7,0xAD,
-  0xE7,0x1F,0x1A,0x79,0x13,0x28,0x01,0xEE,0x8C,0x9F,0xA5,0x88,0xFE,0x9D,0xBA,0xFE,
-  0xD3,0xDD,0x02,0x8B,0x79,0x01,0x1D,0xBC,0x51,0x6B,0x00,0x04,0x00,0x19,0x00,0x00,
-  0x04,0xB8,0x05,0xB6,0x00,0x0F,0x00,0x1A,0x00,0x26,0x00,0x2A,0x00,0xF0,0x40,0x15,
-  0x14,0x19,0x24,0x19,0x02,0x14,0x17,0x24,0x17,0x02,0x1B,0x14,0x2B,0x14,0x02,0x1B,
-  0x12,0x2B,0x12,0x02,0x09,0xB8,0xFF,0xD0,0x40,0x28,0x12,0x15,0x48,0x74,0x09,0x84,
-  0x09,0x02,0x56,0x09,0x66,0x09,0x02,0x37,0x09,0x47,0x09,0x02,0x01,0x30,0x12,0x15,
-  0x48,0x7B,0x01,0x8B,0x01,0x02,0x59,0x01,0x69,0x01,0x02,0x38,0x01,0x48,0x01,0x02,
-  0x27,0x24,0xB8,0x01,0x03,0xB3,0x13,0x0B,0x01,0x0E,0xB8,0x01,0x03,0x40,0x18,0x0F,
-  0x6F,0x13,0x9F,0x13,0xAF,0x13,0xCF,0x13,0xDF,0x13,0x05,0x13,0x0F,0x13,0x0F,0x07,
-  0x2A,0x40,0x15,0x18,0x48,0x2A,0x1E,0xB8,0x01,0x03,0xB4,0x18,0x2C,0x09,0x03,0x06,
-  0xB8,0x01,0x03,0x40,0x31,0x07,0x1B,0xB6,0x10,0x21,0xB6,0x15,0x0F,0x10,0x1F,0x10,
-  0x02,0x10,0x15,0x10,0x15,0x0E,0x4B,0x02,0x5B,0x02,0x02,0x02,0x40,0x09,0x0C,0x48,
-  0x02,0x08,0x03,0x85,0x28,0x01,0x56,0x28,0x66,0x28,0x76,0x28,0x03,0x28,0x61,0x27,
-  0x44,0x0A,0x54,0x0A,0x02,0x0A,0xB8,0xFF,0xC0,0xB6,0x09,0x0C,0x48,0x0A,0x01,0x07,
-  0x12,0x00,0x3F,0x33,0x33,0x2B,0x5D,0x33,0xE0,0x5D,0x5D,0x3F,0x33,0x2B,0x5D,0x33,
-  0x39,0x39,0x2F,0x2F,0x5D,0x10,0xE1,0x10,0xE1,0x01,0x2F,0xE1,0x32,0x32,0x10,0xD6,
-  0xE1,0xC4,0x2B,0x12,0x39,0x39,0x2F,0x2F,0x5D,0x10,0xE1,0x32,0x32,0x10,0xE1,0xC4,
-  0x31,0x30,0x5D,0x5D,0x5D,0x2B,0x5D,0x5D,0x5D,0x2B,0x5D,0x5D,0x5D,0x5D,0x21,0x23,
-  0x01,0x23,0x16,0x15,0x11,0x23,0x11,0x33,0x01,0x33,0x02,0x35,0x11,0x33,0x01,0x22,
-  0x26,0x35,0x10,0x33,0x32,0x16,0x15,0x14,0x06,0x27,0x32,0x36,0x35,0x34,0x26,0x23,
-  0x22,0x06,0x15,0x14,0x16,0x03,0x35,0x21,0x15,0x02,0x89,0xAE,0xFE,0xBB,0x09,0x13,
-  0x87,0xB0,0x01,0x43,0x06,0x0E,0x85,0x01,0x31,0x72,0x87,0xFD,0x72,0x88,0x84,0x78,
-  0x3F,0x30,0x30,0x3F,0x40,0x30,0x30,0x93,0x01,0x9E,0x04,0x91,0xFD,0xA4,0xFD,0x10,
-  0x05,0xB6,0xFB,0x75,0x01,0x2F,0x64,0x02,0xF8,0xFB,0x5C,0xBB,0xA2,0x01,0x5A,0xB7,
-  0xA3,0xA8,0xB5,0x79,0x73,0x71,0x72,0x6D,0x6E,0x71,0x70,0x74,0xFE,0x75,0x93,0x93,
-  0x00,0x02,0x00,0x00,0x02,0xE5,0x04,0x9C,0x05,0xB6,0x00,0x07,0x00,0x19,0x00,0x6B,
-  0x40,0x3F,0x18,0x11,0x14,0xC4,0x13,0x0F,0x09,0x0C,0xC4,0x0D,0xBF,0x0D,0x01,0x06,
-  0x0D,0x06,0x0D,0x01,0x1F,0x13,0x01,0x13,0x1B,0xB6,0x03,0xC6,0x03,0x02,0x9B,0x03,
-  0xAB,0x03,0x02,0x7A,0x03,0x8A,0x03,0x02,0x03,0x00,0xC4,0x00,0x01,0x01,0x01,0x07,
-  0x03,0xC8,0x04,0x10,0x09,0x18,0x03,0x04,0x14,0x0D,0x08,0x01,0x01,0x11,0x0E,0x04,
-  0x03,0x00,0x3F,0x33,0x33,0x33,0x2F,0x33,0x33,0x33,0x12,0x17,0x39,0x10,0xE1,0x32,
-  0x01,0x2F,0x5D,0xE1,0x33,0x5D,0x5D,0x5D,0x10,0xCE,0x5D,0x11,0x39,0x39,0x2F,0x2F,
-  0x5D,0x10,0xE1,0x32,0x32,0x10,0xE1,0x32,0x32,0x31,0x30,0x01,0x23,0x11,0x23,0x35,
-  0x21,0x15,0x23,0x01,0x03,0x23,0x17,0x11,0x23,0x11,0x33,0x13,0x13,0x33,0x11,0x23,
-  0x11,0x34,0x37,0x23,0x03,0x01,0x2F,0x7F,0xB0,0x01,0xE1,0xB2,0x01,0xEE,0x92,0x0C,
-  0x0A,0x7B,0xBB,0x8B,0x95,0xB3,0x7F,0x0A,0x0C,0x9A,0x02,0xE5,0x02,0x65,0x6C,0x6C,
-  0xFD,0x9B,0x02,0x25,0xB4,0xFE,0x8F,0x02,0xD1,0xFD,0xEA,0x02,0x16,0xFD,0x2F,0x01,
-  0x56,0x57,0x78,0xFD,0xDB,0x00,0xFF,0xFF,0x00,0x4A,0x00,0x00,0x04,0x87,0x05,0xCD,
-  0x02,0x06,0x01,0x76,0x00,0x00,0x00,0x02,0x00,0x52,0xFF,0xDD,0x04,0x77,0x04,0x48,
-  0x00,0x13,0x00,0x1A,0x00,0x3C,0x40,0x1A,0x14,0x07,0x00,0x1C,0x1A,0x01,0x1F,0x0D,
-  0x2F,0x0D,0x3F,0x0D,0x03,0x0D,0x01,0x77,0x1A,0x1A,0x04,0x17,0x77,0x10,0x0F,0x04,
-  0x77,0x06,0xB8,0xFF,0xE0,0xB5,0x09,0x0C,0x48,0x06,0x0A,0x19,0x00,0x3F,0x33,0x2B,
-  0xE1,0x3F,0xE1,0x12,0x39,0x2F,0xE1,0x01,0x2F,0x5D,0x33,0x32,0x10,0xCE,0x32,0x32,
-  0x31,0x30,0x01,0x21,0x11,0x16,0x33,0x32,0x37,0x17,0x06,0x06,0x23,0x22,0x00,0x35,
-  0x10,0x00,0x33,0x32,0x00,0x15,0x27,0x11,0x26,0x23,0x22,0x07,0x11,0x04,0x77,0xFC,
-  0xC4,0x7B,0xAE,0xFE,0x8E,0x47,0x61,0xDB,0x97,0xF0,0xFE,0xDE,0x01,0x33,0xDF,0xE7,
-  0x01,0x2C,0xE8,0x79,0xB4,0xAB,0x7C,0x02,0x12,0xFE,0x9C,0x7B,0xEA,0x29,0x9C,0x7B,
-  0x01,0x44,0xF1,0x01,0x05,0x01,0x31,0xFE,0xCA,0xFB,0x51,0x01,0x15,0x77,0x75,0xFE,
-  0xE9,0x00,0xFF,0xFF,0x00,0x12,0xFF,0xF6,0x04,0xB6,0x05,0xB6,0x02,0x27,0x00,0x7B,
-  0xFE,0xA3,0x00,0x00,0x00,0x26,0x02,0x17,0xC8,0x00,0x01,0x07,0x02,0x40,0x01,0x56,
-  0xFD,0x67,0x00,0x54,0x40,0x37,0x04,0x03,0x02,0x14,0x18,0x04,0x03,0x02,0xF0,0x14,
-  0x01,0x80,0x14,0x01,0x10,0x14,0x01,0x00,0x14,0x01,0x14,0x01,0xAB,0x0D,0x01,0x94,
-  0x0D,0x01,0x64,0x0D,0x01,0x54,0x0D,0x01,0x44,0x0D,0x01,0x0D,0x00,0xF0,0x00,0x01,
-  0xE0,0x00,0x01,0xB0,0x00,0x01,0x50,0x00,0x01,0x40,0x00,0x01,0x00,0x11,0x5D,0x5D,
-  0x5D,0x5D,0x5D,0x35,0x11,0x5D,0x5D,0x5D,0x5D,0x5D,0x35,0x11,0x5D,0x5D,0x5D,0x5D,
-  0x35,0x35,0x35,0x00,0x3F,0x35,0x35,0x35,0xFF,0xFF,0x00,0x0B,0xFF,0xF6,0x04,0xCA,
-  0x05,0xC5,0x02,0x27,0x00,0x75,0xFE,0xB5,0x00,0x00,0x00,0x26,0x02,0x17,0xEF,0x00,
-  0x01,0x07,0x02,0x40,0x01,0x6A,0xFD,0x67,0x00,0x4C,0x40,0x31,0x04,0x03,0x02,0x28,
-  0x18,0x04,0x03,0x02,0xF0,0x28,0x01,0xB0,0x28,0x01,0x80,0x28,0x01,0x10,0x28,0x01,
-  0x00,0x28,0x01,0x28,0x01,0xF4,0x21,0x01,0xD4,0x21,0x01,0xC4,0x21,0x01,0xB4,0x21,
-  0x01,0x94,0x21,0x01,0x21,0x00,0xC0,0x00,0x01,0x7F,0x00,0x01,0x00,0x11,0x5D,0x5D,
-  0x35,0x11,0x5D,0x5D,0x5D,0x5D,0x5D,0x35,0x11,0x5D,0x5D,0x5D,0x5D,0x5D,0x35,0x35,
-  0x35,0x00,0x3F,0x35,0x35,0x35,0xFF,0xFF,0x00,0x18,0xFF,0xF6,0x04,0xCA,0x05,0xB6,
-  0x02,0x27,0x02,0x3D,0xFE,0xC8,0x00,0x00,0x00,0x26,0x02,0x17,0xEF,0x00,0x01,0x07,
-  0x02,0x40,0x01,0x6A,0xFD,0x67,0x00,0x50,0x40,0x34,0x04,0x03,0x02,0x22,0x18,0x04,
-  0x03,0x02,0xF0,0x22,0x01,0xB0,0x22,0x01,0x80,0x22,0x01,0x10,0x22,0x01,0x00,0x22,
-  0x01,0x22,0x01,0xF4,0x1B,0x01,0xD4,0x1B,0x01,0xC4,0x1B,0x01,0xB4,0x1B,0x01,0x94,
-  0x1B,0x01,0x1B,0x00,0xE0,0x00,0x01,0xD0,0x00,0x01,0xC0,0x00,0x01,0x00,0x11,0x5D,
-  0x5D,0x5D,0x35,0x11,0x5D,0x5D,0x5D,0x5D,0x5D,0x35,0x11,0x5D,0x5D,0x5D,0x5D,0x5D,
-  0x35,0x35,0x35,0x00,0x3F,0x35,0x35,0x35,0xFF,0xFF,0x00,0x1C,0xFF,0xF6,0x04,0xCA,
-  0x05,0xB6,0x02,0x27,0x02,0x3F,0xFE,0xAD,0x00,0x00,0x00,0x26,0x02,0x17,0xAF,0x00,
-  0x01,0x07,0x02,0x40,0x01,0x6A,0xFD,0x67,0x00,0x50,0x40,0x34,0x04,0x03,0x02,0x10,
-  0x18,0x04,0x03,0x02,0xF0,0x10,0x01,0xB0,0x10,0x01,0x80,0x10,0x01,0x10,0x10,0x01,
-  0x00,0x10,0x01,0x10,0x01,0xAB,0x09,0x01,0x6B,0x09,0x01,0x5B,0x09,0x01,0x4B,0x09,
-  0x01,0x34,0x09,0x01,0x24,0x09,0x01,0x09,0x00,0xC0,0x00,0x01,0x7F,0x00,0x01,0x00,
-  0x11,0x5D,0x5D,0x35,0x11,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x35,0x11,0x5D,0x5D,0x5D,
-  0x5D,0x5D,0x35,0x35,0x35,0x00,0x3F,0x35,0x35,0x35,0x00,0x02,0x00,0x79,0xFF,0xEC,
-  0x04,0x52,0x05,0xC5,0x00,0x14,0x00,0x1F,0x00,0x39,0x40,0x1E,0x06,0x06,0x10,0x15,
-  0x01,0x46,0x0B,0x21,0x1B,0x48,0x00,0x10,0x01,0x10,0x15,0x00,0x18,0x4E,0x13,0x13,
-  0x09,0x1D,0x50,0x0E,0x16,0x06,0x04,0x50,0x09,0x04,0x00,0x3F,0xE1,0x33,0x3F,0xE1,
-  0x11,0x39,0x2F,0xE1,0x32,0x32,0x01,0x2F,0x5D,0xE1,0x10,0xDE,0xE1,0x32,0x11,0x39,
-  0x2F,0x31,0x30,0x01,0x37,0x36,0x26,0x23,0x22,0x07,0x35,0x36,0x33,0x20,0x11,0x10,
-  0x00,0x21,0x20,0x11,0x34,0x00,0x33,0x32,0x13,0x26,0x26,0x23,0x22,0x02,0x15,0x14,
-  0x33,0x32,0x12,0x03,0x9C,0x02,0x09,0x85,0x99,0x83,0x7F,0x86,0x95,0x01,0xB0,0xFE,
-  0xAF,0xFE,0xE2,0xFE,0x96,0x01,0x14,0xF4,0xB8,0x42,0x16,0x7F,0x4C,0xA0,0xC5,0xBB,
-  0x8A,0xDB,0x03,0x5E,0x28,0xB5,0xF2,0x54,0xAE,0x3E,0xFD,0xE1,0xFE,0x7B,0xFD,0xCB,
-  0x01,0x8B,0xF9,0x01,0x82,0xFE,0xB6,0x55,0x69,0xFE,0xC0,0xB5,0xEC,0x01,0x32,0x00,
-  0x00,0x02,0x00,0x4A,0x00,0x00,0x04,0x83,0x05,0xB6,0x00,0x05,0x00,0x0C,0x00,0xC8,
-  0xB5,0x0C,0x10,0x0F,0x13,0x48,0x0B,0xB8,0xFF,0xF0,0xB6,0x0F,0x13,0x48,0xB7,0x02,
-  0x01,0x02,0xB8,0xFF,0xF8,0x40,0x44,0x0D,0x11,0x48,0x26,0x02,0x01,0x17,0x02,0x01,
-  0x06,0x02,0x01,0xB8,0x01,0x01,0x01,0x08,0x0D,0x11,0x48,0x29,0x01,0x01,0x18,0x01,
-  0x01,0x09,0x01,0x01,0xE7,0x02,0x01,0x02,0xE8,0x01,0x01,0x01,0x08,0x08,0x00,0x0C,
-  0x10,0x14,0x18,0x48,0x48,0x0C,0x58,0x0C,0x02,0x2A,0x0C,0x01,0x09,0x0C,0x19,0x0C,
-  0x02,0x0C,0x5F,0x03,0x6F,0x03,0x02,0x03,0x03,0x0E,0x0B,0xB8,0xFF,0xF0,0x40,0x36,
-  0x14,0x18,0x48,0x47,0x0B,0x57,0x0B,0x02,0x25,0x0B,0x01,0x06,0x0B,0x16,0x0B,0x02,
-  0x0B,0x50,0x00,0x60,0x00,0xE0,0x00,0xF0,0x00,0x04,0x00,0x00,0x03,0x0B,0x5F,0x05,
-  0x12,0x08,0x10,0x11,0x18,0x48,0x5B,0x08,0x01,0x29,0x08,0x39,0x08,0x49,0x08,0x03,
-  0x1D,0x08,0x01,0x08,0x01,0x03,0x00,0x3F,0x33,0x5D,0x5D,0x5D,0x2B,0x3F,0xE1,0x39,
-  0x39,0x01,0x2F,0x5D,0x33,0x5D,0x5D,0x5D,0x2B,0x11,0x33,0x2F,0x5D,0x33,0x5D,0x5D,
-  0x5D,0x2B,0x12,0x39,0x3D,0x2F,0x33,0x5D,0x33,0x5D,0x31,0x30,0x5D,0x5D,0x5D,0x2B,
-  0x5D,0x5D,0x5D,0x5D,0x2B,0x5D,0x2B,0x2B,0x37,0x01,0x33,0x01,0x15,0x21,0x01,0x26,
-  0x27,0x06,0x07,0x03,0x21,0x4A,0x01,0xBE,0xBB,0x01,0xC0,0xFB,0xC7,0x02,0x77,0x3B,
-  0x22,0x2D,0x2B,0xFA,0x02,0xA6,0x71,0x05,0x45,0xFA,0xB9,0x6F,0x03,0x9A,0xB6,0x9E,
-  0xC8,0x86,0xFD,0x04,0x00,0x01,0x00,0x9C,0xFE,0x14,0x04,0x58,0x05,0xB6,0x00,0x07,
-  0x00,0x31,0x40,0x0F,0x00,0x5A,0xE0,0x07,0xF0,0x07,0x02,0x07,0x09,0x03,0x5A,0x00,
-  0x04,0x01,0x04,0xB8,0xFF,0xC0,0x40,0x0B,0x14,0x18,0x48,0x04,0x02,0x5F,0x05,0x03,
-  0x04,0x00,0x1B,0x00,0x3F,0x32,0x3F,0xE1,0x01,0x2F,0x2B,0x5D,0xE1,0x10,0xDE,0x5D,
-  0xE1,0x31,0x30,0x01,0x11,0x21,0x11,0x23,0x11,0x21,0x11,0x03,0x9E,0xFD,0xB8,0xBA,
-  0x03,0xBC,0xFE,0x14,0x06,0xFC,0xF9,0x04,0x07,0xA2,0xF8,0x5E,0x00,0x01,0x00,0x4A,
-  0xFE,0x14,0x04,0x91,0x05,0xB6,0x00,0x0B,0x00,0x7A,0x40,0x52,0x37,0x09,0xD7,0x09,
-  0xE7,0x09,0xF7,0x09,0x04,0x26,0x09,0x01,0x07,0x09,0x17,0x09,0x02,0x37,0x07,0xD7,
-  0x07,0xE7,0x07,0xF7,0x07,0x04,0x26,0x07,0x01,0x07,0x07,0x17,0x07,0x02,0x38,0x02,
-  0xD8,0x02,0xE8,0x02,0xF8,0x02,0x04,0x19,0x02,0x29,0x02,0x02,0x08,0x02,0x01,0x08,
-  0x02,0x02,0x00,0x06,0x0A,0x0D,0x07,0x03,0x03,0x09,0x00,0x40,0x0A,0x0D,0x48,0x00,
-  0x03,0x07,0x5F,0x04,0x08,0x02,0x02,0x04,0x03,0x01,0x09,0x5F,0x00,0x1B,0x00,0x3F,
-  0xE1,0x39,0x3F,0x39,0x3D,0x2F,0x33,0x10,0xE1,0x39,0x01,0x18,0x2F,0x2B,0x33,0x33,
-  0x11,0x33,0x10,0xCE,0x32,0x11,0x39,0x2F,0x33,0x31,0x30,0x5D,0x5D,0x5D,0x5D,0x5D,
-  0x5D,0x5D,0x5D,0x5D,0x13,0x35,0x01,0x01,0x35,0x21,0x15,0x21,0x01,0x01,0x21,0x15,
-  0x4A,0x02,0x47,0xFD,0xC9,0x03,0xF6,0xFD,0x0E,0x02,0x11,0xFD,0xD5,0x03,0x4D,0xFE,
-  0x14,0x73,0x03,0x92,0x03,0x2B,0x72,0xA4,0xFD,0x09,0xFC,0x9D,0xA4,0x00,0x00,0x01,
-  0x00,0x98,0x02,0x87,0x04,0x33,0x03,0x1D,0x00,0x03,0x00,0x1A,0x40,0x0C,0x02,0x05,
-  0x00,0x01,0x01,0x01,0x01,0x04,0x00,0xAD,0x01,0xB3,0x00,0x3F,0xE1,0x11,0x01,0x33,
-  0x2F,0x5D,0x10,0xCE,0x31,0x30,0x13,0x35,0x21,0x15,0x98,0x03,0x9B,0x02,0x87,0x96,
-  0x96,0x00,0x00,0x01,0x00,0x17,0xFF,0xF2,0x04,0xB6,0x06,0xA0,0x00,0x08,0x00,0x2E,
-  0x40,0x15,0x01,0x00,0x06,0x06,0x07,0x08,0x08,0x0A,0x05,0x02,0x02,0x03,0x03,0xAE,
-  0x04,0x04,0x0F,0x07,0x01,0x07,0x00,0x00,0x2F,0x2F,0x5D,0x39,0x2F,0xE1,0x01,0x2F,
-  0x32,0x2F,0x33,0x11,0x33,0x2F,0x33,0x39,0x19,0x2F,0x33,0x33,0x31,0x30,0x05,0x23,
-  0x01,0x23,0x35,0x21,0x13,0x01,0x33,0x02,0x64,0x85,0xFE,0xEC,0xB4,0x01,0x28,0xE6,
-  0x02,0x00,0x91,0x0E,0x03,0x0A,0x8F,0xFD,0x69,0x05,0xAC,0x00,0x00,0x03,0x00,0x46,
-  0x01,0x91,0x04,0x85,0x04,0x0E,0x00,0x13,0x00,0x1D,0x00,0x27,0x00,0x5F,0xB9,0x00,
-  0x10,0xFF,0xE0,0xB3,0x09,0x0C,0x48,0x0E,0xB8,0xFF,0xE0,0x40,0x32,0x09,0x0C,0x48,
-  0x06,0x20,0x09,0x0C,0x48,0x04,0x20,0x09,0x0C,0x48,0x1E,0x0A,0x00,0x14,0x04,0x05,
-  0x23,0xAB,0x0F,0x0F,0x01,0x0F,0x29,0x19,0xAB,0x05,0x26,0x16,0xAE,0x0A,0x00,0x02,
-  0x0C,0x08,0x08,0x20,0x1C,0xAE,0x12,0x3F,0x02,0x8F,0x02,0xDF,0x02,0x03,0x02,0x00,
-  0x2F,0x5D,0x33,0xE1,0x32,0x33,0x2F,0x33,0x12,0x39,0x39,0xE1,0x32,0x01,0x2F,0xE1,
-  0x10,0xDE,0x5D,0xE1,0x11,0x17,0x39,0x31,0x30,0x2B,0x2B,0x2B,0x2B,0x01,0x06,0x23,
-  0x22,0x26,0x35,0x34,0x36,0x33,0x32,0x17,0x36,0x33,0x32,0x16,0x15,0x14,0x06,0x23,
-  0x22,0x03,0x26,0x23,0x22,0x06,0x15,0x14,0x16,0x33,0x32,0x37,0x16,0x33,0x32,0x36,
-  0x35,0x34,0x26,0x23,0x22,0x02,0x62,0x76,0x9A,0x77,0x95,0x95,0x77,0xA6,0x6C,0x74,
-  0xA5,0x76,0x92,0x97,0x71,0xAB,0xB5,0x52,0x6D,0x41,0x50,0x50,0x43,0x68,0xE4,0x56,
-  0x6B,0x41,0x50,0x54,0x40,0x67,0x02,0x6D,0xD5,0xAE,0x8D,0x86,0xB5,0xDB,0xD5,0xAC,
-  0x8F,0x83,0xB9,0x01,0x42,0xB8,0x6B,0x4F,0x51,0x65,0xB2,0xB9,0x6D,0x4E,0x4F,0x67,
-  0x00,0x01,0x00,0xEC,0xFE,0x14,0x03,0xE1,0x06,0x14,0x00,0x14,0x00,0x29,0x40,0x15,
-  0x01,0x06,0xAA,0x0C,0x10,0x10,0x01,0x10,0x10,0x15,0x16,0x03,0xAE,0x01,0x13,0x00,
-  0x0E,0xAE,0x0C,0x09,0x1B,0x00,0x3F,0x33,0xE1,0x3F,0x33,0xE1,0x11,0x12,0x01,0x39,
-  0x2F,0x5D,0x33,0xE1,0x32,0x31,0x30,0x01,0x15,0x26,0x23,0x22,0x15,0x11,0x14,0x06,
-  0x23,0x22,0x27,0x35,0x16,0x33,0x32,0x35,0x11,0x10,0x21,0x32,0x03,0xE1,0x38,0x3A,
-  0xAC,0xB2,0xA0,0x4E,0x37,0x3C,0x38,0xB4,0x01,0x4A,0x58,0x06,0x02,0x93,0x1A,0xE9,
-  0xFA,0xD7,0xAE,0xB5,0x13,0x93,0x18,0xE9,0x05,0x27,0x01,0x62,0x00,0x02,0x00,0x98,
-  0x01,0x7B,0x04,0x33,0x04,0x25,0x00,0x11,0x00,0x23,0x00,0x48,0x40,0x29,0x1C,0x09,
-  0x25,0x12,0x00,0x00,0x01,0x00,0x00,0x24,0x22,0xAD,0x1B,0x15,0xB2,0x1E,0x10,0xAD,
-  0x09,0x03,0xB2,0x07,0xAD,0x00,0x3F,0x0C,0x01,0x0C,0x0C,0x19,0xAD,0x12,0xDF,0x1E,
-  0x01,0x50,0x1E,0xA0,0x1E,0x02,0x1E,0x00,0x2F,0x5D,0x5D,0x33,0xE1,0x33,0x2F,0x5D,
-  0x33,0xE1,0xFD,0x32,0xE1,0x10,0xFD,0x32,0xE1,0x11,0x01,0x33,0x2F,0x5D,0x33,0x10,
-  0xCE,0x32,0x31,0x30,0x13,0x35,0x36,0x33,0x32,0x17,0x16,0x33,0x32,0x37,0x15,0x06,
-  0x23,0x22,0x27,0x26,0x23,0x22,0x03,0x35,0x36,0x33,0x32,0x17,0x16,0x33,0x32,0x37,
-  0x15,0x06,0x23,0x22,0x27,0x26,0x23,0x22,0x98,0x62,0x95,0x62,0x96,0x7F,0x4A,0x6D,
-  0x76,0x61,0x97,0x64,0x93,0x80,0x49,0x70,0x73,0x63,0x94,0x64,0x94,0x82,0x47,0x6C,
-  0x77,0x63,0x95,0x64,0x93,0x83,0x46,0x6C,0x03,0x14,0xA2,0x6D,0x40,0x37,0x79,0xA2,
-  0x6C,0x3F,0x37,0xFD,0xEE,0xA2,0x6C,0x3F,0x38,0x79,0xA2,0x6C,0x3F,0x38,0x00,0x01,
-  0x00,0x98,0x00,0xA4,0x04,0x33,0x05,0x04,0x00,0x13,0x00,0x6E,0x40,0x41,0x07,0x04,
-  0x03,0x00,0x04,0x13,0x08,0x08,0x0A,0x0D,0x0E,0x11,0x04,0x12,0x09,0x12,0x13,0x09,
-  0x13,0x09,0x13,0x06,0x0F,0x0B,0x15,0x02,0x00,0x06,0x01,0x06,0x06,0x14,0x0F,0x02,
-  0xAD,0x10,0x70,0x01,0x01,0x4F,0x01,0x5F,0x01,0x6F,0x01,0x03,0x00,0x01,0x01,0x01,
-  0x01,0x0C,0x05,0xAD,0x0B,0x8F,0x06,0x01,0x50,0x06,0x01,0x0F,0x06,0x01,0x06,0x00,
-  0x2F,0x5D,0x5D,0x5D,0x33,0xE1,0x32,0x33,0x2F,0x5D,0x5D,0x5D,0x33,0xE1,0x32,0x11,
-  0x01,0x33,0x2F,0x5D,0x33,0x10,0xCE,0x32,0x11,0x39,0x39,0x2F,0x2F,0x11,0x33,0x11,
-  0x12,0x17,0x39,0x33,0x11,0x12,0x17,0x39,0x31,0x30,0x01,0x23,0x35,0x21,0x13,0x21,
-  0x35,0x21,0x13,0x17,0x07,0x33,0x15,0x21,0x03,0x21,0x15,0x21,0x03,0x27,0x01,0x8F,
-  0xF7,0x01,0x3D,0x79,0xFE,0x4A,0x01,0xFB,0x86,0x89,0x69,0xFA,0xFE,0xC1,0x7B,0x01,
-  0xBA,0xFE,0x00,0x81,0x89,0x01,0xBA,0x96,0x01,0x04,0x95,0x01,0x1B,0x3B,0xE0,0x95,
-  0xFE,0xFC,0x96,0xFE,0xEA,0x39,0x00,0x02,0x00,0x98,0x00,0x00,0x04,0x33,0x04,0xC9,
-  0x00,0x06,0x00,0x0A,0x00,0x65,0x40,0x3F,0x67,0x06,0x77,0x06,0x87,0x06,0x03,0x68,
-  0x04,0x78,0x04,0x88,0x04,0x03,0x76,0x05,0x86,0x05,0x02,0x05,0x04,0x01,0x04,0x09,
-  0x00,0x0C,0x08,0x01,0x01,0x0B,0x02,0x01,0x05,0x05,0x03,0x06,0xE0,0x00,0x01,0xDF,
-  0x00,0x01,0x40,0x00,0x01,0x3F,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x04,0x20,0x03,
-  0xC0,0x03,0x02,0x0F,0x03,0x01,0x03,0x00,0x2F,0x5D,0x5D,0x33,0x33,0x2F,0x5D,0x5D,
-  0x5D,0x5D,0x5D,0x32,0x12,0x39,0x11,0x33,0x33,0x11,0x01,0x33,0x2F,0x33,0x10,0xCE,
-  0x32,0x32,0x11,0x12,0x39,0x5D,0x31,0x30,0x00,0x5D,0x5D,0x25,0x01,0x35,0x01,0x15,
-  0x09,0x02,0x35,0x21,0x15,0x04,0x33,0xFC,0x65,0x03,0x9B,0xFD,0x35,0x02,0xCB,0xFC,
-  0x65,0x03,0x9B,0xDD,0x01,0xC3,0x66,0x01,0xC3,0xA0,0xFE,0xAA,0xFE,0xAA,0xFE,0x83,
-  0x96,0x96,0x00,0x02,0x00,0x98,0x00,0x00,0x04,0x33,0x04,0xC9,0x00,0x06,0x00,0x0A,
-  0x00,0x63,0x40,0x3E,0x68,0x02,0x78,0x02,0x88,0x02,0x03,0x67,0x00,0x77,0x00,0x87,
-  0x00,0x03,0x79,0x01,0x89,0x01,0x02,0x01,0x06,0x09,0x04,0x0C,0x08,0x02,0x06,0x06,
-  0x0B,0x05,0x04,0x01,0x01,0x03,0x00,0xE0,0x06,0x01,0xDF,0x06,0x01,0x40,0x06,0x01,
-  0x3F,0x06,0x01,0x00,0x06,0x01,0x06,0x06,0x02,0x20,0x03,0xC0,0x03,0x02,0x0F,0x03,
-  0x01,0x03,0x00,0x2F,0x5D,0x5D,0x33,0x33,0x2F,0x5D,0x5D,0x5D,0x5D,0x5D,0x33,0x12,
-  0x39,0x11,0x33,0x33,0x11,0x01,0x33,0x2F,0x33,0x33,0x10,0xCE,0x32,0x11,0x39,0x5D,
-  0x31,0x30,0x00,0x5D,0x5D,0x13,0x01,0x01,0x35,0x01,0x15,0x01,0x15,0x35,0x21,0x15,
-  0x98,0x02,0xCA,0xFD,0x36,0x03,0x9B,0xFC,0x65,0x03,0x9B,0x01,0x7D,0x01,0x56,0x01,
-  0x56,0xA0,0xFE,0x3D,0x66,0xFE,0x3D,0xDD,0x96,0x96,0x00,0x02,0x00,0x7D,0x00,0x00,
-  0x04,0x50,0x05,0xC3,0x00,0x05,0x00,0x09,0x00,0x44,0x40,0x1F,0x02,0x01,0x09,0x09,
-  0x05,0x04,0x07,0x07,0x03,0x06,0x00,0x0B,0x08,0x00,0x03,0x01,0x03,0x03,0x0A,0x00,
-  0x06,0x06,0x03,0x08,0x08,0x01,0x07,0x04,0x03,0x09,0x01,0x00,0x2F,0x33,0x3F,0x33,
-  0x12,0x39,0x3D,0x2F,0x33,0x33,0x11,0x33,0x11,0x01,0x33,0x18,0x2F,0x5D,0x33,0x10,
-  0xCE,0x32,0x11,0x39,0x3D,0x2F,0x33,0x33,0x33,0x2F,0x33,0x33,0x31,0x30,0x01,0x01,
-  0x23,0x01,0x01,0x33,0x09,0x03,0x04,0x50,0xFE,0x3B,0x4C,0xFE,0x3E,0x01,0xC2,0x4C,
-  0x01,0x0D,0xFE,0xCE,0xFE,0xCF,0x01,0x31,0x02,0xE1,0xFD,0x1F,0x02,0xDF,0x02,0xE4,
-  0xFD,0x1E,0x02,0x00,0xFE,0x00,0xFD,0xFE,0x00,0x03,0x00,0x31,0x00,0x00,0x04,0x2B,
-  0x06,0x1F,0x00,0x15,0x00,0x1E,0x00,0x22,0x00,0x52,0x40,0x2B,0x1D,0x20,0x47,0x1F,
-  0x0D,0x00,0x00,0x03,0x18,0x1F,0x24,0x14,0x02,0x47,0x03,0x07,0x03,0x05,0x05,0x03,
-  0x1B,0x53,0xAF,0x16,0x01,0x16,0x16,0x0B,0x04,0x01,0x4F,0x21,0x07,0x14,0x0F,0x10,
-  0x50,0x0E,0x0B,0x01,0x20,0x02,0x15,0x00,0x3F,0x33,0x3F,0x33,0xE1,0x3F,0x33,0x33,
-  0xE1,0x32,0x12,0x39,0x2F,0x5D,0xED,0x01,0x2F,0x33,0x2F,0x11,0x33,0x10,0xE1,0x32,
-  0x10,0xCE,0x32,0x11,0x39,0x2F,0x39,0x10,0xE1,0x32,0x31,0x30,0x01,0x23,0x11,0x23,
-  0x11,0x23,0x35,0x37,0x35,0x34,0x36,0x33,0x32,0x17,0x07,0x26,0x23,0x22,0x06,0x15,
-  0x15,0x33,0x01,0x32,0x15,0x14,0x06,0x23,0x22,0x35,0x34,0x13,0x23,0x11,0x33,0x02,
-  0xA0,0xF6,0xB6,0xC3,0xC3,0x99,0xB2,0x61,0x64,0x2F,0x4F,0x40,0x5C,0x40,0xF6,0x01,
-  0x21,0x6A,0x3F,0x2B,0x6B,0xC5,0xB7,0xB7,0x03,0xC1,0xFC,0x3F,0x03,0xC1,0x4B,0x44,
-  0x60,0xBE,0xB1,0x25,0x8D,0x1C,0x65,0x72,0x68,0x01,0x9B,0x72,0x3A,0x39,0x73,0x72,
-  0xFA,0x1B,0x04,0x4A,0x00,0x02,0x00,0x31,0x00,0x00,0x04,0x1B,0x06,0x1F,0x00,0x15,
-  0x00,0x19,0x00,0x42,0x40,0x22,0x0D,0x16,0x00,0x00,0x03,0x17,0x47,0x16,0x1B,0x14,
-  0x02,0x47,0x03,0x07,0x03,0x05,0x05,0x03,0x18,0x00,0x04,0x01,0x4F,0x07,0x14,0x0F,
-  0x10,0x50,0x0E,0x0B,0x01,0x17,0x02,0x15,0x00,0x3F,0x33,0x3F,0x33,0xE1,0x3F,0x33,
-  0xE1,0x32,0x3F,0x01,0x2F,0x33,0x2F,0x11,0x33,0x10,0xE1,0x32,0x10,0xDE,0xE1,0x12,
-  0x39,0x2F,0x12,0x39,0x31,0x30,0x01,0x23,0x11,0x23,0x11,0x23,0x35,0x37,0x35,0x34,
-  0x36,0x33,0x32,0x17,0x07,0x26,0x23,0x22,0x06,0x15,0x15,0x33,0x01,0x23,0x11,0x33,
-  0x02,0xA0,0xF6,0xB6,0xC3,0xC3,0x99,0xB2,0x61,0x64,0x2F,0x4F,0x40,0x5C,0x40,0xF6,
-  0x01,0x7B,0xB7,0xB7,0x03,0xC1,0xFC,0x3F,0x03,0xC1,0x4B,0x44,0x60,0xBE,0xB1,0x25,
-  0x8D,0x1C,0x65,0x72,0x68,0xFB,0xB6,0x06,0x14,0x00,0x00,0x01,0x00,0xE7,0x04,0xD9,
-  0x03,0xE5,0x06,0x17,0x00,0x0B,0x00,0x2D,0x40,0x10,0x06,0x88,0x00,0x05,0x01,0x05,
-  0x05,0x0B,0x88,0x00,0x00,0x0D,0x05,0x00,0x92,0x09,0xB8,0x01,0x01,0xB5,0x0F,0x02,
-  0x5F,0x02,0x02,0x02,0x00,0x2F,0x5D,0xE1,0xE4,0x32,0x11,0x01,0x33,0x2F,0xE1,0x33,
-  0x2F,0x5D,0xE1,0x31,0x30,0x01,0x02,0x21,0x22,0x26,0x27,0x33,0x16,0x16,0x33,0x32,
-  0x37,0x03,0xE5,0x14,0xFE,0x8F,0xC3,0xAC,0x0A,0xAA,0x08,0x54,0x77,0xC2,0x11,0x06,
-  0x17,0xFE,0xC2,0x94,0xAA,0x66,0x55,0xBB,0x00,0x01,0x00,0x87,0xFE,0x14,0x03,0x56,
-  0x04,0x4A,0x00,0x0F,0x00,0x2F,0x40,0x1A,0x08,0x00,0x06,0x47,0x90,0x0B,0xA0,0x0B,
-  0x02,0x0B,0x0B,0x10,0x11,0x00,0x00,0x01,0x00,0x03,0x50,0x01,0x0E,0x1B,0x07,0x4E,
-  0x0A,0x0F,0x00,0x3F,0xE1,0x3F,0x33,0xE1,0x01,0x2F,0x5D,0x11,0x12,0x39,0x2F,0x5D,
-  0xE1,0x11,0x39,0x31,0x30,0x13,0x35,0x16,0x33,0x32,0x36,0x35,0x11,0x25,0x35,0x21,
-  0x11,0x14,0x06,0x23,0x22,0x87,0x86,0x9B,0x75,0x83,0xFE,0x5C,0x02,0x5A,0xE2,0xCE,
-  0xA4,0xFE,0x37,0x9A,0x27,0x72,0x65,0x04,0x39,0x15,0x7B,0xFB,0x41,0xB4,0xC3,0x00,
-  0x00,0x01,0x01,0xEE,0x04,0xCD,0x02,0xDF,0x06,0x14,0x00,0x09,0x00,0x16,0x40,0x09,
-  0x09,0x09,0x04,0x04,0x0B,0x08,0x92,0x03,0x00,0x00,0x3F,0xED,0x11,0x01,0x33,0x2F,
-  0x33,0x2F,0x31,0x30,0x01,0x37,0x36,0x37,0x33,0x15,0x14,0x06,0x07,0x23,0x01,0xEE,
-  0x1A,0x1A,0x09,0xB4,0x54,0x3D,0x60,0x04,0xE7,0x6B,0x74,0x4E,0x14,0x0E,0xC6,0x5F,
-  0x00,0x01,0x01,0xE3,0xFE,0x3B,0x02,0xE9,0xFF,0x83,0x00,0x08,0x00,0x1B,0x40,0x0D,
-  0x08,0x08,0x03,0x03,0x0A,0x07,0x92,0x0F,0x02,0x1F,0x02,0x02,0x02,0x00,0x2F,0x5D,
-  0xED,0x11,0x01,0x33,0x2F,0x33,0x2F,0x31,0x30,0x01,0x36,0x37,0x33,0x15,0x14,0x06,
-  0x07,0x23,0x01,0xE3,0x3E,0x16,0xB2,0x60,0x43,0x63,0xFE,0x56,0x8C,0xA1,0x14,0x16,
-  0xCC,0x52,0x00,0x01,0x01,0xE3,0x04,0xD9,0x02,0xE9,0x06,0x21,0x00,0x08,0x00,0x1B,
-  0x40,0x0D,0x03,0x03,0x08,0x08,0x0A,0x07,0x92,0x0F,0x02,0x5F,0x02,0x02,0x02,0x00,
-  0x2F,0x5D,0xED,0x11,0x01,0x33,0x2F,0x33,0x2F,0x31,0x30,0x01,0x06,0x07,0x23,0x35,
-  0x34,0x36,0x37,0x33,0x02,0xE9,0x3F,0x14,0xB3,0x5B,0x49,0x62,0x06,0x06,0x99,0x94,
-  0x15,0x11,0xC9,0x59,0x00,0x02,0x01,0x39,0x02,0x39,0x03,0x93,0x05,0xC7,0x00,0x09,
-  0x00,0x11,0x00,0x22,0x40,0x12,0x0C,0xE0,0x30,0x08,0x01,0x08,0x08,0x10,0xE0,0x03,
-  0x0E,0xE6,0x05,0xDE,0x0A,0xE6,0x00,0xDF,0x00,0x3F,0xE1,0x3F,0xE1,0x01,0x2F,0xE1,
-  0x33,0x2F,0x5D,0xE1,0x31,0x30,0x01,0x22,0x26,0x35,0x10,0x21,0x32,0x16,0x15,0x10,
-  0x25,0x32,0x11,0x10,0x23,0x22,0x11,0x10,0x02,0x64,0x8E,0x9D,0x01,0x2B,0x95,0x9A,
-  0xFE,0xD1,0x9C,0x9C,0x97,0x02,0x39,0xEA,0xDF,0x01,0xC5,0xEC,0xD9,0xFE,0x37,0x83,
-  0x01,0x46,0x01,0x44,0xFE,0xBC,0xFE,0xBA,0x00,0x02,0x01,0x25,0x02,0xA8,0x03,0x7F,
-  0x05,0xC3,0x00,0x0A,0x00,0x11,0x00,0x56,0x40,0x34,0x11,0x5F,0x06,0xCF,0x06,0x02,
-  0x06,0x06,0x09,0x68,0x00,0x78,0x00,0x02,0x00,0x20,0x0B,0x0E,0x48,0x00,0x02,0xE0,
-  0x0B,0x07,0x1F,0x03,0x8F,0x03,0x02,0x03,0x03,0x12,0x13,0x04,0x01,0xE4,0x11,0x06,
-  0x0E,0x07,0x0B,0x09,0x1B,0x09,0x02,0x09,0x09,0x02,0x07,0xDE,0x02,0xDF,0x00,0x3F,
-  0x3F,0x12,0x39,0x2F,0x5D,0x12,0x39,0x33,0x33,0xE1,0x32,0x11,0x12,0x01,0x39,0x2F,
-  0x5D,0x33,0x33,0xE1,0x32,0x2B,0x5D,0x32,0x33,0x2F,0x5D,0x33,0x31,0x30,0x01,0x23,
-  0x15,0x23,0x35,0x21,0x35,0x01,0x33,0x11,0x33,0x23,0x35,0x34,0x37,0x06,0x07,0x07,
-  0x03,0x7F,0x54,0x8F,0xFE,0x89,0x01,0x79,0x8D,0x54,0xE3,0x06,0x28,0x28,0x9C,0x03,
-  0x56,0xAE,0xAE,0x62,0x02,0x0B,0xFE,0x04,0xB0,0x52,0x5A,0x49,0x3A,0xD9,0x00,0x01,
-  0x01,0x50,0x02,0x91,0x03,0x44,0x05,0xB6,0x00,0x18,0x00,0x5C,0x40,0x39,0x0E,0x0F,
-  0x0F,0x0B,0x0C,0x40,0x10,0x18,0x48,0x0A,0x0C,0x0A,0x0C,0x00,0x05,0xE0,0x0F,0x14,
-  0x1F,0x14,0x4F,0x14,0x5F,0x14,0x7F,0x14,0x8F,0x14,0x9F,0x14,0x07,0x14,0x14,0xCF,
-  0x00,0x01,0x70,0x00,0x01,0x00,0x0A,0x09,0x09,0x07,0xE5,0x11,0x11,0x0B,0x03,0xE4,
-  0x01,0x17,0xDF,0x0E,0xE4,0x0B,0xDC,0x00,0x3F,0xE1,0x3F,0x33,0xE1,0x11,0x39,0x2F,
-  0xE1,0x33,0x12,0x39,0x01,0x2F,0x5D,0x5D,0x33,0x2F,0x5D,0xE1,0x12,0x39,0x39,0x2F,
-  0x2F,0x2B,0x33,0x33,0x11,0x33,0x31,0x30,0x01,0x35,0x16,0x33,0x32,0x35,0x34,0x23,
-  0x22,0x07,0x27,0x13,0x21,0x15,0x21,0x07,0x36,0x33,0x32,0x16,0x15,0x14,0x06,0x23,
-  0x22,0x01,0x50,0x66,0x69,0xA2,0xA6,0x34,0x49,0x3E,0x1F,0x01,0x8D,0xFE,0xE0,0x11,
-  0x23,0x3D,0x76,0x93,0x96,0x91,0x7C,0x02,0xC1,0x81,0x44,0x93,0x92,0x11,0x27,0x01,
-  0x7D,0x6E,0xC1,0x06,0x82,0x6D,0x7F,0x8E,0x00,0x02,0x01,0x39,0x02,0x39,0x03,0x93,
-  0x05,0xD5,0x00,0x10,0x00,0x1B,0x00,0x38,0x40,0x1E,0x03,0x16,0xE0,0x0F,0x01,0x0F,
-  0x11,0xE0,0x30,0x09,0x01,0x09,0x09,0x0F,0x03,0x13,0xE4,0x00,0x06,0x01,0x06,0x06,
-  0x00,0x19,0xE6,0x0C,0xDF,0x01,0x00,0xDE,0x00,0x3F,0x32,0x3F,0xE1,0x11,0x39,0x2F,
-  0x5D,0xE1,0x32,0x01,0x2F,0x33,0x2F,0x5D,0xE1,0x12,0x39,0x10,0xE1,0x32,0x31,0x30,
-  0x01,0x17,0x04,0x07,0x33,0x36,0x33,0x32,0x16,0x15,0x14,0x06,0x23,0x22,0x26,0x35,
-  0x10,0x01,0x34,0x23,0x22,0x06,0x15,0x14,0x16,0x33,0x32,0x36,0x03,0x1D,0x2D,0xFE,
-  0xB7,0x34,0x0A,0x3D,0x8C,0x70,0x83,0xA5,0x86,0x87,0xA8,0x01,0xCD,0x93,0x4A,0x62,
-  0x5D,0x4B,0x44,0x53,0x05,0xD5,0x6D,0x6E,0xD7,0x5C,0x99,0x80,0x85,0xA8,0xBB,0x9D,
-  0x01,0x97,0xFE,0x3C,0xAC,0x57,0x40,0x56,0x71,0x5C,0x00,0x01,0x01,0x6F,0x02,0xA0,
-  0x03,0x93,0x05,0xB6,0x00,0x06,0x00,0x35,0x40,0x22,0x06,0x00,0x00,0x01,0x0F,0x05,
-  0x4F,0x05,0x7F,0x05,0x03,0x05,0x05,0x00,0x02,0x50,0x02,0x60,0x02,0x70,0x02,0xB0,
-  0x02,0xD0,0x02,0x06,0x02,0x05,0x02,0xE6,0x03,0xDC,0x00,0xDD,0x00,0x3F,0x3F,0xE1,
-  0x32,0x01,0x2F,0x5D,0x32,0x2F,0x5D,0x33,0x39,0x2F,0x33,0x31,0x30,0x01,0x01,0x21,
-  0x35,0x21,0x15,0x01,0x01,0xC3,0x01,0x35,0xFE,0x77,0x02,0x24,0xFE,0xCB,0x02,0xA0,
-  0x02,0x9D,0x79,0x64,0xFD,0x4E,0x00,0x03,0x01,0x31,0x02,0x8F,0x03,0x60,0x05,0xC3,
-  0x00,0x13,0x00,0x1B,0x00,0x24,0x00,0x7D,0x40,0x53,0x0A,0x1C,0x0C,0x22,0xE0,0x02,
-  0x14,0x00,0x02,0x1A,0xE0,0x0C,0x16,0xE0,0x12,0x0C,0x12,0x0C,0x12,0x08,0x0F,0x02,
-  0x7F,0x02,0xBF,0x02,0x03,0x02,0x02,0x1E,0xE0,0x1F,0x08,0xEF,0x08,0x02,0x08,0x69,
-  0x14,0x01,0xB8,0x00,0xC8,0x00,0xD8,0x00,0x03,0x69,0x00,0x01,0xB8,0x0A,0xC8,0x0A,
-  0xD8,0x0A,0x03,0x69,0x0A,0x01,0x69,0x1C,0xB9,0x1C,0xC9,0x1C,0xD9,0x1C,0x04,0x1C,
-  0x0A,0x00,0x14,0x04,0x05,0x18,0xE5,0x0F,0xDE,0x20,0xE5,0x05,0xDF,0x00,0x3F,0xE1,
-  0x3F,0xE1,0x12,0x17,0x39,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x01,0x2F,0x5D,0xE1,0x33,
-  0x2F,0x5D,0x12,0x39,0x39,0x2F,0x2F,0x10,0xE1,0x10,0xE1,0x11,0x39,0x39,0x10,0xE1,
-  0x11,0x39,0x39,0x31,0x30,0x01,0x16,0x15,0x14,0x06,0x23,0x22,0x26,0x35,0x34,0x37,
-  0x26,0x35,0x34,0x36,0x33,0x32,0x16,0x15,0x14,0x07,0x36,0x35,0x34,0x23,0x22,0x15,
-  0x14,0x17,0x06,0x15,0x14,0x33,0x32,0x35,0x34,0x27,0x02,0xBA,0xA6,0x98,0x7C,0x88,
-  0x93,0x8B,0x72,0x90,0x70,0x6F,0x8D,0xFC,0x6A,0x6C,0x6B,0x5C,0x76,0x83,0x87,0x87,
-  0x04,0x42,0x55,0x7A,0x67,0x7D,0x76,0x68,0x82,0x4A,0x4F,0x72,0x5B,0x6E,0x6C,0x5D,
-  0x74,0x13,0x31,0x54,0x60,0x60,0x51,0xA1,0x3F,0x5A,0x75,0x75,0x59,0x3A,0x00,0x02,
-  0x01,0x39,0x02,0x39,0x03,0x93,0x05,0xC9,0x00,0x14,0x00,0x1F,0x00,0x39,0x40,0x1F,
-  0x05,0x1A,0xE0,0x01,0x0B,0x30,0x11,0x01,0x11,0x11,0x15,0xE0,0x0B,0x05,0x17,0xE4,
-  0x0F,0x08,0x01,0x08,0x08,0x0E,0x03,0xE4,0x01,0x13,0xDF,0x1D,0xE6,0x0E,0xDE,0x00,
-  0x3F,0xE1,0x3F,0x33,0xE1,0x11,0x39,0x2F,0x5D,0xE1,0x32,0x01,0x2F,0xE1,0x33,0x2F,
-  0x5D,0x12,0x39,0xE1,0x32,0x31,0x30,0x01,0x35,0x16,0x33,0x20,0x13,0x23,0x06,0x23,
-  0x22,0x26,0x35,0x34,0x36,0x33,0x32,0x16,0x15,0x10,0x21,0x22,0x13,0x14,0x33,0x32,
-  0x36,0x35,0x34,0x26,0x23,0x22,0x06,0x01,0x87,0x27,0x3E,0x01,0x10,0x0E,0x08,0x47,
-  0x7E,0x7A,0x8A,0xA0,0x83,0x8E,0xA9,0xFE,0x63,0x3E,0x0D,0x95,0x49,0x61,0x59,0x4D,
-  0x44,0x55,0x02,0x48,0x7D,0x17,0x01,0x3B,0x62,0x95,0x7E,0x85,0xAA,0xCD,0xBA,0xFD,
-  0xF7,0x02,0x63,0xA4,0x57,0x38,0x50,0x7B,0x5E,0x00,0x00,0x12,0x00,0x37,0xFE,0x81,
-  0x04,0x96,0x05,0xEE,0x00,0x13,0x00,0x25,0x00,0x39,0x00,0x45,0x00,0x4B,0x00,0x51,
-  0x00,0x57,0x00,0x5D,0x00,0x61,0x00,0x65,0x00,0x69,0x00,0x6D,0x00,0x71,0x00,0x75,
-  0x00,0x79,0x00,0x7D,0x00,0x86,0x00,0x8F,0x01,0x06,0x40,0x2E,0x62,0x7A,0x65,0x7D,
-  0x7A,0x7D,0x4C,0x5D,0x3F,0x13,0x13,0x45,0x09,0x87,0x7F,0x7F,0x25,0x8B,0x83,0x83,
-  0x18,0x0F,0x21,0x5F,0x21,0x6F,0x21,0x03,0x21,0x21,0x25,0x2A,0x37,0x4F,0x09,0x5F,
-  0x09,0x02,0x10,0x25,0x20,0x25,0x60,0x25,0x03,0x25,0xB8,0xFF,0xC0,0x40,0x64,0x15,
-  0x18,0x48,0x40,0x37,0x50,0x37,0xE0,0x37,0x03,0x09,0x25,0x37,0x37,0x25,0x09,0x03,
-  0x46,0x55,0x55,0x76,0x72,0x6E,0x5D,0x46,0x6B,0x67,0x5F,0x4C,0x74,0x68,0x70,0x60,
-  0x78,0x6C,0x68,0x60,0x6C,0x6C,0x60,0x68,0x03,0x4C,0x47,0x29,0x39,0x39,0x26,0x1B,
-  0x7E,0x7E,0x87,0x20,0x0F,0x13,0x48,0x87,0x87,0x14,0x7F,0x7F,0x60,0x25,0x01,0x25,
-  0x25,0x8F,0x14,0x14,0x0E,0xF0,0x26,0x01,0x6F,0x26,0x01,0x26,0x26,0x34,0x2D,0x3C,
-  0xFF,0x04,0x01,0x04,0x04,0x42,0x0E,0x2D,0x0E,0x2D,0x0E,0x58,0x53,0x58,0x7A,0x4C,
-  0x53,0x63,0x47,0x00,0x2F,0x33,0x33,0x2F,0x33,0x33,0x11,0x12,0x39,0x39,0x2F,0x2F,
-  0x11,0x33,0x33,0x2F,0x5D,0x33,0x11,0x33,0x33,0x2F,0x5D,0x5D,0x12,0x39,0x2F,0x33,
-  0x33,0x2F,0x5D,0x33,0x11,0x12,0x39,0x2F,0x2B,0x33,0x12,0x39,0x11,0x33,0x11,0x33,
-  0x11,0x12,0x17,0x39,0x2F,0x2F,0x2F,0x11,0x33,0x11,0x33,0x11,0x33,0x01,0x2F,0x32,
-  0x32,0x32,0x32,0x2F,0x33,0x33,0x33,0x33,0x11,0x12,0x17,0x39,0x2F,0x2F,0x2F,0x5D,
-  0x2B,0x5D,0x5D,0x11,0x33,0x11,0x33,0x2F,0x5D,0x33,0x33,0x11,0x33,0x11,0x33,0x11,
-  0x33,0x11,0x33,0x33,0x2F,0x33,0x11,0x12,0x39,0x39,0x11,0x33,0x11,0x33,0x31,0x30,
-  0x00,0x0E,0x02,0x23,0x22,0x2E,0x02,0x35,0x34,0x3E,0x02,0x33,0x32,0x1E,0x02,0x15,
-  0x03,0x33,0x32,0x16,0x15,0x14,0x06,0x07,0x15,0x1E,0x03,0x15,0x14,0x06,0x23,0x23,
-  0x17,0x21,0x15,0x23,0x15,0x14,0x06,0x23,0x22,0x26,0x27,0x35,0x16,0x16,0x33,0x32,
-  0x36,0x35,0x35,0x23,0x00,0x16,0x33,0x32,0x36,0x35,0x34,0x26,0x23,0x22,0x06,0x15,
-  0x25,0x11,0x21,0x15,0x23,0x15,0x03,0x11,0x33,0x15,0x33,0x15,0x01,0x35,0x21,0x11,
-  0x23,0x35,0x03,0x35,0x33,0x35,0x33,0x11,0x01,0x23,0x11,0x33,0x01,0x35,0x21,0x15,
-  0x01,0x23,0x11,0x33,0x11,0x23,0x11,0x33,0x01,0x23,0x11,0x33,0x11,0x23,0x11,0x33,
-  0x11,0x23,0x11,0x33,0x01,0x35,0x21,0x15,0x03,0x15,0x33,0x32,0x36,0x35,0x34,0x26,
-  0x23,0x27,0x33,0x32,0x36,0x35,0x34,0x26,0x23,0x23,0x02,0xA0,0x19,0x34,0x4E,0x36,
-  0x36,0x4F,0x33,0x19,0x19,0x33,0x4F,0x36,0x36,0x4E,0x34,0x19,0x89,0x89,0x58,0x58,
-  0x25,0x23,0x12,0x1F,0x17,0x0E,0x57,0x4B,0xA5,0xDF,0x01,0x0A,0x48,0x58,0x45,0x1F,
-  0x2B,0x0C,0x0C,0x27,0x18,0x1D,0x27,0x5E,0xFE,0x6C,0x35,0x38,0x39,0x33,0x33,0x39,
-  0x38,0x35,0xFE,0xD5,0x01,0x2F,0xC0,0x6F,0x6F,0xC0,0x02,0x00,0x01,0x30,0x6D,0xC3,
-  0xC3,0x6D,0xFC,0x10,0x6F,0x6F,0x01,0x39,0x01,0x0F,0xFD,0xB8,0x6F,0x6F,0x6F,0x6F,
-  0x03,0xF0,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0xFD,0x49,0x01,0x0F,0x75,0x3B,0x26,0x1E,
-  0x1E,0x2A,0x37,0x33,0x25,0x1D,0x21,0x25,0x2F,0x04,0x05,0x58,0x40,0x23,0x23,0x40,
-  0x58,0x36,0x37,0x59,0x3F,0x23,0x23,0x3F,0x59,0x37,0xFE,0xE0,0x35,0x42,0x28,0x36,
-  0x07,0x04,0x03,0x0E,0x19,0x26,0x1C,0x41,0x48,0x34,0x4D,0xF2,0x50,0x4C,0x05,0x03,
-  0x52,0x02,0x04,0x1D,0x29,0xF4,0x03,0x2C,0x53,0x53,0x4A,0x4B,0x53,0x53,0x4B,0x83,
-  0x01,0x30,0x6F,0xC1,0xF9,0xC3,0x01,0x2F,0xC2,0x6D,0x06,0xFE,0x6F,0xFE,0xD0,0xC1,
-  0xF9,0x02,0x6D,0xC2,0xFE,0xD1,0x03,0x2D,0x01,0x10,0x02,0xC1,0x6F,0x6F,0xFA,0xA8,
-  0x01,0x0E,0x02,0x02,0x01,0x0F,0xFD,0x68,0x01,0x10,0xFD,0x69,0x01,0x0E,0x02,0x02,
-  0x01,0x0F,0xFA,0x3B,0x6D,0x6D,0x03,0x91,0x7A,0x22,0x1F,0x19,0x20,0x50,0x1B,0x19,
-  0x1B,0x18,0x00,0x03,0x00,0x04,0xFE,0xC1,0x04,0xCB,0x06,0x14,0x00,0x03,0x00,0x29,
-  0x00,0x39,0x00,0x4E,0x40,0x26,0x04,0x29,0x29,0x2A,0x71,0x32,0x01,0x50,0x32,0x60,
-  0x32,0x02,0x32,0x32,0x2A,0x17,0x17,0x7F,0x2A,0x01,0x2A,0x2A,0x02,0x1E,0x0F,0x0F,
-  0x02,0x37,0x2D,0x29,0x29,0x2D,0x2D,0x03,0x1B,0x12,0x12,0x03,0x00,0x19,0x2F,0x33,
-  0x18,0x2F,0x33,0x11,0x33,0x2F,0x33,0x2F,0x11,0x33,0x01,0x19,0x2F,0x33,0x18,0x2F,
-  0x33,0x11,0x33,0x2F,0x5D,0x33,0x2F,0x11,0x33,0x2F,0x5D,0x5D,0x11,0x33,0x2F,0x33,
-  0x31,0x30,0x09,0x03,0x05,0x35,0x34,0x3E,0x02,0x37,0x3E,0x03,0x35,0x34,0x26,0x23,
-  0x22,0x0E,0x02,0x07,0x17,0x36,0x36,0x33,0x32,0x16,0x15,0x14,0x0E,0x02,0x07,0x0E,
-  0x03,0x15,0x15,0x07,0x14,0x16,0x33,0x32,0x3E,0x02,0x35,0x34,0x2E,0x02,0x23,0x22,
-  0x06,0x02,0x66,0x02,0x65,0xFD,0x9B,0xFD,0x9E,0x02,0x98,0x07,0x14,0x23,0x1C,0x23,
-  0x35,0x23,0x12,0x98,0x87,0x23,0x48,0x46,0x41,0x1C,0x42,0x37,0x66,0x2D,0x35,0x32,
-  0x0B,0x18,0x26,0x1C,0x1F,0x2B,0x1B,0x0D,0x15,0x41,0x32,0x15,0x29,0x20,0x13,0x13,
-  0x20,0x29,0x15,0x32,0x41,0x06,0x14,0xFC,0x56,0xFC,0x57,0x03,0xA9,0xE9,0x2B,0x17,
-  0x22,0x21,0x22,0x17,0x21,0x39,0x3E,0x47,0x2E,0x7C,0x88,0x0E,0x19,0x21,0x12,0xA0,
-  0x1F,0x29,0x35,0x2A,0x1A,0x28,0x24,0x25,0x18,0x1C,0x33,0x36,0x3B,0x24,0x37,0xF6,
-  0x41,0x3A,0x0E,0x1E,0x2F,0x20,0x22,0x2F,0x1D,0x0D,0x38,0x00,0xFF,0xFF,0x00,0x87,
-  0xFE,0x14,0x03,0xA9,0x06,0x21,0x02,0x26,0x02,0x37,0x00,0x00,0x01,0x06,0x01,0x4C,
-  0xF7,0x00,0x00,0x0B,0xB6,0x01,0x6F,0x18,0x10,0x00,0x0A,0x25,0x01,0x2B,0x35,0x00,
-  0xFF,0xFF,0x01,0xBE,0x03,0xC1,0x03,0x0C,0x05,0xB6,0x02,0x06,0x02,0x07,0x00,0x00,
-  0x00,0x02,0x00,0x0A,0xFF,0xEC,0x04,0xB2,0x06,0x2B,0x00,0x0C,0x00,0x4F,0x00,0x5D,
-  0x40,0x37,0x08,0x46,0x43,0x43,0x1A,0x00,0x3B,0x47,0x4D,0x90,0x10,0xA0,0x10,0x02,
-  0x10,0x10,0x51,0x0F,0x51,0xAF,0x51,0x02,0x33,0x46,0x90,0x1A,0x01,0x1A,0x3E,0x4F,
-  0x4F,0x4E,0x00,0x4E,0x22,0x4E,0x29,0x00,0x29,0x10,0x29,0x02,0x4E,0x29,0x4E,0x29,
-  0x38,0x05,0x4E,0x48,0x01,0x38,0x4E,0x15,0x16,0x00,0x3F,0xE1,0x3F,0xE1,0x12,0x39,
-  0x39,0x2F,0x2F,0x5D,0x10,0xE1,0x11,0x33,0x10,0xE1,0x32,0x01,0x2F,0x5D,0xE1,0x5D,
-  0x11,0x33,0x2F,0x5D,0x33,0xE1,0x32,0x11,0x39,0x2F,0xE1,0x31,0x30,0x01,0x2E,0x03,
-  0x23,0x22,0x06,0x15,0x14,0x1E,0x02,0x05,0x16,0x16,0x15,0x14,0x02,0x06,0x06,0x23,
-  0x22,0x2E,0x02,0x35,0x34,0x3E,0x02,0x35,0x34,0x26,0x23,0x22,0x06,0x07,0x27,0x36,
-  0x36,0x33,0x32,0x1E,0x02,0x15,0x14,0x0E,0x02,0x15,0x14,0x1E,0x02,0x33,0x32,0x12,
-  0x11,0x34,0x26,0x27,0x2E,0x03,0x35,0x34,0x3E,0x02,0x33,0x32,0x1E,0x02,0x17,0x33,
-  0x15,0x03,0x6A,0x0D,0x39,0x4D,0x5B,0x30,0x4C,0x56,0x2E,0x6A,0xAB,0x01,0x3C,0x02,
-  0x02,0x40,0x81,0xC4,0x83,0x6F,0x92,0x56,0x22,0x0A,0x0B,0x0A,0x1F,0x1F,0x18,0x36,
-  0x10,0x25,0x25,0x64,0x36,0x32,0x45,0x2C,0x13,0x0A,0x0B,0x0A,0x15,0x30,0x4E,0x3A,
-  0xA4,0xA4,0x02,0x02,0xAE,0xF2,0x96,0x43,0x27,0x51,0x7F,0x59,0x68,0xA1,0x75,0x4B,
-  0x12,0x8F,0x03,0xD1,0x6C,0xAA,0x74,0x3D,0x58,0x48,0x38,0x69,0x52,0x33,0x8A,0x16,
-  0x3A,0x1F,0x9F,0xFE,0xEE,0xC9,0x73,0x37,0x5F,0x7D,0x45,0x28,0x5D,0x59,0x4B,0x18,
-  0x2D,0x21,0x0F,0x0A,0x7F,0x11,0x1A,0x1C,0x32,0x44,0x28,0x23,0x56,0x5D,0x61,0x2D,
-  0x2A,0x4A,0x36,0x1F,0x01,0x32,0x01,0x30,0x17,0x3E,0x14,0x02,0x4B,0x78,0x9A,0x51,
-  0x43,0x70,0x52,0x2E,0x54,0x9C,0xDF,0x8B,0x89,0x00,0x00,0x01,0x00,0x1F,0x00,0x00,
-  0x04,0xB8,0x05,0xC3,0x00,0x20,0x00,0x8D,0xB9,0x00,0x20,0xFF,0xF8,0xB3,0x14,0x18,
-  0x48,0x20,0xB8,0xFF,0xF8,0x40,0x46,0x0D,0x10,0x48,0x26,0x20,0x36,0x20,0x02,0x17,
-  0x20,0x01,0x20,0xAF,0x1F,0xFF,0x1F,0x02,0x59,0x1F,0x01,0x1F,0x00,0x54,0x0D,0x01,
-  0x29,0x0D,0x01,0x0D,0x1B,0x5A,0xD0,0x1E,0x01,0xA2,0x1E,0x01,0x93,0x1E,0x01,0x03,
-  0x8E,0x1E,0x01,0x04,0x63,0x1E,0x01,0x05,0x10,0x1E,0x50,0x1E,0x02,0x1E,0x11,0x0A,
-  0x0A,0x3B,0x1B,0x01,0x3B,0x1E,0x01,0x27,0x00,0xB7,0x00,0x02,0x00,0xB8,0xFF,0xF8,
-  0x40,0x0C,0x0D,0x11,0x48,0x00,0x1E,0x1B,0x03,0x1D,0x1F,0x03,0x1D,0x12,0x00,0x3F,
-  0x3F,0x12,0x17,0x39,0x2B,0x5D,0x5D,0x5D,0x33,0x11,0x33,0x01,0x2F,0x5D,0x5F,0x5D,
-  0x5F,0x5D,0x5F,0x5D,0x5D,0x5D,0xE1,0x32,0x5D,0x5D,0x39,0xCD,0x5D,0x5D,0x32,0x5D,
-  0x5D,0x2B,0x2B,0x31,0x30,0x01,0x3E,0x03,0x37,0x3E,0x03,0x33,0x32,0x16,0x17,0x15,
-  0x26,0x26,0x23,0x22,0x06,0x07,0x0E,0x05,0x07,0x11,0x23,0x11,0x01,0x33,0x02,0x64,
-  0x19,0x4B,0x4E,0x49,0x18,0x16,0x2E,0x36,0x40,0x29,0x22,0x2B,0x11,0x0C,0x21,0x0C,
-  0x1C,0x3E,0x23,0x0C,0x2F,0x3A,0x42,0x3F,0x38,0x13,0xBB,0xFE,0x19,0xCA,0x02,0xDB,
-  0x4B,0xA8,0xA0,0x89,0x2C,0x28,0x3D,0x27,0x14,0x09,0x08,0x91,0x03,0x05,0x2F,0x3C,
-  0x15,0x53,0x6E,0x81,0x88,0x86,0x3C,0xFD,0xE3,0x02,0x2F,0x03,0x87,0x00,0x00,0x02,
-  0x00,0x12,0xFF,0xEC,0x04,0xB4,0x04,0x4A,0x00,0x20,0x00,0x40,0x00,0x5F,0x40,0x3C,
-  0x1E,0x1D,0x56,0x38,0x66,0x38,0x02,0x47,0x38,0x01,0x38,0x49,0x37,0x37,0x05,0x21,
-  0x49,0x10,0x15,0x20,0x15,0x02,0x15,0x15,0x42,0x2C,0x49,0x40,0x05,0x50,0x05,0x90,
-  0x05,0xA0,0x05,0xC0,0x05,0xD0,0x05,0x06,0x2F,0x05,0x01,0x05,0x37,0x37,0x31,0x27,
-  0x10,0x0A,0x50,0x0D,0x0F,0x3C,0x1E,0x31,0x50,0x1A,0x00,0x16,0x00,0x3F,0x32,0xE1,
-  0x32,0x32,0x3F,0xE1,0x32,0x32,0x12,0x39,0x2F,0x01,0x2F,0x5D,0x5D,0xE1,0x11,0x33,
-  0x2F,0x5D,0xE1,0x11,0x39,0x2F,0xE1,0x5D,0x5D,0x39,0x39,0x31,0x30,0x05,0x22,0x2E,
-  0x02,0x35,0x34,0x3E,0x02,0x37,0x23,0x35,0x37,0x21,0x15,0x23,0x1E,0x03,0x15,0x14,
-  0x0E,0x02,0x23,0x22,0x26,0x27,0x23,0x06,0x06,0x01,0x34,0x2E,0x02,0x27,0x21,0x0E,
-  0x03,0x15,0x14,0x1E,0x02,0x33,0x32,0x3E,0x02,0x35,0x35,0x33,0x15,0x14,0x16,0x33,
-  0x32,0x3E,0x02,0x01,0x7B,0x4F,0x6E,0x45,0x1F,0x0A,0x16,0x23,0x19,0xA4,0x86,0x04,
-  0x1C,0x9B,0x18,0x23,0x17,0x0A,0x1F,0x45,0x6E,0x4F,0x5E,0x6F,0x1A,0x0B,0x1A,0x6F,
-  0x01,0xF6,0x0A,0x17,0x23,0x18,0xFD,0xE9,0x19,0x23,0x16,0x0A,0x10,0x23,0x34,0x24,
-  0x24,0x36,0x23,0x11,0x9D,0x4F,0x3F,0x24,0x34,0x23,0x10,0x14,0x44,0x80,0xB5,0x72,
-  0x43,0x74,0x6E,0x72,0x42,0x4A,0x50,0x9A,0x42,0x72,0x6E,0x74,0x43,0x72,0xB5,0x80,
-  0x44,0x57,0x5B,0x5B,0x57,0x01,0xEB,0x3E,0x72,0x70,0x76,0x43,0x43,0x76,0x70,0x72,
-  0x3E,0x5B,0x81,0x52,0x26,0x29,0x48,0x62,0x39,0xCB,0xCB,0x82,0x8A,0x26,0x52,0x81,
-  0xFF,0xFF,0x00,0x71,0x00,0x00,0x04,0x5C,0x07,0x75,0x02,0x26,0x00,0x30,0x00,0x00,
-  0x01,0x07,0x00,0x76,0x00,0x64,0x01,0x54,0x00,0x13,0x40,0x0B,0x01,0x1A,0x05,0x26,
-  0x01,0x64,0x14,0x17,0x06,0x0C,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,
-  0x00,0x5C,0x00,0x00,0x04,0x73,0x06,0x21,0x02,0x26,0x00,0x50,0x00,0x00,0x01,0x06,
-  0x00,0x76,0x7F,0x00,0x00,0x13,0x40,0x0B,0x01,0x27,0x11,0x26,0x01,0x7E,0x21,0x24,
-  0x11,0x1F,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x21,0xFD,0xD5,
-  0x04,0xAC,0x05,0xBC,0x02,0x26,0x00,0x24,0x00,0x00,0x01,0x06,0x02,0x5B,0x02,0x00,
-  0x00,0x17,0x40,0x0D,0x03,0x02,0x1E,0x14,0x27,0x03,0x02,0x01,0x19,0x0F,0x04,0x07,
-  0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0x87,0xFD,0xD5,
-  0x04,0x02,0x04,0x5E,0x02,0x26,0x00,0x44,0x00,0x00,0x01,0x06,0x02,0x5B,0xFB,0x00,
-  0x00,0x17,0x40,0x0D,0x03,0x02,0x31,0x17,0x27,0x03,0x02,0x1C,0x2C,0x22,0x08,0x16,
-  0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,0xFF,0xFF,0xFE,0xC8,0xFF,0xEC,
-  0x05,0x0C,0x05,0xCD,0x00,0x27,0x00,0x32,0x00,0x91,0x00,0x00,0x01,0x07,0x02,0x5C,
-  0xFD,0x9B,0x00,0x00,0x00,0x2D,0x40,0x15,0x03,0x02,0x2B,0x03,0x03,0x02,0x60,0x33,
-  0x01,0x50,0x33,0x01,0x40,0x33,0x01,0x20,0x33,0x01,0x00,0x33,0x01,0xB8,0xFF,0x18,
-  0xB4,0x33,0x33,0x02,0x02,0x25,0x01,0x2B,0x5D,0x5D,0x5D,0x5D,0x5D,0x35,0x35,0x00,
-  0x3F,0x35,0x35,0x00,0x00,0x02,0x01,0x83,0xFD,0xD5,0x03,0x48,0xFF,0x83,0x00,0x13,
-  0x00,0x1F,0x00,0x4D,0x40,0x10,0x14,0x10,0x13,0x18,0x48,0x14,0x83,0x0F,0x00,0x1F,
-  0x00,0x2F,0x00,0x03,0x00,0x1A,0xB8,0xFF,0xF0,0xB6,0x13,0x18,0x48,0x1A,0x83,0x0A,
-  0x1D,0xB8,0xFF,0xF8,0x40,0x19,0x15,0x18,0x48,0x1D,0x8C,0x00,0x05,0x10,0x05,0x20,
-  0x05,0x70,0x05,0xC0,0x05,0x05,0x05,0x17,0x08,0x15,0x18,0x48,0x17,0x8C,0x0F,0x00,
-  0x2F,0xE1,0x2B,0xDC,0x5D,0xE1,0x2B,0x01,0x2F,0xE1,0x2B,0xDC,0x5D,0xE1,0x2B,0x31,
-  0x30,0x01,0x14,0x0E,0x02,0x23,0x22,0x2E,0x02,0x35,0x34,0x3E,0x02,0x33,0x32,0x1E,
-  0x02,0x07,0x34,0x26,0x23,0x22,0x06,0x15,0x14,0x16,0x33,0x32,0x36,0x03,0x48,0x23,
-  0x3E,0x54,0x31,0x32,0x52,0x3B,0x20,0x20,0x3B,0x52,0x32,0x30,0x54,0x3E,0x24,0x75,
-  0x3F,0x32,0x31,0x3F,0x39,0x37,0x32,0x3F,0xFE,0xAE,0x33,0x51,0x38,0x1D,0x1D,0x38,
-  0x4F,0x33,0x33,0x4F,0x38,0x1D,0x1D,0x37,0x4F,0x34,0x35,0x3C,0x3C,0x35,0x35,0x3C,
-  0x3C,0x00,0x00,0x02,0x01,0x2D,0x04,0x68,0x03,0x8B,0x05,0xC7,0x00,0x11,0x00,0x1F,
-  0x00,0x30,0x40,0x1A,0x40,0x00,0x01,0x00,0x40,0x0C,0x0C,0x12,0x20,0x09,0x0C,0x48,
-  0x12,0x80,0x18,0x17,0x1E,0x17,0x1E,0x4F,0x03,0x5F,0x03,0x02,0x03,0x0F,0x00,0x2F,
-  0xCC,0x5D,0x39,0x39,0x2F,0x2F,0x01,0x2F,0x1A,0xCD,0x2B,0x32,0x2F,0x1A,0xCD,0x5D,
-  0x31,0x30,0x01,0x34,0x36,0x37,0x15,0x06,0x06,0x15,0x14,0x1E,0x02,0x15,0x14,0x06,
-  0x23,0x22,0x26,0x05,0x3E,0x03,0x37,0x33,0x15,0x0E,0x03,0x07,0x23,0x01,0x2D,0x78,
-  0x7A,0x3C,0x39,0x1F,0x24,0x1F,0x32,0x2E,0x3B,0x44,0x01,0x35,0x0B,0x19,0x18,0x16,
-  0x08,0xCF,0x12,0x30,0x38,0x3E,0x1F,0x52,0x04,0xE7,0x4E,0x73,0x1F,0x4C,0x16,0x2E,
-  0x18,0x13,0x12,0x10,0x1A,0x1C,0x25,0x27,0x46,0x25,0x1E,0x4B,0x4F,0x51,0x24,0x14,
-  0x20,0x4D,0x50,0x51,0x25,0x00,0x00,0x02,0x00,0x42,0x00,0x00,0x04,0x29,0x06,0x1F,
-  0x00,0x27,0x00,0x34,0x00,0x63,0x40,0x37,0x16,0x29,0x1C,0x1C,0x27,0x27,0x02,0x29,
-  0x06,0x26,0x03,0x03,0x06,0x06,0x0A,0xDF,0x02,0x01,0x02,0x02,0x36,0x28,0x07,0x07,
-  0x0D,0x00,0x0A,0x10,0x0A,0x50,0x0A,0xA0,0x0A,0xB0,0x0A,0x05,0x0A,0x0A,0x07,0x03,
-  0x52,0x28,0x0D,0x26,0x0F,0x2F,0x20,0x4E,0x13,0x19,0x01,0x09,0x05,0x01,0x15,0x00,
-  0x3F,0x33,0x33,0x3F,0x33,0xE1,0x32,0x3F,0x33,0x33,0xE1,0x32,0x32,0x01,0x2F,0x5D,
-  0x33,0x33,0x11,0x33,0x11,0x33,0x2F,0x5D,0x12,0x39,0x2F,0x33,0x11,0x33,0x11,0x33,
-  0x11,0x33,0x11,0x33,0x11,0x12,0x39,0x31,0x30,0x21,0x23,0x11,0x23,0x11,0x23,0x11,
-  0x23,0x11,0x23,0x11,0x23,0x35,0x37,0x35,0x34,0x3E,0x02,0x33,0x32,0x16,0x17,0x36,
-  0x36,0x33,0x32,0x16,0x17,0x07,0x26,0x26,0x23,0x22,0x0E,0x02,0x15,0x15,0x21,0x21,
-  0x33,0x35,0x34,0x37,0x26,0x26,0x23,0x22,0x0E,0x02,0x15,0x04,0x29,0xA4,0xCB,0xA3,
-  0xCD,0xA4,0x64,0x64,0x28,0x4D,0x70,0x48,0x31,0x57,0x22,0x26,0x66,0x3F,0x34,0x5B,
-  0x25,0x29,0x1D,0x45,0x25,0x26,0x37,0x24,0x11,0x01,0x6F,0xFD,0x21,0xCD,0x18,0x14,
-  0x2D,0x17,0x23,0x35,0x23,0x12,0x03,0xCB,0xFC,0x35,0x03,0xCB,0xFC,0x35,0x03,0xCB,
-  0x41,0x3E,0x52,0x6A,0x8D,0x54,0x23,0x16,0x0D,0x1D,0x1B,0x17,0x0E,0x83,0x0B,0x11,
-  0x16,0x34,0x57,0x40,0x68,0x66,0x73,0x4E,0x06,0x08,0x16,0x34,0x57,0x40,0x00,0x02,
-  0x00,0x42,0x00,0x00,0x04,0x29,0x06,0x1F,0x00,0x27,0x00,0x34,0x00,0x61,0x40,0x36,
-  0x2C,0x14,0x29,0x1A,0x1A,0x1D,0x29,0x04,0x26,0x01,0x01,0x04,0x04,0x08,0xDF,0x1D,
-  0x01,0x1D,0x1D,0x36,0x28,0x05,0x05,0x0B,0x00,0x08,0x10,0x08,0x50,0x08,0xA0,0x08,
-  0xB0,0x08,0x05,0x08,0x08,0x05,0x01,0x52,0x28,0x0B,0x26,0x0F,0x07,0x03,0x1C,0x15,
-  0x2F,0x20,0x4E,0x11,0x17,0x01,0x00,0x3F,0x33,0xE1,0x32,0x3F,0x33,0x33,0x3F,0x33,
-  0x33,0xE1,0x32,0x32,0x01,0x2F,0x5D,0x33,0x33,0x11,0x33,0x11,0x33,0x2F,0x5D,0x12,
-  0x39,0x2F,0x33,0x11,0x33,0x11,0x33,0x11,0x33,0x11,0x12,0x39,0x39,0x31,0x30,0x01,
-  0x23,0x11,0x23,0x11,0x23,0x11,0x23,0x11,0x23,0x35,0x37,0x35,0x34,0x3E,0x02,0x33,
-  0x32,0x16,0x17,0x36,0x36,0x33,0x32,0x17,0x33,0x11,0x23,0x11,0x26,0x26,0x23,0x22,
-  0x0E,0x02,0x15,0x15,0x33,0x21,0x33,0x35,0x34,0x37,0x26,0x26,0x23,0x22,0x0E,0x02,
-  0x15,0x03,0x48,0x8E,0xA3,0xCD,0xA4,0x64,0x64,0x28,0x4D,0x70,0x48,0x31,0x57,0x22,
-  0x26,0x66,0x3F,0x30,0x2E,0x83,0xA4,0x0E,0x1D,0x0E,0x26,0x37,0x24,0x11,0x8E,0xFE,
-  0x02,0xCD,0x18,0x14,0x2D,0x17,0x23,0x35,0x23,0x12,0x03,0xCB,0xFC,0x35,0x03,0xCB,
-  0xFC,0x35,0x03,0xCB,0x41,0x3E,0x52,0x6A,0x8D,0x54,0x23,0x16,0x0D,0x1D,0x1B,0x0B,
-  0xF9,0xEC,0x05,0x8D,0x03,0x03,0x16,0x34,0x57,0x40,0x68,0x66,0x73,0x4E,0x06,0x08,
-  0x16,0x34,0x57,0x40,0x00,0x02,0x00,0x54,0xFF,0xEC,0x04,0xF6,0x06,0x14,0x00,0x20,
-  0x00,0x34,0x00,0x33,0x40,0x1C,0x17,0x5B,0x19,0x2B,0x5B,0x1E,0x12,0x00,0x36,0x21,
-  0x5B,0x1F,0x0A,0x2F,0x0A,0x02,0x0A,0x1E,0x30,0x5F,0x17,0x12,0x0F,0x04,0x26,0x5F,
-  0x05,0x13,0x00,0x3F,0xE1,0x3F,0x33,0xCE,0xE1,0x32,0x01,0x2F,0x5D,0xE1,0x10,0xDE,
-  0x32,0x32,0xE1,0xD6,0xE1,0x31,0x30,0x01,0x14,0x02,0x06,0x06,0x23,0x22,0x26,0x26,
-  0x02,0x35,0x34,0x12,0x36,0x36,0x33,0x32,0x16,0x17,0x3E,0x03,0x37,0x33,0x17,0x0E,
-  0x03,0x07,0x16,0x16,0x05,0x14,0x1E,0x02,0x33,0x32,0x3E,0x02,0x35,0x34,0x2E,0x02,
-  0x23,0x22,0x0E,0x02,0x04,0x7B,0x40,0x84,0xC8,0x87,0x8E,0xC9,0x81,0x3C,0x3C,0x81,
-  0xCB,0x8E,0x7C,0xBB,0x42,0x12,0x17,0x0D,0x06,0x02,0xC6,0x0F,0x0B,0x21,0x31,0x44,
-  0x2E,0x2A,0x2A,0xFC,0x9E,0x24,0x4F,0x80,0x5C,0x5D,0x80,0x4E,0x23,0x23,0x4E,0x7F,
-  0x5C,0x5D,0x80,0x50,0x24,0x02,0xDD,0xA9,0xFE,0xEA,0xC6,0x6C,0x6C,0xC6,0x01,0x17,
-  0xAA,0xAA,0x01,0x15,0xC4,0x6B,0x5A,0x56,0x13,0x34,0x3F,0x49,0x28,0x16,0x34,0x63,
-  0x57,0x4A,0x1C,0x5B,0xE9,0x89,0x89,0xDB,0x99,0x51,0x51,0x99,0xDB,0x89,0x8A,0xDA,
-  0x97,0x51,0x51,0x97,0xDA,0x00,0x00,0x02,0x00,0x73,0xFF,0xEC,0x04,0xF6,0x04,0xF2,
-  0x00,0x20,0x00,0x2B,0x00,0x35,0x40,0x1C,0x12,0x1E,0x1E,0x00,0x17,0x4A,0x19,0x26,
-  0x48,0x00,0x2D,0x21,0x48,0x00,0x0A,0x01,0x0A,0x1E,0x29,0x50,0x17,0x12,0x0F,0x10,
-  0x24,0x50,0x05,0x16,0x00,0x3F,0xE1,0x3F,0x33,0xC6,0xE1,0x32,0x01,0x2F,0x5D,0xE1,
-  0x10,0xDE,0xE1,0xDC,0xE1,0x11,0x33,0x11,0x33,0x30,0x31,0x01,0x14,0x0E,0x02,0x23,
-  0x22,0x2E,0x02,0x35,0x34,0x3E,0x02,0x33,0x32,0x16,0x17,0x3E,0x03,0x35,0x33,0x17,
-  0x0E,0x03,0x07,0x16,0x16,0x05,0x14,0x16,0x33,0x20,0x11,0x34,0x26,0x23,0x22,0x06,
-  0x04,0x58,0x4A,0x85,0xB8,0x6F,0x67,0xB4,0x86,0x4E,0x49,0x84,0xB9,0x6F,0x61,0xAB,
-  0x42,0x26,0x2B,0x15,0x05,0xC6,0x0F,0x0F,0x2A,0x39,0x4B,0x31,0x26,0x2A,0xFC,0xD7,
-  0x9D,0x9A,0x01,0x36,0x9D,0x9B,0x9A,0x9B,0x02,0x27,0x89,0xD5,0x91,0x4C,0x4C,0x91,
-  0xD5,0x89,0x88,0xD3,0x91,0x4B,0x42,0x41,0x10,0x38,0x48,0x57,0x30,0x17,0x45,0x72,
-  0x5B,0x43,0x15,0x42,0xA5,0x63,0xD3,0xD1,0x01,0xA4,0xD2,0xCE,0xCE,0x00,0x00,0x01,
-  0x00,0x7D,0xFF,0xEC,0x05,0x17,0x06,0x14,0x00,0x26,0x00,0x36,0x40,0x1E,0x06,0x5B,
-  0x60,0x08,0x70,0x08,0x02,0x08,0x25,0x5A,0x01,0x0E,0x28,0x1B,0x5A,0x00,0x18,0x01,
-  0x18,0x0D,0x01,0x01,0x26,0x06,0x19,0x03,0x20,0x5F,0x13,0x13,0x00,0x3F,0xE1,0x3F,
-  0xCE,0x33,0x33,0x2F,0x33,0x01,0x2F,0x5D,0xE1,0x10,0xDE,0x32,0xE1,0xDC,0x5D,0xE1,
-  0x31,0x30,0x01,0x15,0x3E,0x03,0x35,0x33,0x17,0x0E,0x03,0x07,0x11,0x14,0x0E,0x02,
-  0x23,0x22,0x2E,0x02,0x35,0x11,0x33,0x11,0x14,0x1E,0x02,0x33,0x32,0x3E,0x02,0x35,
-  0x11,0x03,0xB6,0x2F,0x37,0x1D,0x09,0xC6,0x0F,0x0F,0x30,0x52,0x79,0x57,0x2D,0x63,
-  0x9F,0x73,0x6C,0x9A,0x63,0x2E,0xBA,0x18,0x36,0x59,0x41,0x43,0x56,0x31,0x13,0x05,
-  0xB6,0xC2,0x08,0x34,0x4D,0x61,0x36,0x16,0x45,0x7F,0x69,0x4B,0x11,0xFD,0x66,0x72,
-  0xB7,0x81,0x45,0x41,0x7E,0xBA,0x7A,0x03,0xD7,0xFC,0x33,0x57,0x82,0x56,0x2B,0x30,
-  0x5A,0x81,0x52,0x03,0xCA,0x00,0x00,0x01,0x00,0xA0,0xFF,0xEC,0x05,0x17,0x04,0xF2,
-  0x00,0x27,0x00,0x57,0xB7,0x1F,0x4A,0x00,0x21,0x10,0x21,0x02,0x21,0xB8,0xFF,0xC0,
-  0xB3,0x14,0x17,0x48,0x21,0xB8,0xFF,0xC0,0x40,0x23,0x0E,0x11,0x48,0x21,0x01,0x00,
-  0x17,0x47,0x1A,0x26,0x29,0x0E,0x47,0x00,0x0D,0xB0,0x0D,0x02,0x0D,0x26,0x1A,0x1A,
-  0x0D,0x1F,0x1F,0x18,0x0D,0x0F,0x02,0x12,0x50,0x07,0x16,0x00,0x15,0x00,0x3F,0x3F,
-  0xE1,0x32,0x3F,0x33,0x33,0x2F,0x11,0x33,0x2F,0x33,0x01,0x2F,0x5D,0xE1,0x10,0xDE,
-  0x32,0xE1,0x32,0x32,0xDD,0x2B,0x2B,0x5D,0xE1,0x30,0x31,0x21,0x27,0x23,0x0E,0x03,
-  0x23,0x22,0x2E,0x02,0x35,0x11,0x33,0x11,0x14,0x16,0x33,0x32,0x3E,0x02,0x35,0x11,
-  0x33,0x15,0x3E,0x03,0x35,0x33,0x17,0x0E,0x03,0x07,0x11,0x03,0x12,0x1A,0x08,0x16,
-  0x3C,0x48,0x50,0x29,0x4F,0x77,0x4F,0x28,0xB6,0x54,0x5A,0x42,0x5A,0x38,0x18,0xB6,
-  0x34,0x3E,0x20,0x0A,0xC6,0x0F,0x0F,0x32,0x55,0x7F,0x5C,0x93,0x2B,0x3F,0x29,0x14,
-  0x2E,0x62,0x98,0x69,0x02,0xCD,0xFD,0x3D,0x82,0x82,0x34,0x65,0x94,0x60,0x02,0x3A,
-  0x7B,0x06,0x32,0x4E,0x65,0x38,0x17,0x46,0x88,0x6E,0x48,0x07,0xFC,0xB0,0xFF,0xFF,
-  0x01,0xA2,0x04,0xD9,0x03,0x2B,0x06,0x21,0x02,0x06,0x00,0x43,0x00,0x00,0xFF,0xFF,
-  0x01,0xA2,0x04,0xD9,0x03,0x2B,0x06,0x21,0x02,0x06,0x00,0x76,0x00,0x00,0xFF,0xFF,
-  0x00,0xFE,0x04,0xD9,0x03,0xCD,0x05,0xE3,0x02,0x06,0x01,0x52,0x00,0x00,0x00,0x01,
-  0x01,0xAC,0x04,0xB8,0x03,0x21,0x06,0x8F,0x00,0x1B,0x00,0x2E,0x40,0x17,0x07,0x05,
-  0x08,0x08,0x15,0x0D,0x84,0x00,0x00,0x15,0x05,0x08,0x08,0x06,0x12,0x8D,0x0F,0x19,
-  0x1F,0x19,0x02,0x19,0x06,0x00,0x2F,0xDC,0x5D,0xE1,0x12,0x39,0x2F,0x33,0x01,0x2F,
-  0x33,0x2F,0xE1,0x11,0x39,0x2F,0x33,0x33,0x30,0x31,0x01,0x14,0x0E,0x02,0x07,0x07,
-  0x23,0x27,0x3E,0x03,0x35,0x34,0x2E,0x02,0x23,0x22,0x06,0x07,0x35,0x36,0x36,0x33,
-  0x32,0x16,0x03,0x21,0x1B,0x2D,0x3C,0x22,0x0A,0x71,0x0E,0x25,0x3B,0x2A,0x17,0x14,
-  0x24,0x32,0x1D,0x1C,0x34,0x10,0x10,0x32,0x29,0x85,0x85,0x05,0xD3,0x27,0x3A,0x29,
-  0x1A,0x08,0x6F,0xB0,0x06,0x10,0x18,0x21,0x18,0x18,0x20,0x13,0x07,0x03,0x03,0x6C,
-  0x03,0x05,0x5B,0x00,0x00,0x01,0x01,0xFC,0xFE,0x98,0x02,0xD1,0xFF,0x7D,0x00,0x0D,
-  0x00,0x0F,0xB5,0x06,0x87,0x00,0x0B,0x91,0x03,0x00,0x2F,0xED,0x01,0x2F,0xED,0x30,
-  0x31,0x05,0x34,0x36,0x33,0x32,0x16,0x15,0x14,0x0E,0x02,0x23,0x22,0x26,0x01,0xFC,
-  0x3D,0x2D,0x2C,0x3F,0x11,0x1D,0x27,0x16,0x2D,0x3D,0xF6,0x3C,0x37,0x37,0x3C,0x1D,
-  0x2B,0x1C,0x0E,0x37,0xFF,0xFF,0x00,0xD9,0x00,0x00,0x04,0x23,0x07,0x73,0x02,0x26,
-  0x00,0x28,0x00,0x00,0x01,0x07,0x00,0x43,0xFF,0xB7,0x01,0x52,0x00,0x15,0xB4,0x01,
-  0x0C,0x05,0x26,0x01,0xB8,0xFF,0xA0,0xB4,0x0F,0x0C,0x01,0x00,0x25,0x01,0x2B,0x35,
-  0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x89,0x00,0x00,0x04,0x46,0x07,0x73,0x02,0x26,
-  0x01,0xB2,0x00,0x00,0x01,0x07,0x00,0x43,0xFF,0xB5,0x01,0x52,0x00,0x15,0xB4,0x01,
-  0x11,0x05,0x26,0x01,0xB8,0xFF,0xB4,0xB4,0x14,0x11,0x00,0x08,0x25,0x01,0x2B,0x35,
-  0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x85,0xFF,0xEC,0x04,0x48,0x06,0x21,0x02,0x26,
-  0x00,0x48,0x00,0x00,0x01,0x06,0x00,0x43,0xD4,0x00,0x00,0x15,0xB4,0x02,0x17,0x11,
-  0x26,0x02,0xB8,0xFF,0xD4,0xB4,0x1A,0x17,0x0B,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,
-  0x35,0x00,0xFF,0xFF,0x00,0xA0,0x00,0x00,0x04,0x2D,0x06,0x21,0x02,0x26,0x01,0xD2,
-  0x00,0x00,0x01,0x06,0x00,0x43,0xB3,0x00,0x00,0x15,0xB4,0x01,0x0C,0x11,0x26,0x01,
-  0xB8,0xFF,0xB3,0xB4,0x0F,0x0C,0x0A,0x04,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,
-  0x00,0x01,0x00,0x52,0xFF,0xEC,0x04,0x7B,0x05,0xC9,0x00,0x3C,0x00,0x75,0x40,0x1F,
-  0x0C,0x0F,0x0D,0xBF,0x0D,0x02,0x0D,0x40,0x0C,0x11,0x48,0x0D,0x0D,0x13,0x1D,0x00,
-  0xFB,0x3A,0x3A,0x27,0x07,0xFB,0x13,0x3E,0x2E,0x00,0x2D,0xB0,0x2D,0x02,0x2D,0xB8,
-  0xFF,0xC0,0x40,0x22,0x0C,0x11,0x48,0x2D,0x2D,0x33,0xFB,0x2F,0x27,0x01,0x27,0x3B,
-  0x3B,0x38,0x2A,0x0C,0x2E,0x2E,0x0A,0x30,0x5F,0x10,0x2A,0x04,0x00,0x3A,0x3A,0x1D,
-  0x02,0x38,0x5F,0x18,0x22,0x13,0x00,0x3F,0x33,0xE1,0x32,0x32,0x32,0x11,0x33,0x3F,
-  0x33,0xF1,0x32,0xC2,0x2F,0x32,0x11,0x12,0x39,0x2F,0x01,0x2F,0x5D,0xE1,0x32,0x2F,
-  0x2B,0x5D,0x33,0x10,0xDE,0xE1,0x11,0x39,0x2F,0xE1,0x39,0x11,0x33,0x2F,0x2B,0x5D,
-  0x33,0x31,0x30,0x25,0x16,0x33,0x32,0x3E,0x02,0x35,0x10,0x02,0x23,0x22,0x07,0x27,
-  0x36,0x36,0x33,0x32,0x12,0x11,0x14,0x02,0x06,0x06,0x23,0x22,0x2E,0x02,0x27,0x0E,
-  0x03,0x23,0x22,0x26,0x26,0x02,0x35,0x10,0x12,0x33,0x32,0x16,0x17,0x07,0x26,0x23,
-  0x22,0x02,0x11,0x14,0x1E,0x02,0x33,0x32,0x37,0x11,0x33,0x02,0xBC,0x27,0x38,0x30,
-  0x43,0x2A,0x13,0x4E,0x42,0x37,0x29,0x2F,0x22,0x58,0x30,0x92,0x93,0x22,0x4E,0x80,
-  0x5E,0x21,0x36,0x2E,0x2B,0x17,0x16,0x2A,0x2E,0x35,0x21,0x5E,0x80,0x4F,0x23,0x93,
-  0x92,0x30,0x58,0x22,0x2F,0x29,0x38,0x42,0x4D,0x13,0x2B,0x44,0x30,0x39,0x25,0xAA,
-  0xBA,0x2B,0x59,0xA4,0xE5,0x8D,0x01,0x13,0x01,0x14,0x1D,0x98,0x17,0x12,0xFE,0x99,
-  0xFE,0x9A,0xC0,0xFE,0xDB,0xC6,0x65,0x0D,0x18,0x25,0x18,0x18,0x25,0x18,0x0D,0x65,
-  0xC6,0x01,0x25,0xC0,0x01,0x66,0x01,0x67,0x12,0x17,0x98,0x1D,0xFE,0xEC,0xFE,0xED,
-  0x8D,0xE5,0xA4,0x59,0x2B,0x01,0xDC,0x00,0x00,0x01,0xFF,0xFC,0x00,0x00,0x04,0x89,
-  0x04,0x4A,0x00,0x2A,0x00,0x7A,0x40,0x2E,0x07,0x0D,0x01,0x0D,0x26,0x0E,0x21,0x15,
-  0xFD,0x22,0x01,0xBB,0x22,0x01,0x22,0x22,0x1B,0x0F,0x49,0x5F,0x0E,0x01,0x0E,0x0E,
-  0x01,0x1B,0x49,0x0C,0x1C,0x01,0x1C,0x2C,0x2A,0x06,0x00,0x00,0x01,0xA6,0x00,0xB6,
-  0x00,0x02,0x94,0x00,0x01,0x00,0xB8,0xFF,0xC0,0x40,0x17,0x0B,0x0F,0x48,0x00,0x00,
-  0x02,0x49,0x01,0x26,0x0D,0x0D,0x00,0x1B,0x0E,0x01,0x0F,0x15,0x22,0x22,0x07,0x4F,
-  0x00,0x15,0x00,0x3F,0xE1,0x33,0x11,0x33,0x3F,0x33,0x33,0x12,0x39,0x11,0x33,0x01,
-  0x2F,0xE1,0x33,0x2F,0x2B,0x5D,0x5D,0x71,0x33,0x33,0x10,0xDE,0x5D,0xE1,0x11,0x39,
-  0x2F,0x5D,0xE1,0x11,0x33,0x2F,0x5D,0x5D,0x33,0x33,0x12,0x39,0x39,0x5D,0x31,0x30,
-  0x21,0x01,0x33,0x13,0x16,0x16,0x17,0x33,0x3E,0x03,0x37,0x13,0x03,0x33,0x13,0x1E,
-  0x03,0x17,0x33,0x3E,0x02,0x12,0x35,0x33,0x14,0x02,0x02,0x06,0x07,0x23,0x03,0x26,
-  0x26,0x27,0x06,0x06,0x07,0x03,0x01,0x1B,0xFE,0xE1,0xA0,0xA3,0x14,0x22,0x08,0x04,
-  0x05,0x0F,0x12,0x14,0x0A,0x56,0x6D,0x96,0x89,0x08,0x16,0x17,0x16,0x07,0x06,0x3F,
-  0x4F,0x2D,0x10,0x99,0x1A,0x42,0x71,0x58,0xA3,0x54,0x07,0x0B,0x03,0x05,0x10,0x08,
-  0x6A,0x04,0x4A,0xFD,0x5C,0x55,0x9D,0x33,0x12,0x38,0x41,0x43,0x1E,0x01,0x10,0x01,
-  0xCD,0xFD,0xB0,0x21,0x60,0x67,0x60,0x21,0x68,0xD2,0xE6,0x01,0x02,0x97,0xA3,0xFE,
-  0xE0,0xFE,0xF5,0xFD,0x7F,0x01,0x54,0x1A,0x38,0x14,0x14,0x3E,0x16,0xFE,0xAE,0x00,
-  0x00,0x02,0x00,0x14,0x00,0x00,0x04,0x75,0x06,0x14,0x00,0x16,0x00,0x21,0x00,0x41,
-  0x40,0x21,0x13,0x00,0x17,0x5A,0x10,0x0C,0x0C,0x0E,0x1B,0x5B,0x15,0x06,0x23,0x0E,
-  0x21,0x5F,0x00,0x16,0x0E,0x5F,0x0F,0x13,0x0F,0x00,0x0F,0x00,0x0F,0x11,0x00,0x17,
-  0x60,0x0C,0x12,0x00,0x3F,0xE1,0x3F,0x39,0x39,0x2F,0x2F,0x11,0x33,0x10,0xE1,0x32,
-  0x10,0xE1,0x01,0x2F,0x10,0xDE,0xCC,0xE1,0x11,0x39,0x2F,0x33,0xE1,0x32,0x32,0x30,
-  0x31,0x01,0x33,0x32,0x1E,0x02,0x15,0x14,0x0E,0x02,0x23,0x21,0x11,0x21,0x35,0x21,
-  0x11,0x33,0x11,0x21,0x15,0x21,0x11,0x33,0x32,0x36,0x35,0x34,0x2E,0x02,0x23,0x23,
-  0x01,0xFA,0x5E,0x98,0xCF,0x7F,0x37,0x3C,0x7E,0xC2,0x86,0xFE,0xCC,0xFE,0xD5,0x01,
-  0x2B,0xBB,0x01,0x89,0xFE,0x77,0x68,0xAF,0xA3,0x2E,0x5B,0x8A,0x5D,0x4A,0x03,0x4E,
-  0x42,0x71,0x98,0x57,0x61,0x9E,0x70,0x3D,0x04,0x60,0xA4,0x01,0x10,0xFE,0xF0,0xA4,
-  0xFC,0x40,0x84,0x88,0x46,0x61,0x3C,0x1B,0x00,0x02,0x00,0x14,0x00,0x00,0x04,0x58,
-  0x05,0x27,0x00,0x14,0x00,0x21,0x00,0x43,0x40,0x22,0x00,0x00,0x1C,0x13,0x02,0x16,
-  0x47,0x10,0x0C,0x0C,0x0E,0x1C,0x46,0x06,0x23,0x0E,0x01,0x0D,0x50,0x10,0x15,0x50,
-  0x02,0x02,0x13,0x10,0x11,0x11,0x10,0x0F,0x16,0x50,0x0C,0x15,0x00,0x3F,0xE1,0x3F,
-  0x33,0x2F,0x11,0x33,0x39,0x2F,0xE1,0x10,0xE1,0x32,0x01,0x2F,0x10,0xDE,0xE1,0x11,
-  0x39,0x2F,0x33,0xE1,0x32,0x32,0x11,0x39,0x2F,0x30,0x31,0x01,0x21,0x11,0x21,0x32,
-  0x16,0x15,0x14,0x0E,0x02,0x23,0x21,0x11,0x23,0x35,0x33,0x35,0x33,0x15,0x21,0x01,
-  0x11,0x33,0x32,0x3E,0x02,0x35,0x34,0x2E,0x02,0x23,0x02,0xE3,0xFE,0xD5,0x01,0x00,
-  0xD4,0xCC,0x2F,0x65,0x9F,0x71,0xFE,0x4E,0xEE,0xEE,0xB6,0x01,0x2B,0xFE,0xD5,0xF0,
-  0x37,0x5D,0x44,0x26,0x21,0x41,0x60,0x40,0x03,0xB0,0xFE,0xD7,0x9C,0x9B,0x4D,0x7C,
-  0x58,0x2F,0x03,0xB0,0x9A,0xDD,0xDD,0xFD,0xA4,0xFE,0xA8,0x11,0x29,0x42,0x30,0x31,
-  0x42,0x28,0x11,0x00,0x00,0x01,0x00,0x62,0xFF,0xEC,0x04,0xB6,0x05,0xCB,0x00,0x2D,
-  0x00,0x56,0x40,0x30,0x05,0x08,0x22,0x1B,0x40,0x09,0x0C,0x48,0x0F,0x07,0x01,0x1B,
-  0x07,0x11,0x11,0x07,0x1B,0x03,0x1E,0x2A,0x2F,0x21,0x1D,0xFB,0x1E,0x08,0x1C,0x5F,
-  0x05,0x21,0x21,0x0D,0x2B,0x00,0x5F,0x2A,0x27,0x04,0x1F,0x03,0x1E,0x12,0x10,0x0D,
-  0x5F,0x11,0x16,0x13,0x00,0x3F,0x33,0xE1,0x32,0x3F,0x3F,0x3F,0x33,0xE1,0x32,0x12,
-  0x39,0x2F,0x33,0xE1,0x32,0x01,0x2F,0xE1,0x32,0x10,0xCE,0x11,0x17,0x39,0x2F,0x2F,
-  0x2F,0x5D,0x2B,0x33,0xC9,0x32,0x30,0x31,0x01,0x22,0x0E,0x02,0x07,0x21,0x15,0x21,
-  0x1E,0x03,0x33,0x32,0x36,0x37,0x15,0x0E,0x03,0x23,0x22,0x26,0x26,0x02,0x27,0x23,
-  0x11,0x23,0x11,0x33,0x11,0x33,0x3E,0x03,0x33,0x32,0x16,0x17,0x07,0x26,0x26,0x03,
-  0x91,0x44,0x72,0x55,0x37,0x09,0x01,0xD3,0xFE,0x29,0x03,0x2D,0x55,0x7D,0x52,0x42,
-  0x74,0x39,0x1E,0x3B,0x40,0x49,0x2C,0x78,0xB2,0x78,0x3E,0x04,0x8B,0xA6,0xA6,0x90,
-  0x0B,0x4C,0x80,0xB2,0x70,0x54,0x95,0x3C,0x49,0x2D,0x6A,0x05,0x27,0x40,0x7A,0xB0,
-  0x6F,0xA2,0x82,0xC9,0x8A,0x48,0x23,0x17,0xA2,0x0F,0x17,0x0E,0x07,0x64,0xB8,0x01,
-  0x03,0x9F,0xFD,0x56,0x05,0xB6,0xFD,0x98,0x8F,0xEB,0xA7,0x5C,0x2C,0x2A,0x9C,0x20,
-  0x2E,0x00,0x00,0x01,0x00,0xA0,0xFF,0xEC,0x04,0x7B,0x04,0x5E,0x00,0x2D,0x00,0x55,
-  0x40,0x2F,0x1F,0x22,0x49,0x0C,0x0F,0x05,0x1F,0x05,0x02,0x05,0x21,0x05,0x21,0x08,
-  0x2B,0x16,0x2F,0x0B,0x07,0x49,0x00,0x08,0x01,0x08,0x17,0x1C,0x51,0x11,0x22,0x06,
-  0x50,0x1F,0x0B,0x0B,0x16,0x11,0x10,0x09,0x0F,0x08,0x15,0x2A,0x27,0x51,0x2B,0x00,
-  0x16,0x00,0x3F,0x32,0xE1,0x32,0x3F,0x3F,0x3F,0x33,0x39,0x2F,0x33,0xED,0x32,0x10,
-  0xE1,0x32,0x01,0x2F,0x5D,0xE1,0x32,0x10,0xCE,0x32,0x11,0x39,0x39,0x2F,0x2F,0x5D,
-  0x33,0xE1,0x32,0x30,0x31,0x05,0x22,0x2E,0x02,0x27,0x23,0x11,0x23,0x11,0x33,0x11,
-  0x33,0x3E,0x03,0x33,0x32,0x1E,0x02,0x17,0x07,0x2E,0x03,0x23,0x22,0x06,0x07,0x21,
-  0x15,0x21,0x1E,0x03,0x33,0x32,0x36,0x37,0x15,0x06,0x06,0x03,0x7F,0x55,0x95,0x72,
-  0x46,0x06,0x95,0xA2,0xA2,0x97,0x0B,0x4B,0x72,0x93,0x53,0x22,0x44,0x40,0x39,0x15,
-  0x2F,0x15,0x32,0x34,0x33,0x17,0x7B,0x81,0x0C,0x01,0xA2,0xFE,0x5C,0x04,0x24,0x40,
-  0x5D,0x3D,0x48,0x73,0x30,0x2F,0x6E,0x14,0x3A,0x7B,0xC1,0x87,0xFE,0x17,0x04,0x4A,
-  0xFE,0x39,0x80,0xB5,0x72,0x34,0x09,0x10,0x16,0x0C,0x9A,0x0A,0x13,0x0F,0x09,0x97,
-  0xA6,0x9A,0x5C,0x84,0x54,0x28,0x25,0x19,0xA2,0x1D,0x1E,0x00,0x00,0x02,0x00,0x00,
-  0x00,0x00,0x04,0xCD,0x05,0xB6,0x00,0x0B,0x00,0x14,0x00,0xA9,0x40,0x20,0x10,0x0F,
-  0x0E,0x0D,0x08,0x07,0x11,0x07,0x0E,0x0F,0x10,0x03,0x11,0x07,0x08,0x07,0x18,0x07,
-  0x02,0x07,0x06,0x07,0x05,0x01,0xC7,0x05,0xD7,0x05,0xE7,0x05,0x03,0x05,0xB8,0xFF,
-  0xF8,0x40,0x40,0x0A,0x10,0x48,0x05,0x11,0x12,0x13,0x14,0x01,0x02,0x11,0x02,0x14,
-  0x13,0x12,0x03,0x02,0x08,0x04,0x01,0xC8,0x04,0xD8,0x04,0xE8,0x04,0x03,0x04,0x08,
-  0x0A,0x10,0x48,0x04,0x11,0x11,0x15,0x06,0x0A,0xFB,0x15,0x0B,0x01,0x0B,0x0B,0x03,
-  0x06,0x02,0x03,0x09,0x08,0x01,0x60,0x0D,0x0C,0x0C,0x02,0x11,0x5F,0x04,0x03,0x0B,
-  0x07,0x02,0x12,0x00,0x3F,0x33,0x33,0x3F,0xE1,0x12,0x39,0x2F,0x33,0xE1,0x32,0x32,
-  0x01,0x2F,0x33,0x2F,0x12,0x39,0x2F,0x5D,0xE1,0x11,0x12,0x39,0x11,0x33,0x2B,0x5D,
-  0x71,0x12,0x00,0x17,0x39,0x10,0x7D,0x87,0x05,0xC4,0xC4,0xC4,0xC4,0x11,0x01,0x33,
-  0x2B,0x5D,0x71,0x11,0x33,0x5D,0x11,0x12,0x00,0x17,0x39,0x10,0x87,0x05,0xC4,0xC4,
-  0xC4,0xC4,0xC4,0x31,0x30,0x01,0x23,0x03,0x23,0x01,0x33,0x01,0x23,0x03,0x23,0x11,
-  0x23,0x03,0x21,0x27,0x26,0x26,0x27,0x06,0x06,0x07,0x02,0x10,0x70,0xEE,0xB2,0x02,
-  0x08,0xBB,0x02,0x0A,0xB6,0xEE,0x73,0xA6,0x37,0x01,0x1D,0x27,0x25,0x33,0x13,0x12,
-  0x3C,0x1C,0x02,0xAA,0xFD,0x56,0x05,0xB6,0xFA,0x4A,0x02,0xAA,0xFD,0x56,0x03,0x44,
-  0x6E,0x69,0xAA,0x4B,0x4B,0xB7,0x5C,0x00,0x00,0x02,0x00,0x3D,0x00,0x00,0x04,0x8D,
-  0x04,0x4A,0x00,0x0B,0x00,0x17,0x00,0xD2,0x40,0x6C,0x12,0x13,0x14,0x15,0x16,0x08,
-  0x09,0x11,0x15,0x14,0x13,0x12,0x04,0x11,0x47,0x09,0x01,0x09,0x47,0x0A,0x05,0x49,
-  0x06,0xA8,0x0B,0xB8,0x0B,0x02,0x8A,0x0B,0x9A,0x0B,0x02,0x0B,0x08,0x0C,0x10,0x48,
-  0x0B,0x17,0x0C,0x0D,0x0E,0x0F,0x11,0x02,0x11,0x0F,0x0E,0x0D,0x0C,0x04,0x02,0xC6,
-  0x00,0x01,0xB3,0x00,0x01,0xA5,0x00,0x01,0x86,0x00,0x96,0x00,0x02,0x75,0x00,0x01,
-  0x46,0x00,0x56,0x00,0x66,0x00,0x03,0x37,0x00,0x01,0x00,0x11,0x11,0x86,0x06,0x96,
-  0x06,0x02,0x15,0x06,0x25,0x06,0x02,0x06,0x06,0x01,0x0A,0x48,0x02,0x01,0x02,0x01,
-  0x04,0x03,0x08,0x50,0x17,0x16,0xB8,0xFF,0xC0,0x40,0x14,0x09,0x0C,0x48,0x16,0x16,
-  0x01,0x0B,0x10,0x11,0x52,0x0B,0x0F,0x09,0x15,0x02,0x15,0x0A,0x06,0x01,0x15,0x00,
-  0x3F,0x33,0x33,0x3F,0x3F,0x3F,0xF1,0xC4,0x11,0x12,0x39,0x2F,0x2B,0x33,0xE1,0x32,
-  0x32,0x01,0x2F,0xC1,0x5D,0x2F,0x12,0x39,0x2F,0x5D,0x5D,0x39,0x11,0x33,0x5D,0x5D,
-  0x5D,0x5D,0x5D,0x5D,0x5D,0x12,0x00,0x17,0x39,0x10,0x7D,0x87,0x05,0xC4,0xC4,0xC4,
-  0xC4,0xC4,0x01,0x33,0x2B,0x5D,0x5D,0x10,0xE1,0x10,0xF1,0x5D,0x11,0x00,0x17,0x39,
-  0x87,0x05,0xC4,0xC4,0xC4,0xC4,0xC4,0xC4,0x31,0x30,0x01,0x01,0x23,0x03,0x23,0x11,
-  0x23,0x11,0x23,0x03,0x23,0x01,0x12,0x2E,0x02,0x27,0x23,0x0E,0x03,0x07,0x33,0x02,
-  0xD9,0x01,0xB4,0xBC,0xB8,0x63,0xA2,0x68,0xB8,0xB7,0x01,0xB5,0xE1,0x23,0x23,0x1D,
-  0x08,0x0C,0x08,0x1E,0x22,0x22,0x0D,0xFC,0x04,0x4A,0xFB,0xB6,0x01,0xE9,0xFE,0x17,
-  0x01,0xE9,0xFE,0x17,0x04,0x4A,0xFE,0x5C,0x5A,0x5D,0x56,0x1E,0x1D,0x57,0x5D,0x5B,
-  0x22,0x00,0x00,0x02,0x00,0x62,0x00,0x00,0x04,0xFC,0x05,0xB6,0x00,0x13,0x00,0x1C,
-  0x01,0x04,0x40,0x8A,0xC6,0x0D,0x01,0xB7,0x0D,0x01,0xA6,0x0D,0x01,0x77,0x0D,0x01,
-  0x0D,0x19,0x88,0x15,0x01,0x59,0x15,0x69,0x15,0x02,0x18,0x17,0x16,0x15,0x10,0x0F,
-  0x19,0x0F,0x16,0x17,0x18,0x03,0x19,0x0F,0x56,0x14,0x66,0x14,0x86,0x14,0x03,0x1A,
-  0x1B,0x1C,0x14,0x01,0x02,0x19,0x02,0x1C,0x1B,0x1A,0x03,0x02,0xD8,0x0C,0x01,0xC9,
-  0x0C,0x01,0x78,0x0C,0xA8,0x0C,0xB8,0x0C,0x03,0x0C,0x19,0x19,0x0E,0x03,0x06,0x12,
-  0x01,0x12,0xFB,0x13,0x01,0xCC,0x13,0x01,0xB5,0x13,0x01,0xA6,0x13,0x01,0x5A,0x13,
-  0x6A,0x13,0x8A,0x13,0x03,0x05,0x13,0x01,0x13,0x13,0x07,0x0F,0x00,0x0E,0x01,0x0E,
-  0x17,0x02,0x01,0x02,0x32,0x03,0x01,0x29,0x03,0x01,0x18,0x03,0x01,0x03,0x03,0x0A,
-  0x06,0xFB,0x07,0x11,0x10,0x01,0x60,0x14,0x15,0x14,0x50,0x14,0x01,0x14,0xB8,0xFF,
-  0xC0,0x40,0x14,0x09,0x0C,0x48,0x14,0x04,0x05,0x60,0x0B,0x0A,0x0A,0x02,0x19,0x0C,
-  0x08,0x03,0x13,0x0F,0x07,0x02,0x12,0x00,0x3F,0x33,0x33,0x33,0x3F,0x33,0xC0,0x12,
-  0x39,0x2F,0x33,0xE1,0x32,0x33,0x2B,0x5D,0x11,0x33,0x10,0xED,0x32,0x32,0x01,0x2F,
-  0xE1,0x32,0x32,0x2F,0x5D,0x5D,0x5D,0xC1,0x5D,0x2F,0x5D,0xC1,0x12,0x39,0x2F,0x5D,
-  0x5D,0x5D,0x5D,0x5D,0x5D,0xC1,0x5D,0x11,0x12,0x39,0x11,0x33,0x5D,0x5D,0x5D,0x12,
-  0x00,0x17,0x39,0x10,0x7D,0x87,0x05,0xC4,0xC4,0xC4,0xC4,0xC4,0x01,0x5D,0x11,0x12,
-  0x00,0x17,0x39,0x10,0x87,0x05,0xC4,0xC4,0xC4,0xC4,0xC4,0x01,0x5D,0x5D,0x11,0x33,
-  0x5D,0x5D,0x5D,0x5D,0x30,0x31,0x01,0x23,0x03,0x23,0x13,0x21,0x11,0x23,0x11,0x33,
-  0x11,0x21,0x13,0x33,0x01,0x23,0x03,0x23,0x11,0x23,0x03,0x33,0x27,0x26,0x26,0x27,
-  0x06,0x06,0x07,0x02,0xD7,0x2F,0xA8,0xA8,0xB0,0xFF,0x00,0xA6,0xA6,0x01,0x27,0xA2,
-  0xAE,0x01,0x7D,0xA8,0xAC,0x2D,0xA4,0x08,0xB6,0x12,0x16,0x28,0x0C,0x0C,0x26,0x14,
-  0x02,0xAA,0xFD,0x56,0x02,0xAA,0xFD,0x56,0x05,0xB6,0xFD,0x94,0x02,0x6C,0xFA,0x4A,
-  0x02,0xAA,0xFD,0x56,0x03,0x4A,0x54,0x61,0x99,0x4B,0x4B,0x99,0x5B,0x00,0x00,0x02,
-  0x00,0x7B,0x00,0x00,0x05,0x0A,0x04,0x4A,0x00,0x13,0x00,0x1F,0x00,0xC8,0x40,0x7A,
-  0x11,0x0D,0x49,0x0E,0x66,0x05,0x01,0x54,0x05,0x01,0x05,0x49,0x04,0x06,0x14,0x06,
-  0x34,0x06,0x44,0x06,0x04,0xF4,0x06,0x01,0xCB,0x06,0x01,0xBC,0x06,0x01,0xA5,0x06,
-  0x01,0x6A,0x06,0x01,0x59,0x06,0x01,0x45,0x06,0x01,0x33,0x06,0x01,0x1B,0x06,0x01,
-  0x06,0x06,0x01,0x00,0x0E,0x10,0x0E,0x02,0x0E,0x12,0x0B,0x0A,0x13,0x0A,0x13,0x08,
-  0x18,0x1E,0x09,0x03,0x19,0x1E,0x02,0x00,0x64,0x1E,0x01,0x1E,0x1E,0x02,0x09,0xC0,
-  0x0A,0x01,0x0F,0x0A,0x01,0x00,0x0A,0x01,0x0A,0x02,0x00,0x01,0x50,0x01,0x02,0x01,
-  0x1E,0x04,0x03,0x08,0x50,0x18,0x19,0x18,0x18,0x0B,0x0C,0x50,0x12,0x11,0x11,0x01,
-  0x13,0x0F,0x0F,0x09,0x02,0x0E,0x0A,0x06,0x01,0x15,0x00,0x3F,0x33,0x33,0x33,0x2F,
-  0x2F,0x3F,0x33,0x12,0x39,0x2F,0x33,0xE1,0x32,0x33,0x11,0x33,0x10,0xE1,0x32,0x32,
-  0x2F,0x01,0x2F,0x5D,0xC1,0x2F,0x5D,0x71,0x71,0xC1,0x11,0x39,0x19,0x2F,0x5D,0x33,
-  0x87,0xC0,0xC0,0x87,0xC0,0xC0,0x01,0x33,0x10,0x7D,0x87,0xC4,0xC4,0x01,0x18,0x2F,
-  0x5D,0x12,0x39,0x2F,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x71,0xE1,0x5D,
-  0x5D,0x10,0xE1,0x32,0x31,0x30,0x01,0x01,0x23,0x03,0x23,0x11,0x23,0x11,0x23,0x03,
-  0x23,0x13,0x23,0x11,0x23,0x11,0x33,0x11,0x21,0x13,0x16,0x0E,0x02,0x07,0x33,0x2E,
-  0x03,0x27,0x23,0x03,0x9E,0x01,0x6C,0xA8,0x9B,0x3A,0xA1,0x3A,0x9E,0xA5,0xA3,0xF5,
-  0xA2,0xA2,0x01,0x27,0x97,0x5C,0x15,0x1A,0x1B,0x0C,0xB7,0x0C,0x1C,0x1A,0x15,0x04,
-  0x02,0x04,0x4A,0xFB,0xB6,0x01,0xE9,0xFE,0x17,0x01,0xE9,0xFE,0x17,0x01,0xE9,0xFE,
-  0x17,0x04,0x4A,0xFE,0x39,0x01,0xC7,0x90,0x56,0x60,0x5E,0x23,0x23,0x5E,0x60,0x56,
-  0x19,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x04,0xCD,0x05,0xB6,0x00,0x23,0x00,0x26,
-  0x00,0x53,0x40,0x2C,0x24,0x0B,0x1A,0xFB,0x06,0x4A,0x1B,0x5A,0x1B,0x02,0x16,0x1B,
-  0x01,0x1B,0x1B,0x28,0x00,0x25,0x0A,0x0A,0x12,0x28,0x26,0x07,0x07,0x23,0x27,0x00,
-  0x19,0x1D,0x61,0x24,0x0B,0x06,0x06,0x00,0x26,0x5F,0x08,0x03,0x1B,0x12,0x00,0x12,
-  0x00,0x3F,0x32,0x32,0x3F,0xE1,0x12,0x39,0x2F,0x33,0x33,0xE1,0x32,0x01,0x2F,0x11,
-  0x33,0x33,0x2F,0x33,0x11,0x33,0x33,0x2F,0x33,0x11,0x12,0x39,0x2F,0x5D,0x5D,0x33,
-  0xE1,0x32,0x39,0x30,0x31,0x31,0x13,0x3E,0x03,0x37,0x01,0x35,0x21,0x15,0x01,0x1E,
-  0x03,0x17,0x13,0x23,0x03,0x2E,0x03,0x23,0x23,0x11,0x23,0x11,0x23,0x22,0x0E,0x02,
-  0x07,0x03,0x01,0x01,0x21,0x71,0x15,0x31,0x4C,0x72,0x56,0xFE,0xB2,0x03,0xD5,0xFE,
-  0xB2,0x59,0x71,0x4A,0x2F,0x15,0x71,0xAA,0x71,0x12,0x22,0x31,0x46,0x36,0x17,0xA8,
-  0x16,0x36,0x46,0x31,0x22,0x12,0x71,0x01,0xC0,0x01,0x25,0xFD,0xB5,0x01,0xC5,0x55,
-  0x88,0x62,0x3A,0x06,0x01,0xE7,0x8B,0x8B,0xFE,0x19,0x06,0x38,0x62,0x89,0x56,0xFE,
-  0x3B,0x01,0xC1,0x48,0x5F,0x39,0x17,0xFD,0x48,0x02,0xB8,0x17,0x39,0x5F,0x48,0xFE,
-  0x3F,0x03,0x60,0x01,0xB2,0x00,0x00,0x02,0x00,0x0A,0x00,0x00,0x04,0xC3,0x04,0x4A,
-  0x00,0x23,0x00,0x26,0x00,0x75,0x40,0x44,0x24,0x66,0x0B,0x01,0x0B,0x1A,0x49,0x06,
-  0xB7,0x1B,0x01,0xA5,0x1B,0x01,0x94,0x1B,0x01,0x8B,0x1B,0x01,0x7A,0x1B,0x01,0x59,
-  0x1B,0x01,0x4B,0x1B,0x01,0x1B,0x1B,0x27,0x11,0x26,0x00,0x07,0x01,0x07,0x07,0x23,
-  0x27,0x25,0x0F,0x0A,0x01,0x0A,0x0A,0x11,0x0A,0x07,0x07,0x08,0x19,0x1C,0x52,0x24,
-  0x0B,0x06,0x06,0x00,0x26,0x50,0x08,0x0F,0x1B,0x12,0x00,0x15,0x00,0x3F,0x32,0x32,
-  0x3F,0xE1,0x12,0x39,0x2F,0x33,0x33,0xE1,0x32,0x11,0x33,0x11,0x33,0x01,0x2F,0x33,
-  0x2F,0x5D,0x33,0x11,0x33,0x33,0x2F,0x5D,0x33,0x11,0x12,0x39,0x2F,0x5D,0x5D,0x5D,
-  0x5D,0x5D,0x5D,0x5D,0x33,0xE1,0x32,0x5D,0x39,0x30,0x31,0x33,0x13,0x3E,0x03,0x37,
-  0x01,0x35,0x21,0x15,0x01,0x1E,0x03,0x17,0x13,0x23,0x03,0x2E,0x03,0x23,0x23,0x11,
-  0x23,0x11,0x23,0x22,0x0E,0x02,0x07,0x03,0x01,0x13,0x21,0x0A,0x77,0x15,0x2A,0x42,
-  0x64,0x50,0xFE,0xD7,0x03,0xB5,0xFE,0xD2,0x50,0x64,0x42,0x2C,0x16,0x77,0xB5,0x76,
-  0x14,0x24,0x2F,0x42,0x33,0x04,0xA4,0x04,0x33,0x42,0x30,0x24,0x14,0x77,0x01,0xA8,
-  0xF6,0xFE,0x19,0x01,0x54,0x3D,0x65,0x4D,0x31,0x09,0x01,0x64,0x69,0x69,0xFE,0x9C,
-  0x08,0x31,0x4C,0x66,0x3E,0xFE,0xAC,0x01,0x50,0x36,0x48,0x2B,0x11,0xFD,0xF6,0x02,
-  0x0A,0x11,0x2B,0x48,0x36,0xFE,0xB0,0x02,0x83,0x01,0x2D,0x00,0x00,0x02,0x00,0x5C,
-  0x00,0x00,0x04,0xE9,0x05,0xB6,0x00,0x28,0x00,0x2B,0x00,0x73,0x40,0x40,0x29,0x10,
-  0x1F,0xFB,0x0B,0x05,0x20,0x01,0x20,0x20,0x00,0x17,0xFB,0x16,0x2A,0x5B,0x0F,0x0F,
-  0x00,0x16,0x01,0x16,0x2B,0x5A,0x0C,0x0C,0x28,0xFB,0x04,0x2F,0x00,0x01,0x00,0x00,
-  0x06,0xFB,0x20,0x07,0x30,0x07,0x02,0x07,0x0F,0x0C,0x0C,0x0D,0x0D,0x08,0x22,0x1E,
-  0x05,0x60,0x29,0x0A,0x0A,0x00,0x2B,0x08,0x03,0x20,0x17,0x07,0x00,0x12,0x00,0x3F,
-  0x32,0x32,0x32,0x3F,0xC0,0x12,0x39,0x2F,0xC4,0xED,0x32,0x32,0x11,0x33,0x11,0x33,
-  0x11,0x33,0x01,0x2F,0x5D,0xE1,0x32,0x2F,0x5D,0x33,0xE1,0x33,0x2F,0xE1,0x2F,0x5D,
-  0x33,0x2F,0xE1,0x10,0xE1,0x11,0x39,0x2F,0x5D,0x33,0xE1,0x32,0x39,0x31,0x30,0x21,
-  0x13,0x36,0x36,0x37,0x23,0x11,0x23,0x11,0x33,0x11,0x21,0x03,0x35,0x21,0x15,0x01,
-  0x1E,0x03,0x17,0x13,0x23,0x03,0x2E,0x03,0x23,0x23,0x11,0x23,0x11,0x23,0x22,0x0E,
-  0x02,0x07,0x03,0x01,0x13,0x21,0x01,0x60,0x38,0x09,0x13,0x17,0xC9,0xA6,0xA6,0x01,
-  0x7F,0xF6,0x03,0x3A,0xFE,0xFE,0x41,0x53,0x34,0x1D,0x0A,0x37,0xAA,0x37,0x09,0x10,
-  0x1C,0x2E,0x26,0x08,0xA4,0x08,0x27,0x2D,0x1C,0x10,0x09,0x38,0x01,0x1B,0xDF,0xFE,
-  0x42,0x01,0xC5,0x51,0x6C,0x28,0xFD,0x56,0x05,0xB6,0xFD,0x94,0x01,0xE1,0x8B,0x8B,
-  0xFE,0x19,0x06,0x38,0x61,0x89,0x57,0xFE,0x3B,0x01,0xC1,0x49,0x5F,0x38,0x17,0xFD,
-  0x48,0x02,0xB8,0x17,0x38,0x5F,0x49,0xFE,0x3F,0x03,0x5A,0x01,0xB8,0x00,0x00,0x02,
-  0x00,0x7B,0x00,0x00,0x05,0x0A,0x04,0x4A,0x00,0x28,0x00,0x2B,0x00,0x95,0x40,0x5B,
-  0x29,0x10,0x1F,0x49,0x1A,0x0B,0x01,0x09,0x0B,0x01,0x0B,0x05,0x20,0x01,0xF5,0x20,
-  0x01,0xC4,0x20,0x01,0xB6,0x20,0x01,0x75,0x20,0x01,0x68,0x20,0x01,0x06,0x20,0x01,
-  0x20,0x20,0x16,0x00,0x2A,0x48,0x0F,0x0F,0x17,0x49,0x00,0x16,0x01,0x16,0x2B,0x48,
-  0x60,0x0C,0x01,0x0C,0x0C,0x28,0x49,0x2A,0x04,0x01,0x04,0xAF,0x00,0x01,0x00,0x00,
-  0x0A,0x06,0x49,0x00,0x07,0x10,0x07,0x02,0x07,0x1E,0x22,0x22,0x05,0x50,0x29,0x0A,
-  0x0A,0x00,0x2B,0x0D,0x08,0x0F,0x20,0x17,0x07,0x00,0x15,0x00,0x3F,0x32,0x32,0x32,
-  0x3F,0x33,0xC0,0x12,0x39,0x2F,0x33,0xF1,0xC0,0x2F,0x32,0x01,0x2F,0x5D,0xE1,0x32,
-  0x32,0x2F,0x5D,0x33,0x5D,0xE1,0x33,0x2F,0x5D,0xE1,0x2F,0x5D,0xE1,0x33,0x2F,0xE1,
-  0x11,0x12,0x39,0x2F,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x71,0x33,0x5D,0x5D,0xE1,0x32,
-  0x39,0x31,0x30,0x21,0x13,0x36,0x36,0x37,0x23,0x11,0x23,0x11,0x33,0x11,0x21,0x03,
-  0x35,0x21,0x15,0x03,0x1E,0x03,0x17,0x13,0x23,0x03,0x2E,0x03,0x23,0x23,0x11,0x23,
-  0x11,0x23,0x22,0x0E,0x02,0x07,0x03,0x01,0x13,0x21,0x01,0x73,0x49,0x0B,0x1A,0x11,
-  0xD5,0xA2,0xA2,0x01,0x81,0xE6,0x03,0x0B,0xEE,0x3D,0x4E,0x33,0x20,0x0E,0x49,0xA4,
-  0x49,0x0C,0x13,0x1C,0x29,0x21,0x09,0xA1,0x09,0x21,0x29,0x1B,0x14,0x0C,0x4C,0x01,
-  0x29,0xC1,0xFE,0x7D,0x01,0x54,0x32,0x43,0x20,0xFE,0x17,0x04,0x4A,0xFE,0x39,0x01,
-  0x5E,0x69,0x69,0xFE,0x9E,0x08,0x31,0x4D,0x67,0x3E,0xFE,0xAC,0x01,0x50,0x35,0x47,
-  0x2C,0x12,0xFD,0xF6,0x02,0x0A,0x12,0x2C,0x47,0x35,0xFE,0xB0,0x02,0x83,0x01,0x2D,
-  0x00,0x01,0x00,0x75,0xFE,0x46,0x04,0x27,0x06,0xD5,0x00,0x76,0x00,0x83,0x40,0x44,
-  0x62,0x47,0x51,0x51,0x4D,0x59,0x59,0x6C,0x39,0x5B,0x67,0x67,0x2C,0x5B,0x72,0x12,
-  0x12,0x72,0x78,0x4E,0x00,0x4D,0x01,0x4D,0x4D,0x43,0x44,0x44,0x22,0x32,0x32,0x05,
-  0x5A,0x22,0x5A,0x5D,0x40,0x56,0x56,0x4E,0x80,0x43,0x3E,0x61,0x62,0x6C,0x32,0x61,
-  0x33,0x33,0x51,0x47,0x44,0x62,0x04,0x27,0x60,0x00,0x12,0x0F,0x0A,0x5F,0x18,0x13,
-  0x1D,0x1D,0x00,0x13,0x00,0x3F,0x32,0x2F,0x33,0x33,0xE1,0x32,0x32,0x10,0xE1,0x3F,
-  0x33,0x33,0x33,0x39,0x2F,0xE1,0x39,0x10,0xE1,0x32,0x1A,0xCC,0x32,0x2F,0x1A,0xCD,
-  0x32,0x01,0x2F,0xE1,0x33,0x2F,0x11,0x33,0x2F,0x33,0x33,0x2F,0x5D,0x33,0x10,0xCE,
-  0x32,0x2F,0x10,0xE1,0x33,0x2F,0xE1,0x32,0x33,0x2F,0x12,0x39,0x11,0x33,0x33,0x30,
-  0x31,0x05,0x22,0x0E,0x02,0x15,0x14,0x1E,0x02,0x33,0x32,0x3E,0x02,0x33,0x32,0x16,
-  0x17,0x15,0x2E,0x03,0x23,0x22,0x0E,0x02,0x23,0x22,0x2E,0x02,0x35,0x34,0x3E,0x02,
-  0x33,0x32,0x3E,0x02,0x35,0x34,0x2E,0x02,0x23,0x23,0x35,0x33,0x32,0x3E,0x02,0x35,
-  0x34,0x2E,0x02,0x23,0x22,0x0E,0x02,0x07,0x27,0x36,0x36,0x37,0x2E,0x03,0x27,0x35,
-  0x33,0x16,0x16,0x17,0x3E,0x03,0x33,0x32,0x16,0x17,0x15,0x26,0x26,0x23,0x22,0x0E,
-  0x02,0x07,0x1E,0x03,0x15,0x14,0x0E,0x02,0x07,0x15,0x1E,0x03,0x15,0x14,0x0E,0x02,
-  0x02,0x1D,0x47,0x5B,0x34,0x14,0x0E,0x24,0x3D,0x2F,0x41,0x61,0x54,0x51,0x32,0x56,
-  0x5E,0x19,0x08,0x20,0x35,0x4E,0x35,0x31,0x47,0x4A,0x5C,0x46,0x68,0x87,0x50,0x1F,
-  0x31,0x66,0x9D,0x6B,0x59,0x80,0x51,0x26,0x38,0x68,0x90,0x59,0xBE,0xB0,0x5C,0x8E,
-  0x61,0x32,0x26,0x44,0x5F,0x39,0x37,0x61,0x56,0x4F,0x26,0x5C,0x3B,0xA7,0x66,0x18,
-  0x37,0x36,0x32,0x14,0x79,0x33,0x62,0x36,0x1A,0x3A,0x43,0x4B,0x2A,0x1F,0x2F,0x0E,
-  0x0B,0x21,0x11,0x16,0x31,0x30,0x2E,0x14,0x53,0x7D,0x55,0x2B,0x33,0x5B,0x7D,0x4B,
-  0x58,0x89,0x5F,0x31,0x42,0x84,0xC3,0x14,0x12,0x20,0x29,0x18,0x16,0x24,0x1A,0x0E,
-  0x04,0x04,0x04,0x18,0x0F,0xB6,0x07,0x12,0x10,0x0C,0x03,0x03,0x02,0x29,0x48,0x60,
-  0x37,0x3C,0x62,0x46,0x26,0x26,0x48,0x6A,0x43,0x47,0x65,0x3F,0x1D,0x97,0x27,0x48,
-  0x65,0x3D,0x36,0x53,0x3A,0x1E,0x12,0x1F,0x2D,0x1B,0x7D,0x30,0x4B,0x11,0x1E,0x42,
-  0x3F,0x39,0x17,0x1B,0x22,0x61,0x38,0x24,0x46,0x38,0x23,0x09,0x05,0x77,0x05,0x07,
-  0x17,0x29,0x38,0x21,0x0D,0x3F,0x5C,0x76,0x45,0x49,0x78,0x58,0x39,0x0C,0x06,0x0B,
-  0x39,0x59,0x77,0x48,0x60,0xA0,0x74,0x40,0x00,0x01,0x00,0x8F,0xFE,0x73,0x04,0x08,
-  0x05,0x52,0x00,0x6E,0x00,0xA6,0x40,0x60,0x14,0x4B,0x46,0x1A,0x88,0x60,0x01,0x69,
-  0x60,0x79,0x60,0x02,0x3A,0x60,0x01,0x29,0x60,0x01,0x60,0xC5,0x0A,0x01,0x67,0x0A,
-  0x77,0x0A,0x02,0x45,0x0A,0x55,0x0A,0x02,0x27,0x0A,0x01,0x0A,0x6A,0x6A,0x5D,0x56,
-  0x46,0x0F,0x04,0x04,0x0F,0x0F,0x31,0x31,0x1A,0x70,0x40,0x67,0x66,0x66,0x5C,0x5D,
-  0x5D,0x41,0x4F,0x4F,0x24,0x49,0x41,0x07,0x52,0x00,0x00,0x67,0x80,0x5C,0x59,0x4E,
-  0x60,0x15,0x4F,0x50,0x50,0x50,0x6A,0x5D,0x0A,0x60,0x10,0x46,0x4E,0x1F,0x31,0x2E,
-  0x29,0x50,0x37,0x32,0x3C,0x3C,0x1F,0x16,0x00,0x3F,0x33,0x2F,0x33,0x33,0xE1,0x32,
-  0x32,0x10,0xE1,0x3F,0x33,0x33,0x33,0x39,0x2F,0xE1,0x39,0x10,0xE1,0x32,0x1A,0xCD,
-  0x32,0x2F,0xE1,0x01,0x2F,0xE1,0x33,0x2F,0x11,0x33,0x2F,0x33,0x33,0x2F,0x33,0x1A,
-  0x10,0xCE,0x32,0x2F,0x32,0x2F,0x33,0x2F,0x10,0xE1,0x12,0x39,0x11,0x33,0x5D,0x5D,
-  0x5D,0x5D,0x33,0x5D,0x5D,0x5D,0x5D,0x10,0xE1,0x32,0x30,0x31,0x01,0x32,0x16,0x17,
-  0x15,0x26,0x26,0x23,0x22,0x06,0x07,0x1E,0x03,0x15,0x14,0x0E,0x02,0x07,0x15,0x1E,
-  0x03,0x15,0x14,0x0E,0x02,0x23,0x22,0x0E,0x02,0x15,0x14,0x1E,0x02,0x33,0x32,0x3E,
-  0x02,0x33,0x32,0x16,0x17,0x15,0x2E,0x03,0x23,0x22,0x0E,0x02,0x23,0x22,0x2E,0x02,
-  0x35,0x34,0x3E,0x02,0x33,0x32,0x3E,0x02,0x35,0x34,0x26,0x23,0x23,0x35,0x33,0x32,
-  0x3E,0x02,0x35,0x34,0x26,0x23,0x22,0x06,0x07,0x27,0x36,0x36,0x37,0x2E,0x03,0x27,
-  0x35,0x33,0x16,0x16,0x17,0x3E,0x03,0x03,0x7D,0x16,0x1F,0x11,0x0E,0x16,0x0E,0x2E,
-  0x5C,0x2A,0x3B,0x62,0x45,0x26,0x1C,0x32,0x47,0x2B,0x2F,0x53,0x3D,0x24,0x37,0x79,
-  0xBF,0x87,0x4A,0x59,0x2F,0x0F,0x0F,0x25,0x40,0x30,0x36,0x6D,0x66,0x5A,0x24,0x48,
-  0x4E,0x0E,0x0A,0x24,0x2B,0x2E,0x15,0x22,0x5C,0x6C,0x77,0x3C,0x5F,0x7A,0x45,0x1A,
-  0x23,0x55,0x91,0x6E,0x51,0x7D,0x55,0x2D,0x9A,0x9F,0x94,0x79,0x3B,0x6F,0x56,0x35,
-  0x81,0x79,0x4F,0x93,0x53,0x3F,0x3E,0x76,0x46,0x15,0x2F,0x30,0x2D,0x14,0x79,0x36,
-  0x65,0x38,0x1C,0x3D,0x47,0x53,0x05,0x52,0x04,0x06,0x75,0x03,0x03,0x4B,0x3E,0x0C,
-  0x2E,0x44,0x5C,0x3B,0x32,0x4E,0x3B,0x29,0x0D,0x0B,0x0D,0x2B,0x42,0x5C,0x3E,0x43,
-  0x75,0x56,0x31,0x0E,0x1A,0x26,0x17,0x16,0x23,0x18,0x0D,0x03,0x04,0x03,0x16,0x13,
-  0x97,0x0A,0x0F,0x0A,0x06,0x03,0x03,0x03,0x2B,0x45,0x57,0x2D,0x33,0x5A,0x43,0x28,
-  0x13,0x2B,0x45,0x33,0x5E,0x5B,0x99,0x0B,0x23,0x42,0x36,0x4D,0x4D,0x26,0x22,0x93,
-  0x1C,0x22,0x08,0x1C,0x39,0x38,0x33,0x15,0x1B,0x23,0x60,0x38,0x22,0x46,0x39,0x24,
-  0xFF,0xFF,0x00,0x39,0x00,0x00,0x04,0x96,0x05,0xB6,0x02,0x06,0x01,0x75,0x00,0x00,
-  0xFF,0xFF,0x00,0x50,0xFE,0x14,0x04,0x83,0x06,0x12,0x02,0x06,0x01,0x95,0x00,0x00,
-  0x00,0x03,0x00,0x54,0xFF,0xEC,0x04,0x7B,0x05,0xCD,0x00,0x13,0x00,0x1E,0x00,0x29,
-  0x00,0x2B,0x40,0x16,0x19,0x25,0x5B,0x00,0x2B,0x24,0x1A,0x5B,0x0A,0x1A,0x60,0x24,
-  0x24,0x14,0x1F,0x5F,0x0F,0x04,0x14,0x5F,0x05,0x13,0x00,0x3F,0xE1,0x3F,0xE1,0x12,
-  0x39,0x2F,0xE1,0x01,0x2F,0xE1,0x32,0x10,0xDE,0xE1,0x32,0x30,0x31,0x01,0x14,0x02,
-  0x06,0x06,0x23,0x22,0x26,0x26,0x02,0x35,0x34,0x12,0x36,0x36,0x33,0x32,0x16,0x16,
-  0x12,0x01,0x32,0x3E,0x02,0x37,0x21,0x1E,0x03,0x13,0x22,0x0E,0x02,0x07,0x21,0x2E,
-  0x03,0x04,0x7B,0x40,0x84,0xC8,0x87,0x8E,0xC9,0x81,0x3C,0x3C,0x81,0xCB,0x8E,0x87,
-  0xC7,0x83,0x40,0xFD,0xED,0x57,0x7B,0x4F,0x27,0x04,0xFD,0x67,0x04,0x28,0x50,0x7B,
-  0x58,0x55,0x7A,0x51,0x2A,0x05,0x02,0x99,0x05,0x2A,0x4F,0x78,0x02,0xDD,0xA9,0xFE,
-  0xEA,0xC6,0x6C,0x6C,0xC6,0x01,0x17,0xAA,0xAA,0x01,0x15,0xC4,0x6B,0x6B,0xC5,0xFE,
-  0xEB,0xFD,0x07,0x47,0x86,0xC2,0x7A,0x7A,0xC2,0x86,0x47,0x04,0x9A,0x43,0x80,0xB8,
-  0x75,0x75,0xB8,0x80,0x43,0x00,0x00,0x03,0x00,0x73,0xFF,0xEC,0x04,0x58,0x04,0x5E,
-  0x00,0x13,0x00,0x19,0x00,0x1E,0x00,0x2B,0x40,0x16,0x1D,0x16,0x48,0x00,0x20,0x1C,
-  0x17,0x48,0x0A,0x17,0x50,0x1C,0x1C,0x14,0x1A,0x50,0x0F,0x10,0x14,0x50,0x05,0x16,
-  0x00,0x3F,0xE1,0x3F,0xE1,0x12,0x39,0x2F,0xE1,0x01,0x2F,0xE1,0x32,0x10,0xDE,0xE1,
-  0x32,0x30,0x31,0x01,0x14,0x0E,0x02,0x23,0x22,0x2E,0x02,0x35,0x34,0x3E,0x02,0x33,
-  0x32,0x1E,0x02,0x01,0x20,0x13,0x21,0x16,0x16,0x13,0x20,0x03,0x21,0x02,0x04,0x58,
-  0x4A,0x85,0xB8,0x6F,0x67,0xB4,0x86,0x4E,0x49,0x84,0xB9,0x6F,0x67,0xB5,0x86,0x4E,
-  0xFE,0x0E,0x01,0x1A,0x1A,0xFD,0x97,0x0B,0x9C,0x8C,0xFE,0xEF,0x20,0x02,0x65,0x23,
-  0x02,0x27,0x89,0xD5,0x91,0x4C,0x4C,0x91,0xD5,0x89,0x88,0xD3,0x91,0x4B,0x4B,0x91,
-  0xD3,0xFD,0xD4,0x01,0x64,0xB3,0xB1,0x03,0x44,0xFE,0xBA,0x01,0x46,0x00,0x00,0x01,
-  0x00,0x3F,0x00,0x00,0x05,0x21,0x05,0xC3,0x00,0x1C,0x00,0x4F,0x40,0x2F,0x1A,0x1A,
-  0x05,0x19,0x06,0x37,0x06,0x01,0x26,0x06,0x01,0x06,0x18,0x07,0x38,0x07,0x02,0x07,
-  0x0D,0x11,0x0D,0x08,0x00,0x19,0x30,0x19,0x50,0x19,0x60,0x19,0x04,0x19,0x09,0x08,
-  0x1A,0x00,0x61,0x19,0x16,0x04,0x08,0x03,0x0D,0x07,0x12,0x06,0x12,0x00,0x3F,0x3F,
-  0x33,0x3F,0x3F,0x33,0xE1,0x32,0x01,0x2F,0x33,0x2F,0x5D,0x12,0x39,0x39,0x11,0x33,
-  0x5D,0x33,0x5D,0x5D,0x11,0x12,0x39,0x32,0x2F,0x30,0x31,0x01,0x22,0x0E,0x02,0x07,
-  0x01,0x23,0x01,0x33,0x01,0x16,0x16,0x17,0x36,0x36,0x37,0x13,0x3E,0x03,0x33,0x32,
-  0x16,0x17,0x15,0x26,0x26,0x04,0xB4,0x23,0x35,0x2A,0x24,0x12,0xFE,0xD7,0xD1,0xFE,
-  0x3D,0xC5,0x01,0x0A,0x1A,0x2D,0x11,0x0E,0x2A,0x1A,0x8E,0x20,0x3C,0x4C,0x67,0x4B,
-  0x23,0x44,0x1A,0x17,0x36,0x05,0x2D,0x25,0x48,0x67,0x42,0xFB,0xE9,0x05,0xB6,0xFC,
-  0x6D,0x5D,0xB9,0x4F,0x4E,0xBC,0x61,0x02,0x00,0x71,0x9C,0x62,0x2B,0x0D,0x08,0x97,
-  0x09,0x0D,0x00,0x01,0x00,0x52,0x00,0x00,0x04,0xAE,0x04,0x52,0x00,0x23,0x00,0x50,
-  0x40,0x33,0x21,0x18,0x22,0x66,0x22,0x76,0x22,0x02,0x17,0x22,0x37,0x22,0x47,0x22,
-  0x57,0x22,0x04,0x22,0x18,0x23,0x28,0x23,0x38,0x23,0x03,0x23,0x09,0x10,0x09,0x00,
-  0x2F,0x18,0x01,0x18,0x01,0x40,0x00,0x50,0x00,0x02,0x00,0x22,0x09,0x23,0x15,0x1C,
-  0x4F,0x15,0x0F,0x00,0x0F,0x00,0x3F,0x3F,0xE1,0x3F,0x33,0x33,0x01,0x2F,0x5D,0x33,
-  0x2F,0x5D,0x12,0x39,0x39,0x11,0x33,0x5D,0x33,0x5D,0x5D,0x11,0x12,0x39,0x30,0x31,
-  0x13,0x33,0x13,0x1E,0x05,0x17,0x33,0x3E,0x03,0x37,0x13,0x3E,0x03,0x33,0x32,0x16,
-  0x17,0x15,0x26,0x26,0x23,0x22,0x0E,0x02,0x07,0x01,0x23,0x52,0xBC,0xE0,0x08,0x15,
-  0x18,0x18,0x14,0x10,0x03,0x06,0x07,0x19,0x1E,0x1F,0x0C,0x66,0x1E,0x35,0x41,0x53,
-  0x3C,0x1A,0x2C,0x0E,0x0B,0x20,0x12,0x1A,0x28,0x20,0x1D,0x0F,0xFE,0xF6,0xE7,0x04,
-  0x4A,0xFD,0xA2,0x16,0x3F,0x46,0x4A,0x43,0x39,0x12,0x1E,0x5D,0x67,0x65,0x25,0x01,
-  0x40,0x5D,0x75,0x43,0x18,0x07,0x03,0x87,0x03,0x05,0x13,0x28,0x41,0x2E,0xFC,0xE1,
-  0xFF,0xFF,0x00,0x3F,0x00,0x00,0x05,0x21,0x07,0x73,0x02,0x26,0x02,0x80,0x00,0x00,
-  0x01,0x07,0x03,0x76,0xFF,0xE0,0x01,0x52,0x00,0x19,0xB6,0x02,0x01,0x1D,0x05,0x26,
-  0x02,0x01,0xB8,0xFF,0x6D,0xB4,0x31,0x1D,0x08,0x19,0x25,0x01,0x2B,0x35,0x35,0x00,
-  0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0x52,0x00,0x00,0x04,0xAE,0x06,0x21,0x02,0x26,
-  0x02,0x81,0x00,0x00,0x01,0x06,0x03,0x76,0xD4,0x00,0x00,0x19,0xB6,0x02,0x01,0x24,
-  0x11,0x26,0x02,0x01,0xB8,0xFF,0x91,0xB4,0x38,0x24,0x00,0x18,0x25,0x01,0x2B,0x35,
-  0x35,0x00,0x2B,0x35,0x35,0x00,0x00,0x03,0x00,0x46,0xFE,0x14,0x04,0xD7,0x05,0xCD,
-  0x00,0x13,0x00,0x27,0x00,0x48,0x00,0x6F,0x40,0x44,0x88,0x48,0x98,0x48,0x02,0x48,
-  0x10,0x0B,0x10,0x48,0x48,0x2F,0x28,0x37,0x41,0x41,0x27,0x29,0x01,0x06,0x29,0x01,
-  0x29,0xFA,0x06,0x28,0x01,0x28,0x28,0x1E,0xFA,0x0F,0x00,0x01,0x00,0x00,0x0A,0x28,
-  0x36,0x01,0x09,0x36,0x01,0x36,0xFA,0xF0,0x37,0x01,0x37,0x14,0xFA,0x0A,0x48,0x2F,
-  0x49,0x44,0x3D,0x1C,0x36,0x28,0x0F,0x23,0x5F,0x0F,0x04,0x19,0x05,0x13,0x00,0x3F,
-  0xC1,0x3F,0xE1,0x3F,0x33,0x3F,0xCD,0x11,0x33,0x33,0x01,0x2F,0xE1,0x2F,0x5D,0xE1,
-  0x5D,0x5D,0x12,0x39,0x2F,0x5D,0xE1,0x33,0x2F,0x5D,0xE1,0x5D,0x5D,0x33,0x2F,0x11,
-  0x12,0x39,0x39,0x2B,0x5D,0x31,0x30,0x01,0x14,0x02,0x06,0x06,0x23,0x22,0x26,0x26,
-  0x02,0x35,0x34,0x12,0x36,0x36,0x33,0x32,0x16,0x16,0x12,0x05,0x14,0x1E,0x02,0x33,
-  0x32,0x3E,0x02,0x35,0x34,0x2E,0x02,0x23,0x22,0x0E,0x02,0x25,0x33,0x13,0x1E,0x03,
-  0x17,0x33,0x3E,0x03,0x37,0x13,0x33,0x03,0x0E,0x03,0x23,0x22,0x26,0x27,0x35,0x16,
-  0x16,0x33,0x32,0x36,0x37,0x37,0x02,0x6A,0x10,0x38,0x6D,0x5D,0x5D,0x6D,0x38,0x10,
-  0x10,0x39,0x6D,0x5E,0x5D,0x6C,0x38,0x0F,0xFE,0x79,0x0A,0x1A,0x2E,0x23,0x24,0x2E,
-  0x19,0x0A,0x09,0x1A,0x2D,0x23,0x24,0x2E,0x1B,0x0A,0x01,0xB0,0x9C,0x64,0x04,0x09,
-  0x09,0x08,0x03,0x04,0x02,0x05,0x07,0x07,0x04,0x6A,0x9C,0xF2,0x0F,0x29,0x3E,0x58,
-  0x3E,0x25,0x30,0x15,0x14,0x2F,0x19,0x31,0x3F,0x13,0x18,0x02,0xDD,0xB6,0xFE,0xE7,
-  0xBF,0x63,0x62,0xC0,0x01,0x1A,0xB7,0xB1,0x01,0x17,0xC1,0x65,0x65,0xC1,0xFE,0xE8,
-  0xB2,0x89,0xDB,0x99,0x51,0x51,0x99,0xDB,0x89,0x8A,0xDA,0x97,0x51,0x51,0x97,0xDA,
-  0xE3,0xFD,0x9F,0x17,0x38,0x3D,0x3F,0x1E,0x19,0x3E,0x40,0x3C,0x16,0x02,0x61,0xFB,
-  0x0E,0x4E,0x78,0x53,0x2B,0x0B,0x06,0x91,0x05,0x07,0x57,0x63,0x88,0x00,0x00,0x03,
-  0x00,0x50,0xFE,0x14,0x04,0xCD,0x04,0x5E,0x00,0x13,0x00,0x1D,0x00,0x3E,0x00,0x97,
-  0x40,0x64,0x58,0x3E,0x68,0x3E,0x02,0x39,0x3E,0x49,0x3E,0x02,0x28,0x3E,0x01,0x25,
-  0x3E,0x2D,0x15,0x1F,0x01,0x1F,0x49,0x1E,0x00,0x1E,0x01,0x1E,0x00,0x00,0x36,0x01,
-  0x36,0x36,0x89,0x19,0x01,0x58,0x19,0x68,0x19,0x78,0x19,0x03,0x19,0x49,0x59,0x00,
-  0x01,0x0F,0x00,0x01,0x00,0x00,0x0A,0x58,0x2C,0x01,0x49,0x2C,0x01,0x38,0x2C,0x01,
-  0x19,0x2C,0x01,0x08,0x2C,0x01,0x2C,0x49,0x2D,0x85,0x14,0x01,0x66,0x14,0x76,0x14,
-  0x02,0x14,0x49,0x0A,0x25,0x3E,0x1E,0x3A,0x50,0x33,0x1B,0x2C,0x1E,0x0F,0x1C,0x50,
-  0x0F,0x10,0x17,0x50,0x05,0x16,0x00,0x3F,0xE1,0x3F,0xE1,0x3F,0x33,0x3F,0xE1,0x11,
-  0x39,0x39,0x01,0x2F,0xE1,0x5D,0x5D,0x2F,0xE1,0x5D,0x5D,0x5D,0x5D,0x5D,0x12,0x39,
-  0x2F,0x5D,0x5D,0xE1,0x5D,0x5D,0x33,0x2F,0x5D,0x11,0x33,0x5D,0x10,0xE1,0x5D,0x12,
-  0x39,0x39,0x5D,0x5D,0x5D,0x30,0x31,0x01,0x14,0x0E,0x02,0x23,0x22,0x2E,0x02,0x35,
-  0x34,0x3E,0x02,0x33,0x32,0x1E,0x02,0x05,0x14,0x16,0x33,0x32,0x11,0x34,0x26,0x23,
-  0x22,0x25,0x33,0x13,0x1E,0x03,0x17,0x33,0x3E,0x03,0x37,0x13,0x33,0x03,0x0E,0x03,
-  0x23,0x22,0x26,0x27,0x35,0x16,0x16,0x33,0x32,0x36,0x37,0x37,0x02,0x73,0x26,0x47,
-  0x66,0x40,0x3D,0x64,0x48,0x27,0x28,0x49,0x65,0x3C,0x39,0x64,0x49,0x2B,0xFE,0x7B,
-  0x3B,0x39,0x75,0x3C,0x39,0x74,0x01,0x9B,0x9C,0x64,0x04,0x09,0x09,0x08,0x03,0x04,
-  0x02,0x05,0x06,0x08,0x04,0x6A,0x9C,0xF2,0x0F,0x29,0x3E,0x58,0x3E,0x25,0x30,0x16,
-  0x14,0x30,0x19,0x31,0x3F,0x13,0x18,0x02,0x27,0xA8,0xDD,0x82,0x34,0x34,0x82,0xDD,
-  0xA8,0xA8,0xDB,0x81,0x33,0x33,0x81,0xDB,0xA8,0xD3,0xD1,0x01,0xA4,0xD2,0xCE,0x83,
-  0xFD,0x9F,0x17,0x38,0x3D,0x3F,0x1E,0x19,0x3E,0x40,0x3C,0x16,0x02,0x61,0xFB,0x0E,
-  0x4E,0x78,0x53,0x2B,0x0B,0x06,0x91,0x05,0x07,0x57,0x63,0x88,0x00,0x02,0x00,0x54,
-  0xFF,0x8B,0x04,0x7B,0x06,0x29,0x00,0x1F,0x00,0x3F,0x00,0x5E,0x40,0x35,0x25,0x0B,
-  0x0B,0x3B,0x15,0x2B,0x05,0x05,0x35,0x1B,0x15,0x1B,0x10,0x30,0x5B,0x00,0x41,0x20,
-  0x5B,0x1F,0x10,0x2F,0x10,0x02,0x10,0x3B,0x4F,0x38,0x5F,0x38,0x02,0x38,0x38,0x35,
-  0x5F,0x18,0x15,0x1B,0x03,0x2B,0x40,0x28,0x50,0x28,0x02,0x28,0x28,0x25,0x5F,0x08,
-  0x05,0x0B,0x12,0x00,0x3F,0x33,0xCD,0xE1,0x32,0x2F,0x5D,0x32,0x3F,0x33,0xCD,0xE1,
-  0x32,0x2F,0x5D,0x32,0x01,0x2F,0x5D,0xE1,0x10,0xDE,0xE1,0x12,0x39,0x39,0x11,0x33,
-  0x33,0x11,0x33,0x11,0x33,0x33,0x11,0x33,0x30,0x31,0x01,0x14,0x0E,0x02,0x07,0x06,
-  0x06,0x23,0x22,0x26,0x27,0x2E,0x03,0x35,0x34,0x3E,0x02,0x37,0x36,0x36,0x33,0x32,
-  0x16,0x17,0x1E,0x03,0x05,0x14,0x1E,0x02,0x17,0x36,0x36,0x33,0x32,0x16,0x17,0x3E,
-  0x03,0x35,0x34,0x2E,0x02,0x27,0x06,0x06,0x23,0x22,0x26,0x27,0x0E,0x03,0x04,0x7B,
-  0x30,0x61,0x93,0x63,0x0E,0x4A,0x36,0x3A,0x47,0x0E,0x67,0x92,0x5E,0x2C,0x2C,0x5E,
-  0x92,0x67,0x0E,0x47,0x3A,0x36,0x4A,0x0E,0x63,0x93,0x61,0x30,0xFC,0x9E,0x16,0x2F,
-  0x4B,0x36,0x11,0x43,0x33,0x30,0x45,0x11,0x37,0x4D,0x30,0x16,0x16,0x30,0x4D,0x37,
-  0x10,0x46,0x30,0x34,0x44,0x11,0x35,0x4A,0x2F,0x16,0x02,0xDD,0x92,0xF7,0xBE,0x7E,
-  0x1A,0x3E,0x35,0x35,0x3E,0x1A,0x7E,0xBE,0xF8,0x93,0x92,0xF6,0xBD,0x7D,0x19,0x3E,
-  0x31,0x32,0x3B,0x1A,0x7E,0xBD,0xF7,0x93,0x6C,0xB6,0x8E,0x65,0x1C,0x2D,0x25,0x27,
-  0x2D,0x1A,0x64,0x8F,0xB8,0x6E,0x6E,0xB7,0x8F,0x63,0x1A,0x30,0x28,0x26,0x2E,0x1B,
-  0x65,0x8D,0xB4,0x00,0x00,0x02,0x00,0x73,0xFF,0x98,0x04,0x58,0x04,0xAE,0x00,0x21,
-  0x00,0x36,0x00,0x58,0x40,0x2F,0x24,0x0B,0x0B,0x35,0x15,0x2A,0x05,0x05,0x2F,0x1D,
-  0x15,0x1D,0x10,0x2C,0x48,0x00,0x38,0x22,0x48,0x00,0x10,0x01,0x10,0x35,0x5F,0x32,
-  0x01,0x32,0x32,0x2F,0x51,0x18,0x15,0x1D,0x0F,0x50,0x27,0x01,0x27,0x27,0x24,0x2A,
-  0x51,0x0B,0x08,0x05,0x15,0x00,0x3F,0xCD,0x33,0xE1,0x32,0x32,0x2F,0x5D,0x3F,0x33,
-  0xCD,0xE1,0x32,0x2F,0x5D,0x32,0x01,0x2F,0x5D,0xE1,0x10,0xDE,0xE1,0x12,0x39,0x39,
-  0x11,0x33,0x33,0x11,0x33,0x11,0x33,0x33,0x11,0x33,0x30,0x31,0x01,0x14,0x0E,0x02,
-  0x07,0x06,0x06,0x23,0x22,0x26,0x27,0x2E,0x03,0x35,0x34,0x3E,0x02,0x37,0x36,0x36,
-  0x33,0x32,0x1E,0x02,0x17,0x1E,0x03,0x05,0x10,0x17,0x36,0x36,0x33,0x32,0x16,0x17,
-  0x36,0x11,0x34,0x26,0x27,0x06,0x06,0x23,0x22,0x26,0x27,0x06,0x04,0x58,0x36,0x62,
-  0x8B,0x56,0x09,0x3C,0x36,0x3A,0x3B,0x08,0x51,0x88,0x63,0x38,0x35,0x61,0x8A,0x54,
-  0x0A,0x3A,0x39,0x1B,0x2A,0x1E,0x14,0x04,0x51,0x8B,0x64,0x39,0xFC,0xD7,0xBF,0x0B,
-  0x38,0x33,0x30,0x39,0x0C,0xC3,0x63,0x60,0x0C,0x39,0x30,0x33,0x37,0x0C,0xBF,0x02,
-  0x27,0x75,0xBC,0x8D,0x5C,0x13,0x36,0x2C,0x2C,0x36,0x14,0x5C,0x8D,0xBC,0x74,0x73,
-  0xBB,0x8D,0x5B,0x13,0x36,0x28,0x09,0x15,0x24,0x1C,0x13,0x5B,0x8D,0xBB,0x73,0xFE,
-  0xB8,0x47,0x26,0x1D,0x1F,0x26,0x47,0x01,0x4A,0xA5,0xC5,0x23,0x2A,0x1D,0x1F,0x28,
-  0x47,0x00,0x00,0x03,0x00,0x52,0xFF,0xEC,0x04,0x7B,0x08,0x3D,0x00,0x15,0x00,0x27,
-  0x00,0x66,0x00,0xB4,0x40,0x6B,0x35,0x0F,0x36,0x3F,0x36,0x4F,0x36,0x5F,0x36,0x7F,
-  0x36,0x8F,0x36,0x06,0x36,0x36,0x30,0xFB,0x3C,0x28,0x46,0x1D,0x16,0x22,0x19,0x0B,
-  0x0C,0x46,0x22,0x01,0x22,0x0C,0x0C,0x22,0x01,0x03,0x50,0x3C,0x68,0x57,0x00,0x56,
-  0x30,0x56,0x40,0x56,0x50,0x56,0x70,0x56,0x80,0x56,0x06,0x56,0x56,0x5C,0xFB,0x50,
-  0x35,0x57,0x57,0x33,0x59,0x5F,0x53,0x36,0x56,0x56,0x53,0x1D,0x25,0x1A,0x1A,0x4F,
-  0x19,0x5F,0x19,0x6F,0x19,0x03,0x19,0x53,0x25,0x25,0x02,0x07,0x10,0x10,0x0B,0x00,
-  0x4F,0x02,0x01,0x02,0x02,0x39,0x53,0x04,0x66,0x66,0x2B,0x61,0x5F,0x46,0x41,0x4B,
-  0x13,0x00,0x3F,0x33,0x33,0xE1,0x32,0x32,0x2F,0x3F,0x33,0x33,0x2F,0x5D,0x33,0x33,
-  0x33,0x2F,0x33,0x11,0x33,0x2F,0x10,0xC6,0x5D,0x32,0x2F,0x12,0x39,0x11,0x33,0x11,
-  0x33,0x10,0xE1,0x32,0x32,0x11,0x33,0x01,0x2F,0xE1,0x32,0x2F,0x5D,0x33,0x10,0xCE,
-  0x11,0x17,0x39,0x2F,0x2F,0x2F,0x12,0x39,0x11,0x33,0x32,0x10,0xDD,0xCD,0x11,0x33,
-  0x10,0xE1,0x32,0x2F,0x5D,0x33,0x31,0x30,0x01,0x15,0x23,0x22,0x2E,0x02,0x23,0x22,
-  0x06,0x15,0x15,0x23,0x35,0x34,0x36,0x33,0x32,0x1E,0x02,0x33,0x07,0x14,0x06,0x07,
-  0x35,0x36,0x36,0x35,0x34,0x2E,0x02,0x35,0x34,0x36,0x33,0x32,0x16,0x03,0x16,0x16,
-  0x33,0x32,0x3E,0x02,0x35,0x10,0x02,0x23,0x22,0x07,0x27,0x36,0x36,0x33,0x32,0x12,
-  0x11,0x14,0x02,0x06,0x06,0x23,0x22,0x2E,0x02,0x27,0x0E,0x03,0x23,0x22,0x26,0x26,
-  0x02,0x35,0x10,0x12,0x33,0x32,0x16,0x17,0x07,0x26,0x23,0x22,0x02,0x11,0x14,0x1E,
-  0x02,0x33,0x32,0x3E,0x02,0x37,0x03,0xDD,0x0E,0x50,0x87,0x72,0x5E,0x26,0x2B,0x37,
-  0x85,0x76,0x67,0x36,0x6A,0x70,0x7D,0x4A,0xE8,0x77,0x7A,0x3C,0x38,0x1F,0x24,0x1F,
-  0x32,0x2E,0x3B,0x44,0x7D,0x24,0x5A,0x33,0x30,0x43,0x2A,0x13,0x4E,0x42,0x37,0x29,
-  0x2F,0x22,0x58,0x30,0x92,0x93,0x22,0x4E,0x80,0x5E,0x21,0x36,0x2E,0x2B,0x17,0x16,
-  0x2A,0x2E,0x35,0x21,0x5E,0x80,0x4F,0x23,0x93,0x92,0x30,0x58,0x22,0x2F,0x29,0x38,
-  0x42,0x4D,0x13,0x2B,0x44,0x30,0x1B,0x2D,0x29,0x28,0x15,0x07,0xCB,0x81,0x24,0x2A,
-  0x24,0x2D,0x35,0x10,0x23,0x6B,0x65,0x24,0x2A,0x24,0xE2,0x4D,0x73,0x1F,0x4C,0x16,
-  0x2D,0x19,0x13,0x12,0x10,0x1A,0x1C,0x25,0x26,0x46,0xF9,0xE8,0x39,0x42,0x59,0xA4,
-  0xE5,0x8D,0x01,0x13,0x01,0x14,0x1D,0x98,0x17,0x12,0xFE,0x99,0xFE,0x9A,0xC0,0xFE,
-  0xDB,0xC6,0x65,0x09,0x14,0x21,0x18,0x18,0x21,0x14,0x09,0x65,0xC6,0x01,0x25,0xC0,
-  0x01,0x66,0x01,0x67,0x12,0x17,0x98,0x1D,0xFE,0xEC,0xFE,0xED,0x8D,0xE5,0xA4,0x59,
-  0x11,0x20,0x2E,0x1C,0x00,0x03,0x00,0x58,0xFF,0xEC,0x04,0x73,0x07,0x08,0x00,0x3B,
-  0x00,0x51,0x00,0x62,0x00,0x9C,0x40,0x29,0x0F,0x2F,0xBF,0x2F,0xFF,0x2F,0x03,0x2F,
-  0x40,0x0B,0x11,0x48,0x2F,0x2F,0x29,0x49,0x21,0x03,0x0B,0x37,0x64,0x46,0x49,0x58,
-  0x52,0x5D,0x5D,0x55,0x55,0x3D,0x3D,0x48,0x0B,0x00,0x13,0xB0,0x13,0xF0,0x13,0x03,
-  0x13,0xB8,0xFF,0xC0,0x40,0x2D,0x0B,0x11,0x48,0x13,0x13,0x19,0x49,0x0B,0x58,0x60,
-  0x56,0x55,0x60,0x60,0x48,0x43,0x4C,0x3C,0x3D,0x3D,0x0F,0x48,0x01,0x48,0x48,0x55,
-  0x2E,0x2C,0x2C,0x14,0x16,0x51,0x32,0x2F,0x13,0x10,0x10,0x26,0x21,0x1C,0x51,0x03,
-  0x00,0x06,0x16,0x00,0x3F,0x33,0x33,0xE1,0x32,0x32,0x3F,0x33,0x33,0x33,0xE1,0x32,
-  0x32,0x11,0x33,0xCE,0x32,0x2F,0x5D,0x33,0x2F,0x33,0xCD,0x32,0x11,0x33,0x2F,0x10,
-  0xCD,0x11,0x39,0x01,0x2F,0xE1,0x32,0x2F,0x2B,0x5D,0x10,0xC4,0x32,0x2F,0x32,0x2F,
-  0x33,0x2F,0xDD,0xC9,0x2F,0x33,0x10,0xDE,0x11,0x39,0x39,0xE1,0x32,0x2F,0x2B,0x5D,
-  0x31,0x30,0x05,0x22,0x26,0x27,0x06,0x06,0x23,0x22,0x2E,0x02,0x35,0x34,0x3E,0x02,
-  0x33,0x32,0x16,0x17,0x07,0x26,0x23,0x22,0x06,0x15,0x14,0x16,0x33,0x32,0x3E,0x02,
-  0x37,0x1E,0x03,0x33,0x32,0x36,0x35,0x34,0x26,0x23,0x22,0x07,0x27,0x36,0x36,0x33,
-  0x32,0x1E,0x02,0x15,0x14,0x0E,0x02,0x13,0x15,0x23,0x22,0x2E,0x02,0x23,0x22,0x06,
-  0x15,0x15,0x23,0x35,0x34,0x36,0x33,0x32,0x1E,0x02,0x33,0x07,0x14,0x06,0x07,0x35,
-  0x36,0x35,0x34,0x2E,0x02,0x35,0x34,0x36,0x33,0x32,0x16,0x03,0x1D,0x3E,0x5B,0x20,
-  0x20,0x58,0x3C,0x4C,0x7F,0x5B,0x32,0x28,0x4C,0x6D,0x44,0x2E,0x5F,0x23,0x33,0x31,
-  0x3E,0x49,0x44,0x66,0x5F,0x1A,0x2E,0x28,0x22,0x0F,0x10,0x23,0x28,0x2F,0x1C,0x5E,
-  0x65,0x44,0x4A,0x3A,0x32,0x33,0x23,0x5E,0x2D,0x46,0x6D,0x4B,0x27,0x33,0x5A,0x7E,
-  0x69,0x08,0x50,0x81,0x6E,0x60,0x2E,0x2B,0x37,0x86,0x76,0x68,0x3E,0x6C,0x6C,0x77,
-  0x4A,0xE8,0x78,0x79,0x74,0x1F,0x24,0x1F,0x32,0x2E,0x3B,0x44,0x14,0x23,0x20,0x20,
-  0x23,0x3C,0x85,0xD7,0x9B,0x9D,0xDB,0x89,0x3E,0x14,0x19,0x91,0x1E,0xC9,0xD4,0xD3,
-  0xC3,0x0E,0x18,0x1E,0x10,0x10,0x1E,0x18,0x0E,0xC3,0xD3,0xD4,0xC9,0x1E,0x91,0x19,
-  0x14,0x3E,0x89,0xDB,0x9D,0x96,0xD5,0x89,0x3F,0x06,0xAA,0x82,0x24,0x2B,0x24,0x2E,
-  0x34,0x11,0x17,0x6C,0x71,0x24,0x2A,0x24,0xE2,0x4D,0x73,0x1F,0x4C,0x29,0x33,0x13,
-  0x12,0x10,0x1A,0x1B,0x26,0x26,0x46,0x00,0x00,0x02,0x00,0x52,0xFF,0xEC,0x04,0x7B,
-  0x07,0x04,0x00,0x0D,0x00,0x4A,0x00,0xAD,0x40,0x64,0x1B,0x1B,0x0E,0xFB,0x48,0x00,
-  0x3B,0x20,0x3B,0x02,0x3B,0x3B,0x05,0x48,0x01,0xC5,0x48,0xD5,0x48,0x02,0x06,0x48,
-  0x96,0x48,0xA6,0x48,0x03,0x48,0x48,0x35,0x15,0xFB,0x04,0x02,0x03,0x05,0x06,0x06,
-  0x08,0x07,0x09,0x0A,0x0A,0x0B,0x0B,0x07,0x03,0x03,0x0C,0x0F,0x01,0x1F,0x01,0x02,
-  0x01,0x21,0x4C,0x00,0x0C,0x10,0x0C,0x02,0x0C,0x41,0xFB,0x35,0x49,0x49,0x38,0x46,
-  0x1A,0x3C,0x3C,0x18,0x3E,0x5F,0x38,0x1B,0x3B,0x3B,0x38,0x0D,0x05,0x09,0x07,0x03,
-  0x0B,0x1E,0x38,0x04,0x0E,0x48,0x48,0x10,0x46,0x5F,0x2B,0x26,0x30,0x13,0x00,0x3F,
-  0x33,0x33,0xE1,0x32,0x32,0x11,0x33,0x3F,0x33,0xDE,0x32,0x32,0xDD,0x32,0xCD,0x11,
-  0x33,0x11,0x33,0x10,0xE1,0x32,0x32,0x11,0x33,0x11,0x12,0x39,0x2F,0x01,0x2F,0xE1,
-  0xC4,0x5D,0x10,0xDE,0xC4,0x5D,0x11,0x17,0x39,0x11,0x33,0x11,0x33,0x11,0x33,0x33,
-  0x11,0x33,0x11,0x33,0x33,0xE1,0x11,0x39,0x2F,0x5D,0x5D,0x71,0x33,0x2F,0x5D,0x10,
-  0xE1,0x32,0x2F,0x31,0x30,0x01,0x15,0x07,0x23,0x27,0x23,0x07,0x23,0x27,0x23,0x07,
-  0x23,0x27,0x35,0x01,0x16,0x33,0x32,0x3E,0x02,0x35,0x10,0x02,0x23,0x22,0x07,0x27,
-  0x36,0x36,0x33,0x32,0x12,0x11,0x14,0x02,0x06,0x06,0x23,0x22,0x2E,0x02,0x27,0x0E,
-  0x03,0x23,0x22,0x26,0x26,0x02,0x35,0x10,0x12,0x33,0x32,0x16,0x17,0x07,0x26,0x23,
-  0x22,0x02,0x11,0x14,0x1E,0x02,0x33,0x32,0x37,0x11,0x33,0x03,0xDD,0x52,0x23,0x31,
-  0x8F,0x31,0x23,0x31,0x90,0x31,0x23,0x4F,0x01,0xCC,0x27,0x38,0x30,0x43,0x2A,0x13,
-  0x4E,0x42,0x37,0x29,0x2F,0x22,0x58,0x30,0x92,0x93,0x22,0x4E,0x80,0x5E,0x21,0x36,
-  0x2E,0x2B,0x17,0x16,0x2A,0x2E,0x35,0x21,0x5E,0x80,0x4F,0x23,0x93,0x92,0x30,0x58,
-  0x22,0x2F,0x29,0x38,0x42,0x4D,0x13,0x2B,0x44,0x30,0x39,0x25,0xAA,0x07,0x04,0x1B,
-  0xAC,0x67,0x67,0x67,0x67,0xAC,0x1B,0xF9,0xB6,0x2B,0x59,0xA4,0xE5,0x8D,0x01,0x13,
-  0x01,0x14,0x1D,0x98,0x17,0x12,0xFE,0x99,0xFE,0x9A,0xC0,0xFE,0xDB,0xC6,0x65,0x0D,
-  0x18,0x25,0x18,0x18,0x25,0x18,0x0D,0x65,0xC6,0x01,0x25,0xC0,0x01,0x66,0x01,0x67,
-  0x12,0x17,0x98,0x1D,0xFE,0xEC,0xFE,0xED,0x8D,0xE5,0xA4,0x59,0x2B,0x01,0xDC,0x00,
-  0x00,0x02,0xFF,0xFC,0x00,0x00,0x04,0x89,0x05,0xA4,0x00,0x0D,0x00,0x38,0x00,0xCC,
-  0x40,0x19,0x16,0x2F,0x01,0x2F,0x23,0x30,0x1D,0x49,0x06,0x38,0x16,0x38,0x02,0x16,
-  0x38,0x26,0x38,0x46,0x38,0x56,0x38,0xD6,0x38,0x05,0x38,0xB8,0xFF,0xF0,0x40,0x66,
-  0x11,0x14,0x48,0x38,0x14,0x0E,0x08,0x30,0x01,0x98,0x30,0xB8,0x30,0xD8,0x30,0xE8,
-  0x30,0x04,0x19,0x30,0x29,0x30,0x49,0x30,0x59,0x30,0x69,0x30,0x05,0x1B,0x34,0x30,
-  0x03,0x29,0x0E,0x0F,0x28,0x1C,0x38,0x1C,0x02,0x0A,0x1C,0x01,0x1C,0x1C,0x0F,0x29,
-  0x49,0x04,0x02,0x03,0x05,0x06,0x06,0x08,0x07,0x09,0x0A,0x0A,0x0B,0x0B,0x07,0x03,
-  0x03,0x0C,0x0F,0x01,0x01,0x01,0x2A,0x3A,0x00,0x0C,0x50,0x0C,0x02,0x0C,0x10,0x49,
-  0x0F,0x23,0x30,0x15,0x34,0x1B,0x1B,0x0F,0x0E,0x0D,0x05,0x09,0x07,0x03,0x0B,0x29,
-  0x1C,0x0F,0x0F,0x14,0x0E,0x15,0x00,0x3F,0x33,0x3F,0x33,0x33,0xDE,0x32,0x32,0xDD,
-  0x32,0xCD,0x11,0x12,0x39,0x11,0x33,0x3F,0x33,0x01,0x2F,0xE1,0xC6,0x5D,0x10,0xDE,
-  0xC6,0x5D,0x11,0x17,0x39,0x11,0x33,0x11,0x33,0x11,0x33,0x33,0x11,0x33,0x11,0x33,
-  0x33,0xED,0x11,0x39,0x2F,0x5D,0x5D,0x12,0x39,0x12,0x17,0x39,0x5D,0x5D,0x71,0x11,
-  0x33,0x33,0x2B,0x5D,0x71,0xE1,0x11,0x33,0x33,0x5D,0x30,0x31,0x01,0x15,0x07,0x23,
-  0x27,0x23,0x07,0x23,0x27,0x23,0x07,0x23,0x27,0x35,0x13,0x01,0x33,0x13,0x16,0x16,
-  0x17,0x33,0x3E,0x03,0x37,0x13,0x03,0x33,0x13,0x1E,0x03,0x17,0x33,0x3E,0x02,0x12,
-  0x35,0x33,0x14,0x02,0x02,0x06,0x07,0x23,0x03,0x26,0x26,0x27,0x06,0x06,0x07,0x03,
-  0x03,0xCF,0x52,0x23,0x31,0x8F,0x32,0x22,0x32,0x8F,0x31,0x23,0x50,0x3A,0xFE,0xE1,
-  0xA0,0xA3,0x14,0x22,0x08,0x04,0x05,0x0F,0x12,0x14,0x0A,0x56,0x6D,0x96,0x89,0x08,
-  0x16,0x17,0x16,0x07,0x06,0x3F,0x4F,0x2D,0x10,0x99,0x1A,0x42,0x71,0x58,0xA3,0x54,
-  0x07,0x0B,0x03,0x05,0x10,0x08,0x6A,0x05,0xA4,0x1B,0xAC,0x67,0x67,0x67,0x67,0xAC,
-  0x1B,0xFA,0x5C,0x04,0x4A,0xFD,0x5C,0x55,0x9D,0x33,0x12,0x38,0x41,0x43,0x1E,0x01,
-  0x10,0x01,0xCD,0xFD,0xB0,0x21,0x60,0x67,0x60,0x21,0x68,0xD2,0xE6,0x01,0x02,0x97,
-  0xA3,0xFE,0xE0,0xFE,0xF5,0xFD,0x7F,0x01,0x54,0x1A,0x38,0x14,0x14,0x3E,0x16,0xFE,
-  0xAE,0x00,0x00,0x01,0x00,0x81,0xFE,0x14,0x04,0x9C,0x05,0xCB,0x00,0x23,0x00,0x34,
-  0x40,0x1B,0x10,0x5A,0x11,0x11,0x18,0x21,0x20,0x20,0x25,0x05,0x5B,0x00,0x18,0x01,
-  0x18,0x21,0x00,0x5F,0x20,0x1D,0x04,0x0F,0x0A,0x5F,0x13,0x13,0x10,0x00,0x2F,0x3F,
-  0xE1,0x32,0x3F,0x33,0xE1,0x32,0x01,0x2F,0x5D,0xE1,0x11,0x33,0x2F,0x33,0x12,0x39,
-  0x2F,0xE1,0x30,0x31,0x01,0x22,0x0E,0x02,0x15,0x14,0x1E,0x02,0x33,0x32,0x3E,0x02,
-  0x37,0x11,0x23,0x11,0x23,0x22,0x26,0x26,0x02,0x35,0x34,0x12,0x36,0x36,0x33,0x32,
-  0x16,0x17,0x07,0x26,0x26,0x03,0x1D,0x6B,0xAE,0x7B,0x43,0x3B,0x76,0xB0,0x76,0x1D,
-  0x2D,0x28,0x25,0x15,0xBB,0x10,0xA4,0xF0,0x9D,0x4C,0x57,0xAA,0xF9,0xA2,0x6C,0xC4,
-  0x4F,0x4E,0x3F,0x94,0x05,0x27,0x51,0x98,0xDA,0x89,0x8D,0xDB,0x96,0x4E,0x04,0x09,
-  0x0D,0x09,0xFD,0x62,0x01,0xD8,0x6C,0xC6,0x01,0x16,0xA9,0xA6,0x01,0x14,0xC6,0x6E,
-  0x2C,0x2A,0x9C,0x20,0x2E,0x00,0x00,0x01,0x00,0xAC,0xFE,0x14,0x04,0x25,0x04,0x5E,
-  0x00,0x1F,0x00,0x35,0x40,0x1C,0x1D,0x47,0x1E,0x1E,0x05,0x0E,0x0D,0x0D,0x21,0x14,
-  0x48,0x00,0x05,0x01,0x05,0x1D,0x1B,0x0E,0x11,0x51,0x0D,0x0A,0x10,0x1C,0x19,0x51,
-  0x00,0x16,0x00,0x3F,0xE1,0x32,0x3F,0x33,0xE1,0x32,0x3F,0x01,0x2F,0x5D,0xE1,0x11,
-  0x33,0x2F,0x33,0x12,0x39,0x2F,0xE1,0x30,0x31,0x05,0x22,0x2E,0x02,0x35,0x34,0x3E,
-  0x02,0x33,0x32,0x16,0x17,0x07,0x26,0x26,0x23,0x22,0x06,0x15,0x14,0x1E,0x02,0x33,
-  0x32,0x36,0x37,0x11,0x23,0x11,0x02,0xC5,0x71,0xC4,0x91,0x53,0x54,0x95,0xCE,0x7A,
-  0x5A,0xAC,0x42,0x3E,0x3A,0x83,0x4F,0xBE,0xB5,0x31,0x5E,0x87,0x57,0x35,0x55,0x22,
-  0xB6,0x14,0x3F,0x89,0xD5,0x96,0x9D,0xDB,0x89,0x3E,0x22,0x19,0x9E,0x16,0x23,0xCC,
-  0xD1,0x69,0x9A,0x63,0x30,0x13,0x0E,0xFD,0x68,0x01,0xD8,0x00,0x00,0x01,0x00,0x5E,
-  0xFF,0xFA,0x04,0x6F,0x05,0x0A,0x00,0x13,0x00,0xA8,0x40,0x4B,0x06,0x09,0x0A,0x0D,
-  0x04,0x0E,0x05,0x0E,0x03,0x00,0x13,0x10,0x04,0x04,0x0F,0x0F,0x02,0x3F,0x01,0x4F,
-  0x01,0x5F,0x01,0xAF,0x01,0x04,0x01,0x01,0x12,0x11,0x15,0x0C,0x30,0x0B,0x40,0x0B,
-  0x50,0x0B,0xA0,0x0B,0x04,0x0B,0x0B,0x07,0x04,0x05,0x05,0x08,0x07,0x0D,0x10,0x0C,
-  0x11,0x0A,0x13,0x0B,0x12,0x0B,0x0C,0x06,0x03,0x07,0x02,0x07,0x09,0x00,0x01,0x08,
-  0x08,0x0C,0x40,0x15,0x1A,0x48,0x0C,0xB8,0xFF,0xC0,0x40,0x09,0x0C,0x0C,0x0F,0x0E,
-  0x11,0x12,0x12,0x01,0x02,0xB8,0xFF,0xC0,0xB6,0x15,0x1A,0x48,0x02,0x02,0x05,0x04,
-  0x00,0x2F,0x33,0x33,0x2F,0x2B,0x33,0x33,0x2F,0x33,0x2F,0x33,0x33,0x2F,0x38,0x2B,
-  0x33,0x2F,0x12,0x39,0x39,0x33,0x11,0x12,0x39,0x39,0x11,0x33,0x11,0x12,0x39,0x39,
-  0x11,0x12,0x39,0x39,0x01,0x2F,0x33,0x33,0x2F,0x33,0x11,0x33,0x2F,0x5D,0x33,0x10,
-  0xCE,0x32,0x32,0x2F,0x5D,0x33,0x32,0x2F,0x12,0x17,0x39,0x33,0x11,0x12,0x17,0x39,
-  0x30,0x31,0x01,0x05,0x07,0x25,0x03,0x27,0x13,0x25,0x37,0x05,0x13,0x25,0x37,0x05,
-  0x13,0x17,0x03,0x05,0x07,0x25,0x02,0x42,0x01,0x1C,0x47,0xFE,0xE3,0xB4,0x81,0xB4,
-  0xFE,0xE5,0x46,0x01,0x1F,0xC6,0xFE,0xE4,0x47,0x01,0x1D,0xB6,0x7F,0xB6,0x01,0x1F,
-  0x4A,0xFE,0xE5,0x01,0xB0,0xA6,0x7B,0xA4,0xFE,0xC7,0x4A,0x01,0x3B,0xA4,0x7B,0xA4,
-  0x01,0x5A,0xA4,0x7D,0xA4,0x01,0x39,0x49,0xFE,0xC4,0xA4,0x7B,0xA4,0x00,0x00,0x01,
-  0x00,0xF2,0x04,0x8F,0x03,0xD9,0x05,0xB8,0x00,0x15,0x00,0x17,0x40,0x09,0x04,0x0A,
-  0x10,0x00,0x13,0x0F,0x8D,0x04,0x07,0x00,0x2F,0xDD,0xFD,0xCC,0x01,0x2F,0x33,0x2F,
-  0x33,0x30,0x31,0x01,0x14,0x06,0x23,0x21,0x06,0x06,0x23,0x22,0x26,0x35,0x34,0x3E,
-  0x02,0x33,0x21,0x36,0x36,0x33,0x32,0x16,0x03,0xD9,0x2B,0x39,0xFE,0x3F,0x06,0x2C,
-  0x30,0x38,0x28,0x09,0x17,0x26,0x1C,0x01,0xC0,0x05,0x2E,0x30,0x38,0x2A,0x05,0x50,
-  0x39,0x29,0x2C,0x33,0x33,0x38,0x1C,0x25,0x16,0x09,0x2D,0x31,0x32,0x00,0x00,0x01,
-  0x00,0xF2,0x04,0xE5,0x03,0xDD,0x05,0xD9,0x00,0x15,0x00,0x1F,0x40,0x0E,0x14,0x0A,
-  0x84,0x0F,0x08,0x01,0x08,0x15,0x14,0x14,0x0E,0x05,0x80,0x0A,0x00,0x2F,0x1A,0xCC,
-  0x32,0x33,0x2F,0x33,0x01,0x2F,0x5D,0xE1,0x2F,0x31,0x30,0x01,0x32,0x3E,0x02,0x33,
-  0x32,0x16,0x15,0x15,0x23,0x35,0x34,0x26,0x23,0x22,0x0E,0x02,0x23,0x23,0x35,0x01,
-  0x00,0x4E,0x85,0x77,0x70,0x3A,0x6D,0x7C,0x85,0x3A,0x2E,0x2A,0x65,0x79,0x91,0x55,
-  0x10,0x05,0x66,0x24,0x2B,0x24,0x65,0x6C,0x23,0x11,0x34,0x2E,0x24,0x2B,0x24,0x81,
-  0x00,0x01,0x01,0xE1,0x04,0xD7,0x02,0xD3,0x06,0x35,0x00,0x11,0x00,0x23,0x40,0x12,
-  0x0F,0x40,0x09,0x0C,0x48,0x0F,0x0B,0x06,0x00,0x0B,0x03,0x0E,0x8C,0x0F,0x7F,0x03,
-  0x01,0x03,0x00,0x2F,0x5D,0x2F,0xE1,0x12,0x39,0x01,0x2F,0xCD,0xCD,0xCD,0x2B,0x30,
-  0x31,0x01,0x34,0x36,0x33,0x32,0x16,0x15,0x14,0x0E,0x02,0x15,0x14,0x16,0x17,0x15,
-  0x26,0x26,0x01,0xE1,0x44,0x3B,0x2F,0x32,0x1F,0x25,0x1F,0x39,0x3C,0x7A,0x78,0x05,
-  0xB6,0x39,0x46,0x26,0x26,0x1B,0x1A,0x10,0x12,0x13,0x19,0x2E,0x15,0x4C,0x1F,0x73,
-  0x00,0x01,0x01,0xE1,0x04,0xD7,0x02,0xD3,0x06,0x35,0x00,0x11,0x00,0x26,0xB2,0x0C,
-  0x07,0x03,0xB8,0xFF,0xC0,0x40,0x0E,0x09,0x0C,0x48,0x03,0x00,0x07,0x03,0x7F,0x0F,
-  0x01,0x0F,0x04,0x8C,0x03,0x00,0x2F,0xE1,0x2F,0x5D,0x12,0x39,0x01,0x2F,0xCD,0x2B,
-  0xCD,0xCD,0x30,0x31,0x01,0x14,0x06,0x07,0x35,0x36,0x36,0x35,0x34,0x2E,0x02,0x35,
-  0x34,0x36,0x33,0x32,0x16,0x02,0xD3,0x78,0x7A,0x3C,0x39,0x1F,0x24,0x1F,0x32,0x2E,
-  0x3B,0x44,0x05,0xB6,0x4D,0x73,0x1F,0x4C,0x15,0x2E,0x19,0x13,0x12,0x10,0x1A,0x1B,
-  0x26,0x26,0x46,0x00,0x00,0x08,0x00,0x29,0x00,0x2F,0x04,0xA4,0x04,0x35,0x00,0x0D,
-  0x00,0x1B,0x00,0x29,0x00,0x37,0x00,0x45,0x00,0x53,0x00,0x63,0x00,0x71,0x00,0x00,
-  0x01,0x32,0x16,0x17,0x23,0x26,0x26,0x23,0x22,0x06,0x07,0x23,0x36,0x36,0x13,0x32,
-  0x16,0x17,0x23,0x26,0x26,0x23,0x22,0x06,0x07,0x23,0x36,0x36,0x25,0x32,0x16,0x17,
-  0x23,0x26,0x26,0x23,0x22,0x06,0x07,0x23,0x36,0x36,0x21,0x32,0x16,0x17,0x23,0x26,
-  0x26,0x23,0x22,0x06,0x07,0x23,0x36,0x36,0x01,0x32,0x16,0x17,0x23,0x26,0x26,0x23,
-  0x22,0x06,0x07,0x23,0x36,0x36,0x21,0x32,0x16,0x17,0x23,0x26,0x26,0x23,0x22,0x06,
-  0x07,0x23,0x36,0x36,0x01,0x32,0x16,0x17,0x23,0x2E,0x03,0x23,0x22,0x06,0x07,0x23,
-  0x36,0x36,0x21,0x32,0x16,0x17,0x23,0x26,0x26,0x23,0x22,0x06,0x07,0x23,0x36,0x36,
-  0x02,0x60,0x41,0x42,0x06,0x45,0x05,0x25,0x1A,0x1C,0x20,0x03,0x48,0x02,0x43,0x42,
-  0x41,0x42,0x06,0x45,0x05,0x25,0x1A,0x1C,0x20,0x03,0x48,0x02,0x43,0x01,0x90,0x3E,
-  0x46,0x03,0x49,0x04,0x21,0x19,0x1C,0x1E,0x03,0x4A,0x03,0x43,0xFD,0xA7,0x41,0x45,
-  0x06,0x48,0x05,0x25,0x1A,0x1B,0x1F,0x03,0x46,0x04,0x3E,0x02,0xDB,0x3E,0x46,0x03,
-  0x49,0x04,0x21,0x19,0x1C,0x1E,0x03,0x4A,0x03,0x43,0xFD,0xA7,0x41,0x45,0x06,0x48,
-  0x05,0x25,0x1A,0x1B,0x1F,0x03,0x46,0x04,0x3E,0x03,0x48,0x3F,0x47,0x03,0x4A,0x01,
-  0x0C,0x11,0x16,0x0B,0x1D,0x1C,0x03,0x49,0x03,0x41,0xFC,0xD4,0x41,0x45,0x03,0x49,
-  0x04,0x23,0x19,0x1A,0x1E,0x03,0x4A,0x03,0x43,0x04,0x35,0x4D,0x3E,0x20,0x11,0x0F,
-  0x22,0x3F,0x4C,0xFC,0x83,0x4B,0x3E,0x20,0x11,0x0F,0x22,0x3F,0x4A,0xA2,0x4F,0x3E,
-  0x22,0x11,0x10,0x23,0x3F,0x4E,0x4F,0x3E,0x22,0x11,0x10,0x23,0x3F,0x4E,0x02,0x39,
-  0x4F,0x3E,0x20,0x11,0x0F,0x22,0x3F,0x4E,0x4F,0x3E,0x20,0x11,0x0F,0x22,0x3F,0x4E,
-  0xFE,0xE8,0x4E,0x41,0x11,0x14,0x0B,0x03,0x10,0x23,0x42,0x4D,0x4E,0x41,0x22,0x11,
-  0x10,0x23,0x42,0x4D,0x00,0x08,0x00,0x29,0xFF,0xE7,0x04,0xA4,0x04,0x62,0x00,0x08,
-  0x00,0x13,0x00,0x20,0x00,0x2B,0x00,0x36,0x00,0x3F,0x00,0x4A,0x00,0x55,0x00,0x3E,
-  0x40,0x1E,0x2B,0x24,0x0D,0x00,0x09,0x04,0x36,0x1A,0x1F,0x4A,0x44,0x35,0x2F,0x13,
-  0x0C,0x1A,0x21,0x14,0x25,0x55,0x3E,0x07,0x0F,0x4F,0x1F,0x4F,0x02,0x4F,0x3A,0x04,
-  0x00,0x2F,0xC6,0xC4,0x5D,0xD6,0xC6,0xC6,0xD4,0x32,0xCD,0x32,0x2F,0xCD,0xC4,0xC4,
-  0xC6,0xC4,0x01,0x2F,0xC6,0xC6,0xD4,0x32,0xCD,0x32,0x2F,0xCD,0x30,0x31,0x25,0x06,
-  0x06,0x07,0x23,0x36,0x36,0x37,0x33,0x03,0x36,0x36,0x37,0x33,0x0E,0x03,0x07,0x23,
-  0x01,0x1E,0x03,0x17,0x15,0x2E,0x03,0x27,0x35,0x05,0x26,0x26,0x27,0x35,0x1E,0x03,
-  0x17,0x15,0x01,0x36,0x36,0x37,0x17,0x0E,0x03,0x07,0x27,0x01,0x06,0x06,0x07,0x27,
-  0x36,0x36,0x37,0x17,0x03,0x26,0x26,0x27,0x37,0x1E,0x03,0x17,0x07,0x01,0x16,0x16,
-  0x17,0x07,0x2E,0x03,0x27,0x37,0x02,0xB8,0x0C,0x2D,0x19,0x4F,0x11,0x17,0x05,0x64,
-  0x91,0x0B,0x2D,0x17,0x54,0x07,0x0E,0x0D,0x0A,0x03,0x64,0x01,0xA4,0x16,0x35,0x39,
-  0x3A,0x1B,0x1E,0x40,0x3E,0x39,0x17,0xFD,0x4C,0x2E,0x75,0x38,0x1A,0x3F,0x41,0x3C,
-  0x15,0x02,0x13,0x36,0x6F,0x2C,0x3F,0x15,0x37,0x38,0x34,0x12,0x46,0xFE,0x7F,0x2F,
-  0x71,0x33,0x40,0x29,0x6D,0x37,0x48,0x77,0x1D,0x35,0x12,0x3D,0x11,0x25,0x24,0x20,
-  0x0D,0x47,0x02,0x50,0x1F,0x32,0x13,0x3B,0x12,0x26,0x24,0x21,0x0D,0x4A,0xC3,0x2F,
-  0x77,0x36,0x57,0x72,0x23,0x02,0xB4,0x30,0x75,0x36,0x1C,0x3F,0x3E,0x3A,0x18,0xFE,
-  0xFE,0x06,0x11,0x15,0x18,0x0C,0x54,0x07,0x0E,0x0E,0x0A,0x02,0x64,0x91,0x0C,0x2D,
-  0x19,0x52,0x06,0x0D,0x0D,0x0B,0x02,0x67,0x01,0x69,0x1F,0x34,0x11,0x3B,0x0E,0x24,
-  0x26,0x23,0x0E,0x47,0xFD,0xB0,0x18,0x37,0x13,0x3B,0x19,0x4A,0x27,0x4A,0x01,0xDD,
-  0x35,0x6F,0x2D,0x3F,0x1B,0x3A,0x35,0x2F,0x11,0x48,0xFE,0x81,0x35,0x6F,0x2F,0x3F,
-  0x1B,0x3A,0x36,0x2F,0x12,0x48,0x00,0x02,0x00,0x89,0xFE,0x7F,0x05,0x08,0x07,0x68,
-  0x00,0x1B,0x00,0x31,0x00,0x5C,0x40,0x32,0x19,0x1A,0x1B,0x1B,0x18,0x17,0x31,0xFB,
-  0x1C,0x1C,0x27,0xFB,0x26,0x26,0x09,0x15,0x00,0xFB,0x17,0x33,0x40,0x08,0x0C,0xFB,
-  0x00,0x09,0xE0,0x09,0xF0,0x09,0x03,0x09,0x31,0x27,0x80,0x2C,0x21,0x15,0x07,0x0B,
-  0x03,0x13,0x08,0x12,0x1A,0x1A,0x17,0x5F,0x00,0x12,0x00,0x3F,0xE1,0x33,0x2F,0x3F,
-  0x33,0x3F,0x33,0x33,0xDE,0x32,0x1A,0xCC,0x32,0x01,0x2F,0x5D,0xE1,0x32,0x1A,0x10,
-  0xDD,0xE1,0x32,0x11,0x39,0x2F,0xE1,0x33,0x2F,0xE1,0x10,0xCD,0x32,0x10,0xCD,0x32,
-  0x31,0x30,0x21,0x11,0x34,0x36,0x37,0x36,0x37,0x23,0x01,0x23,0x11,0x33,0x11,0x14,
-  0x0E,0x02,0x07,0x06,0x07,0x33,0x01,0x33,0x11,0x33,0x03,0x23,0x13,0x03,0x0E,0x03,
-  0x23,0x22,0x2E,0x02,0x27,0x33,0x1E,0x03,0x33,0x32,0x3E,0x02,0x37,0x03,0x9A,0x05,
-  0x04,0x04,0x05,0x08,0xFD,0xBC,0xD7,0xAE,0x01,0x02,0x02,0x02,0x04,0x03,0x06,0x02,
-  0x42,0xD5,0xC2,0x8F,0xD9,0xA6,0x61,0x06,0x30,0x5D,0x8E,0x64,0x67,0x8C,0x57,0x2A,
-  0x05,0xAA,0x05,0x1B,0x33,0x4B,0x35,0x2C,0x49,0x36,0x23,0x05,0x03,0x19,0x39,0x8E,
-  0x41,0x4C,0x4D,0xFB,0x46,0x05,0xB6,0xFC,0xE0,0x1A,0x3E,0x43,0x43,0x20,0x4A,0x4C,
-  0x04,0xB4,0xFA,0xF0,0xFD,0xD9,0x01,0x81,0x07,0x68,0x4D,0x77,0x50,0x29,0x27,0x4F,
-  0x77,0x50,0x39,0x48,0x29,0x10,0x12,0x2C,0x47,0x35,0x00,0x02,0x00,0xB2,0xFE,0x83,
-  0x04,0xC1,0x06,0x17,0x00,0x0F,0x00,0x25,0x00,0xA4,0xB9,0x00,0x03,0xFF,0xF0,0xB3,
-  0x12,0x18,0x48,0x03,0xB8,0xFF,0xE0,0x40,0x60,0x0B,0x0E,0x48,0x25,0x03,0x35,0x03,
-  0x02,0x09,0x10,0x12,0x18,0x48,0x09,0x20,0x0B,0x0E,0x48,0x2A,0x09,0x3A,0x09,0x02,
-  0xAB,0x02,0x01,0x89,0x02,0x99,0x02,0x02,0xA4,0x08,0x01,0x86,0x08,0x96,0x08,0x02,
-  0x0D,0x0E,0x0F,0x0F,0x0C,0x0B,0x25,0x46,0x10,0x10,0x1B,0x46,0x1A,0x1A,0x04,0x09,
-  0x00,0x46,0x0B,0x27,0x40,0x03,0x06,0x46,0x00,0x04,0x10,0x04,0x20,0x04,0xB0,0x04,
-  0xC0,0x04,0xD0,0x04,0x06,0x07,0x04,0x25,0x1B,0x80,0x20,0x15,0x09,0x02,0x06,0x0F,
-  0x08,0x03,0x15,0x0E,0x0E,0x0B,0x50,0x00,0x15,0x00,0x3F,0xE1,0x33,0x2F,0x3F,0x33,
-  0x3F,0x33,0x33,0xDE,0x32,0x1A,0xCC,0x32,0x01,0x2F,0x5E,0x5D,0xE1,0x32,0x1A,0x10,
-  0xDC,0xE1,0x32,0x11,0x39,0x2F,0xE1,0x33,0x2F,0xE1,0x10,0xCD,0x32,0x10,0xCD,0x32,
-  0x31,0x30,0x00,0x5D,0x5D,0x5D,0x5D,0x01,0x5D,0x2B,0x2B,0x5D,0x2B,0x2B,0x21,0x11,
-  0x13,0x01,0x23,0x11,0x33,0x11,0x07,0x01,0x33,0x11,0x33,0x03,0x23,0x13,0x03,0x0E,
-  0x03,0x23,0x22,0x2E,0x02,0x27,0x33,0x1E,0x03,0x33,0x32,0x3E,0x02,0x37,0x03,0x5E,
-  0x0A,0xFE,0x3A,0xF0,0xAC,0x0C,0x01,0xC9,0xEF,0xB7,0x7B,0xB7,0x7B,0x25,0x06,0x30,
-  0x5D,0x8E,0x64,0x67,0x8C,0x57,0x2A,0x05,0xAA,0x05,0x1B,0x33,0x4B,0x35,0x2C,0x49,
-  0x36,0x23,0x05,0x02,0x87,0x01,0x0F,0xFC,0x6A,0x04,0x4A,0xFD,0x64,0xFC,0x03,0x98,
-  0xFC,0x50,0xFD,0xE9,0x01,0x7D,0x06,0x17,0x4E,0x76,0x51,0x29,0x27,0x50,0x77,0x50,
-  0x39,0x49,0x29,0x10,0x13,0x2B,0x48,0x35,0x00,0x02,0x00,0x2F,0x00,0x00,0x04,0x46,
-  0x05,0xB6,0x00,0x16,0x00,0x21,0x00,0x41,0x40,0x21,0x15,0x15,0x17,0x1B,0x5B,0x06,
-  0x23,0x13,0x00,0x17,0x5A,0x10,0x0E,0x0C,0x21,0x5F,0x00,0x16,0x0E,0x5F,0x0F,0x13,
-  0x0F,0x00,0x0F,0x00,0x0F,0x11,0x03,0x17,0x60,0x0C,0x12,0x00,0x3F,0xE1,0x3F,0x39,
-  0x39,0x2F,0x2F,0x11,0x33,0x10,0xE1,0x32,0x10,0xE1,0x01,0x2F,0xC6,0x33,0xE1,0x32,
-  0x32,0x10,0xDE,0xE1,0x11,0x39,0x2F,0x30,0x31,0x01,0x33,0x32,0x1E,0x02,0x15,0x14,
-  0x0E,0x02,0x23,0x21,0x11,0x23,0x35,0x33,0x35,0x33,0x15,0x21,0x15,0x21,0x11,0x33,
-  0x32,0x36,0x35,0x34,0x2E,0x02,0x23,0x23,0x01,0x81,0xA8,0x98,0xCF,0x7F,0x37,0x3C,
-  0x7E,0xC2,0x86,0xFE,0x83,0x98,0x98,0xBA,0x01,0x4E,0xFE,0xB2,0xB2,0xAF,0xA3,0x2E,
-  0x5B,0x8B,0x5D,0x93,0x03,0x4E,0x42,0x71,0x98,0x57,0x61,0x9E,0x70,0x3D,0x04,0x60,
-  0xA4,0xB2,0xB2,0xA4,0xFC,0x40,0x84,0x88,0x46,0x61,0x3C,0x1B,0x00,0x02,0x00,0x3D,
-  0x00,0x00,0x04,0x44,0x06,0x14,0x00,0x14,0x00,0x21,0x00,0x49,0x40,0x27,0x0F,0x02,
-  0x01,0x02,0x02,0x0E,0x1C,0x46,0x08,0x23,0x04,0x00,0x16,0x47,0x12,0x10,0x0E,0x15,
-  0x50,0x04,0x03,0x10,0x4F,0x11,0x00,0x11,0x2F,0x04,0x01,0x04,0x11,0x04,0x11,0x13,
-  0x00,0x16,0x50,0x0E,0x15,0x00,0x3F,0xE1,0x3F,0x39,0x39,0x2F,0x2F,0x5D,0x11,0x33,
-  0x10,0xE1,0x32,0x10,0xE1,0x01,0x2F,0xC6,0x33,0xE1,0x32,0x32,0x10,0xDE,0xE1,0x11,
-  0x39,0x2F,0x5D,0x30,0x31,0x01,0x21,0x15,0x21,0x11,0x21,0x32,0x16,0x15,0x14,0x0E,
-  0x02,0x23,0x21,0x11,0x23,0x35,0x33,0x35,0x33,0x11,0x11,0x21,0x32,0x3E,0x02,0x35,
-  0x34,0x2E,0x02,0x23,0x01,0x8F,0x01,0x17,0xFE,0xE9,0x01,0x15,0xD4,0xCC,0x2F,0x65,
-  0x9F,0x71,0xFE,0x39,0x9C,0x9C,0xB6,0x01,0x04,0x38,0x5D,0x43,0x26,0x21,0x41,0x60,
-  0x40,0x05,0x21,0x89,0xFD,0xEF,0x9C,0x9B,0x4D,0x7C,0x58,0x2F,0x04,0x98,0x89,0xF3,
-  0xFB,0xDA,0xFE,0xA8,0x11,0x29,0x42,0x30,0x31,0x42,0x28,0x11,0x00,0x02,0x00,0xB0,
-  0x00,0x00,0x04,0x46,0x05,0xB6,0x00,0x14,0x00,0x23,0x00,0x6C,0x40,0x3B,0x19,0x08,
-  0x1A,0x07,0x07,0x1C,0x05,0x1B,0x06,0x06,0x1F,0x5B,0xEF,0x00,0xFF,0x00,0x02,0x00,
-  0x25,0x1B,0x1A,0x1A,0x15,0x0D,0x5A,0x00,0x0E,0x90,0x0E,0xA0,0x0E,0x03,0x0E,0x19,
-  0x08,0x1A,0x07,0x1A,0x1C,0x05,0x06,0x1B,0x1B,0x15,0x06,0x07,0x07,0x0C,0x60,0x16,
-  0x15,0x15,0x0D,0x23,0x60,0x0F,0x03,0x0D,0x12,0x00,0x3F,0x3F,0xE1,0x12,0x39,0x2F,
-  0x33,0xE1,0x32,0x2F,0x33,0x11,0x33,0x2F,0x12,0x39,0x39,0x33,0x11,0x12,0x39,0x39,
-  0x01,0x2F,0x5D,0xE1,0x32,0x32,0x2F,0x33,0x10,0xDE,0x5D,0xE1,0x33,0x2F,0x12,0x39,
-  0x39,0x33,0x11,0x12,0x39,0x39,0x30,0x31,0x01,0x14,0x0E,0x02,0x07,0x17,0x07,0x27,
-  0x06,0x06,0x23,0x23,0x11,0x23,0x11,0x21,0x32,0x1E,0x02,0x01,0x33,0x32,0x36,0x37,
-  0x27,0x37,0x17,0x36,0x36,0x35,0x34,0x26,0x23,0x23,0x04,0x46,0x18,0x33,0x52,0x3A,
-  0x68,0x6A,0x7D,0x2C,0x62,0x39,0xBF,0xBA,0x01,0x94,0x86,0xC2,0x7E,0x3C,0xFD,0x24,
-  0xAA,0x20,0x3B,0x1A,0x5E,0x6D,0x76,0x3C,0x3B,0xA3,0xAF,0xC9,0x04,0x0A,0x3D,0x73,
-  0x66,0x55,0x20,0x93,0x4E,0xB0,0x0B,0x0A,0xFD,0xC7,0x05,0xB6,0x39,0x6D,0xA0,0xFE,
-  0x67,0x03,0x05,0x87,0x4C,0xAA,0x22,0x79,0x5D,0x8E,0x89,0x00,0x00,0x02,0x00,0x9E,
-  0xFE,0x14,0x04,0x44,0x04,0x5E,0x00,0x23,0x00,0x39,0x00,0x78,0x40,0x43,0x32,0x21,
-  0x33,0x20,0x20,0x35,0x1E,0x34,0x1F,0x1F,0x37,0x48,0x0F,0x1B,0x1F,0x1B,0x02,0x1B,
-  0x3B,0x34,0x33,0x33,0x2A,0x10,0x0F,0x06,0x0C,0x47,0x00,0x0D,0x10,0x0D,0x20,0x0D,
-  0xD0,0x0D,0x04,0x07,0x0D,0x24,0x50,0x10,0x16,0x10,0x0E,0x0F,0x0C,0x1B,0x32,0x21,
-  0x33,0x20,0x33,0x35,0x1E,0x1F,0x34,0x34,0x2F,0x50,0x00,0x1F,0x20,0x20,0x05,0x00,
-  0x16,0x00,0x3F,0x32,0x32,0x2F,0x33,0x10,0xE1,0x32,0x2F,0x12,0x39,0x39,0x33,0x11,
-  0x12,0x39,0x39,0x3F,0x3F,0x3F,0x33,0xE1,0x01,0x2F,0x5E,0x5D,0xE1,0x32,0x32,0x32,
-  0x32,0x32,0x2F,0x33,0x10,0xDE,0x71,0xE1,0x33,0x2F,0x12,0x39,0x39,0x33,0x11,0x12,
-  0x39,0x39,0x30,0x31,0x05,0x22,0x2E,0x02,0x27,0x23,0x16,0x17,0x16,0x16,0x15,0x11,
-  0x23,0x11,0x33,0x17,0x33,0x3E,0x03,0x33,0x32,0x1E,0x02,0x15,0x14,0x06,0x07,0x17,
-  0x07,0x27,0x06,0x06,0x03,0x22,0x0E,0x02,0x07,0x15,0x14,0x1E,0x02,0x33,0x32,0x36,
-  0x37,0x27,0x37,0x17,0x36,0x35,0x34,0x26,0x02,0x96,0x3D,0x62,0x4F,0x3D,0x17,0x0C,
-  0x03,0x03,0x02,0x04,0xB6,0x93,0x1B,0x08,0x17,0x3C,0x4F,0x63,0x3D,0x61,0x9E,0x71,
-  0x3E,0x5F,0x54,0x6B,0x6B,0x74,0x20,0x44,0x44,0x4F,0x6D,0x43,0x20,0x02,0x1C,0x44,
-  0x6F,0x54,0x12,0x22,0x0F,0x6A,0x6C,0x6F,0x5C,0x84,0x14,0x1A,0x2B,0x3A,0x20,0x22,
-  0x1F,0x1A,0x37,0x10,0xFE,0x2B,0x06,0x36,0x94,0x23,0x3D,0x2D,0x1B,0x48,0x8F,0xD4,
-  0x8C,0xB1,0xF2,0x45,0x97,0x4E,0xA6,0x09,0x0B,0x03,0xDB,0x2E,0x5E,0x8C,0x5F,0x29,
-  0x65,0x9D,0x6B,0x37,0x03,0x05,0x98,0x4C,0xA0,0x68,0xF2,0xD0,0xCE,0x00,0x00,0x01,
-  0x00,0x93,0x00,0x00,0x04,0x64,0x05,0xB6,0x00,0x0D,0x00,0x31,0x40,0x18,0x05,0x05,
-  0x08,0x00,0x0F,0x03,0x07,0x5A,0x0C,0x0A,0x08,0x06,0x0A,0x5F,0x03,0x0B,0x0B,0x07,
-  0x02,0x5F,0x0D,0x03,0x07,0x12,0x00,0x3F,0x3F,0xE1,0x12,0x39,0x2F,0x33,0xE1,0x32,
-  0x01,0x2F,0xC6,0x33,0xE1,0x32,0x10,0xCE,0x11,0x39,0x2F,0x30,0x31,0x01,0x15,0x21,
-  0x11,0x21,0x15,0x21,0x11,0x23,0x11,0x23,0x35,0x33,0x11,0x04,0x64,0xFD,0x81,0x01,
-  0x50,0xFE,0xB0,0xBA,0x98,0x98,0x05,0xB6,0xA6,0xFE,0x15,0xA2,0xFD,0x7D,0x02,0x83,
-  0xA2,0x02,0x91,0x00,0x00,0x01,0x00,0x87,0x00,0x00,0x04,0x0E,0x04,0x4A,0x00,0x0D,
-  0x00,0x31,0x40,0x18,0x0B,0x0B,0x00,0x06,0x0F,0x09,0x0D,0x47,0x04,0x02,0x00,0x0C,
-  0x02,0x4F,0x09,0x03,0x03,0x00,0x08,0x50,0x05,0x0F,0x00,0x15,0x00,0x3F,0x3F,0xE1,
-  0x12,0x39,0x2F,0x33,0xE1,0x32,0x01,0x2F,0xC6,0x33,0xE1,0x32,0x10,0xCE,0x11,0x39,
-  0x2F,0x30,0x31,0x21,0x11,0x23,0x35,0x33,0x11,0x21,0x15,0x21,0x11,0x21,0x15,0x21,
-  0x11,0x01,0x23,0x9C,0x9C,0x02,0xEB,0xFD,0xCB,0x01,0x17,0xFE,0xE9,0x01,0xE1,0x89,
-  0x01,0xE0,0x9A,0xFE,0xBA,0x89,0xFE,0x1F,0x00,0x01,0x00,0xA0,0xFE,0x00,0x04,0x71,
-  0x05,0xB6,0x00,0x26,0x00,0x38,0x40,0x1D,0x08,0x08,0x22,0x5B,0x12,0x28,0x0A,0x04,
-  0x5A,0x1C,0x00,0x05,0x01,0x05,0x1D,0x20,0x5F,0x1C,0x17,0x00,0x0D,0x0D,0x05,0x09,
-  0x5F,0x06,0x03,0x05,0x12,0x00,0x3F,0x3F,0xE1,0x12,0x39,0x2F,0xC1,0x2F,0x33,0xE1,
-  0x32,0x01,0x2F,0x5D,0xC6,0xE1,0x32,0x10,0xDE,0xF1,0xC0,0x2F,0x30,0x31,0x01,0x22,
-  0x06,0x07,0x11,0x23,0x11,0x21,0x15,0x21,0x11,0x36,0x36,0x33,0x32,0x1E,0x02,0x15,
-  0x14,0x0E,0x02,0x23,0x22,0x2E,0x02,0x27,0x35,0x16,0x16,0x33,0x20,0x11,0x34,0x2E,
-  0x02,0x01,0xD5,0x25,0x3C,0x1A,0xBA,0x02,0xF8,0xFD,0xC2,0x1D,0x48,0x2D,0x99,0xF0,
-  0xA5,0x57,0x52,0x92,0xC9,0x76,0x31,0x4E,0x44,0x3C,0x20,0x3F,0x7F,0x48,0x01,0x77,
-  0x43,0x7B,0xAE,0x02,0x83,0x05,0x05,0xFD,0x87,0x05,0xB6,0xA6,0xFE,0x0B,0x05,0x03,
-  0x5C,0xAB,0xF2,0x97,0xAA,0xF8,0xA2,0x4F,0x06,0x0C,0x13,0x0C,0xA2,0x17,0x18,0x01,
-  0xEF,0x79,0xB9,0x7E,0x40,0x00,0x00,0x01,0x00,0xD7,0xFE,0x0A,0x04,0x58,0x04,0x4A,
-  0x00,0x29,0x00,0x35,0x40,0x1C,0x1B,0x1B,0x10,0x48,0x25,0x2B,0x1D,0x17,0x46,0x05,
-  0x00,0x18,0x01,0x18,0x13,0x51,0x20,0x20,0x18,0x1C,0x50,0x19,0x0F,0x18,0x15,0x0B,
-  0x51,0x00,0x00,0x2F,0xE1,0x3F,0x3F,0xE1,0x12,0x39,0x2F,0xE1,0x01,0x2F,0x5D,0xC6,
-  0xE1,0x32,0x10,0xD6,0xF1,0xC0,0x2F,0x30,0x31,0x01,0x22,0x2E,0x02,0x27,0x35,0x1E,
-  0x03,0x33,0x32,0x3E,0x02,0x35,0x34,0x26,0x23,0x22,0x06,0x07,0x11,0x23,0x11,0x21,
-  0x15,0x21,0x11,0x36,0x36,0x33,0x32,0x1E,0x02,0x15,0x14,0x0E,0x02,0x02,0x7F,0x29,
-  0x41,0x37,0x31,0x1A,0x19,0x30,0x34,0x3D,0x26,0x46,0x6E,0x4D,0x28,0xB5,0xC6,0x20,
-  0x53,0x23,0xB4,0x02,0xA8,0xFE,0x0C,0x22,0x4E,0x2A,0x7D,0xD0,0x94,0x52,0x4C,0x81,
-  0xAC,0xFE,0x0A,0x07,0x0F,0x17,0x0F,0xA1,0x0D,0x16,0x11,0x09,0x30,0x63,0x99,0x69,
-  0xD3,0xCB,0x06,0x06,0xFE,0x2F,0x04,0x4A,0x9A,0xFE,0xC3,0x05,0x05,0x3E,0x8A,0xDB,
-  0x9D,0x97,0xD6,0x87,0x3F,0x00,0x00,0x01,0x00,0x00,0xFE,0x7F,0x04,0xCD,0x05,0xB6,
-  0x00,0x15,0x00,0x72,0x40,0x40,0x11,0x0E,0x03,0xFA,0x0B,0x08,0x10,0x04,0x01,0x04,
-  0x04,0x07,0x15,0xFB,0x14,0x14,0x0F,0x2F,0x10,0x3F,0x10,0x02,0x10,0x10,0x01,0xAB,
-  0x12,0x01,0x69,0x12,0x01,0x42,0x12,0x01,0x0B,0x12,0x01,0x12,0x17,0x06,0x16,0x0A,
-  0x09,0x09,0x07,0x11,0x05,0x02,0x08,0x08,0x06,0x0F,0x0C,0x0A,0x03,0x15,0x15,0x04,
-  0x06,0x12,0x12,0x5F,0x01,0x12,0x00,0x3F,0xE1,0x3F,0x33,0x33,0x2F,0x3F,0x33,0x33,
-  0x12,0x39,0x11,0x33,0x33,0x33,0x01,0x2F,0x33,0x2F,0x33,0x11,0x33,0x10,0xCD,0x5D,
-  0x5D,0x5D,0x5D,0x32,0x32,0x2F,0x5D,0x33,0x32,0x2F,0xE1,0x11,0x39,0x2F,0x5D,0x33,
-  0x33,0xE1,0x32,0x32,0x31,0x30,0x21,0x23,0x01,0x11,0x23,0x11,0x01,0x23,0x01,0x01,
-  0x33,0x01,0x11,0x33,0x11,0x01,0x33,0x01,0x01,0x33,0x11,0x23,0x04,0x1D,0x31,0xFE,
-  0xB6,0x9C,0xFE,0xB0,0xB6,0x01,0x60,0xFE,0xAC,0xB2,0x01,0x48,0x9C,0x01,0x41,0xB3,
-  0xFE,0xB0,0x01,0x10,0x77,0xB0,0x02,0xE5,0xFD,0x1B,0x02,0xE5,0xFD,0x1B,0x02,0xF2,
-  0x02,0xC4,0xFD,0x3C,0x02,0xC4,0xFD,0x3C,0x02,0xC4,0xFD,0x3C,0xFD,0xB4,0xFD,0xD9,
-  0x00,0x01,0x00,0x00,0xFE,0x83,0x04,0xB8,0x04,0x4A,0x00,0x15,0x00,0x62,0x40,0x35,
-  0x05,0x16,0x10,0x0D,0x02,0x49,0x0A,0x07,0x03,0x03,0x08,0x14,0x49,0x00,0x1B,0x11,
-  0x01,0x11,0x0F,0x90,0x13,0xA0,0x13,0x02,0x7F,0x13,0x01,0x10,0x13,0x01,0x13,0x09,
-  0x06,0x08,0x10,0x0D,0x07,0x0A,0x0A,0x08,0x13,0x13,0x16,0x0E,0x0B,0x08,0x0F,0x11,
-  0x50,0x00,0x00,0x03,0x06,0x00,0x2F,0x33,0x33,0x10,0xE1,0x3F,0x33,0x33,0x11,0x33,
-  0x2F,0x12,0x39,0x11,0x33,0x33,0x33,0x01,0x2F,0x32,0x32,0x2F,0x5D,0x5D,0x5D,0x33,
-  0xCD,0x5D,0x32,0xE1,0x11,0x39,0x2F,0x33,0x33,0xE1,0x32,0x32,0x11,0x33,0x31,0x30,
-  0x21,0x01,0x11,0x23,0x11,0x01,0x23,0x01,0x01,0x33,0x01,0x11,0x33,0x11,0x01,0x33,
-  0x01,0x13,0x33,0x11,0x23,0x11,0x03,0xDF,0xFE,0xC3,0xA0,0xFE,0xC3,0xC3,0x01,0x5A,
-  0xFE,0xA4,0xB8,0x01,0x4A,0xA0,0x01,0x4A,0xB8,0xFE,0xA6,0xFA,0x74,0xA1,0x02,0x2D,
-  0xFD,0xD3,0x02,0x2D,0xFD,0xD3,0x02,0x35,0x02,0x15,0xFD,0xEB,0x02,0x15,0xFD,0xEB,
-  0x02,0x15,0xFD,0xEB,0xFE,0x65,0xFD,0xE9,0x01,0x7D,0xFF,0xFF,0x00,0x8B,0xFE,0x42,
-  0x04,0x2F,0x05,0xCB,0x02,0x26,0x01,0xB1,0x00,0x00,0x01,0x06,0x03,0x7F,0xF7,0x00,
-  0x00,0x0E,0xB7,0x01,0x01,0x00,0x32,0x2C,0x09,0x04,0x25,0x01,0x2B,0x35,0x00,0x35,
-  0xFF,0xFF,0x00,0xC9,0xFE,0x42,0x04,0x08,0x04,0x5E,0x02,0x26,0x01,0xD1,0x00,0x00,
-  0x01,0x06,0x03,0x7F,0xF5,0x00,0x00,0x11,0xB1,0x01,0x01,0xB8,0xFF,0xF3,0xB4,0x2F,
-  0x29,0x08,0x12,0x25,0x01,0x2B,0x35,0x00,0x35,0x00,0x00,0x01,0x00,0xD3,0xFE,0x7F,
-  0x04,0xBA,0x05,0xB6,0x00,0x0E,0x00,0x78,0x40,0x4D,0x87,0x0E,0x01,0x75,0x0E,0x01,
-  0x36,0x0E,0x56,0x0E,0x02,0x0E,0x0B,0x07,0x5A,0x00,0x08,0x60,0x08,0x70,0x08,0x80,
-  0x08,0x04,0x08,0x0C,0x57,0x0D,0x01,0x40,0x0D,0x01,0x25,0x0D,0x01,0x07,0x0D,0x01,
-  0x0D,0x0D,0x28,0x05,0x01,0x05,0x55,0x00,0x01,0x36,0x00,0x01,0x24,0x00,0x01,0x05,
-  0x00,0x01,0x00,0x03,0xFB,0x7F,0x02,0x01,0x02,0x06,0x0E,0x0E,0x07,0x0C,0x0A,0x03,
-  0x05,0x07,0x03,0x03,0x00,0x07,0x12,0x00,0x3F,0xC4,0x33,0x2F,0x11,0x33,0x3F,0x33,
-  0x12,0x39,0x11,0x33,0x01,0x2F,0x5D,0xE1,0xCD,0x5D,0x5D,0x5D,0x5D,0x32,0x5D,0x33,
-  0x2F,0x5D,0x5D,0x5D,0x5D,0x33,0x2F,0x5D,0xE1,0x32,0x32,0x5D,0x5D,0x5D,0x31,0x30,
-  0x25,0x33,0x11,0x23,0x11,0x23,0x01,0x11,0x23,0x11,0x33,0x11,0x01,0x33,0x01,0x04,
-  0x2B,0x8F,0xB0,0x37,0xFD,0xBA,0xBA,0xBA,0x02,0x36,0xCE,0xFD,0xCB,0xA6,0xFD,0xD9,
-  0x01,0x81,0x02,0xE5,0xFD,0x1B,0x05,0xB6,0xFD,0x3C,0x02,0xC4,0xFD,0x42,0x00,0x01,
-  0x00,0xD7,0xFE,0x83,0x04,0x9C,0x04,0x4A,0x00,0x0E,0x00,0x4D,0x40,0x2C,0x07,0x08,
-  0x08,0x00,0x0A,0x0D,0x46,0x80,0x0C,0x01,0x0C,0x09,0x06,0x02,0x47,0x00,0x03,0x10,
-  0x03,0x20,0x03,0x80,0x03,0xD0,0x03,0x05,0x07,0x03,0x01,0x09,0x09,0x02,0x07,0x05,
-  0x0F,0x0A,0x50,0x00,0x00,0x02,0x0D,0x0D,0x02,0x15,0x00,0x3F,0x33,0x2F,0x11,0x33,
-  0x10,0xE1,0x3F,0x33,0x12,0x39,0x11,0x33,0x01,0x2F,0x5E,0x5D,0xE1,0x32,0x32,0x2F,
-  0x5D,0xE1,0xCD,0x32,0x32,0x2F,0x33,0x31,0x30,0x21,0x01,0x11,0x23,0x11,0x33,0x11,
-  0x01,0x33,0x01,0x01,0x33,0x11,0x23,0x11,0x03,0xAE,0xFD,0xDD,0xB4,0xB4,0x02,0x06,
-  0xDE,0xFD,0xF1,0x01,0x9E,0x9E,0xB0,0x02,0x2D,0xFD,0xD3,0x04,0x4A,0xFD,0xEB,0x02,
-  0x15,0xFD,0xF1,0xFE,0x5F,0xFD,0xE9,0x01,0x7D,0x00,0x00,0x01,0x00,0xD3,0x00,0x00,
-  0x04,0xAE,0x05,0xB6,0x00,0x12,0x00,0x8B,0xB7,0x0B,0x07,0x5A,0x08,0x12,0x0F,0x02,
-  0x03,0xB8,0x01,0x03,0x40,0x49,0x0C,0x05,0x26,0x04,0x01,0x0C,0x04,0x1C,0x04,0x02,
-  0x04,0x04,0x00,0x00,0x08,0x60,0x08,0x70,0x08,0x80,0x08,0x04,0x08,0x10,0x11,0x11,
-  0x01,0xD0,0x00,0xF0,0x00,0x02,0x7F,0x00,0x01,0x00,0x00,0x10,0x00,0x40,0x00,0x60,
-  0x00,0x04,0x00,0x10,0x00,0x02,0x12,0x12,0x05,0x06,0x11,0x03,0x0F,0x0C,0x10,0x0B,
-  0x10,0x0B,0x06,0x06,0x09,0x08,0x04,0x0D,0x04,0x0D,0x09,0x03,0x08,0x00,0x12,0x00,
-  0x3F,0x32,0x3F,0x39,0x39,0x2F,0x2F,0x11,0x12,0x39,0x11,0x33,0x32,0x11,0x12,0x39,
-  0x39,0x3F,0x12,0x39,0x39,0x11,0x33,0x01,0x2F,0x38,0x5D,0x5D,0x5D,0x33,0x33,0x2F,
-  0x33,0x2F,0x5D,0x12,0x39,0x2F,0x5D,0x5D,0x33,0x33,0xE1,0x32,0x32,0x32,0x10,0xE1,
-  0x32,0x30,0x31,0x21,0x23,0x01,0x15,0x23,0x11,0x07,0x11,0x23,0x11,0x33,0x11,0x37,
-  0x11,0x33,0x15,0x01,0x33,0x01,0x04,0xAE,0xD3,0xFE,0xAE,0x85,0x77,0xBA,0xBA,0x77,
-  0x85,0x01,0x42,0xD1,0xFD,0xF7,0x01,0xF4,0xCD,0x01,0x64,0x62,0xFD,0xD7,0x05,0xB6,
-  0xFD,0x06,0xA4,0x01,0x63,0xB3,0x01,0xA6,0xFD,0x65,0x00,0x01,0x00,0xD7,0x00,0x00,
-  0x04,0x96,0x04,0x4A,0x00,0x12,0x00,0x7F,0x40,0x4B,0x0D,0x0A,0x11,0x49,0x07,0x16,
-  0x12,0x01,0x0C,0x12,0x01,0x12,0x12,0x03,0x0E,0x0B,0x0C,0x0C,0x0F,0xA4,0x0E,0x01,
-  0x7B,0x0E,0x8B,0x0E,0x9B,0x0E,0x03,0x00,0x0E,0x60,0x0E,0x02,0x0E,0x10,0x0E,0x06,
-  0x02,0x47,0x00,0x03,0x60,0x03,0x02,0x03,0x0A,0x07,0x0B,0x0D,0x0B,0x04,0x10,0x00,
-  0x0F,0x01,0x0D,0x0D,0x08,0x3F,0x12,0x01,0x30,0x08,0x01,0x12,0x08,0x12,0x08,0x02,
-  0x04,0x0F,0x0F,0x02,0x15,0x00,0x3F,0x33,0x3F,0x12,0x39,0x39,0x2F,0x2F,0x5D,0x5D,
-  0x12,0x39,0x11,0x33,0x12,0x39,0x39,0x11,0x33,0x11,0x12,0x39,0x39,0x01,0x2F,0x5D,
-  0xE1,0x32,0x2F,0x38,0x5D,0x5D,0x5D,0x33,0x33,0x2F,0x33,0x11,0x12,0x39,0x2F,0x5D,
-  0x5D,0x33,0xE1,0x32,0x32,0x31,0x30,0x01,0x27,0x11,0x23,0x11,0x33,0x11,0x37,0x11,
-  0x33,0x15,0x01,0x33,0x01,0x01,0x23,0x01,0x15,0x23,0x02,0x10,0x85,0xB4,0xB4,0x85,
-  0x7D,0x01,0x04,0xDE,0xFD,0xF1,0x02,0x36,0xE8,0xFE,0xDF,0x7D,0x01,0xA6,0x87,0xFD,
-  0xD3,0x04,0x4A,0xFD,0xEB,0x89,0x01,0x38,0xB9,0x01,0x0D,0xFD,0xF1,0xFD,0xC5,0x01,
-  0x27,0xCD,0x00,0x01,0x00,0x3B,0x00,0x00,0x04,0xAE,0x05,0xB6,0x00,0x14,0x00,0x77,
-  0x40,0x4A,0x0E,0x0E,0x05,0x00,0x14,0x02,0x13,0x10,0x0C,0x04,0x5A,0x09,0x07,0x00,
-  0x05,0x60,0x05,0x70,0x05,0x80,0x05,0x04,0x05,0x48,0x12,0x58,0x12,0x02,0x12,0x13,
-  0x13,0x01,0xD0,0x00,0xF0,0x00,0x02,0x7F,0x00,0x01,0x00,0x00,0x10,0x00,0x40,0x00,
-  0x60,0x00,0x04,0x00,0x10,0x00,0x14,0x10,0x02,0x03,0x0F,0x07,0x5F,0x0C,0x03,0x9F,
-  0x08,0xAF,0x08,0x02,0x08,0x08,0x12,0x0A,0x03,0x05,0x00,0x12,0x00,0x3F,0x32,0x3F,
-  0x33,0x39,0x2F,0x5D,0x39,0x33,0xE1,0x32,0x11,0x33,0x33,0x33,0x01,0x2F,0x38,0x5D,
-  0x5D,0x5D,0x33,0x33,0x2F,0x33,0x5D,0x2F,0x5D,0xC6,0x33,0xE1,0x32,0x32,0x11,0x39,
-  0x39,0x11,0x12,0x39,0x2F,0x31,0x30,0x21,0x23,0x01,0x07,0x11,0x23,0x11,0x23,0x35,
-  0x33,0x35,0x33,0x15,0x33,0x15,0x23,0x11,0x37,0x01,0x33,0x01,0x04,0xAE,0xD3,0xFE,
-  0x3E,0x8C,0xBA,0x98,0x98,0xBA,0xD5,0xD5,0x79,0x01,0xC5,0xD1,0xFD,0xF7,0x02,0xBA,
-  0x72,0xFD,0xB8,0x04,0x60,0xA4,0xB2,0xB2,0xA4,0xFE,0x7B,0xA8,0x02,0x33,0xFD,0x83,
-  0x00,0x01,0x00,0x3B,0x00,0x00,0x04,0x8B,0x06,0x14,0x00,0x16,0x00,0x7A,0x40,0x49,
-  0x76,0x0E,0x96,0x0E,0x02,0x65,0x0E,0x01,0x56,0x0E,0x01,0x45,0x0E,0x01,0x0E,0x11,
-  0x06,0x06,0x0D,0x07,0x03,0x13,0x47,0x16,0x01,0x00,0x14,0x01,0x14,0x0C,0x0D,0x0D,
-  0x10,0x0F,0x20,0x10,0x13,0x48,0x00,0x0F,0x60,0x0F,0x02,0x0F,0x10,0x0F,0x0E,0x11,
-  0x59,0x11,0x01,0x11,0x76,0x09,0x01,0x09,0x12,0x12,0x0C,0x10,0x13,0x15,0x06,0x16,
-  0x4F,0x04,0x01,0x01,0x02,0x0C,0x0F,0x02,0x00,0x00,0x3F,0x3F,0x12,0x39,0x2F,0x33,
-  0xED,0x32,0x3F,0x33,0x12,0x39,0x11,0x33,0x5D,0x33,0x5D,0x11,0x33,0x01,0x2F,0x38,
-  0x5D,0x2B,0x33,0x33,0x2F,0x33,0x2F,0x5D,0x33,0xCE,0xE1,0x32,0x32,0x11,0x39,0x2F,
-  0x39,0x39,0x5D,0x5D,0x5D,0x5D,0x31,0x30,0x13,0x33,0x35,0x33,0x15,0x21,0x15,0x21,
-  0x11,0x03,0x33,0x37,0x01,0x33,0x01,0x01,0x23,0x01,0x07,0x11,0x23,0x11,0x23,0x3B,
-  0x9C,0xB4,0x01,0x7B,0xFE,0x85,0x10,0x04,0x87,0x01,0x8B,0xDE,0xFE,0x12,0x02,0x0A,
-  0xD5,0xFE,0x56,0x81,0xB4,0x9C,0x05,0x5E,0xB6,0xB6,0x89,0xFE,0x75,0xFE,0xDF,0x98,
-  0x01,0x89,0xFE,0x25,0xFD,0x91,0x01,0xF8,0x52,0xFE,0x5A,0x04,0xD5,0x00,0x00,0x01,
-  0x00,0x17,0x00,0x00,0x04,0xAE,0x05,0xB6,0x00,0x0E,0x00,0x5F,0xB5,0x07,0x0E,0x17,
-  0x0E,0x02,0x0E,0xB8,0xFF,0xF8,0x40,0x2E,0x0D,0x12,0x48,0x0E,0x02,0x0D,0x0A,0x04,
-  0x5A,0x05,0x05,0x00,0x07,0x0C,0x0D,0x08,0x0D,0x0D,0x01,0x00,0x10,0x00,0x0E,0x02,
-  0xB8,0x02,0x01,0xA9,0x02,0x01,0x58,0x02,0x01,0x02,0x0A,0x03,0x03,0x05,0x0C,0x07,
-  0x5F,0x08,0x03,0x05,0x00,0x12,0x00,0x3F,0x32,0x3F,0xE1,0x33,0x12,0x39,0x11,0x33,
-  0x33,0x5D,0x5D,0x5D,0x11,0x33,0x01,0x2F,0x38,0x33,0x33,0x2F,0x38,0x33,0x2F,0x12,
-  0x39,0x2F,0xE1,0x32,0x11,0x39,0x39,0x2B,0x71,0x30,0x31,0x21,0x23,0x01,0x07,0x11,
-  0x23,0x11,0x21,0x35,0x21,0x11,0x37,0x01,0x33,0x01,0x04,0xAE,0xCB,0xFE,0xA2,0x89,
-  0xBA,0xFE,0xD5,0x01,0xE5,0x68,0x01,0x75,0xC3,0xFE,0x64,0x02,0xB8,0x99,0xFD,0xE1,
-  0x05,0x12,0xA4,0xFD,0x08,0xAA,0x02,0x4E,0xFD,0x87,0x00,0x01,0x00,0x2B,0x00,0x00,
-  0x04,0xCB,0x04,0x4A,0x00,0x0C,0x00,0x5C,0x40,0x36,0xA7,0x00,0x01,0x96,0x00,0x01,
-  0x00,0x01,0x10,0x01,0x01,0x28,0x04,0x38,0x04,0x02,0x04,0x0E,0x0C,0x0B,0x67,0x02,
-  0x01,0x56,0x02,0x01,0x47,0x02,0x01,0x02,0x06,0x47,0x00,0x07,0x01,0x07,0x07,0x03,
-  0x09,0x03,0x10,0x03,0x05,0x02,0x02,0x07,0x09,0x50,0x00,0x0A,0x0F,0x07,0x03,0x15,
-  0x00,0x3F,0x33,0x3F,0x33,0xE1,0x12,0x39,0x11,0x33,0x01,0x2F,0x38,0x2F,0x12,0x39,
-  0x2F,0x5D,0xE1,0x32,0x5D,0x5D,0x5D,0x32,0x32,0x11,0x33,0x5D,0x33,0x2F,0x38,0x33,
-  0x5D,0x5D,0x30,0x31,0x01,0x33,0x01,0x01,0x23,0x01,0x11,0x23,0x11,0x21,0x35,0x21,
-  0x11,0x03,0xDF,0xC5,0xFE,0x60,0x01,0xC7,0xCF,0xFE,0x4C,0xB5,0xFE,0x98,0x02,0x1D,
-  0x04,0x4A,0xFD,0xF1,0xFD,0xC5,0x02,0x2D,0xFD,0xD3,0x03,0xB0,0x9A,0xFD,0xEB,0x00,
-  0x00,0x01,0x00,0x87,0xFE,0x7F,0x04,0xBA,0x05,0xB6,0x00,0x0F,0x00,0x4E,0x40,0x2F,
-  0x0C,0x08,0x5A,0x00,0x09,0x01,0x00,0x09,0x10,0x09,0xF0,0x09,0x03,0x08,0x09,0x0D,
-  0x05,0x5A,0x9F,0x00,0xAF,0x00,0x02,0x00,0x04,0xFB,0x7F,0x01,0xCF,0x01,0x02,0x01,
-  0x06,0x5F,0x0C,0x0C,0x08,0x0E,0x0A,0x03,0x05,0x08,0x03,0x03,0x00,0x08,0x12,0x00,
-  0x3F,0xC0,0x33,0x2F,0x11,0x33,0x3F,0x33,0x12,0x39,0x2F,0xE1,0x01,0x2F,0x5D,0xE1,
-  0xDD,0x5D,0xE1,0x32,0x2F,0x5E,0x5D,0x71,0xE1,0x32,0x30,0x31,0x25,0x33,0x11,0x23,
-  0x11,0x23,0x11,0x21,0x11,0x23,0x11,0x33,0x11,0x21,0x11,0x33,0x04,0x0A,0xB0,0xB0,
-  0xBA,0xFD,0xF2,0xBB,0xBB,0x02,0x0E,0xBA,0xA6,0xFD,0xD9,0x01,0x81,0x02,0xAA,0xFD,
-  0x56,0x05,0xB6,0xFD,0x98,0x02,0x68,0x00,0x00,0x01,0x00,0xA0,0xFE,0x83,0x04,0x9C,
-  0x04,0x4A,0x00,0x0F,0x00,0x55,0x40,0x35,0x08,0x00,0x47,0x0B,0x0F,0x46,0x0F,0x0C,
-  0x01,0xEF,0x0C,0x01,0xA0,0x0C,0xC0,0x0C,0x02,0x4F,0x0C,0x6F,0x0C,0x02,0x0C,0x07,
-  0x03,0x47,0x00,0x04,0x10,0x04,0x20,0x04,0xD0,0x04,0x04,0x07,0x04,0x01,0x50,0x07,
-  0x07,0x09,0x06,0x0F,0x0B,0x50,0x00,0x00,0x03,0x0E,0x0E,0x03,0x15,0x00,0x3F,0x33,
-  0x2F,0x11,0x33,0x10,0xE1,0x3F,0x33,0x39,0x2F,0xE1,0x01,0x2F,0x5E,0x5D,0xE1,0x32,
-  0x2F,0x5D,0x5D,0x5D,0x71,0xE1,0xDD,0xE1,0x32,0x30,0x31,0x21,0x11,0x21,0x11,0x23,
-  0x11,0x33,0x11,0x21,0x11,0x33,0x11,0x33,0x11,0x23,0x11,0x03,0x46,0xFE,0x10,0xB6,
-  0xB6,0x01,0xF0,0xB6,0xA0,0xB0,0x01,0xE9,0xFE,0x17,0x04,0x4A,0xFE,0x39,0x01,0xC7,
-  0xFC,0x50,0xFD,0xE9,0x01,0x7D,0x00,0x01,0x00,0x87,0x00,0x00,0x04,0xB6,0x05,0xB6,
-  0x00,0x0D,0x00,0x4B,0x40,0x2F,0x09,0x01,0x5A,0x3F,0x00,0x4F,0x00,0xBF,0x00,0x03,
-  0x00,0x40,0x1A,0x1D,0x48,0x00,0x8F,0x0B,0x01,0x0B,0x08,0x04,0x5A,0x00,0x05,0x01,
-  0x00,0x05,0x10,0x05,0xF0,0x05,0x03,0x08,0x05,0x03,0x5F,0x08,0x08,0x00,0x0D,0x0A,
-  0x06,0x03,0x05,0x00,0x12,0x00,0x3F,0x32,0x3F,0x33,0xC0,0x12,0x39,0x2F,0xE1,0x01,
-  0x2F,0x5E,0x5D,0x71,0xE1,0x32,0x2F,0x5D,0xDC,0x2B,0x5D,0xE1,0x32,0x31,0x30,0x21,
-  0x23,0x11,0x21,0x11,0x23,0x11,0x33,0x11,0x21,0x11,0x21,0x15,0x21,0x03,0x9C,0xBB,
-  0xFE,0x61,0xBB,0xBB,0x01,0x9F,0x01,0xD5,0xFE,0xE6,0x02,0xAA,0xFD,0x56,0x05,0xB6,
-  0xFD,0x98,0x02,0x68,0xA4,0x00,0x00,0x01,0x00,0xA0,0x00,0x00,0x04,0xB6,0x04,0x4A,
-  0x00,0x0D,0x00,0x3B,0x40,0x22,0x09,0x01,0x47,0x00,0x4F,0x0B,0x01,0x0B,0x08,0x04,
-  0x47,0x00,0x05,0x10,0x05,0x20,0x05,0xD0,0x05,0x04,0x07,0x05,0x03,0x50,0x08,0x08,
-  0x00,0x0D,0x0A,0x06,0x0F,0x05,0x00,0x15,0x00,0x3F,0x32,0x3F,0x33,0xC0,0x12,0x39,
-  0x2F,0xE1,0x01,0x2F,0x5E,0x5D,0xE1,0x32,0x2F,0x5D,0xDC,0xE1,0x32,0x30,0x31,0x21,
-  0x23,0x11,0x21,0x11,0x23,0x11,0x33,0x11,0x21,0x11,0x21,0x15,0x23,0x03,0xC7,0xB7,
-  0xFE,0x46,0xB6,0xB6,0x01,0xBA,0x01,0xA6,0xEF,0x01,0xE9,0xFE,0x17,0x04,0x4A,0xFE,
-  0x39,0x01,0xC7,0x9A,0x00,0x01,0x00,0x6A,0xFE,0x00,0x04,0x9C,0x05,0xB6,0x00,0x24,
-  0x00,0x44,0x40,0x26,0x10,0x10,0x00,0x1D,0xFB,0x1E,0x1E,0x22,0x17,0xFB,0x08,0x40,
-  0x09,0x0E,0x48,0x08,0x26,0x21,0xFB,0x30,0x22,0x01,0x22,0x1A,0x03,0x03,0x21,0x20,
-  0x5F,0x23,0x03,0x1E,0x21,0x12,0x14,0x5F,0x0D,0x13,0x00,0x3F,0xE1,0x3F,0x33,0x3F,
-  0xE1,0x12,0x39,0x2F,0xC9,0x01,0x2F,0x5D,0xE1,0x10,0xDE,0x2B,0xE1,0x11,0x39,0x2F,
-  0xF1,0x32,0xC0,0x2F,0x31,0x30,0x01,0x36,0x36,0x33,0x32,0x1E,0x02,0x15,0x14,0x0E,
-  0x02,0x23,0x22,0x26,0x27,0x35,0x16,0x16,0x33,0x32,0x36,0x35,0x34,0x26,0x23,0x22,
-  0x07,0x11,0x23,0x11,0x21,0x11,0x23,0x11,0x21,0x02,0xCB,0x12,0x31,0x19,0x62,0x8D,
-  0x5B,0x2B,0x33,0x5E,0x86,0x54,0x36,0x55,0x2B,0x26,0x49,0x2F,0x73,0x64,0x67,0x70,
-  0x33,0x1B,0xA6,0xFE,0xEB,0xA6,0x02,0x61,0x03,0x17,0x05,0x07,0x5C,0xAB,0xF2,0x97,
-  0xAA,0xF8,0xA2,0x4F,0x13,0x14,0xA2,0x10,0x15,0xF7,0xF8,0xF3,0xFD,0x0C,0xFD,0x89,
-  0x05,0x12,0xFA,0xEE,0x05,0xB6,0x00,0x01,0x00,0x7F,0xFE,0x0A,0x04,0x83,0x04,0x4A,
-  0x00,0x29,0x00,0x4E,0x40,0x2C,0x1D,0x15,0x49,0x16,0x03,0x03,0x60,0x16,0x01,0x16,
-  0x16,0x1A,0x0C,0x49,0x0F,0x25,0x1F,0x25,0x02,0x25,0x2B,0x19,0x49,0x00,0x1A,0x01,
-  0x1A,0x11,0x51,0x20,0x20,0x1A,0x18,0x50,0x1B,0x0F,0x16,0x1A,0x15,0x04,0x07,0x51,
-  0x03,0x00,0x00,0x2F,0x32,0xE1,0x32,0x3F,0x33,0x3F,0xE1,0x12,0x39,0x2F,0xE1,0x01,
-  0x2F,0x5D,0xE1,0x10,0xDE,0x5D,0xE1,0x11,0x39,0x2F,0x5D,0x33,0x2F,0x10,0xE1,0x32,
-  0x31,0x30,0x01,0x22,0x26,0x27,0x35,0x16,0x16,0x33,0x32,0x3E,0x02,0x35,0x34,0x2E,
-  0x02,0x23,0x22,0x06,0x07,0x11,0x23,0x11,0x21,0x11,0x23,0x11,0x21,0x11,0x36,0x36,
-  0x33,0x32,0x1E,0x02,0x15,0x14,0x0E,0x02,0x03,0x39,0x3C,0x5C,0x28,0x2A,0x52,0x38,
-  0x32,0x46,0x2C,0x14,0x14,0x2F,0x4C,0x39,0x17,0x2D,0x14,0xA2,0xFE,0xFE,0xA2,0x02,
-  0x46,0x15,0x30,0x17,0x4E,0x83,0x5D,0x34,0x30,0x57,0x79,0xFE,0x0A,0x16,0x15,0xA2,
-  0x16,0x17,0x2F,0x62,0x99,0x6B,0x6B,0x9C,0x66,0x31,0x04,0x06,0xFE,0x2D,0x03,0xB0,
-  0xFC,0x50,0x04,0x4A,0xFE,0x27,0x06,0x06,0x39,0x85,0xDD,0xA5,0x9B,0xD7,0x85,0x3C,
-  0x00,0x02,0x00,0x54,0xFF,0xAC,0x04,0xA2,0x05,0xCD,0x00,0x41,0x00,0x53,0x00,0x6B,
-  0x40,0x3D,0x33,0x12,0x05,0x4F,0x4F,0x00,0x4C,0x5B,0x10,0x38,0x20,0x38,0x02,0x38,
-  0x38,0x1A,0x23,0x22,0x22,0x42,0x5B,0x00,0x00,0x0B,0x0B,0x55,0x2B,0x5B,0x1F,0x1A,
-  0x2F,0x1A,0x02,0x1A,0x47,0x60,0x70,0x3D,0x80,0x3D,0x02,0x3D,0x3D,0x26,0x5F,0x1F,
-  0x04,0x4F,0x33,0x30,0x5F,0x15,0x0B,0x08,0x5F,0x0C,0x0F,0x12,0x05,0x15,0x13,0x00,
-  0x3F,0x33,0x33,0xDC,0x32,0xE1,0x32,0x10,0xE1,0x32,0x32,0x3F,0xF1,0xCA,0x2F,0x5D,
-  0xE1,0x01,0x2F,0x5D,0xE1,0x11,0x33,0x2F,0x33,0x2F,0xE1,0x32,0x2F,0x33,0x11,0x39,
-  0x2F,0x71,0xE1,0x12,0x39,0x11,0x33,0x33,0x33,0x31,0x30,0x01,0x14,0x0E,0x02,0x07,
-  0x16,0x16,0x33,0x32,0x36,0x37,0x15,0x06,0x06,0x23,0x22,0x26,0x27,0x06,0x06,0x23,
-  0x22,0x26,0x26,0x02,0x35,0x34,0x12,0x36,0x36,0x33,0x32,0x16,0x17,0x07,0x26,0x26,
-  0x23,0x22,0x0E,0x02,0x15,0x14,0x1E,0x02,0x33,0x32,0x36,0x37,0x2E,0x03,0x35,0x34,
-  0x3E,0x02,0x33,0x32,0x1E,0x02,0x07,0x34,0x2E,0x02,0x23,0x22,0x0E,0x02,0x15,0x14,
-  0x16,0x17,0x3E,0x03,0x04,0x7B,0x1F,0x36,0x47,0x27,0x17,0x37,0x23,0x1F,0x3B,0x1F,
-  0x1D,0x44,0x20,0x45,0x83,0x3E,0x29,0x55,0x3B,0x7E,0xC4,0x86,0x46,0x45,0x86,0xC4,
-  0x7F,0x32,0x5D,0x26,0x38,0x1C,0x3D,0x22,0x51,0x7C,0x54,0x2A,0x2E,0x58,0x7E,0x50,
-  0x14,0x13,0x10,0x25,0x38,0x26,0x13,0x29,0x50,0x73,0x4A,0x4A,0x73,0x50,0x2A,0xC5,
-  0x0B,0x1B,0x2C,0x20,0x20,0x2C,0x1A,0x0B,0x38,0x30,0x1E,0x2E,0x1F,0x10,0x02,0xBE,
-  0x6A,0xB8,0x97,0x73,0x25,0x0D,0x0A,0x0E,0x0B,0xAA,0x0D,0x0C,0x2C,0x34,0x11,0x0F,
-  0x5F,0xBC,0x01,0x15,0xB7,0xC1,0x01,0x1E,0xBD,0x5E,0x14,0x0F,0x9A,0x0B,0x0E,0x44,
-  0x91,0xE3,0x9E,0x9D,0xDD,0x8B,0x3F,0x03,0x04,0x36,0x75,0x84,0x95,0x56,0x84,0xC0,
-  0x7C,0x3C,0x37,0x76,0xBC,0x8F,0x56,0x84,0x59,0x2D,0x34,0x60,0x88,0x54,0x90,0xE4,
-  0x4F,0x21,0x65,0x7C,0x8B,0x00,0x00,0x02,0x00,0x73,0xFF,0xC5,0x04,0x73,0x04,0x5E,
-  0x00,0x0F,0x00,0x50,0x00,0x89,0x40,0x39,0x48,0x34,0x13,0x05,0x05,0x43,0x57,0x00,
-  0x01,0x00,0x48,0x20,0x39,0x01,0x59,0x39,0x01,0x48,0x39,0x01,0x39,0x39,0x1B,0x24,
-  0x23,0x23,0x08,0x48,0x43,0x4E,0x4E,0x0F,0x43,0x01,0x43,0x52,0x2C,0x48,0x00,0x1B,
-  0x10,0x1B,0x02,0x1B,0x0D,0x4E,0x50,0x3E,0x01,0x90,0x3E,0xA0,0x3E,0xB0,0x3E,0x03,
-  0x3E,0xB8,0xFF,0xC0,0x40,0x17,0x09,0x0C,0x48,0x3E,0x3E,0x31,0x24,0x27,0x50,0x23,
-  0x20,0x10,0x05,0x31,0x50,0x16,0x48,0x4A,0x50,0x10,0x13,0x16,0x16,0x00,0x3F,0x33,
-  0xD4,0xE1,0x32,0x10,0xE1,0x32,0x3F,0x33,0xE1,0x32,0x12,0x39,0x2F,0x2B,0x5D,0x71,
-  0xE1,0x01,0x2F,0x5D,0xE1,0x10,0xCE,0x5D,0x32,0x2F,0x10,0xE1,0x32,0x2F,0x33,0x11,
-  0x39,0x2F,0x5D,0x5D,0x71,0xE1,0x5D,0x12,0x39,0x11,0x33,0x33,0x33,0x31,0x30,0x01,
-  0x14,0x1E,0x02,0x17,0x36,0x36,0x35,0x34,0x2E,0x02,0x23,0x22,0x06,0x01,0x22,0x26,
-  0x27,0x06,0x06,0x23,0x22,0x2E,0x02,0x35,0x34,0x3E,0x02,0x33,0x32,0x16,0x17,0x07,
-  0x26,0x26,0x23,0x22,0x0E,0x02,0x15,0x14,0x1E,0x02,0x33,0x32,0x32,0x37,0x2E,0x03,
-  0x35,0x34,0x3E,0x02,0x33,0x32,0x1E,0x02,0x15,0x14,0x0E,0x02,0x07,0x16,0x33,0x32,
-  0x36,0x37,0x15,0x06,0x06,0x02,0xAC,0x13,0x21,0x2B,0x18,0x39,0x42,0x0D,0x1D,0x2C,
-  0x1F,0x3E,0x3F,0x01,0x52,0x41,0x7C,0x39,0x26,0x53,0x2F,0x6F,0xB6,0x81,0x47,0x43,
-  0x7F,0xB9,0x76,0x39,0x4F,0x20,0x2D,0x19,0x38,0x2A,0x51,0x75,0x4B,0x24,0x27,0x4D,
-  0x73,0x4C,0x0A,0x0A,0x09,0x22,0x34,0x24,0x13,0x30,0x54,0x72,0x41,0x41,0x6E,0x52,
-  0x2E,0x1B,0x30,0x40,0x25,0x27,0x35,0x1A,0x39,0x1C,0x17,0x3F,0x01,0xF4,0x34,0x5B,
-  0x4D,0x40,0x1A,0x2D,0xA0,0x6B,0x33,0x54,0x3A,0x20,0x7A,0xFD,0x68,0x1E,0x25,0x0E,
-  0x0E,0x4C,0x91,0xD1,0x85,0x81,0xD4,0x97,0x53,0x0F,0x0B,0x92,0x08,0x0D,0x38,0x6C,
-  0x9F,0x67,0x61,0x98,0x69,0x38,0x02,0x27,0x50,0x5A,0x67,0x3D,0x5E,0x88,0x59,0x2B,
-  0x27,0x56,0x8A,0x63,0x46,0x77,0x63,0x4F,0x1E,0x13,0x06,0x08,0x93,0x09,0x07,0x00,
-  0xFF,0xFF,0x00,0x81,0xFE,0x42,0x04,0x9C,0x05,0xCB,0x02,0x26,0x00,0x26,0x00,0x00,
-  0x01,0x07,0x03,0x7F,0x00,0x9E,0x00,0x00,0x00,0x0E,0xB7,0x01,0x01,0x76,0x24,0x1E,
-  0x06,0x0B,0x25,0x01,0x2B,0x35,0x00,0x35,0xFF,0xFF,0x00,0xAC,0xFE,0x42,0x04,0x25,
-  0x04,0x5E,0x02,0x26,0x00,0x46,0x00,0x00,0x01,0x06,0x03,0x7F,0x37,0x00,0x00,0x0E,
-  0xB7,0x01,0x01,0x35,0x22,0x1C,0x0F,0x00,0x25,0x01,0x2B,0x35,0x00,0x35,0x00,0x01,
-  0x00,0x66,0xFE,0x7F,0x04,0x64,0x05,0xB6,0x00,0x0B,0x00,0x4A,0x40,0x2C,0x0A,0xFB,
-  0x0B,0x01,0x06,0x06,0x08,0x5A,0x03,0xD0,0x01,0x01,0xA2,0x01,0x01,0x93,0x01,0x01,
-  0x03,0x8E,0x01,0x01,0x04,0x63,0x01,0x01,0x05,0x10,0x01,0x50,0x01,0x02,0x01,0x07,
-  0x03,0x5F,0x04,0x03,0x0B,0x0B,0x08,0x5F,0x01,0x12,0x00,0x3F,0xE1,0x33,0x2F,0x3F,
-  0xE1,0x32,0x01,0x2F,0x5D,0x5F,0x5D,0x5F,0x5D,0x5F,0x5D,0x5D,0x5D,0xC6,0xF1,0xC2,
-  0x2F,0x10,0xDE,0xE1,0x30,0x31,0x21,0x23,0x11,0x21,0x35,0x21,0x15,0x21,0x11,0x33,
-  0x11,0x23,0x02,0xC3,0xBB,0xFE,0x5E,0x03,0xFE,0xFE,0x5F,0xB0,0xB0,0x05,0x12,0xA4,
-  0xA4,0xFB,0x94,0xFD,0xD9,0x00,0x00,0x01,0x00,0x79,0xFE,0x83,0x04,0x52,0x04,0x4A,
-  0x00,0x0B,0x00,0x36,0x40,0x20,0x09,0x47,0x0A,0x00,0x05,0x05,0x07,0x47,0x02,0x10,
-  0x00,0x50,0x00,0x90,0x00,0xA0,0x00,0xD0,0x00,0x05,0x00,0x06,0x02,0x50,0x03,0x0F,
-  0x0A,0x0A,0x07,0x50,0x00,0x15,0x00,0x3F,0xE1,0x33,0x2F,0x3F,0xE1,0x32,0x01,0x2F,
-  0x5D,0xCE,0xF1,0xCA,0x2F,0x10,0xDE,0xE1,0x31,0x30,0x21,0x11,0x21,0x35,0x21,0x15,
-  0x21,0x11,0x33,0x11,0x23,0x11,0x02,0x0A,0xFE,0x6F,0x03,0xD9,0xFE,0x6F,0x9F,0xB6,
-  0x03,0xB0,0x9A,0x9A,0xFC,0xEA,0xFD,0xE9,0x01,0x7D,0xFF,0xFF,0x00,0x21,0x00,0x00,
-  0x04,0xAA,0x05,0xB6,0x02,0x06,0x00,0x3C,0x00,0x00,0x00,0x01,0x00,0x52,0xFE,0x14,
-  0x04,0x79,0x04,0x4A,0x00,0x13,0x00,0x63,0x40,0x3E,0x37,0x04,0x47,0x04,0x02,0x26,
-  0x04,0x01,0x04,0x8D,0x03,0x01,0x03,0x01,0x48,0x11,0x01,0x29,0x11,0x01,0x11,0xCF,
-  0x12,0x01,0x12,0x12,0x0A,0x00,0x47,0xD0,0x01,0x01,0xA0,0x01,0x01,0x93,0x01,0x01,
-  0x03,0x7B,0x01,0x01,0x63,0x01,0x01,0x05,0x10,0x01,0x50,0x01,0x02,0x01,0x13,0x0A,
-  0x02,0x02,0x01,0x11,0x03,0x0F,0x01,0x1B,0x00,0x3F,0x3F,0x33,0x12,0x39,0x11,0x33,
-  0x33,0x01,0x2F,0x5D,0x5F,0x5D,0x5D,0x5F,0x5D,0x5D,0x5D,0xF1,0x39,0xCA,0x2F,0x5D,
-  0x32,0x5D,0x5D,0x10,0xCE,0x5D,0x32,0x5D,0x5D,0x31,0x30,0x01,0x23,0x11,0x01,0x33,
-  0x13,0x1E,0x03,0x17,0x33,0x3E,0x03,0x37,0x13,0x33,0x01,0x02,0xC1,0xB7,0xFE,0x48,
-  0xBE,0xEE,0x0C,0x1F,0x1C,0x18,0x05,0x06,0x06,0x17,0x1D,0x1F,0x0C,0xEF,0xBD,0xFE,
-  0x48,0xFE,0x14,0x01,0xEC,0x04,0x4A,0xFD,0x91,0x20,0x5A,0x5D,0x56,0x1D,0x1D,0x56,
-  0x5D,0x5A,0x20,0x02,0x6F,0xFB,0xB6,0x00,0x00,0x01,0x00,0x21,0x00,0x00,0x04,0xAA,
-  0x05,0xB6,0x00,0x10,0x00,0xCA,0xB9,0x00,0x10,0xFF,0xF8,0x40,0x24,0x0D,0x10,0x48,
-  0x26,0x10,0x36,0x10,0x02,0x17,0x10,0x01,0x68,0x01,0x78,0x01,0x02,0x5A,0x01,0x01,
-  0x48,0x01,0x01,0x29,0x01,0x39,0x01,0x02,0x18,0x01,0x01,0x27,0x00,0xB7,0x00,0x02,
-  0x00,0xB8,0xFF,0xF8,0xB3,0x0D,0x11,0x48,0x10,0xB8,0xFF,0xF8,0x40,0x54,0x14,0x18,
-  0x48,0x10,0xAF,0x0F,0xFF,0x0F,0x02,0x59,0x0F,0x01,0x0F,0x09,0x01,0x08,0x14,0x18,
-  0x48,0x01,0xE0,0x02,0xF0,0x02,0x02,0x7B,0x02,0x01,0x50,0x02,0x01,0x02,0x02,0x08,
-  0x00,0x09,0x08,0x06,0x06,0x04,0x08,0x5A,0x0D,0x0B,0xD0,0x09,0x01,0xA2,0x09,0x01,
-  0x93,0x09,0x01,0x03,0x8E,0x09,0x01,0x04,0x63,0x09,0x01,0x05,0x10,0x09,0x50,0x09,
-  0x02,0x09,0x03,0x00,0x0E,0x0E,0x07,0x0B,0x5F,0x04,0x0C,0x0C,0x01,0x08,0x12,0x0F,
-  0x01,0x03,0x00,0x3F,0x33,0x3F,0x12,0x39,0x2F,0x33,0xE1,0x32,0x33,0x11,0x33,0x33,
-  0x01,0x2F,0x5D,0x5F,0x5D,0x5F,0x5D,0x5F,0x5D,0x5D,0x5D,0xCE,0x33,0xF1,0x32,0xCA,
-  0x2F,0x11,0x12,0x39,0x10,0xC8,0x2F,0x5D,0x5D,0x5D,0x32,0x2B,0x10,0xCC,0x5D,0x5D,
-  0x32,0x2B,0x30,0x31,0x00,0x2B,0x5D,0x01,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x2B,
-  0x01,0x01,0x33,0x01,0x15,0x21,0x15,0x21,0x11,0x23,0x11,0x21,0x35,0x21,0x35,0x01,
-  0x33,0x02,0x64,0x01,0x7D,0xC9,0xFE,0x19,0x01,0x26,0xFE,0xDA,0xBB,0xFE,0xD9,0x01,
-  0x27,0xFE,0x19,0xCB,0x02,0xD3,0x02,0xE3,0xFC,0x83,0x3D,0xA4,0xFE,0xA8,0x01,0x58,
-  0xA4,0x33,0x03,0x87,0x00,0x01,0x00,0x52,0xFE,0x14,0x04,0x79,0x04,0x4A,0x00,0x19,
-  0x00,0x88,0x40,0x0B,0x87,0x0A,0x97,0x0A,0xA7,0x0A,0x03,0x76,0x0A,0x01,0x0A,0xB8,
-  0xFF,0xF8,0x40,0x47,0x0B,0x0F,0x48,0x0A,0x09,0x04,0xA8,0x17,0x01,0x79,0x17,0x01,
-  0x17,0x08,0x0B,0x0F,0x48,0x17,0xCF,0x18,0x01,0x18,0x18,0x03,0x10,0x04,0x19,0x03,
-  0x01,0x01,0x03,0x47,0x08,0x06,0xD0,0x04,0x01,0xA2,0x04,0x01,0x93,0x04,0x01,0x03,
-  0x8E,0x04,0x01,0x04,0x63,0x04,0x01,0x05,0x10,0x04,0x50,0x04,0x02,0x04,0x02,0x06,
-  0x4F,0x19,0x10,0x07,0x07,0x03,0x17,0x09,0x0F,0x03,0x1B,0x00,0x3F,0x3F,0x33,0x12,
-  0x39,0x2F,0x33,0x33,0xE1,0x32,0x01,0x2F,0x5D,0x5F,0x5D,0x5F,0x5D,0x5F,0x5D,0x5D,
-  0x5D,0xCE,0x33,0xF1,0xCA,0x2F,0x11,0x33,0x12,0x39,0x10,0xC8,0x2F,0x5D,0x32,0x2B,
-  0x5D,0x5D,0x10,0xCC,0x32,0x2B,0x5D,0x5D,0x30,0x31,0x21,0x15,0x21,0x11,0x23,0x11,
-  0x21,0x35,0x21,0x01,0x33,0x13,0x1E,0x03,0x17,0x33,0x3E,0x03,0x37,0x13,0x33,0x01,
-  0x03,0xCB,0xFE,0xF6,0xB7,0xFE,0xF6,0x01,0x0A,0xFE,0x48,0xBE,0xEE,0x0C,0x1F,0x1C,
-  0x18,0x05,0x06,0x06,0x17,0x1D,0x1F,0x0C,0xEF,0xBD,0xFE,0x48,0x89,0xFE,0x9D,0x01,
-  0x63,0x89,0x04,0x4A,0xFD,0x91,0x20,0x5A,0x5D,0x56,0x1D,0x1D,0x56,0x5D,0x5A,0x20,
-  0x02,0x6F,0xFB,0xB6,0x00,0x01,0x00,0x35,0xFE,0x7F,0x04,0xBA,0x05,0xB6,0x00,0x0F,
-  0x00,0xA0,0x40,0x15,0x47,0x0F,0x57,0x0F,0xA7,0x0F,0x03,0x0F,0x48,0x09,0x68,0x09,
-  0x78,0x09,0x03,0x09,0x06,0x0C,0x0C,0x0E,0x0B,0xB8,0xFF,0xF8,0x40,0x0E,0x0C,0x0F,
-  0x48,0x06,0x0B,0x16,0x0B,0x26,0x0B,0x03,0x0B,0x0A,0x0A,0x07,0xB8,0xFF,0xF8,0x40,
-  0x40,0x0C,0x0F,0x48,0x06,0x07,0x16,0x07,0x26,0x07,0x03,0x07,0x08,0x0D,0x08,0x0C,
-  0x0F,0x48,0x09,0x0D,0x19,0x0D,0x29,0x0D,0x03,0x0D,0x0E,0x0E,0x01,0x05,0x08,0x0C,
-  0x0F,0x48,0x09,0x05,0x19,0x05,0x29,0x05,0x03,0x05,0x00,0x00,0x04,0xFB,0x01,0x0F,
-  0x0C,0x06,0x09,0x09,0x07,0x0D,0x0A,0x03,0x00,0x5F,0x05,0x05,0x07,0x03,0x03,0x07,
-  0x12,0x00,0x3F,0x33,0x2F,0x11,0x33,0x10,0xE1,0x3F,0x33,0x12,0x39,0x11,0x33,0x33,
-  0x33,0x01,0x2F,0xE1,0x33,0x11,0x33,0x5D,0x2B,0x11,0x33,0x2F,0x33,0x5D,0x2B,0x2F,
-  0x33,0x5D,0x2B,0x33,0x2F,0x33,0x5D,0x2B,0x12,0x39,0x11,0x33,0x33,0x5D,0x33,0x5D,
-  0x30,0x31,0x25,0x33,0x11,0x23,0x11,0x23,0x01,0x01,0x23,0x01,0x01,0x33,0x01,0x01,
-  0x33,0x01,0x04,0x33,0x87,0xB0,0x47,0xFE,0x9D,0xFE,0x92,0xBD,0x01,0xC5,0xFE,0x5A,
-  0xC7,0x01,0x4B,0x01,0x4E,0xBF,0xFE,0x5A,0xA6,0xFD,0xD9,0x01,0x81,0x02,0x7B,0xFD,
-  0x85,0x02,0xFC,0x02,0xBA,0xFD,0xD1,0x02,0x2F,0xFD,0x4C,0x00,0x00,0x01,0x00,0x60,
-  0xFE,0x83,0x04,0x9C,0x04,0x4A,0x00,0x0F,0x00,0xBD,0xB7,0xC4,0x0E,0xD4,0x0E,0xE4,
-  0x0E,0x03,0x0E,0xB8,0xFF,0xF0,0x40,0x24,0x0B,0x0E,0x48,0xCB,0x0C,0xDB,0x0C,0xEB,
-  0x0C,0x03,0x0C,0x10,0x0B,0x0E,0x48,0xCB,0x04,0xDB,0x04,0xEB,0x04,0x03,0x04,0x10,
-  0x0B,0x0E,0x48,0xC4,0x02,0xD4,0x02,0xE4,0x02,0x03,0x06,0x02,0xB8,0xFF,0xF0,0x40,
-  0x14,0x0B,0x0E,0x48,0x49,0x0D,0x01,0x0D,0x10,0x12,0x17,0x48,0x0A,0x0D,0x1A,0x0D,
-  0x02,0x46,0x03,0x01,0x03,0xB8,0xFF,0xF0,0x40,0x33,0x12,0x17,0x48,0x05,0x03,0x15,
-  0x03,0x02,0x0D,0x06,0x00,0x03,0x03,0x05,0x02,0x01,0x01,0x0E,0x1F,0x0F,0x01,0x0F,
-  0x0C,0x07,0x07,0x08,0x04,0x05,0x05,0x0B,0x46,0x08,0x07,0x50,0x0C,0x0C,0x0E,0x0D,
-  0x06,0x03,0x00,0x00,0x01,0x0E,0x0A,0x0A,0x0E,0x15,0x04,0x01,0x0F,0x00,0x3F,0x33,
-  0x3F,0x33,0x2F,0x11,0x12,0x39,0x11,0x33,0x33,0x33,0x11,0x33,0x10,0xE1,0x01,0x2F,
-  0xE1,0x33,0x2F,0x33,0x11,0x33,0x11,0x33,0x2F,0x5D,0x33,0x33,0x2F,0x33,0x12,0x39,
-  0x11,0x33,0x33,0x33,0x30,0x31,0x00,0x5D,0x2B,0x5D,0x5D,0x2B,0x5D,0x01,0x2B,0x5F,
-  0x5D,0x2B,0x5D,0x2B,0x5D,0x2B,0x5D,0x01,0x01,0x33,0x01,0x01,0x33,0x01,0x01,0x33,
-  0x11,0x23,0x11,0x23,0x01,0x01,0x23,0x01,0xFE,0xFE,0x77,0xCF,0x01,0x22,0x01,0x23,
-  0xCF,0xFE,0x75,0x01,0x2D,0xA2,0xB0,0x50,0xFE,0xCA,0xFE,0xC9,0xCF,0x02,0x33,0x02,
-  0x17,0xFE,0x66,0x01,0x9A,0xFD,0xE9,0xFE,0x67,0xFD,0xE9,0x01,0x7D,0x01,0xB4,0xFE,
-  0x4C,0x00,0x00,0x01,0x00,0x17,0xFE,0x7F,0x04,0xBA,0x05,0xB6,0x00,0x0F,0x00,0x39,
-  0x40,0x1F,0x00,0x0E,0x30,0x0E,0x02,0x0E,0x0E,0x0F,0x5A,0x0B,0x0A,0x01,0x5A,0x04,
-  0x07,0xFB,0x06,0x0F,0x0A,0x5F,0x02,0x0C,0x03,0x04,0x00,0x5F,0x09,0x07,0x07,0x09,
-  0x12,0x00,0x3F,0x33,0x2F,0x10,0xE1,0x32,0x3F,0x33,0xE1,0x32,0x01,0x2F,0xE1,0xDD,
-  0xE1,0x2F,0xCD,0xF1,0xC9,0x2F,0x5D,0x30,0x31,0x25,0x21,0x11,0x33,0x11,0x33,0x11,
-  0x23,0x11,0x21,0x11,0x23,0x35,0x21,0x15,0x23,0x01,0xBC,0x01,0x94,0xBA,0xB0,0xB0,
-  0xFC,0xF8,0xEB,0x02,0x91,0xEC,0xA6,0x05,0x10,0xFA,0xF0,0xFD,0xD9,0x01,0x81,0x05,
-  0x12,0xA4,0xA4,0x00,0x00,0x01,0x00,0x14,0xFE,0x83,0x04,0x9C,0x04,0x4A,0x00,0x0F,
-  0x00,0x3F,0x40,0x24,0x0B,0x47,0x0D,0x02,0x46,0xA0,0x0F,0xB0,0x0F,0x02,0x0F,0x40,
-  0x08,0x01,0x01,0x08,0x01,0x08,0x08,0x0A,0x47,0x05,0x03,0x0C,0x04,0x50,0x06,0x0F,
-  0x0E,0x0A,0x50,0x03,0x01,0x01,0x03,0x15,0x00,0x3F,0x33,0x2F,0x10,0xE1,0x32,0x3F,
-  0xE1,0x33,0x01,0x2F,0xCE,0xF1,0xCA,0x2F,0x5D,0x5D,0x2F,0x5D,0xE1,0xDE,0xE1,0x30,
-  0x31,0x01,0x23,0x11,0x21,0x11,0x23,0x35,0x21,0x15,0x23,0x11,0x21,0x11,0x33,0x11,
-  0x33,0x04,0x9C,0xB0,0xFD,0x06,0xDE,0x02,0x79,0xE5,0x01,0x9E,0xB6,0xA0,0xFE,0x83,
-  0x01,0x7D,0x03,0xB0,0x9A,0x9A,0xFC,0xEA,0x03,0xB0,0xFC,0x50,0x00,0x01,0x00,0x87,
-  0xFE,0x7F,0x04,0xBA,0x05,0xB6,0x00,0x19,0x00,0x3D,0x40,0x22,0x0F,0x5A,0x00,0x0C,
-  0x01,0x0C,0x17,0x05,0x5A,0x00,0x03,0xFB,0x7F,0x02,0xCF,0x02,0x02,0x02,0x17,0x14,
-  0x5F,0x06,0x09,0x09,0x18,0x0D,0x03,0x00,0x5F,0x05,0x03,0x03,0x05,0x12,0x00,0x3F,
-  0x33,0x2F,0x10,0xE1,0x3F,0x33,0x39,0x2F,0x33,0xE1,0x32,0x01,0x2F,0x5D,0xE1,0xDD,
-  0xE1,0x32,0x2F,0x5D,0xE1,0x30,0x31,0x25,0x33,0x11,0x23,0x11,0x23,0x11,0x06,0x06,
-  0x23,0x22,0x26,0x35,0x11,0x33,0x11,0x14,0x1E,0x02,0x33,0x32,0x36,0x37,0x11,0x33,
-  0x04,0x0A,0xB0,0xB0,0xBA,0x51,0xA9,0x54,0xBB,0xC0,0xBB,0x14,0x32,0x52,0x3D,0x4D,
-  0x98,0x54,0xBA,0xA6,0xFD,0xD9,0x01,0x81,0x02,0x3F,0x1D,0x26,0xBF,0xB4,0x02,0x47,
-  0xFD,0xD1,0x39,0x57,0x3A,0x1D,0x1F,0x1C,0x02,0xDB,0x00,0x01,0x00,0x98,0xFE,0x83,
-  0x04,0x9C,0x04,0x4A,0x00,0x1B,0x00,0x41,0x40,0x25,0x14,0x01,0x47,0x17,0x1B,0x46,
-  0xA0,0x18,0x01,0x2F,0x18,0x01,0x18,0x0E,0x47,0x00,0x0B,0xC0,0x0B,0x02,0x0B,0x14,
-  0x11,0x50,0x01,0x06,0x06,0x00,0x15,0x0C,0x0F,0x1A,0x1A,0x17,0x50,0x00,0x15,0x00,
-  0x3F,0xE1,0x33,0x2F,0x3F,0x33,0x12,0x39,0x2F,0x33,0xE1,0x32,0x01,0x2F,0x5D,0xE1,
-  0x2F,0x5D,0x5D,0xE1,0xDD,0xE1,0x32,0x30,0x31,0x21,0x11,0x0E,0x03,0x23,0x22,0x2E,
-  0x02,0x35,0x11,0x33,0x11,0x14,0x16,0x33,0x32,0x36,0x37,0x11,0x33,0x11,0x33,0x11,
-  0x23,0x11,0x03,0x46,0x27,0x4E,0x52,0x5A,0x33,0x52,0x81,0x58,0x2F,0xB6,0x69,0x64,
-  0x4E,0x94,0x49,0xB6,0xA0,0xB0,0x01,0xCF,0x19,0x25,0x1A,0x0D,0x2F,0x54,0x73,0x44,
-  0x01,0xA6,0xFE,0x66,0x58,0x56,0x2D,0x2B,0x01,0xF0,0xFC,0x50,0xFD,0xE9,0x01,0x7D,
-  0x00,0x01,0x00,0x87,0x00,0x00,0x04,0x46,0x05,0xB6,0x00,0x1D,0x00,0x51,0xB1,0x18,
-  0x06,0xB8,0x01,0x03,0x40,0x26,0x16,0x07,0x07,0x0C,0x1B,0x01,0x5A,0x00,0x1F,0x0F,
-  0x5A,0x00,0x0C,0x10,0x0C,0x02,0x0C,0x1B,0x18,0x16,0x16,0x14,0x5F,0x09,0x08,0x09,
-  0x07,0x07,0x05,0x02,0x09,0x09,0x01,0x1C,0x0D,0x03,0x01,0x12,0x00,0x3F,0x3F,0x33,
-  0x12,0x39,0x2F,0x33,0x33,0x33,0x2F,0x11,0x33,0x10,0xED,0x32,0x2F,0x32,0x32,0x01,
-  0x2F,0x5D,0xE1,0x10,0xDE,0xE1,0x32,0x11,0x39,0x2F,0x33,0xE1,0x32,0x31,0x30,0x21,
-  0x23,0x11,0x06,0x06,0x07,0x11,0x23,0x11,0x23,0x22,0x26,0x35,0x11,0x33,0x11,0x14,
-  0x1E,0x02,0x33,0x33,0x11,0x33,0x11,0x36,0x36,0x37,0x11,0x33,0x04,0x46,0xBB,0x41,
-  0x6D,0x35,0x85,0x21,0xBB,0xC0,0xBB,0x14,0x32,0x52,0x3D,0x0C,0x85,0x33,0x71,0x3F,
-  0xBB,0x02,0x56,0x19,0x24,0x0B,0xFE,0xC7,0x01,0x27,0xBF,0xB4,0x02,0x47,0xFD,0xD1,
-  0x39,0x57,0x3A,0x1D,0x01,0x58,0xFE,0xB4,0x09,0x24,0x17,0x02,0xC6,0x00,0x00,0x01,
-  0x00,0x98,0x00,0x00,0x04,0x25,0x04,0x4A,0x00,0x1C,0x00,0x5F,0x40,0x37,0x08,0x13,
-  0x49,0x06,0x40,0x14,0x50,0x14,0x70,0x14,0x80,0x14,0x04,0x14,0x14,0x1B,0x0A,0x0E,
-  0x47,0x0D,0x1E,0x01,0x47,0x00,0x1B,0x10,0x1B,0x02,0x1B,0x15,0x16,0x14,0x14,0x12,
-  0x0F,0x04,0x50,0x16,0x16,0x0E,0x0B,0x1C,0x0F,0x0E,0x15,0x0A,0x08,0x05,0x0F,0x06,
-  0x01,0x06,0x06,0x05,0x15,0x00,0x3F,0x33,0x2F,0x5D,0x11,0x33,0x33,0x3F,0x3F,0x33,
-  0x12,0x39,0x2F,0xE1,0x33,0x33,0x33,0x2F,0x11,0x33,0x01,0x2F,0x5D,0xE1,0x10,0xDE,
-  0xE1,0x32,0x11,0x39,0x2F,0x5D,0x33,0xE1,0x32,0x30,0x31,0x01,0x11,0x14,0x16,0x33,
-  0x33,0x11,0x33,0x11,0x36,0x37,0x11,0x33,0x11,0x23,0x11,0x06,0x06,0x07,0x15,0x23,
-  0x35,0x23,0x22,0x2E,0x02,0x35,0x11,0x01,0x4E,0x69,0x64,0x06,0x7D,0x68,0x69,0xB6,
-  0xB6,0x35,0x65,0x37,0x7D,0x2F,0x52,0x81,0x58,0x2F,0x04,0x4A,0xFE,0x66,0x58,0x56,
-  0x01,0x2D,0xFE,0xE3,0x1D,0x46,0x01,0xD5,0xFB,0xB6,0x01,0xE9,0x25,0x33,0x10,0xFE,
-  0xE7,0x2F,0x54,0x73,0x44,0x01,0xA6,0x00,0x00,0x01,0x00,0x87,0x00,0x00,0x04,0x46,
-  0x05,0xB6,0x00,0x13,0x00,0x2B,0x40,0x16,0x0A,0x5A,0x09,0x15,0x02,0x12,0x5A,0x00,
-  0x13,0x01,0x13,0x11,0x0E,0x5F,0x02,0x05,0x05,0x13,0x09,0x12,0x00,0x03,0x00,0x3F,
-  0x3F,0x33,0x39,0x2F,0x33,0xE1,0x32,0x01,0x2F,0x5D,0xE1,0x32,0x10,0xDE,0xE1,0x30,
-  0x31,0x13,0x33,0x11,0x36,0x36,0x33,0x32,0x16,0x15,0x11,0x23,0x11,0x34,0x26,0x23,
-  0x22,0x06,0x07,0x11,0x23,0x87,0xBB,0x6E,0xBC,0x5F,0xB7,0xC4,0xBB,0x64,0x75,0x56,
-  0xAF,0x6B,0xBB,0x05,0xB6,0xFD,0xAA,0x2D,0x2D,0xBC,0xB6,0xFD,0xB8,0x02,0x2F,0x74,
-  0x74,0x28,0x28,0xFD,0x39,0x00,0x00,0x01,0x00,0xA8,0x00,0x00,0x04,0x35,0x04,0x4A,
-  0x00,0x17,0x00,0x3B,0x40,0x24,0x00,0x47,0xB0,0x17,0xC0,0x17,0x02,0x17,0x19,0x0C,
-  0x08,0x47,0x00,0x09,0x10,0x09,0x20,0x09,0xC0,0x09,0xD0,0x09,0x05,0x07,0x09,0x07,
-  0x04,0x50,0x0C,0x11,0x11,0x0A,0x0F,0x09,0x00,0x15,0x00,0x3F,0x32,0x3F,0x39,0x2F,
-  0x33,0xE1,0x32,0x01,0x2F,0x5E,0x5D,0xE1,0x32,0x10,0xDE,0x5D,0xE1,0x30,0x31,0x21,
-  0x11,0x34,0x26,0x23,0x22,0x06,0x07,0x11,0x23,0x11,0x33,0x11,0x3E,0x03,0x33,0x32,
-  0x1E,0x02,0x15,0x11,0x03,0x7F,0x69,0x64,0x5A,0xA6,0x54,0xB6,0xB6,0x2C,0x57,0x5C,
-  0x65,0x39,0x52,0x81,0x58,0x2F,0x01,0x9A,0x58,0x56,0x3A,0x39,0xFE,0x2B,0x04,0x4A,
-  0xFE,0x16,0x1F,0x2F,0x20,0x11,0x2F,0x53,0x73,0x44,0xFE,0x5A,0x00,0x02,0xFF,0xF8,
-  0xFF,0xEC,0x04,0x7B,0x05,0xCD,0x00,0x2D,0x00,0x38,0x00,0x54,0x40,0x2F,0x34,0x5B,
-  0x05,0x12,0x12,0x05,0x3A,0x23,0x86,0x26,0x01,0x67,0x26,0x77,0x26,0x02,0x26,0xFB,
-  0x1F,0x33,0x07,0x5B,0x28,0x1F,0x1C,0x01,0x1C,0x22,0x1F,0x1C,0x07,0x60,0x33,0x22,
-  0x28,0x28,0x00,0x11,0x0C,0x5F,0x12,0x17,0x13,0x2E,0x5F,0x00,0x04,0x00,0x3F,0xE1,
-  0x3F,0x33,0xE1,0x32,0x11,0x39,0x2F,0xCC,0x33,0xE1,0x32,0x01,0x2F,0x33,0xDD,0x5D,
-  0x32,0xE1,0x32,0x10,0xE1,0x5D,0x5D,0x32,0x10,0xCE,0x32,0x2F,0x10,0xE1,0x30,0x31,
-  0x01,0x32,0x16,0x16,0x12,0x15,0x15,0x21,0x1E,0x03,0x33,0x32,0x3E,0x02,0x37,0x15,
-  0x0E,0x03,0x23,0x22,0x2E,0x02,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x33,0x06,0x06,
-  0x15,0x14,0x33,0x33,0x3E,0x03,0x17,0x22,0x0E,0x02,0x07,0x21,0x34,0x2E,0x02,0x02,
-  0xDD,0x7D,0xA0,0x5D,0x24,0xFD,0x60,0x05,0x24,0x4B,0x78,0x5A,0x2F,0x4F,0x47,0x41,
-  0x21,0x21,0x41,0x4C,0x5C,0x3C,0x7E,0xB3,0x76,0x3C,0x08,0x90,0x8F,0x11,0x0B,0x9C,
-  0x06,0x0E,0x66,0x15,0x0B,0x3C,0x6D,0xA2,0x6E,0x40,0x5C,0x3E,0x21,0x05,0x01,0xDF,
-  0x10,0x30,0x57,0x05,0xCD,0x65,0xBD,0xFE,0xF1,0xAA,0x5A,0x7A,0xC2,0x86,0x47,0x0C,
-  0x14,0x1C,0x10,0xAA,0x0F,0x1A,0x12,0x0A,0x5D,0xB1,0xFE,0xA0,0x03,0x72,0x7A,0x2A,
-  0x42,0x17,0x0F,0x3E,0x23,0x61,0x9A,0xF4,0xAB,0x5B,0xA4,0x41,0x7E,0xB9,0x78,0x75,
-  0xB8,0x80,0x43,0x00,0x00,0x02,0xFF,0xD5,0xFF,0xEC,0x04,0x58,0x04,0x5E,0x00,0x2C,
-  0x00,0x35,0x00,0x5E,0x40,0x38,0x31,0x48,0x1E,0x28,0x28,0x1E,0x37,0x0C,0x95,0x0F,
-  0x01,0x66,0x0F,0x76,0x0F,0x86,0x0F,0x03,0x0F,0x49,0x08,0x30,0x1F,0x48,0x13,0x1F,
-  0x05,0x2F,0x05,0x02,0x05,0x0B,0x08,0x40,0x18,0x1B,0x48,0x08,0x05,0x1F,0x50,0x30,
-  0x0B,0x12,0x12,0x22,0x2D,0x50,0x18,0x10,0x27,0x22,0x51,0x28,0x00,0x16,0x00,0x3F,
-  0x32,0xE1,0x32,0x3F,0xE1,0x12,0x39,0x2F,0xCC,0x33,0xE1,0x32,0x01,0x2F,0x2B,0x33,
-  0xDD,0x5D,0x32,0xE1,0x32,0x10,0xE1,0x5D,0x5D,0x32,0x10,0xCE,0x32,0x2F,0x10,0xE1,
-  0x30,0x31,0x05,0x22,0x2E,0x02,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x33,0x06,0x06,
-  0x15,0x14,0x16,0x33,0x33,0x3E,0x03,0x33,0x32,0x1E,0x02,0x15,0x15,0x21,0x16,0x16,
-  0x33,0x32,0x3E,0x02,0x37,0x15,0x0E,0x03,0x03,0x22,0x06,0x07,0x21,0x34,0x2E,0x02,
-  0x02,0xD7,0x6C,0xB2,0x83,0x4B,0x04,0x85,0x8D,0x11,0x0A,0x95,0x06,0x0E,0x30,0x32,
-  0x1B,0x0E,0x4B,0x75,0x98,0x5A,0x63,0x9E,0x6E,0x3B,0xFD,0x4C,0x05,0x98,0x98,0x33,
-  0x57,0x50,0x4D,0x27,0x28,0x4D,0x51,0x57,0x60,0x73,0x84,0x0B,0x01,0xEB,0x1B,0x38,
-  0x58,0x14,0x46,0x88,0xC7,0x81,0x02,0x6F,0x72,0x27,0x3F,0x15,0x0E,0x3A,0x22,0x2F,
-  0x31,0x6C,0xAA,0x75,0x3D,0x47,0x81,0xB5,0x6E,0x71,0xC1,0xB6,0x0A,0x13,0x1D,0x12,
-  0xA2,0x13,0x1C,0x12,0x08,0x03,0xDB,0x9C,0x95,0x44,0x71,0x50,0x2C,0x00,0x00,0x02,
-  0xFF,0xF8,0xFE,0x7F,0x04,0x7B,0x05,0xCD,0x00,0x30,0x00,0x3B,0x00,0x67,0x40,0x39,
-  0x18,0xFB,0x19,0x19,0x1F,0x37,0x5B,0x05,0x12,0x12,0x05,0x3D,0x26,0x86,0x29,0x01,
-  0x67,0x29,0x77,0x29,0x02,0x29,0xFB,0x22,0x36,0x07,0x5B,0x2C,0x1F,0x1F,0x01,0x1F,
-  0x25,0x22,0x1F,0x07,0x60,0x36,0x25,0x2B,0x2B,0x00,0x11,0x0C,0x5F,0x17,0x1A,0x17,
-  0x18,0x18,0x12,0x17,0x13,0x31,0x5F,0x00,0x04,0x00,0x3F,0xE1,0x3F,0x33,0x33,0x2F,
-  0x11,0x33,0x10,0xE1,0x32,0x11,0x39,0x2F,0xCC,0x33,0xE1,0x32,0x01,0x2F,0x33,0xDD,
-  0x5D,0x32,0xE1,0x32,0x10,0xE1,0x5D,0x5D,0x32,0x10,0xCE,0x32,0x2F,0x10,0xE1,0x12,
-  0x39,0x2F,0xE1,0x30,0x31,0x01,0x32,0x16,0x16,0x12,0x15,0x15,0x21,0x1E,0x03,0x33,
-  0x32,0x3E,0x02,0x37,0x15,0x0E,0x03,0x07,0x11,0x23,0x11,0x2E,0x03,0x27,0x26,0x26,
-  0x35,0x34,0x36,0x37,0x33,0x06,0x06,0x15,0x14,0x33,0x33,0x3E,0x03,0x17,0x22,0x0E,
-  0x02,0x07,0x21,0x34,0x2E,0x02,0x02,0xDD,0x7D,0xA0,0x5D,0x24,0xFD,0x60,0x05,0x24,
-  0x4B,0x78,0x5A,0x2F,0x4F,0x47,0x41,0x21,0x1E,0x3B,0x43,0x4E,0x31,0xB0,0x5A,0x82,
-  0x56,0x2E,0x06,0x90,0x8F,0x11,0x0B,0x9C,0x06,0x0E,0x66,0x15,0x0B,0x3C,0x6D,0xA2,
-  0x6E,0x40,0x5C,0x3E,0x21,0x05,0x01,0xDF,0x10,0x30,0x57,0x05,0xCD,0x65,0xBD,0xFE,
-  0xF1,0xAA,0x5A,0x7A,0xC2,0x86,0x47,0x0C,0x14,0x1C,0x10,0xAA,0x0E,0x17,0x12,0x0C,
-  0x02,0xFE,0x93,0x01,0x7D,0x17,0x6F,0xAA,0xE2,0x8A,0x03,0x72,0x7A,0x2A,0x42,0x17,
-  0x0F,0x3E,0x23,0x61,0x9A,0xF4,0xAB,0x5B,0xA4,0x41,0x7E,0xB9,0x78,0x75,0xB8,0x80,
-  0x43,0x00,0x00,0x02,0xFF,0xD5,0xFE,0x83,0x04,0x58,0x04,0x5E,0x00,0x2D,0x00,0x36,
-  0x00,0x71,0x40,0x42,0x14,0x46,0x15,0x15,0x1B,0x32,0x48,0x06,0x10,0x10,0x06,0x38,
-  0x22,0x95,0x25,0x01,0x66,0x25,0x76,0x25,0x86,0x25,0x03,0x25,0x49,0x1E,0x31,0x07,
-  0x48,0x29,0x1F,0x1B,0x2F,0x1B,0x02,0x1B,0x21,0x1E,0x40,0x18,0x1B,0x48,0x1E,0x1B,
-  0x07,0x50,0x31,0x21,0x28,0x28,0x00,0x0F,0x0A,0x51,0x13,0x16,0x13,0x14,0x14,0x10,
-  0x13,0x16,0x2E,0x50,0x00,0x10,0x00,0x3F,0xE1,0x3F,0x33,0x33,0x2F,0x11,0x33,0x10,
-  0xE1,0x32,0x11,0x39,0x2F,0xCC,0x33,0xE1,0x32,0x01,0x2F,0x2B,0x33,0xDD,0x5D,0x32,
-  0xE1,0x32,0x10,0xE1,0x5D,0x5D,0x32,0x10,0xCE,0x32,0x2F,0x10,0xE1,0x12,0x39,0x2F,
-  0xE1,0x31,0x30,0x01,0x32,0x1E,0x02,0x15,0x15,0x21,0x16,0x16,0x33,0x32,0x3E,0x02,
-  0x37,0x15,0x06,0x06,0x07,0x11,0x23,0x11,0x2E,0x03,0x27,0x26,0x26,0x35,0x34,0x36,
-  0x37,0x33,0x06,0x06,0x15,0x14,0x16,0x33,0x33,0x3E,0x03,0x17,0x22,0x06,0x07,0x21,
-  0x34,0x2E,0x02,0x02,0xAE,0x63,0x9E,0x6E,0x3B,0xFD,0x4C,0x05,0x98,0x98,0x33,0x57,
-  0x50,0x4D,0x27,0x42,0x85,0x4E,0xB0,0x54,0x88,0x63,0x39,0x03,0x85,0x8D,0x11,0x0A,
-  0x95,0x06,0x0E,0x30,0x32,0x1B,0x0E,0x4B,0x75,0x98,0x56,0x73,0x84,0x0B,0x01,0xEB,
-  0x1B,0x38,0x58,0x04,0x5E,0x47,0x81,0xB5,0x6E,0x71,0xC1,0xB6,0x0A,0x13,0x1D,0x12,
-  0xA2,0x20,0x22,0x05,0xFE,0x95,0x01,0x75,0x11,0x54,0x84,0xB2,0x6F,0x02,0x6F,0x72,
-  0x27,0x3F,0x15,0x0E,0x3A,0x22,0x2F,0x31,0x6C,0xAA,0x75,0x3D,0x97,0x9C,0x95,0x44,
-  0x71,0x50,0x2C,0x00,0xFF,0xFF,0x00,0xE1,0x00,0x00,0x03,0xE9,0x05,0xB6,0x02,0x06,
-  0x00,0x2C,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x04,0xCD,0x07,0x69,0x02,0x26,
-  0x01,0xB0,0x00,0x00,0x01,0x07,0x02,0x36,0x00,0x00,0x01,0x52,0x00,0x13,0x40,0x0B,
-  0x01,0x14,0x05,0x26,0x01,0x00,0x17,0x12,0x11,0x0A,0x25,0x01,0x2B,0x35,0x00,0x2B,
-  0x35,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x04,0xCD,0x06,0x17,0x02,0x26,0x01,0xD0,
-  0x00,0x00,0x01,0x06,0x02,0x36,0x00,0x00,0x00,0x13,0x40,0x0B,0x01,0x14,0x11,0x26,
-  0x01,0x00,0x17,0x12,0x10,0x05,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0x00,0x01,
-  0x00,0x87,0xFE,0x00,0x04,0x58,0x05,0xB6,0x00,0x25,0x00,0x58,0x40,0x31,0x86,0x0B,
-  0x01,0x17,0x0B,0x37,0x0B,0x67,0x0B,0x03,0x77,0x08,0x01,0x09,0x0A,0x0A,0x21,0x5B,
-  0x11,0x27,0x0B,0x08,0x04,0x5A,0x05,0x1B,0x1B,0x00,0x05,0x01,0x05,0x08,0x0B,0x61,
-  0x03,0x00,0x00,0x04,0x09,0x06,0x03,0x1C,0x1F,0x5F,0x1B,0x16,0x16,0x04,0x12,0x00,
-  0x3F,0x33,0x2F,0x33,0xE1,0x32,0x3F,0x33,0x12,0x39,0x2F,0x33,0xE1,0x32,0x01,0x2F,
-  0x5D,0x33,0x2F,0x10,0xE1,0x32,0x32,0x10,0xDE,0xE1,0x33,0x2F,0x33,0x30,0x31,0x00,
-  0x5D,0x01,0x5D,0x5D,0x01,0x22,0x06,0x07,0x11,0x23,0x11,0x33,0x11,0x01,0x33,0x01,
-  0x33,0x32,0x1E,0x02,0x15,0x14,0x0E,0x02,0x23,0x22,0x2E,0x02,0x27,0x35,0x16,0x16,
-  0x33,0x20,0x11,0x34,0x2E,0x02,0x01,0xF0,0x39,0x52,0x23,0xBB,0xBB,0x02,0x35,0xCF,
-  0xFD,0xD1,0x06,0x7F,0xD2,0x97,0x53,0x52,0x92,0xC8,0x77,0x31,0x4E,0x44,0x3C,0x1F,
-  0x3F,0x7E,0x49,0x01,0x76,0x45,0x73,0x98,0x02,0x7D,0x0F,0x0E,0xFD,0xA0,0x05,0xB6,
-  0xFD,0x3C,0x02,0xC4,0xFD,0x58,0x51,0xA1,0xED,0x9C,0xAA,0xF8,0xA2,0x4F,0x06,0x0C,
-  0x13,0x0C,0xA2,0x17,0x18,0x01,0xEF,0x81,0xBA,0x77,0x38,0x00,0x00,0x01,0x00,0xD7,
-  0xFE,0x0A,0x04,0x58,0x04,0x4A,0x00,0x22,0x00,0x55,0x40,0x30,0x22,0x10,0x19,0x21,
-  0x01,0x21,0x22,0x22,0x14,0x48,0x05,0x24,0x20,0x16,0x00,0x36,0x00,0x46,0x00,0x03,
-  0x00,0x1C,0x46,0x1D,0x0D,0x0D,0x00,0x1D,0x01,0x1D,0x20,0x00,0x4E,0x1B,0x19,0x19,
-  0x1D,0x21,0x1E,0x0F,0x0E,0x11,0x51,0x0D,0x0A,0x0A,0x1D,0x15,0x00,0x3F,0x33,0x2F,
-  0x33,0xE1,0x32,0x3F,0x33,0x12,0x39,0x2F,0x33,0xE1,0x32,0x01,0x2F,0x5D,0x33,0x2F,
-  0x10,0xE1,0x32,0x5D,0x32,0x10,0xDE,0xE1,0x33,0x2F,0x33,0x5D,0x38,0x30,0x31,0x01,
-  0x1E,0x03,0x15,0x14,0x0E,0x02,0x23,0x22,0x26,0x27,0x35,0x16,0x16,0x33,0x32,0x36,
-  0x35,0x34,0x2E,0x02,0x23,0x22,0x07,0x11,0x23,0x11,0x33,0x11,0x01,0x33,0x02,0x6A,
-  0x64,0xB4,0x87,0x4F,0x4A,0x81,0xB0,0x66,0x4C,0x69,0x2F,0x2C,0x69,0x42,0x95,0x9D,
-  0x34,0x61,0x89,0x55,0x53,0x4B,0xB4,0xB4,0x01,0xE4,0xD7,0x02,0x62,0x02,0x3D,0x82,
-  0xCF,0x95,0x96,0xD5,0x88,0x40,0x1F,0x1D,0xA1,0x18,0x25,0xC3,0xD2,0x6A,0x98,0x62,
-  0x2E,0x1D,0xFE,0x4C,0x04,0x4A,0xFE,0x06,0x01,0xFA,0x00,0x01,0x00,0x04,0xFE,0x7F,
-  0x04,0xCB,0x05,0xB6,0x00,0x23,0x00,0x4B,0x40,0x2A,0x0C,0x14,0x07,0xFA,0x1D,0x14,
-  0x00,0x22,0x90,0x22,0xA0,0x22,0x03,0x22,0x22,0x05,0x14,0x03,0x5B,0x02,0x01,0x05,
-  0x5A,0x00,0x04,0x01,0x07,0x5F,0x22,0x03,0x15,0x18,0x61,0x14,0x11,0x13,0x03,0x03,
-  0x00,0x5F,0x05,0x12,0x00,0x3F,0xE1,0x33,0x2F,0x3F,0x33,0xE1,0x32,0x3F,0xE1,0x01,
-  0x2F,0x33,0xDD,0xE1,0x10,0xDD,0xE1,0x2F,0x12,0x39,0x2F,0x5D,0x12,0x39,0xE1,0x11,
-  0x39,0x30,0x31,0x25,0x33,0x03,0x23,0x13,0x23,0x11,0x23,0x0E,0x03,0x07,0x0E,0x03,
-  0x23,0x22,0x26,0x27,0x35,0x16,0x16,0x33,0x32,0x3E,0x02,0x37,0x36,0x36,0x12,0x12,
-  0x37,0x21,0x04,0x08,0xC3,0x90,0xD9,0xA6,0xBA,0xEC,0x0E,0x20,0x21,0x22,0x10,0x14,
-  0x35,0x4F,0x6E,0x4E,0x23,0x4A,0x1C,0x16,0x3B,0x20,0x30,0x40,0x2A,0x1A,0x0A,0x0B,
-  0x21,0x27,0x2B,0x16,0x02,0x41,0xA6,0xFD,0xD9,0x01,0x81,0x05,0x12,0x71,0xF4,0xEC,
-  0xD4,0x51,0x67,0xA2,0x6F,0x3B,0x0E,0x0B,0x96,0x0A,0x0F,0x3F,0x62,0x75,0x36,0x39,
-  0xC8,0x01,0x06,0x01,0x3A,0xAA,0x00,0x01,0x00,0x1F,0xFE,0x83,0x04,0xAE,0x04,0x4A,
-  0x00,0x18,0x00,0x3F,0x40,0x21,0x09,0x0F,0x07,0x49,0x14,0x0F,0x17,0x17,0x05,0x0F,
-  0x03,0x47,0x02,0x01,0x05,0x47,0x00,0x04,0x01,0x07,0x50,0x17,0x0F,0x12,0x4F,0x0C,
-  0x16,0x03,0x03,0x00,0x50,0x05,0x15,0x00,0x3F,0xE1,0x33,0x2F,0x3F,0xE1,0x3F,0xE1,
-  0x01,0x2F,0x33,0xDD,0xE1,0x10,0xDD,0xE1,0x2F,0x12,0x39,0x2F,0x12,0x39,0xE1,0x11,
-  0x39,0x30,0x31,0x25,0x33,0x03,0x23,0x13,0x23,0x11,0x21,0x02,0x02,0x06,0x06,0x23,
-  0x22,0x26,0x27,0x35,0x16,0x33,0x32,0x36,0x36,0x12,0x37,0x21,0x03,0xF8,0xB6,0x7B,
-  0xB6,0x7B,0xB6,0xFE,0xC4,0x14,0x40,0x5F,0x82,0x56,0x1C,0x31,0x0F,0x15,0x1C,0x37,
-  0x59,0x45,0x33,0x12,0x02,0x8E,0x9A,0xFD,0xE9,0x01,0x7D,0x03,0xB0,0xFE,0xFD,0xFE,
-  0x94,0xE6,0x69,0x06,0x06,0x83,0x06,0x75,0xF1,0x01,0x6F,0xFA,0x00,0x01,0x00,0x87,
-  0xFE,0x00,0x04,0x46,0x05,0xB6,0x00,0x1B,0x00,0x4E,0x40,0x2E,0x14,0x0C,0x5A,0x17,
-  0x1D,0x13,0x0F,0x5A,0x10,0x05,0x05,0x10,0x10,0x20,0x10,0x02,0x20,0x10,0x30,0x10,
-  0x02,0x10,0x0E,0x5F,0x98,0x13,0x01,0x0F,0x13,0x2F,0x13,0x02,0x06,0x13,0x13,0x10,
-  0x15,0x11,0x03,0x10,0x12,0x06,0x09,0x5F,0x05,0x00,0x00,0x2F,0x32,0xE1,0x32,0x3F,
-  0x3F,0x33,0x12,0x39,0x2F,0x5E,0x5D,0x5D,0xE1,0x01,0x2F,0x5D,0x71,0x33,0x2F,0x10,
-  0xE1,0x32,0x10,0xDE,0xE1,0x32,0x30,0x31,0x01,0x22,0x2E,0x02,0x27,0x35,0x16,0x16,
-  0x33,0x32,0x36,0x35,0x11,0x21,0x11,0x23,0x11,0x33,0x11,0x21,0x11,0x33,0x11,0x14,
-  0x0E,0x02,0x02,0x58,0x2D,0x47,0x3D,0x36,0x1D,0x38,0x6E,0x3F,0xA4,0xAE,0xFD,0xB7,
-  0xBB,0xBB,0x02,0x49,0xBB,0x4A,0x84,0xB5,0xFE,0x00,0x06,0x0C,0x13,0x0C,0xA2,0x17,
-  0x18,0xF0,0xF7,0x02,0x1F,0xFD,0x56,0x05,0xB6,0xFD,0x98,0x02,0x68,0xFA,0xDD,0xAA,
-  0xF8,0xA2,0x4F,0x00,0x00,0x01,0x00,0xA0,0xFE,0x0A,0x04,0x2D,0x04,0x4A,0x00,0x1B,
-  0x00,0x48,0x40,0x2A,0x14,0x0C,0x47,0xB0,0x17,0xC0,0x17,0x02,0x17,0x1D,0x13,0x0F,
-  0x47,0x10,0x03,0x03,0x00,0x10,0x10,0x10,0x20,0x10,0xD0,0x10,0x04,0x07,0x10,0x0E,
-  0x50,0x13,0x13,0x10,0x15,0x11,0x0F,0x10,0x15,0x04,0x07,0x51,0x03,0x00,0x00,0x2F,
-  0x32,0xE1,0x32,0x3F,0x3F,0x33,0x12,0x39,0x2F,0xE1,0x01,0x2F,0x5E,0x5D,0x33,0x2F,
-  0x10,0xE1,0x32,0x10,0xDE,0x5D,0xE1,0x32,0x30,0x31,0x01,0x22,0x26,0x27,0x35,0x16,
-  0x16,0x33,0x32,0x3E,0x02,0x35,0x11,0x21,0x11,0x23,0x11,0x33,0x11,0x21,0x11,0x33,
-  0x11,0x14,0x0E,0x02,0x02,0x91,0x4B,0x69,0x2F,0x2B,0x6A,0x42,0x3B,0x5B,0x3D,0x1F,
-  0xFD,0xDF,0xB6,0xB6,0x02,0x21,0xB6,0x3F,0x6F,0x97,0xFE,0x0A,0x1F,0x1D,0xA1,0x18,
-  0x25,0x2D,0x61,0x96,0x69,0x01,0xB2,0xFE,0x17,0x04,0x4A,0xFE,0x39,0x01,0xC7,0xFB,
-  0xF3,0x96,0xD5,0x88,0x40,0x00,0x00,0x01,0x00,0x87,0xFE,0x7F,0x04,0xCB,0x05,0xB6,
-  0x00,0x0F,0x00,0x54,0x40,0x31,0x0C,0x08,0x5A,0x10,0x09,0x20,0x09,0x02,0x20,0x09,
-  0x30,0x09,0x02,0x09,0x03,0x5B,0x02,0x01,0x0D,0x05,0x5A,0x00,0x04,0x01,0x06,0x5F,
-  0x98,0x0C,0x01,0x0F,0x0C,0x2F,0x0C,0x02,0x06,0x0C,0x0C,0x09,0x0E,0x0A,0x03,0x00,
-  0x05,0x05,0x09,0x03,0x03,0x09,0x12,0x00,0x3F,0x33,0x2F,0x11,0x33,0x10,0xCD,0x3F,
-  0x33,0x12,0x39,0x2F,0x5E,0x5D,0x5D,0xE1,0x01,0x2F,0x33,0xDD,0xE1,0x32,0x10,0xDD,
-  0xE1,0x2F,0x5D,0x71,0xE1,0x32,0x30,0x31,0x25,0x33,0x03,0x23,0x13,0x23,0x11,0x21,
-  0x11,0x23,0x11,0x33,0x11,0x21,0x11,0x33,0x04,0x08,0xC3,0x90,0xD9,0xA6,0xBA,0xFD,
-  0xF4,0xBB,0xBB,0x02,0x0C,0xBA,0xA6,0xFD,0xD9,0x01,0x81,0x02,0xAA,0xFD,0x56,0x05,
-  0xB6,0xFD,0x98,0x02,0x68,0x00,0x00,0x01,0x00,0xA0,0xFE,0x83,0x04,0xAE,0x04,0x4A,
-  0x00,0x0F,0x00,0x49,0x40,0x29,0x0E,0x47,0x0D,0x0C,0x08,0x00,0x47,0x0B,0x0F,0x0C,
-  0x07,0x03,0x47,0x00,0x04,0x10,0x04,0x20,0x04,0xD0,0x04,0x04,0x07,0x04,0x02,0x50,
-  0x07,0x07,0x04,0x09,0x05,0x0F,0x0B,0x50,0x00,0x00,0x04,0x0E,0x0E,0x04,0x15,0x00,
-  0x3F,0x33,0x2F,0x11,0x33,0x10,0xE1,0x3F,0x33,0x12,0x39,0x2F,0xE1,0x01,0x2F,0x5E,
-  0x5D,0xE1,0x32,0x2F,0x33,0xDD,0xE1,0x32,0x10,0xDD,0xED,0x30,0x31,0x21,0x11,0x21,
-  0x11,0x23,0x11,0x33,0x11,0x21,0x11,0x33,0x11,0x33,0x03,0x23,0x13,0x03,0x42,0xFE,
-  0x14,0xB6,0xB6,0x01,0xEC,0xB6,0xB6,0x7B,0xB6,0x7B,0x01,0xE9,0xFE,0x17,0x04,0x4A,
-  0xFE,0x39,0x01,0xC7,0xFC,0x50,0xFD,0xE9,0x01,0x7D,0x00,0x01,0x00,0x87,0xFE,0x7F,
-  0x04,0x46,0x05,0xB6,0x00,0x1D,0x00,0x3D,0x40,0x20,0x1C,0xFB,0x1B,0x1B,0x16,0x00,
-  0x5A,0x19,0x1F,0x0C,0x5A,0x00,0x09,0x01,0x09,0x01,0x06,0x5F,0x16,0x11,0x11,0x0A,
-  0x1D,0x5F,0x1A,0x1B,0x1B,0x1A,0x12,0x17,0x0A,0x03,0x00,0x3F,0x33,0x3F,0x33,0x2F,
-  0x10,0xE1,0x11,0x39,0x2F,0x33,0xE1,0x32,0x01,0x2F,0x5D,0xE1,0x10,0xDE,0xE1,0x32,
-  0x32,0x2F,0xE1,0x30,0x31,0x25,0x11,0x0E,0x03,0x23,0x22,0x26,0x35,0x11,0x33,0x11,
-  0x14,0x1E,0x02,0x33,0x32,0x3E,0x02,0x37,0x11,0x33,0x11,0x23,0x11,0x23,0x11,0x03,
-  0x8B,0x39,0x65,0x5E,0x5C,0x31,0xBB,0xC0,0xBB,0x14,0x32,0x52,0x3D,0x2D,0x56,0x59,
-  0x60,0x38,0xBB,0xBB,0xB0,0xA6,0x01,0xB0,0x16,0x22,0x16,0x0C,0xBF,0xB4,0x02,0x47,
-  0xFD,0xD1,0x39,0x57,0x3A,0x1D,0x0A,0x14,0x1E,0x14,0x02,0xC6,0xFA,0x4A,0xFE,0x7F,
-  0x02,0x27,0x00,0x01,0x00,0x98,0xFE,0x83,0x04,0x25,0x04,0x4A,0x00,0x1B,0x00,0x4B,
-  0x40,0x2D,0x19,0x46,0x18,0x18,0x13,0x1B,0x47,0xB0,0x16,0x01,0x16,0x1D,0x0D,0x47,
-  0x00,0x0A,0x10,0x0A,0x20,0x0A,0xD0,0x0A,0x04,0x07,0x0A,0x05,0x50,0x0F,0x10,0x1F,
-  0x10,0x02,0x10,0x10,0x0B,0x1A,0x50,0x17,0x18,0x18,0x17,0x15,0x14,0x0B,0x0F,0x00,
-  0x3F,0x33,0x3F,0x33,0x2F,0x10,0xE1,0x11,0x39,0x2F,0x5D,0xE1,0x01,0x2F,0x5E,0x5D,
-  0xE1,0x10,0xDE,0x5D,0xE1,0x32,0x32,0x2F,0xE1,0x30,0x31,0x01,0x0E,0x03,0x23,0x22,
-  0x2E,0x02,0x35,0x11,0x33,0x11,0x14,0x16,0x33,0x32,0x36,0x37,0x11,0x33,0x11,0x23,
-  0x11,0x23,0x11,0x33,0x03,0x6F,0x2C,0x57,0x5C,0x65,0x39,0x52,0x81,0x58,0x2F,0xB6,
-  0x69,0x64,0x59,0xA7,0x54,0xB6,0xA6,0xB0,0xA0,0x01,0xE9,0x1E,0x30,0x20,0x11,0x2F,
-  0x54,0x73,0x44,0x01,0xA6,0xFE,0x66,0x58,0x56,0x3A,0x39,0x01,0xD5,0xFB,0xB6,0xFE,
-  0x83,0x02,0x17,0x00,0x00,0x01,0x00,0x71,0xFE,0x7F,0x04,0xCB,0x05,0xB6,0x00,0x1D,
-  0x00,0xDB,0x40,0x3C,0x1B,0x0E,0x01,0x0A,0x0E,0x01,0xFC,0x0E,0x01,0xED,0x0E,0x01,
-  0xDC,0x0E,0x01,0xB9,0x0E,0xC9,0x0E,0x02,0x8A,0x0E,0x9A,0x0E,0xAA,0x0E,0x03,0x6C,
-  0x0E,0x7C,0x0E,0x02,0x5B,0x0E,0x01,0x3A,0x0E,0x4A,0x0E,0x02,0x19,0x0E,0x29,0x0E,
-  0x02,0x03,0x0B,0x13,0x0B,0x02,0xF1,0x0B,0x01,0xE2,0x0B,0x01,0xD4,0x0B,0x01,0x0B,
-  0xB8,0xFF,0xE8,0x40,0x58,0x11,0x15,0x48,0x63,0x0B,0x73,0x0B,0x02,0x54,0x0B,0x01,
-  0x35,0x0B,0x45,0x0B,0x02,0x16,0x0B,0x26,0x0B,0x02,0x13,0xFB,0x12,0x11,0x1D,0x00,
-  0x0C,0x0C,0x08,0x1B,0x16,0x0A,0x0E,0x01,0x0E,0x15,0xFA,0x0F,0x10,0x01,0xBF,0x10,
-  0xCF,0x10,0xDF,0x10,0x03,0x10,0x11,0x05,0x0B,0x01,0x0B,0x07,0x02,0x08,0xFA,0x00,
-  0x09,0x10,0x09,0x02,0x09,0x10,0x5F,0x15,0x12,0x1C,0x0E,0x02,0x0B,0x03,0x05,0x0C,
-  0x01,0x03,0x0C,0x0D,0x00,0x01,0x01,0x00,0x08,0x13,0x13,0x08,0x12,0x00,0x3F,0x33,
-  0x2F,0x11,0x33,0x5F,0x5D,0x32,0x5F,0x5D,0x3F,0x33,0x33,0x33,0x3F,0xE1,0x01,0x2F,
-  0x5D,0xE1,0x32,0x32,0x32,0x5D,0x2F,0xDD,0x5D,0x71,0xE1,0x32,0x5D,0x32,0x32,0x11,
-  0x39,0x11,0x33,0x33,0x10,0xDD,0xED,0x30,0x31,0x5D,0x5D,0x5D,0x5D,0x2B,0x5D,0x5D,
-  0x5D,0x71,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x71,0x71,0x21,0x01,0x23,
-  0x16,0x17,0x16,0x16,0x15,0x11,0x23,0x11,0x33,0x13,0x33,0x13,0x33,0x11,0x33,0x03,
-  0x23,0x13,0x23,0x11,0x34,0x36,0x37,0x36,0x37,0x23,0x01,0x01,0xFE,0xFE,0xFA,0x08,
-  0x05,0x04,0x04,0x05,0x91,0xED,0xEC,0x06,0xEF,0xF2,0x9A,0xB9,0xB0,0xA6,0x6C,0x04,
-  0x03,0x04,0x03,0x08,0xFE,0xF8,0x05,0x00,0x4A,0x49,0x3F,0x8B,0x39,0xFC,0x96,0x05,
-  0xB6,0xFB,0x58,0x04,0xA8,0xFA,0xF0,0xFD,0xD9,0x01,0x81,0x03,0x77,0x34,0x86,0x3D,
-  0x47,0x49,0xFB,0x02,0x00,0x01,0x00,0x73,0xFE,0x83,0x04,0xAE,0x04,0x4A,0x00,0x24,
-  0x00,0xCC,0x40,0x8C,0xB8,0x24,0xC8,0x24,0xD8,0x24,0x03,0x99,0x24,0xA9,0x24,0x02,
-  0x8A,0x24,0x01,0x69,0x24,0x01,0x5A,0x24,0x01,0x48,0x24,0x01,0x29,0x24,0x39,0x24,
-  0x02,0x1A,0x24,0x01,0x09,0x24,0x01,0xD5,0x18,0x01,0xC6,0x18,0x01,0xA5,0x18,0xB5,
-  0x18,0x02,0x96,0x18,0x01,0x55,0x18,0x65,0x18,0x85,0x18,0x03,0x46,0x18,0x01,0x37,
-  0x18,0x01,0x26,0x18,0x01,0x15,0x18,0x01,0x06,0x18,0x01,0x08,0x0F,0x01,0x08,0x0E,
-  0x01,0x07,0x0D,0x01,0x07,0x0C,0x01,0x03,0x0E,0x0D,0x1E,0x1E,0x06,0x18,0x15,0x49,
-  0x04,0x16,0x14,0x16,0x24,0x16,0x03,0x16,0x04,0x03,0x02,0x24,0x06,0x49,0x01,0x05,
-  0x7B,0x02,0xCB,0x02,0xDB,0x02,0xEB,0x02,0x04,0x02,0x07,0x24,0x24,0x14,0x18,0x0F,
-  0x1E,0x0E,0x0F,0x0E,0x01,0x02,0x0E,0x15,0x04,0x04,0x15,0x15,0x01,0x50,0x06,0x15,
-  0x00,0x3F,0xE1,0x3F,0x33,0x2F,0x11,0x33,0x5F,0x5D,0x11,0x33,0x3F,0x33,0x33,0x11,
-  0x33,0x01,0x2F,0x5D,0x33,0xDD,0xE1,0x32,0x10,0xDD,0xCD,0x2F,0x5D,0xE1,0x32,0x11,
-  0x39,0x11,0x33,0x33,0x30,0x31,0x5F,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,
-  0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x5D,0x01,0x11,
-  0x33,0x03,0x23,0x13,0x23,0x11,0x0E,0x03,0x07,0x03,0x23,0x03,0x2E,0x03,0x27,0x11,
-  0x23,0x11,0x33,0x13,0x1E,0x03,0x17,0x3E,0x03,0x37,0x13,0x04,0x1D,0x91,0x7B,0xA8,
-  0x7B,0x7B,0x04,0x10,0x11,0x11,0x05,0xC7,0x83,0xC4,0x04,0x10,0x12,0x12,0x06,0x91,
-  0xCC,0xC5,0x0A,0x15,0x12,0x0F,0x04,0x05,0x0E,0x11,0x13,0x0A,0xCB,0x04,0x4A,0xFC,
-  0x50,0xFD,0xE9,0x01,0x7D,0x03,0x81,0x15,0x45,0x4A,0x44,0x12,0xFD,0x79,0x02,0x87,
-  0x0E,0x3E,0x49,0x4B,0x1A,0xFC,0x7F,0x04,0x4A,0xFD,0x70,0x22,0x51,0x4B,0x3E,0x10,
-  0x11,0x3D,0x4A,0x4E,0x22,0x02,0x94,0x00,0xFF,0xFF,0x00,0xE1,0x00,0x00,0x03,0xE9,
-  0x05,0xB6,0x02,0x06,0x00,0x2C,0x00,0x00,0xFF,0xFF,0x00,0x21,0x00,0x00,0x04,0xAC,
-  0x07,0x69,0x02,0x26,0x00,0x24,0x00,0x00,0x01,0x07,0x02,0x36,0xFF,0xFF,0x01,0x52,
-  0x00,0x15,0xB4,0x02,0x11,0x05,0x26,0x02,0xB8,0xFF,0xFF,0xB4,0x14,0x0F,0x04,0x07,
-  0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x87,0xFF,0xEC,0x04,0x02,
-  0x06,0x17,0x02,0x26,0x00,0x44,0x00,0x00,0x01,0x06,0x02,0x36,0x04,0x00,0x00,0x13,
-  0x40,0x0B,0x02,0x24,0x11,0x26,0x02,0x25,0x27,0x22,0x08,0x16,0x25,0x01,0x2B,0x35,
-  0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x21,0x00,0x00,0x04,0xAC,0x07,0x2B,0x02,0x26,
-  0x00,0x24,0x00,0x00,0x01,0x07,0x00,0x6A,0x00,0x00,0x01,0x52,0x00,0x19,0xB6,0x03,
-  0x02,0x13,0x05,0x26,0x03,0x02,0xB8,0xFF,0xFF,0xB4,0x15,0x19,0x04,0x07,0x25,0x01,
-  0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0x87,0xFF,0xEC,0x04,0x02,
-  0x05,0xD9,0x02,0x26,0x00,0x44,0x00,0x00,0x01,0x06,0x00,0x6A,0x0C,0x00,0x00,0x17,
-  0x40,0x0D,0x03,0x02,0x26,0x11,0x26,0x03,0x02,0x2D,0x28,0x2C,0x08,0x16,0x25,0x01,
-  0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x04,0xBA,
-  0x05,0xB6,0x02,0x06,0x00,0x88,0x00,0x00,0xFF,0xFF,0x00,0x2D,0xFF,0xEC,0x04,0xA2,
-  0x04,0x5E,0x02,0x06,0x00,0xA8,0x00,0x00,0xFF,0xFF,0x00,0xD9,0x00,0x00,0x04,0x23,
-  0x07,0x69,0x02,0x26,0x00,0x28,0x00,0x00,0x01,0x07,0x02,0x36,0x00,0x17,0x01,0x52,
-  0x00,0x15,0xB4,0x01,0x0E,0x05,0x26,0x01,0xB8,0xFF,0xFF,0xB4,0x11,0x0C,0x01,0x00,
-  0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x85,0xFF,0xEC,0x04,0x48,
-  0x06,0x17,0x02,0x26,0x00,0x48,0x00,0x00,0x01,0x06,0x02,0x36,0x10,0x00,0x00,0x13,
-  0x40,0x0B,0x02,0x19,0x11,0x26,0x02,0x0F,0x1C,0x17,0x0B,0x00,0x25,0x01,0x2B,0x35,
-  0x00,0x2B,0x35,0x00,0x00,0x02,0x00,0x54,0xFF,0xEC,0x04,0x7B,0x05,0xCD,0x00,0x1E,
-  0x00,0x29,0x00,0x3F,0x40,0x24,0x24,0x1A,0x5B,0x0E,0x2B,0x25,0x5B,0x18,0x20,0x03,
-  0x30,0x03,0x02,0x03,0x03,0x1F,0x18,0x2F,0x18,0x02,0x18,0x25,0x5F,0x19,0x19,0x09,
-  0x1F,0x5F,0x13,0x13,0x03,0x00,0x5F,0x04,0x09,0x04,0x00,0x3F,0x33,0xE1,0x32,0x3F,
-  0xE1,0x11,0x39,0x2F,0xE1,0x01,0x2F,0x5D,0x33,0x2F,0x5D,0x10,0xE1,0x10,0xDE,0xE1,
-  0x32,0x30,0x31,0x01,0x22,0x06,0x07,0x35,0x3E,0x03,0x33,0x32,0x16,0x16,0x12,0x15,
-  0x14,0x02,0x06,0x06,0x23,0x22,0x26,0x26,0x02,0x35,0x35,0x21,0x2E,0x03,0x03,0x32,
-  0x3E,0x02,0x37,0x21,0x1E,0x03,0x02,0x23,0x6F,0xB3,0x4F,0x26,0x50,0x5D,0x6F,0x43,
-  0x8D,0xD9,0x93,0x4B,0x49,0x8D,0xD0,0x87,0x89,0xC0,0x7A,0x37,0x03,0x62,0x06,0x37,
-  0x64,0x91,0x30,0x4D,0x7D,0x5A,0x36,0x06,0xFD,0x63,0x02,0x23,0x4B,0x77,0x05,0x29,
-  0x2C,0x20,0xAA,0x0F,0x1A,0x13,0x0A,0x6C,0xC6,0xFE,0xE9,0xAB,0xAE,0xFE,0xEB,0xC2,
-  0x68,0x67,0xC0,0x01,0x11,0xAB,0x52,0x7A,0xC1,0x86,0x47,0xFB,0x66,0x41,0x7E,0xB9,
-  0x78,0x75,0xB8,0x7F,0x44,0x00,0x00,0x02,0x00,0x85,0xFF,0xEC,0x04,0x48,0x04,0x5E,
-  0x00,0x1E,0x00,0x27,0x00,0x49,0x40,0x2B,0x22,0x11,0x48,0x0F,0x05,0x01,0xFF,0x05,
-  0x01,0x05,0x29,0x23,0x48,0x0F,0x19,0x19,0x00,0x0F,0x01,0x00,0x0F,0x10,0x0F,0xF0,
-  0x0F,0x03,0x08,0x0F,0x23,0x50,0x10,0x10,0x00,0x1F,0x50,0x0A,0x16,0x19,0x14,0x51,
-  0x1A,0x00,0x10,0x00,0x3F,0x32,0xE1,0x32,0x3F,0xE1,0x11,0x39,0x2F,0xE1,0x01,0x2F,
-  0x5E,0x5D,0x71,0x33,0x2F,0x10,0xE1,0x10,0xDE,0x5D,0x71,0xE1,0x32,0x31,0x30,0x01,
-  0x32,0x1E,0x02,0x15,0x14,0x0E,0x02,0x23,0x22,0x2E,0x02,0x35,0x35,0x21,0x26,0x26,
-  0x23,0x22,0x0E,0x02,0x07,0x35,0x3E,0x03,0x13,0x32,0x36,0x37,0x21,0x14,0x1E,0x02,
-  0x02,0x2D,0x77,0xC6,0x8F,0x4F,0x48,0x83,0xB8,0x6F,0x6C,0xAD,0x78,0x40,0x03,0x06,
-  0x05,0xAB,0xA8,0x38,0x61,0x59,0x54,0x2C,0x2B,0x53,0x57,0x60,0x64,0x85,0x9C,0x0C,
-  0xFD,0xC3,0x20,0x42,0x67,0x04,0x5E,0x4A,0x8E,0xD2,0x87,0x88,0xD6,0x94,0x4F,0x47,
-  0x81,0xB5,0x6E,0x71,0xC1,0xB5,0x0A,0x13,0x1C,0x12,0x9F,0x14,0x1C,0x13,0x09,0xFC,
-  0x25,0x9C,0x95,0x44,0x71,0x50,0x2C,0x00,0xFF,0xFF,0x00,0x54,0xFF,0xEC,0x04,0x7B,
-  0x07,0x2B,0x02,0x26,0x02,0xE1,0x00,0x00,0x01,0x07,0x00,0x6A,0x00,0x02,0x01,0x52,
-  0x00,0x17,0x40,0x0D,0x03,0x02,0x2E,0x05,0x26,0x03,0x02,0x00,0x30,0x34,0x18,0x0E,
-  0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0x85,0xFF,0xEC,
-  0x04,0x48,0x05,0xD9,0x02,0x26,0x02,0xE2,0x00,0x00,0x01,0x06,0x00,0x6A,0x02,0x00,
-  0x00,0x17,0x40,0x0D,0x03,0x02,0x2C,0x11,0x26,0x03,0x02,0x01,0x2E,0x32,0x0F,0x05,
-  0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,
-  0x04,0xCD,0x07,0x2B,0x02,0x26,0x01,0xB0,0x00,0x00,0x01,0x07,0x00,0x6A,0x00,0x00,
-  0x01,0x52,0x00,0x19,0xB6,0x02,0x01,0x16,0x05,0x26,0x02,0x01,0xB8,0xFF,0xFF,0xB4,
-  0x18,0x1C,0x11,0x0A,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,0xFF,0xFF,
-  0x00,0x00,0x00,0x00,0x04,0xCD,0x05,0xD9,0x02,0x26,0x01,0xD0,0x00,0x00,0x01,0x06,
-  0x00,0x6A,0x00,0x00,0x00,0x19,0xB6,0x02,0x01,0x16,0x11,0x26,0x02,0x01,0xB8,0xFF,
-  0xFF,0xB4,0x18,0x1C,0x10,0x05,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,
-  0xFF,0xFF,0x00,0x8B,0xFF,0xEC,0x04,0x2F,0x07,0x2B,0x02,0x26,0x01,0xB1,0x00,0x00,
-  0x01,0x07,0x00,0x6A,0xFF,0xED,0x01,0x52,0x00,0x19,0xB6,0x02,0x01,0x28,0x05,0x26,
-  0x02,0x01,0xB8,0xFF,0xF6,0xB4,0x2A,0x2E,0x09,0x04,0x25,0x01,0x2B,0x35,0x35,0x00,
-  0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0xC9,0xFF,0xEC,0x04,0x08,0x05,0xD9,0x02,0x26,
-  0x01,0xD1,0x00,0x00,0x01,0x06,0x00,0x6A,0xFD,0x00,0x00,0x19,0xB6,0x02,0x01,0x25,
-  0x11,0x26,0x02,0x01,0xB8,0xFF,0xFA,0xB4,0x27,0x2B,0x08,0x12,0x25,0x01,0x2B,0x35,
-  0x35,0x00,0x2B,0x35,0x35,0x00,0x00,0x01,0x00,0x9E,0xFF,0xEC,0x04,0x42,0x05,0xB6,
-  0x00,0x20,0x00,0x4B,0x40,0x29,0x57,0x00,0x01,0x46,0x00,0x01,0x1C,0x5B,0x20,0x20,
-  0x05,0x00,0x5B,0x1A,0x1A,0x0D,0x16,0x05,0x22,0x1D,0x1D,0x00,0x0D,0x01,0x0D,0x20,
-  0x1D,0x5F,0x1E,0x00,0x61,0x1A,0x1A,0x1E,0x03,0x0E,0x13,0x60,0x0D,0x0A,0x13,0x00,
-  0x3F,0x33,0xE1,0x32,0x3F,0x39,0x2F,0xE1,0x10,0xE1,0x32,0x01,0x2F,0x5D,0x33,0x2F,
-  0x10,0xDE,0xC1,0x11,0x39,0x2F,0xE1,0x11,0x33,0x2F,0xE1,0x30,0x31,0x5D,0x5D,0x01,
-  0x1E,0x03,0x15,0x14,0x0E,0x02,0x23,0x22,0x26,0x27,0x35,0x1E,0x03,0x33,0x32,0x36,
-  0x35,0x34,0x26,0x23,0x23,0x35,0x01,0x21,0x35,0x21,0x15,0x02,0x4A,0x73,0xBA,0x84,
-  0x47,0x43,0x88,0xCD,0x89,0x6E,0xC0,0x55,0x2B,0x60,0x63,0x63,0x2E,0xB2,0xB0,0xCF,
-  0xBA,0x7B,0x01,0xA6,0xFD,0xA6,0x03,0x3D,0x03,0x3B,0x04,0x36,0x64,0x97,0x66,0x60,
-  0xA0,0x74,0x40,0x22,0x2D,0xAA,0x17,0x24,0x18,0x0D,0x94,0x87,0x87,0x81,0x97,0x01,
-  0xD1,0xA6,0x91,0x00,0x00,0x01,0x00,0xAA,0xFE,0x14,0x04,0x3B,0x04,0x4A,0x00,0x24,
-  0x00,0x46,0x40,0x26,0x20,0x4A,0x24,0x24,0x05,0x00,0x4A,0x00,0x1E,0x01,0x1E,0x1E,
-  0x0D,0x18,0x46,0x05,0x26,0x21,0x00,0x0D,0x01,0x0D,0x1F,0x00,0x4E,0x1E,0x1E,0x13,
-  0x21,0x50,0x22,0x0F,0x0E,0x13,0x50,0x0D,0x0A,0x1B,0x00,0x3F,0x33,0xE1,0x32,0x3F,
-  0xE1,0x12,0x39,0x2F,0xE1,0x32,0x01,0x2F,0x5D,0x33,0x10,0xDE,0xE1,0x11,0x39,0x2F,
-  0x5D,0xE1,0x11,0x33,0x2F,0xE1,0x30,0x31,0x01,0x1E,0x03,0x15,0x14,0x0E,0x02,0x23,
-  0x22,0x26,0x27,0x37,0x1E,0x03,0x33,0x32,0x3E,0x02,0x35,0x34,0x2E,0x02,0x23,0x23,
-  0x35,0x01,0x21,0x35,0x21,0x15,0x02,0x48,0x68,0xB6,0x87,0x4E,0x4C,0x8B,0xC6,0x7B,
-  0x7A,0xC1,0x3E,0x02,0x21,0x54,0x62,0x6F,0x3B,0x4D,0x80,0x5C,0x33,0x3B,0x6C,0x97,
-  0x5B,0x77,0x01,0xB6,0xFD,0x96,0x03,0x3D,0x01,0xD5,0x07,0x40,0x72,0xA4,0x6C,0x6E,
-  0xB9,0x86,0x4B,0x24,0x22,0xA6,0x10,0x1F,0x18,0x0F,0x30,0x59,0x7F,0x4E,0x56,0x7B,
-  0x50,0x25,0x7D,0x01,0xED,0x9A,0x85,0x00,0xFF,0xFF,0x00,0x89,0x00,0x00,0x04,0x46,
-  0x06,0xC1,0x02,0x26,0x01,0xB2,0x00,0x00,0x01,0x07,0x01,0x4D,0x00,0x02,0x01,0x52,
-  0x00,0x13,0x40,0x0B,0x01,0x13,0x05,0x26,0x01,0x00,0x11,0x12,0x00,0x08,0x25,0x01,
-  0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xA0,0x00,0x00,0x04,0x2D,0x05,0x6F,
-  0x02,0x26,0x01,0xD2,0x00,0x00,0x01,0x06,0x01,0x4D,0x02,0x00,0x00,0x13,0x40,0x0B,
-  0x01,0x0E,0x11,0x26,0x01,0x01,0x0C,0x0D,0x0A,0x04,0x25,0x01,0x2B,0x35,0x00,0x2B,
-  0x35,0x00,0xFF,0xFF,0x00,0x89,0x00,0x00,0x04,0x46,0x07,0x2B,0x02,0x26,0x01,0xB2,
-  0x00,0x00,0x01,0x07,0x00,0x6A,0x00,0x02,0x01,0x52,0x00,0x17,0x40,0x0D,0x02,0x01,
-  0x15,0x05,0x26,0x02,0x01,0x00,0x17,0x1B,0x00,0x08,0x25,0x01,0x2B,0x35,0x35,0x00,
-  0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0xA0,0x00,0x00,0x04,0x2D,0x05,0xD9,0x02,0x26,
-  0x01,0xD2,0x00,0x00,0x01,0x06,0x00,0x6A,0x02,0x00,0x00,0x17,0x40,0x0D,0x02,0x01,
-  0x10,0x11,0x26,0x02,0x01,0x01,0x12,0x16,0x0A,0x04,0x25,0x01,0x2B,0x35,0x35,0x00,
-  0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0x54,0xFF,0xEC,0x04,0x7B,0x07,0x2B,0x02,0x26,
-  0x00,0x32,0x00,0x00,0x01,0x07,0x00,0x6A,0x00,0x02,0x01,0x52,0x00,0x17,0x40,0x0D,
-  0x03,0x02,0x18,0x05,0x26,0x03,0x02,0x00,0x1A,0x1E,0x02,0x07,0x25,0x01,0x2B,0x35,
-  0x35,0x00,0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0x73,0xFF,0xEC,0x04,0x58,0x05,0xD9,
-  0x02,0x26,0x00,0x52,0x00,0x00,0x01,0x06,0x00,0x6A,0xF9,0x00,0x00,0x19,0xB6,0x03,
-  0x02,0x18,0x11,0x26,0x03,0x02,0xB8,0xFF,0xF9,0xB4,0x1A,0x1E,0x03,0x09,0x25,0x01,
-  0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0x54,0xFF,0xEC,0x04,0x7B,
-  0x05,0xCD,0x02,0x06,0x02,0x7E,0x00,0x00,0xFF,0xFF,0x00,0x73,0xFF,0xEC,0x04,0x58,
-  0x04,0x5E,0x02,0x06,0x02,0x7F,0x00,0x00,0xFF,0xFF,0x00,0x54,0xFF,0xEC,0x04,0x7B,
-  0x07,0x2B,0x02,0x26,0x02,0x7E,0x00,0x00,0x01,0x07,0x00,0x6A,0x00,0x02,0x01,0x52,
-  0x00,0x17,0x40,0x0D,0x04,0x03,0x2E,0x05,0x26,0x04,0x03,0x00,0x30,0x34,0x0A,0x00,
-  0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0x73,0xFF,0xEC,
-  0x04,0x58,0x05,0xD9,0x02,0x26,0x02,0x7F,0x00,0x00,0x01,0x06,0x00,0x6A,0xF9,0x00,
-  0x00,0x19,0xB6,0x04,0x03,0x23,0x11,0x26,0x04,0x03,0xB8,0xFF,0xF9,0xB4,0x25,0x29,
-  0x0A,0x00,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0x44,
-  0xFF,0xEC,0x04,0x4C,0x07,0x2B,0x02,0x26,0x01,0xC7,0x00,0x00,0x01,0x07,0x00,0x6A,
-  0xFF,0x88,0x01,0x52,0x00,0x19,0xB6,0x02,0x01,0x1C,0x05,0x26,0x02,0x01,0xB8,0xFF,
-  0xA6,0xB4,0x1E,0x22,0x01,0x06,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,
-  0xFF,0xFF,0x00,0xB8,0xFF,0xEC,0x04,0x25,0x05,0xD9,0x02,0x26,0x01,0xE7,0x00,0x00,
-  0x01,0x06,0x00,0x6A,0xD0,0x00,0x00,0x19,0xB6,0x02,0x01,0x1B,0x11,0x26,0x02,0x01,
-  0xB8,0xFF,0xC7,0xB4,0x1D,0x21,0x0D,0x12,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,
-  0x35,0x00,0xFF,0xFF,0x00,0x1B,0xFF,0xEC,0x04,0xB0,0x06,0xC1,0x02,0x26,0x01,0xBD,
-  0x00,0x00,0x01,0x07,0x01,0x4D,0x00,0x08,0x01,0x52,0x00,0x13,0x40,0x0B,0x01,0x1A,
-  0x05,0x26,0x01,0x08,0x18,0x19,0x0E,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,
-  0xFF,0xFF,0x00,0x52,0xFE,0x14,0x04,0x79,0x05,0x6F,0x02,0x26,0x00,0x5C,0x00,0x00,
-  0x01,0x06,0x01,0x4D,0x02,0x00,0x00,0x13,0x40,0x0B,0x01,0x19,0x11,0x26,0x01,0x02,
-  0x17,0x18,0x00,0x09,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x1B,
-  0xFF,0xEC,0x04,0xB0,0x07,0x2B,0x02,0x26,0x01,0xBD,0x00,0x00,0x01,0x07,0x00,0x6A,
-  0xFF,0xFF,0x01,0x52,0x00,0x19,0xB6,0x02,0x01,0x1C,0x05,0x26,0x02,0x01,0xB8,0xFF,
-  0xFF,0xB4,0x1E,0x22,0x0E,0x00,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,
-  0xFF,0xFF,0x00,0x52,0xFE,0x14,0x04,0x79,0x05,0xD9,0x02,0x26,0x00,0x5C,0x00,0x00,
-  0x01,0x06,0x00,0x6A,0x08,0x00,0x00,0x17,0x40,0x0D,0x02,0x01,0x1B,0x11,0x26,0x02,
-  0x01,0x08,0x1D,0x21,0x00,0x09,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,
-  0xFF,0xFF,0x00,0x1B,0xFF,0xEC,0x04,0xB0,0x07,0x73,0x02,0x26,0x01,0xBD,0x00,0x00,
-  0x01,0x07,0x01,0x53,0x00,0x52,0x01,0x52,0x00,0x17,0x40,0x0D,0x02,0x01,0x1E,0x05,
-  0x26,0x02,0x01,0x52,0x18,0x23,0x0E,0x00,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,
-  0x35,0x00,0xFF,0xFF,0x00,0x52,0xFE,0x14,0x04,0x79,0x06,0x21,0x02,0x26,0x00,0x5C,
-  0x00,0x00,0x01,0x06,0x01,0x53,0x5E,0x00,0x00,0x17,0x40,0x0D,0x02,0x01,0x1D,0x11,
-  0x26,0x02,0x01,0x5E,0x17,0x22,0x00,0x09,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,
-  0x35,0x00,0xFF,0xFF,0x00,0x87,0x00,0x00,0x04,0x46,0x07,0x2B,0x02,0x26,0x01,0xC1,
-  0x00,0x00,0x01,0x07,0x00,0x6A,0x00,0x02,0x01,0x52,0x00,0x17,0x40,0x0D,0x02,0x01,
-  0x15,0x05,0x26,0x02,0x01,0x01,0x17,0x1B,0x06,0x00,0x25,0x01,0x2B,0x35,0x35,0x00,
-  0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0x98,0x00,0x00,0x04,0x25,0x05,0xD9,0x02,0x26,
-  0x01,0xE1,0x00,0x00,0x01,0x06,0x00,0x6A,0xFB,0x00,0x00,0x17,0x40,0x0D,0x02,0x01,
-  0x15,0x11,0x26,0x02,0x01,0x02,0x17,0x1B,0x0F,0x07,0x25,0x01,0x2B,0x35,0x35,0x00,
-  0x2B,0x35,0x35,0x00,0x00,0x01,0x01,0x2B,0xFE,0x7F,0x04,0x64,0x05,0xB6,0x00,0x09,
-  0x00,0x38,0x40,0x23,0x00,0x0B,0x05,0xFB,0x06,0x06,0x03,0x5A,0x00,0x08,0x01,0x00,
-  0x08,0x20,0x08,0x30,0x08,0x90,0x08,0xA0,0x08,0xF0,0x08,0x06,0x08,0x02,0x5F,0x09,
-  0x03,0x05,0x05,0x03,0x5F,0x08,0x12,0x00,0x3F,0xE1,0x33,0x2F,0x3F,0xE1,0x01,0x2F,
-  0x5D,0x71,0xE1,0x32,0x2F,0xE1,0x10,0xCE,0x31,0x30,0x01,0x15,0x21,0x11,0x33,0x11,
-  0x23,0x11,0x23,0x11,0x04,0x64,0xFD,0x81,0xB1,0xB1,0xBA,0x05,0xB6,0xA6,0xFB,0x96,
-  0xFD,0xD9,0x01,0x81,0x05,0xB6,0x00,0x01,0x01,0x23,0xFE,0x83,0x04,0x0E,0x04,0x4A,
-  0x00,0x09,0x00,0x2E,0x40,0x1A,0x02,0x0B,0x07,0x46,0x08,0x08,0x05,0x47,0x00,0x00,
-  0x90,0x00,0xA0,0x00,0x03,0x00,0x04,0x50,0x01,0x0F,0x07,0x07,0x05,0x50,0x00,0x15,
-  0x00,0x3F,0xE1,0x33,0x2F,0x3F,0xE1,0x01,0x2F,0x5D,0xE1,0x32,0x2F,0xE1,0x10,0xCE,
-  0x30,0x31,0x21,0x11,0x21,0x15,0x21,0x11,0x33,0x11,0x23,0x11,0x01,0x23,0x02,0xEB,
-  0xFD,0xCB,0xA0,0xB0,0x04,0x4A,0x9A,0xFC,0xEA,0xFD,0xE9,0x01,0x7D,0x00,0xFF,0xFF,
-  0x00,0x60,0x00,0x00,0x04,0x6D,0x07,0x2B,0x02,0x26,0x01,0xC5,0x00,0x00,0x01,0x07,
-  0x00,0x6A,0x00,0x02,0x01,0x52,0x00,0x17,0x40,0x0D,0x04,0x03,0x1A,0x05,0x26,0x04,
-  0x03,0x01,0x1C,0x20,0x00,0x14,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,
-  0xFF,0xFF,0x00,0x71,0x00,0x00,0x04,0x5A,0x05,0xD9,0x02,0x26,0x01,0xE5,0x00,0x00,
-  0x01,0x06,0x00,0x6A,0x02,0x00,0x00,0x17,0x40,0x0D,0x04,0x03,0x19,0x11,0x26,0x04,
-  0x03,0x02,0x1B,0x1F,0x06,0x11,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,
-  0x00,0x01,0x00,0x93,0xFE,0x6D,0x04,0x64,0x05,0xB6,0x00,0x1D,0x00,0x48,0x40,0x26,
-  0x0F,0x04,0x01,0x04,0x04,0x07,0x00,0x1F,0x10,0x09,0xFA,0x17,0x17,0x02,0x07,0x5A,
-  0x1C,0x1A,0x18,0x13,0x06,0x1A,0x5F,0x03,0x1B,0x1B,0x07,0x02,0x5F,0x1D,0x03,0x07,
-  0x5F,0x18,0x12,0x13,0x60,0x0C,0x00,0x2F,0xE1,0x3F,0xE1,0x3F,0xE1,0x12,0x39,0x2F,
-  0x33,0xE1,0x32,0x01,0x2F,0x2F,0xCE,0x33,0xE1,0x32,0x32,0x2F,0xE1,0xCE,0x10,0xCE,
-  0x11,0x39,0x2F,0x5D,0x30,0x31,0x01,0x15,0x21,0x11,0x21,0x15,0x21,0x11,0x33,0x11,
-  0x14,0x06,0x23,0x22,0x26,0x27,0x35,0x16,0x16,0x33,0x32,0x36,0x35,0x35,0x23,0x11,
-  0x23,0x35,0x33,0x11,0x04,0x64,0xFD,0x81,0x01,0x50,0xFE,0xB0,0x9C,0x6E,0x7D,0x27,
-  0x3F,0x15,0x0E,0x3A,0x22,0x2F,0x31,0xBA,0x98,0x98,0x05,0xB6,0xA6,0xFE,0x15,0xA2,
-  0xFE,0x23,0xFE,0xD9,0x84,0x8E,0x11,0x09,0x96,0x07,0x0E,0x31,0x31,0x96,0x02,0x83,
-  0xA2,0x02,0x91,0x00,0x00,0x01,0x00,0x87,0xFE,0x6D,0x04,0x0E,0x04,0x4A,0x00,0x1D,
-  0x00,0x48,0x40,0x25,0x0A,0x0A,0x0D,0x06,0x1F,0x19,0x16,0x0F,0x49,0x1D,0x1D,0x09,
-  0x0D,0x47,0x04,0x02,0x00,0x16,0x19,0x50,0x15,0x12,0x0C,0x02,0x4F,0x09,0x03,0x03,
-  0x0D,0x08,0x50,0x05,0x0F,0x0D,0x51,0x00,0x15,0x00,0x3F,0xE1,0x3F,0xE1,0x12,0x39,
-  0x2F,0x33,0xE1,0x32,0x2F,0x33,0xE1,0x32,0x01,0x2F,0xCE,0x33,0xE1,0x32,0x32,0x2F,
-  0xE1,0xCE,0x2F,0x10,0xCE,0x11,0x39,0x2F,0x30,0x31,0x21,0x11,0x23,0x35,0x33,0x11,
-  0x21,0x15,0x21,0x11,0x21,0x15,0x21,0x11,0x33,0x11,0x14,0x06,0x23,0x22,0x26,0x27,
-  0x35,0x16,0x16,0x33,0x32,0x36,0x35,0x35,0x01,0x23,0x9C,0x9C,0x02,0xEB,0xFD,0xCB,
-  0x01,0x17,0xFE,0xE9,0x9C,0x6E,0x7E,0x26,0x3F,0x16,0x0E,0x3B,0x22,0x2E,0x32,0x01,
-  0xE1,0x89,0x01,0xE0,0x9A,0xFE,0xBA,0x89,0xFE,0xC5,0xFE,0xD9,0x84,0x8E,0x11,0x09,
-  0x96,0x07,0x0E,0x31,0x31,0x96,0xFF,0xFF,0x00,0x35,0xFE,0x6D,0x04,0xCD,0x05,0xB6,
-  0x02,0x26,0x00,0x3B,0x00,0x00,0x01,0x07,0x03,0x80,0x01,0xB4,0x00,0x00,0x00,0x17,
-  0xB6,0x01,0x01,0x00,0x15,0xB0,0x15,0x02,0xB8,0x01,0xB4,0xB4,0x15,0x0C,0x04,0x00,
-  0x25,0x01,0x2B,0x5D,0x35,0x00,0x35,0x00,0xFF,0xFF,0x00,0x60,0xFE,0x6D,0x04,0x77,
-  0x04,0x4A,0x02,0x26,0x00,0x5B,0x00,0x00,0x01,0x07,0x03,0x81,0x01,0x5E,0x00,0x00,
-  0x00,0x1E,0xB5,0x01,0x01,0x50,0x15,0x01,0x15,0xB8,0xFF,0xC0,0xB2,0x09,0x0C,0x36,
-  0xB8,0x01,0x5E,0xB4,0x15,0x0C,0x0B,0x07,0x25,0x01,0x2B,0x2B,0x5D,0x35,0x00,0x35,
-  0x00,0x01,0x00,0x35,0x00,0x00,0x04,0x96,0x05,0xB6,0x00,0x11,0x00,0xA4,0xB9,0x00,
-  0x0B,0xFF,0xF8,0x40,0x17,0x0C,0x0F,0x48,0x06,0x0B,0x16,0x0B,0x26,0x0B,0x03,0x0D,
-  0x08,0x0C,0x0F,0x48,0x09,0x0D,0x19,0x0D,0x29,0x0D,0x03,0x04,0xB8,0xFF,0xF8,0x40,
-  0x20,0x0C,0x0F,0x48,0x06,0x04,0x16,0x04,0x26,0x04,0x03,0x02,0x08,0x0C,0x0F,0x48,
-  0x09,0x02,0x19,0x02,0x29,0x02,0x03,0x0F,0x09,0x06,0x03,0x00,0x0C,0x0C,0x0E,0x0B,
-  0x0A,0xB8,0xFF,0xF0,0x40,0x0A,0x0A,0x0A,0x05,0x07,0x11,0x07,0x11,0x01,0x04,0x05,
-  0xB8,0xFF,0xF0,0x40,0x19,0x05,0x0D,0x0E,0x10,0x0E,0x0E,0x02,0x01,0x10,0x01,0x03,
-  0x00,0x07,0x5F,0x0F,0x0C,0x08,0x08,0x01,0x0D,0x0A,0x03,0x05,0x01,0x12,0x00,0x3F,
-  0x33,0x3F,0x33,0x12,0x39,0x2F,0x33,0x33,0xE1,0x32,0x32,0x01,0x2F,0x38,0x33,0x33,
-  0x2F,0x38,0x33,0x2F,0x38,0x33,0x12,0x39,0x39,0x2F,0x2F,0x11,0x33,0x2F,0x38,0x33,
-  0x12,0x39,0x11,0x33,0x33,0x33,0x33,0x33,0x5D,0x2B,0x5D,0x2B,0x5D,0x2B,0x5D,0x2B,
-  0x30,0x31,0x01,0x01,0x23,0x01,0x01,0x23,0x01,0x21,0x35,0x21,0x01,0x33,0x01,0x01,
-  0x33,0x01,0x21,0x15,0x02,0xFA,0x01,0x9C,0xD3,0xFE,0x9D,0xFE,0x92,0xBD,0x01,0x9A,
-  0xFE,0xDF,0x01,0x15,0xFE,0x91,0xC7,0x01,0x4B,0x01,0x4E,0xBF,0xFE,0x8D,0x01,0x1D,
-  0x02,0xB4,0xFD,0x4C,0x02,0x7B,0xFD,0x85,0x02,0xB4,0xA2,0x02,0x60,0xFD,0xD1,0x02,
-  0x2F,0xFD,0xA0,0xA2,0x00,0x01,0x00,0x60,0x00,0x00,0x04,0x6A,0x04,0x4A,0x00,0x11,
-  0x00,0xC2,0xB7,0xC4,0x0E,0xD4,0x0E,0xE4,0x0E,0x03,0x0E,0xB8,0xFF,0xF0,0x40,0x24,
-  0x0B,0x0E,0x48,0xCB,0x0C,0xDB,0x0C,0xEB,0x0C,0x03,0x0C,0x10,0x0B,0x0E,0x48,0xCB,
-  0x05,0xDB,0x05,0xEB,0x05,0x03,0x05,0x10,0x0B,0x0E,0x48,0xC4,0x03,0xD4,0x03,0xE4,
-  0x03,0x03,0x06,0x03,0xB8,0xFF,0xF0,0x40,0x14,0x0B,0x0E,0x48,0x49,0x0D,0x01,0x0D,
-  0x10,0x12,0x17,0x48,0x0A,0x0D,0x1A,0x0D,0x02,0x46,0x04,0x01,0x04,0xB8,0xFF,0xF0,
-  0x40,0x37,0x12,0x17,0x48,0x05,0x04,0x15,0x04,0x02,0x11,0x09,0x11,0x09,0x0F,0x0B,
-  0x10,0x0D,0x0A,0x07,0x01,0x04,0x04,0x06,0x03,0x02,0x02,0x0E,0x1F,0x0F,0x01,0x0F,
-  0x05,0x06,0x06,0x0C,0x00,0x0B,0x10,0x0B,0x02,0x0B,0x0D,0x0A,0x11,0x4F,0x07,0x04,
-  0x00,0x00,0x02,0x0F,0x0B,0x15,0x05,0x02,0x0F,0x00,0x3F,0x33,0x3F,0x33,0x12,0x39,
-  0x2F,0x33,0x33,0xE1,0x32,0x32,0x01,0x2F,0x5D,0x33,0x33,0x2F,0x33,0x2F,0x5D,0x33,
-  0x33,0x2F,0x33,0x12,0x39,0x11,0x33,0x33,0x33,0x33,0x33,0x11,0x12,0x39,0x39,0x2F,
-  0x2F,0x30,0x31,0x00,0x5D,0x2B,0x5D,0x5D,0x2B,0x5D,0x01,0x2B,0x5F,0x5D,0x2B,0x5D,
-  0x2B,0x5D,0x2B,0x5D,0x13,0x21,0x01,0x33,0x01,0x01,0x33,0x01,0x21,0x15,0x21,0x01,
-  0x23,0x01,0x01,0x23,0x01,0x21,0xA6,0x01,0x29,0xFE,0xA6,0xCF,0x01,0x22,0x01,0x23,
-  0xCF,0xFE,0xA4,0x01,0x2D,0xFE,0xCF,0x01,0x72,0xCE,0xFE,0xCA,0xFE,0xC9,0xCF,0x01,
-  0x73,0xFE,0xD3,0x02,0x7B,0x01,0xCF,0xFE,0x66,0x01,0x9A,0xFE,0x31,0x89,0xFE,0x0E,
-  0x01,0xB4,0xFE,0x4C,0x01,0xF2,0x00,0x02,0x00,0x89,0x00,0x00,0x03,0xF6,0x05,0xB6,
-  0x00,0x0E,0x00,0x19,0x00,0x2A,0x40,0x16,0x06,0x19,0x5A,0x09,0x1B,0x15,0x5B,0x00,
-  0x00,0x01,0x00,0x10,0x5F,0x05,0x05,0x07,0x18,0x60,0x0A,0x12,0x07,0x03,0x00,0x3F,
-  0x3F,0xE1,0x11,0x39,0x2F,0xE1,0x01,0x2F,0x5D,0xE1,0x10,0xDE,0xE1,0x32,0x30,0x31,
-  0x13,0x34,0x3E,0x02,0x33,0x33,0x11,0x33,0x11,0x21,0x22,0x2E,0x02,0x01,0x23,0x22,
-  0x0E,0x02,0x15,0x14,0x16,0x33,0x33,0x89,0x37,0x7F,0xCF,0x98,0x95,0xBB,0xFE,0x95,
-  0x85,0xC2,0x7E,0x3D,0x02,0xB2,0x81,0x5D,0x8A,0x5B,0x2E,0xA3,0xAF,0x9F,0x01,0xAC,
-  0x57,0x98,0x71,0x42,0x02,0x68,0xFA,0x4A,0x3D,0x70,0x9E,0x01,0x5F,0x1B,0x3C,0x61,
-  0x46,0x88,0x84,0x00,0xFF,0xFF,0x00,0x89,0xFF,0xEC,0x04,0x2F,0x06,0x14,0x02,0x06,
-  0x00,0x47,0x00,0x00,0x00,0x02,0x00,0x31,0xFF,0xEC,0x04,0x83,0x05,0xB6,0x00,0x21,
-  0x00,0x30,0x00,0x3D,0x40,0x21,0x09,0x18,0xFB,0x15,0x30,0x30,0x0F,0x20,0xFB,0x0F,
-  0x01,0x3F,0x01,0x02,0x01,0x32,0x28,0x5A,0x0F,0x23,0x5F,0x21,0x14,0x14,0x16,0x03,
-  0x1B,0x09,0x2B,0x60,0x06,0x0C,0x13,0x00,0x3F,0x33,0xE1,0x32,0x32,0x3F,0x39,0x2F,
-  0x33,0xE1,0x01,0x2F,0xE1,0x10,0xDE,0x5D,0xE1,0x11,0x39,0x2F,0x33,0xE1,0x39,0x31,
-  0x30,0x01,0x11,0x14,0x0E,0x02,0x23,0x22,0x26,0x27,0x06,0x06,0x23,0x22,0x26,0x35,
-  0x34,0x3E,0x02,0x33,0x33,0x11,0x33,0x11,0x14,0x16,0x33,0x32,0x3E,0x02,0x35,0x11,
-  0x05,0x23,0x22,0x0E,0x02,0x15,0x14,0x16,0x33,0x32,0x3E,0x02,0x35,0x04,0x83,0x1E,
-  0x43,0x6D,0x4F,0x5C,0x6D,0x22,0x23,0x7A,0x61,0xA5,0xA7,0x31,0x68,0xA1,0x70,0x52,
-  0xAE,0x41,0x44,0x1E,0x2C,0x1D,0x0E,0xFE,0x58,0x50,0x42,0x5E,0x3C,0x1C,0x4E,0x5E,
-  0x30,0x3C,0x23,0x0D,0x03,0x50,0xFE,0x18,0x54,0x8C,0x65,0x37,0x57,0x57,0x4F,0x5D,
-  0xD1,0xD7,0x67,0xA3,0x72,0x3C,0x02,0x68,0xFB,0xB2,0x72,0x67,0x17,0x33,0x53,0x3C,
-  0x01,0xE8,0xA6,0x1E,0x43,0x6B,0x4D,0x80,0x82,0x23,0x3C,0x4F,0x2B,0x00,0x00,0x02,
-  0x00,0x31,0xFF,0xEC,0x04,0x83,0x06,0x14,0x00,0x2C,0x00,0x3D,0x00,0x3E,0x40,0x21,
-  0x0E,0x28,0x46,0x25,0x32,0x32,0x17,0x03,0x46,0x0F,0x06,0x01,0x06,0x3F,0x3B,0x46,
-  0x17,0x1F,0x38,0x50,0x1C,0x10,0x04,0x04,0x26,0x00,0x0E,0x00,0x2D,0x50,0x0B,0x14,
-  0x16,0x00,0x3F,0x33,0xE1,0x32,0x32,0x3F,0x39,0x2F,0x3F,0xE1,0x32,0x01,0x2F,0xE1,
-  0x10,0xDE,0x5D,0xE1,0x11,0x39,0x2F,0x33,0xE1,0x39,0x30,0x31,0x25,0x32,0x36,0x35,
-  0x11,0x33,0x11,0x14,0x0E,0x02,0x23,0x22,0x26,0x27,0x23,0x0E,0x03,0x23,0x22,0x02,
-  0x11,0x34,0x3E,0x02,0x33,0x32,0x16,0x17,0x33,0x26,0x27,0x26,0x26,0x35,0x11,0x33,
-  0x11,0x14,0x1E,0x02,0x21,0x32,0x3E,0x02,0x37,0x35,0x34,0x2E,0x02,0x23,0x22,0x06,
-  0x15,0x14,0x16,0x03,0x58,0x42,0x3B,0xAE,0x22,0x44,0x65,0x43,0x6E,0x81,0x22,0x04,
-  0x13,0x2B,0x3C,0x53,0x3B,0x9A,0x8D,0x2A,0x4D,0x6B,0x41,0x52,0x68,0x1F,0x08,0x02,
-  0x02,0x02,0x02,0xAE,0x09,0x1A,0x32,0xFE,0x55,0x2E,0x3F,0x27,0x13,0x01,0x11,0x27,
-  0x40,0x30,0x53,0x4D,0x4D,0x83,0x7C,0x82,0x01,0x3B,0xFE,0xC1,0x69,0x98,0x62,0x2E,
-  0x63,0x67,0x29,0x4A,0x37,0x20,0x01,0x1E,0x01,0x19,0x8D,0xD6,0x90,0x48,0x4A,0x41,
-  0x22,0x1F,0x1A,0x37,0x10,0x01,0x9F,0xFB,0x92,0x3D,0x6B,0x4E,0x2D,0x2E,0x5E,0x8D,
-  0x5E,0x29,0x65,0x9D,0x6B,0x37,0xD9,0xCD,0xD1,0xCD,0x00,0x01,0x00,0x23,0xFF,0xEC,
-  0x04,0x54,0x05,0xCB,0x00,0x39,0x00,0x50,0x40,0x2A,0x25,0xFB,0x00,0x00,0x1F,0x1A,
-  0xFB,0x0B,0x0B,0x12,0x2D,0xFB,0x0F,0x30,0x01,0x30,0x3B,0x11,0x12,0x06,0x06,0x12,
-  0x1F,0x06,0x61,0x07,0x2E,0x2E,0x07,0x07,0x15,0x2A,0x5F,0x35,0x13,0x12,0x11,0x11,
-  0x0E,0x60,0x15,0x04,0x00,0x3F,0xE1,0x32,0x11,0x33,0x3F,0xE1,0x11,0x39,0x2F,0x33,
-  0x2F,0x10,0xE1,0x39,0x01,0x2F,0x33,0x2F,0x11,0x33,0x10,0xDE,0x5D,0xE1,0x11,0x39,
-  0x2F,0xE1,0x33,0x33,0x2F,0xE1,0x30,0x31,0x01,0x34,0x2E,0x02,0x23,0x23,0x35,0x33,
-  0x32,0x36,0x35,0x34,0x26,0x23,0x22,0x06,0x07,0x27,0x36,0x36,0x33,0x32,0x1E,0x02,
-  0x15,0x14,0x0E,0x02,0x07,0x15,0x1E,0x03,0x15,0x14,0x1E,0x02,0x33,0x32,0x36,0x35,
-  0x11,0x33,0x11,0x14,0x0E,0x02,0x23,0x22,0x2E,0x02,0x01,0xFE,0x10,0x2A,0x48,0x38,
-  0x9C,0x9C,0x53,0x5B,0x58,0x56,0x3C,0x5E,0x35,0x52,0x41,0x97,0x67,0x51,0x79,0x4F,
-  0x27,0x1E,0x38,0x50,0x31,0x39,0x54,0x38,0x1C,0x0E,0x1F,0x2F,0x21,0x42,0x3B,0xAE,
-  0x28,0x4D,0x6D,0x45,0x45,0x70,0x4F,0x2B,0x01,0x87,0x4D,0x6D,0x46,0x21,0x97,0x86,
-  0x7D,0x7C,0x73,0x21,0x29,0x75,0x36,0x39,0x36,0x61,0x85,0x4F,0x49,0x74,0x55,0x3A,
-  0x10,0x06,0x0D,0x33,0x53,0x79,0x54,0x4A,0x67,0x41,0x1D,0x73,0x85,0x01,0xC9,0xFE,
-  0x2D,0x6B,0x98,0x61,0x2D,0x26,0x5E,0x9F,0x00,0x01,0x00,0x2B,0xFF,0xEC,0x04,0x5E,
-  0x04,0x5C,0x00,0x39,0x00,0x47,0x40,0x25,0x25,0x1A,0x46,0x1F,0x00,0x0B,0x0B,0x12,
-  0x2D,0x46,0x0F,0x30,0x01,0x30,0x3B,0x11,0x12,0x06,0x06,0x12,0x1F,0x06,0x50,0x2E,
-  0x07,0x07,0x15,0x2A,0x51,0x35,0x16,0x11,0x0E,0x4E,0x12,0x15,0x10,0x00,0x3F,0x33,
-  0xE1,0x32,0x3F,0xE1,0x11,0x39,0x2F,0xC4,0xE1,0x39,0x01,0x2F,0x33,0x2F,0x11,0x33,
-  0x10,0xDE,0x5D,0xE1,0x11,0x39,0x2F,0x33,0x33,0xE1,0x32,0x30,0x31,0x01,0x2E,0x03,
-  0x23,0x23,0x35,0x33,0x32,0x36,0x35,0x34,0x26,0x23,0x22,0x06,0x07,0x27,0x36,0x36,
-  0x33,0x32,0x1E,0x02,0x15,0x14,0x0E,0x02,0x07,0x15,0x1E,0x03,0x17,0x1E,0x03,0x33,
-  0x32,0x36,0x35,0x11,0x33,0x11,0x14,0x0E,0x02,0x23,0x22,0x2E,0x02,0x02,0x0A,0x03,
-  0x12,0x29,0x46,0x38,0x8B,0x8B,0x53,0x5B,0x4B,0x57,0x42,0x71,0x3F,0x3D,0x41,0x9C,
-  0x65,0x51,0x78,0x4F,0x27,0x1E,0x38,0x50,0x31,0x35,0x51,0x38,0x1F,0x04,0x03,0x0F,
-  0x1D,0x2D,0x21,0x42,0x3B,0xAE,0x28,0x4C,0x6E,0x45,0x45,0x6B,0x4C,0x2B,0x01,0x1B,
-  0x38,0x50,0x33,0x18,0x99,0x56,0x50,0x52,0x4A,0x24,0x20,0x8D,0x24,0x26,0x2A,0x49,
-  0x64,0x39,0x37,0x56,0x40,0x2B,0x0E,0x04,0x06,0x1E,0x38,0x55,0x3D,0x36,0x4B,0x2F,
-  0x15,0x73,0x85,0x01,0x35,0xFE,0xC1,0x6B,0x98,0x61,0x2D,0x1C,0x45,0x75,0x00,0x01,
-  0x00,0x27,0xFE,0x7F,0x04,0x75,0x05,0xCB,0x00,0x31,0x00,0x50,0x40,0x2B,0x01,0x5A,
-  0x2E,0x2E,0x31,0x27,0x0F,0x5B,0x22,0x22,0x31,0xFB,0x00,0x2F,0x50,0x2F,0x02,0x2F,
-  0x17,0x18,0x08,0x08,0x18,0x18,0x17,0x17,0x14,0x60,0x1D,0x27,0x08,0x61,0x09,0x09,
-  0x1D,0x04,0x2E,0x5F,0x01,0x30,0x30,0x01,0x12,0x00,0x3F,0x33,0x2F,0x10,0xE1,0x3F,
-  0x39,0x2F,0xE1,0x39,0x10,0xE1,0x32,0x11,0x33,0x01,0x2F,0x33,0x2F,0x11,0x33,0x2F,
-  0x5D,0xE1,0x32,0x2F,0xE1,0x32,0x11,0x33,0x2F,0xE1,0x31,0x30,0x21,0x23,0x11,0x34,
-  0x2E,0x02,0x23,0x23,0x35,0x33,0x32,0x3E,0x02,0x35,0x34,0x2E,0x02,0x23,0x22,0x06,
-  0x07,0x27,0x3E,0x03,0x33,0x32,0x1E,0x02,0x15,0x14,0x0E,0x02,0x07,0x15,0x1E,0x03,
-  0x15,0x15,0x33,0x11,0x23,0x03,0xC5,0xBB,0x38,0x67,0x95,0x5D,0xBF,0xB0,0x5C,0x8E,
-  0x61,0x32,0x25,0x44,0x5F,0x3A,0x6E,0xA9,0x4B,0x5C,0x26,0x62,0x74,0x83,0x48,0x6D,
-  0xA6,0x70,0x39,0x33,0x5B,0x7D,0x4B,0x57,0x8A,0x5E,0x32,0xB0,0xB0,0x01,0xA0,0x44,
-  0x63,0x41,0x20,0x97,0x27,0x48,0x65,0x3D,0x36,0x53,0x3A,0x1E,0x43,0x36,0x7D,0x1F,
-  0x36,0x29,0x18,0x36,0x61,0x85,0x4F,0x49,0x78,0x58,0x39,0x0C,0x06,0x0B,0x39,0x59,
-  0x77,0x48,0xFA,0xFD,0xD9,0x00,0x00,0x01,0x00,0x50,0xFE,0x83,0x04,0x5C,0x04,0x5E,
-  0x00,0x2F,0x00,0x4E,0x40,0x29,0x24,0x0E,0x46,0x1F,0x1F,0x00,0x47,0x2B,0x2B,0x2F,
-  0x46,0x2C,0x31,0x16,0x17,0x08,0x08,0x17,0x17,0x30,0x16,0x11,0x50,0x1A,0x24,0x07,
-  0x50,0x30,0x08,0x01,0x08,0x08,0x17,0x1A,0x10,0x2D,0x2D,0x2B,0x50,0x00,0x15,0x00,
-  0x3F,0xE1,0x33,0x2F,0x3F,0x33,0x39,0x2F,0x5D,0xE1,0x39,0x10,0xE1,0x32,0x11,0x01,
-  0x33,0x2F,0x33,0x2F,0x11,0x33,0x10,0xDE,0xE1,0x32,0x2F,0xE1,0x33,0x2F,0xE1,0x32,
-  0x30,0x31,0x21,0x11,0x34,0x2E,0x02,0x23,0x23,0x35,0x33,0x32,0x3E,0x02,0x35,0x34,
-  0x26,0x23,0x22,0x0E,0x02,0x07,0x27,0x36,0x36,0x33,0x32,0x1E,0x02,0x15,0x14,0x0E,
-  0x02,0x07,0x15,0x1E,0x03,0x15,0x15,0x33,0x11,0x23,0x11,0x03,0x06,0x1B,0x3E,0x66,
-  0x4B,0xEC,0xCB,0x3E,0x64,0x48,0x27,0x8C,0x83,0x2F,0x52,0x50,0x50,0x2D,0x3F,0x5D,
-  0xC9,0x73,0x63,0xA0,0x71,0x3D,0x1C,0x33,0x47,0x2B,0x36,0x54,0x3A,0x1F,0xA0,0xB0,
-  0x01,0x2B,0x2F,0x49,0x31,0x1A,0x99,0x12,0x27,0x40,0x2D,0x4D,0x4D,0x0A,0x12,0x1B,
-  0x11,0x93,0x27,0x25,0x24,0x48,0x6A,0x46,0x35,0x51,0x3B,0x29,0x0E,0x0B,0x0D,0x2C,
-  0x42,0x5B,0x3E,0x91,0xFD,0xE9,0x01,0x7D,0x00,0x01,0x00,0x00,0xFF,0xEC,0x04,0x83,
-  0x05,0xB6,0x00,0x30,0x00,0x53,0x40,0x2E,0x16,0x0D,0x1B,0xFA,0x01,0x1D,0xFB,0x30,
-  0x06,0x0D,0x00,0x01,0x10,0x01,0x02,0x01,0x30,0x01,0x30,0x0D,0x23,0xFB,0x0F,0x26,
-  0x01,0x26,0x32,0x0D,0x20,0x5F,0x2B,0x13,0x24,0x24,0x11,0x01,0x5F,0x1B,0x03,0x0E,
-  0x0E,0x11,0x60,0x0D,0x0B,0x13,0x00,0x3F,0x33,0xE1,0x32,0x2F,0x3F,0xE1,0x12,0x39,
-  0x2F,0x3F,0xE1,0x01,0x2F,0x10,0xDE,0x5D,0xE1,0x11,0x39,0x39,0x2F,0x2F,0x5D,0x12,
-  0x39,0x10,0xE1,0x10,0xED,0x11,0x39,0x30,0x31,0x01,0x23,0x0E,0x03,0x07,0x0E,0x03,
-  0x23,0x22,0x27,0x35,0x16,0x16,0x33,0x32,0x3E,0x02,0x37,0x36,0x36,0x12,0x12,0x37,
-  0x21,0x11,0x14,0x16,0x33,0x32,0x36,0x35,0x11,0x33,0x11,0x14,0x0E,0x02,0x23,0x22,
-  0x2E,0x02,0x35,0x02,0x2D,0xA4,0x09,0x14,0x15,0x13,0x09,0x0A,0x1B,0x30,0x4E,0x3E,
-  0x33,0x27,0x0E,0x1A,0x11,0x19,0x1F,0x15,0x0E,0x06,0x07,0x13,0x17,0x1A,0x0F,0x01,
-  0xE7,0x3B,0x42,0x44,0x39,0xAE,0x2A,0x4E,0x6D,0x44,0x43,0x6E,0x50,0x2C,0x05,0x12,
-  0x74,0xF5,0xEA,0xD2,0x51,0x67,0xA1,0x6E,0x3A,0x16,0x9A,0x08,0x09,0x3C,0x5D,0x71,
-  0x36,0x3B,0xC4,0x01,0x02,0x01,0x39,0xB1,0xFB,0xD1,0x81,0x77,0x77,0x81,0x01,0xC9,
-  0xFE,0x2D,0x69,0x98,0x62,0x2E,0x2C,0x60,0x99,0x6C,0x00,0x01,0x00,0x00,0xFF,0xEC,
-  0x04,0x83,0x04,0x4A,0x00,0x29,0x00,0x49,0x40,0x28,0x14,0x49,0x01,0x16,0x46,0x29,
-  0x00,0x01,0x10,0x01,0x02,0x01,0x29,0x01,0x29,0x0B,0x1C,0x46,0x0F,0x1F,0x01,0x1F,
-  0x2B,0x0B,0x1D,0x1D,0x0F,0x01,0x50,0x14,0x0F,0x19,0x0C,0x0C,0x0F,0x4F,0x24,0x0B,
-  0x08,0x16,0x00,0x3F,0x33,0x33,0xE1,0x32,0x11,0x33,0x3F,0xE1,0x12,0x39,0x2F,0x01,
-  0x2F,0x10,0xDE,0x5D,0xE1,0x11,0x39,0x39,0x2F,0x2F,0x5D,0x10,0xE1,0x10,0xE1,0x31,
-  0x30,0x01,0x23,0x06,0x02,0x0E,0x03,0x23,0x22,0x26,0x27,0x35,0x16,0x16,0x33,0x32,
-  0x36,0x36,0x12,0x37,0x21,0x11,0x14,0x16,0x33,0x32,0x36,0x35,0x11,0x33,0x11,0x14,
-  0x0E,0x02,0x23,0x22,0x2E,0x02,0x35,0x02,0x2D,0xAE,0x0A,0x1D,0x26,0x30,0x3A,0x45,
-  0x29,0x1A,0x31,0x0F,0x08,0x11,0x08,0x25,0x3D,0x30,0x25,0x0D,0x01,0xF6,0x37,0x48,
-  0x41,0x3A,0xAE,0x24,0x49,0x6E,0x4A,0x47,0x71,0x4F,0x2A,0x03,0xB0,0xBA,0xFE,0xE2,
-  0xD5,0x91,0x59,0x27,0x06,0x06,0x83,0x03,0x03,0x75,0xF1,0x01,0x6F,0xFA,0xFD,0x3D,
-  0x87,0x7D,0x7B,0x89,0x01,0x35,0xFE,0xC1,0x69,0x98,0x62,0x2E,0x25,0x57,0x8E,0x68,
-  0x00,0x01,0x00,0x79,0xFF,0xEC,0x04,0x83,0x05,0xB6,0x00,0x1D,0x00,0x48,0x40,0x2A,
-  0x1B,0x00,0xFB,0x13,0x13,0x17,0x06,0xFB,0x38,0x09,0x01,0x0F,0x09,0x01,0x09,0x1F,
-  0x1A,0x16,0xFB,0x47,0x17,0x01,0x00,0x17,0x10,0x17,0x02,0x17,0x15,0x5F,0x07,0x1A,
-  0x1A,0x1C,0x18,0x03,0x17,0x12,0x03,0x5F,0x0E,0x13,0x00,0x3F,0xE1,0x3F,0x3F,0x33,
-  0x39,0x2F,0x33,0xE1,0x01,0x2F,0x5D,0x5D,0xE1,0x32,0x10,0xDE,0x5D,0x5D,0xE1,0x11,
-  0x39,0x2F,0xE1,0x33,0x30,0x31,0x01,0x14,0x16,0x33,0x32,0x36,0x35,0x11,0x33,0x11,
-  0x14,0x0E,0x02,0x23,0x22,0x2E,0x02,0x35,0x11,0x21,0x11,0x23,0x11,0x33,0x11,0x21,
-  0x11,0x33,0x02,0xDB,0x3E,0x45,0x45,0x3A,0xA6,0x25,0x4A,0x6F,0x4B,0x4B,0x6E,0x48,
-  0x24,0xFE,0xEA,0xA6,0xA6,0x01,0x16,0xA6,0x01,0x87,0x81,0x77,0x77,0x81,0x01,0xC9,
-  0xFE,0x2D,0x69,0x98,0x62,0x2E,0x2C,0x60,0x99,0x6C,0x01,0x2D,0xFD,0x56,0x05,0xB6,
-  0xFD,0x98,0x02,0x68,0x00,0x01,0x00,0x7B,0xFF,0xEC,0x04,0x7B,0x04,0x4A,0x00,0x1D,
-  0x00,0x50,0x40,0x31,0x05,0x49,0x02,0x47,0x18,0x57,0x18,0x02,0x18,0x18,0x1C,0x0B,
-  0x49,0x48,0x0E,0x58,0x0E,0xA8,0x0E,0x03,0x0F,0x0E,0x01,0x0E,0x1F,0x01,0x1B,0x49,
-  0x00,0x1C,0x10,0x1C,0x02,0x1C,0x1C,0x15,0x1A,0x50,0x0C,0x01,0x01,0x00,0x08,0x50,
-  0x13,0x16,0x03,0x00,0x0F,0x00,0x3F,0x32,0x3F,0xE1,0x11,0x39,0x2F,0xC4,0xE1,0x3F,
-  0x01,0x2F,0x5D,0xE1,0x32,0x10,0xDE,0x5D,0x5D,0xE1,0x11,0x39,0x2F,0x5D,0x33,0xE1,
-  0x30,0x31,0x01,0x11,0x21,0x11,0x33,0x11,0x14,0x16,0x33,0x32,0x36,0x35,0x11,0x33,
-  0x11,0x14,0x0E,0x02,0x23,0x22,0x2E,0x02,0x35,0x35,0x21,0x11,0x23,0x11,0x01,0x1D,
-  0x01,0x22,0xA2,0x37,0x48,0x3F,0x3A,0xA2,0x23,0x46,0x69,0x47,0x43,0x6C,0x4C,0x28,
-  0xFE,0xDE,0xA2,0x04,0x4A,0xFE,0x39,0x01,0xC7,0xFD,0x3D,0x83,0x81,0x82,0x82,0x01,
-  0x35,0xFE,0xC1,0x69,0x98,0x62,0x2E,0x25,0x57,0x8E,0x68,0x8B,0xFE,0x17,0x04,0x4A,
-  0x00,0x01,0x00,0x75,0xFF,0xEC,0x04,0x6F,0x05,0xCB,0x00,0x28,0x00,0x49,0x40,0x2A,
-  0x28,0x28,0x0C,0x27,0x5A,0x02,0x15,0x14,0x14,0x02,0x2A,0x1D,0x5B,0x00,0x0C,0x01,
-  0x0C,0x15,0x18,0x5F,0x11,0x28,0x5F,0x2F,0x00,0x5F,0x00,0x02,0x00,0x40,0x10,0x18,
-  0x48,0x00,0x00,0x14,0x11,0x04,0x22,0x5F,0x07,0x13,0x00,0x3F,0xE1,0x3F,0x33,0x39,
-  0x2F,0x2B,0x5D,0xE1,0x10,0xE1,0x32,0x01,0x2F,0x5D,0xE1,0x10,0xCE,0x32,0x2F,0x33,
-  0x10,0xE1,0x11,0x39,0x2F,0x30,0x31,0x01,0x21,0x15,0x14,0x0E,0x02,0x23,0x22,0x26,
-  0x26,0x02,0x35,0x34,0x12,0x36,0x36,0x33,0x32,0x16,0x17,0x07,0x26,0x26,0x23,0x22,
-  0x0E,0x02,0x15,0x14,0x1E,0x02,0x33,0x32,0x3E,0x02,0x35,0x21,0x02,0xA0,0x01,0xCF,
-  0x34,0x6F,0xAD,0x79,0x8A,0xD2,0x8D,0x48,0x50,0x97,0xD8,0x88,0x73,0xB5,0x4B,0x48,
-  0x3A,0x99,0x5E,0x56,0x8C,0x64,0x37,0x2D,0x59,0x84,0x57,0x52,0x6D,0x42,0x1B,0xFE,
-  0xEA,0x02,0xF6,0x8E,0xA7,0xF1,0x9B,0x49,0x69,0xC3,0x01,0x17,0xAE,0xAC,0x01,0x16,
-  0xC3,0x69,0x2C,0x2A,0xA2,0x22,0x32,0x51,0x98,0xDA,0x89,0x84,0xD9,0x9A,0x55,0x37,
-  0x6F,0xAA,0x73,0x00,0x00,0x01,0x00,0x71,0xFF,0xEC,0x04,0x5C,0x04,0x5E,0x00,0x28,
-  0x00,0x41,0x40,0x23,0x28,0x28,0x0C,0x01,0x15,0x3F,0x14,0x01,0x14,0x14,0x27,0x47,
-  0x01,0x2A,0x1D,0x48,0x00,0x0C,0x01,0x0C,0x15,0x18,0x4E,0x11,0x28,0x50,0x00,0x00,
-  0x14,0x11,0x10,0x22,0x4E,0x07,0x16,0x00,0x3F,0xE1,0x3F,0x33,0x39,0x2F,0xE1,0x10,
-  0xE1,0x32,0x01,0x2F,0x5D,0xE1,0x10,0xDE,0xE1,0x33,0x2F,0x5D,0x33,0x11,0x12,0x39,
-  0x2F,0x30,0x31,0x01,0x21,0x15,0x14,0x0E,0x02,0x23,0x22,0x2E,0x02,0x35,0x34,0x3E,
-  0x02,0x33,0x32,0x16,0x17,0x07,0x26,0x26,0x23,0x22,0x0E,0x02,0x15,0x14,0x1E,0x02,
-  0x33,0x32,0x3E,0x02,0x35,0x21,0x02,0x7B,0x01,0xE1,0x32,0x71,0xB3,0x81,0x87,0xC8,
-  0x84,0x41,0x47,0x8C,0xD0,0x8A,0x6F,0xAC,0x4D,0x3D,0x3C,0x94,0x5B,0x5B,0x8B,0x5C,
-  0x2F,0x25,0x53,0x84,0x5E,0x51,0x6E,0x42,0x1C,0xFE,0xD7,0x02,0x4A,0x44,0x82,0xC8,
-  0x89,0x47,0x4F,0x93,0xD3,0x84,0x83,0xD2,0x94,0x50,0x25,0x27,0x91,0x1D,0x2D,0x3A,
-  0x6D,0x9D,0x62,0x5D,0x9B,0x70,0x3E,0x2D,0x50,0x71,0x43,0x00,0x00,0x01,0x00,0x14,
-  0xFF,0xEC,0x04,0x83,0x05,0xB6,0x00,0x19,0x00,0x40,0x40,0x26,0x06,0x5A,0x0F,0x09,
-  0x01,0x09,0x1B,0x30,0x18,0x01,0x18,0x18,0x00,0x5A,0x9F,0x15,0x01,0x15,0x30,0x13,
-  0x80,0x13,0x90,0x13,0x03,0x13,0x19,0x15,0x5F,0x16,0x07,0x07,0x16,0x03,0x03,0x5F,
-  0x0E,0x13,0x00,0x3F,0xE1,0x3F,0x39,0x2F,0x10,0xE1,0x32,0x01,0x2F,0x5D,0xCE,0x5D,
-  0xF1,0xCA,0x2F,0x5D,0x10,0xDE,0x5D,0xE1,0x30,0x31,0x01,0x14,0x16,0x33,0x32,0x36,
-  0x35,0x11,0x33,0x11,0x14,0x0E,0x02,0x23,0x22,0x2E,0x02,0x35,0x11,0x21,0x35,0x21,
-  0x15,0x21,0x02,0x71,0x52,0x5C,0x5C,0x52,0xB6,0x32,0x5D,0x84,0x51,0x50,0x85,0x5F,
-  0x35,0xFE,0x5E,0x03,0xFE,0xFE,0x5F,0x01,0x87,0x81,0x77,0x77,0x81,0x01,0xC9,0xFE,
-  0x2D,0x69,0x98,0x62,0x2E,0x27,0x5D,0x9A,0x73,0x03,0x95,0xA4,0xA4,0x00,0x00,0x01,
-  0x00,0x29,0xFF,0xEC,0x04,0x6F,0x04,0x4A,0x00,0x1B,0x00,0x3C,0x40,0x23,0x0D,0x47,
-  0x10,0x1D,0x8F,0x03,0x9F,0x03,0x02,0x03,0x03,0x05,0x47,0x1F,0x00,0x01,0x00,0x00,
-  0x1A,0x10,0x1A,0x02,0x1A,0x0E,0x0E,0x01,0x0A,0x50,0x15,0x16,0x04,0x00,0x50,0x01,
-  0x0F,0x00,0x3F,0xE1,0x32,0x3F,0xE1,0x11,0x39,0x2F,0x01,0x2F,0x5D,0xCE,0x5D,0xF1,
-  0xCA,0x2F,0x5D,0x10,0xDE,0xE1,0x30,0x31,0x13,0x35,0x21,0x15,0x21,0x11,0x14,0x1E,
-  0x02,0x33,0x32,0x36,0x35,0x11,0x33,0x11,0x14,0x0E,0x02,0x23,0x22,0x2E,0x02,0x35,
-  0x11,0x29,0x03,0x35,0xFE,0xC1,0x15,0x31,0x50,0x3B,0x69,0x5F,0xB7,0x2F,0x5F,0x8F,
-  0x60,0x5B,0x92,0x66,0x37,0x03,0xB0,0x9A,0x9A,0xFD,0xD7,0x41,0x62,0x41,0x20,0x82,
-  0x82,0x01,0x35,0xFE,0xC1,0x69,0x98,0x62,0x2E,0x2E,0x62,0x96,0x69,0x02,0x35,0x00,
-  0x00,0x01,0x00,0xA6,0xFF,0xEC,0x04,0x44,0x05,0xCB,0x00,0x3B,0x00,0x49,0x40,0x27,
-  0x1C,0x1C,0x31,0x27,0x27,0x0B,0x0A,0x3D,0x15,0x5A,0x00,0x00,0x20,0x5B,0x00,0x31,
-  0x01,0x31,0x36,0x1D,0x61,0x9F,0x1A,0x01,0x1A,0x1A,0x05,0x26,0x23,0x60,0x27,0x2C,
-  0x13,0x0B,0x10,0x60,0x0A,0x05,0x04,0x00,0x3F,0x33,0xE1,0x32,0x3F,0x33,0xE1,0x32,
-  0x11,0x39,0x2F,0x5D,0xE1,0x39,0x01,0x2F,0x5D,0xE1,0x33,0x2F,0xE1,0x10,0xCE,0x32,
-  0x32,0x2F,0x11,0x39,0x2F,0x30,0x31,0x13,0x34,0x3E,0x02,0x33,0x32,0x1E,0x02,0x17,
-  0x07,0x2E,0x03,0x23,0x22,0x0E,0x02,0x15,0x14,0x1E,0x02,0x33,0x33,0x15,0x23,0x22,
-  0x06,0x15,0x14,0x16,0x33,0x32,0x36,0x37,0x15,0x0E,0x03,0x23,0x22,0x2E,0x02,0x35,
-  0x34,0x3E,0x02,0x37,0x35,0x2E,0x03,0xD3,0x3C,0x73,0xA9,0x6D,0x47,0x7B,0x69,0x5A,
-  0x27,0x5D,0x25,0x4D,0x53,0x5B,0x34,0x39,0x5F,0x44,0x26,0x2C,0x57,0x83,0x57,0xC2,
-  0xBE,0xBA,0xD0,0xAA,0xA4,0x6D,0xCB,0x54,0x2A,0x58,0x63,0x6F,0x40,0x80,0xC3,0x83,
-  0x42,0x32,0x5E,0x89,0x58,0x4B,0x78,0x54,0x2D,0x04,0x60,0x4F,0x85,0x61,0x36,0x18,
-  0x29,0x36,0x1F,0x7D,0x1B,0x2D,0x1F,0x12,0x1E,0x3A,0x53,0x36,0x3D,0x65,0x48,0x27,
-  0x97,0x85,0x87,0x89,0x8E,0x31,0x2B,0xAA,0x13,0x1C,0x13,0x09,0x3C,0x6F,0x9C,0x60,
-  0x48,0x7B,0x5E,0x3D,0x0B,0x06,0x0C,0x39,0x58,0x78,0xFF,0xFF,0x00,0xC9,0xFF,0xEC,
-  0x04,0x08,0x04,0x5E,0x02,0x06,0x01,0x82,0x00,0x00,0xFF,0xFF,0x00,0x04,0xFF,0xE9,
-  0x04,0x46,0x05,0xB6,0x02,0x06,0x01,0xB5,0x00,0x00,0xFF,0xFF,0x00,0x1F,0xFF,0xF2,
-  0x04,0x10,0x04,0x4A,0x02,0x06,0x01,0xD5,0x00,0x00,0xFF,0xFF,0x00,0x21,0xFE,0x98,
-  0x04,0xAC,0x05,0xBC,0x02,0x26,0x00,0x24,0x00,0x00,0x01,0x06,0x02,0x67,0x00,0x00,
-  0x00,0x13,0x40,0x0B,0x02,0x12,0x14,0x27,0x02,0x00,0x0F,0x15,0x04,0x07,0x25,0x01,
-  0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x87,0xFE,0x98,0x04,0x02,0x04,0x5E,
-  0x02,0x26,0x00,0x44,0x00,0x00,0x01,0x06,0x02,0x67,0xED,0x00,0x00,0x13,0x40,0x0B,
-  0x02,0x25,0x17,0x27,0x02,0x0F,0x22,0x28,0x08,0x16,0x25,0x01,0x2B,0x35,0x00,0x2B,
-  0x35,0x00,0xFF,0xFF,0x00,0x21,0x00,0x00,0x04,0xAC,0x07,0xE1,0x02,0x26,0x00,0x24,
-  0x00,0x00,0x01,0x07,0x02,0x66,0x00,0x21,0x01,0x52,0x00,0x13,0x40,0x0B,0x02,0x15,
-  0x05,0x26,0x02,0x21,0x24,0x0F,0x04,0x07,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,
-  0xFF,0xFF,0x00,0x87,0xFF,0xEC,0x04,0x02,0x06,0x8F,0x02,0x26,0x00,0x44,0x00,0x00,
-  0x01,0x06,0x02,0x66,0x19,0x00,0x00,0x13,0x40,0x0B,0x02,0x28,0x11,0x26,0x02,0x3B,
-  0x37,0x22,0x08,0x16,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x21,
-  0x00,0x00,0x04,0xAC,0x07,0xD1,0x02,0x26,0x00,0x24,0x00,0x00,0x01,0x07,0x03,0x77,
-  0x00,0x79,0x01,0x52,0x00,0x17,0x40,0x0D,0x03,0x02,0x0F,0x05,0x26,0x03,0x02,0x78,
-  0x17,0x26,0x04,0x07,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,0xFF,0xFF,
-  0x00,0x87,0xFF,0xEC,0x04,0x8D,0x06,0x7F,0x02,0x26,0x00,0x44,0x00,0x00,0x01,0x06,
-  0x03,0x77,0x7D,0x00,0x00,0x17,0x40,0x0D,0x03,0x02,0x22,0x11,0x26,0x03,0x02,0x9E,
-  0x2A,0x39,0x08,0x16,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,0xFF,0xFF,
-  0x00,0x21,0x00,0x00,0x04,0xAC,0x07,0xD1,0x02,0x26,0x00,0x24,0x00,0x00,0x01,0x07,
-  0x03,0x78,0xFF,0x94,0x01,0x52,0x00,0x19,0xB6,0x03,0x02,0x17,0x05,0x26,0x03,0x02,
-  0xB8,0xFF,0x94,0xB4,0x24,0x16,0x04,0x07,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,
-  0x35,0x00,0xFF,0xFF,0x00,0x55,0xFF,0xEC,0x04,0x02,0x06,0x7F,0x02,0x26,0x00,0x44,
-  0x00,0x00,0x01,0x06,0x03,0x78,0x99,0x00,0x00,0x19,0xB6,0x03,0x02,0x2A,0x11,0x26,
-  0x03,0x02,0xB8,0xFF,0xBB,0xB4,0x37,0x29,0x08,0x16,0x25,0x01,0x2B,0x35,0x35,0x00,
-  0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0x21,0x00,0x00,0x04,0xAC,0x08,0x4A,0x02,0x26,
-  0x00,0x24,0x00,0x00,0x01,0x07,0x03,0x79,0x00,0x58,0x01,0x52,0x00,0x17,0x40,0x0D,
-  0x03,0x02,0x0F,0x05,0x26,0x03,0x02,0x58,0x17,0x20,0x04,0x07,0x25,0x01,0x2B,0x35,
-  0x35,0x00,0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0x87,0xFF,0xEC,0x04,0x4C,0x06,0xF8,
-  0x02,0x26,0x00,0x44,0x00,0x00,0x01,0x06,0x03,0x79,0x5C,0x00,0x00,0x17,0x40,0x0D,
-  0x03,0x02,0x22,0x11,0x26,0x03,0x02,0x7E,0x2A,0x33,0x08,0x16,0x25,0x01,0x2B,0x35,
-  0x35,0x00,0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0x21,0x00,0x00,0x04,0xAC,0x08,0x62,
-  0x02,0x26,0x00,0x24,0x00,0x00,0x01,0x07,0x03,0x7A,0x00,0x08,0x01,0x52,0x00,0x17,
-  0x40,0x0D,0x03,0x02,0x17,0x05,0x26,0x03,0x02,0x07,0x29,0x37,0x04,0x07,0x25,0x01,
-  0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0x87,0xFF,0xEC,0x04,0x02,
-  0x07,0x10,0x02,0x26,0x00,0x44,0x00,0x00,0x01,0x06,0x03,0x7A,0x0C,0x00,0x00,0x17,
-  0x40,0x0D,0x03,0x02,0x2A,0x11,0x26,0x03,0x02,0x2D,0x3C,0x4A,0x08,0x16,0x25,0x01,
-  0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0x21,0xFE,0x98,0x04,0xAC,
-  0x07,0x73,0x02,0x26,0x00,0x24,0x00,0x00,0x00,0x27,0x01,0x4B,0x00,0x00,0x01,0x52,
-  0x01,0x06,0x02,0x67,0x00,0x00,0x00,0x22,0x40,0x16,0x03,0x22,0x14,0x27,0x02,0x0F,
-  0x05,0x26,0x03,0x00,0x1F,0x25,0x04,0x07,0x25,0x02,0x00,0x15,0x0F,0x04,0x07,0x25,
-  0x01,0x2B,0x35,0x2B,0x35,0x00,0x2B,0x35,0x2B,0x35,0xFF,0xFF,0x00,0x87,0xFE,0x98,
-  0x04,0x02,0x06,0x21,0x02,0x26,0x00,0x44,0x00,0x00,0x00,0x26,0x01,0x4B,0x08,0x00,
-  0x01,0x06,0x02,0x67,0xED,0x00,0x00,0x22,0x40,0x16,0x03,0x35,0x17,0x27,0x02,0x22,
-  0x11,0x26,0x03,0x0F,0x32,0x38,0x08,0x16,0x25,0x02,0x2A,0x28,0x22,0x08,0x16,0x25,
-  0x01,0x2B,0x35,0x2B,0x35,0x00,0x2B,0x35,0x2B,0x35,0xFF,0xFF,0x00,0x21,0x00,0x00,
-  0x04,0xAC,0x08,0x13,0x02,0x26,0x00,0x24,0x00,0x00,0x01,0x07,0x03,0x7B,0x00,0x00,
-  0x01,0x52,0x00,0x17,0x40,0x0D,0x03,0x02,0x20,0x05,0x26,0x03,0x02,0x00,0x23,0x1B,
-  0x04,0x07,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0x87,
-  0xFF,0xEC,0x04,0x02,0x06,0xC1,0x02,0x26,0x00,0x44,0x00,0x00,0x01,0x06,0x03,0x7B,
-  0xFF,0x00,0x00,0x17,0x40,0x0D,0x03,0x02,0x33,0x11,0x26,0x03,0x02,0x20,0x36,0x2E,
-  0x08,0x16,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0x21,
-  0x00,0x00,0x04,0xAC,0x08,0x13,0x02,0x26,0x00,0x24,0x00,0x00,0x01,0x07,0x03,0x7C,
-  0x00,0x00,0x01,0x52,0x00,0x17,0x40,0x0D,0x03,0x02,0x20,0x05,0x26,0x03,0x02,0x00,
-  0x23,0x1B,0x04,0x07,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,0xFF,0xFF,
-  0x00,0x87,0xFF,0xEC,0x04,0x02,0x06,0xC1,0x02,0x26,0x00,0x44,0x00,0x00,0x01,0x06,
-  0x03,0x7C,0xFF,0x00,0x00,0x17,0x40,0x0D,0x03,0x02,0x33,0x11,0x26,0x03,0x02,0x20,
-  0x36,0x2E,0x08,0x16,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,0xFF,0xFF,
-  0x00,0x21,0x00,0x00,0x04,0xAC,0x08,0x58,0x02,0x26,0x00,0x24,0x00,0x00,0x01,0x07,
-  0x03,0x7D,0x00,0x00,0x01,0x52,0x00,0x17,0x40,0x0D,0x03,0x02,0x14,0x05,0x26,0x03,
-  0x02,0x00,0x17,0x0F,0x04,0x07,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,
-  0xFF,0xFF,0x00,0x87,0xFF,0xEC,0x04,0x02,0x07,0x06,0x02,0x26,0x00,0x44,0x00,0x00,
-  0x01,0x06,0x03,0x7D,0xFF,0x00,0x00,0x17,0x40,0x0D,0x03,0x02,0x27,0x11,0x26,0x03,
-  0x02,0x20,0x2A,0x22,0x08,0x16,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,
-  0xFF,0xFF,0x00,0x21,0x00,0x00,0x04,0xAC,0x08,0x62,0x02,0x26,0x00,0x24,0x00,0x00,
-  0x01,0x07,0x03,0x7E,0x00,0x00,0x01,0x52,0x00,0x19,0xB6,0x03,0x02,0x14,0x05,0x26,
-  0x03,0x02,0xB8,0xFF,0xFF,0xB4,0x2C,0x3A,0x04,0x07,0x25,0x01,0x2B,0x35,0x35,0x00,
-  0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0x87,0xFF,0xEC,0x04,0x02,0x07,0x10,0x02,0x26,
-  0x00,0x44,0x00,0x00,0x01,0x06,0x03,0x7E,0xFF,0x00,0x00,0x17,0x40,0x0D,0x03,0x02,
-  0x27,0x11,0x26,0x03,0x02,0x20,0x3F,0x4D,0x08,0x16,0x25,0x01,0x2B,0x35,0x35,0x00,
-  0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0x21,0xFE,0x98,0x04,0xAC,0x07,0x40,0x02,0x26,
-  0x00,0x24,0x00,0x00,0x00,0x27,0x01,0x4E,0xFF,0xFD,0x01,0x52,0x01,0x06,0x02,0x67,
-  0x00,0x00,0x00,0x25,0x40,0x10,0x03,0x1E,0x14,0x27,0x02,0x12,0x05,0x26,0x03,0x00,
-  0x1B,0x21,0x04,0x07,0x25,0x02,0xB8,0xFF,0xFD,0xB4,0x14,0x0F,0x04,0x07,0x25,0x01,
-  0x2B,0x35,0x2B,0x35,0x00,0x2B,0x35,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x87,0xFE,0x98,
-  0x04,0x02,0x05,0xEE,0x02,0x26,0x00,0x44,0x00,0x00,0x00,0x26,0x01,0x4E,0xF5,0x00,
-  0x01,0x06,0x02,0x67,0xED,0x00,0x00,0x22,0x40,0x16,0x03,0x31,0x17,0x27,0x02,0x25,
-  0x11,0x26,0x03,0x0F,0x2E,0x34,0x08,0x16,0x25,0x02,0x16,0x27,0x22,0x08,0x16,0x25,
-  0x01,0x2B,0x35,0x2B,0x35,0x00,0x2B,0x35,0x2B,0x35,0xFF,0xFF,0x00,0xD9,0xFE,0x98,
-  0x04,0x23,0x05,0xB6,0x02,0x26,0x00,0x28,0x00,0x00,0x01,0x06,0x02,0x67,0x17,0x00,
-  0x00,0x13,0x40,0x0B,0x01,0x0F,0x14,0x27,0x01,0x00,0x0C,0x12,0x01,0x00,0x25,0x01,
-  0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x85,0xFE,0x98,0x04,0x48,0x04,0x5E,
-  0x02,0x26,0x00,0x48,0x00,0x00,0x01,0x06,0x02,0x67,0x17,0x00,0x00,0x13,0x40,0x0B,
-  0x02,0x1A,0x17,0x27,0x02,0x17,0x17,0x1D,0x0B,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,
-  0x35,0x00,0xFF,0xFF,0x00,0xD9,0x00,0x00,0x04,0x23,0x07,0xE1,0x02,0x26,0x00,0x28,
-  0x00,0x00,0x01,0x07,0x02,0x66,0x00,0x27,0x01,0x52,0x00,0x13,0x40,0x0B,0x01,0x12,
-  0x05,0x26,0x01,0x0F,0x21,0x0C,0x01,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,
-  0xFF,0xFF,0x00,0x85,0xFF,0xEC,0x04,0x48,0x06,0x8F,0x02,0x26,0x00,0x48,0x00,0x00,
-  0x01,0x06,0x02,0x66,0x39,0x00,0x00,0x13,0x40,0x0B,0x02,0x1D,0x11,0x26,0x02,0x39,
-  0x2C,0x17,0x0B,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xD9,
-  0x00,0x00,0x04,0x23,0x07,0x35,0x02,0x26,0x00,0x28,0x00,0x00,0x01,0x07,0x01,0x52,
-  0x00,0x19,0x01,0x52,0x00,0x13,0x40,0x0B,0x01,0x0C,0x05,0x26,0x01,0x00,0x0D,0x16,
-  0x01,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x85,0xFF,0xEC,
-  0x04,0x48,0x05,0xE3,0x02,0x26,0x00,0x48,0x00,0x00,0x01,0x06,0x01,0x52,0x21,0x00,
-  0x00,0x13,0x40,0x0B,0x02,0x17,0x11,0x26,0x02,0x20,0x18,0x21,0x0B,0x00,0x25,0x01,
-  0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xD9,0x00,0x00,0x04,0x91,0x07,0xD1,
-  0x02,0x26,0x00,0x28,0x00,0x00,0x01,0x07,0x03,0x77,0x00,0x81,0x01,0x52,0x00,0x17,
-  0x40,0x0D,0x02,0x01,0x0C,0x05,0x26,0x02,0x01,0x69,0x14,0x23,0x01,0x00,0x25,0x01,
-  0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0x85,0xFF,0xEC,0x04,0x85,
-  0x06,0x7F,0x02,0x26,0x00,0x48,0x00,0x00,0x01,0x06,0x03,0x77,0x75,0x00,0x00,0x17,
-  0x40,0x0D,0x03,0x02,0x17,0x11,0x26,0x03,0x02,0x74,0x1F,0x2E,0x0B,0x00,0x25,0x01,
-  0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0x59,0x00,0x00,0x04,0x23,
-  0x07,0xD1,0x02,0x26,0x00,0x28,0x00,0x00,0x01,0x07,0x03,0x78,0xFF,0x9D,0x01,0x52,
-  0x00,0x19,0xB6,0x02,0x01,0x14,0x05,0x26,0x02,0x01,0xB8,0xFF,0x85,0xB4,0x21,0x13,
-  0x01,0x00,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0x4C,
-  0xFF,0xEC,0x04,0x48,0x06,0x7F,0x02,0x26,0x00,0x48,0x00,0x00,0x01,0x06,0x03,0x78,
-  0x90,0x00,0x00,0x19,0xB6,0x03,0x02,0x1F,0x11,0x26,0x03,0x02,0xB8,0xFF,0x90,0xB4,
-  0x2C,0x1E,0x0B,0x00,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,0xFF,0xFF,
-  0x00,0xD9,0x00,0x00,0x04,0x50,0x08,0x4A,0x02,0x26,0x00,0x28,0x00,0x00,0x01,0x07,
-  0x03,0x79,0x00,0x60,0x01,0x52,0x00,0x17,0x40,0x0D,0x02,0x01,0x0C,0x05,0x26,0x02,
-  0x01,0x48,0x14,0x1D,0x01,0x00,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,
-  0xFF,0xFF,0x00,0x85,0xFF,0xEC,0x04,0x48,0x06,0xF8,0x02,0x26,0x00,0x48,0x00,0x00,
-  0x01,0x06,0x03,0x79,0x54,0x00,0x00,0x17,0x40,0x0D,0x03,0x02,0x17,0x11,0x26,0x03,
-  0x02,0x54,0x1F,0x28,0x0B,0x00,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,
-  0xFF,0xFF,0x00,0xD9,0x00,0x00,0x04,0x23,0x08,0x62,0x02,0x26,0x00,0x28,0x00,0x00,
-  0x01,0x07,0x03,0x7A,0x00,0x10,0x01,0x52,0x00,0x19,0xB6,0x02,0x01,0x14,0x05,0x26,
-  0x02,0x01,0xB8,0xFF,0xF8,0xB4,0x26,0x34,0x01,0x00,0x25,0x01,0x2B,0x35,0x35,0x00,
-  0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0x85,0xFF,0xEC,0x04,0x48,0x07,0x10,0x02,0x26,
-  0x00,0x48,0x00,0x00,0x01,0x06,0x03,0x7A,0x04,0x00,0x00,0x17,0x40,0x0D,0x03,0x02,
-  0x1F,0x11,0x26,0x03,0x02,0x03,0x31,0x3F,0x0B,0x00,0x25,0x01,0x2B,0x35,0x35,0x00,
-  0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0xD9,0xFE,0x98,0x04,0x23,0x07,0x73,0x02,0x26,
-  0x00,0x28,0x00,0x00,0x00,0x27,0x01,0x4B,0x00,0x23,0x01,0x52,0x01,0x06,0x02,0x67,
-  0x17,0x00,0x00,0x22,0x40,0x16,0x02,0x1F,0x14,0x27,0x01,0x0C,0x05,0x26,0x02,0x00,
-  0x1C,0x22,0x01,0x00,0x25,0x01,0x0B,0x12,0x0C,0x01,0x00,0x25,0x01,0x2B,0x35,0x2B,
-  0x35,0x00,0x2B,0x35,0x2B,0x35,0xFF,0xFF,0x00,0x85,0xFE,0x98,0x04,0x48,0x06,0x21,
-  0x02,0x26,0x00,0x48,0x00,0x00,0x00,0x26,0x01,0x4B,0x10,0x00,0x01,0x06,0x02,0x67,
-  0x17,0x00,0x00,0x22,0x40,0x16,0x03,0x2A,0x17,0x27,0x02,0x17,0x11,0x26,0x03,0x17,
-  0x27,0x2D,0x0B,0x00,0x25,0x02,0x10,0x1D,0x17,0x0B,0x00,0x25,0x01,0x2B,0x35,0x2B,
-  0x35,0x00,0x2B,0x35,0x2B,0x35,0xFF,0xFF,0x00,0xE1,0x00,0x00,0x03,0xE9,0x07,0xE1,
-  0x02,0x26,0x00,0x2C,0x00,0x00,0x01,0x07,0x02,0x66,0x00,0x1F,0x01,0x52,0x00,0x13,
-  0x40,0x0B,0x01,0x12,0x05,0x26,0x01,0x20,0x21,0x0C,0x01,0x00,0x25,0x01,0x2B,0x35,
-  0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xC5,0x00,0x00,0x04,0x33,0x06,0x8F,0x02,0x26,
-  0x00,0xF3,0x00,0x00,0x01,0x06,0x02,0x66,0x2F,0x00,0x00,0x13,0x40,0x0B,0x01,0x10,
-  0x11,0x26,0x01,0x19,0x1F,0x0A,0x07,0x05,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,
-  0xFF,0xFF,0x00,0xE1,0xFE,0x98,0x03,0xE9,0x05,0xB6,0x02,0x26,0x00,0x2C,0x00,0x00,
-  0x01,0x06,0x02,0x67,0x00,0x00,0x00,0x13,0x40,0x0B,0x01,0x0F,0x14,0x27,0x01,0x01,
-  0x0C,0x12,0x01,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xC5,
-  0xFE,0x98,0x04,0x33,0x06,0x0E,0x02,0x26,0x00,0x4C,0x00,0x00,0x01,0x06,0x02,0x67,
-  0x14,0x00,0x00,0x15,0xB4,0x02,0x16,0x17,0x27,0x02,0xB8,0xFF,0xFF,0xB4,0x13,0x19,
-  0x10,0x0E,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x54,0xFE,0x98,
-  0x04,0x7B,0x05,0xCD,0x02,0x26,0x00,0x32,0x00,0x00,0x01,0x06,0x02,0x67,0x00,0x00,
-  0x00,0x15,0xB4,0x02,0x17,0x14,0x27,0x02,0xB8,0xFF,0xFF,0xB4,0x14,0x1A,0x02,0x07,
-  0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x73,0xFE,0x98,0x04,0x58,
-  0x04,0x5E,0x02,0x26,0x00,0x52,0x00,0x00,0x01,0x06,0x02,0x67,0x00,0x00,0x00,0x13,
-  0x40,0x0B,0x02,0x17,0x17,0x27,0x02,0x01,0x14,0x1A,0x03,0x09,0x25,0x01,0x2B,0x35,
-  0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x54,0xFF,0xEC,0x04,0x7B,0x07,0xE1,0x02,0x26,
-  0x00,0x32,0x00,0x00,0x01,0x07,0x02,0x66,0x00,0x17,0x01,0x52,0x00,0x13,0x40,0x0B,
-  0x02,0x1A,0x05,0x26,0x02,0x16,0x29,0x14,0x02,0x07,0x25,0x01,0x2B,0x35,0x00,0x2B,
-  0x35,0x00,0xFF,0xFF,0x00,0x73,0xFF,0xEC,0x04,0x58,0x06,0x8F,0x02,0x26,0x00,0x52,
-  0x00,0x00,0x01,0x06,0x02,0x66,0x1F,0x00,0x00,0x13,0x40,0x0B,0x02,0x1A,0x11,0x26,
-  0x02,0x20,0x29,0x14,0x03,0x09,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,
-  0x00,0x54,0xFF,0xEC,0x04,0x83,0x07,0xD1,0x02,0x26,0x00,0x32,0x00,0x00,0x01,0x07,
-  0x03,0x77,0x00,0x73,0x01,0x52,0x00,0x17,0x40,0x0D,0x03,0x02,0x14,0x05,0x26,0x03,
-  0x02,0x71,0x1C,0x2B,0x02,0x07,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,
-  0xFF,0xFF,0x00,0x73,0xFF,0xEC,0x04,0x83,0x06,0x7F,0x02,0x26,0x00,0x52,0x00,0x00,
-  0x01,0x06,0x03,0x77,0x73,0x00,0x00,0x17,0x40,0x0D,0x03,0x02,0x14,0x11,0x26,0x03,
-  0x02,0x73,0x1C,0x2B,0x03,0x09,0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,
-  0xFF,0xFF,0x00,0x4A,0xFF,0xEC,0x04,0x7B,0x07,0xD1,0x02,0x26,0x00,0x32,0x00,0x00,
-  0x01,0x07,0x03,0x78,0xFF,0x8E,0x01,0x52,0x00,0x19,0xB6,0x03,0x02,0x1C,0x05,0x26,
-  0x03,0x02,0xB8,0xFF,0x8D,0xB4,0x29,0x1B,0x02,0x07,0x25,0x01,0x2B,0x35,0x35,0x00,
-  0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0x4A,0xFF,0xEC,0x04,0x58,0x06,0x7F,0x02,0x26,
-  0x00,0x52,0x00,0x00,0x01,0x06,0x03,0x78,0x8E,0x00,0x00,0x19,0xB6,0x03,0x02,0x1C,
-  0x11,0x26,0x03,0x02,0xB8,0xFF,0x8F,0xB4,0x29,0x1B,0x03,0x09,0x25,0x01,0x2B,0x35,
-  0x35,0x00,0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0x54,0xFF,0xEC,0x04,0x7B,0x08,0x4A,
-  0x02,0x26,0x00,0x32,0x00,0x00,0x01,0x07,0x03,0x79,0x00,0x52,0x01,0x52,0x00,0x17,
-  0x40,0x0D,0x03,0x02,0x14,0x05,0x26,0x03,0x02,0x51,0x1C,0x25,0x02,0x07,0x25,0x01,
-  0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0x73,0xFF,0xEC,0x04,0x58,
-  0x06,0xF8,0x02,0x26,0x00,0x52,0x00,0x00,0x01,0x06,0x03,0x79,0x52,0x00,0x00,0x17,
-  0x40,0x0D,0x03,0x02,0x14,0x11,0x26,0x03,0x02,0x53,0x1C,0x25,0x03,0x09,0x25,0x01,
-  0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0x54,0xFF,0xEC,0x04,0x7B,
-  0x08,0x62,0x02,0x26,0x00,0x32,0x00,0x00,0x01,0x07,0x03,0x7A,0x00,0x02,0x01,0x52,
-  0x00,0x17,0x40,0x0D,0x03,0x02,0x1C,0x05,0x26,0x03,0x02,0x00,0x2E,0x3C,0x02,0x07,
-  0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0x73,0xFF,0xEC,
-  0x04,0x58,0x07,0x10,0x02,0x26,0x00,0x52,0x00,0x00,0x01,0x06,0x03,0x7A,0x02,0x00,
-  0x00,0x17,0x40,0x0D,0x03,0x02,0x1C,0x11,0x26,0x03,0x02,0x02,0x2E,0x3C,0x03,0x09,
-  0x25,0x01,0x2B,0x35,0x35,0x00,0x2B,0x35,0x35,0x00,0xFF,0xFF,0x00,0x54,0xFE,0x98,
-  0x04,0x7B,0x07,0x73,0x02,0x26,0x00,0x32,0x00,0x00,0x00,0x27,0x01,0x4B,0x00,0x00,
-  0x01,0x52,0x01,0x06,0x02,0x67,0x00,0x00,0x00,0x28,0x40,0x09,0x03,0x27,0x14,0x27,
-  0x02,0x14,0x05,0x26,0x03,0xB8,0xFF,0xFF,0xB5,0x24,0x2A,0x02,0x07,0x25,0x02,0xB8,
-  0xFF,0xFF,0xB4,0x1A,0x14,0x02,0x07,0x25,0x01,0x2B,0x35,0x2B,0x35,0x00,0x2B,0x35,
-  0x2B,0x35,0xFF,0xFF,0x00,0x73,0xFE,0x98,0x04,0x58,0x06,0x21,0x02,0x26,0x00,0x52,
-  0x00,0x00,0x00,0x26,0x01,0x4B,0x00,0x00,0x01,0x06,0x02,0x67,0x00,0x00,0x00,0x22,
-  0x40,0x16,0x03,0x27,0x17,0x27,0x02,0x14,0x11,0x26,0x03,0x01,0x24,0x2A,0x03,0x09,
-  0x25,0x02,0x01,0x1A,0x14,0x03,0x09,0x25,0x01,0x2B,0x35,0x2B,0x35,0x00,0x2B,0x35,
-  0x2B,0x35,0xFF,0xFF,0x00,0x54,0xFF,0xEC,0x04,0xF6,0x07,0x73,0x02,0x26,0x02,0x5F,
-  0x00,0x00,0x01,0x07,0x00,0x76,0x00,0x5A,0x01,0x52,0x00,0x13,0x40,0x0B,0x02,0x3B,
-  0x05,0x26,0x02,0x1B,0x35,0x38,0x0A,0x19,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,
-  0xFF,0xFF,0x00,0x73,0xFF,0xEC,0x04,0xF6,0x06,0x21,0x02,0x26,0x02,0x60,0x00,0x00,
-  0x01,0x06,0x00,0x76,0x50,0x00,0x00,0x0E,0xB7,0x02,0x02,0x02,0x2C,0x2F,0x0A,0x19,
-  0x25,0x01,0x2B,0x35,0x00,0x35,0xFF,0xFF,0x00,0x54,0xFF,0xEC,0x04,0xF6,0x07,0x73,
-  0x02,0x26,0x02,0x5F,0x00,0x00,0x01,0x07,0x00,0x43,0xFF,0xAF,0x01,0x52,0x00,0x15,
-  0xB4,0x02,0x35,0x05,0x26,0x02,0xB8,0xFF,0x71,0xB4,0x38,0x35,0x0A,0x19,0x25,0x01,
-  0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x73,0xFF,0xEC,0x04,0xF6,0x06,0x21,
-  0x02,0x26,0x02,0x60,0x00,0x00,0x01,0x06,0x00,0x43,0xD8,0x00,0x00,0x11,0xB1,0x02,
-  0x02,0xB8,0xFF,0x8A,0xB4,0x2F,0x2C,0x0A,0x19,0x25,0x01,0x2B,0x35,0x00,0x35,0x00,
-  0xFF,0xFF,0x00,0x54,0xFF,0xEC,0x04,0xF6,0x07,0xE1,0x02,0x26,0x02,0x5F,0x00,0x00,
-  0x01,0x07,0x02,0x66,0x00,0x17,0x01,0x52,0x00,0x15,0xB4,0x02,0x3C,0x05,0x26,0x02,
-  0xB8,0xFF,0xD9,0xB4,0x4A,0x35,0x0A,0x19,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,
-  0xFF,0xFF,0x00,0x73,0xFF,0xEC,0x04,0xF6,0x06,0x8F,0x02,0x26,0x02,0x60,0x00,0x00,
-  0x01,0x06,0x02,0x66,0x1F,0x00,0x00,0x15,0xB4,0x02,0x33,0x11,0x26,0x02,0xB8,0xFF,
-  0xD1,0xB4,0x41,0x2C,0x0A,0x19,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,
-  0x00,0x54,0xFF,0xEC,0x04,0xF6,0x07,0x35,0x02,0x26,0x02,0x5F,0x00,0x00,0x01,0x07,
-  0x01,0x52,0x00,0x08,0x01,0x52,0x00,0x15,0xB4,0x02,0x35,0x05,0x26,0x02,0xB8,0xFF,
-  0xC9,0xB4,0x36,0x3F,0x0A,0x19,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,
-  0x00,0x73,0xFF,0xEC,0x04,0xF6,0x05,0xE3,0x02,0x26,0x02,0x60,0x00,0x00,0x01,0x06,
-  0x01,0x52,0x00,0x00,0x00,0x11,0xB1,0x02,0x02,0xB8,0xFF,0xB1,0xB4,0x2D,0x36,0x0A,
-  0x19,0x25,0x01,0x2B,0x35,0x00,0x35,0x00,0xFF,0xFF,0x00,0x54,0xFE,0x98,0x04,0xF6,
-  0x06,0x14,0x02,0x26,0x02,0x5F,0x00,0x00,0x01,0x06,0x02,0x67,0x00,0x00,0x00,0x15,
-  0xB4,0x02,0x38,0x14,0x27,0x02,0xB8,0xFF,0xC2,0xB4,0x35,0x3B,0x0A,0x19,0x25,0x01,
-  0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x73,0xFE,0x98,0x04,0xF6,0x04,0xF2,
-  0x02,0x26,0x02,0x60,0x00,0x00,0x01,0x06,0x02,0x67,0x00,0x00,0x00,0x15,0xB4,0x02,
-  0x2F,0x17,0x27,0x02,0xB8,0xFF,0xB2,0xB4,0x2C,0x32,0x0A,0x19,0x25,0x01,0x2B,0x35,
-  0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x7D,0xFE,0x98,0x04,0x50,0x05,0xB8,0x02,0x26,
-  0x00,0x38,0x00,0x00,0x01,0x06,0x02,0x67,0x00,0x00,0x00,0x13,0x40,0x0B,0x01,0x12,
-  0x14,0x27,0x01,0x00,0x0F,0x15,0x06,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,
-  0xFF,0xFF,0x00,0xA0,0xFE,0x98,0x04,0x2D,0x04,0x4A,0x02,0x26,0x00,0x58,0x00,0x00,
-  0x01,0x06,0x02,0x67,0x00,0x00,0x00,0x13,0x40,0x0B,0x01,0x15,0x17,0x27,0x01,0x00,
-  0x12,0x18,0x06,0x10,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x7D,
-  0xFF,0xEC,0x04,0x50,0x07,0xE1,0x02,0x26,0x00,0x38,0x00,0x00,0x01,0x07,0x02,0x66,
-  0x00,0x17,0x01,0x52,0x00,0x13,0x40,0x0B,0x01,0x15,0x05,0x26,0x01,0x17,0x24,0x0F,
-  0x06,0x00,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xA0,0xFF,0xEC,
-  0x04,0x2D,0x06,0x8F,0x02,0x26,0x00,0x58,0x00,0x00,0x01,0x06,0x02,0x66,0x1D,0x00,
-  0x00,0x13,0x40,0x0B,0x01,0x18,0x11,0x26,0x01,0x1D,0x27,0x12,0x06,0x10,0x25,0x01,
-  0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x7D,0xFF,0xEC,0x05,0x17,0x07,0x73,
-  0x02,0x26,0x02,0x61,0x00,0x00,0x01,0x07,0x00,0x76,0xFF,0xFF,0x01,0x52,0x00,0x15,
-  0xB4,0x01,0x2D,0x05,0x26,0x01,0xB8,0xFF,0x9C,0xB4,0x27,0x2A,0x18,0x08,0x25,0x01,
-  0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xA0,0xFF,0xEC,0x05,0x17,0x06,0x21,
-  0x02,0x26,0x02,0x62,0x00,0x00,0x01,0x06,0x00,0x76,0xFF,0x00,0x00,0x11,0xB1,0x01,
-  0x01,0xB8,0xFF,0x8A,0xB4,0x28,0x2B,0x0C,0x21,0x25,0x01,0x2B,0x35,0x00,0x35,0x00,
-  0xFF,0xFF,0x00,0x7D,0xFF,0xEC,0x05,0x17,0x07,0x73,0x02,0x26,0x02,0x61,0x00,0x00,
-  0x01,0x07,0x00,0x43,0xFF,0x6E,0x01,0x52,0x00,0x15,0xB4,0x01,0x27,0x05,0x26,0x01,
-  0xB8,0xFF,0x0B,0xB4,0x2A,0x27,0x18,0x08,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,
-  0xFF,0xFF,0x00,0xA0,0xFF,0xEC,0x05,0x17,0x06,0x21,0x02,0x26,0x02,0x62,0x00,0x00,
-  0x01,0x07,0x00,0x43,0xFF,0x6B,0x00,0x00,0x00,0x11,0xB1,0x01,0x01,0xB8,0xFE,0xF6,
-  0xB4,0x2B,0x28,0x0C,0x21,0x25,0x01,0x2B,0x35,0x00,0x35,0x00,0xFF,0xFF,0x00,0x7D,
-  0xFF,0xEC,0x05,0x17,0x07,0xE1,0x02,0x26,0x02,0x61,0x00,0x00,0x01,0x07,0x02,0x66,
-  0xFF,0xDA,0x01,0x52,0x00,0x15,0xB4,0x01,0x2E,0x05,0x26,0x01,0xB8,0xFF,0x77,0xB4,
-  0x3C,0x27,0x18,0x08,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xA0,
-  0xFF,0xEC,0x05,0x17,0x06,0x8F,0x02,0x26,0x02,0x62,0x00,0x00,0x01,0x06,0x02,0x66,
-  0xE2,0x00,0x00,0x15,0xB4,0x01,0x2E,0x11,0x26,0x01,0xB8,0xFF,0x6D,0xB4,0x3D,0x28,
-  0x0C,0x21,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x7D,0xFF,0xEC,
-  0x05,0x17,0x07,0x35,0x02,0x26,0x02,0x61,0x00,0x00,0x01,0x07,0x01,0x52,0xFF,0xC6,
-  0x01,0x52,0x00,0x13,0x40,0x0B,0x01,0x27,0x05,0x26,0x01,0x24,0x28,0x31,0x18,0x0E,
-  0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xA0,0xFF,0xEC,0x05,0x17,
-  0x05,0xE3,0x02,0x26,0x02,0x62,0x00,0x00,0x01,0x06,0x01,0x52,0xCE,0x00,0x00,0x0E,
-  0xB7,0x01,0x01,0x21,0x29,0x32,0x0C,0x27,0x25,0x01,0x2B,0x35,0x00,0x35,0xFF,0xFF,
-  0x00,0x7D,0xFE,0x98,0x05,0x17,0x06,0x14,0x02,0x26,0x02,0x61,0x00,0x00,0x01,0x06,
-  0x02,0x67,0xB9,0x00,0x00,0x15,0xB4,0x01,0x2A,0x14,0x27,0x01,0xB8,0xFF,0x56,0xB4,
-  0x27,0x2D,0x18,0x08,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0xA0,
-  0xFE,0x98,0x05,0x17,0x04,0xF2,0x02,0x26,0x02,0x62,0x00,0x00,0x01,0x06,0x02,0x67,
-  0xBD,0x00,0x00,0x15,0xB4,0x01,0x2B,0x17,0x27,0x01,0xB8,0xFF,0x48,0xB4,0x28,0x2E,
-  0x0C,0x21,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x21,0xFE,0x98,
-  0x04,0xAA,0x05,0xB6,0x02,0x26,0x00,0x3C,0x00,0x00,0x01,0x06,0x02,0x67,0xFF,0x00,
-  0x00,0x13,0x40,0x0B,0x01,0x0C,0x14,0x27,0x01,0x00,0x09,0x0F,0x07,0x02,0x25,0x01,
-  0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x52,0xFE,0x14,0x04,0x79,0x04,0x4A,
-  0x02,0x26,0x00,0x5C,0x00,0x00,0x01,0x07,0x02,0x67,0x01,0x2F,0x00,0x00,0x00,0x11,
-  0xB1,0x01,0x01,0xB8,0x01,0x30,0xB4,0x17,0x1D,0x00,0x09,0x25,0x01,0x2B,0x35,0x00,
-  0x35,0x00,0xFF,0xFF,0x00,0x21,0x00,0x00,0x04,0xAA,0x07,0xE1,0x02,0x26,0x00,0x3C,
-  0x00,0x00,0x01,0x07,0x02,0x66,0x00,0x14,0x01,0x52,0x00,0x13,0x40,0x0B,0x01,0x0F,
-  0x05,0x26,0x01,0x15,0x1E,0x09,0x07,0x02,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,
-  0xFF,0xFF,0x00,0x52,0xFE,0x14,0x04,0x79,0x06,0x8F,0x02,0x26,0x00,0x5C,0x00,0x00,
-  0x01,0x06,0x02,0x66,0x14,0x00,0x00,0x13,0x40,0x0B,0x01,0x1D,0x11,0x26,0x01,0x15,
-  0x2C,0x17,0x00,0x09,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x21,
-  0x00,0x00,0x04,0xAA,0x07,0x35,0x02,0x26,0x00,0x3C,0x00,0x00,0x01,0x07,0x01,0x52,
-  0x00,0x0C,0x01,0x52,0x00,0x13,0x40,0x0B,0x01,0x09,0x05,0x26,0x01,0x0C,0x0A,0x13,
-  0x07,0x02,0x25,0x01,0x2B,0x35,0x00,0x2B,0x35,0x00,0xFF,0xFF,0x00,0x52,0xFE,0x14,
-  0x04,0x79,0x05,0xE3,0x02,0x26,0x00,0x5C,0x00,0x00,0x01,0x06,0x01,0x52,0x0C,0x00,
-  0x00,0x13,0x40,0x0B,0x01,0x17,0x11,0x26,0x01,0x0C,0x18,0x21,0x00,0x09,0x25,0x01,
-  0x2B,0x35,0x00,0x2B,0x35,0x00,0x00,0x03,0x00,0x89,0xFE,0xBC,0x04,0xCB,0x06,0x14,
-  0x00,0x03,0x00,0x2B,0x00,0x3C,0x00,0x76,0x40,0x47,0x21,0x21,0x0F,0x32,0x2B,0x23,
-  0x1A,0x04,0x20,0x47,0x27,0x29,0x25,0x03,0x03,0x90,0x29,0xA0,0x29,0x02,0x29,0x3E,
-  0x3A,0x48,0x0F,0x02,0x02,0x00,0x0F,0xE0,0x0F,0xF0,0x0F,0x03,0x0F,0x2B,0x15,0x29,
-  0x20,0x4F,0x26,0x23,0x23,0x14,0x24,0x00,0x19,0x37,0x50,0x00,0x14,0x10,0x14,0x20,
-  0x14,0xB0,0x14,0xC0,0x14,0x05,0x14,0x0F,0x04,0x2C,0x50,0x0A,0x01,0x4E,0x02,0x0A,
-  0x16,0x00,0x3F,0xDE,0xE1,0x10,0xE1,0x32,0x3F,0x5D,0xE1,0x32,0x3F,0x12,0x39,0x2F,
-  0x33,0xE1,0x32,0x3F,0x01,0x2F,0x5D,0x33,0x2F,0x10,0xE1,0x10,0xCE,0x5D,0x32,0x2F,
-  0x32,0x10,0xCD,0xE1,0x32,0x32,0x32,0x32,0x32,0x11,0x39,0x2F,0x30,0x31,0x01,0x21,
-  0x35,0x21,0x03,0x23,0x0E,0x03,0x23,0x22,0x2E,0x02,0x35,0x34,0x3E,0x02,0x33,0x32,
-  0x1E,0x02,0x17,0x33,0x26,0x27,0x26,0x26,0x35,0x35,0x21,0x35,0x21,0x35,0x33,0x15,
-  0x33,0x15,0x23,0x11,0x23,0x25,0x32,0x3E,0x02,0x37,0x35,0x34,0x2E,0x02,0x23,0x22,
-  0x06,0x15,0x14,0x16,0x04,0x2F,0xFC,0x98,0x03,0x68,0xAE,0x08,0x17,0x3D,0x4E,0x62,
-  0x3E,0x61,0x9E,0x71,0x3E,0x3E,0x71,0x9E,0x61,0x3D,0x62,0x4F,0x3D,0x17,0x0C,0x03,
-  0x03,0x02,0x04,0xFE,0x85,0x01,0x7B,0xB6,0x9C,0x9C,0x93,0xFE,0xBC,0x4F,0x6D,0x43,
-  0x20,0x02,0x1C,0x44,0x6F,0x54,0x8C,0x84,0x84,0xFE,0xBC,0x8C,0x01,0x4B,0x22,0x3D,
-  0x2E,0x1A,0x46,0x8A,0xCC,0x86,0x87,0xCE,0x8B,0x47,0x19,0x2C,0x3A,0x20,0x21,0x1F,
-  0x1A,0x37,0x10,0x9E,0x89,0xB6,0xB6,0x89,0xFB,0x2B,0x83,0x2C,0x59,0x85,0x5A,0x27,
-  0x61,0x95,0x66,0x34,0xCE,0xC4,0xC6,0xC3,0x00,0x02,0x00,0xCD,0x04,0xD9,0x03,0xAC,
-  0x06,0x21,0x00,0x0D,0x00,0x1B,0x00,0x30,0x40,0x18,0x0F,0x82,0x0E,0x0E,0x14,0x01,
-  0x82,0x00,0x00,0x08,0x85,0x5F,0x06,0x01,0x06,0x06,0x16,0x85,0x14,0x15,0x07,0x80,
-  0x0F,0x00,0x00,0x2F,0x32,0x1A,0xCD,0x32,0x01,0x2F,0xE1,0x33,0x2F,0x5D,0xE1,0x33,
-  0x2F,0xE1,0x11,0x33,0x2F,0xE1,0x30,0x31,0x01,0x23,0x2E,0x03,0x27,0x35,0x33,0x1E,
-  0x03,0x17,0x05,0x23,0x2E,0x03,0x27,0x35,0x33,0x1E,0x03,0x17,0x03,0xAC,0x64,0x22,
-  0x52,0x4D,0x40,0x10,0xC7,0x10,0x2B,0x2E,0x30,0x15,0xFE,0x96,0x65,0x22,0x52,0x4D,
-  0x3F,0x10,0xC6,0x10,0x2B,0x2E,0x30,0x16,0x04,0xD9,0x1C,0x53,0x58,0x51,0x1B,0x15,
-  0x22,0x51,0x51,0x4C,0x1D,0x1B,0x1C,0x53,0x58,0x51,0x1B,0x15,0x22,0x51,0x51,0x4C,
-  0x1D,0x00,0x00,0x02,0x00,0xBC,0x04,0xD9,0x04,0x10,0x06,0x7F,0x00,0x10,0x00,0x1C,
-  0x00,0x44,0x40,0x23,0x16,0x88,0x17,0x17,0x1B,0x82,0x3F,0x1C,0x4F,0x1C,0x6F,0x1C,
-  0x03,0x1C,0x1C,0x0D,0x0D,0x0C,0x04,0x04,0x08,0x01,0x00,0x00,0x07,0x08,0x16,0x80,
-  0x1B,0x40,0x04,0x0C,0x80,0x07,0x00,0x00,0x2F,0x32,0x1A,0xCD,0x32,0x1A,0xDE,0x1A,
-  0xCD,0x01,0x2F,0x33,0x33,0x2F,0x33,0x12,0x39,0x11,0x33,0x33,0x11,0x33,0x2F,0x5D,
-  0xE1,0x33,0x2F,0xE1,0x30,0x31,0x01,0x23,0x26,0x26,0x27,0x06,0x06,0x07,0x23,0x35,
-  0x36,0x36,0x37,0x33,0x16,0x16,0x17,0x27,0x3E,0x03,0x37,0x33,0x15,0x06,0x06,0x07,
-  0x23,0x03,0x2B,0x64,0x33,0x6C,0x34,0x36,0x6A,0x33,0x65,0x33,0x74,0x30,0xC1,0x30,
-  0x74,0x33,0x4E,0x14,0x20,0x1E,0x1D,0x10,0xB4,0x2D,0x6A,0x37,0x65,0x04,0xD9,0x22,
-  0x54,0x30,0x30,0x54,0x22,0x1B,0x3B,0x84,0x45,0x45,0x84,0x3B,0xC2,0x1A,0x2C,0x2E,
-  0x34,0x21,0x15,0x3C,0x67,0x2B,0x00,0x02,0x00,0xBC,0x04,0xD9,0x04,0x10,0x06,0x7F,
-  0x00,0x10,0x00,0x1C,0x00,0x44,0x40,0x23,0x17,0x88,0x16,0x40,0x12,0x82,0x30,0x11,
-  0x40,0x11,0x60,0x11,0x03,0x11,0x11,0x03,0x03,0x04,0x0C,0x0C,0x10,0x09,0x08,0x08,
-  0x0F,0x10,0x17,0x80,0x12,0x40,0x0C,0x03,0x80,0x09,0x0F,0x00,0x2F,0x33,0x1A,0xCD,
-  0x32,0x1A,0xDC,0x1A,0xCD,0x01,0x2F,0x33,0x33,0x2F,0x33,0x12,0x39,0x11,0x33,0x33,
-  0x11,0x33,0x2F,0x5D,0xE1,0x1A,0xDD,0xE1,0x30,0x31,0x01,0x36,0x36,0x37,0x33,0x16,
-  0x16,0x17,0x15,0x23,0x26,0x26,0x27,0x06,0x06,0x07,0x23,0x37,0x23,0x26,0x26,0x27,
-  0x35,0x33,0x1E,0x03,0x17,0x01,0xA2,0x33,0x74,0x30,0xC0,0x30,0x74,0x33,0x64,0x33,
-  0x6A,0x36,0x35,0x6B,0x33,0x64,0x4E,0x65,0x37,0x6B,0x2D,0xB5,0x10,0x1D,0x1D,0x21,
-  0x14,0x04,0xF4,0x3B,0x84,0x45,0x45,0x84,0x3B,0x1B,0x22,0x54,0x30,0x30,0x54,0x22,
-  0xC3,0x2B,0x67,0x3C,0x15,0x21,0x34,0x2E,0x2C,0x1A,0x00,0x02,0x00,0xDD,0x04,0xD9,
-  0x03,0xF0,0x06,0xF8,0x00,0x10,0x00,0x29,0x00,0x5F,0x40,0x34,0x17,0x82,0x18,0x18,
-  0x24,0x1C,0x82,0x0F,0x11,0x1F,0x11,0x02,0x11,0x11,0x0F,0x24,0x1F,0x24,0x02,0x24,
-  0x40,0x0C,0x0F,0x48,0x24,0x24,0x0D,0x0D,0x0C,0x04,0x04,0x08,0x01,0x00,0x00,0x07,
-  0x08,0x16,0x19,0x19,0x18,0x21,0x8C,0x27,0x27,0x18,0x40,0x04,0x0C,0x80,0x01,0x07,
-  0x00,0x2F,0x33,0x1A,0xCD,0x32,0x1A,0xCC,0x32,0x2F,0xED,0x12,0x39,0x2F,0x33,0x01,
-  0x2F,0x33,0x33,0x2F,0x33,0x12,0x39,0x11,0x33,0x33,0x11,0x33,0x2F,0x2B,0x5D,0x33,
-  0x2F,0x5D,0xE1,0x11,0x39,0x2F,0xE1,0x30,0x31,0x01,0x23,0x26,0x26,0x27,0x06,0x06,
-  0x07,0x23,0x35,0x36,0x36,0x37,0x33,0x16,0x16,0x17,0x13,0x14,0x0E,0x02,0x07,0x07,
-  0x23,0x27,0x36,0x36,0x35,0x34,0x2E,0x02,0x23,0x22,0x06,0x07,0x35,0x36,0x33,0x32,
-  0x16,0x03,0x4C,0x65,0x33,0x6B,0x35,0x36,0x69,0x33,0x65,0x33,0x74,0x30,0xC1,0x30,
-  0x74,0x33,0xA4,0x14,0x23,0x2D,0x19,0x06,0x56,0x0B,0x38,0x41,0x0F,0x1B,0x25,0x15,
-  0x16,0x27,0x0B,0x15,0x3B,0x63,0x64,0x04,0xD9,0x22,0x54,0x30,0x30,0x54,0x22,0x1B,
-  0x3B,0x84,0x45,0x45,0x84,0x3B,0x01,0x76,0x1D,0x2B,0x1E,0x15,0x06,0x51,0x83,0x09,
-  0x1F,0x25,0x13,0x18,0x0E,0x05,0x03,0x03,0x52,0x06,0x45,0x00,0x00,0x02,0x01,0x23,
-  0x04,0xD9,0x03,0xA8,0x07,0x10,0x00,0x10,0x00,0x2C,0x00,0x66,0x40,0x24,0x14,0x1A,
-  0x27,0x82,0x28,0x22,0x19,0x28,0x04,0x03,0x0C,0x0C,0x10,0x09,0x08,0x08,0x0F,0x28,
-  0x1F,0x28,0x2F,0x28,0x03,0x28,0x28,0x19,0x82,0x1A,0x0F,0x10,0x10,0x1A,0x27,0x27,
-  0x1F,0x1F,0xB8,0x01,0x01,0xB3,0x16,0x19,0x40,0x24,0xB8,0x01,0x01,0xB7,0x11,0x11,
-  0x19,0x0C,0x03,0x80,0x09,0x0F,0x00,0x2F,0x33,0x1A,0xDD,0x32,0xC6,0x32,0x2F,0xE1,
-  0x1A,0x10,0xDA,0xE1,0x2F,0x32,0x2F,0x01,0x2F,0x33,0x2F,0x33,0x10,0xED,0x33,0x2F,
-  0x5D,0x33,0x2F,0x33,0x12,0x39,0x11,0x33,0x33,0x11,0x12,0x39,0x10,0xED,0x11,0x39,
-  0x31,0x30,0x01,0x36,0x36,0x37,0x33,0x16,0x16,0x17,0x15,0x23,0x26,0x26,0x27,0x06,
-  0x06,0x07,0x23,0x01,0x22,0x2E,0x02,0x23,0x22,0x06,0x07,0x23,0x3E,0x03,0x33,0x32,
-  0x1E,0x02,0x33,0x32,0x36,0x37,0x33,0x0E,0x03,0x01,0x2D,0x33,0x74,0x30,0xC1,0x30,
-  0x74,0x33,0x65,0x33,0x6A,0x36,0x34,0x6C,0x33,0x64,0x01,0xBF,0x24,0x48,0x45,0x3F,
-  0x1D,0x28,0x2A,0x0E,0x5C,0x05,0x1C,0x30,0x42,0x29,0x26,0x4A,0x45,0x3E,0x1A,0x28,
-  0x2A,0x0E,0x5C,0x04,0x1D,0x30,0x42,0x04,0xF4,0x3B,0x84,0x45,0x45,0x84,0x3B,0x1B,
-  0x22,0x54,0x30,0x30,0x54,0x22,0x01,0x5A,0x1C,0x22,0x1C,0x2A,0x32,0x30,0x51,0x3B,
-  0x21,0x1C,0x22,0x1C,0x2B,0x31,0x30,0x51,0x3B,0x21,0x00,0x02,0x01,0x39,0x04,0xD9,
-  0x03,0x93,0x06,0xC1,0x00,0x0B,0x00,0x1F,0x00,0x2D,0x40,0x16,0x00,0x0B,0x01,0x0B,
-  0x40,0x07,0x1F,0x83,0x0C,0x0C,0x15,0x83,0x14,0x05,0x80,0x0B,0x0B,0x1F,0x14,0x1A,
-  0x8F,0x11,0x00,0x2F,0xFD,0xCC,0x32,0x32,0x2F,0x1A,0xCC,0x01,0x2F,0xE1,0x33,0x2F,
-  0xE1,0xD6,0x1A,0xCD,0x5D,0x30,0x31,0x01,0x3E,0x03,0x37,0x33,0x15,0x06,0x06,0x07,
-  0x23,0x25,0x0E,0x03,0x23,0x22,0x26,0x27,0x33,0x1E,0x03,0x33,0x32,0x3E,0x02,0x37,
-  0x02,0x25,0x14,0x20,0x1E,0x1D,0x10,0xB4,0x2D,0x6A,0x38,0x64,0x01,0x6E,0x04,0x2C,
-  0x4C,0x6E,0x47,0x92,0x90,0x07,0x6D,0x04,0x1B,0x30,0x44,0x2B,0x24,0x42,0x33,0x22,
-  0x04,0x05,0xF8,0x19,0x2C,0x2E,0x35,0x21,0x15,0x3C,0x67,0x2C,0x06,0x3C,0x63,0x45,
-  0x26,0x8B,0x7F,0x2B,0x31,0x1A,0x07,0x09,0x1B,0x31,0x28,0x00,0x00,0x02,0x01,0x39,
-  0x04,0xD9,0x03,0x93,0x06,0xC1,0x00,0x0B,0x00,0x1F,0x00,0x2F,0x40,0x17,0x1F,0x83,
-  0x0C,0x0C,0x14,0x0F,0x00,0x01,0x00,0x40,0x04,0x15,0x83,0x14,0x05,0x80,0x01,0x01,
-  0x1F,0x14,0x1A,0x8F,0x11,0x00,0x2F,0xFD,0xCC,0x32,0x32,0x2F,0x1A,0xCD,0x01,0x2F,
-  0xE1,0xD6,0x1A,0xCD,0x5D,0x11,0x33,0x2F,0xE1,0x30,0x31,0x01,0x23,0x26,0x26,0x27,
-  0x35,0x33,0x1E,0x03,0x17,0x17,0x0E,0x03,0x23,0x22,0x26,0x27,0x33,0x1E,0x03,0x33,
-  0x32,0x3E,0x02,0x37,0x02,0x98,0x65,0x38,0x6A,0x2D,0xB5,0x10,0x1D,0x1D,0x21,0x14,
-  0xFB,0x04,0x2C,0x4C,0x6E,0x47,0x92,0x90,0x07,0x6D,0x04,0x1B,0x30,0x44,0x2B,0x24,
-  0x42,0x33,0x22,0x04,0x05,0xDD,0x2C,0x67,0x3C,0x15,0x21,0x35,0x2E,0x2C,0x19,0x15,
-  0x3C,0x63,0x45,0x26,0x8B,0x7F,0x2B,0x31,0x1A,0x07,0x09,0x1B,0x31,0x28,0x00,0x02,
-  0x01,0x39,0x04,0xD9,0x03,0x93,0x07,0x06,0x00,0x13,0x00,0x2B,0x00,0x56,0x40,0x30,
-  0x1A,0x1A,0x1B,0x1B,0x25,0x25,0x1F,0x14,0x40,0x09,0x0C,0x48,0x14,0x14,0x00,0x09,
-  0x83,0x08,0x13,0x83,0x1F,0x00,0x01,0x00,0x19,0x1C,0x1C,0x1B,0x22,0x8C,0x29,0x80,
-  0x8F,0x1B,0x9F,0x1B,0xAF,0x1B,0x03,0x1B,0x1B,0x0E,0x13,0x08,0x08,0x0E,0x8F,0x05,
-  0x00,0x2F,0xF1,0xC8,0x2F,0x32,0x10,0xCA,0x2F,0x5D,0x1A,0xDC,0xE1,0x12,0x39,0x11,
-  0x33,0x01,0x2F,0x5D,0xE1,0x2F,0xE1,0x12,0x39,0x2F,0x2B,0xC1,0x33,0x2F,0x39,0x2F,
-  0x33,0x2F,0x30,0x31,0x01,0x0E,0x03,0x23,0x22,0x26,0x27,0x33,0x1E,0x03,0x33,0x32,
-  0x3E,0x02,0x37,0x27,0x14,0x0E,0x02,0x07,0x07,0x23,0x27,0x36,0x36,0x35,0x34,0x26,
-  0x23,0x22,0x06,0x07,0x35,0x36,0x36,0x33,0x32,0x16,0x03,0x93,0x04,0x2C,0x4C,0x6E,
-  0x47,0x92,0x90,0x07,0x6D,0x04,0x1B,0x30,0x44,0x2B,0x24,0x42,0x33,0x22,0x04,0x2B,
-  0x14,0x23,0x2D,0x19,0x06,0x56,0x0B,0x38,0x41,0x39,0x2B,0x16,0x27,0x0B,0x0B,0x26,
-  0x1F,0x63,0x64,0x05,0xE3,0x3C,0x63,0x45,0x26,0x8B,0x7F,0x2B,0x31,0x1A,0x07,0x09,
-  0x1B,0x31,0x28,0x96,0x1D,0x2B,0x1F,0x14,0x06,0x29,0x5A,0x09,0x20,0x25,0x25,0x18,
-  0x03,0x03,0x52,0x03,0x03,0x45,0x00,0x02,0x01,0x23,0x04,0xD9,0x03,0xA8,0x07,0x10,
-  0x00,0x13,0x00,0x2F,0x00,0x58,0x40,0x18,0x19,0x22,0x14,0x27,0x22,0x27,0x2B,0x1C,
-  0x82,0x1D,0x1D,0x09,0x83,0x08,0x2A,0x82,0x2B,0x2B,0x13,0x83,0x00,0x2A,0x2A,0x22,
-  0xB8,0x01,0x01,0xB2,0x19,0x1D,0x27,0xB8,0x01,0x01,0x40,0x0C,0x40,0x14,0x14,0x1D,
-  0x08,0x13,0x13,0x08,0x80,0x0E,0x8F,0x05,0x00,0x2F,0xE1,0x1A,0xCD,0x32,0x2F,0x10,
-  0xC6,0x32,0x2F,0x1A,0xED,0x10,0xDC,0xED,0x32,0x2F,0x01,0x2F,0xE1,0x33,0x2F,0xE1,
-  0x2F,0xE1,0x33,0x2F,0xE1,0x12,0x39,0x39,0x11,0x33,0x11,0x33,0x31,0x30,0x01,0x0E,
-  0x03,0x23,0x22,0x26,0x27,0x33,0x1E,0x03,0x33,0x32,0x3E,0x02,0x37,0x27,0x22,0x2E,
-  0x02,0x23,0x22,0x06,0x07,0x23,0x3E,0x03,0x33,0x32,0x1E,0x02,0x33,0x32,0x36,0x37,
-  0x33,0x0E,0x03,0x03,0x8B,0x04,0x2C,0x4C,0x6E,0x47,0x92,0x91,0x06,0x6D,0x04,0x1B,
-  0x30,0x43,0x2C,0x24,0x41,0x33,0x22,0x05,0x2F,0x24,0x48,0x45,0x3F,0x1D,0x28,0x2A,
-  0x0E,0x5C,0x05,0x1C,0x30,0x42,0x29,0x26,0x4A,0x45,0x3E,0x1A,0x28,0x2A,0x0E,0x5C,
-  0x04,0x1D,0x30,0x42,0x05,0xE3,0x3C,0x63,0x45,0x26,0x8B,0x7F,0x2B,0x31,0x1A,0x07,
-  0x09,0x1B,0x31,0x28,0x50,0x1C,0x22,0x1C,0x2A,0x32,0x30,0x51,0x3B,0x21,0x1C,0x22,
-  0x1C,0x2B,0x31,0x30,0x51,0x3B,0x21,0x00,0x00,0x01,0x01,0xC7,0xFE,0x42,0x03,0x06,
-  0x00,0x00,0x00,0x14,0x00,0x22,0x40,0x12,0x03,0x0F,0x02,0x1F,0x02,0x2F,0x02,0x03,
-  0x02,0x02,0x0E,0x08,0x84,0x00,0x12,0x8E,0x0B,0x02,0x00,0x2F,0x2F,0xE1,0x01,0x2F,
-  0xED,0xCC,0x33,0x2F,0x5D,0x33,0x30,0x31,0x05,0x34,0x27,0x33,0x1E,0x03,0x15,0x14,
-  0x06,0x23,0x22,0x26,0x27,0x35,0x16,0x16,0x33,0x32,0x36,0x02,0x71,0x8C,0x81,0x1A,
-  0x39,0x2F,0x1E,0x64,0x65,0x1D,0x3F,0x1A,0x0E,0x2D,0x19,0x22,0x34,0xEE,0x6A,0x84,
-  0x13,0x34,0x40,0x4B,0x2A,0x5A,0x68,0x08,0x08,0x71,0x04,0x05,0x2B,0x00,0x00,0x01,
-  0x01,0xB2,0xFE,0x6D,0x03,0x19,0x00,0xA6,0x00,0x11,0x00,0x18,0x40,0x0A,0x09,0x01,
-  0x49,0x10,0x0A,0x0D,0x50,0x09,0x06,0x00,0x00,0x2F,0x2F,0x33,0xE1,0x32,0x01,0x2F,
-  0xE1,0xCC,0x30,0x31,0x25,0x11,0x0E,0x03,0x23,0x22,0x26,0x27,0x35,0x16,0x16,0x33,
-  0x32,0x36,0x35,0x11,0x03,0x19,0x01,0x1A,0x39,0x59,0x3F,0x26,0x3F,0x16,0x0E,0x3B,
-  0x22,0x2E,0x32,0xA6,0xFE,0xD9,0x42,0x66,0x46,0x24,0x11,0x09,0x96,0x07,0x0E,0x31,
-  0x31,0x01,0x3C,0x00,0x00,0x01,0x01,0xB2,0xFE,0x6D,0x03,0x19,0x00,0x9A,0x00,0x11,
-  0x00,0x18,0x40,0x0A,0x09,0x01,0x49,0x10,0x0A,0x0D,0x50,0x09,0x06,0x00,0x00,0x2F,
-  0x2F,0x33,0xED,0x32,0x01,0x2F,0xE1,0xCC,0x30,0x31,0x25,0x11,0x0E,0x03,0x23,0x22,
-  0x26,0x27,0x35,0x16,0x16,0x33,0x32,0x36,0x35,0x11,0x03,0x19,0x01,0x1A,0x39,0x59,
-  0x3F,0x26,0x3F,0x16,0x0E,0x3B,0x22,0x2E,0x32,0x9A,0xFE,0xE5,0x42,0x66,0x46,0x24,
-  0x11,0x09,0x96,0x07,0x0E,0x31,0x31,0x01,0x30,0x00,0xFF,0xFF,0x00,0x66,0xFE,0x14,
-  0x04,0x64,0x05,0xB6,0x02,0x26,0x00,0x37,0x00,0x00,0x01,0x06,0x00,0x7A,0x00,0x00,
-  0x00,0x0B,0xB6,0x01,0x19,0x10,0x11,0x01,0x00,0x25,0x01,0x2B,0x35,0x00,0xFF,0xFF,
-  0x00,0x8B,0xFE,0x14,0x04,0x02,0x05,0x6F,0x02,0x26,0x00,0x57,0x00,0x00,0x01,0x06,
-  0x00,0x7A,0x28,0x00,0x00,0x0E,0xB9,0x00,0x01,0xFF,0xC5,0xB4,0x15,0x20,0x05,0x01,
-  0x25,0x01,0x2B,0x35,0x00,0x00,0x00,0x1B,0x01,0x4A,0x00,0x01,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x34,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x0F,
-  0x00,0x34,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x07,0x00,0x43,0x00,0x01,
-  0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x1A,0x00,0x4A,0x00,0x01,0x00,0x00,0x00,0x00,
-  0x00,0x04,0x00,0x0F,0x00,0x34,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x0C,
-  0x00,0x64,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x0D,0x00,0x70,0x00,0x01,
-  0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x4E,0x00,0x7D,0x00,0x01,0x00,0x00,0x00,0x00,
-  0x00,0x08,0x00,0x14,0x00,0xCB,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0A,0x00,0x67,
-  0x00,0xDF,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0D,0x00,0x2E,0x01,0x46,0x00,0x01,
-  0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x2A,0x01,0x74,0x00,0x01,0x00,0x00,0x00,0x00,
-  0x00,0x12,0x00,0x0F,0x00,0x34,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x00,0x00,0x68,
-  0x01,0x9E,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x01,0x00,0x1E,0x02,0x06,0x00,0x03,
-  0x00,0x01,0x04,0x09,0x00,0x02,0x00,0x0E,0x02,0x24,0x00,0x03,0x00,0x01,0x04,0x09,
-  0x00,0x03,0x00,0x34,0x02,0x32,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x04,0x00,0x1E,
-  0x02,0x06,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x05,0x00,0x2C,0x02,0x66,0x00,0x03,
-  0x00,0x01,0x04,0x09,0x00,0x06,0x00,0x1A,0x02,0x92,0x00,0x03,0x00,0x01,0x04,0x09,
-  0x00,0x07,0x00,0x9C,0x02,0xAC,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x08,0x00,0x28,
-  0x03,0x48,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x0A,0x00,0xCE,0x03,0x70,0x00,0x03,
-  0x00,0x01,0x04,0x09,0x00,0x0B,0x00,0x38,0x04,0x3E,0x00,0x03,0x00,0x01,0x04,0x09,
-  0x00,0x0C,0x00,0x5C,0x04,0x76,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x0D,0x00,0x5C,
-  0x04,0xD2,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x0E,0x00,0x54,0x05,0x2E,0x44,0x69,
-  0x67,0x69,0x74,0x69,0x7A,0x65,0x64,0x20,0x64,0x61,0x74,0x61,0x20,0x63,0x6F,0x70,
-  0x79,0x72,0x69,0x67,0x68,0x74,0x20,0xA9,0x20,0x32,0x30,0x30,0x37,0x2C,0x20,0x47,
-  0x6F,0x6F,0x67,0x6C,0x65,0x20,0x43,0x6F,0x72,0x70,0x6F,0x72,0x61,0x74,0x69,0x6F,
-  0x6E,0x2E,0x44,0x72,0x6F,0x69,0x64,0x20,0x53,0x61,0x6E,0x73,0x20,0x4D,0x6F,0x6E,
-  0x6F,0x52,0x65,0x67,0x75,0x6C,0x61,0x72,0x41,0x73,0x63,0x65,0x6E,0x64,0x65,0x72,
-  0x20,0x2D,0x20,0x44,0x72,0x6F,0x69,0x64,0x20,0x53,0x61,0x6E,0x73,0x20,0x4D,0x6F,
-  0x6E,0x6F,0x56,0x65,0x72,0x73,0x69,0x6F,0x6E,0x20,0x31,0x2E,0x30,0x30,0x44,0x72,
-  0x6F,0x69,0x64,0x53,0x61,0x6E,0x73,0x4D,0x6F,0x6E,0x6F,0x44,0x72,0x6F,0x69,0x64,
-  0x20,0x69,0x73,0x20,0x61,0x20,0x74,0x72,0x61,0x64,0x65,0x6D,0x61,0x72,0x6B,0x20,
-  0x6F,0x66,0x20,0x47,0x6F,0x6F,0x67,0x6C,0x65,0x20,0x61,0x6E,0x64,0x20,0x6D,0x61,
-  0x79,0x20,0x62,0x65,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x65,0x64,0x20,
-  0x69,0x6E,0x20,0x63,0x65,0x72,0x74,0x61,0x69,0x6E,0x20,0x6A,0x75,0x72,0x69,0x73,
-  0x64,0x69,0x63,0x74,0x69,0x6F,0x6E,0x73,0x2E,0x41,0x73,0x63,0x65,0x6E,0x64,0x65,
-  0x72,0x20,0x43,0x6F,0x72,0x70,0x6F,0x72,0x61,0x74,0x69,0x6F,0x6E,0x44,0x72,0x6F,
-  0x69,0x64,0x20,0x53,0x61,0x6E,0x73,0x20,0x69,0x73,0x20,0x61,0x20,0x68,0x75,0x6D,
-  0x61,0x6E,0x69,0x73,0x74,0x20,0x73,0x61,0x6E,0x73,0x20,0x73,0x65,0x72,0x69,0x66,
-  0x20,0x74,0x79,0x70,0x65,0x66,0x61,0x63,0x65,0x20,0x64,0x65,0x73,0x69,0x67,0x6E,
-  0x65,0x64,0x20,0x66,0x6F,0x72,0x20,0x75,0x73,0x65,0x72,0x20,0x69,0x6E,0x74,0x65,
-  0x72,0x66,0x61,0x63,0x65,0x73,0x20,0x61,0x6E,0x64,0x20,0x65,0x6C,0x65,0x63,0x74,
-  0x72,0x6F,0x6E,0x69,0x63,0x20,0x63,0x6F,0x6D,0x6D,0x75,0x6E,0x69,0x63,0x61,0x74,
-  0x69,0x6F,0x6E,0x2E,0x4C,0x69,0x63,0x65,0x6E,0x73,0x65,0x64,0x20,0x75,0x6E,0x64,
-  0x65,0x72,0x20,0x74,0x68,0x65,0x20,0x41,0x70,0x61,0x63,0x68,0x65,0x20,0x4C,0x69,
-  0x63,0x65,0x6E,0x73,0x65,0x2C,0x20,0x56,0x65,0x72,0x73,0x69,0x6F,0x6E,0x20,0x32,
-  0x2E,0x30,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x77,0x77,0x77,0x2E,0x61,0x70,0x61,
-  0x63,0x68,0x65,0x2E,0x6F,0x72,0x67,0x2F,0x6C,0x69,0x63,0x65,0x6E,0x73,0x65,0x73,
-  0x2F,0x4C,0x49,0x43,0x45,0x4E,0x53,0x45,0x2D,0x32,0x2E,0x30,0x00,0x44,0x00,0x69,
-  0x00,0x67,0x00,0x69,0x00,0x74,0x00,0x69,0x00,0x7A,0x00,0x65,0x00,0x64,0x00,0x20,
-  0x00,0x64,0x00,0x61,0x00,0x74,0x00,0x61,0x00,0x20,0x00,0x63,0x00,0x6F,0x00,0x70,
-  0x00,0x79,0x00,0x72,0x00,0x69,0x00,0x67,0x00,0x68,0x00,0x74,0x00,0x20,0x00,0xA9,
-  0x00,0x20,0x00,0x32,0x00,0x30,0x00,0x30,0x00,0x37,0x00,0x2C,0x00,0x20,0x00,0x47,
-  0x00,0x6F,0x00,0x6F,0x00,0x67,0x00,0x6C,0x00,0x65,0x00,0x20,0x00,0x43,0x00,0x6F,
-  0x00,0x72,0x00,0x70,0x00,0x6F,0x00,0x72,0x00,0x61,0x00,0x74,0x00,0x69,0x00,0x6F,
-  0x00,0x6E,0x00,0x2E,0x00,0x44,0x00,0x72,0x00,0x6F,0x00,0x69,0x00,0x64,0x00,0x20,
-  0x00,0x53,0x00,0x61,0x00,0x6E,0x00,0x73,0x00,0x20,0x00,0x4D,0x00,0x6F,0x00,0x6E,
-  0x00,0x6F,0x00,0x52,0x00,0x65,0x00,0x67,0x00,0x75,0x00,0x6C,0x00,0x61,0x00,0x72,
-  0x00,0x41,0x00,0x73,0x00,0x63,0x00,0x65,0x00,0x6E,0x00,0x64,0x00,0x65,0x00,0x72,
-  0x00,0x20,0x00,0x2D,0x00,0x20,0x00,0x44,0x00,0x72,0x00,0x6F,0x00,0x69,0x00,0x64,
-  0x00,0x20,0x00,0x53,0x00,0x61,0x00,0x6E,0x00,0x73,0x00,0x20,0x00,0x4D,0x00,0x6F,
-  0x00,0x6E,0x00,0x6F,0x00,0x56,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x69,0x00,0x6F,
-  0x00,0x6E,0x00,0x20,0x00,0x31,0x00,0x2E,0x00,0x30,0x00,0x30,0x00,0x20,0x00,0x62,
-  0x00,0x75,0x00,0x69,0x00,0x6C,0x00,0x64,0x00,0x20,0x00,0x31,0x00,0x31,0x00,0x33,
-  0x00,0x44,0x00,0x72,0x00,0x6F,0x00,0x69,0x00,0x64,0x00,0x53,0x00,0x61,0x00,0x6E,
-  0x00,0x73,0x00,0x4D,0x00,0x6F,0x00,0x6E,0x00,0x6F,0x00,0x44,0x00,0x72,0x00,0x6F,
-  0x00,0x69,0x00,0x64,0x00,0x20,0x00,0x69,0x00,0x73,0x00,0x20,0x00,0x61,0x00,0x20,
-  0x00,0x74,0x00,0x72,0x00,0x61,0x00,0x64,0x00,0x65,0x00,0x6D,0x00,0x61,0x00,0x72,
-  0x00,0x6B,0x00,0x20,0x00,0x6F,0x00,0x66,0x00,0x20,0x00,0x47,0x00,0x6F,0x00,0x6F,
-  0x00,0x67,0x00,0x6C,0x00,0x65,0x00,0x20,0x00,0x61,0x00,0x6E,0x00,0x64,0x00,0x20,
-  0x00,0x6D,0x00,0x61,0x00,0x79,0x00,0x20,0x00,0x62,0x00,0x65,0x00,0x20,0x00,0x72,
-  0x00,0x65,0x00,0x67,0x00,0x69,0x00,0x73,0x00,0x74,0x00,0x65,0x00,0x72,0x00,0x65,
-  0x00,0x64,0x00,0x20,0x00,0x69,0x00,0x6E,0x00,0x20,0x00,0x63,0x00,0x65,0x00,0x72,
-  0x00,0x74,0x00,0x61,0x00,0x69,0x00,0x6E,0x00,0x20,0x00,0x6A,0x00,0x75,0x00,0x72,
-  0x00,0x69,0x00,0x73,0x00,0x64,0x00,0x69,0x00,0x63,0x00,0x74,0x00,0x69,0x00,0x6F,
-  0x00,0x6E,0x00,0x73,0x00,0x2E,0x00,0x41,0x00,0x73,0x00,0x63,0x00,0x65,0x00,0x6E,
-  0x00,0x64,0x00,0x65,0x00,0x72,0x00,0x20,0x00,0x43,0x00,0x6F,0x00,0x72,0x00,0x70,
-  0x00,0x6F,0x00,0x72,0x00,0x61,0x00,0x74,0x00,0x69,0x00,0x6F,0x00,0x6E,0x00,0x44,
-  0x00,0x72,0x00,0x6F,0x00,0x69,0x00,0x64,0x00,0x20,0x00,0x53,0x00,0x61,0x00,0x6E,
-  0x00,0x73,0x00,0x20,0x00,0x69,0x00,0x73,0x00,0x20,0x00,0x61,0x00,0x20,0x00,0x68,
-  0x00,0x75,0x00,0x6D,0x00,0x61,0x00,0x6E,0x00,0x69,0x00,0x73,0x00,0x74,0x00,0x20,
-  0x00,0x73,0x00,0x61,0x00,0x6E,0x00,0x73,0x00,0x20,0x00,0x73,0x00,0x65,0x00,0x72,
-  0x00,0x69,0x00,0x66,0x00,0x20,0x00,0x74,0x00,0x79,0x00,0x70,0x00,0x65,0x00,0x66,
-  0x00,0x61,0x00,0x63,0x00,0x65,0x00,0x20,0x00,0x64,0x00,0x65,0x00,0x73,0x00,0x69,
-  0x00,0x67,0x00,0x6E,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x66,0x00,0x6F,0x00,0x72,
-  0x00,0x20,0x00,0x75,0x00,0x73,0x00,0x65,0x00,0x72,0x00,0x20,0x00,0x69,0x00,0x6E,
-  0x00,0x74,0x00,0x65,0x00,0x72,0x00,0x66,0x00,0x61,0x00,0x63,0x00,0x65,0x00,0x73,
-  0x00,0x20,0x00,0x61,0x00,0x6E,0x00,0x64,0x00,0x20,0x00,0x65,0x00,0x6C,0x00,0x65,
-  0x00,0x63,0x00,0x74,0x00,0x72,0x00,0x6F,0x00,0x6E,0x00,0x69,0x00,0x63,0x00,0x20,
-  0x00,0x63,0x00,0x6F,0x00,0x6D,0x00,0x6D,0x00,0x75,0x00,0x6E,0x00,0x69,0x00,0x63,
-  0x00,0x61,0x00,0x74,0x00,0x69,0x00,0x6F,0x00,0x6E,0x00,0x2E,0x00,0x68,0x00,0x74,
-  0x00,0x74,0x00,0x70,0x00,0x3A,0x00,0x2F,0x00,0x2F,0x00,0x77,0x00,0x77,0x00,0x77,
-  0x00,0x2E,0x00,0x61,0x00,0x73,0x00,0x63,0x00,0x65,0x00,0x6E,0x00,0x64,0x00,0x65,
-  0x00,0x72,0x00,0x63,0x00,0x6F,0x00,0x72,0x00,0x70,0x00,0x2E,0x00,0x63,0x00,0x6F,
-  0x00,0x6D,0x00,0x2F,0x00,0x68,0x00,0x74,0x00,0x74,0x00,0x70,0x00,0x3A,0x00,0x2F,
-  0x00,0x2F,0x00,0x77,0x00,0x77,0x00,0x77,0x00,0x2E,0x00,0x61,0x00,0x73,0x00,0x63,
-  0x00,0x65,0x00,0x6E,0x00,0x64,0x00,0x65,0x00,0x72,0x00,0x63,0x00,0x6F,0x00,0x72,
-  0x00,0x70,0x00,0x2E,0x00,0x63,0x00,0x6F,0x00,0x6D,0x00,0x2F,0x00,0x74,0x00,0x79,
-  0x00,0x70,0x00,0x65,0x00,0x64,0x00,0x65,0x00,0x73,0x00,0x69,0x00,0x67,0x00,0x6E,
-  0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x2E,0x00,0x68,0x00,0x74,0x00,0x6D,0x00,0x6C,
-  0x00,0x4C,0x00,0x69,0x00,0x63,0x00,0x65,0x00,0x6E,0x00,0x73,0x00,0x65,0x00,0x64,
-  0x00,0x20,0x00,0x75,0x00,0x6E,0x00,0x64,0x00,0x65,0x00,0x72,0x00,0x20,0x00,0x74,
-  0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x41,0x00,0x70,0x00,0x61,0x00,0x63,0x00,0x68,
-  0x00,0x65,0x00,0x20,0x00,0x4C,0x00,0x69,0x00,0x63,0x00,0x65,0x00,0x6E,0x00,0x73,
-  0x00,0x65,0x00,0x2C,0x00,0x20,0x00,0x56,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x69,
-  0x00,0x6F,0x00,0x6E,0x00,0x20,0x00,0x32,0x00,0x2E,0x00,0x30,0x00,0x68,0x00,0x74,
-  0x00,0x74,0x00,0x70,0x00,0x3A,0x00,0x2F,0x00,0x2F,0x00,0x77,0x00,0x77,0x00,0x77,
-  0x00,0x2E,0x00,0x61,0x00,0x70,0x00,0x61,0x00,0x63,0x00,0x68,0x00,0x65,0x00,0x2E,
-  0x00,0x6F,0x00,0x72,0x00,0x67,0x00,0x2F,0x00,0x6C,0x00,0x69,0x00,0x63,0x00,0x65,
-  0x00,0x6E,0x00,0x73,0x00,0x65,0x00,0x73,0x00,0x2F,0x00,0x4C,0x00,0x49,0x00,0x43,
-  0x00,0x45,0x00,0x4E,0x00,0x53,0x00,0x45,0x00,0x2D,0x00,0x32,0x00,0x2E,0x00,0x30,
-  0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x66,0x00,0x66,0x00,0x00,0x00,0x01,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x03,0x84,0x00,0x00,0x01,0x02,0x00,0x02,0x00,0x03,0x00,0x04,0x00,0x05,0x00,0x06,
-  0x00,0x07,0x00,0x08,0x00,0x09,0x00,0x0A,0x00,0x0B,0x00,0x0C,0x00,0x0D,0x00,0x0E,
-  0x00,0x0F,0x00,0x10,0x00,0x11,0x00,0x12,0x00,0x13,0x00,0x14,0x00,0x15,0x00,0x16,
-  0x00,0x17,0x00,0x18,0x00,0x19,0x00,0x1A,0x00,0x1B,0x00,0x1C,0x00,0x1D,0x00,0x1E,
-  0x00,0x1F,0x00,0x20,0x00,0x21,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x26,
-  0x00,0x27,0x00,0x28,0x00,0x29,0x00,0x2A,0x00,0x2B,0x00,0x2C,0x00,0x2D,0x00,0x2E,
-  0x00,0x2F,0x00,0x30,0x00,0x31,0x00,0x32,0x00,0x33,0x00,0x34,0x00,0x35,0x00,0x36,
-  0x00,0x37,0x00,0x38,0x00,0x39,0x00,0x3A,0x00,0x3B,0x00,0x3C,0x00,0x3D,0x00,0x3E,
-  0x00,0x3F,0x00,0x40,0x00,0x41,0x00,0x42,0x00,0x43,0x00,0x44,0x00,0x45,0x00,0x46,
-  0x00,0x47,0x00,0x48,0x00,0x49,0x00,0x4A,0x00,0x4B,0x00,0x4C,0x00,0x4D,0x00,0x4E,
-  0x00,0x4F,0x00,0x50,0x00,0x51,0x00,0x52,0x00,0x53,0x00,0x54,0x00,0x55,0x00,0x56,
-  0x00,0x57,0x00,0x58,0x00,0x59,0x00,0x5A,0x00,0x5B,0x00,0x5C,0x00,0x5D,0x00,0x5E,
-  0x00,0x5F,0x00,0x60,0x00,0x61,0x00,0xAC,0x00,0xA3,0x00,0x84,0x00,0x85,0x00,0xBD,
-  0x00,0x96,0x00,0xE8,0x00,0x86,0x00,0x8E,0x00,0x8B,0x00,0x9D,0x00,0xA9,0x00,0xA4,
-  0x01,0x03,0x00,0x8A,0x01,0x04,0x00,0x83,0x00,0x93,0x00,0xF2,0x00,0xF3,0x00,0x8D,
-  0x00,0x97,0x00,0x88,0x01,0x05,0x00,0xDE,0x00,0xF1,0x00,0x9E,0x00,0xAA,0x00,0xF5,
-  0x00,0xF4,0x00,0xF6,0x00,0xA2,0x00,0xAD,0x00,0xC9,0x00,0xC7,0x00,0xAE,0x00,0x62,
-  0x00,0x63,0x00,0x90,0x00,0x64,0x00,0xCB,0x00,0x65,0x00,0xC8,0x00,0xCA,0x00,0xCF,
-  0x00,0xCC,0x00,0xCD,0x00,0xCE,0x00,0xE9,0x00,0x66,0x00,0xD3,0x00,0xD0,0x00,0xD1,
-  0x00,0xAF,0x00,0x67,0x00,0xF0,0x00,0x91,0x00,0xD6,0x00,0xD4,0x00,0xD5,0x00,0x68,
-  0x00,0xEB,0x00,0xED,0x00,0x89,0x00,0x6A,0x00,0x69,0x00,0x6B,0x00,0x6D,0x00,0x6C,
-  0x00,0x6E,0x00,0xA0,0x00,0x6F,0x00,0x71,0x00,0x70,0x00,0x72,0x00,0x73,0x00,0x75,
-  0x00,0x74,0x00,0x76,0x00,0x77,0x00,0xEA,0x00,0x78,0x00,0x7A,0x00,0x79,0x00,0x7B,
-  0x00,0x7D,0x00,0x7C,0x00,0xB8,0x00,0xA1,0x00,0x7F,0x00,0x7E,0x00,0x80,0x00,0x81,
-  0x00,0xEC,0x00,0xEE,0x00,0xBA,0x01,0x06,0x01,0x07,0x01,0x08,0x01,0x09,0x01,0x0A,
-  0x01,0x0B,0x00,0xFD,0x00,0xFE,0x01,0x0C,0x01,0x0D,0x01,0x0E,0x01,0x0F,0x00,0xFF,
-  0x01,0x00,0x01,0x10,0x01,0x11,0x01,0x12,0x01,0x13,0x01,0x14,0x01,0x15,0x01,0x16,
-  0x01,0x17,0x01,0x18,0x01,0x19,0x01,0x1A,0x01,0x1B,0x01,0x1C,0x01,0x1D,0x01,0x1E,
-  0x01,0x1F,0x00,0xF8,0x00,0xF9,0x01,0x20,0x01,0x21,0x01,0x22,0x01,0x23,0x01,0x24,
-  0x01,0x25,0x01,0x26,0x01,0x27,0x01,0x28,0x01,0x29,0x01,0x2A,0x01,0x2B,0x01,0x2C,
-  0x01,0x2D,0x01,0x2E,0x01,0x2F,0x01,0x30,0x00,0xD7,0x01,0x31,0x01,0x32,0x01,0x33,
-  0x01,0x34,0x01,0x35,0x01,0x36,0x01,0x37,0x01,0x38,0x01,0x39,0x01,0x3A,0x01,0x3B,
-  0x01,0x3C,0x01,0x3D,0x01,0x3E,0x01,0x3F,0x00,0xE2,0x00,0xE3,0x01,0x40,0x01,0x41,
-  0x01,0x42,0x01,0x43,0x01,0x44,0x01,0x45,0x01,0x46,0x01,0x47,0x01,0x48,0x01,0x49,
-  0x01,0x4A,0x01,0x4B,0x01,0x4C,0x01,0x4D,0x01,0x4E,0x00,0xB0,0x00,0xB1,0x01,0x4F,
-  0x01,0x50,0x01,0x51,0x01,0x52,0x01,0x53,0x01,0x54,0x01,0x55,0x01,0x56,0x01,0x57,
-  0x01,0x58,0x00,0xFB,0x00,0xFC,0x00,0xE4,0x00,0xE5,0x01,0x59,0x01,0x5A,0x01,0x5B,
-  0x01,0x5C,0x01,0x5D,0x01,0x5E,0x01,0x5F,0x01,0x60,0x01,0x61,0x01,0x62,0x01,0x63,
-  0x01,0x64,0x01,0x65,0x01,0x66,0x01,0x67,0x01,0x68,0x01,0x69,0x01,0x6A,0x01,0x6B,
-  0x01,0x6C,0x01,0x6D,0x01,0x6E,0x00,0xBB,0x01,0x6F,0x01,0x70,0x01,0x71,0x01,0x72,
-  0x00,0xE6,0x00,0xE7,0x01,0x73,0x00,0xA6,0x01,0x74,0x01,0x75,0x01,0x76,0x01,0x77,
-  0x01,0x78,0x01,0x79,0x01,0x7A,0x01,0x7B,0x00,0xD8,0x00,0xE1,0x01,0x7C,0x00,0xDB,
-  0x00,0xDC,0x00,0xDD,0x00,0xE0,0x00,0xD9,0x00,0xDF,0x01,0x7D,0x01,0x7E,0x01,0x7F,
-  0x01,0x80,0x01,0x81,0x01,0x82,0x01,0x83,0x01,0x84,0x01,0x85,0x01,0x86,0x01,0x87,
-  0x01,0x88,0x01,0x89,0x01,0x8A,0x01,0x8B,0x01,0x8C,0x01,0x8D,0x01,0x8E,0x01,0x8F,
-  0x01,0x90,0x01,0x91,0x01,0x92,0x01,0x93,0x01,0x94,0x01,0x95,0x01,0x96,0x01,0x97,
-  0x01,0x98,0x01,0x99,0x01,0x9A,0x01,0x9B,0x01,0x9C,0x01,0x9D,0x01,0x9E,0x01,0x9F,
-  0x01,0xA0,0x01,0xA1,0x01,0xA2,0x01,0xA3,0x01,0xA4,0x01,0xA5,0x01,0xA6,0x01,0xA7,
-  0x01,0xA8,0x01,0xA9,0x01,0xAA,0x01,0xAB,0x01,0xAC,0x01,0xAD,0x01,0xAE,0x01,0xAF,
-  0x01,0xB0,0x01,0xB1,0x01,0xB2,0x01,0xB3,0x01,0xB4,0x01,0xB5,0x00,0x9B,0x01,0xB6,
-  0x01,0xB7,0x01,0xB8,0x01,0xB9,0x01,0xBA,0x01,0xBB,0x01,0xBC,0x01,0xBD,0x01,0xBE,
-  0x01,0xBF,0x01,0xC0,0x01,0xC1,0x01,0xC2,0x01,0xC3,0x01,0xC4,0x01,0xC5,0x01,0xC6,
-  0x01,0xC7,0x01,0xC8,0x01,0xC9,0x01,0xCA,0x01,0xCB,0x01,0xCC,0x01,0xCD,0x01,0xCE,
-  0x01,0xCF,0x01,0xD0,0x01,0xD1,0x01,0xD2,0x01,0xD3,0x01,0xD4,0x01,0xD5,0x01,0xD6,
-  0x01,0xD7,0x01,0xD8,0x01,0xD9,0x01,0xDA,0x01,0xDB,0x01,0xDC,0x01,0xDD,0x01,0xDE,
-  0x01,0xDF,0x01,0xE0,0x01,0xE1,0x01,0xE2,0x01,0xE3,0x01,0xE4,0x01,0xE5,0x01,0xE6,
-  0x01,0xE7,0x01,0xE8,0x01,0xE9,0x01,0xEA,0x01,0xEB,0x01,0xEC,0x01,0xED,0x01,0xEE,
-  0x01,0xEF,0x01,0xF0,0x01,0xF1,0x01,0xF2,0x01,0xF3,0x01,0xF4,0x01,0xF5,0x01,0xF6,
-  0x01,0xF7,0x01,0xF8,0x01,0xF9,0x01,0xFA,0x01,0xFB,0x01,0xFC,0x01,0xFD,0x01,0xFE,
-  0x01,0xFF,0x02,0x00,0x02,0x01,0x02,0x02,0x02,0x03,0x02,0x04,0x02,0x05,0x02,0x06,
-  0x02,0x07,0x02,0x08,0x02,0x09,0x02,0x0A,0x02,0x0B,0x02,0x0C,0x02,0x0D,0x02,0x0E,
-  0x02,0x0F,0x02,0x10,0x02,0x11,0x02,0x12,0x02,0x13,0x02,0x14,0x02,0x15,0x02,0x16,
-  0x02,0x17,0x02,0x18,0x02,0x19,0x02,0x1A,0x02,0x1B,0x02,0x1C,0x02,0x1D,0x02,0x1E,
-  0x02,0x1F,0x02,0x20,0x02,0x21,0x02,0x22,0x02,0x23,0x02,0x24,0x02,0x25,0x02,0x26,
-  0x02,0x27,0x02,0x28,0x02,0x29,0x00,0xB2,0x00,0xB3,0x02,0x2A,0x02,0x2B,0x00,0xB6,
-  0x00,0xB7,0x00,0xC4,0x02,0x2C,0x00,0xB4,0x00,0xB5,0x00,0xC5,0x00,0x82,0x00,0xC2,
-  0x00,0x87,0x00,0xAB,0x00,0xC6,0x02,0x2D,0x02,0x2E,0x00,0xBE,0x00,0xBF,0x02,0x2F,
-  0x00,0xBC,0x02,0x30,0x00,0xF7,0x02,0x31,0x02,0x32,0x02,0x33,0x02,0x34,0x02,0x35,
-  0x02,0x36,0x00,0x8C,0x00,0x9F,0x02,0x37,0x02,0x38,0x02,0x39,0x02,0x3A,0x02,0x3B,
-  0x00,0x98,0x02,0x3C,0x00,0x9A,0x00,0x99,0x00,0xEF,0x00,0xA5,0x00,0x92,0x00,0x9C,
-  0x00,0xA7,0x00,0x8F,0x00,0x94,0x00,0x95,0x00,0xB9,0x02,0x3D,0x02,0x3E,0x02,0x3F,
-  0x02,0x40,0x02,0x41,0x02,0x42,0x02,0x43,0x02,0x44,0x02,0x45,0x02,0x46,0x02,0x47,
-  0x02,0x48,0x02,0x49,0x02,0x4A,0x02,0x4B,0x02,0x4C,0x02,0x4D,0x02,0x4E,0x02,0x4F,
-  0x02,0x50,0x02,0x51,0x02,0x52,0x02,0x53,0x02,0x54,0x02,0x55,0x02,0x56,0x02,0x57,
-  0x02,0x58,0x02,0x59,0x02,0x5A,0x02,0x5B,0x02,0x5C,0x02,0x5D,0x02,0x5E,0x02,0x5F,
-  0x02,0x60,0x02,0x61,0x02,0x62,0x02,0x63,0x02,0x64,0x02,0x65,0x02,0x66,0x02,0x67,
-  0x02,0x68,0x02,0x69,0x02,0x6A,0x02,0x6B,0x02,0x6C,0x02,0x6D,0x02,0x6E,0x02,0x6F,
-  0x02,0x70,0x02,0x71,0x02,0x72,0x02,0x73,0x02,0x74,0x02,0x75,0x02,0x76,0x02,0x77,
-  0x02,0x78,0x02,0x79,0x02,0x7A,0x02,0x7B,0x02,0x7C,0x02,0x7D,0x02,0x7E,0x02,0x7F,
-  0x02,0x80,0x02,0x81,0x02,0x82,0x02,0x83,0x02,0x84,0x02,0x85,0x02,0x86,0x02,0x87,
-  0x02,0x88,0x02,0x89,0x02,0x8A,0x02,0x8B,0x02,0x8C,0x02,0x8D,0x02,0x8E,0x02,0x8F,
-  0x02,0x90,0x02,0x91,0x02,0x92,0x02,0x93,0x02,0x94,0x02,0x95,0x02,0x96,0x02,0x97,
-  0x02,0x98,0x02,0x99,0x02,0x9A,0x02,0x9B,0x02,0x9C,0x02,0x9D,0x02,0x9E,0x02,0x9F,
-  0x02,0xA0,0x02,0xA1,0x02,0xA2,0x02,0xA3,0x02,0xA4,0x02,0xA5,0x02,0xA6,0x02,0xA7,
-  0x02,0xA8,0x02,0xA9,0x02,0xAA,0x02,0xAB,0x02,0xAC,0x02,0xAD,0x02,0xAE,0x02,0xAF,
-  0x02,0xB0,0x02,0xB1,0x02,0xB2,0x02,0xB3,0x02,0xB4,0x02,0xB5,0x02,0xB6,0x02,0xB7,
-  0x02,0xB8,0x02,0xB9,0x02,0xBA,0x02,0xBB,0x02,0xBC,0x02,0xBD,0x02,0xBE,0x02,0xBF,
-  0x02,0xC0,0x02,0xC1,0x02,0xC2,0x02,0xC3,0x02,0xC4,0x02,0xC5,0x02,0xC6,0x02,0xC7,
-  0x02,0xC8,0x02,0xC9,0x02,0xCA,0x02,0xCB,0x02,0xCC,0x02,0xCD,0x02,0xCE,0x02,0xCF,
-  0x02,0xD0,0x02,0xD1,0x02,0xD2,0x02,0xD3,0x02,0xD4,0x02,0xD5,0x02,0xD6,0x02,0xD7,
-  0x02,0xD8,0x02,0xD9,0x02,0xDA,0x02,0xDB,0x02,0xDC,0x02,0xDD,0x02,0xDE,0x02,0xDF,
-  0x02,0xE0,0x02,0xE1,0x02,0xE2,0x02,0xE3,0x02,0xE4,0x02,0xE5,0x02,0xE6,0x02,0xE7,
-  0x02,0xE8,0x02,0xE9,0x02,0xEA,0x02,0xEB,0x02,0xEC,0x02,0xED,0x02,0xEE,0x02,0xEF,
-  0x02,0xF0,0x02,0xF1,0x02,0xF2,0x02,0xF3,0x02,0xF4,0x02,0xF5,0x02,0xF6,0x02,0xF7,
-  0x02,0xF8,0x02,0xF9,0x02,0xFA,0x02,0xFB,0x02,0xFC,0x02,0xFD,0x02,0xFE,0x02,0xFF,
-  0x03,0x00,0x03,0x01,0x03,0x02,0x03,0x03,0x03,0x04,0x03,0x05,0x03,0x06,0x03,0x07,
-  0x03,0x08,0x03,0x09,0x03,0x0A,0x03,0x0B,0x03,0x0C,0x03,0x0D,0x03,0x0E,0x03,0x0F,
-  0x03,0x10,0x03,0x11,0x03,0x12,0x03,0x13,0x03,0x14,0x03,0x15,0x03,0x16,0x03,0x17,
-  0x03,0x18,0x03,0x19,0x03,0x1A,0x03,0x1B,0x03,0x1C,0x03,0x1D,0x03,0x1E,0x03,0x1F,
-  0x03,0x20,0x03,0x21,0x03,0x22,0x03,0x23,0x03,0x24,0x03,0x25,0x03,0x26,0x03,0x27,
-  0x03,0x28,0x03,0x29,0x03,0x2A,0x03,0x2B,0x03,0x2C,0x03,0x2D,0x03,0x2E,0x03,0x2F,
-  0x03,0x30,0x03,0x31,0x03,0x32,0x03,0x33,0x03,0x34,0x03,0x35,0x03,0x36,0x03,0x37,
-  0x03,0x38,0x03,0x39,0x03,0x3A,0x03,0x3B,0x03,0x3C,0x03,0x3D,0x03,0x3E,0x03,0x3F,
-  0x03,0x40,0x03,0x41,0x03,0x42,0x03,0x43,0x03,0x44,0x03,0x45,0x03,0x46,0x03,0x47,
-  0x03,0x48,0x03,0x49,0x03,0x4A,0x03,0x4B,0x03,0x4C,0x03,0x4D,0x03,0x4E,0x03,0x4F,
-  0x03,0x50,0x03,0x51,0x03,0x52,0x03,0x53,0x03,0x54,0x03,0x55,0x03,0x56,0x03,0x57,
-  0x03,0x58,0x03,0x59,0x03,0x5A,0x03,0x5B,0x03,0x5C,0x03,0x5D,0x03,0x5E,0x03,0x5F,
-  0x03,0x60,0x03,0x61,0x03,0x62,0x03,0x63,0x03,0x64,0x03,0x65,0x03,0x66,0x03,0x67,
-  0x03,0x68,0x03,0x69,0x03,0x6A,0x03,0x6B,0x03,0x6C,0x03,0x6D,0x03,0x6E,0x03,0x6F,
-  0x03,0x70,0x03,0x71,0x03,0x72,0x03,0x73,0x03,0x74,0x03,0x75,0x03,0x76,0x03,0x77,
-  0x03,0x78,0x03,0x79,0x03,0x7A,0x03,0x7B,0x03,0x7C,0x03,0x7D,0x03,0x7E,0x03,0x7F,
-  0x03,0x80,0x03,0x81,0x03,0x82,0x03,0x83,0x03,0x84,0x03,0x85,0x03,0x86,0x03,0x87,
-  0x03,0x88,0x03,0x89,0x03,0x8A,0x03,0x8B,0x03,0x8C,0x05,0x2E,0x6E,0x75,0x6C,0x6C,
-  0x07,0x75,0x6E,0x69,0x30,0x30,0x41,0x44,0x09,0x6F,0x76,0x65,0x72,0x73,0x63,0x6F,
-  0x72,0x65,0x0E,0x70,0x65,0x72,0x69,0x6F,0x64,0x63,0x65,0x6E,0x74,0x65,0x72,0x65,
-  0x64,0x07,0x41,0x6D,0x61,0x63,0x72,0x6F,0x6E,0x07,0x61,0x6D,0x61,0x63,0x72,0x6F,
-  0x6E,0x06,0x41,0x62,0x72,0x65,0x76,0x65,0x06,0x61,0x62,0x72,0x65,0x76,0x65,0x07,
-  0x41,0x6F,0x67,0x6F,0x6E,0x65,0x6B,0x07,0x61,0x6F,0x67,0x6F,0x6E,0x65,0x6B,0x0B,
-  0x43,0x63,0x69,0x72,0x63,0x75,0x6D,0x66,0x6C,0x65,0x78,0x0B,0x63,0x63,0x69,0x72,
-  0x63,0x75,0x6D,0x66,0x6C,0x65,0x78,0x04,0x43,0x64,0x6F,0x74,0x04,0x63,0x64,0x6F,
-  0x74,0x06,0x44,0x63,0x61,0x72,0x6F,0x6E,0x06,0x64,0x63,0x61,0x72,0x6F,0x6E,0x06,
-  0x44,0x63,0x72,0x6F,0x61,0x74,0x06,0x64,0x63,0x72,0x6F,0x61,0x74,0x07,0x45,0x6D,
-  0x61,0x63,0x72,0x6F,0x6E,0x07,0x65,0x6D,0x61,0x63,0x72,0x6F,0x6E,0x06,0x45,0x62,
-  0x72,0x65,0x76,0x65,0x06,0x65,0x62,0x72,0x65,0x76,0x65,0x0A,0x45,0x64,0x6F,0x74,
-  0x61,0x63,0x63,0x65,0x6E,0x74,0x0A,0x65,0x64,0x6F,0x74,0x61,0x63,0x63,0x65,0x6E,
-  0x74,0x07,0x45,0x6F,0x67,0x6F,0x6E,0x65,0x6B,0x07,0x65,0x6F,0x67,0x6F,0x6E,0x65,
-  0x6B,0x06,0x45,0x63,0x61,0x72,0x6F,0x6E,0x06,0x65,0x63,0x61,0x72,0x6F,0x6E,0x0B,
-  0x47,0x63,0x69,0x72,0x63,0x75,0x6D,0x66,0x6C,0x65,0x78,0x0B,0x67,0x63,0x69,0x72,
-  0x63,0x75,0x6D,0x66,0x6C,0x65,0x78,0x04,0x47,0x64,0x6F,0x74,0x04,0x67,0x64,0x6F,
-  0x74,0x0C,0x47,0x63,0x6F,0x6D,0x6D,0x61,0x61,0x63,0x63,0x65,0x6E,0x74,0x0C,0x67,
-  0x63,0x6F,0x6D,0x6D,0x61,0x61,0x63,0x63,0x65,0x6E,0x74,0x0B,0x48,0x63,0x69,0x72,
-  0x63,0x75,0x6D,0x66,0x6C,0x65,0x78,0x0B,0x68,0x63,0x69,0x72,0x63,0x75,0x6D,0x66,
-  0x6C,0x65,0x78,0x04,0x48,0x62,0x61,0x72,0x04,0x68,0x62,0x61,0x72,0x06,0x49,0x74,
-  0x69,0x6C,0x64,0x65,0x06,0x69,0x74,0x69,0x6C,0x64,0x65,0x07,0x49,0x6D,0x61,0x63,
-  0x72,0x6F,0x6E,0x07,0x69,0x6D,0x61,0x63,0x72,0x6F,0x6E,0x06,0x49,0x62,0x72,0x65,
-  0x76,0x65,0x06,0x69,0x62,0x72,0x65,0x76,0x65,0x07,0x49,0x6F,0x67,0x6F,0x6E,0x65,
-  0x6B,0x07,0x69,0x6F,0x67,0x6F,0x6E,0x65,0x6B,0x0A,0x49,0x64,0x6F,0x74,0x61,0x63,
-  0x63,0x65,0x6E,0x74,0x02,0x49,0x4A,0x02,0x69,0x6A,0x0B,0x4A,0x63,0x69,0x72,0x63,
-  0x75,0x6D,0x66,0x6C,0x65,0x78,0x0B,0x6A,0x63,0x69,0x72,0x63,0x75,0x6D,0x66,0x6C,
-  0x65,0x78,0x0C,0x4B,0x63,0x6F,0x6D,0x6D,0x61,0x61,0x63,0x63,0x65,0x6E,0x74,0x0C,
-  0x6B,0x63,0x6F,0x6D,0x6D,0x61,0x61,0x63,0x63,0x65,0x6E,0x74,0x0C,0x6B,0x67,0x72,
-  0x65,0x65,0x6E,0x6C,0x61,0x6E,0x64,0x69,0x63,0x06,0x4C,0x61,0x63,0x75,0x74,0x65,
-  0x06,0x6C,0x61,0x63,0x75,0x74,0x65,0x0C,0x4C,0x63,0x6F,0x6D,0x6D,0x61,0x61,0x63,
-  0x63,0x65,0x6E,0x74,0x0C,0x6C,0x63,0x6F,0x6D,0x6D,0x61,0x61,0x63,0x63,0x65,0x6E,
-  0x74,0x06,0x4C,0x63,0x61,0x72,0x6F,0x6E,0x06,0x6C,0x63,0x61,0x72,0x6F,0x6E,0x04,
-  0x4C,0x64,0x6F,0x74,0x04,0x6C,0x64,0x6F,0x74,0x06,0x4E,0x61,0x63,0x75,0x74,0x65,
-  0x06,0x6E,0x61,0x63,0x75,0x74,0x65,0x0C,0x4E,0x63,0x6F,0x6D,0x6D,0x61,0x61,0x63,
-  0x63,0x65,0x6E,0x74,0x0C,0x6E,0x63,0x6F,0x6D,0x6D,0x61,0x61,0x63,0x63,0x65,0x6E,
-  0x74,0x06,0x4E,0x63,0x61,0x72,0x6F,0x6E,0x06,0x6E,0x63,0x61,0x72,0x6F,0x6E,0x0B,
-  0x6E,0x61,0x70,0x6F,0x73,0x74,0x72,0x6F,0x70,0x68,0x65,0x03,0x45,0x6E,0x67,0x03,
-  0x65,0x6E,0x67,0x07,0x4F,0x6D,0x61,0x63,0x72,0x6F,0x6E,0x07,0x6F,0x6D,0x61,0x63,
-  0x72,0x6F,0x6E,0x06,0x4F,0x62,0x72,0x65,0x76,0x65,0x06,0x6F,0x62,0x72,0x65,0x76,
-  0x65,0x0D,0x4F,0x68,0x75,0x6E,0x67,0x61,0x72,0x75,0x6D,0x6C,0x61,0x75,0x74,0x0D,
-  0x6F,0x68,0x75,0x6E,0x67,0x61,0x72,0x75,0x6D,0x6C,0x61,0x75,0x74,0x06,0x52,0x61,
-  0x63,0x75,0x74,0x65,0x06,0x72,0x61,0x63,0x75,0x74,0x65,0x0C,0x52,0x63,0x6F,0x6D,
-  0x6D,0x61,0x61,0x63,0x63,0x65,0x6E,0x74,0x0C,0x72,0x63,0x6F,0x6D,0x6D,0x61,0x61,
-  0x63,0x63,0x65,0x6E,0x74,0x06,0x52,0x63,0x61,0x72,0x6F,0x6E,0x06,0x72,0x63,0x61,
-  0x72,0x6F,0x6E,0x06,0x53,0x61,0x63,0x75,0x74,0x65,0x06,0x73,0x61,0x63,0x75,0x74,
-  0x65,0x0B,0x53,0x63,0x69,0x72,0x63,0x75,0x6D,0x66,0x6C,0x65,0x78,0x0B,0x73,0x63,
-  0x69,0x72,0x63,0x75,0x6D,0x66,0x6C,0x65,0x78,0x0C,0x54,0x63,0x6F,0x6D,0x6D,0x61,
-  0x61,0x63,0x63,0x65,0x6E,0x74,0x0C,0x74,0x63,0x6F,0x6D,0x6D,0x61,0x61,0x63,0x63,
-  0x65,0x6E,0x74,0x06,0x54,0x63,0x61,0x72,0x6F,0x6E,0x06,0x74,0x63,0x61,0x72,0x6F,
-  0x6E,0x04,0x54,0x62,0x61,0x72,0x04,0x74,0x62,0x61,0x72,0x06,0x55,0x74,0x69,0x6C,
-  0x64,0x65,0x06,0x75,0x74,0x69,0x6C,0x64,0x65,0x07,0x55,0x6D,0x61,0x63,0x72,0x6F,
-  0x6E,0x07,0x75,0x6D,0x61,0x63,0x72,0x6F,0x6E,0x06,0x55,0x62,0x72,0x65,0x76,0x65,
-  0x06,0x75,0x62,0x72,0x65,0x76,0x65,0x05,0x55,0x72,0x69,0x6E,0x67,0x05,0x75,0x72,
-  0x69,0x6E,0x67,0x0D,0x55,0x68,0x75,0x6E,0x67,0x61,0x72,0x75,0x6D,0x6C,0x61,0x75,
-  0x74,0x0D,0x75,0x68,0x75,0x6E,0x67,0x61,0x72,0x75,0x6D,0x6C,0x61,0x75,0x74,0x07,
-  0x55,0x6F,0x67,0x6F,0x6E,0x65,0x6B,0x07,0x75,0x6F,0x67,0x6F,0x6E,0x65,0x6B,0x0B,
-  0x57,0x63,0x69,0x72,0x63,0x75,0x6D,0x66,0x6C,0x65,0x78,0x0B,0x77,0x63,0x69,0x72,
-  0x63,0x75,0x6D,0x66,0x6C,0x65,0x78,0x0B,0x59,0x63,0x69,0x72,0x63,0x75,0x6D,0x66,
-  0x6C,0x65,0x78,0x0B,0x79,0x63,0x69,0x72,0x63,0x75,0x6D,0x66,0x6C,0x65,0x78,0x06,
-  0x5A,0x61,0x63,0x75,0x74,0x65,0x06,0x7A,0x61,0x63,0x75,0x74,0x65,0x0A,0x5A,0x64,
-  0x6F,0x74,0x61,0x63,0x63,0x65,0x6E,0x74,0x0A,0x7A,0x64,0x6F,0x74,0x61,0x63,0x63,
-  0x65,0x6E,0x74,0x05,0x6C,0x6F,0x6E,0x67,0x73,0x0A,0x41,0x72,0x69,0x6E,0x67,0x61,
-  0x63,0x75,0x74,0x65,0x0A,0x61,0x72,0x69,0x6E,0x67,0x61,0x63,0x75,0x74,0x65,0x07,
-  0x41,0x45,0x61,0x63,0x75,0x74,0x65,0x07,0x61,0x65,0x61,0x63,0x75,0x74,0x65,0x0B,
-  0x4F,0x73,0x6C,0x61,0x73,0x68,0x61,0x63,0x75,0x74,0x65,0x0B,0x6F,0x73,0x6C,0x61,
-  0x73,0x68,0x61,0x63,0x75,0x74,0x65,0x0C,0x53,0x63,0x6F,0x6D,0x6D,0x61,0x61,0x63,
-  0x63,0x65,0x6E,0x74,0x0C,0x73,0x63,0x6F,0x6D,0x6D,0x61,0x61,0x63,0x63,0x65,0x6E,
-  0x74,0x06,0x6D,0x61,0x63,0x72,0x6F,0x6E,0x05,0x74,0x6F,0x6E,0x6F,0x73,0x0D,0x64,
-  0x69,0x65,0x72,0x65,0x73,0x69,0x73,0x74,0x6F,0x6E,0x6F,0x73,0x0A,0x41,0x6C,0x70,
-  0x68,0x61,0x74,0x6F,0x6E,0x6F,0x73,0x09,0x61,0x6E,0x6F,0x74,0x65,0x6C,0x65,0x69,
-  0x61,0x0C,0x45,0x70,0x73,0x69,0x6C,0x6F,0x6E,0x74,0x6F,0x6E,0x6F,0x73,0x08,0x45,
-  0x74,0x61,0x74,0x6F,0x6E,0x6F,0x73,0x09,0x49,0x6F,0x74,0x61,0x74,0x6F,0x6E,0x6F,
-  0x73,0x0C,0x4F,0x6D,0x69,0x63,0x72,0x6F,0x6E,0x74,0x6F,0x6E,0x6F,0x73,0x0C,0x55,
-  0x70,0x73,0x69,0x6C,0x6F,0x6E,0x74,0x6F,0x6E,0x6F,0x73,0x0A,0x4F,0x6D,0x65,0x67,
-  0x61,0x74,0x6F,0x6E,0x6F,0x73,0x11,0x69,0x6F,0x74,0x61,0x64,0x69,0x65,0x72,0x65,
-  0x73,0x69,0x73,0x74,0x6F,0x6E,0x6F,0x73,0x05,0x41,0x6C,0x70,0x68,0x61,0x04,0x42,
-  0x65,0x74,0x61,0x05,0x47,0x61,0x6D,0x6D,0x61,0x07,0x75,0x6E,0x69,0x30,0x33,0x39,
-  0x34,0x07,0x45,0x70,0x73,0x69,0x6C,0x6F,0x6E,0x04,0x5A,0x65,0x74,0x61,0x03,0x45,
-  0x74,0x61,0x05,0x54,0x68,0x65,0x74,0x61,0x04,0x49,0x6F,0x74,0x61,0x05,0x4B,0x61,
-  0x70,0x70,0x61,0x06,0x4C,0x61,0x6D,0x62,0x64,0x61,0x02,0x4D,0x75,0x02,0x4E,0x75,
-  0x02,0x58,0x69,0x07,0x4F,0x6D,0x69,0x63,0x72,0x6F,0x6E,0x02,0x50,0x69,0x03,0x52,
-  0x68,0x6F,0x05,0x53,0x69,0x67,0x6D,0x61,0x03,0x54,0x61,0x75,0x07,0x55,0x70,0x73,
-  0x69,0x6C,0x6F,0x6E,0x03,0x50,0x68,0x69,0x03,0x43,0x68,0x69,0x03,0x50,0x73,0x69,
-  0x07,0x75,0x6E,0x69,0x30,0x33,0x41,0x39,0x0C,0x49,0x6F,0x74,0x61,0x64,0x69,0x65,
-  0x72,0x65,0x73,0x69,0x73,0x0F,0x55,0x70,0x73,0x69,0x6C,0x6F,0x6E,0x64,0x69,0x65,
-  0x72,0x65,0x73,0x69,0x73,0x0A,0x61,0x6C,0x70,0x68,0x61,0x74,0x6F,0x6E,0x6F,0x73,
-  0x0C,0x65,0x70,0x73,0x69,0x6C,0x6F,0x6E,0x74,0x6F,0x6E,0x6F,0x73,0x08,0x65,0x74,
-  0x61,0x74,0x6F,0x6E,0x6F,0x73,0x09,0x69,0x6F,0x74,0x61,0x74,0x6F,0x6E,0x6F,0x73,
-  0x14,0x75,0x70,0x73,0x69,0x6C,0x6F,0x6E,0x64,0x69,0x65,0x72,0x65,0x73,0x69,0x73,
-  0x74,0x6F,0x6E,0x6F,0x73,0x05,0x61,0x6C,0x70,0x68,0x61,0x04,0x62,0x65,0x74,0x61,
-  0x05,0x67,0x61,0x6D,0x6D,0x61,0x05,0x64,0x65,0x6C,0x74,0x61,0x07,0x65,0x70,0x73,
-  0x69,0x6C,0x6F,0x6E,0x04,0x7A,0x65,0x74,0x61,0x03,0x65,0x74,0x61,0x05,0x74,0x68,
-  0x65,0x74,0x61,0x04,0x69,0x6F,0x74,0x61,0x05,0x6B,0x61,0x70,0x70,0x61,0x06,0x6C,
-  0x61,0x6D,0x62,0x64,0x61,0x07,0x75,0x6E,0x69,0x30,0x33,0x42,0x43,0x02,0x6E,0x75,
-  0x02,0x78,0x69,0x07,0x6F,0x6D,0x69,0x63,0x72,0x6F,0x6E,0x03,0x72,0x68,0x6F,0x06,
-  0x73,0x69,0x67,0x6D,0x61,0x31,0x05,0x73,0x69,0x67,0x6D,0x61,0x03,0x74,0x61,0x75,
-  0x07,0x75,0x70,0x73,0x69,0x6C,0x6F,0x6E,0x03,0x70,0x68,0x69,0x03,0x63,0x68,0x69,
-  0x03,0x70,0x73,0x69,0x05,0x6F,0x6D,0x65,0x67,0x61,0x0C,0x69,0x6F,0x74,0x61,0x64,
-  0x69,0x65,0x72,0x65,0x73,0x69,0x73,0x0F,0x75,0x70,0x73,0x69,0x6C,0x6F,0x6E,0x64,
-  0x69,0x65,0x72,0x65,0x73,0x69,0x73,0x0C,0x6F,0x6D,0x69,0x63,0x72,0x6F,0x6E,0x74,
-  0x6F,0x6E,0x6F,0x73,0x0C,0x75,0x70,0x73,0x69,0x6C,0x6F,0x6E,0x74,0x6F,0x6E,0x6F,
-  0x73,0x0A,0x6F,0x6D,0x65,0x67,0x61,0x74,0x6F,0x6E,0x6F,0x73,0x09,0x61,0x66,0x69,
-  0x69,0x31,0x30,0x30,0x32,0x33,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x35,0x31,
-  0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x35,0x32,0x09,0x61,0x66,0x69,0x69,0x31,
-  0x30,0x30,0x35,0x33,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x35,0x34,0x09,0x61,
-  0x66,0x69,0x69,0x31,0x30,0x30,0x35,0x35,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,
-  0x35,0x36,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x35,0x37,0x09,0x61,0x66,0x69,
-  0x69,0x31,0x30,0x30,0x35,0x38,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x35,0x39,
-  0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x36,0x30,0x09,0x61,0x66,0x69,0x69,0x31,
-  0x30,0x30,0x36,0x31,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x36,0x32,0x09,0x61,
-  0x66,0x69,0x69,0x31,0x30,0x31,0x34,0x35,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,
-  0x31,0x37,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x31,0x38,0x09,0x61,0x66,0x69,
-  0x69,0x31,0x30,0x30,0x31,0x39,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x32,0x30,
-  0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x32,0x31,0x09,0x61,0x66,0x69,0x69,0x31,
-  0x30,0x30,0x32,0x32,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x32,0x34,0x09,0x61,
-  0x66,0x69,0x69,0x31,0x30,0x30,0x32,0x35,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,
-  0x32,0x36,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x32,0x37,0x09,0x61,0x66,0x69,
-  0x69,0x31,0x30,0x30,0x32,0x38,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x32,0x39,
-  0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x33,0x30,0x09,0x61,0x66,0x69,0x69,0x31,
-  0x30,0x30,0x33,0x31,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x33,0x32,0x09,0x61,
-  0x66,0x69,0x69,0x31,0x30,0x30,0x33,0x33,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,
-  0x33,0x34,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x33,0x35,0x09,0x61,0x66,0x69,
-  0x69,0x31,0x30,0x30,0x33,0x36,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x33,0x37,
-  0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x33,0x38,0x09,0x61,0x66,0x69,0x69,0x31,
-  0x30,0x30,0x33,0x39,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x34,0x30,0x09,0x61,
-  0x66,0x69,0x69,0x31,0x30,0x30,0x34,0x31,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,
-  0x34,0x32,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x34,0x33,0x09,0x61,0x66,0x69,
-  0x69,0x31,0x30,0x30,0x34,0x34,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x34,0x35,
-  0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x34,0x36,0x09,0x61,0x66,0x69,0x69,0x31,
-  0x30,0x30,0x34,0x37,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x34,0x38,0x09,0x61,
-  0x66,0x69,0x69,0x31,0x30,0x30,0x34,0x39,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,
-  0x36,0x35,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x36,0x36,0x09,0x61,0x66,0x69,
-  0x69,0x31,0x30,0x30,0x36,0x37,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x36,0x38,
-  0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x36,0x39,0x09,0x61,0x66,0x69,0x69,0x31,
-  0x30,0x30,0x37,0x30,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x37,0x32,0x09,0x61,
-  0x66,0x69,0x69,0x31,0x30,0x30,0x37,0x33,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,
-  0x37,0x34,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x37,0x35,0x09,0x61,0x66,0x69,
-  0x69,0x31,0x30,0x30,0x37,0x36,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x37,0x37,
-  0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x37,0x38,0x09,0x61,0x66,0x69,0x69,0x31,
-  0x30,0x30,0x37,0x39,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x38,0x30,0x09,0x61,
-  0x66,0x69,0x69,0x31,0x30,0x30,0x38,0x31,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,
-  0x38,0x32,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x38,0x33,0x09,0x61,0x66,0x69,
-  0x69,0x31,0x30,0x30,0x38,0x34,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x38,0x35,
-  0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x38,0x36,0x09,0x61,0x66,0x69,0x69,0x31,
-  0x30,0x30,0x38,0x37,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x38,0x38,0x09,0x61,
-  0x66,0x69,0x69,0x31,0x30,0x30,0x38,0x39,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,
-  0x39,0x30,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x39,0x31,0x09,0x61,0x66,0x69,
-  0x69,0x31,0x30,0x30,0x39,0x32,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x39,0x33,
-  0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x39,0x34,0x09,0x61,0x66,0x69,0x69,0x31,
-  0x30,0x30,0x39,0x35,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x39,0x36,0x09,0x61,
-  0x66,0x69,0x69,0x31,0x30,0x30,0x39,0x37,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,
-  0x37,0x31,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x39,0x39,0x09,0x61,0x66,0x69,
-  0x69,0x31,0x30,0x31,0x30,0x30,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x31,0x30,0x31,
-  0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x31,0x30,0x32,0x09,0x61,0x66,0x69,0x69,0x31,
-  0x30,0x31,0x30,0x33,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x31,0x30,0x34,0x09,0x61,
-  0x66,0x69,0x69,0x31,0x30,0x31,0x30,0x35,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x31,
-  0x30,0x36,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x31,0x30,0x37,0x09,0x61,0x66,0x69,
-  0x69,0x31,0x30,0x31,0x30,0x38,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x31,0x30,0x39,
-  0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x31,0x31,0x30,0x09,0x61,0x66,0x69,0x69,0x31,
-  0x30,0x31,0x39,0x33,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x35,0x30,0x09,0x61,
-  0x66,0x69,0x69,0x31,0x30,0x30,0x39,0x38,0x06,0x57,0x67,0x72,0x61,0x76,0x65,0x06,
-  0x77,0x67,0x72,0x61,0x76,0x65,0x06,0x57,0x61,0x63,0x75,0x74,0x65,0x06,0x77,0x61,
-  0x63,0x75,0x74,0x65,0x09,0x57,0x64,0x69,0x65,0x72,0x65,0x73,0x69,0x73,0x09,0x77,
-  0x64,0x69,0x65,0x72,0x65,0x73,0x69,0x73,0x06,0x59,0x67,0x72,0x61,0x76,0x65,0x06,
-  0x79,0x67,0x72,0x61,0x76,0x65,0x09,0x61,0x66,0x69,0x69,0x30,0x30,0x32,0x30,0x38,
-  0x0D,0x75,0x6E,0x64,0x65,0x72,0x73,0x63,0x6F,0x72,0x65,0x64,0x62,0x6C,0x0D,0x71,
-  0x75,0x6F,0x74,0x65,0x72,0x65,0x76,0x65,0x72,0x73,0x65,0x64,0x06,0x6D,0x69,0x6E,
-  0x75,0x74,0x65,0x06,0x73,0x65,0x63,0x6F,0x6E,0x64,0x09,0x65,0x78,0x63,0x6C,0x61,
-  0x6D,0x64,0x62,0x6C,0x09,0x6E,0x73,0x75,0x70,0x65,0x72,0x69,0x6F,0x72,0x09,0x61,
-  0x66,0x69,0x69,0x30,0x38,0x39,0x34,0x31,0x06,0x70,0x65,0x73,0x65,0x74,0x61,0x04,
-  0x45,0x75,0x72,0x6F,0x09,0x61,0x66,0x69,0x69,0x36,0x31,0x32,0x34,0x38,0x09,0x61,
-  0x66,0x69,0x69,0x36,0x31,0x32,0x38,0x39,0x09,0x61,0x66,0x69,0x69,0x36,0x31,0x33,
-  0x35,0x32,0x09,0x65,0x73,0x74,0x69,0x6D,0x61,0x74,0x65,0x64,0x09,0x6F,0x6E,0x65,
-  0x65,0x69,0x67,0x68,0x74,0x68,0x0C,0x74,0x68,0x72,0x65,0x65,0x65,0x69,0x67,0x68,
-  0x74,0x68,0x73,0x0B,0x66,0x69,0x76,0x65,0x65,0x69,0x67,0x68,0x74,0x68,0x73,0x0C,
-  0x73,0x65,0x76,0x65,0x6E,0x65,0x69,0x67,0x68,0x74,0x68,0x73,0x05,0x44,0x65,0x6C,
-  0x74,0x61,0x07,0x75,0x6E,0x69,0x46,0x42,0x30,0x31,0x07,0x75,0x6E,0x69,0x46,0x42,
-  0x30,0x32,0x0D,0x63,0x79,0x72,0x69,0x6C,0x6C,0x69,0x63,0x62,0x72,0x65,0x76,0x65,
-  0x08,0x64,0x6F,0x74,0x6C,0x65,0x73,0x73,0x6A,0x10,0x63,0x61,0x72,0x6F,0x6E,0x63,
-  0x6F,0x6D,0x6D,0x61,0x61,0x63,0x63,0x65,0x6E,0x74,0x0B,0x63,0x6F,0x6D,0x6D,0x61,
-  0x61,0x63,0x63,0x65,0x6E,0x74,0x11,0x63,0x6F,0x6D,0x6D,0x61,0x61,0x63,0x63,0x65,
-  0x6E,0x74,0x72,0x6F,0x74,0x61,0x74,0x65,0x0C,0x7A,0x65,0x72,0x6F,0x73,0x75,0x70,
-  0x65,0x72,0x69,0x6F,0x72,0x0C,0x66,0x6F,0x75,0x72,0x73,0x75,0x70,0x65,0x72,0x69,
-  0x6F,0x72,0x0C,0x66,0x69,0x76,0x65,0x73,0x75,0x70,0x65,0x72,0x69,0x6F,0x72,0x0B,
-  0x73,0x69,0x78,0x73,0x75,0x70,0x65,0x72,0x69,0x6F,0x72,0x0D,0x73,0x65,0x76,0x65,
-  0x6E,0x73,0x75,0x70,0x65,0x72,0x69,0x6F,0x72,0x0D,0x65,0x69,0x67,0x68,0x74,0x73,
-  0x75,0x70,0x65,0x72,0x69,0x6F,0x72,0x0C,0x6E,0x69,0x6E,0x65,0x73,0x75,0x70,0x65,
-  0x72,0x69,0x6F,0x72,0x07,0x75,0x6E,0x69,0x32,0x30,0x30,0x30,0x07,0x75,0x6E,0x69,
-  0x32,0x30,0x30,0x31,0x07,0x75,0x6E,0x69,0x32,0x30,0x30,0x32,0x07,0x75,0x6E,0x69,
-  0x32,0x30,0x30,0x33,0x07,0x75,0x6E,0x69,0x32,0x30,0x30,0x34,0x07,0x75,0x6E,0x69,
-  0x32,0x30,0x30,0x35,0x07,0x75,0x6E,0x69,0x32,0x30,0x30,0x36,0x07,0x75,0x6E,0x69,
-  0x32,0x30,0x30,0x37,0x07,0x75,0x6E,0x69,0x32,0x30,0x30,0x38,0x07,0x75,0x6E,0x69,
-  0x32,0x30,0x30,0x39,0x07,0x75,0x6E,0x69,0x32,0x30,0x30,0x41,0x07,0x75,0x6E,0x69,
-  0x32,0x30,0x30,0x42,0x07,0x75,0x6E,0x69,0x46,0x45,0x46,0x46,0x07,0x75,0x6E,0x69,
-  0x46,0x46,0x46,0x43,0x07,0x75,0x6E,0x69,0x46,0x46,0x46,0x44,0x07,0x75,0x6E,0x69,
-  0x30,0x31,0x46,0x30,0x07,0x75,0x6E,0x69,0x30,0x32,0x42,0x43,0x07,0x75,0x6E,0x69,
-  0x30,0x33,0x44,0x31,0x07,0x75,0x6E,0x69,0x30,0x33,0x44,0x32,0x07,0x75,0x6E,0x69,
-  0x30,0x33,0x44,0x36,0x07,0x75,0x6E,0x69,0x31,0x45,0x33,0x45,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x33,0x46,0x07,0x75,0x6E,0x69,0x31,0x45,0x30,0x30,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x30,0x31,0x07,0x75,0x6E,0x69,0x31,0x46,0x34,0x44,0x07,0x75,0x6E,0x69,
-  0x30,0x32,0x46,0x33,0x09,0x64,0x61,0x73,0x69,0x61,0x6F,0x78,0x69,0x61,0x07,0x75,
-  0x6E,0x69,0x46,0x42,0x30,0x33,0x07,0x75,0x6E,0x69,0x46,0x42,0x30,0x34,0x05,0x4F,
-  0x68,0x6F,0x72,0x6E,0x05,0x6F,0x68,0x6F,0x72,0x6E,0x05,0x55,0x68,0x6F,0x72,0x6E,
-  0x05,0x75,0x68,0x6F,0x72,0x6E,0x07,0x75,0x6E,0x69,0x30,0x33,0x30,0x30,0x07,0x75,
-  0x6E,0x69,0x30,0x33,0x30,0x31,0x07,0x75,0x6E,0x69,0x30,0x33,0x30,0x33,0x04,0x68,
-  0x6F,0x6F,0x6B,0x08,0x64,0x6F,0x74,0x62,0x65,0x6C,0x6F,0x77,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x30,0x30,0x07,0x75,0x6E,0x69,0x30,0x34,0x30,0x44,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x35,0x30,0x07,0x75,0x6E,0x69,0x30,0x34,0x35,0x44,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x36,0x30,0x07,0x75,0x6E,0x69,0x30,0x34,0x36,0x31,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x36,0x32,0x07,0x75,0x6E,0x69,0x30,0x34,0x36,0x33,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x36,0x34,0x07,0x75,0x6E,0x69,0x30,0x34,0x36,0x35,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x36,0x36,0x07,0x75,0x6E,0x69,0x30,0x34,0x36,0x37,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x36,0x38,0x07,0x75,0x6E,0x69,0x30,0x34,0x36,0x39,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x36,0x41,0x07,0x75,0x6E,0x69,0x30,0x34,0x36,0x42,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x36,0x43,0x07,0x75,0x6E,0x69,0x30,0x34,0x36,0x44,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x36,0x45,0x07,0x75,0x6E,0x69,0x30,0x34,0x36,0x46,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x37,0x30,0x07,0x75,0x6E,0x69,0x30,0x34,0x37,0x31,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x37,0x32,0x07,0x75,0x6E,0x69,0x30,0x34,0x37,0x33,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x37,0x34,0x07,0x75,0x6E,0x69,0x30,0x34,0x37,0x35,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x37,0x36,0x07,0x75,0x6E,0x69,0x30,0x34,0x37,0x37,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x37,0x38,0x07,0x75,0x6E,0x69,0x30,0x34,0x37,0x39,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x37,0x41,0x07,0x75,0x6E,0x69,0x30,0x34,0x37,0x42,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x37,0x43,0x07,0x75,0x6E,0x69,0x30,0x34,0x37,0x44,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x37,0x45,0x07,0x75,0x6E,0x69,0x30,0x34,0x37,0x46,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x38,0x30,0x07,0x75,0x6E,0x69,0x30,0x34,0x38,0x31,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x38,0x32,0x07,0x75,0x6E,0x69,0x30,0x34,0x38,0x33,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x38,0x34,0x07,0x75,0x6E,0x69,0x30,0x34,0x38,0x35,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x38,0x36,0x07,0x75,0x6E,0x69,0x30,0x34,0x38,0x38,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x38,0x39,0x07,0x75,0x6E,0x69,0x30,0x34,0x38,0x41,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x38,0x42,0x07,0x75,0x6E,0x69,0x30,0x34,0x38,0x43,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x38,0x44,0x07,0x75,0x6E,0x69,0x30,0x34,0x38,0x45,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x38,0x46,0x07,0x75,0x6E,0x69,0x30,0x34,0x39,0x32,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x39,0x33,0x07,0x75,0x6E,0x69,0x30,0x34,0x39,0x34,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x39,0x35,0x07,0x75,0x6E,0x69,0x30,0x34,0x39,0x36,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x39,0x37,0x07,0x75,0x6E,0x69,0x30,0x34,0x39,0x38,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x39,0x39,0x07,0x75,0x6E,0x69,0x30,0x34,0x39,0x41,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x39,0x42,0x07,0x75,0x6E,0x69,0x30,0x34,0x39,0x43,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x39,0x44,0x07,0x75,0x6E,0x69,0x30,0x34,0x39,0x45,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x39,0x46,0x07,0x75,0x6E,0x69,0x30,0x34,0x41,0x30,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x41,0x31,0x07,0x75,0x6E,0x69,0x30,0x34,0x41,0x32,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x41,0x33,0x07,0x75,0x6E,0x69,0x30,0x34,0x41,0x34,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x41,0x35,0x07,0x75,0x6E,0x69,0x30,0x34,0x41,0x36,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x41,0x37,0x07,0x75,0x6E,0x69,0x30,0x34,0x41,0x38,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x41,0x39,0x07,0x75,0x6E,0x69,0x30,0x34,0x41,0x41,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x41,0x42,0x07,0x75,0x6E,0x69,0x30,0x34,0x41,0x43,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x41,0x44,0x07,0x75,0x6E,0x69,0x30,0x34,0x41,0x45,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x41,0x46,0x07,0x75,0x6E,0x69,0x30,0x34,0x42,0x30,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x42,0x31,0x07,0x75,0x6E,0x69,0x30,0x34,0x42,0x32,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x42,0x33,0x07,0x75,0x6E,0x69,0x30,0x34,0x42,0x34,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x42,0x35,0x07,0x75,0x6E,0x69,0x30,0x34,0x42,0x36,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x42,0x37,0x07,0x75,0x6E,0x69,0x30,0x34,0x42,0x38,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x42,0x39,0x07,0x75,0x6E,0x69,0x30,0x34,0x42,0x41,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x42,0x42,0x07,0x75,0x6E,0x69,0x30,0x34,0x42,0x43,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x42,0x44,0x07,0x75,0x6E,0x69,0x30,0x34,0x42,0x45,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x42,0x46,0x07,0x75,0x6E,0x69,0x30,0x34,0x43,0x30,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x43,0x31,0x07,0x75,0x6E,0x69,0x30,0x34,0x43,0x32,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x43,0x33,0x07,0x75,0x6E,0x69,0x30,0x34,0x43,0x34,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x43,0x35,0x07,0x75,0x6E,0x69,0x30,0x34,0x43,0x36,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x43,0x37,0x07,0x75,0x6E,0x69,0x30,0x34,0x43,0x38,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x43,0x39,0x07,0x75,0x6E,0x69,0x30,0x34,0x43,0x41,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x43,0x42,0x07,0x75,0x6E,0x69,0x30,0x34,0x43,0x43,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x43,0x44,0x07,0x75,0x6E,0x69,0x30,0x34,0x43,0x45,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x43,0x46,0x07,0x75,0x6E,0x69,0x30,0x34,0x44,0x30,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x44,0x31,0x07,0x75,0x6E,0x69,0x30,0x34,0x44,0x32,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x44,0x33,0x07,0x75,0x6E,0x69,0x30,0x34,0x44,0x34,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x44,0x35,0x07,0x75,0x6E,0x69,0x30,0x34,0x44,0x36,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x44,0x37,0x07,0x75,0x6E,0x69,0x30,0x34,0x44,0x38,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x44,0x39,0x07,0x75,0x6E,0x69,0x30,0x34,0x44,0x41,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x44,0x42,0x07,0x75,0x6E,0x69,0x30,0x34,0x44,0x43,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x44,0x44,0x07,0x75,0x6E,0x69,0x30,0x34,0x44,0x45,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x44,0x46,0x07,0x75,0x6E,0x69,0x30,0x34,0x45,0x30,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x45,0x31,0x07,0x75,0x6E,0x69,0x30,0x34,0x45,0x32,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x45,0x33,0x07,0x75,0x6E,0x69,0x30,0x34,0x45,0x34,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x45,0x35,0x07,0x75,0x6E,0x69,0x30,0x34,0x45,0x36,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x45,0x37,0x07,0x75,0x6E,0x69,0x30,0x34,0x45,0x38,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x45,0x39,0x07,0x75,0x6E,0x69,0x30,0x34,0x45,0x41,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x45,0x42,0x07,0x75,0x6E,0x69,0x30,0x34,0x45,0x43,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x45,0x44,0x07,0x75,0x6E,0x69,0x30,0x34,0x45,0x45,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x45,0x46,0x07,0x75,0x6E,0x69,0x30,0x34,0x46,0x30,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x46,0x31,0x07,0x75,0x6E,0x69,0x30,0x34,0x46,0x32,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x46,0x33,0x07,0x75,0x6E,0x69,0x30,0x34,0x46,0x34,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x46,0x35,0x07,0x75,0x6E,0x69,0x30,0x34,0x46,0x36,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x46,0x37,0x07,0x75,0x6E,0x69,0x30,0x34,0x46,0x38,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x46,0x39,0x07,0x75,0x6E,0x69,0x30,0x34,0x46,0x41,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x46,0x42,0x07,0x75,0x6E,0x69,0x30,0x34,0x46,0x43,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x46,0x44,0x07,0x75,0x6E,0x69,0x30,0x34,0x46,0x45,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x46,0x46,0x07,0x75,0x6E,0x69,0x30,0x35,0x30,0x30,0x07,0x75,0x6E,0x69,
-  0x30,0x35,0x30,0x31,0x07,0x75,0x6E,0x69,0x30,0x35,0x30,0x32,0x07,0x75,0x6E,0x69,
-  0x30,0x35,0x30,0x33,0x07,0x75,0x6E,0x69,0x30,0x35,0x30,0x34,0x07,0x75,0x6E,0x69,
-  0x30,0x35,0x30,0x35,0x07,0x75,0x6E,0x69,0x30,0x35,0x30,0x36,0x07,0x75,0x6E,0x69,
-  0x30,0x35,0x30,0x37,0x07,0x75,0x6E,0x69,0x30,0x35,0x30,0x38,0x07,0x75,0x6E,0x69,
-  0x30,0x35,0x30,0x39,0x07,0x75,0x6E,0x69,0x30,0x35,0x30,0x41,0x07,0x75,0x6E,0x69,
-  0x30,0x35,0x30,0x42,0x07,0x75,0x6E,0x69,0x30,0x35,0x30,0x43,0x07,0x75,0x6E,0x69,
-  0x30,0x35,0x30,0x44,0x07,0x75,0x6E,0x69,0x30,0x35,0x30,0x45,0x07,0x75,0x6E,0x69,
-  0x30,0x35,0x30,0x46,0x07,0x75,0x6E,0x69,0x30,0x35,0x31,0x30,0x07,0x75,0x6E,0x69,
-  0x30,0x35,0x31,0x31,0x07,0x75,0x6E,0x69,0x30,0x35,0x31,0x32,0x07,0x75,0x6E,0x69,
-  0x30,0x35,0x31,0x33,0x07,0x75,0x6E,0x69,0x31,0x45,0x41,0x30,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x41,0x31,0x07,0x75,0x6E,0x69,0x31,0x45,0x41,0x32,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x41,0x33,0x07,0x75,0x6E,0x69,0x31,0x45,0x41,0x34,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x41,0x35,0x07,0x75,0x6E,0x69,0x31,0x45,0x41,0x36,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x41,0x37,0x07,0x75,0x6E,0x69,0x31,0x45,0x41,0x38,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x41,0x39,0x07,0x75,0x6E,0x69,0x31,0x45,0x41,0x41,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x41,0x42,0x07,0x75,0x6E,0x69,0x31,0x45,0x41,0x43,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x41,0x44,0x07,0x75,0x6E,0x69,0x31,0x45,0x41,0x45,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x41,0x46,0x07,0x75,0x6E,0x69,0x31,0x45,0x42,0x30,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x42,0x31,0x07,0x75,0x6E,0x69,0x31,0x45,0x42,0x32,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x42,0x33,0x07,0x75,0x6E,0x69,0x31,0x45,0x42,0x34,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x42,0x35,0x07,0x75,0x6E,0x69,0x31,0x45,0x42,0x36,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x42,0x37,0x07,0x75,0x6E,0x69,0x31,0x45,0x42,0x38,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x42,0x39,0x07,0x75,0x6E,0x69,0x31,0x45,0x42,0x41,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x42,0x42,0x07,0x75,0x6E,0x69,0x31,0x45,0x42,0x43,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x42,0x44,0x07,0x75,0x6E,0x69,0x31,0x45,0x42,0x45,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x42,0x46,0x07,0x75,0x6E,0x69,0x31,0x45,0x43,0x30,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x43,0x31,0x07,0x75,0x6E,0x69,0x31,0x45,0x43,0x32,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x43,0x33,0x07,0x75,0x6E,0x69,0x31,0x45,0x43,0x34,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x43,0x35,0x07,0x75,0x6E,0x69,0x31,0x45,0x43,0x36,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x43,0x37,0x07,0x75,0x6E,0x69,0x31,0x45,0x43,0x38,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x43,0x39,0x07,0x75,0x6E,0x69,0x31,0x45,0x43,0x41,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x43,0x42,0x07,0x75,0x6E,0x69,0x31,0x45,0x43,0x43,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x43,0x44,0x07,0x75,0x6E,0x69,0x31,0x45,0x43,0x45,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x43,0x46,0x07,0x75,0x6E,0x69,0x31,0x45,0x44,0x30,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x44,0x31,0x07,0x75,0x6E,0x69,0x31,0x45,0x44,0x32,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x44,0x33,0x07,0x75,0x6E,0x69,0x31,0x45,0x44,0x34,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x44,0x35,0x07,0x75,0x6E,0x69,0x31,0x45,0x44,0x36,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x44,0x37,0x07,0x75,0x6E,0x69,0x31,0x45,0x44,0x38,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x44,0x39,0x07,0x75,0x6E,0x69,0x31,0x45,0x44,0x41,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x44,0x42,0x07,0x75,0x6E,0x69,0x31,0x45,0x44,0x43,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x44,0x44,0x07,0x75,0x6E,0x69,0x31,0x45,0x44,0x45,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x44,0x46,0x07,0x75,0x6E,0x69,0x31,0x45,0x45,0x30,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x45,0x31,0x07,0x75,0x6E,0x69,0x31,0x45,0x45,0x32,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x45,0x33,0x07,0x75,0x6E,0x69,0x31,0x45,0x45,0x34,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x45,0x35,0x07,0x75,0x6E,0x69,0x31,0x45,0x45,0x36,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x45,0x37,0x07,0x75,0x6E,0x69,0x31,0x45,0x45,0x38,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x45,0x39,0x07,0x75,0x6E,0x69,0x31,0x45,0x45,0x41,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x45,0x42,0x07,0x75,0x6E,0x69,0x31,0x45,0x45,0x43,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x45,0x44,0x07,0x75,0x6E,0x69,0x31,0x45,0x45,0x45,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x45,0x46,0x07,0x75,0x6E,0x69,0x31,0x45,0x46,0x30,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x46,0x31,0x07,0x75,0x6E,0x69,0x31,0x45,0x46,0x34,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x46,0x35,0x07,0x75,0x6E,0x69,0x31,0x45,0x46,0x36,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x46,0x37,0x07,0x75,0x6E,0x69,0x31,0x45,0x46,0x38,0x07,0x75,0x6E,0x69,
-  0x31,0x45,0x46,0x39,0x07,0x75,0x6E,0x69,0x32,0x30,0x41,0x42,0x07,0x75,0x6E,0x69,
-  0x30,0x33,0x30,0x46,0x13,0x63,0x69,0x72,0x63,0x75,0x6D,0x66,0x6C,0x65,0x78,0x61,
-  0x63,0x75,0x74,0x65,0x63,0x6F,0x6D,0x62,0x13,0x63,0x69,0x72,0x63,0x75,0x6D,0x66,
-  0x6C,0x65,0x78,0x67,0x72,0x61,0x76,0x65,0x63,0x6F,0x6D,0x62,0x12,0x63,0x69,0x72,
-  0x63,0x75,0x6D,0x66,0x6C,0x65,0x78,0x68,0x6F,0x6F,0x6B,0x63,0x6F,0x6D,0x62,0x13,
-  0x63,0x69,0x72,0x63,0x75,0x6D,0x66,0x6C,0x65,0x78,0x74,0x69,0x6C,0x64,0x65,0x63,
-  0x6F,0x6D,0x62,0x0E,0x62,0x72,0x65,0x76,0x65,0x61,0x63,0x75,0x74,0x65,0x63,0x6F,
-  0x6D,0x62,0x0E,0x62,0x72,0x65,0x76,0x65,0x67,0x72,0x61,0x76,0x65,0x63,0x6F,0x6D,
-  0x62,0x0D,0x62,0x72,0x65,0x76,0x65,0x68,0x6F,0x6F,0x6B,0x63,0x6F,0x6D,0x62,0x0E,
-  0x62,0x72,0x65,0x76,0x65,0x74,0x69,0x6C,0x64,0x65,0x63,0x6F,0x6D,0x62,0x10,0x63,
-  0x79,0x72,0x69,0x6C,0x6C,0x69,0x63,0x68,0x6F,0x6F,0x6B,0x6C,0x65,0x66,0x74,0x11,
-  0x63,0x79,0x72,0x69,0x6C,0x6C,0x69,0x63,0x62,0x69,0x67,0x68,0x6F,0x6F,0x6B,0x55,
-  0x43,0x11,0x63,0x79,0x72,0x69,0x6C,0x6C,0x69,0x63,0x62,0x69,0x67,0x68,0x6F,0x6F,
-  0x6B,0x4C,0x43,0x08,0x54,0x63,0x65,0x64,0x69,0x6C,0x6C,0x61,0x08,0x74,0x63,0x65,
-  0x64,0x69,0x6C,0x6C,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x05,0x00,0x02,
-  0xFF,0xFF,0x00,0x03};
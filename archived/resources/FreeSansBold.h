@@ -1,5844 +0,0 @@
-#pragma once
-#include <stdint.h>
-
-const uint8_t freeSansBold[]  = {
-  0x00,0x01,0x00,0x00,0x00,0x0C,0x00,0x80,0x00,0x03,0x00,
-  0x40,0x4F,0x53,0x2F,0x32,0xA3,0xC7,0x2E,0x70,0x00,0x00,
-  0x00,0xCC,0x00,0x00,0x00,0x56,0x63,0x6D,0x61,0x70,0x96,
-  0xFD,0x9C,0xDB,0x00,0x00,0x01,0x24,0x00,0x00,0x03,0x0A,
-  0x63,0x76,0x74,0x20,0x00,0x21,0x02,0x79,0x00,0x00,0x04,
-  0x30,0x00,0x00,0x00,0x04,0x67,0x61,0x73,0x70,0xFF,0xFF,
-  0x00,0x03,0x00,0x00,0x04,0x34,0x00,0x00,0x00,0x08,0x67,
-  0x6C,0x79,0x66,0x54,0x8E,0xAC,0xA9,0x00,0x00,0x04,0x3C,
-  0x00,0x00,0xC6,0xD6,0x68,0x65,0x61,0x64,0xDB,0x03,0xEA,
-  0x95,0x00,0x00,0xCB,0x14,0x00,0x00,0x00,0x36,0x68,0x68,
-  0x65,0x61,0x07,0x5C,0x05,0xF1,0x00,0x00,0xCB,0x4C,0x00,
-  0x00,0x00,0x24,0x68,0x6D,0x74,0x78,0xFA,0xED,0x7D,0x65,
-  0x00,0x00,0xCB,0x70,0x00,0x00,0x0B,0xC4,0x6C,0x6F,0x63,
-  0x61,0xE7,0x0C,0x19,0xEB,0x00,0x00,0xD7,0x34,0x00,0x00,
-  0x05,0xE4,0x6D,0x61,0x78,0x70,0x03,0x41,0x00,0xD9,0x00,
-  0x00,0xDD,0x18,0x00,0x00,0x00,0x20,0x6E,0x61,0x6D,0x65,
-  0x00,0x1F,0x06,0xD9,0x00,0x00,0xDD,0x38,0x00,0x00,0x06,
-  0x73,0x70,0x6F,0x73,0x74,0x4D,0xAF,0xFA,0x78,0x00,0x00,
-  0xE3,0xAC,0x00,0x00,0x17,0x37,0x00,0x01,0x02,0x10,0x02,
-  0xBC,0x00,0x05,0x00,0x00,0x00,0xC8,0x00,0xC8,0x00,0x00,
-  0x00,0xC8,0x00,0xC8,0x00,0xC8,0x00,0x00,0x00,0xC8,0x00,
-  0x31,0x01,0x02,0x00,0x00,0x02,0x0B,0x07,0x04,0x02,0x02,
-  0x02,0x02,0x02,0x04,0x80,0x00,0x2A,0xAF,0x50,0x00,0x20,
-  0x4A,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x50,0x66,
-  0x45,0x64,0x00,0x20,0x00,0x20,0xFE,0x9E,0x03,0xD3,0xFE,
-  0x9D,0x00,0x5A,0x03,0xD3,0x01,0x63,0x00,0x00,0x00,0xBF,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,
-  0x00,0x00,0x03,0x00,0x00,0x00,0x1C,0x00,0x01,0x00,0x00,
-  0x00,0x00,0x02,0x04,0x00,0x03,0x00,0x01,0x00,0x00,0x00,
-  0x1C,0x00,0x04,0x01,0xE8,0x00,0x00,0x00,0x76,0x00,0x40,
-  0x00,0x05,0x00,0x36,0x00,0x0D,0x00,0x7E,0x00,0xAC,0x01,
-  0x7F,0x01,0x92,0x02,0x1B,0x02,0xC7,0x02,0xDD,0x03,0x8A,
-  0x03,0x8C,0x03,0x8F,0x03,0xA1,0x03,0xCE,0x04,0x5F,0x04,
-  0xC4,0x04,0xC8,0x04,0xCC,0x04,0xF5,0x04,0xF9,0x05,0xB9,
-  0x05,0xC4,0x05,0xEA,0x05,0xF4,0x06,0x1C,0x06,0x21,0x06,
-  0x28,0x06,0x2B,0x06,0x2E,0x06,0x33,0x20,0x14,0x20,0x1A,
-  0x20,0x1E,0x20,0x22,0x20,0x26,0x20,0x30,0x20,0x3A,0x20,
-  0x44,0x20,0xAA,0x20,0xAC,0x21,0x22,0x22,0x02,0x22,0x06,
-  0x22,0x12,0x22,0x1A,0x22,0x60,0x22,0x65,0x25,0xCA,0xF6,
-  0x41,0xF6,0xC3,0xF6,0xDC,0xFB,0x02,0xFB,0x36,0xFB,0x3C,
-  0xFB,0x3E,0xFB,0x41,0xFB,0x44,0xFB,0x4F,0xFE,0x9E,0xFF,
-  0xFF,0x00,0x00,0x00,0x0D,0x00,0x20,0x00,0xA1,0x00,0xAE,
-  0x01,0x92,0x02,0x18,0x02,0xC6,0x02,0xD8,0x03,0x85,0x03,
-  0x8C,0x03,0x8E,0x03,0x91,0x03,0xA3,0x04,0x00,0x04,0x8C,
-  0x04,0xC7,0x04,0xCB,0x04,0xD0,0x04,0xF8,0x05,0xB0,0x05,
-  0xBB,0x05,0xD0,0x05,0xF0,0x06,0x17,0x06,0x21,0x06,0x28,
-  0x06,0x2A,0x06,0x2D,0x06,0x33,0x20,0x13,0x20,0x18,0x20,
-  0x1C,0x20,0x20,0x20,0x26,0x20,0x30,0x20,0x39,0x20,0x44,
-  0x20,0xAA,0x20,0xAC,0x21,0x22,0x22,0x02,0x22,0x06,0x22,
-  0x11,0x22,0x1A,0x22,0x60,0x22,0x64,0x25,0xCA,0xF6,0x39,
-  0xF6,0xC3,0xF6,0xDC,0xFB,0x01,0xFB,0x1D,0xFB,0x38,0xFB,
-  0x3E,0xFB,0x40,0xFB,0x43,0xFB,0x46,0xFE,0x9E,0xFF,0xFF,
-  0xFF,0xF5,0xFF,0xE3,0xFF,0xC1,0xFF,0xC0,0xFF,0xAE,0xFF,
-  0x29,0xFE,0x7F,0xFE,0x6F,0xFD,0xC8,0xFD,0xC7,0xFD,0xC6,
-  0xFD,0xC5,0xFD,0xC4,0xFD,0x93,0xFD,0x67,0xFD,0x65,0xFD,
-  0x63,0xFD,0x60,0xFD,0x5E,0xFC,0xA8,0xFC,0xA7,0xFC,0x9C,
-  0xFC,0x97,0xFC,0x75,0xFC,0x71,0xFC,0x6B,0xFC,0x6A,0xFC,
-  0x69,0xFC,0x65,0xE2,0x86,0xE2,0x83,0xE2,0x82,0xE2,0x81,
-  0xE2,0x7E,0xE2,0x75,0xE2,0x6D,0xE2,0x64,0xE1,0xFF,0xE1,
-  0xFE,0xE1,0x89,0xE0,0xAA,0xE0,0xA7,0xE0,0x9D,0xE0,0x96,
-  0xE0,0x51,0xE0,0x4E,0xDC,0xEA,0x0C,0x7C,0x0B,0xFB,0x0B,
-  0xE3,0x07,0xBF,0x07,0xA5,0x07,0xA4,0x07,0xA3,0x07,0xA2,
-  0x07,0xA1,0x07,0xA0,0x04,0x52,0x00,0x01,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x06,0x00,0x00,
-  0x01,0x90,0xB0,0x00,0x00,0x00,0x00,0x9D,0x01,0x03,0x00,
-  0x9E,0xBE,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7D,
-  0x7C,0x79,0x7E,0x73,0x72,0x67,0x00,0x01,0x00,0x00,0x03,
-  0x04,0x05,0x06,0x07,0x08,0x09,0x0A,0x0B,0x0C,0x0D,0x0E,
-  0x0F,0x10,0x11,0x12,0x13,0x14,0x15,0x16,0x17,0x18,0x19,
-  0x1A,0x1B,0x1C,0x1D,0x1E,0x1F,0x20,0x21,0x22,0x23,0x24,
-  0x25,0x26,0x27,0x28,0x29,0x2A,0x2B,0x2C,0x2D,0x2E,0x2F,
-  0x30,0x31,0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x39,0x3A,
-  0x3B,0x3C,0x3D,0x3E,0x3F,0x40,0x41,0x42,0x43,0x44,0x45,
-  0x46,0x47,0x48,0x49,0x4A,0x4B,0x4C,0x4D,0x4E,0x4F,0x50,
-  0x51,0x52,0x53,0x54,0x55,0x56,0x57,0x58,0x59,0x5A,0x5B,
-  0x5C,0x5D,0x5E,0x5F,0x60,0x61,0x00,0x84,0x85,0x87,0x89,
-  0x91,0x96,0x9C,0xA1,0xA0,0xA2,0xA4,0xA3,0xA5,0xA7,0xA9,
-  0xA8,0xAA,0xAB,0xAD,0xAC,0xAE,0xAF,0xB1,0xB3,0xB2,0xB4,
-  0xB6,0xB5,0xBA,0xB9,0xBB,0xBC,0x00,0x70,0x63,0x64,0x68,
-  0x00,0x76,0x9F,0x6E,0x6A,0x00,0x74,0x69,0x00,0x86,0x98,
-  0x00,0x71,0x00,0x00,0x66,0x75,0x00,0x00,0x00,0x00,0x00,
-  0x6B,0x7A,0x00,0xA6,0xB8,0x7F,0x62,0x6D,0x00,0x00,0x00,
-  0x00,0x6C,0x7B,0x00,0x00,0x80,0x83,0x95,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0xB7,0x00,0xBF,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x77,0x00,0x00,0x00,0x82,0x8A,
-  0x81,0x8B,0x88,0x8D,0x8E,0x8F,0x8C,0x93,0x94,0x00,0x92,
-  0x9A,0x9B,0x99,0x00,0x00,0x00,0x6F,0x00,0x00,0x00,0x78,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x02,0x79,0x00,0x00,
-  0x00,0x01,0xFF,0xFF,0x00,0x02,0x00,0x02,0x00,0x21,0x00,
-  0x00,0x01,0x6E,0x02,0x9A,0x00,0x03,0x00,0x07,0x00,0x2E,
-  0xB1,0x01,0x00,0x2F,0x3C,0xB2,0x07,0x04,0x00,0xED,0x32,
-  0xB1,0x06,0x05,0xDC,0x3C,0xB2,0x03,0x02,0x00,0xED,0x32,
-  0x00,0xB1,0x03,0x00,0x2F,0x3C,0xB2,0x05,0x04,0x00,0xED,
-  0x32,0xB2,0x07,0x06,0x01,0xFC,0x3C,0xB2,0x01,0x02,0x00,
-  0xED,0x32,0x33,0x11,0x21,0x11,0x25,0x21,0x11,0x21,0x21,
-  0x01,0x4D,0xFE,0xD4,0x01,0x0B,0xFE,0xF5,0x02,0x9A,0xFD,
-  0x66,0x21,0x02,0x58,0x00,0x02,0x00,0x70,0x00,0x00,0x01,
-  0x06,0x02,0xD6,0x00,0x05,0x00,0x09,0x00,0x00,0x01,0x15,
-  0x03,0x23,0x03,0x35,0x13,0x15,0x23,0x35,0x01,0x06,0x2A,
-  0x43,0x29,0x96,0x96,0x02,0xD6,0xD2,0xFE,0xCB,0x01,0x35,
-  0xD2,0xFD,0xBC,0x92,0x92,0x00,0x00,0x02,0x00,0x32,0x01,
-  0xD6,0x01,0xA8,0x02,0xD9,0x00,0x05,0x00,0x0B,0x00,0x00,
-  0x13,0x15,0x07,0x23,0x27,0x35,0x21,0x15,0x07,0x23,0x27,
-  0x35,0xBC,0x2A,0x38,0x28,0x01,0x76,0x2A,0x38,0x28,0x02,
-  0xD9,0x82,0x81,0x81,0x82,0x82,0x81,0x81,0x82,0x00,0x00,
-  0x02,0x00,0x03,0xFF,0xE0,0x02,0x29,0x02,0xB9,0x00,0x1B,
-  0x00,0x1F,0x00,0x00,0x17,0x23,0x37,0x23,0x35,0x33,0x37,
-  0x23,0x35,0x33,0x37,0x33,0x07,0x33,0x37,0x33,0x07,0x33,
-  0x15,0x23,0x07,0x33,0x15,0x23,0x07,0x23,0x37,0x23,0x37,
-  0x33,0x37,0x23,0x92,0x6A,0x28,0x4D,0x61,0x1E,0x63,0x77,
-  0x22,0x69,0x22,0x67,0x22,0x69,0x22,0x5A,0x6D,0x1F,0x64,
-  0x77,0x28,0x69,0x28,0x67,0x13,0x67,0x1E,0x67,0x20,0xCC,
-  0x63,0x99,0x63,0xAE,0xAE,0xAE,0xAE,0x63,0x99,0x63,0xCC,
-  0xCC,0x63,0x99,0x00,0x03,0x00,0x16,0xFF,0x82,0x02,0x0F,
-  0x02,0xFB,0x00,0x2D,0x00,0x34,0x00,0x39,0x00,0x00,0x01,
-  0x23,0x36,0x27,0x26,0x27,0x15,0x16,0x17,0x16,0x15,0x14,
-  0x07,0x06,0x07,0x06,0x07,0x15,0x23,0x35,0x26,0x27,0x26,
-  0x3D,0x01,0x33,0x16,0x17,0x35,0x26,0x35,0x34,0x37,0x36,
-  0x37,0x35,0x33,0x15,0x16,0x17,0x15,0x30,0x31,0x16,0x15,
-  0x16,0x05,0x35,0x06,0x15,0x14,0x17,0x16,0x17,0x15,0x36,
-  0x35,0x34,0x02,0x05,0x80,0x03,0x37,0x0C,0x0E,0x99,0x29,
-  0x16,0x44,0x09,0x09,0x33,0x4F,0x44,0x52,0x35,0x56,0x83,
-  0x05,0x55,0xCC,0x69,0x2A,0x39,0x44,0x81,0x34,0x01,0x17,
-  0xFE,0xEF,0x51,0x48,0x04,0x49,0x54,0x01,0xF2,0x4E,0x19,
-  0x05,0x02,0xC9,0x2A,0x4C,0x27,0x37,0x68,0x3A,0x07,0x06,
-  0x20,0x09,0x69,0x69,0x08,0x26,0x3D,0x70,0x09,0x6A,0x0F,
-  0xD5,0x2F,0xA6,0x79,0x32,0x15,0x05,0x36,0x36,0x07,0x61,
-  0x01,0x01,0x01,0x2D,0x82,0xB5,0x10,0x4C,0x3C,0x1A,0x01,
-  0x93,0xC4,0x15,0x4C,0x49,0x00,0x00,0x05,0x00,0x16,0xFF,
-  0xEC,0x03,0x5F,0x02,0xC5,0x00,0x11,0x00,0x21,0x00,0x25,
-  0x00,0x35,0x00,0x49,0x00,0x00,0x13,0x32,0x17,0x16,0x17,
-  0x16,0x15,0x14,0x07,0x06,0x23,0x22,0x27,0x26,0x35,0x34,
-  0x37,0x36,0x17,0x22,0x07,0x06,0x15,0x14,0x17,0x16,0x33,
-  0x32,0x37,0x36,0x35,0x34,0x27,0x26,0x25,0x33,0x01,0x23,
-  0x01,0x32,0x17,0x16,0x15,0x14,0x07,0x06,0x23,0x22,0x27,
-  0x26,0x35,0x34,0x37,0x36,0x17,0x22,0x07,0x06,0x15,0x14,
-  0x17,0x33,0x16,0x33,0x32,0x37,0x36,0x35,0x34,0x27,0x22,
-  0x31,0x27,0x26,0xCE,0x59,0x37,0x1C,0x08,0x04,0x42,0x34,
-  0x42,0x56,0x37,0x2B,0x43,0x33,0x42,0x30,0x19,0x0C,0x29,
-  0x14,0x18,0x2F,0x1A,0x0C,0x2B,0x13,0x01,0x79,0x4C,0xFE,
-  0x75,0x4D,0x01,0xD5,0x5A,0x36,0x28,0x42,0x34,0x42,0x56,
-  0x37,0x2B,0x43,0x33,0x42,0x30,0x19,0x0C,0x29,0x01,0x14,
-  0x17,0x2F,0x1A,0x0C,0x29,0x01,0x01,0x13,0x02,0xBD,0x44,
-  0x23,0x2C,0x12,0x13,0x52,0x37,0x2B,0x42,0x33,0x41,0x55,
-  0x37,0x2A,0x63,0x29,0x13,0x17,0x2F,0x19,0x0C,0x29,0x13,
-  0x17,0x31,0x18,0x0B,0x6B,0xFD,0x27,0x01,0x74,0x45,0x32,
-  0x42,0x52,0x37,0x2B,0x42,0x33,0x42,0x55,0x37,0x2A,0x63,
-  0x29,0x14,0x17,0x2F,0x19,0x0C,0x29,0x13,0x17,0x30,0x19,
-  0x01,0x0B,0x00,0x03,0x00,0x37,0xFF,0xE9,0x02,0xB6,0x02,
-  0xD3,0x00,0x2B,0x00,0x35,0x00,0x42,0x00,0x00,0x01,0x33,
-  0x1D,0x01,0x06,0x07,0x06,0x07,0x17,0x23,0x27,0x06,0x07,
-  0x06,0x23,0x22,0x27,0x26,0x35,0x34,0x37,0x36,0x37,0x26,
-  0x2F,0x01,0x26,0x35,0x34,0x37,0x36,0x33,0x32,0x17,0x15,
-  0x16,0x15,0x14,0x07,0x06,0x07,0x17,0x36,0x35,0x0F,0x01,
-  0x06,0x15,0x14,0x17,0x16,0x33,0x32,0x37,0x03,0x36,0x35,
-  0x26,0x27,0x22,0x07,0x06,0x15,0x14,0x17,0x33,0x16,0x02,
-  0x0E,0x71,0x03,0x32,0x07,0x08,0x7B,0xA1,0x2E,0x57,0x40,
-  0x14,0x18,0x82,0x41,0x2A,0x3C,0x22,0x3F,0x09,0x03,0x1C,
-  0x2A,0x46,0x33,0x44,0x6B,0x2F,0x18,0x32,0x18,0x2B,0x74,
-  0x1E,0xF8,0x2F,0x2B,0x2D,0x1D,0x20,0x30,0x48,0x61,0x3C,
-  0x09,0x30,0x2B,0x0C,0x03,0x13,0x01,0x09,0x01,0x75,0x0B,
-  0x05,0x6B,0x4C,0x0B,0x09,0x9A,0x38,0x42,0x0A,0x03,0x55,
-  0x36,0x4D,0x59,0x37,0x1F,0x21,0x0C,0x03,0x22,0x32,0x38,
-  0x52,0x31,0x24,0x46,0x01,0x24,0x30,0x47,0x33,0x18,0x1E,
-  0x90,0x39,0x3A,0x2C,0x1D,0x1D,0x33,0x37,0x26,0x18,0x37,
-  0x01,0x42,0x21,0x35,0x35,0x05,0x20,0x07,0x09,0x17,0x1B,
-  0x0E,0x00,0x00,0x01,0x00,0x32,0x01,0xD6,0x00,0xBC,0x02,
-  0xD9,0x00,0x05,0x00,0x00,0x13,0x15,0x07,0x23,0x27,0x35,
-  0xBC,0x2A,0x38,0x28,0x02,0xD9,0x82,0x81,0x81,0x82,0x00,
-  0x01,0x00,0x28,0xFF,0x38,0x01,0x2F,0x02,0xD9,0x00,0x11,
-  0x00,0x00,0x13,0x33,0x06,0x07,0x06,0x15,0x14,0x17,0x16,
-  0x17,0x23,0x26,0x27,0x26,0x35,0x34,0x37,0x36,0xCB,0x64,
-  0x6C,0x16,0x0A,0x3A,0x1D,0x35,0x64,0x8A,0x15,0x04,0x6D,
-  0x18,0x02,0xD9,0xD0,0x85,0x3A,0x41,0x90,0x92,0x49,0x66,
-  0xD0,0xB2,0x26,0x29,0xB9,0xBF,0x2A,0x00,0x00,0x01,0x00,
-  0x16,0xFF,0x38,0x01,0x1D,0x02,0xD9,0x00,0x11,0x00,0x00,
-  0x17,0x23,0x36,0x37,0x36,0x35,0x34,0x27,0x26,0x27,0x33,
-  0x16,0x17,0x16,0x15,0x14,0x07,0x06,0x7A,0x64,0x6C,0x16,
-  0x0A,0x3A,0x1D,0x35,0x64,0x8A,0x15,0x04,0x6D,0x18,0xC8,
-  0xD0,0x85,0x3A,0x41,0x90,0x92,0x49,0x66,0xD0,0xB2,0x26,
-  0x29,0xB9,0xBF,0x2A,0x00,0x01,0x00,0x17,0x01,0x97,0x01,
-  0x65,0x02,0xD9,0x00,0x0E,0x00,0x00,0x13,0x27,0x37,0x17,
-  0x35,0x33,0x15,0x37,0x17,0x07,0x17,0x07,0x27,0x07,0x27,
-  0x84,0x6D,0x16,0x6D,0x48,0x6D,0x16,0x6D,0x43,0x3A,0x43,
-  0x43,0x3A,0x02,0x20,0x24,0x45,0x24,0x74,0x74,0x24,0x46,
-  0x23,0x5E,0x2B,0x5E,0x5E,0x2B,0x00,0x00,0x01,0x00,0x32,
-  0xFF,0xF6,0x02,0x15,0x01,0xD9,0x00,0x0B,0x00,0x00,0x01,
-  0x15,0x23,0x15,0x23,0x35,0x23,0x35,0x33,0x35,0x33,0x15,
-  0x02,0x15,0xB6,0x77,0xB6,0xB6,0x77,0x01,0x23,0x77,0xB6,
-  0xB6,0x77,0xB6,0xB6,0x00,0x00,0x01,0x00,0x40,0xFF,0x52,
-  0x00,0xD6,0x00,0x92,0x00,0x0F,0x00,0x00,0x37,0x33,0x15,
-  0x14,0x07,0x06,0x07,0x06,0x07,0x35,0x36,0x37,0x36,0x3D,
-  0x01,0x23,0x40,0x96,0x22,0x09,0x0B,0x27,0x39,0x4C,0x09,
-  0x01,0x56,0x92,0x89,0x5A,0x26,0x09,0x09,0x1E,0x07,0x38,
-  0x10,0x4C,0x0B,0x0C,0x03,0x00,0x00,0x01,0x00,0x1A,0x00,
-  0xCF,0x01,0x2A,0x01,0x56,0x00,0x03,0x00,0x00,0x01,0x15,
-  0x21,0x35,0x01,0x2A,0xFE,0xF0,0x01,0x56,0x87,0x87,0x00,
-  0x01,0x00,0x40,0x00,0x00,0x00,0xD6,0x00,0x92,0x00,0x03,
-  0x00,0x00,0x37,0x15,0x23,0x35,0xD6,0x96,0x92,0x92,0x92,
-  0x00,0x00,0x01,0x00,0x02,0xFF,0xF2,0x01,0x13,0x02,0xCA,
-  0x00,0x03,0x00,0x00,0x13,0x33,0x03,0x23,0xD0,0x43,0xCE,
-  0x43,0x02,0xCA,0xFD,0x28,0x00,0x02,0x00,0x1D,0xFF,0xE9,
-  0x02,0x05,0x02,0xD4,0x00,0x14,0x00,0x24,0x00,0x00,0x01,
-  0x32,0x1F,0x01,0x16,0x17,0x16,0x15,0x14,0x07,0x06,0x23,
-  0x22,0x27,0x26,0x27,0x26,0x35,0x34,0x37,0x36,0x17,0x22,
-  0x07,0x06,0x15,0x14,0x17,0x16,0x33,0x32,0x37,0x36,0x35,
-  0x34,0x27,0x26,0x01,0x11,0x7D,0x41,0x01,0x01,0x02,0x32,
-  0x3C,0x43,0x75,0x79,0x42,0x04,0x03,0x32,0x3C,0x42,0x76,
-  0x3D,0x19,0x12,0x16,0x1A,0x38,0x3D,0x19,0x12,0x16,0x1A,
-  0x02,0xD4,0x63,0x01,0x02,0x03,0x51,0xC0,0xC5,0x51,0x5B,
-  0x5F,0x05,0x05,0x52,0xBA,0xCB,0x50,0x5B,0x71,0x43,0x34,
-  0x8D,0x98,0x2F,0x37,0x41,0x32,0x89,0x9E,0x2F,0x39,0x00,
-  0x00,0x01,0x00,0x44,0x00,0x00,0x01,0x7A,0x02,0xC5,0x00,
-  0x07,0x00,0x00,0x13,0x23,0x35,0x32,0x37,0x33,0x11,0x23,
-  0xEE,0xAA,0xB8,0x21,0x5D,0x8C,0x01,0xE9,0x5D,0x7F,0xFD,
-  0x3B,0x00,0x01,0x00,0x1E,0x00,0x00,0x02,0x03,0x02,0xD4,
-  0x00,0x26,0x00,0x00,0x25,0x15,0x21,0x36,0x37,0x36,0x37,
-  0x36,0x37,0x36,0x35,0x34,0x27,0x26,0x23,0x22,0x07,0x06,
-  0x1D,0x01,0x23,0x26,0x35,0x34,0x37,0x36,0x33,0x32,0x17,
-  0x16,0x15,0x14,0x07,0x06,0x07,0x06,0x07,0x06,0x07,0x02,
-  0x00,0xFE,0x1E,0x06,0x33,0x22,0x49,0x7D,0x1F,0x19,0x3D,
-  0x12,0x15,0x4C,0x14,0x05,0x86,0x01,0x6F,0x34,0x46,0x8C,
-  0x41,0x26,0x32,0x22,0x4B,0x68,0x17,0x09,0x08,0x7D,0x7D,
-  0x74,0x42,0x2C,0x32,0x59,0x2A,0x23,0x36,0x54,0x17,0x07,
-  0x4D,0x16,0x1A,0x17,0x0B,0x0E,0x9B,0x38,0x1A,0x5D,0x37,
-  0x4D,0x55,0x3B,0x29,0x37,0x4C,0x1E,0x0C,0x10,0x00,0x01,
-  0x00,0x1D,0xFF,0xE9,0x02,0x04,0x02,0xD4,0x00,0x38,0x00,
-  0x00,0x13,0x35,0x33,0x32,0x35,0x34,0x27,0x26,0x23,0x22,
-  0x07,0x06,0x07,0x06,0x07,0x23,0x35,0x34,0x37,0x36,0x33,
-  0x32,0x17,0x16,0x15,0x14,0x07,0x22,0x15,0x06,0x07,0x16,
-  0x17,0x16,0x15,0x14,0x07,0x30,0x07,0x06,0x23,0x22,0x27,
-  0x26,0x27,0x33,0x16,0x33,0x32,0x37,0x36,0x35,0x34,0x27,
-  0x26,0x27,0x26,0xD9,0x0C,0x7C,0x40,0x0B,0x0D,0x3D,0x17,
-  0x01,0x01,0x0A,0x01,0x82,0x29,0x3E,0x7F,0x86,0x3B,0x20,
-  0x48,0x01,0x09,0x0B,0x67,0x0B,0x02,0x60,0x01,0x3E,0x59,
-  0x8A,0x3F,0x25,0x01,0x88,0x06,0x64,0x3D,0x1D,0x0F,0x34,
-  0x0C,0x0D,0x1C,0x01,0x3D,0x5E,0x6B,0x4D,0x0E,0x02,0x2D,
-  0x02,0x03,0x19,0x32,0x0C,0x5F,0x33,0x50,0x54,0x2E,0x3F,
-  0x54,0x35,0x01,0x06,0x07,0x32,0x62,0x0D,0x0F,0x7E,0x3D,
-  0x01,0x27,0x5F,0x38,0x50,0x6F,0x32,0x19,0x20,0x42,0x1E,
-  0x06,0x04,0x07,0x00,0x00,0x02,0x00,0x18,0x00,0x00,0x02,
-  0x0A,0x02,0xC5,0x00,0x0A,0x00,0x0D,0x00,0x00,0x01,0x15,
-  0x23,0x15,0x23,0x35,0x21,0x35,0x01,0x33,0x11,0x23,0x11,
-  0x03,0x02,0x0A,0x4A,0x8C,0xFE,0xE4,0x01,0x03,0xA5,0x8C,
-  0xB9,0x01,0x11,0x74,0x9D,0x9D,0x76,0x01,0xB2,0xFE,0x4C,
-  0x01,0x2F,0xFE,0xD1,0x00,0x00,0x01,0x00,0x1B,0xFF,0xE9,
-  0x02,0x05,0x02,0xC5,0x00,0x22,0x00,0x00,0x01,0x15,0x21,
-  0x07,0x36,0x33,0x32,0x17,0x16,0x15,0x14,0x07,0x06,0x23,
-  0x22,0x27,0x26,0x27,0x33,0x16,0x17,0x32,0x37,0x36,0x35,
-  0x34,0x27,0x34,0x23,0x26,0x23,0x22,0x07,0x23,0x13,0x01,
-  0xE9,0xFE,0xDB,0x17,0x39,0x42,0x72,0x3E,0x2D,0x5C,0x43,
-  0x61,0x7F,0x41,0x29,0x01,0x8A,0x0E,0x54,0x4C,0x1B,0x0B,
-  0x44,0x01,0x14,0x19,0x43,0x17,0x7E,0x3F,0x02,0xC5,0x7D,
-  0x94,0x2B,0x59,0x40,0x5C,0x84,0x48,0x35,0x53,0x34,0x49,
-  0x53,0x05,0x46,0x1C,0x24,0x64,0x1C,0x01,0x08,0x36,0x01,
-  0x8B,0x00,0x02,0x00,0x20,0xFF,0xE9,0x02,0x07,0x02,0xD4,
-  0x00,0x30,0x00,0x40,0x00,0x00,0x01,0x23,0x26,0x27,0x26,
-  0x23,0x22,0x07,0x06,0x07,0x06,0x15,0x06,0x07,0x36,0x37,
-  0x32,0x33,0x31,0x36,0x33,0x32,0x17,0x16,0x15,0x14,0x07,
-  0x06,0x23,0x22,0x27,0x26,0x27,0x26,0x35,0x34,0x37,0x36,
-  0x37,0x36,0x37,0x32,0x33,0x32,0x1F,0x01,0x16,0x17,0x16,
-  0x07,0x22,0x07,0x06,0x15,0x14,0x17,0x16,0x33,0x32,0x37,
-  0x36,0x35,0x34,0x27,0x26,0x01,0xFB,0x82,0x16,0x2C,0x09,
-  0x0C,0x48,0x1C,0x05,0x03,0x01,0x06,0x03,0x36,0x43,0x01,
-  0x01,0x09,0x09,0x6C,0x39,0x29,0x57,0x3E,0x58,0x6F,0x43,
-  0x0C,0x09,0x33,0x32,0x04,0x05,0x3F,0x7F,0x07,0x06,0x70,
-  0x3C,0x01,0x03,0x03,0x19,0xDB,0x42,0x1D,0x0E,0x35,0x19,
-  0x1E,0x3C,0x1F,0x11,0x39,0x16,0x02,0x24,0x36,0x07,0x02,
-  0x48,0x0C,0x0E,0x02,0x02,0x1E,0x4B,0x39,0x05,0x01,0x55,
-  0x3C,0x55,0x88,0x48,0x34,0x4D,0x0D,0x0F,0x51,0xAE,0xA9,
-  0x5C,0x08,0x08,0x68,0x06,0x48,0x01,0x04,0x04,0x24,0xFA,
-  0x3E,0x1E,0x28,0x4F,0x22,0x0F,0x3A,0x20,0x29,0x56,0x1F,
-  0x0C,0x00,0x00,0x01,0x00,0x1D,0x00,0x00,0x02,0x10,0x02,
-  0xC5,0x00,0x10,0x00,0x00,0x01,0x15,0x06,0x07,0x06,0x07,
-  0x23,0x36,0x37,0x36,0x37,0x36,0x37,0x36,0x37,0x21,0x35,
-  0x02,0x10,0xAC,0x35,0x17,0x06,0x8D,0x18,0x38,0x06,0x07,
-  0x23,0x50,0x19,0x10,0xFE,0x9F,0x02,0xC5,0x6E,0xD0,0xC7,
-  0x59,0x67,0xC0,0x80,0x0D,0x0E,0x4D,0x6E,0x20,0x12,0x7D,
-  0x00,0x03,0x00,0x16,0xFF,0xE9,0x02,0x0D,0x02,0xD4,0x00,
-  0x21,0x00,0x31,0x00,0x41,0x00,0x00,0x01,0x16,0x17,0x16,
-  0x15,0x14,0x07,0x06,0x23,0x22,0x27,0x26,0x35,0x34,0x37,
-  0x36,0x37,0x26,0x27,0x31,0x26,0x35,0x34,0x37,0x36,0x33,
-  0x32,0x1F,0x01,0x16,0x15,0x14,0x07,0x06,0x27,0x22,0x07,
-  0x06,0x15,0x14,0x17,0x16,0x33,0x32,0x37,0x36,0x35,0x34,
-  0x27,0x26,0x03,0x22,0x07,0x06,0x15,0x14,0x17,0x16,0x33,
-  0x32,0x37,0x36,0x35,0x34,0x27,0x26,0x01,0x99,0x60,0x10,
-  0x04,0x5A,0x42,0x5F,0x84,0x46,0x32,0x4E,0x11,0x15,0x51,
-  0x0A,0x01,0x51,0x3E,0x55,0x75,0x41,0x01,0x2C,0x2E,0x0E,
-  0xA6,0x45,0x1B,0x0A,0x35,0x18,0x1D,0x41,0x1C,0x0C,0x35,
-  0x16,0x20,0x49,0x1B,0x0B,0x3C,0x17,0x1C,0x49,0x1C,0x0B,
-  0x3F,0x16,0x01,0x82,0x33,0x55,0x15,0x19,0x73,0x40,0x30,
-  0x55,0x3B,0x53,0x66,0x39,0x0C,0x0B,0x2B,0x4D,0x0C,0x0D,
-  0x60,0x37,0x2A,0x49,0x01,0x32,0x44,0x49,0x2B,0x0D,0xD0,
-  0x31,0x14,0x17,0x3A,0x19,0x0B,0x2F,0x15,0x19,0x3A,0x18,
-  0x0B,0xFE,0xE7,0x3D,0x19,0x20,0x4E,0x1B,0x0A,0x3A,0x19,
-  0x1E,0x54,0x1B,0x09,0x00,0x00,0x02,0x00,0x1C,0xFF,0xE8,
-  0x02,0x04,0x02,0xD4,0x00,0x20,0x00,0x32,0x00,0x00,0x37,
-  0x33,0x16,0x17,0x16,0x33,0x32,0x35,0x06,0x07,0x06,0x23,
-  0x22,0x27,0x26,0x35,0x34,0x37,0x36,0x33,0x32,0x17,0x16,
-  0x15,0x14,0x07,0x06,0x07,0x06,0x23,0x22,0x27,0x26,0x13,
-  0x22,0x07,0x30,0x07,0x06,0x15,0x14,0x17,0x16,0x33,0x32,
-  0x37,0x36,0x35,0x34,0x27,0x26,0x26,0x87,0x04,0x31,0x0F,
-  0x12,0x75,0x1F,0x0D,0x24,0x38,0x6E,0x3B,0x2B,0x58,0x3E,
-  0x59,0x83,0x45,0x31,0x36,0x02,0x03,0x40,0x8A,0x6D,0x3F,
-  0x2B,0xDF,0x42,0x19,0x01,0x0A,0x3C,0x14,0x18,0x41,0x1D,
-  0x0E,0x3D,0x16,0xA5,0x31,0x0F,0x05,0xCA,0x23,0x09,0x1A,
-  0x5A,0x40,0x5C,0x82,0x46,0x32,0x74,0x51,0x9D,0xAE,0x65,
-  0x05,0x04,0x6E,0x48,0x32,0x02,0x00,0x44,0x01,0x1C,0x25,
-  0x5D,0x1D,0x0A,0x3D,0x1E,0x27,0x5D,0x20,0x0B,0x00,0x00,
-  0x02,0x00,0x71,0x00,0x00,0x01,0x07,0x02,0x08,0x00,0x03,
-  0x00,0x07,0x00,0x00,0x25,0x15,0x23,0x35,0x13,0x15,0x23,
-  0x35,0x01,0x07,0x96,0x96,0x96,0x92,0x92,0x92,0x01,0x76,
-  0x92,0x92,0x00,0x02,0x00,0x71,0xFF,0x52,0x01,0x07,0x02,
-  0x08,0x00,0x0F,0x00,0x13,0x00,0x00,0x37,0x33,0x15,0x14,
-  0x07,0x06,0x07,0x06,0x07,0x35,0x36,0x37,0x36,0x3D,0x01,
-  0x23,0x13,0x15,0x23,0x35,0x71,0x96,0x22,0x09,0x0B,0x27,
-  0x39,0x4C,0x09,0x01,0x56,0x96,0x96,0x92,0x89,0x5A,0x26,
-  0x09,0x09,0x1E,0x07,0x38,0x10,0x4C,0x0B,0x0C,0x03,0x02,
-  0x08,0x92,0x92,0x00,0x00,0x01,0x00,0x28,0xFF,0xF6,0x02,
-  0x11,0x01,0xDA,0x00,0x06,0x00,0x00,0x01,0x15,0x0D,0x01,
-  0x15,0x25,0x35,0x02,0x11,0xFE,0x82,0x01,0x7E,0xFE,0x17,
-  0x01,0xDA,0x6D,0x85,0x83,0x6F,0xB6,0x79,0x00,0x00,0x02,
-  0x00,0x32,0x00,0x34,0x02,0x16,0x01,0x9B,0x00,0x03,0x00,
-  0x07,0x00,0x00,0x01,0x15,0x21,0x35,0x05,0x15,0x21,0x35,
-  0x02,0x16,0xFE,0x1C,0x01,0xE4,0xFE,0x1C,0x01,0x9B,0x77,
-  0x77,0xF0,0x77,0x77,0x00,0x00,0x01,0x00,0x28,0xFF,0xF6,
-  0x02,0x11,0x01,0xDA,0x00,0x06,0x00,0x00,0x17,0x35,0x2D,
-  0x01,0x35,0x05,0x15,0x28,0x01,0x7E,0xFE,0x82,0x01,0xE9,
-  0x0A,0x6D,0x85,0x83,0x6F,0xB6,0x79,0x00,0x00,0x02,0x00,
-  0x40,0x00,0x00,0x02,0x2C,0x02,0xE8,0x00,0x2D,0x00,0x31,
-  0x00,0x00,0x25,0x23,0x26,0x37,0x36,0x37,0x36,0x37,0x35,
-  0x36,0x35,0x34,0x27,0x26,0x23,0x22,0x07,0x06,0x17,0x15,
-  0x23,0x36,0x37,0x36,0x37,0x36,0x33,0x32,0x17,0x14,0x17,
-  0x16,0x17,0x16,0x15,0x14,0x07,0x06,0x07,0x06,0x07,0x06,
-  0x07,0x06,0x07,0x06,0x17,0x15,0x23,0x35,0x01,0x71,0x7C,
-  0x03,0x29,0x15,0x28,0x38,0x0A,0x05,0x31,0x19,0x1F,0x3D,
-  0x1F,0x14,0x02,0x88,0x01,0x29,0x02,0x03,0x41,0x83,0x82,
-  0x46,0x01,0x2B,0x04,0x01,0x2B,0x0B,0x0F,0x12,0x18,0x04,
-  0x05,0x30,0x0A,0x09,0x10,0x96,0xC9,0x52,0x35,0x1C,0x23,
-  0x2E,0x1C,0x01,0x0E,0x17,0x42,0x20,0x11,0x3A,0x25,0x30,
-  0x02,0x6C,0x3A,0x04,0x04,0x59,0x55,0x01,0x01,0x35,0x49,
-  0x08,0x09,0x4E,0x32,0x0D,0x0D,0x10,0x11,0x04,0x03,0x22,
-  0x14,0x13,0x65,0x92,0x92,0x00,0x00,0x02,0x00,0x1B,0xFF,
-  0x76,0x03,0xB3,0x02,0xE9,0x00,0x4F,0x00,0x66,0x00,0x00,
-  0x01,0x33,0x03,0x06,0x15,0x14,0x17,0x16,0x33,0x32,0x37,
-  0x36,0x37,0x36,0x35,0x34,0x27,0x26,0x23,0x22,0x07,0x06,
-  0x07,0x06,0x15,0x14,0x17,0x16,0x33,0x32,0x37,0x17,0x06,
-  0x23,0x22,0x27,0x26,0x27,0x26,0x35,0x34,0x37,0x36,0x37,
-  0x36,0x33,0x32,0x17,0x16,0x15,0x14,0x07,0x06,0x23,0x22,
-  0x27,0x26,0x27,0x34,0x27,0x06,0x07,0x22,0x23,0x22,0x27,
-  0x26,0x35,0x34,0x37,0x36,0x37,0x36,0x37,0x36,0x33,0x32,
-  0x17,0x16,0x17,0x27,0x22,0x07,0x06,0x15,0x14,0x17,0x16,
-  0x33,0x32,0x37,0x36,0x37,0x36,0x37,0x36,0x35,0x34,0x27,
-  0x23,0x22,0x31,0x26,0x02,0x84,0x5A,0x4E,0x08,0x25,0x05,
-  0x07,0x33,0x34,0x03,0x04,0x33,0x62,0x68,0x91,0xAF,0x6D,
-  0x5C,0x0A,0x01,0x76,0x68,0x8C,0x74,0x5B,0x1C,0x65,0x88,
-  0xB9,0x79,0x76,0x1B,0x06,0x56,0x1A,0x1F,0x8B,0xCF,0xBE,
-  0x82,0x6F,0x52,0x4B,0x5D,0x33,0x26,0x19,0x0A,0x01,0x39,
-  0x51,0x06,0x06,0x4F,0x31,0x24,0x3F,0x06,0x05,0x3C,0x5B,
-  0x0F,0x10,0x4B,0x22,0x03,0x02,0x75,0x3D,0x31,0x2E,0x2B,
-  0x15,0x19,0x2C,0x28,0x02,0x02,0x31,0x0C,0x02,0x35,0x01,
-  0x01,0x0D,0x01,0xFC,0xFE,0xE8,0x1E,0x0C,0x29,0x07,0x01,
-  0x3F,0x04,0x05,0x47,0x5A,0x76,0x58,0x5C,0x7E,0x6B,0x8E,
-  0x0D,0x0E,0x99,0x5C,0x51,0x29,0x49,0x2E,0x5F,0x5C,0x91,
-  0x23,0x23,0x89,0x81,0x27,0x20,0x90,0x7D,0x6C,0x9D,0x79,
-  0x5E,0x54,0x1A,0x12,0x1B,0x02,0x02,0x45,0x06,0x40,0x2F,
-  0x3C,0x62,0x58,0x07,0x07,0x4B,0x0E,0x02,0x3F,0x04,0x05,
-  0x01,0x43,0x3E,0x4A,0x3E,0x1E,0x0F,0x2A,0x03,0x02,0x39,
-  0x4D,0x11,0x0A,0x4D,0x14,0x05,0x00,0x02,0x00,0x1A,0x00,
-  0x00,0x02,0xBF,0x02,0xD9,0x00,0x07,0x00,0x0A,0x00,0x00,
-  0x25,0x21,0x07,0x23,0x01,0x33,0x13,0x23,0x0B,0x02,0x01,
-  0xF5,0xFE,0xEF,0x31,0x99,0x01,0x03,0xA6,0xFC,0x9A,0x59,
-  0x5F,0x5F,0x93,0x93,0x02,0xD9,0xFD,0x27,0x01,0x10,0x01,
-  0x1D,0xFE,0xE3,0x00,0x03,0x00,0x52,0x00,0x00,0x02,0x9A,
-  0x02,0xD9,0x00,0x17,0x00,0x20,0x00,0x27,0x00,0x00,0x33,
-  0x11,0x21,0x32,0x17,0x16,0x17,0x14,0x15,0x14,0x07,0x23,
-  0x06,0x07,0x16,0x15,0x14,0x07,0x06,0x07,0x06,0x07,0x06,
-  0x23,0x03,0x15,0x33,0x36,0x37,0x34,0x27,0x22,0x23,0x03,
-  0x15,0x33,0x36,0x37,0x34,0x23,0x52,0x01,0x45,0x6E,0x3E,
-  0x3C,0x06,0x3F,0x01,0x0F,0x15,0x79,0x36,0x06,0x08,0x02,
-  0x02,0x3F,0x79,0xB2,0xA3,0x65,0x05,0x5F,0x05,0x06,0xA3,
-  0xB3,0x6C,0x03,0x6F,0x02,0xD9,0x35,0x34,0x4B,0x06,0x06,
-  0x48,0x34,0x0D,0x0D,0x47,0x6A,0x4F,0x3C,0x08,0x06,0x02,
-  0x02,0x35,0x02,0x5C,0xA5,0x07,0x4B,0x4E,0x05,0xFE,0xDE,
-  0xBD,0x05,0x59,0x5F,0x00,0x01,0x00,0x2C,0xFF,0xE9,0x02,
-  0xAD,0x02,0xE5,0x00,0x25,0x00,0x00,0x01,0x23,0x26,0x27,
-  0x26,0x23,0x22,0x07,0x06,0x07,0x06,0x15,0x14,0x17,0x16,
-  0x33,0x32,0x37,0x36,0x37,0x33,0x06,0x07,0x06,0x23,0x22,
-  0x27,0x26,0x35,0x34,0x37,0x36,0x33,0x32,0x17,0x16,0x17,
-  0x16,0x02,0xAA,0x8F,0x0C,0x15,0x2A,0x51,0x73,0x30,0x13,
-  0x05,0x02,0x5E,0x27,0x33,0x6F,0x25,0x0A,0x03,0x92,0x08,
-  0x72,0x4E,0x6F,0xAC,0x59,0x45,0x78,0x56,0x80,0xA1,0x57,
-  0x04,0x03,0x2A,0x01,0xE2,0x34,0x1A,0x35,0x6F,0x2D,0x3C,
-  0x14,0x15,0xAB,0x3A,0x18,0x5A,0x19,0x1F,0x94,0x4A,0x32,
-  0x80,0x64,0x99,0xD0,0x66,0x49,0x6A,0x05,0x04,0x37,0x00,
-  0x02,0x00,0x4D,0x00,0x00,0x02,0xA9,0x02,0xD9,0x00,0x0E,
-  0x00,0x15,0x00,0x00,0x33,0x11,0x21,0x32,0x17,0x16,0x17,
-  0x16,0x15,0x14,0x07,0x06,0x07,0x22,0x23,0x27,0x33,0x32,
-  0x35,0x34,0x2B,0x01,0x4D,0x01,0x1D,0x93,0x44,0x08,0x07,
-  0x59,0x59,0x42,0x8D,0x0B,0x0C,0x87,0x87,0xA9,0xA9,0x87,
-  0x02,0xD9,0x44,0x08,0x08,0x6A,0xAE,0xB0,0x68,0x50,0x05,
-  0x7D,0xEF,0xF0,0x00,0x01,0x00,0x4F,0x00,0x00,0x02,0x70,
-  0x02,0xD9,0x00,0x0B,0x00,0x00,0x13,0x15,0x21,0x15,0x21,
-  0x11,0x21,0x15,0x21,0x15,0x21,0x15,0xE5,0x01,0x8B,0xFD,
-  0xDF,0x02,0x0F,0xFE,0x87,0x01,0x5D,0x01,0x3A,0xBD,0x7D,
-  0x02,0xD9,0x7D,0xA5,0x7D,0x00,0x01,0x00,0x4A,0x00,0x00,
-  0x02,0x4A,0x02,0xD9,0x00,0x09,0x00,0x00,0x13,0x11,0x23,
-  0x11,0x21,0x15,0x21,0x15,0x21,0x15,0xE0,0x96,0x02,0x00,
-  0xFE,0x96,0x01,0x3F,0x01,0x3A,0xFE,0xC6,0x02,0xD9,0x7D,
-  0xA5,0x7D,0x00,0x00,0x01,0x00,0x2A,0xFF,0xE9,0x02,0xC7,
-  0x02,0xE5,0x00,0x28,0x00,0x00,0x01,0x11,0x23,0x27,0x06,
-  0x07,0x06,0x23,0x22,0x27,0x26,0x35,0x34,0x37,0x36,0x33,
-  0x32,0x17,0x16,0x17,0x23,0x26,0x27,0x26,0x23,0x22,0x07,
-  0x06,0x15,0x14,0x17,0x16,0x33,0x32,0x37,0x36,0x37,0x36,
-  0x37,0x23,0x35,0x02,0xC7,0x5A,0x12,0x44,0x6A,0x16,0x18,
-  0x95,0x60,0x60,0x6F,0x60,0x92,0xA6,0x57,0x35,0x0A,0x8D,
-  0x11,0x1C,0x32,0x4F,0x7B,0x34,0x1D,0x4F,0x36,0x4B,0x57,
-  0x3A,0x02,0x02,0x1F,0x05,0xA6,0x01,0x88,0xFE,0x76,0x60,
-  0x64,0x0E,0x03,0x6D,0x6C,0xA5,0xB7,0x6A,0x5D,0x64,0x3C,
-  0x55,0x31,0x18,0x2C,0x6C,0x3B,0x55,0x85,0x49,0x32,0x41,
-  0x02,0x03,0x24,0x38,0x7D,0x00,0x00,0x01,0x00,0x44,0x00,
-  0x00,0x02,0x91,0x02,0xD9,0x00,0x0B,0x00,0x00,0x01,0x21,
-  0x11,0x23,0x11,0x33,0x11,0x21,0x11,0x33,0x11,0x23,0x01,
-  0xFB,0xFE,0xDF,0x96,0x96,0x01,0x20,0x97,0x96,0x01,0x4B,
-  0xFE,0xB5,0x02,0xD9,0xFE,0xEF,0x01,0x11,0xFD,0x27,0x00,
-  0x01,0x00,0x3F,0x00,0x00,0x00,0xD5,0x02,0xD9,0x00,0x03,
-  0x00,0x00,0x13,0x11,0x23,0x11,0xD5,0x96,0x02,0xD9,0xFD,
-  0x27,0x02,0xD9,0x00,0x01,0x00,0x18,0xFF,0xE9,0x01,0xE6,
-  0x02,0xD9,0x00,0x17,0x00,0x00,0x01,0x33,0x11,0x14,0x07,
-  0x06,0x23,0x22,0x27,0x26,0x27,0x34,0x3D,0x01,0x33,0x15,
-  0x14,0x17,0x16,0x33,0x32,0x37,0x36,0x35,0x01,0x50,0x96,
-  0x77,0x31,0x42,0x67,0x40,0x39,0x04,0x96,0x36,0x0C,0x0F,
-  0x49,0x07,0x01,0x02,0xD9,0xFD,0xE5,0x92,0x2F,0x14,0x3A,
-  0x35,0x5C,0x09,0x09,0x48,0x46,0x50,0x0C,0x03,0x46,0x07,
-  0x08,0x00,0x00,0x01,0x00,0x4A,0x00,0x00,0x02,0xCD,0x02,
-  0xD9,0x00,0x0B,0x00,0x00,0x37,0x15,0x23,0x11,0x33,0x11,
-  0x01,0x33,0x09,0x01,0x23,0x03,0xE0,0x96,0x96,0x01,0x1D,
-  0xB1,0xFE,0xDD,0x01,0x42,0xB3,0xEF,0xF4,0xF4,0x02,0xD9,
-  0xFE,0xC0,0x01,0x40,0xFE,0xC6,0xFE,0x61,0x01,0x42,0x00,
-  0x01,0x00,0x50,0x00,0x00,0x02,0x43,0x02,0xD9,0x00,0x05,
-  0x00,0x00,0x13,0x11,0x21,0x15,0x21,0x11,0xE6,0x01,0x5D,
-  0xFE,0x0D,0x02,0xD9,0xFD,0xA4,0x7D,0x02,0xD9,0x00,0x01,
-  0x00,0x42,0x00,0x00,0x03,0x08,0x02,0xD9,0x00,0x0C,0x00,
-  0x00,0x13,0x11,0x23,0x11,0x33,0x1B,0x01,0x33,0x11,0x23,
-  0x11,0x03,0x23,0xD8,0x96,0xE0,0x84,0x80,0xE2,0x96,0x81,
-  0x96,0x02,0x38,0xFD,0xC8,0x02,0xD9,0xFD,0xBC,0x02,0x44,
-  0xFD,0x27,0x02,0x38,0xFD,0xC8,0x00,0x01,0x00,0x44,0x00,
-  0x00,0x02,0x95,0x02,0xD9,0x00,0x09,0x00,0x00,0x21,0x01,
-  0x11,0x23,0x11,0x33,0x01,0x11,0x33,0x11,0x01,0xFF,0xFE,
-  0xDB,0x96,0x9A,0x01,0x21,0x96,0x01,0xF8,0xFE,0x08,0x02,
-  0xD9,0xFE,0x10,0x01,0xF0,0xFD,0x27,0x00,0x00,0x02,0x00,
-  0x28,0xFF,0xE9,0x02,0xE6,0x02,0xE5,0x00,0x1B,0x00,0x2C,
-  0x00,0x00,0x01,0x32,0x17,0x16,0x17,0x14,0x15,0x14,0x07,
-  0x06,0x07,0x06,0x23,0x22,0x27,0x26,0x27,0x26,0x35,0x34,
-  0x3F,0x02,0x30,0x37,0x36,0x37,0x36,0x17,0x22,0x07,0x15,
-  0x06,0x15,0x14,0x17,0x16,0x33,0x32,0x37,0x36,0x35,0x34,
-  0x27,0x26,0x01,0x86,0x9C,0x5E,0x62,0x04,0x47,0x0E,0x11,
-  0x5E,0x9B,0x9B,0x5E,0x5A,0x0B,0x01,0x58,0x01,0x01,0x01,
-  0x05,0x06,0x5D,0x9C,0x6C,0x37,0x26,0x52,0x32,0x45,0x69,
-  0x38,0x28,0x57,0x30,0x02,0xE5,0x65,0x69,0xA8,0x06,0x07,
-  0x85,0x68,0x15,0x12,0x65,0x65,0x60,0x97,0x11,0x11,0x9D,
-  0x6C,0x01,0x01,0x01,0x06,0x07,0x65,0x80,0x5E,0x01,0x41,
-  0x5E,0x90,0x45,0x29,0x5C,0x41,0x5D,0x9A,0x43,0x25,0x00,
-  0x02,0x00,0x4C,0x00,0x00,0x02,0x79,0x02,0xD9,0x00,0x10,
-  0x00,0x1B,0x00,0x00,0x13,0x11,0x23,0x11,0x21,0x32,0x17,
-  0x14,0x15,0x16,0x15,0x14,0x07,0x06,0x07,0x06,0x23,0x27,
-  0x33,0x32,0x37,0x36,0x35,0x34,0x27,0x26,0x2B,0x01,0xE2,
-  0x96,0x01,0x42,0xB1,0x2D,0x0D,0x5B,0x01,0x01,0x35,0x4A,
-  0xBB,0x8C,0x6D,0x07,0x01,0x60,0x0A,0x0B,0x8C,0x01,0x04,
-  0xFE,0xFC,0x02,0xD9,0x87,0x01,0x01,0x27,0x32,0x8C,0x40,
-  0x01,0x01,0x25,0x7D,0x5E,0x07,0x08,0x64,0x09,0x01,0x00,
-  0x02,0x00,0x2B,0xFF,0xCA,0x02,0xE9,0x02,0xE5,0x00,0x1A,
-  0x00,0x2E,0x00,0x00,0x25,0x17,0x07,0x27,0x06,0x23,0x22,
-  0x27,0x26,0x27,0x26,0x35,0x34,0x37,0x36,0x37,0x36,0x33,
-  0x32,0x17,0x16,0x17,0x16,0x15,0x14,0x07,0x06,0x27,0x17,
-  0x36,0x35,0x34,0x27,0x26,0x23,0x22,0x07,0x15,0x06,0x15,
-  0x14,0x17,0x16,0x33,0x32,0x37,0x27,0x02,0x99,0x50,0x4C,
-  0x56,0x53,0x6A,0x9B,0x5E,0x59,0x0C,0x01,0x53,0x09,0x0A,
-  0x5E,0x9B,0x9B,0x5E,0x57,0x0D,0x02,0x3B,0x0A,0xC4,0x52,
-  0x21,0x54,0x31,0x44,0x6C,0x37,0x26,0x52,0x32,0x44,0x34,
-  0x24,0x4D,0x67,0x4C,0x51,0x51,0x32,0x65,0x60,0x94,0x12,
-  0x13,0x97,0x6C,0x0B,0x0B,0x65,0x65,0x5E,0x90,0x14,0x15,
-  0x83,0x61,0x10,0xA1,0x4E,0x42,0x5C,0x94,0x44,0x27,0x5E,
-  0x01,0x41,0x5E,0x90,0x45,0x29,0x13,0x49,0x00,0x00,0x02,
-  0x00,0x50,0x00,0x00,0x02,0xA5,0x02,0xD9,0x00,0x23,0x00,
-  0x2E,0x00,0x00,0x13,0x11,0x23,0x11,0x21,0x32,0x17,0x16,
-  0x15,0x14,0x07,0x16,0x17,0x16,0x17,0x16,0x17,0x14,0x1F,
-  0x01,0x16,0x17,0x15,0x23,0x26,0x27,0x34,0x35,0x34,0x37,
-  0x36,0x35,0x34,0x27,0x26,0x23,0x27,0x33,0x32,0x37,0x36,
-  0x35,0x34,0x27,0x26,0x27,0x23,0xE6,0x96,0x01,0x87,0x5C,
-  0x31,0x37,0x7B,0x39,0x10,0x16,0x04,0x01,0x01,0x1C,0x01,
-  0x01,0x02,0xA1,0x15,0x02,0x01,0x01,0x3D,0x0E,0x12,0xAC,
-  0xB5,0x39,0x16,0x1B,0x1B,0x1C,0x33,0xB5,0x01,0x21,0xFE,
-  0xDF,0x02,0xD9,0x32,0x39,0x5A,0x84,0x30,0x19,0x15,0x1E,
-  0x64,0x1E,0x3B,0x28,0x11,0x01,0x01,0x01,0x1B,0x26,0x37,
-  0x0D,0x13,0x1D,0x13,0x0D,0x10,0x49,0x0B,0x03,0x7D,0x13,
-  0x18,0x36,0x33,0x17,0x12,0x01,0x00,0x01,0x00,0x20,0xFF,
-  0xE9,0x02,0x79,0x02,0xE5,0x00,0x3C,0x00,0x00,0x01,0x23,
-  0x26,0x27,0x26,0x23,0x22,0x07,0x06,0x31,0x06,0x15,0x14,
-  0x17,0x16,0x17,0x33,0x16,0x1F,0x01,0x16,0x17,0x16,0x15,
-  0x14,0x07,0x06,0x23,0x22,0x27,0x26,0x27,0x33,0x16,0x17,
-  0x16,0x33,0x32,0x37,0x36,0x35,0x34,0x27,0x26,0x2F,0x01,
-  0x26,0x2F,0x01,0x35,0x30,0x27,0x26,0x35,0x34,0x37,0x36,
-  0x33,0x32,0x17,0x16,0x02,0x5F,0x8C,0x07,0x76,0x0D,0x0F,
-  0x5A,0x1B,0x01,0x08,0x2A,0x17,0x29,0x01,0x0E,0x11,0x72,
-  0x91,0x23,0x0D,0x7B,0x48,0x68,0xD7,0x40,0x14,0x03,0x92,
-  0x06,0x6F,0x16,0x19,0x6C,0x1E,0x09,0x3A,0x1D,0x32,0x66,
-  0x90,0x28,0x01,0x01,0x13,0x7D,0x3F,0x58,0xA0,0x4B,0x33,
-  0x01,0xFB,0x65,0x0C,0x01,0x35,0x01,0x10,0x14,0x2E,0x15,
-  0x0C,0x09,0x04,0x03,0x16,0x1C,0x5B,0x23,0x2F,0x8D,0x3C,
-  0x23,0x8E,0x2B,0x38,0x64,0x12,0x03,0x3C,0x11,0x15,0x3A,
-  0x1A,0x0D,0x09,0x14,0x1B,0x49,0x01,0x01,0x01,0x25,0x38,
-  0x8F,0x36,0x1B,0x53,0x39,0x00,0x00,0x01,0x00,0x0E,0x00,
-  0x00,0x02,0x56,0x02,0xD9,0x00,0x07,0x00,0x00,0x01,0x11,
-  0x23,0x11,0x23,0x35,0x21,0x15,0x01,0x81,0x96,0xDD,0x02,
-  0x48,0x02,0x5C,0xFD,0xA4,0x02,0x5C,0x7D,0x7D,0x00,0x01,
-  0x00,0x4C,0xFF,0xE9,0x02,0x8E,0x02,0xD9,0x00,0x11,0x00,
-  0x00,0x01,0x33,0x11,0x14,0x07,0x06,0x23,0x22,0x27,0x26,
-  0x35,0x11,0x33,0x11,0x16,0x17,0x36,0x37,0x01,0xF8,0x96,
-  0x47,0x52,0x88,0x88,0x52,0x47,0x96,0x0A,0x81,0x87,0x04,
-  0x02,0xD9,0xFE,0x12,0x78,0x40,0x4A,0x4A,0x40,0x78,0x01,
-  0xEE,0xFE,0x12,0x7E,0x04,0x07,0x7B,0x00,0x01,0x00,0x18,
-  0x00,0x00,0x02,0x87,0x02,0xD9,0x00,0x06,0x00,0x00,0x21,
-  0x23,0x03,0x33,0x1B,0x01,0x33,0x01,0x8D,0x7F,0xF6,0x97,
-  0xA2,0x9F,0x97,0x02,0xD9,0xFD,0xDB,0x02,0x25,0x00,0x00,
-  0x01,0x00,0x0D,0x00,0x00,0x03,0xA4,0x02,0xD9,0x00,0x0C,
-  0x00,0x00,0x21,0x23,0x0B,0x01,0x23,0x03,0x33,0x1B,0x01,
-  0x33,0x1B,0x01,0x33,0x02,0xDA,0x87,0x7A,0x77,0x87,0xCE,
-  0x9F,0x71,0x71,0x94,0x76,0x6D,0x9F,0x02,0x39,0xFD,0xC7,
-  0x02,0xD9,0xFD,0xDE,0x02,0x22,0xFD,0xDD,0x02,0x23,0x00,
-  0x00,0x01,0x00,0x16,0x00,0x00,0x02,0x8D,0x02,0xD9,0x00,
-  0x0B,0x00,0x00,0x01,0x13,0x23,0x27,0x07,0x23,0x13,0x03,
-  0x33,0x17,0x37,0x33,0x01,0xA3,0xEA,0xB2,0x8C,0x8B,0xAE,
-  0xE6,0xDE,0xB2,0x80,0x86,0xAE,0x01,0x74,0xFE,0x8C,0xFD,
-  0xFD,0x01,0x6F,0x01,0x6A,0xF0,0xF0,0x00,0x00,0x01,0x00,
-  0x1B,0x00,0x00,0x02,0x8A,0x02,0xD9,0x00,0x08,0x00,0x00,
-  0x01,0x11,0x23,0x11,0x03,0x33,0x1B,0x01,0x33,0x01,0xA3,
-  0x96,0xF2,0xA7,0x95,0x8B,0xA8,0x01,0x0E,0xFE,0xF2,0x01,
-  0x0E,0x01,0xCB,0xFE,0xBE,0x01,0x42,0x00,0x00,0x01,0x00,
-  0x1E,0x00,0x00,0x02,0x42,0x02,0xD9,0x00,0x09,0x00,0x00,
-  0x01,0x15,0x01,0x21,0x15,0x21,0x35,0x01,0x21,0x35,0x02,
-  0x42,0xFE,0x8C,0x01,0x74,0xFD,0xDC,0x01,0x75,0xFE,0x8B,
-  0x02,0xD9,0x7D,0xFE,0x21,0x7D,0x7D,0x01,0xDF,0x7D,0x00,
-  0x01,0x00,0x42,0xFF,0x38,0x01,0x34,0x02,0xD9,0x00,0x07,
-  0x00,0x00,0x01,0x15,0x23,0x11,0x33,0x15,0x23,0x11,0x01,
-  0x34,0x70,0x70,0xF2,0x02,0xD9,0x66,0xFD,0x2B,0x66,0x03,
-  0xA1,0x00,0x00,0x01,0xFF,0xF4,0xFF,0xF2,0x01,0x21,0x02,
-  0xCA,0x00,0x03,0x00,0x00,0x1B,0x01,0x23,0x03,0x37,0xEA,
-  0x43,0xEA,0x02,0xCA,0xFD,0x28,0x02,0xD8,0x00,0x01,0x00,
-  0x12,0xFF,0x38,0x01,0x04,0x02,0xD9,0x00,0x07,0x00,0x00,
-  0x17,0x35,0x33,0x11,0x23,0x35,0x33,0x11,0x12,0x70,0x70,
-  0xF2,0xC8,0x66,0x02,0xD5,0x66,0xFC,0x5F,0x00,0x00,0x01,
-  0x00,0x3D,0x01,0x0E,0x02,0x0A,0x02,0xB7,0x00,0x06,0x00,
-  0x00,0x01,0x23,0x0B,0x01,0x23,0x13,0x33,0x02,0x0A,0x71,
-  0x79,0x73,0x70,0xA5,0x7D,0x01,0x0E,0x01,0x2C,0xFE,0xD4,
-  0x01,0xA9,0x00,0x00,0x01,0xFF,0xEA,0xFF,0x43,0x02,0x42,
-  0xFF,0x88,0x00,0x03,0x00,0x00,0x05,0x15,0x21,0x35,0x02,
-  0x42,0xFD,0xA8,0x78,0x45,0x45,0x00,0x00,0x01,0x00,0x11,
-  0x02,0x5F,0x00,0xD5,0x02,0xF5,0x00,0x03,0x00,0x00,0x13,
-  0x33,0x17,0x23,0x11,0x7E,0x46,0x46,0x02,0xF5,0x96,0x00,
-  0x00,0x02,0x00,0x1C,0xFF,0xE9,0x02,0x0C,0x02,0x25,0x00,
-  0x23,0x00,0x34,0x00,0x00,0x25,0x15,0x23,0x26,0x35,0x06,
-  0x23,0x22,0x27,0x26,0x35,0x34,0x3F,0x01,0x36,0x37,0x36,
-  0x37,0x36,0x35,0x34,0x23,0x22,0x07,0x15,0x06,0x07,0x23,
-  0x36,0x37,0x32,0x15,0x11,0x14,0x17,0x16,0x27,0x35,0x06,
-  0x0F,0x01,0x06,0x07,0x15,0x06,0x15,0x14,0x17,0x16,0x33,
-  0x32,0x37,0x36,0x02,0x0C,0x98,0x10,0x4A,0x5A,0x4D,0x31,
-  0x26,0x9F,0x38,0x44,0x0F,0x01,0x04,0x18,0x51,0x44,0x13,
-  0x09,0x03,0x87,0x0D,0xDA,0xDD,0x1A,0x03,0xA6,0x13,0x28,
-  0x30,0x42,0x0B,0x03,0x31,0x0C,0x0F,0x57,0x13,0x05,0x11,
-  0x11,0x18,0x1E,0x4D,0x33,0x29,0x46,0x8F,0x1B,0x0A,0x0B,
-  0x07,0x01,0x02,0x0D,0x1D,0x36,0x20,0x01,0x0F,0x1A,0xB9,
-  0x02,0xA6,0xFE,0xD4,0x22,0x1A,0x03,0xC5,0x26,0x09,0x08,
-  0x09,0x0E,0x24,0x01,0x09,0x0E,0x31,0x0D,0x03,0x53,0x14,
-  0x00,0x02,0x00,0x3B,0xFF,0xE9,0x02,0x3F,0x02,0xD9,0x00,
-  0x12,0x00,0x23,0x00,0x00,0x13,0x33,0x11,0x36,0x33,0x32,
-  0x17,0x16,0x17,0x16,0x15,0x14,0x07,0x06,0x23,0x22,0x27,
-  0x15,0x23,0x01,0x22,0x07,0x31,0x06,0x15,0x14,0x17,0x16,
-  0x33,0x32,0x37,0x36,0x35,0x34,0x27,0x26,0x3B,0x8C,0x32,
-  0x63,0x55,0x3D,0x0D,0x0A,0x3A,0x4F,0x3F,0x55,0x63,0x32,
-  0x8C,0x01,0x02,0x42,0x21,0x13,0x3C,0x19,0x21,0x40,0x22,
-  0x14,0x38,0x1C,0x02,0xD9,0xFE,0xFD,0x4F,0x3C,0x0D,0x0E,
-  0x54,0x73,0x89,0x54,0x41,0x4E,0x37,0x01,0xB0,0x47,0x2A,
-  0x36,0x6D,0x2B,0x13,0x45,0x2B,0x38,0x66,0x2E,0x16,0x00,
-  0x00,0x01,0x00,0x22,0xFF,0xE9,0x02,0x0A,0x02,0x25,0x00,
-  0x26,0x00,0x00,0x01,0x23,0x26,0x2F,0x01,0x26,0x23,0x22,
-  0x07,0x06,0x15,0x14,0x17,0x16,0x33,0x32,0x37,0x35,0x37,
-  0x36,0x37,0x33,0x06,0x07,0x06,0x23,0x22,0x27,0x26,0x35,
-  0x34,0x37,0x36,0x33,0x32,0x17,0x16,0x17,0x16,0x02,0x0A,
-  0x86,0x11,0x2C,0x01,0x10,0x16,0x3E,0x19,0x1B,0x42,0x16,
-  0x1A,0x3C,0x1A,0x01,0x07,0x06,0x86,0x0D,0x60,0x37,0x47,
-  0x9E,0x3E,0x21,0x77,0x39,0x4F,0x8A,0x3D,0x13,0x09,0x04,
-  0x01,0x52,0x4D,0x0F,0x01,0x05,0x2E,0x33,0x50,0x7A,0x23,
-  0x0C,0x37,0x01,0x01,0x11,0x17,0x7C,0x37,0x1F,0x7C,0x42,
-  0x5C,0xBB,0x46,0x21,0x62,0x21,0x28,0x13,0x00,0x02,0x00,
-  0x1D,0xFF,0xE9,0x02,0x21,0x02,0xD9,0x00,0x12,0x00,0x22,
-  0x00,0x00,0x21,0x35,0x06,0x23,0x22,0x27,0x26,0x27,0x26,
-  0x35,0x34,0x37,0x36,0x33,0x32,0x17,0x11,0x33,0x11,0x01,
-  0x22,0x07,0x06,0x15,0x14,0x17,0x16,0x33,0x32,0x37,0x36,
-  0x35,0x34,0x27,0x26,0x01,0x95,0x34,0x61,0x54,0x3E,0x0D,
-  0x0A,0x3A,0x4F,0x3E,0x56,0x62,0x33,0x8C,0xFE,0xFE,0x42,
-  0x20,0x14,0x39,0x1B,0x22,0x43,0x20,0x13,0x3B,0x1A,0x37,
-  0x4E,0x3B,0x0D,0x0E,0x54,0x73,0x89,0x54,0x42,0x4F,0x01,
-  0x03,0xFD,0x27,0x01,0xB0,0x47,0x2A,0x39,0x67,0x2C,0x15,
-  0x47,0x29,0x36,0x6D,0x2C,0x13,0x00,0x02,0x00,0x16,0xFF,
-  0xE9,0x02,0x0D,0x02,0x25,0x00,0x1F,0x00,0x26,0x00,0x00,
-  0x25,0x21,0x16,0x17,0x16,0x33,0x32,0x37,0x36,0x37,0x33,
-  0x06,0x07,0x06,0x23,0x22,0x27,0x26,0x35,0x34,0x37,0x36,
-  0x33,0x32,0x17,0x16,0x17,0x16,0x17,0x16,0x15,0x14,0x25,
-  0x33,0x26,0x27,0x26,0x23,0x22,0x02,0x0C,0xFE,0x96,0x03,
-  0x11,0x1F,0x3D,0x4B,0x1D,0x02,0x01,0x8A,0x1D,0x61,0x38,
-  0x44,0x8E,0x41,0x28,0x68,0x3C,0x56,0x7D,0x46,0x15,0x0D,
-  0x02,0x01,0x15,0xFE,0x97,0xD7,0x04,0x12,0x20,0x37,0x5C,
-  0xE2,0x44,0x1B,0x2F,0x3D,0x03,0x04,0x65,0x2E,0x1C,0x6E,
-  0x45,0x64,0xAD,0x4C,0x2C,0x5A,0x1B,0x21,0x04,0x03,0x3D,
-  0x51,0x0C,0x51,0x32,0x1C,0x2D,0x00,0x00,0x01,0x00,0x0E,
-  0x00,0x00,0x01,0x39,0x02,0xD9,0x00,0x13,0x00,0x00,0x01,
-  0x15,0x23,0x11,0x23,0x11,0x23,0x35,0x33,0x35,0x34,0x33,
-  0x32,0x17,0x15,0x26,0x23,0x22,0x1D,0x01,0x01,0x39,0x53,
-  0x8C,0x4C,0x4C,0x8A,0x29,0x27,0x12,0x16,0x26,0x02,0x11,
-  0x5D,0xFE,0x4C,0x01,0xB4,0x5D,0x41,0x87,0x03,0x69,0x03,
-  0x2A,0x35,0x00,0x00,0x02,0x00,0x22,0xFF,0x26,0x02,0x1D,
-  0x02,0x25,0x00,0x24,0x00,0x34,0x00,0x00,0x01,0x33,0x11,
-  0x14,0x07,0x06,0x07,0x06,0x23,0x22,0x27,0x26,0x27,0x33,
-  0x16,0x33,0x32,0x37,0x36,0x3D,0x01,0x06,0x07,0x06,0x23,
-  0x22,0x27,0x26,0x35,0x34,0x37,0x36,0x33,0x32,0x17,0x16,
-  0x17,0x07,0x22,0x07,0x06,0x15,0x14,0x17,0x16,0x33,0x32,
-  0x37,0x36,0x35,0x34,0x27,0x26,0x01,0x98,0x85,0x7A,0x26,
-  0x30,0x17,0x1A,0x7A,0x40,0x34,0x01,0x91,0x11,0x52,0x4A,
-  0x1F,0x0E,0x38,0x36,0x13,0x18,0x73,0x3D,0x2D,0x4F,0x3D,
-  0x54,0x57,0x3B,0x02,0x02,0x78,0x41,0x1F,0x12,0x37,0x1A,
-  0x1F,0x46,0x22,0x14,0x37,0x1E,0x02,0x1C,0xFD,0xD2,0x82,
-  0x30,0x0F,0x05,0x02,0x34,0x2B,0x3A,0x3F,0x37,0x18,0x1F,
-  0x49,0x3F,0x0B,0x04,0x63,0x4A,0x6B,0x8D,0x55,0x42,0x56,
-  0x03,0x03,0x19,0x49,0x2B,0x39,0x66,0x2B,0x14,0x46,0x28,
-  0x37,0x62,0x31,0x1A,0x00,0x00,0x01,0x00,0x43,0x00,0x00,
-  0x02,0x1D,0x02,0xD9,0x00,0x15,0x00,0x00,0x13,0x33,0x11,
-  0x36,0x33,0x32,0x17,0x16,0x15,0x11,0x23,0x11,0x34,0x27,
-  0x26,0x23,0x22,0x07,0x06,0x15,0x11,0x23,0x43,0x8C,0x3A,
-  0x64,0x48,0x31,0x37,0x8C,0x10,0x18,0x2E,0x42,0x1D,0x0D,
-  0x8C,0x02,0xD9,0xFE,0xF5,0x57,0x29,0x2E,0x64,0xFE,0x96,
-  0x01,0x4A,0x2B,0x18,0x21,0x34,0x18,0x1E,0xFE,0xBC,0x00,
-  0x00,0x02,0x00,0x43,0x00,0x00,0x00,0xCF,0x02,0xD9,0x00,
-  0x03,0x00,0x07,0x00,0x00,0x13,0x11,0x23,0x11,0x37,0x15,
-  0x23,0x35,0xCF,0x8C,0x8C,0x8C,0x02,0x1C,0xFD,0xE4,0x02,
-  0x1C,0xBD,0x7D,0x7D,0x00,0x00,0x02,0x00,0x04,0xFF,0x26,
-  0x00,0xD2,0x02,0xD9,0x00,0x0F,0x00,0x13,0x00,0x00,0x13,
-  0x11,0x14,0x07,0x06,0x23,0x22,0x27,0x35,0x16,0x33,0x32,
-  0x37,0x36,0x35,0x11,0x37,0x15,0x23,0x35,0xD2,0x40,0x18,
-  0x23,0x24,0x2F,0x0D,0x0C,0x24,0x04,0x01,0x8C,0x8C,0x02,
-  0x1C,0xFD,0x86,0x5F,0x15,0x08,0x05,0x70,0x04,0x1C,0x06,
-  0x08,0x02,0x5B,0xBD,0x7D,0x7D,0x00,0x00,0x01,0x00,0x3B,
-  0x00,0x00,0x02,0x24,0x02,0xD9,0x00,0x0B,0x00,0x00,0x13,
-  0x37,0x33,0x07,0x13,0x23,0x27,0x07,0x15,0x23,0x11,0x33,
-  0xC7,0xB1,0x9F,0xB8,0xC5,0xA4,0x81,0x38,0x8C,0x8C,0x01,
-  0x4A,0xD2,0xCC,0xFE,0xB0,0xEE,0x3D,0xB1,0x02,0xD9,0x00,
-  0x00,0x01,0x00,0x43,0x00,0x00,0x00,0xCF,0x02,0xD9,0x00,
-  0x03,0x00,0x00,0x13,0x11,0x23,0x11,0xCF,0x8C,0x02,0xD9,
-  0xFD,0x27,0x02,0xD9,0x00,0x01,0x00,0x3C,0x00,0x00,0x03,
-  0x38,0x02,0x25,0x00,0x29,0x00,0x00,0x13,0x33,0x15,0x36,
-  0x37,0x36,0x33,0x32,0x1F,0x01,0x16,0x17,0x36,0x37,0x32,
-  0x17,0x16,0x15,0x11,0x23,0x11,0x34,0x27,0x26,0x23,0x22,
-  0x07,0x06,0x15,0x11,0x23,0x11,0x34,0x27,0x26,0x23,0x22,
-  0x07,0x06,0x15,0x11,0x23,0x3C,0x8B,0x36,0x3E,0x0F,0x11,
-  0x60,0x2B,0x01,0x04,0x03,0x42,0x5C,0x76,0x27,0x0F,0x8C,
-  0x31,0x0C,0x0F,0x46,0x14,0x06,0x8C,0x31,0x0C,0x0F,0x46,
-  0x14,0x06,0x8C,0x02,0x1C,0x43,0x41,0x09,0x02,0x43,0x01,
-  0x06,0x06,0x4D,0x03,0x58,0x22,0x2D,0xFE,0x82,0x01,0x68,
-  0x35,0x0E,0x03,0x40,0x13,0x17,0xFE,0xBC,0x01,0x68,0x35,
-  0x0E,0x03,0x40,0x13,0x17,0xFE,0xBC,0x00,0x01,0x00,0x3F,
-  0x00,0x00,0x02,0x22,0x02,0x25,0x00,0x15,0x00,0x00,0x13,
-  0x33,0x15,0x36,0x37,0x32,0x33,0x32,0x17,0x16,0x15,0x11,
-  0x23,0x11,0x34,0x23,0x22,0x07,0x06,0x15,0x11,0x23,0x3F,
-  0x8C,0x37,0x5E,0x06,0x07,0x7F,0x28,0x0E,0x8C,0x5A,0x4A,
-  0x1C,0x0B,0x8C,0x02,0x1C,0x4E,0x52,0x05,0x65,0x26,0x30,
-  0xFE,0x96,0x01,0x4D,0x61,0x38,0x16,0x1C,0xFE,0xBC,0x00,
-  0x00,0x02,0x00,0x23,0xFF,0xE9,0x02,0x39,0x02,0x25,0x00,
-  0x0F,0x00,0x1F,0x00,0x00,0x01,0x32,0x17,0x16,0x15,0x14,
-  0x07,0x06,0x23,0x22,0x27,0x26,0x35,0x34,0x37,0x36,0x17,
-  0x22,0x07,0x06,0x15,0x14,0x17,0x16,0x33,0x32,0x37,0x36,
-  0x35,0x34,0x27,0x26,0x01,0x2D,0xA5,0x43,0x24,0x67,0x43,
-  0x61,0x9C,0x45,0x2A,0x6B,0x41,0x5F,0x49,0x22,0x14,0x3D,
-  0x1D,0x25,0x47,0x23,0x15,0x40,0x21,0x02,0x25,0x7D,0x44,
-  0x61,0x9E,0x4B,0x31,0x73,0x46,0x65,0xA6,0x4B,0x2D,0x71,
-  0x4A,0x2A,0x39,0x6A,0x2E,0x15,0x47,0x2B,0x39,0x71,0x2B,
-  0x11,0x00,0x02,0x00,0x3A,0xFF,0x26,0x02,0x3E,0x02,0x25,
-  0x00,0x12,0x00,0x22,0x00,0x00,0x13,0x15,0x36,0x33,0x32,
-  0x17,0x16,0x17,0x16,0x17,0x14,0x07,0x06,0x23,0x22,0x27,
-  0x11,0x23,0x11,0x05,0x22,0x07,0x06,0x15,0x14,0x17,0x16,
-  0x33,0x32,0x37,0x36,0x35,0x34,0x27,0x26,0xC6,0x32,0x64,
-  0x51,0x3E,0x0E,0x0B,0x38,0x02,0x4F,0x3E,0x55,0x64,0x32,
-  0x8C,0x01,0x02,0x43,0x20,0x13,0x3A,0x1B,0x21,0x41,0x21,
-  0x14,0x3B,0x1A,0x02,0x1C,0x50,0x59,0x38,0x0E,0x0F,0x55,
-  0x75,0x8B,0x53,0x40,0x58,0xFE,0xE6,0x02,0xF6,0x6C,0x48,
-  0x2A,0x38,0x6A,0x2B,0x14,0x45,0x2A,0x38,0x6D,0x2C,0x13,
-  0x00,0x00,0x02,0x00,0x1C,0xFF,0x26,0x02,0x20,0x02,0x25,
-  0x00,0x14,0x00,0x24,0x00,0x00,0x01,0x33,0x11,0x23,0x11,
-  0x06,0x23,0x22,0x27,0x26,0x27,0x26,0x27,0x34,0x35,0x34,
-  0x37,0x36,0x33,0x32,0x17,0x07,0x22,0x07,0x06,0x15,0x14,
-  0x17,0x16,0x33,0x32,0x37,0x36,0x35,0x34,0x27,0x26,0x01,
-  0x94,0x8C,0x8C,0x31,0x66,0x50,0x3D,0x0F,0x0B,0x37,0x03,
-  0x50,0x3D,0x55,0x64,0x32,0x76,0x43,0x20,0x13,0x3A,0x1B,
-  0x21,0x43,0x20,0x13,0x3D,0x19,0x02,0x1C,0xFD,0x0A,0x01,
-  0x1A,0x58,0x37,0x0E,0x10,0x4B,0x74,0x05,0x05,0x8C,0x53,
-  0x40,0x59,0x1C,0x48,0x2A,0x38,0x6A,0x2B,0x14,0x47,0x29,
-  0x36,0x71,0x2A,0x12,0x00,0x00,0x01,0x00,0x3F,0x00,0x00,
-  0x01,0x72,0x02,0x25,0x00,0x0F,0x00,0x00,0x13,0x33,0x15,
-  0x36,0x37,0x36,0x33,0x32,0x17,0x15,0x26,0x23,0x22,0x15,
-  0x11,0x23,0x3F,0x8C,0x25,0x4D,0x12,0x12,0x09,0x08,0x19,
-  0x13,0x7B,0x8C,0x02,0x1C,0x6A,0x5A,0x14,0x05,0x01,0x8E,
-  0x04,0x7B,0xFE,0xE1,0x00,0x01,0x00,0x1D,0xFF,0xE9,0x02,
-  0x08,0x02,0x25,0x00,0x36,0x00,0x00,0x01,0x23,0x26,0x23,
-  0x22,0x07,0x14,0x31,0x06,0x15,0x14,0x17,0x33,0x16,0x1F,
-  0x01,0x16,0x15,0x14,0x07,0x06,0x07,0x06,0x23,0x22,0x27,
-  0x26,0x35,0x33,0x16,0x17,0x16,0x33,0x32,0x37,0x36,0x35,
-  0x34,0x27,0x26,0x2F,0x01,0x26,0x27,0x26,0x27,0x26,0x35,
-  0x34,0x37,0x36,0x33,0x32,0x17,0x16,0x01,0xF9,0x87,0x01,
-  0x64,0x40,0x0E,0x03,0x18,0x01,0x08,0x10,0xB1,0x6A,0x3C,
-  0x02,0x02,0x3C,0x70,0xE8,0x15,0x02,0x89,0x08,0x13,0x1D,
-  0x36,0x5A,0x0C,0x02,0x1F,0x07,0x09,0xA7,0x3E,0x17,0x01,
-  0x02,0x1E,0x60,0x34,0x4A,0x98,0x39,0x19,0x01,0x6E,0x49,
-  0x23,0x01,0x07,0x07,0x16,0x0B,0x04,0x05,0x33,0x1F,0x69,
-  0x50,0x33,0x02,0x02,0x30,0x9D,0x0B,0x0C,0x24,0x0F,0x13,
-  0x2A,0x05,0x06,0x1A,0x0C,0x03,0x03,0x34,0x14,0x16,0x01,
-  0x02,0x21,0x37,0x6C,0x2E,0x1A,0x5B,0x27,0x00,0x01,0x00,
-  0x0E,0xFF,0xE9,0x01,0x2D,0x02,0xA2,0x00,0x16,0x00,0x00,
-  0x01,0x15,0x23,0x11,0x14,0x17,0x33,0x16,0x33,0x32,0x37,
-  0x15,0x06,0x23,0x22,0x35,0x11,0x23,0x35,0x33,0x35,0x33,
-  0x15,0x01,0x2D,0x4E,0x12,0x01,0x09,0x12,0x0B,0x15,0x22,
-  0x2F,0x89,0x45,0x45,0x8C,0x02,0x11,0x5D,0xFE,0xDA,0x2E,
-  0x09,0x04,0x03,0x62,0x0B,0x7F,0x01,0x4C,0x5D,0x91,0x91,
-  0x00,0x00,0x01,0x00,0x3A,0xFF,0xE9,0x02,0x1D,0x02,0x1C,
-  0x00,0x15,0x00,0x00,0x21,0x23,0x35,0x06,0x07,0x22,0x23,
-  0x22,0x27,0x26,0x35,0x11,0x33,0x11,0x14,0x33,0x32,0x37,
-  0x36,0x35,0x11,0x33,0x02,0x1D,0x8C,0x37,0x5E,0x06,0x07,
-  0x7F,0x28,0x0E,0x8C,0x5A,0x49,0x1C,0x0C,0x8C,0x40,0x52,
-  0x05,0x65,0x26,0x30,0x01,0x78,0xFE,0xA5,0x61,0x37,0x16,
-  0x1D,0x01,0x52,0x00,0x01,0x00,0x0E,0x00,0x00,0x02,0x18,
-  0x02,0x1C,0x00,0x06,0x00,0x00,0x21,0x23,0x03,0x33,0x1B,
-  0x01,0x33,0x01,0x5E,0x93,0xBD,0x94,0x75,0x6D,0x94,0x02,
-  0x1C,0xFE,0x75,0x01,0x8B,0x00,0x00,0x01,0x00,0x05,0x00,
-  0x00,0x02,0xFE,0x02,0x1C,0x00,0x0C,0x00,0x00,0x21,0x23,
-  0x0B,0x01,0x23,0x03,0x33,0x1B,0x01,0x33,0x1B,0x01,0x33,
-  0x02,0x65,0x91,0x51,0x56,0x90,0x98,0x91,0x56,0x52,0x8C,
-  0x51,0x52,0x91,0x01,0x7D,0xFE,0x83,0x02,0x1C,0xFE,0x86,
-  0x01,0x7A,0xFE,0x86,0x01,0x7A,0x00,0x00,0x01,0x00,0x10,
-  0x00,0x00,0x02,0x17,0x02,0x1C,0x00,0x0B,0x00,0x00,0x01,
-  0x13,0x23,0x27,0x07,0x23,0x13,0x03,0x33,0x17,0x37,0x33,
-  0x01,0x63,0xB4,0xA8,0x5B,0x5C,0xA8,0xB4,0xB0,0xA8,0x58,
-  0x57,0xA8,0x01,0x10,0xFE,0xF0,0xA8,0xA8,0x01,0x10,0x01,
-  0x0C,0xA3,0xA3,0x00,0x00,0x01,0x00,0x09,0xFF,0x25,0x02,
-  0x1A,0x02,0x1C,0x00,0x16,0x00,0x00,0x01,0x33,0x03,0x06,
-  0x07,0x06,0x07,0x06,0x23,0x22,0x27,0x35,0x16,0x33,0x32,
-  0x37,0x36,0x3D,0x02,0x03,0x33,0x13,0x01,0x8A,0x90,0xDE,
-  0x19,0x1E,0x0A,0x0E,0x29,0x3C,0x16,0x1C,0x16,0x0F,0x33,
-  0x18,0x0C,0xC9,0x9A,0x77,0x02,0x1C,0xFD,0x81,0x45,0x15,
-  0x07,0x06,0x11,0x04,0x69,0x06,0x2C,0x15,0x19,0x03,0x01,
-  0x02,0x32,0xFE,0x77,0x00,0x00,0x01,0x00,0x15,0x00,0x00,
-  0x01,0xD4,0x02,0x1C,0x00,0x09,0x00,0x00,0x01,0x15,0x01,
-  0x21,0x15,0x21,0x35,0x01,0x23,0x35,0x01,0xCB,0xFE,0xF7,
-  0x01,0x12,0xFE,0x41,0x01,0x0B,0xF9,0x02,0x1C,0x71,0xFE,
-  0xC6,0x71,0x71,0x01,0x3A,0x71,0x00,0x00,0x01,0x00,0x25,
-  0xFF,0x38,0x01,0x3D,0x02,0xD9,0x00,0x34,0x00,0x00,0x01,
-  0x15,0x23,0x06,0x07,0x15,0x14,0x07,0x22,0x31,0x06,0x07,
-  0x16,0x17,0x33,0x16,0x17,0x16,0x1D,0x01,0x14,0x17,0x16,
-  0x3B,0x01,0x15,0x23,0x22,0x27,0x26,0x3D,0x01,0x34,0x27,
-  0x23,0x27,0x26,0x27,0x26,0x23,0x27,0x35,0x3B,0x01,0x36,
-  0x37,0x36,0x3D,0x01,0x34,0x37,0x36,0x33,0x01,0x3D,0x25,
-  0x2A,0x03,0x22,0x01,0x14,0x2A,0x45,0x11,0x01,0x08,0x01,
-  0x01,0x19,0x08,0x0C,0x25,0x4C,0x46,0x22,0x13,0x17,0x01,
-  0x01,0x03,0x03,0x0E,0x20,0x04,0x04,0x0C,0x3C,0x04,0x01,
-  0x3A,0x1C,0x25,0x02,0xD9,0x63,0x08,0x31,0xC3,0x44,0x16,
-  0x0D,0x06,0x0B,0x24,0x11,0x1C,0x08,0x0A,0xC3,0x36,0x08,
-  0x03,0x63,0x3E,0x22,0x2C,0xD2,0x30,0x0F,0x01,0x02,0x01,
-  0x05,0x01,0x5C,0x01,0x33,0x05,0x06,0xD3,0x53,0x26,0x13,
-  0x00,0x00,0x01,0x00,0x64,0xFF,0x38,0x00,0xB4,0x02,0xD9,
-  0x00,0x03,0x00,0x00,0x13,0x11,0x23,0x11,0xB4,0x50,0x02,
-  0xD9,0xFC,0x5F,0x03,0xA1,0x00,0x01,0x00,0x48,0xFF,0x38,
-  0x01,0x60,0x02,0xD9,0x00,0x2F,0x00,0x00,0x17,0x35,0x33,
-  0x36,0x37,0x35,0x34,0x37,0x32,0x31,0x36,0x37,0x26,0x27,
-  0x26,0x3D,0x01,0x34,0x27,0x26,0x2B,0x01,0x35,0x33,0x32,
-  0x17,0x16,0x1D,0x01,0x14,0x17,0x16,0x17,0x16,0x33,0x17,
-  0x15,0x2B,0x01,0x06,0x07,0x06,0x1D,0x01,0x14,0x07,0x06,
-  0x23,0x48,0x25,0x2A,0x03,0x22,0x01,0x14,0x2A,0x45,0x11,
-  0x0B,0x19,0x08,0x0C,0x25,0x4C,0x46,0x22,0x13,0x17,0x04,
-  0x04,0x0E,0x20,0x04,0x04,0x0C,0x3C,0x04,0x01,0x3A,0x1C,
-  0x25,0xC8,0x63,0x08,0x31,0xC3,0x44,0x16,0x0D,0x06,0x0B,
-  0x24,0x15,0x2A,0xC3,0x36,0x08,0x03,0x63,0x3E,0x22,0x2C,
-  0xD2,0x30,0x0F,0x02,0x02,0x05,0x01,0x5C,0x01,0x33,0x05,
-  0x06,0xD3,0x53,0x26,0x13,0x00,0x01,0x00,0x3C,0x00,0x8E,
-  0x02,0x07,0x01,0x3A,0x00,0x17,0x00,0x00,0x01,0x33,0x06,
-  0x23,0x22,0x2F,0x01,0x26,0x23,0x22,0x07,0x06,0x07,0x23,
-  0x36,0x33,0x32,0x1F,0x01,0x16,0x33,0x32,0x37,0x36,0x01,
-  0xB9,0x4E,0x09,0x76,0x2D,0x26,0x39,0x20,0x1D,0x24,0x0C,
-  0x04,0x01,0x4E,0x07,0x78,0x30,0x23,0x39,0x22,0x1B,0x24,
-  0x0C,0x04,0x01,0x20,0x92,0x1A,0x2A,0x18,0x1B,0x0B,0x1B,
-  0x91,0x19,0x2A,0x19,0x1B,0x0B,0x00,0x02,0x00,0x42,0xFF,
-  0x46,0x00,0xD8,0x02,0x1C,0x00,0x05,0x00,0x09,0x00,0x00,
-  0x17,0x35,0x13,0x33,0x13,0x15,0x03,0x35,0x33,0x15,0x42,
-  0x2A,0x43,0x29,0x96,0x96,0xBA,0xD2,0x01,0x35,0xFE,0xCB,
-  0xD2,0x02,0x44,0x92,0x92,0x00,0x00,0x02,0x00,0x24,0xFF,
-  0x84,0x02,0x0A,0x02,0x7A,0x00,0x21,0x00,0x26,0x00,0x00,
-  0x01,0x11,0x36,0x37,0x35,0x36,0x37,0x33,0x06,0x07,0x06,
-  0x07,0x15,0x23,0x35,0x26,0x27,0x26,0x35,0x34,0x37,0x36,
-  0x37,0x35,0x33,0x15,0x16,0x17,0x16,0x17,0x23,0x26,0x27,
-  0x26,0x03,0x11,0x06,0x15,0x14,0x01,0x2F,0x36,0x16,0x05,
-  0x04,0x86,0x0A,0x56,0x35,0x46,0x2C,0x85,0x39,0x21,0x8D,
-  0x25,0x2D,0x2C,0x72,0x3E,0x26,0x05,0x86,0x10,0x33,0x08,
-  0x36,0x53,0x01,0xB3,0xFE,0xA8,0x08,0x3B,0x01,0x0C,0x10,
-  0x6F,0x3B,0x25,0x03,0x65,0x66,0x09,0x72,0x42,0x5C,0xCF,
-  0x3E,0x0F,0x05,0x56,0x55,0x02,0x55,0x34,0x48,0x4D,0x10,
-  0x03,0xFE,0xAC,0x01,0x53,0x16,0x97,0x8D,0x00,0x00,0x01,
-  0x00,0x1F,0xFF,0xE9,0x02,0x19,0x02,0xCB,0x00,0x4D,0x00,
-  0x00,0x01,0x15,0x23,0x16,0x15,0x14,0x07,0x06,0x07,0x36,
-  0x37,0x32,0x17,0x16,0x33,0x32,0x37,0x17,0x06,0x23,0x22,
-  0x27,0x26,0x23,0x22,0x07,0x27,0x36,0x37,0x36,0x35,0x34,
-  0x27,0x23,0x35,0x33,0x26,0x27,0x26,0x35,0x34,0x37,0x36,
-  0x37,0x36,0x33,0x32,0x1F,0x01,0x15,0x16,0x17,0x16,0x17,
-  0x23,0x27,0x26,0x2F,0x01,0x26,0x27,0x26,0x23,0x22,0x07,
-  0x14,0x23,0x06,0x15,0x14,0x1F,0x01,0x15,0x17,0x16,0x17,
-  0x16,0x17,0x01,0x77,0x7A,0x0F,0x42,0x15,0x1D,0x52,0x1E,
-  0x15,0x2B,0x25,0x1A,0x2F,0x3A,0x29,0x4C,0x45,0x20,0x43,
-  0x40,0x22,0x31,0x3C,0x37,0x53,0x12,0x09,0x15,0x59,0x3C,
-  0x2F,0x04,0x02,0x3D,0x06,0x07,0x40,0x64,0x94,0x3C,0x01,
-  0x05,0x04,0x15,0x07,0x84,0x01,0x07,0x16,0x01,0x02,0x03,
-  0x1E,0x2F,0x3D,0x1A,0x01,0x0A,0x13,0x01,0x01,0x02,0x04,
-  0x17,0x07,0x01,0x73,0x37,0x20,0x1B,0x41,0x3F,0x14,0x17,
-  0x24,0x01,0x0B,0x0A,0x1D,0x6D,0x2D,0x10,0x10,0x1E,0x65,
-  0x39,0x2D,0x15,0x1C,0x22,0x33,0x37,0x52,0x23,0x0C,0x10,
-  0x50,0x3A,0x06,0x06,0x31,0x5D,0x01,0x01,0x07,0x08,0x29,
-  0x50,0x0B,0x37,0x16,0x01,0x02,0x02,0x1B,0x2F,0x01,0x13,
-  0x18,0x15,0x28,0x01,0x01,0x01,0x06,0x07,0x2F,0x12,0x00,
-  0x00,0x02,0x00,0x1A,0x00,0x64,0x02,0x12,0x02,0x5C,0x00,
-  0x1F,0x00,0x2F,0x00,0x00,0x01,0x37,0x17,0x07,0x16,0x15,
-  0x14,0x07,0x17,0x07,0x27,0x06,0x07,0x2B,0x01,0x22,0x23,
-  0x22,0x27,0x07,0x27,0x37,0x26,0x35,0x34,0x37,0x27,0x37,
-  0x17,0x36,0x33,0x32,0x07,0x22,0x07,0x06,0x15,0x14,0x17,
-  0x16,0x33,0x32,0x37,0x36,0x35,0x34,0x27,0x26,0x01,0x84,
-  0x49,0x45,0x4B,0x1B,0x1D,0x4D,0x45,0x4B,0x34,0x24,0x01,
-  0x01,0x04,0x06,0x45,0x2A,0x4F,0x44,0x4E,0x1E,0x1D,0x4F,
-  0x45,0x4D,0x33,0x3A,0x3B,0x3C,0x3B,0x20,0x11,0x31,0x1A,
-  0x20,0x39,0x20,0x12,0x2F,0x1B,0x02,0x10,0x49,0x45,0x4B,
-  0x36,0x31,0x39,0x33,0x4C,0x44,0x4B,0x1C,0x02,0x1F,0x4E,
-  0x45,0x4D,0x37,0x33,0x3B,0x2E,0x4F,0x44,0x4D,0x1F,0x62,
-  0x31,0x1A,0x21,0x3A,0x20,0x11,0x30,0x1B,0x21,0x38,0x21,
-  0x12,0x00,0x01,0x00,0x05,0x00,0x00,0x02,0x28,0x02,0xC0,
-  0x00,0x16,0x00,0x00,0x01,0x15,0x23,0x15,0x33,0x15,0x23,
-  0x15,0x23,0x35,0x23,0x35,0x33,0x35,0x23,0x35,0x33,0x03,
-  0x33,0x17,0x37,0x33,0x03,0x01,0xF1,0x8E,0x8E,0x8E,0x8C,
-  0x91,0x91,0x91,0x8A,0xCB,0x8B,0x8B,0x86,0x87,0xC0,0x01,
-  0x5F,0x3B,0x35,0x3B,0xB4,0xB4,0x3B,0x35,0x3B,0x01,0x61,
-  0xFE,0xFE,0xFE,0x9F,0x00,0x00,0x02,0x00,0x64,0xFF,0x38,
-  0x00,0xB4,0x02,0xD9,0x00,0x03,0x00,0x07,0x00,0x00,0x13,
-  0x11,0x23,0x11,0x13,0x11,0x23,0x11,0xB4,0x50,0x50,0x50,
-  0x02,0xD9,0xFE,0x7B,0x01,0x85,0xFD,0xE4,0xFE,0x7B,0x01,
-  0x85,0x00,0x02,0x00,0x21,0xFF,0x37,0x02,0x06,0x02,0xD3,
-  0x00,0x3F,0x00,0x4F,0x00,0x00,0x01,0x23,0x26,0x27,0x2B,
-  0x01,0x22,0x07,0x06,0x15,0x14,0x17,0x16,0x1F,0x01,0x16,
-  0x15,0x14,0x07,0x06,0x07,0x16,0x15,0x14,0x07,0x06,0x23,
-  0x22,0x27,0x33,0x15,0x16,0x17,0x16,0x33,0x32,0x37,0x36,
-  0x35,0x34,0x27,0x26,0x2F,0x01,0x26,0x35,0x34,0x37,0x36,
-  0x37,0x26,0x27,0x26,0x35,0x34,0x37,0x36,0x33,0x32,0x1F,
-  0x01,0x16,0x17,0x16,0x03,0x27,0x06,0x07,0x14,0x1F,0x01,
-  0x16,0x1F,0x01,0x36,0x35,0x34,0x27,0x31,0x26,0x01,0xD9,
-  0x7F,0x09,0x3B,0x01,0x09,0x31,0x0C,0x03,0x27,0x12,0x21,
-  0x7F,0x61,0x3F,0x0D,0x12,0x46,0x54,0x38,0x4E,0xD1,0x02,
-  0x83,0x03,0x10,0x16,0x28,0x36,0x11,0x05,0x12,0x0A,0x2A,
-  0xAB,0x4F,0x28,0x13,0x21,0x1C,0x06,0x1B,0x4E,0x37,0x4C,
-  0x6B,0x36,0x01,0x07,0x05,0x17,0x85,0x8F,0x29,0x01,0x21,
-  0x01,0x08,0x0B,0x93,0x2E,0x22,0x0B,0x02,0x20,0x48,0x05,
-  0x23,0x07,0x09,0x1C,0x1B,0x0C,0x12,0x46,0x36,0x63,0x50,
-  0x29,0x09,0x08,0x31,0x55,0x67,0x35,0x23,0xC9,0x0A,0x2B,
-  0x0F,0x16,0x25,0x0B,0x0D,0x1B,0x12,0x0A,0x17,0x64,0x2E,
-  0x56,0x3C,0x2A,0x14,0x19,0x1C,0x09,0x23,0x33,0x58,0x31,
-  0x23,0x3C,0x01,0x07,0x08,0x26,0xFE,0xD1,0x4C,0x19,0x28,
-  0x23,0x17,0x01,0x05,0x06,0x50,0x20,0x21,0x23,0x17,0x07,
-  0x00,0x02,0x00,0x12,0x02,0x6D,0x01,0x3A,0x02,0xE7,0x00,
-  0x03,0x00,0x07,0x00,0x00,0x13,0x15,0x23,0x35,0x21,0x15,
-  0x23,0x35,0x80,0x6E,0x01,0x28,0x6E,0x02,0xE7,0x7A,0x7A,
-  0x7A,0x7A,0x00,0x00,0x03,0xFF,0xF2,0xFF,0xEA,0x02,0xEF,
-  0x02,0xE7,0x00,0x21,0x00,0x39,0x00,0x4B,0x00,0x00,0x01,
-  0x23,0x26,0x27,0x22,0x07,0x06,0x07,0x06,0x15,0x14,0x17,
-  0x16,0x33,0x32,0x37,0x36,0x35,0x33,0x06,0x07,0x06,0x23,
-  0x22,0x27,0x26,0x35,0x34,0x37,0x36,0x33,0x32,0x17,0x16,
-  0x03,0x32,0x17,0x16,0x17,0x16,0x15,0x14,0x07,0x06,0x07,
-  0x06,0x23,0x22,0x27,0x26,0x27,0x26,0x35,0x34,0x37,0x36,
-  0x37,0x36,0x17,0x22,0x07,0x14,0x07,0x06,0x15,0x14,0x17,
-  0x16,0x17,0x32,0x37,0x36,0x35,0x34,0x27,0x26,0x02,0x28,
-  0x5A,0x17,0x46,0x4E,0x1A,0x07,0x02,0x01,0x46,0x12,0x17,
-  0x54,0x0B,0x01,0x5C,0x05,0x58,0x2A,0x37,0x74,0x35,0x20,
-  0x5B,0x30,0x41,0x66,0x35,0x1A,0xB3,0x96,0x6E,0x6C,0x0D,
-  0x01,0x6A,0x67,0x99,0x0D,0x0C,0x91,0x6E,0x6B,0x0E,0x02,
-  0x67,0x66,0x92,0x10,0x0F,0x7D,0x5A,0x01,0x58,0x58,0x58,
-  0x7D,0x82,0x5A,0x58,0x5B,0x59,0x01,0xAF,0x4A,0x04,0x50,
-  0x14,0x18,0x0C,0x0E,0x70,0x1C,0x08,0x4F,0x04,0x03,0x6B,
-  0x2A,0x14,0x5F,0x39,0x50,0x8E,0x3B,0x1F,0x46,0x23,0x01,
-  0x00,0x66,0x65,0x92,0x11,0x10,0x9B,0x6E,0x6C,0x09,0x01,
-  0x66,0x64,0x90,0x12,0x13,0x96,0x6E,0x6D,0x0C,0x01,0x48,
-  0x5B,0x01,0x01,0x5A,0x7F,0x7E,0x5C,0x5B,0x02,0x5C,0x5A,
-  0x81,0x81,0x5B,0x5A,0x00,0x00,0x03,0x00,0x1F,0x01,0x06,
-  0x01,0x49,0x02,0xD9,0x00,0x03,0x00,0x24,0x00,0x34,0x00,
-  0x00,0x01,0x15,0x21,0x35,0x25,0x15,0x23,0x26,0x27,0x06,
-  0x23,0x22,0x27,0x26,0x35,0x34,0x3F,0x01,0x36,0x37,0x36,
-  0x35,0x34,0x23,0x22,0x07,0x1D,0x01,0x06,0x07,0x23,0x36,
-  0x33,0x32,0x1D,0x01,0x14,0x27,0x35,0x06,0x0F,0x01,0x06,
-  0x07,0x06,0x15,0x14,0x17,0x16,0x33,0x32,0x37,0x36,0x01,
-  0x41,0xFE,0xE4,0x01,0x24,0x5C,0x09,0x01,0x2B,0x37,0x41,
-  0x18,0x09,0x5F,0x22,0x29,0x0B,0x0F,0x31,0x2F,0x09,0x02,
-  0x01,0x4E,0x02,0x85,0x85,0x52,0x0B,0x18,0x1D,0x2B,0x04,
-  0x01,0x25,0x04,0x05,0x38,0x09,0x01,0x01,0x54,0x4E,0x4E,
-  0x46,0x0A,0x0B,0x15,0x2E,0x35,0x14,0x19,0x57,0x10,0x06,
-  0x07,0x06,0x07,0x11,0x1F,0x1D,0x01,0x01,0x06,0x07,0x70,
-  0x64,0xB3,0x16,0x66,0x17,0x06,0x04,0x06,0x09,0x1A,0x04,
-  0x05,0x22,0x04,0x01,0x3A,0x09,0x00,0x00,0x02,0x00,0x58,
-  0x00,0x48,0x01,0xD4,0x01,0xE1,0x00,0x06,0x00,0x0D,0x00,
-  0x00,0x37,0x35,0x37,0x15,0x07,0x17,0x15,0x37,0x35,0x37,
-  0x15,0x07,0x17,0x15,0x58,0xA7,0x65,0x65,0x2E,0xA7,0x65,
-  0x65,0xDA,0x72,0x95,0x75,0x59,0x59,0x72,0x92,0x72,0x95,
-  0x75,0x59,0x59,0x72,0x00,0x01,0x00,0x28,0x00,0x56,0x02,
-  0x20,0x01,0x77,0x00,0x05,0x00,0x00,0x13,0x21,0x11,0x23,
-  0x35,0x21,0x28,0x01,0xF8,0x4D,0xFE,0x55,0x01,0x77,0xFE,
-  0xDF,0xD4,0x00,0x00,0x04,0xFF,0xF2,0xFF,0xEA,0x02,0xEF,
-  0x02,0xE7,0x00,0x1D,0x00,0x28,0x00,0x40,0x00,0x52,0x00,
-  0x00,0x01,0x15,0x23,0x11,0x33,0x32,0x1F,0x01,0x16,0x15,
-  0x14,0x07,0x16,0x17,0x31,0x16,0x17,0x14,0x17,0x16,0x17,
-  0x15,0x23,0x26,0x35,0x34,0x37,0x35,0x26,0x2F,0x01,0x33,
-  0x32,0x37,0x36,0x35,0x34,0x27,0x26,0x2B,0x01,0x37,0x32,
-  0x17,0x16,0x17,0x16,0x15,0x14,0x07,0x06,0x07,0x06,0x23,
-  0x22,0x27,0x26,0x27,0x26,0x35,0x34,0x37,0x36,0x37,0x36,
-  0x17,0x22,0x07,0x14,0x07,0x06,0x15,0x14,0x17,0x16,0x17,
-  0x32,0x37,0x36,0x35,0x34,0x27,0x26,0x01,0x20,0x60,0xEE,
-  0x59,0x18,0x01,0x07,0x46,0x23,0x09,0x0B,0x02,0x0F,0x02,
-  0x02,0x67,0x0E,0x01,0x04,0x39,0x5C,0x67,0x33,0x09,0x04,
-  0x1F,0x0C,0x15,0x67,0x51,0x96,0x6E,0x6C,0x0D,0x01,0x6A,
-  0x67,0x99,0x0D,0x0C,0x91,0x6E,0x6B,0x0E,0x02,0x67,0x66,
-  0x92,0x10,0x0F,0x7D,0x5A,0x01,0x58,0x58,0x58,0x7D,0x82,
-  0x5A,0x58,0x5B,0x59,0x01,0x39,0xAD,0x01,0xBB,0x48,0x01,
-  0x15,0x1B,0x4A,0x22,0x10,0x12,0x15,0x68,0x17,0x09,0x01,
-  0x01,0x15,0x22,0x2F,0x10,0x0A,0x11,0x30,0x01,0x51,0x1B,
-  0x0A,0x11,0x2A,0x09,0x03,0xF1,0x66,0x65,0x92,0x11,0x10,
-  0x9B,0x6E,0x6C,0x09,0x01,0x66,0x64,0x90,0x12,0x13,0x96,
-  0x6E,0x6D,0x0C,0x01,0x48,0x5B,0x01,0x01,0x5A,0x7F,0x7E,
-  0x5C,0x5B,0x02,0x5C,0x5A,0x81,0x81,0x5B,0x5A,0x00,0x00,
-  0x01,0x00,0x10,0x02,0x80,0x01,0x3B,0x02,0xCF,0x00,0x03,
-  0x00,0x00,0x01,0x15,0x21,0x35,0x01,0x3B,0xFE,0xD5,0x02,
-  0xCF,0x4F,0x4F,0x00,0x02,0x00,0x97,0x01,0x7F,0x01,0xC6,
-  0x02,0xAE,0x00,0x0F,0x00,0x21,0x00,0x00,0x01,0x32,0x17,
-  0x16,0x15,0x14,0x07,0x06,0x23,0x22,0x27,0x26,0x35,0x34,
-  0x37,0x36,0x17,0x22,0x07,0x06,0x15,0x14,0x17,0x16,0x33,
-  0x32,0x37,0x30,0x35,0x36,0x35,0x34,0x27,0x26,0x01,0x2F,
-  0x4A,0x2D,0x20,0x3C,0x29,0x34,0x48,0x2E,0x20,0x3C,0x28,
-  0x34,0x32,0x1A,0x0D,0x29,0x16,0x18,0x34,0x1A,0x0C,0x2A,
-  0x15,0x02,0xAE,0x3B,0x29,0x33,0x4C,0x2D,0x1F,0x3B,0x29,
-  0x34,0x4A,0x2E,0x1F,0x3F,0x2A,0x16,0x19,0x30,0x1A,0x0E,
-  0x2C,0x01,0x14,0x18,0x30,0x1B,0x0D,0x00,0x00,0x02,0x00,
-  0x38,0xFF,0xF0,0x02,0x0F,0x02,0x60,0x00,0x03,0x00,0x0F,
-  0x00,0x00,0x25,0x15,0x21,0x35,0x01,0x15,0x23,0x15,0x23,
-  0x35,0x23,0x35,0x33,0x35,0x33,0x15,0x02,0x0F,0xFE,0x29,
-  0x01,0xD7,0xB0,0x77,0xB0,0xB0,0x77,0x67,0x77,0x77,0x01,
-  0x49,0x77,0xB0,0xB0,0x77,0xB0,0xB0,0x00,0x01,0x00,0x10,
-  0x01,0x1C,0x01,0x48,0x02,0xCE,0x00,0x27,0x00,0x00,0x01,
-  0x15,0x21,0x36,0x37,0x36,0x37,0x36,0x37,0x36,0x35,0x34,
-  0x27,0x26,0x23,0x22,0x07,0x06,0x15,0x14,0x17,0x23,0x26,
-  0x35,0x34,0x37,0x36,0x33,0x32,0x17,0x16,0x15,0x14,0x07,
-  0x06,0x07,0x06,0x07,0x06,0x07,0x01,0x46,0xFE,0xCA,0x03,
-  0x28,0x15,0x28,0x57,0x10,0x0A,0x2E,0x07,0x08,0x33,0x08,
-  0x01,0x02,0x5C,0x01,0x64,0x19,0x1F,0x79,0x18,0x06,0x26,
-  0x15,0x2B,0x32,0x09,0x09,0x13,0x01,0x6D,0x51,0x4E,0x2A,
-  0x17,0x1A,0x3A,0x19,0x11,0x1B,0x36,0x09,0x01,0x37,0x07,
-  0x09,0x02,0x0E,0x08,0x0A,0x6F,0x1A,0x06,0x5A,0x14,0x18,
-  0x38,0x27,0x15,0x1E,0x23,0x08,0x06,0x18,0x00,0x01,0x00,
-  0x0F,0x01,0x0F,0x01,0x49,0x02,0xCE,0x00,0x2A,0x00,0x00,
-  0x13,0x35,0x33,0x32,0x35,0x34,0x27,0x26,0x23,0x22,0x07,
-  0x06,0x15,0x23,0x36,0x37,0x36,0x33,0x32,0x17,0x16,0x15,
-  0x14,0x07,0x16,0x15,0x14,0x07,0x06,0x23,0x22,0x27,0x26,
-  0x35,0x33,0x16,0x17,0x32,0x37,0x36,0x35,0x34,0x27,0x86,
-  0x0B,0x4B,0x26,0x07,0x08,0x26,0x0C,0x07,0x58,0x03,0x19,
-  0x28,0x50,0x5F,0x24,0x0E,0x34,0x42,0x4A,0x24,0x31,0x75,
-  0x1E,0x08,0x5C,0x04,0x3D,0x2B,0x0F,0x04,0x54,0x01,0xD7,
-  0x3E,0x3A,0x2B,0x09,0x02,0x1C,0x0E,0x20,0x41,0x21,0x31,
-  0x3D,0x19,0x1F,0x39,0x20,0x20,0x47,0x55,0x23,0x12,0x59,
-  0x18,0x1E,0x40,0x02,0x25,0x0A,0x0D,0x3D,0x02,0x00,0x01,
-  0x00,0x79,0x02,0x5F,0x01,0x3D,0x02,0xF5,0x00,0x03,0x00,
-  0x00,0x01,0x07,0x23,0x37,0x01,0x3D,0x7E,0x46,0x46,0x02,
-  0xF5,0x96,0x96,0x00,0x00,0x01,0x00,0x3A,0xFF,0x24,0x02,
-  0x3D,0x02,0x1C,0x00,0x23,0x00,0x00,0x17,0x23,0x11,0x33,
-  0x11,0x14,0x17,0x16,0x33,0x32,0x37,0x36,0x35,0x11,0x33,
-  0x11,0x14,0x1F,0x01,0x16,0x33,0x32,0x37,0x15,0x06,0x23,
-  0x22,0x27,0x26,0x27,0x06,0x07,0x22,0x23,0x22,0x27,0xC0,
-  0x86,0x8C,0x12,0x16,0x2C,0x3D,0x1B,0x0D,0x8C,0x10,0x01,
-  0x05,0x08,0x07,0x0D,0x21,0x25,0x36,0x1C,0x06,0x07,0x31,
-  0x35,0x05,0x09,0x3D,0x27,0xDC,0x02,0xF8,0xFE,0xB2,0x33,
-  0x1A,0x21,0x33,0x19,0x1E,0x01,0x52,0xFE,0x7A,0x3E,0x08,
-  0x01,0x02,0x04,0x57,0x11,0x23,0x08,0x0B,0x32,0x04,0x26,
-  0x00,0x01,0x00,0x13,0xFF,0x41,0x02,0x11,0x02,0xD9,0x00,
-  0x11,0x00,0x00,0x01,0x15,0x23,0x11,0x23,0x11,0x23,0x11,
-  0x23,0x11,0x26,0x27,0x26,0x35,0x34,0x37,0x36,0x33,0x02,
-  0x11,0x2B,0x62,0x3F,0x62,0x6D,0x3B,0x28,0x33,0x3A,0x62,
-  0x02,0xD9,0x48,0xFC,0xB0,0x03,0x50,0xFC,0xB0,0x01,0xCA,
-  0x05,0x56,0x3A,0x4F,0x57,0x44,0x4F,0x00,0x01,0x00,0x40,
-  0x00,0xA9,0x00,0xBC,0x01,0x24,0x00,0x03,0x00,0x00,0x13,
-  0x33,0x15,0x23,0x40,0x7C,0x7C,0x01,0x24,0x7B,0x00,0x01,
-  0x00,0x1B,0xFF,0x24,0x01,0x26,0x00,0x00,0x00,0x1E,0x00,
-  0x00,0x3B,0x01,0x07,0x36,0x33,0x32,0x17,0x16,0x15,0x14,
-  0x07,0x06,0x23,0x22,0x27,0x22,0x27,0x37,0x16,0x33,0x32,
-  0x37,0x36,0x37,0x34,0x2F,0x01,0x26,0x23,0x22,0x07,0xA2,
-  0x2B,0x1D,0x15,0x15,0x3C,0x0D,0x03,0x5A,0x12,0x15,0x37,
-  0x4F,0x02,0x02,0x13,0x45,0x24,0x28,0x0D,0x03,0x01,0x22,
-  0x01,0x08,0x08,0x18,0x19,0x3F,0x07,0x30,0x0B,0x0C,0x4C,
-  0x0E,0x03,0x1B,0x01,0x34,0x1E,0x1A,0x06,0x09,0x1B,0x06,
-  0x01,0x01,0x0C,0x00,0x00,0x01,0x00,0x28,0x01,0x1C,0x00,
-  0xF2,0x02,0xC5,0x00,0x07,0x00,0x00,0x13,0x23,0x35,0x32,
-  0x37,0x33,0x11,0x23,0x93,0x6B,0x75,0x15,0x40,0x5F,0x02,
-  0x3D,0x3D,0x4B,0xFE,0x57,0x00,0x03,0x00,0x17,0x01,0x06,
-  0x01,0x57,0x02,0xD9,0x00,0x03,0x00,0x13,0x00,0x23,0x00,
-  0x00,0x01,0x15,0x21,0x35,0x13,0x32,0x17,0x16,0x15,0x14,
-  0x07,0x06,0x23,0x22,0x27,0x26,0x35,0x34,0x37,0x36,0x17,
-  0x22,0x07,0x06,0x15,0x14,0x17,0x16,0x33,0x32,0x37,0x36,
-  0x35,0x34,0x27,0x26,0x01,0x4E,0xFE,0xD3,0x96,0x70,0x23,
-  0x0D,0x4D,0x24,0x2F,0x67,0x27,0x12,0x50,0x23,0x2D,0x30,
-  0x14,0x08,0x2C,0x0F,0x11,0x30,0x13,0x09,0x2E,0x11,0x01,
-  0x54,0x4E,0x4E,0x01,0x85,0x5E,0x23,0x2D,0x6B,0x2A,0x14,
-  0x52,0x26,0x33,0x71,0x29,0x12,0x44,0x34,0x17,0x1C,0x47,
-  0x19,0x08,0x34,0x16,0x1C,0x4B,0x17,0x06,0x00,0x00,0x02,
-  0x00,0x58,0x00,0x48,0x01,0xCE,0x01,0xE1,0x00,0x06,0x00,
-  0x0D,0x00,0x00,0x01,0x15,0x07,0x35,0x37,0x27,0x35,0x05,
-  0x15,0x07,0x35,0x37,0x27,0x35,0x00,0xFF,0xA7,0x65,0x65,
-  0x01,0x76,0xA7,0x65,0x65,0x01,0x4F,0x73,0x94,0x75,0x59,
-  0x59,0x72,0x92,0x73,0x94,0x75,0x59,0x59,0x72,0x00,0x00,
-  0x04,0x00,0x28,0xFF,0xEC,0x03,0x52,0x02,0xCB,0x00,0x07,
-  0x00,0x0B,0x00,0x16,0x00,0x19,0x00,0x00,0x13,0x23,0x35,
-  0x32,0x37,0x33,0x11,0x23,0x01,0x33,0x01,0x23,0x25,0x15,
-  0x23,0x15,0x23,0x35,0x23,0x35,0x13,0x33,0x11,0x23,0x35,
-  0x07,0x93,0x6B,0x75,0x15,0x40,0x5F,0x01,0xBE,0x57,0xFE,
-  0x59,0x57,0x02,0xA8,0x2E,0x5F,0xB3,0xA5,0x6D,0x5F,0x6A,
-  0x02,0x3D,0x3D,0x4B,0xFE,0x57,0x01,0xAF,0xFD,0x21,0xBC,
-  0x4B,0x5D,0x5D,0x4A,0x01,0x02,0xFE,0xFF,0xA4,0xA4,0x00,
-  0x03,0x00,0x28,0xFF,0xEC,0x03,0x4E,0x02,0xCB,0x00,0x07,
-  0x00,0x0B,0x00,0x34,0x00,0x00,0x13,0x23,0x35,0x32,0x37,
-  0x33,0x11,0x23,0x01,0x33,0x01,0x23,0x25,0x15,0x21,0x36,
-  0x37,0x36,0x37,0x36,0x37,0x36,0x35,0x34,0x27,0x26,0x23,
-  0x22,0x07,0x15,0x06,0x15,0x14,0x17,0x23,0x26,0x35,0x34,
-  0x37,0x36,0x33,0x32,0x17,0x16,0x15,0x14,0x07,0x06,0x07,
-  0x06,0x07,0x06,0x07,0x93,0x6B,0x75,0x15,0x40,0x5F,0x01,
-  0xB8,0x57,0xFE,0x59,0x57,0x02,0xA8,0xFE,0xCA,0x03,0x28,
-  0x15,0x28,0x57,0x10,0x0A,0x2E,0x07,0x08,0x33,0x08,0x01,
-  0x02,0x5C,0x01,0x64,0x19,0x1F,0x79,0x18,0x06,0x26,0x15,
-  0x2B,0x2E,0x0D,0x09,0x13,0x02,0x3D,0x3D,0x4B,0xFE,0x57,
-  0x01,0xAF,0xFD,0x21,0x65,0x51,0x4E,0x2A,0x17,0x1A,0x3A,
-  0x19,0x11,0x1B,0x36,0x09,0x01,0x37,0x01,0x07,0x08,0x02,
-  0x0E,0x08,0x0A,0x6F,0x1A,0x06,0x5A,0x14,0x18,0x38,0x27,
-  0x15,0x1E,0x20,0x0B,0x06,0x18,0x00,0x00,0x04,0x00,0x0F,
-  0xFF,0xEC,0x03,0x52,0x02,0xCE,0x00,0x2A,0x00,0x2E,0x00,
-  0x39,0x00,0x3C,0x00,0x00,0x13,0x35,0x33,0x32,0x35,0x34,
-  0x27,0x26,0x23,0x22,0x07,0x06,0x15,0x23,0x36,0x37,0x36,
-  0x33,0x32,0x17,0x16,0x15,0x14,0x07,0x16,0x15,0x14,0x07,
-  0x06,0x23,0x22,0x27,0x26,0x35,0x33,0x16,0x17,0x32,0x37,
-  0x36,0x35,0x34,0x27,0x25,0x33,0x01,0x23,0x25,0x15,0x23,
-  0x15,0x23,0x35,0x23,0x35,0x13,0x33,0x11,0x23,0x35,0x07,
-  0x86,0x0B,0x4B,0x26,0x07,0x08,0x26,0x0C,0x07,0x58,0x03,
-  0x19,0x28,0x50,0x5F,0x24,0x0E,0x34,0x42,0x4A,0x24,0x31,
-  0x75,0x1E,0x08,0x5C,0x04,0x3D,0x2B,0x0F,0x04,0x54,0x01,
-  0xDB,0x57,0xFE,0x59,0x57,0x02,0x88,0x2E,0x5F,0xB3,0xA5,
-  0x6D,0x5F,0x6A,0x01,0xD7,0x3E,0x3A,0x2B,0x09,0x02,0x1C,
-  0x0E,0x20,0x41,0x21,0x31,0x3D,0x19,0x1F,0x39,0x20,0x20,
-  0x47,0x55,0x23,0x12,0x59,0x18,0x1E,0x40,0x02,0x25,0x0A,
-  0x0D,0x3D,0x02,0xF4,0xFD,0x21,0xBC,0x4B,0x5D,0x5D,0x4A,
-  0x01,0x02,0xFE,0xFF,0xA4,0xA4,0x00,0x00,0x02,0x00,0x33,
-  0xFF,0x34,0x02,0x20,0x02,0x1C,0x00,0x26,0x00,0x2A,0x00,
-  0x00,0x13,0x33,0x16,0x07,0x06,0x07,0x06,0x07,0x06,0x15,
-  0x14,0x17,0x16,0x33,0x32,0x37,0x36,0x27,0x35,0x33,0x06,
-  0x07,0x06,0x07,0x06,0x23,0x22,0x27,0x26,0x35,0x34,0x37,
-  0x36,0x37,0x36,0x37,0x36,0x37,0x36,0x27,0x35,0x33,0x15,
-  0xEF,0x7C,0x03,0x28,0x16,0x29,0x38,0x0A,0x05,0x31,0x19,
-  0x1F,0x3E,0x20,0x13,0x02,0x88,0x01,0x29,0x02,0x03,0x41,
-  0x83,0x83,0x46,0x31,0x2C,0x19,0x34,0x30,0x0A,0x05,0x02,
-  0x02,0x10,0x96,0x01,0x53,0x51,0x35,0x1D,0x23,0x2E,0x1C,
-  0x0F,0x17,0x42,0x20,0x11,0x3B,0x25,0x2F,0x02,0x6C,0x3A,
-  0x04,0x04,0x59,0x56,0x3C,0x54,0x4E,0x32,0x1E,0x24,0x22,
-  0x15,0x0A,0x0C,0x15,0x4C,0x92,0x92,0xFF,0xFF,0x00,0x1A,
-  0x00,0x00,0x02,0xBF,0x03,0xA8,0x10,0x26,0x00,0x24,0x00,
-  0x00,0x10,0x07,0x00,0x43,0x00,0xCC,0x00,0xB3,0xFF,0xFF,
-  0x00,0x1A,0x00,0x00,0x02,0xBF,0x03,0xA7,0x10,0x26,0x00,
-  0x24,0x00,0x00,0x10,0x07,0x00,0x74,0x00,0xC1,0x00,0xB2,
-  0xFF,0xFF,0x00,0x1A,0x00,0x00,0x02,0xBF,0x03,0xA8,0x10,
-  0x26,0x00,0x24,0x00,0x00,0x10,0x07,0x01,0x45,0x00,0xC4,
-  0x00,0xB3,0xFF,0xFF,0x00,0x1A,0x00,0x00,0x02,0xBF,0x03,
-  0xA0,0x10,0x26,0x00,0x24,0x00,0x00,0x10,0x07,0x01,0x4B,
-  0x00,0xC9,0x00,0xB3,0xFF,0xFF,0x00,0x1A,0x00,0x00,0x02,
-  0xBF,0x03,0x9A,0x10,0x26,0x00,0x24,0x00,0x00,0x10,0x07,
-  0x00,0x69,0x00,0xC6,0x00,0xB3,0xFF,0xFF,0x00,0x1A,0x00,
-  0x00,0x02,0xBF,0x03,0xB5,0x10,0x26,0x00,0x24,0x00,0x00,
-  0x10,0x07,0x01,0x49,0x00,0xC4,0x00,0xB3,0x00,0x02,0x00,
-  0x01,0x00,0x00,0x03,0xC6,0x02,0xD9,0x00,0x0F,0x00,0x13,
-  0x00,0x00,0x25,0x23,0x07,0x23,0x01,0x21,0x15,0x21,0x15,
-  0x21,0x15,0x21,0x15,0x21,0x15,0x21,0x19,0x01,0x23,0x03,
-  0x01,0xAE,0xDF,0x35,0x99,0x01,0x07,0x02,0xAA,0xFE,0x92,
-  0x01,0x53,0xFE,0xAD,0x01,0x82,0xFD,0xE8,0x43,0x72,0x98,
-  0x98,0x02,0xD9,0x7D,0xA5,0x7D,0xBD,0x7D,0x01,0x15,0x01,
-  0x47,0xFE,0xB9,0x00,0x01,0x00,0x2C,0xFF,0x24,0x02,0xAD,
-  0x02,0xE5,0x00,0x47,0x00,0x00,0x05,0x07,0x36,0x33,0x32,
-  0x17,0x16,0x15,0x14,0x07,0x06,0x23,0x22,0x27,0x22,0x27,
-  0x37,0x16,0x33,0x32,0x37,0x36,0x37,0x34,0x27,0x23,0x31,
-  0x23,0x26,0x23,0x22,0x07,0x37,0x26,0x27,0x26,0x27,0x26,
-  0x35,0x34,0x37,0x36,0x33,0x32,0x17,0x16,0x17,0x16,0x17,
-  0x23,0x26,0x27,0x26,0x23,0x22,0x07,0x06,0x07,0x06,0x15,
-  0x14,0x17,0x16,0x33,0x32,0x37,0x36,0x37,0x33,0x06,0x07,
-  0x06,0x01,0x7B,0x13,0x14,0x16,0x3C,0x0D,0x03,0x5A,0x12,
-  0x15,0x37,0x4F,0x02,0x02,0x13,0x45,0x24,0x28,0x0D,0x03,
-  0x01,0x1F,0x01,0x01,0x08,0x0A,0x18,0x19,0x2B,0x64,0x31,
-  0x0E,0x11,0x6F,0x78,0x56,0x80,0xA1,0x57,0x04,0x03,0x2A,
-  0x07,0x8F,0x0C,0x15,0x2A,0x51,0x73,0x30,0x13,0x05,0x02,
-  0x5E,0x27,0x33,0x6F,0x25,0x0A,0x03,0x92,0x07,0x78,0x4A,
-  0x17,0x28,0x07,0x30,0x0B,0x0C,0x4C,0x0E,0x03,0x1B,0x01,
-  0x34,0x1E,0x1A,0x06,0x09,0x19,0x08,0x02,0x0C,0x53,0x11,
-  0x24,0x0A,0x10,0x6A,0xC4,0xD0,0x66,0x49,0x6A,0x05,0x04,
-  0x37,0x59,0x34,0x1A,0x35,0x6F,0x2D,0x3C,0x14,0x15,0xAB,
-  0x3A,0x18,0x5A,0x19,0x1F,0x99,0x48,0x2D,0x00,0xFF,0xFF,
-  0x00,0x4F,0x00,0x00,0x02,0x70,0x03,0xA8,0x10,0x26,0x00,
-  0x28,0x00,0x00,0x10,0x07,0x00,0x43,0x00,0xBE,0x00,0xB3,
-  0xFF,0xFF,0x00,0x4F,0x00,0x00,0x02,0x70,0x03,0xA8,0x10,
-  0x26,0x00,0x28,0x00,0x00,0x10,0x07,0x00,0x74,0x00,0xA3,
-  0x00,0xB3,0xFF,0xFF,0x00,0x4F,0x00,0x00,0x02,0x70,0x03,
-  0xA8,0x10,0x26,0x00,0x28,0x00,0x00,0x10,0x07,0x01,0x45,
-  0x00,0xB2,0x00,0xB3,0xFF,0xFF,0x00,0x4F,0x00,0x00,0x02,
-  0x70,0x03,0x9A,0x10,0x26,0x00,0x28,0x00,0x00,0x10,0x07,
-  0x00,0x69,0x00,0xB2,0x00,0xB3,0xFF,0xFF,0xFF,0xF6,0x00,
-  0x00,0x00,0xD5,0x03,0xA8,0x10,0x26,0x00,0x2C,0x00,0x00,
-  0x10,0x07,0x00,0x43,0xFF,0xE5,0x00,0xB3,0xFF,0xFF,0x00,
-  0x3F,0x00,0x00,0x01,0x22,0x03,0xA8,0x10,0x26,0x00,0x2C,
-  0x00,0x00,0x10,0x07,0x00,0x74,0xFF,0xE5,0x00,0xB3,0xFF,
-  0xFF,0xFF,0xED,0x00,0x00,0x01,0x2B,0x03,0xA8,0x10,0x26,
-  0x00,0x2C,0x00,0x00,0x10,0x07,0x01,0x45,0xFF,0xE5,0x00,
-  0xB3,0xFF,0xFF,0xFF,0xF7,0x00,0x00,0x01,0x1F,0x03,0x9A,
-  0x10,0x26,0x00,0x2C,0x00,0x00,0x10,0x07,0x00,0x69,0xFF,
-  0xE5,0x00,0xB3,0x00,0x02,0x00,0x00,0x00,0x00,0x02,0xA9,
-  0x02,0xD9,0x00,0x18,0x00,0x29,0x00,0x00,0x13,0x23,0x35,
-  0x33,0x11,0x21,0x32,0x17,0x16,0x17,0x16,0x17,0x16,0x17,
-  0x16,0x15,0x14,0x07,0x06,0x07,0x06,0x07,0x06,0x23,0x21,
-  0x13,0x15,0x33,0x32,0x37,0x34,0x37,0x36,0x35,0x34,0x27,
-  0x26,0x27,0x23,0x15,0x33,0x15,0x4D,0x4D,0x4D,0x01,0x1D,
-  0x8F,0x43,0x07,0x06,0x04,0x04,0x4D,0x0A,0x01,0x4B,0x06,
-  0x07,0x3C,0x7F,0x15,0x17,0xFE,0xE3,0x96,0x87,0x5A,0x25,
-  0x02,0x2E,0x2E,0x2B,0x56,0x87,0x96,0x01,0x53,0x50,0x01,
-  0x36,0x3E,0x06,0x07,0x04,0x05,0x61,0x95,0x11,0x11,0x9A,
-  0x6C,0x0A,0x08,0x4B,0x09,0x01,0x01,0x53,0xD6,0x33,0x01,
-  0x02,0x41,0x78,0x79,0x41,0x34,0x02,0xB9,0x50,0x00,0xFF,
-  0xFF,0x00,0x44,0x00,0x00,0x02,0x95,0x03,0xA0,0x10,0x26,
-  0x00,0x31,0x00,0x00,0x10,0x07,0x01,0x4B,0x00,0xCA,0x00,
-  0xB3,0xFF,0xFF,0x00,0x28,0xFF,0xE9,0x02,0xE6,0x03,0xA8,
-  0x10,0x26,0x00,0x32,0x00,0x00,0x10,0x07,0x00,0x43,0x00,
-  0xED,0x00,0xB3,0xFF,0xFF,0x00,0x28,0xFF,0xE9,0x02,0xE6,
-  0x03,0xA8,0x10,0x26,0x00,0x32,0x00,0x00,0x10,0x07,0x00,
-  0x74,0x00,0xD5,0x00,0xB3,0xFF,0xFF,0x00,0x28,0xFF,0xE9,
-  0x02,0xE6,0x03,0xA8,0x10,0x26,0x00,0x32,0x00,0x00,0x10,
-  0x07,0x01,0x45,0x00,0xE0,0x00,0xB3,0xFF,0xFF,0x00,0x28,
-  0xFF,0xE9,0x02,0xE6,0x03,0xA0,0x10,0x26,0x00,0x32,0x00,
-  0x00,0x10,0x07,0x01,0x4B,0x00,0xE6,0x00,0xB3,0xFF,0xFF,
-  0x00,0x28,0xFF,0xE9,0x02,0xE6,0x03,0x9A,0x10,0x26,0x00,
-  0x32,0x00,0x00,0x10,0x07,0x00,0x69,0x00,0xE1,0x00,0xB3,
-  0x00,0x01,0x00,0x4F,0x00,0x12,0x01,0xF9,0x01,0xBC,0x00,
-  0x0B,0x00,0x00,0x01,0x17,0x07,0x17,0x07,0x27,0x07,0x27,
-  0x37,0x27,0x37,0x17,0x01,0xA5,0x54,0x81,0x80,0x54,0x80,
-  0x80,0x54,0x80,0x81,0x54,0x81,0x01,0xBC,0x54,0x81,0x81,
-  0x54,0x81,0x80,0x54,0x80,0x80,0x55,0x81,0x00,0x03,0x00,
-  0x1F,0xFF,0xD9,0x02,0xF3,0x02,0xED,0x00,0x1D,0x00,0x26,
-  0x00,0x2F,0x00,0x00,0x37,0x07,0x27,0x37,0x26,0x35,0x34,
-  0x37,0x36,0x37,0x36,0x33,0x32,0x17,0x16,0x17,0x37,0x17,
-  0x07,0x16,0x17,0x16,0x15,0x14,0x07,0x06,0x07,0x06,0x23,
-  0x22,0x09,0x01,0x16,0x33,0x32,0x37,0x36,0x35,0x34,0x05,
-  0x01,0x26,0x23,0x22,0x07,0x06,0x15,0x14,0xA5,0x53,0x33,
-  0x56,0x52,0x55,0x09,0x09,0x5E,0x9C,0x83,0x5B,0x05,0x05,
-  0x53,0x34,0x59,0x43,0x06,0x01,0x4F,0x0B,0x0D,0x5E,0x9B,
-  0x88,0x01,0x3B,0xFE,0xC9,0x32,0x52,0x6D,0x37,0x26,0xFE,
-  0x88,0x01,0x3A,0x37,0x55,0x70,0x37,0x24,0x34,0x5B,0x2E,
-  0x5F,0x6E,0x93,0x9A,0x6A,0x0B,0x0A,0x65,0x4C,0x04,0x04,
-  0x5C,0x2D,0x63,0x5C,0x86,0x0B,0x0B,0x91,0x69,0x10,0x0D,
-  0x65,0x02,0x08,0xFE,0xA8,0x30,0x60,0x41,0x5F,0x4B,0xE3,
-  0x01,0x5A,0x3A,0x63,0x41,0x5D,0x53,0x00,0xFF,0xFF,0x00,
-  0x4C,0xFF,0xE9,0x02,0x8E,0x03,0xA8,0x10,0x26,0x00,0x38,
-  0x00,0x00,0x10,0x07,0x00,0x43,0x00,0xD3,0x00,0xB3,0xFF,
-  0xFF,0x00,0x4C,0xFF,0xE9,0x02,0x8E,0x03,0xA8,0x10,0x26,
-  0x00,0x38,0x00,0x00,0x10,0x07,0x00,0x74,0x00,0xBB,0x00,
-  0xB3,0xFF,0xFF,0x00,0x4C,0xFF,0xE9,0x02,0x8E,0x03,0xA8,
-  0x10,0x26,0x00,0x38,0x00,0x00,0x10,0x07,0x01,0x45,0x00,
-  0xC6,0x00,0xB3,0xFF,0xFF,0x00,0x4C,0xFF,0xE9,0x02,0x8E,
-  0x03,0x9A,0x10,0x26,0x00,0x38,0x00,0x00,0x10,0x07,0x00,
-  0x69,0x00,0xC7,0x00,0xB3,0xFF,0xFF,0x00,0x1B,0x00,0x00,
-  0x02,0x8A,0x03,0xA8,0x10,0x26,0x00,0x3C,0x00,0x00,0x10,
-  0x07,0x00,0x74,0x00,0xA2,0x00,0xB3,0x00,0x02,0x00,0x4C,
-  0x00,0x00,0x02,0x79,0x02,0xD9,0x00,0x0E,0x00,0x19,0x00,
-  0x00,0x37,0x15,0x23,0x11,0x33,0x15,0x33,0x32,0x17,0x16,
-  0x15,0x14,0x07,0x06,0x23,0x27,0x33,0x32,0x37,0x36,0x35,
-  0x34,0x27,0x26,0x2B,0x01,0xE2,0x96,0x96,0xAC,0x72,0x3B,
-  0x3E,0x5D,0x35,0x4A,0xBB,0x8C,0x6D,0x07,0x01,0x5E,0x0B,
-  0x0C,0x8C,0x8C,0x8C,0x02,0xD9,0x78,0x38,0x3D,0x6E,0x8F,
-  0x3F,0x24,0x7D,0x5E,0x07,0x08,0x63,0x0A,0x01,0x00,0x00,
-  0x01,0x00,0x43,0xFF,0xEF,0x02,0x3F,0x02,0xD9,0x00,0x3B,
-  0x00,0x00,0x01,0x35,0x33,0x36,0x37,0x35,0x34,0x31,0x36,
-  0x37,0x36,0x35,0x34,0x27,0x26,0x23,0x22,0x07,0x15,0x30,
-  0x31,0x06,0x15,0x11,0x23,0x11,0x34,0x37,0x36,0x37,0x32,
-  0x17,0x16,0x15,0x14,0x07,0x16,0x17,0x16,0x17,0x14,0x15,
-  0x14,0x07,0x06,0x23,0x22,0x27,0x35,0x36,0x33,0x37,0x36,
-  0x37,0x36,0x35,0x34,0x27,0x26,0x27,0x01,0x1D,0x09,0x47,
-  0x15,0x04,0x01,0x01,0x3E,0x11,0x13,0x48,0x0D,0x02,0x8C,
-  0x3D,0x45,0x6A,0x7D,0x40,0x28,0x57,0x2E,0x21,0x30,0x03,
-  0x56,0x37,0x4D,0x17,0x31,0x06,0x07,0x14,0x46,0x1F,0x10,
-  0x49,0x21,0x1F,0x01,0x5D,0x5F,0x01,0x35,0x01,0x01,0x09,
-  0x0A,0x07,0x07,0x3F,0x10,0x04,0x3A,0x01,0x09,0x0B,0xFD,
-  0xE7,0x02,0x06,0x70,0x31,0x2F,0x03,0x49,0x2E,0x3F,0x66,
-  0x22,0x09,0x1F,0x2F,0x4D,0x05,0x06,0x8C,0x45,0x2C,0x06,
-  0x70,0x01,0x01,0x01,0x39,0x1D,0x24,0x53,0x1D,0x0A,0x01,
-  0xFF,0xFF,0x00,0x1C,0xFF,0xE9,0x02,0x0C,0x02,0xF5,0x10,
-  0x26,0x00,0x44,0x00,0x00,0x10,0x06,0x00,0x43,0x73,0x00,
-  0xFF,0xFF,0x00,0x1C,0xFF,0xE9,0x02,0x0C,0x02,0xF5,0x10,
-  0x26,0x00,0x44,0x00,0x00,0x10,0x06,0x00,0x74,0x5E,0x00,
-  0xFF,0xFF,0x00,0x1C,0xFF,0xE9,0x02,0x0C,0x02,0xF5,0x10,
-  0x26,0x00,0x44,0x00,0x00,0x10,0x06,0x01,0x45,0x69,0x00,
-  0xFF,0xFF,0x00,0x1C,0xFF,0xE9,0x02,0x0C,0x02,0xED,0x10,
-  0x26,0x00,0x44,0x00,0x00,0x10,0x06,0x01,0x4B,0x68,0x00,
-  0xFF,0xFF,0x00,0x1C,0xFF,0xE9,0x02,0x0C,0x02,0xE7,0x10,
-  0x26,0x00,0x44,0x00,0x00,0x10,0x06,0x00,0x69,0x6A,0x00,
-  0xFF,0xFF,0x00,0x1C,0xFF,0xE9,0x02,0x0C,0x03,0x02,0x10,
-  0x26,0x00,0x44,0x00,0x00,0x10,0x06,0x01,0x49,0x69,0x00,
-  0x00,0x03,0x00,0x1B,0xFF,0xE8,0x03,0x59,0x02,0x25,0x00,
-  0x38,0x00,0x46,0x00,0x4B,0x00,0x00,0x25,0x33,0x06,0x07,
-  0x06,0x23,0x22,0x27,0x06,0x07,0x06,0x23,0x22,0x27,0x26,
-  0x35,0x34,0x37,0x36,0x3F,0x01,0x36,0x37,0x36,0x37,0x36,
-  0x35,0x34,0x23,0x22,0x07,0x06,0x07,0x23,0x36,0x33,0x32,
-  0x17,0x36,0x33,0x32,0x17,0x33,0x16,0x17,0x16,0x15,0x14,
-  0x07,0x21,0x14,0x17,0x16,0x33,0x32,0x37,0x36,0x25,0x35,
-  0x06,0x0F,0x01,0x06,0x15,0x14,0x17,0x16,0x33,0x32,0x37,
-  0x36,0x37,0x33,0x26,0x23,0x22,0x02,0xC8,0x8A,0x1E,0x63,
-  0x37,0x42,0x88,0x40,0x53,0x66,0x0A,0x0A,0x69,0x2A,0x15,
-  0x8D,0x09,0x09,0x38,0x44,0x0F,0x01,0x04,0x18,0x55,0x44,
-  0x12,0x06,0x03,0x83,0x03,0xE1,0x75,0x3A,0x3E,0x5D,0x86,
-  0x46,0x01,0x12,0x0C,0x15,0x01,0xFE,0x96,0x14,0x20,0x3E,
-  0x39,0x20,0x0B,0xFE,0x9E,0x16,0x25,0x30,0x50,0x32,0x0F,
-  0x0B,0x5F,0x0E,0x02,0x8D,0xD8,0x0B,0x62,0x62,0x98,0x67,
-  0x2E,0x1A,0x68,0x61,0x07,0x01,0x4D,0x26,0x32,0x88,0x1F,
-  0x02,0x02,0x0A,0x0B,0x07,0x01,0x02,0x0D,0x1B,0x35,0x27,
-  0x0E,0x15,0xBB,0x32,0x32,0x63,0x1A,0x20,0x3C,0x52,0x0C,
-  0x0C,0x3E,0x1F,0x31,0x29,0x0D,0x4E,0x26,0x0D,0x06,0x07,
-  0x0B,0x3E,0x33,0x0C,0x03,0x60,0x0F,0x77,0x7B,0x00,0x01,
-  0x00,0x22,0xFF,0x24,0x02,0x0A,0x02,0x25,0x00,0x42,0x00,
-  0x00,0x05,0x07,0x36,0x33,0x32,0x17,0x16,0x15,0x14,0x07,
-  0x06,0x23,0x22,0x27,0x37,0x16,0x33,0x32,0x37,0x36,0x35,
-  0x34,0x27,0x23,0x31,0x23,0x26,0x23,0x22,0x07,0x37,0x26,
-  0x27,0x26,0x35,0x34,0x37,0x36,0x33,0x32,0x17,0x16,0x17,
-  0x16,0x17,0x23,0x26,0x2F,0x01,0x26,0x23,0x22,0x07,0x06,
-  0x15,0x14,0x17,0x16,0x17,0x32,0x37,0x36,0x37,0x33,0x06,
-  0x07,0x06,0x01,0x23,0x11,0x12,0x17,0x3D,0x0D,0x03,0x5A,
-  0x12,0x15,0x3A,0x50,0x13,0x43,0x25,0x28,0x0E,0x04,0x1F,
-  0x01,0x01,0x08,0x0A,0x19,0x19,0x2B,0x9C,0x2B,0x0F,0x77,
-  0x39,0x4F,0x8A,0x3D,0x13,0x09,0x04,0x02,0x86,0x11,0x2C,
-  0x01,0x10,0x16,0x3E,0x19,0x1B,0x26,0x1A,0x33,0x3F,0x19,
-  0x06,0x05,0x86,0x0A,0x56,0x3A,0x17,0x28,0x07,0x31,0x0A,
-  0x0C,0x4C,0x0E,0x03,0x1C,0x34,0x1E,0x1A,0x07,0x08,0x19,
-  0x08,0x02,0x0C,0x55,0x14,0x93,0x32,0x3F,0xBB,0x46,0x21,
-  0x62,0x21,0x28,0x13,0x15,0x4D,0x0F,0x01,0x05,0x2E,0x33,
-  0x4F,0x5B,0x2E,0x20,0x01,0x3F,0x0F,0x13,0x70,0x3A,0x29,
-  0x00,0xFF,0xFF,0x00,0x16,0xFF,0xE9,0x02,0x0D,0x02,0xF5,
-  0x10,0x26,0x00,0x48,0x00,0x00,0x10,0x06,0x00,0x43,0x73,
-  0x00,0xFF,0xFF,0x00,0x16,0xFF,0xE9,0x02,0x0D,0x02,0xF5,
-  0x10,0x26,0x00,0x48,0x00,0x00,0x10,0x06,0x00,0x74,0x66,
-  0x00,0xFF,0xFF,0x00,0x16,0xFF,0xE9,0x02,0x0D,0x02,0xF6,
-  0x10,0x26,0x00,0x48,0x00,0x00,0x10,0x06,0x01,0x45,0x71,
-  0x00,0xFF,0xFF,0x00,0x16,0xFF,0xE9,0x02,0x0D,0x02,0xE7,
-  0x10,0x26,0x00,0x48,0x00,0x00,0x10,0x06,0x00,0x69,0x72,
-  0x00,0xFF,0xFF,0xFF,0xF6,0x00,0x00,0x00,0xCF,0x02,0xF5,
-  0x10,0x26,0x00,0xF1,0x00,0x00,0x10,0x06,0x00,0x43,0xE5,
-  0x00,0xFF,0xFF,0x00,0x43,0x00,0x00,0x01,0x22,0x02,0xF5,
-  0x10,0x26,0x00,0xF1,0x00,0x00,0x10,0x06,0x00,0x74,0xE5,
-  0x00,0xFF,0xFF,0xFF,0xED,0x00,0x00,0x01,0x2B,0x02,0xF5,
-  0x10,0x26,0x00,0xF1,0x00,0x00,0x10,0x06,0x01,0x45,0xE5,
-  0x00,0xFF,0xFF,0xFF,0xF7,0x00,0x00,0x01,0x1F,0x02,0xE7,
-  0x10,0x26,0x00,0xF1,0x00,0x00,0x10,0x06,0x00,0x69,0xE5,
-  0x00,0x00,0x02,0x00,0x23,0xFF,0xE9,0x02,0x39,0x02,0xE8,
-  0x00,0x20,0x00,0x30,0x00,0x00,0x01,0x07,0x16,0x17,0x16,
-  0x15,0x14,0x07,0x06,0x23,0x22,0x27,0x26,0x35,0x34,0x37,
-  0x36,0x33,0x32,0x17,0x26,0x27,0x07,0x27,0x37,0x26,0x27,
-  0x37,0x16,0x17,0x16,0x17,0x37,0x03,0x22,0x07,0x06,0x15,
-  0x14,0x17,0x16,0x33,0x32,0x37,0x36,0x35,0x34,0x27,0x26,
-  0x01,0xB0,0x54,0xBC,0x1C,0x05,0x75,0x3E,0x58,0x9E,0x45,
-  0x28,0x71,0x3C,0x42,0x24,0x31,0x28,0x37,0x4D,0x2A,0x46,
-  0x26,0x34,0x43,0x23,0x34,0x02,0x0D,0x57,0x4F,0x4B,0x21,
-  0x12,0x3F,0x1C,0x23,0x4A,0x22,0x12,0x40,0x1B,0x02,0xC6,
-  0x32,0x7F,0xBC,0x24,0x28,0xB5,0x49,0x26,0x76,0x45,0x65,
-  0xA5,0x43,0x25,0x13,0x40,0x20,0x2E,0x25,0x2C,0x17,0x19,
-  0x2F,0x0D,0x1D,0x02,0x05,0x34,0xFE,0xC5,0x4B,0x28,0x36,
-  0x6D,0x2A,0x13,0x4A,0x28,0x35,0x70,0x2A,0x12,0x00,0xFF,
-  0xFF,0x00,0x3F,0x00,0x00,0x02,0x22,0x02,0xED,0x10,0x26,
-  0x00,0x51,0x00,0x00,0x10,0x07,0x01,0x4B,0x00,0x85,0x00,
-  0x00,0xFF,0xFF,0x00,0x23,0xFF,0xE9,0x02,0x39,0x02,0xF5,
-  0x10,0x26,0x00,0x52,0x00,0x00,0x10,0x07,0x00,0x43,0x00,
-  0x94,0x00,0x00,0xFF,0xFF,0x00,0x23,0xFF,0xE9,0x02,0x39,
-  0x02,0xF5,0x10,0x26,0x00,0x52,0x00,0x00,0x10,0x06,0x00,
-  0x74,0x7C,0x00,0xFF,0xFF,0x00,0x23,0xFF,0xE9,0x02,0x39,
-  0x02,0xF5,0x10,0x26,0x00,0x52,0x00,0x00,0x10,0x07,0x01,
-  0x45,0x00,0x87,0x00,0x00,0xFF,0xFF,0x00,0x23,0xFF,0xE9,
-  0x02,0x39,0x02,0xED,0x10,0x26,0x00,0x52,0x00,0x00,0x10,
-  0x07,0x01,0x4B,0x00,0x89,0x00,0x00,0xFF,0xFF,0x00,0x23,
-  0xFF,0xE9,0x02,0x39,0x02,0xE7,0x10,0x26,0x00,0x52,0x00,
-  0x00,0x10,0x07,0x00,0x69,0x00,0x88,0x00,0x00,0x00,0x03,
-  0x00,0x32,0xFF,0xF5,0x02,0x16,0x01,0xDA,0x00,0x03,0x00,
-  0x07,0x00,0x0B,0x00,0x00,0x01,0x15,0x21,0x35,0x37,0x33,
-  0x15,0x23,0x15,0x33,0x15,0x23,0x02,0x16,0xFE,0x1C,0xB4,
-  0x7C,0x7C,0x7C,0x7C,0x01,0x23,0x77,0x77,0xB7,0x7B,0xEF,
-  0x7B,0x00,0x00,0x03,0x00,0x0B,0xFF,0xDA,0x02,0x56,0x02,
-  0x2D,0x00,0x17,0x00,0x20,0x00,0x29,0x00,0x00,0x37,0x07,
-  0x27,0x37,0x26,0x35,0x34,0x37,0x36,0x33,0x32,0x17,0x37,
-  0x17,0x07,0x16,0x15,0x14,0x07,0x06,0x23,0x22,0x27,0x26,
-  0x01,0x07,0x16,0x33,0x32,0x37,0x36,0x35,0x34,0x07,0x37,
-  0x26,0x23,0x22,0x07,0x06,0x15,0x14,0x7E,0x48,0x2B,0x4B,
-  0x32,0x6F,0x41,0x5D,0x6B,0x4B,0x44,0x2B,0x48,0x2F,0x6C,
-  0x41,0x5E,0x69,0x42,0x05,0x01,0x23,0xC9,0x24,0x32,0x44,
-  0x24,0x17,0xF3,0xCA,0x27,0x32,0x46,0x23,0x16,0x23,0x49,
-  0x28,0x4D,0x48,0x70,0xA9,0x4A,0x2B,0x3E,0x46,0x29,0x49,
-  0x49,0x6B,0xA6,0x4B,0x2D,0x32,0x04,0x01,0x31,0xCC,0x2A,
-  0x45,0x2B,0x3A,0x28,0x74,0xCE,0x2F,0x47,0x2B,0x39,0x2E,
-  0xFF,0xFF,0x00,0x3A,0xFF,0xE9,0x02,0x1D,0x02,0xF5,0x10,
-  0x26,0x00,0x58,0x00,0x00,0x10,0x07,0x00,0x43,0x00,0x92,
-  0x00,0x00,0xFF,0xFF,0x00,0x3A,0xFF,0xE9,0x02,0x1D,0x02,
-  0xF5,0x10,0x26,0x00,0x58,0x00,0x00,0x10,0x06,0x00,0x74,
-  0x79,0x00,0xFF,0xFF,0x00,0x3A,0xFF,0xE9,0x02,0x1D,0x02,
-  0xF5,0x10,0x26,0x00,0x58,0x00,0x00,0x10,0x07,0x01,0x45,
-  0x00,0x84,0x00,0x00,0xFF,0xFF,0x00,0x3A,0xFF,0xE9,0x02,
-  0x1D,0x02,0xE7,0x10,0x26,0x00,0x58,0x00,0x00,0x10,0x07,
-  0x00,0x69,0x00,0x84,0x00,0x00,0xFF,0xFF,0x00,0x09,0xFF,
-  0x25,0x02,0x1A,0x02,0xF5,0x10,0x26,0x00,0x5C,0x00,0x00,
-  0x10,0x06,0x00,0x74,0x5E,0x00,0x00,0x02,0x00,0x3A,0xFF,
-  0x26,0x02,0x3E,0x02,0xD9,0x00,0x10,0x00,0x20,0x00,0x00,
-  0x13,0x11,0x36,0x33,0x32,0x17,0x16,0x15,0x14,0x07,0x06,
-  0x23,0x22,0x27,0x11,0x23,0x11,0x01,0x22,0x07,0x06,0x15,
-  0x14,0x17,0x16,0x33,0x32,0x37,0x36,0x35,0x34,0x27,0x26,
-  0xC6,0x32,0x64,0x68,0x42,0x38,0x50,0x3D,0x55,0x64,0x32,
-  0x8C,0x01,0x02,0x43,0x20,0x13,0x3A,0x1B,0x21,0x41,0x21,
-  0x14,0x3B,0x1A,0x02,0xD9,0xFE,0xF3,0x59,0x5C,0x50,0x73,
-  0x8B,0x52,0x40,0x57,0xFE,0xE6,0x03,0xB3,0xFE,0xD7,0x48,
-  0x2A,0x38,0x68,0x2C,0x14,0x44,0x2A,0x38,0x6D,0x2C,0x13,
-  0xFF,0xFF,0x00,0x09,0xFF,0x25,0x02,0x1A,0x02,0xE7,0x10,
-  0x26,0x00,0x5C,0x00,0x00,0x10,0x06,0x00,0x69,0x6B,0x00,
-  0xFF,0xFF,0x00,0x1A,0x00,0x00,0x02,0xBF,0x03,0x82,0x10,
-  0x26,0x00,0x24,0x00,0x00,0x10,0x07,0x00,0x6F,0x00,0xC7,
-  0x00,0xB3,0xFF,0xFF,0x00,0x1C,0xFF,0xE9,0x02,0x0C,0x02,
-  0xCF,0x10,0x26,0x00,0x44,0x00,0x00,0x10,0x06,0x00,0x6F,
-  0x6A,0x00,0xFF,0xFF,0x00,0x1A,0x00,0x00,0x02,0xBF,0x03,
-  0x9F,0x10,0x26,0x00,0x24,0x00,0x00,0x10,0x07,0x01,0x47,
-  0x00,0xC1,0x00,0xB3,0xFF,0xFF,0x00,0x1C,0xFF,0xE9,0x02,
-  0x0C,0x02,0xEC,0x10,0x26,0x00,0x44,0x00,0x00,0x10,0x06,
-  0x01,0x47,0x6C,0x00,0x00,0x02,0x00,0x1A,0xFF,0x17,0x02,
-  0xD3,0x02,0xD9,0x00,0x1B,0x00,0x1E,0x00,0x00,0x25,0x21,
-  0x07,0x23,0x01,0x33,0x13,0x06,0x07,0x06,0x15,0x14,0x33,
-  0x32,0x37,0x15,0x06,0x23,0x22,0x27,0x26,0x35,0x34,0x3F,
-  0x01,0x36,0x37,0x23,0x0B,0x02,0x01,0xF5,0xFE,0xEF,0x31,
-  0x99,0x01,0x03,0xA7,0xFB,0x53,0x18,0x06,0x4C,0x1B,0x1E,
-  0x24,0x27,0x77,0x18,0x05,0x56,0x01,0x11,0x14,0x4B,0x58,
-  0x5F,0x60,0x93,0x93,0x02,0xD9,0xFD,0x27,0x24,0x3C,0x11,
-  0x10,0x35,0x05,0x2F,0x09,0x42,0x0D,0x10,0x4B,0x2E,0x01,
-  0x09,0x07,0x01,0x10,0x01,0x1D,0xFE,0xE3,0x00,0x00,0x02,
-  0x00,0x1C,0xFF,0x17,0x02,0x24,0x02,0x25,0x00,0x36,0x00,
-  0x47,0x00,0x00,0x25,0x15,0x06,0x15,0x14,0x33,0x32,0x37,
-  0x15,0x06,0x23,0x22,0x27,0x26,0x35,0x34,0x37,0x36,0x37,
-  0x36,0x37,0x23,0x26,0x35,0x06,0x23,0x22,0x27,0x26,0x35,
-  0x34,0x3F,0x01,0x36,0x37,0x36,0x37,0x36,0x35,0x34,0x23,
-  0x22,0x07,0x15,0x06,0x07,0x23,0x36,0x37,0x32,0x15,0x11,
-  0x14,0x17,0x16,0x27,0x35,0x06,0x0F,0x01,0x06,0x07,0x15,
-  0x06,0x15,0x14,0x17,0x16,0x33,0x32,0x37,0x36,0x02,0x0C,
-  0x6D,0x4C,0x19,0x20,0x24,0x27,0x73,0x1B,0x06,0x4D,0x12,
-  0x15,0x04,0x04,0x4D,0x10,0x4A,0x5A,0x4D,0x31,0x26,0x9F,
-  0x38,0x44,0x0F,0x01,0x04,0x18,0x51,0x44,0x13,0x09,0x03,
-  0x87,0x0D,0xDA,0xDD,0x1A,0x03,0xA6,0x13,0x28,0x30,0x42,
-  0x0B,0x03,0x31,0x0C,0x0F,0x57,0x13,0x05,0x11,0x11,0x3A,
-  0x47,0x35,0x05,0x2F,0x09,0x3E,0x0F,0x11,0x47,0x2E,0x0B,
-  0x08,0x02,0x01,0x18,0x1E,0x4D,0x33,0x29,0x46,0x8F,0x1B,
-  0x0A,0x0B,0x07,0x01,0x02,0x0D,0x1D,0x36,0x20,0x01,0x0F,
-  0x1A,0xB9,0x02,0xA6,0xFE,0xD4,0x22,0x1A,0x03,0xC5,0x26,
-  0x09,0x08,0x09,0x0E,0x24,0x01,0x09,0x0E,0x31,0x0D,0x03,
-  0x53,0x14,0xFF,0xFF,0x00,0x2C,0xFF,0xE9,0x02,0xAD,0x03,
-  0xA8,0x10,0x26,0x00,0x26,0x00,0x00,0x10,0x07,0x00,0x74,
-  0x00,0xC1,0x00,0xB3,0xFF,0xFF,0x00,0x22,0xFF,0xE9,0x02,
-  0x0A,0x02,0xF5,0x10,0x26,0x00,0x46,0x00,0x00,0x10,0x06,
-  0x00,0x74,0x6F,0x00,0xFF,0xFF,0x00,0x2C,0xFF,0xE9,0x02,
-  0xAD,0x03,0xD3,0x10,0x26,0x00,0x26,0x00,0x00,0x10,0x07,
-  0x01,0x45,0x01,0x0F,0x00,0xDE,0xFF,0xFF,0x00,0x22,0xFF,
-  0xE9,0x02,0x0A,0x03,0x16,0x10,0x26,0x00,0x46,0x00,0x00,
-  0x10,0x07,0x01,0x45,0x00,0x7F,0x00,0x21,0xFF,0xFF,0x00,
-  0x2C,0xFF,0xE9,0x02,0xAD,0x03,0xB7,0x10,0x26,0x00,0x26,
-  0x00,0x00,0x10,0x07,0x01,0x48,0x01,0x0F,0x00,0xD0,0xFF,
-  0xFF,0x00,0x22,0xFF,0xE9,0x02,0x0A,0x02,0xFA,0x10,0x26,
-  0x00,0x46,0x00,0x00,0x10,0x07,0x01,0x48,0x00,0x7F,0x00,
-  0x13,0xFF,0xFF,0x00,0x2C,0xFF,0xE9,0x02,0xAD,0x03,0xA8,
-  0x10,0x26,0x00,0x26,0x00,0x00,0x10,0x07,0x01,0x46,0x00,
-  0xD0,0x00,0xB3,0xFF,0xFF,0x00,0x22,0xFF,0xE9,0x02,0x0A,
-  0x02,0xF5,0x10,0x26,0x00,0x46,0x00,0x00,0x10,0x06,0x01,
-  0x46,0x7A,0x00,0xFF,0xFF,0x00,0x4D,0x00,0x00,0x02,0xA9,
-  0x03,0xA8,0x10,0x26,0x00,0x27,0x00,0x00,0x10,0x07,0x01,
-  0x46,0x00,0xAB,0x00,0xB3,0xFF,0xFF,0x00,0x1D,0xFF,0xE9,
-  0x02,0xD0,0x02,0xD9,0x10,0x26,0x00,0x47,0x00,0x00,0x10,
-  0x07,0x02,0xBE,0x01,0xE6,0x03,0x15,0x00,0x02,0x00,0x00,
-  0x00,0x00,0x02,0xA9,0x02,0xD9,0x00,0x18,0x00,0x29,0x00,
-  0x00,0x13,0x23,0x35,0x33,0x11,0x21,0x32,0x17,0x16,0x17,
-  0x16,0x17,0x16,0x17,0x16,0x15,0x14,0x07,0x06,0x07,0x06,
-  0x07,0x06,0x23,0x21,0x13,0x15,0x33,0x32,0x37,0x34,0x37,
-  0x36,0x35,0x34,0x27,0x26,0x27,0x23,0x15,0x33,0x15,0x4D,
-  0x4D,0x4D,0x01,0x1D,0x8F,0x43,0x07,0x06,0x04,0x04,0x4D,
-  0x0A,0x01,0x4B,0x06,0x07,0x3C,0x7F,0x15,0x17,0xFE,0xE3,
-  0x96,0x87,0x5A,0x25,0x02,0x2E,0x2E,0x2B,0x56,0x87,0x96,
-  0x01,0x53,0x50,0x01,0x36,0x3E,0x06,0x07,0x04,0x05,0x61,
-  0x95,0x11,0x11,0x9A,0x6C,0x0A,0x08,0x4B,0x09,0x01,0x01,
-  0x53,0xD6,0x33,0x01,0x02,0x41,0x78,0x79,0x41,0x34,0x02,
-  0xB9,0x50,0x00,0x00,0x02,0x00,0x1D,0xFF,0xE9,0x02,0x5D,
-  0x02,0xD9,0x00,0x18,0x00,0x28,0x00,0x00,0x01,0x23,0x35,
-  0x33,0x35,0x33,0x15,0x33,0x15,0x23,0x11,0x23,0x35,0x06,
-  0x23,0x22,0x27,0x26,0x35,0x34,0x37,0x36,0x33,0x32,0x17,
-  0x07,0x22,0x07,0x06,0x15,0x14,0x17,0x16,0x33,0x32,0x37,
-  0x36,0x35,0x34,0x27,0x26,0x01,0x95,0x85,0x85,0x8C,0x3C,
-  0x3C,0x8C,0x34,0x61,0x66,0x42,0x3B,0x4F,0x3E,0x56,0x62,
-  0x33,0x76,0x40,0x22,0x14,0x39,0x1B,0x22,0x43,0x20,0x13,
-  0x3B,0x1A,0x02,0x54,0x43,0x42,0x42,0x43,0xFD,0xAC,0x37,
-  0x4E,0x5A,0x50,0x73,0x89,0x54,0x42,0x4F,0x26,0x45,0x2B,
-  0x3A,0x67,0x2C,0x15,0x47,0x29,0x36,0x6D,0x2C,0x13,0x00,
-  0xFF,0xFF,0x00,0x4F,0x00,0x00,0x02,0x70,0x03,0x82,0x10,
-  0x26,0x00,0x28,0x00,0x00,0x10,0x07,0x00,0x6F,0x00,0xB3,
-  0x00,0xB3,0xFF,0xFF,0x00,0x16,0xFF,0xE9,0x02,0x0D,0x02,
-  0xCF,0x10,0x26,0x00,0x48,0x00,0x00,0x10,0x06,0x00,0x6F,
-  0x73,0x00,0xFF,0xFF,0x00,0x4F,0x00,0x00,0x02,0x70,0x03,
-  0xCC,0x10,0x26,0x00,0x28,0x00,0x00,0x10,0x07,0x01,0x47,
-  0x00,0xAF,0x00,0xE0,0xFF,0xFF,0x00,0x16,0xFF,0xE9,0x02,
-  0x0D,0x03,0x0F,0x10,0x26,0x00,0x48,0x00,0x00,0x10,0x06,
-  0x01,0x47,0x5D,0x23,0xFF,0xFF,0x00,0x4F,0x00,0x00,0x02,
-  0x70,0x03,0x9A,0x10,0x26,0x00,0x28,0x00,0x00,0x10,0x07,
-  0x01,0x48,0x00,0xB1,0x00,0xB3,0xFF,0xFF,0x00,0x16,0xFF,
-  0xE9,0x02,0x0D,0x02,0xE7,0x10,0x26,0x00,0x48,0x00,0x00,
-  0x10,0x06,0x01,0x48,0x70,0x00,0x00,0x01,0x00,0x4F,0xFF,
-  0x17,0x02,0x88,0x02,0xD9,0x00,0x1C,0x00,0x00,0x13,0x15,
-  0x21,0x15,0x06,0x15,0x14,0x33,0x32,0x37,0x15,0x06,0x23,
-  0x22,0x27,0x26,0x35,0x34,0x37,0x36,0x37,0x21,0x11,0x21,
-  0x15,0x21,0x15,0x21,0x15,0xE5,0x01,0x8B,0x6D,0x4C,0x1B,
-  0x1E,0x28,0x22,0x79,0x18,0x04,0x70,0x06,0x07,0xFE,0x29,
-  0x02,0x0F,0xFE,0x87,0x01,0x5D,0x01,0x3A,0xBD,0x7D,0x3A,
-  0x47,0x35,0x05,0x2F,0x09,0x43,0x0D,0x0F,0x4E,0x36,0x03,
-  0x03,0x02,0xD9,0x7D,0xA5,0x7D,0x00,0x02,0x00,0x15,0xFF,
-  0x16,0x02,0x0D,0x02,0x25,0x00,0x32,0x00,0x39,0x00,0x00,
-  0x05,0x15,0x06,0x23,0x22,0x27,0x26,0x35,0x34,0x37,0x35,
-  0x33,0x36,0x37,0x06,0x23,0x22,0x27,0x26,0x35,0x34,0x37,
-  0x36,0x33,0x32,0x17,0x16,0x17,0x16,0x15,0x14,0x07,0x21,
-  0x16,0x17,0x16,0x33,0x32,0x37,0x33,0x06,0x07,0x06,0x07,
-  0x06,0x07,0x06,0x15,0x14,0x33,0x32,0x01,0x33,0x26,0x27,
-  0x26,0x23,0x22,0x01,0xDE,0x27,0x28,0x69,0x1E,0x09,0x34,
-  0x01,0x11,0x19,0x2F,0x23,0x8C,0x41,0x2A,0x68,0x3C,0x56,
-  0x7C,0x47,0x18,0x0E,0x15,0x01,0xFE,0x96,0x03,0x11,0x1E,
-  0x3E,0x4D,0x1D,0x8A,0x0E,0x1E,0x0D,0x1B,0x4B,0x0B,0x03,
-  0x4C,0x1D,0xFE,0xE1,0xD8,0x04,0x13,0x1F,0x37,0x5E,0xB1,
-  0x2F,0x0A,0x3B,0x11,0x15,0x31,0x2C,0x01,0x0F,0x11,0x0D,
-  0x6D,0x46,0x65,0xAD,0x4C,0x2C,0x58,0x1F,0x26,0x3C,0x52,
-  0x0C,0x0C,0x44,0x1C,0x2F,0x45,0x31,0x25,0x10,0x1D,0x52,
-  0x2B,0x0D,0x0E,0x34,0x01,0xF6,0x33,0x1B,0x2D,0xFF,0xFF,
-  0x00,0x4F,0x00,0x00,0x02,0x70,0x03,0xA8,0x10,0x26,0x00,
-  0x28,0x00,0x00,0x10,0x07,0x01,0x46,0x00,0xB0,0x00,0xB3,
-  0xFF,0xFF,0x00,0x16,0xFF,0xE9,0x02,0x0D,0x02,0xF5,0x10,
-  0x26,0x00,0x48,0x00,0x00,0x10,0x06,0x01,0x46,0x70,0x00,
-  0xFF,0xFF,0x00,0x2A,0xFF,0xE9,0x02,0xC7,0x03,0xD3,0x10,
-  0x26,0x00,0x2A,0x00,0x00,0x10,0x07,0x01,0x45,0x00,0xD6,
-  0x00,0xDE,0xFF,0xFF,0x00,0x22,0xFF,0x26,0x02,0x1D,0x03,
-  0x16,0x10,0x26,0x00,0x4A,0x00,0x00,0x10,0x07,0x01,0x45,
-  0x00,0xBE,0x00,0x21,0xFF,0xFF,0x00,0x2A,0xFF,0xE9,0x02,
-  0xC7,0x03,0x9F,0x10,0x26,0x00,0x2A,0x00,0x00,0x10,0x07,
-  0x01,0x47,0x00,0xE7,0x00,0xB3,0xFF,0xFF,0x00,0x22,0xFF,
-  0x26,0x02,0x1D,0x02,0xEC,0x10,0x26,0x00,0x4A,0x00,0x00,
-  0x10,0x07,0x01,0x47,0x00,0x8B,0x00,0x00,0xFF,0xFF,0x00,
-  0x2A,0xFF,0xE9,0x02,0xC7,0x03,0xB7,0x10,0x26,0x00,0x2A,
-  0x00,0x00,0x10,0x07,0x01,0x48,0x00,0xD6,0x00,0xD0,0xFF,
-  0xFF,0x00,0x22,0xFF,0x26,0x02,0x1D,0x02,0xFA,0x10,0x26,
-  0x00,0x4A,0x00,0x00,0x10,0x07,0x01,0x48,0x00,0xBE,0x00,
-  0x13,0xFF,0xFF,0x00,0x2A,0xFE,0xCD,0x02,0xC7,0x02,0xE5,
-  0x10,0x26,0x00,0x2A,0x00,0x00,0x10,0x07,0x02,0xBE,0x00,
-  0xDC,0x00,0x00,0xFF,0xFF,0x00,0x22,0xFF,0x26,0x02,0x1D,
-  0x03,0x55,0x10,0x26,0x00,0x4A,0x00,0x00,0x10,0x0F,0x02,
-  0xBE,0x01,0xDD,0x02,0x22,0xC0,0x00,0xFF,0xFF,0x00,0x44,
-  0x00,0x00,0x02,0x91,0x03,0xD3,0x10,0x26,0x00,0x2B,0x00,
-  0x00,0x10,0x07,0x01,0x45,0x00,0xC3,0x00,0xDE,0xFF,0xFF,
-  0x00,0x43,0x00,0x00,0x02,0x1D,0x03,0xD3,0x10,0x26,0x00,
-  0x4B,0x00,0x00,0x10,0x07,0x01,0x45,0x00,0x6D,0x00,0xDE,
-  0x00,0x02,0x00,0x08,0x00,0x00,0x02,0xCD,0x02,0xD9,0x00,
-  0x13,0x00,0x17,0x00,0x00,0x01,0x33,0x15,0x23,0x11,0x23,
-  0x11,0x21,0x11,0x23,0x11,0x23,0x35,0x33,0x35,0x33,0x15,
-  0x21,0x35,0x33,0x07,0x21,0x15,0x21,0x02,0x91,0x3C,0x3C,
-  0x96,0xFE,0xDF,0x96,0x3C,0x3C,0x96,0x01,0x20,0x97,0x97,
-  0xFE,0xE0,0x01,0x20,0x02,0x57,0x43,0xFD,0xEC,0x01,0x4B,
-  0xFE,0xB5,0x02,0x14,0x43,0x82,0x82,0x82,0xC5,0x4C,0x00,
-  0x01,0x00,0x08,0x00,0x00,0x02,0x1D,0x02,0xD9,0x00,0x1D,
-  0x00,0x00,0x13,0x35,0x33,0x15,0x33,0x15,0x23,0x15,0x36,
-  0x33,0x32,0x17,0x16,0x15,0x11,0x23,0x11,0x34,0x27,0x26,
-  0x23,0x22,0x07,0x06,0x15,0x11,0x23,0x11,0x23,0x35,0x43,
-  0x8C,0x86,0x86,0x3A,0x64,0x48,0x31,0x37,0x8C,0x10,0x18,
-  0x2E,0x42,0x1D,0x0D,0x8C,0x3B,0x02,0x97,0x42,0x42,0x43,
-  0x86,0x57,0x29,0x2E,0x64,0xFE,0x96,0x01,0x4A,0x2B,0x18,
-  0x21,0x34,0x18,0x1E,0xFE,0xBC,0x02,0x54,0x43,0x00,0xFF,
-  0xFF,0xFF,0xD9,0x00,0x00,0x01,0x3B,0x03,0xBD,0x10,0x26,
-  0x00,0x2C,0x00,0x00,0x10,0x07,0x01,0x4B,0xFF,0xE2,0x00,
-  0xD0,0xFF,0xFF,0xFF,0xD8,0x00,0x00,0x01,0x3A,0x03,0x00,
-  0x10,0x26,0x00,0xF1,0x00,0x00,0x10,0x06,0x01,0x4B,0xE1,
-  0x13,0xFF,0xFF,0x00,0x02,0x00,0x00,0x01,0x12,0x03,0x82,
-  0x10,0x26,0x00,0x2C,0x00,0x00,0x10,0x47,0x00,0x6F,0xFF,
-  0xF4,0x00,0xB3,0x3A,0x38,0x40,0x00,0xFF,0xFF,0x00,0x07,
-  0x00,0x00,0x01,0x0A,0x02,0xCF,0x10,0x26,0x00,0xF1,0x00,
-  0x00,0x10,0x46,0x00,0x6F,0xFA,0x00,0x37,0x70,0x40,0x00,
-  0xFF,0xFF,0x00,0x06,0x00,0x00,0x01,0x0E,0x03,0xCC,0x10,
-  0x26,0x00,0x2C,0x00,0x00,0x10,0x07,0x01,0x47,0xFF,0xE3,
-  0x00,0xE0,0xFF,0xFF,0x00,0x05,0x00,0x00,0x01,0x0D,0x03,
-  0x0F,0x10,0x26,0x00,0xF1,0x00,0x00,0x10,0x06,0x01,0x47,
-  0xE2,0x23,0x00,0x01,0x00,0x22,0xFF,0x17,0x00,0xED,0x02,
-  0xD9,0x00,0x14,0x00,0x00,0x13,0x11,0x06,0x15,0x14,0x17,
-  0x16,0x33,0x32,0x37,0x15,0x06,0x23,0x22,0x27,0x26,0x35,
-  0x34,0x37,0x23,0x11,0xD5,0x59,0x27,0x0B,0x0D,0x17,0x1B,
-  0x27,0x1F,0x60,0x1C,0x09,0x71,0x54,0x02,0xD9,0xFD,0x27,
-  0x40,0x43,0x24,0x0C,0x03,0x05,0x2F,0x09,0x3A,0x12,0x15,
-  0x4C,0x3C,0x02,0xD9,0x00,0x02,0x00,0x22,0xFF,0x17,0x00,
-  0xE7,0x02,0xD9,0x00,0x14,0x00,0x18,0x00,0x00,0x13,0x11,
-  0x06,0x15,0x14,0x17,0x16,0x33,0x32,0x37,0x15,0x06,0x23,
-  0x22,0x27,0x26,0x35,0x34,0x37,0x23,0x11,0x37,0x15,0x23,
-  0x35,0xCF,0x53,0x16,0x13,0x16,0x0F,0x1D,0x28,0x17,0x63,
-  0x1B,0x08,0x6E,0x4D,0x8C,0x8C,0x02,0x1C,0xFD,0xE4,0x3A,
-  0x46,0x1E,0x0D,0x0B,0x05,0x2F,0x09,0x3B,0x11,0x15,0x47,
-  0x41,0x02,0x1C,0xBD,0x7D,0x7D,0x00,0xFF,0xFF,0x00,0x3F,
-  0x00,0x00,0x00,0xD5,0x03,0x9A,0x10,0x26,0x00,0x2C,0x00,
-  0x00,0x10,0x07,0x01,0x48,0xFF,0xE3,0x00,0xB3,0x00,0x01,
-  0x00,0x43,0x00,0x00,0x00,0xCF,0x02,0x1C,0x00,0x03,0x00,
-  0x00,0x13,0x11,0x23,0x11,0xCF,0x8C,0x02,0x1C,0xFD,0xE4,
-  0x02,0x1C,0xFF,0xFF,0x00,0x3F,0xFF,0xE9,0x02,0xE4,0x02,
-  0xD9,0x10,0x26,0x00,0x2C,0x00,0x00,0x10,0x07,0x00,0x2D,
-  0x00,0xFE,0x00,0x00,0xFF,0xFF,0x00,0x43,0xFF,0x26,0x01,
-  0xA2,0x02,0xD9,0x10,0x26,0x00,0x4C,0x00,0x00,0x10,0x07,
-  0x00,0x4D,0x00,0xD0,0x00,0x00,0xFF,0xFF,0x00,0x18,0xFF,
-  0xE9,0x02,0x3A,0x03,0xD3,0x10,0x26,0x00,0x2D,0x00,0x00,
-  0x10,0x07,0x01,0x45,0x00,0xF4,0x00,0xDE,0x00,0x02,0xFF,
-  0xED,0xFF,0x26,0x01,0x2B,0x03,0x0F,0x00,0x0F,0x00,0x16,
-  0x00,0x00,0x13,0x11,0x14,0x07,0x06,0x23,0x22,0x27,0x35,
-  0x16,0x33,0x32,0x37,0x36,0x35,0x11,0x37,0x33,0x17,0x23,
-  0x27,0x07,0x23,0xD2,0x40,0x18,0x23,0x24,0x2F,0x0D,0x0C,
-  0x24,0x04,0x01,0x13,0x6B,0x67,0x4E,0x52,0x52,0x4C,0x02,
-  0x1C,0xFD,0x86,0x5F,0x15,0x08,0x05,0x70,0x04,0x1C,0x06,
-  0x08,0x02,0x5B,0xF3,0x96,0x64,0x64,0xFF,0xFF,0x00,0x4A,
-  0xFE,0xCD,0x02,0xCD,0x02,0xD9,0x10,0x26,0x00,0x2E,0x00,
-  0x00,0x10,0x07,0x02,0xBE,0x00,0xCB,0x00,0x00,0xFF,0xFF,
-  0x00,0x3B,0xFE,0xCD,0x02,0x24,0x02,0xD9,0x10,0x26,0x00,
-  0x4E,0x00,0x00,0x10,0x06,0x02,0xBE,0x75,0x00,0xFF,0xFF,
-  0x00,0x3C,0x00,0x00,0x02,0x25,0x02,0x1C,0x10,0x06,0x01,
-  0xCD,0x00,0x00,0xFF,0xFF,0x00,0x50,0x00,0x00,0x02,0x43,
-  0x03,0xA8,0x10,0x26,0x00,0x2F,0x00,0x00,0x10,0x07,0x00,
-  0x74,0xFF,0xED,0x00,0xB3,0xFF,0xFF,0x00,0x43,0x00,0x00,
-  0x01,0x16,0x03,0xA8,0x10,0x26,0x00,0x4F,0x00,0x00,0x10,
-  0x07,0x00,0x74,0xFF,0xD9,0x00,0xB3,0xFF,0xFF,0x00,0x50,
-  0xFE,0xCD,0x02,0x43,0x02,0xD9,0x10,0x26,0x00,0x2F,0x00,
-  0x00,0x10,0x07,0x02,0xBE,0x00,0x9D,0x00,0x00,0xFF,0xFF,
-  0x00,0x43,0xFE,0xCD,0x00,0xCF,0x02,0xD9,0x10,0x26,0x00,
-  0x4F,0x00,0x00,0x10,0x06,0x02,0xBE,0xDE,0x00,0xFF,0xFF,
-  0x00,0x50,0x00,0x00,0x02,0x43,0x02,0xD9,0x10,0x26,0x00,
-  0x2F,0x00,0x00,0x10,0x07,0x02,0xBE,0x00,0xDA,0x03,0x15,
-  0xFF,0xFF,0x00,0x43,0x00,0x00,0x01,0x7E,0x02,0xD9,0x10,
-  0x26,0x00,0x4F,0x00,0x00,0x10,0x07,0x02,0xBE,0x00,0x94,
-  0x03,0x14,0xFF,0xFF,0x00,0x50,0x00,0x00,0x02,0x43,0x02,
-  0xD9,0x10,0x26,0x00,0x2F,0x00,0x00,0x10,0x07,0x00,0x77,
-  0x01,0x0F,0x00,0x96,0xFF,0xFF,0x00,0x43,0x00,0x00,0x01,
-  0xBC,0x02,0xD9,0x10,0x26,0x00,0x4F,0x00,0x00,0x10,0x07,
-  0x00,0x77,0x01,0x00,0x00,0x88,0x00,0x01,0x00,0x00,0x00,
-  0x00,0x02,0x55,0x02,0xD9,0x00,0x0D,0x00,0x00,0x13,0x37,
-  0x15,0x07,0x15,0x21,0x15,0x21,0x11,0x07,0x35,0x37,0x11,
-  0x33,0xE6,0xA5,0xA5,0x01,0x6F,0xFD,0xFB,0x50,0x50,0x96,
-  0x01,0xA7,0x70,0x58,0x71,0xD1,0x7D,0x01,0x01,0x38,0x59,
-  0x38,0x01,0x7F,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0xFC,
-  0x02,0xD9,0x00,0x0B,0x00,0x00,0x13,0x37,0x15,0x07,0x11,
-  0x23,0x11,0x07,0x35,0x37,0x11,0x33,0xC4,0x38,0x38,0x8C,
-  0x38,0x38,0x8C,0x01,0xBA,0x28,0x4F,0x28,0xFE,0x95,0x01,
-  0x26,0x28,0x4F,0x28,0x01,0x64,0x00,0xFF,0xFF,0x00,0x44,
-  0x00,0x00,0x02,0x95,0x03,0xA8,0x10,0x26,0x00,0x31,0x00,
-  0x00,0x10,0x07,0x00,0x74,0x00,0xB7,0x00,0xB3,0xFF,0xFF,
-  0x00,0x3F,0x00,0x00,0x02,0x22,0x02,0xF5,0x10,0x26,0x00,
-  0x51,0x00,0x00,0x10,0x06,0x00,0x74,0x7B,0x00,0xFF,0xFF,
-  0x00,0x44,0xFE,0xCD,0x02,0x95,0x02,0xD9,0x10,0x26,0x00,
-  0x31,0x00,0x00,0x10,0x07,0x02,0xBE,0x00,0xBC,0x00,0x00,
-  0xFF,0xFF,0x00,0x3F,0xFE,0xCD,0x02,0x22,0x02,0x25,0x10,
-  0x26,0x00,0x51,0x00,0x00,0x10,0x07,0x02,0xBE,0x00,0x84,
-  0x00,0x00,0xFF,0xFF,0x00,0x44,0x00,0x00,0x02,0x95,0x03,
-  0xA8,0x10,0x26,0x00,0x31,0x00,0x00,0x10,0x07,0x01,0x46,
-  0x00,0xC6,0x00,0xB3,0xFF,0xFF,0x00,0x3F,0x00,0x00,0x02,
-  0x22,0x02,0xF5,0x10,0x26,0x00,0x51,0x00,0x00,0x10,0x07,
-  0x01,0x46,0x00,0x83,0x00,0x00,0x00,0x01,0x00,0x3F,0x00,
-  0x00,0x02,0x22,0x02,0x25,0x00,0x15,0x00,0x00,0x13,0x33,
-  0x15,0x36,0x37,0x32,0x33,0x32,0x17,0x16,0x15,0x11,0x23,
-  0x11,0x34,0x23,0x22,0x07,0x06,0x15,0x11,0x23,0x3F,0x8C,
-  0x37,0x5E,0x06,0x07,0x7F,0x28,0x0E,0x8C,0x5A,0x4A,0x1C,
-  0x0B,0x8C,0x02,0x1C,0x4E,0x52,0x05,0x65,0x26,0x30,0xFE,
-  0x96,0x01,0x4D,0x61,0x38,0x16,0x1C,0xFE,0xBC,0x00,0x00,
-  0x01,0x00,0x44,0x00,0x00,0x02,0x95,0x02,0xD9,0x00,0x09,
-  0x00,0x00,0x21,0x01,0x11,0x23,0x11,0x33,0x01,0x11,0x33,
-  0x11,0x01,0xFF,0xFE,0xDB,0x96,0x9A,0x01,0x21,0x96,0x01,
-  0xF8,0xFE,0x08,0x02,0xD9,0xFE,0x10,0x01,0xF0,0xFD,0x27,
-  0x00,0x00,0x01,0x00,0x3F,0x00,0x00,0x02,0x22,0x02,0x25,
-  0x00,0x15,0x00,0x00,0x13,0x33,0x15,0x36,0x37,0x32,0x33,
-  0x32,0x17,0x16,0x15,0x11,0x23,0x11,0x34,0x23,0x22,0x07,
-  0x06,0x15,0x11,0x23,0x3F,0x8C,0x37,0x5E,0x06,0x07,0x7F,
-  0x28,0x0E,0x8C,0x5A,0x4A,0x1C,0x0B,0x8C,0x02,0x1C,0x4E,
-  0x52,0x05,0x65,0x26,0x30,0xFE,0x96,0x01,0x4D,0x61,0x38,
-  0x16,0x1C,0xFE,0xBC,0x00,0xFF,0xFF,0x00,0x28,0xFF,0xE9,
-  0x02,0xE6,0x03,0x82,0x10,0x26,0x00,0x32,0x00,0x00,0x10,
-  0x07,0x00,0x6F,0x00,0xE1,0x00,0xB3,0xFF,0xFF,0x00,0x23,
-  0xFF,0xE9,0x02,0x39,0x02,0xCF,0x10,0x26,0x00,0x52,0x00,
-  0x00,0x10,0x07,0x00,0x6F,0x00,0x88,0x00,0x00,0xFF,0xFF,
-  0x00,0x28,0xFF,0xE9,0x02,0xE6,0x03,0xCC,0x10,0x26,0x00,
-  0x32,0x00,0x00,0x10,0x07,0x01,0x47,0x00,0xE0,0x00,0xE0,
-  0xFF,0xFF,0x00,0x23,0xFF,0xE9,0x02,0x39,0x03,0x0F,0x10,
-  0x26,0x00,0x52,0x00,0x00,0x10,0x07,0x01,0x47,0x00,0x87,
-  0x00,0x23,0xFF,0xFF,0x00,0x28,0xFF,0xE9,0x02,0xE6,0x03,
-  0xA8,0x10,0x26,0x00,0x32,0x00,0x00,0x10,0x07,0x01,0x4C,
-  0x01,0x35,0x00,0xB3,0xFF,0xFF,0x00,0x23,0xFF,0xE9,0x02,
-  0x39,0x02,0xF5,0x10,0x26,0x00,0x52,0x00,0x00,0x10,0x07,
-  0x01,0x4C,0x00,0xDB,0x00,0x00,0x00,0x02,0x00,0x1C,0xFF,
-  0xE9,0x03,0xCA,0x02,0xE5,0x00,0x1C,0x00,0x2E,0x00,0x00,
-  0x01,0x15,0x21,0x15,0x21,0x35,0x06,0x07,0x06,0x23,0x22,
-  0x27,0x26,0x35,0x34,0x37,0x36,0x33,0x32,0x17,0x16,0x17,
-  0x35,0x21,0x15,0x21,0x15,0x21,0x15,0x05,0x11,0x26,0x27,
-  0x22,0x23,0x22,0x07,0x15,0x06,0x15,0x14,0x17,0x16,0x33,
-  0x32,0x37,0x36,0x02,0x70,0x01,0x5A,0xFE,0x16,0x33,0x35,
-  0x16,0x1D,0x84,0x54,0x51,0x63,0x52,0x78,0x4B,0x35,0x0B,
-  0x0C,0x01,0xD7,0xFE,0xB9,0x01,0x2B,0xFE,0x3F,0x27,0x44,
-  0x05,0x06,0x5F,0x31,0x22,0x4C,0x2B,0x3A,0x4B,0x29,0x02,
-  0x01,0x3A,0xBD,0x7D,0x3B,0x40,0x0D,0x05,0x6F,0x6B,0xA4,
-  0xBA,0x6C,0x58,0x2B,0x09,0x0C,0x34,0x7D,0xA5,0x7D,0x88,
-  0x01,0x6A,0x45,0x04,0x5E,0x01,0x41,0x5E,0x92,0x45,0x27,
-  0x44,0x02,0x00,0x00,0x03,0x00,0x17,0xFF,0xE9,0x03,0x98,
-  0x02,0x25,0x00,0x27,0x00,0x37,0x00,0x42,0x00,0x00,0x25,
-  0x33,0x06,0x07,0x06,0x07,0x06,0x23,0x22,0x27,0x06,0x23,
-  0x22,0x27,0x26,0x35,0x34,0x37,0x36,0x33,0x32,0x17,0x36,
-  0x33,0x32,0x17,0x16,0x17,0x16,0x15,0x14,0x07,0x21,0x16,
-  0x17,0x16,0x17,0x32,0x37,0x36,0x01,0x22,0x07,0x06,0x15,
-  0x14,0x17,0x16,0x33,0x32,0x37,0x36,0x35,0x34,0x27,0x26,
-  0x17,0x33,0x26,0x27,0x26,0x27,0x22,0x07,0x06,0x07,0x06,
-  0x03,0x08,0x8A,0x1F,0x62,0x2F,0x38,0x09,0x09,0x71,0x42,
-  0x4D,0x76,0x9C,0x45,0x2A,0x6E,0x40,0x5D,0x7A,0x49,0x41,
-  0x73,0x80,0x46,0x17,0x0D,0x15,0x01,0xFE,0x96,0x01,0x14,
-  0x1C,0x41,0x3C,0x20,0x09,0xFE,0x1E,0x49,0x22,0x14,0x3D,
-  0x1D,0x25,0x47,0x23,0x15,0x40,0x21,0xEF,0xD7,0x05,0x12,
-  0x23,0x32,0x37,0x1D,0x03,0x03,0x0D,0x98,0x67,0x2E,0x16,
-  0x03,0x01,0x4B,0x4B,0x73,0x46,0x65,0xA9,0x4A,0x2B,0x4C,
-  0x4C,0x5C,0x1D,0x24,0x3D,0x51,0x0C,0x0C,0x3E,0x20,0x2F,
-  0x01,0x2C,0x0B,0x01,0x29,0x4A,0x2A,0x39,0x6A,0x2E,0x15,
-  0x47,0x2B,0x39,0x71,0x2B,0x11,0x73,0x34,0x1A,0x2A,0x03,
-  0x2C,0x05,0x05,0x1A,0x00,0xFF,0xFF,0x00,0x50,0x00,0x00,
-  0x02,0xA5,0x03,0xA8,0x10,0x26,0x00,0x35,0x00,0x00,0x10,
-  0x07,0x00,0x74,0x00,0xB1,0x00,0xB3,0xFF,0xFF,0x00,0x3F,
-  0x00,0x00,0x01,0x72,0x02,0xF5,0x10,0x26,0x00,0x55,0x00,
-  0x00,0x10,0x06,0x00,0x74,0x1F,0x00,0xFF,0xFF,0x00,0x50,
-  0xFE,0xCD,0x02,0xA5,0x02,0xD9,0x10,0x26,0x00,0x35,0x00,
-  0x00,0x10,0x07,0x02,0xBE,0x00,0xCE,0x00,0x00,0xFF,0xFF,
-  0x00,0x3F,0xFE,0xCD,0x01,0x72,0x02,0x25,0x10,0x26,0x00,
-  0x55,0x00,0x00,0x10,0x06,0x02,0xBE,0xDA,0x00,0xFF,0xFF,
-  0x00,0x50,0x00,0x00,0x02,0xA5,0x03,0xA8,0x10,0x26,0x00,
-  0x35,0x00,0x00,0x10,0x07,0x01,0x46,0x00,0xBF,0x00,0xB3,
-  0xFF,0xFF,0x00,0x36,0x00,0x00,0x01,0x75,0x02,0xF5,0x10,
-  0x26,0x00,0x55,0x00,0x00,0x10,0x06,0x01,0x46,0x2D,0x00,
-  0xFF,0xFF,0x00,0x20,0xFF,0xE9,0x02,0x79,0x03,0xA8,0x10,
-  0x26,0x00,0x36,0x00,0x00,0x10,0x07,0x00,0x74,0x00,0x94,
-  0x00,0xB3,0xFF,0xFF,0x00,0x1D,0xFF,0xE9,0x02,0x08,0x02,
-  0xF5,0x10,0x26,0x00,0x56,0x00,0x00,0x10,0x06,0x00,0x74,
-  0x66,0x00,0xFF,0xFF,0x00,0x20,0xFF,0xE9,0x02,0x79,0x03,
-  0xD3,0x10,0x26,0x00,0x36,0x00,0x00,0x10,0x07,0x01,0x45,
-  0x00,0xE6,0x00,0xDE,0xFF,0xFF,0x00,0x1D,0xFF,0xE9,0x02,
-  0x08,0x03,0x16,0x10,0x26,0x00,0x56,0x00,0x00,0x10,0x06,
-  0x01,0x45,0x70,0x21,0x00,0x01,0x00,0x20,0xFF,0x24,0x02,
-  0x79,0x02,0xE5,0x00,0x58,0x00,0x00,0x05,0x07,0x36,0x33,
-  0x32,0x17,0x16,0x15,0x14,0x07,0x06,0x23,0x22,0x27,0x37,
-  0x16,0x33,0x32,0x37,0x36,0x37,0x34,0x27,0x23,0x31,0x23,
-  0x26,0x23,0x22,0x07,0x37,0x26,0x27,0x26,0x27,0x33,0x16,
-  0x17,0x16,0x33,0x32,0x37,0x36,0x35,0x34,0x27,0x26,0x2F,
-  0x01,0x26,0x2F,0x01,0x35,0x30,0x27,0x26,0x35,0x34,0x37,
-  0x36,0x33,0x32,0x17,0x16,0x15,0x23,0x26,0x27,0x26,0x23,
-  0x22,0x07,0x06,0x31,0x06,0x15,0x14,0x17,0x16,0x17,0x33,
-  0x16,0x1F,0x01,0x16,0x17,0x16,0x15,0x14,0x01,0x54,0x11,
-  0x17,0x12,0x3D,0x0D,0x03,0x5A,0x12,0x15,0x39,0x51,0x13,
-  0x44,0x25,0x28,0x0D,0x03,0x01,0x1F,0x01,0x01,0x08,0x0A,
-  0x18,0x19,0x2A,0xD2,0x2B,0x09,0x03,0x92,0x06,0x6F,0x16,
-  0x19,0x6C,0x1E,0x09,0x3A,0x1D,0x32,0x66,0x90,0x28,0x01,
-  0x01,0x13,0x7D,0x3F,0x58,0xA0,0x4B,0x33,0x8C,0x07,0x76,
-  0x0D,0x0F,0x5A,0x1B,0x01,0x08,0x2A,0x17,0x29,0x01,0x0E,
-  0x11,0x72,0x91,0x23,0x0D,0x17,0x27,0x06,0x31,0x0A,0x0C,
-  0x4C,0x0E,0x03,0x1C,0x34,0x1E,0x1A,0x06,0x09,0x19,0x08,
-  0x02,0x0C,0x53,0x16,0x97,0x1F,0x25,0x64,0x12,0x03,0x3C,
-  0x11,0x15,0x3A,0x1A,0x0D,0x09,0x14,0x1B,0x49,0x01,0x01,
-  0x01,0x25,0x38,0x8F,0x36,0x1B,0x53,0x39,0x5E,0x65,0x0C,
-  0x01,0x35,0x01,0x10,0x14,0x2E,0x15,0x0C,0x09,0x04,0x03,
-  0x16,0x1C,0x5B,0x23,0x2E,0xDF,0x00,0x01,0x00,0x1D,0xFF,
-  0x24,0x02,0x08,0x02,0x25,0x00,0x55,0x00,0x00,0x05,0x07,
-  0x36,0x33,0x32,0x17,0x16,0x15,0x14,0x07,0x06,0x23,0x22,
-  0x27,0x26,0x27,0x37,0x16,0x33,0x32,0x37,0x36,0x37,0x34,
-  0x27,0x23,0x31,0x23,0x26,0x23,0x22,0x07,0x37,0x26,0x27,
-  0x26,0x27,0x33,0x16,0x17,0x16,0x33,0x32,0x37,0x36,0x35,
-  0x34,0x27,0x26,0x2F,0x01,0x26,0x27,0x26,0x27,0x26,0x35,
-  0x34,0x37,0x36,0x33,0x32,0x17,0x16,0x17,0x23,0x26,0x23,
-  0x22,0x07,0x14,0x31,0x06,0x15,0x14,0x17,0x33,0x16,0x1F,
-  0x01,0x16,0x15,0x14,0x07,0x06,0x23,0x01,0x1B,0x13,0x15,
-  0x15,0x3C,0x0D,0x03,0x57,0x13,0x16,0x37,0x4E,0x03,0x03,
-  0x13,0x45,0x24,0x28,0x0D,0x03,0x01,0x1F,0x01,0x01,0x08,
-  0x0A,0x18,0x19,0x2B,0x98,0x28,0x10,0x02,0x89,0x08,0x13,
-  0x1D,0x36,0x5A,0x0C,0x02,0x1F,0x07,0x09,0xA7,0x3E,0x17,
-  0x01,0x02,0x1E,0x60,0x34,0x4A,0x98,0x39,0x19,0x01,0x87,
-  0x01,0x64,0x40,0x0E,0x03,0x18,0x01,0x08,0x10,0xB1,0x6A,
-  0x52,0x39,0x50,0x17,0x28,0x07,0x30,0x0B,0x0C,0x4B,0x0F,
-  0x03,0x1A,0x01,0x01,0x34,0x1E,0x1A,0x06,0x09,0x19,0x08,
-  0x02,0x0C,0x54,0x12,0x53,0x20,0x2E,0x24,0x0F,0x13,0x2A,
-  0x05,0x06,0x1A,0x0C,0x03,0x03,0x34,0x14,0x16,0x01,0x02,
-  0x21,0x37,0x6C,0x2E,0x1A,0x5B,0x27,0x35,0x49,0x23,0x01,
-  0x07,0x07,0x16,0x0B,0x04,0x05,0x33,0x1F,0x69,0x60,0x33,
-  0x24,0x00,0xFF,0xFF,0x00,0x20,0xFF,0xE9,0x02,0x79,0x03,
-  0xA8,0x10,0x26,0x00,0x36,0x00,0x00,0x10,0x07,0x01,0x46,
-  0x00,0xA0,0x00,0xB3,0xFF,0xFF,0x00,0x1D,0xFF,0xE9,0x02,
-  0x08,0x02,0xF5,0x10,0x26,0x00,0x56,0x00,0x00,0x10,0x06,
-  0x01,0x46,0x71,0x00,0xFF,0xFF,0x00,0x0E,0xFF,0x24,0x02,
-  0x56,0x02,0xD9,0x10,0x26,0x00,0x37,0x00,0x00,0x10,0x07,
-  0x00,0x78,0x00,0x95,0x00,0x00,0xFF,0xFF,0x00,0x0E,0xFF,
-  0x0D,0x01,0x46,0x02,0xA2,0x10,0x26,0x00,0x57,0x00,0x00,
-  0x10,0x06,0x00,0x78,0x1F,0xE9,0xFF,0xFF,0x00,0x0E,0x00,
-  0x00,0x02,0x56,0x03,0xA8,0x10,0x26,0x00,0x37,0x00,0x00,
-  0x10,0x07,0x01,0x46,0x00,0x8E,0x00,0xB3,0xFF,0xFF,0x00,
-  0x0E,0xFF,0xE9,0x01,0x8E,0x03,0x3C,0x10,0x26,0x00,0x57,
-  0x00,0x00,0x10,0x07,0x02,0xBE,0x00,0xA4,0x03,0x78,0x00,
-  0x01,0x00,0x0E,0x00,0x00,0x02,0x56,0x02,0xD9,0x00,0x07,
-  0x00,0x00,0x01,0x11,0x23,0x11,0x23,0x35,0x21,0x15,0x01,
-  0x81,0x96,0xDD,0x02,0x48,0x02,0x5C,0xFD,0xA4,0x02,0x5C,
-  0x7D,0x7D,0x00,0x01,0x00,0x0E,0xFF,0xE9,0x01,0x2D,0x02,
-  0xA2,0x00,0x16,0x00,0x00,0x01,0x15,0x23,0x11,0x14,0x17,
-  0x33,0x16,0x33,0x32,0x37,0x15,0x06,0x23,0x22,0x35,0x11,
-  0x23,0x35,0x33,0x35,0x33,0x15,0x01,0x2D,0x4E,0x12,0x01,
-  0x09,0x12,0x0B,0x15,0x22,0x2F,0x89,0x45,0x45,0x8C,0x02,
-  0x11,0x5D,0xFE,0xDA,0x2E,0x09,0x04,0x03,0x62,0x0B,0x7F,
-  0x01,0x4C,0x5D,0x91,0x91,0x00,0xFF,0xFF,0x00,0x4C,0xFF,
-  0xE9,0x02,0x8E,0x03,0xBD,0x10,0x26,0x00,0x38,0x00,0x00,
-  0x10,0x07,0x01,0x4B,0x00,0xC5,0x00,0xD0,0xFF,0xFF,0x00,
-  0x3A,0xFF,0xE9,0x02,0x1D,0x03,0x00,0x10,0x26,0x00,0x58,
-  0x00,0x00,0x10,0x07,0x01,0x4B,0x00,0x83,0x00,0x13,0xFF,
-  0xFF,0x00,0x4C,0xFF,0xE9,0x02,0x8E,0x03,0x82,0x10,0x26,
-  0x00,0x38,0x00,0x00,0x10,0x07,0x00,0x6F,0x00,0xC7,0x00,
-  0xB3,0xFF,0xFF,0x00,0x3A,0xFF,0xE9,0x02,0x1D,0x02,0xCF,
-  0x10,0x26,0x00,0x58,0x00,0x00,0x10,0x07,0x00,0x6F,0x00,
-  0x86,0x00,0x00,0xFF,0xFF,0x00,0x4C,0xFF,0xE9,0x02,0x8E,
-  0x03,0xCC,0x10,0x26,0x00,0x38,0x00,0x00,0x10,0x07,0x01,
-  0x47,0x00,0xC6,0x00,0xE0,0xFF,0xFF,0x00,0x3A,0xFF,0xE9,
-  0x02,0x1D,0x03,0x0F,0x10,0x26,0x00,0x58,0x00,0x00,0x10,
-  0x07,0x01,0x47,0x00,0x84,0x00,0x23,0xFF,0xFF,0x00,0x4C,
-  0xFF,0xE9,0x02,0x8E,0x03,0xB5,0x10,0x26,0x00,0x38,0x00,
-  0x00,0x10,0x07,0x01,0x49,0x00,0xC6,0x00,0xB3,0xFF,0xFF,
-  0x00,0x3A,0xFF,0xE9,0x02,0x1D,0x03,0x02,0x10,0x26,0x00,
-  0x58,0x00,0x00,0x10,0x07,0x01,0x49,0x00,0x83,0x00,0x00,
-  0xFF,0xFF,0x00,0x4C,0xFF,0xE9,0x02,0x8E,0x03,0xA8,0x10,
-  0x26,0x00,0x38,0x00,0x00,0x10,0x07,0x01,0x4C,0x01,0x19,
-  0x00,0xB3,0xFF,0xFF,0x00,0x3A,0xFF,0xE9,0x02,0x2F,0x02,
-  0xF5,0x10,0x26,0x00,0x58,0x00,0x00,0x10,0x07,0x01,0x4C,
-  0x00,0xDA,0x00,0x00,0x00,0x01,0x00,0x4C,0xFF,0x16,0x02,
-  0x8E,0x02,0xD9,0x00,0x25,0x00,0x00,0x05,0x15,0x06,0x23,
-  0x22,0x27,0x26,0x35,0x34,0x37,0x33,0x36,0x37,0x06,0x23,
-  0x22,0x27,0x26,0x35,0x11,0x33,0x11,0x16,0x17,0x36,0x37,
-  0x11,0x33,0x11,0x14,0x07,0x06,0x07,0x06,0x15,0x14,0x33,
-  0x32,0x02,0x55,0x27,0x29,0x28,0x24,0x44,0x3B,0x01,0x12,
-  0x1A,0x3B,0x32,0x8B,0x52,0x47,0x96,0x0A,0x81,0x87,0x04,
-  0x96,0x34,0x11,0x3A,0x41,0x4D,0x1D,0xB1,0x2F,0x0A,0x0C,
-  0x16,0x3E,0x36,0x2E,0x0F,0x10,0x10,0x4A,0x40,0x78,0x01,
-  0xEE,0xFE,0x12,0x7E,0x04,0x07,0x7B,0x01,0xEE,0xFE,0x12,
-  0x62,0x44,0x15,0x3D,0x47,0x30,0x33,0x00,0x00,0x01,0x00,
-  0x3A,0xFF,0x17,0x02,0x34,0x02,0x1C,0x00,0x28,0x00,0x00,
-  0x21,0x23,0x35,0x06,0x07,0x22,0x23,0x22,0x27,0x26,0x35,
-  0x11,0x33,0x11,0x14,0x33,0x32,0x37,0x36,0x35,0x11,0x33,
-  0x11,0x06,0x07,0x14,0x33,0x32,0x37,0x15,0x06,0x23,0x22,
-  0x27,0x26,0x35,0x34,0x37,0x36,0x37,0x36,0x01,0xD1,0x40,
-  0x37,0x5E,0x06,0x07,0x7F,0x28,0x0E,0x8C,0x5A,0x49,0x1C,
-  0x0C,0x8C,0x6E,0x01,0x4C,0x1A,0x20,0x24,0x27,0x76,0x19,
-  0x06,0x39,0x0A,0x0C,0x0E,0x40,0x52,0x05,0x65,0x26,0x30,
-  0x01,0x78,0xFE,0xA5,0x61,0x37,0x16,0x1D,0x01,0x52,0xFD,
-  0xE4,0x38,0x49,0x35,0x05,0x2F,0x09,0x40,0x0E,0x11,0x3A,
-  0x2C,0x08,0x07,0x09,0x00,0xFF,0xFF,0x00,0x0D,0x00,0x00,
-  0x03,0xA4,0x03,0xD3,0x10,0x26,0x00,0x3A,0x00,0x00,0x10,
-  0x07,0x01,0x45,0x01,0x31,0x00,0xDE,0xFF,0xFF,0x00,0x05,
-  0x00,0x00,0x02,0xFE,0x03,0x16,0x10,0x26,0x00,0x5A,0x00,
-  0x00,0x10,0x07,0x01,0x45,0x00,0xDA,0x00,0x21,0xFF,0xFF,
-  0x00,0x1B,0x00,0x00,0x02,0x8A,0x03,0xD3,0x10,0x26,0x00,
-  0x3C,0x00,0x00,0x10,0x07,0x01,0x45,0x00,0xAB,0x00,0xDE,
-  0xFF,0xFF,0x00,0x09,0xFF,0x25,0x02,0x1A,0x03,0x16,0x10,
-  0x26,0x00,0x5C,0x00,0x00,0x10,0x06,0x01,0x45,0x6A,0x21,
-  0xFF,0xFF,0x00,0x1B,0x00,0x00,0x02,0x8A,0x03,0x9A,0x10,
-  0x26,0x00,0x3C,0x00,0x00,0x10,0x07,0x00,0x69,0x00,0xB0,
-  0x00,0xB3,0xFF,0xFF,0x00,0x1E,0x00,0x00,0x02,0x42,0x03,
-  0xA8,0x10,0x26,0x00,0x3D,0x00,0x00,0x10,0x07,0x00,0x74,
-  0x00,0x7C,0x00,0xB3,0xFF,0xFF,0x00,0x15,0x00,0x00,0x01,
-  0xD4,0x02,0xF5,0x10,0x26,0x00,0x5D,0x00,0x00,0x10,0x06,
-  0x00,0x74,0x46,0x00,0xFF,0xFF,0x00,0x1E,0x00,0x00,0x02,
-  0x42,0x03,0x9A,0x10,0x26,0x00,0x3D,0x00,0x00,0x10,0x07,
-  0x01,0x48,0x00,0x8C,0x00,0xB3,0xFF,0xFF,0x00,0x15,0x00,
-  0x00,0x01,0xD4,0x02,0xE7,0x10,0x26,0x00,0x5D,0x00,0x00,
-  0x10,0x06,0x01,0x48,0x54,0x00,0xFF,0xFF,0x00,0x1E,0x00,
-  0x00,0x02,0x42,0x03,0xA8,0x10,0x26,0x00,0x3D,0x00,0x00,
-  0x10,0x07,0x01,0x46,0x00,0x8B,0x00,0xB3,0xFF,0xFF,0x00,
-  0x15,0x00,0x00,0x01,0xD4,0x02,0xF5,0x10,0x26,0x00,0x5D,
-  0x00,0x00,0x10,0x06,0x01,0x46,0x53,0x00,0x00,0x01,0x00,
-  0x0E,0x00,0x00,0x01,0x34,0x02,0xD9,0x00,0x0F,0x00,0x00,
-  0x33,0x23,0x11,0x23,0x35,0x33,0x35,0x34,0x33,0x32,0x17,
-  0x15,0x26,0x23,0x22,0x15,0xE6,0x8C,0x4C,0x4C,0x8A,0x29,
-  0x27,0x12,0x16,0x26,0x01,0xB4,0x5D,0x41,0x87,0x03,0x69,
-  0x03,0x2A,0x00,0x00,0x01,0x00,0x15,0xFF,0x24,0x02,0x17,
-  0x02,0xE8,0x00,0x21,0x00,0x00,0x01,0x15,0x23,0x03,0x06,
-  0x07,0x06,0x23,0x22,0x27,0x37,0x16,0x33,0x32,0x37,0x36,
-  0x37,0x13,0x23,0x35,0x33,0x37,0x36,0x37,0x36,0x33,0x32,
-  0x17,0x07,0x26,0x23,0x22,0x0F,0x01,0x01,0xF4,0x89,0x3B,
-  0x13,0x31,0x30,0x4D,0x2F,0x2B,0x18,0x23,0x16,0x23,0x10,
-  0x08,0x06,0x3C,0x7B,0x8A,0x0B,0x1B,0x66,0x19,0x20,0x28,
-  0x38,0x14,0x24,0x13,0x3A,0x12,0x07,0x01,0xE0,0x61,0xFE,
-  0x82,0x7C,0x31,0x30,0x16,0x73,0x15,0x2F,0x17,0x29,0x01,
-  0x78,0x61,0x3B,0xA7,0x1E,0x08,0x11,0x73,0x10,0x6B,0x29,
-  0x00,0xFF,0xFF,0x00,0x20,0xFE,0xCD,0x02,0x79,0x02,0xE5,
-  0x10,0x26,0x00,0x36,0x00,0x00,0x10,0x07,0x02,0xBE,0x00,
-  0xAA,0x00,0x00,0xFF,0xFF,0x00,0x1D,0xFE,0xCD,0x02,0x08,
-  0x02,0x25,0x10,0x26,0x00,0x56,0x00,0x00,0x10,0x06,0x02,
-  0xBE,0x73,0x00,0xFF,0xFF,0x00,0x0E,0xFE,0xCD,0x02,0x56,
-  0x02,0xD9,0x10,0x26,0x00,0x37,0x00,0x00,0x10,0x07,0x02,
-  0xBE,0x00,0x8C,0x00,0x00,0xFF,0xFF,0x00,0x0E,0xFE,0xCD,
-  0x01,0x2D,0x02,0xA2,0x10,0x26,0x00,0x57,0x00,0x00,0x10,
-  0x06,0x02,0xBE,0x0F,0x00,0x00,0x01,0x00,0x08,0x02,0x5F,
-  0x01,0x46,0x02,0xF5,0x00,0x06,0x00,0x00,0x13,0x33,0x17,
-  0x23,0x27,0x07,0x23,0x74,0x6B,0x67,0x4E,0x52,0x52,0x4C,
-  0x02,0xF5,0x96,0x64,0x64,0x00,0x00,0x01,0x00,0x09,0x02,
-  0x5F,0x01,0x47,0x02,0xF5,0x00,0x06,0x00,0x00,0x13,0x23,
-  0x27,0x33,0x17,0x37,0x33,0xDB,0x6B,0x67,0x4E,0x52,0x52,
-  0x4C,0x02,0x5F,0x96,0x61,0x61,0x00,0x00,0x01,0x00,0x23,
-  0x02,0x5D,0x01,0x2B,0x02,0xEC,0x00,0x12,0x00,0x00,0x01,
-  0x15,0x14,0x07,0x06,0x23,0x22,0x27,0x35,0x26,0x3D,0x01,
-  0x33,0x16,0x33,0x32,0x37,0x34,0x37,0x01,0x2B,0x39,0x21,
-  0x2A,0x48,0x26,0x16,0x38,0x09,0x44,0x3D,0x0D,0x01,0x02,
-  0xEC,0x0B,0x47,0x27,0x16,0x39,0x01,0x21,0x2A,0x0A,0x42,
-  0x3B,0x03,0x04,0x00,0x01,0x00,0x70,0x02,0x6D,0x00,0xDE,
-  0x02,0xE7,0x00,0x03,0x00,0x00,0x13,0x15,0x23,0x35,0xDE,
-  0x6E,0x02,0xE7,0x7A,0x7A,0x00,0x02,0x00,0x4D,0x02,0x4E,
-  0x01,0x01,0x03,0x02,0x00,0x11,0x00,0x22,0x00,0x00,0x13,
-  0x32,0x17,0x16,0x15,0x14,0x07,0x06,0x23,0x22,0x2F,0x01,
-  0x35,0x26,0x35,0x34,0x37,0x36,0x17,0x22,0x07,0x06,0x15,
-  0x14,0x17,0x16,0x33,0x32,0x3F,0x01,0x36,0x35,0x34,0x27,
-  0x26,0xA8,0x33,0x1A,0x0C,0x2A,0x16,0x1A,0x33,0x1A,0x01,
-  0x0C,0x2C,0x15,0x1A,0x1D,0x0B,0x03,0x1A,0x08,0x09,0x1A,
-  0x0B,0x01,0x03,0x1A,0x07,0x03,0x02,0x2C,0x15,0x1A,0x31,
-  0x1A,0x0E,0x2B,0x01,0x01,0x15,0x18,0x33,0x1A,0x0D,0x30,
-  0x1B,0x07,0x08,0x1C,0x0B,0x03,0x19,0x01,0x08,0x08,0x1C,
-  0x0B,0x03,0x00,0x00,0x01,0x00,0x2D,0xFF,0x16,0x01,0x0C,
-  0x00,0x00,0x00,0x13,0x00,0x00,0x3B,0x01,0x06,0x07,0x06,
-  0x15,0x14,0x33,0x32,0x37,0x15,0x06,0x23,0x22,0x27,0x26,
-  0x35,0x34,0x37,0x36,0xA9,0x4B,0x52,0x12,0x09,0x4C,0x1E,
-  0x1B,0x27,0x28,0x68,0x1F,0x09,0x51,0x14,0x33,0x25,0x13,
-  0x1A,0x32,0x06,0x2F,0x0A,0x39,0x11,0x15,0x49,0x2E,0x0C,
-  0x00,0x00,0x01,0xFF,0xF7,0x02,0x6D,0x01,0x59,0x02,0xED,
-  0x00,0x17,0x00,0x00,0x01,0x33,0x06,0x23,0x22,0x2F,0x01,
-  0x26,0x23,0x22,0x07,0x06,0x07,0x23,0x36,0x37,0x36,0x33,
-  0x32,0x1F,0x01,0x16,0x33,0x32,0x01,0x1A,0x3F,0x06,0x59,
-  0x18,0x1F,0x47,0x12,0x0C,0x1E,0x08,0x01,0x01,0x3F,0x05,
-  0x3D,0x0D,0x0F,0x14,0x24,0x47,0x0E,0x14,0x20,0x02,0xED,
-  0x7F,0x0C,0x1A,0x06,0x23,0x05,0x05,0x62,0x15,0x05,0x0D,
-  0x19,0x06,0x00,0x02,0xFF,0xD4,0x02,0x62,0x01,0x54,0x02,
-  0xF5,0x00,0x03,0x00,0x07,0x00,0x00,0x13,0x07,0x23,0x37,
-  0x21,0x07,0x23,0x37,0x98,0x7E,0x46,0x46,0x01,0x3A,0x7E,
-  0x46,0x46,0x02,0xF5,0x93,0x93,0x93,0x93,0x00,0x00,0x03,
-  0x00,0x32,0x01,0x93,0x01,0xB2,0x02,0xE9,0x00,0x03,0x00,
-  0x07,0x00,0x0B,0x00,0x00,0x01,0x07,0x23,0x37,0x13,0x23,
-  0x35,0x33,0x07,0x23,0x35,0x33,0x01,0xB2,0x9B,0x7A,0x5A,
-  0x7F,0x8E,0x8E,0xB6,0x8E,0x8E,0x02,0xE9,0xBC,0xBC,0xFE,
-  0xAA,0x96,0x96,0x96,0x00,0x03,0xFF,0xDF,0xFF,0xE7,0x02,
-  0xD5,0x02,0xE5,0x00,0x07,0x00,0x0E,0x00,0x12,0x00,0x00,
-  0x05,0x23,0x27,0x21,0x07,0x23,0x01,0x33,0x07,0x06,0x0F,
-  0x01,0x33,0x2F,0x02,0x07,0x23,0x37,0x02,0xD5,0xA0,0x54,
-  0xFE,0xF7,0x4E,0x9C,0x01,0x27,0x87,0x42,0x04,0x0F,0x41,
-  0xAA,0x3D,0x0B,0x74,0x9B,0x7A,0x5A,0x19,0xDA,0xDA,0x02,
-  0xFE,0xC0,0x10,0x25,0xB1,0xA4,0x1D,0xE3,0xBC,0xBC,0x00,
-  0x01,0x00,0x3B,0x00,0xC9,0x01,0x65,0x01,0xF3,0x00,0x16,
-  0x00,0x00,0x01,0x14,0x07,0x06,0x07,0x06,0x23,0x22,0x27,
-  0x26,0x27,0x26,0x34,0x37,0x36,0x37,0x36,0x33,0x32,0x17,
-  0x16,0x17,0x16,0x01,0x65,0x10,0x13,0x21,0x1F,0x32,0x31,
-  0x1F,0x23,0x12,0x10,0x10,0x11,0x24,0x23,0x2D,0x2E,0x23,
-  0x24,0x10,0x10,0x01,0x5E,0x24,0x23,0x24,0x14,0x16,0x16,
-  0x15,0x23,0x23,0x48,0x23,0x24,0x16,0x14,0x14,0x18,0x22,
-  0x23,0x00,0x00,0x02,0xFF,0xE2,0xFF,0xE7,0x03,0x17,0x02,
-  0xE5,0x00,0x03,0x00,0x0F,0x00,0x00,0x13,0x07,0x23,0x37,
-  0x01,0x21,0x11,0x21,0x15,0x21,0x15,0x21,0x15,0x21,0x15,
-  0x21,0xF7,0x9B,0x7A,0x5A,0x02,0xDB,0xFD,0xB8,0x02,0x38,
-  0xFE,0x58,0x01,0x8C,0xFE,0x74,0x01,0xB8,0x02,0xE3,0xBC,
-  0xBC,0xFD,0x04,0x02,0xFE,0x86,0xAA,0x86,0xC2,0x00,0x02,
-  0xFF,0xDF,0xFF,0xE7,0x03,0x2E,0x02,0xE5,0x00,0x03,0x00,
-  0x0F,0x00,0x00,0x13,0x07,0x23,0x37,0x01,0x23,0x11,0x21,
-  0x11,0x23,0x11,0x33,0x11,0x21,0x11,0x33,0xF4,0x9B,0x7A,
-  0x5A,0x02,0xF5,0x90,0xFE,0xBE,0x90,0x90,0x01,0x42,0x90,
-  0x02,0xE3,0xBC,0xBC,0xFD,0x04,0x01,0x52,0xFE,0xAE,0x02,
-  0xFE,0xFE,0xDA,0x01,0x26,0x00,0x02,0xFF,0xE0,0xFF,0xE9,
-  0x01,0x5D,0x02,0xEB,0x00,0x03,0x00,0x07,0x00,0x00,0x13,
-  0x07,0x23,0x37,0x01,0x23,0x11,0x33,0xF5,0x9B,0x7A,0x5A,
-  0x01,0x23,0x90,0x90,0x02,0xEB,0xBC,0xBC,0xFC,0xFE,0x02,
-  0xFE,0x00,0x03,0xFF,0xD7,0xFF,0xCD,0x03,0x5C,0x02,0xFB,
-  0x00,0x03,0x00,0x12,0x00,0x21,0x00,0x00,0x13,0x07,0x23,
-  0x37,0x01,0x14,0x07,0x06,0x20,0x27,0x26,0x35,0x34,0x37,
-  0x36,0x33,0x32,0x17,0x16,0x07,0x34,0x27,0x26,0x23,0x22,
-  0x07,0x06,0x10,0x17,0x16,0x33,0x32,0x37,0x36,0xEC,0x9B,
-  0x7A,0x5A,0x03,0x2B,0x66,0x66,0xFE,0xBA,0x66,0x66,0x66,
-  0x64,0xA5,0xA5,0x64,0x66,0x92,0x42,0x43,0x58,0x57,0x44,
-  0x42,0x42,0x44,0x57,0x58,0x43,0x42,0x02,0xED,0xBC,0xBC,
-  0xFE,0x79,0xC0,0x6C,0x6D,0x6D,0x6C,0xC0,0xBC,0x6C,0x6D,
-  0x6D,0x6C,0xBE,0x96,0x3F,0x3E,0x3E,0x3F,0xFE,0xD4,0x3F,
-  0x3E,0x3E,0x3F,0x00,0x02,0xFF,0xDE,0xFF,0xE7,0x03,0x9C,
-  0x02,0xE5,0x00,0x03,0x00,0x0E,0x00,0x00,0x13,0x07,0x23,
-  0x37,0x21,0x01,0x11,0x23,0x11,0x01,0x33,0x1F,0x01,0x3F,
-  0x01,0xF3,0x9B,0x7A,0x5A,0x03,0x64,0xFE,0xCB,0x90,0xFE,
-  0xD6,0xAF,0x95,0x34,0x38,0x93,0x02,0xE5,0xBC,0xBC,0xFE,
-  0x43,0xFE,0xBF,0x01,0x41,0x01,0xBD,0xE3,0x55,0x5B,0xDD,
-  0x00,0x00,0x02,0xFF,0xE4,0xFF,0xE7,0x03,0x13,0x02,0xEB,
-  0x00,0x03,0x00,0x2E,0x00,0x00,0x13,0x07,0x23,0x37,0x01,
-  0x21,0x35,0x36,0x37,0x36,0x3D,0x01,0x34,0x27,0x26,0x23,
-  0x22,0x07,0x06,0x15,0x07,0x14,0x17,0x16,0x17,0x15,0x21,
-  0x35,0x33,0x26,0x27,0x26,0x2F,0x01,0x34,0x37,0x36,0x33,
-  0x32,0x17,0x16,0x15,0x14,0x07,0x06,0x07,0x33,0xF9,0x9B,
-  0x7A,0x5A,0x02,0xD5,0xFE,0xBC,0x64,0x2A,0x2A,0x3E,0x3C,
-  0x61,0x5E,0x37,0x3B,0x01,0x28,0x27,0x5D,0xFE,0xC6,0x7A,
-  0x2D,0x1C,0x27,0x02,0x02,0x61,0x61,0x95,0x9E,0x66,0x65,
-  0x2B,0x1C,0x2F,0x76,0x02,0xE9,0xBC,0xBC,0xFC,0xFE,0x79,
-  0x2A,0x45,0x47,0x62,0x08,0x5E,0x4A,0x45,0x46,0x4A,0x66,
-  0x07,0x5D,0x41,0x47,0x2A,0x7A,0x7E,0x28,0x2F,0x48,0x75,
-  0x02,0x93,0x6D,0x70,0x6C,0x6B,0x90,0x7F,0x4A,0x2F,0x27,
-  0xFF,0xFF,0x00,0x1A,0x00,0x00,0x02,0xBF,0x02,0xD9,0x10,
-  0x06,0x00,0x24,0x00,0x00,0xFF,0xFF,0x00,0x52,0x00,0x00,
-  0x02,0x9A,0x02,0xD9,0x10,0x06,0x00,0x25,0x00,0x00,0x00,
-  0x01,0x00,0x39,0x00,0x00,0x02,0x4F,0x02,0xD9,0x00,0x05,
-  0x00,0x00,0x01,0x21,0x11,0x23,0x11,0x21,0x02,0x4F,0xFE,
-  0x7C,0x92,0x02,0x16,0x02,0x53,0xFD,0xAD,0x02,0xD9,0x00,
-  0x00,0x02,0x00,0x00,0x00,0x00,0x02,0xD4,0x02,0xD9,0x00,
-  0x03,0x00,0x06,0x00,0x00,0x31,0x01,0x33,0x01,0x27,0x0B,
-  0x01,0x01,0x19,0x91,0x01,0x2A,0xCF,0xA2,0x98,0x02,0xD9,
-  0xFD,0x27,0x7D,0x01,0xA8,0xFE,0x58,0xFF,0xFF,0x00,0x4F,
-  0x00,0x00,0x02,0x70,0x02,0xD9,0x10,0x06,0x00,0x28,0x00,
-  0x00,0xFF,0xFF,0x00,0x1E,0x00,0x00,0x02,0x42,0x02,0xD9,
-  0x10,0x06,0x00,0x3D,0x00,0x00,0xFF,0xFF,0x00,0x44,0x00,
-  0x00,0x02,0x91,0x02,0xD9,0x10,0x06,0x00,0x2B,0x00,0x00,
-  0x00,0x03,0x00,0x14,0xFF,0xDB,0x02,0xF2,0x02,0xF3,0x00,
-  0x19,0x00,0x2D,0x00,0x31,0x00,0x00,0x01,0x14,0x07,0x06,
-  0x07,0x06,0x23,0x22,0x27,0x26,0x27,0x26,0x35,0x34,0x37,
-  0x36,0x37,0x36,0x37,0x36,0x33,0x32,0x17,0x16,0x17,0x14,
-  0x07,0x34,0x27,0x26,0x27,0x26,0x23,0x22,0x07,0x06,0x15,
-  0x14,0x17,0x16,0x33,0x32,0x37,0x36,0x37,0x36,0x27,0x21,
-  0x35,0x21,0x02,0xF2,0x96,0x0F,0x10,0x53,0x67,0x5B,0x55,
-  0x9C,0x1D,0x06,0x5A,0x06,0x06,0x57,0x94,0x0F,0x0F,0x97,
-  0x65,0x6B,0x08,0x94,0x68,0x0C,0x0D,0x2A,0x30,0x98,0x31,
-  0x14,0x3F,0x37,0x65,0x81,0x3A,0x03,0x03,0x1C,0x1C,0xFE,
-  0x7E,0x01,0x82,0x01,0x66,0xD8,0x6F,0x0A,0x0A,0x30,0x27,
-  0x4D,0xBD,0x27,0x2B,0xB1,0x69,0x07,0x07,0x62,0x0A,0x01,
-  0x5F,0x60,0xB6,0x0C,0x0C,0xA6,0x43,0x08,0x06,0x12,0x8F,
-  0x39,0x4B,0x75,0x45,0x43,0x6B,0x06,0x06,0x39,0x20,0x86,
-  0xFF,0xFF,0x00,0x3F,0x00,0x00,0x00,0xD5,0x02,0xD9,0x10,
-  0x06,0x00,0x2C,0x00,0x00,0xFF,0xFF,0x00,0x4A,0x00,0x00,
-  0x02,0xCD,0x02,0xD9,0x10,0x06,0x00,0x2E,0x00,0x00,0x00,
-  0x01,0xFF,0xE4,0xFF,0xE7,0x02,0xCB,0x02,0xE5,0x00,0x0E,
-  0x00,0x00,0x05,0x23,0x03,0x27,0x26,0x27,0x37,0x06,0x07,
-  0x06,0x07,0x03,0x23,0x01,0x33,0x02,0xCB,0xA0,0xC2,0x23,
-  0x08,0x0A,0x31,0x05,0x0B,0x04,0x14,0xBE,0x9B,0x01,0x27,
-  0x87,0x19,0x01,0xFC,0x5F,0x10,0x29,0x03,0x21,0x27,0x0E,
-  0x38,0xFD,0xF7,0x02,0xFE,0x00,0x00,0x01,0x00,0x27,0xFF,
-  0xE7,0x03,0x05,0x02,0xE5,0x00,0x16,0x00,0x00,0x05,0x23,
-  0x11,0x03,0x23,0x03,0x11,0x23,0x11,0x33,0x13,0x17,0x16,
-  0x17,0x16,0x17,0x16,0x15,0x34,0x27,0x37,0x13,0x33,0x03,
-  0x05,0x8E,0xA5,0x7A,0xA3,0x8E,0xBB,0xAD,0x0E,0x03,0x06,
-  0x02,0x01,0x01,0x0B,0x09,0xB2,0xAB,0x19,0x01,0xDC,0xFE,
-  0x24,0x01,0xE2,0xFE,0x1E,0x02,0xFE,0xFD,0xF6,0x28,0x08,
-  0x12,0x07,0x01,0x02,0x02,0x01,0x37,0x1D,0x02,0x03,0x00,
-  0x00,0x01,0x00,0x1F,0xFF,0xE7,0x02,0x85,0x02,0xE5,0x00,
-  0x09,0x00,0x00,0x05,0x23,0x01,0x11,0x23,0x11,0x33,0x01,
-  0x11,0x33,0x02,0x85,0x87,0xFE,0xAF,0x8E,0x89,0x01,0x51,
-  0x8C,0x19,0x01,0xF8,0xFE,0x08,0x02,0xFE,0xFE,0x08,0x01,
-  0xF8,0x00,0x00,0x03,0x00,0x2D,0xFF,0xE7,0x02,0x75,0x02,
-  0xE5,0x00,0x03,0x00,0x07,0x00,0x0B,0x00,0x00,0x01,0x21,
-  0x35,0x21,0x03,0x21,0x35,0x21,0x13,0x21,0x35,0x21,0x02,
-  0x65,0xFD,0xC8,0x02,0x38,0x38,0xFE,0x3E,0x01,0xC2,0x48,
-  0xFD,0xB8,0x02,0x48,0x02,0x5F,0x86,0xFE,0x48,0x86,0xFE,
-  0x34,0x86,0x00,0x00,0x02,0x00,0x14,0xFF,0xCD,0x02,0xF2,
-  0x02,0xFB,0x00,0x0F,0x00,0x1C,0x00,0x00,0x01,0x14,0x07,
-  0x06,0x23,0x22,0x27,0x26,0x35,0x34,0x37,0x36,0x33,0x32,
-  0x17,0x16,0x07,0x34,0x27,0x26,0x22,0x07,0x06,0x10,0x17,
-  0x16,0x32,0x37,0x36,0x02,0xF2,0x66,0x66,0xA3,0xA5,0x64,
-  0x66,0x66,0x64,0xA5,0xA5,0x64,0x66,0x92,0x42,0x43,0xB0,
-  0x43,0x42,0x42,0x43,0xB0,0x43,0x42,0x01,0x66,0xC0,0x6C,
-  0x6D,0x6D,0x6C,0xC0,0xBC,0x6C,0x6D,0x6D,0x6C,0xBE,0x96,
-  0x3F,0x3E,0x3E,0x3F,0xFE,0xD4,0x3F,0x3E,0x3E,0x3F,0x00,
-  0x00,0x01,0x00,0x37,0xFF,0xE7,0x02,0x99,0x02,0xE5,0x00,
-  0x07,0x00,0x00,0x05,0x23,0x11,0x21,0x11,0x23,0x11,0x21,
-  0x02,0x99,0x90,0xFE,0xBE,0x90,0x02,0x62,0x19,0x02,0x78,
-  0xFD,0x88,0x02,0xFE,0x00,0x00,0x02,0x00,0x35,0xFF,0xE7,
-  0x02,0x89,0x02,0xE5,0x00,0x12,0x00,0x1D,0x00,0x00,0x01,
-  0x14,0x07,0x06,0x07,0x06,0x2B,0x01,0x11,0x23,0x11,0x21,
-  0x32,0x17,0x16,0x17,0x16,0x17,0x16,0x07,0x34,0x27,0x26,
-  0x2B,0x01,0x15,0x33,0x32,0x37,0x36,0x02,0x89,0x1C,0x1D,
-  0x43,0x42,0x67,0x9F,0x90,0x01,0x27,0x52,0x26,0x40,0x29,
-  0x29,0x11,0x12,0x94,0x40,0x1C,0x35,0x9F,0xA1,0x4E,0x23,
-  0x1E,0x01,0xFE,0x46,0x34,0x39,0x21,0x1F,0xFE,0xDC,0x02,
-  0xFE,0x07,0x0C,0x24,0x23,0x2F,0x2D,0x35,0x4D,0x13,0x05,
-  0xCE,0x1B,0x16,0x00,0x00,0x01,0x00,0x0F,0xFF,0xE7,0x02,
-  0x77,0x02,0xE7,0x00,0x10,0x00,0x00,0x05,0x21,0x35,0x13,
-  0x27,0x35,0x21,0x15,0x21,0x16,0x17,0x16,0x1F,0x01,0x03,
-  0x07,0x21,0x02,0x77,0xFD,0x98,0xE5,0xC3,0x02,0x32,0xFE,
-  0x90,0x0C,0x06,0x0C,0x06,0x92,0xD6,0x09,0x01,0xAD,0x19,
-  0x7B,0x01,0x20,0xEF,0x76,0x86,0x10,0x07,0x0E,0x08,0xB2,
-  0xFE,0xF6,0x0B,0x00,0x00,0x01,0x00,0x0E,0xFF,0xE7,0x02,
-  0x78,0x02,0xE5,0x00,0x07,0x00,0x00,0x01,0x23,0x11,0x23,
-  0x11,0x23,0x35,0x21,0x02,0x78,0xEE,0x90,0xEC,0x02,0x6A,
-  0x02,0x5F,0xFD,0x88,0x02,0x78,0x86,0x00,0x01,0xFF,0xDF,
-  0xFF,0xE7,0x02,0xCE,0x02,0xE5,0x00,0x0B,0x00,0x00,0x09,
-  0x01,0x11,0x23,0x11,0x01,0x33,0x17,0x16,0x27,0x3F,0x01,
-  0x02,0xCE,0xFE,0xCB,0x90,0xFE,0xD6,0xAF,0x95,0x36,0x02,
-  0x38,0x93,0x02,0xE5,0xFE,0x43,0xFE,0xBF,0x01,0x41,0x01,
-  0xBD,0xE3,0x59,0x04,0x5B,0xDD,0x00,0x03,0x00,0x04,0xFF,
-  0xE7,0x02,0xC9,0x02,0xE9,0x00,0x15,0x00,0x1E,0x00,0x27,
-  0x00,0x00,0x01,0x14,0x07,0x06,0x07,0x15,0x23,0x35,0x26,
-  0x27,0x26,0x35,0x34,0x37,0x36,0x37,0x35,0x33,0x15,0x16,
-  0x17,0x16,0x07,0x34,0x27,0x26,0x27,0x11,0x36,0x37,0x36,
-  0x05,0x11,0x06,0x07,0x06,0x15,0x14,0x17,0x16,0x02,0xC9,
-  0x5A,0x4E,0x78,0x85,0x78,0x4E,0x5A,0x5A,0x50,0x77,0x83,
-  0x78,0x4E,0x5B,0x8D,0x57,0x1B,0x21,0x60,0x24,0x0F,0xFE,
-  0xE8,0x62,0x22,0x0F,0x30,0x2A,0x01,0x61,0x87,0x55,0x4D,
-  0x07,0x4A,0x4A,0x07,0x4D,0x55,0x87,0x85,0x5A,0x4E,0x08,
-  0x53,0x53,0x08,0x4E,0x5B,0x7F,0x67,0x33,0x10,0x08,0xFE,
-  0x93,0x16,0x54,0x25,0x8F,0x01,0x6D,0x17,0x50,0x22,0x29,
-  0x51,0x33,0x2A,0x00,0x00,0x01,0xFF,0xEB,0xFF,0xE7,0x02,
-  0xE0,0x02,0xE5,0x00,0x26,0x00,0x00,0x05,0x23,0x03,0x27,
-  0x36,0x37,0x34,0x37,0x30,0x07,0x30,0x07,0x06,0x07,0x06,
-  0x07,0x03,0x23,0x09,0x01,0x33,0x17,0x16,0x17,0x16,0x17,
-  0x16,0x15,0x36,0x37,0x36,0x33,0x36,0x37,0x36,0x3F,0x01,
-  0x33,0x01,0x02,0xE0,0xB3,0xBD,0x0A,0x06,0x01,0x01,0x07,
-  0x07,0x02,0x01,0x05,0x01,0xBB,0xB1,0x01,0x29,0xFE,0xFA,
-  0xAD,0x8A,0x06,0x0E,0x0D,0x03,0x02,0x01,0x02,0x02,0x01,
-  0x01,0x01,0x04,0x18,0x98,0xA6,0xFE,0xF1,0x19,0x01,0x0B,
-  0x10,0x09,0x01,0x01,0x01,0x0B,0x0B,0x02,0x02,0x08,0x01,
-  0xFE,0xFC,0x01,0x8F,0x01,0x6F,0xC2,0x09,0x12,0x11,0x06,
-  0x02,0x03,0x01,0x04,0x03,0x01,0x02,0x06,0x20,0xC8,0xFE,
-  0x95,0x00,0x00,0x01,0x00,0x1B,0xFF,0xE5,0x02,0xCF,0x02,
-  0xEA,0x00,0x27,0x00,0x00,0x01,0x14,0x07,0x06,0x07,0x06,
-  0x23,0x33,0x15,0x23,0x35,0x33,0x22,0x27,0x26,0x27,0x26,
-  0x35,0x11,0x17,0x11,0x14,0x1F,0x01,0x33,0x16,0x17,0x16,
-  0x3B,0x01,0x11,0x33,0x11,0x33,0x32,0x37,0x36,0x35,0x11,
-  0x37,0x02,0xCF,0x2D,0x2E,0x48,0x22,0x4E,0x01,0x90,0x01,
-  0x6E,0x34,0x11,0x11,0x4F,0x8C,0x28,0x01,0x01,0x04,0x05,
-  0x1E,0x38,0x01,0x88,0x01,0x66,0x16,0x0D,0x8C,0x01,0x70,
-  0x64,0x3A,0x3D,0x12,0x0A,0x94,0x94,0x1C,0x0A,0x0E,0x41,
-  0x82,0x01,0x7A,0x04,0xFE,0x96,0x51,0x19,0x01,0x03,0x02,
-  0x0E,0x01,0xE9,0xFE,0x17,0x32,0x1B,0x31,0x01,0x6A,0x04,
-  0x00,0x00,0x01,0x00,0x11,0xFF,0xE7,0x02,0xD9,0x02,0xEB,
-  0x00,0x29,0x00,0x00,0x01,0x14,0x07,0x33,0x15,0x21,0x35,
-  0x36,0x37,0x36,0x35,0x34,0x27,0x26,0x23,0x22,0x07,0x06,
-  0x07,0x06,0x15,0x14,0x17,0x16,0x17,0x15,0x21,0x35,0x33,
-  0x26,0x35,0x34,0x37,0x36,0x37,0x36,0x33,0x32,0x17,0x16,
-  0x17,0x16,0x02,0xD9,0x78,0x76,0xFE,0xBC,0x64,0x2A,0x2B,
-  0x3A,0x3D,0x65,0x73,0x3B,0x05,0x05,0x19,0x28,0x27,0x5D,
-  0xFE,0xC6,0x7A,0x75,0x66,0x1A,0x1E,0x50,0x6A,0x76,0x53,
-  0x52,0x29,0x27,0x01,0x72,0xAC,0x61,0x7E,0x79,0x2A,0x45,
-  0x49,0x58,0x68,0x4B,0x4A,0x6C,0x0A,0x0B,0x39,0x46,0x57,
-  0x44,0x49,0x28,0x7A,0x7E,0x66,0xA3,0xA2,0x72,0x1C,0x16,
-  0x37,0x37,0x37,0x57,0x57,0x00,0x00,0x03,0xFF,0xF5,0xFF,
-  0xE7,0x01,0x39,0x03,0x75,0x00,0x03,0x00,0x07,0x00,0x0B,
-  0x00,0x00,0x01,0x23,0x35,0x33,0x07,0x23,0x35,0x33,0x13,
-  0x23,0x11,0x33,0x01,0x39,0x8E,0x8E,0xB6,0x8E,0x8E,0x5C,
-  0x90,0x90,0x02,0xDF,0x96,0x96,0x96,0xFC,0x72,0x02,0xFE,
-  0x00,0x00,0x03,0xFF,0xDF,0xFF,0xE7,0x02,0xCE,0x03,0x75,
-  0x00,0x03,0x00,0x07,0x00,0x13,0x00,0x00,0x01,0x23,0x35,
-  0x33,0x07,0x23,0x35,0x33,0x05,0x01,0x11,0x23,0x11,0x01,
-  0x33,0x17,0x16,0x27,0x3F,0x01,0x01,0xEF,0x8E,0x8E,0xB6,
-  0x8E,0x8E,0x01,0x95,0xFE,0xCB,0x90,0xFE,0xD6,0xAF,0x95,
-  0x36,0x02,0x38,0x93,0x02,0xDF,0x96,0x96,0x96,0x90,0xFE,
-  0x43,0xFE,0xBF,0x01,0x41,0x01,0xBD,0xE3,0x59,0x04,0x5B,
-  0xDD,0x00,0x00,0x03,0x00,0x1B,0xFF,0xDA,0x02,0x65,0x03,
-  0x15,0x00,0x03,0x00,0x11,0x00,0x2F,0x00,0x00,0x01,0x07,
-  0x23,0x37,0x13,0x34,0x27,0x26,0x23,0x22,0x07,0x06,0x15,
-  0x14,0x17,0x16,0x33,0x32,0x17,0x06,0x23,0x22,0x27,0x26,
-  0x35,0x34,0x37,0x36,0x37,0x36,0x37,0x36,0x33,0x16,0x17,
-  0x16,0x17,0x35,0x33,0x11,0x15,0x37,0x17,0x06,0x23,0x22,
-  0x27,0x26,0x02,0x0D,0x94,0x7D,0x5B,0x32,0x1F,0x1C,0x3A,
-  0x3A,0x1C,0x21,0x1F,0x1C,0x3A,0x77,0x1B,0x3B,0x55,0x7B,
-  0x3F,0x3F,0x12,0x12,0x24,0x24,0x2C,0x2B,0x36,0x31,0x21,
-  0x23,0x1C,0x7A,0x22,0x24,0x43,0x2B,0x1A,0x17,0x17,0x03,
-  0x15,0xBA,0xBA,0xFD,0xF1,0x4B,0x31,0x2B,0x27,0x2D,0x57,
-  0x55,0x2B,0x27,0x54,0x2C,0x4A,0x4B,0x96,0x46,0x3A,0x39,
-  0x25,0x24,0x11,0x12,0x02,0x0B,0x0E,0x1A,0x2B,0xFE,0x42,
-  0x06,0x18,0x7A,0x21,0x0E,0x0E,0x00,0x00,0x02,0x00,0x0E,
-  0xFF,0xDD,0x01,0xF9,0x03,0x15,0x00,0x33,0x00,0x37,0x00,
-  0x00,0x25,0x06,0x07,0x06,0x07,0x06,0x23,0x22,0x35,0x34,
-  0x37,0x36,0x37,0x26,0x27,0x26,0x35,0x34,0x37,0x36,0x37,
-  0x33,0x32,0x17,0x16,0x17,0x16,0x17,0x23,0x26,0x27,0x26,
-  0x23,0x22,0x07,0x16,0x17,0x16,0x3B,0x01,0x15,0x23,0x22,
-  0x07,0x06,0x07,0x16,0x33,0x32,0x37,0x36,0x37,0x13,0x07,
-  0x23,0x37,0x01,0xF9,0x0A,0x1E,0x1C,0x35,0x33,0x50,0xEF,
-  0x21,0x10,0x10,0x15,0x0B,0x21,0x3A,0x3B,0x7A,0x09,0x4D,
-  0x30,0x33,0x1C,0x1D,0x0A,0x7F,0x06,0x22,0x21,0x37,0x66,
-  0x02,0x04,0x14,0x17,0x38,0x47,0x47,0x3C,0x13,0x14,0x04,
-  0x02,0x66,0x37,0x21,0x22,0x06,0x67,0x94,0x7D,0x5B,0xA1,
-  0x49,0x2B,0x2B,0x12,0x13,0xAB,0x40,0x22,0x10,0x0B,0x0E,
-  0x0C,0x25,0x3E,0x55,0x2A,0x2B,0x01,0x13,0x14,0x2A,0x2C,
-  0x47,0x2D,0x0F,0x10,0x39,0x22,0x0E,0x11,0x6D,0x10,0x0F,
-  0x22,0x38,0x10,0x0F,0x2D,0x02,0x74,0xBA,0xBA,0x00,0x00,
-  0x02,0xFF,0xFB,0xFF,0x29,0x02,0x0B,0x03,0x15,0x00,0x03,
-  0x00,0x2B,0x00,0x00,0x01,0x07,0x23,0x37,0x03,0x37,0x36,
-  0x37,0x36,0x37,0x36,0x33,0x32,0x17,0x16,0x17,0x16,0x17,
-  0x16,0x15,0x11,0x27,0x11,0x34,0x27,0x26,0x23,0x22,0x15,
-  0x11,0x23,0x11,0x34,0x37,0x36,0x31,0x32,0x07,0x27,0x36,
-  0x33,0x32,0x17,0x16,0x01,0xF9,0x94,0x7D,0x5B,0x98,0x06,
-  0x05,0x16,0x16,0x1E,0x20,0x20,0x39,0x2D,0x2C,0x1B,0x1A,
-  0x03,0x01,0x8A,0x09,0x12,0x38,0x71,0x8A,0x01,0x02,0x01,
-  0x25,0x17,0x37,0x23,0x28,0x1B,0x0B,0x03,0x15,0xBA,0xBA,
-  0xFE,0xD9,0x0B,0x08,0x0C,0x0C,0x09,0x09,0x14,0x14,0x2B,
-  0x29,0x3A,0x07,0x2E,0xFD,0xE9,0x26,0x01,0xED,0x30,0x17,
-  0x2A,0x91,0xFE,0xCB,0x01,0xB7,0x04,0x03,0x05,0x08,0x76,
-  0x14,0x1F,0x0D,0x00,0x02,0x00,0x1F,0xFF,0xDF,0x01,0x49,
-  0x03,0x15,0x00,0x14,0x00,0x18,0x00,0x00,0x05,0x06,0x23,
-  0x22,0x27,0x26,0x35,0x11,0x33,0x11,0x1D,0x01,0x30,0x17,
-  0x16,0x17,0x16,0x3B,0x01,0x36,0x37,0x13,0x07,0x23,0x37,
-  0x01,0x2E,0x4C,0x2E,0x40,0x2C,0x29,0x8A,0x02,0x01,0x0A,
-  0x02,0x05,0x05,0x10,0x2C,0x4B,0x94,0x7D,0x5B,0x01,0x20,
-  0x29,0x29,0x54,0x01,0x9C,0xFE,0x75,0x0D,0x06,0x08,0x0A,
-  0x07,0x02,0x02,0x18,0x02,0x93,0xBA,0xBA,0x00,0x04,0x00,
-  0x0F,0xFF,0xD9,0x01,0xF7,0x03,0x71,0x00,0x03,0x00,0x07,
-  0x00,0x0B,0x00,0x31,0x00,0x00,0x01,0x07,0x23,0x37,0x13,
-  0x23,0x35,0x33,0x07,0x23,0x35,0x33,0x01,0x14,0x07,0x06,
-  0x07,0x06,0x07,0x06,0x23,0x22,0x27,0x26,0x27,0x26,0x27,
-  0x26,0x35,0x11,0x33,0x11,0x14,0x17,0x16,0x17,0x16,0x17,
-  0x16,0x33,0x32,0x37,0x36,0x37,0x36,0x37,0x36,0x35,0x11,
-  0x33,0x01,0xE2,0x9B,0x7A,0x5A,0x7F,0x8E,0x8E,0xB6,0x8E,
-  0x8E,0x01,0x07,0x09,0x08,0x14,0x0F,0x35,0x2C,0x5C,0x64,
-  0x2B,0x34,0x0F,0x14,0x08,0x09,0x8A,0x07,0x08,0x09,0x11,
-  0x0C,0x12,0x24,0x22,0x12,0x0E,0x0E,0x0B,0x07,0x07,0x8A,
-  0x03,0x71,0xBC,0xBC,0xFE,0xAA,0x96,0x96,0x96,0xFE,0x15,
-  0x3E,0x22,0x23,0x20,0x12,0x20,0x18,0x18,0x20,0x12,0x1E,
-  0x25,0x22,0x3E,0x01,0x59,0xFE,0xC9,0x40,0x1D,0x18,0x05,
-  0x0C,0x04,0x07,0x07,0x05,0x0B,0x08,0x15,0x1D,0x40,0x01,
-  0x37,0x00,0x02,0x00,0x1B,0xFF,0xDA,0x02,0x65,0x02,0x2B,
-  0x00,0x09,0x00,0x20,0x00,0x00,0x01,0x34,0x27,0x26,0x23,
-  0x22,0x15,0x14,0x33,0x32,0x17,0x06,0x23,0x22,0x11,0x34,
-  0x37,0x36,0x33,0x16,0x17,0x16,0x17,0x35,0x33,0x11,0x37,
-  0x17,0x06,0x23,0x22,0x27,0x26,0x01,0x89,0x1F,0x1C,0x3A,
-  0x77,0x75,0x77,0x1B,0x3B,0x55,0xF9,0x48,0x47,0x6A,0x59,
-  0x33,0x02,0x03,0x7A,0x22,0x24,0x43,0x2B,0x2C,0x20,0x04,
-  0x01,0x06,0x4B,0x31,0x2B,0xAB,0xA7,0x54,0x2C,0x01,0x2B,
-  0x93,0x4B,0x47,0x03,0x2D,0x02,0x03,0x2B,0xFE,0x3C,0x18,
-  0x7A,0x21,0x24,0x04,0x00,0x02,0x00,0x19,0xFF,0x21,0x02,
-  0x11,0x02,0xF5,0x00,0x1E,0x00,0x3A,0x00,0x00,0x25,0x14,
-  0x07,0x06,0x07,0x06,0x23,0x22,0x27,0x15,0x23,0x11,0x34,
-  0x37,0x36,0x37,0x36,0x33,0x32,0x17,0x30,0x31,0x16,0x17,
-  0x16,0x15,0x06,0x0F,0x02,0x16,0x07,0x34,0x27,0x26,0x2B,
-  0x01,0x35,0x33,0x32,0x37,0x36,0x35,0x34,0x27,0x26,0x23,
-  0x22,0x07,0x06,0x15,0x13,0x16,0x17,0x16,0x33,0x32,0x37,
-  0x36,0x02,0x11,0x56,0x09,0x0B,0x35,0x48,0x56,0x33,0x88,
-  0x28,0x0C,0x10,0x3B,0x62,0x8F,0x37,0x17,0x03,0x01,0x04,
-  0x3C,0x01,0x01,0x78,0x8C,0x1D,0x27,0x45,0x4B,0x43,0x3A,
-  0x19,0x1A,0x34,0x11,0x15,0x33,0x1F,0x14,0x01,0x0A,0x1C,
-  0x1B,0x35,0x41,0x1D,0x0F,0xC8,0x7D,0x43,0x08,0x06,0x21,
-  0x24,0xDC,0x02,0xC9,0x7A,0x3B,0x11,0x10,0x35,0x64,0x29,
-  0x35,0x09,0x0A,0x61,0x32,0x01,0x01,0x32,0x8F,0x3A,0x17,
-  0x1E,0x7C,0x1F,0x20,0x2E,0x3D,0x15,0x07,0x22,0x14,0x5F,
-  0xFE,0xAE,0x1C,0x11,0x12,0x32,0x19,0x00,0x01,0x00,0x00,
-  0xFF,0x21,0x02,0x2F,0x02,0x2B,0x00,0x18,0x00,0x00,0x01,
-  0x03,0x15,0x23,0x35,0x03,0x26,0x27,0x26,0x23,0x22,0x07,
-  0x27,0x34,0x37,0x36,0x37,0x36,0x33,0x32,0x17,0x16,0x1F,
-  0x01,0x13,0x02,0x2F,0xC7,0x88,0x8F,0x0D,0x08,0x02,0x01,
-  0x09,0x27,0x09,0x08,0x08,0x12,0x14,0x0D,0x3B,0x19,0x19,
-  0x14,0x5F,0x7F,0x02,0x1F,0xFD,0xFD,0xFB,0xFA,0x01,0x5A,
-  0x29,0x0D,0x02,0x10,0x68,0x06,0x0B,0x0B,0x04,0x06,0x19,
-  0x1C,0x35,0xF4,0x01,0x52,0x00,0x02,0x00,0x0C,0xFF,0xD7,
-  0x02,0x2A,0x02,0xE7,0x00,0x13,0x00,0x2F,0x00,0x00,0x25,
-  0x34,0x27,0x26,0x27,0x26,0x23,0x22,0x07,0x06,0x07,0x06,
-  0x15,0x14,0x33,0x32,0x37,0x36,0x37,0x36,0x03,0x27,0x35,
-  0x21,0x15,0x23,0x17,0x16,0x17,0x16,0x15,0x14,0x07,0x06,
-  0x07,0x06,0x23,0x22,0x27,0x26,0x35,0x34,0x37,0x36,0x37,
-  0x36,0x37,0x36,0x01,0xA0,0x0D,0x0D,0x1E,0x1C,0x33,0x26,
-  0x1C,0x1E,0x0F,0x12,0x7B,0x36,0x1F,0x1E,0x0D,0x0D,0xD1,
-  0x9F,0x01,0xC0,0xD9,0x71,0x35,0x1A,0x53,0x1D,0x1C,0x42,
-  0x3D,0x5F,0x78,0x49,0x46,0x17,0x18,0x25,0x24,0x2D,0x0F,
-  0xFC,0x2C,0x21,0x22,0x16,0x16,0x14,0x13,0x23,0x24,0x2F,
-  0x9F,0x17,0x16,0x24,0x27,0x01,0x35,0x71,0x6E,0x7A,0x52,
-  0x27,0x1A,0x56,0x8A,0x60,0x40,0x43,0x21,0x1F,0x49,0x47,
-  0x8B,0x4C,0x3A,0x39,0x1F,0x20,0x10,0x05,0x00,0x01,0x00,
-  0x0E,0xFF,0xDD,0x01,0xF9,0x02,0x2D,0x00,0x30,0x00,0x00,
-  0x25,0x06,0x07,0x06,0x07,0x06,0x23,0x22,0x35,0x34,0x37,
-  0x36,0x37,0x26,0x35,0x34,0x37,0x36,0x37,0x33,0x32,0x17,
-  0x16,0x17,0x23,0x26,0x27,0x26,0x23,0x22,0x07,0x16,0x17,
-  0x31,0x16,0x3B,0x01,0x15,0x23,0x22,0x07,0x06,0x07,0x16,
-  0x33,0x32,0x37,0x36,0x37,0x01,0xF9,0x14,0x5E,0x03,0x04,
-  0x33,0x50,0xEF,0x34,0x06,0x07,0x41,0x9E,0x24,0x2D,0x09,
-  0x97,0x35,0x1D,0x0A,0x7F,0x06,0x22,0x21,0x37,0x66,0x02,
-  0x06,0x2E,0x13,0x20,0x47,0x47,0x46,0x13,0x0B,0x03,0x02,
-  0x66,0x37,0x21,0x22,0x06,0xA1,0x8A,0x24,0x02,0x01,0x13,
-  0xAB,0x4A,0x2A,0x04,0x05,0x2A,0x53,0x8B,0x1A,0x05,0x01,
-  0x51,0x2C,0x47,0x2D,0x0F,0x10,0x39,0x32,0x0A,0x05,0x6D,
-  0x1A,0x0E,0x19,0x38,0x10,0x0F,0x2D,0x00,0x01,0x00,0x0D,
-  0xFF,0x1E,0x01,0xD1,0x02,0xE7,0x00,0x24,0x00,0x00,0x05,
-  0x14,0x07,0x27,0x36,0x35,0x34,0x27,0x26,0x23,0x22,0x27,
-  0x26,0x35,0x34,0x37,0x36,0x37,0x23,0x35,0x21,0x15,0x06,
-  0x07,0x06,0x15,0x14,0x17,0x16,0x17,0x26,0x17,0x16,0x17,
-  0x16,0x17,0x16,0x01,0xD1,0x31,0x7C,0x2B,0x0D,0x07,0x15,
-  0x5D,0x64,0x58,0x44,0x34,0x45,0xAD,0x01,0x96,0x93,0x4C,
-  0x39,0x25,0x2B,0x37,0x74,0x8F,0x1A,0x15,0x28,0x17,0x23,
-  0x2A,0x3E,0x7A,0x2E,0x5A,0x1A,0x1C,0x05,0x02,0x41,0x39,
-  0x7F,0x8B,0x74,0x57,0x3B,0x7A,0x64,0x54,0x7D,0x60,0x66,
-  0x3E,0x21,0x22,0x06,0x0C,0x0E,0x03,0x05,0x08,0x17,0x2A,
-  0x00,0x01,0xFF,0xFB,0xFF,0x29,0x02,0x0B,0x02,0x2C,0x00,
-  0x27,0x00,0x00,0x13,0x37,0x36,0x37,0x36,0x37,0x36,0x33,
-  0x32,0x17,0x16,0x17,0x16,0x17,0x16,0x15,0x11,0x27,0x11,
-  0x34,0x27,0x26,0x23,0x22,0x15,0x11,0x23,0x11,0x34,0x37,
-  0x36,0x31,0x32,0x07,0x27,0x36,0x33,0x32,0x17,0x16,0xAB,
-  0x06,0x05,0x16,0x16,0x1E,0x20,0x20,0x39,0x2D,0x2C,0x1B,
-  0x1A,0x03,0x01,0x8A,0x09,0x12,0x38,0x71,0x8A,0x01,0x02,
-  0x01,0x25,0x17,0x37,0x23,0x28,0x1B,0x0B,0x01,0xEE,0x0B,
-  0x08,0x0C,0x0C,0x09,0x09,0x14,0x14,0x2B,0x29,0x3A,0x07,
-  0x2E,0xFD,0xE9,0x26,0x01,0xED,0x30,0x17,0x2A,0x91,0xFE,
-  0xCB,0x01,0xB7,0x04,0x03,0x05,0x08,0x76,0x14,0x1F,0x0D,
-  0x00,0x00,0x03,0x00,0x14,0xFF,0xDB,0x02,0x03,0x02,0xF3,
-  0x00,0x16,0x00,0x1F,0x00,0x28,0x00,0x00,0x01,0x10,0x07,
-  0x06,0x07,0x06,0x23,0x22,0x27,0x26,0x27,0x26,0x35,0x34,
-  0x37,0x36,0x33,0x32,0x17,0x15,0x16,0x17,0x16,0x07,0x26,
-  0x27,0x26,0x23,0x22,0x07,0x06,0x07,0x17,0x23,0x16,0x17,
-  0x16,0x33,0x32,0x37,0x36,0x02,0x03,0x64,0x04,0x07,0x3A,
-  0x4E,0x7F,0x3A,0x22,0x0D,0x10,0x67,0x38,0x59,0x87,0x40,
-  0x10,0x09,0x17,0x86,0x03,0x18,0x17,0x3F,0x36,0x1A,0x1D,
-  0x03,0xE1,0xE1,0x04,0x2B,0x17,0x2A,0x52,0x15,0x07,0x01,
-  0x68,0xFE,0xF3,0x51,0x04,0x05,0x26,0x5B,0x34,0x49,0x44,
-  0x71,0xF5,0x61,0x35,0x7E,0x01,0x1F,0x24,0x53,0x33,0x59,
-  0x3D,0x38,0x32,0x34,0x68,0x7A,0x8B,0x35,0x1A,0x6E,0x27,
-  0x00,0x00,0x01,0x00,0x1F,0xFF,0xDF,0x01,0x2E,0x02,0x21,
-  0x00,0x14,0x00,0x00,0x05,0x06,0x23,0x22,0x27,0x26,0x35,
-  0x11,0x33,0x11,0x1D,0x01,0x30,0x17,0x16,0x17,0x16,0x3B,
-  0x01,0x36,0x37,0x01,0x2E,0x4C,0x2E,0x40,0x2C,0x29,0x8A,
-  0x02,0x01,0x0A,0x02,0x05,0x05,0x10,0x2C,0x01,0x20,0x29,
-  0x29,0x54,0x01,0x9C,0xFE,0x75,0x0D,0x06,0x08,0x0A,0x07,
-  0x02,0x02,0x18,0x00,0x01,0x00,0x29,0xFF,0xE7,0x02,0x1F,
-  0x02,0x1F,0x00,0x0B,0x00,0x00,0x05,0x23,0x27,0x07,0x15,
-  0x23,0x11,0x33,0x15,0x37,0x33,0x07,0x02,0x1F,0xA9,0xA3,
-  0x20,0x8A,0x8A,0xAC,0xBA,0xE3,0x19,0xFC,0x1F,0xDD,0x02,
-  0x38,0xAE,0xAE,0xDC,0x00,0x00,0x01,0xFF,0xFA,0xFF,0xDD,
-  0x02,0x4A,0x02,0xF5,0x00,0x2B,0x00,0x00,0x01,0x03,0x23,
-  0x13,0x27,0x26,0x27,0x26,0x27,0x26,0x23,0x22,0x07,0x22,
-  0x0F,0x01,0x37,0x36,0x33,0x32,0x17,0x16,0x17,0x16,0x17,
-  0x16,0x17,0x26,0x1B,0x01,0x17,0x16,0x33,0x32,0x37,0x17,
-  0x06,0x23,0x22,0x27,0x26,0x2F,0x01,0x26,0x01,0x0F,0x7F,
-  0x96,0xCF,0x04,0x11,0x12,0x07,0x08,0x08,0x13,0x0A,0x23,
-  0x04,0x05,0x1D,0x10,0x32,0x1D,0x3E,0x27,0x05,0x05,0x05,
-  0x06,0x1F,0x19,0x4E,0x63,0x98,0x0D,0x05,0x01,0x09,0x29,
-  0x22,0x46,0x29,0x45,0x16,0x07,0x06,0x58,0x08,0x01,0x4A,
-  0xFE,0x9F,0x02,0x20,0x0D,0x37,0x11,0x06,0x05,0x04,0x07,
-  0x01,0x04,0x81,0x13,0x24,0x05,0x05,0x05,0x07,0x25,0x42,
-  0xCE,0xFE,0xF9,0xFE,0x66,0x1A,0x05,0x16,0x76,0x25,0x40,
-  0x0F,0x0F,0xEC,0x18,0x00,0x01,0x00,0x34,0xFF,0x1F,0x02,
-  0x53,0x02,0x1F,0x00,0x24,0x00,0x00,0x25,0x11,0x33,0x11,
-  0x14,0x17,0x16,0x1F,0x01,0x06,0x07,0x06,0x23,0x22,0x27,
-  0x06,0x07,0x06,0x23,0x22,0x27,0x26,0x27,0x15,0x23,0x11,
-  0x33,0x11,0x14,0x17,0x16,0x33,0x32,0x37,0x36,0x37,0x34,
-  0x01,0x8E,0x88,0x09,0x04,0x0C,0x24,0x21,0x13,0x0F,0x12,
-  0x40,0x18,0x2A,0x45,0x08,0x08,0x33,0x25,0x02,0x0F,0x8A,
-  0x8A,0x40,0x0E,0x1E,0x25,0x1C,0x21,0x02,0xD0,0x01,0x4F,
-  0xFE,0x79,0x21,0x10,0x07,0x05,0x4F,0x17,0x08,0x06,0x2F,
-  0x32,0x06,0x01,0x15,0x01,0x0A,0xDE,0x03,0x00,0xFE,0xB1,
-  0x49,0x25,0x09,0x17,0x1D,0x37,0x06,0x00,0x00,0x01,0xFF,
-  0xEA,0xFF,0xE7,0x02,0x0C,0x02,0x1F,0x00,0x18,0x00,0x00,
-  0x01,0x03,0x23,0x03,0x33,0x13,0x17,0x1E,0x01,0x31,0x34,
-  0x27,0x06,0x0F,0x01,0x15,0x06,0x31,0x30,0x37,0x36,0x37,
-  0x36,0x37,0x13,0x02,0x0C,0xD7,0x74,0xD7,0x92,0x76,0x11,
-  0x01,0x04,0x0D,0x01,0x05,0x05,0x02,0x05,0x01,0x07,0x05,
-  0x04,0x78,0x02,0x1F,0xFD,0xC8,0x02,0x38,0xFE,0xB9,0x34,
-  0x04,0x0C,0x04,0x2B,0x07,0x0E,0x11,0x01,0x06,0x0F,0x02,
-  0x15,0x0E,0x0A,0x01,0x4B,0x00,0x00,0x01,0xFF,0xF7,0xFF,
-  0x1E,0x01,0xD2,0x02,0xE7,0x00,0x40,0x00,0x00,0x05,0x14,
-  0x07,0x27,0x36,0x37,0x36,0x35,0x34,0x27,0x26,0x2B,0x01,
-  0x22,0x27,0x26,0x35,0x36,0x37,0x36,0x37,0x36,0x37,0x26,
-  0x27,0x26,0x35,0x34,0x37,0x30,0x37,0x23,0x35,0x21,0x15,
-  0x23,0x22,0x07,0x06,0x07,0x06,0x15,0x14,0x17,0x16,0x3B,
-  0x01,0x15,0x23,0x22,0x07,0x06,0x15,0x14,0x17,0x16,0x17,
-  0x16,0x33,0x32,0x17,0x33,0x16,0x17,0x16,0x01,0xD2,0x32,
-  0x77,0x26,0x02,0x01,0x04,0x0C,0x35,0x13,0x9D,0x42,0x24,
-  0x07,0x20,0x0A,0x0D,0x18,0x20,0x12,0x0E,0x28,0x1B,0x09,
-  0x3C,0x01,0xA6,0xBF,0x27,0x17,0x04,0x02,0x0D,0x49,0x11,
-  0x31,0x6B,0x87,0x57,0x2B,0x13,0x13,0x17,0x1D,0x22,0x20,
-  0x6D,0x25,0x01,0x14,0x0C,0x19,0x27,0x40,0x7B,0x2D,0x69,
-  0x15,0x01,0x08,0x0E,0x01,0x06,0x58,0x30,0x4E,0x55,0x28,
-  0x0C,0x0C,0x16,0x12,0x0A,0x11,0x2B,0x44,0x35,0x2A,0x0C,
-  0x78,0x78,0x2C,0x06,0x06,0x17,0x1C,0x3A,0x16,0x07,0x72,
-  0x3A,0x17,0x24,0x24,0x14,0x1B,0x08,0x0C,0x13,0x0B,0x12,
-  0x21,0x00,0x02,0x00,0x09,0xFF,0xDB,0x02,0x1F,0x02,0x2B,
-  0x00,0x13,0x00,0x2A,0x00,0x00,0x01,0x14,0x07,0x06,0x07,
-  0x06,0x23,0x22,0x27,0x26,0x27,0x26,0x35,0x34,0x37,0x36,
-  0x33,0x32,0x17,0x16,0x07,0x34,0x27,0x26,0x27,0x26,0x27,
-  0x26,0x22,0x07,0x06,0x07,0x06,0x07,0x06,0x15,0x14,0x17,
-  0x16,0x33,0x32,0x37,0x36,0x02,0x1F,0x22,0x21,0x3E,0x3E,
-  0x4C,0x48,0x3E,0x3E,0x23,0x24,0x4B,0x4C,0x74,0x74,0x4C,
-  0x4B,0x8C,0x09,0x08,0x13,0x0E,0x19,0x16,0x3C,0x16,0x19,
-  0x0E,0x12,0x08,0x0A,0x24,0x21,0x3A,0x38,0x23,0x24,0x01,
-  0x04,0x5E,0x40,0x44,0x24,0x23,0x20,0x22,0x44,0x42,0x61,
-  0x92,0x4B,0x4A,0x4A,0x4B,0x92,0x28,0x23,0x1E,0x19,0x15,
-  0x0B,0x0B,0x0B,0x0B,0x15,0x1A,0x1D,0x25,0x26,0x59,0x2A,
-  0x2A,0x2A,0x2A,0x00,0x01,0x00,0x1C,0xFF,0xE3,0x02,0x87,
-  0x02,0x21,0x00,0x15,0x00,0x00,0x25,0x32,0x37,0x17,0x06,
-  0x23,0x22,0x27,0x26,0x35,0x11,0x23,0x11,0x23,0x11,0x23,
-  0x27,0x21,0x15,0x23,0x11,0x14,0x02,0x39,0x03,0x2C,0x1F,
-  0x49,0x1F,0x56,0x15,0x08,0xBA,0x8F,0x46,0x01,0x02,0x5A,
-  0x40,0x56,0x21,0x78,0x1C,0x45,0x1D,0x2D,0x01,0x37,0xFE,
-  0x3F,0x01,0xC1,0x78,0x78,0xFE,0xCB,0x1A,0x00,0x00,0x02,
-  0x00,0x20,0xFF,0x1F,0x02,0x36,0x02,0x2D,0x00,0x16,0x00,
-  0x26,0x00,0x00,0x01,0x14,0x07,0x06,0x07,0x06,0x07,0x06,
-  0x23,0x22,0x27,0x26,0x27,0x15,0x23,0x11,0x34,0x37,0x36,
-  0x33,0x32,0x17,0x16,0x07,0x34,0x27,0x26,0x23,0x22,0x07,
-  0x06,0x15,0x14,0x17,0x16,0x33,0x32,0x37,0x36,0x02,0x36,
-  0x1A,0x18,0x17,0x16,0x30,0x34,0x4A,0x34,0x2D,0x0B,0x13,
-  0x8A,0x50,0x4D,0x6C,0x78,0x4B,0x4A,0x8C,0x26,0x24,0x37,
-  0x39,0x21,0x25,0x25,0x23,0x37,0x36,0x25,0x26,0x01,0x0E,
-  0x67,0x34,0x30,0x17,0x17,0x1C,0x1C,0x14,0x05,0x0C,0xE3,
-  0x01,0xEF,0x96,0x45,0x44,0x4E,0x4D,0x8A,0x56,0x2B,0x2A,
-  0x29,0x28,0x5C,0x5C,0x28,0x29,0x28,0x2E,0x00,0x01,0xFF,
-  0xFD,0xFF,0x2A,0x02,0x0E,0x02,0x31,0x00,0x2E,0x00,0x00,
-  0x01,0x23,0x34,0x27,0x26,0x23,0x22,0x07,0x06,0x15,0x14,
-  0x17,0x16,0x17,0x16,0x17,0x16,0x17,0x16,0x15,0x14,0x07,
-  0x06,0x07,0x27,0x36,0x37,0x34,0x23,0x27,0x26,0x27,0x26,
-  0x27,0x26,0x27,0x26,0x35,0x34,0x37,0x36,0x37,0x36,0x33,
-  0x32,0x17,0x16,0x02,0x0E,0x8D,0x1C,0x20,0x37,0x4A,0x22,
-  0x13,0x0C,0x17,0x56,0x09,0x5E,0x6E,0x1F,0x11,0x0C,0x09,
-  0x25,0x8C,0x1C,0x17,0x12,0x7A,0x0F,0x0D,0x2A,0x3A,0x2F,
-  0x23,0x1F,0x25,0x43,0x87,0x14,0x16,0x6A,0x47,0x47,0x01,
-  0x2B,0x4D,0x1C,0x1D,0x41,0x22,0x3C,0x28,0x1E,0x35,0x1B,
-  0x03,0x09,0x0E,0x35,0x1D,0x2C,0x1D,0x24,0x1B,0x5E,0x31,
-  0x3C,0x47,0x04,0x0D,0x02,0x03,0x0B,0x2B,0x20,0x42,0x37,
-  0x51,0x5A,0x40,0x70,0x10,0x03,0x3F,0x41,0x00,0x00,0x02,
-  0x00,0x09,0xFF,0xDB,0x02,0x67,0x02,0x2B,0x00,0x14,0x00,
-  0x24,0x00,0x00,0x01,0x23,0x16,0x15,0x14,0x07,0x06,0x23,
-  0x22,0x27,0x26,0x27,0x26,0x35,0x34,0x37,0x36,0x33,0x32,
-  0x17,0x21,0x03,0x34,0x27,0x26,0x23,0x22,0x07,0x06,0x15,
-  0x14,0x17,0x16,0x33,0x32,0x37,0x36,0x02,0x67,0x72,0x2A,
-  0x5E,0x45,0x68,0x9D,0x46,0x02,0x02,0x24,0x4B,0x4C,0x74,
-  0x1F,0x15,0x01,0x1F,0xD4,0x24,0x1D,0x3E,0x3F,0x1C,0x24,
-  0x4E,0x16,0x1B,0x38,0x23,0x24,0x01,0xA3,0x48,0x57,0x9B,
-  0x52,0x3C,0x7E,0x04,0x04,0x42,0x61,0x92,0x4B,0x4A,0x04,
-  0xFE,0xDD,0x53,0x2F,0x2B,0x2B,0x35,0x4D,0x83,0x21,0x09,
-  0x2A,0x2A,0x00,0x01,0x00,0x11,0xFF,0xE3,0x02,0x07,0x02,
-  0x1F,0x00,0x1D,0x00,0x00,0x01,0x23,0x11,0x14,0x17,0x16,
-  0x17,0x16,0x33,0x32,0x37,0x32,0x37,0x17,0x06,0x07,0x06,
-  0x23,0x22,0x27,0x26,0x27,0x26,0x27,0x26,0x35,0x11,0x23,
-  0x35,0x21,0x02,0x07,0xC8,0x02,0x01,0x05,0x04,0x0D,0x06,
-  0x02,0x06,0x26,0x1E,0x36,0x08,0x15,0x0F,0x34,0x22,0x24,
-  0x0C,0x06,0x04,0x03,0xA4,0x01,0xF6,0x01,0xA9,0xFE,0xEF,
-  0x1E,0x08,0x04,0x03,0x02,0x01,0x09,0x80,0x0C,0x01,0x03,
-  0x13,0x14,0x21,0x0E,0x19,0x14,0x2A,0x01,0x19,0x76,0x00,
-  0x01,0x00,0x0F,0xFF,0xD9,0x01,0xF7,0x02,0x1F,0x00,0x25,
-  0x00,0x00,0x25,0x14,0x07,0x06,0x07,0x06,0x07,0x06,0x23,
-  0x22,0x27,0x26,0x27,0x26,0x27,0x26,0x35,0x11,0x33,0x11,
-  0x14,0x17,0x16,0x17,0x16,0x17,0x16,0x33,0x32,0x37,0x36,
-  0x37,0x36,0x37,0x36,0x35,0x11,0x33,0x01,0xF7,0x09,0x08,
-  0x14,0x0F,0x35,0x2C,0x5C,0x64,0x2B,0x34,0x0F,0x14,0x08,
-  0x09,0x8A,0x07,0x08,0x09,0x11,0x0C,0x12,0x24,0x22,0x12,
-  0x0E,0x0E,0x0B,0x07,0x07,0x8A,0xC6,0x3E,0x22,0x23,0x20,
-  0x12,0x20,0x18,0x18,0x20,0x12,0x1E,0x25,0x22,0x3E,0x01,
-  0x59,0xFE,0xC9,0x40,0x1D,0x18,0x05,0x0C,0x04,0x07,0x07,
-  0x05,0x0B,0x08,0x15,0x1D,0x40,0x01,0x37,0x00,0x00,0x02,
-  0x00,0x15,0xFF,0x1F,0x02,0xD2,0x02,0x23,0x00,0x08,0x00,
-  0x2C,0x00,0x00,0x25,0x34,0x27,0x26,0x23,0x11,0x32,0x37,
-  0x36,0x01,0x17,0x06,0x07,0x06,0x15,0x14,0x17,0x16,0x33,
-  0x11,0x33,0x32,0x17,0x16,0x17,0x16,0x15,0x14,0x07,0x06,
-  0x2B,0x01,0x15,0x23,0x35,0x33,0x22,0x27,0x26,0x27,0x26,
-  0x35,0x34,0x37,0x36,0x02,0x4C,0x3B,0x24,0x30,0x5A,0x24,
-  0x11,0xFE,0x68,0x50,0x37,0x18,0x1A,0x4D,0x24,0x2D,0x6C,
-  0xA0,0x53,0x0E,0x0A,0x22,0x7B,0x3E,0x54,0x07,0x8A,0x03,
-  0x86,0x51,0x3E,0x0B,0x02,0x4E,0x1C,0xFA,0x56,0x2C,0x1B,
-  0xFE,0xC9,0x4E,0x20,0x01,0x42,0x68,0x27,0x28,0x2F,0x2C,
-  0x58,0x31,0x15,0x01,0xC3,0x74,0x12,0x14,0x43,0x4D,0x9D,
-  0x57,0x28,0xBE,0xBE,0x57,0x3E,0x67,0x11,0x10,0x77,0x5C,
-  0x21,0x00,0x00,0x01,0xFF,0xE0,0xFF,0x13,0x02,0x56,0x02,
-  0x33,0x00,0x27,0x00,0x00,0x05,0x06,0x2B,0x01,0x22,0x27,
-  0x26,0x2F,0x01,0x07,0x23,0x13,0x27,0x26,0x27,0x26,0x23,
-  0x06,0x23,0x35,0x36,0x33,0x37,0x32,0x17,0x16,0x1F,0x01,
-  0x13,0x33,0x03,0x17,0x16,0x17,0x16,0x33,0x32,0x37,0x32,
-  0x37,0x02,0x56,0x2D,0x1F,0x08,0x2B,0x26,0x1E,0x1A,0x4E,
-  0xA7,0xA4,0xFB,0x8E,0x0C,0x04,0x03,0x0E,0x0E,0x26,0x2E,
-  0x07,0x1C,0x29,0x1C,0x1C,0x16,0x6E,0x8A,0x99,0xD1,0x7D,
-  0x09,0x06,0x03,0x0C,0x03,0x0A,0x07,0x27,0xD9,0x14,0x20,
-  0x18,0x2F,0x9E,0xF9,0x01,0x82,0xF7,0x13,0x03,0x03,0x04,
-  0x7D,0x07,0x02,0x12,0x0F,0x27,0xCC,0x01,0x00,0xFE,0x81,
-  0xEF,0x0E,0x06,0x03,0x02,0x10,0x00,0x00,0x01,0x00,0x11,
-  0xFF,0x1F,0x02,0x85,0x02,0x1F,0x00,0x20,0x00,0x00,0x25,
-  0x14,0x0F,0x01,0x06,0x07,0x15,0x23,0x35,0x26,0x27,0x26,
-  0x35,0x11,0x33,0x11,0x14,0x17,0x16,0x17,0x16,0x17,0x11,
-  0x33,0x11,0x36,0x37,0x36,0x37,0x36,0x35,0x11,0x33,0x02,
-  0x85,0x7B,0x01,0x34,0x46,0x88,0xA5,0x39,0x18,0x8C,0x2B,
-  0x04,0x04,0x18,0x1F,0x88,0x3F,0x16,0x03,0x02,0x10,0x8C,
-  0xD6,0x9A,0x3A,0x01,0x18,0x03,0xC7,0xC7,0x07,0x74,0x32,
-  0x43,0x01,0x49,0xFE,0xD3,0x60,0x1D,0x03,0x02,0x0B,0x03,
-  0x01,0xAB,0xFE,0x55,0x05,0x26,0x05,0x05,0x1F,0x3C,0x01,
-  0x2D,0x00,0x01,0x00,0x0B,0xFF,0xDE,0x02,0xD9,0x02,0x2B,
-  0x00,0x3A,0x00,0x00,0x25,0x14,0x07,0x22,0x31,0x14,0x23,
-  0x06,0x07,0x06,0x23,0x22,0x27,0x06,0x23,0x22,0x27,0x26,
-  0x35,0x34,0x37,0x36,0x37,0x36,0x37,0x17,0x06,0x07,0x06,
-  0x15,0x14,0x17,0x16,0x33,0x36,0x37,0x36,0x37,0x36,0x3D,
-  0x01,0x33,0x15,0x14,0x17,0x16,0x17,0x32,0x37,0x36,0x35,
-  0x34,0x27,0x26,0x27,0x37,0x16,0x17,0x16,0x02,0xD9,0x67,
-  0x01,0x01,0x08,0x08,0x28,0x36,0x5D,0x33,0x33,0x5D,0x67,
-  0x3C,0x34,0x37,0x03,0x03,0x1E,0x2A,0x81,0x4D,0x19,0x1A,
-  0x16,0x13,0x2A,0x21,0x08,0x02,0x0B,0x15,0x86,0x2A,0x01,
-  0x1F,0x2B,0x13,0x16,0x29,0x13,0x43,0x81,0x4D,0x26,0x11,
-  0xF1,0xAA,0x48,0x01,0x05,0x05,0x16,0x44,0x44,0x53,0x4C,
-  0x74,0x69,0x6D,0x06,0x06,0x37,0x20,0x29,0x54,0x3C,0x3D,
-  0x49,0x41,0x2D,0x25,0x02,0x05,0x02,0x0A,0x13,0x1B,0xF8,
-  0xF8,0x25,0x19,0x01,0x02,0x25,0x2D,0x41,0x58,0x4F,0x25,
-  0x49,0x2B,0x42,0x86,0x3C,0x00,0x00,0x03,0xFF,0xD0,0xFF,
-  0xDF,0x01,0x3A,0x02,0xE9,0x00,0x03,0x00,0x07,0x00,0x1C,
-  0x00,0x00,0x01,0x23,0x35,0x33,0x07,0x23,0x35,0x33,0x13,
-  0x06,0x23,0x22,0x27,0x26,0x35,0x11,0x33,0x11,0x15,0x14,
-  0x16,0x15,0x16,0x17,0x16,0x3B,0x01,0x36,0x37,0x01,0x14,
-  0x8E,0x8E,0xB6,0x8E,0x8E,0xDC,0x4C,0x2E,0x45,0x27,0x29,
-  0x8A,0x02,0x01,0x0A,0x02,0x05,0x05,0x10,0x2C,0x02,0x53,
-  0x96,0x96,0x96,0xFD,0x16,0x20,0x2A,0x29,0x53,0x01,0x9C,
-  0xFE,0x75,0x0D,0x06,0x04,0x04,0x0A,0x07,0x02,0x02,0x18,
-  0x00,0x00,0x03,0x00,0x0F,0xFF,0xD9,0x01,0xF7,0x02,0xEB,
-  0x00,0x03,0x00,0x07,0x00,0x2D,0x00,0x00,0x01,0x23,0x35,
-  0x33,0x07,0x23,0x35,0x33,0x01,0x14,0x07,0x06,0x07,0x06,
-  0x07,0x06,0x23,0x22,0x27,0x26,0x27,0x26,0x27,0x26,0x35,
-  0x11,0x33,0x11,0x14,0x17,0x16,0x17,0x16,0x17,0x16,0x33,
-  0x32,0x37,0x36,0x37,0x36,0x37,0x36,0x35,0x11,0x33,0x01,
-  0xA7,0x8E,0x8E,0xB6,0x8E,0x8E,0x01,0x06,0x09,0x08,0x14,
-  0x0F,0x35,0x2C,0x5C,0x64,0x2B,0x34,0x0F,0x14,0x08,0x09,
-  0x8A,0x07,0x08,0x09,0x11,0x0C,0x12,0x24,0x22,0x12,0x0E,
-  0x0E,0x0B,0x07,0x07,0x8A,0x02,0x55,0x96,0x96,0x96,0xFD,
-  0xDB,0x3E,0x22,0x23,0x20,0x12,0x20,0x18,0x18,0x20,0x12,
-  0x1E,0x25,0x22,0x3E,0x01,0x59,0xFE,0xC9,0x40,0x1D,0x18,
-  0x05,0x0C,0x04,0x07,0x07,0x05,0x0B,0x08,0x15,0x1D,0x40,
-  0x01,0x37,0x00,0x03,0x00,0x09,0xFF,0xDB,0x02,0x1F,0x03,
-  0x15,0x00,0x03,0x00,0x17,0x00,0x2E,0x00,0x00,0x01,0x07,
-  0x23,0x37,0x13,0x14,0x07,0x06,0x07,0x06,0x23,0x22,0x27,
-  0x26,0x27,0x26,0x35,0x34,0x37,0x36,0x33,0x32,0x17,0x16,
-  0x07,0x34,0x27,0x26,0x27,0x26,0x27,0x26,0x22,0x07,0x06,
-  0x07,0x06,0x07,0x06,0x15,0x14,0x17,0x16,0x33,0x32,0x37,
-  0x36,0x01,0xF9,0x94,0x7D,0x5B,0xDC,0x22,0x21,0x3E,0x3E,
-  0x4C,0x48,0x3E,0x3E,0x23,0x24,0x4B,0x4C,0x74,0x74,0x4C,
-  0x4B,0x8C,0x09,0x08,0x13,0x0E,0x19,0x16,0x3C,0x16,0x19,
-  0x0E,0x12,0x08,0x0A,0x24,0x21,0x3A,0x38,0x23,0x24,0x03,
-  0x15,0xBA,0xBA,0xFD,0xEF,0x5E,0x40,0x44,0x24,0x23,0x20,
-  0x22,0x44,0x42,0x61,0x92,0x4B,0x4A,0x4A,0x4B,0x92,0x28,
-  0x23,0x1E,0x19,0x15,0x0B,0x0B,0x0B,0x0B,0x15,0x1A,0x1D,
-  0x25,0x26,0x59,0x2A,0x2A,0x2A,0x2A,0x00,0x02,0x00,0x0F,
-  0xFF,0xD9,0x01,0xF7,0x03,0x15,0x00,0x25,0x00,0x29,0x00,
-  0x00,0x25,0x14,0x07,0x06,0x07,0x06,0x07,0x06,0x23,0x22,
-  0x27,0x26,0x27,0x26,0x27,0x26,0x35,0x11,0x33,0x11,0x14,
-  0x17,0x16,0x17,0x16,0x17,0x16,0x33,0x32,0x37,0x36,0x37,
-  0x36,0x37,0x36,0x35,0x11,0x33,0x27,0x07,0x23,0x37,0x01,
-  0xF7,0x09,0x08,0x14,0x0F,0x35,0x2C,0x5C,0x64,0x2B,0x34,
-  0x0F,0x14,0x08,0x09,0x8A,0x07,0x08,0x09,0x11,0x0C,0x12,
-  0x24,0x22,0x12,0x0E,0x0E,0x0B,0x07,0x07,0x8A,0x16,0x94,
-  0x7D,0x5B,0xC6,0x3E,0x22,0x23,0x20,0x12,0x20,0x18,0x18,
-  0x20,0x12,0x1E,0x25,0x22,0x3E,0x01,0x59,0xFE,0xC9,0x40,
-  0x1D,0x18,0x05,0x0C,0x04,0x07,0x07,0x05,0x0B,0x08,0x15,
-  0x1D,0x40,0x01,0x37,0xF6,0xBA,0xBA,0x00,0x02,0x00,0x0B,
-  0xFF,0xDE,0x02,0xD9,0x03,0x15,0x00,0x48,0x00,0x4C,0x00,
-  0x00,0x25,0x14,0x07,0x06,0x07,0x06,0x07,0x06,0x23,0x22,
-  0x27,0x26,0x27,0x06,0x07,0x06,0x23,0x22,0x27,0x26,0x27,
-  0x26,0x27,0x26,0x35,0x34,0x37,0x36,0x37,0x36,0x37,0x17,
-  0x06,0x07,0x06,0x07,0x06,0x15,0x14,0x17,0x16,0x33,0x36,
-  0x37,0x36,0x37,0x36,0x3D,0x01,0x33,0x15,0x14,0x17,0x16,
-  0x17,0x16,0x17,0x32,0x37,0x36,0x35,0x34,0x27,0x26,0x27,
-  0x26,0x27,0x37,0x16,0x17,0x16,0x17,0x16,0x03,0x07,0x23,
-  0x37,0x02,0xD9,0x0D,0x0E,0x1A,0x1C,0x28,0x28,0x36,0x3B,
-  0x2C,0x17,0x12,0x12,0x17,0x2C,0x3B,0x38,0x25,0x2A,0x1C,
-  0x1A,0x0D,0x0D,0x11,0x12,0x1A,0x1E,0x2A,0x81,0x42,0x14,
-  0x15,0x0C,0x09,0x16,0x13,0x2A,0x20,0x01,0x07,0x0E,0x15,
-  0x86,0x14,0x0A,0x0C,0x01,0x1F,0x2B,0x13,0x16,0x09,0x0A,
-  0x16,0x19,0x3D,0x81,0x2A,0x1D,0x1A,0x12,0x11,0x80,0x94,
-  0x7D,0x5B,0xF1,0x3C,0x2D,0x33,0x24,0x27,0x16,0x16,0x1D,
-  0x10,0x17,0x17,0x10,0x1D,0x16,0x15,0x28,0x26,0x32,0x2D,
-  0x3B,0x34,0x3E,0x40,0x30,0x37,0x20,0x29,0x48,0x27,0x25,
-  0x30,0x29,0x29,0x41,0x2D,0x25,0x02,0x01,0x04,0x0C,0x13,
-  0x1B,0xF8,0xF8,0x1A,0x14,0x09,0x07,0x01,0x02,0x25,0x2D,
-  0x41,0x29,0x29,0x29,0x2C,0x2B,0x43,0x2B,0x24,0x34,0x30,
-  0x40,0x3C,0x01,0xEE,0xBA,0xBA,0xFF,0xFF,0x00,0x4F,0x00,
-  0x00,0x02,0x70,0x03,0xD3,0x10,0x26,0x00,0x28,0x00,0x00,
-  0x10,0x07,0x00,0x43,0x00,0xE4,0x00,0xDE,0x00,0x03,0x00,
-  0x52,0x00,0x00,0x02,0x73,0x03,0x9A,0x00,0x0B,0x00,0x0F,
-  0x00,0x13,0x00,0x00,0x13,0x15,0x21,0x15,0x21,0x11,0x21,
-  0x15,0x21,0x15,0x21,0x15,0x01,0x15,0x23,0x35,0x21,0x15,
-  0x23,0x35,0xE8,0x01,0x8B,0xFD,0xDF,0x02,0x0F,0xFE,0x87,
-  0x01,0x5D,0xFE,0xF1,0x6E,0x01,0x28,0x6E,0x01,0x3A,0xBD,
-  0x7D,0x02,0xD9,0x7D,0xA5,0x7D,0x02,0x60,0x7A,0x7A,0x7A,
-  0x7A,0x00,0x01,0x00,0x0E,0xFF,0x5C,0x02,0xF6,0x02,0xD9,
-  0x00,0x23,0x00,0x00,0x01,0x33,0x32,0x17,0x16,0x1D,0x01,
-  0x11,0x06,0x07,0x06,0x07,0x06,0x07,0x22,0x0F,0x01,0x35,
-  0x33,0x36,0x37,0x36,0x37,0x11,0x34,0x2F,0x01,0x23,0x11,
-  0x23,0x11,0x23,0x35,0x21,0x15,0x23,0x01,0x60,0xBC,0x65,
-  0x42,0x33,0x09,0x0F,0x14,0x2E,0x38,0x35,0x0A,0x0B,0x46,
-  0x3C,0x42,0x0C,0x01,0x01,0x37,0x19,0xAF,0x97,0xBC,0x02,
-  0x0A,0xB8,0x01,0xF8,0x41,0x32,0x41,0x01,0xFE,0xBD,0x43,
-  0x19,0x23,0x13,0x0D,0x03,0x01,0x01,0x5E,0x01,0x35,0x07,
-  0x09,0x01,0x3D,0x30,0x0B,0x03,0xFE,0x85,0x02,0x5D,0x7C,
-  0x7C,0x00,0x02,0x00,0x4A,0x00,0x00,0x02,0x4A,0x03,0xD3,
-  0x00,0x05,0x00,0x09,0x00,0x00,0x33,0x23,0x11,0x21,0x15,
-  0x21,0x13,0x07,0x23,0x37,0xE0,0x96,0x02,0x00,0xFE,0x96,
-  0xCC,0x7E,0x46,0x46,0x02,0xD9,0x7D,0x01,0x77,0x96,0x96,
-  0x00,0x00,0x01,0x00,0x2C,0xFF,0xE9,0x02,0xAD,0x02,0xE5,
-  0x00,0x26,0x00,0x00,0x01,0x21,0x16,0x17,0x16,0x33,0x32,
-  0x37,0x36,0x37,0x33,0x06,0x07,0x06,0x23,0x22,0x27,0x26,
-  0x35,0x34,0x37,0x36,0x33,0x32,0x17,0x16,0x17,0x16,0x17,
-  0x23,0x26,0x27,0x26,0x23,0x22,0x07,0x06,0x07,0x21,0x01,
-  0xE8,0xFE,0xDC,0x0E,0x66,0x1E,0x24,0x6F,0x25,0x0A,0x03,
-  0x92,0x08,0x72,0x4E,0x6F,0xAC,0x59,0x45,0x78,0x56,0x80,
-  0xA1,0x57,0x04,0x03,0x2A,0x07,0x8F,0x0C,0x15,0x2A,0x51,
-  0x6E,0x32,0x12,0x08,0x01,0x23,0x01,0x37,0x9C,0x28,0x0C,
-  0x5A,0x19,0x1F,0x94,0x4A,0x32,0x80,0x64,0x99,0xD0,0x66,
-  0x49,0x6A,0x05,0x04,0x37,0x59,0x34,0x1A,0x35,0x63,0x22,
-  0x2C,0x00,0x00,0x01,0x00,0x20,0xFF,0xE9,0x02,0x79,0x02,
-  0xE5,0x00,0x3C,0x00,0x00,0x01,0x23,0x26,0x27,0x26,0x23,
-  0x22,0x07,0x06,0x31,0x06,0x15,0x14,0x17,0x16,0x17,0x33,
-  0x16,0x1F,0x01,0x16,0x17,0x16,0x15,0x14,0x07,0x06,0x23,
-  0x22,0x27,0x26,0x27,0x33,0x16,0x17,0x16,0x33,0x32,0x37,
-  0x36,0x35,0x34,0x27,0x26,0x2F,0x01,0x26,0x2F,0x01,0x35,
-  0x30,0x27,0x26,0x35,0x34,0x37,0x36,0x33,0x32,0x17,0x16,
-  0x02,0x5F,0x8C,0x07,0x76,0x0D,0x0F,0x5A,0x1B,0x01,0x08,
-  0x2A,0x17,0x29,0x01,0x0E,0x11,0x72,0x91,0x23,0x0D,0x7B,
-  0x48,0x68,0xD7,0x40,0x14,0x03,0x92,0x06,0x6F,0x16,0x19,
-  0x6C,0x1E,0x09,0x3A,0x1D,0x32,0x66,0x90,0x28,0x01,0x01,
-  0x13,0x7D,0x3F,0x58,0xA0,0x4B,0x33,0x01,0xFB,0x65,0x0C,
-  0x01,0x35,0x01,0x10,0x14,0x2E,0x15,0x0C,0x09,0x04,0x03,
-  0x16,0x1C,0x5B,0x23,0x2F,0x8D,0x3C,0x23,0x8E,0x2B,0x38,
-  0x64,0x12,0x03,0x3C,0x11,0x15,0x3A,0x1A,0x0D,0x09,0x14,
-  0x1B,0x49,0x01,0x01,0x01,0x25,0x38,0x8F,0x36,0x1B,0x53,
-  0x39,0x00,0xFF,0xFF,0x00,0x3F,0x00,0x00,0x00,0xD5,0x02,
-  0xD9,0x10,0x06,0x00,0x2C,0x00,0x00,0xFF,0xFF,0xFF,0xF7,
-  0x00,0x00,0x01,0x1F,0x03,0x9A,0x10,0x26,0x00,0x2C,0x00,
-  0x00,0x10,0x07,0x00,0x69,0xFF,0xE5,0x00,0xB3,0xFF,0xFF,
-  0x00,0x18,0xFF,0xE9,0x01,0xE6,0x02,0xD9,0x10,0x06,0x00,
-  0x2D,0x00,0x00,0x00,0x02,0x00,0x2E,0x00,0x00,0x04,0x28,
-  0x02,0xD9,0x00,0x1D,0x00,0x30,0x00,0x00,0x21,0x11,0x23,
-  0x15,0x10,0x07,0x06,0x23,0x35,0x16,0x37,0x36,0x3D,0x01,
-  0x11,0x21,0x11,0x33,0x32,0x17,0x16,0x1D,0x01,0x14,0x0F,
-  0x01,0x06,0x07,0x06,0x23,0x03,0x15,0x33,0x32,0x3F,0x01,
-  0x33,0x36,0x37,0x36,0x37,0x36,0x3D,0x01,0x34,0x27,0x23,
-  0x27,0x23,0x01,0xFB,0xDE,0x94,0x28,0x33,0x37,0x13,0x0F,
-  0x02,0x0A,0xBB,0x7C,0x3B,0x25,0x39,0x01,0x1B,0x34,0x2B,
-  0x37,0xAC,0x8C,0x47,0x12,0x01,0x01,0x0B,0x06,0x06,0x02,
-  0x01,0x63,0x01,0x01,0x10,0x02,0x5C,0xBE,0xFE,0xB8,0x44,
-  0x12,0x91,0x01,0x60,0x47,0x95,0x01,0x01,0x0C,0xFE,0xDA,
-  0x60,0x3C,0x56,0x01,0x63,0x2A,0x01,0x13,0x11,0x0E,0x01,
-  0x36,0xB9,0x08,0x01,0x06,0x0B,0x0C,0x14,0x08,0x09,0x01,
-  0x65,0x07,0x01,0x00,0x00,0x02,0x00,0x44,0x00,0x00,0x04,
-  0x28,0x02,0xD9,0x00,0x14,0x00,0x23,0x00,0x00,0x01,0x11,
-  0x33,0x32,0x17,0x16,0x15,0x14,0x07,0x06,0x23,0x21,0x11,
-  0x21,0x11,0x23,0x11,0x33,0x11,0x21,0x11,0x13,0x15,0x33,
-  0x32,0x37,0x36,0x35,0x34,0x27,0x23,0x26,0x23,0x31,0x22,
-  0x23,0x02,0x91,0xBB,0x7C,0x3B,0x25,0x87,0x2C,0x38,0xFE,
-  0xBE,0xFE,0xDF,0x96,0x96,0x01,0x20,0x97,0x8C,0x6C,0x08,
-  0x01,0x63,0x01,0x01,0x01,0x07,0x08,0x02,0xD9,0xFE,0xFC,
-  0x60,0x3D,0x56,0xA7,0x2D,0x0E,0x01,0x37,0xFE,0xC9,0x02,
-  0xD9,0xFE,0xDB,0x01,0x25,0xFE,0x7F,0xDB,0x5C,0x08,0x0A,
-  0x65,0x07,0x01,0x00,0x00,0x01,0x00,0x0E,0x00,0x00,0x02,
-  0xF6,0x02,0xD9,0x00,0x15,0x00,0x00,0x01,0x33,0x32,0x17,
-  0x16,0x1D,0x01,0x11,0x23,0x11,0x34,0x2F,0x01,0x23,0x11,
-  0x23,0x11,0x23,0x35,0x21,0x15,0x23,0x01,0x60,0xBC,0x65,
-  0x42,0x33,0x96,0x37,0x19,0xAF,0x97,0xBC,0x02,0x0A,0xB8,
-  0x01,0xF8,0x41,0x32,0x41,0x01,0xFE,0xBD,0x01,0x3D,0x30,
-  0x0B,0x03,0xFE,0x85,0x02,0x5D,0x7C,0x7C,0x00,0x02,0x00,
-  0x4A,0x00,0x00,0x02,0xCD,0x03,0xA1,0x00,0x0A,0x00,0x0E,
-  0x00,0x00,0x33,0x23,0x11,0x33,0x11,0x01,0x33,0x09,0x01,
-  0x23,0x01,0x13,0x07,0x23,0x37,0xE0,0x96,0x96,0x01,0x1D,
-  0xB1,0xFE,0x92,0x01,0x8D,0xB3,0xFE,0xC6,0xFE,0x7E,0x46,
-  0x46,0x02,0xD9,0xFE,0xE9,0x01,0x17,0xFE,0xA1,0xFE,0x86,
-  0x01,0x1D,0x02,0x84,0x96,0x96,0x00,0x02,0x00,0x44,0x00,
-  0x00,0x02,0x95,0x03,0xA1,0x00,0x09,0x00,0x0D,0x00,0x00,
-  0x33,0x23,0x11,0x33,0x11,0x01,0x33,0x11,0x23,0x11,0x03,
-  0x33,0x17,0x23,0xDA,0x96,0x96,0x01,0x21,0x9A,0x96,0xF5,
-  0x7E,0x46,0x46,0x02,0xD9,0xFE,0x10,0x01,0xF0,0xFD,0x27,
-  0x01,0xF8,0x01,0xA9,0x96,0x00,0x02,0x00,0x0F,0x00,0x00,
-  0x02,0xB8,0x03,0x9A,0x00,0x07,0x00,0x1A,0x00,0x00,0x21,
-  0x23,0x37,0x03,0x33,0x1B,0x01,0x33,0x27,0x15,0x14,0x07,
-  0x06,0x23,0x22,0x27,0x35,0x26,0x3D,0x01,0x33,0x16,0x33,
-  0x32,0x37,0x34,0x37,0x01,0x48,0xAE,0x72,0xFD,0xA3,0xAC,
-  0xAC,0xAE,0xD0,0x39,0x21,0x2A,0x48,0x26,0x16,0x38,0x09,
-  0x44,0x3D,0x0D,0x01,0xE2,0x01,0xF7,0xFE,0xA7,0x01,0x59,
-  0xC1,0x0B,0x47,0x27,0x16,0x39,0x01,0x21,0x2A,0x0A,0x42,
-  0x3B,0x03,0x04,0x00,0x01,0x00,0x44,0xFF,0x6A,0x02,0x92,
-  0x02,0xD9,0x00,0x0B,0x00,0x00,0x21,0x15,0x23,0x35,0x23,
-  0x11,0x33,0x11,0x21,0x11,0x33,0x11,0x01,0xAC,0x82,0xE6,
-  0x96,0x01,0x22,0x96,0x96,0x96,0x02,0xD9,0xFD,0xA4,0x02,
-  0x5C,0xFD,0x27,0xFF,0xFF,0x00,0x1A,0x00,0x00,0x02,0xBF,
-  0x02,0xD9,0x10,0x06,0x00,0x24,0x00,0x00,0x00,0x02,0x00,
-  0x52,0x00,0x00,0x02,0x9A,0x02,0xD9,0x00,0x10,0x00,0x1B,
-  0x00,0x00,0x01,0x32,0x17,0x16,0x15,0x14,0x07,0x06,0x07,
-  0x06,0x23,0x21,0x11,0x21,0x15,0x21,0x1D,0x02,0x33,0x32,
-  0x37,0x36,0x35,0x34,0x27,0x26,0x23,0x01,0x8B,0xAE,0x44,
-  0x1D,0x2C,0x0D,0x0F,0x3F,0x79,0xFE,0xB8,0x02,0x00,0xFE,
-  0x96,0xB3,0x50,0x18,0x07,0x3D,0x16,0x1C,0x01,0xCF,0x81,
-  0x37,0x39,0x4A,0x3F,0x13,0x0D,0x35,0x02,0xD9,0x7D,0x8D,
-  0x7D,0xD5,0x3F,0x14,0x17,0x4A,0x18,0x09,0xFF,0xFF,0x00,
-  0x52,0x00,0x00,0x02,0x9A,0x02,0xD9,0x10,0x06,0x00,0x25,
-  0x00,0x00,0x00,0x01,0x00,0x52,0x00,0x00,0x02,0x52,0x02,
-  0xD9,0x00,0x05,0x00,0x00,0x33,0x23,0x11,0x21,0x15,0x21,
-  0xE8,0x96,0x02,0x00,0xFE,0x96,0x02,0xD9,0x7D,0x00,0x00,
-  0x02,0x00,0x23,0xFF,0x6A,0x03,0x61,0x02,0xD9,0x00,0x0F,
-  0x00,0x15,0x00,0x00,0x37,0x32,0x37,0x36,0x35,0x11,0x21,
-  0x11,0x33,0x11,0x23,0x35,0x21,0x15,0x23,0x11,0x25,0x21,
-  0x11,0x23,0x15,0x14,0x8B,0x2E,0x1A,0x13,0x02,0x08,0x73,
-  0x82,0xFD,0xC6,0x82,0x01,0x2A,0x01,0x0B,0xDC,0x6C,0x80,
-  0x5E,0x83,0x01,0x0C,0xFD,0x93,0xFE,0xFE,0x96,0x96,0x01,
-  0x02,0x11,0x01,0xDF,0xBE,0xBE,0x00,0x00,0x01,0x00,0x52,
-  0x00,0x00,0x02,0x73,0x02,0xD9,0x00,0x0B,0x00,0x00,0x13,
-  0x15,0x21,0x15,0x21,0x11,0x21,0x15,0x21,0x15,0x21,0x15,
-  0xE8,0x01,0x8B,0xFD,0xDF,0x02,0x0F,0xFE,0x87,0x01,0x5D,
-  0x01,0x3A,0xBD,0x7D,0x02,0xD9,0x7D,0xA5,0x7D,0x00,0x01,
-  0x00,0x16,0x00,0x00,0x04,0x36,0x02,0xD9,0x00,0x11,0x00,
-  0x00,0x09,0x01,0x23,0x09,0x01,0x33,0x13,0x11,0x33,0x11,
-  0x13,0x33,0x09,0x01,0x23,0x01,0x11,0x23,0x01,0xDB,0xFE,
-  0xF3,0xB8,0x01,0x65,0xFE,0xC7,0xA4,0xF5,0x96,0xF5,0xA4,
-  0xFE,0xC7,0x01,0x65,0xB8,0xFE,0xF3,0x96,0x01,0x1D,0xFE,
-  0xE3,0x01,0x7A,0x01,0x5F,0xFE,0xE9,0x01,0x17,0xFE,0xE9,
-  0x01,0x17,0xFE,0xA1,0xFE,0x86,0x01,0x1D,0xFE,0xE3,0x00,
-  0x01,0x00,0x20,0xFF,0xE9,0x02,0x79,0x02,0xE5,0x00,0x34,
-  0x00,0x00,0x13,0x33,0x32,0x35,0x34,0x27,0x26,0x23,0x22,
-  0x07,0x06,0x07,0x14,0x15,0x23,0x34,0x37,0x36,0x33,0x32,
-  0x17,0x16,0x15,0x14,0x07,0x16,0x17,0x16,0x15,0x14,0x07,
-  0x06,0x23,0x22,0x27,0x26,0x27,0x33,0x16,0x17,0x16,0x33,
-  0x32,0x37,0x36,0x35,0x34,0x27,0x26,0x27,0x26,0x2B,0x01,
-  0xFA,0x4C,0x8A,0x42,0x1A,0x22,0x87,0x10,0x01,0x01,0x8C,
-  0x33,0x4B,0xA0,0xB9,0x40,0x1B,0x3F,0x52,0x06,0x01,0x7B,
-  0x48,0x68,0xD7,0x40,0x14,0x03,0x92,0x06,0x6F,0x16,0x19,
-  0x6C,0x1E,0x09,0x4F,0x12,0x15,0x09,0x0A,0x66,0x01,0xAC,
-  0x67,0x3C,0x15,0x09,0x64,0x05,0x05,0x02,0x02,0x5E,0x39,
-  0x53,0x70,0x30,0x40,0x5D,0x2F,0x2D,0x62,0x0A,0x0B,0x8D,
-  0x3C,0x23,0x8E,0x2B,0x38,0x64,0x12,0x03,0x3C,0x11,0x15,
-  0x53,0x17,0x05,0x01,0x01,0x00,0x00,0x01,0x00,0x52,0x00,
-  0x00,0x02,0xA3,0x02,0xD9,0x00,0x09,0x00,0x00,0x33,0x23,
-  0x11,0x33,0x11,0x01,0x33,0x11,0x23,0x11,0xE8,0x96,0x96,
-  0x01,0x21,0x9A,0x96,0x02,0xD9,0xFE,0x10,0x01,0xF0,0xFD,
-  0x27,0x01,0xF8,0x00,0x00,0x02,0x00,0x52,0x00,0x00,0x02,
-  0xA3,0x03,0x9F,0x00,0x16,0x00,0x20,0x00,0x00,0x01,0x15,
-  0x14,0x07,0x06,0x23,0x22,0x27,0x35,0x26,0x3D,0x01,0x33,
-  0x16,0x33,0x32,0x37,0x35,0x37,0x30,0x35,0x36,0x37,0x03,
-  0x23,0x11,0x33,0x11,0x01,0x33,0x11,0x23,0x11,0x01,0xFB,
-  0x39,0x21,0x2A,0x48,0x26,0x16,0x38,0x09,0x44,0x39,0x0F,
-  0x01,0x01,0x01,0xDB,0x96,0x96,0x01,0x21,0x9A,0x96,0x03,
-  0x9F,0x0B,0x47,0x27,0x16,0x39,0x01,0x21,0x2A,0x0A,0x42,
-  0x36,0x01,0x01,0x01,0x04,0x05,0xFC,0x61,0x02,0xD9,0xFE,
-  0x10,0x01,0xF0,0xFD,0x27,0x01,0xF8,0x00,0x01,0x00,0x52,
-  0x00,0x00,0x02,0xD5,0x02,0xD9,0x00,0x0A,0x00,0x00,0x33,
-  0x23,0x11,0x33,0x11,0x01,0x33,0x09,0x01,0x23,0x01,0xE8,
-  0x96,0x96,0x01,0x1D,0xB1,0xFE,0x92,0x01,0x8D,0xC8,0xFE,
-  0xDB,0x02,0xD9,0xFE,0xE9,0x01,0x17,0xFE,0xA1,0xFE,0x86,
-  0x01,0x1D,0x00,0x01,0x00,0x24,0xFF,0xF4,0x02,0x87,0x02,
-  0xD9,0x00,0x0F,0x00,0x00,0x01,0x23,0x15,0x10,0x07,0x06,
-  0x23,0x35,0x16,0x37,0x36,0x35,0x11,0x21,0x11,0x23,0x01,
-  0xF1,0xDE,0x8C,0x2B,0x38,0x33,0x14,0x12,0x02,0x0A,0x96,
-  0x02,0x5C,0xCC,0xFE,0xC2,0x48,0x16,0x91,0x01,0x4A,0x44,
-  0xAD,0x01,0x1A,0xFD,0x27,0x00,0x01,0x00,0x52,0x00,0x00,
-  0x03,0x18,0x02,0xD9,0x00,0x0C,0x00,0x00,0x13,0x11,0x23,
-  0x11,0x33,0x1B,0x01,0x33,0x11,0x23,0x11,0x03,0x23,0xE8,
-  0x96,0xE0,0x84,0x80,0xE2,0x96,0x81,0x96,0x02,0x38,0xFD,
-  0xC8,0x02,0xD9,0xFD,0xBC,0x02,0x44,0xFD,0x27,0x02,0x38,
-  0xFD,0xC8,0x00,0x01,0x00,0x52,0x00,0x00,0x02,0x9F,0x02,
-  0xD9,0x00,0x0B,0x00,0x00,0x01,0x21,0x11,0x23,0x11,0x33,
-  0x11,0x21,0x11,0x33,0x11,0x23,0x02,0x09,0xFE,0xDF,0x96,
-  0x96,0x01,0x20,0x97,0x96,0x01,0x4B,0xFE,0xB5,0x02,0xD9,
-  0xFE,0xEF,0x01,0x11,0xFD,0x27,0xFF,0xFF,0x00,0x28,0xFF,
-  0xE9,0x02,0xE6,0x02,0xE5,0x10,0x06,0x00,0x32,0x00,0x00,
-  0x00,0x01,0x00,0x52,0x00,0x00,0x02,0x9F,0x02,0xD9,0x00,
-  0x07,0x00,0x00,0x01,0x21,0x11,0x23,0x11,0x21,0x11,0x23,
-  0x02,0x09,0xFE,0xDF,0x96,0x02,0x4D,0x96,0x02,0x5C,0xFD,
-  0xA4,0x02,0xD9,0xFD,0x27,0x00,0x02,0x00,0x52,0x00,0x00,
-  0x02,0x7F,0x02,0xD9,0x00,0x10,0x00,0x1B,0x00,0x00,0x13,
-  0x11,0x23,0x11,0x21,0x32,0x17,0x14,0x15,0x16,0x15,0x14,
-  0x07,0x06,0x07,0x06,0x23,0x27,0x33,0x32,0x37,0x36,0x35,
-  0x34,0x27,0x26,0x2B,0x01,0xE8,0x96,0x01,0x42,0xB1,0x2D,
-  0x0D,0x5B,0x01,0x01,0x35,0x4A,0xBB,0x8C,0x6D,0x07,0x01,
-  0x60,0x0A,0x0B,0x8C,0x01,0x04,0xFE,0xFC,0x02,0xD9,0x87,
-  0x01,0x01,0x27,0x32,0x8C,0x40,0x01,0x01,0x25,0x7D,0x5E,
-  0x07,0x08,0x64,0x09,0x01,0xFF,0xFF,0x00,0x2C,0xFF,0xE9,
-  0x02,0xAD,0x02,0xE5,0x10,0x06,0x00,0x26,0x00,0x00,0xFF,
-  0xFF,0x00,0x0E,0x00,0x00,0x02,0x56,0x02,0xD9,0x10,0x06,
-  0x00,0x37,0x00,0x00,0x00,0x01,0x00,0x0F,0x00,0x00,0x02,
-  0xB8,0x02,0xD9,0x00,0x07,0x00,0x00,0x21,0x23,0x37,0x03,
-  0x33,0x1B,0x01,0x33,0x01,0x48,0xAE,0x72,0xFD,0xA3,0xAC,
-  0xAC,0xAE,0xE2,0x01,0xF7,0xFE,0xA7,0x01,0x59,0x00,0x03,
-  0x00,0x1E,0x00,0x00,0x03,0x5E,0x02,0xD9,0x00,0x19,0x00,
-  0x22,0x00,0x2B,0x00,0x00,0x21,0x35,0x22,0x27,0x26,0x35,
-  0x10,0x25,0x32,0x33,0x22,0x33,0x35,0x33,0x15,0x32,0x17,
-  0x16,0x17,0x16,0x15,0x10,0x25,0x2B,0x01,0x15,0x27,0x11,
-  0x22,0x07,0x06,0x15,0x14,0x17,0x16,0x33,0x32,0x37,0x36,
-  0x35,0x34,0x27,0x22,0x23,0x01,0x73,0x5B,0x2A,0xD0,0x01,
-  0x21,0x0B,0x0C,0x41,0x5E,0x96,0x6E,0x35,0x8A,0x1F,0x09,
-  0xFE,0xBE,0x0B,0x08,0x96,0x55,0x29,0x51,0x88,0x11,0xCC,
-  0x47,0x18,0x70,0xB0,0x05,0x1A,0x5E,0x08,0x29,0xE7,0x01,
-  0x01,0x07,0x5B,0x5B,0x0E,0x24,0x84,0x25,0x2D,0xFE,0xE3,
-  0x05,0x5E,0xBC,0x01,0x60,0x13,0x25,0x72,0xA6,0x0F,0x01,
-  0x05,0x19,0x98,0xA6,0x04,0xFF,0xFF,0x00,0x16,0x00,0x00,
-  0x02,0x8D,0x02,0xD9,0x10,0x06,0x00,0x3B,0x00,0x00,0x00,
-  0x01,0x00,0x52,0xFF,0x6A,0x03,0x0D,0x02,0xD9,0x00,0x0B,
-  0x00,0x00,0x25,0x11,0x33,0x11,0x33,0x11,0x23,0x35,0x21,
-  0x11,0x33,0x11,0x02,0x09,0x96,0x6E,0x82,0xFD,0xC7,0x96,
-  0x7D,0x02,0x5C,0xFD,0x93,0xFE,0xFE,0x96,0x02,0xD9,0xFD,
-  0xA4,0x00,0x01,0x00,0x44,0x00,0x00,0x02,0x70,0x02,0xD9,
-  0x00,0x11,0x00,0x00,0x25,0x23,0x22,0x27,0x26,0x35,0x11,
-  0x33,0x11,0x14,0x17,0x16,0x3B,0x01,0x11,0x33,0x11,0x23,
-  0x01,0xDA,0xBC,0x65,0x42,0x33,0x96,0x37,0x0C,0x0D,0xAF,
-  0x97,0x96,0xE1,0x41,0x33,0x41,0x01,0x43,0xFE,0xC3,0x30,
-  0x0B,0x03,0x01,0x7B,0xFD,0x27,0x00,0x01,0x00,0x44,0x00,
-  0x00,0x03,0xC7,0x02,0xD9,0x00,0x0B,0x00,0x00,0x29,0x01,
-  0x11,0x33,0x11,0x33,0x11,0x33,0x11,0x33,0x11,0x33,0x03,
-  0xC7,0xFC,0x7D,0x96,0xDB,0x96,0xE6,0x96,0x02,0xD9,0xFD,
-  0xA4,0x02,0x5C,0xFD,0xA4,0x02,0x5C,0x00,0x00,0x01,0x00,
-  0x44,0xFF,0x6A,0x04,0x49,0x02,0xD9,0x00,0x0F,0x00,0x00,
-  0x29,0x01,0x11,0x33,0x11,0x33,0x11,0x33,0x11,0x33,0x11,
-  0x33,0x11,0x33,0x11,0x23,0x03,0xC2,0xFC,0x82,0x96,0xE5,
-  0x96,0xE6,0x96,0x78,0x87,0x02,0xD9,0xFD,0xA4,0x02,0x5C,
-  0xFD,0xA4,0x02,0x5C,0xFD,0x93,0xFE,0xFE,0x00,0x00,0x02,
-  0x00,0x0E,0x00,0x00,0x03,0x21,0x02,0xD9,0x00,0x0E,0x00,
-  0x1D,0x00,0x00,0x01,0x33,0x32,0x17,0x16,0x15,0x14,0x07,
-  0x06,0x23,0x21,0x11,0x27,0x35,0x21,0x11,0x15,0x33,0x32,
-  0x37,0x36,0x35,0x34,0x27,0x23,0x26,0x23,0x31,0x22,0x23,
-  0x01,0x8A,0xBB,0x7C,0x3B,0x25,0x87,0x2C,0x38,0xFE,0xBE,
-  0xE6,0x01,0x7C,0x8C,0x6C,0x08,0x01,0x63,0x01,0x01,0x01,
-  0x07,0x08,0x01,0xD5,0x60,0x3D,0x56,0xA7,0x2D,0x0E,0x02,
-  0x5C,0x01,0x7C,0xFE,0x7F,0xDB,0x5C,0x08,0x0A,0x65,0x07,
-  0x01,0x00,0x00,0x03,0x00,0x44,0x00,0x00,0x03,0x74,0x02,
-  0xD9,0x00,0x03,0x00,0x10,0x00,0x1B,0x00,0x00,0x01,0x11,
-  0x23,0x11,0x01,0x33,0x32,0x17,0x16,0x15,0x14,0x07,0x06,
-  0x23,0x21,0x11,0x33,0x11,0x15,0x33,0x32,0x37,0x36,0x35,
-  0x34,0x27,0x26,0x23,0x03,0x74,0x96,0xFD,0xFC,0xBB,0x7C,
-  0x3B,0x25,0x89,0x2B,0x37,0xFE,0xBE,0x96,0x8C,0x6C,0x08,
-  0x01,0x63,0x09,0x09,0x02,0xD9,0xFD,0x27,0x02,0xD9,0xFE,
-  0xFC,0x60,0x3D,0x56,0xA8,0x2C,0x0E,0x02,0xD9,0xFE,0x7F,
-  0xDB,0x5C,0x08,0x0A,0x65,0x07,0x01,0x00,0x00,0x02,0x00,
-  0x4C,0x00,0x00,0x02,0x79,0x02,0xD9,0x00,0x0C,0x00,0x17,
-  0x00,0x00,0x13,0x33,0x32,0x17,0x16,0x15,0x14,0x07,0x06,
-  0x23,0x21,0x11,0x33,0x11,0x15,0x33,0x32,0x37,0x36,0x35,
-  0x34,0x27,0x26,0x23,0xE2,0xBB,0x7C,0x3B,0x25,0x89,0x2B,
-  0x37,0xFE,0xBE,0x96,0x8C,0x6C,0x08,0x01,0x63,0x09,0x09,
-  0x01,0xD5,0x60,0x3D,0x56,0xA8,0x2C,0x0E,0x02,0xD9,0xFE,
-  0x7F,0xDB,0x5C,0x08,0x0A,0x65,0x07,0x01,0x00,0x00,0x01,
-  0x00,0x2C,0xFF,0xE9,0x02,0xAD,0x02,0xE5,0x00,0x26,0x00,
-  0x00,0x13,0x35,0x21,0x26,0x27,0x26,0x23,0x22,0x07,0x06,
-  0x07,0x23,0x36,0x37,0x36,0x37,0x32,0x33,0x32,0x17,0x16,
-  0x15,0x14,0x07,0x06,0x23,0x22,0x27,0x26,0x27,0x33,0x16,
-  0x17,0x16,0x33,0x32,0x37,0x36,0x37,0xF1,0x01,0x23,0x16,
-  0x5E,0x20,0x26,0x51,0x2A,0x15,0x0C,0x8F,0x07,0x2A,0x53,
-  0x9E,0x07,0x07,0xB0,0x5A,0x44,0x76,0x55,0x7F,0xA5,0x55,
-  0x38,0x05,0x92,0x0A,0x5B,0x1B,0x21,0x77,0x2C,0x0E,0x05,
-  0x01,0x37,0x7D,0x7E,0x26,0x0D,0x35,0x1A,0x34,0x58,0x38,
-  0x6E,0x05,0x83,0x63,0x99,0xCD,0x67,0x49,0x69,0x44,0x63,
-  0x6C,0x1D,0x09,0x76,0x28,0x32,0x00,0x02,0x00,0x44,0xFF,
-  0xE9,0x04,0x13,0x02,0xE5,0x00,0x20,0x00,0x33,0x00,0x00,
-  0x01,0x36,0x37,0x36,0x33,0x32,0x17,0x16,0x17,0x16,0x17,
-  0x14,0x15,0x14,0x07,0x06,0x07,0x06,0x07,0x06,0x23,0x22,
-  0x27,0x26,0x27,0x26,0x27,0x23,0x11,0x23,0x11,0x33,0x11,
-  0x25,0x22,0x07,0x06,0x15,0x14,0x1F,0x01,0x16,0x33,0x32,
-  0x37,0x36,0x35,0x34,0x27,0x26,0x27,0x26,0x01,0x6F,0x14,
-  0x4C,0x5D,0x91,0x85,0x57,0x0A,0x0A,0x62,0x04,0x47,0x0E,
-  0x11,0x57,0x82,0x0D,0x09,0x8A,0x5A,0x05,0x06,0x55,0x0E,
-  0x92,0x96,0x96,0x01,0xE4,0x71,0x32,0x1C,0x55,0x01,0x2C,
-  0x3D,0x6E,0x32,0x1F,0x5D,0x22,0x2D,0x09,0x01,0xB4,0x7A,
-  0x52,0x65,0x51,0x09,0x0B,0x69,0xA8,0x06,0x07,0x85,0x68,
-  0x15,0x12,0x5E,0x06,0x01,0x59,0x06,0x06,0x5B,0x8E,0xFE,
-  0xC9,0x02,0xD9,0xFE,0xDB,0xB1,0x6B,0x3D,0x56,0x9C,0x40,
-  0x01,0x21,0x65,0x3E,0x57,0xA9,0x3D,0x17,0x04,0x01,0x00,
-  0x02,0x00,0x16,0x00,0x00,0x02,0x79,0x02,0xD9,0x00,0x0F,
-  0x00,0x1A,0x00,0x00,0x01,0x03,0x23,0x13,0x26,0x27,0x26,
-  0x35,0x34,0x37,0x36,0x33,0x21,0x11,0x23,0x11,0x3D,0x01,
-  0x23,0x22,0x07,0x06,0x15,0x14,0x17,0x16,0x33,0x01,0xA6,
-  0xDD,0xB3,0xDC,0x58,0x2E,0x20,0x89,0x2B,0x37,0x01,0x42,
-  0x96,0x8C,0x6C,0x08,0x01,0x63,0x09,0x09,0x01,0x04,0xFE,
-  0xFC,0x01,0x09,0x11,0x53,0x3B,0x4F,0xA8,0x2C,0x0E,0xFD,
-  0x27,0x01,0x04,0x7D,0xDB,0x5C,0x08,0x0A,0x65,0x07,0x01,
-  0x00,0xFF,0xFF,0x00,0x1C,0xFF,0xE9,0x02,0x0C,0x02,0x25,
-  0x10,0x06,0x00,0x44,0x00,0x00,0x00,0x02,0x00,0x32,0xFF,
-  0xE9,0x02,0x35,0x03,0x09,0x00,0x2C,0x00,0x3D,0x00,0x00,
-  0x01,0x37,0x14,0x07,0x06,0x07,0x06,0x07,0x36,0x07,0x06,
-  0x07,0x06,0x07,0x14,0x15,0x36,0x33,0x32,0x17,0x16,0x17,
-  0x16,0x15,0x14,0x07,0x06,0x23,0x22,0x27,0x26,0x35,0x10,
-  0x37,0x36,0x37,0x36,0x3F,0x01,0x36,0x37,0x36,0x37,0x35,
-  0x36,0x03,0x22,0x07,0x31,0x06,0x15,0x14,0x17,0x16,0x33,
-  0x32,0x37,0x36,0x35,0x34,0x27,0x26,0x01,0xB6,0x68,0x13,
-  0x05,0x09,0x2B,0x53,0x0F,0x20,0x4B,0x26,0x50,0x04,0x2B,
-  0x7E,0x55,0x3D,0x0D,0x0A,0x3A,0x5F,0x42,0x63,0x9C,0x39,
-  0x2A,0x7A,0x0B,0x0D,0x25,0x75,0x0A,0x10,0x0A,0x2A,0x09,
-  0x01,0x83,0x42,0x21,0x13,0x3C,0x19,0x21,0x40,0x22,0x14,
-  0x38,0x1C,0x03,0x08,0x01,0x47,0x1A,0x07,0x07,0x1F,0x09,
-  0x01,0x03,0x09,0x17,0x31,0x4C,0x03,0x02,0x57,0x3C,0x0D,
-  0x0E,0x54,0x73,0x9B,0x4E,0x35,0x66,0x4A,0x8B,0x01,0x13,
-  0x64,0x09,0x08,0x17,0x0D,0x01,0x02,0x01,0x05,0x2A,0x01,
-  0x04,0xFE,0xA8,0x47,0x2A,0x36,0x6D,0x2B,0x13,0x45,0x2B,
-  0x38,0x66,0x2E,0x16,0x00,0x00,0x03,0x00,0x3C,0x00,0x00,
-  0x02,0x06,0x02,0x1C,0x00,0x16,0x00,0x25,0x00,0x30,0x00,
-  0x00,0x33,0x11,0x21,0x32,0x17,0x16,0x17,0x14,0x07,0x06,
-  0x07,0x16,0x17,0x16,0x15,0x14,0x0F,0x01,0x23,0x06,0x07,
-  0x06,0x23,0x03,0x15,0x33,0x32,0x37,0x33,0x36,0x35,0x34,
-  0x27,0x22,0x31,0x23,0x26,0x23,0x07,0x15,0x33,0x32,0x37,
-  0x36,0x35,0x34,0x27,0x26,0x23,0x3C,0x01,0x0A,0x53,0x2D,
-  0x2E,0x03,0x28,0x0F,0x13,0x3F,0x14,0x06,0x2D,0x01,0x01,
-  0x03,0x03,0x2E,0x5A,0x81,0x5E,0x3A,0x0B,0x01,0x04,0x25,
-  0x01,0x01,0x0D,0x16,0x5E,0x64,0x43,0x0A,0x02,0x22,0x0F,
-  0x1E,0x02,0x1C,0x27,0x2D,0x3A,0x37,0x25,0x0E,0x06,0x13,
-  0x45,0x15,0x16,0x41,0x2C,0x01,0x03,0x03,0x27,0x01,0xAE,
-  0x61,0x17,0x0A,0x0E,0x27,0x08,0x03,0xCF,0x71,0x27,0x09,
-  0x0C,0x29,0x08,0x04,0x00,0x01,0x00,0x3C,0x00,0x00,0x01,
-  0x98,0x02,0x1C,0x00,0x05,0x00,0x00,0x01,0x15,0x23,0x11,
-  0x23,0x11,0x01,0x98,0xD0,0x8C,0x02,0x1C,0x71,0xFE,0x55,
-  0x02,0x1C,0x00,0x00,0x02,0x00,0x17,0xFF,0x83,0x02,0x96,
-  0x02,0x1C,0x00,0x0F,0x00,0x15,0x00,0x00,0x25,0x33,0x15,
-  0x23,0x35,0x21,0x15,0x23,0x35,0x33,0x36,0x37,0x36,0x3D,
-  0x01,0x21,0x01,0x33,0x11,0x23,0x15,0x14,0x02,0x44,0x52,
-  0x6E,0xFE,0x5D,0x6E,0x3E,0x31,0x14,0x08,0x01,0xA2,0xFE,
-  0xC3,0xB1,0x8A,0x65,0xE2,0x7D,0x7D,0xE2,0x01,0x97,0x3F,
-  0x48,0x98,0xFE,0x55,0x01,0x3A,0x33,0xAF,0x00,0xFF,0xFF,
-  0x00,0x16,0xFF,0xE9,0x02,0x0D,0x02,0x25,0x10,0x06,0x00,
-  0x48,0x00,0x00,0x00,0x01,0x00,0x10,0x00,0x00,0x03,0x14,
-  0x02,0x1C,0x00,0x11,0x00,0x00,0x25,0x07,0x23,0x13,0x27,
-  0x33,0x17,0x35,0x33,0x15,0x37,0x33,0x07,0x13,0x23,0x27,
-  0x15,0x23,0x01,0x4C,0x89,0xB3,0xD5,0xB1,0x94,0x84,0x8C,
-  0x84,0x94,0xB1,0xD5,0xB3,0x89,0x8C,0xC6,0xC6,0x01,0x28,
-  0xF4,0xBD,0xBD,0xBD,0xBD,0xF4,0xFE,0xD8,0xC6,0xC6,0x00,
-  0x01,0x00,0x1D,0xFF,0xE9,0x02,0x08,0x02,0x25,0x00,0x3A,
-  0x00,0x00,0x37,0x35,0x33,0x32,0x37,0x34,0x35,0x14,0x35,
-  0x34,0x27,0x26,0x23,0x22,0x07,0x23,0x36,0x37,0x36,0x33,
-  0x32,0x17,0x16,0x17,0x16,0x15,0x14,0x0F,0x01,0x16,0x15,
-  0x14,0x07,0x06,0x07,0x06,0x23,0x22,0x27,0x26,0x35,0x33,
-  0x16,0x17,0x16,0x33,0x32,0x37,0x36,0x35,0x34,0x2F,0x01,
-  0x30,0x39,0x01,0x23,0x26,0x23,0xCE,0x5E,0x3E,0x03,0x2D,
-  0x10,0x14,0x64,0x01,0x87,0x02,0x67,0x37,0x4B,0x8B,0x38,
-  0x15,0x05,0x01,0x1E,0x0E,0x3B,0x3C,0x02,0x02,0x3C,0x70,
-  0xE8,0x15,0x02,0x89,0x08,0x13,0x1D,0x36,0x5A,0x0C,0x02,
-  0x19,0x01,0x01,0x14,0x23,0xD0,0x6E,0x32,0x03,0x03,0x09,
-  0x18,0x22,0x0C,0x04,0x49,0x71,0x2E,0x18,0x54,0x20,0x29,
-  0x0B,0x0C,0x37,0x21,0x0A,0x25,0x4A,0x50,0x33,0x02,0x02,
-  0x30,0x9D,0x0B,0x0C,0x24,0x0F,0x13,0x2A,0x05,0x06,0x2A,
-  0x0E,0x01,0x0B,0x00,0x01,0x00,0x3C,0x00,0x00,0x02,0x2B,
-  0x02,0x1C,0x00,0x09,0x00,0x00,0x13,0x33,0x11,0x13,0x33,
-  0x11,0x23,0x11,0x03,0x23,0x3C,0x8C,0xC3,0xA0,0x8C,0xC3,
-  0xA0,0x02,0x1C,0xFE,0xAE,0x01,0x52,0xFD,0xE4,0x01,0x52,
-  0xFE,0xAE,0x00,0x00,0x02,0x00,0x3C,0x00,0x00,0x02,0x2B,
-  0x02,0xD3,0x00,0x09,0x00,0x1C,0x00,0x00,0x13,0x33,0x11,
-  0x13,0x33,0x11,0x23,0x11,0x03,0x23,0x01,0x15,0x14,0x07,
-  0x06,0x23,0x22,0x27,0x35,0x26,0x3D,0x01,0x33,0x16,0x33,
-  0x32,0x37,0x34,0x37,0x3C,0x8C,0xC3,0xA0,0x8C,0xC3,0xA0,
-  0x01,0x7C,0x39,0x21,0x2A,0x48,0x26,0x16,0x38,0x09,0x44,
-  0x3D,0x0D,0x01,0x02,0x1C,0xFE,0xAE,0x01,0x52,0xFD,0xE4,
-  0x01,0x52,0xFE,0xAE,0x02,0xD3,0x0B,0x47,0x27,0x16,0x39,
-  0x01,0x21,0x2A,0x0A,0x42,0x3B,0x03,0x04,0x00,0x00,0x01,
-  0x00,0x3C,0x00,0x00,0x02,0x25,0x02,0x1C,0x00,0x0A,0x00,
-  0x00,0x13,0x37,0x33,0x07,0x13,0x23,0x27,0x15,0x23,0x11,
-  0x33,0xC8,0xA2,0x94,0xD6,0xFD,0xB6,0xA7,0x8C,0x8C,0x01,
-  0x5F,0xBD,0xF4,0xFE,0xD8,0xC6,0xC6,0x02,0x1C,0x00,0x01,
-  0x00,0x1D,0xFF,0xF6,0x02,0x05,0x02,0x1C,0x00,0x11,0x00,
-  0x00,0x13,0x21,0x11,0x23,0x11,0x23,0x15,0x10,0x07,0x06,
-  0x07,0x22,0x23,0x35,0x36,0x37,0x36,0x35,0x68,0x01,0x9D,
-  0x8C,0x85,0x59,0x2B,0x43,0x08,0x08,0x39,0x0D,0x05,0x02,
-  0x1C,0xFD,0xE4,0x01,0xAB,0x3D,0xFE,0xFD,0x4C,0x25,0x04,
-  0x87,0x01,0x6A,0x2C,0x66,0x00,0x01,0x00,0x3C,0x00,0x00,
-  0x02,0x5E,0x02,0x1C,0x00,0x0C,0x00,0x00,0x21,0x23,0x03,
-  0x11,0x23,0x11,0x33,0x1B,0x01,0x33,0x11,0x23,0x11,0x01,
-  0x71,0x48,0x61,0x8C,0xAF,0x62,0x62,0xAF,0x8C,0x01,0x29,
-  0xFE,0xD7,0x02,0x1C,0xFE,0xB9,0x01,0x47,0xFD,0xE4,0x01,
-  0x29,0x00,0x00,0x01,0x00,0x3C,0x00,0x00,0x02,0x1F,0x02,
-  0x1C,0x00,0x0B,0x00,0x00,0x13,0x33,0x15,0x33,0x35,0x33,
-  0x11,0x23,0x35,0x23,0x15,0x23,0x3C,0x8C,0xCB,0x8C,0x8C,
-  0xCB,0x8C,0x02,0x1C,0xDC,0xDC,0xFD,0xE4,0xCF,0xCF,0x00,
-  0xFF,0xFF,0x00,0x23,0xFF,0xE9,0x02,0x39,0x02,0x25,0x10,
-  0x06,0x00,0x52,0x00,0x00,0x00,0x01,0x00,0x3C,0x00,0x00,
-  0x02,0x1F,0x02,0x1C,0x00,0x07,0x00,0x00,0x13,0x21,0x11,
-  0x23,0x11,0x23,0x11,0x23,0x3C,0x01,0xE3,0x8C,0xCB,0x8C,
-  0x02,0x1C,0xFD,0xE4,0x01,0xAB,0xFE,0x55,0x00,0x02,0x00,
-  0x3C,0xFF,0x26,0x02,0x40,0x02,0x25,0x00,0x12,0x00,0x22,
-  0x00,0x00,0x13,0x15,0x36,0x33,0x32,0x17,0x16,0x17,0x16,
-  0x17,0x14,0x07,0x06,0x23,0x22,0x27,0x11,0x23,0x11,0x05,
-  0x22,0x07,0x06,0x15,0x14,0x17,0x16,0x33,0x32,0x37,0x36,
-  0x35,0x34,0x27,0x26,0xC8,0x32,0x64,0x51,0x3E,0x0E,0x0B,
-  0x38,0x02,0x4F,0x3E,0x55,0x64,0x32,0x8C,0x01,0x02,0x43,
-  0x20,0x13,0x3A,0x1B,0x21,0x41,0x21,0x14,0x3B,0x1A,0x02,
-  0x1C,0x50,0x59,0x38,0x0E,0x0F,0x55,0x75,0x8B,0x53,0x40,
-  0x58,0xFE,0xE6,0x02,0xF6,0x6C,0x48,0x2A,0x38,0x6A,0x2B,
-  0x14,0x45,0x2A,0x38,0x6D,0x2C,0x13,0x00,0xFF,0xFF,0x00,
-  0x22,0xFF,0xE9,0x02,0x0A,0x02,0x25,0x10,0x06,0x00,0x46,
-  0x00,0x00,0x00,0x01,0x00,0x15,0x00,0x00,0x01,0xAF,0x02,
-  0x1C,0x00,0x07,0x00,0x00,0x01,0x15,0x23,0x11,0x23,0x11,
-  0x23,0x35,0x01,0xAF,0x87,0x8C,0x87,0x02,0x1C,0x71,0xFE,
-  0x55,0x01,0xAB,0x71,0x00,0xFF,0xFF,0x00,0x09,0xFF,0x25,
-  0x02,0x1A,0x02,0x1C,0x10,0x06,0x00,0x5C,0x00,0x00,0x00,
-  0x03,0x00,0x1C,0xFF,0x26,0x03,0x98,0x02,0xCF,0x00,0x23,
-  0x00,0x37,0x00,0x49,0x00,0x00,0x25,0x06,0x23,0x22,0x27,
-  0x26,0x35,0x34,0x37,0x36,0x37,0x36,0x37,0x36,0x33,0x32,
-  0x17,0x11,0x33,0x11,0x36,0x33,0x32,0x17,0x16,0x17,0x16,
-  0x17,0x14,0x07,0x06,0x23,0x22,0x27,0x11,0x23,0x03,0x22,
-  0x07,0x06,0x15,0x14,0x17,0x16,0x33,0x32,0x37,0x36,0x35,
-  0x34,0x27,0x30,0x23,0x2F,0x01,0x26,0x21,0x22,0x07,0x06,
-  0x15,0x14,0x17,0x16,0x33,0x32,0x37,0x36,0x35,0x34,0x27,
-  0x30,0x23,0x26,0x01,0x94,0x32,0x64,0x68,0x41,0x39,0x37,
-  0x01,0x02,0x2C,0x50,0x16,0x16,0x64,0x32,0x8C,0x32,0x64,
-  0x51,0x3E,0x0E,0x0B,0x38,0x02,0x4F,0x3E,0x55,0x64,0x32,
-  0x8C,0x76,0x45,0x1F,0x12,0x38,0x1C,0x22,0x43,0x20,0x13,
-  0x3A,0x01,0x01,0x01,0x19,0x01,0x58,0x43,0x20,0x13,0x3A,
-  0x1B,0x21,0x40,0x21,0x15,0x3B,0x01,0x1A,0x40,0x58,0x5B,
-  0x50,0x73,0x75,0x50,0x03,0x02,0x3E,0x12,0x05,0x59,0x01,
-  0x03,0xFE,0xFD,0x59,0x38,0x0E,0x0F,0x55,0x75,0x8B,0x53,
-  0x40,0x58,0xFE,0xE6,0x02,0x8A,0x4A,0x2A,0x38,0x64,0x2D,
-  0x16,0x48,0x29,0x38,0x69,0x2D,0x01,0x01,0x12,0x48,0x2A,
-  0x38,0x6A,0x2B,0x14,0x44,0x2A,0x39,0x6D,0x2C,0x13,0x00,
-  0xFF,0xFF,0x00,0x10,0x00,0x00,0x02,0x17,0x02,0x1C,0x10,
-  0x06,0x00,0x5B,0x00,0x00,0x00,0x01,0x00,0x3C,0xFF,0x83,
-  0x02,0x75,0x02,0x1C,0x00,0x0B,0x00,0x00,0x33,0x11,0x33,
-  0x11,0x33,0x11,0x33,0x11,0x33,0x15,0x23,0x35,0x3C,0x8C,
-  0xCB,0x8C,0x56,0x6E,0x02,0x1C,0xFE,0x55,0x01,0xAB,0xFE,
-  0x49,0xE2,0x7D,0x00,0x01,0x00,0x3C,0x00,0x00,0x02,0x06,
-  0x02,0x1C,0x00,0x12,0x00,0x00,0x13,0x33,0x15,0x14,0x17,
-  0x16,0x3B,0x01,0x11,0x33,0x11,0x23,0x35,0x23,0x22,0x27,
-  0x35,0x26,0x35,0x3C,0x8C,0x1D,0x0A,0x13,0x78,0x8C,0x8C,
-  0x76,0x9B,0x24,0x09,0x02,0x1C,0xD6,0x27,0x07,0x02,0x01,
-  0x06,0xFD,0xE4,0xA5,0x64,0x01,0x1A,0x21,0x00,0x01,0x00,
-  0x3C,0x00,0x00,0x03,0x3A,0x02,0x1C,0x00,0x0B,0x00,0x00,
-  0x29,0x01,0x11,0x33,0x11,0x33,0x11,0x33,0x11,0x33,0x11,
-  0x33,0x03,0x3A,0xFD,0x02,0x8C,0xAB,0x8C,0xAF,0x8C,0x02,
-  0x1C,0xFE,0x55,0x01,0xAB,0xFE,0x55,0x01,0xAB,0x00,0x00,
-  0x01,0x00,0x3C,0xFF,0x83,0x03,0xB1,0x02,0x1C,0x00,0x0F,
-  0x00,0x00,0x29,0x01,0x11,0x33,0x11,0x33,0x11,0x33,0x11,
-  0x33,0x11,0x33,0x11,0x33,0x15,0x23,0x03,0x43,0xFC,0xF9,
-  0x8C,0xAB,0x8C,0xAE,0x8C,0x78,0x6E,0x02,0x1C,0xFE,0x55,
-  0x01,0xAB,0xFE,0x55,0x01,0xAB,0xFE,0x49,0xE2,0x00,0x02,
-  0x00,0x14,0x00,0x00,0x02,0x97,0x02,0x1C,0x00,0x10,0x00,
-  0x19,0x00,0x00,0x33,0x11,0x23,0x35,0x21,0x15,0x33,0x32,
-  0x17,0x16,0x15,0x14,0x07,0x06,0x07,0x06,0x23,0x27,0x15,
-  0x33,0x36,0x37,0x34,0x27,0x26,0x23,0xBF,0xAB,0x01,0x37,
-  0x6C,0x8F,0x37,0x1A,0x22,0x09,0x0A,0x2E,0x5A,0x8F,0x6D,
-  0x4E,0x06,0x43,0x0A,0x0C,0x01,0xAB,0x71,0xB5,0x5C,0x2B,
-  0x38,0x3C,0x30,0x0D,0x08,0x27,0xF9,0x8B,0x09,0x3D,0x3A,
-  0x0A,0x01,0x00,0x00,0x03,0x00,0x3C,0x00,0x00,0x02,0xCE,
-  0x02,0x1C,0x00,0x0E,0x00,0x17,0x00,0x1B,0x00,0x00,0x01,
-  0x32,0x17,0x16,0x15,0x14,0x07,0x06,0x07,0x06,0x23,0x21,
-  0x11,0x33,0x1D,0x02,0x33,0x36,0x37,0x34,0x27,0x26,0x23,
-  0x01,0x11,0x23,0x11,0x01,0x34,0x8F,0x37,0x1A,0x22,0x09,
-  0x0A,0x2E,0x5A,0xFE,0xE5,0x8C,0x6D,0x4E,0x06,0x43,0x0A,
-  0x0C,0x01,0x9E,0x8C,0x01,0x67,0x5C,0x2B,0x38,0x3C,0x30,
-  0x0D,0x08,0x27,0x02,0x1C,0xB5,0x6E,0x8B,0x09,0x3D,0x3A,
-  0x0A,0x01,0x01,0x23,0xFD,0xE4,0x02,0x1C,0x00,0x00,0x02,
-  0x00,0x3C,0x00,0x00,0x02,0x14,0x02,0x1C,0x00,0x0E,0x00,
-  0x17,0x00,0x00,0x01,0x32,0x17,0x16,0x15,0x14,0x07,0x06,
-  0x07,0x06,0x23,0x21,0x11,0x33,0x1D,0x02,0x33,0x36,0x37,
-  0x34,0x27,0x26,0x23,0x01,0x34,0x8F,0x37,0x1A,0x22,0x09,
-  0x0A,0x2E,0x5A,0xFE,0xE5,0x8C,0x6D,0x4E,0x06,0x43,0x0A,
-  0x0C,0x01,0x67,0x5C,0x2B,0x38,0x3C,0x30,0x0D,0x08,0x27,
-  0x02,0x1C,0xB5,0x6E,0x8B,0x09,0x3D,0x3A,0x0A,0x01,0x00,
-  0x01,0x00,0x22,0xFF,0xE9,0x02,0x0A,0x02,0x25,0x00,0x24,
-  0x00,0x00,0x37,0x35,0x33,0x26,0x27,0x26,0x23,0x22,0x07,
-  0x06,0x07,0x23,0x36,0x37,0x36,0x33,0x32,0x17,0x16,0x15,
-  0x14,0x07,0x06,0x23,0x22,0x27,0x26,0x27,0x33,0x16,0x17,
-  0x16,0x33,0x32,0x37,0x36,0x37,0xCB,0xAE,0x08,0x0E,0x19,
-  0x3E,0x3D,0x18,0x09,0x06,0x86,0x0A,0x67,0x34,0x44,0x9F,
-  0x3F,0x21,0x74,0x39,0x50,0x80,0x41,0x23,0x07,0x86,0x14,
-  0x2F,0x0E,0x13,0x4A,0x1B,0x06,0x03,0xCF,0x71,0x2C,0x1A,
-  0x2E,0x33,0x13,0x1C,0x84,0x35,0x1A,0x7F,0x43,0x60,0xB4,
-  0x44,0x22,0x5C,0x31,0x45,0x4E,0x0F,0x04,0x52,0x10,0x13,
-  0x00,0x00,0x02,0x00,0x3C,0xFF,0xE9,0x03,0x2C,0x02,0x25,
-  0x00,0x16,0x00,0x26,0x00,0x00,0x25,0x23,0x15,0x23,0x11,
-  0x33,0x15,0x33,0x36,0x37,0x36,0x33,0x32,0x17,0x16,0x15,
-  0x14,0x07,0x06,0x23,0x22,0x27,0x26,0x13,0x22,0x07,0x06,
-  0x15,0x14,0x17,0x16,0x33,0x32,0x37,0x36,0x35,0x34,0x27,
-  0x26,0x01,0x2E,0x66,0x8C,0x8C,0x66,0x17,0x83,0x2C,0x36,
-  0xB3,0x38,0x17,0x6D,0x3D,0x57,0xAA,0x3C,0x11,0xF7,0x4E,
-  0x1C,0x0B,0x42,0x16,0x1D,0x4C,0x1C,0x0D,0x48,0x14,0xCF,
-  0xCF,0x02,0x1C,0xDC,0xA7,0x2E,0x10,0x95,0x3C,0x51,0xAB,
-  0x47,0x28,0x8E,0x27,0x01,0x16,0x59,0x24,0x30,0x7A,0x26,
-  0x0D,0x54,0x26,0x31,0x84,0x22,0x09,0x00,0x02,0x00,0x19,
-  0x00,0x00,0x02,0x13,0x02,0x1C,0x00,0x11,0x00,0x1D,0x00,
-  0x00,0x25,0x07,0x23,0x37,0x26,0x27,0x26,0x35,0x34,0x37,
-  0x36,0x37,0x36,0x33,0x21,0x11,0x23,0x3D,0x02,0x23,0x22,
-  0x07,0x06,0x15,0x14,0x17,0x31,0x16,0x33,0x01,0x5B,0x8F,
-  0xB3,0x9B,0x5C,0x1C,0x09,0x2D,0x04,0x04,0x2E,0x5A,0x01,
-  0x23,0x8C,0x7A,0x43,0x0A,0x02,0x22,0x0F,0x1E,0xCF,0xCF,
-  0xDA,0x19,0x52,0x1C,0x20,0x41,0x2C,0x04,0x03,0x27,0xFD,
-  0xE4,0xCF,0x6E,0x71,0x27,0x09,0x0C,0x29,0x08,0x04,0x00,
-  0xFF,0xFF,0x00,0x16,0xFF,0xE9,0x02,0x0D,0x03,0x16,0x10,
-  0x26,0x00,0x48,0x00,0x00,0x10,0x07,0x00,0x43,0x00,0x91,
-  0x00,0x21,0xFF,0xFF,0x00,0x16,0xFF,0xE9,0x02,0x0D,0x02,
-  0xE7,0x10,0x26,0x00,0x48,0x00,0x00,0x10,0x06,0x00,0x69,
-  0x72,0x00,0x00,0x01,0x00,0x16,0xFF,0x52,0x02,0x38,0x02,
-  0xD9,0x00,0x29,0x00,0x00,0x25,0x27,0x35,0x34,0x27,0x26,
-  0x23,0x22,0x07,0x35,0x33,0x35,0x23,0x35,0x23,0x15,0x23,
-  0x15,0x33,0x11,0x33,0x11,0x31,0x34,0x37,0x36,0x33,0x32,
-  0x17,0x16,0x15,0x17,0x06,0x07,0x06,0x07,0x15,0x16,0x37,
-  0x36,0x37,0x36,0x02,0x38,0x01,0x37,0x31,0x48,0x65,0x3A,
-  0xAA,0xAA,0x8C,0x46,0x46,0x8C,0x0E,0x1D,0x42,0x2E,0x18,
-  0x10,0x01,0x04,0x4C,0x2A,0x26,0x27,0x4E,0x6A,0x30,0x1A,
-  0x84,0xDD,0x01,0x63,0x2E,0x29,0x57,0x72,0x68,0x3A,0x3A,
-  0x68,0xFD,0xC9,0x01,0x3B,0x1C,0x1A,0x34,0x21,0x18,0x2B,
-  0xD1,0x6F,0x46,0x28,0x01,0x3E,0x09,0x2F,0x40,0x60,0x34,
-  0x00,0x00,0x02,0x00,0x3C,0x00,0x00,0x01,0x98,0x03,0x16,
-  0x00,0x05,0x00,0x09,0x00,0x00,0x01,0x15,0x23,0x11,0x23,
-  0x11,0x25,0x07,0x23,0x37,0x01,0x98,0xD0,0x8C,0x01,0x10,
-  0x7E,0x46,0x46,0x02,0x1C,0x71,0xFE,0x55,0x02,0x1C,0xFA,
-  0x96,0x96,0x00,0x00,0x01,0x00,0x22,0xFF,0xE9,0x02,0x0A,
-  0x02,0x25,0x00,0x29,0x00,0x00,0x25,0x23,0x16,0x17,0x16,
-  0x33,0x32,0x37,0x35,0x37,0x36,0x37,0x33,0x06,0x07,0x06,
-  0x23,0x22,0x27,0x26,0x35,0x34,0x37,0x36,0x33,0x32,0x17,
-  0x16,0x17,0x16,0x17,0x23,0x26,0x2F,0x01,0x26,0x23,0x22,
-  0x07,0x06,0x07,0x33,0x01,0x61,0xAF,0x10,0x43,0x0D,0x0E,
-  0x3C,0x1A,0x01,0x07,0x06,0x86,0x0D,0x60,0x37,0x47,0x9E,
-  0x3E,0x21,0x77,0x39,0x4F,0x8A,0x3D,0x13,0x09,0x04,0x02,
-  0x86,0x11,0x2C,0x01,0x10,0x16,0x3E,0x19,0x0E,0x08,0xAE,
-  0xCF,0x60,0x12,0x03,0x37,0x01,0x01,0x11,0x17,0x7C,0x37,
-  0x1F,0x7C,0x42,0x5C,0xBB,0x46,0x21,0x62,0x21,0x28,0x13,
-  0x15,0x4D,0x0F,0x01,0x05,0x2E,0x1A,0x2C,0x00,0x01,0x00,
-  0x1D,0xFF,0xE9,0x02,0x08,0x02,0x25,0x00,0x36,0x00,0x00,
-  0x01,0x23,0x26,0x23,0x22,0x07,0x14,0x31,0x06,0x15,0x14,
-  0x17,0x33,0x16,0x1F,0x01,0x16,0x15,0x14,0x07,0x06,0x07,
-  0x06,0x23,0x22,0x27,0x26,0x35,0x33,0x16,0x17,0x16,0x33,
-  0x32,0x37,0x36,0x35,0x34,0x27,0x26,0x2F,0x01,0x26,0x27,
-  0x26,0x27,0x26,0x35,0x34,0x37,0x36,0x33,0x32,0x17,0x16,
-  0x01,0xF9,0x87,0x01,0x64,0x40,0x0E,0x03,0x18,0x01,0x08,
-  0x10,0xB1,0x6A,0x3C,0x02,0x02,0x3C,0x70,0xE8,0x15,0x02,
-  0x89,0x08,0x13,0x1D,0x36,0x5A,0x0C,0x02,0x1F,0x07,0x09,
-  0xA7,0x3E,0x17,0x01,0x02,0x1E,0x60,0x34,0x4A,0x98,0x39,
-  0x19,0x01,0x6E,0x49,0x23,0x01,0x07,0x07,0x16,0x0B,0x04,
-  0x05,0x33,0x1F,0x69,0x50,0x33,0x02,0x02,0x30,0x9D,0x0B,
-  0x0C,0x24,0x0F,0x13,0x2A,0x05,0x06,0x1A,0x0C,0x03,0x03,
-  0x34,0x14,0x16,0x01,0x02,0x21,0x37,0x6C,0x2E,0x1A,0x5B,
-  0x27,0xFF,0xFF,0x00,0x43,0x00,0x00,0x00,0xCF,0x02,0xD9,
-  0x10,0x06,0x00,0x4C,0x00,0x00,0xFF,0xFF,0xFF,0xF7,0x00,
-  0x00,0x01,0x1F,0x02,0xE7,0x10,0x26,0x00,0xF1,0x00,0x00,
-  0x10,0x06,0x00,0x69,0xE5,0x00,0xFF,0xFF,0x00,0x04,0xFF,
-  0x26,0x00,0xD2,0x02,0xD9,0x10,0x06,0x00,0x4D,0x00,0x00,
-  0x00,0x02,0x00,0x1D,0x00,0x00,0x03,0x5F,0x02,0x1C,0x00,
-  0x23,0x00,0x31,0x00,0x00,0x21,0x11,0x23,0x15,0x10,0x07,
-  0x06,0x07,0x23,0x35,0x36,0x37,0x36,0x3D,0x02,0x21,0x15,
-  0x33,0x32,0x17,0x16,0x07,0x34,0x15,0x14,0x1D,0x01,0x14,
-  0x07,0x06,0x07,0x06,0x07,0x06,0x23,0x27,0x15,0x33,0x32,
-  0x37,0x36,0x37,0x35,0x34,0x27,0x26,0x27,0x26,0x23,0x01,
-  0x93,0x9F,0x59,0x2B,0x43,0x10,0x39,0x0D,0x05,0x01,0xB7,
-  0x6C,0x8F,0x37,0x0E,0x01,0x18,0x04,0x04,0x09,0x0A,0x2A,
-  0x53,0x8F,0x6D,0x3B,0x0F,0x0B,0x02,0x1E,0x0A,0x1E,0x0A,
-  0x0C,0x01,0xAB,0x33,0xFE,0xFE,0x4D,0x25,0x04,0x87,0x01,
-  0x6A,0x2C,0x65,0x01,0x98,0xDD,0x5C,0x17,0x23,0x04,0x09,
-  0x0A,0x06,0x01,0x2B,0x24,0x05,0x06,0x0D,0x08,0x24,0xD1,
-  0x63,0x0C,0x0A,0x13,0x09,0x20,0x09,0x02,0x05,0x01,0x00,
-  0x02,0x00,0x3F,0x00,0x00,0x03,0x62,0x02,0x1C,0x00,0x1D,
-  0x00,0x2B,0x00,0x00,0x01,0x15,0x33,0x32,0x17,0x16,0x07,
-  0x34,0x15,0x14,0x1D,0x01,0x14,0x07,0x06,0x07,0x06,0x07,
-  0x06,0x23,0x21,0x35,0x23,0x15,0x23,0x11,0x33,0x15,0x33,
-  0x35,0x13,0x15,0x33,0x32,0x37,0x36,0x37,0x35,0x34,0x27,
-  0x26,0x27,0x26,0x23,0x02,0x22,0x6C,0x8F,0x37,0x0E,0x01,
-  0x18,0x04,0x04,0x09,0x0A,0x2A,0x53,0xFE,0xE5,0xCB,0x8C,
-  0x8C,0xCB,0x8C,0x6D,0x3B,0x0F,0x0B,0x02,0x1E,0x0A,0x1E,
-  0x0A,0x0C,0x02,0x1C,0xDD,0x5C,0x17,0x23,0x04,0x09,0x0A,
-  0x06,0x01,0x2B,0x24,0x05,0x06,0x0D,0x08,0x24,0xCF,0xCF,
-  0x02,0x1C,0xDC,0xDC,0xFE,0xB5,0x63,0x0C,0x0A,0x13,0x09,
-  0x20,0x09,0x02,0x05,0x01,0x00,0x00,0x01,0x00,0x16,0x00,
-  0x00,0x02,0x37,0x02,0xD9,0x00,0x1F,0x00,0x00,0x13,0x33,
-  0x15,0x33,0x15,0x23,0x15,0x36,0x33,0x32,0x17,0x16,0x1D,
-  0x01,0x03,0x23,0x13,0x34,0x27,0x26,0x23,0x22,0x07,0x06,
-  0x15,0x31,0x11,0x23,0x11,0x23,0x35,0x33,0x5C,0x8C,0xAA,
-  0xAA,0x3A,0x65,0x48,0x31,0x37,0x01,0x8C,0x01,0x10,0x18,
-  0x2E,0x42,0x1D,0x0E,0x8C,0x46,0x46,0x02,0xD9,0x3A,0x68,
-  0x72,0x57,0x29,0x2E,0x63,0x01,0xFE,0x9F,0x01,0x41,0x2B,
-  0x18,0x21,0x34,0x1A,0x1C,0xFE,0xC5,0x02,0x37,0x68,0x00,
-  0x02,0x00,0x3B,0x00,0x00,0x02,0x24,0x03,0x16,0x00,0x0A,
-  0x00,0x0E,0x00,0x00,0x13,0x37,0x33,0x07,0x13,0x23,0x27,
-  0x15,0x23,0x11,0x33,0x37,0x07,0x23,0x37,0xC7,0xA2,0x94,
-  0xD6,0xFD,0xB6,0xA7,0x8C,0x8C,0xB7,0x7E,0x46,0x46,0x01,
-  0x5F,0xBD,0xF4,0xFE,0xD8,0xC6,0xC6,0x02,0x1C,0xFA,0x96,
-  0x96,0x00,0x00,0x02,0x00,0x3C,0x00,0x00,0x02,0x1F,0x03,
-  0x16,0x00,0x09,0x00,0x0D,0x00,0x00,0x13,0x33,0x11,0x13,
-  0x33,0x11,0x23,0x11,0x03,0x23,0x13,0x33,0x17,0x23,0x3C,
-  0x8C,0xBC,0x9B,0x8C,0xBC,0x9B,0x90,0x7E,0x46,0x46,0x02,
-  0x1C,0xFE,0xA9,0x01,0x57,0xFD,0xE4,0x01,0x57,0xFE,0xA9,
-  0x03,0x16,0x96,0xFF,0xFF,0x00,0x09,0xFF,0x25,0x02,0x1A,
-  0x03,0x0F,0x10,0x26,0x00,0x5C,0x00,0x00,0x10,0x06,0x01,
-  0x47,0x6A,0x23,0x00,0x01,0x00,0x3C,0xFF,0x83,0x02,0x20,
-  0x02,0x1C,0x00,0x0B,0x00,0x00,0x21,0x15,0x23,0x35,0x23,
-  0x11,0x33,0x11,0x33,0x11,0x33,0x11,0x01,0x65,0x6E,0xBB,
-  0x8C,0xCC,0x8C,0x7D,0x7D,0x02,0x1C,0xFE,0x55,0x01,0xAB,
-  0xFD,0xE4,0x00,0x00,0x02,0x00,0x4C,0x00,0x00,0x02,0x79,
-  0x02,0xD9,0x00,0x0C,0x00,0x17,0x00,0x00,0x13,0x33,0x32,
-  0x17,0x16,0x15,0x14,0x07,0x06,0x23,0x21,0x11,0x33,0x11,
-  0x15,0x33,0x32,0x37,0x36,0x35,0x34,0x27,0x26,0x23,0xE2,
-  0xBB,0x7C,0x3B,0x25,0x89,0x2B,0x37,0xFE,0xBE,0x96,0x8C,
-  0x6C,0x08,0x01,0x63,0x09,0x09,0x01,0xD5,0x60,0x3D,0x56,
-  0xA8,0x2C,0x0E,0x02,0xD9,0xFE,0x7F,0xDB,0x5C,0x08,0x0A,
-  0x65,0x07,0x01,0x00,0x00,0x02,0x00,0x3C,0x00,0x00,0x02,
-  0x1C,0x02,0x1C,0x00,0x10,0x00,0x1B,0x00,0x00,0x01,0x32,
-  0x17,0x16,0x17,0x14,0x0F,0x01,0x23,0x06,0x07,0x06,0x23,
-  0x21,0x11,0x33,0x1D,0x02,0x33,0x32,0x37,0x36,0x35,0x34,
-  0x27,0x26,0x23,0x01,0x3C,0xB6,0x23,0x06,0x01,0x2D,0x01,
-  0x01,0x03,0x03,0x2E,0x5A,0xFE,0xDD,0x8C,0x7A,0x43,0x0A,
-  0x02,0x22,0x0F,0x1E,0x01,0x4D,0x7E,0x18,0x1C,0x41,0x2C,
-  0x01,0x03,0x03,0x27,0x02,0x1C,0xCF,0x6E,0x71,0x27,0x09,
-  0x0C,0x29,0x08,0x04,0xFF,0xFF,0x00,0x4C,0x00,0x00,0x02,
-  0x79,0x02,0xD9,0x10,0x06,0x00,0x33,0x00,0x00,0xFF,0xFF,
-  0x00,0x3A,0xFF,0x26,0x02,0x3E,0x02,0x25,0x10,0x06,0x00,
-  0x53,0x00,0x00,0x00,0x01,0x00,0x4A,0x00,0x00,0x02,0x4A,
-  0x03,0x60,0x00,0x07,0x00,0x00,0x33,0x23,0x11,0x05,0x35,
-  0x33,0x11,0x21,0xE0,0x96,0x01,0x6A,0x96,0xFE,0x96,0x02,
-  0xD9,0x01,0x88,0xFE,0xFC,0x00,0x00,0x01,0x00,0x40,0x00,
-  0x00,0x01,0x9C,0x02,0x9A,0x00,0x07,0x00,0x00,0x01,0x15,
-  0x23,0x11,0x23,0x11,0x33,0x35,0x01,0x9C,0xD0,0x8C,0xDC,
-  0x02,0x9A,0xEF,0xFE,0x55,0x02,0x1C,0x7E,0x00,0x00,0x01,
-  0x00,0x4A,0x00,0x00,0x02,0x4A,0x02,0xD9,0x00,0x05,0x00,
-  0x00,0x33,0x23,0x11,0x21,0x15,0x21,0xE0,0x96,0x02,0x00,
-  0xFE,0x96,0x02,0xD9,0x7D,0x00,0x00,0x01,0x00,0x3C,0x00,
-  0x00,0x01,0x98,0x02,0x1C,0x00,0x05,0x00,0x00,0x01,0x15,
-  0x23,0x11,0x23,0x11,0x01,0x98,0xD0,0x8C,0x02,0x1C,0x71,
-  0xFE,0x55,0x02,0x1C,0x00,0x00,0x01,0x00,0x4A,0x00,0x00,
-  0x02,0x4A,0x02,0xD9,0x00,0x05,0x00,0x00,0x33,0x23,0x11,
-  0x21,0x15,0x21,0xE0,0x96,0x02,0x00,0xFE,0x96,0x02,0xD9,
-  0x7D,0x00,0x00,0x01,0x00,0x3C,0x00,0x00,0x01,0x98,0x02,
-  0x1C,0x00,0x05,0x00,0x00,0x01,0x15,0x23,0x11,0x23,0x11,
-  0x01,0x98,0xD0,0x8C,0x02,0x1C,0x71,0xFE,0x55,0x02,0x1C,
-  0x00,0x00,0x01,0x00,0x16,0x00,0x00,0x04,0x36,0x02,0xD9,
-  0x00,0x11,0x00,0x00,0x09,0x01,0x23,0x09,0x01,0x33,0x13,
-  0x11,0x33,0x11,0x13,0x33,0x09,0x01,0x23,0x01,0x11,0x23,
-  0x01,0xDB,0xFE,0xEE,0xB3,0x01,0x65,0xFE,0xC7,0xA4,0xF5,
-  0x96,0xF5,0xA4,0xFE,0xC7,0x01,0x65,0xB3,0xFE,0xEE,0x96,
-  0x01,0x1D,0xFE,0xE3,0x01,0x7A,0x01,0x5F,0xFE,0xE9,0x01,
-  0x17,0xFE,0xE9,0x01,0x17,0xFE,0xA1,0xFE,0x86,0x01,0x1D,
-  0xFE,0xE3,0x00,0x01,0x00,0x10,0x00,0x00,0x03,0x14,0x02,
-  0x1C,0x00,0x11,0x00,0x00,0x25,0x07,0x23,0x13,0x27,0x33,
-  0x17,0x35,0x33,0x15,0x37,0x33,0x07,0x13,0x23,0x27,0x15,
-  0x23,0x01,0x4C,0x89,0xB3,0xD5,0xB1,0x94,0x84,0x8C,0x84,
-  0x94,0xB1,0xD5,0xB3,0x89,0x8C,0xC6,0xC6,0x01,0x28,0xF4,
-  0xBD,0xBD,0xBD,0xBD,0xF4,0xFE,0xD8,0xC6,0xC6,0x00,0x01,
-  0x00,0x20,0xFF,0xE9,0x02,0x79,0x02,0xE5,0x00,0x34,0x00,
-  0x00,0x13,0x33,0x32,0x35,0x34,0x27,0x26,0x23,0x22,0x07,
-  0x06,0x07,0x14,0x15,0x23,0x34,0x37,0x36,0x33,0x32,0x17,
-  0x16,0x15,0x14,0x07,0x16,0x17,0x16,0x15,0x14,0x07,0x06,
-  0x23,0x22,0x27,0x26,0x27,0x33,0x16,0x17,0x16,0x33,0x32,
-  0x37,0x36,0x35,0x34,0x27,0x26,0x27,0x26,0x2B,0x01,0xFA,
-  0x4C,0x8A,0x42,0x1A,0x22,0x87,0x10,0x01,0x01,0x8C,0x33,
-  0x4B,0xA0,0xB9,0x40,0x1B,0x3F,0x52,0x06,0x01,0x7B,0x48,
-  0x68,0xD7,0x40,0x14,0x03,0x92,0x06,0x6F,0x16,0x19,0x6C,
-  0x1E,0x09,0x4F,0x12,0x15,0x09,0x0A,0x66,0x01,0xAC,0x67,
-  0x3C,0x15,0x09,0x64,0x05,0x05,0x02,0x02,0x5E,0x39,0x53,
-  0x70,0x30,0x40,0x5D,0x2F,0x2D,0x62,0x0A,0x0B,0x8D,0x3C,
-  0x23,0x8E,0x2B,0x38,0x64,0x12,0x03,0x3C,0x11,0x15,0x53,
-  0x17,0x05,0x01,0x01,0x00,0x00,0x01,0x00,0x1D,0xFF,0xE9,
-  0x02,0x08,0x02,0x25,0x00,0x3A,0x00,0x00,0x37,0x35,0x33,
-  0x32,0x37,0x34,0x35,0x14,0x35,0x34,0x27,0x26,0x23,0x22,
-  0x07,0x23,0x36,0x37,0x36,0x33,0x32,0x17,0x16,0x17,0x16,
-  0x15,0x14,0x0F,0x01,0x16,0x15,0x14,0x07,0x06,0x07,0x06,
-  0x23,0x22,0x27,0x26,0x35,0x33,0x16,0x17,0x16,0x33,0x32,
-  0x37,0x36,0x35,0x34,0x2F,0x01,0x30,0x39,0x01,0x23,0x26,
-  0x23,0xCE,0x5E,0x3E,0x03,0x2D,0x10,0x14,0x64,0x01,0x87,
-  0x02,0x67,0x37,0x4B,0x8B,0x38,0x15,0x05,0x01,0x1E,0x0E,
-  0x3B,0x3C,0x02,0x02,0x3C,0x70,0xE8,0x15,0x02,0x89,0x08,
-  0x13,0x1D,0x36,0x5A,0x0C,0x02,0x19,0x01,0x01,0x14,0x23,
-  0xD0,0x6E,0x32,0x03,0x03,0x09,0x18,0x22,0x0C,0x04,0x49,
-  0x71,0x2E,0x18,0x54,0x20,0x29,0x0B,0x0C,0x37,0x21,0x0A,
-  0x25,0x4A,0x50,0x33,0x02,0x02,0x30,0x9D,0x0B,0x0C,0x24,
-  0x0F,0x13,0x2A,0x05,0x06,0x2A,0x0E,0x01,0x0B,0x00,0x01,
-  0x00,0x4A,0x00,0x00,0x02,0xCD,0x02,0xD9,0x00,0x0A,0x00,
-  0x00,0x33,0x23,0x11,0x33,0x11,0x01,0x33,0x09,0x01,0x23,
-  0x01,0xE0,0x96,0x96,0x01,0x1D,0xB1,0xFE,0x92,0x01,0x8D,
-  0xB3,0xFE,0xC6,0x02,0xD9,0xFE,0xE9,0x01,0x17,0xFE,0xA1,
-  0xFE,0x86,0x01,0x1D,0x00,0x01,0x00,0x3B,0x00,0x00,0x02,
-  0x24,0x02,0x1C,0x00,0x0A,0x00,0x00,0x13,0x37,0x33,0x07,
-  0x13,0x23,0x27,0x15,0x23,0x11,0x33,0xC7,0xA2,0x94,0xD6,
-  0xFD,0xB6,0xA7,0x8C,0x8C,0x01,0x5F,0xBD,0xF4,0xFE,0xD8,
-  0xC6,0xC6,0x02,0x1C,0x00,0x01,0x00,0x4A,0x00,0x00,0x02,
-  0xCD,0x02,0xD9,0x00,0x0A,0x00,0x00,0x33,0x23,0x11,0x33,
-  0x11,0x01,0x33,0x09,0x01,0x23,0x01,0xE0,0x96,0x96,0x01,
-  0x1D,0xB1,0xFE,0x92,0x01,0x8D,0xB3,0xFE,0xC6,0x02,0xD9,
-  0xFE,0xE9,0x01,0x17,0xFE,0xA1,0xFE,0x86,0x01,0x1D,0x00,
-  0x01,0x00,0x3B,0x00,0x00,0x02,0x24,0x02,0x1C,0x00,0x0A,
-  0x00,0x00,0x13,0x37,0x33,0x07,0x13,0x23,0x27,0x15,0x23,
-  0x11,0x33,0xC7,0xA2,0x94,0xD6,0xFD,0xB6,0xA7,0x8C,0x8C,
-  0x01,0x5F,0xBD,0xF4,0xFE,0xD8,0xC6,0xC6,0x02,0x1C,0x00,
-  0x01,0x00,0x4A,0x00,0x00,0x02,0xCD,0x02,0xD9,0x00,0x0A,
-  0x00,0x00,0x33,0x23,0x11,0x33,0x11,0x01,0x33,0x09,0x01,
-  0x23,0x01,0xE0,0x96,0x96,0x01,0x1D,0xB1,0xFE,0x92,0x01,
-  0x8D,0xB3,0xFE,0xC6,0x02,0xD9,0xFE,0xE9,0x01,0x17,0xFE,
-  0xA1,0xFE,0x86,0x01,0x1D,0x00,0x01,0x00,0x3B,0x00,0x00,
-  0x02,0x24,0x02,0x1C,0x00,0x0A,0x00,0x00,0x13,0x37,0x33,
-  0x07,0x13,0x23,0x27,0x15,0x23,0x11,0x33,0xC7,0xA2,0x94,
-  0xD6,0xFD,0xB6,0xA7,0x8C,0x8C,0x01,0x5F,0xBD,0xF4,0xFE,
-  0xD8,0xC6,0xC6,0x02,0x1C,0x00,0x01,0x00,0x4A,0x00,0x00,
-  0x02,0xCD,0x02,0xD9,0x00,0x0A,0x00,0x00,0x33,0x23,0x11,
-  0x33,0x11,0x01,0x33,0x09,0x01,0x23,0x01,0xE0,0x96,0x96,
-  0x01,0x1D,0xB1,0xFE,0x92,0x01,0x8D,0xB3,0xFE,0xC6,0x02,
-  0xD9,0xFE,0xE9,0x01,0x17,0xFE,0xA1,0xFE,0x86,0x01,0x1D,
-  0x00,0x01,0x00,0x3B,0x00,0x00,0x02,0x24,0x02,0x1C,0x00,
-  0x0A,0x00,0x00,0x13,0x37,0x33,0x07,0x13,0x23,0x27,0x15,
-  0x23,0x11,0x33,0xC7,0xA2,0x94,0xD6,0xFD,0xB6,0xA7,0x8C,
-  0x8C,0x01,0x5F,0xBD,0xF4,0xFE,0xD8,0xC6,0xC6,0x02,0x1C,
-  0xFF,0xFF,0x00,0x44,0x00,0x00,0x02,0x91,0x02,0xD9,0x10,
-  0x06,0x00,0x2B,0x00,0x00,0x00,0x01,0x00,0x3C,0x00,0x00,
-  0x02,0x1F,0x02,0x1C,0x00,0x0B,0x00,0x00,0x13,0x33,0x15,
-  0x33,0x35,0x33,0x11,0x23,0x35,0x23,0x15,0x23,0x3C,0x8C,
-  0xCB,0x8C,0x8C,0xCB,0x8C,0x02,0x1C,0xDC,0xDC,0xFD,0xE4,
-  0xCF,0xCF,0x00,0xFF,0xFF,0x00,0x44,0x00,0x00,0x02,0x91,
-  0x02,0xD9,0x10,0x06,0x00,0x2B,0x00,0x00,0x00,0x01,0x00,
-  0x3C,0x00,0x00,0x02,0x1F,0x02,0x1C,0x00,0x0B,0x00,0x00,
-  0x13,0x33,0x15,0x33,0x35,0x33,0x11,0x23,0x35,0x23,0x15,
-  0x23,0x3C,0x8C,0xCB,0x8C,0x8C,0xCB,0x8C,0x02,0x1C,0xDC,
-  0xDC,0xFD,0xE4,0xCF,0xCF,0x00,0x00,0x01,0x00,0x44,0x00,
-  0x00,0x02,0x91,0x02,0xD9,0x00,0x07,0x00,0x00,0x01,0x21,
-  0x11,0x23,0x11,0x21,0x11,0x23,0x01,0xFB,0xFE,0xDF,0x96,
-  0x02,0x4D,0x96,0x02,0x5C,0xFD,0xA4,0x02,0xD9,0xFD,0x27,
-  0x00,0x01,0x00,0x3C,0x00,0x00,0x02,0x1F,0x02,0x1C,0x00,
-  0x07,0x00,0x00,0x13,0x21,0x11,0x23,0x11,0x23,0x11,0x23,
-  0x3C,0x01,0xE3,0x8C,0xCB,0x8C,0x02,0x1C,0xFD,0xE4,0x01,
-  0xAB,0xFE,0x55,0xFF,0xFF,0x00,0x2C,0xFF,0xE9,0x02,0xAD,
-  0x02,0xE5,0x10,0x06,0x00,0x26,0x00,0x00,0xFF,0xFF,0x00,
-  0x22,0xFF,0xE9,0x02,0x0A,0x02,0x25,0x10,0x06,0x00,0x46,
-  0x00,0x00,0xFF,0xFF,0x00,0x2C,0xFF,0xE9,0x02,0xAD,0x02,
-  0xE5,0x10,0x06,0x00,0x26,0x00,0x00,0xFF,0xFF,0x00,0x22,
-  0xFF,0xE9,0x02,0x0A,0x02,0x25,0x10,0x06,0x00,0x46,0x00,
-  0x00,0xFF,0xFF,0x00,0x0E,0x00,0x00,0x02,0x56,0x02,0xD9,
-  0x10,0x06,0x00,0x37,0x00,0x00,0x00,0x01,0x00,0x15,0x00,
-  0x00,0x01,0xAF,0x02,0x1C,0x00,0x07,0x00,0x00,0x01,0x15,
-  0x23,0x11,0x23,0x11,0x23,0x35,0x01,0xAF,0x87,0x8C,0x87,
-  0x02,0x1C,0x71,0xFE,0x55,0x01,0xAB,0x71,0x00,0xFF,0xFF,
-  0x00,0x1B,0x00,0x00,0x02,0x8A,0x02,0xD9,0x10,0x06,0x00,
-  0x3C,0x00,0x00,0x00,0x01,0x00,0x0E,0x00,0x00,0x02,0x18,
-  0x02,0x1C,0x00,0x06,0x00,0x00,0x21,0x23,0x03,0x33,0x1B,
-  0x01,0x33,0x01,0x5E,0x93,0xBD,0x94,0x75,0x6D,0x94,0x02,
-  0x1C,0xFE,0x75,0x01,0x8B,0x00,0xFF,0xFF,0x00,0x1B,0x00,
-  0x00,0x02,0x8A,0x02,0xD9,0x10,0x06,0x00,0x3C,0x00,0x00,
-  0x00,0x01,0x00,0x0E,0x00,0x00,0x02,0x18,0x02,0x1C,0x00,
-  0x06,0x00,0x00,0x21,0x23,0x03,0x33,0x1B,0x01,0x33,0x01,
-  0x5E,0x93,0xBD,0x94,0x75,0x6D,0x94,0x02,0x1C,0xFE,0x75,
-  0x01,0x8B,0x00,0xFF,0xFF,0x00,0x16,0x00,0x00,0x02,0x8D,
-  0x02,0xD9,0x10,0x06,0x00,0x3B,0x00,0x00,0xFF,0xFF,0x00,
-  0x10,0x00,0x00,0x02,0x17,0x02,0x1C,0x10,0x06,0x00,0x5B,
-  0x00,0x00,0x00,0x01,0x00,0x44,0xFF,0x6A,0x02,0xFF,0x02,
-  0xD9,0x00,0x0B,0x00,0x00,0x25,0x11,0x33,0x11,0x33,0x11,
-  0x23,0x35,0x21,0x11,0x33,0x11,0x01,0xFB,0x96,0x6E,0x82,
-  0xFD,0xC7,0x96,0x7D,0x02,0x5C,0xFD,0x93,0xFE,0xFE,0x96,
-  0x02,0xD9,0xFD,0xA4,0x00,0x01,0x00,0x3C,0xFF,0x83,0x02,
-  0x7F,0x02,0x1C,0x00,0x0B,0x00,0x00,0x33,0x11,0x33,0x11,
-  0x33,0x11,0x33,0x11,0x33,0x15,0x23,0x35,0x3C,0x8C,0xCB,
-  0x8C,0x60,0x6E,0x02,0x1C,0xFE,0x55,0x01,0xAB,0xFE,0x49,
-  0xE2,0x7D,0x00,0x01,0x00,0x44,0x00,0x00,0x02,0x66,0x02,
-  0xD9,0x00,0x0E,0x00,0x00,0x01,0x23,0x26,0x2F,0x01,0x26,
-  0x35,0x11,0x33,0x11,0x33,0x11,0x33,0x11,0x23,0x01,0xD0,
-  0xF6,0x4E,0x2C,0x01,0x1B,0x96,0xF5,0x97,0x96,0x01,0x12,
-  0x01,0x30,0x01,0x1E,0x26,0x01,0x51,0xFE,0xB6,0x01,0x4A,
-  0xFD,0x27,0x00,0x00,0x01,0x00,0x3C,0x00,0x00,0x02,0x06,
-  0x02,0x1C,0x00,0x0B,0x00,0x00,0x13,0x33,0x11,0x33,0x11,
-  0x33,0x11,0x23,0x35,0x23,0x22,0x27,0x3C,0x8C,0xB2,0x8C,
-  0x8C,0xB2,0x8B,0x01,0x02,0x1C,0xFE,0xFA,0x01,0x06,0xFD,
-  0xE4,0xA5,0x72,0x00,0x01,0x00,0x44,0x00,0x00,0x02,0x66,
-  0x02,0xD9,0x00,0x0E,0x00,0x00,0x01,0x23,0x26,0x2F,0x01,
-  0x26,0x35,0x11,0x33,0x11,0x33,0x11,0x33,0x11,0x23,0x01,
-  0xD0,0xF6,0x4E,0x2C,0x01,0x1B,0x96,0xF5,0x97,0x96,0x01,
-  0x12,0x01,0x30,0x01,0x1E,0x26,0x01,0x51,0xFE,0xB6,0x01,
-  0x4A,0xFD,0x27,0x00,0x00,0x01,0x00,0x3C,0x00,0x00,0x02,
-  0x06,0x02,0x1C,0x00,0x0B,0x00,0x00,0x13,0x33,0x11,0x33,
-  0x11,0x33,0x11,0x23,0x35,0x23,0x22,0x27,0x3C,0x8C,0xB2,
-  0x8C,0x8C,0xB2,0x8B,0x01,0x02,0x1C,0xFE,0xFA,0x01,0x06,
-  0xFD,0xE4,0xA5,0x72,0x00,0x01,0x00,0x44,0x00,0x00,0x02,
-  0x66,0x02,0xD9,0x00,0x0F,0x00,0x00,0x13,0x33,0x16,0x17,
-  0x16,0x17,0x16,0x15,0x11,0x23,0x11,0x23,0x11,0x23,0x11,
-  0x33,0xDA,0xF6,0x4E,0x2C,0x01,0x01,0x1A,0x96,0xF5,0x97,
-  0x96,0x01,0xC7,0x01,0x30,0x01,0x01,0x1D,0x26,0xFE,0xAF,
-  0x01,0x4A,0xFE,0xB6,0x02,0xD9,0x00,0x00,0x01,0x00,0x3C,
-  0x00,0x00,0x02,0x06,0x02,0x1C,0x00,0x0B,0x00,0x00,0x21,
-  0x23,0x11,0x23,0x11,0x23,0x11,0x33,0x15,0x33,0x32,0x17,
-  0x02,0x06,0x8C,0xB2,0x8C,0x8C,0xB2,0x8B,0x01,0x01,0x06,
-  0xFE,0xFA,0x02,0x1C,0xA5,0x72,0x00,0xFF,0xFF,0x00,0x2C,
-  0xFF,0xE9,0x02,0xAD,0x02,0xE5,0x10,0x06,0x00,0x26,0x00,
-  0x00,0xFF,0xFF,0x00,0x22,0xFF,0xE9,0x02,0x0A,0x02,0x25,
-  0x10,0x06,0x00,0x46,0x00,0x00,0xFF,0xFF,0x00,0x2C,0xFF,
-  0xE9,0x02,0xAD,0x02,0xE5,0x10,0x06,0x00,0x26,0x00,0x00,
-  0xFF,0xFF,0x00,0x22,0xFF,0xE9,0x02,0x0A,0x02,0x25,0x10,
-  0x06,0x00,0x46,0x00,0x00,0xFF,0xFF,0x00,0x3F,0x00,0x00,
-  0x00,0xD5,0x02,0xD9,0x10,0x06,0x00,0x2C,0x00,0x00,0xFF,
-  0xFF,0x00,0x16,0x00,0x00,0x04,0x36,0x03,0x9A,0x10,0x26,
-  0x01,0xA9,0x00,0x00,0x10,0x07,0x01,0x47,0x01,0x7F,0x00,
-  0xAE,0xFF,0xFF,0x00,0x10,0x00,0x00,0x03,0x14,0x02,0xDD,
-  0x10,0x26,0x01,0xC9,0x00,0x00,0x10,0x07,0x01,0x47,0x00,
-  0xEB,0xFF,0xF1,0x00,0x01,0x00,0x4A,0x00,0x00,0x02,0xCD,
-  0x02,0xD9,0x00,0x0A,0x00,0x00,0x33,0x23,0x11,0x33,0x11,
-  0x01,0x33,0x09,0x01,0x23,0x01,0xE0,0x96,0x96,0x01,0x1D,
-  0xB1,0xFE,0x92,0x01,0x8D,0xB3,0xFE,0xC6,0x02,0xD9,0xFE,
-  0xE9,0x01,0x17,0xFE,0xA1,0xFE,0x86,0x01,0x1D,0x00,0x01,
-  0x00,0x3B,0x00,0x00,0x02,0x24,0x02,0x1C,0x00,0x0A,0x00,
-  0x00,0x13,0x37,0x33,0x07,0x13,0x23,0x27,0x15,0x23,0x11,
-  0x33,0xC7,0xA2,0x94,0xD6,0xFD,0xB6,0xA7,0x8C,0x8C,0x01,
-  0x5F,0xBD,0xF4,0xFE,0xD8,0xC6,0xC6,0x02,0x1C,0xFF,0xFF,
-  0x00,0x44,0x00,0x00,0x02,0x91,0x02,0xD9,0x10,0x06,0x00,
-  0x2B,0x00,0x00,0x00,0x01,0x00,0x3C,0x00,0x00,0x02,0x1F,
-  0x02,0x1C,0x00,0x0B,0x00,0x00,0x13,0x33,0x15,0x33,0x35,
-  0x33,0x11,0x23,0x35,0x23,0x15,0x23,0x3C,0x8C,0xCB,0x8C,
-  0x8C,0xCB,0x8C,0x02,0x1C,0xDC,0xDC,0xFD,0xE4,0xCF,0xCF,
-  0x00,0x00,0x01,0x00,0x44,0x00,0x00,0x02,0x66,0x02,0xD9,
-  0x00,0x0E,0x00,0x00,0x01,0x23,0x26,0x2F,0x01,0x26,0x35,
-  0x11,0x33,0x11,0x33,0x11,0x33,0x11,0x23,0x01,0xD0,0xF6,
-  0x4E,0x2C,0x01,0x1B,0x96,0xF5,0x97,0x96,0x01,0x12,0x01,
-  0x30,0x01,0x1E,0x26,0x01,0x51,0xFE,0xB6,0x01,0x4A,0xFD,
-  0x27,0x00,0x00,0x01,0x00,0x3C,0x00,0x00,0x02,0x06,0x02,
-  0x1C,0x00,0x0B,0x00,0x00,0x13,0x33,0x11,0x33,0x11,0x33,
-  0x11,0x23,0x35,0x23,0x22,0x27,0x3C,0x8C,0xB2,0x8C,0x8C,
-  0xB2,0x8B,0x01,0x02,0x1C,0xFE,0xFA,0x01,0x06,0xFD,0xE4,
-  0xA5,0x72,0xFF,0xFF,0x00,0x1A,0x00,0x00,0x02,0xBF,0x03,
-  0x9F,0x10,0x27,0x01,0x47,0x00,0xC1,0x00,0xB3,0x10,0x06,
-  0x00,0x24,0x00,0x00,0xFF,0xFF,0x00,0x1C,0xFF,0xE9,0x02,
-  0x0C,0x02,0xEC,0x10,0x26,0x01,0x47,0x6C,0x00,0x10,0x06,
-  0x00,0x44,0x00,0x00,0xFF,0xFF,0x00,0x1A,0x00,0x00,0x02,
-  0xBF,0x03,0x9A,0x10,0x27,0x00,0x69,0x00,0xC6,0x00,0xB3,
-  0x10,0x06,0x00,0x24,0x00,0x00,0xFF,0xFF,0x00,0x1C,0xFF,
-  0xE9,0x02,0x0C,0x02,0xE7,0x10,0x26,0x00,0x69,0x6A,0x00,
-  0x10,0x06,0x00,0x44,0x00,0x00,0x00,0x02,0x00,0x01,0x00,
-  0x00,0x03,0xC6,0x02,0xD9,0x00,0x0F,0x00,0x13,0x00,0x00,
-  0x25,0x23,0x07,0x23,0x01,0x21,0x15,0x21,0x15,0x21,0x15,
-  0x21,0x15,0x21,0x15,0x21,0x19,0x01,0x23,0x03,0x01,0xAE,
-  0xDF,0x35,0x99,0x01,0x07,0x02,0xAA,0xFE,0x92,0x01,0x53,
-  0xFE,0xAD,0x01,0x82,0xFD,0xE8,0x43,0x72,0x98,0x98,0x02,
-  0xD9,0x7D,0xA5,0x7D,0xBD,0x7D,0x01,0x15,0x01,0x47,0xFE,
-  0xB9,0x00,0x03,0x00,0x1B,0xFF,0xE8,0x03,0x59,0x02,0x25,
-  0x00,0x38,0x00,0x46,0x00,0x4B,0x00,0x00,0x25,0x33,0x06,
-  0x07,0x06,0x23,0x22,0x27,0x06,0x07,0x06,0x23,0x22,0x27,
-  0x26,0x35,0x34,0x37,0x36,0x3F,0x01,0x36,0x37,0x36,0x37,
-  0x36,0x35,0x34,0x23,0x22,0x07,0x06,0x07,0x23,0x36,0x33,
-  0x32,0x17,0x36,0x33,0x32,0x17,0x33,0x16,0x17,0x16,0x15,
-  0x14,0x07,0x21,0x14,0x17,0x16,0x33,0x32,0x37,0x36,0x25,
-  0x35,0x06,0x0F,0x01,0x06,0x15,0x14,0x17,0x16,0x33,0x32,
-  0x37,0x36,0x37,0x33,0x26,0x23,0x22,0x02,0xC8,0x8A,0x1E,
-  0x63,0x37,0x42,0x88,0x40,0x53,0x66,0x0A,0x0A,0x69,0x2A,
-  0x15,0x8D,0x09,0x09,0x38,0x44,0x0F,0x01,0x04,0x18,0x55,
-  0x44,0x12,0x06,0x03,0x83,0x03,0xE1,0x75,0x3A,0x3E,0x5D,
-  0x86,0x46,0x01,0x12,0x0C,0x15,0x01,0xFE,0x96,0x14,0x20,
-  0x3E,0x39,0x20,0x0B,0xFE,0x9E,0x16,0x25,0x30,0x50,0x32,
-  0x0F,0x0B,0x5F,0x0E,0x02,0x8D,0xD8,0x0B,0x62,0x62,0x98,
-  0x67,0x2E,0x1A,0x68,0x61,0x07,0x01,0x4D,0x26,0x32,0x88,
-  0x1F,0x02,0x02,0x0A,0x0B,0x07,0x01,0x02,0x0D,0x1B,0x35,
-  0x27,0x0E,0x15,0xBB,0x32,0x32,0x63,0x1A,0x20,0x3C,0x52,
-  0x0C,0x0C,0x3E,0x1F,0x31,0x29,0x0D,0x4E,0x26,0x0D,0x06,
-  0x07,0x0B,0x3E,0x33,0x0C,0x03,0x60,0x0F,0x77,0x7B,0xFF,
-  0xFF,0x00,0x52,0x00,0x00,0x02,0x73,0x03,0x9A,0x10,0x26,
-  0x01,0xA8,0x00,0x00,0x10,0x07,0x01,0x47,0x00,0xAF,0x00,
-  0xAE,0xFF,0xFF,0x00,0x16,0xFF,0xE9,0x02,0x0D,0x02,0xDD,
-  0x10,0x26,0x00,0x48,0x00,0x00,0x10,0x06,0x01,0x47,0x5D,
-  0xF1,0x00,0x02,0x00,0x2C,0xFF,0xE9,0x02,0xAD,0x02,0xE5,
-  0x00,0x08,0x00,0x25,0x00,0x00,0x25,0x21,0x16,0x17,0x16,
-  0x33,0x32,0x37,0x36,0x37,0x35,0x34,0x27,0x26,0x23,0x22,
-  0x07,0x06,0x07,0x23,0x36,0x37,0x36,0x37,0x32,0x33,0x32,
-  0x17,0x16,0x15,0x14,0x07,0x06,0x23,0x22,0x27,0x26,0x35,
-  0x02,0x0A,0xFE,0xB4,0x0A,0x5B,0x1B,0x21,0x74,0x2D,0x06,
-  0x11,0x5D,0x29,0x37,0x51,0x2A,0x15,0x0C,0x8F,0x07,0x2A,
-  0x53,0x9E,0x07,0x07,0xB0,0x5A,0x44,0x76,0x55,0x7F,0xAD,
-  0x51,0x39,0xF9,0x6C,0x1D,0x09,0x72,0x0F,0x7B,0x01,0xA9,
-  0x3D,0x1B,0x35,0x1A,0x34,0x58,0x38,0x6E,0x05,0x83,0x63,
-  0x99,0xCD,0x67,0x49,0x86,0x5F,0x95,0x00,0x02,0x00,0x22,
-  0xFF,0xE9,0x02,0x0A,0x02,0x25,0x00,0x1F,0x00,0x28,0x00,
-  0x00,0x01,0x35,0x34,0x27,0x26,0x23,0x22,0x07,0x15,0x07,
-  0x06,0x07,0x23,0x36,0x37,0x36,0x33,0x32,0x17,0x16,0x15,
-  0x14,0x07,0x06,0x07,0x06,0x23,0x22,0x27,0x26,0x27,0x35,
-  0x05,0x23,0x16,0x17,0x16,0x33,0x32,0x37,0x36,0x01,0x7E,
-  0x42,0x16,0x1A,0x3C,0x1A,0x01,0x07,0x06,0x86,0x0D,0x60,
-  0x37,0x47,0x9E,0x3E,0x21,0x77,0x24,0x2C,0x1A,0x1E,0x8A,
-  0x3D,0x1D,0x05,0x01,0x4F,0xC4,0x12,0x30,0x0C,0x11,0x3E,
-  0x19,0x08,0x01,0x0A,0x01,0x7A,0x23,0x0C,0x37,0x01,0x01,
-  0x11,0x17,0x7C,0x37,0x1F,0x7C,0x42,0x5C,0xBB,0x46,0x14,
-  0x08,0x05,0x62,0x30,0x41,0x4E,0x60,0x42,0x0B,0x03,0x2E,
-  0x0F,0xFF,0xFF,0x00,0x2C,0xFF,0xE9,0x02,0xAD,0x03,0xB7,
-  0x10,0x26,0x02,0x38,0x00,0x00,0x10,0x07,0x00,0x69,0x00,
-  0xBF,0x00,0xD0,0xFF,0xFF,0x00,0x22,0xFF,0xE9,0x02,0x0A,
-  0x02,0xC8,0x10,0x26,0x02,0x39,0x00,0x00,0x10,0x06,0x00,
-  0x69,0x6D,0xE1,0xFF,0xFF,0x00,0x16,0x00,0x00,0x04,0x36,
-  0x03,0x85,0x10,0x26,0x01,0xA9,0x00,0x00,0x10,0x07,0x00,
-  0x69,0x01,0x80,0x00,0x9E,0xFF,0xFF,0x00,0x10,0x00,0x00,
-  0x03,0x14,0x02,0xC8,0x10,0x26,0x01,0xC9,0x00,0x00,0x10,
-  0x07,0x00,0x69,0x00,0xEC,0xFF,0xE1,0xFF,0xFF,0x00,0x20,
-  0xFF,0xE9,0x02,0x79,0x03,0x85,0x10,0x26,0x01,0xAA,0x00,
-  0x00,0x10,0x07,0x00,0x69,0x00,0x58,0x00,0x9E,0xFF,0xFF,
-  0x00,0x1D,0xFF,0xE9,0x02,0x08,0x02,0xC8,0x10,0x26,0x01,
-  0xCA,0x00,0x00,0x10,0x06,0x00,0x69,0x6C,0xE1,0x00,0x01,
-  0x00,0x20,0xFF,0xE9,0x02,0x79,0x02,0xE5,0x00,0x34,0x00,
-  0x00,0x13,0x33,0x32,0x35,0x34,0x27,0x26,0x23,0x22,0x07,
-  0x06,0x07,0x14,0x15,0x23,0x34,0x37,0x36,0x33,0x32,0x17,
-  0x16,0x15,0x14,0x07,0x16,0x17,0x16,0x15,0x14,0x07,0x06,
-  0x23,0x22,0x27,0x26,0x27,0x33,0x16,0x17,0x16,0x33,0x32,
-  0x37,0x36,0x35,0x34,0x27,0x26,0x27,0x26,0x2B,0x01,0xFA,
-  0x4C,0x8A,0x42,0x1A,0x22,0x87,0x10,0x01,0x01,0x8C,0x33,
-  0x4B,0xA0,0xB9,0x40,0x1B,0x3F,0x52,0x06,0x01,0x7B,0x48,
-  0x68,0xD7,0x40,0x14,0x03,0x92,0x06,0x6F,0x16,0x19,0x6C,
-  0x1E,0x09,0x4F,0x12,0x15,0x09,0x0A,0x66,0x01,0xAC,0x67,
-  0x3C,0x15,0x09,0x64,0x05,0x05,0x02,0x02,0x5E,0x39,0x53,
-  0x70,0x30,0x40,0x5D,0x2F,0x2D,0x62,0x0A,0x0B,0x8D,0x3C,
-  0x23,0x8E,0x2B,0x38,0x64,0x12,0x03,0x3C,0x11,0x15,0x53,
-  0x17,0x05,0x01,0x01,0x00,0x00,0x01,0x00,0x1D,0xFF,0xE9,
-  0x02,0x08,0x02,0x25,0x00,0x3A,0x00,0x00,0x37,0x35,0x33,
-  0x32,0x37,0x34,0x35,0x14,0x35,0x34,0x27,0x26,0x23,0x22,
-  0x07,0x23,0x36,0x37,0x36,0x33,0x32,0x17,0x16,0x17,0x16,
-  0x15,0x14,0x0F,0x01,0x16,0x15,0x14,0x07,0x06,0x07,0x06,
-  0x23,0x22,0x27,0x26,0x35,0x33,0x16,0x17,0x16,0x33,0x32,
-  0x37,0x36,0x35,0x34,0x2F,0x01,0x30,0x39,0x01,0x23,0x26,
-  0x23,0xCE,0x5E,0x3E,0x03,0x2D,0x10,0x14,0x64,0x01,0x87,
-  0x02,0x67,0x37,0x4B,0x8B,0x38,0x15,0x05,0x01,0x1E,0x0E,
-  0x3B,0x3C,0x02,0x02,0x3C,0x70,0xE8,0x15,0x02,0x89,0x08,
-  0x13,0x1D,0x36,0x5A,0x0C,0x02,0x19,0x01,0x01,0x14,0x23,
-  0xD0,0x6E,0x32,0x03,0x03,0x09,0x18,0x22,0x0C,0x04,0x49,
-  0x71,0x2E,0x18,0x54,0x20,0x29,0x0B,0x0C,0x37,0x21,0x0A,
-  0x25,0x4A,0x50,0x33,0x02,0x02,0x30,0x9D,0x0B,0x0C,0x24,
-  0x0F,0x13,0x2A,0x05,0x06,0x2A,0x0E,0x01,0x0B,0xFF,0xFF,
-  0x00,0x52,0x00,0x00,0x02,0xA3,0x03,0x5A,0x10,0x26,0x01,
-  0xAB,0x00,0x00,0x10,0x07,0x00,0x6F,0x00,0xC7,0x00,0x8B,
-  0xFF,0xFF,0x00,0x3C,0x00,0x00,0x02,0x2B,0x02,0x9D,0x10,
-  0x26,0x01,0xCB,0x00,0x00,0x10,0x07,0x00,0x6F,0x00,0x88,
-  0xFF,0xCE,0xFF,0xFF,0x00,0x52,0x00,0x00,0x02,0xA3,0x03,
-  0x85,0x10,0x26,0x01,0xAB,0x00,0x00,0x10,0x07,0x00,0x69,
-  0x00,0xC6,0x00,0x9E,0xFF,0xFF,0x00,0x3C,0x00,0x00,0x02,
-  0x2B,0x02,0xC8,0x10,0x26,0x01,0xCB,0x00,0x00,0x10,0x07,
-  0x00,0x69,0x00,0x87,0xFF,0xE1,0xFF,0xFF,0x00,0x28,0xFF,
-  0xE9,0x02,0xE6,0x03,0x9A,0x10,0x26,0x00,0x32,0x00,0x00,
-  0x10,0x07,0x00,0x69,0x00,0xE1,0x00,0xB3,0xFF,0xFF,0x00,
-  0x23,0xFF,0xE9,0x02,0x39,0x02,0xE7,0x10,0x26,0x00,0x52,
-  0x00,0x00,0x10,0x07,0x00,0x69,0x00,0x88,0x00,0x00,0x00,
-  0x03,0x00,0x28,0xFF,0xE9,0x02,0xE6,0x02,0xE5,0x00,0x1B,
-  0x00,0x24,0x00,0x2D,0x00,0x00,0x01,0x32,0x17,0x16,0x17,
-  0x14,0x15,0x14,0x07,0x06,0x07,0x06,0x23,0x22,0x27,0x26,
-  0x27,0x26,0x35,0x34,0x3F,0x02,0x30,0x37,0x36,0x37,0x36,
-  0x01,0x26,0x27,0x26,0x23,0x22,0x07,0x06,0x07,0x05,0x21,
-  0x16,0x17,0x16,0x33,0x32,0x37,0x36,0x01,0x86,0x9C,0x5E,
-  0x62,0x04,0x47,0x0E,0x11,0x5E,0x9B,0x9B,0x5E,0x5A,0x0B,
-  0x01,0x58,0x01,0x01,0x01,0x05,0x06,0x5D,0x01,0x63,0x0F,
-  0x5B,0x29,0x34,0x6C,0x37,0x1D,0x07,0x01,0x8F,0xFE,0x71,
-  0x0C,0x57,0x2C,0x38,0x69,0x38,0x20,0x02,0xE5,0x65,0x69,
-  0xA8,0x06,0x07,0x85,0x68,0x15,0x12,0x65,0x65,0x60,0x97,
-  0x11,0x11,0x9D,0x6C,0x01,0x01,0x01,0x06,0x07,0x65,0xFE,
-  0xAB,0x8A,0x34,0x17,0x5F,0x32,0x44,0x4F,0x84,0x38,0x1C,
-  0x5C,0x34,0x00,0x03,0x00,0x23,0xFF,0xE9,0x02,0x39,0x02,
-  0x25,0x00,0x0F,0x00,0x18,0x00,0x21,0x00,0x00,0x01,0x32,
-  0x17,0x16,0x15,0x14,0x07,0x06,0x23,0x22,0x27,0x26,0x35,
-  0x34,0x37,0x36,0x17,0x26,0x27,0x26,0x23,0x22,0x07,0x06,
-  0x07,0x17,0x23,0x16,0x17,0x16,0x33,0x32,0x37,0x36,0x01,
-  0x2D,0xA5,0x43,0x24,0x67,0x43,0x61,0x9C,0x45,0x2A,0x6B,
-  0x41,0xDB,0x0E,0x42,0x14,0x18,0x49,0x22,0x0D,0x04,0xF9,
-  0xF9,0x0D,0x3F,0x16,0x1A,0x47,0x23,0x0E,0x02,0x25,0x7D,
-  0x44,0x61,0x9E,0x4B,0x31,0x73,0x46,0x65,0xA6,0x4B,0x2D,
-  0xF6,0x61,0x1B,0x09,0x4A,0x1A,0x21,0x4F,0x5E,0x1E,0x0A,
-  0x47,0x1C,0xFF,0xFF,0x00,0x28,0xFF,0xE9,0x02,0xE6,0x03,
-  0xB7,0x10,0x26,0x02,0x48,0x00,0x00,0x10,0x07,0x00,0x69,
-  0x00,0xE1,0x00,0xD0,0xFF,0xFF,0x00,0x23,0xFF,0xE9,0x02,
-  0x39,0x02,0xFA,0x10,0x26,0x02,0x49,0x00,0x00,0x10,0x07,
-  0x00,0x69,0x00,0x88,0x00,0x13,0xFF,0xFF,0x00,0x2C,0xFF,
-  0xE9,0x02,0xAD,0x03,0x85,0x10,0x26,0x01,0xC0,0x00,0x00,
-  0x10,0x07,0x00,0x69,0x00,0x7B,0x00,0x9E,0xFF,0xFF,0x00,
-  0x22,0xFF,0xE9,0x02,0x0A,0x02,0xC8,0x10,0x26,0x01,0xE0,
-  0x00,0x00,0x10,0x06,0x00,0x69,0x5F,0xE1,0xFF,0xFF,0x00,
-  0x0F,0x00,0x00,0x02,0xB8,0x03,0x5A,0x10,0x26,0x01,0xB6,
-  0x00,0x00,0x10,0x07,0x00,0x6F,0x00,0xBE,0x00,0x8B,0xFF,
-  0xFF,0x00,0x09,0xFF,0x25,0x02,0x1A,0x02,0x9D,0x10,0x26,
-  0x00,0x5C,0x00,0x00,0x10,0x06,0x00,0x6F,0x72,0xCE,0xFF,
-  0xFF,0x00,0x0F,0x00,0x00,0x02,0xB8,0x03,0x85,0x10,0x26,
-  0x01,0xB6,0x00,0x00,0x10,0x07,0x00,0x69,0x00,0xBD,0x00,
-  0x9E,0xFF,0xFF,0x00,0x09,0xFF,0x25,0x02,0x1A,0x02,0xC8,
-  0x10,0x26,0x00,0x5C,0x00,0x00,0x10,0x06,0x00,0x69,0x71,
-  0xE1,0xFF,0xFF,0x00,0x0F,0x00,0x00,0x02,0xB8,0x03,0x9E,
-  0x10,0x26,0x01,0xB6,0x00,0x00,0x10,0x07,0x01,0x4C,0x00,
-  0xCF,0x00,0xA9,0xFF,0xFF,0x00,0x09,0xFF,0x25,0x02,0x1A,
-  0x02,0xE1,0x10,0x26,0x00,0x5C,0x00,0x00,0x10,0x07,0x01,
-  0x4C,0x00,0x83,0xFF,0xEC,0xFF,0xFF,0x00,0x44,0x00,0x00,
-  0x02,0x70,0x03,0x85,0x10,0x26,0x01,0xBA,0x00,0x00,0x10,
-  0x07,0x00,0x69,0x00,0xAF,0x00,0x9E,0xFF,0xFF,0x00,0x3C,
-  0x00,0x00,0x02,0x06,0x02,0xC8,0x10,0x26,0x01,0xDA,0x00,
-  0x00,0x10,0x06,0x00,0x69,0x7B,0xE1,0xFF,0xFF,0x00,0x44,
-  0x00,0x00,0x03,0x74,0x03,0x85,0x10,0x26,0x01,0xBE,0x00,
-  0x00,0x10,0x07,0x00,0x69,0x01,0x36,0x00,0x9E,0xFF,0xFF,
-  0x00,0x3C,0x00,0x00,0x02,0xCE,0x02,0xC8,0x10,0x26,0x01,
-  0xDE,0x00,0x00,0x10,0x07,0x00,0x69,0x00,0xED,0xFF,0xE1,
-  0x00,0x02,0x00,0x00,0xFF,0x02,0x00,0x52,0xFF,0xC4,0x00,
-  0x03,0x00,0x07,0x00,0x00,0x15,0x33,0x15,0x23,0x35,0x33,
-  0x15,0x23,0x52,0x52,0x52,0x52,0xAC,0x52,0xC2,0x52,0x00,
-  0x05,0x00,0x00,0xFF,0x02,0x01,0x5B,0xFF,0xC4,0x00,0x03,
-  0x00,0x07,0x00,0x0B,0x00,0x0F,0x00,0x13,0x00,0x00,0x17,
-  0x33,0x15,0x23,0x27,0x33,0x15,0x23,0x37,0x33,0x15,0x23,
-  0x37,0x33,0x15,0x23,0x15,0x33,0x15,0x23,0x41,0x52,0x52,
-  0x41,0x52,0x52,0x81,0x53,0x53,0x88,0x52,0x52,0x52,0x52,
-  0xAC,0x52,0xC2,0x52,0x52,0x52,0x52,0x52,0x1E,0x52,0x00,
-  0x03,0x00,0x00,0xFF,0x02,0x01,0x55,0xFF,0xC4,0x00,0x03,
-  0x00,0x07,0x00,0x0B,0x00,0x00,0x15,0x33,0x15,0x23,0x25,
-  0x33,0x15,0x23,0x15,0x33,0x15,0x23,0xC8,0xC8,0x01,0x03,
-  0x52,0x52,0x52,0x52,0x3C,0x52,0x52,0x52,0x1E,0x52,0x00,
-  0x03,0x00,0x00,0xFF,0x02,0x01,0x55,0xFF,0xC4,0x00,0x03,
-  0x00,0x07,0x00,0x0F,0x00,0x00,0x05,0x33,0x15,0x23,0x35,
-  0x33,0x15,0x2B,0x01,0x15,0x23,0x35,0x23,0x35,0x33,0x15,
-  0x01,0x03,0x52,0x52,0x52,0x52,0x76,0x52,0x3B,0xC8,0xAC,
-  0x52,0xC2,0x52,0x6A,0x6A,0x52,0x52,0x00,0x01,0x00,0x00,
-  0xFF,0x72,0x00,0x52,0xFF,0xC4,0x00,0x03,0x00,0x00,0x15,
-  0x33,0x15,0x23,0x52,0x52,0x3C,0x52,0x00,0x02,0x00,0x00,
-  0xFF,0x72,0x00,0xD4,0xFF,0xC4,0x00,0x03,0x00,0x07,0x00,
-  0x00,0x15,0x33,0x15,0x23,0x37,0x33,0x15,0x23,0x52,0x52,
-  0x81,0x53,0x53,0x3C,0x52,0x52,0x52,0x00,0x00,0x03,0x00,
-  0x00,0xFF,0x02,0x00,0xD4,0xFF,0xC4,0x00,0x03,0x00,0x07,
-  0x00,0x0B,0x00,0x00,0x17,0x33,0x15,0x23,0x27,0x33,0x15,
-  0x23,0x37,0x33,0x15,0x23,0x41,0x52,0x52,0x41,0x52,0x52,
-  0x81,0x53,0x53,0xAC,0x52,0xC2,0x52,0x52,0x52,0x00,0x00,
-  0x01,0x00,0x00,0xFF,0x72,0x00,0xC8,0xFF,0xC4,0x00,0x03,
-  0x00,0x00,0x15,0x33,0x15,0x23,0xC8,0xC8,0x3C,0x52,0x00,
-  0x01,0x00,0x00,0xFF,0x08,0x00,0xC8,0xFF,0xC4,0x00,0x07,
-  0x00,0x00,0x17,0x15,0x23,0x35,0x23,0x35,0x33,0x15,0x8D,
-  0x52,0x3B,0xC8,0x8E,0x6A,0x6A,0x52,0x52,0x00,0x00,0x01,
-  0x00,0x00,0x02,0x94,0x00,0x52,0x02,0xE6,0x00,0x03,0x00,
-  0x00,0x11,0x33,0x15,0x23,0x52,0x52,0x02,0xE6,0x52,0x00,
-  0x00,0x03,0x00,0x00,0xFF,0x02,0x01,0x55,0xFF,0xC4,0x00,
-  0x03,0x00,0x07,0x00,0x0B,0x00,0x00,0x05,0x33,0x15,0x23,
-  0x27,0x33,0x15,0x23,0x27,0x33,0x15,0x23,0x01,0x03,0x52,
-  0x52,0x82,0x53,0x53,0x81,0x52,0x52,0xAC,0x52,0x8D,0x52,
-  0x87,0x52,0x00,0x01,0x00,0x00,0x01,0x01,0x00,0x52,0x01,
-  0x53,0x00,0x03,0x00,0x00,0x11,0x33,0x15,0x23,0x52,0x52,
-  0x01,0x53,0x52,0x00,0x00,0x01,0x00,0x00,0xFF,0x08,0x00,
-  0x52,0xFF,0xC4,0x00,0x03,0x00,0x00,0x17,0x15,0x23,0x35,
-  0x52,0x52,0x3C,0xBC,0xBC,0x00,0x00,0x01,0x00,0x3F,0x01,
-  0xE5,0x01,0xBC,0x02,0x58,0x00,0x03,0x00,0x00,0x13,0x35,
-  0x21,0x15,0x3F,0x01,0x7D,0x01,0xE5,0x73,0x73,0x00,0x00,
-  0x01,0x00,0x00,0x02,0x94,0x00,0xC8,0x02,0xE6,0x00,0x03,
-  0x00,0x00,0x11,0x33,0x15,0x23,0xC8,0xC8,0x02,0xE6,0x52,
-  0x00,0x00,0x01,0x00,0x4F,0xFF,0x9C,0x00,0xDA,0x02,0xBC,
-  0x00,0x03,0x00,0x00,0x17,0x11,0x33,0x11,0x4F,0x8B,0x64,
-  0x03,0x20,0xFC,0xE0,0x00,0x00,0x01,0x02,0x8A,0x02,0x7F,
-  0x02,0xDC,0x02,0xD1,0x00,0x03,0x00,0x00,0x01,0x33,0x15,
-  0x23,0x02,0x8A,0x52,0x52,0x02,0xD1,0x52,0x00,0x00,0x01,
-  0x00,0x65,0x02,0x7F,0x00,0xB7,0x02,0xD1,0x00,0x03,0x00,
-  0x00,0x13,0x33,0x15,0x23,0x65,0x52,0x52,0x02,0xD1,0x52,
-  0xFF,0xFF,0x00,0x71,0x00,0x00,0x01,0x07,0x02,0x08,0x10,
-  0x06,0x00,0x1D,0x00,0x00,0x00,0x01,0x00,0x00,0x02,0x94,
-  0x00,0x52,0x02,0xE6,0x00,0x03,0x00,0x00,0x11,0x33,0x15,
-  0x23,0x52,0x52,0x02,0xE6,0x52,0x00,0x00,0x01,0x00,0x3D,
-  0x00,0x00,0x02,0x8A,0x02,0x58,0x00,0x21,0x00,0x00,0x01,
-  0x06,0x07,0x06,0x15,0x06,0x07,0x15,0x23,0x35,0x36,0x37,
-  0x36,0x37,0x36,0x37,0x27,0x33,0x13,0x36,0x37,0x36,0x37,
-  0x35,0x33,0x15,0x06,0x07,0x06,0x07,0x06,0x07,0x17,0x23,
-  0x01,0x1E,0x24,0x0E,0x01,0x02,0x05,0x8B,0x11,0x1F,0x0D,
-  0x14,0x11,0x19,0x97,0xA1,0xCB,0x24,0x0E,0x02,0x05,0x8B,
-  0x10,0x26,0x0B,0x10,0x12,0x18,0x98,0xA3,0x01,0x1D,0x2C,
-  0x3B,0x02,0x03,0x07,0x16,0x94,0x9E,0x5D,0x34,0x16,0x18,
-  0x15,0x12,0xD4,0xFE,0xE3,0x2C,0x37,0x08,0x16,0x9C,0xA7,
-  0x59,0x39,0x12,0x13,0x15,0x11,0xD4,0x00,0x01,0x00,0x4D,
-  0x00,0x00,0x02,0x62,0x02,0x58,0x00,0x22,0x00,0x00,0x25,
-  0x35,0x26,0x27,0x26,0x27,0x26,0x27,0x26,0x27,0x26,0x27,
-  0x26,0x27,0x26,0x27,0x23,0x35,0x33,0x16,0x17,0x16,0x17,
-  0x16,0x17,0x16,0x17,0x15,0x16,0x17,0x11,0x33,0x15,0x21,
-  0x35,0x01,0x7C,0x0B,0x0A,0x02,0x03,0x02,0x02,0x07,0x05,
-  0x02,0x03,0x1B,0x31,0x06,0x04,0xAA,0xB6,0x54,0x3C,0x03,
-  0x03,0x28,0x15,0x23,0x0C,0x01,0x01,0x5B,0xFD,0xEB,0x73,
-  0xFA,0x31,0x10,0x04,0x05,0x02,0x03,0x09,0x03,0x01,0x02,
-  0x0F,0x09,0x01,0x01,0x73,0x0A,0x1F,0x01,0x02,0x13,0x23,
-  0x31,0x40,0x01,0x06,0x08,0xFE,0xFD,0x73,0x73,0x00,0x01,
-  0x00,0x2F,0x00,0x00,0x01,0xF7,0x02,0x58,0x00,0x21,0x00,
-  0x00,0x25,0x07,0x23,0x37,0x33,0x27,0x26,0x27,0x26,0x27,
-  0x26,0x27,0x26,0x27,0x26,0x27,0x26,0x27,0x23,0x35,0x33,
-  0x16,0x17,0x16,0x17,0x16,0x17,0x16,0x17,0x15,0x16,0x17,
-  0x13,0x23,0x01,0x5B,0x7F,0xAD,0xB1,0x75,0x13,0x0E,0x07,
-  0x04,0x05,0x08,0x05,0x02,0x03,0x1B,0x31,0x06,0x04,0x49,
-  0x55,0x53,0x3B,0x04,0x04,0x27,0x17,0x1C,0x0F,0x03,0x02,
-  0x2B,0x8C,0x8A,0x8A,0xC2,0xA7,0x37,0x0E,0x07,0x07,0x0A,
-  0x02,0x01,0x02,0x0F,0x09,0x01,0x01,0x73,0x09,0x1F,0x02,
-  0x02,0x13,0x23,0x28,0x3F,0x01,0x0E,0x06,0xFE,0x86,0x00,
-  0x00,0x01,0x00,0x3F,0x00,0x00,0x02,0x36,0x02,0x58,0x00,
-  0x07,0x00,0x00,0x01,0x21,0x35,0x21,0x15,0x23,0x11,0x23,
-  0x01,0x58,0xFE,0xE7,0x01,0xF7,0x53,0x8B,0x01,0xE5,0x73,
-  0x73,0xFE,0x1B,0x00,0x02,0x00,0x4F,0x00,0x00,0x02,0x64,
-  0x02,0x59,0x00,0x1F,0x00,0x23,0x00,0x00,0x01,0x31,0x11,
-  0x23,0x11,0x26,0x27,0x26,0x27,0x26,0x27,0x26,0x27,0x23,
-  0x26,0x27,0x26,0x27,0x26,0x23,0x21,0x35,0x21,0x16,0x17,
-  0x16,0x17,0x16,0x17,0x16,0x17,0x16,0x01,0x11,0x33,0x11,
-  0x02,0x64,0x8B,0x0B,0x0A,0x02,0x03,0x02,0x02,0x08,0x02,
-  0x01,0x03,0x03,0x1B,0x31,0x06,0x04,0xFE,0xFB,0x01,0x11,
-  0x54,0x3C,0x03,0x03,0x27,0x17,0x23,0x0B,0x01,0xFD,0xEC,
-  0x8B,0x01,0x76,0xFE,0x8A,0x01,0x6D,0x31,0x10,0x04,0x05,
-  0x03,0x02,0x0A,0x02,0x02,0x01,0x10,0x09,0x01,0x73,0x09,
-  0x1F,0x02,0x02,0x12,0x24,0x31,0x41,0x06,0xFE,0x82,0x01,
-  0x5D,0xFE,0xA3,0x00,0x00,0x01,0x00,0x4F,0x00,0x00,0x00,
-  0xDA,0x02,0x58,0x00,0x03,0x00,0x00,0x33,0x11,0x33,0x11,
-  0x4F,0x8B,0x02,0x58,0xFD,0xA8,0x00,0x01,0x00,0x3F,0x00,
-  0x00,0x01,0x73,0x02,0x58,0x00,0x07,0x00,0x00,0x13,0x23,
-  0x35,0x21,0x15,0x23,0x11,0x23,0x95,0x56,0x01,0x34,0x53,
-  0x8B,0x01,0xE5,0x73,0x73,0xFE,0x1B,0x00,0x01,0x00,0x4F,
-  0x00,0x00,0x02,0x64,0x02,0x58,0x00,0x20,0x00,0x00,0x01,
-  0x11,0x23,0x11,0x26,0x27,0x26,0x27,0x26,0x27,0x26,0x2F,
-  0x01,0x26,0x27,0x26,0x27,0x26,0x27,0x23,0x11,0x23,0x11,
-  0x21,0x16,0x17,0x16,0x17,0x16,0x17,0x16,0x17,0x16,0x02,
-  0x64,0x8B,0x0B,0x0A,0x02,0x03,0x02,0x02,0x08,0x02,0x01,
-  0x03,0x03,0x1B,0x31,0x06,0x04,0x7A,0x8B,0x01,0x11,0x48,
-  0x44,0x05,0x05,0x27,0x17,0x23,0x0B,0x01,0x01,0x76,0xFE,
-  0x8A,0x01,0x6D,0x31,0x10,0x04,0x05,0x02,0x03,0x0A,0x01,
-  0x01,0x01,0x02,0x0F,0x09,0x01,0x01,0xFE,0x1B,0x02,0x58,
-  0x03,0x24,0x02,0x03,0x13,0x23,0x32,0x40,0x06,0x00,0x01,
-  0x00,0x4C,0x00,0x00,0x02,0x62,0x02,0x58,0x00,0x51,0x00,
-  0x00,0x01,0x31,0x22,0x07,0x35,0x36,0x33,0x32,0x17,0x16,
-  0x17,0x16,0x17,0x16,0x17,0x15,0x06,0x07,0x06,0x07,0x06,
-  0x07,0x06,0x23,0x22,0x27,0x26,0x27,0x26,0x27,0x26,0x27,
-  0x11,0x33,0x11,0x16,0x17,0x16,0x17,0x16,0x17,0x16,0x17,
-  0x16,0x17,0x16,0x17,0x39,0x01,0x16,0x33,0x36,0x37,0x35,
-  0x33,0x36,0x37,0x36,0x37,0x36,0x37,0x36,0x37,0x3D,0x01,
-  0x36,0x37,0x35,0x26,0x27,0x26,0x27,0x26,0x27,0x26,0x27,
-  0x26,0x27,0x26,0x27,0x31,0x26,0x01,0x54,0x1B,0x13,0x21,
-  0x12,0x4B,0x4F,0x26,0x17,0x24,0x0B,0x01,0x01,0x0B,0x1E,
-  0x04,0x04,0x17,0x26,0x4E,0x4F,0x4D,0x4F,0x25,0x18,0x24,
-  0x0B,0x01,0x01,0x8B,0x0B,0x0A,0x02,0x04,0x01,0x02,0x09,
-  0x04,0x02,0x02,0x2C,0x0F,0x07,0x0E,0x20,0x17,0x01,0x02,
-  0x16,0x0B,0x03,0x02,0x02,0x12,0x09,0x02,0x01,0x0B,0x09,
-  0x03,0x03,0x02,0x02,0x08,0x04,0x03,0x03,0x2B,0x0B,0x0A,
-  0x01,0xE5,0x0C,0x7A,0x05,0x2C,0x12,0x24,0x34,0x40,0x06,
-  0x06,0x94,0x45,0x2F,0x06,0x06,0x24,0x12,0x2C,0x2C,0x12,
-  0x24,0x34,0x40,0x06,0x06,0x01,0x76,0xFE,0x93,0x31,0x10,
-  0x04,0x05,0x02,0x03,0x0A,0x03,0x01,0x01,0x17,0x02,0x01,
-  0x01,0x0B,0x01,0x01,0x0C,0x06,0x04,0x02,0x03,0x19,0x28,
-  0x01,0x01,0x07,0x05,0x82,0x31,0x10,0x04,0x05,0x02,0x03,
-  0x0A,0x02,0x01,0x02,0x16,0x02,0x02,0x00,0x01,0x00,0x49,
-  0x01,0x14,0x00,0xD4,0x02,0x58,0x00,0x03,0x00,0x00,0x13,
-  0x07,0x11,0x33,0xD4,0x8B,0x8B,0x01,0x4D,0x39,0x01,0x44,
-  0x00,0x01,0x00,0x3E,0xFF,0x38,0x02,0x08,0x02,0x58,0x00,
-  0x1E,0x00,0x00,0x05,0x11,0x26,0x27,0x26,0x27,0x26,0x27,
-  0x26,0x27,0x26,0x27,0x26,0x27,0x23,0x26,0x27,0x23,0x35,
-  0x33,0x16,0x17,0x16,0x17,0x16,0x17,0x16,0x17,0x16,0x17,
-  0x11,0x01,0x7D,0x0B,0x0A,0x02,0x03,0x02,0x02,0x08,0x05,
-  0x02,0x03,0x1A,0x31,0x01,0x05,0x04,0xBA,0xC5,0x53,0x3D,
-  0x03,0x04,0x26,0x17,0x24,0x0B,0x01,0x01,0xC8,0x02,0x35,
-  0x31,0x10,0x04,0x05,0x02,0x03,0x0A,0x02,0x01,0x02,0x0F,
-  0x09,0x01,0x01,0x73,0x09,0x1F,0x02,0x02,0x12,0x24,0x34,
-  0x40,0x06,0x06,0xFD,0xC2,0x00,0x01,0x00,0x4B,0x00,0x00,
-  0x02,0x16,0x02,0x58,0x00,0x3A,0x00,0x00,0x21,0x31,0x23,
-  0x35,0x33,0x36,0x37,0x33,0x36,0x37,0x36,0x37,0x36,0x37,
-  0x36,0x37,0x3D,0x01,0x36,0x37,0x35,0x26,0x27,0x26,0x27,
-  0x26,0x27,0x26,0x27,0x26,0x27,0x26,0x27,0x23,0x26,0x27,
-  0x23,0x35,0x33,0x16,0x17,0x16,0x17,0x16,0x17,0x16,0x17,
-  0x16,0x17,0x15,0x06,0x07,0x06,0x07,0x06,0x07,0x06,0x07,
-  0x06,0x01,0x11,0xC5,0xBA,0x36,0x13,0x01,0x05,0x06,0x0A,
-  0x03,0x02,0x03,0x12,0x09,0x02,0x01,0x0B,0x0A,0x03,0x03,
-  0x01,0x02,0x09,0x04,0x03,0x02,0x1B,0x30,0x01,0x05,0x04,
-  0xBA,0xC5,0x53,0x3C,0x04,0x04,0x25,0x18,0x24,0x0B,0x01,
-  0x01,0x0B,0x1F,0x03,0x04,0x18,0x25,0x40,0x4F,0x04,0x73,
-  0x0A,0x0A,0x03,0x03,0x06,0x04,0x02,0x03,0x19,0x28,0x01,
-  0x01,0x07,0x05,0x82,0x31,0x10,0x04,0x05,0x02,0x03,0x0A,
-  0x02,0x01,0x02,0x0F,0x09,0x01,0x01,0x73,0x09,0x1F,0x02,
-  0x02,0x12,0x24,0x34,0x40,0x06,0x06,0x94,0x45,0x2F,0x06,
-  0x06,0x24,0x12,0x21,0x0A,0x01,0x00,0x00,0x01,0x00,0x3E,
-  0x00,0x00,0x02,0x53,0x02,0xEE,0x00,0x24,0x00,0x00,0x25,
-  0x15,0x23,0x35,0x36,0x37,0x36,0x37,0x36,0x37,0x36,0x37,
-  0x36,0x37,0x35,0x31,0x36,0x37,0x35,0x21,0x11,0x33,0x15,
-  0x21,0x15,0x06,0x07,0x06,0x07,0x06,0x07,0x06,0x07,0x06,
-  0x07,0x15,0x14,0x01,0x9A,0x8B,0x08,0x03,0x08,0x11,0x1D,
-  0x3E,0x1D,0x06,0x0F,0x05,0x02,0x01,0xFE,0x76,0x8B,0x01,
-  0x8A,0x05,0x13,0x05,0x07,0x1F,0x42,0x18,0x05,0x15,0x02,
-  0x65,0x65,0x6B,0x42,0x0A,0x1A,0x18,0x28,0x25,0x11,0x0A,
-  0x16,0x28,0x01,0x0B,0x08,0x42,0x01,0x09,0x96,0xBC,0x45,
-  0x23,0x0B,0x0A,0x2F,0x25,0x0E,0x06,0x1B,0x24,0x01,0x07,
-  0x00,0x02,0x00,0x50,0x00,0x00,0x02,0x65,0x02,0x58,0x00,
-  0x09,0x00,0x13,0x00,0x00,0x29,0x01,0x11,0x21,0x32,0x17,
-  0x16,0x17,0x16,0x15,0x07,0x35,0x26,0x27,0x26,0x27,0x26,
-  0x27,0x23,0x11,0x02,0x65,0xFD,0xEB,0x01,0x0A,0x58,0x45,
-  0x44,0x1D,0x0D,0x8B,0x03,0x21,0x06,0x06,0x28,0x28,0x7F,
-  0x02,0x58,0x2C,0x2B,0x4A,0x22,0x24,0xFE,0xFE,0x32,0x1F,
-  0x06,0x03,0x19,0x01,0xFE,0x8E,0x00,0x01,0x00,0x43,0x00,
-  0x00,0x02,0x79,0x02,0x58,0x00,0x1E,0x00,0x00,0x01,0x03,
-  0x23,0x13,0x23,0x35,0x21,0x32,0x17,0x16,0x17,0x16,0x15,
-  0x11,0x21,0x35,0x33,0x35,0x34,0x27,0x26,0x27,0x23,0x27,
-  0x31,0x27,0x23,0x26,0x27,0x26,0x23,0x01,0x2A,0x48,0x8C,
-  0x48,0x5B,0x01,0x2C,0x46,0x35,0x4D,0x27,0x1B,0xFE,0xF2,
-  0x83,0x0C,0x16,0x0D,0x01,0x01,0x01,0x01,0x07,0x0F,0x14,
-  0x22,0x01,0xE5,0xFE,0x1B,0x01,0xE5,0x73,0x19,0x23,0x42,
-  0x2B,0x3E,0xFE,0x8F,0x73,0xFE,0x20,0x13,0x20,0x09,0x01,
-  0x01,0x04,0x08,0x0A,0x00,0x00,0x01,0x00,0x4F,0xFF,0x38,
-  0x00,0xDA,0x02,0x58,0x00,0x03,0x00,0x00,0x17,0x11,0x33,
-  0x11,0x4F,0x8B,0xC8,0x03,0x20,0xFC,0xE0,0x00,0x00,0x01,
-  0x00,0x49,0x00,0x00,0x01,0x67,0x02,0x58,0x00,0x18,0x00,
-  0x00,0x29,0x01,0x35,0x33,0x35,0x26,0x27,0x26,0x27,0x26,
-  0x27,0x26,0x27,0x26,0x23,0x35,0x32,0x17,0x16,0x17,0x16,
-  0x17,0x15,0x16,0x15,0x01,0x67,0xFE,0xE2,0x93,0x0B,0x0A,
-  0x02,0x03,0x02,0x02,0x06,0x0E,0x29,0x2D,0x5A,0x4D,0x28,
-  0x13,0x2A,0x06,0x01,0x73,0xFA,0x31,0x10,0x04,0x05,0x02,
-  0x03,0x08,0x09,0x18,0x73,0x2D,0x17,0x1E,0x3C,0x35,0x01,
-  0x07,0x07,0x00,0x00,0x02,0x00,0x4B,0xFF,0xFF,0x02,0x61,
-  0x02,0x58,0x00,0x1F,0x00,0x51,0x00,0x00,0x21,0x31,0x06,
-  0x27,0x26,0x27,0x26,0x27,0x26,0x35,0x11,0x21,0x16,0x17,
-  0x33,0x15,0x16,0x17,0x16,0x17,0x16,0x17,0x16,0x17,0x15,
-  0x06,0x07,0x06,0x07,0x06,0x07,0x06,0x27,0x36,0x3F,0x01,
-  0x33,0x36,0x37,0x36,0x37,0x36,0x37,0x36,0x37,0x3D,0x01,
-  0x36,0x37,0x35,0x26,0x27,0x26,0x27,0x26,0x27,0x26,0x27,
-  0x26,0x27,0x26,0x27,0x31,0x26,0x27,0x23,0x15,0x16,0x17,
-  0x16,0x17,0x16,0x17,0x16,0x17,0x16,0x17,0x16,0x17,0x33,
-  0x31,0x16,0x01,0x56,0x4C,0x50,0x26,0x17,0x2A,0x06,0x01,
-  0x01,0x10,0x47,0x44,0x01,0x05,0x06,0x25,0x18,0x23,0x0C,
-  0x01,0x01,0x0B,0x1F,0x03,0x04,0x18,0x25,0x51,0x4C,0x20,
-  0x16,0x01,0x01,0x01,0x17,0x0A,0x03,0x02,0x03,0x12,0x09,
-  0x01,0x02,0x0C,0x09,0x03,0x03,0x02,0x01,0x09,0x04,0x03,
-  0x02,0x1B,0x31,0x05,0x04,0x7A,0x0B,0x09,0x03,0x03,0x02,
-  0x02,0x08,0x05,0x02,0x02,0x2B,0x0F,0x01,0x07,0x01,0x2D,
-  0x12,0x24,0x3C,0x35,0x07,0x08,0x01,0x76,0x03,0x23,0x01,
-  0x02,0x03,0x12,0x24,0x34,0x40,0x06,0x06,0x94,0x45,0x2F,
-  0x06,0x06,0x24,0x12,0x2D,0x74,0x01,0x0B,0x01,0x01,0x0C,
-  0x06,0x04,0x02,0x03,0x19,0x28,0x01,0x01,0x07,0x05,0x82,
-  0x31,0x10,0x04,0x05,0x02,0x03,0x0A,0x02,0x01,0x02,0x0F,
-  0x09,0x01,0x01,0xFA,0x31,0x10,0x04,0x05,0x02,0x03,0x0A,
-  0x03,0x01,0x01,0x17,0x02,0x01,0x00,0x00,0x01,0x00,0x3C,
-  0xFF,0xC9,0x02,0x43,0x02,0x58,0x00,0x19,0x00,0x00,0x25,
-  0x36,0x37,0x30,0x31,0x36,0x37,0x36,0x37,0x36,0x31,0x11,
-  0x33,0x11,0x06,0x07,0x06,0x07,0x06,0x0F,0x01,0x05,0x35,
-  0x37,0x03,0x33,0x01,0x5A,0x29,0x0F,0x02,0x01,0x15,0x08,
-  0x06,0x8B,0x0D,0x0E,0x0D,0x17,0x26,0x44,0x21,0xFE,0xC3,
-  0x98,0x71,0x8E,0x88,0x11,0x0F,0x01,0x02,0x16,0x26,0x1F,
-  0x01,0x52,0xFE,0xA4,0x48,0x1B,0x1A,0x1A,0x2A,0x1A,0x0C,
-  0x4C,0x78,0x24,0x01,0xF3,0x00,0x01,0x00,0x48,0xFF,0x38,
-  0x02,0x4E,0x02,0x59,0x00,0x27,0x00,0x00,0x05,0x11,0x26,
-  0x27,0x26,0x27,0x26,0x2F,0x01,0x31,0x27,0x26,0x27,0x26,
-  0x23,0x15,0x14,0x17,0x16,0x3B,0x01,0x15,0x23,0x26,0x27,
-  0x26,0x27,0x26,0x3D,0x01,0x21,0x16,0x17,0x16,0x17,0x16,
-  0x17,0x16,0x17,0x11,0x01,0xC3,0x05,0x03,0x01,0x03,0x15,
-  0x0E,0x01,0x01,0x07,0x12,0x13,0x93,0x0B,0x0B,0x21,0x35,
-  0x41,0x3E,0x04,0x25,0x1E,0x31,0x01,0x00,0x45,0x32,0x4D,
-  0x27,0x15,0x04,0x01,0x01,0xC8,0x02,0x37,0x2A,0x05,0x03,
-  0x04,0x20,0x08,0x01,0x01,0x04,0x09,0x0A,0x4F,0x23,0x08,
-  0x08,0x73,0x08,0x01,0x0A,0x18,0x31,0x41,0xCB,0x02,0x17,
-  0x23,0x42,0x22,0x35,0x09,0x06,0xFD,0xC3,0x00,0x01,0x00,
-  0x4F,0x00,0x00,0x02,0x56,0x02,0x58,0x00,0x4E,0x00,0x00,
-  0x21,0x31,0x21,0x35,0x33,0x36,0x37,0x36,0x37,0x36,0x3F,
-  0x01,0x35,0x36,0x37,0x36,0x37,0x36,0x3D,0x01,0x26,0x27,
-  0x35,0x27,0x34,0x31,0x30,0x31,0x27,0x26,0x27,0x26,0x27,
-  0x35,0x23,0x27,0x26,0x27,0x26,0x23,0x15,0x14,0x17,0x16,
-  0x3B,0x01,0x15,0x23,0x26,0x27,0x26,0x27,0x26,0x27,0x34,
-  0x3D,0x01,0x21,0x16,0x17,0x16,0x17,0x16,0x17,0x16,0x1D,
-  0x01,0x07,0x06,0x07,0x06,0x07,0x06,0x07,0x2B,0x03,0x06,
-  0x01,0x4F,0xFF,0x00,0xF8,0x2F,0x05,0x02,0x03,0x22,0x0C,
-  0x01,0x05,0x0A,0x08,0x03,0x01,0x05,0x03,0x01,0x01,0x01,
-  0x01,0x15,0x0E,0x01,0x01,0x07,0x12,0x13,0x93,0x0B,0x0B,
-  0x21,0x35,0x41,0x3D,0x05,0x24,0x1F,0x30,0x01,0x01,0x00,
-  0x46,0x31,0x4D,0x27,0x15,0x05,0x01,0x07,0x05,0x0F,0x27,
-  0x4D,0x29,0x42,0x01,0x01,0x01,0x01,0x04,0x73,0x05,0x02,
-  0x01,0x02,0x12,0x0E,0x01,0x01,0x06,0x0F,0x0A,0x1F,0x07,
-  0x06,0x84,0x2A,0x05,0x01,0x01,0x01,0x01,0x01,0x02,0x20,
-  0x08,0x01,0x01,0x04,0x09,0x0A,0x4F,0x22,0x08,0x09,0x73,
-  0x08,0x01,0x0A,0x18,0x2D,0x40,0x02,0x03,0xCB,0x02,0x17,
-  0x23,0x42,0x22,0x35,0x09,0x06,0x90,0x37,0x18,0x17,0x42,
-  0x23,0x14,0x04,0x01,0x00,0x01,0x00,0x1B,0xFF,0x38,0x02,
-  0x20,0x02,0x58,0x00,0x16,0x00,0x00,0x01,0x36,0x37,0x36,
-  0x37,0x36,0x37,0x35,0x33,0x15,0x06,0x07,0x06,0x07,0x06,
-  0x07,0x06,0x07,0x11,0x23,0x11,0x03,0x33,0x01,0x51,0x15,
-  0x04,0x07,0x0A,0x13,0x07,0x8B,0x0A,0x23,0x02,0x03,0x19,
-  0x27,0x20,0x1F,0x8B,0xC9,0x9E,0x01,0x6A,0x02,0x04,0x04,
-  0x0A,0x14,0x2A,0x9C,0xA7,0x39,0x30,0x03,0x04,0x25,0x11,
-  0x0D,0x05,0xFE,0x3F,0x01,0xE6,0x01,0x3A,0x00,0x00,0x01,
-  0x00,0x3D,0x00,0x00,0x02,0x5E,0x02,0x58,0x00,0x19,0x00,
-  0x00,0x01,0x36,0x37,0x36,0x3F,0x01,0x31,0x36,0x37,0x36,
-  0x37,0x35,0x33,0x15,0x06,0x07,0x06,0x07,0x06,0x07,0x13,
-  0x21,0x35,0x21,0x01,0x33,0x01,0x75,0x14,0x04,0x05,0x04,
-  0x01,0x02,0x02,0x11,0x0C,0x8B,0x0A,0x23,0x02,0x03,0x1E,
-  0x3B,0xA6,0xFD,0xF8,0x01,0x20,0xFE,0xC7,0x9E,0x01,0x6A,
-  0x02,0x04,0x03,0x05,0x01,0x02,0x03,0x16,0x28,0x9C,0xA7,
-  0x39,0x30,0x03,0x04,0x2D,0x12,0xFE,0xFE,0x73,0x01,0xE5,
-  0x00,0x02,0x00,0x50,0xFF,0x38,0x02,0x58,0x02,0x59,0x00,
-  0x1D,0x00,0x21,0x00,0x00,0x25,0x31,0x06,0x07,0x06,0x07,
-  0x35,0x17,0x36,0x37,0x33,0x37,0x36,0x37,0x36,0x37,0x36,
-  0x37,0x36,0x37,0x35,0x21,0x35,0x21,0x11,0x06,0x07,0x06,
-  0x07,0x06,0x01,0x11,0x23,0x11,0x01,0xE9,0x42,0x39,0x0E,
-  0x11,0x06,0x29,0x09,0x01,0x01,0x08,0x0B,0x0D,0x05,0x13,
-  0x08,0x02,0x01,0xFE,0x84,0x02,0x07,0x09,0x23,0x02,0x03,
-  0x15,0xFE,0xCA,0x8B,0x5E,0x25,0x06,0x01,0x01,0x74,0x01,
-  0x08,0x05,0x01,0x04,0x08,0x0A,0x06,0x19,0x29,0x08,0x05,
-  0xC8,0x73,0xFE,0xBC,0x45,0x33,0x04,0x04,0x20,0x00,0xFF,
-  0xFD,0xC5,0x02,0x3B,0x00,0x01,0x00,0x3F,0x00,0x00,0x02,
-  0x12,0x02,0x59,0x00,0x1F,0x00,0x00,0x01,0x31,0x11,0x23,
-  0x11,0x26,0x27,0x26,0x27,0x26,0x27,0x26,0x27,0x23,0x26,
-  0x27,0x26,0x27,0x26,0x2B,0x01,0x35,0x33,0x16,0x17,0x16,
-  0x17,0x16,0x17,0x16,0x17,0x16,0x02,0x12,0x8B,0x0B,0x0A,
-  0x02,0x03,0x02,0x02,0x08,0x02,0x01,0x03,0x03,0x1B,0x31,
-  0x06,0x04,0xC3,0xCF,0x54,0x3C,0x03,0x03,0x27,0x17,0x23,
-  0x0B,0x01,0x01,0x76,0xFE,0x8A,0x01,0x6D,0x31,0x10,0x04,
-  0x05,0x03,0x02,0x0A,0x02,0x02,0x01,0x10,0x09,0x01,0x73,
-  0x09,0x1F,0x02,0x02,0x12,0x24,0x31,0x41,0x06,0x00,0x01,
-  0x00,0x4C,0x00,0x00,0x02,0xFF,0x02,0x58,0x00,0x32,0x00,
-  0x00,0x13,0x33,0x32,0x37,0x36,0x3D,0x01,0x33,0x15,0x14,
-  0x07,0x06,0x07,0x06,0x27,0x23,0x17,0x16,0x17,0x16,0x17,
-  0x16,0x3B,0x01,0x32,0x37,0x36,0x37,0x31,0x36,0x37,0x36,
-  0x35,0x11,0x33,0x11,0x16,0x07,0x06,0x07,0x06,0x2B,0x01,
-  0x22,0x27,0x26,0x27,0x26,0x35,0x11,0x33,0xD7,0x44,0x1F,
-  0x11,0x14,0x8B,0x3A,0x31,0x4E,0x0B,0x0B,0x35,0x06,0x19,
-  0x14,0x08,0x15,0x27,0x21,0x4F,0x22,0x25,0x29,0x0F,0x06,
-  0x0C,0x15,0x8B,0x01,0x27,0x2E,0x4D,0x40,0x50,0x4F,0x50,
-  0x41,0x4D,0x2E,0x26,0x8B,0x01,0x43,0x11,0x11,0x1E,0xD5,
-  0xD5,0x50,0x2F,0x2F,0x05,0x01,0x01,0x0A,0x23,0x0D,0x06,
-  0x0B,0x12,0x12,0x16,0x12,0x08,0x11,0x22,0x21,0x01,0x4F,
-  0xFE,0xB1,0x42,0x39,0x47,0x25,0x22,0x22,0x25,0x47,0x37,
-  0x44,0x01,0x4F,0x00,0x01,0x00,0x3E,0xFF,0xFF,0x02,0xAD,
-  0x02,0x58,0x00,0x36,0x00,0x00,0x01,0x11,0x07,0x06,0x07,
-  0x06,0x07,0x06,0x07,0x06,0x07,0x06,0x27,0x35,0x32,0x17,
-  0x32,0x37,0x36,0x37,0x36,0x37,0x36,0x37,0x36,0x37,0x35,
-  0x23,0x35,0x21,0x16,0x17,0x16,0x17,0x16,0x17,0x16,0x17,
-  0x11,0x23,0x11,0x26,0x2F,0x01,0x26,0x27,0x26,0x2F,0x01,
-  0x26,0x27,0x26,0x27,0x26,0x27,0x01,0x48,0x04,0x06,0x11,
-  0x11,0x2F,0x46,0x3A,0x09,0x0A,0x0B,0x11,0x01,0x1B,0x1B,
-  0x0F,0x06,0x0A,0x11,0x0B,0x0A,0x01,0x01,0x01,0x42,0x01,
-  0x2E,0x55,0x41,0x29,0x15,0x23,0x0B,0x01,0x01,0x8B,0x0B,
-  0x09,0x01,0x04,0x05,0x08,0x02,0x01,0x03,0x03,0x1A,0x30,
-  0x07,0x05,0x01,0xE5,0xFF,0x00,0x43,0x1F,0x1D,0x23,0x17,
-  0x24,0x06,0x01,0x01,0x01,0x06,0x74,0x06,0x07,0x02,0x05,
-  0x08,0x10,0x0F,0x22,0x12,0x0D,0xFC,0x73,0x0A,0x21,0x15,
-  0x21,0x32,0x40,0x07,0x08,0xFE,0x8A,0x01,0x6E,0x31,0x0F,
-  0x01,0x06,0x08,0x0A,0x01,0x01,0x01,0x02,0x0E,0x09,0x01,
-  0x01,0x00,0x02,0x00,0x4F,0x00,0x00,0x01,0xDB,0x02,0x58,
-  0x00,0x03,0x00,0x07,0x00,0x00,0x33,0x11,0x33,0x11,0x33,
-  0x11,0x33,0x11,0x4F,0x8B,0x76,0x8B,0x02,0x58,0xFD,0xA8,
-  0x02,0x58,0xFD,0xA8,0x00,0x02,0x00,0x49,0x00,0x00,0x01,
-  0xD7,0x02,0x58,0x00,0x03,0x00,0x07,0x00,0x00,0x13,0x07,
-  0x11,0x33,0x13,0x11,0x33,0x11,0xD4,0x8B,0x8B,0x78,0x8B,
-  0x01,0x4D,0x39,0x01,0x44,0xFD,0xA8,0x02,0x58,0xFD,0xA8,
-  0x00,0x02,0x00,0x49,0x01,0x14,0x01,0xD6,0x02,0x58,0x00,
-  0x03,0x00,0x07,0x00,0x00,0x13,0x07,0x11,0x33,0x01,0x07,
-  0x11,0x33,0xD4,0x8B,0x8B,0x01,0x02,0x8B,0x8B,0x01,0x4D,
-  0x39,0x01,0x44,0xFE,0xF5,0x39,0x01,0x44,0x00,0x00,0x01,
-  0x00,0x32,0x01,0xD6,0x00,0xBC,0x02,0xD9,0x00,0x05,0x00,
-  0x00,0x13,0x15,0x07,0x23,0x27,0x35,0xBC,0x2A,0x38,0x28,
-  0x02,0xD9,0x82,0x81,0x81,0x82,0x00,0x02,0x00,0x32,0x01,
-  0xD6,0x01,0xA8,0x02,0xD9,0x00,0x05,0x00,0x0B,0x00,0x00,
-  0x13,0x15,0x07,0x23,0x27,0x35,0x21,0x15,0x07,0x23,0x27,
-  0x35,0xBC,0x2A,0x38,0x28,0x01,0x76,0x2A,0x38,0x28,0x02,
-  0xD9,0x82,0x81,0x81,0x82,0x82,0x81,0x81,0x82,0x00,0x00,
-  0x02,0x00,0x18,0x00,0x00,0x02,0x0A,0x02,0xC5,0x00,0x0A,
-  0x00,0x0D,0x00,0x00,0x01,0x15,0x23,0x15,0x23,0x35,0x21,
-  0x35,0x01,0x33,0x11,0x23,0x11,0x03,0x02,0x0A,0x4A,0x8C,
-  0xFE,0xE4,0x01,0x03,0xA5,0x8C,0xB9,0x01,0x11,0x74,0x9D,
-  0x9D,0x76,0x01,0xB2,0xFE,0x4C,0x01,0x2F,0xFE,0xD1,0x00,
-  0x00,0x01,0x00,0x2A,0xFF,0xE9,0x02,0xC7,0x02,0xE5,0x00,
-  0x28,0x00,0x00,0x01,0x11,0x23,0x27,0x06,0x07,0x06,0x23,
-  0x22,0x27,0x26,0x35,0x34,0x37,0x36,0x33,0x32,0x17,0x16,
-  0x17,0x23,0x26,0x27,0x26,0x23,0x22,0x07,0x06,0x15,0x14,
-  0x17,0x16,0x33,0x32,0x37,0x36,0x37,0x36,0x37,0x23,0x35,
-  0x02,0xC7,0x5A,0x12,0x44,0x6A,0x16,0x18,0x95,0x60,0x60,
-  0x6F,0x60,0x92,0xA6,0x57,0x35,0x0A,0x8D,0x11,0x1C,0x32,
-  0x4F,0x7B,0x34,0x1D,0x4F,0x36,0x4B,0x57,0x3A,0x02,0x02,
-  0x1F,0x05,0xA6,0x01,0x88,0xFE,0x76,0x60,0x64,0x0E,0x03,
-  0x6D,0x6C,0xA5,0xB7,0x6A,0x5D,0x64,0x3C,0x55,0x31,0x18,
-  0x2C,0x6C,0x3B,0x55,0x85,0x49,0x32,0x41,0x02,0x03,0x24,
-  0x38,0x7D,0x00,0x00,0x01,0x00,0x0D,0x00,0x00,0x03,0xA4,
-  0x02,0xD9,0x00,0x0C,0x00,0x00,0x21,0x23,0x0B,0x01,0x23,
-  0x03,0x33,0x1B,0x01,0x33,0x1B,0x01,0x33,0x02,0xDA,0x87,
-  0x7A,0x77,0x87,0xCE,0x9F,0x71,0x71,0x94,0x76,0x6D,0x9F,
-  0x02,0x39,0xFD,0xC7,0x02,0xD9,0xFD,0xDE,0x02,0x22,0xFD,
-  0xDD,0x02,0x23,0x00,0x00,0x02,0x00,0x22,0xFF,0x26,0x02,
-  0x1D,0x02,0x25,0x00,0x24,0x00,0x34,0x00,0x00,0x01,0x33,
-  0x11,0x14,0x07,0x06,0x07,0x06,0x23,0x22,0x27,0x26,0x27,
-  0x33,0x16,0x33,0x32,0x37,0x36,0x3D,0x01,0x06,0x07,0x06,
-  0x23,0x22,0x27,0x26,0x35,0x34,0x37,0x36,0x33,0x32,0x17,
-  0x16,0x17,0x07,0x22,0x07,0x06,0x15,0x14,0x17,0x16,0x33,
-  0x32,0x37,0x36,0x35,0x34,0x27,0x26,0x01,0x98,0x85,0x7A,
-  0x26,0x30,0x17,0x1A,0x7A,0x40,0x34,0x01,0x91,0x11,0x52,
-  0x4A,0x1F,0x0E,0x38,0x36,0x13,0x18,0x73,0x3D,0x2D,0x4F,
-  0x3D,0x54,0x57,0x3B,0x02,0x02,0x78,0x41,0x1F,0x12,0x37,
-  0x1A,0x1F,0x46,0x22,0x14,0x37,0x1E,0x02,0x1C,0xFD,0xD2,
-  0x82,0x30,0x0F,0x05,0x02,0x34,0x2B,0x3A,0x3F,0x37,0x18,
-  0x1F,0x49,0x3F,0x0B,0x04,0x63,0x4A,0x6B,0x8D,0x55,0x42,
-  0x56,0x03,0x03,0x19,0x49,0x2B,0x39,0x66,0x2B,0x14,0x46,
-  0x28,0x37,0x62,0x31,0x1A,0x00,0x00,0x01,0x00,0x43,0x00,
-  0x00,0x00,0xCF,0x02,0xD9,0x00,0x03,0x00,0x00,0x13,0x11,
-  0x23,0x11,0xCF,0x8C,0x02,0xD9,0xFD,0x27,0x02,0xD9,0x00,
-  0x01,0x00,0x3C,0x00,0x00,0x03,0x38,0x02,0x25,0x00,0x29,
-  0x00,0x00,0x13,0x33,0x15,0x36,0x37,0x36,0x33,0x32,0x1F,
-  0x01,0x16,0x17,0x36,0x37,0x32,0x17,0x16,0x15,0x11,0x23,
-  0x11,0x34,0x27,0x26,0x23,0x22,0x07,0x06,0x15,0x11,0x23,
-  0x11,0x34,0x27,0x26,0x23,0x22,0x07,0x06,0x15,0x11,0x23,
-  0x3C,0x8B,0x36,0x3E,0x0F,0x11,0x60,0x2B,0x01,0x04,0x03,
-  0x42,0x5C,0x76,0x27,0x0F,0x8C,0x31,0x0C,0x0F,0x46,0x14,
-  0x06,0x8C,0x31,0x0C,0x0F,0x46,0x14,0x06,0x8C,0x02,0x1C,
-  0x43,0x41,0x09,0x02,0x43,0x01,0x06,0x06,0x4D,0x03,0x58,
-  0x22,0x2D,0xFE,0x82,0x01,0x68,0x35,0x0E,0x03,0x40,0x13,
-  0x17,0xFE,0xBC,0x01,0x68,0x35,0x0E,0x03,0x40,0x13,0x17,
-  0xFE,0xBC,0x00,0x01,0x01,0x86,0x00,0xDF,0x03,0x2A,0x02,
-  0x2D,0x00,0x20,0x00,0x00,0x01,0x05,0x27,0x37,0x26,0x27,
-  0x26,0x35,0x34,0x37,0x36,0x1F,0x03,0x0F,0x02,0x2F,0x03,
-  0x26,0x07,0x06,0x15,0x14,0x17,0x16,0x33,0x32,0x3F,0x01,
-  0x03,0x2A,0xFE,0x72,0x16,0x8B,0x09,0x16,0x09,0x2A,0x27,
-  0x31,0x1C,0x1F,0x27,0x04,0x03,0x01,0x17,0x12,0x0F,0x0E,
-  0x18,0x15,0x16,0x17,0x17,0x18,0x13,0x42,0x45,0x01,0x44,
-  0x65,0x4E,0x21,0x08,0x2C,0x1B,0x17,0x34,0x27,0x1F,0x02,
-  0x02,0x06,0x09,0x20,0x15,0x13,0x04,0x03,0x02,0x01,0x02,
-  0x10,0x0F,0x15,0x18,0x12,0x12,0x12,0x12,0x00,0x00,0x02,
-  0x00,0x2C,0xFF,0x37,0x03,0x9B,0x01,0x60,0x00,0x03,0x00,
-  0x24,0x00,0x00,0x05,0x23,0x35,0x33,0x25,0x22,0x27,0x26,
-  0x3D,0x01,0x33,0x15,0x14,0x17,0x30,0x17,0x16,0x17,0x16,
-  0x31,0x21,0x32,0x35,0x34,0x2F,0x01,0x37,0x16,0x17,0x16,
-  0x17,0x16,0x15,0x14,0x07,0x06,0x23,0x01,0xFD,0x72,0x72,
-  0xFE,0xD5,0x51,0x31,0x24,0x71,0x10,0x07,0x0D,0x14,0x13,
-  0x02,0x13,0x27,0x0A,0x33,0x62,0x1F,0x10,0x21,0x03,0x01,
-  0x4B,0x1C,0x25,0xC9,0x73,0x56,0x2E,0x2A,0x56,0x48,0x36,
-  0x1E,0x13,0x04,0x07,0x02,0x01,0x1A,0x0C,0x12,0x63,0x44,
-  0x34,0x20,0x47,0x1D,0x06,0x05,0x6C,0x23,0x0E,0x00,0x03,
-  0x00,0x2C,0x00,0x00,0x03,0x9B,0x01,0xA9,0x00,0x03,0x00,
-  0x07,0x00,0x26,0x00,0x00,0x01,0x23,0x35,0x33,0x07,0x23,
-  0x35,0x33,0x03,0x22,0x27,0x26,0x3D,0x01,0x33,0x15,0x14,
-  0x1F,0x04,0x21,0x32,0x35,0x2F,0x03,0x37,0x1F,0x02,0x16,
-  0x15,0x14,0x07,0x06,0x23,0x02,0x3F,0x65,0x65,0x89,0x65,
-  0x65,0xE4,0x51,0x31,0x24,0x71,0x10,0x07,0x0F,0x12,0x13,
-  0x02,0x13,0x27,0x01,0x04,0x05,0x33,0x62,0x1B,0x14,0x11,
-  0x14,0x22,0x24,0x46,0x01,0x44,0x65,0x65,0x65,0xFE,0x57,
-  0x2E,0x2A,0x55,0x48,0x35,0x1E,0x13,0x05,0x06,0x02,0x02,
-  0x1B,0x0C,0x08,0x09,0x64,0x43,0x2D,0x26,0x25,0x2B,0x1F,
-  0x47,0x29,0x2D,0x00,0x00,0x04,0x00,0x2C,0x00,0x00,0x03,
-  0x9B,0x02,0x12,0x00,0x03,0x00,0x07,0x00,0x0B,0x00,0x2A,
-  0x00,0x00,0x01,0x23,0x15,0x33,0x27,0x23,0x15,0x33,0x37,
-  0x23,0x15,0x33,0x01,0x22,0x27,0x26,0x3D,0x01,0x33,0x15,
-  0x14,0x1F,0x04,0x21,0x32,0x35,0x2F,0x03,0x37,0x1F,0x02,
-  0x16,0x15,0x14,0x07,0x06,0x23,0x02,0x2D,0x65,0x65,0x7E,
-  0x64,0x64,0x3E,0x67,0x67,0xFE,0xE5,0x51,0x31,0x24,0x71,
-  0x10,0x07,0x0F,0x12,0x13,0x02,0x13,0x27,0x01,0x04,0x05,
-  0x33,0x62,0x1B,0x14,0x11,0x14,0x22,0x24,0x46,0x01,0x99,
-  0x67,0x67,0x67,0xE0,0x66,0xFE,0x54,0x2E,0x2A,0x56,0x48,
-  0x35,0x20,0x11,0x05,0x06,0x03,0x01,0x1B,0x0C,0x07,0x0A,
-  0x63,0x44,0x2D,0x27,0x24,0x2D,0x1E,0x47,0x28,0x2E,0x00,
-  0x00,0x01,0x00,0x2D,0xFE,0x9D,0x02,0x8A,0x01,0x9D,0x00,
-  0x46,0x00,0x00,0x25,0x0F,0x03,0x06,0x07,0x06,0x15,0x14,
-  0x17,0x16,0x33,0x32,0x37,0x36,0x3F,0x01,0x17,0x06,0x07,
-  0x06,0x07,0x06,0x23,0x22,0x2F,0x02,0x26,0x27,0x26,0x35,
-  0x34,0x3F,0x06,0x36,0x37,0x2F,0x01,0x07,0x22,0x0F,0x03,
-  0x27,0x3F,0x03,0x36,0x17,0x05,0x07,0x23,0x0F,0x09,0x01,
-  0x59,0x28,0x23,0x0F,0x18,0x14,0x0D,0x20,0x30,0x39,0x5C,
-  0x1B,0x23,0x0F,0x33,0x54,0x37,0x2D,0x54,0x19,0x2C,0x22,
-  0x1F,0x36,0x15,0x2E,0x12,0x5A,0x30,0x2D,0x3F,0x1A,0x06,
-  0x18,0x22,0x28,0x38,0x1E,0x18,0x36,0x54,0x09,0x03,0x0C,
-  0x0E,0x13,0x26,0x39,0x08,0x10,0x10,0x0F,0x23,0x2A,0x01,
-  0xCC,0x0C,0x3C,0x0D,0x0C,0x1B,0x0A,0x0D,0x2A,0x17,0x17,
-  0x22,0x11,0xA8,0x1F,0x1D,0x0E,0x18,0x14,0x15,0x2F,0x2A,
-  0x42,0x2F,0x37,0x05,0x02,0x0C,0x1F,0x69,0x18,0x1B,0x08,
-  0x07,0x06,0x04,0x08,0x07,0x1B,0x49,0x45,0x62,0x57,0x56,
-  0x1D,0x08,0x16,0x1E,0x1F,0x21,0x12,0x09,0x02,0x01,0x02,
-  0x01,0x03,0x07,0x13,0x5E,0x09,0x0E,0x0C,0x09,0x14,0x01,
-  0x10,0x7A,0x02,0x02,0x06,0x03,0x05,0x11,0x0C,0x0E,0x14,
-  0x0B,0x00,0x00,0x02,0x00,0x2D,0xFE,0x9D,0x02,0x8A,0x02,
-  0x51,0x00,0x03,0x00,0x4A,0x00,0x00,0x01,0x23,0x35,0x33,
-  0x03,0x0F,0x03,0x06,0x07,0x06,0x15,0x14,0x17,0x16,0x33,
-  0x32,0x37,0x36,0x3F,0x01,0x17,0x06,0x07,0x06,0x07,0x06,
-  0x23,0x22,0x2F,0x02,0x26,0x27,0x26,0x35,0x34,0x3F,0x06,
-  0x36,0x37,0x2F,0x01,0x07,0x22,0x0F,0x03,0x27,0x3F,0x03,
-  0x36,0x17,0x05,0x07,0x23,0x0F,0x09,0x01,0x73,0x71,0x71,
-  0x1A,0x28,0x23,0x0F,0x18,0x15,0x0C,0x20,0x30,0x38,0x5D,
-  0x22,0x1C,0x15,0x2D,0x54,0x37,0x2D,0x54,0x17,0x2E,0x22,
-  0x1F,0x30,0x1B,0x2E,0x12,0x5A,0x30,0x2D,0x3F,0x1A,0x06,
-  0x18,0x22,0x28,0x38,0x1A,0x1C,0x36,0x54,0x09,0x0E,0x01,
-  0x0E,0x13,0x26,0x39,0x08,0x10,0x10,0x0F,0x25,0x28,0x01,
-  0xCC,0x0C,0x3C,0x0D,0x0C,0x1B,0x0A,0x0D,0x2A,0x17,0x17,
-  0x22,0x11,0x01,0xDF,0x72,0xFE,0x57,0x1E,0x1E,0x0E,0x17,
-  0x17,0x13,0x2E,0x2B,0x41,0x30,0x36,0x04,0x03,0x0C,0x1F,
-  0x69,0x18,0x1B,0x08,0x08,0x06,0x05,0x08,0x07,0x1B,0x48,
-  0x45,0x62,0x57,0x56,0x1E,0x07,0x17,0x1D,0x1F,0x22,0x0F,
-  0x0B,0x02,0x01,0x02,0x01,0x03,0x07,0x13,0x5F,0x09,0x0E,
-  0x0B,0x09,0x15,0x01,0x11,0x7A,0x01,0x03,0x06,0x02,0x06,
-  0x11,0x0C,0x0E,0x13,0x0C,0x00,0x01,0x00,0x40,0xFE,0xF3,
-  0x04,0x8C,0x01,0x90,0x00,0x6B,0x00,0x00,0x25,0x06,0x27,
-  0x06,0x07,0x06,0x23,0x22,0x2F,0x02,0x14,0x0F,0x02,0x14,
-  0x0F,0x02,0x06,0x0F,0x01,0x06,0x07,0x06,0x23,0x22,0x27,
-  0x26,0x2F,0x02,0x26,0x3D,0x01,0x34,0x3F,0x05,0x17,0x0F,
-  0x03,0x06,0x17,0x16,0x1F,0x04,0x16,0x37,0x36,0x35,0x34,
-  0x2F,0x04,0x37,0x1F,0x02,0x16,0x33,0x32,0x37,0x36,0x3D,
-  0x01,0x33,0x15,0x17,0x16,0x17,0x16,0x33,0x32,0x35,0x34,
-  0x2F,0x01,0x37,0x1F,0x04,0x16,0x1D,0x02,0x0F,0x01,0x15,
-  0x0F,0x01,0x06,0x0F,0x03,0x03,0xF2,0x43,0x47,0x0E,0x1A,
-  0x21,0x2A,0x0D,0x19,0x10,0x0E,0x04,0x02,0x03,0x03,0x02,
-  0x04,0x02,0x02,0x05,0x27,0x39,0x4D,0x7A,0x67,0x4F,0x31,
-  0x2E,0x0A,0x0A,0x06,0x01,0x01,0x07,0x11,0x04,0x04,0x62,
-  0x06,0x05,0x0A,0x03,0x06,0x4A,0x18,0x21,0x12,0x13,0x11,
-  0x14,0x6B,0x34,0x2C,0x10,0x18,0x0D,0x0E,0x1A,0x60,0x2F,
-  0x0D,0x1C,0x21,0x25,0x18,0x10,0x12,0x69,0x02,0x03,0x13,
-  0x18,0x2C,0x38,0x1F,0x17,0x61,0x1A,0x0C,0x08,0x0C,0x0A,
-  0x07,0x01,0x02,0x02,0x06,0x0C,0x17,0x30,0x1E,0x10,0x22,
-  0x05,0x56,0x14,0x20,0x1B,0x06,0x07,0x09,0x3C,0x07,0x10,
-  0x12,0x03,0x05,0x0A,0x0B,0x09,0x02,0x0D,0x52,0x26,0x35,
-  0x33,0x1E,0x57,0x1E,0x24,0x24,0x23,0x0F,0x0B,0x01,0x0E,
-  0x16,0x45,0x07,0x07,0x22,0x11,0x12,0x29,0x26,0x56,0x33,
-  0x10,0x07,0x04,0x02,0x02,0x01,0x03,0x36,0x2E,0x5A,0x2C,
-  0x27,0x3F,0x1A,0x1D,0x2F,0x3D,0x56,0x16,0x27,0x2C,0x10,
-  0x16,0x24,0x78,0x32,0x20,0x34,0x1A,0x22,0x35,0x18,0x35,
-  0x28,0x3C,0x2E,0x18,0x15,0x1B,0x1C,0x1B,0x11,0x05,0x12,
-  0x08,0x0D,0x09,0x04,0x11,0x23,0x15,0x22,0x09,0x02,0x00,
-  0x00,0x01,0xFF,0xF7,0x00,0xCF,0x02,0x2D,0x01,0x37,0x00,
-  0x03,0x00,0x00,0x01,0x15,0x21,0x35,0x02,0x2D,0xFD,0xCA,
-  0x01,0x37,0x68,0x68,0x00,0x01,0xFF,0xF9,0x00,0xCF,0x03,
-  0xEB,0x01,0x37,0x00,0x03,0x00,0x00,0x01,0x15,0x21,0x35,
-  0x03,0xEB,0xFC,0x0E,0x01,0x37,0x68,0x68,0x00,0x01,0x00,
-  0x43,0x01,0xD5,0x00,0xCA,0x02,0xD9,0x00,0x0C,0x00,0x00,
-  0x13,0x23,0x35,0x34,0x37,0x36,0x37,0x36,0x37,0x15,0x06,
-  0x17,0x33,0xCA,0x87,0x2A,0x01,0x02,0x25,0x35,0x53,0x03,
-  0x50,0x01,0xD5,0x6D,0x4D,0x25,0x02,0x01,0x1F,0x03,0x2E,
-  0x0F,0x4A,0x00,0x00,0x01,0x00,0x42,0x01,0xD5,0x00,0xC9,
-  0x02,0xD9,0x00,0x0C,0x00,0x00,0x13,0x33,0x15,0x14,0x07,
-  0x06,0x07,0x06,0x07,0x35,0x36,0x27,0x23,0x42,0x87,0x2A,
-  0x01,0x02,0x25,0x35,0x53,0x03,0x50,0x02,0xD9,0x6D,0x4D,
-  0x25,0x02,0x01,0x1F,0x03,0x2E,0x0F,0x4A,0x00,0x00,0x01,
-  0x00,0x42,0xFF,0x79,0x00,0xC9,0x00,0x7D,0x00,0x0C,0x00,
-  0x00,0x37,0x33,0x15,0x14,0x07,0x06,0x07,0x06,0x07,0x35,
-  0x36,0x27,0x23,0x42,0x87,0x2A,0x01,0x02,0x25,0x35,0x53,
-  0x03,0x50,0x7D,0x6D,0x4D,0x25,0x02,0x01,0x1F,0x03,0x2E,
-  0x0F,0x4A,0x00,0x02,0x00,0x47,0x01,0xD5,0x01,0xB1,0x02,
-  0xD9,0x00,0x0C,0x00,0x19,0x00,0x00,0x13,0x23,0x35,0x34,
-  0x37,0x36,0x37,0x36,0x37,0x15,0x06,0x17,0x33,0x17,0x23,
-  0x35,0x34,0x37,0x36,0x37,0x36,0x37,0x15,0x06,0x17,0x33,
-  0xCE,0x87,0x2A,0x01,0x02,0x25,0x35,0x53,0x03,0x50,0xE3,
-  0x87,0x2A,0x01,0x02,0x25,0x35,0x53,0x03,0x50,0x01,0xD5,
-  0x6D,0x4D,0x25,0x02,0x01,0x1F,0x03,0x2E,0x0F,0x4A,0x7D,
-  0x6D,0x4D,0x25,0x02,0x01,0x1F,0x03,0x2E,0x0F,0x4A,0x00,
-  0x00,0x02,0x00,0x49,0x01,0xD5,0x01,0xB8,0x02,0xD9,0x00,
-  0x0C,0x00,0x19,0x00,0x00,0x13,0x33,0x15,0x14,0x07,0x06,
-  0x07,0x06,0x07,0x35,0x36,0x27,0x23,0x37,0x33,0x15,0x14,
-  0x07,0x06,0x07,0x06,0x07,0x35,0x36,0x27,0x23,0x49,0x87,
-  0x2A,0x01,0x02,0x25,0x35,0x53,0x03,0x50,0xE8,0x87,0x2A,
-  0x01,0x02,0x25,0x35,0x53,0x03,0x50,0x02,0xD9,0x6D,0x4D,
-  0x25,0x02,0x01,0x1F,0x03,0x2E,0x0F,0x4A,0x7D,0x6D,0x4D,
-  0x25,0x02,0x01,0x1F,0x03,0x2E,0x0F,0x4A,0x00,0x00,0x02,
-  0x00,0x48,0xFF,0x79,0x01,0xB0,0x00,0x7D,0x00,0x0C,0x00,
-  0x19,0x00,0x00,0x37,0x33,0x15,0x14,0x07,0x06,0x07,0x06,
-  0x07,0x35,0x36,0x27,0x23,0x37,0x33,0x15,0x14,0x07,0x06,
-  0x07,0x06,0x07,0x35,0x36,0x27,0x23,0x48,0x87,0x2A,0x01,
-  0x02,0x25,0x35,0x53,0x03,0x50,0xE1,0x87,0x2A,0x01,0x02,
-  0x25,0x35,0x53,0x03,0x50,0x7D,0x6D,0x4D,0x25,0x02,0x01,
-  0x1F,0x03,0x2E,0x0F,0x4A,0x7D,0x6D,0x4D,0x25,0x02,0x01,
-  0x1F,0x03,0x2E,0x0F,0x4A,0x00,0x01,0x00,0x1F,0xFF,0x3E,
-  0x02,0x0B,0x02,0xC5,0x00,0x0B,0x00,0x00,0x01,0x15,0x23,
-  0x11,0x23,0x11,0x23,0x35,0x33,0x35,0x33,0x15,0x02,0x0B,
-  0xB3,0x86,0xB3,0xB3,0x86,0x01,0xE5,0x74,0xFD,0xCD,0x02,
-  0x33,0x74,0xE0,0xE0,0x00,0x00,0x01,0x00,0x1C,0xFF,0x3E,
-  0x02,0x08,0x02,0xC5,0x00,0x13,0x00,0x00,0x01,0x15,0x23,
-  0x15,0x33,0x15,0x23,0x15,0x23,0x35,0x23,0x35,0x33,0x35,
-  0x23,0x35,0x33,0x35,0x33,0x15,0x02,0x08,0xB3,0xB3,0xB3,
-  0x86,0xB3,0xB3,0xB3,0xB3,0x86,0x01,0xE5,0x74,0xDF,0x74,
-  0xE0,0xE0,0x74,0xDF,0x74,0xE0,0xE0,0x00,0x00,0x01,0x00,
-  0x32,0x00,0xAF,0x01,0x2C,0x01,0xA9,0x00,0x0F,0x00,0x00,
-  0x13,0x32,0x17,0x16,0x15,0x14,0x07,0x06,0x23,0x22,0x27,
-  0x26,0x35,0x34,0x37,0x36,0xB1,0x3F,0x25,0x17,0x34,0x21,
-  0x28,0x40,0x26,0x17,0x36,0x20,0x01,0xA9,0x35,0x21,0x27,
-  0x40,0x26,0x17,0x34,0x21,0x28,0x42,0x25,0x16,0x00,0x03,
-  0x00,0x5C,0x00,0x00,0x03,0x8C,0x00,0x92,0x00,0x03,0x00,
-  0x07,0x00,0x0B,0x00,0x00,0x37,0x15,0x23,0x35,0x21,0x15,
-  0x23,0x35,0x21,0x15,0x23,0x35,0xF2,0x96,0x01,0xE3,0x96,
-  0x01,0xE3,0x96,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x00,
-  0x00,0x07,0x00,0x0B,0xFF,0xEA,0x03,0xDE,0x02,0xE3,0x00,
-  0x0F,0x00,0x20,0x00,0x24,0x00,0x34,0x00,0x44,0x00,0x54,
-  0x00,0x64,0x00,0x00,0x13,0x32,0x17,0x16,0x15,0x14,0x07,
-  0x06,0x23,0x22,0x27,0x26,0x35,0x34,0x37,0x36,0x17,0x22,
-  0x0F,0x01,0x06,0x15,0x14,0x17,0x16,0x33,0x32,0x37,0x36,
-  0x35,0x34,0x27,0x26,0x25,0x33,0x01,0x23,0x01,0x32,0x17,
-  0x16,0x15,0x14,0x07,0x06,0x23,0x22,0x27,0x26,0x35,0x34,
-  0x37,0x36,0x17,0x22,0x07,0x06,0x15,0x14,0x17,0x16,0x33,
-  0x32,0x37,0x36,0x35,0x34,0x27,0x26,0x25,0x32,0x17,0x16,
-  0x15,0x14,0x07,0x06,0x23,0x22,0x27,0x26,0x35,0x34,0x37,
-  0x36,0x17,0x22,0x07,0x06,0x15,0x14,0x17,0x16,0x33,0x32,
-  0x37,0x36,0x35,0x34,0x27,0x26,0xA0,0x4C,0x2C,0x1E,0x39,
-  0x29,0x33,0x4A,0x2D,0x1F,0x3A,0x28,0x33,0x29,0x14,0x01,
-  0x08,0x25,0x0F,0x12,0x2A,0x15,0x08,0x25,0x0E,0x01,0x3C,
-  0x43,0xFE,0x5B,0x42,0x01,0x8B,0x4C,0x2C,0x1E,0x3B,0x28,
-  0x32,0x4B,0x2D,0x1E,0x3A,0x28,0x33,0x29,0x14,0x09,0x26,
-  0x0F,0x12,0x29,0x14,0x09,0x25,0x10,0x01,0x5F,0x4C,0x2C,
-  0x1E,0x3B,0x28,0x32,0x4B,0x2D,0x1E,0x3A,0x28,0x33,0x29,
-  0x14,0x09,0x26,0x0F,0x12,0x29,0x14,0x09,0x25,0x10,0x02,
-  0xE3,0x3C,0x27,0x33,0x46,0x2C,0x20,0x3A,0x28,0x32,0x48,
-  0x2D,0x1F,0x50,0x24,0x01,0x0F,0x11,0x2A,0x14,0x08,0x24,
-  0x10,0x11,0x2A,0x14,0x07,0x50,0xFD,0x09,0x01,0x27,0x3C,
-  0x27,0x33,0x47,0x2C,0x1F,0x3B,0x28,0x31,0x48,0x2D,0x1F,
-  0x50,0x24,0x0F,0x12,0x2A,0x14,0x08,0x24,0x0F,0x12,0x2A,
-  0x14,0x08,0x50,0x3C,0x27,0x33,0x47,0x2C,0x1F,0x3B,0x28,
-  0x31,0x48,0x2D,0x1F,0x50,0x24,0x0F,0x12,0x2A,0x14,0x08,
-  0x24,0x0F,0x12,0x2A,0x14,0x08,0x00,0x01,0x00,0x53,0x00,
-  0x48,0x00,0xFA,0x01,0xE1,0x00,0x06,0x00,0x00,0x37,0x35,
-  0x37,0x15,0x07,0x17,0x15,0x53,0xA7,0x65,0x65,0xDA,0x72,
-  0x95,0x75,0x59,0x59,0x72,0x00,0x01,0x00,0x50,0x00,0x48,
-  0x00,0xF7,0x01,0xE1,0x00,0x06,0x00,0x00,0x13,0x15,0x07,
-  0x35,0x37,0x27,0x35,0xF7,0xA7,0x65,0x65,0x01,0x4F,0x73,
-  0x94,0x75,0x59,0x59,0x72,0x00,0x00,0x01,0xFF,0x53,0xFF,
-  0xEC,0x01,0x51,0x02,0xCB,0x00,0x03,0x00,0x00,0x13,0x33,
-  0x01,0x23,0xFA,0x57,0xFE,0x59,0x57,0x02,0xCB,0xFD,0x21,
-  0x00,0x00,0x02,0x00,0x50,0xFF,0xFF,0x03,0xD3,0x02,0x58,
-  0x00,0x13,0x00,0x23,0x00,0x00,0x25,0x11,0x33,0x11,0x14,
-  0x07,0x06,0x07,0x06,0x27,0x21,0x11,0x33,0x11,0x33,0x36,
-  0x37,0x36,0x37,0x36,0x27,0x15,0x23,0x35,0x34,0x27,0x26,
-  0x27,0x21,0x11,0x23,0x11,0x21,0x32,0x17,0x16,0x03,0x48,
-  0x8B,0x1B,0x27,0x4D,0x35,0x46,0xFE,0x87,0x8B,0xEE,0x27,
-  0x0F,0x2D,0x10,0x09,0x6E,0x8B,0x0B,0x0B,0x1A,0xFE,0xBF,
-  0x8B,0x01,0xCC,0x53,0x37,0x31,0xE7,0x01,0x71,0xFE,0x8F,
-  0x40,0x29,0x42,0x23,0x1B,0x02,0x01,0x7A,0xFE,0xF9,0x04,
-  0x06,0x13,0x24,0x13,0xEF,0xDC,0xDC,0x19,0x0A,0x0B,0x01,
-  0xFE,0x1B,0x02,0x58,0x30,0x2B,0x00,0x00,0x01,0x00,0x06,
-  0xFF,0xE9,0x02,0x22,0x02,0xD4,0x00,0x34,0x00,0x00,0x13,
-  0x33,0x26,0x34,0x37,0x23,0x37,0x33,0x36,0x37,0x36,0x33,
-  0x32,0x17,0x16,0x17,0x07,0x26,0x27,0x26,0x23,0x22,0x07,
-  0x33,0x07,0x23,0x06,0x14,0x17,0x33,0x07,0x23,0x16,0x17,
-  0x16,0x33,0x32,0x37,0x33,0x31,0x37,0x36,0x37,0x15,0x06,
-  0x23,0x22,0x27,0x26,0x27,0x26,0x27,0x23,0x1E,0x28,0x02,
-  0x01,0x3F,0x18,0x30,0x27,0x7D,0x37,0x43,0x4A,0x3B,0x15,
-  0x1C,0x2D,0x4E,0x36,0x07,0x07,0x5E,0x25,0xFB,0x18,0xF0,
-  0x03,0x02,0xD9,0x19,0xB5,0x23,0x4D,0x0B,0x0B,0x2C,0x3F,
-  0x01,0x01,0x10,0x15,0x67,0x31,0x5D,0x4A,0x17,0x11,0x2D,
-  0x13,0x48,0x01,0x3E,0x0E,0x2A,0x0C,0x44,0xB3,0x3F,0x1C,
-  0x23,0x0C,0x15,0x81,0x3E,0x04,0x01,0x8C,0x44,0x18,0x22,
-  0x0A,0x44,0x7A,0x12,0x02,0x20,0x01,0x07,0x0C,0x95,0x22,
-  0x41,0x15,0x19,0x42,0x60,0x00,0x02,0x00,0x47,0x01,0x11,
-  0x03,0xA1,0x02,0xD9,0x00,0x07,0x00,0x14,0x00,0x00,0x01,
-  0x11,0x23,0x11,0x23,0x35,0x21,0x15,0x01,0x23,0x03,0x11,
-  0x23,0x11,0x33,0x1B,0x01,0x33,0x11,0x23,0x11,0x01,0x2F,
-  0x5F,0x89,0x01,0x6D,0x01,0x3F,0x5E,0x55,0x5B,0x89,0x56,
-  0x54,0x89,0x5B,0x02,0x8B,0xFE,0x86,0x01,0x7A,0x4E,0x4E,
-  0xFE,0x86,0x01,0x5D,0xFE,0xA3,0x01,0xC8,0xFE,0xA2,0x01,
-  0x5E,0xFE,0x38,0x01,0x5D,0x00,0x00,0x02,0x00,0x16,0xFF,
-  0xF1,0x01,0xCA,0x02,0xEE,0x00,0x29,0x00,0x39,0x00,0x00,
-  0x13,0x27,0x36,0x33,0x32,0x17,0x16,0x15,0x14,0x07,0x06,
-  0x07,0x06,0x23,0x22,0x27,0x26,0x35,0x34,0x37,0x36,0x37,
-  0x36,0x33,0x32,0x17,0x16,0x17,0x36,0x35,0x34,0x27,0x26,
-  0x27,0x26,0x23,0x22,0x07,0x15,0x31,0x06,0x07,0x13,0x26,
-  0x23,0x22,0x07,0x06,0x15,0x14,0x17,0x16,0x33,0x32,0x37,
-  0x36,0x37,0x36,0x66,0x28,0x3E,0x46,0x77,0x4B,0x46,0x2B,
-  0x0B,0x0C,0x42,0x72,0x5C,0x38,0x2A,0x41,0x04,0x05,0x32,
-  0x48,0x35,0x2E,0x14,0x1F,0x0B,0x32,0x02,0x03,0x25,0x49,
-  0x23,0x26,0x0A,0x15,0xFB,0x26,0x43,0x42,0x2C,0x24,0x3C,
-  0x0D,0x10,0x4A,0x2B,0x05,0x05,0x12,0x02,0x9E,0x34,0x1C,
-  0x67,0x61,0x91,0x81,0x79,0x1E,0x16,0x76,0x47,0x35,0x46,
-  0x5F,0x4A,0x05,0x05,0x32,0x1D,0x0C,0x18,0x49,0x27,0x71,
-  0x4C,0x03,0x04,0x34,0x0F,0x01,0x04,0x09,0xFE,0x8E,0x3F,
-  0x49,0x3C,0x4F,0x6E,0x18,0x05,0x60,0x0D,0x0E,0x36,0x00,
-  0x00,0x02,0x00,0x08,0x00,0x00,0x02,0xD1,0x02,0xD9,0x00,
-  0x03,0x00,0x06,0x00,0x00,0x33,0x01,0x33,0x01,0x25,0x21,
-  0x03,0x08,0x01,0x04,0xC1,0x01,0x04,0xFD,0xFC,0x01,0x3F,
-  0xA0,0x02,0xD9,0xFD,0x27,0x7D,0x01,0xE9,0x00,0x00,0x01,
-  0x00,0x11,0xFF,0xA0,0x02,0xB6,0x02,0xF8,0x00,0x20,0x00,
-  0x00,0x01,0x17,0x23,0x26,0x27,0x26,0x23,0x21,0x09,0x01,
-  0x21,0x32,0x37,0x36,0x37,0x36,0x37,0x36,0x37,0x36,0x37,
-  0x33,0x06,0x07,0x26,0x23,0x21,0x22,0x07,0x09,0x01,0x16,
-  0x33,0x02,0x68,0x07,0x16,0x14,0x23,0x1D,0x40,0xFE,0xFB,
-  0x01,0x0D,0xFE,0xDE,0x01,0x56,0x4A,0x18,0x03,0x03,0x15,
-  0x0F,0x04,0x07,0x01,0x05,0x18,0x1C,0x0F,0x1F,0x31,0xFE,
-  0x21,0x29,0x22,0x01,0x59,0xFE,0xA7,0x39,0x38,0x02,0xF1,
-  0xA0,0x4C,0x15,0x11,0xFE,0x9D,0xFE,0xB2,0x11,0x02,0x03,
-  0x11,0x21,0x0A,0x11,0x01,0x0C,0x6A,0x78,0x09,0x04,0x01,
-  0x90,0x01,0xC3,0x07,0x00,0x01,0x00,0x28,0x00,0xAC,0x02,
-  0x20,0x01,0x23,0x00,0x03,0x00,0x00,0x01,0x15,0x21,0x35,
-  0x02,0x20,0xFE,0x08,0x01,0x23,0x77,0x77,0x00,0x01,0x00,
-  0x07,0xFF,0xDC,0x02,0x00,0x03,0x91,0x00,0x07,0x00,0x00,
-  0x01,0x17,0x0B,0x01,0x07,0x27,0x37,0x13,0x01,0xDC,0x24,
-  0x98,0xF1,0x5E,0x12,0x94,0xC1,0x03,0x91,0x05,0xFC,0x50,
-  0x01,0xF1,0x2E,0x21,0x49,0xFE,0x74,0x00,0x00,0x01,0x00,
-  0x32,0xFF,0xBB,0x02,0x16,0x02,0x10,0x00,0x13,0x00,0x00,
-  0x37,0x23,0x35,0x33,0x37,0x23,0x35,0x21,0x37,0x17,0x07,
-  0x33,0x15,0x23,0x07,0x33,0x15,0x21,0x07,0x27,0x7B,0x49,
-  0x89,0x44,0xCD,0x01,0x10,0x41,0x62,0x23,0x54,0x96,0x44,
-  0xDA,0xFE,0xE3,0x44,0x61,0x34,0x77,0x79,0x77,0x75,0x38,
-  0x3D,0x77,0x79,0x77,0x79,0x38,0x00,0x02,0x00,0x2D,0xFF,
-  0xF6,0x02,0x16,0x02,0x7F,0x00,0x03,0x00,0x0A,0x00,0x00,
-  0x25,0x15,0x21,0x35,0x01,0x15,0x0D,0x01,0x15,0x25,0x35,
-  0x02,0x16,0xFE,0x17,0x01,0xE9,0xFE,0x82,0x01,0x7E,0xFE,
-  0x17,0x51,0x5B,0x5B,0x02,0x2E,0x6D,0x85,0x83,0x6F,0xB6,
-  0x78,0x00,0x02,0x00,0x2D,0xFF,0xF6,0x02,0x16,0x02,0x7F,
-  0x00,0x03,0x00,0x0A,0x00,0x00,0x25,0x15,0x21,0x3D,0x02,
-  0x2D,0x01,0x35,0x05,0x15,0x02,0x16,0xFE,0x17,0x01,0x7E,
-  0xFE,0x82,0x01,0xE9,0x51,0x5B,0x5B,0x4A,0x6D,0x85,0x83,
-  0x6F,0xB6,0x79,0x00,0x02,0x00,0x10,0x00,0x00,0x01,0xCE,
-  0x02,0xE8,0x00,0x05,0x00,0x09,0x00,0x00,0x01,0x13,0x03,
-  0x23,0x03,0x1B,0x02,0x0B,0x01,0x01,0x0E,0xC0,0xC0,0x3E,
-  0xC0,0xC0,0x20,0xA0,0xA0,0xA1,0x02,0xE8,0xFE,0x8C,0xFE,
-  0x8C,0x01,0x74,0x01,0x74,0xFD,0x54,0x01,0x38,0x01,0x38,
-  0xFE,0xC8,0xFF,0xFF,0x00,0x1D,0xFF,0xE9,0x02,0x05,0x02,
-  0xD4,0x10,0x06,0x00,0x13,0x00,0x00,0xFF,0xFF,0x00,0x1E,
-  0x00,0x00,0x02,0x03,0x02,0xD4,0x10,0x06,0x00,0x15,0x00,
-  0x00,0xFF,0xFF,0x00,0x1D,0xFF,0xE9,0x02,0x04,0x02,0xD4,
-  0x10,0x06,0x00,0x16,0x00,0x00,0xFF,0xFF,0x00,0x18,0x00,
-  0x00,0x02,0x0A,0x02,0xC5,0x10,0x06,0x00,0x17,0x00,0x00,
-  0xFF,0xFF,0x00,0x1B,0xFF,0xE9,0x02,0x05,0x02,0xC5,0x10,
-  0x06,0x00,0x18,0x00,0x00,0xFF,0xFF,0x00,0x20,0xFF,0xE9,
-  0x02,0x07,0x02,0xD4,0x10,0x06,0x00,0x19,0x00,0x00,0xFF,
-  0xFF,0x00,0x1D,0x00,0x00,0x02,0x10,0x02,0xC5,0x10,0x06,
-  0x00,0x1A,0x00,0x00,0xFF,0xFF,0x00,0x16,0xFF,0xE9,0x02,
-  0x0D,0x02,0xD4,0x10,0x06,0x00,0x1B,0x00,0x00,0xFF,0xFF,
-  0x00,0x1C,0xFF,0xE8,0x02,0x04,0x02,0xD4,0x10,0x06,0x00,
-  0x1C,0x00,0x00,0x00,0x01,0x00,0x70,0xFE,0xCD,0x00,0xEA,
-  0xFF,0xC4,0x00,0x0A,0x00,0x00,0x17,0x33,0x15,0x14,0x07,
-  0x06,0x07,0x35,0x36,0x27,0x23,0x70,0x7A,0x39,0x1C,0x25,
-  0x45,0x02,0x43,0x3C,0x67,0x52,0x28,0x15,0x01,0x2E,0x0D,
-  0x4C,0xFF,0xFF,0x00,0x44,0x00,0x00,0x01,0x7A,0x02,0xC5,
-  0x10,0x06,0x00,0x14,0x00,0x00,0x00,0x03,0x00,0x09,0x00,
-  0x00,0x02,0x24,0x02,0xD9,0x00,0x03,0x00,0x07,0x00,0x1B,
-  0x00,0x00,0x01,0x11,0x23,0x11,0x37,0x15,0x23,0x35,0x07,
-  0x15,0x23,0x11,0x23,0x11,0x23,0x35,0x33,0x35,0x34,0x33,
-  0x32,0x17,0x15,0x26,0x23,0x22,0x1D,0x01,0x02,0x24,0x8C,
-  0x8C,0x8C,0x64,0x53,0x8C,0x4C,0x4C,0x8A,0x29,0x27,0x12,
-  0x16,0x26,0x02,0x1C,0xFD,0xE4,0x02,0x1C,0xBD,0x7D,0x7D,
-  0xC8,0x5D,0xFE,0x4C,0x01,0xB4,0x5D,0x41,0x87,0x03,0x69,
-  0x03,0x2A,0x35,0x00,0x00,0x02,0x00,0x0C,0x00,0x00,0x02,
-  0x22,0x02,0xD9,0x00,0x03,0x00,0x17,0x00,0x00,0x01,0x11,
-  0x23,0x11,0x07,0x15,0x23,0x11,0x23,0x11,0x23,0x35,0x33,
-  0x35,0x34,0x33,0x32,0x17,0x15,0x26,0x23,0x22,0x1D,0x01,
-  0x02,0x22,0x8C,0x5F,0x53,0x8C,0x4C,0x4C,0x8A,0x29,0x27,
-  0x12,0x16,0x26,0x02,0xD9,0xFD,0x27,0x02,0xD9,0xC8,0x5D,
-  0xFE,0x4C,0x01,0xB4,0x5D,0x41,0x87,0x03,0x69,0x03,0x2A,
-  0x35,0x00,0x02,0x00,0x49,0x00,0x8E,0x00,0xD4,0x02,0x58,
-  0x00,0x03,0x00,0x07,0x00,0x00,0x13,0x07,0x11,0x33,0x03,
-  0x33,0x15,0x23,0xD4,0x8B,0x8B,0x6C,0x52,0x52,0x01,0x4D,
-  0x39,0x01,0x44,0xFE,0x88,0x52,0x00,0x01,0x00,0x00,0x02,
-  0x94,0x01,0x32,0x03,0x2D,0x00,0x1C,0x00,0x00,0x13,0x23,
-  0x30,0x17,0x16,0x17,0x16,0x17,0x16,0x33,0x32,0x37,0x36,
-  0x37,0x36,0x37,0x23,0x30,0x07,0x15,0x07,0x15,0x07,0x06,
-  0x07,0x06,0x22,0x27,0x26,0x64,0x64,0x0A,0x06,0x08,0x11,
-  0x1E,0x27,0x2B,0x2B,0x27,0x1E,0x11,0x12,0x06,0x64,0x06,
-  0x01,0x01,0x02,0x02,0x0F,0x34,0x0F,0x0A,0x03,0x2D,0x30,
-  0x15,0x0D,0x1E,0x11,0x18,0x18,0x11,0x1E,0x1D,0x35,0x19,
-  0x01,0x01,0x01,0x01,0x04,0x02,0x12,0x12,0x0B,0x00,0x00,
-  0x03,0x00,0x49,0x00,0x8C,0x01,0xD6,0x02,0x58,0x00,0x03,
-  0x00,0x07,0x00,0x0B,0x00,0x00,0x13,0x07,0x11,0x33,0x01,
-  0x07,0x11,0x33,0x01,0x33,0x15,0x23,0xD4,0x8B,0x8B,0x01,
-  0x02,0x8B,0x8B,0xFE,0xD0,0xC8,0xC8,0x01,0x4D,0x39,0x01,
-  0x44,0xFE,0xF5,0x39,0x01,0x44,0xFE,0x86,0x52,0x00,0x01,
-  0x00,0x56,0xFF,0xFF,0x02,0x44,0x02,0x58,0x00,0x14,0x00,
-  0x00,0x25,0x36,0x37,0x36,0x37,0x36,0x35,0x11,0x33,0x11,
-  0x16,0x07,0x06,0x07,0x06,0x27,0x23,0x35,0x33,0x03,0x33,
-  0x01,0x5E,0x0D,0x12,0x20,0x0E,0x0D,0x8B,0x02,0x1D,0x1F,
-  0x3C,0x40,0x41,0xF6,0x7B,0x6E,0x8E,0x76,0x02,0x0B,0x14,
-  0x1B,0x19,0x1C,0x01,0x71,0xFE,0x8F,0x39,0x2E,0x3A,0x22,
-  0x25,0x01,0x73,0x01,0xE5,0x00,0x00,0x01,0x00,0x3D,0x00,
-  0x00,0x03,0x84,0x02,0x58,0x00,0x23,0x00,0x00,0x01,0x06,
-  0x07,0x06,0x07,0x15,0x23,0x35,0x36,0x37,0x36,0x37,0x36,
-  0x37,0x36,0x37,0x27,0x33,0x01,0x36,0x37,0x36,0x37,0x36,
-  0x37,0x35,0x33,0x15,0x06,0x07,0x06,0x07,0x06,0x07,0x17,
-  0x23,0x01,0x56,0x39,0x14,0x19,0x0C,0x8B,0x11,0x1F,0x0D,
-  0x14,0x14,0x3A,0x02,0x02,0xBF,0xC3,0x01,0x6F,0x4B,0x16,
-  0x01,0x01,0x06,0x04,0x8B,0x10,0x26,0x0B,0x10,0x26,0x30,
-  0xC4,0xC8,0x01,0x51,0x31,0x20,0x29,0x43,0x94,0x9E,0x5D,
-  0x34,0x16,0x18,0x18,0x2D,0x02,0x01,0xB3,0xFE,0xAA,0x46,
-  0x41,0x04,0x04,0x14,0x17,0x9C,0xA7,0x59,0x39,0x12,0x13,
-  0x2B,0x18,0xB7,0x00,0x01,0x00,0x3F,0x00,0x00,0x03,0x30,
-  0x02,0x58,0x00,0x07,0x00,0x00,0x01,0x21,0x35,0x21,0x15,
-  0x23,0x11,0x23,0x02,0x52,0xFD,0xED,0x02,0xF1,0x53,0x8B,
-  0x01,0xE5,0x73,0x73,0xFE,0x1B,0x00,0x02,0x00,0x4F,0x00,
-  0x00,0x03,0x5E,0x02,0x58,0x00,0x24,0x00,0x28,0x00,0x00,
-  0x01,0x11,0x23,0x11,0x26,0x27,0x26,0x27,0x26,0x27,0x26,
-  0x2F,0x01,0x31,0x26,0x27,0x26,0x2F,0x01,0x2B,0x02,0x26,
-  0x23,0x21,0x35,0x21,0x16,0x17,0x31,0x16,0x17,0x16,0x17,
-  0x16,0x17,0x16,0x01,0x11,0x33,0x11,0x03,0x5E,0x8B,0x0B,
-  0x0A,0x02,0x03,0x02,0x02,0x08,0x02,0x01,0x02,0x04,0x1B,
-  0x31,0x02,0x01,0x01,0x01,0x03,0x02,0xFE,0x01,0x02,0x0B,
-  0x54,0x3C,0x03,0x03,0x27,0x17,0x23,0x0B,0x01,0xFC,0xF2,
-  0x8B,0x01,0x76,0xFE,0x8A,0x01,0x6D,0x31,0x10,0x04,0x05,
-  0x02,0x03,0x0A,0x01,0x01,0x01,0x02,0x0F,0x09,0x01,0x01,
-  0x73,0x0A,0x1F,0x01,0x02,0x13,0x23,0x32,0x40,0x06,0xFE,
-  0x82,0x01,0x5D,0xFE,0xA3,0x00,0x00,0x01,0x00,0x4C,0x00,
-  0x00,0x03,0x10,0x02,0x58,0x00,0x3D,0x00,0x00,0x29,0x01,
-  0x35,0x21,0x36,0x37,0x33,0x37,0x31,0x36,0x37,0x36,0x37,
-  0x36,0x37,0x36,0x37,0x35,0x36,0x37,0x35,0x26,0x27,0x26,
-  0x27,0x26,0x27,0x26,0x27,0x26,0x27,0x26,0x27,0x23,0x27,
-  0x23,0x22,0x27,0x21,0x35,0x21,0x16,0x17,0x31,0x16,0x17,
-  0x16,0x17,0x16,0x17,0x16,0x17,0x15,0x06,0x07,0x06,0x07,
-  0x06,0x07,0x06,0x07,0x06,0x02,0x0B,0xFE,0x41,0x01,0xB4,
-  0x37,0x13,0x01,0x01,0x05,0x04,0x0B,0x03,0x02,0x02,0x12,
-  0x09,0x02,0x01,0x0B,0x0A,0x02,0x03,0x02,0x02,0x08,0x05,
-  0x01,0x04,0x1A,0x31,0x01,0x01,0x01,0x04,0x03,0xFE,0x4C,
-  0x01,0xBF,0x53,0x3D,0x03,0x04,0x26,0x17,0x24,0x0B,0x01,
-  0x01,0x0B,0x1E,0x04,0x04,0x17,0x26,0x3F,0x50,0x04,0x73,
-  0x0A,0x0A,0x01,0x02,0x03,0x06,0x04,0x02,0x03,0x19,0x28,
-  0x01,0x08,0x05,0x82,0x31,0x10,0x04,0x05,0x02,0x03,0x0A,
-  0x02,0x01,0x02,0x0F,0x09,0x01,0x01,0x73,0x09,0x1F,0x02,
-  0x02,0x12,0x24,0x34,0x40,0x06,0x06,0x94,0x45,0x2F,0x06,
-  0x06,0x24,0x12,0x21,0x0A,0x01,0x00,0x00,0x01,0x00,0x3E,
-  0x00,0x00,0x03,0x4D,0x02,0xEE,0x00,0x22,0x00,0x00,0x25,
-  0x15,0x23,0x35,0x34,0x37,0x36,0x3F,0x01,0x3B,0x01,0x36,
-  0x37,0x36,0x37,0x35,0x21,0x11,0x33,0x15,0x21,0x15,0x06,
-  0x0F,0x02,0x30,0x23,0x06,0x07,0x06,0x07,0x06,0x07,0x06,
-  0x02,0x17,0x8B,0x46,0x30,0x6C,0x01,0x01,0x01,0x09,0x04,
-  0x3C,0x08,0xFD,0x7C,0x8B,0x02,0x84,0x01,0x43,0x01,0x01,
-  0x01,0x05,0x05,0x1E,0x56,0x29,0x15,0x34,0x65,0x65,0x6B,
-  0x3F,0x46,0x30,0x2D,0x01,0x04,0x02,0x1C,0x33,0x42,0x01,
-  0x09,0x96,0xBC,0x44,0x2F,0x01,0x01,0x04,0x03,0x13,0x27,
-  0x12,0x10,0x28,0x00,0x02,0x00,0x50,0x00,0x00,0x03,0x5F,
-  0x02,0x58,0x00,0x09,0x00,0x14,0x00,0x00,0x29,0x01,0x11,
-  0x21,0x32,0x17,0x16,0x17,0x16,0x15,0x07,0x35,0x26,0x2F,
-  0x01,0x26,0x27,0x26,0x27,0x21,0x11,0x03,0x5F,0xFC,0xF1,
-  0x02,0x04,0x58,0x45,0x44,0x1D,0x0D,0x8B,0x03,0x21,0x01,
-  0x06,0x05,0x28,0x28,0xFE,0x87,0x02,0x58,0x2C,0x2B,0x4A,
-  0x22,0x24,0xFE,0xFE,0x32,0x1F,0x01,0x05,0x03,0x19,0x01,
-  0xFE,0x8E,0x00,0x01,0x00,0x3F,0x00,0x00,0x03,0x0C,0x02,
-  0x58,0x00,0x24,0x00,0x00,0x01,0x11,0x23,0x11,0x26,0x27,
-  0x26,0x27,0x26,0x27,0x26,0x2F,0x01,0x31,0x26,0x27,0x26,
-  0x2F,0x01,0x2B,0x02,0x26,0x23,0x21,0x35,0x21,0x16,0x17,
-  0x31,0x16,0x17,0x16,0x17,0x16,0x17,0x16,0x03,0x0C,0x8B,
-  0x0B,0x0A,0x02,0x03,0x02,0x02,0x08,0x02,0x01,0x02,0x04,
-  0x1B,0x31,0x02,0x01,0x01,0x01,0x03,0x02,0xFE,0x43,0x01,
-  0xC9,0x54,0x3C,0x03,0x03,0x27,0x17,0x23,0x0B,0x01,0x01,
-  0x76,0xFE,0x8A,0x01,0x6D,0x31,0x10,0x04,0x05,0x02,0x03,
-  0x0A,0x01,0x01,0x01,0x02,0x0F,0x09,0x01,0x01,0x73,0x0A,
-  0x1F,0x01,0x02,0x13,0x23,0x32,0x40,0x06,0x00,0x01,0x00,
-  0x3E,0xFF,0xFF,0x03,0xA7,0x02,0x58,0x00,0x37,0x00,0x00,
-  0x01,0x11,0x07,0x06,0x07,0x06,0x07,0x06,0x07,0x06,0x07,
-  0x06,0x27,0x35,0x32,0x17,0x32,0x37,0x36,0x37,0x36,0x37,
-  0x36,0x37,0x36,0x37,0x35,0x23,0x35,0x21,0x16,0x17,0x16,
-  0x17,0x16,0x17,0x16,0x17,0x11,0x23,0x11,0x26,0x2F,0x01,
-  0x26,0x27,0x26,0x2F,0x01,0x31,0x26,0x27,0x26,0x27,0x26,
-  0x27,0x01,0x48,0x04,0x06,0x11,0x11,0x2F,0x46,0x3A,0x09,
-  0x0A,0x0B,0x11,0x01,0x1B,0x1B,0x0F,0x06,0x0A,0x11,0x0B,
-  0x0A,0x01,0x01,0x01,0x42,0x02,0x28,0x55,0x41,0x29,0x15,
-  0x23,0x0B,0x01,0x01,0x8B,0x0B,0x09,0x01,0x04,0x05,0x08,
-  0x02,0x01,0x02,0x04,0x1A,0x30,0x07,0x05,0x01,0xE5,0xFF,
-  0x00,0x43,0x1F,0x1D,0x23,0x17,0x24,0x06,0x01,0x01,0x01,
-  0x06,0x74,0x06,0x07,0x02,0x05,0x08,0x10,0x0F,0x22,0x12,
-  0x0D,0xFC,0x73,0x0A,0x21,0x15,0x21,0x32,0x40,0x07,0x08,
-  0xFE,0x8A,0x01,0x6E,0x31,0x0F,0x01,0x06,0x08,0x0A,0x01,
-  0x01,0x01,0x02,0x0E,0x09,0x01,0x01,0x00,0x00,0x01,0x00,
-  0x32,0x00,0xAC,0x02,0x15,0x01,0xD9,0x00,0x07,0x00,0x00,
-  0x01,0x15,0x21,0x35,0x33,0x35,0x33,0x15,0x02,0x15,0xFE,
-  0x1D,0xB6,0x77,0x01,0x23,0x77,0x77,0xB6,0xB6,0x00,0x02,
-  0x00,0x4C,0x00,0x00,0x02,0xFF,0x02,0xD1,0x00,0x32,0x00,
-  0x36,0x00,0x00,0x13,0x33,0x32,0x37,0x36,0x3D,0x01,0x33,
-  0x15,0x14,0x07,0x06,0x07,0x06,0x27,0x23,0x17,0x16,0x17,
-  0x16,0x17,0x16,0x3B,0x01,0x32,0x37,0x36,0x37,0x31,0x36,
-  0x37,0x36,0x35,0x11,0x33,0x11,0x16,0x07,0x06,0x07,0x06,
-  0x2B,0x01,0x22,0x27,0x26,0x27,0x26,0x35,0x11,0x33,0x25,
-  0x33,0x15,0x23,0xD7,0x44,0x1F,0x11,0x14,0x8B,0x3A,0x31,
-  0x4E,0x0B,0x0B,0x35,0x06,0x19,0x14,0x08,0x15,0x27,0x21,
-  0x4F,0x22,0x25,0x29,0x0F,0x06,0x0C,0x15,0x8B,0x01,0x27,
-  0x2E,0x4D,0x40,0x50,0x4F,0x50,0x41,0x4D,0x2E,0x26,0x8B,
-  0x01,0xB3,0x52,0x52,0x01,0x43,0x11,0x11,0x1E,0xD5,0xD5,
-  0x50,0x2F,0x2F,0x05,0x01,0x01,0x0A,0x23,0x0D,0x06,0x0B,
-  0x12,0x12,0x16,0x12,0x08,0x11,0x22,0x21,0x01,0x4F,0xFE,
-  0xB1,0x42,0x39,0x47,0x25,0x22,0x22,0x25,0x47,0x37,0x44,
-  0x01,0x4F,0x79,0x52,0x00,0x02,0x00,0x4C,0x00,0x00,0x02,
-  0xFF,0x02,0xD1,0x00,0x32,0x00,0x36,0x00,0x00,0x13,0x33,
-  0x32,0x37,0x36,0x3D,0x01,0x33,0x15,0x14,0x07,0x06,0x07,
-  0x06,0x27,0x23,0x17,0x16,0x17,0x16,0x17,0x16,0x3B,0x01,
-  0x32,0x37,0x36,0x37,0x31,0x36,0x37,0x36,0x35,0x11,0x33,
-  0x11,0x16,0x07,0x06,0x07,0x06,0x2B,0x01,0x22,0x27,0x26,
-  0x27,0x26,0x35,0x11,0x33,0x27,0x33,0x15,0x23,0xD7,0x44,
-  0x1F,0x11,0x14,0x8B,0x3A,0x31,0x4E,0x0B,0x0B,0x35,0x06,
-  0x19,0x14,0x08,0x15,0x27,0x21,0x4F,0x22,0x25,0x29,0x0F,
-  0x06,0x0C,0x15,0x8B,0x01,0x27,0x2E,0x4D,0x40,0x50,0x4F,
-  0x50,0x41,0x4D,0x2E,0x26,0x8B,0x72,0x52,0x52,0x01,0x43,
-  0x11,0x11,0x1E,0xD5,0xD5,0x50,0x2F,0x2F,0x05,0x01,0x01,
-  0x0A,0x23,0x0D,0x06,0x0B,0x12,0x12,0x16,0x12,0x08,0x11,
-  0x22,0x21,0x01,0x4F,0xFE,0xB1,0x42,0x39,0x47,0x25,0x22,
-  0x22,0x25,0x47,0x37,0x44,0x01,0x4F,0x79,0x52,0x00,0x00,
-  0x03,0x00,0x4C,0x00,0x00,0x02,0xFF,0x02,0xD1,0x00,0x32,
-  0x00,0x36,0x00,0x3A,0x00,0x00,0x13,0x33,0x32,0x37,0x36,
-  0x3D,0x01,0x33,0x15,0x14,0x07,0x06,0x07,0x06,0x27,0x23,
-  0x17,0x16,0x17,0x16,0x17,0x16,0x3B,0x01,0x32,0x37,0x36,
-  0x37,0x31,0x36,0x37,0x36,0x35,0x11,0x33,0x11,0x16,0x07,
-  0x06,0x07,0x06,0x2B,0x01,0x22,0x27,0x26,0x27,0x26,0x35,
-  0x11,0x33,0x01,0x33,0x15,0x23,0x13,0x33,0x15,0x23,0xD7,
-  0x44,0x1F,0x11,0x14,0x8B,0x3A,0x31,0x4E,0x0B,0x0B,0x35,
-  0x06,0x19,0x14,0x08,0x15,0x27,0x21,0x4F,0x22,0x25,0x29,
-  0x0F,0x06,0x0C,0x15,0x8B,0x01,0x27,0x2E,0x4D,0x40,0x50,
-  0x4F,0x50,0x41,0x4D,0x2E,0x26,0x8B,0x01,0x03,0x52,0x52,
-  0xB0,0x52,0x52,0x01,0x43,0x11,0x11,0x1E,0xD5,0xD5,0x50,
-  0x2F,0x2F,0x05,0x01,0x01,0x0A,0x23,0x0D,0x06,0x0B,0x12,
-  0x12,0x16,0x12,0x08,0x11,0x22,0x21,0x01,0x4F,0xFE,0xB1,
-  0x42,0x39,0x47,0x25,0x22,0x22,0x25,0x47,0x37,0x44,0x01,
-  0x4F,0xFE,0xAF,0x52,0x02,0x1C,0x52,0x00,0x00,0x03,0x00,
-  0x4C,0x00,0x00,0x02,0xFF,0x02,0xD1,0x00,0x32,0x00,0x36,
-  0x00,0x3A,0x00,0x00,0x13,0x33,0x32,0x37,0x36,0x3D,0x01,
-  0x33,0x15,0x14,0x07,0x06,0x07,0x06,0x27,0x23,0x17,0x16,
-  0x17,0x16,0x17,0x16,0x3B,0x01,0x32,0x37,0x36,0x37,0x31,
-  0x36,0x37,0x36,0x35,0x11,0x33,0x11,0x16,0x07,0x06,0x07,
-  0x06,0x2B,0x01,0x22,0x27,0x26,0x27,0x26,0x35,0x11,0x33,
-  0x01,0x33,0x15,0x23,0x01,0x33,0x15,0x23,0xD7,0x44,0x1F,
-  0x11,0x14,0x8B,0x3A,0x31,0x4E,0x0B,0x0B,0x35,0x06,0x19,
-  0x14,0x08,0x15,0x27,0x21,0x4F,0x22,0x25,0x29,0x0F,0x06,
-  0x0C,0x15,0x8B,0x01,0x27,0x2E,0x4D,0x40,0x50,0x4F,0x50,
-  0x41,0x4D,0x2E,0x26,0x8B,0x01,0x03,0x52,0x52,0xFE,0x8B,
-  0x52,0x52,0x01,0x43,0x11,0x11,0x1E,0xD5,0xD5,0x50,0x2F,
-  0x2F,0x05,0x01,0x01,0x0A,0x23,0x0D,0x06,0x0B,0x12,0x12,
-  0x16,0x12,0x08,0x11,0x22,0x21,0x01,0x4F,0xFE,0xB1,0x42,
-  0x39,0x47,0x25,0x22,0x22,0x25,0x47,0x37,0x44,0x01,0x4F,
-  0xFE,0xAF,0x52,0x02,0x1C,0x52,0x00,0x02,0x00,0x3D,0xFF,
-  0x72,0x02,0x8A,0x02,0x58,0x00,0x21,0x00,0x25,0x00,0x00,
-  0x01,0x06,0x07,0x06,0x15,0x06,0x07,0x15,0x23,0x35,0x36,
-  0x37,0x36,0x37,0x36,0x37,0x27,0x33,0x13,0x36,0x37,0x36,
-  0x37,0x35,0x33,0x15,0x06,0x07,0x06,0x07,0x06,0x07,0x17,
-  0x23,0x07,0x33,0x15,0x23,0x01,0x1E,0x24,0x0E,0x01,0x02,
-  0x05,0x8B,0x11,0x1F,0x0D,0x14,0x11,0x19,0x97,0xA1,0xCB,
-  0x24,0x0E,0x02,0x05,0x8B,0x10,0x26,0x0B,0x10,0x12,0x18,
-  0x98,0xA3,0xE7,0xC8,0xC8,0x01,0x1D,0x2C,0x3B,0x02,0x03,
-  0x07,0x16,0x94,0x9E,0x5D,0x34,0x16,0x18,0x15,0x12,0xD4,
-  0xFE,0xE3,0x2C,0x37,0x08,0x16,0x9C,0xA7,0x59,0x39,0x12,
-  0x13,0x15,0x11,0xD4,0x3C,0x52,0x00,0x00,0x02,0x00,0x3D,
-  0xFF,0x08,0x02,0x8A,0x02,0x58,0x00,0x21,0x00,0x29,0x00,
-  0x00,0x01,0x06,0x07,0x06,0x15,0x06,0x07,0x15,0x23,0x35,
-  0x36,0x37,0x36,0x37,0x36,0x37,0x27,0x33,0x13,0x36,0x37,
-  0x36,0x37,0x35,0x33,0x15,0x06,0x07,0x06,0x07,0x06,0x07,
-  0x17,0x23,0x07,0x15,0x23,0x35,0x23,0x35,0x33,0x15,0x01,
-  0x1E,0x24,0x0E,0x01,0x02,0x05,0x8B,0x11,0x1F,0x0D,0x14,
-  0x11,0x19,0x97,0xA1,0xCB,0x24,0x0E,0x02,0x05,0x8B,0x10,
-  0x26,0x0B,0x10,0x12,0x18,0x98,0xA3,0x52,0x52,0x3B,0xC8,
-  0x01,0x1D,0x2C,0x3B,0x02,0x03,0x07,0x16,0x94,0x9E,0x5D,
-  0x34,0x16,0x18,0x15,0x12,0xD4,0xFE,0xE3,0x2C,0x37,0x08,
-  0x16,0x9C,0xA7,0x59,0x39,0x12,0x13,0x15,0x11,0xD4,0x8E,
-  0x6A,0x6A,0x52,0x52,0x00,0x00,0x02,0x00,0x3D,0x00,0x00,
-  0x02,0x8A,0x02,0x58,0x00,0x21,0x00,0x25,0x00,0x00,0x01,
-  0x06,0x07,0x06,0x15,0x06,0x07,0x15,0x23,0x35,0x36,0x37,
-  0x36,0x37,0x36,0x37,0x27,0x33,0x13,0x36,0x37,0x36,0x37,
-  0x35,0x33,0x15,0x06,0x07,0x06,0x07,0x06,0x07,0x17,0x23,
-  0x27,0x33,0x15,0x23,0x01,0x1E,0x24,0x0E,0x01,0x02,0x05,
-  0x8B,0x11,0x1F,0x0D,0x14,0x11,0x19,0x97,0xA1,0xCB,0x24,
-  0x0E,0x02,0x05,0x8B,0x10,0x26,0x0B,0x10,0x12,0x18,0x98,
-  0xA3,0xD9,0x52,0x52,0x01,0x1D,0x2C,0x3B,0x02,0x03,0x07,
-  0x16,0x94,0x9E,0x5D,0x34,0x16,0x18,0x15,0x12,0xD4,0xFE,
-  0xE3,0x2C,0x37,0x08,0x16,0x9C,0xA7,0x59,0x39,0x12,0x13,
-  0x15,0x11,0xD4,0x99,0x52,0x00,0x00,0x02,0x00,0x4D,0x00,
-  0x00,0x02,0x62,0x02,0x58,0x00,0x22,0x00,0x26,0x00,0x00,
-  0x25,0x35,0x26,0x27,0x26,0x27,0x26,0x27,0x26,0x27,0x26,
-  0x27,0x26,0x27,0x26,0x27,0x23,0x35,0x33,0x16,0x17,0x16,
-  0x17,0x16,0x17,0x16,0x17,0x15,0x16,0x17,0x11,0x33,0x15,
-  0x21,0x35,0x37,0x33,0x15,0x23,0x01,0x7C,0x0B,0x0A,0x02,
-  0x03,0x02,0x02,0x07,0x05,0x02,0x03,0x1B,0x31,0x06,0x04,
-  0xAA,0xB6,0x54,0x3C,0x03,0x03,0x28,0x15,0x23,0x0C,0x01,
-  0x01,0x5B,0xFD,0xEB,0x8B,0x52,0x52,0x73,0xFA,0x31,0x10,
-  0x04,0x05,0x02,0x03,0x09,0x03,0x01,0x02,0x0F,0x09,0x01,
-  0x01,0x73,0x0A,0x1F,0x01,0x02,0x13,0x23,0x31,0x40,0x01,
-  0x06,0x08,0xFE,0xFD,0x73,0x73,0xE0,0x52,0x00,0x00,0x02,
-  0x00,0x2F,0x00,0x00,0x01,0xF7,0x02,0x58,0x00,0x21,0x00,
-  0x25,0x00,0x00,0x25,0x07,0x23,0x37,0x33,0x27,0x26,0x27,
-  0x26,0x27,0x26,0x27,0x26,0x27,0x26,0x27,0x26,0x27,0x23,
-  0x35,0x33,0x16,0x17,0x16,0x17,0x16,0x17,0x16,0x17,0x15,
-  0x16,0x17,0x13,0x23,0x03,0x33,0x15,0x23,0x01,0x5B,0x7F,
-  0xAD,0xB1,0x75,0x13,0x0E,0x07,0x04,0x05,0x08,0x05,0x02,
-  0x03,0x1B,0x31,0x06,0x04,0x49,0x55,0x53,0x3B,0x04,0x04,
-  0x27,0x17,0x1C,0x0F,0x03,0x02,0x2B,0x8C,0xAD,0x52,0x52,
-  0x8A,0x8A,0xC2,0xA7,0x37,0x0E,0x07,0x07,0x0A,0x02,0x01,
-  0x02,0x0F,0x09,0x01,0x01,0x73,0x09,0x1F,0x02,0x02,0x13,
-  0x23,0x28,0x3F,0x01,0x0E,0x06,0xFE,0x86,0x01,0x53,0x52,
-  0x00,0x00,0x02,0x00,0x3F,0x00,0x00,0x02,0x36,0x02,0x58,
-  0x00,0x07,0x00,0x0B,0x00,0x00,0x01,0x21,0x35,0x21,0x15,
-  0x23,0x11,0x23,0x03,0x33,0x15,0x23,0x01,0x58,0xFE,0xE7,
-  0x01,0xF7,0x53,0x8B,0x8A,0x52,0x52,0x01,0xE5,0x73,0x73,
-  0xFE,0x1B,0x01,0x53,0x52,0x00,0x03,0x00,0x4F,0x00,0x00,
-  0x02,0x64,0x02,0x59,0x00,0x1F,0x00,0x23,0x00,0x27,0x00,
-  0x00,0x01,0x31,0x11,0x23,0x11,0x26,0x27,0x26,0x27,0x26,
-  0x27,0x26,0x27,0x23,0x26,0x27,0x26,0x27,0x26,0x23,0x21,
-  0x35,0x21,0x16,0x17,0x16,0x17,0x16,0x17,0x16,0x17,0x16,
-  0x01,0x11,0x33,0x11,0x13,0x33,0x15,0x23,0x02,0x64,0x8B,
-  0x0B,0x0A,0x02,0x03,0x02,0x02,0x08,0x02,0x01,0x03,0x03,
-  0x1B,0x31,0x06,0x04,0xFE,0xFB,0x01,0x11,0x54,0x3C,0x03,
-  0x03,0x27,0x17,0x23,0x0B,0x01,0xFD,0xEC,0x8B,0x56,0x52,
-  0x52,0x01,0x76,0xFE,0x8A,0x01,0x6D,0x31,0x10,0x04,0x05,
-  0x03,0x02,0x0A,0x02,0x02,0x01,0x10,0x09,0x01,0x73,0x09,
-  0x1F,0x02,0x02,0x12,0x24,0x31,0x41,0x06,0xFE,0x82,0x01,
-  0x5D,0xFE,0xA3,0x01,0x53,0x52,0x00,0x00,0x02,0x00,0x1E,
-  0x00,0x00,0x01,0x20,0x02,0x58,0x00,0x03,0x00,0x07,0x00,
-  0x00,0x33,0x11,0x33,0x11,0x01,0x33,0x15,0x23,0x95,0x8B,
-  0xFE,0xFE,0x52,0x52,0x02,0x58,0xFD,0xA8,0x01,0x53,0x52,
-  0x00,0x00,0x02,0x00,0x1A,0x00,0x00,0x01,0x73,0x02,0x58,
-  0x00,0x07,0x00,0x0B,0x00,0x00,0x13,0x23,0x35,0x21,0x15,
-  0x23,0x11,0x23,0x03,0x33,0x15,0x23,0x95,0x56,0x01,0x34,
-  0x53,0x8B,0x7B,0x52,0x52,0x01,0xE5,0x73,0x73,0xFE,0x1B,
-  0x01,0x53,0x52,0x00,0x02,0x00,0x4C,0x00,0x00,0x02,0x62,
-  0x02,0x58,0x00,0x51,0x00,0x55,0x00,0x00,0x01,0x31,0x22,
-  0x07,0x35,0x36,0x33,0x32,0x17,0x16,0x17,0x16,0x17,0x16,
-  0x17,0x15,0x06,0x07,0x06,0x07,0x06,0x07,0x06,0x23,0x22,
-  0x27,0x26,0x27,0x26,0x27,0x26,0x27,0x11,0x33,0x11,0x16,
-  0x17,0x16,0x17,0x16,0x17,0x16,0x17,0x16,0x17,0x16,0x17,
-  0x39,0x01,0x16,0x33,0x36,0x37,0x35,0x33,0x36,0x37,0x36,
-  0x37,0x36,0x37,0x36,0x37,0x3D,0x01,0x36,0x37,0x35,0x26,
-  0x27,0x26,0x27,0x26,0x27,0x26,0x27,0x26,0x27,0x26,0x27,
-  0x31,0x26,0x07,0x33,0x15,0x23,0x01,0x54,0x1B,0x13,0x21,
-  0x12,0x4B,0x4F,0x26,0x17,0x24,0x0B,0x01,0x01,0x0B,0x1E,
-  0x04,0x04,0x17,0x26,0x4E,0x4F,0x4D,0x4F,0x25,0x18,0x24,
-  0x0B,0x01,0x01,0x8B,0x0B,0x0A,0x02,0x04,0x01,0x02,0x09,
-  0x04,0x02,0x02,0x2C,0x0F,0x07,0x0E,0x20,0x17,0x01,0x02,
-  0x16,0x0B,0x03,0x02,0x02,0x12,0x09,0x02,0x01,0x0B,0x09,
-  0x03,0x03,0x02,0x02,0x08,0x04,0x03,0x03,0x2B,0x0B,0x0A,
-  0x3A,0x52,0x52,0x01,0xE5,0x0C,0x7A,0x05,0x2C,0x12,0x24,
-  0x34,0x40,0x06,0x06,0x94,0x45,0x2F,0x06,0x06,0x24,0x12,
-  0x2C,0x2C,0x12,0x24,0x34,0x40,0x06,0x06,0x01,0x76,0xFE,
-  0x93,0x31,0x10,0x04,0x05,0x02,0x03,0x0A,0x03,0x01,0x01,
-  0x17,0x02,0x01,0x01,0x0B,0x01,0x01,0x0C,0x06,0x04,0x02,
-  0x03,0x19,0x28,0x01,0x01,0x07,0x05,0x82,0x31,0x10,0x04,
-  0x05,0x02,0x03,0x0A,0x02,0x01,0x02,0x16,0x02,0x02,0x92,
-  0x52,0x00,0x00,0x02,0x00,0x22,0x01,0x14,0x01,0x1A,0x02,
-  0x58,0x00,0x03,0x00,0x07,0x00,0x00,0x01,0x07,0x11,0x33,
-  0x07,0x33,0x15,0x23,0x01,0x1A,0x8B,0x8B,0xF8,0x52,0x52,
-  0x01,0x4D,0x39,0x01,0x44,0xA3,0x52,0x00,0x02,0x00,0x3E,
-  0xFF,0x38,0x02,0x08,0x02,0x58,0x00,0x1E,0x00,0x22,0x00,
-  0x00,0x05,0x11,0x26,0x27,0x26,0x27,0x26,0x27,0x26,0x27,
-  0x26,0x27,0x26,0x27,0x23,0x26,0x27,0x23,0x35,0x33,0x16,
-  0x17,0x16,0x17,0x16,0x17,0x16,0x17,0x16,0x17,0x11,0x01,
-  0x33,0x15,0x23,0x01,0x7D,0x0B,0x0A,0x02,0x03,0x02,0x02,
-  0x08,0x05,0x02,0x03,0x1A,0x31,0x01,0x05,0x04,0xBA,0xC5,
-  0x53,0x3D,0x03,0x04,0x26,0x17,0x24,0x0B,0x01,0x01,0xFE,
-  0xD0,0x52,0x52,0xC8,0x02,0x35,0x31,0x10,0x04,0x05,0x02,
-  0x03,0x0A,0x02,0x01,0x02,0x0F,0x09,0x01,0x01,0x73,0x09,
-  0x1F,0x02,0x02,0x12,0x24,0x34,0x40,0x06,0x06,0xFD,0xC2,
-  0x02,0x1B,0x52,0x00,0x00,0x02,0x00,0x4B,0x00,0x00,0x02,
-  0x16,0x02,0x58,0x00,0x3A,0x00,0x3E,0x00,0x00,0x21,0x31,
-  0x23,0x35,0x33,0x36,0x37,0x33,0x36,0x37,0x36,0x37,0x36,
-  0x37,0x36,0x37,0x3D,0x01,0x36,0x37,0x35,0x26,0x27,0x26,
-  0x27,0x26,0x27,0x26,0x27,0x26,0x27,0x26,0x27,0x23,0x26,
-  0x27,0x23,0x35,0x33,0x16,0x17,0x16,0x17,0x16,0x17,0x16,
-  0x17,0x16,0x17,0x15,0x06,0x07,0x06,0x07,0x06,0x07,0x06,
-  0x07,0x06,0x03,0x33,0x15,0x23,0x01,0x11,0xC5,0xBA,0x36,
-  0x13,0x01,0x05,0x06,0x0A,0x03,0x02,0x03,0x12,0x09,0x02,
-  0x01,0x0B,0x0A,0x03,0x03,0x01,0x02,0x09,0x04,0x03,0x02,
-  0x1B,0x30,0x01,0x05,0x04,0xBA,0xC5,0x53,0x3C,0x04,0x04,
-  0x25,0x18,0x24,0x0B,0x01,0x01,0x0B,0x1F,0x03,0x04,0x18,
-  0x25,0x40,0x4F,0x04,0x41,0x52,0x52,0x73,0x0A,0x0A,0x03,
-  0x03,0x06,0x04,0x02,0x03,0x19,0x28,0x01,0x01,0x07,0x05,
-  0x82,0x31,0x10,0x04,0x05,0x02,0x03,0x0A,0x02,0x01,0x02,
-  0x0F,0x09,0x01,0x01,0x73,0x09,0x1F,0x02,0x02,0x12,0x24,
-  0x34,0x40,0x06,0x06,0x94,0x45,0x2F,0x06,0x06,0x24,0x12,
-  0x21,0x0A,0x01,0x01,0x53,0x52,0x00,0x00,0x02,0x00,0x3E,
-  0x00,0x00,0x02,0x53,0x02,0xEE,0x00,0x03,0x00,0x28,0x00,
-  0x00,0x13,0x33,0x15,0x23,0x17,0x15,0x23,0x35,0x36,0x37,
-  0x36,0x37,0x36,0x37,0x36,0x37,0x36,0x37,0x35,0x31,0x36,
-  0x37,0x35,0x21,0x11,0x33,0x15,0x21,0x15,0x06,0x07,0x06,
-  0x07,0x06,0x07,0x06,0x07,0x06,0x07,0x15,0x14,0xE8,0x52,
-  0x52,0xB2,0x8B,0x08,0x03,0x08,0x11,0x1D,0x3E,0x1D,0x06,
-  0x0F,0x05,0x02,0x01,0xFE,0x76,0x8B,0x01,0x8A,0x05,0x13,
-  0x05,0x07,0x1F,0x42,0x18,0x05,0x15,0x02,0x01,0xA3,0x52,
-  0xEC,0x65,0x6B,0x42,0x0A,0x1A,0x18,0x28,0x25,0x11,0x0A,
-  0x16,0x28,0x01,0x0B,0x08,0x42,0x01,0x09,0x96,0xBC,0x45,
-  0x23,0x0B,0x0A,0x2F,0x25,0x0E,0x06,0x1B,0x24,0x01,0x07,
-  0x00,0x00,0x02,0x00,0x43,0x00,0x00,0x02,0x79,0x02,0x58,
-  0x00,0x1E,0x00,0x22,0x00,0x00,0x01,0x03,0x23,0x13,0x23,
-  0x35,0x21,0x32,0x17,0x16,0x17,0x16,0x15,0x11,0x21,0x35,
-  0x33,0x35,0x34,0x27,0x26,0x27,0x23,0x27,0x31,0x27,0x23,
-  0x26,0x27,0x26,0x23,0x07,0x33,0x15,0x23,0x01,0x2A,0x48,
-  0x8C,0x48,0x5B,0x01,0x2C,0x46,0x35,0x4D,0x27,0x1B,0xFE,
-  0xF2,0x83,0x0C,0x16,0x0D,0x01,0x01,0x01,0x01,0x07,0x0F,
-  0x14,0x22,0x1F,0x52,0x52,0x01,0xE5,0xFE,0x1B,0x01,0xE5,
-  0x73,0x19,0x23,0x42,0x2B,0x3E,0xFE,0x8F,0x73,0xFE,0x20,
-  0x13,0x20,0x09,0x01,0x01,0x04,0x08,0x0A,0x92,0x52,0x00,
-  0x02,0x00,0x49,0x00,0x00,0x01,0x67,0x02,0x58,0x00,0x18,
-  0x00,0x1C,0x00,0x00,0x29,0x01,0x35,0x33,0x35,0x26,0x27,
-  0x26,0x27,0x26,0x27,0x26,0x27,0x26,0x23,0x35,0x32,0x17,
-  0x16,0x17,0x16,0x17,0x15,0x16,0x15,0x05,0x33,0x15,0x23,
-  0x01,0x67,0xFE,0xE2,0x93,0x0B,0x0A,0x02,0x03,0x02,0x02,
-  0x06,0x0E,0x29,0x2D,0x5A,0x4D,0x28,0x13,0x2A,0x06,0x01,
-  0xFE,0xE6,0x52,0x52,0x73,0xFA,0x31,0x10,0x04,0x05,0x02,
-  0x03,0x08,0x09,0x18,0x73,0x2D,0x17,0x1E,0x3C,0x35,0x01,
-  0x07,0x07,0x23,0x52,0x00,0x00,0x03,0x00,0x4B,0xFF,0xFF,
-  0x02,0x61,0x02,0x58,0x00,0x1F,0x00,0x51,0x00,0x55,0x00,
-  0x00,0x21,0x31,0x06,0x27,0x26,0x27,0x26,0x27,0x26,0x35,
-  0x11,0x21,0x16,0x17,0x33,0x15,0x16,0x17,0x16,0x17,0x16,
-  0x17,0x16,0x17,0x15,0x06,0x07,0x06,0x07,0x06,0x07,0x06,
-  0x27,0x36,0x3F,0x01,0x33,0x36,0x37,0x36,0x37,0x36,0x37,
-  0x36,0x37,0x3D,0x01,0x36,0x37,0x35,0x26,0x27,0x26,0x27,
-  0x26,0x27,0x26,0x27,0x26,0x27,0x26,0x27,0x31,0x26,0x27,
-  0x23,0x15,0x16,0x17,0x16,0x17,0x16,0x17,0x16,0x17,0x16,
-  0x17,0x16,0x17,0x33,0x31,0x16,0x27,0x33,0x15,0x23,0x01,
-  0x56,0x4C,0x50,0x26,0x17,0x2A,0x06,0x01,0x01,0x10,0x47,
-  0x44,0x01,0x05,0x06,0x25,0x18,0x23,0x0C,0x01,0x01,0x0B,
-  0x1F,0x03,0x04,0x18,0x25,0x51,0x4C,0x20,0x16,0x01,0x01,
-  0x01,0x17,0x0A,0x03,0x02,0x03,0x12,0x09,0x01,0x02,0x0C,
-  0x09,0x03,0x03,0x02,0x01,0x09,0x04,0x03,0x02,0x1B,0x31,
-  0x05,0x04,0x7A,0x0B,0x09,0x03,0x03,0x02,0x02,0x08,0x05,
-  0x02,0x02,0x2B,0x0F,0x01,0x07,0x1C,0x52,0x52,0x01,0x2D,
-  0x12,0x24,0x3C,0x35,0x07,0x08,0x01,0x76,0x03,0x23,0x01,
-  0x02,0x03,0x12,0x24,0x34,0x40,0x06,0x06,0x94,0x45,0x2F,
-  0x06,0x06,0x24,0x12,0x2D,0x74,0x01,0x0B,0x01,0x01,0x0C,
-  0x06,0x04,0x02,0x03,0x19,0x28,0x01,0x01,0x07,0x05,0x82,
-  0x31,0x10,0x04,0x05,0x02,0x03,0x0A,0x02,0x01,0x02,0x0F,
-  0x09,0x01,0x01,0xFA,0x31,0x10,0x04,0x05,0x02,0x03,0x0A,
-  0x03,0x01,0x01,0x17,0x02,0x01,0xE0,0x52,0x00,0x02,0x00,
-  0x48,0xFF,0x38,0x02,0x4E,0x02,0x59,0x00,0x27,0x00,0x2B,
-  0x00,0x00,0x05,0x11,0x26,0x27,0x26,0x27,0x26,0x2F,0x01,
-  0x31,0x27,0x26,0x27,0x26,0x23,0x15,0x14,0x17,0x16,0x3B,
-  0x01,0x15,0x23,0x26,0x27,0x26,0x27,0x26,0x3D,0x01,0x21,
-  0x16,0x17,0x16,0x17,0x16,0x17,0x16,0x17,0x11,0x03,0x33,
-  0x15,0x23,0x01,0xC3,0x05,0x03,0x01,0x03,0x15,0x0E,0x01,
-  0x01,0x07,0x12,0x13,0x93,0x0B,0x0B,0x21,0x35,0x41,0x3E,
-  0x04,0x25,0x1E,0x31,0x01,0x00,0x45,0x32,0x4D,0x27,0x15,
-  0x04,0x01,0x01,0xFB,0x52,0x52,0xC8,0x02,0x37,0x2A,0x05,
-  0x03,0x04,0x20,0x08,0x01,0x01,0x04,0x09,0x0A,0x4F,0x23,
-  0x08,0x08,0x73,0x08,0x01,0x0A,0x18,0x31,0x41,0xCB,0x02,
-  0x17,0x23,0x42,0x22,0x35,0x09,0x06,0xFD,0xC3,0x02,0x54,
-  0x52,0x00,0x02,0x00,0x4F,0x00,0x00,0x02,0x56,0x02,0x58,
-  0x00,0x4E,0x00,0x52,0x00,0x00,0x21,0x31,0x21,0x35,0x33,
-  0x36,0x37,0x36,0x37,0x36,0x3F,0x01,0x35,0x36,0x37,0x36,
-  0x37,0x36,0x3D,0x01,0x26,0x27,0x35,0x27,0x34,0x31,0x30,
-  0x31,0x27,0x26,0x27,0x26,0x27,0x35,0x23,0x27,0x26,0x27,
-  0x26,0x23,0x15,0x14,0x17,0x16,0x3B,0x01,0x15,0x23,0x26,
-  0x27,0x26,0x27,0x26,0x27,0x34,0x3D,0x01,0x21,0x16,0x17,
-  0x16,0x17,0x16,0x17,0x16,0x1D,0x01,0x07,0x06,0x07,0x06,
-  0x07,0x06,0x07,0x2B,0x03,0x06,0x13,0x33,0x15,0x23,0x01,
-  0x4F,0xFF,0x00,0xF8,0x2F,0x05,0x02,0x03,0x22,0x0C,0x01,
-  0x05,0x0A,0x08,0x03,0x01,0x05,0x03,0x01,0x01,0x01,0x01,
-  0x15,0x0E,0x01,0x01,0x07,0x12,0x13,0x93,0x0B,0x0B,0x21,
-  0x35,0x41,0x3D,0x05,0x24,0x1F,0x30,0x01,0x01,0x00,0x46,
-  0x31,0x4D,0x27,0x15,0x05,0x01,0x07,0x05,0x0F,0x27,0x4D,
-  0x29,0x42,0x01,0x01,0x01,0x01,0x04,0x0D,0x52,0x52,0x73,
-  0x05,0x02,0x01,0x02,0x12,0x0E,0x01,0x01,0x06,0x0F,0x0A,
-  0x1F,0x07,0x06,0x84,0x2A,0x05,0x01,0x01,0x01,0x01,0x01,
-  0x02,0x20,0x08,0x01,0x01,0x04,0x09,0x0A,0x4F,0x22,0x08,
-  0x09,0x73,0x08,0x01,0x0A,0x18,0x2D,0x40,0x02,0x03,0xCB,
-  0x02,0x17,0x23,0x42,0x22,0x35,0x09,0x06,0x90,0x37,0x18,
-  0x17,0x42,0x23,0x14,0x04,0x01,0x01,0x85,0x52,0x00,0x02,
-  0x00,0x3D,0x00,0x00,0x02,0x5E,0x02,0x58,0x00,0x19,0x00,
-  0x1D,0x00,0x00,0x01,0x36,0x37,0x36,0x3F,0x01,0x31,0x36,
-  0x37,0x36,0x37,0x35,0x33,0x15,0x06,0x07,0x06,0x07,0x06,
-  0x07,0x13,0x21,0x35,0x21,0x01,0x33,0x03,0x33,0x15,0x23,
-  0x01,0x75,0x14,0x04,0x05,0x04,0x01,0x02,0x02,0x11,0x0C,
-  0x8B,0x0A,0x23,0x02,0x03,0x1E,0x3B,0xA6,0xFD,0xF8,0x01,
-  0x20,0xFE,0xC7,0x9E,0x65,0x52,0x52,0x01,0x6A,0x02,0x04,
-  0x03,0x05,0x01,0x02,0x03,0x16,0x28,0x9C,0xA7,0x39,0x30,
-  0x03,0x04,0x2D,0x12,0xFE,0xFE,0x73,0x01,0xE5,0xFE,0xC7,
-  0x52,0x00,0x03,0x00,0x50,0xFF,0x38,0x02,0x58,0x02,0x59,
-  0x00,0x1D,0x00,0x21,0x00,0x25,0x00,0x00,0x25,0x31,0x06,
-  0x07,0x06,0x07,0x35,0x17,0x36,0x37,0x33,0x37,0x36,0x37,
-  0x36,0x37,0x36,0x37,0x36,0x37,0x35,0x21,0x35,0x21,0x11,
-  0x06,0x07,0x06,0x07,0x06,0x01,0x11,0x23,0x11,0x17,0x33,
-  0x15,0x23,0x01,0xE9,0x42,0x39,0x0E,0x11,0x06,0x29,0x09,
-  0x01,0x01,0x08,0x0B,0x0D,0x05,0x13,0x08,0x02,0x01,0xFE,
-  0x84,0x02,0x07,0x09,0x23,0x02,0x03,0x15,0xFE,0xCA,0x8B,
-  0xD6,0x52,0x52,0x5E,0x25,0x06,0x01,0x01,0x74,0x01,0x08,
-  0x05,0x01,0x04,0x08,0x0A,0x06,0x19,0x29,0x08,0x05,0xC8,
-  0x73,0xFE,0xBC,0x45,0x33,0x04,0x04,0x20,0x00,0xFF,0xFD,
-  0xC5,0x02,0x3B,0x05,0x52,0x00,0x00,0x02,0x00,0x3F,0x00,
-  0x00,0x02,0x12,0x02,0x59,0x00,0x1F,0x00,0x23,0x00,0x00,
-  0x01,0x31,0x11,0x23,0x11,0x26,0x27,0x26,0x27,0x26,0x27,
-  0x26,0x27,0x23,0x26,0x27,0x26,0x27,0x26,0x2B,0x01,0x35,
-  0x33,0x16,0x17,0x16,0x17,0x16,0x17,0x16,0x17,0x16,0x05,
-  0x33,0x15,0x23,0x02,0x12,0x8B,0x0B,0x0A,0x02,0x03,0x02,
-  0x02,0x08,0x02,0x01,0x03,0x03,0x1B,0x31,0x06,0x04,0xC3,
-  0xCF,0x54,0x3C,0x03,0x03,0x27,0x17,0x23,0x0B,0x01,0xFE,
-  0xC7,0x52,0x52,0x01,0x76,0xFE,0x8A,0x01,0x6D,0x31,0x10,
-  0x04,0x05,0x03,0x02,0x0A,0x02,0x02,0x01,0x10,0x09,0x01,
-  0x73,0x09,0x1F,0x02,0x02,0x12,0x24,0x31,0x41,0x06,0x2B,
-  0x52,0x00,0x02,0x00,0x4C,0x00,0x00,0x02,0xFF,0x02,0x58,
-  0x00,0x32,0x00,0x36,0x00,0x00,0x13,0x33,0x32,0x37,0x36,
-  0x3D,0x01,0x33,0x15,0x14,0x07,0x06,0x07,0x06,0x27,0x23,
-  0x17,0x16,0x17,0x16,0x17,0x16,0x3B,0x01,0x32,0x37,0x36,
-  0x37,0x31,0x36,0x37,0x36,0x35,0x11,0x33,0x11,0x16,0x07,
-  0x06,0x07,0x06,0x2B,0x01,0x22,0x27,0x26,0x27,0x26,0x35,
-  0x11,0x33,0x01,0x33,0x15,0x23,0xD7,0x44,0x1F,0x11,0x14,
-  0x8B,0x3A,0x31,0x4E,0x0B,0x0B,0x35,0x06,0x19,0x14,0x08,
-  0x15,0x27,0x21,0x4F,0x22,0x25,0x29,0x0F,0x06,0x0C,0x15,
-  0x8B,0x01,0x27,0x2E,0x4D,0x40,0x50,0x4F,0x50,0x41,0x4D,
-  0x2E,0x26,0x8B,0x01,0x03,0x52,0x52,0x01,0x43,0x11,0x11,
-  0x1E,0xD5,0xD5,0x50,0x2F,0x2F,0x05,0x01,0x01,0x0A,0x23,
-  0x0D,0x06,0x0B,0x12,0x12,0x16,0x12,0x08,0x11,0x22,0x21,
-  0x01,0x4F,0xFE,0xB1,0x42,0x39,0x47,0x25,0x22,0x22,0x25,
-  0x47,0x37,0x44,0x01,0x4F,0xFE,0xAF,0x52,0x00,0x00,0x02,
-  0x00,0x3E,0xFF,0xFF,0x02,0xAD,0x02,0x58,0x00,0x36,0x00,
-  0x3A,0x00,0x00,0x01,0x11,0x07,0x06,0x07,0x06,0x07,0x06,
-  0x07,0x06,0x07,0x06,0x27,0x35,0x32,0x17,0x32,0x37,0x36,
-  0x37,0x36,0x37,0x36,0x37,0x36,0x37,0x35,0x23,0x35,0x21,
-  0x16,0x17,0x16,0x17,0x16,0x17,0x16,0x17,0x11,0x23,0x11,
-  0x26,0x2F,0x01,0x26,0x27,0x26,0x2F,0x01,0x26,0x27,0x26,
-  0x27,0x26,0x27,0x07,0x33,0x15,0x23,0x01,0x48,0x04,0x06,
-  0x11,0x11,0x2F,0x46,0x3A,0x09,0x0A,0x0B,0x11,0x01,0x1B,
-  0x1B,0x0F,0x06,0x0A,0x11,0x0B,0x0A,0x01,0x01,0x01,0x42,
-  0x01,0x2E,0x55,0x41,0x29,0x15,0x23,0x0B,0x01,0x01,0x8B,
-  0x0B,0x09,0x01,0x04,0x05,0x08,0x02,0x01,0x03,0x03,0x1A,
-  0x30,0x07,0x05,0x12,0x52,0x52,0x01,0xE5,0xFF,0x00,0x43,
-  0x1F,0x1D,0x23,0x17,0x24,0x06,0x01,0x01,0x01,0x06,0x74,
-  0x06,0x07,0x02,0x05,0x08,0x10,0x0F,0x22,0x12,0x0D,0xFC,
-  0x73,0x0A,0x21,0x15,0x21,0x32,0x40,0x07,0x08,0xFE,0x8A,
-  0x01,0x6E,0x31,0x0F,0x01,0x06,0x08,0x0A,0x01,0x01,0x01,
-  0x02,0x0E,0x09,0x01,0x01,0x92,0x52,0x00,0x00,0x02,0x00,
-  0x4F,0x00,0x00,0x00,0xDA,0x02,0xE6,0x00,0x03,0x00,0x07,
-  0x00,0x00,0x33,0x11,0x33,0x11,0x03,0x33,0x15,0x23,0x4F,
-  0x8B,0x72,0x52,0x52,0x02,0x58,0xFD,0xA8,0x02,0xE6,0x52,
-  0x00,0x02,0x00,0x4D,0x00,0x00,0x02,0x62,0x02,0xE6,0x00,
-  0x22,0x00,0x26,0x00,0x00,0x25,0x35,0x26,0x27,0x26,0x27,
-  0x26,0x27,0x26,0x27,0x26,0x27,0x26,0x27,0x26,0x27,0x23,
-  0x35,0x33,0x16,0x17,0x16,0x17,0x16,0x17,0x16,0x17,0x15,
-  0x16,0x17,0x11,0x33,0x15,0x21,0x35,0x13,0x33,0x15,0x23,
-  0x01,0x7C,0x0B,0x0A,0x02,0x03,0x02,0x02,0x07,0x05,0x02,
-  0x03,0x1B,0x31,0x06,0x04,0xAA,0xB6,0x54,0x3C,0x03,0x03,
-  0x28,0x15,0x23,0x0C,0x01,0x01,0x5B,0xFD,0xEB,0x59,0xC8,
-  0xC8,0x73,0xFA,0x31,0x10,0x04,0x05,0x02,0x03,0x09,0x03,
-  0x01,0x02,0x0F,0x09,0x01,0x01,0x73,0x0A,0x1F,0x01,0x02,
-  0x13,0x23,0x31,0x40,0x01,0x06,0x08,0xFE,0xFD,0x73,0x73,
-  0x02,0x73,0x52,0x00,0x02,0x00,0x4B,0x00,0x00,0x02,0x16,
-  0x02,0xE6,0x00,0x3A,0x00,0x3E,0x00,0x00,0x21,0x31,0x23,
-  0x35,0x33,0x36,0x37,0x33,0x36,0x37,0x36,0x37,0x36,0x37,
-  0x36,0x37,0x3D,0x01,0x36,0x37,0x35,0x26,0x27,0x26,0x27,
-  0x26,0x27,0x26,0x27,0x26,0x27,0x26,0x27,0x23,0x26,0x27,
-  0x23,0x35,0x33,0x16,0x17,0x16,0x17,0x16,0x17,0x16,0x17,
-  0x16,0x17,0x15,0x06,0x07,0x06,0x07,0x06,0x07,0x06,0x07,
-  0x06,0x03,0x33,0x15,0x23,0x01,0x11,0xC5,0xBA,0x36,0x13,
-  0x01,0x05,0x06,0x0A,0x03,0x02,0x03,0x12,0x09,0x02,0x01,
-  0x0B,0x0A,0x03,0x03,0x01,0x02,0x09,0x04,0x03,0x02,0x1B,
-  0x30,0x01,0x05,0x04,0xBA,0xC5,0x53,0x3C,0x04,0x04,0x25,
-  0x18,0x24,0x0B,0x01,0x01,0x0B,0x1F,0x03,0x04,0x18,0x25,
-  0x40,0x4F,0x04,0x6D,0xC8,0xC8,0x73,0x0A,0x0A,0x03,0x03,
-  0x06,0x04,0x02,0x03,0x19,0x28,0x01,0x01,0x07,0x05,0x82,
-  0x31,0x10,0x04,0x05,0x02,0x03,0x0A,0x02,0x01,0x02,0x0F,
-  0x09,0x01,0x01,0x73,0x09,0x1F,0x02,0x02,0x12,0x24,0x34,
-  0x40,0x06,0x06,0x94,0x45,0x2F,0x06,0x06,0x24,0x12,0x21,
-  0x0A,0x01,0x02,0xE6,0x52,0x00,0x00,0x02,0x00,0x4F,0x00,
-  0x00,0x02,0x56,0x02,0xE6,0x00,0x4E,0x00,0x52,0x00,0x00,
-  0x21,0x31,0x21,0x35,0x33,0x36,0x37,0x36,0x37,0x36,0x3F,
-  0x01,0x35,0x36,0x37,0x36,0x37,0x36,0x3D,0x01,0x26,0x27,
-  0x35,0x27,0x34,0x31,0x30,0x31,0x27,0x26,0x27,0x26,0x27,
-  0x35,0x23,0x27,0x26,0x27,0x26,0x23,0x15,0x14,0x17,0x16,
-  0x3B,0x01,0x15,0x23,0x26,0x27,0x26,0x27,0x26,0x27,0x34,
-  0x3D,0x01,0x21,0x16,0x17,0x16,0x17,0x16,0x17,0x16,0x1D,
-  0x01,0x07,0x06,0x07,0x06,0x07,0x06,0x07,0x2B,0x03,0x06,
-  0x03,0x33,0x15,0x23,0x01,0x4F,0xFF,0x00,0xF8,0x2F,0x05,
-  0x02,0x03,0x22,0x0C,0x01,0x05,0x0A,0x08,0x03,0x01,0x05,
-  0x03,0x01,0x01,0x01,0x01,0x15,0x0E,0x01,0x01,0x07,0x12,
-  0x13,0x93,0x0B,0x0B,0x21,0x35,0x41,0x3D,0x05,0x24,0x1F,
-  0x30,0x01,0x01,0x00,0x46,0x31,0x4D,0x27,0x15,0x05,0x01,
-  0x07,0x05,0x0F,0x27,0x4D,0x29,0x42,0x01,0x01,0x01,0x01,
-  0x04,0x7D,0xC8,0xC8,0x73,0x05,0x02,0x01,0x02,0x12,0x0E,
-  0x01,0x01,0x06,0x0F,0x0A,0x1F,0x07,0x06,0x84,0x2A,0x05,
-  0x01,0x01,0x01,0x01,0x01,0x02,0x20,0x08,0x01,0x01,0x04,
-  0x09,0x0A,0x4F,0x22,0x08,0x09,0x73,0x08,0x01,0x0A,0x18,
-  0x2D,0x40,0x02,0x03,0xCB,0x02,0x17,0x23,0x42,0x22,0x35,
-  0x09,0x06,0x90,0x37,0x18,0x17,0x42,0x23,0x14,0x04,0x01,
-  0x02,0xE6,0x52,0x00,0x01,0x00,0x53,0x00,0x00,0x02,0x8A,
-  0x02,0xEE,0x00,0x13,0x00,0x00,0x13,0x35,0x33,0x15,0x13,
-  0x36,0x37,0x36,0x37,0x35,0x33,0x15,0x06,0x07,0x06,0x07,
-  0x06,0x07,0x17,0x23,0x53,0x8B,0xCB,0x24,0x0E,0x02,0x05,
-  0x8B,0x10,0x26,0x0B,0x10,0x12,0x18,0x98,0xA3,0x02,0x39,
-  0xB5,0x96,0xFE,0xE3,0x2C,0x37,0x08,0x16,0x9C,0xA7,0x59,
-  0x39,0x12,0x13,0x15,0x11,0xD4,0x00,0x00,0x02,0x00,0x0D,
-  0xFE,0x9D,0x02,0x8A,0x01,0x9D,0x00,0x03,0x00,0x4F,0x00,
-  0x00,0x05,0x23,0x35,0x33,0x07,0x14,0x17,0x16,0x33,0x32,
-  0x37,0x36,0x3F,0x01,0x17,0x06,0x07,0x06,0x07,0x06,0x23,
-  0x22,0x2F,0x02,0x26,0x27,0x26,0x35,0x34,0x3F,0x06,0x2F,
-  0x01,0x0F,0x05,0x27,0x3F,0x03,0x36,0x17,0x05,0x07,0x23,
-  0x22,0x0F,0x05,0x16,0x17,0x16,0x17,0x16,0x3B,0x01,0x15,
-  0x23,0x22,0x2F,0x02,0x0F,0x01,0x06,0x07,0x06,0x01,0x6B,
-  0x71,0x71,0xE3,0x2F,0x35,0x5E,0x1B,0x23,0x12,0x30,0x55,
-  0x37,0x2D,0x54,0x1C,0x2A,0x21,0x1F,0x35,0x17,0x2D,0x12,
-  0x5C,0x2E,0x2D,0x41,0x1A,0x20,0x22,0x2A,0x32,0x36,0x1C,
-  0x44,0x18,0x2A,0x09,0x09,0x2A,0x0A,0x3A,0x08,0x0C,0x0D,
-  0x12,0x24,0x2D,0x01,0xCB,0x0B,0x2A,0x17,0x14,0x15,0x09,
-  0x0E,0x22,0x19,0x1A,0x18,0x08,0x29,0x1B,0x20,0x4A,0x5F,
-  0x66,0x3E,0x1A,0x23,0x27,0x29,0x25,0x2A,0x23,0x78,0x72,
-  0x38,0x44,0x2F,0x33,0x05,0x02,0x0C,0x1F,0x69,0x18,0x1B,
-  0x08,0x07,0x06,0x04,0x08,0x07,0x1B,0x49,0x45,0x62,0x4E,
-  0x61,0x1E,0x20,0x1C,0x1E,0x1F,0x1C,0x01,0x02,0x01,0x03,
-  0x01,0x02,0x13,0x06,0x5D,0x0A,0x0A,0x0A,0x0C,0x16,0x01,
-  0x10,0x7A,0x04,0x04,0x02,0x06,0x0F,0x0F,0x28,0x15,0x09,
-  0x13,0x0A,0x81,0x4D,0x29,0x3D,0x1C,0x20,0x1E,0x37,0x31,
-  0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0xCC,0xCC,0x90,
-  0xFD,0xDC,0xFD,0x5F,0x0F,0x3C,0xF5,0x02,0x13,0x03,0xE8,
-  0x00,0x00,0x00,0x00,0xBA,0xFE,0xED,0x3A,0x00,0x00,0x00,
-  0x00,0xBA,0xFE,0xED,0x3A,0xFF,0x53,0xFE,0x9D,0x04,0x8C,
-  0x03,0xD3,0x00,0x01,0x00,0x08,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x03,0x20,0xFF,0x38,
-  0x00,0x5A,0x04,0xC5,0xFF,0x53,0xFF,0x02,0x04,0x8C,0x00,
-  0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x02,0xF1,0x01,0xB0,0x00,0x21,0x00,
-  0x00,0x00,0x00,0x01,0x4D,0x00,0x00,0x01,0x16,0x00,0x00,
-  0x01,0x4D,0x00,0x70,0x01,0xDA,0x00,0x32,0x02,0x2C,0x00,
-  0x03,0x02,0x2C,0x00,0x16,0x03,0x79,0x00,0x16,0x02,0xD2,
-  0x00,0x37,0x00,0xEE,0x00,0x32,0x01,0x4D,0x00,0x28,0x01,
-  0x4D,0x00,0x16,0x01,0x85,0x00,0x17,0x02,0x48,0x00,0x32,
-  0x01,0x16,0x00,0x40,0x01,0x4D,0x00,0x1A,0x01,0x16,0x00,
-  0x40,0x01,0x16,0x00,0x02,0x02,0x2C,0x00,0x1D,0x02,0x2C,
-  0x00,0x44,0x02,0x2C,0x00,0x1E,0x02,0x2C,0x00,0x1D,0x02,
-  0x2C,0x00,0x18,0x02,0x2C,0x00,0x1B,0x02,0x2C,0x00,0x20,
-  0x02,0x2C,0x00,0x1D,0x02,0x2C,0x00,0x16,0x02,0x2C,0x00,
-  0x1C,0x01,0x4D,0x00,0x71,0x01,0x4D,0x00,0x71,0x02,0x48,
-  0x00,0x28,0x02,0x48,0x00,0x32,0x02,0x48,0x00,0x28,0x02,
-  0x63,0x00,0x40,0x03,0xCF,0x00,0x1B,0x02,0xD2,0x00,0x1A,
-  0x02,0xD2,0x00,0x52,0x02,0xD2,0x00,0x2C,0x02,0xD2,0x00,
-  0x4D,0x02,0x9B,0x00,0x4F,0x02,0x63,0x00,0x4A,0x03,0x0A,
-  0x00,0x2A,0x02,0xD2,0x00,0x44,0x01,0x16,0x00,0x3F,0x02,
-  0x2C,0x00,0x18,0x02,0xD2,0x00,0x4A,0x02,0x63,0x00,0x50,
-  0x03,0x41,0x00,0x42,0x02,0xD2,0x00,0x44,0x03,0x0A,0x00,
-  0x28,0x02,0x9B,0x00,0x4C,0x03,0x0A,0x00,0x2B,0x02,0xD2,
-  0x00,0x50,0x02,0x9B,0x00,0x20,0x02,0x63,0x00,0x0E,0x02,
-  0xD2,0x00,0x4C,0x02,0x9B,0x00,0x18,0x03,0xB0,0x00,0x0D,
-  0x02,0x9B,0x00,0x16,0x02,0x9B,0x00,0x1B,0x02,0x63,0x00,
-  0x1E,0x01,0x4D,0x00,0x42,0x01,0x16,0xFF,0xF4,0x01,0x4D,
-  0x00,0x12,0x02,0x48,0x00,0x3D,0x02,0x2C,0xFF,0xEA,0x01,
-  0x4D,0x00,0x11,0x02,0x2C,0x00,0x1C,0x02,0x63,0x00,0x3B,
-  0x02,0x2C,0x00,0x22,0x02,0x63,0x00,0x1D,0x02,0x2C,0x00,
-  0x16,0x01,0x4D,0x00,0x0E,0x02,0x63,0x00,0x22,0x02,0x63,
-  0x00,0x43,0x01,0x16,0x00,0x43,0x01,0x16,0x00,0x04,0x02,
-  0x2C,0x00,0x3B,0x01,0x16,0x00,0x43,0x03,0x79,0x00,0x3C,
-  0x02,0x63,0x00,0x3F,0x02,0x63,0x00,0x23,0x02,0x63,0x00,
-  0x3A,0x02,0x63,0x00,0x1C,0x01,0x85,0x00,0x3F,0x02,0x2C,
-  0x00,0x1D,0x01,0x4D,0x00,0x0E,0x02,0x63,0x00,0x3A,0x02,
-  0x2C,0x00,0x0E,0x03,0x0A,0x00,0x05,0x02,0x2C,0x00,0x10,
-  0x02,0x2C,0x00,0x09,0x01,0xF4,0x00,0x15,0x01,0x85,0x00,
-  0x25,0x01,0x18,0x00,0x64,0x01,0x85,0x00,0x48,0x02,0x48,
-  0x00,0x3C,0x01,0x4D,0x00,0x42,0x02,0x2C,0x00,0x24,0x02,
-  0x2C,0x00,0x1F,0x02,0x2C,0x00,0x1A,0x02,0x2C,0x00,0x05,
-  0x01,0x18,0x00,0x64,0x02,0x2C,0x00,0x21,0x01,0x4D,0x00,
-  0x12,0x02,0xE1,0xFF,0xF2,0x01,0x72,0x00,0x1F,0x02,0x2C,
-  0x00,0x58,0x02,0x48,0x00,0x28,0x02,0xE1,0xFF,0xF2,0x01,
-  0x4D,0x00,0x10,0x02,0x5E,0x00,0x97,0x02,0x48,0x00,0x38,
-  0x01,0x5F,0x00,0x10,0x01,0x5F,0x00,0x0F,0x01,0x4D,0x00,
-  0x79,0x02,0x63,0x00,0x3A,0x02,0x2C,0x00,0x13,0x01,0x16,
-  0x00,0x40,0x01,0x4D,0x00,0x1B,0x01,0x5F,0x00,0x28,0x01,
-  0x6D,0x00,0x17,0x02,0x2C,0x00,0x58,0x03,0x65,0x00,0x28,
-  0x03,0x65,0x00,0x28,0x03,0x65,0x00,0x0F,0x02,0x63,0x00,
-  0x33,0x02,0xD2,0x00,0x1A,0x02,0xD2,0x00,0x1A,0x02,0xD2,
-  0x00,0x1A,0x02,0xD2,0x00,0x1A,0x02,0xD2,0x00,0x1A,0x02,
-  0xD2,0x00,0x1A,0x03,0xE8,0x00,0x01,0x02,0xD2,0x00,0x2C,
-  0x02,0x9B,0x00,0x4F,0x02,0x9B,0x00,0x4F,0x02,0x9B,0x00,
-  0x4F,0x02,0x9B,0x00,0x4F,0x01,0x16,0xFF,0xF6,0x01,0x16,
-  0x00,0x3F,0x01,0x16,0xFF,0xED,0x01,0x16,0xFF,0xF7,0x02,
-  0xD2,0x00,0x00,0x02,0xD2,0x00,0x44,0x03,0x0A,0x00,0x28,
-  0x03,0x0A,0x00,0x28,0x03,0x0A,0x00,0x28,0x03,0x0A,0x00,
-  0x28,0x03,0x0A,0x00,0x28,0x02,0x48,0x00,0x4F,0x03,0x0A,
-  0x00,0x1F,0x02,0xD2,0x00,0x4C,0x02,0xD2,0x00,0x4C,0x02,
-  0xD2,0x00,0x4C,0x02,0xD2,0x00,0x4C,0x02,0x9B,0x00,0x1B,
-  0x02,0x9B,0x00,0x4C,0x02,0x63,0x00,0x43,0x02,0x2C,0x00,
-  0x1C,0x02,0x2C,0x00,0x1C,0x02,0x2C,0x00,0x1C,0x02,0x2C,
-  0x00,0x1C,0x02,0x2C,0x00,0x1C,0x02,0x2C,0x00,0x1C,0x03,
-  0x79,0x00,0x1B,0x02,0x2C,0x00,0x22,0x02,0x2C,0x00,0x16,
-  0x02,0x2C,0x00,0x16,0x02,0x2C,0x00,0x16,0x02,0x2C,0x00,
-  0x16,0x01,0x16,0xFF,0xF6,0x01,0x16,0x00,0x43,0x01,0x16,
-  0xFF,0xED,0x01,0x16,0xFF,0xF7,0x02,0x63,0x00,0x23,0x02,
-  0x63,0x00,0x3F,0x02,0x63,0x00,0x23,0x02,0x63,0x00,0x23,
-  0x02,0x63,0x00,0x23,0x02,0x63,0x00,0x23,0x02,0x63,0x00,
-  0x23,0x02,0x48,0x00,0x32,0x02,0x63,0x00,0x0B,0x02,0x63,
-  0x00,0x3A,0x02,0x63,0x00,0x3A,0x02,0x63,0x00,0x3A,0x02,
-  0x63,0x00,0x3A,0x02,0x2C,0x00,0x09,0x02,0x63,0x00,0x3A,
-  0x02,0x2C,0x00,0x09,0x02,0xD2,0x00,0x1A,0x02,0x2C,0x00,
-  0x1C,0x02,0xD2,0x00,0x1A,0x02,0x2C,0x00,0x1C,0x02,0xD2,
-  0x00,0x1A,0x02,0x2C,0x00,0x1C,0x02,0xD2,0x00,0x2C,0x02,
-  0x2C,0x00,0x22,0x02,0xD2,0x00,0x2C,0x02,0x2C,0x00,0x22,
-  0x02,0xD2,0x00,0x2C,0x02,0x2C,0x00,0x22,0x02,0xD2,0x00,
-  0x2C,0x02,0x2C,0x00,0x22,0x02,0xD2,0x00,0x4D,0x02,0x63,
-  0x00,0x1D,0x02,0xD2,0x00,0x00,0x02,0x63,0x00,0x1D,0x02,
-  0x9B,0x00,0x4F,0x02,0x2C,0x00,0x16,0x02,0x9B,0x00,0x4F,
-  0x02,0x2C,0x00,0x16,0x02,0x9B,0x00,0x4F,0x02,0x2C,0x00,
-  0x16,0x02,0x9B,0x00,0x4F,0x02,0x2C,0x00,0x15,0x02,0x9B,
-  0x00,0x4F,0x02,0x2C,0x00,0x16,0x03,0x0A,0x00,0x2A,0x02,
-  0x63,0x00,0x22,0x03,0x0A,0x00,0x2A,0x02,0x63,0x00,0x22,
-  0x03,0x0A,0x00,0x2A,0x02,0x63,0x00,0x22,0x03,0x0A,0x00,
-  0x2A,0x02,0x63,0x00,0x22,0x02,0xD2,0x00,0x44,0x02,0x63,
-  0x00,0x43,0x02,0xD2,0x00,0x08,0x02,0x63,0x00,0x08,0x01,
-  0x16,0xFF,0xD9,0x01,0x16,0xFF,0xD8,0x01,0x16,0x00,0x02,
-  0x01,0x16,0x00,0x07,0x01,0x16,0x00,0x06,0x01,0x16,0x00,
-  0x05,0x01,0x16,0x00,0x22,0x01,0x16,0x00,0x22,0x01,0x16,
-  0x00,0x3F,0x01,0x16,0x00,0x43,0x03,0x28,0x00,0x3F,0x01,
-  0xEC,0x00,0x43,0x02,0x2C,0x00,0x18,0x01,0x16,0xFF,0xED,
-  0x02,0xD2,0x00,0x4A,0x02,0x2C,0x00,0x3B,0x02,0x3D,0x00,
-  0x3C,0x02,0x63,0x00,0x50,0x01,0x16,0x00,0x43,0x02,0x63,
-  0x00,0x50,0x01,0x16,0x00,0x43,0x02,0x63,0x00,0x50,0x01,
-  0x16,0x00,0x43,0x02,0x63,0x00,0x50,0x02,0x2C,0x00,0x43,
-  0x02,0x63,0x00,0x00,0x01,0x16,0x00,0x00,0x02,0xD2,0x00,
-  0x44,0x02,0x63,0x00,0x3F,0x02,0xD2,0x00,0x44,0x02,0x63,
-  0x00,0x3F,0x02,0xD2,0x00,0x44,0x02,0x63,0x00,0x3F,0x02,
-  0x63,0x00,0x3F,0x02,0xD2,0x00,0x44,0x02,0x63,0x00,0x3F,
-  0x03,0x0A,0x00,0x28,0x02,0x63,0x00,0x23,0x03,0x0A,0x00,
-  0x28,0x02,0x63,0x00,0x23,0x03,0x0A,0x00,0x28,0x02,0x63,
-  0x00,0x23,0x03,0xE8,0x00,0x1C,0x03,0xB0,0x00,0x17,0x02,
-  0xD2,0x00,0x50,0x01,0x85,0x00,0x3F,0x02,0xD2,0x00,0x50,
-  0x01,0x85,0x00,0x3F,0x02,0xD2,0x00,0x50,0x01,0x85,0x00,
-  0x36,0x02,0x9B,0x00,0x20,0x02,0x2C,0x00,0x1D,0x02,0x9B,
-  0x00,0x20,0x02,0x2C,0x00,0x1D,0x02,0x9B,0x00,0x20,0x02,
-  0x2C,0x00,0x1D,0x02,0x9B,0x00,0x20,0x02,0x2C,0x00,0x1D,
-  0x02,0x63,0x00,0x0E,0x01,0x4D,0x00,0x0E,0x02,0x63,0x00,
-  0x0E,0x01,0x4D,0x00,0x0E,0x02,0x63,0x00,0x0E,0x01,0x4D,
-  0x00,0x0E,0x02,0xD2,0x00,0x4C,0x02,0x63,0x00,0x3A,0x02,
-  0xD2,0x00,0x4C,0x02,0x63,0x00,0x3A,0x02,0xD2,0x00,0x4C,
-  0x02,0x63,0x00,0x3A,0x02,0xD2,0x00,0x4C,0x02,0x63,0x00,
-  0x3A,0x02,0xD2,0x00,0x4C,0x02,0x63,0x00,0x3A,0x02,0xD2,
-  0x00,0x4C,0x02,0x63,0x00,0x3A,0x03,0xB0,0x00,0x0D,0x03,
-  0x0A,0x00,0x05,0x02,0x9B,0x00,0x1B,0x02,0x2C,0x00,0x09,
-  0x02,0x9B,0x00,0x1B,0x02,0x63,0x00,0x1E,0x01,0xF4,0x00,
-  0x15,0x02,0x63,0x00,0x1E,0x01,0xF4,0x00,0x15,0x02,0x63,
-  0x00,0x1E,0x01,0xF4,0x00,0x15,0x01,0x4D,0x00,0x0E,0x02,
-  0x2C,0x00,0x15,0x02,0x9B,0x00,0x20,0x02,0x2C,0x00,0x1D,
-  0x02,0x63,0x00,0x0E,0x01,0x4D,0x00,0x0E,0x01,0x4D,0x00,
-  0x08,0x01,0x4D,0x00,0x09,0x01,0x4D,0x00,0x23,0x01,0x4D,
-  0x00,0x70,0x01,0x4D,0x00,0x4D,0x01,0x4D,0x00,0x2D,0x01,
-  0x4D,0xFF,0xF7,0x01,0x4D,0xFF,0xD4,0x01,0xEE,0x00,0x32,
-  0x02,0xFC,0xFF,0xDF,0x01,0xDA,0x00,0x3B,0x03,0x62,0xFF,
-  0xE2,0x03,0x87,0xFF,0xDF,0x01,0xAE,0xFF,0xE0,0x03,0x82,
-  0xFF,0xD7,0x03,0xC5,0xFF,0xDE,0x03,0x4C,0xFF,0xE4,0x02,
-  0xD2,0x00,0x1A,0x02,0xD2,0x00,0x52,0x02,0x82,0x00,0x39,
-  0x02,0xD6,0x00,0x00,0x02,0x9B,0x00,0x4F,0x02,0x63,0x00,
-  0x1E,0x02,0xD2,0x00,0x44,0x03,0x2A,0x00,0x14,0x01,0x16,
-  0x00,0x3F,0x02,0xD2,0x00,0x4A,0x02,0xE8,0xFF,0xE4,0x03,
-  0x5C,0x00,0x27,0x02,0xCA,0x00,0x1F,0x02,0xB2,0x00,0x2D,
-  0x03,0x36,0x00,0x14,0x03,0x0D,0x00,0x37,0x02,0xBA,0x00,
-  0x35,0x02,0xB0,0x00,0x0F,0x02,0xB0,0x00,0x0E,0x02,0xE8,
-  0xFF,0xDF,0x03,0x09,0x00,0x04,0x03,0x0F,0xFF,0xEB,0x03,
-  0x25,0x00,0x1B,0x03,0x0C,0x00,0x11,0x01,0x6F,0xFF,0xF5,
-  0x02,0xE8,0xFF,0xDF,0x02,0x90,0x00,0x1B,0x02,0x3A,0x00,
-  0x0E,0x02,0x54,0xFF,0xFB,0x01,0x4E,0x00,0x1F,0x02,0x3F,
-  0x00,0x0F,0x02,0x90,0x00,0x1B,0x02,0x40,0x00,0x19,0x02,
-  0x4F,0x00,0x00,0x02,0x6C,0x00,0x0C,0x02,0x3A,0x00,0x0E,
-  0x02,0x0A,0x00,0x0D,0x02,0x4A,0xFF,0xFB,0x02,0x4A,0x00,
-  0x14,0x01,0x5A,0x00,0x1F,0x02,0x40,0x00,0x29,0x02,0x6C,
-  0xFF,0xFA,0x02,0x9B,0x00,0x34,0x02,0x34,0xFF,0xEA,0x02,
-  0x12,0xFF,0xF7,0x02,0x62,0x00,0x09,0x02,0xD1,0x00,0x1C,
-  0x02,0x72,0x00,0x20,0x02,0x53,0xFF,0xFD,0x02,0xA4,0x00,
-  0x09,0x02,0x50,0x00,0x11,0x02,0x3F,0x00,0x0F,0x03,0x21,
-  0x00,0x15,0x02,0x78,0xFF,0xE0,0x02,0xD2,0x00,0x11,0x03,
-  0x20,0x00,0x0B,0x01,0x74,0xFF,0xD0,0x02,0x3F,0x00,0x0F,
-  0x02,0x62,0x00,0x09,0x02,0x3F,0x00,0x0F,0x03,0x20,0x00,
-  0x0B,0x02,0x9B,0x00,0x4F,0x02,0xC5,0x00,0x52,0x03,0x16,
-  0x00,0x0E,0x02,0x63,0x00,0x4A,0x02,0xD2,0x00,0x2C,0x02,
-  0x9B,0x00,0x20,0x01,0x16,0x00,0x3F,0x01,0x16,0xFF,0xF7,
-  0x02,0x2C,0x00,0x18,0x04,0x56,0x00,0x2E,0x04,0x59,0x00,
-  0x44,0x03,0x16,0x00,0x0E,0x02,0xD2,0x00,0x4A,0x02,0xD6,
-  0x00,0x44,0x02,0xCE,0x00,0x0F,0x02,0xD2,0x00,0x44,0x02,
-  0xD2,0x00,0x1A,0x02,0xD2,0x00,0x52,0x02,0xD2,0x00,0x52,
-  0x02,0x63,0x00,0x52,0x03,0x84,0x00,0x23,0x02,0xC5,0x00,
-  0x52,0x04,0x45,0x00,0x16,0x02,0xA0,0x00,0x20,0x02,0xF5,
-  0x00,0x52,0x02,0xF5,0x00,0x52,0x02,0xEE,0x00,0x52,0x02,
-  0xD9,0x00,0x24,0x03,0x6A,0x00,0x52,0x02,0xF1,0x00,0x52,
-  0x03,0x0A,0x00,0x28,0x02,0xF1,0x00,0x52,0x02,0x9F,0x00,
-  0x52,0x02,0xD2,0x00,0x2C,0x02,0x63,0x00,0x0E,0x02,0xCE,
-  0x00,0x0F,0x03,0x7C,0x00,0x1E,0x02,0x9B,0x00,0x16,0x03,
-  0x30,0x00,0x52,0x02,0xAD,0x00,0x44,0x04,0x21,0x00,0x44,
-  0x04,0x9F,0x00,0x44,0x03,0xA0,0x00,0x0E,0x03,0xB5,0x00,
-  0x44,0x02,0xAF,0x00,0x4C,0x02,0xD2,0x00,0x2C,0x04,0x55,
-  0x00,0x44,0x02,0xBA,0x00,0x16,0x02,0x2C,0x00,0x1C,0x02,
-  0x5E,0x00,0x32,0x02,0x3C,0x00,0x3C,0x01,0xC6,0x00,0x3C,
-  0x02,0xAD,0x00,0x17,0x02,0x2C,0x00,0x16,0x03,0x29,0x00,
-  0x10,0x02,0x22,0x00,0x1D,0x02,0x67,0x00,0x3C,0x02,0x67,
-  0x00,0x3C,0x02,0x3D,0x00,0x3C,0x02,0x41,0x00,0x1D,0x02,
-  0x9A,0x00,0x3C,0x02,0x5B,0x00,0x3C,0x02,0x63,0x00,0x23,
-  0x02,0x5B,0x00,0x3C,0x02,0x63,0x00,0x3C,0x02,0x2C,0x00,
-  0x22,0x01,0xC6,0x00,0x15,0x02,0x2C,0x00,0x09,0x03,0xBD,
-  0x00,0x1C,0x02,0x2C,0x00,0x10,0x02,0x8C,0x00,0x3C,0x02,
-  0x42,0x00,0x3C,0x03,0x76,0x00,0x3C,0x03,0xC8,0x00,0x3C,
-  0x02,0xB5,0x00,0x14,0x03,0x2B,0x00,0x3C,0x02,0x32,0x00,
-  0x3C,0x02,0x34,0x00,0x22,0x03,0x8C,0x00,0x3C,0x02,0x54,
-  0x00,0x19,0x02,0x2C,0x00,0x16,0x02,0x2C,0x00,0x16,0x02,
-  0x5E,0x00,0x16,0x01,0xC6,0x00,0x3C,0x02,0x2C,0x00,0x22,
-  0x02,0x2C,0x00,0x1D,0x01,0x16,0x00,0x43,0x01,0x16,0xFF,
-  0xF7,0x01,0x16,0x00,0x04,0x03,0x84,0x00,0x1D,0x02,0x63,
-  0x00,0x3F,0x02,0x5E,0x00,0x16,0x02,0x3D,0x00,0x3B,0x02,
-  0x60,0x00,0x3C,0x02,0x2C,0x00,0x09,0x02,0x60,0x00,0x3C,
-  0x02,0xAF,0x00,0x4C,0x02,0x32,0x00,0x3C,0x02,0x9B,0x00,
-  0x4C,0x02,0x63,0x00,0x3A,0x02,0x63,0x00,0x4A,0x01,0xC6,
-  0x00,0x40,0x02,0x63,0x00,0x4A,0x01,0xC6,0x00,0x3C,0x02,
-  0x63,0x00,0x4A,0x01,0xC6,0x00,0x3C,0x04,0x45,0x00,0x16,
-  0x03,0x29,0x00,0x10,0x02,0xA0,0x00,0x20,0x02,0x22,0x00,
-  0x1D,0x02,0xD2,0x00,0x4A,0x02,0x3D,0x00,0x3B,0x02,0xD2,
-  0x00,0x4A,0x02,0x3D,0x00,0x3B,0x02,0xD2,0x00,0x4A,0x02,
-  0x3D,0x00,0x3B,0x02,0xD2,0x00,0x4A,0x02,0x3D,0x00,0x3B,
-  0x02,0xD2,0x00,0x44,0x02,0x60,0x00,0x3C,0x02,0xD2,0x00,
-  0x44,0x02,0x60,0x00,0x3C,0x02,0xD2,0x00,0x44,0x02,0x60,
-  0x00,0x3C,0x02,0xD2,0x00,0x2C,0x02,0x2C,0x00,0x22,0x02,
-  0xD2,0x00,0x2C,0x02,0x2C,0x00,0x22,0x02,0x63,0x00,0x0E,
-  0x01,0xC6,0x00,0x15,0x02,0x9B,0x00,0x1B,0x02,0x2C,0x00,
-  0x0E,0x02,0x9B,0x00,0x1B,0x02,0x2C,0x00,0x0E,0x02,0x9B,
-  0x00,0x16,0x02,0x2C,0x00,0x10,0x03,0x2E,0x00,0x44,0x02,
-  0xAD,0x00,0x3C,0x02,0xA3,0x00,0x44,0x02,0x44,0x00,0x3C,
-  0x02,0xA3,0x00,0x44,0x02,0x44,0x00,0x3C,0x02,0xA3,0x00,
-  0x44,0x02,0x44,0x00,0x3C,0x02,0xD2,0x00,0x2C,0x02,0x2C,
-  0x00,0x22,0x02,0xD2,0x00,0x2C,0x02,0x2C,0x00,0x22,0x01,
-  0x16,0x00,0x3F,0x04,0x45,0x00,0x16,0x03,0x29,0x00,0x10,
-  0x02,0xD2,0x00,0x4A,0x02,0x3D,0x00,0x3B,0x02,0xD2,0x00,
-  0x44,0x02,0x60,0x00,0x3C,0x02,0xA3,0x00,0x44,0x02,0x44,
-  0x00,0x3C,0x02,0xD2,0x00,0x1A,0x02,0x2C,0x00,0x1C,0x02,
-  0xD2,0x00,0x1A,0x02,0x2C,0x00,0x1C,0x03,0xE8,0x00,0x01,
-  0x03,0x79,0x00,0x1B,0x02,0xC5,0x00,0x52,0x02,0x2C,0x00,
-  0x16,0x02,0xD2,0x00,0x2C,0x02,0x2C,0x00,0x22,0x02,0xD2,
-  0x00,0x2C,0x02,0x2C,0x00,0x22,0x04,0x45,0x00,0x16,0x03,
-  0x29,0x00,0x10,0x02,0xA0,0x00,0x20,0x02,0x22,0x00,0x1D,
-  0x02,0xA0,0x00,0x20,0x02,0x22,0x00,0x1D,0x02,0xF5,0x00,
-  0x52,0x02,0x67,0x00,0x3C,0x02,0xF5,0x00,0x52,0x02,0x67,
-  0x00,0x3C,0x03,0x0A,0x00,0x28,0x02,0x63,0x00,0x23,0x03,
-  0x0A,0x00,0x28,0x02,0x63,0x00,0x23,0x03,0x0A,0x00,0x28,
-  0x02,0x63,0x00,0x23,0x02,0xD2,0x00,0x2C,0x02,0x34,0x00,
-  0x22,0x02,0xCE,0x00,0x0F,0x02,0x2C,0x00,0x09,0x02,0xCE,
-  0x00,0x0F,0x02,0x2C,0x00,0x09,0x02,0xCE,0x00,0x0F,0x02,
-  0x2C,0x00,0x09,0x02,0xAD,0x00,0x44,0x02,0x42,0x00,0x3C,
-  0x03,0xB5,0x00,0x44,0x03,0x2B,0x00,0x3C,0x00,0x52,0x00,
-  0x00,0x01,0x5B,0x00,0x00,0x01,0x55,0x00,0x00,0x01,0x55,
-  0x00,0x00,0x00,0x52,0x00,0x00,0x00,0xD3,0x00,0x00,0x00,
-  0xD3,0x00,0x00,0x00,0xC8,0x00,0x00,0x00,0xC8,0x00,0x00,
-  0x00,0x52,0x00,0x00,0x01,0x55,0x00,0x00,0x00,0x52,0x00,
-  0x00,0x00,0x52,0x00,0x00,0x02,0x04,0x00,0x3F,0x00,0xC8,
-  0x00,0x00,0x01,0x29,0x00,0x4F,0x04,0x0E,0x02,0x8A,0x04,
-  0x0E,0x00,0x65,0x01,0x4D,0x00,0x71,0x00,0x52,0x00,0x00,
-  0x02,0xCA,0x00,0x3D,0x02,0x8B,0x00,0x4D,0x02,0x2D,0x00,
-  0x2F,0x02,0x7E,0x00,0x3F,0x02,0xAA,0x00,0x4F,0x01,0x29,
-  0x00,0x4F,0x01,0xBB,0x00,0x3F,0x02,0xAA,0x00,0x4F,0x02,
-  0x9E,0x00,0x4C,0x01,0x1C,0x00,0x49,0x02,0x4E,0x00,0x3E,
-  0x02,0x53,0x00,0x4B,0x02,0x9B,0x00,0x3E,0x02,0xAB,0x00,
-  0x50,0x02,0xC0,0x00,0x43,0x01,0x29,0x00,0x4F,0x01,0xAD,
-  0x00,0x49,0x02,0x9E,0x00,0x4B,0x02,0x8D,0x00,0x3C,0x02,
-  0x95,0x00,0x48,0x02,0x94,0x00,0x4F,0x02,0x68,0x00,0x1B,
-  0x02,0x9F,0x00,0x3D,0x02,0xA0,0x00,0x50,0x02,0x58,0x00,
-  0x3F,0x03,0x48,0x00,0x4C,0x02,0xF4,0x00,0x3E,0x02,0x2A,
-  0x00,0x4F,0x02,0x26,0x00,0x49,0x02,0x1E,0x00,0x49,0x00,
-  0xEE,0x00,0x32,0x01,0xDA,0x00,0x32,0x02,0x2C,0x00,0x18,
-  0x03,0x0A,0x00,0x2A,0x03,0xB0,0x00,0x0D,0x02,0x63,0x00,
-  0x22,0x01,0x16,0x00,0x43,0x03,0x79,0x00,0x3C,0x03,0x4C,
-  0x01,0x86,0x03,0x9B,0x00,0x2C,0x03,0x9A,0x00,0x2C,0x03,
-  0x9A,0x00,0x2C,0x02,0x89,0x00,0x2D,0x02,0xC0,0x00,0x2D,
-  0x04,0xC5,0x00,0x40,0x02,0x2C,0xFF,0xF7,0x03,0xE8,0xFF,
-  0xF9,0x01,0x16,0x00,0x43,0x01,0x16,0x00,0x42,0x01,0x16,
-  0x00,0x42,0x01,0xF4,0x00,0x47,0x01,0xF4,0x00,0x49,0x01,
-  0xF4,0x00,0x48,0x02,0x2C,0x00,0x1F,0x02,0x2C,0x00,0x1C,
-  0x01,0x5E,0x00,0x32,0x03,0xE8,0x00,0x5C,0x03,0xE8,0x00,
-  0x0B,0x01,0x4D,0x00,0x53,0x01,0x4D,0x00,0x50,0x00,0xA7,
-  0xFF,0x53,0x04,0x19,0x00,0x50,0x02,0x2C,0x00,0x06,0x03,
-  0xE8,0x00,0x47,0x01,0xEA,0x00,0x16,0x02,0xD9,0x00,0x08,
-  0x02,0xC7,0x00,0x11,0x02,0x48,0x00,0x28,0x02,0x1E,0x00,
-  0x07,0x02,0x24,0x00,0x32,0x02,0x48,0x00,0x2D,0x02,0x48,
-  0x00,0x2D,0x01,0xE9,0x00,0x10,0x02,0x2C,0x00,0x1D,0x02,
-  0x2C,0x00,0x1E,0x02,0x2C,0x00,0x1D,0x02,0x2C,0x00,0x18,
-  0x02,0x2C,0x00,0x1B,0x02,0x2C,0x00,0x20,0x02,0x2C,0x00,
-  0x1D,0x02,0x2C,0x00,0x16,0x02,0x2C,0x00,0x1C,0x01,0x4D,
-  0x00,0x70,0x02,0x2C,0x00,0x44,0x02,0x63,0x00,0x09,0x02,
-  0x63,0x00,0x0C,0x01,0x1C,0x00,0x49,0x01,0x31,0x00,0x00,
-  0x02,0x1E,0x00,0x49,0x02,0x8D,0x00,0x56,0x03,0xC4,0x00,
-  0x3D,0x03,0x78,0x00,0x3F,0x03,0xA4,0x00,0x4F,0x03,0x4D,
-  0x00,0x4C,0x03,0x95,0x00,0x3E,0x03,0xA5,0x00,0x50,0x03,
-  0x52,0x00,0x3F,0x03,0xEE,0x00,0x3E,0x02,0x48,0x00,0x32,
-  0x03,0x48,0x00,0x4C,0x03,0x48,0x00,0x4C,0x03,0x48,0x00,
-  0x4C,0x03,0x48,0x00,0x4C,0x02,0xCA,0x00,0x3D,0x02,0xCA,
-  0x00,0x3D,0x02,0xCA,0x00,0x3D,0x02,0x8B,0x00,0x4D,0x02,
-  0x2D,0x00,0x2F,0x02,0x7E,0x00,0x3F,0x02,0xAA,0x00,0x4F,
-  0x01,0x6F,0x00,0x1E,0x01,0xBB,0x00,0x1A,0x02,0x9E,0x00,
-  0x4C,0x01,0x62,0x00,0x22,0x02,0x4E,0x00,0x3E,0x02,0x53,
-  0x00,0x4B,0x02,0x9B,0x00,0x3E,0x02,0xC0,0x00,0x43,0x01,
-  0xAD,0x00,0x49,0x02,0x9E,0x00,0x4B,0x02,0x95,0x00,0x48,
-  0x02,0x94,0x00,0x4F,0x02,0x9F,0x00,0x3D,0x02,0xA0,0x00,
-  0x50,0x02,0x58,0x00,0x3F,0x03,0x48,0x00,0x4C,0x02,0xF4,
-  0x00,0x3E,0x01,0x29,0x00,0x4F,0x02,0x8B,0x00,0x4D,0x02,
-  0x53,0x00,0x4B,0x02,0x94,0x00,0x4F,0x02,0xCA,0x00,0x53,
-  0x02,0x7C,0x00,0x0D,0x00,0x00,0x00,0x2B,0x00,0x2B,0x00,
-  0x2B,0x00,0x2B,0x00,0x42,0x00,0x5A,0x00,0x88,0x00,0xDC,
-  0x01,0x48,0x01,0xAB,0x01,0xBA,0x01,0xDA,0x01,0xF9,0x02,
-  0x16,0x02,0x2B,0x02,0x47,0x02,0x54,0x02,0x60,0x02,0x6D,
-  0x02,0xA7,0x02,0xB8,0x02,0xF3,0x03,0x43,0x03,0x5F,0x03,
-  0x94,0x03,0xF2,0x04,0x12,0x04,0x72,0x04,0xBC,0x04,0xCE,
-  0x04,0xF0,0x05,0x03,0x05,0x17,0x05,0x29,0x05,0x75,0x06,
-  0x04,0x06,0x1E,0x06,0x5B,0x06,0x95,0x06,0xB8,0x06,0xCF,
-  0x06,0xE4,0x07,0x22,0x07,0x3A,0x07,0x47,0x07,0x6D,0x07,
-  0x87,0x07,0x97,0x07,0xB1,0x07,0xC8,0x08,0x0B,0x08,0x37,
-  0x08,0x7E,0x08,0xC4,0x09,0x1C,0x09,0x2E,0x09,0x4E,0x09,
-  0x60,0x09,0x7C,0x09,0x96,0x09,0xAC,0x09,0xC3,0x09,0xD5,
-  0x09,0xE3,0x09,0xF4,0x0A,0x07,0x0A,0x14,0x0A,0x21,0x0A,
-  0x6E,0x0A,0xA5,0x0A,0xE0,0x0B,0x16,0x0B,0x53,0x0B,0x72,
-  0x0B,0xC0,0x0B,0xE4,0x0B,0xF7,0x0C,0x19,0x0C,0x31,0x0C,
-  0x3E,0x0C,0x7C,0x0C,0x9F,0x0C,0xD1,0x0D,0x08,0x0D,0x41,
-  0x0D,0x5C,0x0D,0xAB,0x0D,0xCE,0x0D,0xF0,0x0E,0x02,0x0E,
-  0x1E,0x0E,0x38,0x0E,0x5F,0x0E,0x76,0x0E,0xC0,0x0E,0xCD,
-  0x0F,0x0F,0x0F,0x36,0x0F,0x4C,0x0F,0x8A,0x0F,0xF9,0x10,
-  0x41,0x10,0x64,0x10,0x78,0x10,0xEB,0x10,0xFD,0x11,0x6C,
-  0x11,0xBA,0x11,0xD4,0x11,0xE4,0x12,0x5B,0x12,0x68,0x12,
-  0x9C,0x12,0xB7,0x12,0xF4,0x13,0x31,0x13,0x3F,0x13,0x74,
-  0x13,0x93,0x13,0x9F,0x13,0xCE,0x13,0xDF,0x14,0x18,0x14,
-  0x34,0x14,0x60,0x14,0xB1,0x15,0x09,0x15,0x4B,0x15,0x57,
-  0x15,0x63,0x15,0x6F,0x15,0x7B,0x15,0x87,0x15,0x93,0x15,
-  0xB7,0x16,0x1D,0x16,0x29,0x16,0x35,0x16,0x41,0x16,0x4D,
-  0x16,0x59,0x16,0x65,0x16,0x71,0x16,0x7D,0x16,0xBD,0x16,
-  0xC9,0x16,0xD5,0x16,0xE1,0x16,0xED,0x16,0xF9,0x17,0x05,
-  0x17,0x1F,0x17,0x6C,0x17,0x78,0x17,0x84,0x17,0x90,0x17,
-  0x9C,0x17,0xA8,0x17,0xD0,0x18,0x23,0x18,0x2E,0x18,0x39,
-  0x18,0x44,0x18,0x4F,0x18,0x5A,0x18,0x65,0x18,0xD2,0x19,
-  0x31,0x19,0x3C,0x19,0x47,0x19,0x52,0x19,0x5D,0x19,0x68,
-  0x19,0x73,0x19,0x7E,0x19,0x89,0x19,0xD5,0x19,0xE1,0x19,
-  0xED,0x19,0xF8,0x1A,0x04,0x1A,0x10,0x1A,0x1C,0x1A,0x34,
-  0x1A,0x75,0x1A,0x81,0x1A,0x8C,0x1A,0x98,0x1A,0xA4,0x1A,
-  0xAF,0x1A,0xE3,0x1A,0xEE,0x1A,0xFA,0x1B,0x05,0x1B,0x11,
-  0x1B,0x1C,0x1B,0x50,0x1B,0xB5,0x1B,0xC1,0x1B,0xCC,0x1B,
-  0xD8,0x1B,0xE4,0x1B,0xF0,0x1B,0xFC,0x1C,0x08,0x1C,0x13,
-  0x1C,0x1F,0x1C,0x2B,0x1C,0x6B,0x1C,0xA6,0x1C,0xB2,0x1C,
-  0xBD,0x1C,0xC9,0x1C,0xD4,0x1C,0xE0,0x1C,0xEB,0x1D,0x17,
-  0x1D,0x6B,0x1D,0x77,0x1D,0x82,0x1D,0x8E,0x1D,0x9A,0x1D,
-  0xA6,0x1D,0xB2,0x1D,0xBE,0x1D,0xCA,0x1D,0xD6,0x1D,0xE3,
-  0x1D,0xEF,0x1D,0xFB,0x1E,0x21,0x1E,0x4D,0x1E,0x59,0x1E,
-  0x64,0x1E,0x72,0x1E,0x7F,0x1E,0x8B,0x1E,0x96,0x1E,0xB8,
-  0x1E,0xE0,0x1E,0xEC,0x1E,0xF9,0x1F,0x05,0x1F,0x11,0x1F,
-  0x1D,0x1F,0x43,0x1F,0x4F,0x1F,0x5A,0x1F,0x62,0x1F,0x6E,
-  0x1F,0x7A,0x1F,0x86,0x1F,0x91,0x1F,0x9D,0x1F,0xA9,0x1F,
-  0xB5,0x1F,0xC1,0x1F,0xDB,0x1F,0xF3,0x1F,0xFF,0x20,0x0A,
-  0x20,0x16,0x20,0x22,0x20,0x2E,0x20,0x3A,0x20,0x5D,0x20,
-  0x74,0x20,0x97,0x20,0xA3,0x20,0xAF,0x20,0xBB,0x20,0xC7,
-  0x20,0xD3,0x20,0xDF,0x21,0x25,0x21,0x89,0x21,0x95,0x21,
-  0xA0,0x21,0xAC,0x21,0xB7,0x21,0xC3,0x21,0xCE,0x21,0xDA,
-  0x21,0xE5,0x21,0xF1,0x21,0xFC,0x22,0x76,0x22,0xED,0x22,
-  0xF9,0x23,0x04,0x23,0x10,0x23,0x1B,0x23,0x27,0x23,0x33,
-  0x23,0x45,0x23,0x68,0x23,0x74,0x23,0x80,0x23,0x8C,0x23,
-  0x98,0x23,0xA4,0x23,0xB0,0x23,0xBC,0x23,0xC8,0x23,0xD4,
-  0x23,0xE0,0x24,0x19,0x24,0x54,0x24,0x60,0x24,0x6C,0x24,
-  0x78,0x24,0x83,0x24,0x8F,0x24,0x9B,0x24,0xA6,0x24,0xB2,
-  0x24,0xBD,0x24,0xC9,0x24,0xD4,0x24,0xED,0x25,0x23,0x25,
-  0x2F,0x25,0x3A,0x25,0x46,0x25,0x51,0x25,0x62,0x25,0x73,
-  0x25,0x92,0x25,0x9E,0x25,0xD4,0x25,0xF4,0x26,0x1B,0x26,
-  0x2F,0x26,0x48,0x26,0x6C,0x26,0x94,0x26,0xB3,0x26,0xD2,
-  0x26,0xE6,0x27,0x1E,0x27,0x3E,0x27,0x85,0x27,0x8D,0x27,
-  0x95,0x27,0xA6,0x27,0xBA,0x27,0xC2,0x27,0xCA,0x27,0xD2,
-  0x28,0x1F,0x28,0x27,0x28,0x2F,0x28,0x4E,0x28,0x77,0x28,
-  0x8E,0x28,0xAA,0x28,0xDA,0x28,0xED,0x29,0x1E,0x29,0x3F,
-  0x29,0x51,0x29,0x6C,0x29,0xAD,0x29,0xEE,0x2A,0x2A,0x2A,
-  0x69,0x2A,0x82,0x2A,0xA9,0x2A,0xF3,0x2B,0x47,0x2B,0x8B,
-  0x2B,0xB4,0x2C,0x03,0x2C,0x36,0x2C,0x8A,0x2C,0xB5,0x2C,
-  0xFE,0x2D,0x45,0x2D,0x7E,0x2D,0xBB,0x2D,0xFD,0x2E,0x1F,
-  0x2E,0x36,0x2E,0x7D,0x2E,0xB6,0x2E,0xE1,0x2F,0x3C,0x2F,
-  0x7F,0x2F,0xA3,0x2F,0xDF,0x30,0x27,0x30,0x60,0x30,0x90,
-  0x30,0xCC,0x31,0x10,0x31,0x4F,0x31,0x83,0x31,0xD8,0x32,
-  0x07,0x32,0x4F,0x32,0x99,0x32,0xDB,0x33,0x4E,0x33,0x5A,
-  0x33,0x7D,0x33,0xB4,0x33,0xCA,0x34,0x07,0x34,0x5F,0x34,
-  0x67,0x34,0x73,0x34,0x7B,0x34,0xC3,0x34,0xFA,0x35,0x1D,
-  0x35,0x3D,0x35,0x58,0x35,0x83,0x35,0x99,0x35,0xA1,0x35,
-  0xCD,0x35,0xD5,0x35,0xE4,0x36,0x09,0x36,0x20,0x36,0x47,
-  0x36,0x92,0x36,0xA7,0x36,0xDA,0x36,0xF3,0x37,0x10,0x37,
-  0x2A,0x37,0x42,0x37,0x4A,0x37,0x5D,0x37,0x89,0x37,0x91,
-  0x37,0x99,0x37,0xAC,0x37,0xEC,0x37,0xF4,0x38,0x0B,0x38,
-  0x29,0x38,0x40,0x38,0x5C,0x38,0x8A,0x38,0xB9,0x38,0xE0,
-  0x39,0x1B,0x39,0x6A,0x39,0x97,0x39,0x9F,0x39,0xFC,0x3A,
-  0x43,0x3A,0x53,0x3A,0x77,0x3A,0x7F,0x3A,0x9E,0x3A,0xED,
-  0x3B,0x03,0x3B,0x32,0x3B,0x48,0x3B,0x67,0x3B,0x81,0x3B,
-  0x96,0x3B,0x9E,0x3B,0xB0,0x3B,0xE7,0x3B,0xEF,0x3C,0x01,
-  0x3C,0x09,0x3C,0x72,0x3C,0x7A,0x3C,0x8F,0x3C,0xAD,0x3C,
-  0xC4,0x3C,0xDF,0x3D,0x08,0x3D,0x37,0x3D,0x5E,0x3D,0x96,
-  0x3D,0xD0,0x3D,0xFE,0x3E,0x0A,0x3E,0x15,0x3E,0x51,0x3E,
-  0x68,0x3E,0xA7,0x3E,0xF6,0x3E,0xFE,0x3F,0x09,0x3F,0x11,
-  0x3F,0x58,0x3F,0x98,0x3F,0xC6,0x3F,0xE3,0x3F,0xFF,0x40,
-  0x0A,0x40,0x20,0x40,0x47,0x40,0x73,0x40,0x7B,0x40,0x83,
-  0x40,0x95,0x40,0xA7,0x40,0xB6,0x40,0xC6,0x40,0xD5,0x40,
-  0xE5,0x41,0x0C,0x41,0x2B,0x41,0x76,0x41,0xC5,0x41,0xDE,
-  0x41,0xF4,0x42,0x0D,0x42,0x23,0x42,0x3C,0x42,0x52,0x42,
-  0x6B,0x42,0x81,0x42,0x89,0x42,0x9E,0x42,0xA6,0x42,0xBB,
-  0x42,0xCE,0x42,0xE0,0x42,0xE8,0x42,0xF0,0x42,0xF8,0x43,
-  0x00,0x43,0x08,0x43,0x1A,0x43,0x22,0x43,0x34,0x43,0x3C,
-  0x43,0x4E,0x43,0x56,0x43,0x5E,0x43,0x75,0x43,0x8A,0x43,
-  0xA6,0x43,0xBC,0x43,0xD8,0x43,0xEE,0x44,0x0B,0x44,0x21,
-  0x44,0x29,0x44,0x31,0x44,0x39,0x44,0x41,0x44,0x49,0x44,
-  0x55,0x44,0x61,0x44,0x7A,0x44,0x90,0x44,0x98,0x44,0xAD,
-  0x44,0xC9,0x44,0xDF,0x44,0xEB,0x44,0xF6,0x45,0x02,0x45,
-  0x0D,0x45,0x31,0x45,0x9E,0x45,0xAA,0x45,0xB5,0x45,0xEF,
-  0x46,0x2E,0x46,0x3A,0x46,0x45,0x46,0x51,0x46,0x5D,0x46,
-  0x69,0x46,0x74,0x46,0xBF,0x47,0x0E,0x47,0x1A,0x47,0x26,
-  0x47,0x32,0x47,0x3E,0x47,0x4A,0x47,0x56,0x47,0x9F,0x47,
-  0xD6,0x47,0xE2,0x47,0xEE,0x47,0xFA,0x48,0x05,0x48,0x11,
-  0x48,0x1C,0x48,0x28,0x48,0x33,0x48,0x3F,0x48,0x4B,0x48,
-  0x57,0x48,0x62,0x48,0x6E,0x48,0x7A,0x48,0x8A,0x48,0xAB,
-  0x48,0xC1,0x48,0xDB,0x48,0xE6,0x48,0xF7,0x49,0x0E,0x49,
-  0x19,0x49,0x29,0x49,0x35,0x49,0x4C,0x49,0x58,0x49,0x64,
-  0x49,0x71,0x49,0x7D,0x49,0x8A,0x49,0x97,0x49,0xA3,0x49,
-  0xAB,0x49,0xB7,0x49,0xEE,0x4A,0x26,0x4A,0x5E,0x4A,0x70,
-  0x4A,0xAD,0x4A,0xB9,0x4A,0xCA,0x4B,0x02,0x4B,0x7A,0x4B,
-  0x87,0x4B,0xBB,0x4C,0x14,0x4C,0x4D,0x4C,0x71,0x4C,0xA2,
-  0x4C,0xAF,0x4C,0xD8,0x4D,0x53,0x4D,0x7E,0x4D,0xBC,0x4E,
-  0x28,0x4E,0x51,0x4E,0x7E,0x4E,0xB7,0x4E,0xEB,0x4F,0x35,
-  0x4F,0x8C,0x4F,0x9E,0x4F,0xB2,0x4F,0xC7,0x4F,0xD6,0x4F,
-  0xEE,0x50,0x0A,0x50,0x48,0x50,0x64,0x50,0xB2,0x50,0xBF,
-  0x50,0xFD,0x51,0x32,0x51,0x69,0x51,0xA3,0x51,0xE3,0x52,
-  0x47,0x52,0xB1,0x53,0x43,0x53,0x50,0x53,0x5D,0x53,0x76,
-  0x53,0x8F,0x53,0xA7,0x53,0xD2,0x53,0xFD,0x54,0x27,0x54,
-  0x3D,0x54,0x5A,0x54,0x76,0x54,0x8D,0x55,0x1F,0x55,0x2F,
-  0x55,0x40,0x55,0x4E,0x55,0x88,0x55,0xD4,0x55,0xFB,0x56,
-  0x50,0x56,0x65,0x56,0x9F,0x56,0xAC,0x56,0xC2,0x56,0xE2,
-  0x56,0xFB,0x57,0x12,0x57,0x2D,0x57,0x35,0x57,0x3D,0x57,
-  0x45,0x57,0x4D,0x57,0x55,0x57,0x5D,0x57,0x65,0x57,0x6D,
-  0x57,0x75,0x57,0x8A,0x57,0x92,0x57,0xBD,0x57,0xE2,0x57,
-  0xF5,0x58,0x23,0x58,0x3E,0x58,0x63,0x58,0x9E,0x58,0xB0,
-  0x58,0xF2,0x59,0x50,0x59,0x85,0x59,0xAB,0x59,0xE5,0x5A,
-  0x3D,0x5A,0x4E,0x5A,0x9E,0x5A,0xEE,0x5B,0x45,0x5B,0x9C,
-  0x5B,0xD9,0x5C,0x1A,0x5C,0x57,0x5C,0x95,0x5C,0xD3,0x5C,
-  0xEB,0x5D,0x2E,0x5D,0x41,0x5D,0x58,0x5D,0xD6,0x5D,0xE9,
-  0x5E,0x24,0x5E,0x83,0x5E,0xC2,0x5E,0xF8,0x5F,0x27,0x5F,
-  0xA7,0x5F,0xEB,0x60,0x5D,0x60,0x90,0x60,0xCF,0x61,0x09,
-  0x61,0x5A,0x61,0xB7,0x61,0xC9,0x62,0x07,0x62,0x66,0x62,
-  0xD8,0x62,0xFB,0x63,0x6B,0x00,0x01,0x00,0x00,0x02,0xF1,
-  0x00,0x6C,0x00,0x07,0x00,0x3A,0x00,0x05,0x00,0x02,0x00,
-  0x00,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x40,0x00,0x2E,
-  0x00,0x02,0x00,0x02,0x00,0x00,0x00,0x22,0x01,0x9E,0x00,
-  0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x5A,0x00,0x00,
-  0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x01,0x00,0x10,0x00,
-  0x5C,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x02,0x00,0x08,
-  0x00,0x6E,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x00,
-  0x4E,0x00,0x78,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x04,
-  0x00,0x1C,0x00,0xC8,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
-  0x05,0x00,0x32,0x00,0xE6,0x00,0x00,0x00,0x03,0x00,0x00,
-  0x00,0x06,0x00,0x18,0x01,0x1A,0x00,0x00,0x00,0x03,0x00,
-  0x00,0x00,0x0D,0x00,0x8C,0x01,0x34,0x00,0x00,0x00,0x03,
-  0x00,0x00,0x00,0x0E,0x00,0x48,0x01,0xC2,0x00,0x00,0x00,
-  0x03,0x00,0x00,0x00,0x13,0x00,0x58,0x02,0x0C,0x00,0x01,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2D,0x02,0x66,0x00,
-  0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x08,0x02,0x94,
-  0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x02,
-  0x9D,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x27,
-  0x02,0xA2,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x04,0x00,
-  0x0E,0x02,0xCA,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x05,
-  0x00,0x19,0x02,0xD9,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
-  0x06,0x00,0x0C,0x02,0xF3,0x00,0x01,0x00,0x00,0x00,0x00,
-  0x00,0x0D,0x00,0x46,0x03,0x00,0x00,0x01,0x00,0x00,0x00,
-  0x00,0x00,0x0E,0x00,0x24,0x03,0x47,0x00,0x01,0x00,0x00,
-  0x00,0x00,0x00,0x13,0x00,0x2C,0x03,0x6C,0x00,0x03,0x00,
-  0x01,0x04,0x09,0x00,0x00,0x00,0x5A,0x00,0x00,0x00,0x03,
-  0x00,0x01,0x04,0x09,0x00,0x01,0x00,0x10,0x00,0x5C,0x00,
-  0x03,0x00,0x01,0x04,0x09,0x00,0x02,0x00,0x08,0x00,0x6E,
-  0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x03,0x00,0x4E,0x00,
-  0x78,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x04,0x00,0x1C,
-  0x00,0xC8,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x05,0x00,
-  0x32,0x00,0xE6,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x06,
-  0x00,0x18,0x01,0x1A,0x00,0x03,0x00,0x01,0x04,0x09,0x00,
-  0x0D,0x00,0x8C,0x01,0x34,0x00,0x03,0x00,0x01,0x04,0x09,
-  0x00,0x0E,0x00,0x48,0x01,0xC2,0x00,0x03,0x00,0x01,0x04,
-  0x09,0x00,0x13,0x00,0x58,0x02,0x0C,0x00,0x03,0x00,0x01,
-  0x04,0x24,0x00,0x02,0x00,0x12,0x03,0x99,0x00,0x03,0x00,
-  0x01,0x04,0x24,0x00,0x0D,0x00,0x86,0x03,0xAD,0x00,0x03,
-  0x00,0x01,0x04,0x24,0x00,0x0E,0x00,0x48,0x04,0x35,0x00,
-  0x03,0x00,0x01,0x04,0x24,0x00,0x13,0x00,0x54,0x04,0x7F,
-  0x00,0x43,0x00,0x6F,0x00,0x70,0x00,0x79,0x00,0x6C,0x00,
-  0x65,0x00,0x66,0x00,0x74,0x00,0x20,0x00,0x32,0x00,0x30,
-  0x00,0x30,0x00,0x32,0x00,0x2C,0x00,0x20,0x00,0x32,0x00,
-  0x30,0x00,0x30,0x00,0x33,0x00,0x20,0x00,0x46,0x00,0x72,
-  0x00,0x65,0x00,0x65,0x00,0x20,0x00,0x53,0x00,0x6F,0x00,
-  0x66,0x00,0x74,0x00,0x77,0x00,0x61,0x00,0x72,0x00,0x65,
-  0x00,0x20,0x00,0x46,0x00,0x6F,0x00,0x75,0x00,0x6E,0x00,
-  0x64,0x00,0x61,0x00,0x74,0x00,0x69,0x00,0x6F,0x00,0x6E,
-  0x00,0x2E,0x00,0x00,0x00,0x46,0x00,0x72,0x00,0x65,0x00,
-  0x65,0x00,0x53,0x00,0x61,0x00,0x6E,0x00,0x73,0x00,0x00,
-  0x00,0x42,0x00,0x6F,0x00,0x6C,0x00,0x64,0x00,0x00,0x00,
-  0x50,0x00,0x66,0x00,0x61,0x00,0x45,0x00,0x64,0x00,0x69,
-  0x00,0x74,0x00,0x20,0x00,0x31,0x00,0x2E,0x00,0x30,0x00,
-  0x20,0x00,0x3A,0x00,0x20,0x00,0x46,0x00,0x72,0x00,0x65,
-  0x00,0x65,0x00,0x20,0x00,0x53,0x00,0x61,0x00,0x6E,0x00,
-  0x73,0x00,0x20,0x00,0x42,0x00,0x6F,0x00,0x6C,0x00,0x64,
-  0x00,0x20,0x00,0x3A,0x00,0x20,0x00,0x31,0x00,0x2D,0x00,
-  0x35,0x00,0x2D,0x00,0x32,0x00,0x30,0x00,0x30,0x00,0x33,
-  0x00,0x00,0x00,0x46,0x00,0x72,0x00,0x65,0x00,0x65,0x00,
-  0x20,0x00,0x53,0x00,0x61,0x00,0x6E,0x00,0x73,0x00,0x20,
-  0x00,0x42,0x00,0x6F,0x00,0x6C,0x00,0x64,0x00,0x00,0x00,
-  0x56,0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x69,0x00,0x6F,
-  0x00,0x6E,0x00,0x20,0x00,0x24,0x00,0x52,0x00,0x65,0x00,
-  0x76,0x00,0x69,0x00,0x73,0x00,0x69,0x00,0x6F,0x00,0x6E,
-  0x00,0x3A,0x00,0x20,0x00,0x31,0x00,0x2E,0x00,0x38,0x00,
-  0x20,0x00,0x24,0x00,0x20,0x00,0x00,0x00,0x46,0x00,0x72,
-  0x00,0x65,0x00,0x65,0x00,0x53,0x00,0x61,0x00,0x6E,0x00,
-  0x73,0x00,0x42,0x00,0x6F,0x00,0x6C,0x00,0x64,0x00,0x00,
-  0x00,0x54,0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x75,0x00,
-  0x73,0x00,0x65,0x00,0x20,0x00,0x6F,0x00,0x66,0x00,0x20,
-  0x00,0x74,0x00,0x68,0x00,0x69,0x00,0x73,0x00,0x20,0x00,
-  0x66,0x00,0x6F,0x00,0x6E,0x00,0x74,0x00,0x20,0x00,0x69,
-  0x00,0x73,0x00,0x20,0x00,0x67,0x00,0x72,0x00,0x61,0x00,
-  0x6E,0x00,0x74,0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x73,
-  0x00,0x75,0x00,0x62,0x00,0x6A,0x00,0x65,0x00,0x63,0x00,
-  0x74,0x00,0x20,0x00,0x74,0x00,0x6F,0x00,0x20,0x00,0x47,
-  0x00,0x4E,0x00,0x55,0x00,0x20,0x00,0x47,0x00,0x65,0x00,
-  0x6E,0x00,0x65,0x00,0x72,0x00,0x61,0x00,0x6C,0x00,0x20,
-  0x00,0x50,0x00,0x75,0x00,0x62,0x00,0x6C,0x00,0x69,0x00,
-  0x63,0x00,0x20,0x00,0x4C,0x00,0x69,0x00,0x63,0x00,0x65,
-  0x00,0x6E,0x00,0x73,0x00,0x65,0x00,0x2E,0x00,0x00,0x00,
-  0x68,0x00,0x74,0x00,0x74,0x00,0x70,0x00,0x3A,0x00,0x2F,
-  0x00,0x2F,0x00,0x77,0x00,0x77,0x00,0x77,0x00,0x2E,0x00,
-  0x67,0x00,0x6E,0x00,0x75,0x00,0x2E,0x00,0x6F,0x00,0x72,
-  0x00,0x67,0x00,0x2F,0x00,0x63,0x00,0x6F,0x00,0x70,0x00,
-  0x79,0x00,0x6C,0x00,0x65,0x00,0x66,0x00,0x74,0x00,0x2F,
-  0x00,0x67,0x00,0x70,0x00,0x6C,0x00,0x2E,0x00,0x68,0x00,
-  0x74,0x00,0x6D,0x00,0x6C,0x00,0x00,0x00,0x54,0x00,0x68,
-  0x00,0x65,0x00,0x20,0x00,0x71,0x00,0x75,0x00,0x69,0x00,
-  0x63,0x00,0x6B,0x00,0x20,0x00,0x62,0x00,0x72,0x00,0x6F,
-  0x00,0x77,0x00,0x6E,0x00,0x20,0x00,0x66,0x00,0x6F,0x00,
-  0x78,0x00,0x20,0x00,0x6A,0x00,0x75,0x00,0x6D,0x00,0x70,
-  0x00,0x73,0x00,0x20,0x00,0x6F,0x00,0x76,0x00,0x65,0x00,
-  0x72,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,0x00,0x20,
-  0x00,0x6C,0x00,0x61,0x00,0x7A,0x00,0x79,0x00,0x20,0x00,
-  0x64,0x00,0x6F,0x00,0x67,0x00,0x2E,0x00,0x00,0x43,0x6F,
-  0x70,0x79,0x6C,0x65,0x66,0x74,0x20,0x32,0x30,0x30,0x32,
-  0x2C,0x20,0x32,0x30,0x30,0x33,0x20,0x46,0x72,0x65,0x65,
-  0x20,0x53,0x6F,0x66,0x74,0x77,0x61,0x72,0x65,0x20,0x46,
-  0x6F,0x75,0x6E,0x64,0x61,0x74,0x69,0x6F,0x6E,0x2E,0x00,
-  0x46,0x72,0x65,0x65,0x53,0x61,0x6E,0x73,0x00,0x42,0x6F,
-  0x6C,0x64,0x00,0x50,0x66,0x61,0x45,0x64,0x69,0x74,0x20,
-  0x31,0x2E,0x30,0x20,0x3A,0x20,0x46,0x72,0x65,0x65,0x20,
-  0x53,0x61,0x6E,0x73,0x20,0x42,0x6F,0x6C,0x64,0x20,0x3A,
-  0x20,0x31,0x2D,0x35,0x2D,0x32,0x30,0x30,0x33,0x00,0x46,
-  0x72,0x65,0x65,0x20,0x53,0x61,0x6E,0x73,0x20,0x42,0x6F,
-  0x6C,0x64,0x00,0x56,0x65,0x72,0x73,0x69,0x6F,0x6E,0x20,
-  0x24,0x52,0x65,0x76,0x69,0x73,0x69,0x6F,0x6E,0x3A,0x20,
-  0x31,0x2E,0x31,0x20,0x24,0x20,0x00,0x46,0x72,0x65,0x65,
-  0x53,0x61,0x6E,0x73,0x42,0x6F,0x6C,0x64,0x00,0x54,0x68,
-  0x65,0x20,0x75,0x73,0x65,0x20,0x6F,0x66,0x20,0x74,0x68,
-  0x69,0x73,0x20,0x66,0x6F,0x6E,0x74,0x20,0x69,0x73,0x20,
-  0x67,0x72,0x61,0x6E,0x74,0x65,0x64,0x20,0x73,0x75,0x62,
-  0x6A,0x65,0x63,0x74,0x20,0x74,0x6F,0x20,0x47,0x4E,0x55,
-  0x20,0x47,0x65,0x6E,0x65,0x72,0x61,0x6C,0x20,0x50,0x75,
-  0x62,0x6C,0x69,0x63,0x20,0x4C,0x69,0x63,0x65,0x6E,0x73,
-  0x65,0x2E,0x00,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x77,
-  0x77,0x77,0x2E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
-  0x63,0x6F,0x70,0x79,0x6C,0x65,0x66,0x74,0x2F,0x67,0x70,
-  0x6C,0x2E,0x68,0x74,0x6D,0x6C,0x00,0x54,0x68,0x65,0x20,
-  0x71,0x75,0x69,0x63,0x6B,0x20,0x62,0x72,0x6F,0x77,0x6E,
-  0x20,0x66,0x6F,0x78,0x20,0x6A,0x75,0x6D,0x70,0x73,0x20,
-  0x6F,0x76,0x65,0x72,0x20,0x74,0x68,0x65,0x20,0x6C,0x61,
-  0x7A,0x79,0x20,0x64,0x6F,0x67,0x2E,0x00,0x00,0x70,0x00,
-  0x6F,0x00,0x6C,0x00,0x6B,0x00,0x72,0x00,0x65,0x00,0x70,
-  0x00,0x6B,0x00,0x6F,0x00,0x00,0x00,0x44,0x00,0x6F,0x00,
-  0x76,0x00,0x6F,0x00,0x6C,0x00,0x6A,0x00,0x65,0x00,0x6E,
-  0x00,0x61,0x00,0x20,0x00,0x6A,0x00,0x65,0x00,0x20,0x00,
-  0x75,0x00,0x70,0x00,0x6F,0x00,0x72,0x00,0x61,0x00,0x62,
-  0x00,0x61,0x00,0x20,0x00,0x76,0x00,0x20,0x00,0x73,0x00,
-  0x6B,0x00,0x6C,0x00,0x61,0x00,0x64,0x00,0x75,0x00,0x20,
-  0x00,0x7A,0x00,0x20,0x00,0x6C,0x00,0x69,0x00,0x63,0x00,
-  0x65,0x00,0x6E,0x00,0x63,0x00,0x6F,0x00,0x20,0x00,0x47,
-  0x00,0x4E,0x00,0x55,0x00,0x20,0x00,0x47,0x00,0x65,0x00,
-  0x6E,0x00,0x65,0x00,0x72,0x00,0x61,0x00,0x6C,0x00,0x20,
-  0x00,0x50,0x00,0x75,0x00,0x62,0x00,0x6C,0x00,0x69,0x00,
-  0x63,0x00,0x20,0x00,0x4C,0x00,0x69,0x00,0x63,0x00,0x65,
-  0x00,0x6E,0x00,0x73,0x00,0x65,0x00,0x2E,0x00,0x00,0x00,
-  0x68,0x00,0x74,0x00,0x74,0x00,0x70,0x00,0x3A,0x00,0x2F,
-  0x00,0x2F,0x00,0x77,0x00,0x77,0x00,0x77,0x00,0x2E,0x00,
-  0x67,0x00,0x6E,0x00,0x75,0x00,0x2E,0x00,0x6F,0x00,0x72,
-  0x00,0x67,0x00,0x2F,0x00,0x63,0x00,0x6F,0x00,0x70,0x00,
-  0x79,0x00,0x6C,0x00,0x65,0x00,0x66,0x00,0x74,0x00,0x2F,
-  0x00,0x67,0x00,0x70,0x00,0x6C,0x00,0x2E,0x00,0x68,0x00,
-  0x74,0x00,0x6D,0x00,0x6C,0x00,0x00,0x01,0x60,0x00,0x65,
-  0x00,0x72,0x00,0x69,0x00,0x66,0x00,0x20,0x00,0x62,0x00,
-  0x6F,0x00,0x20,0x00,0x7A,0x00,0x61,0x00,0x20,0x00,0x76,
-  0x00,0x61,0x00,0x6A,0x00,0x6F,0x00,0x20,0x00,0x73,0x00,
-  0x70,0x00,0x65,0x00,0x74,0x00,0x20,0x00,0x6B,0x00,0x75,
-  0x00,0x68,0x00,0x61,0x00,0x6C,0x00,0x20,0x00,0x64,0x00,
-  0x6F,0x00,0x6D,0x00,0x61,0x01,0x0D,0x00,0x65,0x00,0x20,
-  0x01,0x7E,0x00,0x67,0x00,0x61,0x00,0x6E,0x00,0x63,0x00,
-  0x65,0x00,0x2E,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
-  0x00,0x00,0x00,0xFF,0x65,0x00,0x45,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x02,0xF1,0x00,0x00,0x00,0x01,
-  0x00,0x02,0x00,0x03,0x00,0x04,0x00,0x05,0x00,0x06,0x00,
-  0x07,0x00,0x08,0x00,0x09,0x00,0x0A,0x00,0x0B,0x00,0x0C,
-  0x00,0x0D,0x00,0x0E,0x00,0x0F,0x00,0x10,0x00,0x11,0x00,
-  0x12,0x00,0x13,0x00,0x14,0x00,0x15,0x00,0x16,0x00,0x17,
-  0x00,0x18,0x00,0x19,0x00,0x1A,0x00,0x1B,0x00,0x1C,0x00,
-  0x1D,0x00,0x1E,0x00,0x1F,0x00,0x20,0x00,0x21,0x00,0x22,
-  0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x27,0x00,
-  0x28,0x00,0x29,0x00,0x2A,0x00,0x2B,0x00,0x2C,0x00,0x2D,
-  0x00,0x2E,0x00,0x2F,0x00,0x30,0x00,0x31,0x00,0x32,0x00,
-  0x33,0x00,0x34,0x00,0x35,0x00,0x36,0x00,0x37,0x00,0x38,
-  0x00,0x39,0x00,0x3A,0x00,0x3B,0x00,0x3C,0x00,0x3D,0x00,
-  0x3E,0x00,0x3F,0x00,0x40,0x00,0x41,0x00,0x42,0x00,0x43,
-  0x00,0x44,0x00,0x45,0x00,0x46,0x00,0x47,0x00,0x48,0x00,
-  0x49,0x00,0x4A,0x00,0x4B,0x00,0x4C,0x00,0x4D,0x00,0x4E,
-  0x00,0x4F,0x00,0x50,0x00,0x51,0x00,0x52,0x00,0x53,0x00,
-  0x54,0x00,0x55,0x00,0x56,0x00,0x57,0x00,0x58,0x00,0x59,
-  0x00,0x5A,0x00,0x5B,0x00,0x5C,0x00,0x5D,0x00,0x5E,0x00,
-  0x5F,0x00,0x60,0x00,0x61,0x00,0xA3,0x00,0x84,0x00,0x85,
-  0x00,0xBD,0x00,0x96,0x00,0xE8,0x00,0x86,0x00,0x8E,0x00,
-  0x8B,0x00,0x9D,0x00,0xA9,0x00,0xA4,0x00,0x8A,0x00,0xDA,
-  0x00,0x83,0x00,0x93,0x00,0xF2,0x00,0xF3,0x00,0x8D,0x00,
-  0x97,0x00,0x88,0x00,0xC3,0x00,0xDE,0x00,0xF1,0x00,0x9E,
-  0x00,0xAA,0x00,0xF5,0x00,0xF4,0x00,0xF6,0x00,0xA2,0x00,
-  0xAD,0x00,0xC9,0x00,0xC7,0x00,0xAE,0x00,0x62,0x00,0x63,
-  0x00,0x90,0x00,0x64,0x00,0xCB,0x00,0x65,0x00,0xC8,0x00,
-  0xCA,0x00,0xCF,0x00,0xCC,0x00,0xCD,0x00,0xCE,0x00,0xE9,
-  0x00,0x66,0x00,0xD3,0x00,0xD0,0x00,0xD1,0x00,0xAF,0x00,
-  0x67,0x00,0xF0,0x00,0x91,0x00,0xD6,0x00,0xD4,0x00,0xD5,
-  0x00,0x68,0x00,0xEB,0x00,0xED,0x00,0x89,0x00,0x6A,0x00,
-  0x69,0x00,0x6B,0x00,0x6D,0x00,0x6C,0x00,0x6E,0x00,0xA0,
-  0x00,0x6F,0x00,0x71,0x00,0x70,0x00,0x72,0x00,0x73,0x00,
-  0x75,0x00,0x74,0x00,0x76,0x00,0x77,0x00,0xEA,0x00,0x78,
-  0x00,0x7A,0x00,0x79,0x00,0x7B,0x00,0x7D,0x00,0x7C,0x00,
-  0xB8,0x00,0xA1,0x00,0x7F,0x00,0x7E,0x00,0x80,0x00,0x81,
-  0x00,0xEC,0x00,0xEE,0x00,0xBA,0x01,0x02,0x01,0x03,0x01,
-  0x04,0x01,0x05,0x01,0x06,0x01,0x07,0x00,0xFD,0x00,0xFE,
-  0x01,0x08,0x01,0x09,0x01,0x0A,0x01,0x0B,0x00,0xFF,0x01,
-  0x00,0x01,0x0C,0x01,0x0D,0x01,0x0E,0x01,0x01,0x01,0x0F,
-  0x01,0x10,0x01,0x11,0x01,0x12,0x01,0x13,0x01,0x14,0x01,
-  0x15,0x01,0x16,0x01,0x17,0x01,0x18,0x01,0x19,0x01,0x1A,
-  0x00,0xF8,0x00,0xF9,0x01,0x1B,0x01,0x1C,0x01,0x1D,0x01,
-  0x1E,0x01,0x1F,0x01,0x20,0x01,0x21,0x01,0x22,0x01,0x23,
-  0x01,0x24,0x01,0x25,0x01,0x26,0x01,0x27,0x01,0x28,0x01,
-  0x29,0x01,0x2A,0x00,0xFA,0x00,0xD7,0x01,0x2B,0x01,0x2C,
-  0x01,0x2D,0x01,0x2E,0x01,0x2F,0x01,0x30,0x01,0x31,0x01,
-  0x32,0x01,0x33,0x01,0x34,0x01,0x35,0x01,0x36,0x01,0x37,
-  0x01,0x38,0x01,0x39,0x00,0xE2,0x00,0xE3,0x01,0x3A,0x01,
-  0x3B,0x01,0x3C,0x01,0x3D,0x01,0x3E,0x01,0x3F,0x01,0x40,
-  0x01,0x41,0x01,0x42,0x01,0x43,0x01,0x44,0x01,0x45,0x01,
-  0x46,0x01,0x47,0x01,0x48,0x00,0xB0,0x00,0xB1,0x01,0x49,
-  0x01,0x4A,0x01,0x4B,0x01,0x4C,0x01,0x4D,0x01,0x4E,0x01,
-  0x4F,0x01,0x50,0x01,0x51,0x01,0x52,0x00,0xFB,0x00,0xFC,
-  0x00,0xE4,0x00,0xE5,0x01,0x53,0x01,0x54,0x01,0x55,0x01,
-  0x56,0x01,0x57,0x01,0x58,0x01,0x59,0x01,0x5A,0x01,0x5B,
-  0x01,0x5C,0x01,0x5D,0x01,0x5E,0x01,0x5F,0x01,0x60,0x01,
-  0x61,0x01,0x62,0x01,0x63,0x01,0x64,0x01,0x65,0x01,0x66,
-  0x01,0x67,0x01,0x68,0x00,0xBB,0x01,0x69,0x01,0x6A,0x01,
-  0x6B,0x01,0x6C,0x00,0xE6,0x00,0xE7,0x01,0x6D,0x00,0xA6,
-  0x01,0x6E,0x01,0x6F,0x01,0x70,0x01,0x71,0x00,0xD8,0x00,
-  0xE1,0x00,0xDB,0x00,0xDC,0x00,0xDD,0x00,0xE0,0x00,0xD9,
-  0x00,0xDF,0x01,0x72,0x01,0x73,0x01,0x74,0x01,0x75,0x01,
-  0x76,0x01,0x77,0x01,0x78,0x01,0x79,0x01,0x7A,0x01,0x7B,
-  0x01,0x7C,0x01,0x7D,0x00,0xA8,0x01,0x7E,0x01,0x7F,0x01,
-  0x80,0x01,0x81,0x01,0x82,0x01,0x83,0x01,0x84,0x01,0x85,
-  0x01,0x86,0x01,0x87,0x01,0x88,0x01,0x89,0x01,0x8A,0x01,
-  0x8B,0x01,0x8C,0x01,0x8D,0x01,0x8E,0x01,0x8F,0x01,0x90,
-  0x00,0x9F,0x01,0x91,0x01,0x92,0x01,0x93,0x01,0x94,0x01,
-  0x95,0x01,0x96,0x01,0x97,0x01,0x98,0x01,0x99,0x01,0x9A,
-  0x01,0x9B,0x01,0x9C,0x01,0x9D,0x01,0x9E,0x01,0x9F,0x01,
-  0xA0,0x01,0xA1,0x01,0xA2,0x01,0xA3,0x01,0xA4,0x01,0xA5,
-  0x01,0xA6,0x00,0x9B,0x01,0xA7,0x01,0xA8,0x01,0xA9,0x01,
-  0xAA,0x01,0xAB,0x01,0xAC,0x01,0xAD,0x01,0xAE,0x01,0xAF,
-  0x01,0xB0,0x01,0xB1,0x01,0xB2,0x01,0xB3,0x01,0xB4,0x01,
-  0xB5,0x01,0xB6,0x01,0xB7,0x01,0xB8,0x01,0xB9,0x01,0xBA,
-  0x01,0xBB,0x01,0xBC,0x01,0xBD,0x01,0xBE,0x01,0xBF,0x01,
-  0xC0,0x01,0xC1,0x01,0xC2,0x01,0xC3,0x01,0xC4,0x01,0xC5,
-  0x01,0xC6,0x01,0xC7,0x01,0xC8,0x01,0xC9,0x01,0xCA,0x01,
-  0xCB,0x01,0xCC,0x01,0xCD,0x01,0xCE,0x01,0xCF,0x01,0xD0,
-  0x01,0xD1,0x01,0xD2,0x01,0xD3,0x01,0xD4,0x01,0xD5,0x01,
-  0xD6,0x01,0xD7,0x01,0xD8,0x01,0xD9,0x01,0xDA,0x01,0xDB,
-  0x01,0xDC,0x01,0xDD,0x01,0xDE,0x01,0xDF,0x01,0xE0,0x01,
-  0xE1,0x01,0xE2,0x01,0xE3,0x01,0xE4,0x01,0xE5,0x01,0xE6,
-  0x01,0xE7,0x01,0xE8,0x01,0xE9,0x01,0xEA,0x01,0xEB,0x01,
-  0xEC,0x01,0xED,0x01,0xEE,0x01,0xEF,0x01,0xF0,0x01,0xF1,
-  0x01,0xF2,0x01,0xF3,0x01,0xF4,0x01,0xF5,0x01,0xF6,0x01,
-  0xF7,0x01,0xF8,0x01,0xF9,0x01,0xFA,0x01,0xFB,0x01,0xFC,
-  0x01,0xFD,0x01,0xFE,0x01,0xFF,0x02,0x00,0x02,0x01,0x02,
-  0x02,0x02,0x03,0x02,0x04,0x02,0x05,0x02,0x06,0x02,0x07,
-  0x02,0x08,0x02,0x09,0x02,0x0A,0x02,0x0B,0x02,0x0C,0x02,
-  0x0D,0x02,0x0E,0x02,0x0F,0x02,0x10,0x02,0x11,0x02,0x12,
-  0x02,0x13,0x02,0x14,0x02,0x15,0x02,0x16,0x02,0x17,0x02,
-  0x18,0x02,0x19,0x02,0x1A,0x02,0x1B,0x02,0x1C,0x02,0x1D,
-  0x02,0x1E,0x02,0x1F,0x02,0x20,0x02,0x21,0x02,0x22,0x02,
-  0x23,0x02,0x24,0x02,0x25,0x02,0x26,0x02,0x27,0x02,0x28,
-  0x02,0x29,0x02,0x2A,0x02,0x2B,0x02,0x2C,0x02,0x2D,0x02,
-  0x2E,0x02,0x2F,0x02,0x30,0x02,0x31,0x02,0x32,0x02,0x33,
-  0x02,0x34,0x02,0x35,0x02,0x36,0x02,0x37,0x02,0x38,0x02,
-  0x39,0x02,0x3A,0x02,0x3B,0x02,0x3C,0x02,0x3D,0x02,0x3E,
-  0x02,0x3F,0x02,0x40,0x02,0x41,0x02,0x42,0x02,0x43,0x02,
-  0x44,0x02,0x45,0x02,0x46,0x02,0x47,0x02,0x48,0x02,0x49,
-  0x02,0x4A,0x02,0x4B,0x02,0x4C,0x02,0x4D,0x02,0x4E,0x02,
-  0x4F,0x02,0x50,0x02,0x51,0x02,0x52,0x02,0x53,0x02,0x54,
-  0x02,0x55,0x02,0x56,0x02,0x57,0x02,0x58,0x02,0x59,0x02,
-  0x5A,0x02,0x5B,0x02,0x5C,0x02,0x5D,0x02,0x5E,0x02,0x5F,
-  0x02,0x60,0x02,0x61,0x02,0x62,0x02,0x63,0x02,0x64,0x02,
-  0x65,0x02,0x66,0x02,0x67,0x02,0x68,0x02,0x69,0x02,0x6A,
-  0x02,0x6B,0x02,0x6C,0x02,0x6D,0x02,0x6E,0x02,0x6F,0x02,
-  0x70,0x02,0x71,0x02,0x72,0x02,0x73,0x02,0x74,0x02,0x75,
-  0x02,0x76,0x02,0x77,0x02,0x78,0x02,0x79,0x02,0x7A,0x02,
-  0x7B,0x02,0x7C,0x02,0x7D,0x02,0x7E,0x02,0x7F,0x02,0x80,
-  0x02,0x81,0x02,0x82,0x02,0x83,0x02,0x84,0x02,0x85,0x02,
-  0x86,0x02,0x87,0x02,0x88,0x02,0x89,0x02,0x8A,0x02,0x8B,
-  0x02,0x8C,0x02,0x8D,0x02,0x8E,0x02,0x8F,0x02,0x90,0x02,
-  0x91,0x02,0x92,0x02,0x93,0x02,0x94,0x02,0x95,0x02,0x96,
-  0x02,0x97,0x02,0x98,0x02,0x99,0x02,0x9A,0x02,0x9B,0x02,
-  0x9C,0x02,0x9D,0x02,0x9E,0x02,0x9F,0x02,0xA0,0x02,0xA1,
-  0x02,0xA2,0x02,0xA3,0x02,0xA4,0x02,0xA5,0x02,0xA6,0x02,
-  0xA7,0x02,0xA8,0x02,0xA9,0x02,0xAA,0x02,0xAB,0x02,0xAC,
-  0x02,0xAD,0x02,0xAE,0x02,0xAF,0x02,0xB0,0x02,0xB1,0x02,
-  0xB2,0x02,0xB3,0x02,0xB4,0x02,0xB5,0x02,0xB6,0x02,0xB7,
-  0x02,0xB8,0x02,0xB9,0x02,0xBA,0x00,0xB2,0x00,0xB3,0x00,
-  0xB6,0x00,0xB7,0x00,0xC4,0x00,0xB4,0x00,0xB5,0x00,0xC5,
-  0x00,0x82,0x00,0xC2,0x00,0x87,0x00,0xAB,0x00,0xC6,0x00,
-  0xBE,0x00,0xBF,0x00,0xBC,0x02,0xBB,0x02,0xBC,0x00,0x8C,
-  0x00,0x98,0x00,0xA8,0x00,0x99,0x00,0xEF,0x00,0xA5,0x00,
-  0x8F,0x00,0x94,0x00,0x95,0x00,0xB9,0x02,0xBD,0x02,0xBE,
-  0x02,0xBF,0x02,0xC0,0x02,0xC1,0x02,0xC2,0x02,0xC3,0x02,
-  0xC4,0x02,0xC5,0x02,0xC6,0x02,0xC7,0x00,0xC0,0x00,0xC1,
-  0x02,0xC8,0x02,0xC9,0x02,0xCA,0x02,0xCB,0x02,0xCC,0x02,
-  0xCD,0x02,0xCE,0x02,0xCF,0x02,0xD0,0x02,0xD1,0x02,0xD2,
-  0x02,0xD3,0x02,0xD4,0x02,0xD5,0x02,0xD6,0x02,0xD7,0x02,
-  0xD8,0x02,0xD9,0x02,0xDA,0x02,0xDB,0x02,0xDC,0x02,0xDD,
-  0x02,0xDE,0x02,0xDF,0x02,0xE0,0x02,0xE1,0x02,0xE2,0x02,
-  0xE3,0x02,0xE4,0x02,0xE5,0x02,0xE6,0x02,0xE7,0x02,0xE8,
-  0x02,0xE9,0x02,0xEA,0x02,0xEB,0x02,0xEC,0x02,0xED,0x02,
-  0xEE,0x02,0xEF,0x02,0xF0,0x02,0xF1,0x02,0xF2,0x02,0xF3,
-  0x02,0xF4,0x02,0xF5,0x02,0xF6,0x07,0x41,0x6D,0x61,0x63,
-  0x72,0x6F,0x6E,0x07,0x61,0x6D,0x61,0x63,0x72,0x6F,0x6E,
-  0x06,0x41,0x62,0x72,0x65,0x76,0x65,0x06,0x61,0x62,0x72,
-  0x65,0x76,0x65,0x07,0x41,0x6F,0x67,0x6F,0x6E,0x65,0x6B,
-  0x07,0x61,0x6F,0x67,0x6F,0x6E,0x65,0x6B,0x0B,0x43,0x63,
-  0x69,0x72,0x63,0x75,0x6D,0x66,0x6C,0x65,0x78,0x0B,0x63,
-  0x63,0x69,0x72,0x63,0x75,0x6D,0x66,0x6C,0x65,0x78,0x0A,
-  0x43,0x64,0x6F,0x74,0x61,0x63,0x63,0x65,0x6E,0x74,0x0A,
-  0x63,0x64,0x6F,0x74,0x61,0x63,0x63,0x65,0x6E,0x74,0x06,
-  0x44,0x63,0x61,0x72,0x6F,0x6E,0x06,0x64,0x63,0x61,0x72,
-  0x6F,0x6E,0x06,0x44,0x63,0x72,0x6F,0x61,0x74,0x07,0x45,
-  0x6D,0x61,0x63,0x72,0x6F,0x6E,0x07,0x65,0x6D,0x61,0x63,
-  0x72,0x6F,0x6E,0x06,0x45,0x62,0x72,0x65,0x76,0x65,0x06,
-  0x65,0x62,0x72,0x65,0x76,0x65,0x0A,0x45,0x64,0x6F,0x74,
-  0x61,0x63,0x63,0x65,0x6E,0x74,0x0A,0x65,0x64,0x6F,0x74,
-  0x61,0x63,0x63,0x65,0x6E,0x74,0x07,0x45,0x6F,0x67,0x6F,
-  0x6E,0x65,0x6B,0x07,0x65,0x6F,0x67,0x6F,0x6E,0x65,0x6B,
-  0x06,0x45,0x63,0x61,0x72,0x6F,0x6E,0x06,0x65,0x63,0x61,
-  0x72,0x6F,0x6E,0x0B,0x47,0x63,0x69,0x72,0x63,0x75,0x6D,
-  0x66,0x6C,0x65,0x78,0x0B,0x67,0x63,0x69,0x72,0x63,0x75,
-  0x6D,0x66,0x6C,0x65,0x78,0x0A,0x47,0x64,0x6F,0x74,0x61,
-  0x63,0x63,0x65,0x6E,0x74,0x0A,0x67,0x64,0x6F,0x74,0x61,
-  0x63,0x63,0x65,0x6E,0x74,0x0C,0x47,0x63,0x6F,0x6D,0x6D,
-  0x61,0x61,0x63,0x63,0x65,0x6E,0x74,0x0C,0x67,0x63,0x6F,
-  0x6D,0x6D,0x61,0x61,0x63,0x63,0x65,0x6E,0x74,0x0B,0x48,
-  0x63,0x69,0x72,0x63,0x75,0x6D,0x66,0x6C,0x65,0x78,0x0B,
-  0x68,0x63,0x69,0x72,0x63,0x75,0x6D,0x66,0x6C,0x65,0x78,
-  0x04,0x48,0x62,0x61,0x72,0x04,0x68,0x62,0x61,0x72,0x06,
-  0x49,0x74,0x69,0x6C,0x64,0x65,0x06,0x69,0x74,0x69,0x6C,
-  0x64,0x65,0x07,0x49,0x6D,0x61,0x63,0x72,0x6F,0x6E,0x07,
-  0x69,0x6D,0x61,0x63,0x72,0x6F,0x6E,0x06,0x49,0x62,0x72,
-  0x65,0x76,0x65,0x06,0x69,0x62,0x72,0x65,0x76,0x65,0x07,
-  0x49,0x6F,0x67,0x6F,0x6E,0x65,0x6B,0x07,0x69,0x6F,0x67,
-  0x6F,0x6E,0x65,0x6B,0x02,0x49,0x4A,0x02,0x69,0x6A,0x0B,
-  0x4A,0x63,0x69,0x72,0x63,0x75,0x6D,0x66,0x6C,0x65,0x78,
-  0x0B,0x6A,0x63,0x69,0x72,0x63,0x75,0x6D,0x66,0x6C,0x65,
-  0x78,0x0C,0x4B,0x63,0x6F,0x6D,0x6D,0x61,0x61,0x63,0x63,
-  0x65,0x6E,0x74,0x0C,0x6B,0x63,0x6F,0x6D,0x6D,0x61,0x61,
-  0x63,0x63,0x65,0x6E,0x74,0x0C,0x6B,0x67,0x72,0x65,0x65,
-  0x6E,0x6C,0x61,0x6E,0x64,0x69,0x63,0x06,0x4C,0x61,0x63,
-  0x75,0x74,0x65,0x06,0x6C,0x61,0x63,0x75,0x74,0x65,0x0C,
-  0x4C,0x63,0x6F,0x6D,0x6D,0x61,0x61,0x63,0x63,0x65,0x6E,
-  0x74,0x0C,0x6C,0x63,0x6F,0x6D,0x6D,0x61,0x61,0x63,0x63,
-  0x65,0x6E,0x74,0x06,0x4C,0x63,0x61,0x72,0x6F,0x6E,0x06,
-  0x6C,0x63,0x61,0x72,0x6F,0x6E,0x04,0x4C,0x64,0x6F,0x74,
-  0x04,0x6C,0x64,0x6F,0x74,0x06,0x4E,0x61,0x63,0x75,0x74,
-  0x65,0x06,0x6E,0x61,0x63,0x75,0x74,0x65,0x0C,0x4E,0x63,
-  0x6F,0x6D,0x6D,0x61,0x61,0x63,0x63,0x65,0x6E,0x74,0x0C,
-  0x6E,0x63,0x6F,0x6D,0x6D,0x61,0x61,0x63,0x63,0x65,0x6E,
-  0x74,0x06,0x4E,0x63,0x61,0x72,0x6F,0x6E,0x06,0x6E,0x63,
-  0x61,0x72,0x6F,0x6E,0x0B,0x6E,0x61,0x70,0x6F,0x73,0x74,
-  0x72,0x6F,0x70,0x68,0x65,0x03,0x45,0x6E,0x67,0x03,0x65,
-  0x6E,0x67,0x07,0x4F,0x6D,0x61,0x63,0x72,0x6F,0x6E,0x07,
-  0x6F,0x6D,0x61,0x63,0x72,0x6F,0x6E,0x06,0x4F,0x62,0x72,
-  0x65,0x76,0x65,0x06,0x6F,0x62,0x72,0x65,0x76,0x65,0x0D,
-  0x4F,0x68,0x75,0x6E,0x67,0x61,0x72,0x75,0x6D,0x6C,0x61,
-  0x75,0x74,0x0D,0x6F,0x68,0x75,0x6E,0x67,0x61,0x72,0x75,
-  0x6D,0x6C,0x61,0x75,0x74,0x06,0x52,0x61,0x63,0x75,0x74,
-  0x65,0x06,0x72,0x61,0x63,0x75,0x74,0x65,0x0C,0x52,0x63,
-  0x6F,0x6D,0x6D,0x61,0x61,0x63,0x63,0x65,0x6E,0x74,0x0C,
-  0x72,0x63,0x6F,0x6D,0x6D,0x61,0x61,0x63,0x63,0x65,0x6E,
-  0x74,0x06,0x52,0x63,0x61,0x72,0x6F,0x6E,0x06,0x72,0x63,
-  0x61,0x72,0x6F,0x6E,0x06,0x53,0x61,0x63,0x75,0x74,0x65,
-  0x06,0x73,0x61,0x63,0x75,0x74,0x65,0x0B,0x53,0x63,0x69,
-  0x72,0x63,0x75,0x6D,0x66,0x6C,0x65,0x78,0x0B,0x73,0x63,
-  0x69,0x72,0x63,0x75,0x6D,0x66,0x6C,0x65,0x78,0x07,0x75,
-  0x6E,0x69,0x30,0x31,0x36,0x32,0x07,0x75,0x6E,0x69,0x30,
-  0x31,0x36,0x33,0x06,0x54,0x63,0x61,0x72,0x6F,0x6E,0x06,
-  0x74,0x63,0x61,0x72,0x6F,0x6E,0x04,0x54,0x62,0x61,0x72,
-  0x04,0x74,0x62,0x61,0x72,0x06,0x55,0x74,0x69,0x6C,0x64,
-  0x65,0x06,0x75,0x74,0x69,0x6C,0x64,0x65,0x07,0x55,0x6D,
-  0x61,0x63,0x72,0x6F,0x6E,0x07,0x75,0x6D,0x61,0x63,0x72,
-  0x6F,0x6E,0x06,0x55,0x62,0x72,0x65,0x76,0x65,0x06,0x75,
-  0x62,0x72,0x65,0x76,0x65,0x05,0x55,0x72,0x69,0x6E,0x67,
-  0x05,0x75,0x72,0x69,0x6E,0x67,0x0D,0x55,0x68,0x75,0x6E,
-  0x67,0x61,0x72,0x75,0x6D,0x6C,0x61,0x75,0x74,0x0D,0x75,
-  0x68,0x75,0x6E,0x67,0x61,0x72,0x75,0x6D,0x6C,0x61,0x75,
-  0x74,0x07,0x55,0x6F,0x67,0x6F,0x6E,0x65,0x6B,0x07,0x75,
-  0x6F,0x67,0x6F,0x6E,0x65,0x6B,0x0B,0x57,0x63,0x69,0x72,
-  0x63,0x75,0x6D,0x66,0x6C,0x65,0x78,0x0B,0x77,0x63,0x69,
-  0x72,0x63,0x75,0x6D,0x66,0x6C,0x65,0x78,0x0B,0x59,0x63,
-  0x69,0x72,0x63,0x75,0x6D,0x66,0x6C,0x65,0x78,0x0B,0x79,
-  0x63,0x69,0x72,0x63,0x75,0x6D,0x66,0x6C,0x65,0x78,0x06,
-  0x5A,0x61,0x63,0x75,0x74,0x65,0x06,0x7A,0x61,0x63,0x75,
-  0x74,0x65,0x0A,0x5A,0x64,0x6F,0x74,0x61,0x63,0x63,0x65,
-  0x6E,0x74,0x0A,0x7A,0x64,0x6F,0x74,0x61,0x63,0x63,0x65,
-  0x6E,0x74,0x05,0x6C,0x6F,0x6E,0x67,0x73,0x0C,0x53,0x63,
-  0x6F,0x6D,0x6D,0x61,0x61,0x63,0x63,0x65,0x6E,0x74,0x0C,
-  0x73,0x63,0x6F,0x6D,0x6D,0x61,0x61,0x63,0x63,0x65,0x6E,
-  0x74,0x0C,0x54,0x63,0x6F,0x6D,0x6D,0x61,0x61,0x63,0x63,
-  0x65,0x6E,0x74,0x0C,0x74,0x63,0x6F,0x6D,0x6D,0x61,0x61,
-  0x63,0x63,0x65,0x6E,0x74,0x0D,0x64,0x69,0x65,0x72,0x65,
-  0x73,0x69,0x73,0x74,0x6F,0x6E,0x6F,0x73,0x0A,0x41,0x6C,
-  0x70,0x68,0x61,0x74,0x6F,0x6E,0x6F,0x73,0x09,0x61,0x6E,
-  0x6F,0x74,0x65,0x6C,0x65,0x69,0x61,0x0C,0x45,0x70,0x73,
-  0x69,0x6C,0x6F,0x6E,0x74,0x6F,0x6E,0x6F,0x73,0x08,0x45,
-  0x74,0x61,0x74,0x6F,0x6E,0x6F,0x73,0x09,0x49,0x6F,0x74,
-  0x61,0x74,0x6F,0x6E,0x6F,0x73,0x0C,0x4F,0x6D,0x69,0x63,
-  0x72,0x6F,0x6E,0x74,0x6F,0x6E,0x6F,0x73,0x0C,0x55,0x70,
-  0x73,0x69,0x6C,0x6F,0x6E,0x74,0x6F,0x6E,0x6F,0x73,0x0A,
-  0x4F,0x6D,0x65,0x67,0x61,0x74,0x6F,0x6E,0x6F,0x73,0x05,
-  0x41,0x6C,0x70,0x68,0x61,0x04,0x42,0x65,0x74,0x61,0x05,
-  0x47,0x61,0x6D,0x6D,0x61,0x07,0x45,0x70,0x73,0x69,0x6C,
-  0x6F,0x6E,0x04,0x5A,0x65,0x74,0x61,0x03,0x45,0x74,0x61,
-  0x05,0x54,0x68,0x65,0x74,0x61,0x04,0x49,0x6F,0x74,0x61,
-  0x05,0x4B,0x61,0x70,0x70,0x61,0x06,0x4C,0x61,0x6D,0x62,
-  0x64,0x61,0x02,0x4D,0x75,0x02,0x4E,0x75,0x02,0x58,0x69,
-  0x07,0x4F,0x6D,0x69,0x63,0x72,0x6F,0x6E,0x02,0x50,0x69,
-  0x03,0x52,0x68,0x6F,0x05,0x53,0x69,0x67,0x6D,0x61,0x03,
-  0x54,0x61,0x75,0x07,0x55,0x70,0x73,0x69,0x6C,0x6F,0x6E,
-  0x03,0x50,0x68,0x69,0x03,0x43,0x68,0x69,0x03,0x50,0x73,
-  0x69,0x0C,0x49,0x6F,0x74,0x61,0x64,0x69,0x65,0x72,0x65,
-  0x73,0x69,0x73,0x0F,0x55,0x70,0x73,0x69,0x6C,0x6F,0x6E,
-  0x64,0x69,0x65,0x72,0x65,0x73,0x69,0x73,0x0A,0x61,0x6C,
-  0x70,0x68,0x61,0x74,0x6F,0x6E,0x6F,0x73,0x0C,0x65,0x70,
-  0x73,0x69,0x6C,0x6F,0x6E,0x74,0x6F,0x6E,0x6F,0x73,0x08,
-  0x65,0x74,0x61,0x74,0x6F,0x6E,0x6F,0x73,0x09,0x69,0x6F,
-  0x74,0x61,0x74,0x6F,0x6E,0x6F,0x73,0x14,0x75,0x70,0x73,
-  0x69,0x6C,0x6F,0x6E,0x64,0x69,0x65,0x72,0x65,0x73,0x69,
-  0x73,0x74,0x6F,0x6E,0x6F,0x73,0x05,0x61,0x6C,0x70,0x68,
-  0x61,0x04,0x62,0x65,0x74,0x61,0x05,0x67,0x61,0x6D,0x6D,
-  0x61,0x05,0x64,0x65,0x6C,0x74,0x61,0x07,0x65,0x70,0x73,
-  0x69,0x6C,0x6F,0x6E,0x04,0x7A,0x65,0x74,0x61,0x03,0x65,
-  0x74,0x61,0x05,0x74,0x68,0x65,0x74,0x61,0x04,0x69,0x6F,
-  0x74,0x61,0x05,0x6B,0x61,0x70,0x70,0x61,0x06,0x6C,0x61,
-  0x6D,0x62,0x64,0x61,0x07,0x75,0x6E,0x69,0x30,0x33,0x42,
-  0x43,0x02,0x6E,0x75,0x02,0x78,0x69,0x07,0x6F,0x6D,0x69,
-  0x63,0x72,0x6F,0x6E,0x03,0x72,0x68,0x6F,0x06,0x73,0x69,
-  0x67,0x6D,0x61,0x31,0x05,0x73,0x69,0x67,0x6D,0x61,0x03,
-  0x74,0x61,0x75,0x07,0x75,0x70,0x73,0x69,0x6C,0x6F,0x6E,
-  0x03,0x70,0x68,0x69,0x03,0x63,0x68,0x69,0x03,0x70,0x73,
-  0x69,0x05,0x6F,0x6D,0x65,0x67,0x61,0x0C,0x69,0x6F,0x74,
-  0x61,0x64,0x69,0x65,0x72,0x65,0x73,0x69,0x73,0x0F,0x75,
-  0x70,0x73,0x69,0x6C,0x6F,0x6E,0x64,0x69,0x65,0x72,0x65,
-  0x73,0x69,0x73,0x0C,0x6F,0x6D,0x69,0x63,0x72,0x6F,0x6E,
-  0x74,0x6F,0x6E,0x6F,0x73,0x0C,0x75,0x70,0x73,0x69,0x6C,
-  0x6F,0x6E,0x74,0x6F,0x6E,0x6F,0x73,0x0A,0x6F,0x6D,0x65,
-  0x67,0x61,0x74,0x6F,0x6E,0x6F,0x73,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x30,0x30,0x09,0x61,0x66,0x69,0x69,0x31,0x30,
-  0x30,0x32,0x33,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,
-  0x35,0x31,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x35,
-  0x32,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x35,0x33,
-  0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x35,0x34,0x09,
-  0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x35,0x35,0x09,0x61,
-  0x66,0x69,0x69,0x31,0x30,0x30,0x35,0x36,0x09,0x61,0x66,
-  0x69,0x69,0x31,0x30,0x30,0x35,0x37,0x09,0x61,0x66,0x69,
-  0x69,0x31,0x30,0x30,0x35,0x38,0x09,0x61,0x66,0x69,0x69,
-  0x31,0x30,0x30,0x35,0x39,0x09,0x61,0x66,0x69,0x69,0x31,
-  0x30,0x30,0x36,0x30,0x09,0x61,0x66,0x69,0x69,0x31,0x30,
-  0x30,0x36,0x31,0x07,0x75,0x6E,0x69,0x30,0x34,0x30,0x44,
-  0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x36,0x32,0x09,
-  0x61,0x66,0x69,0x69,0x31,0x30,0x31,0x34,0x35,0x09,0x61,
-  0x66,0x69,0x69,0x31,0x30,0x30,0x31,0x37,0x09,0x61,0x66,
-  0x69,0x69,0x31,0x30,0x30,0x31,0x38,0x09,0x61,0x66,0x69,
-  0x69,0x31,0x30,0x30,0x31,0x39,0x09,0x61,0x66,0x69,0x69,
-  0x31,0x30,0x30,0x32,0x30,0x09,0x61,0x66,0x69,0x69,0x31,
-  0x30,0x30,0x32,0x31,0x09,0x61,0x66,0x69,0x69,0x31,0x30,
-  0x30,0x32,0x32,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,
-  0x32,0x34,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x32,
-  0x35,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x32,0x36,
-  0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x32,0x37,0x09,
-  0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x32,0x38,0x09,0x61,
-  0x66,0x69,0x69,0x31,0x30,0x30,0x32,0x39,0x09,0x61,0x66,
-  0x69,0x69,0x31,0x30,0x30,0x33,0x30,0x09,0x61,0x66,0x69,
-  0x69,0x31,0x30,0x30,0x33,0x31,0x09,0x61,0x66,0x69,0x69,
-  0x31,0x30,0x30,0x33,0x32,0x09,0x61,0x66,0x69,0x69,0x31,
-  0x30,0x30,0x33,0x33,0x09,0x61,0x66,0x69,0x69,0x31,0x30,
-  0x30,0x33,0x34,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,
-  0x33,0x35,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x33,
-  0x36,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x33,0x37,
-  0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x33,0x38,0x09,
-  0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x33,0x39,0x09,0x61,
-  0x66,0x69,0x69,0x31,0x30,0x30,0x34,0x30,0x09,0x61,0x66,
-  0x69,0x69,0x31,0x30,0x30,0x34,0x31,0x09,0x61,0x66,0x69,
-  0x69,0x31,0x30,0x30,0x34,0x32,0x09,0x61,0x66,0x69,0x69,
-  0x31,0x30,0x30,0x34,0x33,0x09,0x61,0x66,0x69,0x69,0x31,
-  0x30,0x30,0x34,0x34,0x09,0x61,0x66,0x69,0x69,0x31,0x30,
-  0x30,0x34,0x35,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,
-  0x34,0x36,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x34,
-  0x37,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x34,0x38,
-  0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x34,0x39,0x09,
-  0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x36,0x35,0x09,0x61,
-  0x66,0x69,0x69,0x31,0x30,0x30,0x36,0x36,0x09,0x61,0x66,
-  0x69,0x69,0x31,0x30,0x30,0x36,0x37,0x09,0x61,0x66,0x69,
-  0x69,0x31,0x30,0x30,0x36,0x38,0x09,0x61,0x66,0x69,0x69,
-  0x31,0x30,0x30,0x36,0x39,0x09,0x61,0x66,0x69,0x69,0x31,
-  0x30,0x30,0x37,0x30,0x09,0x61,0x66,0x69,0x69,0x31,0x30,
-  0x30,0x37,0x32,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,
-  0x37,0x33,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x37,
-  0x34,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x37,0x35,
-  0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x37,0x36,0x09,
-  0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x37,0x37,0x09,0x61,
-  0x66,0x69,0x69,0x31,0x30,0x30,0x37,0x38,0x09,0x61,0x66,
-  0x69,0x69,0x31,0x30,0x30,0x37,0x39,0x09,0x61,0x66,0x69,
-  0x69,0x31,0x30,0x30,0x38,0x30,0x09,0x61,0x66,0x69,0x69,
-  0x31,0x30,0x30,0x38,0x31,0x09,0x61,0x66,0x69,0x69,0x31,
-  0x30,0x30,0x38,0x32,0x09,0x61,0x66,0x69,0x69,0x31,0x30,
-  0x30,0x38,0x33,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,
-  0x38,0x34,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x38,
-  0x35,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x38,0x36,
-  0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x38,0x37,0x09,
-  0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x38,0x38,0x09,0x61,
-  0x66,0x69,0x69,0x31,0x30,0x30,0x38,0x39,0x09,0x61,0x66,
-  0x69,0x69,0x31,0x30,0x30,0x39,0x30,0x09,0x61,0x66,0x69,
-  0x69,0x31,0x30,0x30,0x39,0x31,0x09,0x61,0x66,0x69,0x69,
-  0x31,0x30,0x30,0x39,0x32,0x09,0x61,0x66,0x69,0x69,0x31,
-  0x30,0x30,0x39,0x33,0x09,0x61,0x66,0x69,0x69,0x31,0x30,
-  0x30,0x39,0x34,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,
-  0x39,0x35,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x39,
-  0x36,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x39,0x37,
-  0x07,0x75,0x6E,0x69,0x30,0x34,0x35,0x30,0x09,0x61,0x66,
-  0x69,0x69,0x31,0x30,0x30,0x37,0x31,0x09,0x61,0x66,0x69,
-  0x69,0x31,0x30,0x30,0x39,0x39,0x09,0x61,0x66,0x69,0x69,
-  0x31,0x30,0x31,0x30,0x30,0x09,0x61,0x66,0x69,0x69,0x31,
-  0x30,0x31,0x30,0x31,0x09,0x61,0x66,0x69,0x69,0x31,0x30,
-  0x31,0x30,0x32,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x31,
-  0x30,0x33,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x31,0x30,
-  0x34,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x31,0x30,0x35,
-  0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x31,0x30,0x36,0x09,
-  0x61,0x66,0x69,0x69,0x31,0x30,0x31,0x30,0x37,0x09,0x61,
-  0x66,0x69,0x69,0x31,0x30,0x31,0x30,0x38,0x09,0x61,0x66,
-  0x69,0x69,0x31,0x30,0x31,0x30,0x39,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x35,0x44,0x09,0x61,0x66,0x69,0x69,0x31,0x30,
-  0x31,0x31,0x30,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x31,
-  0x39,0x33,0x07,0x75,0x6E,0x69,0x30,0x34,0x38,0x43,0x07,
-  0x75,0x6E,0x69,0x30,0x34,0x38,0x44,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x38,0x45,0x07,0x75,0x6E,0x69,0x30,0x34,0x38,
-  0x46,0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x35,0x30,
-  0x09,0x61,0x66,0x69,0x69,0x31,0x30,0x30,0x39,0x38,0x07,
-  0x75,0x6E,0x69,0x30,0x34,0x39,0x32,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x39,0x33,0x07,0x75,0x6E,0x69,0x30,0x34,0x39,
-  0x34,0x07,0x75,0x6E,0x69,0x30,0x34,0x39,0x35,0x07,0x75,
-  0x6E,0x69,0x30,0x34,0x39,0x36,0x07,0x75,0x6E,0x69,0x30,
-  0x34,0x39,0x37,0x07,0x75,0x6E,0x69,0x30,0x34,0x39,0x38,
-  0x07,0x75,0x6E,0x69,0x30,0x34,0x39,0x39,0x07,0x75,0x6E,
-  0x69,0x30,0x34,0x39,0x41,0x07,0x75,0x6E,0x69,0x30,0x34,
-  0x39,0x42,0x07,0x75,0x6E,0x69,0x30,0x34,0x39,0x43,0x07,
-  0x75,0x6E,0x69,0x30,0x34,0x39,0x44,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x39,0x45,0x07,0x75,0x6E,0x69,0x30,0x34,0x39,
-  0x46,0x07,0x75,0x6E,0x69,0x30,0x34,0x41,0x30,0x07,0x75,
-  0x6E,0x69,0x30,0x34,0x41,0x31,0x07,0x75,0x6E,0x69,0x30,
-  0x34,0x41,0x32,0x07,0x75,0x6E,0x69,0x30,0x34,0x41,0x33,
-  0x07,0x75,0x6E,0x69,0x30,0x34,0x41,0x34,0x07,0x75,0x6E,
-  0x69,0x30,0x34,0x41,0x35,0x07,0x75,0x6E,0x69,0x30,0x34,
-  0x41,0x36,0x07,0x75,0x6E,0x69,0x30,0x34,0x41,0x37,0x07,
-  0x75,0x6E,0x69,0x30,0x34,0x41,0x38,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x41,0x39,0x07,0x75,0x6E,0x69,0x30,0x34,0x41,
-  0x41,0x07,0x75,0x6E,0x69,0x30,0x34,0x41,0x42,0x07,0x75,
-  0x6E,0x69,0x30,0x34,0x41,0x43,0x07,0x75,0x6E,0x69,0x30,
-  0x34,0x41,0x44,0x07,0x75,0x6E,0x69,0x30,0x34,0x41,0x45,
-  0x07,0x75,0x6E,0x69,0x30,0x34,0x41,0x46,0x07,0x75,0x6E,
-  0x69,0x30,0x34,0x42,0x30,0x07,0x75,0x6E,0x69,0x30,0x34,
-  0x42,0x31,0x07,0x75,0x6E,0x69,0x30,0x34,0x42,0x32,0x07,
-  0x75,0x6E,0x69,0x30,0x34,0x42,0x33,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x42,0x34,0x07,0x75,0x6E,0x69,0x30,0x34,0x42,
-  0x35,0x07,0x75,0x6E,0x69,0x30,0x34,0x42,0x36,0x07,0x75,
-  0x6E,0x69,0x30,0x34,0x42,0x37,0x07,0x75,0x6E,0x69,0x30,
-  0x34,0x42,0x38,0x07,0x75,0x6E,0x69,0x30,0x34,0x42,0x39,
-  0x07,0x75,0x6E,0x69,0x30,0x34,0x42,0x41,0x07,0x75,0x6E,
-  0x69,0x30,0x34,0x42,0x42,0x07,0x75,0x6E,0x69,0x30,0x34,
-  0x42,0x43,0x07,0x75,0x6E,0x69,0x30,0x34,0x42,0x44,0x07,
-  0x75,0x6E,0x69,0x30,0x34,0x42,0x45,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x42,0x46,0x07,0x75,0x6E,0x69,0x30,0x34,0x43,
-  0x30,0x07,0x75,0x6E,0x69,0x30,0x34,0x43,0x31,0x07,0x75,
-  0x6E,0x69,0x30,0x34,0x43,0x32,0x07,0x75,0x6E,0x69,0x30,
-  0x34,0x43,0x33,0x07,0x75,0x6E,0x69,0x30,0x34,0x43,0x34,
-  0x07,0x75,0x6E,0x69,0x30,0x34,0x43,0x37,0x07,0x75,0x6E,
-  0x69,0x30,0x34,0x43,0x38,0x07,0x75,0x6E,0x69,0x30,0x34,
-  0x43,0x42,0x07,0x75,0x6E,0x69,0x30,0x34,0x43,0x43,0x07,
-  0x75,0x6E,0x69,0x30,0x34,0x44,0x30,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x44,0x31,0x07,0x75,0x6E,0x69,0x30,0x34,0x44,
-  0x32,0x07,0x75,0x6E,0x69,0x30,0x34,0x44,0x33,0x07,0x75,
-  0x6E,0x69,0x30,0x34,0x44,0x34,0x07,0x75,0x6E,0x69,0x30,
-  0x34,0x44,0x35,0x07,0x75,0x6E,0x69,0x30,0x34,0x44,0x36,
-  0x07,0x75,0x6E,0x69,0x30,0x34,0x44,0x37,0x07,0x75,0x6E,
-  0x69,0x30,0x34,0x44,0x38,0x09,0x61,0x66,0x69,0x69,0x31,
-  0x30,0x38,0x34,0x36,0x07,0x75,0x6E,0x69,0x30,0x34,0x44,
-  0x41,0x07,0x75,0x6E,0x69,0x30,0x34,0x44,0x42,0x07,0x75,
-  0x6E,0x69,0x30,0x34,0x44,0x43,0x07,0x75,0x6E,0x69,0x30,
-  0x34,0x44,0x44,0x07,0x75,0x6E,0x69,0x30,0x34,0x44,0x45,
-  0x07,0x75,0x6E,0x69,0x30,0x34,0x44,0x46,0x07,0x75,0x6E,
-  0x69,0x30,0x34,0x45,0x30,0x07,0x75,0x6E,0x69,0x30,0x34,
-  0x45,0x31,0x07,0x75,0x6E,0x69,0x30,0x34,0x45,0x32,0x07,
-  0x75,0x6E,0x69,0x30,0x34,0x45,0x33,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x45,0x34,0x07,0x75,0x6E,0x69,0x30,0x34,0x45,
-  0x35,0x07,0x75,0x6E,0x69,0x30,0x34,0x45,0x36,0x07,0x75,
-  0x6E,0x69,0x30,0x34,0x45,0x37,0x07,0x75,0x6E,0x69,0x30,
-  0x34,0x45,0x38,0x07,0x75,0x6E,0x69,0x30,0x34,0x45,0x39,
-  0x07,0x75,0x6E,0x69,0x30,0x34,0x45,0x41,0x07,0x75,0x6E,
-  0x69,0x30,0x34,0x45,0x42,0x07,0x75,0x6E,0x69,0x30,0x34,
-  0x45,0x43,0x07,0x75,0x6E,0x69,0x30,0x34,0x45,0x44,0x07,
-  0x75,0x6E,0x69,0x30,0x34,0x45,0x45,0x07,0x75,0x6E,0x69,
-  0x30,0x34,0x45,0x46,0x07,0x75,0x6E,0x69,0x30,0x34,0x46,
-  0x30,0x07,0x75,0x6E,0x69,0x30,0x34,0x46,0x31,0x07,0x75,
-  0x6E,0x69,0x30,0x34,0x46,0x32,0x07,0x75,0x6E,0x69,0x30,
-  0x34,0x46,0x33,0x07,0x75,0x6E,0x69,0x30,0x34,0x46,0x34,
-  0x07,0x75,0x6E,0x69,0x30,0x34,0x46,0x35,0x07,0x75,0x6E,
-  0x69,0x30,0x34,0x46,0x38,0x07,0x75,0x6E,0x69,0x30,0x34,
-  0x46,0x39,0x09,0x61,0x66,0x69,0x69,0x35,0x37,0x37,0x39,
-  0x39,0x09,0x61,0x66,0x69,0x69,0x35,0x37,0x38,0x30,0x31,
-  0x09,0x61,0x66,0x69,0x69,0x35,0x37,0x38,0x30,0x30,0x09,
-  0x61,0x66,0x69,0x69,0x35,0x37,0x38,0x30,0x32,0x09,0x61,
-  0x66,0x69,0x69,0x35,0x37,0x37,0x39,0x33,0x09,0x61,0x66,
-  0x69,0x69,0x35,0x37,0x37,0x39,0x34,0x09,0x61,0x66,0x69,
-  0x69,0x35,0x37,0x37,0x39,0x35,0x09,0x61,0x66,0x69,0x69,
-  0x35,0x37,0x37,0x39,0x38,0x09,0x61,0x66,0x69,0x69,0x35,
-  0x37,0x37,0x39,0x37,0x09,0x61,0x66,0x69,0x69,0x35,0x37,
-  0x38,0x30,0x36,0x09,0x61,0x66,0x69,0x69,0x35,0x37,0x37,
-  0x39,0x36,0x09,0x61,0x66,0x69,0x69,0x35,0x37,0x38,0x30,
-  0x37,0x09,0x61,0x66,0x69,0x69,0x35,0x37,0x38,0x33,0x39,
-  0x09,0x61,0x66,0x69,0x69,0x35,0x37,0x36,0x34,0x35,0x09,
-  0x61,0x66,0x69,0x69,0x35,0x37,0x38,0x34,0x31,0x09,0x61,
-  0x66,0x69,0x69,0x35,0x37,0x38,0x34,0x32,0x09,0x61,0x66,
-  0x69,0x69,0x35,0x37,0x38,0x30,0x34,0x09,0x61,0x66,0x69,
-  0x69,0x35,0x37,0x38,0x30,0x33,0x09,0x61,0x66,0x69,0x69,
-  0x35,0x37,0x36,0x35,0x38,0x07,0x75,0x6E,0x69,0x30,0x35,
-  0x43,0x34,0x09,0x61,0x66,0x69,0x69,0x35,0x37,0x36,0x36,
-  0x34,0x09,0x61,0x66,0x69,0x69,0x35,0x37,0x36,0x36,0x35,
-  0x09,0x61,0x66,0x69,0x69,0x35,0x37,0x36,0x36,0x36,0x09,
-  0x61,0x66,0x69,0x69,0x35,0x37,0x36,0x36,0x37,0x09,0x61,
-  0x66,0x69,0x69,0x35,0x37,0x36,0x36,0x38,0x09,0x61,0x66,
-  0x69,0x69,0x35,0x37,0x36,0x36,0x39,0x09,0x61,0x66,0x69,
-  0x69,0x35,0x37,0x36,0x37,0x30,0x09,0x61,0x66,0x69,0x69,
-  0x35,0x37,0x36,0x37,0x31,0x09,0x61,0x66,0x69,0x69,0x35,
-  0x37,0x36,0x37,0x32,0x09,0x61,0x66,0x69,0x69,0x35,0x37,
-  0x36,0x37,0x33,0x09,0x61,0x66,0x69,0x69,0x35,0x37,0x36,
-  0x37,0x34,0x09,0x61,0x66,0x69,0x69,0x35,0x37,0x36,0x37,
-  0x35,0x09,0x61,0x66,0x69,0x69,0x35,0x37,0x36,0x37,0x36,
-  0x09,0x61,0x66,0x69,0x69,0x35,0x37,0x36,0x37,0x37,0x09,
-  0x61,0x66,0x69,0x69,0x35,0x37,0x36,0x37,0x38,0x09,0x61,
-  0x66,0x69,0x69,0x35,0x37,0x36,0x37,0x39,0x09,0x61,0x66,
-  0x69,0x69,0x35,0x37,0x36,0x38,0x30,0x09,0x61,0x66,0x69,
-  0x69,0x35,0x37,0x36,0x38,0x31,0x09,0x61,0x66,0x69,0x69,
-  0x35,0x37,0x36,0x38,0x32,0x09,0x61,0x66,0x69,0x69,0x35,
-  0x37,0x36,0x38,0x33,0x09,0x61,0x66,0x69,0x69,0x35,0x37,
-  0x36,0x38,0x34,0x09,0x61,0x66,0x69,0x69,0x35,0x37,0x36,
-  0x38,0x35,0x09,0x61,0x66,0x69,0x69,0x35,0x37,0x36,0x38,
-  0x36,0x09,0x61,0x66,0x69,0x69,0x35,0x37,0x36,0x38,0x37,
-  0x09,0x61,0x66,0x69,0x69,0x35,0x37,0x36,0x38,0x38,0x09,
-  0x61,0x66,0x69,0x69,0x35,0x37,0x36,0x38,0x39,0x09,0x61,
-  0x66,0x69,0x69,0x35,0x37,0x36,0x39,0x30,0x09,0x61,0x66,
-  0x69,0x69,0x35,0x37,0x37,0x31,0x36,0x09,0x61,0x66,0x69,
-  0x69,0x35,0x37,0x37,0x31,0x37,0x09,0x61,0x66,0x69,0x69,
-  0x35,0x37,0x37,0x31,0x38,0x07,0x75,0x6E,0x69,0x30,0x35,
-  0x46,0x33,0x07,0x75,0x6E,0x69,0x30,0x35,0x46,0x34,0x07,
-  0x75,0x6E,0x69,0x30,0x36,0x31,0x37,0x07,0x75,0x6E,0x69,
-  0x30,0x36,0x31,0x38,0x07,0x75,0x6E,0x69,0x30,0x36,0x31,
-  0x39,0x07,0x75,0x6E,0x69,0x30,0x36,0x31,0x41,0x09,0x61,
-  0x66,0x69,0x69,0x35,0x37,0x34,0x30,0x33,0x07,0x75,0x6E,
-  0x69,0x30,0x36,0x31,0x43,0x09,0x61,0x66,0x69,0x69,0x35,
-  0x37,0x34,0x30,0x39,0x09,0x61,0x66,0x69,0x69,0x35,0x37,
-  0x34,0x31,0x36,0x09,0x61,0x66,0x69,0x69,0x35,0x37,0x34,
-  0x31,0x38,0x09,0x61,0x66,0x69,0x69,0x35,0x37,0x34,0x31,
-  0x39,0x09,0x61,0x66,0x69,0x69,0x35,0x37,0x34,0x32,0x31,
-  0x09,0x61,0x66,0x69,0x69,0x35,0x37,0x34,0x32,0x32,0x09,
-  0x61,0x66,0x69,0x69,0x35,0x37,0x34,0x32,0x37,0x09,0x61,
-  0x66,0x69,0x69,0x35,0x37,0x36,0x33,0x36,0x04,0x45,0x75,
-  0x72,0x6F,0x07,0x75,0x6E,0x69,0x46,0x36,0x33,0x39,0x07,
-  0x75,0x6E,0x69,0x46,0x36,0x33,0x41,0x07,0x75,0x6E,0x69,
-  0x46,0x36,0x33,0x42,0x07,0x75,0x6E,0x69,0x46,0x36,0x33,
-  0x43,0x07,0x75,0x6E,0x69,0x46,0x36,0x33,0x44,0x07,0x75,
-  0x6E,0x69,0x46,0x36,0x33,0x45,0x07,0x75,0x6E,0x69,0x46,
-  0x36,0x33,0x46,0x07,0x75,0x6E,0x69,0x46,0x36,0x34,0x30,
-  0x07,0x75,0x6E,0x69,0x46,0x36,0x34,0x31,0x0B,0x63,0x6F,
-  0x6D,0x6D,0x61,0x61,0x63,0x63,0x65,0x6E,0x74,0x09,0x6F,
-  0x6E,0x65,0x66,0x69,0x74,0x74,0x65,0x64,0x07,0x75,0x6E,
-  0x69,0x46,0x42,0x31,0x44,0x07,0x75,0x6E,0x69,0x46,0x42,
-  0x31,0x45,0x09,0x61,0x66,0x69,0x69,0x35,0x37,0x37,0x30,
-  0x35,0x07,0x75,0x6E,0x69,0x46,0x42,0x32,0x30,0x07,0x75,
-  0x6E,0x69,0x46,0x42,0x32,0x31,0x07,0x75,0x6E,0x69,0x46,
-  0x42,0x32,0x32,0x07,0x75,0x6E,0x69,0x46,0x42,0x32,0x33,
-  0x07,0x75,0x6E,0x69,0x46,0x42,0x32,0x34,0x07,0x75,0x6E,
-  0x69,0x46,0x42,0x32,0x35,0x07,0x75,0x6E,0x69,0x46,0x42,
-  0x32,0x36,0x07,0x75,0x6E,0x69,0x46,0x42,0x32,0x37,0x07,
-  0x75,0x6E,0x69,0x46,0x42,0x32,0x38,0x07,0x75,0x6E,0x69,
-  0x46,0x42,0x32,0x39,0x09,0x61,0x66,0x69,0x69,0x35,0x37,
-  0x36,0x39,0x34,0x09,0x61,0x66,0x69,0x69,0x35,0x37,0x36,
-  0x39,0x35,0x07,0x75,0x6E,0x69,0x46,0x42,0x32,0x43,0x07,
-  0x75,0x6E,0x69,0x46,0x42,0x32,0x44,0x07,0x75,0x6E,0x69,
-  0x46,0x42,0x32,0x45,0x07,0x75,0x6E,0x69,0x46,0x42,0x32,
-  0x46,0x07,0x75,0x6E,0x69,0x46,0x42,0x33,0x30,0x07,0x75,
-  0x6E,0x69,0x46,0x42,0x33,0x31,0x07,0x75,0x6E,0x69,0x46,
-  0x42,0x33,0x32,0x07,0x75,0x6E,0x69,0x46,0x42,0x33,0x33,
-  0x07,0x75,0x6E,0x69,0x46,0x42,0x33,0x34,0x09,0x61,0x66,
-  0x69,0x69,0x35,0x37,0x37,0x32,0x33,0x07,0x75,0x6E,0x69,
-  0x46,0x42,0x33,0x36,0x07,0x75,0x6E,0x69,0x46,0x42,0x33,
-  0x38,0x07,0x75,0x6E,0x69,0x46,0x42,0x33,0x39,0x07,0x75,
-  0x6E,0x69,0x46,0x42,0x33,0x41,0x07,0x75,0x6E,0x69,0x46,
-  0x42,0x33,0x42,0x07,0x75,0x6E,0x69,0x46,0x42,0x33,0x43,
-  0x07,0x75,0x6E,0x69,0x46,0x42,0x33,0x45,0x07,0x75,0x6E,
-  0x69,0x46,0x42,0x34,0x30,0x07,0x75,0x6E,0x69,0x46,0x42,
-  0x34,0x31,0x07,0x75,0x6E,0x69,0x46,0x42,0x34,0x33,0x07,
-  0x75,0x6E,0x69,0x46,0x42,0x34,0x34,0x07,0x75,0x6E,0x69,
-  0x46,0x42,0x34,0x36,0x07,0x75,0x6E,0x69,0x46,0x42,0x34,
-  0x37,0x07,0x75,0x6E,0x69,0x46,0x42,0x34,0x38,0x07,0x75,
-  0x6E,0x69,0x46,0x42,0x34,0x39,0x07,0x75,0x6E,0x69,0x46,
-  0x42,0x34,0x41,0x09,0x61,0x66,0x69,0x69,0x35,0x37,0x37,
-  0x30,0x30,0x07,0x75,0x6E,0x69,0x46,0x42,0x34,0x43,0x07,
-  0x75,0x6E,0x69,0x46,0x42,0x34,0x44,0x07,0x75,0x6E,0x69,
-  0x46,0x42,0x34,0x45,0x07,0x75,0x6E,0x69,0x46,0x42,0x34,
-  0x46,0x07,0x75,0x6E,0x69,0x46,0x45,0x39,0x45,0x00,
-};
@@ -1,1207 +0,0 @@
-#pragma once
-#include <stdint.h>
-const uint8_t bbc1[] {
-  0x42,0x4D,0x36,0x4B,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x00,0x00,0x00,0x28,0x00,
-  0x00,0x00,0x50,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x01,0x00,0x18,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x4B,0x00,0x00,0x13,0x0B,0x00,0x00,0x13,0x0B,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x15,0x15,0x15,0x13,0x13,0x13,
-  0x15,0x15,0x15,0x14,0x14,0x14,0x15,0x15,0x15,0x13,0x13,0x13,0x13,0x13,0x13,0x15,
-  0x15,0x15,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x15,0x15,0x15,0x14,0x14,0x14,0x15,0x15,0x15,
-  0x15,0x15,0x15,0x15,0x15,0x15,0x14,0x14,0x14,0x16,0x16,0x16,0x14,0x14,0x14,0x15,
-  0x15,0x15,0x13,0x14,0x14,0x18,0x15,0x15,0x12,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x15,0x15,0x15,0x16,0x16,0x16,0x15,0x15,0x15,0x15,0x15,0x15,0x17,0x17,0x17,
-  0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x13,0x13,0x13,0x16,0x16,0x16,0x15,
-  0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x15,0x15,0x15,0x14,0x14,
-  0x14,0x15,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x14,
-  0x15,0x15,0x14,0x14,0x14,0x15,0x15,0x15,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x16,0x16,0x16,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x15,0x15,0x15,0x13,0x13,0x13,0x15,0x15,0x15,0x13,0x13,0x13,0x14,
-  0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x15,0x15,
-  0x15,0x13,0x13,0x13,0x13,0x13,0x13,0x12,0x12,0x12,0x14,0x14,0x14,0x13,0x13,0x13,
-  0x15,0x15,0x15,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x15,
-  0x15,0x15,0x15,0x15,0x15,0x15,0x16,0x15,0x14,0x14,0x14,0x15,0x15,0x14,0x15,0x14,
-  0x14,0x16,0x15,0x15,0x14,0x13,0x13,0x14,0x13,0x13,0x16,0x15,0x15,0x15,0x14,0x14,
-  0x15,0x15,0x15,0x15,0x15,0x14,0x13,0x13,0x13,0x16,0x16,0x16,0x15,0x15,0x14,0x16,
-  0x16,0x16,0x13,0x15,0x15,0x19,0x14,0x14,0x13,0x15,0x15,0x13,0x14,0x14,0x14,0x14,
-  0x14,0x16,0x15,0x15,0x16,0x15,0x15,0x16,0x15,0x15,0x15,0x14,0x15,0x15,0x15,0x15,
-  0x15,0x15,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x15,0x14,0x14,0x16,0x15,0x16,0x15,
-  0x15,0x15,0x15,0x15,0x15,0x15,0x16,0x16,0x14,0x14,0x14,0x17,0x16,0x16,0x15,0x14,
-  0x14,0x15,0x15,0x15,0x15,0x14,0x14,0x15,0x14,0x14,0x16,0x16,0x16,0x15,0x16,0x16,
-  0x15,0x15,0x15,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x15,0x15,0x14,0x14,0x14,0x15,
-  0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x15,0x15,
-  0x15,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x15,0x15,0x15,
-  0x15,0x15,0x15,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x15,
-  0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,
-  0x14,0x15,0x15,0x15,0x15,0x15,0x15,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,
-  0x15,0x15,0x15,0x15,0x15,0x15,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x15,0x15,0x15,0x15,0x14,0x14,0x14,0x16,0x0E,0x0F,0x12,0x0E,0x11,
-  0x14,0x0F,0x11,0x15,0x10,0x12,0x14,0x11,0x12,0x13,0x0F,0x14,0x14,0x11,0x13,0x12,
-  0x14,0x14,0x15,0x12,0x15,0x11,0x0F,0x12,0x10,0x0E,0x0F,0x11,0x12,0x13,0x15,0x11,
-  0x12,0x14,0x13,0x12,0x12,0x11,0x11,0x12,0x11,0x10,0x12,0x12,0x16,0x1A,0x18,0x13,
-  0x16,0x1A,0x14,0x15,0x18,0x15,0x14,0x17,0x15,0x13,0x14,0x13,0x14,0x12,0x15,0x14,
-  0x0D,0x13,0x16,0x0A,0x10,0x14,0x0B,0x0F,0x11,0x0C,0x0F,0x10,0x11,0x12,0x12,0x14,
-  0x14,0x15,0x14,0x14,0x15,0x14,0x14,0x15,0x17,0x14,0x16,0x1A,0x13,0x14,0x12,0x14,
-  0x15,0x07,0x0E,0x0F,0x0A,0x10,0x0F,0x10,0x10,0x10,0x15,0x14,0x14,0x13,0x16,0x16,
-  0x18,0x15,0x16,0x18,0x16,0x16,0x15,0x15,0x15,0x12,0x15,0x15,0x17,0x14,0x14,0x18,
-  0x16,0x16,0x16,0x14,0x14,0x18,0x16,0x16,0x18,0x15,0x15,0x18,0x16,0x16,0x16,0x16,
-  0x16,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x16,0x16,0x16,
-  0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x14,
-  0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x15,
-  0x15,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x15,
-  0x15,0x15,0x12,0x12,0x12,0x14,0x13,0x13,0x0A,0x11,0x11,0x36,0x47,0x4E,0x16,0x29,
-  0x37,0x17,0x28,0x34,0x1C,0x2D,0x33,0x23,0x34,0x3C,0x1E,0x34,0x3A,0x03,0x19,0x1F,
-  0x00,0x0D,0x0F,0x08,0x13,0x14,0x26,0x33,0x39,0x26,0x39,0x44,0x16,0x28,0x35,0x1D,
-  0x2C,0x33,0x23,0x31,0x39,0x21,0x35,0x3C,0x10,0x26,0x2E,0x00,0x0A,0x0F,0x0C,0x12,
-  0x16,0x15,0x14,0x16,0x11,0x15,0x15,0x0C,0x15,0x14,0x0A,0x13,0x16,0x00,0x0C,0x15,
-  0x10,0x23,0x30,0x28,0x3C,0x47,0x35,0x48,0x55,0x39,0x4B,0x54,0x1E,0x31,0x36,0x01,
-  0x0E,0x0E,0x0A,0x10,0x12,0x14,0x14,0x16,0x18,0x14,0x16,0x17,0x15,0x15,0x0D,0x1B,
-  0x19,0x41,0x54,0x58,0x1E,0x3D,0x40,0x31,0x3F,0x43,0x1C,0x1F,0x1F,0x15,0x16,0x16,
-  0x19,0x17,0x17,0x14,0x14,0x14,0x16,0x16,0x16,0x14,0x14,0x14,0x18,0x15,0x15,0x17,
-  0x15,0x15,0x16,0x14,0x14,0x17,0x16,0x16,0x16,0x14,0x14,0x15,0x13,0x13,0x13,0x13,
-  0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x15,0x15,0x15,0x13,0x13,0x13,0x13,0x13,0x13,
-  0x15,0x15,0x15,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x13,
-  0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x0E,0x14,0x15,0x19,0x2B,0x37,0x49,0x68,
-  0x7B,0x44,0x5A,0x6A,0x2B,0x38,0x40,0x29,0x39,0x3C,0x41,0x5C,0x63,0x72,0x94,0xA1,
-  0x3D,0x5B,0x64,0x00,0x0F,0x15,0x06,0x14,0x1B,0x61,0x7C,0x8C,0x43,0x60,0x70,0x35,
-  0x48,0x4E,0x26,0x39,0x3B,0x31,0x49,0x51,0x6D,0x8B,0x9B,0x5F,0x83,0x8D,0x09,0x1C,
-  0x21,0x15,0x19,0x17,0x14,0x18,0x15,0x04,0x10,0x15,0x05,0x19,0x2B,0x35,0x4F,0x64,
-  0x4C,0x62,0x74,0x45,0x54,0x61,0x3D,0x4B,0x52,0x41,0x4F,0x55,0x5C,0x69,0x6E,0x6C,
-  0x7B,0x7E,0x3B,0x45,0x48,0x10,0x14,0x18,0x15,0x17,0x18,0x13,0x17,0x16,0x02,0x13,
-  0x10,0x46,0x61,0x68,0x77,0xAF,0xB8,0x5C,0x77,0x7D,0x0E,0x15,0x13,0x17,0x18,0x17,
-  0x18,0x16,0x16,0x13,0x15,0x15,0x15,0x15,0x15,0x16,0x14,0x14,0x17,0x15,0x15,0x16,
-  0x14,0x14,0x18,0x16,0x16,0x15,0x16,0x16,0x14,0x14,0x14,0x14,0x15,0x15,0x13,0x13,
-  0x13,0x15,0x15,0x15,0x14,0x14,0x14,0x15,0x15,0x15,0x13,0x13,0x13,0x14,0x14,0x14,
-  0x15,0x15,0x15,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x13,
-  0x13,0x13,0x15,0x15,0x15,0x13,0x13,0x13,0x14,0x14,0x14,0x12,0x12,0x12,0x13,0x13,
-  0x13,0x12,0x12,0x12,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x12,0x12,0x12,0x14,0x14,0x14,0x13,
-  0x13,0x13,0x15,0x15,0x15,0x16,0x15,0x14,0x0C,0x14,0x15,0x00,0x0A,0x17,0x4C,0x68,
-  0x7B,0x2E,0x40,0x4E,0x09,0x0E,0x12,0x0C,0x11,0x12,0x00,0x05,0x0E,0x22,0x3E,0x4C,
-  0x66,0x90,0x9F,0x2E,0x46,0x50,0x00,0x08,0x13,0x44,0x57,0x68,0x48,0x5D,0x6D,0x0A,
-  0x11,0x17,0x10,0x14,0x15,0x04,0x0C,0x11,0x01,0x16,0x22,0x5C,0x82,0x95,0x66,0x81,
-  0x8A,0x01,0x0D,0x11,0x06,0x17,0x1A,0x0F,0x20,0x31,0x55,0x72,0x85,0x45,0x5A,0x68,
-  0x1A,0x23,0x29,0x0A,0x0F,0x11,0x0D,0x10,0x0F,0x0A,0x0D,0x0C,0x07,0x0C,0x0B,0x03,
-  0x0D,0x0D,0x3C,0x41,0x41,0x19,0x17,0x19,0x17,0x14,0x17,0x13,0x16,0x15,0x04,0x17,
-  0x15,0x0F,0x26,0x2B,0x7B,0xB9,0xC1,0x2D,0x48,0x4E,0x0D,0x16,0x14,0x17,0x17,0x17,
-  0x18,0x16,0x16,0x14,0x17,0x17,0x17,0x14,0x14,0x16,0x15,0x15,0x14,0x14,0x14,0x13,
-  0x13,0x13,0x16,0x16,0x16,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,
-  0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x12,
-  0x12,0x12,0x15,0x15,0x15,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,
-  0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x15,0x15,0x15,0x12,0x12,0x12,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x15,0x14,0x14,0x0C,0x14,0x15,0x01,0x0A,0x17,0x57,0x75,
-  0x84,0x32,0x43,0x4F,0x0F,0x11,0x14,0x15,0x15,0x16,0x11,0x15,0x1A,0x00,0x0E,0x1A,
-  0x59,0x82,0x96,0x68,0x83,0x92,0x00,0x03,0x12,0x44,0x5D,0x6E,0x4A,0x61,0x71,0x0E,
-  0x15,0x1A,0x17,0x17,0x16,0x0E,0x16,0x13,0x00,0x09,0x12,0x40,0x62,0x7A,0x76,0x94,
-  0xA7,0x12,0x23,0x2D,0x00,0x09,0x17,0x6A,0x85,0x9D,0x50,0x68,0x7C,0x18,0x20,0x24,
-  0x16,0x14,0x15,0x19,0x16,0x16,0x1B,0x15,0x15,0x18,0x14,0x13,0x18,0x17,0x15,0x12,
-  0x14,0x14,0x11,0x10,0x11,0x16,0x13,0x14,0x16,0x14,0x15,0x13,0x15,0x14,0x03,0x16,
-  0x14,0x12,0x2B,0x2E,0x83,0xC4,0xC9,0x2F,0x4E,0x4F,0x0E,0x17,0x16,0x19,0x19,0x18,
-  0x17,0x16,0x16,0x13,0x16,0x16,0x17,0x15,0x15,0x17,0x16,0x16,0x13,0x13,0x13,0x15,
-  0x15,0x15,0x15,0x15,0x15,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x13,0x13,
-  0x13,0x15,0x15,0x15,0x15,0x15,0x15,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x14,
-  0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,
-  0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x15,0x15,0x15,0x13,0x13,0x13,0x13,
-  0x13,0x13,0x14,0x14,0x14,0x15,0x14,0x14,0x0D,0x15,0x15,0x01,0x0A,0x17,0x60,0x81,
-  0x93,0x34,0x47,0x55,0x0D,0x0F,0x14,0x12,0x17,0x15,0x0D,0x16,0x16,0x00,0x0E,0x19,
-  0x59,0x7F,0x93,0x78,0x91,0xA2,0x00,0x02,0x12,0x4A,0x64,0x74,0x4D,0x63,0x72,0x13,
-  0x15,0x1B,0x17,0x17,0x17,0x0C,0x17,0x13,0x00,0x08,0x13,0x3D,0x59,0x70,0x7C,0x9B,
-  0xB0,0x13,0x28,0x34,0x24,0x39,0x47,0x74,0x99,0xAD,0x33,0x48,0x51,0x0D,0x13,0x13,
-  0x18,0x16,0x15,0x17,0x16,0x17,0x15,0x14,0x15,0x15,0x14,0x15,0x12,0x14,0x14,0x14,
-  0x14,0x14,0x16,0x15,0x15,0x13,0x14,0x14,0x18,0x16,0x17,0x13,0x15,0x14,0x03,0x15,
-  0x13,0x15,0x2D,0x2E,0x8B,0xC9,0xCC,0x30,0x4D,0x4D,0x0F,0x18,0x16,0x19,0x18,0x18,
-  0x18,0x16,0x16,0x13,0x15,0x15,0x16,0x14,0x14,0x15,0x15,0x15,0x15,0x15,0x15,0x15,
-  0x15,0x15,0x14,0x14,0x14,0x15,0x15,0x15,0x15,0x15,0x15,0x13,0x13,0x13,0x14,0x14,
-  0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x13,0x13,0x13,
-  0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x12,
-  0x12,0x12,0x14,0x14,0x14,0x13,0x13,0x13,0x15,0x15,0x15,0x14,0x14,0x14,0x12,0x12,
-  0x12,0x15,0x15,0x15,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x14,
-  0x14,0x14,0x12,0x12,0x12,0x15,0x14,0x11,0x0D,0x15,0x15,0x00,0x0A,0x16,0x6A,0x8A,
-  0x9B,0x3C,0x4F,0x5B,0x0B,0x12,0x14,0x10,0x18,0x15,0x03,0x11,0x14,0x08,0x1E,0x2F,
-  0x70,0x90,0xA3,0x5C,0x6E,0x7D,0x00,0x01,0x12,0x55,0x6A,0x7C,0x4F,0x67,0x74,0x0D,
-  0x15,0x1A,0x13,0x18,0x19,0x0A,0x15,0x18,0x00,0x08,0x1A,0x4F,0x6E,0x81,0x7D,0x9C,
-  0xA8,0x00,0x06,0x11,0x4F,0x6E,0x7D,0x6C,0x92,0xA1,0x13,0x24,0x29,0x13,0x1A,0x18,
-  0x18,0x17,0x17,0x17,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x14,0x14,0x14,0x13,
-  0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x15,0x16,0x15,0x16,0x04,0x17,
-  0x14,0x13,0x2D,0x2E,0x8E,0xCC,0xCE,0x2F,0x4B,0x4C,0x0E,0x18,0x15,0x18,0x18,0x18,
-  0x18,0x16,0x16,0x15,0x15,0x15,0x14,0x14,0x14,0x17,0x17,0x17,0x16,0x16,0x16,0x15,
-  0x15,0x15,0x14,0x14,0x14,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,
-  0x15,0x14,0x14,0x14,0x15,0x15,0x15,0x15,0x15,0x15,0x13,0x13,0x13,0x13,0x13,0x13,
-  0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x12,
-  0x12,0x12,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x12,0x12,
-  0x12,0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x14,
-  0x14,0x14,0x14,0x14,0x15,0x16,0x15,0x14,0x0C,0x15,0x14,0x00,0x0A,0x14,0x77,0x99,
-  0xAD,0x35,0x4B,0x5D,0x00,0x0B,0x15,0x00,0x0E,0x15,0x06,0x1C,0x2B,0x5F,0x79,0x8A,
-  0x80,0x93,0x9C,0x03,0x0D,0x10,0x03,0x09,0x10,0x5A,0x76,0x88,0x4D,0x6C,0x7C,0x00,
-  0x10,0x1C,0x05,0x0E,0x1B,0x00,0x0E,0x1E,0x3F,0x54,0x66,0x7C,0x8E,0x9B,0x1C,0x2C,
-  0x31,0x00,0x0A,0x13,0x5D,0x86,0x93,0x68,0x8F,0x9F,0x07,0x11,0x17,0x17,0x1A,0x19,
-  0x17,0x15,0x15,0x16,0x15,0x15,0x15,0x15,0x15,0x16,0x16,0x16,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x13,0x14,0x16,0x13,0x14,0x04,0x16,
-  0x12,0x17,0x32,0x32,0x93,0xD1,0xD3,0x31,0x4D,0x4E,0x0F,0x18,0x16,0x18,0x17,0x17,
-  0x18,0x17,0x17,0x16,0x16,0x16,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x16,
-  0x16,0x16,0x14,0x14,0x14,0x15,0x15,0x15,0x15,0x15,0x15,0x14,0x14,0x14,0x16,0x16,
-  0x16,0x14,0x14,0x14,0x16,0x16,0x16,0x13,0x13,0x13,0x15,0x15,0x15,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x13,
-  0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,
-  0x14,0x12,0x12,0x12,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x15,0x15,0x15,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x15,
-  0x15,0x15,0x15,0x15,0x15,0x15,0x13,0x14,0x0D,0x16,0x15,0x00,0x0A,0x14,0x78,0xA2,
-  0xB2,0x41,0x5E,0x6F,0x37,0x47,0x54,0x3B,0x53,0x61,0x42,0x5F,0x73,0x23,0x36,0x42,
-  0x00,0x06,0x0C,0x11,0x16,0x14,0x00,0x0A,0x0F,0x5E,0x7B,0x8B,0x4C,0x6E,0x7D,0x33,
-  0x44,0x52,0x3C,0x4C,0x5E,0x48,0x65,0x78,0x2B,0x44,0x4F,0x02,0x11,0x15,0x07,0x12,
-  0x0F,0x00,0x0D,0x13,0x5E,0x85,0x94,0x6E,0x95,0xA5,0x07,0x13,0x19,0x18,0x18,0x17,
-  0x1C,0x17,0x18,0x17,0x15,0x16,0x15,0x15,0x15,0x14,0x15,0x15,0x14,0x14,0x14,0x15,
-  0x15,0x15,0x14,0x14,0x14,0x14,0x15,0x15,0x18,0x15,0x16,0x18,0x15,0x15,0x05,0x15,
-  0x12,0x19,0x32,0x34,0x9A,0xD8,0xDA,0x31,0x4D,0x4D,0x0E,0x17,0x16,0x19,0x18,0x18,
-  0x19,0x16,0x16,0x15,0x16,0x16,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x15,
-  0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x15,0x15,0x15,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x16,0x16,0x16,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x13,
-  0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,
-  0x12,0x12,0x12,0x13,0x13,0x13,0x13,0x13,0x13,0x15,0x15,0x15,0x13,0x13,0x13,0x13,
-  0x13,0x13,0x14,0x14,0x14,0x13,0x15,0x13,0x0C,0x16,0x13,0x00,0x08,0x11,0x84,0xAF,
-  0xB9,0x3A,0x56,0x5F,0x06,0x15,0x19,0x10,0x21,0x2A,0x39,0x54,0x61,0x61,0x7A,0x88,
-  0x03,0x12,0x1E,0x0D,0x17,0x18,0x00,0x09,0x10,0x5E,0x7D,0x8C,0x55,0x76,0x84,0x07,
-  0x17,0x21,0x12,0x1E,0x27,0x25,0x40,0x48,0x65,0x86,0x8F,0x21,0x35,0x3B,0x07,0x12,
-  0x12,0x03,0x0E,0x0E,0x52,0x6D,0x7B,0x7A,0xA5,0xB2,0x0F,0x1E,0x26,0x14,0x18,0x1A,
-  0x17,0x17,0x16,0x17,0x15,0x15,0x16,0x16,0x16,0x13,0x13,0x13,0x16,0x16,0x16,0x16,
-  0x14,0x14,0x13,0x13,0x14,0x18,0x14,0x14,0x1B,0x14,0x16,0x18,0x15,0x16,0x04,0x15,
-  0x12,0x1B,0x33,0x31,0xAA,0xE3,0xE5,0x39,0x4F,0x4E,0x13,0x17,0x16,0x18,0x17,0x17,
-  0x18,0x16,0x16,0x15,0x15,0x15,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x15,0x15,0x15,0x13,0x13,
-  0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x13,0x13,0x13,
-  0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x12,
-  0x12,0x12,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x15,0x15,0x15,0x13,0x13,0x13,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x13,
-  0x13,0x13,0x14,0x14,0x14,0x13,0x15,0x15,0x0C,0x16,0x15,0x00,0x09,0x12,0x8D,0xB4,
-  0xC0,0x3E,0x5B,0x63,0x08,0x13,0x13,0x0B,0x15,0x14,0x00,0x0F,0x18,0x5A,0x7A,0x8B,
-  0x62,0x7A,0x88,0x00,0x0C,0x12,0x00,0x0C,0x12,0x67,0x84,0x92,0x62,0x7E,0x89,0x0C,
-  0x17,0x1C,0x11,0x17,0x17,0x00,0x08,0x0F,0x44,0x63,0x73,0x8A,0xAA,0xBA,0x07,0x17,
-  0x19,0x0A,0x19,0x15,0x1D,0x32,0x36,0xA0,0xC8,0xD0,0x31,0x4D,0x53,0x09,0x12,0x15,
-  0x17,0x19,0x18,0x19,0x15,0x14,0x16,0x17,0x17,0x18,0x15,0x15,0x16,0x14,0x14,0x10,
-  0x15,0x14,0x0B,0x10,0x10,0x16,0x16,0x16,0x19,0x15,0x16,0x18,0x15,0x16,0x07,0x15,
-  0x13,0x1C,0x33,0x2D,0xBA,0xEB,0xE8,0x42,0x59,0x58,0x11,0x16,0x15,0x19,0x17,0x17,
-  0x1A,0x17,0x17,0x17,0x17,0x17,0x15,0x15,0x15,0x16,0x16,0x16,0x15,0x15,0x15,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x16,0x16,0x16,0x14,0x14,0x14,0x16,0x16,
-  0x16,0x13,0x13,0x13,0x14,0x14,0x14,0x15,0x15,0x15,0x15,0x15,0x15,0x16,0x16,0x16,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x15,0x15,0x15,0x14,
-  0x14,0x14,0x15,0x15,0x15,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,
-  0x13,0x15,0x15,0x15,0x14,0x14,0x14,0x15,0x15,0x15,0x15,0x15,0x15,0x13,0x13,0x13,
-  0x12,0x12,0x12,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x15,0x15,0x15,0x16,
-  0x16,0x16,0x15,0x15,0x15,0x13,0x13,0x14,0x0B,0x14,0x15,0x00,0x07,0x12,0x8F,0xB3,
-  0xC5,0x3B,0x56,0x62,0x0E,0x15,0x16,0x11,0x17,0x17,0x00,0x09,0x15,0x45,0x64,0x78,
-  0x7E,0x9B,0xAC,0x03,0x0E,0x1A,0x01,0x0B,0x12,0x65,0x83,0x93,0x5B,0x79,0x86,0x0B,
-  0x16,0x1B,0x11,0x18,0x1A,0x03,0x0E,0x19,0x2C,0x47,0x5B,0x77,0x9E,0xB0,0x28,0x39,
-  0x3E,0x12,0x1A,0x19,0x00,0x07,0x08,0x73,0x96,0x9F,0x81,0xA7,0xB1,0x00,0x13,0x19,
-  0x0D,0x17,0x18,0x14,0x16,0x17,0x16,0x17,0x16,0x18,0x16,0x16,0x0D,0x16,0x15,0x00,
-  0x0F,0x0D,0x3A,0x48,0x46,0x1D,0x25,0x24,0x19,0x17,0x18,0x1A,0x16,0x16,0x08,0x16,
-  0x14,0x1E,0x30,0x31,0xC4,0xED,0xEC,0x49,0x5F,0x5D,0x11,0x16,0x15,0x19,0x18,0x18,
-  0x1A,0x18,0x18,0x17,0x17,0x17,0x14,0x14,0x14,0x13,0x13,0x13,0x15,0x15,0x15,0x15,
-  0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x14,0x14,0x14,0x13,0x13,
-  0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x15,0x15,0x15,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x15,0x15,
-  0x15,0x14,0x15,0x15,0x14,0x12,0x12,0x18,0x16,0x16,0x16,0x14,0x14,0x14,0x13,0x13,
-  0x13,0x13,0x13,0x12,0x12,0x12,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x15,
-  0x15,0x15,0x14,0x14,0x14,0x15,0x13,0x14,0x0D,0x16,0x17,0x00,0x09,0x14,0x78,0xA2,
-  0xB2,0x2F,0x4A,0x5A,0x00,0x0C,0x12,0x00,0x0C,0x13,0x00,0x12,0x21,0x6A,0x85,0x94,
-  0x88,0xA0,0xAD,0x00,0x09,0x11,0x00,0x04,0x0D,0x5F,0x81,0x8E,0x43,0x64,0x76,0x00,
-  0x10,0x1D,0x00,0x0E,0x16,0x00,0x04,0x10,0x51,0x6F,0x7F,0x98,0xB6,0xC4,0x1A,0x25,
-  0x25,0x1E,0x1A,0x1A,0x18,0x15,0x16,0x00,0x07,0x08,0x78,0x95,0x9E,0x7B,0x9A,0xA2,
-  0x0A,0x20,0x24,0x02,0x0C,0x13,0x06,0x0E,0x14,0x08,0x0F,0x15,0x00,0x0E,0x13,0x08,
-  0x23,0x27,0x91,0xA8,0xAF,0x06,0x10,0x0D,0x17,0x19,0x19,0x14,0x15,0x15,0x03,0x0E,
-  0x0C,0x36,0x4B,0x4A,0xD0,0xF1,0xEE,0x50,0x62,0x5F,0x14,0x17,0x17,0x19,0x1A,0x1A,
-  0x1A,0x17,0x18,0x17,0x17,0x17,0x14,0x14,0x14,0x15,0x15,0x15,0x13,0x13,0x13,0x15,
-  0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x15,0x15,0x15,0x14,0x14,
-  0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x13,0x13,0x13,
-  0x15,0x15,0x15,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x17,0x14,0x14,0x16,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x13,0x14,0x14,0x17,0x13,0x13,0x09,0x10,0x10,0x4D,0x59,0x5E,0x97,0xAF,
-  0xBB,0x5D,0x6F,0x7B,0x48,0x57,0x5E,0x48,0x59,0x60,0x73,0x86,0x8F,0x7E,0x90,0x95,
-  0x1B,0x25,0x24,0x0D,0x15,0x15,0x20,0x2E,0x30,0x98,0xB3,0xB7,0x64,0x7D,0x85,0x4D,
-  0x5B,0x65,0x48,0x57,0x5F,0x5E,0x6F,0x76,0x84,0x95,0x9C,0x42,0x4B,0x4F,0x0F,0x12,
-  0x10,0x18,0x19,0x14,0x15,0x15,0x13,0x10,0x16,0x14,0x00,0x04,0x06,0x3C,0x4D,0x50,
-  0x78,0x89,0x8B,0x59,0x67,0x6F,0x3D,0x4D,0x56,0x3D,0x4A,0x52,0x4C,0x5E,0x62,0x5D,
-  0x73,0x74,0x55,0x64,0x66,0x0E,0x12,0x11,0x16,0x18,0x18,0x13,0x13,0x13,0x30,0x35,
-  0x34,0x9D,0xAA,0xAA,0xD6,0xE7,0xE5,0x68,0x6E,0x6D,0x16,0x17,0x17,0x19,0x19,0x19,
-  0x16,0x16,0x16,0x16,0x16,0x16,0x15,0x15,0x15,0x15,0x15,0x15,0x16,0x16,0x16,0x14,
-  0x14,0x14,0x15,0x15,0x15,0x15,0x15,0x15,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,
-  0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x15,0x15,0x15,0x15,0x15,0x15,0x13,0x13,0x13,
-  0x15,0x15,0x15,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x15,0x15,0x15,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x16,0x16,0x16,0x14,0x14,
-  0x14,0x13,0x13,0x13,0x16,0x15,0x15,0x15,0x13,0x13,0x16,0x14,0x14,0x16,0x15,0x15,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x14,
-  0x14,0x14,0x17,0x16,0x16,0x12,0x14,0x14,0x12,0x14,0x15,0x12,0x15,0x16,0x03,0x0B,
-  0x0A,0x0A,0x0F,0x0E,0x0F,0x11,0x11,0x0B,0x12,0x11,0x07,0x0F,0x0F,0x02,0x06,0x04,
-  0x0D,0x13,0x12,0x10,0x15,0x11,0x14,0x18,0x17,0x04,0x0B,0x0B,0x06,0x0F,0x0D,0x0F,
-  0x12,0x12,0x0F,0x11,0x12,0x0C,0x11,0x11,0x04,0x08,0x06,0x0E,0x0E,0x0D,0x13,0x13,
-  0x13,0x14,0x15,0x14,0x13,0x14,0x14,0x16,0x15,0x13,0x12,0x14,0x15,0x0B,0x0F,0x10,
-  0x03,0x09,0x07,0x13,0x18,0x19,0x1C,0x22,0x21,0x1B,0x22,0x21,0x12,0x18,0x1A,0x0A,
-  0x0D,0x0C,0x0C,0x0C,0x0B,0x16,0x13,0x15,0x13,0x14,0x14,0x13,0x14,0x14,0x13,0x12,
-  0x12,0x00,0x00,0x00,0x01,0x03,0x03,0x17,0x19,0x17,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x16,0x16,0x16,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x15,0x15,
-  0x15,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x15,0x15,0x15,0x13,0x13,0x13,
-  0x15,0x15,0x15,0x14,0x14,0x14,0x15,0x15,0x15,0x15,0x15,0x15,0x14,0x14,0x14,0x15,
-  0x15,0x15,0x15,0x15,0x15,0x14,0x14,0x14,0x15,0x15,0x15,0x16,0x16,0x16,0x15,0x15,
-  0x15,0x15,0x15,0x15,0x15,0x16,0x16,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x15,0x15,0x15,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x13,
-  0x13,0x13,0x13,0x13,0x13,0x18,0x16,0x16,0x18,0x15,0x15,0x18,0x15,0x15,0x13,0x13,
-  0x13,0x16,0x15,0x15,0x16,0x14,0x14,0x15,0x14,0x14,0x16,0x15,0x15,0x15,0x15,0x15,
-  0x15,0x14,0x14,0x15,0x15,0x15,0x16,0x15,0x15,0x16,0x15,0x15,0x14,0x14,0x14,0x15,
-  0x15,0x15,0x15,0x13,0x13,0x14,0x13,0x13,0x17,0x15,0x15,0x15,0x15,0x15,0x13,0x13,
-  0x13,0x15,0x15,0x15,0x15,0x15,0x15,0x14,0x14,0x14,0x16,0x15,0x15,0x12,0x14,0x13,
-  0x15,0x15,0x15,0x16,0x14,0x14,0x13,0x12,0x12,0x13,0x13,0x13,0x13,0x13,0x13,0x15,
-  0x15,0x15,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x15,
-  0x15,0x15,0x15,0x15,0x13,0x13,0x13,0x14,0x13,0x14,0x15,0x15,0x15,0x15,0x15,0x15,
-  0x15,0x15,0x15,0x12,0x12,0x12,0x15,0x15,0x15,0x14,0x14,0x14,0x13,0x13,0x13,0x15,
-  0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x13,0x13,
-  0x13,0x15,0x15,0x15,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,
-  0x16,0x16,0x16,0x15,0x15,0x15,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x17,0x17,
-  0x17,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x13,0x13,0x13,
-  0x14,0x14,0x14,0x15,0x15,0x15,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x12,
-  0x12,0x12,0x13,0x13,0x13,0x15,0x14,0x14,0x17,0x16,0x16,0x16,0x15,0x15,0x18,0x15,
-  0x15,0x16,0x16,0x16,0x12,0x14,0x14,0x15,0x15,0x14,0x13,0x13,0x13,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x16,0x16,0x16,0x14,0x14,0x14,0x15,0x15,0x15,0x16,
-  0x16,0x16,0x17,0x15,0x15,0x17,0x14,0x14,0x17,0x14,0x14,0x13,0x14,0x14,0x13,0x13,
-  0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x16,0x16,0x16,0x15,0x15,0x15,0x16,0x15,0x15,
-  0x14,0x14,0x14,0x16,0x17,0x17,0x16,0x16,0x16,0x16,0x16,0x16,0x14,0x14,0x14,0x15,
-  0x15,0x15,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x15,0x15,
-  0x15,0x16,0x16,0x16,0x16,0x16,0x16,0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,
-  0x16,0x16,0x16,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x15,
-  0x15,0x15,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x15,0x15,0x15,0x15,0x15,
-  0x15,0x15,0x15,0x15,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x15,0x15,0x15,
-  0x15,0x15,0x15,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x13,0x13,0x13,0x15,0x15,
-  0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x15,0x15,0x15,
-  0x14,0x14,0x14,0x15,0x15,0x15,0x15,0x15,0x15,0x13,0x13,0x13,0x14,0x14,0x14,0x13,
-  0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x13,0x14,
-  0x14,0x15,0x16,0x16,0x15,0x13,0x13,0x13,0x14,0x13,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x12,0x13,0x13,0x14,0x14,0x14,0x13,0x14,0x13,0x14,0x14,0x14,0x15,
-  0x15,0x15,0x14,0x14,0x14,0x15,0x15,0x15,0x13,0x12,0x12,0x14,0x14,0x14,0x15,0x15,
-  0x15,0x15,0x15,0x15,0x16,0x15,0x15,0x16,0x16,0x16,0x16,0x16,0x16,0x18,0x15,0x15,
-  0x15,0x15,0x15,0x13,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x15,
-  0x15,0x15,0x13,0x13,0x13,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,
-  0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x13,0x13,0x13,0x15,0x15,0x15,
-  0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x13,
-  0x13,0x13,0x13,0x13,0x13,0x15,0x15,0x15,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,
-  0x15,0x15,0x15,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x15,0x15,0x15,0x13,
-  0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x16,0x16,
-  0x16,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,
-  0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x14,
-  0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x15,0x15,0x15,0x13,0x13,0x13,0x14,0x13,0x16,0x19,0x15,0x14,0x14,0x13,0x15,
-  0x14,0x13,0x15,0x15,0x15,0x13,0x15,0x14,0x16,0x16,0x14,0x14,0x15,0x14,0x15,0x14,
-  0x13,0x14,0x12,0x13,0x13,0x13,0x13,0x13,0x14,0x13,0x13,0x1A,0x15,0x15,0x17,0x14,
-  0x14,0x15,0x14,0x14,0x14,0x13,0x15,0x12,0x14,0x16,0x16,0x14,0x16,0x14,0x13,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,
-  0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x15,0x15,0x15,0x13,0x13,0x13,0x14,0x14,0x14,
-  0x13,0x13,0x13,0x14,0x14,0x14,0x15,0x15,0x15,0x13,0x13,0x13,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x10,0x13,
-  0x13,0x13,0x13,0x13,0x18,0x16,0x16,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x13,0x13,0x13,0x14,
-  0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,
-  0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x15,0x15,0x15,
-  0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x13,
-  0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,
-  0x14,0x15,0x15,0x15,0x15,0x15,0x15,0x17,0x14,0x15,0x16,0x13,0x15,0x16,0x14,0x14,
-  0x13,0x14,0x12,0x14,0x14,0x14,0x14,0x14,0x13,0x14,0x14,0x15,0x14,0x13,0x14,0x17,
-  0x15,0x15,0x12,0x13,0x14,0x11,0x11,0x12,0x14,0x13,0x13,0x10,0x12,0x11,0x0C,0x11,
-  0x0F,0x0A,0x11,0x10,0x06,0x11,0x0E,0x07,0x12,0x10,0x0C,0x10,0x13,0x0D,0x12,0x11,
-  0x11,0x14,0x12,0x15,0x14,0x13,0x15,0x13,0x14,0x13,0x12,0x12,0x15,0x15,0x15,0x13,
-  0x13,0x13,0x14,0x14,0x15,0x14,0x14,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x14,0x14,
-  0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,
-  0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x14,
-  0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x12,0x12,0x12,0x10,0x13,
-  0x13,0x14,0x14,0x14,0x16,0x14,0x14,0x14,0x15,0x15,0x14,0x14,0x14,0x13,0x13,0x13,
-  0x13,0x13,0x13,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,
-  0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x13,0x13,0x13,0x15,0x15,0x15,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x13,
-  0x13,0x13,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,
-  0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x17,0x14,0x14,0x15,0x15,0x19,0x17,0x15,0x16,
-  0x16,0x15,0x13,0x15,0x13,0x14,0x15,0x14,0x13,0x19,0x17,0x0F,0x13,0x13,0x0F,0x08,
-  0x0C,0x0D,0x06,0x0D,0x10,0x19,0x1C,0x17,0x2B,0x29,0x1D,0x3B,0x34,0x2D,0x3C,0x3F,
-  0x3E,0x34,0x41,0x45,0x3A,0x4E,0x56,0x2A,0x44,0x4E,0x1D,0x36,0x44,0x11,0x26,0x36,
-  0x04,0x16,0x1F,0x00,0x0D,0x0F,0x06,0x0E,0x0E,0x0E,0x12,0x13,0x14,0x13,0x15,0x14,
-  0x13,0x15,0x14,0x13,0x15,0x14,0x13,0x16,0x16,0x16,0x15,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x13,0x13,0x13,0x15,0x15,0x15,0x12,0x12,0x12,0x14,0x14,0x14,0x15,0x15,0x15,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x15,0x15,0x15,0x15,
-  0x15,0x15,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x12,0x14,
-  0x14,0x15,0x15,0x15,0x16,0x15,0x15,0x14,0x15,0x15,0x15,0x15,0x15,0x13,0x13,0x13,
-  0x14,0x14,0x14,0x15,0x15,0x15,0x13,0x13,0x13,0x15,0x15,0x15,0x14,0x14,0x14,0x15,
-  0x15,0x15,0x15,0x15,0x15,0x14,0x14,0x14,0x12,0x12,0x12,0x14,0x14,0x14,0x13,0x13,
-  0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,
-  0x15,0x15,0x15,0x12,0x12,0x12,0x12,0x12,0x12,0x13,0x13,0x13,0x14,0x14,0x14,0x13,
-  0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x15,0x14,
-  0x15,0x15,0x13,0x13,0x12,0x12,0x12,0x16,0x15,0x15,0x10,0x13,0x18,0x11,0x14,0x1B,
-  0x13,0x15,0x15,0x19,0x15,0x11,0x22,0x14,0x04,0x2A,0x19,0x00,0x36,0x28,0x10,0x54,
-  0x52,0x49,0x71,0x73,0x6A,0x88,0x80,0x6B,0x5E,0x4F,0x31,0x4B,0x3B,0x21,0x2B,0x24,
-  0x12,0x0F,0x14,0x10,0x27,0x33,0x3A,0x41,0x57,0x60,0x4F,0x6B,0x77,0x5F,0x7D,0x8C,
-  0x63,0x81,0x8C,0x64,0x7A,0x82,0x4F,0x61,0x67,0x2D,0x3A,0x3D,0x11,0x19,0x19,0x13,
-  0x12,0x0F,0x18,0x14,0x13,0x17,0x15,0x14,0x13,0x15,0x13,0x14,0x14,0x14,0x12,0x14,
-  0x14,0x16,0x14,0x14,0x14,0x14,0x14,0x11,0x12,0x12,0x13,0x13,0x13,0x15,0x15,0x15,
-  0x14,0x14,0x14,0x11,0x13,0x13,0x13,0x13,0x13,0x17,0x15,0x15,0x16,0x16,0x16,0x15,
-  0x15,0x15,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x15,0x15,0x15,
-  0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x16,0x16,0x16,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x15,0x15,0x15,
-  0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x15,0x15,0x15,0x16,0x14,
-  0x13,0x12,0x14,0x15,0x16,0x14,0x14,0x12,0x15,0x12,0x15,0x16,0x10,0x1B,0x16,0x0A,
-  0x23,0x14,0x03,0x3D,0x26,0x05,0x5F,0x3C,0x0D,0x6E,0x48,0x19,0x64,0x46,0x1B,0x5E,
-  0x48,0x25,0x6C,0x55,0x35,0x63,0x43,0x1B,0x67,0x3F,0x16,0x5B,0x35,0x0F,0x4F,0x2D,
-  0x0A,0x40,0x26,0x0A,0x31,0x19,0x05,0x1F,0x0F,0x00,0x15,0x0D,0x00,0x20,0x17,0x0B,
-  0x1B,0x13,0x06,0x2E,0x21,0x13,0x35,0x28,0x1B,0x3C,0x2F,0x20,0x4A,0x3F,0x2E,0x47,
-  0x3A,0x25,0x31,0x27,0x13,0x19,0x13,0x08,0x16,0x15,0x12,0x12,0x14,0x16,0x14,0x15,
-  0x14,0x14,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x16,0x16,0x16,0x16,0x16,0x16,
-  0x14,0x14,0x14,0x10,0x12,0x12,0x16,0x16,0x16,0x17,0x16,0x16,0x15,0x15,0x15,0x14,
-  0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x15,0x15,0x15,0x16,0x16,0x16,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x12,0x12,0x12,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x15,0x15,0x15,0x12,0x12,0x12,
-  0x15,0x15,0x15,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x14,
-  0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x13,0x13,0x14,0x13,0x17,0x13,
-  0x12,0x12,0x14,0x19,0x16,0x15,0x16,0x1F,0x15,0x09,0x26,0x16,0x01,0x41,0x25,0x03,
-  0x65,0x42,0x12,0x6E,0x4A,0x13,0x74,0x49,0x12,0x70,0x46,0x10,0x6D,0x43,0x14,0x6D,
-  0x45,0x1A,0x6F,0x46,0x1A,0x6C,0x41,0x12,0x6C,0x42,0x14,0x6E,0x42,0x17,0x71,0x43,
-  0x17,0x6D,0x42,0x1B,0x70,0x43,0x1A,0x71,0x40,0x18,0x6A,0x3E,0x17,0x6D,0x40,0x17,
-  0x6A,0x41,0x19,0x6B,0x3F,0x1A,0x68,0x40,0x15,0x69,0x40,0x15,0x67,0x40,0x13,0x6A,
-  0x41,0x14,0x6B,0x4A,0x1A,0x56,0x3F,0x16,0x30,0x1E,0x05,0x18,0x14,0x0C,0x11,0x14,
-  0x16,0x12,0x14,0x14,0x14,0x14,0x14,0x15,0x13,0x13,0x14,0x14,0x14,0x15,0x15,0x15,
-  0x14,0x13,0x13,0x11,0x14,0x14,0x13,0x13,0x13,0x15,0x14,0x14,0x14,0x14,0x14,0x13,
-  0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x16,0x16,0x16,0x15,0x15,0x15,0x14,0x14,0x14,
-  0x15,0x15,0x15,0x13,0x13,0x13,0x15,0x15,0x15,0x15,0x15,0x15,0x13,0x13,0x13,0x13,
-  0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x15,0x15,0x15,0x15,0x15,0x15,0x13,0x13,
-  0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x15,0x15,0x15,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x15,0x15,0x15,0x13,
-  0x13,0x13,0x14,0x14,0x14,0x14,0x13,0x15,0x15,0x15,0x15,0x14,0x13,0x14,0x17,0x12,
-  0x14,0x19,0x15,0x13,0x21,0x16,0x07,0x35,0x1E,0x02,0x62,0x3A,0x12,0x70,0x49,0x16,
-  0x6F,0x48,0x13,0x6E,0x47,0x15,0x6E,0x41,0x13,0x70,0x43,0x14,0x70,0x41,0x14,0x6B,
-  0x3E,0x14,0x68,0x3F,0x13,0x6B,0x40,0x15,0x6B,0x3E,0x14,0x70,0x3E,0x11,0x6F,0x3E,
-  0x12,0x6D,0x3B,0x13,0x6A,0x3E,0x14,0x6F,0x3F,0x16,0x71,0x3E,0x15,0x6F,0x3F,0x14,
-  0x6E,0x3E,0x13,0x6F,0x3E,0x13,0x6E,0x40,0x15,0x6F,0x42,0x13,0x6D,0x42,0x10,0x73,
-  0x41,0x12,0x6E,0x41,0x10,0x6D,0x43,0x15,0x66,0x46,0x1E,0x4A,0x35,0x17,0x23,0x19,
-  0x0C,0x17,0x15,0x10,0x14,0x14,0x16,0x13,0x13,0x14,0x11,0x12,0x16,0x14,0x14,0x14,
-  0x17,0x15,0x16,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,
-  0x13,0x13,0x13,0x15,0x15,0x15,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x14,
-  0x14,0x14,0x15,0x15,0x15,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,
-  0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x15,0x15,0x15,
-  0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x12,
-  0x12,0x12,0x14,0x14,0x14,0x16,0x14,0x14,0x12,0x13,0x15,0x16,0x13,0x14,0x19,0x15,
-  0x13,0x24,0x15,0x03,0x48,0x2C,0x06,0x6F,0x48,0x18,0x74,0x4A,0x12,0x65,0x42,0x19,
-  0x58,0x40,0x1F,0x5E,0x43,0x1E,0x69,0x47,0x21,0x68,0x3F,0x15,0x6C,0x3F,0x15,0x6B,
-  0x3F,0x14,0x67,0x3E,0x13,0x69,0x3E,0x14,0x6A,0x3D,0x12,0x6C,0x3A,0x14,0x6B,0x3C,
-  0x13,0x68,0x3D,0x10,0x69,0x40,0x12,0x6A,0x3D,0x11,0x6E,0x3E,0x12,0x6D,0x3D,0x13,
-  0x6C,0x3C,0x12,0x6D,0x3D,0x13,0x6B,0x3D,0x13,0x6C,0x3F,0x14,0x6D,0x40,0x12,0x6B,
-  0x40,0x13,0x6E,0x42,0x13,0x6E,0x42,0x0F,0x6F,0x44,0x12,0x6D,0x45,0x16,0x63,0x44,
-  0x1C,0x32,0x23,0x0A,0x1A,0x15,0x0A,0x13,0x15,0x13,0x14,0x14,0x15,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x12,0x12,0x12,
-  0x14,0x14,0x14,0x12,0x12,0x12,0x14,0x14,0x14,0x13,0x13,0x13,0x15,0x15,0x15,0x13,
-  0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x12,0x12,0x12,0x14,0x14,0x14,0x13,0x13,
-  0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,
-  0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x12,
-  0x12,0x12,0x13,0x13,0x13,0x15,0x14,0x15,0x15,0x13,0x15,0x20,0x16,0x0C,0x2C,0x17,
-  0x01,0x55,0x37,0x10,0x72,0x4A,0x13,0x6F,0x49,0x10,0x65,0x42,0x1C,0x4C,0x3D,0x27,
-  0x42,0x43,0x35,0x5F,0x50,0x37,0x68,0x43,0x1F,0x6A,0x3D,0x19,0x69,0x3E,0x16,0x66,
-  0x3F,0x12,0x66,0x3D,0x12,0x68,0x3D,0x12,0x69,0x3C,0x10,0x68,0x3A,0x11,0x67,0x3B,
-  0x12,0x65,0x3B,0x11,0x66,0x3B,0x12,0x69,0x3D,0x14,0x6B,0x3A,0x13,0x69,0x3C,0x12,
-  0x69,0x3D,0x11,0x69,0x3D,0x11,0x6C,0x3B,0x15,0x6D,0x3C,0x14,0x6E,0x3E,0x13,0x6B,
-  0x3F,0x13,0x6B,0x3F,0x15,0x6A,0x3F,0x12,0x6E,0x3F,0x11,0x73,0x42,0x11,0x6C,0x44,
-  0x12,0x6A,0x47,0x1E,0x3E,0x2B,0x12,0x18,0x17,0x07,0x17,0x17,0x13,0x14,0x14,0x16,
-  0x12,0x15,0x14,0x15,0x14,0x15,0x14,0x14,0x14,0x13,0x13,0x13,0x15,0x15,0x15,0x15,
-  0x15,0x15,0x16,0x16,0x16,0x15,0x15,0x15,0x13,0x13,0x13,0x15,0x15,0x15,0x14,0x14,
-  0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x13,
-  0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x12,0x12,0x12,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,
-  0x12,0x12,0x12,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x11,0x14,0x15,0x11,
-  0x13,0x15,0x12,0x12,0x15,0x11,0x15,0x14,0x1B,0x17,0x0C,0x2A,0x1B,0x00,0x5E,0x41,
-  0x17,0x73,0x4B,0x14,0x75,0x47,0x11,0x69,0x44,0x17,0x50,0x3E,0x27,0x39,0x40,0x3D,
-  0x44,0x5B,0x55,0x54,0x4B,0x36,0x63,0x3A,0x1A,0x6A,0x3B,0x17,0x69,0x3C,0x13,0x67,
-  0x3D,0x10,0x65,0x3D,0x12,0x67,0x3B,0x12,0x67,0x3A,0x11,0x6A,0x39,0x13,0x66,0x39,
-  0x11,0x66,0x3C,0x12,0x65,0x3B,0x12,0x66,0x3A,0x11,0x6A,0x3A,0x12,0x68,0x3B,0x12,
-  0x65,0x3C,0x0F,0x6B,0x3B,0x12,0x69,0x39,0x10,0x6A,0x3A,0x10,0x6B,0x3C,0x11,0x6F,
-  0x3D,0x13,0x6E,0x3B,0x12,0x70,0x3E,0x14,0x70,0x3F,0x15,0x6C,0x3F,0x13,0x6D,0x41,
-  0x13,0x72,0x43,0x13,0x6A,0x47,0x19,0x46,0x34,0x1A,0x1A,0x15,0x07,0x16,0x16,0x12,
-  0x11,0x15,0x17,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x17,0x15,0x15,0x16,0x14,0x14,0x13,0x14,0x14,0x14,0x14,
-  0x14,0x12,0x12,0x12,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x15,0x15,0x15,
-  0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x12,0x12,0x12,0x13,
-  0x13,0x13,0x13,0x13,0x13,0x15,0x15,0x15,0x13,0x13,0x13,0x13,0x13,0x13,0x15,0x15,
-  0x15,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x12,0x12,0x12,0x13,0x13,0x13,
-  0x12,0x12,0x12,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x15,0x15,0x12,
-  0x13,0x14,0x19,0x14,0x12,0x1D,0x14,0x0E,0x2C,0x19,0x00,0x61,0x43,0x12,0x71,0x4A,
-  0x13,0x73,0x49,0x0D,0x6F,0x45,0x12,0x63,0x3F,0x21,0x3A,0x3A,0x35,0x34,0x4E,0x54,
-  0x3A,0x53,0x51,0x4B,0x3F,0x26,0x6A,0x3C,0x15,0x66,0x3A,0x14,0x61,0x3C,0x16,0x5E,
-  0x3C,0x11,0x61,0x3D,0x13,0x65,0x3B,0x11,0x6D,0x3B,0x13,0x69,0x37,0x15,0x66,0x37,
-  0x13,0x64,0x3A,0x11,0x63,0x39,0x12,0x65,0x3A,0x14,0x67,0x39,0x13,0x67,0x39,0x14,
-  0x67,0x3A,0x12,0x6A,0x3A,0x16,0x67,0x39,0x11,0x67,0x3B,0x10,0x67,0x3C,0x10,0x6A,
-  0x3A,0x11,0x6B,0x3B,0x15,0x6A,0x3B,0x12,0x6F,0x3D,0x13,0x70,0x3F,0x14,0x70,0x3F,
-  0x14,0x70,0x40,0x0F,0x6E,0x43,0x0F,0x69,0x46,0x19,0x45,0x34,0x13,0x1E,0x16,0x07,
-  0x17,0x15,0x16,0x14,0x15,0x15,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x13,
-  0x13,0x13,0x14,0x14,0x14,0x16,0x14,0x14,0x13,0x13,0x13,0x15,0x14,0x14,0x13,0x13,
-  0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x15,0x15,0x15,0x15,0x15,0x15,0x12,0x12,0x12,0x13,0x13,0x13,0x13,
-  0x13,0x13,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,
-  0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x12,0x12,0x12,0x14,0x14,0x14,
-  0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x14,0x14,0x14,
-  0x15,0x16,0x1D,0x15,0x0D,0x2B,0x17,0x00,0x62,0x43,0x14,0x75,0x4A,0x12,0x76,0x45,
-  0x12,0x73,0x45,0x0F,0x67,0x44,0x15,0x4E,0x3F,0x29,0x25,0x3E,0x44,0x2E,0x52,0x5F,
-  0x32,0x52,0x4F,0x47,0x3D,0x22,0x63,0x3C,0x16,0x5F,0x39,0x18,0x3E,0x1F,0x02,0x48,
-  0x26,0x04,0x62,0x38,0x11,0x64,0x37,0x11,0x67,0x38,0x13,0x69,0x39,0x13,0x66,0x37,
-  0x14,0x65,0x37,0x17,0x5C,0x37,0x16,0x61,0x3A,0x19,0x62,0x37,0x18,0x65,0x39,0x13,
-  0x6A,0x39,0x10,0x68,0x3A,0x13,0x64,0x3A,0x10,0x65,0x3B,0x11,0x64,0x3A,0x0F,0x67,
-  0x3C,0x11,0x67,0x3B,0x11,0x67,0x3D,0x10,0x69,0x3C,0x14,0x6C,0x3E,0x14,0x6E,0x3E,
-  0x12,0x6B,0x3F,0x14,0x6E,0x3F,0x10,0x70,0x46,0x10,0x64,0x47,0x17,0x42,0x33,0x17,
-  0x18,0x15,0x0A,0x15,0x15,0x16,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x15,0x14,0x14,0x17,0x15,0x15,0x15,0x14,
-  0x14,0x12,0x12,0x12,0x12,0x12,0x12,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,
-  0x15,0x15,0x15,0x14,0x14,0x14,0x15,0x15,0x15,0x13,0x13,0x13,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x12,0x12,
-  0x12,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,
-  0x14,0x13,0x13,0x12,0x14,0x14,0x17,0x14,0x13,0x12,0x14,0x14,0x15,0x14,0x16,0x1A,
-  0x15,0x12,0x2B,0x18,0x00,0x53,0x37,0x0E,0x6F,0x4C,0x14,0x75,0x49,0x0D,0x73,0x46,
-  0x12,0x70,0x46,0x0E,0x64,0x3F,0x1D,0x36,0x37,0x2F,0x20,0x4C,0x61,0x1F,0x4D,0x69,
-  0x1E,0x4B,0x57,0x34,0x3D,0x31,0x4E,0x35,0x19,0x40,0x22,0x02,0x54,0x35,0x13,0x64,
-  0x38,0x15,0x66,0x3A,0x13,0x67,0x3A,0x14,0x66,0x3A,0x11,0x67,0x38,0x12,0x69,0x3A,
-  0x14,0x5D,0x38,0x19,0x41,0x20,0x00,0x50,0x2E,0x0E,0x5E,0x37,0x14,0x62,0x37,0x12,
-  0x68,0x39,0x14,0x67,0x38,0x14,0x64,0x36,0x11,0x63,0x39,0x11,0x67,0x39,0x14,0x67,
-  0x3C,0x11,0x67,0x3B,0x11,0x67,0x39,0x0F,0x67,0x3D,0x11,0x68,0x3D,0x10,0x6D,0x3E,
-  0x14,0x6B,0x40,0x13,0x6E,0x3F,0x12,0x71,0x44,0x10,0x6E,0x45,0x10,0x67,0x4A,0x20,
-  0x36,0x29,0x12,0x1C,0x15,0x0E,0x15,0x16,0x14,0x14,0x14,0x15,0x14,0x13,0x13,0x13,
-  0x13,0x13,0x15,0x14,0x15,0x11,0x16,0x15,0x14,0x13,0x13,0x19,0x13,0x15,0x15,0x14,
-  0x14,0x13,0x13,0x13,0x15,0x15,0x15,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,
-  0x15,0x15,0x15,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x12,0x12,
-  0x12,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x15,0x14,0x14,0x14,0x18,0x16,0x0F,0x23,
-  0x16,0x05,0x49,0x2A,0x06,0x77,0x50,0x17,0x74,0x49,0x0D,0x75,0x49,0x0E,0x6D,0x44,
-  0x0F,0x6C,0x43,0x15,0x59,0x3B,0x24,0x2F,0x3C,0x43,0x17,0x4F,0x70,0x0F,0x4C,0x6F,
-  0x15,0x4F,0x67,0x2A,0x4F,0x53,0x4B,0x3F,0x2C,0x57,0x36,0x18,0x64,0x3A,0x12,0x66,
-  0x3A,0x12,0x64,0x3B,0x14,0x65,0x3A,0x14,0x65,0x3A,0x10,0x66,0x3B,0x11,0x61,0x37,
-  0x12,0x57,0x39,0x1D,0x4D,0x36,0x1F,0x43,0x32,0x1D,0x49,0x34,0x1E,0x51,0x37,0x1B,
-  0x5F,0x38,0x18,0x68,0x39,0x15,0x66,0x39,0x13,0x66,0x39,0x13,0x65,0x38,0x12,0x65,
-  0x38,0x11,0x67,0x39,0x12,0x67,0x39,0x12,0x66,0x3C,0x11,0x68,0x3C,0x0F,0x6C,0x3C,
-  0x12,0x6E,0x3D,0x12,0x71,0x3F,0x12,0x71,0x41,0x0C,0x6E,0x42,0x0E,0x6D,0x46,0x13,
-  0x65,0x4D,0x20,0x2D,0x21,0x0B,0x15,0x16,0x10,0x12,0x16,0x18,0x14,0x15,0x15,0x15,
-  0x15,0x15,0x14,0x14,0x14,0x12,0x13,0x13,0x15,0x15,0x15,0x17,0x14,0x14,0x16,0x15,
-  0x15,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,
-  0x15,0x15,0x15,0x12,0x12,0x12,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x12,0x12,0x12,0x14,0x14,0x14,0x12,0x12,
-  0x12,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x12,0x12,0x12,0x13,0x13,0x13,
-  0x15,0x15,0x15,0x16,0x14,0x12,0x12,0x12,0x17,0x14,0x14,0x14,0x21,0x16,0x09,0x34,
-  0x1D,0x00,0x71,0x4D,0x1A,0x73,0x4A,0x11,0x76,0x46,0x11,0x76,0x45,0x11,0x6F,0x41,
-  0x14,0x67,0x3D,0x18,0x49,0x3B,0x27,0x27,0x41,0x4D,0x11,0x50,0x74,0x0E,0x4C,0x70,
-  0x10,0x51,0x6B,0x28,0x54,0x65,0x39,0x49,0x41,0x43,0x35,0x1A,0x64,0x3A,0x0F,0x65,
-  0x3B,0x12,0x62,0x39,0x12,0x63,0x39,0x13,0x64,0x3A,0x10,0x64,0x39,0x12,0x61,0x39,
-  0x1A,0x42,0x27,0x13,0x23,0x16,0x0D,0x17,0x15,0x0E,0x17,0x12,0x0B,0x38,0x29,0x19,
-  0x52,0x36,0x1E,0x5F,0x38,0x18,0x67,0x3A,0x15,0x6A,0x39,0x14,0x67,0x3A,0x14,0x65,
-  0x38,0x17,0x66,0x3A,0x1A,0x66,0x3C,0x1C,0x65,0x3B,0x16,0x66,0x3C,0x13,0x68,0x39,
-  0x15,0x6C,0x3B,0x16,0x6C,0x3C,0x1A,0x63,0x3D,0x16,0x64,0x40,0x14,0x70,0x46,0x12,
-  0x6C,0x4A,0x12,0x5A,0x44,0x1C,0x18,0x16,0x07,0x16,0x16,0x16,0x16,0x16,0x16,0x14,
-  0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x16,0x16,0x16,0x17,0x14,0x14,0x13,0x13,
-  0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x13,0x13,0x13,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,
-  0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,
-  0x14,0x14,0x14,0x14,0x13,0x14,0x0E,0x14,0x15,0x18,0x18,0x0F,0x2A,0x19,0x03,0x5B,
-  0x3D,0x13,0x76,0x4C,0x16,0x72,0x4A,0x12,0x74,0x46,0x10,0x73,0x42,0x10,0x6C,0x41,
-  0x11,0x65,0x3C,0x1D,0x42,0x38,0x2D,0x21,0x46,0x58,0x11,0x4F,0x73,0x10,0x4F,0x74,
-  0x12,0x55,0x71,0x20,0x4F,0x6E,0x2C,0x56,0x5F,0x45,0x51,0x46,0x52,0x34,0x17,0x63,
-  0x38,0x16,0x65,0x3B,0x11,0x63,0x39,0x12,0x66,0x3A,0x13,0x5E,0x38,0x13,0x51,0x35,
-  0x1C,0x26,0x1A,0x0C,0x19,0x16,0x11,0x16,0x16,0x15,0x14,0x16,0x14,0x19,0x15,0x0E,
-  0x29,0x21,0x12,0x41,0x2F,0x17,0x55,0x36,0x1A,0x5E,0x38,0x19,0x5C,0x39,0x1A,0x52,
-  0x38,0x1C,0x46,0x32,0x1A,0x3B,0x21,0x0E,0x4A,0x30,0x15,0x62,0x3B,0x17,0x67,0x39,
-  0x10,0x66,0x3C,0x16,0x5C,0x38,0x1E,0x4E,0x47,0x33,0x43,0x46,0x36,0x4B,0x3E,0x22,
-  0x67,0x45,0x18,0x68,0x4C,0x19,0x41,0x32,0x17,0x16,0x15,0x11,0x14,0x15,0x16,0x15,
-  0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,
-  0x13,0x15,0x15,0x15,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,
-  0x14,0x14,0x14,0x15,0x15,0x15,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x14,
-  0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x15,0x15,
-  0x15,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,
-  0x13,0x13,0x13,0x11,0x14,0x14,0x12,0x16,0x13,0x1C,0x17,0x06,0x44,0x2A,0x05,0x79,
-  0x51,0x19,0x7A,0x4B,0x11,0x77,0x48,0x14,0x76,0x46,0x10,0x73,0x42,0x11,0x6C,0x42,
-  0x17,0x5E,0x3D,0x1F,0x38,0x39,0x32,0x22,0x51,0x68,0x10,0x52,0x75,0x13,0x53,0x77,
-  0x11,0x55,0x76,0x19,0x56,0x7A,0x20,0x59,0x72,0x3A,0x5B,0x65,0x45,0x3C,0x2B,0x5A,
-  0x37,0x1A,0x63,0x38,0x12,0x65,0x39,0x12,0x63,0x38,0x15,0x5D,0x38,0x1B,0x3A,0x24,
-  0x13,0x1D,0x17,0x11,0x17,0x15,0x17,0x12,0x15,0x15,0x13,0x14,0x14,0x14,0x14,0x13,
-  0x15,0x15,0x0F,0x1D,0x17,0x0F,0x2F,0x27,0x1D,0x39,0x2F,0x23,0x36,0x2B,0x1F,0x1E,
-  0x15,0x11,0x18,0x13,0x0E,0x1A,0x15,0x0C,0x2E,0x22,0x11,0x5B,0x3A,0x1C,0x68,0x3A,
-  0x11,0x65,0x39,0x13,0x57,0x36,0x21,0x35,0x40,0x44,0x36,0x5F,0x70,0x47,0x62,0x65,
-  0x4D,0x47,0x2B,0x60,0x45,0x17,0x63,0x4C,0x24,0x22,0x19,0x0A,0x18,0x17,0x13,0x15,
-  0x16,0x16,0x14,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,
-  0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x15,0x15,0x15,0x15,0x15,0x15,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x13,
-  0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,
-  0x14,0x13,0x13,0x13,0x12,0x12,0x12,0x14,0x14,0x13,0x14,0x14,0x14,0x15,0x15,0x14,
-  0x13,0x13,0x13,0x15,0x14,0x14,0x18,0x15,0x10,0x25,0x18,0x00,0x68,0x48,0x17,0x7C,
-  0x4F,0x0F,0x7A,0x4C,0x11,0x78,0x48,0x15,0x75,0x45,0x11,0x6E,0x43,0x12,0x69,0x3F,
-  0x18,0x58,0x3D,0x21,0x30,0x3B,0x3A,0x21,0x53,0x70,0x12,0x53,0x77,0x18,0x55,0x7A,
-  0x16,0x58,0x7A,0x19,0x5B,0x7B,0x23,0x5E,0x78,0x35,0x63,0x79,0x5A,0x64,0x5A,0x53,
-  0x37,0x22,0x62,0x36,0x14,0x67,0x38,0x11,0x62,0x36,0x16,0x56,0x35,0x1D,0x2B,0x19,
-  0x0A,0x21,0x17,0x15,0x19,0x14,0x18,0x15,0x15,0x13,0x18,0x13,0x14,0x17,0x12,0x15,
-  0x14,0x15,0x16,0x15,0x14,0x16,0x10,0x11,0x11,0x10,0x11,0x0D,0x16,0x14,0x12,0x11,
-  0x12,0x14,0x15,0x13,0x16,0x15,0x14,0x14,0x19,0x17,0x0A,0x4C,0x33,0x19,0x61,0x37,
-  0x15,0x64,0x3C,0x16,0x59,0x39,0x22,0x26,0x37,0x3E,0x23,0x59,0x72,0x29,0x5D,0x74,
-  0x53,0x67,0x64,0x4D,0x45,0x29,0x63,0x4B,0x1D,0x4B,0x3D,0x1A,0x1A,0x17,0x0C,0x14,
-  0x16,0x16,0x16,0x15,0x16,0x15,0x14,0x14,0x15,0x15,0x15,0x13,0x13,0x13,0x13,0x13,
-  0x13,0x15,0x15,0x15,0x13,0x13,0x13,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x13,
-  0x13,0x13,0x12,0x12,0x12,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x15,
-  0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x12,0x13,0x12,0x14,0x13,0x14,0x14,0x15,0x13,
-  0x12,0x12,0x14,0x13,0x13,0x13,0x1F,0x1A,0x09,0x42,0x28,0x07,0x7B,0x53,0x1A,0x7D,
-  0x50,0x0F,0x76,0x4A,0x10,0x79,0x47,0x13,0x71,0x44,0x10,0x6D,0x41,0x15,0x66,0x3E,
-  0x18,0x4F,0x39,0x25,0x2F,0x3E,0x44,0x20,0x56,0x76,0x14,0x55,0x7A,0x19,0x58,0x80,
-  0x1B,0x5C,0x80,0x1A,0x5F,0x7F,0x23,0x60,0x7E,0x2D,0x64,0x7D,0x4B,0x66,0x63,0x41,
-  0x31,0x19,0x63,0x37,0x13,0x64,0x37,0x0F,0x61,0x35,0x15,0x55,0x30,0x1A,0x2D,0x17,
-  0x08,0x1F,0x19,0x11,0x15,0x15,0x14,0x17,0x14,0x16,0x14,0x15,0x14,0x13,0x13,0x13,
-  0x15,0x15,0x15,0x14,0x14,0x14,0x12,0x12,0x12,0x15,0x15,0x15,0x14,0x14,0x15,0x12,
-  0x12,0x14,0x14,0x14,0x14,0x13,0x15,0x14,0x15,0x16,0x0D,0x33,0x20,0x11,0x5D,0x37,
-  0x18,0x60,0x39,0x14,0x58,0x38,0x1D,0x2D,0x3C,0x41,0x21,0x59,0x75,0x16,0x57,0x7A,
-  0x3B,0x65,0x74,0x5A,0x65,0x5A,0x56,0x45,0x19,0x5E,0x4D,0x24,0x20,0x1B,0x09,0x13,
-  0x16,0x16,0x16,0x15,0x16,0x15,0x14,0x14,0x15,0x15,0x15,0x15,0x15,0x15,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x13,0x13,0x13,0x15,0x15,0x15,0x13,0x13,0x13,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,
-  0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x12,0x13,0x13,0x19,0x15,0x0F,0x26,0x17,0x00,0x67,0x43,0x17,0x7C,0x52,0x11,0x7A,
-  0x4F,0x0E,0x74,0x48,0x12,0x79,0x45,0x14,0x73,0x44,0x12,0x6C,0x40,0x15,0x68,0x3E,
-  0x1B,0x42,0x35,0x27,0x2E,0x4B,0x53,0x1C,0x58,0x79,0x18,0x5B,0x7F,0x1A,0x5C,0x82,
-  0x1C,0x5F,0x82,0x1D,0x61,0x82,0x23,0x64,0x82,0x29,0x63,0x84,0x45,0x6D,0x7B,0x38,
-  0x3E,0x3D,0x43,0x2D,0x18,0x54,0x31,0x13,0x5E,0x34,0x16,0x5E,0x36,0x1B,0x38,0x1D,
-  0x09,0x1E,0x18,0x0F,0x19,0x16,0x14,0x17,0x14,0x15,0x13,0x16,0x13,0x15,0x15,0x15,
-  0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x14,0x15,0x15,0x15,0x14,
-  0x13,0x15,0x14,0x14,0x14,0x14,0x15,0x14,0x14,0x15,0x12,0x25,0x18,0x0B,0x52,0x32,
-  0x15,0x62,0x39,0x14,0x58,0x38,0x1D,0x2F,0x38,0x3E,0x2B,0x59,0x75,0x14,0x56,0x79,
-  0x22,0x5D,0x77,0x45,0x6E,0x76,0x51,0x52,0x3A,0x5B,0x4D,0x2C,0x34,0x34,0x1F,0x13,
-  0x17,0x13,0x15,0x16,0x16,0x16,0x15,0x16,0x14,0x14,0x14,0x13,0x13,0x13,0x16,0x16,
-  0x16,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x15,0x15,0x15,0x13,0x13,0x13,
-  0x13,0x13,0x13,0x15,0x15,0x15,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x13,
-  0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x13,0x16,
-  0x12,0x13,0x14,0x1D,0x17,0x0B,0x30,0x1E,0x00,0x76,0x55,0x1A,0x7A,0x53,0x10,0x7B,
-  0x4F,0x10,0x7A,0x48,0x10,0x76,0x44,0x0F,0x71,0x42,0x0F,0x6E,0x42,0x14,0x61,0x3D,
-  0x1A,0x3B,0x34,0x2B,0x2C,0x4C,0x59,0x1D,0x59,0x7A,0x20,0x5E,0x83,0x1F,0x5F,0x83,
-  0x22,0x62,0x85,0x23,0x63,0x85,0x26,0x65,0x87,0x28,0x68,0x88,0x31,0x6D,0x8B,0x43,
-  0x76,0x8C,0x47,0x65,0x69,0x59,0x54,0x45,0x4E,0x31,0x18,0x62,0x32,0x1B,0x59,0x32,
-  0x1A,0x2D,0x19,0x0B,0x1F,0x19,0x0F,0x1A,0x14,0x14,0x17,0x13,0x16,0x14,0x15,0x14,
-  0x13,0x14,0x14,0x13,0x13,0x13,0x15,0x13,0x15,0x15,0x13,0x16,0x14,0x13,0x16,0x15,
-  0x14,0x16,0x13,0x14,0x14,0x15,0x16,0x16,0x17,0x13,0x12,0x20,0x15,0x07,0x50,0x31,
-  0x10,0x61,0x3A,0x14,0x59,0x38,0x1D,0x32,0x34,0x3A,0x28,0x59,0x76,0x11,0x56,0x7A,
-  0x19,0x59,0x78,0x2F,0x66,0x7B,0x6B,0x7B,0x75,0x45,0x45,0x2D,0x69,0x6F,0x57,0x0D,
-  0x11,0x07,0x17,0x16,0x16,0x16,0x15,0x16,0x16,0x16,0x16,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,
-  0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x15,0x15,0x15,0x13,0x13,0x13,0x13,
-  0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x12,0x12,0x12,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x14,0x14,0x13,0x13,0x15,
-  0x16,0x14,0x11,0x20,0x17,0x05,0x4E,0x35,0x0C,0x7A,0x55,0x17,0x79,0x51,0x0D,0x7A,
-  0x4C,0x11,0x75,0x46,0x10,0x74,0x43,0x12,0x71,0x43,0x0F,0x6C,0x40,0x13,0x5F,0x3D,
-  0x1C,0x37,0x34,0x2F,0x2E,0x55,0x66,0x1E,0x5E,0x83,0x1F,0x61,0x84,0x23,0x63,0x86,
-  0x22,0x64,0x87,0x26,0x68,0x8B,0x27,0x69,0x8C,0x2D,0x6B,0x8F,0x31,0x71,0x98,0x31,
-  0x74,0x92,0x45,0x7C,0x90,0x6B,0x83,0x85,0x46,0x38,0x25,0x63,0x32,0x18,0x65,0x34,
-  0x1A,0x44,0x2C,0x17,0x24,0x18,0x09,0x1D,0x17,0x11,0x17,0x14,0x15,0x17,0x15,0x14,
-  0x15,0x13,0x15,0x14,0x12,0x17,0x11,0x14,0x16,0x17,0x12,0x18,0x15,0x15,0x14,0x13,
-  0x14,0x14,0x12,0x15,0x10,0x1A,0x14,0x0C,0x22,0x14,0x08,0x39,0x21,0x0D,0x5C,0x37,
-  0x17,0x62,0x39,0x13,0x54,0x38,0x1D,0x2E,0x31,0x36,0x28,0x5A,0x78,0x15,0x59,0x7B,
-  0x19,0x56,0x79,0x28,0x61,0x7A,0x57,0x77,0x76,0x45,0x4A,0x37,0x77,0x7D,0x63,0x18,
-  0x19,0x0E,0x14,0x18,0x16,0x16,0x16,0x17,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x13,
-  0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,
-  0x13,0x13,0x13,0x13,0x12,0x12,0x12,0x12,0x12,0x12,0x14,0x13,0x14,0x11,0x13,0x13,
-  0x18,0x14,0x0C,0x21,0x18,0x01,0x6B,0x50,0x19,0x7D,0x53,0x0D,0x7B,0x51,0x0F,0x7B,
-  0x4B,0x10,0x75,0x43,0x10,0x74,0x44,0x12,0x70,0x42,0x12,0x60,0x3F,0x19,0x4D,0x3B,
-  0x23,0x22,0x37,0x3D,0x2A,0x5E,0x79,0x22,0x61,0x89,0x25,0x64,0x8B,0x25,0x65,0x8C,
-  0x26,0x67,0x8D,0x2A,0x6B,0x91,0x2E,0x6F,0x95,0x34,0x71,0x96,0x33,0x74,0x9B,0x37,
-  0x7A,0x9F,0x40,0x7E,0x9B,0x63,0x88,0x95,0x61,0x5B,0x52,0x5F,0x31,0x17,0x67,0x34,
-  0x15,0x5F,0x37,0x1B,0x49,0x2C,0x16,0x27,0x19,0x0E,0x1E,0x17,0x13,0x1C,0x14,0x13,
-  0x19,0x16,0x10,0x18,0x15,0x13,0x15,0x15,0x15,0x14,0x13,0x15,0x14,0x14,0x15,0x11,
-  0x14,0x15,0x19,0x16,0x0F,0x2F,0x19,0x0D,0x53,0x33,0x19,0x5E,0x39,0x17,0x67,0x3A,
-  0x11,0x64,0x3B,0x10,0x54,0x39,0x1C,0x2D,0x36,0x3B,0x2E,0x61,0x7F,0x16,0x5A,0x7C,
-  0x17,0x5A,0x7B,0x1E,0x5D,0x7F,0x41,0x6E,0x7C,0x50,0x62,0x60,0x52,0x57,0x45,0x3F,
-  0x42,0x34,0x12,0x17,0x12,0x18,0x18,0x18,0x16,0x16,0x16,0x15,0x15,0x15,0x15,0x15,
-  0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x12,0x12,0x12,0x12,0x12,0x12,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x13,0x13,0x11,0x14,0x12,
-  0x1C,0x16,0x0A,0x2E,0x1B,0x00,0x7B,0x58,0x1B,0x7C,0x52,0x0F,0x7B,0x50,0x10,0x7A,
-  0x48,0x0F,0x77,0x44,0x11,0x72,0x42,0x14,0x69,0x3C,0x1A,0x47,0x37,0x29,0x2D,0x3A,
-  0x40,0x28,0x5B,0x76,0x23,0x62,0x85,0x25,0x65,0x88,0x28,0x66,0x89,0x28,0x6B,0x8D,
-  0x2B,0x6C,0x92,0x30,0x71,0x98,0x33,0x74,0x9B,0x35,0x77,0x9E,0x37,0x7D,0x9F,0x3E,
-  0x80,0xA1,0x4A,0x82,0x9F,0x5D,0x8A,0x9A,0x6A,0x6F,0x65,0x5B,0x2E,0x17,0x64,0x34,
-  0x15,0x61,0x35,0x14,0x5B,0x33,0x1B,0x2F,0x1C,0x0A,0x27,0x17,0x0B,0x35,0x20,0x15,
-  0x30,0x20,0x10,0x24,0x14,0x0E,0x1A,0x13,0x13,0x17,0x14,0x16,0x16,0x12,0x14,0x19,
-  0x15,0x11,0x24,0x17,0x08,0x4E,0x2D,0x13,0x60,0x35,0x17,0x61,0x38,0x11,0x65,0x39,
-  0x13,0x65,0x3B,0x14,0x55,0x38,0x1A,0x3C,0x3E,0x40,0x35,0x66,0x7D,0x1D,0x5C,0x7F,
-  0x19,0x5B,0x82,0x1C,0x5B,0x82,0x2B,0x67,0x7D,0x58,0x7D,0x84,0x45,0x51,0x43,0x6C,
-  0x73,0x60,0x11,0x11,0x0D,0x17,0x17,0x17,0x16,0x17,0x16,0x14,0x14,0x14,0x15,0x15,
-  0x15,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x15,0x15,0x15,0x15,0x15,0x15,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x13,
-  0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,
-  0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x14,0x14,0x15,0x14,0x12,0x14,0x15,0x14,
-  0x1E,0x16,0x08,0x3D,0x25,0x03,0x7D,0x59,0x16,0x7E,0x50,0x12,0x7D,0x4F,0x10,0x7D,
-  0x4A,0x0C,0x76,0x44,0x13,0x6E,0x42,0x18,0x57,0x3A,0x26,0x28,0x36,0x40,0x33,0x5D,
-  0x77,0x21,0x62,0x87,0x27,0x65,0x89,0x29,0x69,0x8A,0x2C,0x6C,0x8F,0x2C,0x6D,0x94,
-  0x2E,0x72,0x99,0x39,0x75,0x9E,0x37,0x7B,0xA2,0x3A,0x7E,0xA5,0x3B,0x81,0xA5,0x40,
-  0x84,0xA6,0x47,0x87,0xA3,0x5F,0x90,0xA1,0x6F,0x75,0x70,0x51,0x2C,0x1A,0x66,0x34,
-  0x19,0x63,0x33,0x17,0x61,0x36,0x1D,0x4A,0x27,0x0F,0x35,0x17,0x00,0x4B,0x2C,0x16,
-  0x55,0x32,0x1E,0x3C,0x26,0x15,0x23,0x1A,0x0D,0x1F,0x17,0x12,0x28,0x1B,0x0E,0x2A,
-  0x16,0x07,0x46,0x28,0x0D,0x60,0x36,0x15,0x64,0x37,0x14,0x65,0x39,0x15,0x66,0x39,
-  0x14,0x66,0x39,0x12,0x5A,0x3C,0x18,0x3A,0x34,0x29,0x3C,0x65,0x72,0x25,0x5E,0x7F,
-  0x1A,0x5B,0x84,0x13,0x5D,0x82,0x25,0x62,0x84,0x41,0x74,0x83,0x6C,0x80,0x74,0x64,
-  0x69,0x4E,0x18,0x16,0x0B,0x17,0x18,0x18,0x16,0x15,0x18,0x14,0x14,0x13,0x14,0x14,
-  0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,
-  0x14,0x14,0x14,0x15,0x15,0x15,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x11,0x11,0x11,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x13,0x13,0x13,0x12,0x13,0x13,0x17,0x15,0x13,
-  0x23,0x16,0x04,0x53,0x34,0x0E,0x80,0x57,0x14,0x80,0x52,0x10,0x7D,0x4E,0x10,0x78,
-  0x48,0x0D,0x71,0x43,0x15,0x69,0x41,0x17,0x42,0x36,0x2C,0x2D,0x4E,0x63,0x27,0x62,
-  0x85,0x20,0x63,0x8B,0x27,0x68,0x8C,0x2C,0x6C,0x8F,0x30,0x6F,0x94,0x31,0x72,0x98,
-  0x32,0x77,0x9D,0x39,0x7B,0xA1,0x39,0x7D,0xA3,0x3D,0x83,0xA9,0x3E,0x85,0xA9,0x42,
-  0x89,0xAA,0x4D,0x8C,0xAB,0x5B,0x91,0xA7,0x64,0x80,0x81,0x44,0x30,0x22,0x5F,0x33,
-  0x1C,0x66,0x32,0x17,0x60,0x32,0x17,0x63,0x37,0x1E,0x4C,0x20,0x09,0x58,0x2F,0x18,
-  0x5B,0x32,0x19,0x49,0x29,0x10,0x31,0x16,0x04,0x33,0x15,0x06,0x4E,0x2B,0x15,0x5A,
-  0x32,0x14,0x62,0x36,0x15,0x66,0x35,0x14,0x67,0x36,0x13,0x68,0x39,0x14,0x66,0x3B,
-  0x15,0x69,0x3B,0x11,0x63,0x3D,0x16,0x48,0x35,0x25,0x32,0x4B,0x56,0x2F,0x65,0x80,
-  0x1D,0x5E,0x83,0x16,0x5D,0x81,0x22,0x61,0x81,0x3A,0x71,0x83,0x73,0x8D,0x7E,0x58,
-  0x56,0x35,0x2B,0x22,0x0F,0x17,0x18,0x16,0x16,0x15,0x17,0x14,0x13,0x14,0x13,0x13,
-  0x13,0x13,0x13,0x13,0x12,0x12,0x12,0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,
-  0x15,0x15,0x15,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,
-  0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x11,0x12,0x14,0x18,0x15,0x12,
-  0x27,0x16,0x01,0x63,0x44,0x18,0x80,0x58,0x12,0x7C,0x53,0x0C,0x7C,0x4D,0x10,0x79,
-  0x49,0x10,0x6E,0x45,0x19,0x59,0x3D,0x1F,0x2D,0x34,0x3C,0x2C,0x5F,0x7D,0x27,0x65,
-  0x89,0x28,0x66,0x8E,0x2D,0x6C,0x91,0x30,0x6E,0x96,0x33,0x72,0x98,0x36,0x77,0x9D,
-  0x37,0x7D,0xA1,0x3A,0x80,0xA5,0x3C,0x81,0xA6,0x42,0x86,0xAC,0x45,0x8B,0xAF,0x4C,
-  0x90,0xB1,0x52,0x91,0xB2,0x56,0x91,0xB1,0x75,0xA0,0xB2,0x6D,0x76,0x79,0x41,0x2B,
-  0x1B,0x57,0x31,0x15,0x5D,0x35,0x1B,0x5D,0x32,0x1C,0x54,0x2E,0x1A,0x5B,0x30,0x1A,
-  0x62,0x32,0x17,0x61,0x30,0x14,0x5C,0x32,0x14,0x5F,0x31,0x16,0x62,0x33,0x17,0x61,
-  0x36,0x18,0x64,0x38,0x17,0x66,0x37,0x17,0x66,0x39,0x18,0x65,0x38,0x17,0x68,0x3A,
-  0x18,0x68,0x3B,0x16,0x65,0x3C,0x15,0x53,0x36,0x24,0x26,0x3B,0x44,0x32,0x67,0x83,
-  0x20,0x5F,0x87,0x1C,0x5F,0x81,0x25,0x60,0x81,0x39,0x6E,0x85,0x72,0x8B,0x81,0x5A,
-  0x56,0x32,0x33,0x2D,0x16,0x16,0x17,0x13,0x17,0x16,0x18,0x13,0x12,0x15,0x14,0x14,
-  0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x15,0x15,0x15,
-  0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,
-  0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x11,0x11,0x14,0x17,0x14,0x11,
-  0x27,0x16,0x00,0x6D,0x4D,0x1B,0x80,0x55,0x13,0x80,0x54,0x0E,0x7E,0x4C,0x13,0x79,
-  0x45,0x10,0x6A,0x44,0x1B,0x4C,0x3B,0x25,0x2F,0x46,0x57,0x29,0x65,0x84,0x23,0x65,
-  0x8D,0x29,0x6A,0x91,0x2E,0x6F,0x96,0x32,0x73,0x99,0x35,0x76,0x9C,0x3B,0x7B,0xA1,
-  0x3C,0x7F,0xA6,0x40,0x84,0xA6,0x45,0x89,0xAD,0x4B,0x8B,0xB3,0x49,0x91,0xB3,0x52,
-  0x93,0xB7,0x53,0x96,0xB8,0x5A,0x9A,0xC1,0x67,0x9B,0xBA,0x94,0xAE,0xBE,0x67,0x60,
-  0x59,0x3E,0x24,0x0D,0x42,0x21,0x0C,0x4C,0x31,0x1F,0x3F,0x2B,0x1A,0x43,0x2A,0x19,
-  0x51,0x31,0x1E,0x5E,0x31,0x18,0x63,0x33,0x17,0x67,0x34,0x15,0x65,0x36,0x13,0x64,
-  0x35,0x14,0x51,0x24,0x03,0x5E,0x30,0x11,0x5C,0x32,0x11,0x5D,0x34,0x12,0x5F,0x35,
-  0x13,0x5E,0x38,0x1A,0x60,0x3A,0x19,0x4C,0x37,0x28,0x2E,0x43,0x4D,0x34,0x68,0x88,
-  0x26,0x62,0x89,0x1F,0x5E,0x84,0x23,0x5F,0x84,0x37,0x6D,0x83,0x72,0x8D,0x7E,0x59,
-  0x59,0x2E,0x3C,0x3A,0x16,0x16,0x1A,0x0F,0x16,0x16,0x17,0x15,0x14,0x16,0x14,0x14,
-  0x14,0x13,0x13,0x13,0x16,0x16,0x16,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,
-  0x15,0x15,0x15,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x13,
-  0x13,0x13,0x13,0x13,0x13,0x12,0x12,0x12,0x12,0x12,0x12,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x12,0x13,0x13,0x19,0x14,0x0F,
-  0x2B,0x17,0x00,0x76,0x57,0x1F,0x84,0x58,0x12,0x80,0x54,0x0D,0x7E,0x4D,0x10,0x7D,
-  0x48,0x14,0x64,0x42,0x21,0x3D,0x38,0x2E,0x37,0x5E,0x7A,0x1F,0x64,0x8A,0x26,0x68,
-  0x8F,0x2A,0x6C,0x93,0x2F,0x71,0x98,0x31,0x76,0x9B,0x38,0x7A,0x9F,0x3D,0x7D,0xA4,
-  0x40,0x84,0xA9,0x45,0x8B,0xAC,0x49,0x8E,0xB0,0x53,0x92,0xBA,0x53,0x96,0xBB,0x59,
-  0x9B,0xBF,0x61,0xA2,0xC3,0x64,0xA4,0xC2,0x75,0xA8,0xC0,0xAC,0xBD,0xC3,0x7F,0x72,
-  0x66,0x50,0x31,0x19,0x43,0x23,0x12,0x2C,0x19,0x0B,0x20,0x19,0x0E,0x1D,0x15,0x0D,
-  0x33,0x1E,0x13,0x56,0x30,0x1C,0x5F,0x31,0x17,0x63,0x32,0x15,0x62,0x34,0x11,0x64,
-  0x36,0x15,0x67,0x37,0x17,0x5E,0x32,0x14,0x5A,0x36,0x13,0x59,0x35,0x12,0x58,0x33,
-  0x10,0x4C,0x29,0x08,0x43,0x22,0x04,0x31,0x28,0x23,0x23,0x46,0x58,0x31,0x6A,0x8B,
-  0x22,0x61,0x88,0x1B,0x5F,0x86,0x23,0x60,0x84,0x33,0x6F,0x7F,0x71,0x8D,0x7B,0x5C,
-  0x59,0x2E,0x47,0x3F,0x1E,0x15,0x18,0x0E,0x15,0x15,0x16,0x15,0x14,0x16,0x15,0x15,
-  0x15,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x16,0x16,0x16,0x12,0x12,0x12,0x14,0x14,0x14,0x13,0x13,0x13,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,
-  0x14,0x12,0x12,0x12,0x12,0x12,0x12,0x14,0x14,0x14,0x0E,0x13,0x12,0x17,0x17,0x0E,
-  0x29,0x18,0x00,0x76,0x56,0x1F,0x86,0x5A,0x12,0x81,0x53,0x08,0x7E,0x4D,0x13,0x7C,
-  0x46,0x15,0x5C,0x40,0x21,0x3E,0x3E,0x3B,0x33,0x62,0x85,0x20,0x65,0x8E,0x26,0x69,
-  0x90,0x2B,0x6E,0x95,0x31,0x74,0x9B,0x32,0x78,0x9D,0x39,0x7E,0xA2,0x40,0x81,0xA7,
-  0x46,0x84,0xAA,0x4F,0x8F,0xB1,0x53,0x92,0xB5,0x5A,0x9A,0xBC,0x62,0x9D,0xC2,0x6A,
-  0xA5,0xC4,0x78,0xAE,0xC7,0x8D,0xB7,0xC5,0xB1,0xC1,0xC4,0x8A,0x7D,0x6D,0x47,0x29,
-  0x0F,0x4D,0x2A,0x0E,0x50,0x2E,0x17,0x33,0x1C,0x0A,0x23,0x16,0x09,0x1C,0x16,0x0D,
-  0x26,0x19,0x10,0x42,0x2A,0x1A,0x4C,0x2F,0x1C,0x57,0x31,0x19,0x5F,0x34,0x16,0x66,
-  0x37,0x15,0x67,0x35,0x15,0x62,0x38,0x18,0x50,0x2F,0x11,0x56,0x35,0x17,0x5D,0x3C,
-  0x1D,0x5D,0x3C,0x20,0x5A,0x3C,0x23,0x1B,0x20,0x20,0x25,0x54,0x6E,0x2C,0x6A,0x8C,
-  0x22,0x63,0x89,0x18,0x5F,0x85,0x23,0x5F,0x88,0x32,0x6E,0x85,0x70,0x8C,0x84,0x5C,
-  0x5A,0x33,0x47,0x41,0x1F,0x15,0x19,0x0F,0x15,0x15,0x16,0x16,0x15,0x17,0x15,0x15,
-  0x15,0x15,0x15,0x15,0x14,0x14,0x14,0x15,0x15,0x15,0x15,0x15,0x15,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x15,0x15,0x15,0x14,0x14,0x14,0x13,0x13,
-  0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x13,0x14,0x10,0x14,0x12,0x17,0x15,0x0E,
-  0x29,0x17,0x00,0x77,0x57,0x21,0x86,0x5C,0x0E,0x80,0x54,0x0C,0x81,0x4D,0x11,0x77,
-  0x48,0x13,0x63,0x43,0x1D,0x3C,0x39,0x34,0x35,0x61,0x7D,0x25,0x66,0x8E,0x25,0x6B,
-  0x93,0x2A,0x71,0x95,0x2F,0x74,0x9C,0x34,0x7B,0xA1,0x39,0x81,0xA6,0x44,0x85,0xA9,
-  0x51,0x8E,0xAF,0x56,0x93,0xB1,0x67,0xA0,0xB7,0x7B,0xA9,0xBC,0x8F,0xB0,0xBD,0xAD,
-  0xBF,0xBF,0x9B,0x9B,0x97,0x97,0x87,0x7A,0x7C,0x5C,0x49,0x51,0x25,0x0A,0x59,0x2F,
-  0x11,0x60,0x36,0x15,0x60,0x35,0x18,0x5C,0x32,0x1C,0x48,0x25,0x12,0x35,0x1D,0x09,
-  0x2C,0x18,0x04,0x34,0x1B,0x09,0x36,0x1B,0x08,0x49,0x2B,0x14,0x4E,0x28,0x0D,0x54,
-  0x28,0x0A,0x5E,0x34,0x13,0x53,0x30,0x0F,0x3A,0x1B,0x04,0x44,0x2C,0x19,0x39,0x20,
-  0x12,0x3A,0x25,0x19,0x43,0x32,0x25,0x27,0x39,0x44,0x39,0x71,0x90,0x2A,0x6A,0x91,
-  0x22,0x65,0x8B,0x1E,0x62,0x88,0x23,0x62,0x8B,0x33,0x6C,0x89,0x69,0x8D,0x89,0x5F,
-  0x69,0x47,0x45,0x43,0x22,0x16,0x17,0x0C,0x1A,0x17,0x18,0x16,0x16,0x16,0x15,0x15,
-  0x15,0x13,0x13,0x13,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x15,0x15,0x15,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x10,0x12,0x13,0x18,0x16,0x11,
-  0x28,0x16,0x00,0x76,0x54,0x20,0x86,0x5B,0x0E,0x84,0x55,0x0E,0x80,0x4E,0x12,0x79,
-  0x49,0x14,0x67,0x42,0x1E,0x3E,0x3B,0x34,0x3F,0x69,0x80,0x25,0x6A,0x90,0x2A,0x6F,
-  0x96,0x2E,0x72,0x99,0x32,0x76,0x9D,0x35,0x7D,0xA6,0x3D,0x83,0xA7,0x4B,0x8C,0xAC,
-  0x51,0x91,0xB3,0x63,0x9F,0xB9,0x63,0x8B,0x94,0x57,0x66,0x66,0xA7,0x91,0x86,0x79,
-  0x4F,0x3B,0x56,0x23,0x0B,0x5D,0x2A,0x0D,0x5F,0x2C,0x0F,0x66,0x34,0x16,0x65,0x33,
-  0x13,0x66,0x33,0x13,0x64,0x35,0x13,0x65,0x35,0x16,0x67,0x36,0x18,0x63,0x33,0x1B,
-  0x5E,0x2F,0x16,0x5C,0x2F,0x16,0x4F,0x27,0x0C,0x4B,0x24,0x09,0x5D,0x31,0x16,0x63,
-  0x36,0x18,0x64,0x39,0x18,0x59,0x33,0x13,0x3D,0x20,0x07,0x3A,0x2A,0x1A,0x20,0x16,
-  0x11,0x18,0x14,0x10,0x22,0x1E,0x1A,0x44,0x63,0x71,0x35,0x72,0x96,0x28,0x6A,0x94,
-  0x25,0x65,0x8C,0x20,0x62,0x86,0x23,0x61,0x8C,0x32,0x6B,0x8E,0x5F,0x8A,0x8D,0x6A,
-  0x7C,0x62,0x40,0x40,0x25,0x17,0x18,0x0D,0x17,0x15,0x16,0x15,0x15,0x15,0x16,0x16,
-  0x16,0x15,0x15,0x15,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x13,
-  0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x12,0x12,0x12,0x12,0x12,0x12,0x14,0x14,
-  0x14,0x12,0x12,0x12,0x14,0x14,0x14,0x14,0x14,0x14,0x10,0x12,0x14,0x17,0x14,0x10,
-  0x28,0x15,0x00,0x72,0x54,0x20,0x84,0x5D,0x11,0x7F,0x54,0x0F,0x7E,0x50,0x0E,0x79,
-  0x4A,0x10,0x6A,0x43,0x1B,0x50,0x39,0x26,0x43,0x5C,0x6B,0x2F,0x6B,0x91,0x2C,0x70,
-  0x96,0x31,0x73,0x9C,0x36,0x79,0xA0,0x3E,0x7E,0xA5,0x48,0x84,0xAB,0x4D,0x8F,0xB4,
-  0x57,0x97,0xBA,0x63,0xA1,0xBB,0x97,0xB7,0xBD,0x7F,0x7D,0x71,0x50,0x25,0x0B,0x61,
-  0x2E,0x14,0x66,0x31,0x17,0x65,0x33,0x14,0x64,0x33,0x17,0x64,0x35,0x16,0x64,0x32,
-  0x14,0x66,0x32,0x15,0x67,0x33,0x17,0x63,0x34,0x14,0x65,0x33,0x13,0x63,0x32,0x14,
-  0x6A,0x33,0x15,0x68,0x34,0x16,0x6B,0x34,0x18,0x66,0x35,0x16,0x65,0x35,0x13,0x5F,
-  0x2F,0x11,0x60,0x31,0x0F,0x54,0x2C,0x0B,0x49,0x2B,0x0D,0x2F,0x1E,0x09,0x21,0x19,
-  0x0E,0x1D,0x16,0x0D,0x1B,0x15,0x11,0x30,0x51,0x60,0x35,0x75,0x93,0x27,0x6A,0x92,
-  0x1F,0x64,0x8C,0x1F,0x62,0x89,0x1D,0x5F,0x8D,0x2D,0x6F,0x91,0x55,0x88,0x90,0x79,
-  0x93,0x82,0x30,0x34,0x1D,0x19,0x1A,0x0E,0x18,0x16,0x17,0x15,0x16,0x16,0x16,0x16,
-  0x16,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x12,0x12,0x12,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x12,0x12,0x12,0x13,0x13,0x13,0x12,0x12,0x12,0x14,0x14,
-  0x14,0x12,0x12,0x12,0x13,0x13,0x13,0x12,0x12,0x12,0x13,0x13,0x13,0x19,0x16,0x12,
-  0x26,0x16,0x00,0x69,0x4D,0x1D,0x85,0x5F,0x12,0x83,0x55,0x11,0x7E,0x51,0x0E,0x7D,
-  0x4D,0x0F,0x71,0x44,0x14,0x64,0x40,0x1C,0x32,0x38,0x35,0x39,0x6A,0x8A,0x2E,0x6E,
-  0x96,0x2F,0x73,0x9C,0x36,0x7B,0xA1,0x3E,0x81,0xA6,0x46,0x87,0xAD,0x4C,0x92,0xB5,
-  0x5A,0x9A,0xBB,0x74,0xA8,0xBE,0xB3,0xC6,0xC5,0x6B,0x5D,0x46,0x64,0x35,0x13,0x65,
-  0x35,0x14,0x68,0x34,0x15,0x66,0x34,0x15,0x64,0x34,0x15,0x68,0x33,0x15,0x66,0x32,
-  0x14,0x67,0x32,0x14,0x66,0x34,0x16,0x65,0x32,0x15,0x65,0x33,0x16,0x66,0x34,0x14,
-  0x66,0x34,0x13,0x66,0x35,0x12,0x66,0x34,0x14,0x62,0x35,0x14,0x61,0x34,0x14,0x57,
-  0x35,0x17,0x51,0x2C,0x13,0x4D,0x2F,0x16,0x50,0x36,0x1E,0x2D,0x1D,0x0B,0x20,0x18,
-  0x06,0x2F,0x26,0x1D,0x24,0x27,0x2A,0x2B,0x51,0x68,0x37,0x73,0x9A,0x29,0x6C,0x92,
-  0x21,0x64,0x8B,0x1E,0x61,0x89,0x1B,0x62,0x8D,0x31,0x71,0x95,0x4C,0x84,0x93,0x82,
-  0xA4,0x9F,0x27,0x2E,0x21,0x19,0x18,0x12,0x19,0x17,0x14,0x15,0x15,0x15,0x15,0x15,
-  0x15,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x12,0x12,0x12,0x12,
-  0x12,0x12,0x13,0x13,0x13,0x12,0x12,0x12,0x13,0x13,0x13,0x13,0x13,0x13,0x12,0x12,
-  0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x14,0x13,0x14,0x15,0x14,0x10,
-  0x23,0x17,0x03,0x5C,0x41,0x16,0x86,0x61,0x15,0x83,0x57,0x0F,0x84,0x52,0x0A,0x7E,
-  0x4E,0x0E,0x70,0x45,0x16,0x63,0x41,0x20,0x31,0x33,0x2D,0x3C,0x67,0x85,0x2F,0x6F,
-  0x98,0x30,0x75,0x9E,0x36,0x7B,0xA2,0x41,0x80,0xA8,0x4F,0x8B,0xAC,0x63,0x98,0xA8,
-  0x91,0xAD,0xB5,0xAC,0xB4,0xA9,0x9D,0x83,0x68,0x57,0x32,0x10,0x68,0x37,0x14,0x64,
-  0x34,0x13,0x68,0x33,0x15,0x67,0x33,0x15,0x65,0x32,0x14,0x67,0x32,0x14,0x67,0x33,
-  0x15,0x66,0x32,0x14,0x65,0x34,0x15,0x64,0x33,0x13,0x64,0x33,0x13,0x62,0x33,0x13,
-  0x62,0x33,0x14,0x62,0x33,0x14,0x64,0x33,0x16,0x5A,0x34,0x1C,0x3F,0x30,0x25,0x1F,
-  0x2B,0x2E,0x61,0x7F,0x87,0x46,0x61,0x6E,0x49,0x5D,0x64,0x2B,0x3F,0x43,0x0D,0x1D,
-  0x20,0x1A,0x30,0x3D,0x3F,0x6D,0x82,0x3B,0x74,0x96,0x32,0x6F,0x9C,0x2A,0x6B,0x94,
-  0x20,0x63,0x8C,0x1D,0x61,0x88,0x1F,0x64,0x90,0x32,0x72,0x96,0x4D,0x89,0x97,0x87,
-  0xA9,0xA6,0x1B,0x23,0x1A,0x1A,0x17,0x15,0x18,0x16,0x15,0x13,0x13,0x13,0x14,0x14,
-  0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x12,
-  0x12,0x12,0x14,0x14,0x14,0x12,0x12,0x12,0x13,0x13,0x13,0x13,0x13,0x13,0x12,0x12,
-  0x12,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x15,0x13,0x14,0x13,0x14,0x11,
-  0x1D,0x16,0x03,0x4B,0x31,0x0A,0x88,0x63,0x18,0x86,0x59,0x0F,0x7F,0x53,0x0F,0x78,
-  0x4C,0x13,0x68,0x45,0x20,0x53,0x40,0x2A,0x3C,0x42,0x3E,0x40,0x69,0x82,0x33,0x72,
-  0x97,0x34,0x77,0x9D,0x3A,0x7E,0xA2,0x47,0x85,0xA3,0x60,0x92,0xA4,0x98,0xAE,0xA4,
-  0x65,0x50,0x3A,0x50,0x2D,0x0A,0x62,0x2C,0x0A,0x68,0x35,0x13,0x65,0x33,0x16,0x67,
-  0x34,0x14,0x63,0x32,0x13,0x61,0x32,0x13,0x62,0x34,0x15,0x64,0x32,0x14,0x63,0x31,
-  0x13,0x64,0x33,0x15,0x64,0x32,0x14,0x62,0x31,0x13,0x65,0x33,0x15,0x65,0x32,0x14,
-  0x66,0x33,0x16,0x67,0x33,0x17,0x62,0x33,0x1D,0x4E,0x2F,0x25,0x1E,0x2F,0x3E,0x76,
-  0xAA,0xCA,0x75,0xAD,0xD0,0x69,0xA7,0xCA,0x62,0xA2,0xC3,0x63,0x9D,0xBB,0x4B,0x86,
-  0xA6,0x43,0x80,0xA3,0x43,0x85,0xAA,0x33,0x7B,0x9E,0x31,0x74,0x9E,0x2C,0x6B,0x94,
-  0x1F,0x64,0x8B,0x1D,0x63,0x8A,0x22,0x65,0x92,0x35,0x76,0x9A,0x55,0x8D,0x9D,0x8B,
-  0xAB,0xAA,0x0F,0x13,0x10,0x1B,0x18,0x18,0x18,0x16,0x16,0x15,0x15,0x15,0x13,0x13,
-  0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,
-  0x13,0x13,0x13,0x13,0x13,0x13,0x15,0x15,0x15,0x13,0x13,0x13,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x13,0x13,0x13,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
-  0x12,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x10,0x13,0x11,0x12,0x15,0x15,
-  0x1E,0x15,0x09,0x38,0x21,0x00,0x83,0x61,0x1B,0x86,0x5B,0x0E,0x7F,0x55,0x10,0x6F,
-  0x4B,0x19,0x5A,0x45,0x21,0x6C,0x5B,0x3E,0x58,0x4D,0x3B,0x3D,0x4A,0x4F,0x53,0x77,
-  0x89,0x4C,0x75,0x8D,0x63,0x88,0x99,0x75,0x91,0x98,0x92,0x9B,0x93,0x68,0x5C,0x3F,
-  0x5F,0x32,0x11,0x67,0x39,0x15,0x69,0x37,0x11,0x66,0x37,0x14,0x65,0x35,0x14,0x65,
-  0x33,0x14,0x62,0x33,0x13,0x63,0x34,0x14,0x62,0x34,0x13,0x64,0x32,0x14,0x63,0x31,
-  0x13,0x64,0x32,0x15,0x68,0x34,0x14,0x69,0x32,0x13,0x65,0x34,0x13,0x62,0x34,0x15,
-  0x64,0x33,0x13,0x63,0x36,0x15,0x57,0x35,0x1E,0x24,0x1F,0x21,0x69,0x90,0xAA,0x7A,
-  0xB7,0xD9,0x69,0xA8,0xCA,0x60,0xA2,0xC5,0x57,0x99,0xBF,0x50,0x93,0xB9,0x4C,0x8F,
-  0xB4,0x45,0x88,0xAE,0x3D,0x81,0xA6,0x38,0x7B,0xA1,0x31,0x74,0x9C,0x27,0x6A,0x91,
-  0x1F,0x65,0x8C,0x1D,0x66,0x8B,0x26,0x6B,0x93,0x40,0x7F,0x9B,0x62,0x98,0xA1,0x8C,
-  0xA6,0x9F,0x07,0x0D,0x0A,0x1A,0x17,0x18,0x18,0x16,0x16,0x18,0x15,0x15,0x14,0x13,
-  0x13,0x15,0x15,0x15,0x15,0x15,0x15,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x14,
-  0x14,0x14,0x12,0x12,0x12,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x12,0x12,
-  0x12,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x11,0x13,0x12,
-  0x1B,0x15,0x0E,0x27,0x15,0x00,0x7B,0x5B,0x1C,0x84,0x5E,0x0F,0x7E,0x59,0x12,0x63,
-  0x4C,0x24,0x4B,0x47,0x2F,0x68,0x61,0x42,0x58,0x3F,0x17,0x53,0x39,0x16,0x66,0x56,
-  0x3B,0x71,0x65,0x4E,0x75,0x63,0x45,0x62,0x48,0x23,0x78,0x56,0x32,0x60,0x37,0x10,
-  0x67,0x38,0x12,0x67,0x38,0x13,0x68,0x37,0x14,0x67,0x35,0x15,0x65,0x33,0x14,0x66,
-  0x33,0x15,0x63,0x34,0x14,0x64,0x35,0x15,0x61,0x32,0x12,0x64,0x33,0x13,0x65,0x34,
-  0x14,0x64,0x33,0x13,0x68,0x34,0x14,0x69,0x32,0x13,0x65,0x34,0x13,0x62,0x34,0x13,
-  0x65,0x34,0x19,0x59,0x32,0x22,0x2D,0x23,0x21,0x57,0x71,0x8D,0x8B,0xCA,0xEA,0x70,
-  0xB5,0xD4,0x68,0xAA,0xCC,0x5E,0xA2,0xC6,0x54,0x9A,0xC0,0x4F,0x94,0xBB,0x49,0x8E,
-  0xB5,0x43,0x89,0xAD,0x3D,0x82,0xA6,0x3B,0x7B,0xA1,0x30,0x74,0x99,0x26,0x6B,0x91,
-  0x1F,0x64,0x8B,0x22,0x66,0x91,0x32,0x71,0x97,0x52,0x88,0x9B,0x79,0x9B,0x95,0x5F,
-  0x69,0x5A,0x10,0x10,0x09,0x18,0x16,0x16,0x16,0x14,0x14,0x16,0x14,0x14,0x14,0x15,
-  0x15,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,
-  0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x12,0x12,0x12,0x14,
-  0x14,0x14,0x12,0x12,0x12,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x12,0x12,
-  0x12,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,
-  0x16,0x13,0x12,0x1D,0x13,0x06,0x67,0x4D,0x19,0x80,0x60,0x13,0x74,0x58,0x1C,0x4F,
-  0x4B,0x31,0x52,0x5C,0x4D,0x6D,0x6D,0x57,0x61,0x44,0x16,0x72,0x45,0x0D,0x6F,0x3F,
-  0x0A,0x69,0x41,0x10,0x6A,0x3A,0x0B,0x6A,0x3A,0x0C,0x68,0x37,0x0F,0x65,0x3A,0x12,
-  0x65,0x3C,0x14,0x65,0x37,0x10,0x6B,0x37,0x10,0x69,0x36,0x12,0x68,0x36,0x12,0x69,
-  0x36,0x14,0x63,0x36,0x13,0x63,0x36,0x13,0x63,0x36,0x14,0x65,0x34,0x14,0x66,0x35,
-  0x14,0x65,0x35,0x14,0x66,0x32,0x13,0x6A,0x33,0x14,0x67,0x36,0x15,0x65,0x34,0x15,
-  0x64,0x35,0x19,0x4A,0x2E,0x21,0x4F,0x54,0x64,0x9F,0xD4,0xEF,0x7C,0xBE,0xE0,0x70,
-  0xB5,0xD7,0x6A,0xAD,0xCF,0x63,0xA1,0xC8,0x59,0x9A,0xBF,0x54,0x96,0xBA,0x4E,0x90,
-  0xB4,0x48,0x89,0xAF,0x3E,0x81,0xA6,0x36,0x7A,0x9F,0x2F,0x72,0x99,0x26,0x68,0x92,
-  0x20,0x64,0x91,0x23,0x6B,0x93,0x39,0x77,0x9B,0x60,0x91,0xA0,0x75,0x91,0x8D,0x27,
-  0x29,0x1D,0x18,0x18,0x11,0x17,0x15,0x16,0x17,0x15,0x15,0x16,0x13,0x13,0x13,0x13,
-  0x13,0x12,0x12,0x12,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,
-  0x13,0x13,0x13,0x14,0x14,0x14,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x12,0x12,0x12,0x12,0x12,0x12,0x13,0x13,0x13,0x13,0x13,
-  0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x12,0x12,0x12,0x13,0x14,0x12,0x15,0x13,0x14,
-  0x14,0x13,0x14,0x1C,0x14,0x09,0x46,0x30,0x08,0x76,0x60,0x26,0x5C,0x52,0x2B,0x3D,
-  0x4E,0x43,0x5A,0x6B,0x63,0x62,0x61,0x45,0x6E,0x47,0x19,0x75,0x44,0x0F,0x75,0x44,
-  0x11,0x6B,0x3F,0x10,0x6F,0x3E,0x0F,0x6F,0x3D,0x11,0x69,0x3A,0x12,0x6B,0x42,0x17,
-  0x65,0x3B,0x11,0x66,0x3B,0x11,0x69,0x38,0x10,0x6C,0x39,0x13,0x69,0x37,0x12,0x67,
-  0x37,0x12,0x66,0x36,0x14,0x66,0x35,0x13,0x66,0x36,0x13,0x64,0x35,0x13,0x66,0x36,
-  0x14,0x65,0x36,0x13,0x67,0x35,0x14,0x69,0x33,0x14,0x68,0x34,0x14,0x66,0x34,0x15,
-  0x63,0x38,0x1B,0x45,0x2B,0x1D,0x68,0x74,0x85,0x97,0xD3,0xEB,0x7D,0xBD,0xE0,0x74,
-  0xB5,0xD9,0x6A,0xAC,0xCF,0x60,0xA2,0xC5,0x58,0x9C,0xC1,0x52,0x96,0xBB,0x4C,0x90,
-  0xB5,0x46,0x8A,0xAF,0x3D,0x81,0xA6,0x38,0x7B,0xA0,0x2C,0x72,0x98,0x25,0x69,0x94,
-  0x23,0x67,0x91,0x2C,0x6E,0x97,0x49,0x84,0xA2,0x5A,0x87,0x95,0x8A,0xA6,0xA5,0x07,
-  0x11,0x10,0x1A,0x18,0x19,0x16,0x16,0x16,0x16,0x16,0x16,0x14,0x14,0x14,0x13,0x13,
-  0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x12,0x12,0x12,0x12,0x12,0x12,0x11,0x11,0x11,0x13,
-  0x13,0x13,0x13,0x13,0x13,0x12,0x12,0x12,0x14,0x14,0x14,0x12,0x12,0x12,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x12,0x13,0x11,0x12,0x12,0x13,
-  0x16,0x14,0x14,0x1A,0x15,0x0B,0x23,0x16,0x00,0x61,0x58,0x35,0x53,0x5E,0x48,0x68,
-  0x7E,0x81,0x66,0x73,0x63,0x58,0x4A,0x24,0x70,0x47,0x18,0x6E,0x45,0x15,0x66,0x44,
-  0x21,0x61,0x43,0x1F,0x64,0x40,0x1A,0x65,0x3C,0x11,0x67,0x3D,0x11,0x6A,0x3F,0x10,
-  0x68,0x3B,0x0F,0x69,0x3C,0x11,0x68,0x3B,0x10,0x68,0x3B,0x11,0x65,0x39,0x11,0x63,
-  0x38,0x11,0x67,0x37,0x12,0x65,0x36,0x11,0x66,0x36,0x11,0x66,0x36,0x13,0x65,0x35,
-  0x12,0x65,0x36,0x12,0x69,0x34,0x15,0x6B,0x33,0x14,0x6A,0x35,0x15,0x65,0x35,0x14,
-  0x62,0x35,0x18,0x48,0x31,0x20,0x37,0x4A,0x58,0x96,0xD1,0xEC,0x7C,0xBD,0xDF,0x74,
-  0xB6,0xD9,0x69,0xAB,0xCE,0x60,0xA2,0xC4,0x55,0x99,0xBE,0x52,0x96,0xBB,0x4B,0x8F,
-  0xB4,0x46,0x8A,0xAF,0x40,0x84,0xA9,0x36,0x79,0x9E,0x2B,0x71,0x97,0x26,0x68,0x90,
-  0x2A,0x6D,0x93,0x38,0x77,0x9A,0x61,0x98,0xB1,0x38,0x5F,0x69,0x8B,0xA2,0xA7,0x03,
-  0x0B,0x0C,0x16,0x18,0x18,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x13,0x13,
-  0x13,0x15,0x15,0x15,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x15,0x15,0x15,
-  0x15,0x15,0x15,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x12,0x12,0x12,0x12,
-  0x12,0x12,0x13,0x13,0x13,0x12,0x12,0x12,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,
-  0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x15,0x13,0x16,0x15,0x15,
-  0x15,0x13,0x12,0x16,0x15,0x0F,0x1B,0x15,0x05,0x3C,0x3A,0x23,0x6C,0x72,0x5F,0x78,
-  0x8B,0x77,0x4E,0x4D,0x2D,0x83,0x6D,0x3F,0x6B,0x46,0x14,0x62,0x47,0x1D,0x61,0x46,
-  0x26,0x6E,0x53,0x33,0xA2,0x7F,0x58,0x75,0x4B,0x1D,0x6B,0x3F,0x10,0x6A,0x3A,0x10,
-  0x6D,0x3B,0x0E,0x6A,0x3C,0x0E,0x67,0x3D,0x0D,0x69,0x3B,0x10,0x67,0x3A,0x0F,0x65,
-  0x39,0x0F,0x67,0x39,0x11,0x68,0x3A,0x11,0x66,0x38,0x0F,0x66,0x37,0x13,0x65,0x35,
-  0x11,0x66,0x36,0x12,0x65,0x35,0x15,0x69,0x36,0x16,0x67,0x36,0x17,0x65,0x37,0x15,
-  0x65,0x38,0x19,0x3E,0x2C,0x1B,0x54,0x70,0x7B,0x95,0xD0,0xED,0x7C,0xBD,0xDE,0x72,
-  0xB4,0xD7,0x67,0xA9,0xCC,0x5F,0xA1,0xC3,0x55,0x9A,0xBE,0x4F,0x93,0xB8,0x4C,0x90,
-  0xB5,0x44,0x88,0xAD,0x3D,0x81,0xA6,0x33,0x77,0x9C,0x2A,0x70,0x94,0x2B,0x6E,0x94,
-  0x34,0x75,0x98,0x47,0x84,0xA2,0x4A,0x7D,0x92,0x75,0x96,0x9D,0x3A,0x4A,0x4B,0x14,
-  0x17,0x16,0x18,0x16,0x16,0x14,0x14,0x14,0x13,0x13,0x13,0x15,0x15,0x15,0x13,0x13,
-  0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,
-  0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x12,
-  0x12,0x12,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x15,0x15,0x15,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x14,0x14,0x14,0x14,
-  0x12,0x12,0x13,0x15,0x14,0x14,0x1D,0x16,0x0B,0x21,0x1C,0x0C,0x5C,0x5D,0x4C,0x8F,
-  0x9C,0x7F,0x59,0x4F,0x23,0x7B,0x5B,0x28,0x77,0x4E,0x1A,0x68,0x48,0x19,0x89,0x64,
-  0x3A,0x74,0x4C,0x22,0x6B,0x3C,0x0C,0x6F,0x3F,0x0E,0x6E,0x3E,0x0F,0x6D,0x3D,0x0E,
-  0x6C,0x3B,0x0D,0x6A,0x3C,0x0D,0x68,0x3B,0x10,0x68,0x3C,0x11,0x69,0x3C,0x11,0x69,
-  0x3C,0x10,0x6A,0x39,0x13,0x6B,0x39,0x13,0x6B,0x36,0x11,0x6B,0x37,0x12,0x69,0x38,
-  0x12,0x67,0x38,0x12,0x68,0x38,0x13,0x68,0x37,0x12,0x64,0x37,0x12,0x66,0x3A,0x15,
-  0x62,0x38,0x18,0x40,0x2D,0x1C,0x97,0xB2,0xC1,0x8C,0xC7,0xE9,0x7C,0xBB,0xDD,0x73,
-  0xB2,0xD6,0x67,0xAB,0xCE,0x5E,0xA0,0xC3,0x58,0x99,0xBF,0x50,0x93,0xB9,0x4A,0x8F,
-  0xB4,0x44,0x87,0xAD,0x3A,0x7E,0xA4,0x31,0x75,0x9A,0x29,0x70,0x94,0x2E,0x73,0x97,
-  0x3D,0x7B,0x9C,0x5D,0x99,0xB3,0x3C,0x6A,0x7E,0xB1,0xCC,0xD3,0x00,0x0B,0x0A,0x18,
-  0x19,0x1A,0x17,0x17,0x16,0x15,0x14,0x15,0x16,0x16,0x16,0x14,0x14,0x14,0x13,0x13,
-  0x13,0x15,0x15,0x15,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x13,
-  0x13,0x13,0x12,0x12,0x12,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x12,0x12,
-  0x12,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x12,0x12,0x12,0x12,0x12,0x12,
-  0x11,0x11,0x11,0x13,0x13,0x14,0x18,0x13,0x10,0x16,0x12,0x0A,0x38,0x3A,0x2E,0x8E,
-  0x9C,0x86,0x76,0x6D,0x44,0x6C,0x53,0x15,0x7B,0x50,0x0F,0x7C,0x55,0x1F,0x73,0x48,
-  0x15,0x72,0x44,0x10,0x75,0x43,0x11,0x72,0x41,0x0E,0x71,0x40,0x0E,0x6F,0x3E,0x0D,
-  0x6F,0x3E,0x0E,0x6D,0x3D,0x0F,0x69,0x3B,0x10,0x68,0x3B,0x10,0x68,0x3C,0x11,0x68,
-  0x3C,0x10,0x69,0x3C,0x11,0x68,0x39,0x0F,0x6B,0x3A,0x10,0x6A,0x37,0x0F,0x69,0x38,
-  0x10,0x68,0x37,0x0F,0x67,0x37,0x10,0x69,0x37,0x10,0x66,0x38,0x11,0x65,0x3B,0x12,
-  0x62,0x3A,0x15,0x46,0x2E,0x17,0x66,0x71,0x7C,0x98,0xC8,0xE5,0x79,0xB9,0xDB,0x6D,
-  0xAD,0xCF,0x62,0xA6,0xC7,0x5A,0x9E,0xBE,0x59,0x97,0xBD,0x52,0x91,0xB7,0x4A,0x8A,
-  0xB0,0x3F,0x81,0xA9,0x35,0x78,0x9F,0x2E,0x71,0x99,0x31,0x72,0x9B,0x3A,0x7A,0xA0,
-  0x56,0x90,0xAE,0x33,0x69,0x7D,0x91,0xB5,0xC2,0x54,0x63,0x65,0x0E,0x14,0x13,0x16,
-  0x15,0x15,0x15,0x15,0x16,0x17,0x17,0x16,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x12,0x12,0x12,0x13,0x13,0x13,0x14,0x14,0x14,
-  0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,
-  0x13,0x13,0x13,0x13,0x13,0x12,0x12,0x12,0x12,0x12,0x12,0x13,0x13,0x13,0x11,0x11,
-  0x11,0x12,0x12,0x12,0x13,0x13,0x13,0x12,0x12,0x12,0x12,0x12,0x12,0x13,0x13,0x13,
-  0x12,0x12,0x12,0x12,0x15,0x13,0x15,0x14,0x13,0x1A,0x15,0x0F,0x11,0x11,0x0C,0x78,
-  0x8D,0x86,0x95,0xA0,0x86,0x5E,0x53,0x1F,0x79,0x55,0x16,0x71,0x4E,0x15,0x74,0x51,
-  0x24,0x73,0x4B,0x17,0x70,0x46,0x12,0x70,0x43,0x0E,0x6F,0x42,0x0D,0x6F,0x41,0x0D,
-  0x70,0x3F,0x0D,0x6F,0x3E,0x10,0x6A,0x3A,0x12,0x69,0x3C,0x11,0x68,0x3C,0x10,0x69,
-  0x3C,0x10,0x67,0x3B,0x11,0x67,0x3A,0x10,0x68,0x38,0x0F,0x6C,0x38,0x0F,0x6B,0x39,
-  0x0F,0x6A,0x39,0x0E,0x69,0x39,0x0F,0x6C,0x39,0x0F,0x68,0x3B,0x10,0x67,0x3B,0x0F,
-  0x65,0x39,0x10,0x5A,0x37,0x1E,0x36,0x2C,0x25,0x9B,0xBB,0xCB,0x7C,0xB5,0xD3,0x67,
-  0xA7,0xCC,0x5E,0xA1,0xC4,0x5B,0x9D,0xC0,0x53,0x93,0xBA,0x4C,0x8F,0xB4,0x42,0x87,
-  0xAC,0x39,0x7E,0xA3,0x32,0x76,0x9C,0x30,0x75,0x9B,0x39,0x7B,0x9F,0x48,0x86,0xA8,
-  0x4E,0x83,0x9F,0x59,0x89,0x99,0x87,0xA1,0xA5,0x01,0x08,0x04,0x1A,0x19,0x17,0x19,
-  0x15,0x16,0x15,0x15,0x17,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x12,0x12,0x12,0x13,0x13,0x13,0x14,0x14,0x14,
-  0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,
-  0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x12,0x12,0x12,0x12,0x12,
-  0x12,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x12,0x12,0x12,
-  0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x11,0x11,0x17,0x13,0x12,0x10,0x0F,0x0F,0x2C,
-  0x41,0x41,0xA4,0xBF,0xB6,0x6C,0x7E,0x6C,0x4B,0x49,0x30,0x4C,0x48,0x2A,0x63,0x5A,
-  0x3A,0x70,0x52,0x22,0x74,0x47,0x12,0x7A,0x45,0x09,0x7B,0x44,0x0E,0x73,0x41,0x0F,
-  0x74,0x40,0x0E,0x70,0x3E,0x10,0x6F,0x3C,0x11,0x6C,0x3C,0x12,0x6A,0x3B,0x10,0x68,
-  0x3C,0x10,0x68,0x3C,0x11,0x69,0x3B,0x10,0x6A,0x3A,0x10,0x6A,0x3A,0x10,0x68,0x38,
-  0x0E,0x68,0x38,0x0E,0x6B,0x3A,0x12,0x69,0x3B,0x11,0x68,0x3A,0x0E,0x65,0x3C,0x0E,
-  0x66,0x3C,0x10,0x61,0x3D,0x1C,0x50,0x31,0x1E,0x45,0x49,0x49,0x7A,0xAB,0xC4,0x65,
-  0xA6,0xC6,0x5B,0x9C,0xC0,0x57,0x9A,0xBA,0x4C,0x90,0xB5,0x3F,0x89,0xAE,0x3D,0x81,
-  0xA6,0x3B,0x7B,0x9F,0x42,0x7B,0x9E,0x3F,0x7D,0x9D,0x4B,0x8A,0xA8,0x5C,0x95,0xB6,
-  0x53,0x88,0xA1,0xA2,0xC4,0xCF,0x23,0x31,0x34,0x17,0x17,0x15,0x16,0x16,0x16,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x15,0x15,0x15,0x13,0x13,0x13,0x13,0x13,
-  0x13,0x12,0x12,0x12,0x12,0x12,0x12,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,
-  0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x12,
-  0x12,0x12,0x12,0x12,0x12,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,
-  0x13,0x13,0x13,0x13,0x12,0x12,0x12,0x13,0x13,0x13,0x13,0x13,0x13,0x12,0x12,0x12,
-  0x13,0x13,0x13,0x12,0x11,0x13,0x13,0x13,0x13,0x14,0x13,0x13,0x11,0x15,0x11,0x00,
-  0x03,0x06,0x72,0x92,0x9A,0x7F,0xAF,0xBE,0x55,0x85,0x94,0x37,0x6A,0x7A,0x48,0x6A,
-  0x6D,0x55,0x59,0x41,0x69,0x46,0x1A,0x7E,0x4C,0x0F,0x82,0x46,0x0D,0x78,0x44,0x0F,
-  0x75,0x42,0x0E,0x72,0x3F,0x0E,0x71,0x3F,0x12,0x6F,0x3E,0x11,0x6C,0x3C,0x0F,0x6D,
-  0x3D,0x10,0x6A,0x3A,0x11,0x6B,0x3A,0x10,0x6E,0x3C,0x12,0x6D,0x3B,0x11,0x6B,0x39,
-  0x0F,0x6D,0x3B,0x11,0x6C,0x3A,0x11,0x69,0x3B,0x0F,0x67,0x3B,0x0F,0x67,0x3B,0x11,
-  0x66,0x3D,0x14,0x5D,0x3A,0x18,0x58,0x37,0x16,0x34,0x2A,0x1D,0x6E,0x8E,0xA1,0x66,
-  0xA1,0xC5,0x56,0x98,0xBE,0x50,0x94,0xB7,0x4D,0x89,0xAF,0x4C,0x85,0xA2,0x58,0x87,
-  0x9A,0x5C,0x87,0x97,0x28,0x4C,0x5E,0x6D,0x96,0xA8,0x54,0x7E,0x94,0x5B,0x8A,0xA1,
-  0x9B,0xC8,0xD6,0x6F,0x88,0x8F,0x02,0x0C,0x0C,0x1A,0x19,0x17,0x15,0x15,0x15,0x13,
-  0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x13,0x13,0x13,0x14,0x14,
-  0x14,0x16,0x16,0x16,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,
-  0x12,0x12,0x12,0x13,0x13,0x13,0x12,0x12,0x12,0x13,0x13,0x13,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x12,0x12,0x12,0x11,0x11,0x11,0x12,0x12,0x12,0x13,0x13,0x13,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x12,0x14,0x13,0x12,0x14,0x0F,0x12,0x12,0x16,0x13,0x15,0x12,
-  0x11,0x12,0x0C,0x18,0x24,0xA4,0xCC,0xDF,0x60,0x9E,0xB8,0x44,0x87,0xA5,0x3F,0x79,
-  0x94,0x4C,0x78,0x7C,0x4B,0x54,0x45,0x60,0x46,0x1C,0x7A,0x47,0x11,0x7A,0x48,0x0D,
-  0x79,0x44,0x0F,0x74,0x41,0x0E,0x73,0x3F,0x10,0x73,0x3F,0x10,0x6F,0x3E,0x0F,0x6F,
-  0x3F,0x0F,0x6D,0x3B,0x12,0x6E,0x3A,0x11,0x6E,0x39,0x11,0x6C,0x39,0x10,0x6D,0x3A,
-  0x11,0x6E,0x3A,0x11,0x68,0x3A,0x10,0x65,0x3D,0x0D,0x62,0x3C,0x13,0x62,0x3A,0x18,
-  0x53,0x31,0x10,0x44,0x28,0x06,0x47,0x2B,0x11,0x46,0x32,0x23,0x60,0x74,0x7D,0x79,
-  0xA9,0xC0,0x5F,0x9C,0xB8,0x50,0x8D,0xAF,0x51,0x86,0xA1,0x5C,0x81,0x91,0x31,0x46,
-  0x4B,0x08,0x1B,0x1C,0x0C,0x18,0x1F,0x0E,0x1F,0x29,0x00,0x00,0x06,0x6D,0x90,0x9E,
-  0xA1,0xC8,0xCC,0x0A,0x13,0x16,0x17,0x19,0x18,0x12,0x16,0x14,0x15,0x15,0x15,0x13,
-  0x13,0x13,0x14,0x14,0x14,0x15,0x15,0x15,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,
-  0x13,0x15,0x15,0x15,0x12,0x12,0x12,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x12,0x12,0x12,0x13,
-  0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,
-  0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x12,0x12,0x12,0x13,0x12,0x12,
-  0x13,0x11,0x04,0x0D,0x0E,0x2B,0x3F,0x4B,0x9F,0xCC,0xE2,0x59,0x99,0xBA,0x44,0x83,
-  0xA8,0x40,0x78,0x9B,0x4A,0x7A,0x8B,0x62,0x71,0x61,0x62,0x4B,0x1D,0x7A,0x4B,0x10,
-  0x83,0x49,0x0A,0x7D,0x46,0x0C,0x78,0x44,0x0F,0x73,0x42,0x0E,0x73,0x40,0x0F,0x73,
-  0x3F,0x0E,0x71,0x40,0x11,0x71,0x3E,0x13,0x70,0x3D,0x11,0x70,0x3E,0x10,0x6F,0x3B,
-  0x0E,0x6B,0x3C,0x0F,0x6B,0x3E,0x11,0x67,0x3C,0x14,0x56,0x30,0x0B,0x40,0x1A,0x00,
-  0x4E,0x29,0x08,0x57,0x36,0x18,0x31,0x23,0x12,0x24,0x27,0x27,0x2C,0x40,0x47,0x2F,
-  0x48,0x52,0x36,0x4F,0x5D,0x65,0x8D,0x9B,0x68,0x8E,0x98,0x49,0x5D,0x63,0x0A,0x17,
-  0x1B,0x06,0x13,0x18,0x04,0x15,0x22,0x0C,0x21,0x32,0x3D,0x5C,0x6D,0xC5,0xE4,0xEC,
-  0x18,0x22,0x23,0x11,0x16,0x14,0x17,0x17,0x17,0x13,0x14,0x15,0x13,0x13,0x13,0x15,
-  0x15,0x15,0x13,0x13,0x13,0x15,0x15,0x15,0x13,0x13,0x13,0x14,0x14,0x14,0x12,0x12,
-  0x12,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x12,0x12,0x12,
-  0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,
-  0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x12,0x12,0x12,0x14,0x14,0x14,0x12,0x12,
-  0x12,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x12,0x12,0x12,0x12,0x12,0x12,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x12,0x12,0x12,0x12,0x12,0x14,0x15,
-  0x12,0x13,0x15,0x13,0x12,0x05,0x05,0x03,0x5A,0x70,0x78,0x92,0xC5,0xDC,0x5D,0x9A,
-  0xB9,0x41,0x85,0xA7,0x3A,0x7C,0x97,0x54,0x7E,0x85,0x59,0x62,0x4C,0x62,0x48,0x18,
-  0x79,0x4C,0x14,0x7E,0x49,0x0E,0x80,0x47,0x0D,0x7D,0x46,0x0E,0x77,0x44,0x0D,0x74,
-  0x42,0x0D,0x71,0x41,0x0E,0x71,0x40,0x11,0x71,0x40,0x0F,0x72,0x40,0x10,0x72,0x40,
-  0x0F,0x6D,0x41,0x0D,0x6E,0x40,0x0F,0x6A,0x3F,0x14,0x4E,0x24,0x02,0x64,0x39,0x13,
-  0x6D,0x40,0x12,0x5B,0x42,0x27,0x1D,0x21,0x1D,0x3B,0x63,0x6E,0x73,0xA0,0xB2,0x74,
-  0x93,0x9B,0x00,0x0E,0x12,0x00,0x0C,0x0F,0x15,0x27,0x2B,0x0C,0x1B,0x23,0x14,0x2A,
-  0x37,0x33,0x4E,0x5D,0x3C,0x6B,0x7A,0xA6,0xD0,0xDD,0xBC,0xDC,0xE0,0x1D,0x25,0x28,
-  0x14,0x13,0x12,0x15,0x15,0x15,0x14,0x16,0x16,0x11,0x13,0x13,0x14,0x14,0x14,0x15,
-  0x15,0x15,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x12,0x12,0x12,0x12,
-  0x12,0x12,0x12,0x12,0x12,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x13,0x14,0x15,
-  0x13,0x16,0x16,0x14,0x13,0x14,0x14,0x13,0x00,0x01,0x00,0x56,0x6E,0x76,0xA0,0xC6,
-  0xDF,0x65,0x9F,0xBE,0x51,0x8C,0xA7,0x4F,0x82,0x8B,0x5B,0x83,0x82,0x63,0x70,0x61,
-  0x55,0x4F,0x2D,0x68,0x49,0x18,0x78,0x49,0x12,0x7A,0x48,0x0E,0x79,0x47,0x0F,0x79,
-  0x46,0x11,0x74,0x45,0x0F,0x73,0x43,0x0F,0x72,0x42,0x0F,0x73,0x44,0x0B,0x73,0x41,
-  0x0D,0x6E,0x42,0x10,0x6D,0x40,0x12,0x66,0x3D,0x11,0x5A,0x35,0x0B,0x68,0x43,0x1B,
-  0x5D,0x40,0x23,0x4B,0x3C,0x2D,0x09,0x14,0x18,0x60,0x8B,0xA1,0x5B,0x8E,0xA6,0x5E,
-  0x8F,0x9F,0x07,0x1F,0x29,0x00,0x14,0x20,0x23,0x43,0x53,0x23,0x41,0x55,0x67,0x8D,
-  0x9F,0x61,0x83,0x92,0x60,0x7F,0x8C,0x95,0xB1,0xB5,0x22,0x2E,0x2D,0x0E,0x13,0x14,
-  0x19,0x16,0x18,0x18,0x14,0x15,0x12,0x14,0x14,0x13,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,
-  0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x15,0x15,0x15,0x13,0x13,0x13,
-  0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x12,
-  0x12,0x12,0x12,0x12,0x12,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x12,0x12,0x12,0x12,0x12,0x12,0x13,
-  0x14,0x13,0x12,0x12,0x12,0x13,0x12,0x13,0x14,0x14,0x12,0x00,0x00,0x06,0x5E,0x6B,
-  0x7C,0xA6,0xCB,0xE0,0x77,0xAD,0xBD,0x54,0x85,0x8F,0x46,0x75,0x7C,0x55,0x7B,0x7F,
-  0x5F,0x83,0x88,0x45,0x57,0x47,0x5D,0x4F,0x2E,0x6A,0x4E,0x1C,0x77,0x49,0x12,0x79,
-  0x46,0x11,0x7C,0x46,0x0F,0x79,0x46,0x10,0x7D,0x45,0x0E,0x78,0x46,0x10,0x79,0x45,
-  0x0C,0x76,0x44,0x0E,0x6A,0x3E,0x10,0x52,0x29,0x03,0x61,0x42,0x1F,0x46,0x2F,0x1A,
-  0x21,0x19,0x09,0x1A,0x16,0x14,0x08,0x18,0x1D,0x13,0x21,0x34,0x0C,0x27,0x45,0x4E,
-  0x87,0xA3,0x42,0x72,0x8D,0x31,0x5C,0x79,0x30,0x67,0x81,0x63,0x9D,0xB6,0x85,0xB3,
-  0xC9,0x12,0x2E,0x3C,0x7A,0x89,0x8F,0x2D,0x34,0x37,0x0E,0x11,0x10,0x14,0x16,0x16,
-  0x15,0x15,0x15,0x14,0x14,0x14,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,
-  0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,
-  0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,
-  0x15,0x15,0x15,0x14,0x14,0x14,0x13,0x13,0x13,0x12,0x12,0x12,0x13,0x13,0x13,0x14,
-  0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x12,0x12,0x12,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x12,0x12,0x12,
-  0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x12,
-  0x12,0x12,0x13,0x12,0x12,0x12,0x12,0x14,0x19,0x15,0x14,0x18,0x15,0x11,0x01,0x03,
-  0x06,0x31,0x42,0x4B,0xAD,0xCB,0xD6,0x95,0xBE,0xCB,0x4B,0x7B,0x8C,0x4E,0x7F,0x95,
-  0x4E,0x8A,0xA7,0x4C,0x86,0x9D,0x64,0x81,0x80,0x67,0x6C,0x58,0x55,0x4C,0x2E,0x72,
-  0x57,0x2B,0x7D,0x55,0x1E,0x81,0x4C,0x0E,0x82,0x4D,0x0F,0x7B,0x4B,0x15,0x7D,0x4A,
-  0x0E,0x7F,0x4A,0x0E,0x78,0x49,0x12,0x64,0x3F,0x18,0x3F,0x2B,0x14,0x1C,0x17,0x0A,
-  0x13,0x17,0x12,0x0C,0x12,0x14,0x00,0x0D,0x16,0x10,0x29,0x3A,0x4C,0x7F,0x9B,0x4A,
-  0x8B,0xAE,0x53,0x94,0xBC,0x5E,0xA2,0xC9,0x70,0xB1,0xD4,0x82,0xBB,0xD8,0xA2,0xCB,
-  0xDE,0xB5,0xD1,0xD3,0x1A,0x27,0x26,0x10,0x13,0x11,0x16,0x16,0x16,0x13,0x14,0x14,
-  0x13,0x13,0x13,0x15,0x15,0x15,0x15,0x15,0x15,0x14,0x14,0x14,0x15,0x15,0x15,0x15,
-  0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x12,0x12,0x12,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x12,0x12,0x12,0x13,0x13,0x13,0x14,0x14,
-  0x14,0x12,0x12,0x12,0x12,0x12,0x12,0x14,0x14,0x14,0x14,0x14,0x14,0x12,0x12,0x12,
-  0x12,0x12,0x12,0x12,0x12,0x12,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x12,
-  0x12,0x12,0x12,0x12,0x12,0x13,0x13,0x15,0x16,0x13,0x14,0x16,0x16,0x14,0x12,0x14,
-  0x15,0x03,0x08,0x0A,0x15,0x20,0x24,0x9F,0xBA,0xC3,0xA6,0xCE,0xDD,0x7E,0xB1,0xC5,
-  0x70,0xA4,0xBD,0x5D,0x92,0xA2,0x64,0x90,0x9B,0x4F,0x75,0x7E,0x43,0x61,0x61,0x74,
-  0x79,0x5F,0x71,0x54,0x1E,0x82,0x50,0x0E,0x7B,0x52,0x16,0x70,0x44,0x12,0x7C,0x4B,
-  0x11,0x80,0x4C,0x0F,0x7D,0x4E,0x14,0x50,0x2E,0x08,0x26,0x19,0x07,0x1C,0x16,0x12,
-  0x0C,0x13,0x16,0x13,0x20,0x23,0x0F,0x26,0x2C,0x2D,0x48,0x51,0x3E,0x70,0x87,0x73,
-  0xAE,0xCB,0x6C,0xAB,0xD0,0x74,0xB3,0xD6,0x8C,0xC2,0xDC,0xB8,0xE2,0xF4,0x91,0xAA,
-  0xB0,0x08,0x12,0x12,0x15,0x17,0x15,0x19,0x16,0x17,0x17,0x14,0x14,0x17,0x16,0x16,
-  0x13,0x14,0x14,0x13,0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x16,0x16,0x16,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,
-  0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x12,0x12,0x12,0x13,0x13,0x13,0x14,0x14,0x14,
-  0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x12,0x12,0x12,0x12,0x12,0x12,0x13,0x13,0x13,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,
-  0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x12,0x12,0x12,0x13,0x13,0x13,0x12,
-  0x12,0x12,0x13,0x13,0x13,0x14,0x14,0x13,0x13,0x13,0x13,0x15,0x15,0x15,0x17,0x13,
-  0x15,0x14,0x14,0x16,0x0D,0x10,0x10,0x00,0x00,0x03,0x4C,0x5C,0x63,0xAF,0xCA,0xD5,
-  0xB0,0xD2,0xDC,0x71,0x90,0x94,0x60,0x87,0x88,0x82,0xAF,0xBC,0x6E,0xA1,0xA7,0x89,
-  0x9B,0x8A,0x7A,0x6A,0x36,0x83,0x59,0x15,0x6B,0x4E,0x17,0x30,0x19,0x00,0x6A,0x49,
-  0x19,0x78,0x55,0x1A,0x79,0x54,0x1D,0x60,0x48,0x26,0x30,0x28,0x1B,0x13,0x18,0x12,
-  0x01,0x0C,0x0F,0x5F,0x76,0x7C,0x47,0x5E,0x68,0x06,0x15,0x21,0x32,0x55,0x63,0x20,
-  0x48,0x5D,0x80,0xAF,0xC6,0xB0,0xDC,0xEA,0xAD,0xCE,0xD4,0x3C,0x49,0x4A,0x05,0x06,
-  0x06,0x15,0x14,0x14,0x16,0x15,0x15,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,
-  0x13,0x13,0x13,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x16,0x16,0x16,0x15,
-  0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x13,0x13,0x13,0x15,0x15,0x15,0x13,0x13,
-  0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x15,0x15,0x15,0x13,0x13,0x13,0x15,0x15,0x15,
-  0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x13,
-  0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,
-  0x13,0x14,0x14,0x14,0x15,0x15,0x15,0x13,0x13,0x13,0x14,0x14,0x14,0x12,0x12,0x12,
-  0x12,0x12,0x12,0x14,0x14,0x14,0x14,0x14,0x14,0x12,0x12,0x12,0x13,0x13,0x13,0x14,
-  0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x17,0x14,
-  0x15,0x17,0x14,0x15,0x14,0x13,0x14,0x11,0x14,0x12,0x04,0x0A,0x08,0x03,0x0A,0x0B,
-  0x73,0x7D,0x80,0xCC,0xD7,0xD4,0x33,0x41,0x3D,0x4B,0x60,0x61,0xA1,0xC0,0xBD,0x99,
-  0xA7,0x95,0x5F,0x55,0x28,0x6E,0x58,0x26,0x4C,0x45,0x25,0x2D,0x26,0x17,0x41,0x36,
-  0x24,0x47,0x36,0x22,0x46,0x3C,0x26,0x28,0x22,0x17,0x10,0x0F,0x11,0x13,0x16,0x17,
-  0x05,0x10,0x13,0x2C,0x40,0x46,0x11,0x20,0x2E,0x6A,0x89,0x94,0x72,0x8D,0x94,0x41,
-  0x5C,0x68,0xCF,0xE5,0xEF,0x64,0x71,0x75,0x00,0x08,0x06,0x11,0x11,0x11,0x19,0x15,
-  0x18,0x15,0x15,0x15,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x14,
-  0x14,0x14,0x13,0x13,0x13,0x15,0x15,0x15,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,
-  0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x15,0x15,0x15,0x15,0x15,0x15,
-  0x15,0x15,0x15,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x12,
-  0x12,0x12,0x12,0x12,0x12,0x15,0x15,0x15,0x15,0x15,0x15,0x14,0x14,0x14,0x13,0x13,
-  0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x15,0x15,0x15,0x12,0x12,0x12,
-  0x12,0x12,0x12,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x13,
-  0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x14,
-  0x14,0x14,0x15,0x15,0x13,0x13,0x13,0x13,0x14,0x15,0x14,0x14,0x15,0x13,0x14,0x13,
-  0x03,0x04,0x05,0x0A,0x0E,0x0B,0x62,0x67,0x65,0x6D,0x76,0x75,0x71,0x7F,0x7E,0x94,
-  0x9A,0x94,0xA6,0xA8,0x93,0x3A,0x39,0x24,0x00,0x0C,0x07,0xCA,0xDC,0xE0,0x44,0x58,
-  0x59,0x00,0x0B,0x0B,0x00,0x00,0x00,0x43,0x49,0x47,0x38,0x38,0x39,0x12,0x10,0x11,
-  0x0D,0x15,0x14,0x0A,0x17,0x1C,0xC9,0xE1,0xE5,0x94,0xAA,0xB1,0xA4,0xB6,0xB6,0x52,
-  0x5D,0x5E,0x03,0x09,0x09,0x08,0x09,0x0B,0x12,0x16,0x15,0x11,0x13,0x17,0x13,0x15,
-  0x16,0x14,0x13,0x13,0x15,0x15,0x15,0x13,0x13,0x13,0x14,0x14,0x14,0x15,0x15,0x15,
-  0x14,0x14,0x14,0x15,0x15,0x15,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,
-  0x13,0x14,0x14,0x14,0x12,0x12,0x12,0x14,0x14,0x14,0x13,0x13,0x13,0x15,0x15,0x15,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x13,
-  0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x15,0x15,0x15,0x13,0x13,
-  0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x15,0x15,0x15,0x15,0x15,0x15,
-  0x13,0x13,0x13,0x15,0x15,0x15,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,
-  0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x12,0x12,0x12,0x13,0x13,0x13,0x14,0x13,
-  0x13,0x13,0x13,0x13,0x15,0x15,0x15,0x14,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x17,0x15,0x15,0x12,0x12,0x12,0x0B,0x0C,0x0C,0x01,0x07,0x06,0x13,0x19,0x17,0x38,
-  0x3F,0x3A,0x3F,0x43,0x3B,0xC3,0xC4,0xB8,0x45,0x4D,0x44,0x63,0x73,0x71,0xE0,0xF5,
-  0xF8,0xEF,0xFF,0xFF,0x94,0x9D,0x95,0x29,0x2F,0x21,0x1F,0x1C,0x15,0x1D,0x18,0x18,
-  0x18,0x18,0x17,0x5F,0x65,0x64,0x2F,0x35,0x37,0x08,0x0F,0x0E,0x01,0x03,0x01,0x12,
-  0x0F,0x0F,0x18,0x15,0x15,0x17,0x14,0x14,0x14,0x14,0x14,0x15,0x14,0x14,0x13,0x13,
-  0x13,0x13,0x13,0x13,0x15,0x15,0x15,0x15,0x15,0x15,0x16,0x16,0x16,0x14,0x14,0x14,
-  0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x15,
-  0x15,0x15,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x15,0x15,
-  0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x15,0x15,0x15,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x15,
-  0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x13,0x13,0x13,0x15,0x15,0x15,0x13,0x13,
-  0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x15,0x15,0x15,0x13,0x13,0x13,0x14,0x14,0x14,
-  0x15,0x15,0x15,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x12,0x12,0x12,0x14,0x14,0x14,0x13,0x13,
-  0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x15,0x15,0x15,
-  0x17,0x15,0x15,0x14,0x14,0x14,0x13,0x15,0x14,0x10,0x15,0x10,0x10,0x14,0x14,0x0C,
-  0x0F,0x10,0x09,0x0C,0x0E,0x03,0x03,0x00,0x16,0x15,0x12,0x12,0x13,0x12,0x21,0x25,
-  0x27,0x36,0x37,0x37,0x2C,0x29,0x28,0x25,0x24,0x1F,0x1A,0x1A,0x18,0x17,0x15,0x17,
-  0x16,0x13,0x15,0x10,0x0C,0x0E,0x0F,0x0F,0x11,0x11,0x15,0x14,0x15,0x14,0x14,0x17,
-  0x15,0x15,0x14,0x13,0x13,0x16,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x15,
-  0x15,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x12,0x12,0x12,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x15,
-  0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,
-  0x13,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,
-  0x15,0x15,0x15,0x13,0x13,0x13,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x15,
-  0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,
-  0x14,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,
-  0x12,0x12,0x12,0x13,0x13,0x13,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x16,0x14,0x14,0x13,0x13,0x13,0x12,0x14,0x14,0x15,0x14,0x14,0x15,0x14,0x16,0x12,
-  0x14,0x14,0x15,0x15,0x14,0x15,0x14,0x15,0x16,0x13,0x15,0x13,0x13,0x13,0x13,0x11,
-  0x10,0x0F,0x0F,0x0F,0x10,0x0F,0x11,0x13,0x13,0x15,0x10,0x12,0x13,0x12,0x14,0x15,
-  0x11,0x12,0x13,0x14,0x15,0x13,0x14,0x14,0x14,0x13,0x15,0x15,0x16,0x16,0x17,0x14,
-  0x15,0x15,0x12,0x12,0x12,0x15,0x15,0x15,0x15,0x15,0x15,0x14,0x14,0x14,0x15,0x15,
-  0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x15,0x15,0x15,
-  0x15,0x15,0x15,0x14,0x14,0x14,0x15,0x15,0x15,0x14,0x14,0x14,0x14,0x14,0x14,0x14,
-  0x14,0x14,0x14,0x14,0x14,0x13,0x13,0x13,0x14,0x14,0x14,0x13,0x13,0x13,0x13,0x13,
-  0x13,0x15,0x15,0x15,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x13,0x14,0x14,0x14,
-  0x13,0x13,0x13,0x14,0x14,0x14,};
@@ -1,1207 +0,0 @@
-#pragma once
-#include <stdint.h>
-const uint8_t bbcnews[] {
-  0x42,0x4D,0x36,0x4B,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x00,0x00,0x00,0x28,0x00,
-  0x00,0x00,0x50,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x01,0x00,0x18,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x4B,0x00,0x00,0x13,0x0B,0x00,0x00,0x13,0x0B,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x04,0x00,0xB9,0x04,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x04,0x00,0xB9,0x04,0x00,0xB9,0x04,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x04,0x00,0xB9,0x04,0x00,0xB9,0x04,0x00,0xB9,0x04,0x00,0xB9,
-  0x04,0x00,0xB9,0x04,0x00,0xB9,0x04,0x00,0xB9,0x04,0x00,0xB9,0x04,0x00,0xB9,0x04,
-  0x00,0xB9,0x04,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x04,0x00,0xB9,0x04,0x00,0xB9,0x04,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x04,
-  0x00,0xB9,0x04,0x00,0xB9,0x04,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xC6,0xC5,0xEF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF1,0xF1,0xFB,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x00,0x00,0xB7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xF4,0xF4,0xFC,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x6D,0x6A,0xD6,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x00,0x00,0xB7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xF4,0xF4,0xFC,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xBD,0xED,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0x4A,0x46,0xCC,0x09,0x04,0xBA,0x40,0x3C,0xCA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x00,0x00,0xB7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFE,0xFE,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x07,0x02,0xBA,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x04,0x03,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x92,0x90,0xE0,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x00,0x00,0xB7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xF0,0xF0,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x30,0x2B,0xC5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0x28,0x23,0xC3,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x00,0x00,0xB7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xF1,0xF0,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0x07,0x02,0xBA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x4E,0x4B,0xCE,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xB7,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x00,0x00,0xB7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0xD3,0xD2,0xF2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,
-  0x00,0xB9,0xF1,0xF0,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xCD,0xCC,
-  0xF1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x0B,0x06,0xBB,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x00,0x00,0xB7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x01,0xB9,0x05,
-  0x00,0xB9,0xF1,0xF0,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x14,
-  0x10,0xBD,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xF6,0xFC,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0x04,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x00,0x00,0xB7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0xF1,0xF0,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x14,
-  0x10,0xBD,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0x47,0x43,0xCC,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x0D,0x08,0xBB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFD,0xFF,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x00,0x00,0xB7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,
-  0xE7,0xE7,0xF8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0xF1,0xF0,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x1E,0x1A,0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x55,0x52,0xD0,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x07,0x02,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x1C,0x17,0xBF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x00,0x00,0xB7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0x14,0xBF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0xF1,0xF0,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xE4,0xE3,0xF7,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x03,0x00,0xB8,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x00,0x00,0xB7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0xF1,0xF0,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xEF,
-  0xFB,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDB,0xDA,0xF5,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x00,0x00,0xB7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0xF1,0xF0,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x00,0x00,0xB7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0x02,0x00,0xB8,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0xF1,0xF0,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x03,0x00,0xB8,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0x18,0x13,0xBE,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB2,0xB1,0xEA,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x04,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x00,0x00,0xB7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0xF1,0xF0,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFC,0xFC,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x04,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x0C,0x08,0xBB,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0x04,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x43,0x3F,0xCA,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x50,0x4D,0xCE,0xCE,0xCD,0xF1,0x51,0x4D,0xCE,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xF6,0xF6,0xFC,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x04,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x60,0x5D,0xD3,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x5E,0x5B,0xD2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xF6,0xF6,0xFC,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xB8,0xB7,0xEB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x04,0x00,
-  0xB9,0x04,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x3F,0x3B,0xC9,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xF6,0xF6,0xFC,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x04,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0xDD,0xDC,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3F,0x3B,0xC9,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xF6,0xF6,0xFC,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x39,0x35,0xC7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0xDD,0xDC,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0x05,0x00,0xB9,0x81,0x7F,0xDC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xF6,0xF6,0xFC,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x38,
-  0x34,0xC7,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xF6,0xF6,0xFC,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x4F,
-  0x4B,0xCE,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xF6,0xF6,0xFC,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0x05,0x00,0xB9,0x03,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0xDD,0xDC,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0x05,0x00,0xB9,0x14,0x10,0xBD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xF6,0xF6,0xFC,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0xDD,0xDC,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0xF7,0xF7,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xDE,0xF6,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xF6,0xF6,0xFC,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x35,0x32,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xDF,0xDE,0xF6,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xF6,0xF6,0xFC,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x0B,0x06,
-  0xBB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x01,0x00,
-  0xB8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x03,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x01,0x00,0xB8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0xBE,0xBD,0xED,0xBE,0xBD,0xED,0xBE,
-  0xBD,0xED,0xBE,0xBD,0xED,0xBE,0xBD,0xED,0xBE,0xBD,0xED,0xBE,0xBD,0xED,0xBE,0xBD,
-  0xED,0xBE,0xBD,0xED,0xBE,0xBD,0xED,0xBE,0xBD,0xED,0xBE,0xBD,0xED,0xBE,0xBD,0xED,
-  0xBE,0xBD,0xED,0x05,0x00,0xB9,0x05,0x00,0xB9,0xBE,0xBD,0xED,0xBE,0xBD,0xED,0xBE,
-  0xBD,0xED,0xBE,0xBD,0xED,0xBE,0xBD,0xED,0xBE,0xBD,0xED,0xBE,0xBD,0xED,0xBE,0xBD,
-  0xED,0xBE,0xBD,0xED,0xBE,0xBD,0xED,0xBE,0xBD,0xED,0xBE,0xBD,0xED,0xBE,0xBD,0xED,
-  0xBE,0xBD,0xED,0x05,0x00,0xB9,0x05,0x00,0xB9,0xBE,0xBD,0xED,0xBE,0xBD,0xED,0xBE,
-  0xBD,0xED,0xBE,0xBD,0xED,0xBE,0xBD,0xED,0xBE,0xBD,0xED,0xBE,0xBD,0xED,0xBE,0xBD,
-  0xED,0xBE,0xBD,0xED,0xBE,0xBD,0xED,0xBE,0xBD,0xED,0xBE,0xBD,0xED,0xBE,0xBD,0xED,
-  0xBE,0xBD,0xED,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,
-  0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,
-  0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,0x05,0x00,0xB9,
-  0x05,0x00,0xB9,0x05,0x00,0xB9,};
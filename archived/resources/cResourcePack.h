@@ -0,0 +1,268 @@
+// cResourcePack.h - named resources from one indexed pack built by resPack, replaces generated .h byte arrays
+// - pack mapped from a file, linked in as a binary object, or a win32 RCDATA resource, all viewed in place
+// - name lookup hashes into an open addressed slot table, one probe for most names
+// - entries stored or lz compressed, compressed ones expanded once on first get, images optionally pre-decoded rgba
+#pragma once
+//{{{  includes
+#include <stdint.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+
+#include "../decoders/cMappedFile.h"
+//}}}
+
+class cResourcePack {
+public:
+  enum eType { eRaw, eRgba };  // rgba width * 4 stride
+  enum eCodec { eStored, eLz };
+
+  //{{{
+  struct sView {
+    const uint8_t* mData;
+    size_t mSize;
+    eType mType;
+    uint32_t mWidth;
+    uint32_t mHeight;
+    };
+  //}}}
+  //{{{
+  struct sHeader {
+  // pack starts with it, native endian, offsets from pack start
+    uint32_t mMagic;
+    uint32_t mVersion;
+    uint32_t mNumEntries;
+    uint32_t mNumSlots;      // power of 2, slot holds entry index + 1, 0 empty
+    uint32_t mEntriesOffset;
+    uint32_t mSlotsOffset;
+    uint32_t mNamesOffset;
+    uint32_t mBytes;         // whole pack
+    };
+  //}}}
+  //{{{
+  struct sEntry {
+    uint32_t mNameOffset;
+    uint16_t mNameLength;
+    uint8_t mType;
+    uint8_t mCodec;
+    uint32_t mDataOffset;
+    uint32_t mStoredBytes;
+    uint32_t mBytes;
+    uint32_t mWidth;
+    uint32_t mHeight;
+    };
+  //}}}
+
+  static constexpr uint32_t kMagic = 0x50535263;  // "cRSP"
+  static constexpr uint32_t kVersion = 1;
+
+  //{{{
+  bool open (const uint8_t* pack, size_t size) {
+  // view pack in memory, linked blob or caller's buffer, must outlive the views, false if malformed
+
+    mPack = nullptr;
+    mExpanded.clear();
+
+    if (!pack || (size < sizeof(sHeader)))
+      return false;
+
+    sHeader header;
+    memcpy (&header, pack, sizeof(header));
+    if ((header.mMagic != kMagic) || (header.mVersion != kVersion) || (header.mBytes != size) ||
+        !header.mNumSlots || (header.mNumSlots & (header.mNumSlots - 1)) ||
+        (header.mNumSlots < header.mNumEntries) ||
+        ((uint64_t)header.mEntriesOffset + (uint64_t)header.mNumEntries * sizeof(sEntry) > size) ||
+        ((uint64_t)header.mSlotsOffset + (uint64_t)header.mNumSlots * 4 > size) ||
+        (header.mNamesOffset > size))
+      return false;
+
+    // entries must stay inside the pack, get trusts them after this
+    for (uint32_t i = 0; i < header.mNumEntries; i++) {
+      sEntry entry;
+      memcpy (&entry, pack + header.mEntriesOffset + i * sizeof(sEntry), sizeof(entry));
+      if (((uint64_t)entry.mNameOffset + entry.mNameLength > size) ||
+          ((uint64_t)entry.mDataOffset + entry.mStoredBytes > size) ||
+          ((entry.mCodec == eStored) && (entry.mStoredBytes != entry.mBytes)) || (entry.mCodec > eLz))
+        return false;
+      }
+
+    mPack = pack;
+    mHeader = header;
+    mExpanded.resize (header.mNumEntries);
+    return true;
+    }
+  //}}}
+  //{{{
+  bool openFile (const std::string& fileName) {
+  // map pack file, random access, pages in only the entries used
+
+    return mFile.open (fileName, false) && open (mFile.getBuffer(), mFile.getSize());
+    }
+  //}}}
+#ifdef _WIN32
+  //{{{
+  bool openResource (const char* name) {
+  // pack linked as RCDATA by the .rc resPack -r writes, resource memory lives with the exe
+
+    HRSRC resource = FindResourceA (NULL, name, MAKEINTRESOURCEA(10));  // RT_RCDATA
+    if (!resource)
+      return false;
+
+    HGLOBAL global = LoadResource (NULL, resource);
+    if (!global)
+      return false;
+
+    return open ((const uint8_t*)LockResource (global), SizeofResource (NULL, resource));
+    }
+  //}}}
+#endif
+
+  bool isOpen() { return mPack != nullptr; }
+  uint32_t getNumEntries() { return mPack ? mHeader.mNumEntries : 0; }
+
+  //{{{
+  bool get (const char* name, sView& view) {
+  // find name, expand it first time if compressed, false if absent or corrupt
+
+    if (!mPack)
+      return false;
+
+    size_t length = strlen (name);
+    uint32_t mask = mHeader.mNumSlots - 1;
+    for (uint32_t slot = getHash (name, length) & mask, probes = 0; probes < mHeader.mNumSlots;
+         slot = (slot + 1) & mask, probes++) {
+      uint32_t index;
+      memcpy (&index, mPack + mHeader.mSlotsOffset + slot * 4, 4);
+      if (!index || (index > mHeader.mNumEntries))
+        return false;
+
+      sEntry entry;
+      memcpy (&entry, mPack + mHeader.mEntriesOffset + (index - 1) * sizeof(sEntry), sizeof(entry));
+      if ((entry.mNameLength == length) && !memcmp (mPack + entry.mNameOffset, name, length))
+        return getData (index - 1, entry, view);
+      }
+
+    return false;
+    }
+  //}}}
+  //{{{
+  sView get (const char* name) {
+  // empty view if absent
+
+    sView view = { nullptr, 0, eRaw, 0, 0 };
+    get (name, view);
+    return view;
+    }
+  //}}}
+
+  //{{{
+  static uint32_t getHash (const char* name, size_t length) {
+  // fnv-1a, resPack places names with the same hash
+
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++)
+      hash = (hash ^ (uint8_t)name[i]) * 16777619u;
+    return hash;
+    }
+  //}}}
+  //{{{
+  static bool lzExpand (const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize) {
+  // lz4 style sequences, token literal count nibble, match length - 4 nibble, 255 extended, 16 bit offset
+  // - last sequence literals only, true if src expands to exactly dstSize
+
+    const uint8_t* srcEnd = src + srcSize;
+    uint8_t* dstStart = dst;
+    uint8_t* dstEnd = dst + dstSize;
+
+    while (src < srcEnd) {
+      uint32_t token = *src++;
+
+      size_t literals = token >> 4;
+      if (literals == 15) {
+        uint32_t extra;
+        do {
+          if (src >= srcEnd)
+            return false;
+          extra = *src++;
+          literals += extra;
+          } while (extra == 255);
+        }
+      if ((literals > size_t(srcEnd - src)) || (literals > size_t(dstEnd - dst)))
+        return false;
+      memcpy (dst, src, literals);
+      src += literals;
+      dst += literals;
+
+      if (src == srcEnd)
+        break;
+
+      if (srcEnd - src < 2)
+        return false;
+      size_t offset = src[0] | (src[1] << 8);
+      src += 2;
+      size_t match = (token & 15) + 4;
+      if ((token & 15) == 15) {
+        uint32_t extra;
+        do {
+          if (src >= srcEnd)
+            return false;
+          extra = *src++;
+          match += extra;
+          } while (extra == 255);
+        }
+      if (!offset || (offset > size_t(dst - dstStart)) || (match > size_t(dstEnd - dst)))
+        return false;
+
+      // overlapping copy repeats the last offset bytes
+      const uint8_t* from = dst - offset;
+      if (offset >= match) {
+        memcpy (dst, from, match);
+        dst += match;
+        }
+      else
+        while (match--)
+          *dst++ = *from++;
+      }
+
+    return dst == dstEnd;
+    }
+  //}}}
+
+private:
+  //{{{
+  bool getData (uint32_t index, const sEntry& entry, sView& view) {
+
+    view.mSize = entry.mBytes;
+    view.mType = (eType)entry.mType;
+    view.mWidth = entry.mWidth;
+    view.mHeight = entry.mHeight;
+
+    if (entry.mCodec == eStored) {
+      view.mData = mPack + entry.mDataOffset;
+      return true;
+      }
+
+    std::unique_lock<std::mutex> lock (mMutex);
+
+    if (!mExpanded[index]) {
+      std::unique_ptr<uint8_t[]> data (new uint8_t[entry.mBytes ? entry.mBytes : 1]);
+      if (!lzExpand (mPack + entry.mDataOffset, entry.mStoredBytes, data.get(), entry.mBytes))
+        return false;
+      mExpanded[index] = std::move (data);
+      }
+
+    view.mData = mExpanded[index].get();
+    return true;
+    }
+  //}}}
+
+  const uint8_t* mPack = nullptr;
+  sHeader mHeader;
+  cMappedFile mFile;
+
+  std::mutex mMutex;
+  std::vector<std::unique_ptr<uint8_t[]>> mExpanded;  // per entry, compressed ones once got
+  };
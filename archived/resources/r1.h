@@ -1,1207 +0,0 @@
-#pragma once
-#include <stdint.h>
-const uint8_t r1[] {
-  0x42,0x4D,0x36,0x4B,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x00,0x00,0x00,0x28,0x00,
-  0x00,0x00,0x50,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x01,0x00,0x18,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x4B,0x00,0x00,0xC4,0x0E,0x00,0x00,0xC4,0x0E,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCB,0xC9,0xCB,0x9E,0x9B,0x9D,0x74,0x72,0x74,0x54,
-  0x4F,0x51,0x3B,0x36,0x38,0x22,0x1D,0x1F,0x1B,0x15,0x1A,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1A,0x14,0x19,0x2B,0x25,0x2A,0x42,0x3C,0x41,0x5E,0x59,0x5D,
-  0x81,0x7F,0x81,0xAB,0xA9,0xAB,0xDE,0xDC,0xDD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,
-  0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC4,0xC5,0xC5,0x73,0x70,0x72,
-  0x27,0x1F,0x26,0x01,0x00,0x00,0x09,0x01,0x08,0x0E,0x06,0x0D,0x12,0x0A,0x12,0x15,
-  0x10,0x12,0x18,0x13,0x15,0x1B,0x16,0x19,0x1C,0x15,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1A,0x14,0x19,0x17,0x11,0x16,0x14,0x0E,0x13,
-  0x11,0x09,0x10,0x0C,0x04,0x0B,0x07,0x00,0x05,0x03,0x00,0x02,0x40,0x37,0x3F,0x8B,
-  0x8B,0x8B,0xE2,0xE3,0xE2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,
-  0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xDA,0xD7,0xD9,0x68,0x65,0x67,0x0B,0x05,0x0A,0x05,0x00,0x04,0x10,0x0A,0x0F,
-  0x17,0x11,0x16,0x1B,0x15,0x1A,0x1B,0x15,0x1A,0x1B,0x16,0x1A,0x1B,0x16,0x1A,0x1B,
-  0x15,0x1B,0x1C,0x15,0x1B,0x1C,0x15,0x1B,0x1C,0x15,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1B,0x16,0x1A,
-  0x1B,0x16,0x1A,0x1B,0x16,0x1A,0x1B,0x16,0x1A,0x1B,0x15,0x1A,0x15,0x0F,0x14,0x0D,
-  0x07,0x0C,0x02,0x00,0x01,0x23,0x1D,0x21,0x8D,0x8C,0x8B,0xFD,0xFC,0xFB,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB5,0xB3,0xB5,0x2B,0x28,
-  0x2A,0x00,0x00,0x00,0x0E,0x0C,0x0D,0x1A,0x13,0x19,0x1C,0x16,0x1B,0x1B,0x15,0x1A,
-  0x1B,0x16,0x1A,0x1B,0x16,0x1A,0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x1B,0x16,0x1A,0x1C,
-  0x15,0x1B,0x1C,0x15,0x1B,0x1C,0x15,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1B,0x16,0x1A,0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1B,0x15,0x1A,0x17,0x11,0x16,0x0A,0x07,0x0B,0x00,0x00,0x00,0x57,0x53,
-  0x57,0xE2,0xDE,0xE2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xB3,0xB1,0xB3,0x1B,0x16,0x19,0x05,0x01,0x03,0x15,0x11,
-  0x14,0x1A,0x16,0x19,0x1A,0x16,0x19,0x1C,0x15,0x1B,0x1B,0x15,0x1A,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1A,0x1A,0x15,0x1C,0x19,0x15,0x1B,0x12,0x0C,
-  0x12,0x01,0x00,0x00,0x45,0x3E,0x45,0xE7,0xE6,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDC,
-  0xD9,0xDB,0x2B,0x27,0x2A,0x04,0x00,0x03,0x18,0x11,0x17,0x1C,0x15,0x1B,0x1C,0x15,
-  0x1B,0x1C,0x15,0x1B,0x1C,0x15,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1A,0x1C,0x16,0x1A,0x1C,0x16,
-  0x1A,0x1B,0x15,0x1A,0x14,0x0E,0x13,0x00,0x00,0x00,0x62,0x5F,0x61,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x68,0x69,0x68,0x00,
-  0x00,0x00,0x14,0x11,0x13,0x1A,0x17,0x19,0x1C,0x15,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x15,0x1B,0x19,0x16,0x18,0x0D,0x0A,0x0C,0x08,0x05,0x06,
-  0xB0,0xB1,0xB0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,
-  0xFD,0xFC,0xFE,0xFF,0xFF,0xFF,0xE4,0xE1,0xE4,0x18,0x14,0x17,0x0B,0x07,0x0A,0x1A,
-  0x15,0x19,0x1B,0x16,0x1A,0x1B,0x16,0x1A,0x1C,0x15,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x15,0x1B,0x1B,0x16,0x1A,0x1A,0x15,0x19,0x19,0x14,0x18,
-  0x00,0x00,0x00,0x4F,0x4B,0x4E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFF,0xFD,0xFF,
-  0xFF,0xFF,0xFF,0x9E,0x9C,0x9E,0x00,0x00,0x00,0x18,0x11,0x17,0x1C,0x15,0x1B,0x1C,
-  0x15,0x1B,0x1C,0x15,0x1B,0x1C,0x15,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x15,0x1B,0x1C,0x15,0x1B,0x1C,0x15,0x1B,
-  0x1C,0x15,0x1B,0x10,0x0A,0x0F,0x15,0x10,0x13,0xE7,0xE5,0xE6,0xFF,0xFF,0xFF,0xFD,
-  0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0x68,0x62,0x64,0x03,0x00,0x00,0x1B,0x15,0x1A,0x1B,0x15,0x1A,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x15,0x1A,0x17,0x10,0x16,0x02,0x00,0x01,0xBF,0xB7,0xBE,0xFF,
-  0xFF,0xFF,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x45,0x41,0x44,
-  0x09,0x03,0x08,0x1C,0x16,0x1B,0x1B,0x15,0x1A,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1B,0x15,0x1A,0x1A,0x14,0x19,0x00,0x00,0x00,0x9E,
-  0x9B,0x9D,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,
-  0xFD,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x37,0x34,0x35,0x0C,0x07,0x0B,
-  0x1C,0x16,0x1B,0x1B,0x15,0x1A,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x1C,0x16,0x1B,0x1C,0x15,0x1B,0x1C,
-  0x15,0x1B,0x1C,0x15,0x1B,0x1C,0x15,0x1B,0x1C,0x15,0x1B,0x1C,0x15,0x1B,0x1C,0x15,
-  0x1B,0x1C,0x15,0x1B,0x1C,0x15,0x1B,0x1C,0x15,0x1B,0x1C,0x15,0x1B,0x1C,0x15,0x1B,
-  0x1C,0x15,0x1B,0x1B,0x15,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1B,0x15,0x1A,0x1B,0x15,0x1A,0x00,
-  0x00,0x00,0x8D,0x8A,0x8C,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,0xFD,
-  0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3B,0x35,0x38,0x0F,0x0A,0x0C,0x1C,0x16,0x1A,
-  0x1B,0x15,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x1C,0x15,0x1B,0x12,0x0C,0x11,0x02,0x00,0x01,0x03,
-  0x00,0x02,0x03,0x00,0x02,0x03,0x00,0x02,0x03,0x00,0x02,0x03,0x00,0x02,0x03,0x00,
-  0x02,0x03,0x00,0x02,0x03,0x00,0x02,0x03,0x00,0x02,0x03,0x00,0x02,0x03,0x00,0x02,
-  0x03,0x00,0x02,0x0B,0x06,0x0A,0x1B,0x15,0x1A,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x15,0x1B,0x19,
-  0x16,0x18,0x00,0x00,0x00,0x97,0x94,0x97,0xFF,0xFF,0xFF,0xFE,0xFD,0xFE,0xFE,0xFD,
-  0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFF,0xFE,
-  0xFF,0xFF,0xFF,0xFF,0x53,0x4D,0x50,0x0C,0x06,0x0B,0x1B,0x15,0x1A,0x1C,0x15,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x14,0x0B,0x13,0x68,0x63,0x67,0xFC,0xFD,0xFC,0xEE,
-  0xEF,0xEF,0xEE,0xEF,0xEE,0xEE,0xEF,0xEE,0xEE,0xEF,0xEE,0xEE,0xEF,0xEE,0xEE,0xEF,
-  0xEE,0xEE,0xEF,0xEE,0xEE,0xEF,0xEE,0xEE,0xEF,0xEE,0xEE,0xEF,0xEE,0xEE,0xEE,0xEE,
-  0xF5,0xF4,0xF6,0xB7,0xB2,0xB4,0x0C,0x04,0x09,0x1B,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x15,0x1B,0x1B,0x15,0x1A,0x00,0x00,0x00,0xB3,0xAF,0xB0,0xFF,0xFF,0xFF,0xFE,0xFD,
-  0xFF,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,
-  0xFF,0x78,0x75,0x77,0x06,0x00,0x03,0x1C,0x16,0x1B,0x1B,0x15,0x1A,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x12,0x09,0x11,0x6F,0x6A,0x6E,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xC6,0xC2,0xC4,0x08,0x02,0x06,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1B,
-  0x15,0x1A,0x1C,0x16,0x1B,0x1A,0x14,0x19,0x00,0x00,0x00,0xDA,0xD8,0xDA,0xFF,0xFF,
-  0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFF,0xFF,0xFF,0xBA,0xB6,
-  0xB9,0x00,0x00,0x00,0x1B,0x16,0x1A,0x1B,0x15,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x12,0x09,0x11,0x6D,0x68,0x6C,0xFF,0xFF,0xFF,0xFD,
-  0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,
-  0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFE,0xFD,0xFE,0xFD,0xFE,0xFD,
-  0xFF,0xFF,0xFF,0xC3,0xC0,0xC1,0x08,0x02,0x06,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1B,0x15,0x1A,0x18,0x12,0x16,0x0D,0x08,0x0C,0xFF,0xFF,
-  0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xF6,0xF5,0xF5,0x04,0x00,
-  0x03,0x1B,0x15,0x1A,0x1B,0x15,0x1A,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x12,0x09,0x11,0x6D,0x68,0x6C,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFC,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC1,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1B,0x15,0x1B,0x13,0x0C,0x12,0x39,0x35,
-  0x38,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0x31,0x30,0x2F,0x13,0x0D,
-  0x12,0x1B,0x15,0x1A,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x12,0x09,0x11,0x6D,0x68,0x6C,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC2,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x15,0x1B,0x04,0x01,
-  0x04,0x8F,0x90,0x8F,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0x98,0x94,0x96,0x06,0x00,0x02,0x1C,0x15,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x12,0x09,0x11,0x6D,0x68,0x6C,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC1,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x15,0x1B,0x19,0x15,
-  0x19,0x00,0x00,0x00,0xF5,0xF3,0xF4,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x02,0x00,0x00,0x1C,0x15,0x18,0x1B,0x15,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x12,0x09,0x11,0x6D,0x68,0x6C,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC3,0xC0,0xC1,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1A,0x15,
-  0x19,0x11,0x0E,0x10,0x3D,0x3A,0x3C,0xFF,0xFF,0xFF,0xFC,0xFD,0xFC,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFF,0xFF,0xFF,0x5A,0x58,0x59,0x10,0x0B,0x0E,0x1D,0x15,0x18,0x1B,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x12,0x09,0x11,0x6D,0x68,0x6C,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC2,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1B,0x15,
-  0x1A,0x1A,0x17,0x19,0x00,0x00,0x00,0xC2,0xC1,0xC1,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,
-  0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,
-  0xFF,0xFF,0xEA,0xE3,0xE8,0x00,0x00,0x00,0x1B,0x15,0x1A,0x1B,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x12,0x09,0x11,0x6D,0x68,0x6C,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC1,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x15,0x1B,0x17,0x11,0x16,0x24,0x1F,0x22,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,
-  0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFF,
-  0xFF,0xFF,0x52,0x4B,0x50,0x13,0x0C,0x12,0x1B,0x16,0x1A,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x12,0x09,0x11,0x6D,0x68,0x6C,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC1,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1B,0x15,0x1B,0x06,0x00,0x03,0xB7,0xB4,0xB6,0xFF,0xFF,0xFF,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xEE,
-  0xEC,0xED,0x00,0x00,0x00,0x1B,0x15,0x1A,0x1B,0x16,0x1A,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x12,0x09,0x11,0x6D,0x68,0x6C,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC3,0xC0,0xC2,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x15,0x1B,0x16,0x11,0x14,0x28,0x25,0x27,0xFF,0xFF,0xFF,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0x6E,
-  0x6B,0x6D,0x0D,0x0B,0x0C,0x1A,0x15,0x19,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x12,0x09,0x11,0x6D,0x68,0x6C,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC1,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x15,0x1B,0x1A,0x17,0x19,0x01,0x00,0x00,0xD1,0xCE,0xD0,
-  0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,
-  0x03,0x05,0x18,0x15,0x17,0x1A,0x15,0x19,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x12,0x09,0x11,0x6D,0x68,0x6C,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC1,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x15,0x1B,0x1A,0x17,0x19,0x10,0x0D,0x0F,0x58,0x56,0x58,
-  0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xB1,0xAF,0xB0,0x08,
-  0x02,0x07,0x1B,0x16,0x1A,0x1B,0x15,0x1A,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x12,0x09,0x11,0x6D,0x68,0x6C,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC2,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x15,0x1B,0x1B,0x16,0x1A,0x1A,0x14,0x19,0x02,0x00,0x01,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0x4E,0x4B,0x4C,0x14,
-  0x0D,0x13,0x1C,0x15,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x12,0x09,0x11,0x6D,0x68,0x6C,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC1,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1B,0x15,0x1A,0x09,0x03,0x08,
-  0xAC,0xAC,0xAC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x03,0x00,0x01,0x1B,
-  0x14,0x1A,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x12,0x09,0x11,0x6D,0x68,0x6C,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC2,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x13,0x0C,0x12,
-  0x51,0x52,0x52,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC5,0xC0,0xC4,0x08,0x00,0x07,0x1B,
-  0x16,0x1A,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x12,0x09,0x11,0x6D,0x68,0x6C,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC1,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1A,0x14,0x19,
-  0x09,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x75,0x79,0x10,0x08,0x0F,0x1B,
-  0x16,0x1A,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x12,0x09,0x11,0x6D,0x68,0x6C,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC1,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1B,0x16,0x1A,
-  0x05,0x00,0x04,0xE0,0xDD,0xDF,0xFF,0xFF,0xFF,0x38,0x33,0x37,0x16,0x0E,0x15,0x1B,
-  0x16,0x1A,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x12,0x09,0x11,0x6D,0x68,0x6C,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC2,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1A,
-  0x0B,0x05,0x0C,0xA3,0xA1,0xA2,0xFF,0xFF,0xFF,0x03,0x00,0x02,0x1C,0x13,0x1B,0x1B,
-  0x16,0x1A,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x12,0x09,0x11,0x6D,0x68,0x6C,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC1,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1A,
-  0x10,0x0C,0x12,0x6F,0x6C,0x6E,0xED,0xEE,0xED,0x03,0x00,0x01,0x1D,0x14,0x1C,0x1B,
-  0x16,0x1A,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x12,0x09,0x11,0x6D,0x68,0x6C,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC1,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1A,
-  0x14,0x11,0x18,0x42,0x3F,0x41,0xC6,0xC4,0xC5,0x06,0x03,0x05,0x1B,0x16,0x1A,0x1C,
-  0x15,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x12,0x09,0x11,0x6D,0x68,0x6C,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC2,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x15,0x1B,
-  0x1A,0x16,0x18,0x1E,0x1A,0x1C,0xA8,0xA5,0xA7,0x09,0x06,0x08,0x1A,0x17,0x19,0x1C,
-  0x15,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x12,0x09,0x11,0x6D,0x68,0x6C,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC1,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x15,0x1B,
-  0x1C,0x17,0x18,0x1B,0x16,0x18,0x8E,0x8B,0x8E,0x0D,0x0A,0x0C,0x1A,0x17,0x19,0x1C,
-  0x15,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x12,0x09,0x11,0x6D,0x68,0x6C,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC2,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x15,0x1B,
-  0x1B,0x17,0x18,0x1C,0x17,0x19,0x7E,0x7A,0x7C,0x10,0x0B,0x0D,0x1C,0x17,0x1A,0x1C,
-  0x15,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x12,0x09,0x11,0x6D,0x68,0x6C,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC1,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x15,0x1B,0x1B,0x15,0x1B,0x71,0x6D,0x6F,0x12,0x0D,0x0E,0x1C,0x17,0x19,0x1C,
-  0x15,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x12,0x09,0x11,0x6D,0x68,0x6C,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC1,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1B,0x15,0x1A,0x1C,0x16,0x1B,0x6A,0x65,0x67,0x13,0x0E,0x10,0x1B,0x16,0x1A,0x1C,
-  0x15,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x12,0x09,0x11,0x6D,0x68,0x6C,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC2,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x15,0x1A,0x6C,0x66,0x6B,0x14,0x0D,0x13,0x1B,0x15,0x1A,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x12,0x09,0x11,0x6D,0x68,0x6C,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC1,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x15,0x1A,0x71,0x6C,0x71,0x11,0x0B,0x11,0x1C,0x15,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x12,0x09,0x11,0x6D,0x68,0x6C,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC1,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1B,0x15,0x1B,0x1B,0x15,0x1B,0x80,0x7A,0x7D,0x11,0x0B,0x0E,0x1B,0x16,0x1A,0x1C,
-  0x15,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x12,0x09,0x11,0x6D,0x68,0x6C,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC2,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x15,0x1B,
-  0x1B,0x16,0x19,0x1C,0x17,0x19,0x91,0x8D,0x8F,0x0F,0x0A,0x0B,0x1B,0x17,0x19,0x1C,
-  0x15,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x12,0x09,0x11,0x6D,0x68,0x6C,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC1,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x15,0x1B,
-  0x1B,0x17,0x18,0x1C,0x17,0x19,0xAB,0xA7,0xA9,0x0C,0x07,0x08,0x1B,0x17,0x19,0x1C,
-  0x15,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x12,0x09,0x11,0x6D,0x68,0x6C,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC2,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x15,0x1B,
-  0x1C,0x17,0x18,0x1A,0x15,0x17,0xC6,0xC7,0xC6,0x07,0x02,0x06,0x1D,0x14,0x1C,0x1B,
-  0x16,0x1A,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x12,0x09,0x11,0x6D,0x68,0x6C,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC1,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x15,0x1B,
-  0x1B,0x16,0x17,0x20,0x1B,0x1D,0xEF,0xF0,0xF0,0x02,0x00,0x01,0x1D,0x14,0x1C,0x1B,
-  0x16,0x1A,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x12,0x09,0x11,0x6D,0x68,0x6C,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC1,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x15,0x1B,
-  0x17,0x12,0x13,0x45,0x40,0x42,0xFF,0xFF,0xFF,0x04,0x00,0x03,0x1C,0x13,0x1B,0x1B,
-  0x16,0x1A,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x12,0x09,0x11,0x6D,0x68,0x6C,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC2,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1B,0x15,0x1B,
-  0x12,0x0C,0x0F,0x73,0x6F,0x70,0xFF,0xFF,0xFF,0x3A,0x35,0x3A,0x17,0x0E,0x16,0x1B,
-  0x16,0x1A,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x12,0x09,0x11,0x6D,0x68,0x6C,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC1,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1B,0x16,0x1A,
-  0x0D,0x04,0x0C,0xA6,0xA4,0xA6,0xFF,0xFF,0xFF,0x7D,0x78,0x7C,0x0F,0x07,0x0E,0x1B,
-  0x16,0x1A,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x15,0x1A,0x1C,0x15,0x1B,0x1C,0x15,0x1B,
-  0x1B,0x16,0x1A,0x1B,0x16,0x1A,0x12,0x09,0x11,0x6D,0x68,0x6C,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC1,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1B,0x16,0x1A,
-  0x05,0x00,0x04,0xE3,0xE1,0xE3,0xFF,0xFF,0xFF,0xC6,0xC5,0xC6,0x08,0x01,0x05,0x1C,
-  0x16,0x1B,0x1B,0x15,0x1A,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x15,0x1A,0x17,0x13,0x18,0x0C,0x08,0x0B,0x0D,0x07,0x0B,
-  0x0D,0x05,0x0C,0x0D,0x05,0x0C,0x01,0x00,0x00,0x62,0x60,0x61,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC2,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1A,0x14,0x19,
-  0x0C,0x06,0x09,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0x00,0x02,0x1B,
-  0x15,0x1B,0x1B,0x15,0x1A,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x15,0x1A,0x18,0x12,0x17,0x32,0x2E,0x34,0xA5,0xA3,0xA4,0x95,0x92,0x94,
-  0x96,0x91,0x95,0x96,0x91,0x95,0x8E,0x8D,0x8E,0xB9,0xB9,0xB9,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC1,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x12,0x0C,0x12,
-  0x58,0x54,0x54,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0x53,0x4C,0x4F,0x13,
-  0x0D,0x12,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1B,0x15,0x1A,0x1B,0x15,0x1A,0x04,0x00,0x07,0xF7,0xF5,0xF7,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC2,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x08,0x02,0x08,
-  0xB3,0xAF,0xB0,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xB4,0xB3,0xB4,0x07,
-  0x01,0x06,0x1B,0x15,0x1A,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1B,0x15,0x1A,0x1C,0x16,0x1B,0x13,0x0E,0x10,0x47,0x42,0x45,0xFF,0xFF,0xFF,
-  0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC1,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1A,0x14,0x19,0x06,0x00,0x05,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0x0C,
-  0x05,0x0B,0x1A,0x14,0x19,0x1B,0x15,0x1A,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1B,0x15,0x1B,0x1B,0x17,0x18,0x00,0x00,0x00,0xD6,0xD3,0xD5,
-  0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC3,0xC0,0xC1,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x12,0x0C,0x11,0x60,0x5A,0x5F,
-  0xFF,0xFF,0xFF,0xFD,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0x74,
-  0x6F,0x73,0x11,0x0A,0x10,0x1C,0x15,0x1B,0x1B,0x16,0x1A,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x15,0x1B,0x1B,0x16,0x18,0x16,0x11,0x13,0x30,0x2C,0x2E,
-  0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC2,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1B,0x15,0x1A,0x01,0x00,0x00,0xD7,0xD3,0xD6,
-  0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xF0,
-  0xF0,0xF0,0x00,0x00,0x00,0x1C,0x15,0x1B,0x1B,0x15,0x1A,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x15,0x1B,0x1B,0x15,0x1B,0x05,0x00,0x04,
-  0xBF,0xB8,0xBE,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC1,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x17,0x0F,0x16,0x30,0x2A,0x2F,0xFF,0xFF,0xFF,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,
-  0xFF,0xFF,0x59,0x52,0x58,0x13,0x0C,0x12,0x1D,0x17,0x1C,0x1B,0x15,0x1A,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x18,0x10,0x17,
-  0x1F,0x19,0x1E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC1,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x15,0x1B,0x1B,0x16,0x1B,0x05,0x00,0x04,0xC0,0xBC,0xC0,0xFF,0xFF,0xFF,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,
-  0xFF,0xFF,0xED,0xEA,0xEC,0x00,0x00,0x00,0x1B,0x15,0x1A,0x1B,0x15,0x1A,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1B,0x16,0x1B,0x1C,0x15,0x1A,
-  0x06,0x00,0x04,0xA4,0xA2,0xA2,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC3,0xC0,0xC2,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x15,
-  0x1A,0x1B,0x16,0x19,0x16,0x11,0x14,0x28,0x23,0x27,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFF,0xFF,0xFF,0x64,0x61,0x64,0x10,0x09,0x0E,0x1B,0x15,0x1A,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x15,0x19,
-  0x19,0x14,0x15,0x11,0x0C,0x0E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC1,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1B,0x15,
-  0x19,0x1C,0x17,0x18,0x01,0x00,0x00,0xCA,0xC9,0xC9,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0x00,0x05,0x1A,0x14,0x19,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1B,0x15,0x19,
-  0x1C,0x17,0x18,0x0B,0x06,0x08,0x89,0x88,0x89,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC1,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1B,0x15,
-  0x19,0x12,0x0E,0x0F,0x48,0x42,0x44,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0x9F,0x9C,0x9F,0x05,0x00,0x02,0x1C,0x15,
-  0x1B,0x1B,0x15,0x1A,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x15,0x1A,
-  0x1B,0x16,0x1A,0x1A,0x14,0x19,0x07,0x01,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC1,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1B,0x15,0x1A,0x1B,0x14,
-  0x19,0x03,0x00,0x01,0xF8,0xF7,0xF8,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFC,0xFE,0xFF,0xFF,0xFF,0x3A,0x35,0x36,0x12,0x0C,
-  0x12,0x1C,0x16,0x1B,0x1B,0x15,0x1A,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x15,0x1B,0x1B,0x15,0x1B,0x10,0x09,0x0C,0x75,0x71,0x73,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC3,0xC0,0xC1,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1B,0x15,0x1A,0x1C,0x16,0x1B,0x04,0x00,
-  0x03,0xA1,0x9C,0x9F,0xFF,0xFF,0xFF,0xFD,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFF,0xFF,0xFF,0xFF,0xFD,0xFB,0xFC,0x08,0x02,
-  0x07,0x19,0x13,0x18,0x1C,0x15,0x1B,0x1B,0x16,0x1A,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1B,0x16,0x1B,0x1C,0x14,0x19,0x00,0x00,0x00,0xF8,0xF7,0xF8,0xFF,
-  0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC2,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x1C,0x15,0x1B,0x11,0x0B,0x10,0x44,0x3E,
-  0x42,0xFF,0xFF,0xFF,0xFE,0xFE,0xFF,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFE,0xFD,0xFF,0xFF,0xFF,0xC2,0xC3,
-  0xC2,0x00,0x00,0x00,0x1D,0x14,0x1C,0x1B,0x16,0x1A,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1B,0x15,0x1B,0x11,0x0B,0x10,0x5A,0x54,0x59,0xFF,
-  0xFF,0xFF,0xFD,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xC2,0xC0,0xC1,0x08,0x02,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x19,0x10,0x18,0x0F,0x0D,0x0E,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,
-  0xFF,0x87,0x82,0x86,0x04,0x00,0x03,0x1C,0x16,0x1B,0x1C,0x15,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1B,0x15,0x1A,0x00,0x00,0x00,0xE5,
-  0xE6,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xC5,0xC3,0xC4,0x08,0x01,0x07,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x15,0x1B,0x1C,0x15,0x1B,0x1A,0x14,0x19,0x02,0x00,0x01,0xE3,0xE1,0xE2,0xFF,0xFF,
-  0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,
-  0xFD,0xFF,0xFF,0xFF,0x5D,0x58,0x5C,0x09,0x04,0x07,0x1A,0x16,0x19,0x1B,0x15,0x1A,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x14,0x0E,0x13,0x43,
-  0x41,0x43,0xFF,0xFE,0xFF,0xF0,0xEE,0xEF,0xF0,0xEE,0xEF,0xF0,0xEE,0xEF,0xF0,0xEE,
-  0xEF,0xF0,0xEE,0xEF,0xF0,0xEE,0xEF,0xF0,0xEE,0xEF,0xF0,0xEE,0xEF,0xF0,0xEE,0xEF,
-  0xF7,0xF7,0xF7,0xB7,0xB4,0xB6,0x0B,0x05,0x09,0x1B,0x15,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x15,0x1B,0x1B,
-  0x16,0x1A,0x1A,0x15,0x19,0x00,0x00,0x00,0xBE,0xBA,0xBD,0xFF,0xFF,0xFF,0xFD,0xFD,
-  0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFD,0xFD,0xFD,0xFF,0xFF,0xFF,0x44,0x42,0x44,0x0A,0x07,0x09,0x1A,0x15,0x19,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1B,0x15,0x1A,0x16,
-  0x0F,0x14,0x03,0x00,0x03,0x03,0x00,0x01,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,
-  0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,
-  0x05,0x00,0x01,0x0C,0x07,0x09,0x1C,0x16,0x1A,0x1B,0x15,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x15,0x1B,0x18,
-  0x16,0x17,0x00,0x00,0x00,0xA6,0xA4,0xA5,0xFF,0xFF,0xFF,0xFD,0xFD,0xFD,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x40,0x3D,0x3F,0x0B,0x06,0x0A,
-  0x1B,0x15,0x1B,0x1B,0x15,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1B,
-  0x15,0x1A,0x1B,0x15,0x1B,0x1C,0x15,0x19,0x1C,0x17,0x18,0x1C,0x17,0x18,0x1C,0x17,
-  0x18,0x1C,0x17,0x18,0x1C,0x17,0x18,0x1C,0x17,0x18,0x1C,0x17,0x18,0x1C,0x17,0x18,
-  0x1B,0x17,0x18,0x1B,0x17,0x18,0x1B,0x15,0x19,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x15,0x1B,0x1B,0x14,0x1A,0x00,
-  0x00,0x00,0x9B,0x98,0x9A,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x50,0x4C,0x4E,
-  0x09,0x01,0x05,0x1C,0x15,0x18,0x1B,0x15,0x1B,0x1B,0x15,0x1A,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x15,0x1A,0x1C,0x16,0x1A,0x1C,0x16,0x1A,0x1C,0x16,
-  0x1A,0x1C,0x16,0x1A,0x1C,0x16,0x1A,0x1C,0x16,0x1A,0x1C,0x16,0x1A,0x1C,0x16,0x1A,
-  0x1C,0x16,0x1A,0x1C,0x16,0x1A,0x1C,0x15,0x1A,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x15,0x1B,0x1B,0x15,0x1A,0x17,0x14,0x16,0x00,0x00,0x00,0xA9,
-  0xA8,0xA8,0xFF,0xFF,0xFF,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0x74,0x71,0x72,0x00,0x00,0x00,0x1B,0x15,0x1A,0x1C,0x15,0x1B,0x1B,0x15,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x15,0x1B,0x1C,0x15,0x1B,0x1C,0x15,
-  0x1B,0x1C,0x15,0x1B,0x1C,0x15,0x1B,0x1C,0x15,0x1B,0x1C,0x15,0x1B,0x1C,0x15,0x1B,
-  0x1C,0x15,0x1B,0x1C,0x15,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1B,0x15,0x1A,0x1C,0x16,0x1B,0x15,0x10,0x14,0x02,0x00,0x01,0xC8,0xC5,0xC7,0xFF,
-  0xFF,0xFF,0xFD,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFC,0xFE,
-  0xFF,0xFF,0xFF,0xAB,0xAB,0xAC,0x01,0x00,0x00,0x16,0x10,0x16,0x1B,0x15,0x1A,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1B,0x15,0x1A,
-  0x1B,0x15,0x1A,0x0D,0x07,0x0C,0x1E,0x19,0x1D,0xEF,0xED,0xEE,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xEC,0xE8,0xEA,0x23,0x1D,0x1F,0x0A,0x06,0x07,0x1B,
-  0x15,0x1A,0x1B,0x15,0x1A,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1B,0x15,0x1A,0x1B,0x15,0x1A,0x19,0x13,0x18,
-  0x00,0x00,0x00,0x5E,0x58,0x5D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7A,0x77,0x79,0x00,
-  0x00,0x00,0x15,0x0E,0x14,0x1B,0x15,0x1A,0x1B,0x16,0x1A,0x1B,0x16,0x1A,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1B,0x16,
-  0x1A,0x1B,0x16,0x1A,0x1B,0x15,0x1A,0x1C,0x16,0x1B,0x0E,0x07,0x0D,0x0F,0x09,0x0E,
-  0xBF,0xBC,0xBE,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,0xFF,0xFF,0xFF,0xEB,
-  0xE8,0xEB,0x37,0x34,0x36,0x02,0x00,0x01,0x17,0x10,0x16,0x1C,0x15,0x1B,0x1B,0x16,
-  0x1A,0x1B,0x15,0x1A,0x1B,0x15,0x1A,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x1C,0x15,
-  0x1B,0x1C,0x15,0x1B,0x13,0x0C,0x12,0x00,0x00,0x00,0x71,0x6E,0x71,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xBD,0xBF,0x26,0x1F,0x26,0x04,0x00,0x03,0x15,0x0F,
-  0x14,0x1B,0x15,0x1A,0x1C,0x16,0x1B,0x1B,0x15,0x1A,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1B,0x15,0x1A,0x1C,0x16,0x1B,0x1B,0x15,0x1A,0x11,0x0A,
-  0x10,0x00,0x00,0x00,0x55,0x4E,0x54,0xF0,0xEF,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xBF,0xBE,0x3A,0x34,
-  0x39,0x01,0x00,0x00,0x0F,0x08,0x0E,0x19,0x13,0x18,0x1B,0x16,0x1A,0x1B,0x16,0x1A,
-  0x1B,0x16,0x1A,0x1B,0x16,0x1A,0x1C,0x15,0x1B,0x1C,0x15,0x1B,0x1C,0x15,0x1B,0x1C,
-  0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,0x1C,0x16,0x1B,
-  0x1C,0x15,0x1B,0x1C,0x15,0x1B,0x1C,0x16,0x1B,0x1B,0x16,0x1A,0x1B,0x16,0x1A,0x1B,
-  0x16,0x1A,0x1B,0x15,0x1A,0x16,0x10,0x15,0x0B,0x04,0x0A,0x03,0x00,0x02,0x64,0x61,
-  0x63,0xED,0xED,0xED,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xE8,0xE7,0xE8,0x77,0x75,0x77,0x13,0x0B,0x12,0x05,0x00,0x04,0x10,0x08,0x0F,
-  0x17,0x0F,0x16,0x1C,0x14,0x1B,0x1B,0x16,0x1A,0x1C,0x16,0x19,0x1C,0x16,0x19,0x1B,
-  0x15,0x1B,0x1C,0x16,0x1B,0x1B,0x15,0x1A,0x1B,0x15,0x1A,0x1C,0x16,0x1B,0x1C,0x16,
-  0x1B,0x1B,0x15,0x1A,0x1C,0x16,0x1B,0x1B,0x15,0x1A,0x1C,0x15,0x1B,0x1B,0x15,0x1A,
-  0x1A,0x16,0x19,0x1A,0x16,0x19,0x1C,0x15,0x1B,0x1B,0x13,0x1A,0x15,0x0D,0x14,0x0C,
-  0x04,0x0B,0x02,0x00,0x01,0x30,0x2A,0x2F,0x99,0x98,0x99,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFD,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD7,0xD3,0xD7,0x80,0x7B,0x7F,
-  0x34,0x2F,0x33,0x00,0x00,0x00,0x06,0x01,0x04,0x0B,0x06,0x08,0x10,0x0B,0x0D,0x15,
-  0x0E,0x14,0x16,0x10,0x15,0x1A,0x14,0x19,0x1B,0x15,0x1A,0x1B,0x15,0x1A,0x1B,0x15,
-  0x1A,0x1C,0x16,0x1B,0x1A,0x14,0x19,0x1A,0x14,0x19,0x16,0x10,0x15,0x12,0x0D,0x11,
-  0x0C,0x0A,0x0B,0x08,0x05,0x07,0x02,0x00,0x01,0x08,0x03,0x07,0x4C,0x48,0x4C,0x9B,
-  0x96,0x9A,0xF4,0xF1,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD6,0xD3,0xD5,0xA9,0xA4,0xA6,0x81,0x7D,0x7F,0x60,
-  0x5B,0x60,0x45,0x40,0x44,0x2F,0x29,0x2E,0x20,0x1A,0x1F,0x1B,0x15,0x1A,0x1B,0x15,
-  0x1A,0x1B,0x15,0x1A,0x25,0x1F,0x24,0x35,0x2F,0x34,0x4C,0x47,0x4C,0x6B,0x66,0x6A,
-  0x8B,0x88,0x8A,0xB7,0xB5,0xB7,0xE8,0xE8,0xE8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,};
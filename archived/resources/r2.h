@@ -1,1207 +0,0 @@
-#pragma once
-#include <stdint.h>
-const uint8_t r2[] {
-  0x42,0x4D,0x36,0x4B,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x00,0x00,0x00,0x28,0x00,
-  0x00,0x00,0x50,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x01,0x00,0x18,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x4B,0x00,0x00,0xC4,0x0E,0x00,0x00,0xC4,0x0E,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEA,0xF3,0xFD,0x91,0xC6,
-  0xF7,0x4C,0xA0,0xF4,0x24,0x8B,0xF2,0x19,0x85,0xF2,0x1B,0x86,0xF2,0x1B,0x86,0xF2,
-  0x1B,0x86,0xF2,0x1B,0x86,0xF2,0x1B,0x86,0xF2,0x1B,0x86,0xF2,0x1B,0x86,0xF2,0x1B,
-  0x86,0xF2,0x1B,0x86,0xF2,0x1B,0x86,0xF2,0x1B,0x86,0xF2,0x1B,0x86,0xF2,0x1B,0x86,
-  0xF2,0x1B,0x86,0xF2,0x1B,0x86,0xF2,0x1A,0x86,0xF2,0x1B,0x86,0xF2,0x1B,0x86,0xF2,
-  0x1B,0x86,0xF2,0x1B,0x86,0xF2,0x1B,0x86,0xF2,0x1B,0x86,0xF2,0x1B,0x86,0xF2,0x1B,
-  0x86,0xF2,0x1B,0x86,0xF2,0x1B,0x86,0xF2,0x1B,0x86,0xF2,0x1B,0x86,0xF2,0x1B,0x86,
-  0xF2,0x1B,0x86,0xF2,0x1B,0x86,0xF2,0x1B,0x86,0xF2,0x1B,0x86,0xF2,0x1B,0x86,0xF2,
-  0x1B,0x86,0xF2,0x1B,0x86,0xF2,0x1B,0x86,0xF2,0x1B,0x86,0xF2,0x1A,0x86,0xF2,0x1B,
-  0x86,0xF2,0x1B,0x86,0xF2,0x1B,0x86,0xF2,0x1B,0x86,0xF2,0x1B,0x86,0xF2,0x1B,0x86,
-  0xF2,0x1B,0x86,0xF2,0x1B,0x86,0xF2,0x1B,0x86,0xF2,0x1B,0x86,0xF2,0x1B,0x86,0xF2,
-  0x1B,0x86,0xF2,0x1A,0x85,0xF2,0x1B,0x86,0xF2,0x1B,0x86,0xF2,0x1B,0x86,0xF2,0x1B,
-  0x86,0xF2,0x19,0x85,0xF1,0x27,0x8D,0xF3,0x53,0xA4,0xF5,0x9B,0xCB,0xF8,0xF4,0xF9,
-  0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0xEF,0xFC,0x35,0x91,0xEF,0x00,0x6B,0xEA,0x00,0x70,
-  0xEA,0x00,0x75,0xEB,0x04,0x77,0xEB,0x05,0x78,0xEB,0x05,0x78,0xEB,0x05,0x78,0xEB,
-  0x05,0x78,0xEB,0x05,0x78,0xEB,0x05,0x78,0xEB,0x05,0x78,0xEB,0x05,0x78,0xEB,0x05,
-  0x78,0xEB,0x05,0x78,0xEB,0x05,0x78,0xEB,0x05,0x78,0xEB,0x05,0x78,0xEB,0x05,0x78,
-  0xEB,0x05,0x78,0xEB,0x05,0x78,0xEB,0x05,0x78,0xEB,0x05,0x78,0xEB,0x05,0x78,0xEB,
-  0x05,0x78,0xEB,0x05,0x78,0xEB,0x05,0x78,0xEB,0x05,0x78,0xEB,0x05,0x78,0xEB,0x05,
-  0x78,0xEB,0x05,0x78,0xEB,0x05,0x78,0xEB,0x05,0x78,0xEB,0x05,0x78,0xEB,0x05,0x78,
-  0xEB,0x05,0x78,0xEB,0x05,0x78,0xEB,0x05,0x78,0xEB,0x05,0x78,0xEB,0x05,0x78,0xEB,
-  0x05,0x78,0xEB,0x05,0x78,0xEB,0x05,0x78,0xEB,0x05,0x78,0xEB,0x05,0x78,0xEB,0x05,
-  0x78,0xEB,0x05,0x78,0xEB,0x05,0x78,0xEB,0x05,0x78,0xEB,0x05,0x78,0xEB,0x05,0x78,
-  0xEB,0x05,0x78,0xEB,0x05,0x78,0xEB,0x05,0x78,0xEB,0x05,0x78,0xEB,0x05,0x78,0xEB,
-  0x05,0x78,0xEB,0x05,0x78,0xEB,0x05,0x78,0xEB,0x05,0x78,0xEB,0x05,0x78,0xEB,0x05,
-  0x78,0xEB,0x05,0x78,0xEB,0x04,0x77,0xEB,0x00,0x75,0xEA,0x00,0x6F,0xEA,0x00,0x6C,
-  0xE9,0x45,0x9B,0xF0,0xF2,0xF8,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0x86,0xBE,0xF5,0x00,0x6B,0xE9,0x00,0x74,0xEB,0x07,0x79,0xEB,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,
-  0xEB,0x00,0x73,0xEB,0x00,0x6D,0xEA,0xA4,0xCE,0xF8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5F,
-  0xAA,0xF2,0x00,0x6A,0xE9,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x06,0x78,0xEB,0x00,0x69,0xE9,0x86,0xBD,0xF5,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7F,0xBA,0xF5,0x00,
-  0x6A,0xE9,0x08,0x7A,0xEC,0x07,0x79,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEB,0x00,0x68,0xE9,0xA4,0xCE,0xF8,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD4,0xE8,0xFB,0x00,0x6A,0xE9,0x07,
-  0x79,0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEB,0x08,0x7A,
-  0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x06,0x78,0xEB,0x00,0x6D,0xEA,
-  0xF2,0xF8,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x23,0x89,0xEE,0x00,0x75,0xEB,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x79,0xEB,0x04,0x78,0xEB,0x00,0x75,0xEB,0x00,
-  0x72,0xEB,0x00,0x70,0xEA,0x00,0x6E,0xEA,0x00,0x6D,0xEA,0x00,0x6D,0xEA,0x00,0x6D,
-  0xEA,0x00,0x6E,0xEA,0x00,0x6F,0xEA,0x00,0x70,0xEA,0x00,0x73,0xEB,0x01,0x76,0xEB,
-  0x06,0x79,0xEB,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,
-  0x79,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x00,0x73,0xEB,
-  0x46,0x9C,0xF0,0xFF,0xFF,0xFF,0xD8,0xEA,0xFB,0x00,0x6B,0xEA,0x07,0x79,0xEB,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x05,0x78,0xEB,
-  0x00,0x74,0xEB,0x00,0x6E,0xEA,0x00,0x6A,0xEA,0x08,0x7A,0xEC,0x3A,0x95,0xF0,0x68,
-  0xAE,0xF3,0x8F,0xC2,0xF6,0xA9,0xD1,0xF8,0xBB,0xDB,0xF9,0xC1,0xDE,0xFA,0xC1,0xDE,
-  0xFA,0xB5,0xD8,0xF9,0xA3,0xCD,0xF8,0x85,0xBE,0xF6,0x5A,0xA7,0xF2,0x2A,0x8C,0xEE,
-  0x00,0x72,0xEB,0x00,0x6A,0xE9,0x00,0x70,0xEA,0x00,0x76,0xEB,0x07,0x79,0xEB,0x07,
-  0x79,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEB,
-  0x00,0x6B,0xE9,0xF4,0xF9,0xFE,0x77,0xB8,0xF4,0x00,0x72,0xEA,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEB,0x00,0x75,0xEB,0x00,0x6C,0xEA,0x00,0x74,0xEB,
-  0x4D,0x9F,0xF1,0xA7,0xD0,0xF8,0xF8,0xFA,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xE1,0xEF,0xFD,0x8C,0xC2,0xF6,0x31,0x8F,0xEF,0x00,0x6D,0xEA,0x00,
-  0x6F,0xEA,0x03,0x77,0xEB,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x07,0x79,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x00,0x6F,0xEA,0x9B,0xCA,0xF7,0x35,0x94,0xF2,0x02,0x76,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,
-  0xEB,0x00,0x73,0xEB,0x00,0x6C,0xEA,0x34,0x91,0xEF,0xB7,0xD8,0xF9,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFD,0xFE,0x8F,
-  0xC2,0xF6,0x14,0x81,0xED,0x00,0x6C,0xEA,0x01,0x76,0xEB,0x08,0x79,0xEB,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x00,0x75,0xEA,0x53,0xA4,0xF5,0x13,0x82,0xF0,0x06,0x78,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x07,0x79,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x00,0x75,0xEB,0x00,0x6B,
-  0xEA,0x4D,0x9F,0xF1,0xE4,0xF0,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xBC,0xDB,0xFA,0x20,0x87,0xEE,0x00,0x6C,0xEA,0x04,0x78,
-  0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x07,0x79,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x04,0x77,0xEB,0x27,0x8D,0xF3,0x0A,0x7C,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x05,0x78,0xEB,0x00,0x6A,0xE9,0x2F,0x8F,0xEF,0xE7,0xF2,
-  0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0xD7,0xF9,0x00,0x77,
-  0xEC,0x00,0x70,0xEA,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x07,0x79,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x19,0x85,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x00,0x73,0xEB,0x00,0x72,0xEB,0xB0,0xD5,0xF9,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0x6A,0xAE,0xF3,0x00,0x6A,0xEA,0x03,0x77,0xEB,0x07,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEB,0x00,
-  0x6D,0xEA,0x32,0x91,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xD0,0xE5,0xFB,0x00,0x76,0xEB,0x00,0x73,0xEB,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEB,0x00,0x6B,0xE9,0x70,
-  0xB2,0xF3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x24,0x89,0xEE,0x00,0x70,0xEA,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x06,0x79,0xEB,0x00,0x69,0xE9,0x9C,0xCA,0xF7,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x45,0x9D,0xF1,
-  0x00,0x6D,0xEA,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x06,0x79,0xEB,0x00,0x6A,0xEA,0xB8,0xD8,0xF9,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0x5A,0xA7,0xF2,0x00,0x6D,0xEA,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x07,0x79,0xEB,0x00,0x69,0xE9,0xB0,0xD5,0xF9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x50,0xA1,0xF1,0x00,0x6F,0xEA,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x79,0xEB,
-  0x00,0x6C,0xEA,0x8A,0xC0,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x2E,0x8E,0xEF,0x00,0x72,0xEA,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0A,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x00,0x70,0xEA,
-  0x52,0xA2,0xF1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xF2,0xF8,0xFE,0x3D,0x97,0xF0,0x54,0xA3,0xF1,0x54,0xA3,
-  0xF2,0x55,0xA3,0xF2,0x54,0xA3,0xF2,0x54,0xA3,0xF2,0x54,0xA4,0xF2,0x54,0xA3,0xF2,
-  0x54,0xA4,0xF2,0x53,0xA3,0xF2,0x55,0xA4,0xF2,0x53,0xA3,0xF2,0x55,0xA3,0xF2,0x54,
-  0xA3,0xF2,0x53,0xA3,0xF2,0x54,0xA3,0xF2,0x53,0xA3,0xF2,0x54,0xA4,0xF2,0x54,0xA4,
-  0xF2,0x54,0xA3,0xF2,0x54,0xA3,0xF2,0x54,0xA3,0xF2,0x54,0xA3,0xF2,0x53,0xA3,0xF2,
-  0x54,0xA3,0xF2,0x55,0xA3,0xF2,0x54,0xA3,0xF2,0x54,0xA3,0xF2,0x54,0xA3,0xF2,0x55,
-  0xA3,0xF2,0x54,0xA3,0xF2,0x55,0xA3,0xF2,0x54,0xA3,0xF2,0x54,0xA3,0xF1,0x4B,0x9E,
-  0xF1,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x79,0xEC,0x02,0x77,0xEB,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x01,0x76,0xEB,0x15,0x82,0xED,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA3,0xCD,0xF8,0x00,0x63,0xE8,0x00,0x74,
-  0xEB,0x00,0x74,0xEB,0x00,0x74,0xEB,0x00,0x74,0xEB,0x00,0x74,0xEB,0x00,0x74,0xEB,
-  0x00,0x74,0xEB,0x00,0x74,0xEB,0x00,0x74,0xEB,0x00,0x74,0xEB,0x00,0x74,0xEB,0x00,
-  0x74,0xEB,0x00,0x74,0xEB,0x00,0x74,0xEB,0x00,0x74,0xEB,0x00,0x74,0xEB,0x00,0x74,
-  0xEB,0x00,0x74,0xEB,0x00,0x74,0xEB,0x00,0x74,0xEB,0x00,0x74,0xEB,0x00,0x74,0xEB,
-  0x00,0x74,0xEB,0x00,0x74,0xEB,0x00,0x74,0xEB,0x00,0x74,0xEB,0x00,0x74,0xEB,0x00,
-  0x74,0xEB,0x00,0x74,0xEB,0x00,0x74,0xEB,0x00,0x74,0xEB,0x00,0x73,0xEB,0x00,0x6B,
-  0xEA,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE2,0xEF,0xFC,0x00,0x6C,0xEA,0x06,
-  0x79,0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x07,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,
-  0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEB,0x00,0x6B,0xEA,0xE5,0xF0,0xFC,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7F,0xBA,0xF5,0x00,0x6B,
-  0xEA,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x06,0x79,0xEB,0x00,0x71,
-  0xEB,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x86,0xBD,0xF5,0x00,
-  0x6D,0xEA,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x07,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x00,0x6F,0xEA,0x75,0xB5,0xF4,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x4C,0x9F,
-  0xF1,0x00,0x70,0xEA,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x06,0x79,0xEB,0x00,0x71,
-  0xEB,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x19,
-  0x83,0xED,0x02,0x76,0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x04,0x78,0xEB,0x00,0x76,0xEB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0x25,0x8A,0xEE,0x00,0x73,0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x07,0x79,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x06,0x79,0xEB,0x00,0x71,
-  0xEB,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD6,
-  0xE8,0xFC,0x00,0x68,0xE9,0x08,0x79,0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1A,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x00,0x6D,0xEA,0xA6,0xCF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0x07,0x7A,0xEC,0x01,0x76,0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x06,0x79,0xEB,0x00,0x71,
-  0xEB,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0x3F,0x98,0xF0,0x00,0x74,0xEB,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x03,0x77,0xEB,0x0D,0x7D,0xEC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xEF,0xF6,0xFD,0x00,0x6F,0xEA,0x04,0x78,0xEB,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x06,0x79,0xEB,0x00,0x71,
-  0xEB,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xE0,0xEE,0xFC,0x00,0x6B,0xEA,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x00,0x6E,0xEA,0x99,0xC8,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCD,0xE4,0xFB,0x00,0x69,0xE9,0x07,0x79,0xEB,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x06,0x79,0xEB,0x00,0x71,
-  0xEB,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0x34,0x92,0xEF,0x00,0x75,0xEB,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x05,0x78,
-  0xEB,0x00,0x72,0xEB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9E,0xCB,0xF7,0x00,0x69,0xE9,
-  0x08,0x79,0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x06,0x79,0xEB,0x00,0x71,
-  0xEB,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xBC,0xDB,0xFA,0x00,0x6C,0xEA,0x08,0x7A,0xEC,0x07,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x00,0x73,
-  0xEB,0x58,0xA6,0xF2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x70,0xB2,0xF4,
-  0x00,0x6D,0xEA,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x07,0x79,0xEC,0x07,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x06,0x79,0xEB,0x00,0x71,
-  0xEB,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x07,0x79,0xEC,0x04,0x78,0xEB,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x00,0x6B,
-  0xEA,0xC6,0xE0,0xFA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0x46,0x9B,0xF0,0x00,0x70,0xEA,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x04,0x77,0xEB,
-  0x00,0x75,0xEB,0x00,0x75,0xEB,0x00,0x75,0xEB,0x00,0x75,0xEB,0x00,0x75,0xEB,0x00,
-  0x75,0xEB,0x00,0x75,0xEB,0x00,0x75,0xEB,0x00,0x75,0xEB,0x00,0x75,0xEB,0x00,0x6C,
-  0xEA,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x61,0xA9,0xF3,0x00,0x73,0xEB,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x05,0x78,0xEB,0x00,0x74,
-  0xEB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x1C,0x85,0xEE,0x00,0x74,0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x03,0x77,0xEB,0x2A,0x8C,0xEE,
-  0x45,0x9A,0xF0,0x3B,0x95,0xEF,0x3A,0x94,0xEF,0x3B,0x95,0xEF,0x3B,0x95,0xEF,0x3A,
-  0x95,0xEF,0x3B,0x95,0xEF,0x3A,0x95,0xEF,0x3B,0x95,0xEF,0x39,0x94,0xEF,0x30,0x8E,
-  0xEE,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC5,0xDF,0xFA,0x00,0x6C,0xEA,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x00,0x75,0xEB,0x40,0x98,
-  0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x73,0xEB,0x02,0x77,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x04,0x78,0xEB,0x12,0x80,0xEC,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x70,0xEA,0x06,0x79,
-  0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEC,0x08,0x7A,0xEC,0x00,0x70,0xEA,0x8A,0xC0,
-  0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE9,0xF3,0xFD,0x00,0x6E,0xEA,0x05,0x78,0xEB,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x00,0x75,0xEB,
-  0x0D,0x7C,0xEC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x2C,0x8C,0xEF,0x01,0x76,
-  0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x00,0x6B,0xEA,0xCA,0xE2,
-  0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xDD,0xF9,0x00,0x6B,0xEA,0x07,
-  0x79,0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x00,0x72,0xEA,0x29,0x8B,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x67,0xAD,0xF3,0x00,0x73,
-  0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEB,0x00,0x6B,0xE9,0xF9,0xFC,
-  0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x94,0xC5,0xF7,0x00,
-  0x6B,0xE9,0x08,0x79,0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x00,0x6F,0xEA,0x4D,0x9F,0xF1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x99,0xC8,0xF7,0x00,0x6F,
-  0xEA,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x06,0x79,0xEB,0x00,0x72,0xEB,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x63,
-  0xAB,0xF3,0x00,0x6D,0xEA,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x00,0x6B,0xEA,0x77,0xB5,0xF4,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC6,0xE1,0xFA,0x00,0x6C,
-  0xEA,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x03,0x77,0xEB,0x11,0x80,0xED,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0x37,0x93,0xF0,0x00,0x71,0xEA,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEB,0x00,0x69,0xE9,0x99,0xC8,0xF6,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE9,0xF3,0xFD,0x00,0x6A,
-  0xEA,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1A,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x07,
-  0x79,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x01,0x76,0xEB,0x29,0x8A,0xEE,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0x16,0x82,0xED,0x00,0x74,0xEB,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEB,0x00,0x6A,0xE9,0xC0,
-  0xDD,0xFA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFC,0xFE,0x00,0x6C,
-  0xE9,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1A,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x00,0x75,0xEB,0x37,0x92,0xEF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFD,0xFE,0x00,0x74,0xEA,0x03,0x77,0xEB,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x06,0x78,0xEB,0x00,
-  0x6A,0xEA,0xE4,0xF0,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x00,0x6C,
-  0xEB,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x00,0x75,0xEB,0x38,0x92,0xEF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xED,0xFC,0x00,0x6A,0xE9,0x06,0x79,
-  0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x03,
-  0x77,0xEB,0x00,0x72,0xEB,0xFD,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x00,0x6C,
-  0xEB,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x00,0x76,0xEB,0x35,0x90,0xEF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBC,0xDB,0xF9,0x00,0x68,
-  0xE9,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x00,0x75,0xEB,0x14,0x81,0xED,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x00,0x6C,
-  0xEA,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x01,0x76,0xEB,0x26,0x89,0xEE,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8C,0xC1,
-  0xF6,0x00,0x6B,0xEA,0x07,0x7A,0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x00,0x6F,0xEA,0x69,0xAE,0xF3,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0xFB,0xFE,0x00,0x6B,
-  0xE9,0x08,0x79,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x04,0x77,0xEB,0x0D,0x7D,0xEC,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0x58,0xA5,0xF2,0x00,0x6F,0xEA,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEB,0x00,0x6B,0xEA,0xE3,0xF0,0xFC,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE4,0xF0,0xFD,0x00,0x6B,
-  0xEA,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x06,0x79,0xEB,0x00,0x71,0xEB,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0x19,0x83,0xED,0x00,0x76,0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x00,0x74,0xEB,0x45,0x9B,0xF0,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC1,0xDE,0xFA,0x00,0x6C,
-  0xEA,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0A,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x79,0xEC,0x00,0x6B,0xE9,0xF2,0xF8,
-  0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xE6,0xF2,0xFD,0x00,0x6C,0xEA,0x07,0x79,0xEB,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEB,0x00,0x6B,0xEA,0xFF,0xFF,
-  0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x92,0xC4,0xF6,0x00,0x70,
-  0xEA,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0A,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x00,0x6B,0xEA,0xBE,0xDD,
-  0xF9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,
-  0xFF,0xF6,0xFA,0xFE,0xF9,0xFB,0xFE,0xF9,0xFC,0xFE,0xF8,0xFB,0xFE,0xF9,0xFB,0xFE,
-  0xF8,0xFB,0xFE,0xF9,0xFB,0xFE,0xF8,0xFB,0xFE,0xFA,0xFC,0xFE,0xF8,0xFB,0xFE,0xF7,
-  0xFB,0xFE,0xFD,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x59,0xA6,0xF2,0x00,0x73,0xEB,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEC,0x08,0x7A,0xEC,0x00,0x6D,0xEA,0xAA,0xD2,
-  0xF8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5B,0xA7,0xF2,0x00,0x73,
-  0xEB,0x07,0x79,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x00,0x71,0xEA,0x7E,0xB9,
-  0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCE,0xE4,
-  0xFB,0x00,0x64,0xE9,0x00,0x70,0xEA,0x00,0x70,0xEA,0x00,0x70,0xEA,0x00,0x70,0xEA,
-  0x00,0x70,0xEA,0x00,0x70,0xEA,0x00,0x70,0xEA,0x00,0x70,0xEA,0x00,0x70,0xEA,0x00,
-  0x68,0xE9,0x81,0xBA,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD5,0xE8,0xFB,0x00,0x6B,0xEA,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x00,0x73,0xEA,0x69,0xAE,
-  0xF3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x21,0x86,0xED,0x02,0x77,
-  0xEB,0x07,0x79,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x00,0x75,0xEB,0x34,0x91,
-  0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE1,0xEE,
-  0xFD,0x00,0x6D,0xE9,0x06,0x79,0xEB,0x06,0x79,0xEB,0x07,0x79,0xEB,0x07,0x79,0xEB,
-  0x07,0x79,0xEB,0x07,0x79,0xEB,0x06,0x79,0xEB,0x06,0x79,0xEB,0x07,0x79,0xEB,0x00,
-  0x71,0xEA,0x78,0xB5,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x00,0x6E,0xE9,0x07,0x79,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x00,0x74,0xEB,0x42,0x9B,
-  0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x6E,0xEA,0x07,0x79,
-  0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x06,0x79,0xEB,0x00,0x70,
-  0xEA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF1,0xF6,
-  0xFE,0x00,0x6E,0xEA,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x00,
-  0x74,0xEB,0x4B,0x9E,0xF1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x6D,0xE9,0x07,0x79,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEC,0x08,0x7A,0xEC,0x00,0x75,0xEB,0x37,0x93,
-  0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB4,0xD7,0xF9,0x00,0x6D,0xEA,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x00,0x6D,
-  0xEA,0xB5,0xD7,0xF9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0x00,0x73,0xEB,0x06,0x79,0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x06,
-  0x78,0xEB,0x00,0x72,0xEA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xDA,0xF9,0x00,0x6D,0xEA,0x08,0x7A,0xEC,
-  0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x07,0x7A,0xEC,0x07,0x79,0xEC,0x08,0x7A,0xEC,0x00,0x75,0xEB,0x3C,0x96,
-  0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x4F,0xA0,0xF1,0x00,0x74,0xEB,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x00,0x74,
-  0xEB,0x44,0x9B,0xF1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0x13,0x81,0xED,0x03,0x77,0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x00,0x72,0xEB,0x53,0xA2,0xF1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x19,0x83,0xED,0x02,0x77,0xEB,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x00,0x74,0xEB,0x54,0xA3,
-  0xF2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x73,0xEB,0x05,0x78,0xEB,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x06,0x79,
-  0xEB,0x00,0x6E,0xEA,0xFA,0xFD,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0x4F,0xA1,0xF1,0x00,0x74,0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEB,0x00,0x6F,0xEA,0x44,0x9B,0xF0,0xE1,0xEF,0xFC,0xFF,0xFF,
-  0xFF,0xD9,0xEA,0xFC,0x27,0x8B,0xEE,0x00,0x72,0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x00,0x71,0xEA,0x83,0xBD,
-  0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xA7,0xD0,0xF8,0x00,0x6D,0xEA,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x00,0x70,0xEA,0x7F,0xBA,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xB9,0xDA,0xF9,0x00,0x6B,0xEA,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x79,0xEB,0x00,0x74,0xEB,0x00,0x6B,0xEA,0x00,0x6B,
-  0xEA,0x00,0x6C,0xEA,0x01,0x76,0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x00,0x6A,0xEA,0xCE,0xE4,
-  0xFA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0x1C,0x85,0xED,0x02,0x76,0xEB,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x05,0x78,0xEB,0x00,0x74,0xEB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0x0E,0x7E,0xEC,0x03,0x77,0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x79,
-  0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x05,0x78,0xEB,0x00,0x74,0xEB,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xC8,0xE1,0xFA,0x00,0x6B,0xEA,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x00,0x6F,0xEA,0x87,0xBE,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xB1,0xD5,0xF9,0x00,0x6A,0xE9,0x08,0x7A,0xEB,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,
-  0x79,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x00,0x71,0xEA,0x6C,0xB0,0xF3,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0x22,0x88,0xED,0x01,0x76,0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x06,0x79,0xEB,0x00,0x6E,0xEA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x37,0x94,0xEF,0x00,0x73,0xEB,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x05,0x78,0xEB,0x00,0x6F,0xEA,0xFF,0xFE,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB8,
-  0xD8,0xF9,0x00,0x6A,0xE9,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x00,0x72,0xEA,0x4E,0xA0,0xF1,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x73,0xEB,0x02,0x77,0xEB,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x07,0x79,0xEB,0x00,0x69,0xE9,0xA2,0xCC,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x01,
-  0x77,0xEB,0x04,0x78,0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEB,0x00,0x6B,0xEA,0xC3,0xDE,0xFA,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE3,0xF0,0xFC,0x00,0x6E,0xEA,
-  0x03,0x77,0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,
-  0x7A,0xEB,0x00,0x6C,0xEA,0x61,0xAA,0xF3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xA8,0xF2,0x00,
-  0x71,0xEA,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x04,0x78,0xEB,0x00,0x75,0xEB,
-  0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDB,0xEC,0xFB,
-  0x00,0x70,0xEA,0x00,0x75,0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x06,0x78,0xEB,0x00,
-  0x69,0xE9,0x64,0xAB,0xF3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xDA,0xF9,0x00,0x6B,0xEA,0x07,
-  0x79,0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x00,0x73,0xEB,
-  0x2C,0x8E,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xF7,0xFB,0xFE,0x1B,0x83,0xED,0x00,0x6B,0xE9,0x04,0x78,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x05,0x78,0xEB,0x00,0x70,0xEA,0x00,0x6E,0xEA,0xA8,
-  0xD1,0xF8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xFA,0xFD,0x00,0x70,0xEA,0x05,0x78,0xEB,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x07,0x79,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x00,0x6E,0xEA,0x59,0xA5,0xF2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x96,0xC6,0xF6,0x02,0x76,0xEB,0x00,0x6C,0xEA,0x00,
-  0x75,0xEB,0x05,0x78,0xEB,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x07,0x79,0xEB,0x04,0x77,0xEB,
-  0x00,0x74,0xEB,0x00,0x6C,0xEA,0x00,0x72,0xEB,0x6D,0xB1,0xF3,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x09,0x7B,0xEC,0x00,0x76,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x07,0x79,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEB,0x00,0x6B,0xEA,0x7A,0xB8,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAD,0xD3,0xF8,0x42,
-  0x99,0xF0,0x01,0x77,0xEB,0x00,0x6D,0xEA,0x00,0x6C,0xEA,0x00,0x6D,0xEA,0x00,0x6F,
-  0xEA,0x00,0x6E,0xEA,0x00,0x6D,0xEA,0x00,0x6C,0xEA,0x00,0x70,0xEA,0x0C,0x7D,0xEC,
-  0x4D,0xA0,0xF1,0xB0,0xD4,0xF9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x24,0x89,0xEE,0x00,0x73,0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x07,0x79,0xEB,0x00,0x6A,0xE9,0x7F,0xBB,0xF5,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xE9,0xF3,0xFC,0xC7,0xE0,0xFA,0xB0,0xD4,0xF9,0xA4,0xCD,
-  0xF7,0xAD,0xD3,0xF9,0xBB,0xDA,0xF9,0xD7,0xE9,0xFC,0xF7,0xFB,0xFE,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0x2A,0x8C,0xEE,0x00,0x71,0xEA,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEB,0x00,0x6B,0xEA,0x68,0xAE,0xF3,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1C,0x84,0xEE,
-  0x00,0x71,0xEA,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x79,0xEB,0x00,0x6D,0xEA,0x35,
-  0x92,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE4,0xF0,0xFC,0x00,0x74,0xEB,0x00,0x74,0xEB,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x00,
-  0x72,0xEA,0x08,0x7A,0xEC,0xDA,0xEB,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0x97,0xC7,0xF6,0x00,0x6C,0xEA,0x03,0x77,0xEB,0x08,0x7A,0xEC,
-  0x07,0x79,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x06,0x79,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x02,0x77,0xEB,0x00,0x6B,0xE9,0x73,0xB3,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0xF9,
-  0xFE,0x33,0x91,0xEF,0x00,0x6C,0xEA,0x06,0x79,0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x07,0x79,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0B,0x7D,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEB,0x00,0x6F,0xEA,0x05,0x79,0xEC,0xB4,0xD6,
-  0xF9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0xB7,0xF4,0x00,0x6D,
-  0xEA,0x00,0x74,0xEB,0x08,0x79,0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x07,0x79,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x07,0x79,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x05,0x78,0xEB,0x1B,0x86,0xF2,0x0A,0x7C,0xF0,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x04,0x77,0xEB,0x00,0x6B,
-  0xEA,0x18,0x83,0xED,0xB0,0xD5,0xF8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0xBB,0xF4,0x00,0x72,0xEB,0x00,0x70,0xEA,0x06,0x79,
-  0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x07,0x79,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,
-  0x05,0x78,0xEB,0x19,0x85,0xF2,0x11,0x81,0xF0,0x06,0x79,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x02,0x76,0xEB,0x00,0x6D,0xEA,0x05,0x79,0xEC,0x7B,0xB8,0xF5,0xE8,0xF3,0xFD,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCB,0xE3,0xFB,0x54,
-  0xA3,0xF2,0x00,0x6F,0xEA,0x00,0x70,0xEA,0x05,0x78,0xEB,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x06,0x79,0xEC,
-  0x04,0x77,0xEB,0x24,0x8B,0xF2,0x2F,0x91,0xF1,0x03,0x77,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x79,0xEB,0x04,0x78,0xEB,0x00,0x71,0xEA,0x00,0x6D,0xEA,
-  0x1A,0x84,0xED,0x70,0xB1,0xF4,0xC1,0xDE,0xFA,0xFB,0xFD,0xFE,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xED,0xF5,0xFE,0xAB,0xD2,0xF8,0x55,0xA3,0xF2,0x06,0x7A,0xEC,0x00,0x6C,0xEA,0x00,
-  0x73,0xEB,0x06,0x79,0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x00,0x75,0xEA,0x4B,0xA0,0xF5,0x6D,0xB2,0xF4,0x00,0x73,0xEB,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEB,
-  0x02,0x77,0xEB,0x00,0x72,0xEA,0x00,0x6C,0xEA,0x00,0x6D,0xE9,0x0E,0x7D,0xEC,0x35,
-  0x92,0xEF,0x5A,0xA5,0xF2,0x75,0xB4,0xF4,0x87,0xBE,0xF6,0x8B,0xC0,0xF5,0x8B,0xC0,
-  0xF5,0x84,0xBC,0xF5,0x6D,0xAF,0xF3,0x4D,0xA0,0xF1,0x2A,0x8C,0xEE,0x02,0x77,0xEB,
-  0x00,0x6B,0xE9,0x00,0x6D,0xEA,0x00,0x74,0xEB,0x04,0x77,0xEB,0x08,0x7A,0xEB,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x00,0x70,0xEA,0x92,0xC6,0xF7,0xCD,0xE4,0xFB,0x00,0x6B,0xE9,0x08,0x79,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEB,0x04,0x78,0xEB,0x00,
-  0x75,0xEB,0x00,0x74,0xEB,0x00,0x72,0xEA,0x00,0x70,0xEA,0x00,0x71,0xEA,0x00,0x70,
-  0xEA,0x00,0x71,0xEA,0x00,0x73,0xEA,0x00,0x74,0xEB,0x01,0x76,0xEB,0x05,0x78,0xEB,
-  0x07,0x79,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEB,
-  0x00,0x6B,0xEA,0xEA,0xF4,0xFC,0xFF,0xFF,0xFF,0x14,0x81,0xED,0x02,0x76,0xEB,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x00,0x74,0xEB,
-  0x35,0x91,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0xDD,0xFA,0x00,0x69,0xEA,0x07,
-  0x79,0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x07,0x79,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEB,0x00,0x6A,0xEA,
-  0xE2,0xEF,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5F,0xAA,0xF2,0x00,
-  0x6D,0xEA,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x07,0x79,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x00,0x6A,0xE9,0x86,0xBE,0xF5,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x40,
-  0x98,0xF0,0x00,0x6D,0xEA,0x07,0x79,0xEB,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEB,0x00,0x6A,0xE9,0x5F,0xAA,0xF2,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0x60,0xA9,0xF2,0x00,0x6A,0xE9,0x02,0x76,0xEB,0x08,0x79,0xEB,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x07,0x79,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,
-  0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x7A,0xEC,0x08,0x7A,0xEC,
-  0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,
-  0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x08,0x7A,0xEC,0x07,0x79,
-  0xEB,0x00,0x75,0xEB,0x00,0x6A,0xEA,0x7E,0xBA,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0xDD,0xFA,0x15,0x81,0xED,0x00,0x6B,0xEA,0x00,0x73,
-  0xEB,0x03,0x77,0xEB,0x06,0x79,0xEB,0x07,0x79,0xEB,0x07,0x79,0xEB,0x07,0x79,0xEB,
-  0x07,0x79,0xEB,0x07,0x79,0xEB,0x07,0x79,0xEB,0x07,0x79,0xEB,0x07,0x79,0xEB,0x07,
-  0x79,0xEB,0x07,0x79,0xEB,0x07,0x79,0xEB,0x07,0x79,0xEB,0x07,0x79,0xEB,0x07,0x79,
-  0xEB,0x07,0x79,0xEB,0x07,0x79,0xEB,0x07,0x79,0xEB,0x07,0x79,0xEB,0x07,0x79,0xEB,
-  0x07,0x79,0xEB,0x07,0x79,0xEB,0x07,0x79,0xEB,0x07,0x79,0xEB,0x07,0x79,0xEB,0x07,
-  0x79,0xEB,0x07,0x79,0xEB,0x07,0x79,0xEB,0x07,0x79,0xEB,0x07,0x79,0xEB,0x07,0x79,
-  0xEB,0x07,0x79,0xEB,0x07,0x79,0xEB,0x07,0x79,0xEB,0x07,0x79,0xEB,0x07,0x79,0xEB,
-  0x07,0x79,0xEB,0x07,0x79,0xEB,0x07,0x79,0xEB,0x07,0x79,0xEB,0x07,0x79,0xEB,0x07,
-  0x79,0xEB,0x07,0x79,0xEB,0x07,0x79,0xEB,0x07,0x79,0xEB,0x07,0x79,0xEB,0x07,0x79,
-  0xEB,0x07,0x79,0xEB,0x07,0x79,0xEB,0x07,0x79,0xEB,0x07,0x79,0xEB,0x07,0x79,0xEB,
-  0x07,0x79,0xEB,0x07,0x79,0xEB,0x07,0x79,0xEB,0x07,0x79,0xEB,0x07,0x79,0xEB,0x07,
-  0x79,0xEB,0x07,0x79,0xEB,0x06,0x78,0xEB,0x02,0x76,0xEB,0x00,0x72,0xEA,0x00,0x6B,
-  0xEA,0x22,0x88,0xEE,0xD5,0xE8,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFF,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCC,0xE3,0xFB,0x6C,0xB2,
-  0xF4,0x2F,0x91,0xF1,0x11,0x81,0xF0,0x09,0x7D,0xF0,0x0A,0x7D,0xF0,0x0A,0x7D,0xF0,
-  0x0A,0x7D,0xF0,0x0A,0x7D,0xF0,0x0A,0x7D,0xF0,0x0A,0x7D,0xF0,0x0A,0x7D,0xF0,0x0B,
-  0x7D,0xF0,0x0A,0x7D,0xF0,0x0A,0x7D,0xF0,0x0A,0x7D,0xF0,0x0A,0x7D,0xF0,0x0A,0x7D,
-  0xF0,0x0A,0x7D,0xF0,0x0A,0x7D,0xF0,0x0A,0x7D,0xF0,0x0B,0x7D,0xF0,0x0A,0x7D,0xF0,
-  0x0A,0x7D,0xF0,0x0A,0x7D,0xF0,0x0A,0x7D,0xF0,0x0A,0x7D,0xF0,0x0A,0x7D,0xF0,0x0A,
-  0x7D,0xF0,0x0A,0x7D,0xF0,0x0A,0x7D,0xF0,0x0A,0x7D,0xF0,0x0A,0x7D,0xF0,0x0B,0x7D,
-  0xF0,0x0A,0x7D,0xF0,0x0A,0x7D,0xF0,0x0B,0x7D,0xF0,0x0A,0x7D,0xF0,0x0B,0x7D,0xF0,
-  0x0A,0x7D,0xF0,0x0A,0x7D,0xF0,0x0A,0x7D,0xF0,0x0B,0x7D,0xF0,0x0A,0x7D,0xF0,0x0A,
-  0x7D,0xF0,0x0B,0x7D,0xF0,0x0A,0x7D,0xF0,0x0A,0x7D,0xF0,0x0A,0x7D,0xF0,0x0A,0x7D,
-  0xF0,0x0A,0x7D,0xF0,0x0A,0x7D,0xF0,0x0A,0x7D,0xF0,0x0A,0x7D,0xF0,0x0A,0x7D,0xF0,
-  0x0A,0x7D,0xF0,0x0A,0x7D,0xF0,0x0A,0x7D,0xF0,0x0B,0x7D,0xF0,0x0A,0x7D,0xF0,0x0A,
-  0x7D,0xF0,0x0A,0x7C,0xF0,0x14,0x82,0xF0,0x35,0x94,0xF1,0x75,0xB6,0xF4,0xD9,0xEA,
-  0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,};
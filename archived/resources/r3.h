@@ -1,1207 +0,0 @@
-#pragma once
-#include <stdint.h>
-const uint8_t r3[] {
-  0x42,0x4D,0x36,0x4B,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x00,0x00,0x00,0x28,0x00,
-  0x00,0x00,0x50,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x01,0x00,0x18,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x4B,0x00,0x00,0xC4,0x0E,0x00,0x00,0xC4,0x0E,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,0xFF,0xFD,0xFC,0xFF,0xFB,0xED,0xFD,0xFC,
-  0xCA,0xD6,0xFF,0x99,0xA0,0xED,0x67,0x6F,0xDD,0x44,0x48,0xE1,0x23,0x1C,0xF3,0x1F,
-  0x0C,0xF6,0x1D,0x09,0xF2,0x18,0x08,0xFB,0x18,0x08,0xFA,0x19,0x09,0xFA,0x17,0x0A,
-  0xF5,0x16,0x0B,0xF0,0x19,0x0C,0xEA,0x16,0x0F,0xE5,0x1F,0x16,0xEC,0x38,0x2C,0xE8,
-  0x60,0x5C,0xDE,0x84,0x92,0xE9,0xB9,0xCB,0xF9,0xEB,0xF5,0xFE,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFD,0xFD,0xFF,0xFD,0xFC,0xFE,0xFD,0xFB,
-  0xFF,0xFA,0xF7,0xFF,0xF5,0xFE,0xFC,0xFF,0xFC,0xFC,0xF4,0xF8,0xFC,0xF1,0xFF,0xFF,
-  0xFB,0xFF,0xFF,0xFF,0xE4,0xF0,0xFF,0x9C,0xA1,0xE8,0x59,0x4F,0xE1,0x25,0x12,0xE1,
-  0x0F,0x00,0xE7,0x12,0x00,0xF1,0x17,0x01,0xF7,0x17,0x03,0xFB,0x17,0x04,0xFE,0x1A,
-  0x07,0xFC,0x1C,0x09,0xF9,0x19,0x07,0xF9,0x1A,0x08,0xF9,0x1B,0x09,0xFB,0x1A,0x09,
-  0xF8,0x1A,0x09,0xF7,0x1C,0x09,0xF9,0x18,0x06,0xF7,0x1A,0x04,0xFC,0x19,0x02,0xFB,
-  0x17,0x00,0xF3,0x0D,0x00,0xF4,0x0C,0x00,0xEA,0x1A,0x05,0xD9,0x4A,0x3B,0xDA,0x85,
-  0x84,0xE6,0xD4,0xD3,0xFC,0xFE,0xFB,0xFF,0xFE,0xFF,0xFC,0xFE,0xFF,0xF1,0xFD,0xFB,
-  0xF5,0xFF,0xFC,0xFD,0xFF,0xFE,0xF5,0xF9,0xFE,0xFD,0xF7,0xFF,0xFB,0xFB,0xFF,0xFD,
-  0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFF,0xFD,0xFD,0xFF,0xF9,0xFE,0xFF,0xFA,0xFE,
-  0xFA,0xFF,0xFB,0xF0,0xFF,0xFF,0xFC,0xFB,0xFB,0xFF,0xF7,0xFA,0xFF,0xFF,0xAF,0xB2,
-  0xF1,0x55,0x47,0xDB,0x1E,0x0B,0xCE,0x16,0x02,0xDD,0x14,0x00,0xF1,0x1A,0x03,0xFD,
-  0x17,0x0C,0xF6,0x19,0x0C,0xF5,0x1B,0x08,0xFB,0x1C,0x08,0xFA,0x1C,0x09,0xF9,0x1C,
-  0x09,0xF9,0x1B,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x08,0xF9,0x1C,0x08,
-  0xFA,0x1C,0x08,0xFA,0x1C,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xF9,0x1B,0x09,0xFA,
-  0x1B,0x08,0xFB,0x18,0x0B,0xF4,0x1A,0x08,0xFB,0x1D,0x05,0xFF,0x1B,0x04,0xF3,0x19,
-  0x05,0xDD,0x16,0x01,0xD0,0x3D,0x2B,0xD4,0x93,0x91,0xE5,0xEE,0xF0,0xFF,0xFF,0xFF,
-  0xFF,0xFE,0xFA,0xF8,0xFD,0xF9,0xFD,0xFD,0xFF,0xF5,0xFC,0xFD,0xFD,0xFD,0xFD,0xFE,
-  0xFE,0xFF,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFC,0xFF,0xFF,0xFD,0xFF,0xFF,0xFE,0xFC,0xFF,
-  0xFF,0xFA,0xFF,0xFF,0xFA,0xF4,0xFD,0xFF,0xA1,0x9E,0xED,0x33,0x25,0xD2,0x0A,0x00,
-  0xDE,0x06,0x01,0xEE,0x11,0x07,0xF7,0x13,0x03,0xF6,0x19,0x08,0xFB,0x18,0x06,0xFA,
-  0x1A,0x09,0xF8,0x1B,0x09,0xF8,0x1C,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1B,0x08,0xFA,0x1E,0x0B,0xF8,0x1C,0x08,0xF7,0x19,0x04,0xFB,0x19,0x05,0xFF,0x14,
-  0x00,0xFF,0x11,0x0B,0xF9,0x0A,0x05,0xF2,0x0D,0x00,0xEF,0x22,0x08,0xD8,0x79,0x71,
-  0xDA,0xE2,0xEC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,0xFF,0xFD,0xF9,0xFF,0xFF,0xF7,
-  0xFC,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFE,0xFD,0xFE,0xFD,0xFB,0xF7,0xF8,0xFF,0xEA,0xF5,0xFF,0xF1,0xED,
-  0xF0,0xFF,0xAD,0xA3,0xEA,0x2B,0x22,0xD9,0x11,0x06,0xD0,0x19,0x09,0xEF,0x15,0x08,
-  0xFD,0x12,0x09,0xFC,0x11,0x0D,0xF4,0x14,0x0E,0xF2,0x14,0x0C,0xF4,0x18,0x0A,0xFA,
-  0x1A,0x05,0xFF,0x1B,0x07,0xFD,0x1C,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1B,0x09,0xF9,0x1D,0x05,0xFF,0x1C,0x07,0xFB,0x19,0x0B,0xF5,0x16,0x0C,0xF4,0x13,
-  0x0B,0xF8,0x12,0x0C,0xF4,0x12,0x0A,0xFA,0x15,0x06,0xFF,0x19,0x09,0xF8,0x0D,0x00,
-  0xE6,0x14,0x05,0xD9,0x78,0x6F,0xE0,0xDD,0xE4,0xFD,0xFB,0xFF,0xF1,0xFA,0xFD,0xF5,
-  0xF6,0xF6,0xF8,0xFA,0xFA,0xFA,0xFC,0xFC,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFE,0xFD,0xFF,0xFF,0xF8,0xF9,0xFE,0xFC,0xC5,0xCB,0xF9,0x3C,
-  0x34,0xD0,0x12,0x00,0xE4,0x16,0x07,0xFA,0x16,0x05,0xFD,0x19,0x06,0xFB,0x19,0x0A,
-  0xF7,0x1B,0x0A,0xF6,0x19,0x06,0xFB,0x18,0x05,0xFC,0x18,0x06,0xFB,0x19,0x09,0xFA,
-  0x18,0x0A,0xF8,0x1A,0x09,0xF9,0x1C,0x08,0xFA,0x1C,0x08,0xFA,0x1C,0x08,0xFA,0x1C,
-  0x09,0xF9,0x1C,0x09,0xF9,0x1C,0x09,0xF9,0x1C,0x09,0xF9,0x1C,0x09,0xF9,0x1C,0x09,
-  0xF9,0x1C,0x09,0xF9,0x1C,0x09,0xF9,0x1C,0x08,0xF9,0x1C,0x09,0xF9,0x1C,0x09,0xF9,
-  0x1C,0x09,0xFA,0x19,0x09,0xF9,0x18,0x0A,0xF7,0x18,0x0B,0xF5,0x18,0x0B,0xF4,0x17,
-  0x0B,0xF4,0x19,0x08,0xFB,0x1A,0x08,0xFB,0x18,0x0C,0xF3,0x18,0x0B,0xF6,0x15,0x07,
-  0xFC,0x14,0x03,0xFE,0x10,0x00,0xEF,0x1A,0x10,0xC7,0x91,0x94,0xE4,0xFA,0xFF,0xFF,
-  0xFC,0xF9,0xFD,0xFC,0xFC,0xFB,0xFD,0xFD,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,0xFB,0xFA,0xFC,0xFE,0xFC,0xFB,0xFA,0xFE,0xFE,0xF8,
-  0xFD,0xFB,0xFB,0xFF,0xFF,0xFF,0xFA,0xF7,0xFF,0x7F,0x71,0xE6,0x14,0x02,0xCD,0x13,
-  0x05,0xF3,0x12,0x04,0xFF,0x1C,0x0A,0xF7,0x1D,0x0B,0xF5,0x1B,0x09,0xF8,0x1C,0x06,
-  0xFD,0x1B,0x06,0xFD,0x1D,0x08,0xF8,0x1D,0x09,0xF7,0x1B,0x09,0xF7,0x19,0x0A,0xF6,
-  0x18,0x0B,0xF5,0x19,0x0A,0xF7,0x1A,0x09,0xF9,0x1A,0x0A,0xF6,0x1A,0x09,0xF7,0x1A,
-  0x07,0xFB,0x1B,0x07,0xFC,0x1B,0x08,0xFA,0x1B,0x08,0xFB,0x1B,0x08,0xFA,0x1B,0x08,
-  0xFB,0x1B,0x08,0xFB,0x1A,0x07,0xFC,0x19,0x08,0xFA,0x1A,0x08,0xFA,0x19,0x08,0xFA,
-  0x19,0x07,0xFC,0x18,0x0D,0xF2,0x18,0x0D,0xF3,0x19,0x09,0xF7,0x1B,0x07,0xFC,0x1C,
-  0x05,0xFF,0x1B,0x08,0xF9,0x1A,0x09,0xF7,0x1B,0x08,0xFB,0x1C,0x09,0xF8,0x1C,0x0A,
-  0xF5,0x18,0x0B,0xF1,0x11,0x0C,0xF4,0x15,0x01,0xFF,0x13,0x00,0xE6,0x48,0x39,0xCD,
-  0xD2,0xD4,0xFE,0xFE,0xFF,0xFC,0xFC,0xFD,0xF9,0xFD,0xFC,0xF7,0xFD,0xF9,0xFF,0xF9,
-  0xFF,0xFC,0xFE,0xFF,0xFD,0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFB,0xFE,0xFC,0xF9,0xFC,0xF9,0xFB,0xF5,0xF9,0xFB,0xFA,0xF4,
-  0xFA,0xFF,0xFB,0xD0,0xD0,0xFA,0x3F,0x37,0xBC,0x14,0x03,0xE0,0x13,0x04,0xFF,0x15,
-  0x08,0xFC,0x1B,0x09,0xF8,0x1C,0x08,0xFA,0x1B,0x08,0xFA,0x1C,0x08,0xFA,0x1C,0x09,
-  0xF9,0x1C,0x09,0xF9,0x1B,0x07,0xFA,0x1B,0x08,0xFA,0x1C,0x09,0xF7,0x1A,0x0A,0xF6,
-  0x19,0x0A,0xF8,0x1A,0x08,0xFA,0x1B,0x08,0xF9,0x1B,0x09,0xF7,0x1B,0x09,0xF7,0x1C,
-  0x09,0xF8,0x1B,0x07,0xFB,0x19,0x08,0xFC,0x1A,0x08,0xFB,0x19,0x08,0xFC,0x1A,0x08,
-  0xFC,0x19,0x08,0xFB,0x1B,0x0C,0xF1,0x1B,0x0C,0xF3,0x1B,0x0A,0xF5,0x1B,0x0A,0xF6,
-  0x1A,0x0A,0xF7,0x1C,0x0B,0xF5,0x1C,0x0A,0xF6,0x1C,0x09,0xF6,0x1C,0x09,0xF8,0x1C,
-  0x08,0xFA,0x1C,0x09,0xF9,0x1C,0x08,0xFA,0x1C,0x09,0xF9,0x1C,0x08,0xFA,0x1C,0x08,
-  0xFA,0x19,0x0A,0xF6,0x13,0x0C,0xF4,0x19,0x05,0xFF,0x19,0x02,0xFD,0x1A,0x0A,0xE3,
-  0x1A,0x12,0xC9,0x98,0x92,0xE8,0xFD,0xFF,0xFF,0xFB,0xFA,0xF3,0xFC,0xF7,0xFB,0xF8,
-  0xFC,0xFD,0xFD,0xFE,0xFD,0xFF,0xFF,0xFE,0xFF,0xFF,0xFD,0xFF,0xFF,0xFD,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFD,0xFA,0xFD,0xFF,0xEE,0xFB,0xFF,0xFF,
-  0x9F,0xA4,0xEF,0x1A,0x0F,0xC1,0x18,0x00,0xF1,0x17,0x04,0xFF,0x10,0x06,0xFC,0x16,
-  0x0D,0xF3,0x1D,0x0A,0xF5,0x1B,0x08,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x08,0xFA,0x1C,0x0B,0xF5,0x1C,0x0A,0xF5,0x1B,0x09,0xF8,0x1C,0x08,0xFB,
-  0x1D,0x08,0xFB,0x1B,0x09,0xF7,0x1B,0x09,0xF8,0x1A,0x08,0xFB,0x19,0x08,0xFC,0x19,
-  0x0B,0xF8,0x17,0x0B,0xF6,0x14,0x0A,0xF9,0x14,0x0A,0xF8,0x14,0x0A,0xF9,0x14,0x0A,
-  0xF9,0x14,0x0A,0xF9,0x19,0x0A,0xF7,0x19,0x07,0xFC,0x1A,0x05,0xFF,0x1B,0x06,0xFF,
-  0x1B,0x07,0xFB,0x1C,0x09,0xF7,0x1C,0x08,0xF8,0x1B,0x08,0xF9,0x1C,0x09,0xFA,0x1C,
-  0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xF9,0x1A,0x07,0xFB,0x15,0x07,0xFF,0x18,0x07,0xFD,0x1D,0x0A,0xF9,0x21,0x09,0xF6,
-  0x1E,0x05,0xF3,0x14,0x00,0xE2,0x5F,0x5A,0xD9,0xF5,0xFF,0xFF,0xFE,0xFF,0xF7,0xFF,
-  0xFB,0xFC,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,
-  0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFB,0xFB,0xFC,0xF9,0xFA,0xF0,0xFA,0xFF,0xEE,0xFA,0xFF,0xFE,0x8B,0x86,0xEC,
-  0x13,0x02,0xDE,0x13,0x07,0xF8,0x15,0x05,0xFF,0x12,0x0A,0xFB,0x13,0x0D,0xF3,0x18,
-  0x0B,0xF5,0x1B,0x06,0xFD,0x1C,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x08,0xFA,0x1A,0x0A,0xF6,0x1B,0x08,0xFA,0x1C,0x06,0xFE,0x1A,0x03,0xFA,
-  0x1B,0x04,0xF3,0x1A,0x0A,0xF9,0x10,0x09,0xF9,0x10,0x04,0xFC,0x0E,0x00,0xFC,0x0A,
-  0x00,0xF5,0x0C,0x00,0xF3,0x0E,0x01,0xEE,0x0D,0x00,0xEE,0x0D,0x00,0xED,0x0C,0x00,
-  0xEC,0x0E,0x01,0xEE,0x0F,0x05,0xF1,0x11,0x07,0xF8,0x13,0x07,0xFA,0x12,0x07,0xFA,
-  0x10,0x09,0xF7,0x17,0x07,0xF5,0x1B,0x08,0xF7,0x1C,0x09,0xF8,0x1B,0x08,0xFA,0x1C,
-  0x08,0xFA,0x1C,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xF9,0x1A,0x07,0xFB,0x18,0x07,0xFD,0x18,0x0C,0xF2,0x1B,0x0D,0xF0,0x1D,0x07,0xFB,
-  0x1E,0x01,0xFF,0x11,0x04,0xFD,0x12,0x05,0xE3,0x48,0x3F,0xD2,0xE3,0xE8,0xFF,0xFB,
-  0xFE,0xF6,0xFB,0xFA,0xF9,0xFC,0xFB,0xFD,0xFD,0xFD,0xFE,0xFF,0xFF,0xFE,0xFF,0xFF,
-  0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFC,0xFB,0xFB,0xFC,0xFF,0xF3,0xF9,0xFF,0xFE,0x70,0x65,0xE5,0x11,0x00,0xE8,
-  0x15,0x05,0xF5,0x18,0x09,0xFA,0x17,0x0D,0xF4,0x17,0x0E,0xF0,0x19,0x0C,0xF4,0x19,
-  0x08,0xFA,0x18,0x07,0xFD,0x1B,0x09,0xF9,0x1C,0x08,0xFA,0x1C,0x09,0xFA,0x1B,0x08,
-  0xFA,0x1C,0x08,0xFA,0x19,0x0A,0xF9,0x1A,0x07,0xFC,0x1D,0x07,0xFC,0x1D,0x0A,0xF3,
-  0x19,0x0C,0xE1,0x11,0x01,0xDA,0x14,0x01,0xDA,0x24,0x19,0xCD,0x42,0x3D,0xCC,0x65,
-  0x63,0xDE,0x78,0x76,0xE6,0x88,0x81,0xEA,0x8A,0x84,0xED,0x8C,0x86,0xEE,0x82,0x7C,
-  0xE6,0x74,0x6D,0xDF,0x52,0x46,0xDE,0x36,0x2B,0xCB,0x1D,0x13,0xC4,0x14,0x06,0xD1,
-  0x14,0x01,0xE2,0x14,0x04,0xEF,0x18,0x08,0xF3,0x1D,0x0C,0xF8,0x1B,0x08,0xF9,0x1C,
-  0x07,0xFB,0x1C,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x08,0xF9,0x1C,0x09,0xF9,0x1C,0x09,
-  0xF9,0x1B,0x09,0xF9,0x19,0x09,0xF8,0x1A,0x0B,0xF5,0x19,0x0B,0xF4,0x1A,0x09,0xFA,
-  0x1A,0x06,0xFE,0x13,0x0A,0xF9,0x12,0x0A,0xF4,0x13,0x02,0xE9,0x3B,0x27,0xDB,0xD4,
-  0xD6,0xFD,0xFC,0xFD,0xFC,0xFC,0xFB,0xFE,0xFE,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFD,0xFC,0xFF,0xFC,0xFB,0xFC,0xFE,0xFF,
-  0xF9,0xFC,0xFC,0xFC,0xFF,0xFD,0xFF,0x72,0x60,0xDF,0x15,0x00,0xDB,0x11,0x0A,0xEF,
-  0x19,0x0B,0xF6,0x1C,0x05,0xF9,0x1C,0x07,0xFC,0x1D,0x08,0xFA,0x1C,0x06,0xFD,0x1A,
-  0x08,0xFB,0x16,0x0C,0xF5,0x1A,0x08,0xFB,0x1C,0x0A,0xF6,0x1C,0x07,0xF9,0x1D,0x09,
-  0xF9,0x19,0x08,0xF8,0x19,0x0C,0xF5,0x16,0x04,0xF6,0x13,0x00,0xEA,0x1E,0x0F,0xD6,
-  0x49,0x46,0xDB,0x94,0x93,0xE5,0xD6,0xD9,0xF9,0xF3,0xF9,0xFF,0xFB,0xFF,0xFF,0xFF,
-  0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xEA,0xEF,0xFD,0xC1,0xBA,0xF1,
-  0x8B,0x78,0xE0,0x40,0x32,0xE6,0x15,0x08,0xDB,0x12,0x00,0xE4,0x17,0x04,0xF6,0x18,
-  0x06,0xFC,0x1A,0x0A,0xF9,0x18,0x07,0xF6,0x1B,0x09,0xFA,0x1C,0x08,0xFA,0x1C,0x07,
-  0xFC,0x1B,0x09,0xF9,0x1A,0x08,0xFA,0x1A,0x07,0xFD,0x1A,0x07,0xFD,0x1A,0x09,0xF9,
-  0x1A,0x09,0xF7,0x1B,0x0C,0xF7,0x14,0x0B,0xF4,0x0F,0x02,0xFB,0x18,0x05,0xE8,0x33,
-  0x26,0xD0,0xDF,0xDB,0xFE,0xFF,0xFF,0xFE,0xFE,0xFE,0xFB,0xFD,0xFD,0xFC,0xFD,0xFE,
-  0xFD,0xFD,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0xFE,0xFF,0xFA,0xF8,0xFF,0xFC,0xF4,0xF7,0xF7,0xFE,
-  0xE9,0xF7,0xFE,0xFF,0x67,0x60,0xEB,0x0E,0x02,0xE1,0x1F,0x0C,0xF6,0x1C,0x06,0xFE,
-  0x1A,0x07,0xFA,0x1A,0x0A,0xF7,0x1C,0x08,0xFA,0x1B,0x09,0xFA,0x1C,0x08,0xF9,0x1C,
-  0x09,0xF9,0x1B,0x08,0xF9,0x18,0x0A,0xF7,0x1A,0x0A,0xF6,0x1C,0x09,0xFA,0x1A,0x0B,
-  0xF5,0x15,0x06,0xF7,0x0F,0x00,0xE5,0x24,0x19,0xD5,0x86,0x86,0xEB,0xDB,0xDD,0xFE,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xFD,0xFE,0xFF,
-  0xFE,0xFB,0xFF,0xFD,0xFA,0xFE,0xFA,0xFF,0xFD,0xFC,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,
-  0xFC,0xFE,0xFF,0xF9,0xFE,0xFF,0xF5,0xFF,0xFF,0xF7,0xFF,0xFF,0xFB,0xFF,0xFF,0xFE,
-  0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xD8,0xD8,0xFC,0x89,0x83,0xEB,0x39,0x2C,0xE0,0x0C,
-  0x00,0xE4,0x16,0x06,0xF8,0x14,0x0B,0xF0,0x17,0x09,0xF8,0x17,0x05,0xFF,0x1A,0x08,
-  0xF9,0x1C,0x09,0xF7,0x1C,0x08,0xFA,0x1C,0x08,0xF9,0x1C,0x08,0xF9,0x1C,0x09,0xFA,
-  0x1B,0x08,0xFA,0x18,0x08,0xFA,0x19,0x09,0xF7,0x19,0x0C,0xF7,0x17,0x0B,0xF5,0x0F,
-  0x02,0xF4,0x35,0x26,0xD1,0xDF,0xE2,0xFF,0xFE,0xFF,0xEC,0xFD,0xF5,0xF5,0xFB,0xFE,
-  0xFD,0xFA,0xFF,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xF8,0xFB,0xFB,0xF7,0xF9,0xF5,0xF1,0xF9,0xFF,
-  0xFE,0x89,0x8B,0xE4,0x15,0x02,0xDA,0x1E,0x0C,0xF4,0x1E,0x08,0xFA,0x1C,0x06,0xFF,
-  0x1B,0x08,0xF9,0x1B,0x0A,0xF6,0x1C,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xF9,0x1B,
-  0x08,0xFA,0x1C,0x09,0xF8,0x20,0x0E,0xED,0x14,0x03,0xFF,0x10,0x0C,0xF8,0x18,0x0B,
-  0xEF,0x1A,0x00,0xD3,0x76,0x70,0xDF,0xE1,0xEA,0xFF,0xFD,0xFF,0xF8,0xFB,0xFF,0xEA,
-  0xFF,0xFB,0xFA,0xFF,0xFC,0xFA,0xFF,0xFF,0xFA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,0xFF,0xF8,0xFF,0xFF,0xFD,0xFF,0xFF,0xFE,0xFF,0xFE,
-  0xFE,0xFF,0xFD,0xFD,0xFE,0xFB,0xFC,0xFE,0xFC,0xFD,0xFB,0xFE,0xFD,0xF8,0xFE,0xFA,
-  0xF0,0xFD,0xF2,0xF7,0xF8,0xF4,0xFF,0xFF,0xF6,0xFD,0xFF,0xF6,0xEB,0xF1,0xFF,0xB4,
-  0xAB,0xF4,0x40,0x2D,0xCE,0x18,0x00,0xE3,0x18,0x08,0xF9,0x14,0x0A,0xFA,0x16,0x0B,
-  0xF5,0x1B,0x0C,0xF3,0x1C,0x08,0xFA,0x1C,0x09,0xFA,0x1B,0x08,0xF9,0x1C,0x09,0xFA,
-  0x1B,0x08,0xFA,0x18,0x09,0xF8,0x19,0x0A,0xF8,0x18,0x0A,0xF6,0x19,0x0C,0xF7,0x17,
-  0x0B,0xF6,0x1A,0x04,0xED,0x42,0x2D,0xDA,0xEC,0xF3,0xFF,0xFE,0xFF,0xF4,0xFF,0xFB,
-  0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0xFE,0xF4,0xFA,0xFA,0xFA,0xFC,0xFF,0xF7,0xA6,0xA6,
-  0xF0,0x0E,0x00,0xDE,0x1A,0x0E,0xF6,0x1C,0x06,0xFC,0x1C,0x06,0xFE,0x1B,0x07,0xFD,
-  0x1D,0x08,0xF9,0x1C,0x0A,0xF6,0x1B,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1B,
-  0x09,0xFA,0x1C,0x09,0xF9,0x23,0x06,0xFA,0x18,0x08,0xFE,0x0D,0x02,0xF5,0x22,0x17,
-  0xCB,0xBA,0xB4,0xF1,0xFE,0xFF,0xFE,0xFE,0xFD,0xFC,0xFE,0xF6,0xF6,0xFF,0xFF,0xF2,
-  0xFF,0xFF,0xFF,0xEC,0xF2,0xFF,0xC7,0xD0,0xEF,0xB0,0xB4,0xEA,0x9E,0x9F,0xE6,0x92,
-  0x95,0xE5,0x98,0x9A,0xEC,0xA8,0xA9,0xEC,0xC6,0xC4,0xF3,0xEF,0xED,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFA,0xFF,0xFA,0xFE,0xFF,0xFA,0xFC,0xFC,0xFB,0xF6,0xF9,0xFC,0xFA,
-  0xF6,0xFC,0xFD,0xFD,0xFD,0xFB,0xFF,0xFD,0xFA,0xFF,0xFE,0xF8,0xFF,0xFF,0xF7,0xFF,
-  0xFF,0xF4,0xFB,0xFD,0xFF,0x89,0x82,0xE4,0x1C,0x0A,0xCE,0x14,0x03,0xF3,0x16,0x07,
-  0xFD,0x1A,0x07,0xFE,0x1B,0x08,0xF9,0x1B,0x08,0xF9,0x1C,0x09,0xFA,0x1C,0x08,0xF9,
-  0x1B,0x08,0xFA,0x18,0x0A,0xF7,0x19,0x09,0xF8,0x19,0x0A,0xF8,0x18,0x0B,0xF6,0x19,
-  0x0C,0xF6,0x14,0x05,0xFB,0x11,0x00,0xEC,0x5D,0x50,0xE0,0xF7,0xFF,0xF7,0xFD,0xFE,
-  0xEF,0xFC,0xF8,0xFA,0xFD,0xFD,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFC,0xFD,0xF7,0xFD,0xFE,0xC7,0xD0,0xF9,0x23,0x0D,
-  0xD9,0x18,0x05,0xFB,0x17,0x07,0xFB,0x1B,0x07,0xFC,0x1B,0x07,0xFC,0x1E,0x07,0xFA,
-  0x1E,0x07,0xF9,0x1D,0x08,0xF9,0x1B,0x09,0xFA,0x1B,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x08,0xFA,0x1B,0x09,0xFA,0x1A,0x07,0xFB,0x1A,0x06,0xE4,0x3F,0x2C,0xD3,0xDF,0xE2,
-  0xFF,0xFF,0xFF,0xF8,0xFF,0xFE,0xF3,0xFE,0xFF,0xF4,0xF7,0xFF,0xFF,0xAA,0xA6,0xF4,
-  0x5C,0x4E,0xDD,0x24,0x17,0xD2,0x0F,0x00,0xDC,0x0D,0x00,0xE3,0x0D,0x00,0xEE,0x0E,
-  0x00,0xF4,0x10,0x00,0xF3,0x0A,0x05,0xE0,0x0E,0x03,0xD3,0x27,0x19,0xC8,0x4E,0x43,
-  0xC9,0x99,0x90,0xF1,0xE5,0xEF,0xFE,0xFB,0xFF,0xF8,0xF8,0xFE,0xEB,0xF9,0xFB,0xEF,
-  0xFC,0xF6,0xFF,0xFA,0xF8,0xFF,0xFD,0xFC,0xFF,0xFE,0xFD,0xFF,0xFF,0xFC,0xFF,0xFE,
-  0xF7,0xFF,0xFB,0xFA,0xF9,0xFD,0xFF,0xF8,0xCC,0xCB,0xF9,0x35,0x1E,0xD6,0x15,0x00,
-  0xF0,0x18,0x0C,0xF5,0x1C,0x09,0xFA,0x1D,0x09,0xFA,0x1B,0x07,0xF9,0x1C,0x09,0xFA,
-  0x1B,0x08,0xFA,0x18,0x0A,0xF7,0x19,0x0A,0xF8,0x18,0x09,0xF7,0x19,0x0A,0xF7,0x19,
-  0x09,0xF9,0x17,0x0E,0xF1,0x17,0x07,0xFC,0x10,0x00,0xDD,0x82,0x83,0xE3,0xFD,0xFF,
-  0xF9,0xFB,0xFA,0xF9,0xFA,0xFA,0xFA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xFF,0xFF,0x3D,0x39,0xCC,0x11,0x00,
-  0xF3,0x1B,0x07,0xFB,0x1B,0x0A,0xF8,0x19,0x09,0xF7,0x1C,0x09,0xF6,0x1E,0x09,0xF7,
-  0x1E,0x07,0xFA,0x1F,0x07,0xFB,0x1B,0x08,0xF9,0x1C,0x09,0xF9,0x1B,0x08,0xF9,0x1B,
-  0x08,0xF9,0x1B,0x08,0xFC,0x07,0x00,0xF4,0x43,0x3B,0xCF,0xF7,0xF4,0xFD,0xFF,0xFF,
-  0xF8,0xFF,0xFF,0xF6,0xFF,0xFF,0xFE,0xBC,0xB0,0xF4,0x34,0x22,0xD5,0x0B,0x00,0xE5,
-  0x12,0x00,0xF4,0x14,0x07,0xF1,0x18,0x0D,0xF6,0x19,0x0A,0xFB,0x17,0x07,0xF9,0x18,
-  0x0A,0xF6,0x15,0x09,0xEF,0x16,0x0D,0xF3,0x1A,0x0A,0xFF,0x14,0x03,0xFC,0x14,0x02,
-  0xF9,0x0C,0x00,0xEC,0x24,0x12,0xD9,0x76,0x71,0xE1,0xEF,0xF5,0xFF,0xFB,0xFF,0xF2,
-  0xFD,0xFF,0xF5,0xFE,0xFC,0xFB,0xFF,0xFE,0xFD,0xFF,0xFF,0xFB,0xFD,0xFE,0xF8,0xFB,
-  0xFC,0xF9,0xFB,0xF9,0xF8,0xFF,0xFC,0xF9,0xFF,0xFE,0xF6,0xE6,0xEA,0xFF,0x36,0x35,
-  0xC9,0x0E,0x02,0xEE,0x1C,0x08,0xFC,0x1B,0x08,0xFA,0x1C,0x09,0xF9,0x1C,0x08,0xF9,
-  0x1B,0x08,0xFA,0x18,0x0A,0xF7,0x18,0x0A,0xF7,0x19,0x0A,0xF8,0x18,0x09,0xF9,0x18,
-  0x08,0xFA,0x1B,0x07,0xFC,0x1A,0x13,0xEE,0x15,0x0E,0xF0,0x14,0x00,0xDD,0xBC,0xBA,
-  0xFD,0xFD,0xFF,0xF5,0xFD,0xFC,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFC,0xFF,0xF6,0xFF,0xFD,0xF6,0xFE,0xFF,0xFA,
-  0xF9,0xFF,0xF7,0xFA,0xF9,0xF9,0xFF,0xFC,0x7E,0x79,0xDF,0x0E,0x00,0xE3,0x16,0x09,
-  0xFE,0x1B,0x07,0xF8,0x1E,0x07,0xFB,0x1B,0x09,0xF9,0x1C,0x08,0xF9,0x1B,0x08,0xF9,
-  0x1C,0x09,0xFA,0x19,0x09,0xF8,0x17,0x06,0xFE,0x22,0x07,0xF7,0x19,0x09,0xFA,0x15,
-  0x13,0xF0,0x10,0x00,0xEB,0x2D,0x22,0xDA,0xE6,0xED,0xFF,0xFF,0xFF,0xF5,0xFD,0xFF,
-  0xE7,0xF4,0xF6,0xFF,0x6C,0x65,0xEB,0x0F,0x00,0xCB,0x1B,0x05,0xF4,0x17,0x08,0xF5,
-  0x16,0x13,0xF0,0x17,0x12,0xEE,0x1B,0x07,0xFF,0x1E,0x09,0xFD,0x1C,0x0D,0xF0,0x19,
-  0x07,0xFA,0x19,0x08,0xFC,0x1C,0x09,0xF9,0x1B,0x08,0xFA,0x1B,0x08,0xFB,0x1A,0x07,
-  0xFB,0x1A,0x07,0xFB,0x18,0x06,0xFB,0x0B,0x00,0xE2,0x2F,0x2A,0xCC,0xCF,0xD9,0xF9,
-  0xFF,0xFF,0xF6,0xFF,0xFE,0xF2,0xF9,0xF8,0xFB,0xF5,0xFB,0xFF,0xF8,0xFD,0xFE,0xFE,
-  0xFE,0xFE,0xFF,0xFE,0xFB,0xFF,0xFD,0xFD,0xFF,0xFF,0xF9,0xFD,0xFF,0xF9,0xE6,0xE6,
-  0xFF,0x3C,0x2A,0xBE,0x16,0x01,0xEB,0x16,0x06,0xFD,0x14,0x0F,0xF1,0x18,0x0C,0xF3,
-  0x1E,0x07,0xFA,0x1C,0x09,0xFA,0x1B,0x08,0xFA,0x1B,0x08,0xFA,0x1B,0x08,0xFA,0x1B,
-  0x09,0xF9,0x1B,0x07,0xFD,0x14,0x0D,0xF1,0x10,0x08,0xFC,0x18,0x03,0xF9,0x2F,0x26,
-  0xBD,0xF0,0xF3,0xFF,0xF8,0xFA,0xF1,0xFC,0xFD,0xF5,0xFE,0xFF,0xFE,0xFA,0xFE,0xFD,
-  0xF9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFD,0xFA,0xFE,0xFE,0xFC,0xFF,0xFD,0xFF,
-  0xFD,0xF9,0xFD,0xFF,0xF8,0xBF,0xC1,0xFC,0x18,0x09,0xC1,0x19,0x06,0xFE,0x14,0x0A,
-  0xFB,0x1B,0x0E,0xF3,0x1C,0x07,0xF6,0x1B,0x09,0xFA,0x1C,0x08,0xFA,0x1B,0x09,0xFA,
-  0x1C,0x09,0xF9,0x19,0x08,0xFA,0x17,0x08,0xFB,0x21,0x06,0xFB,0x1A,0x09,0xFC,0x13,
-  0x0B,0xF2,0x17,0x04,0xD4,0xCF,0xCF,0xFC,0xFB,0xFF,0xED,0xFE,0xF8,0xF8,0xF8,0xFF,
-  0xFE,0x60,0x54,0xCE,0x05,0x00,0xCE,0x1B,0x12,0xE5,0x16,0x12,0xDD,0x07,0x04,0xD6,
-  0x00,0x00,0xE4,0x13,0x01,0xFE,0x1A,0x0B,0xF3,0x19,0x0A,0xF5,0x19,0x04,0xFF,0x17,
-  0x0A,0xF8,0x17,0x09,0xFB,0x1C,0x08,0xF9,0x1C,0x09,0xF9,0x1C,0x09,0xF9,0x1C,0x08,
-  0xFA,0x1C,0x09,0xF9,0x17,0x0D,0xF0,0x14,0x06,0xFB,0x16,0x04,0xF1,0x25,0x0E,0xCE,
-  0xCC,0xCD,0xFB,0xFD,0xFF,0xF3,0xFE,0xFD,0xF3,0xFD,0xFF,0xFD,0xFE,0xFD,0xFF,0xFF,
-  0xFF,0xFE,0xFF,0xFE,0xFD,0xFF,0xFA,0xFF,0xFF,0xFE,0xFB,0xF6,0xFA,0xEA,0xF4,0xFA,
-  0xFC,0xDA,0xD8,0xFF,0x20,0x10,0xCE,0x1C,0x05,0xFB,0x12,0x08,0xFB,0x18,0x09,0xF9,
-  0x1D,0x08,0xF8,0x1B,0x08,0xFA,0x1C,0x08,0xFA,0x1C,0x08,0xFA,0x1C,0x09,0xFA,0x1B,
-  0x09,0xF9,0x1F,0x05,0xFE,0x1A,0x0C,0xF2,0x13,0x08,0xFA,0x19,0x02,0xFF,0x1A,0x04,
-  0xE2,0x7A,0x6D,0xD8,0xFF,0xFF,0xFF,0xFC,0xFF,0xF1,0xFF,0xFD,0xFE,0xFD,0xFE,0xFB,
-  0xFD,0xFE,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xF8,0xFE,0xFC,0xFE,0xFF,0xFD,0xF6,0xFE,
-  0xFD,0xF4,0xFB,0xFA,0xFF,0x3D,0x36,0xD0,0x15,0x04,0xEC,0x17,0x06,0xFF,0x15,0x0D,
-  0xF6,0x17,0x0B,0xF0,0x1C,0x09,0xF8,0x1C,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xF9,0x19,0x07,0xFC,0x17,0x0A,0xF9,0x1F,0x06,0xFE,0x15,0x06,0xFA,0x15,
-  0x03,0xF0,0x65,0x55,0xDA,0xFF,0xFF,0xFA,0xFE,0xF8,0xF8,0xFF,0xFC,0xFB,0xD6,0xD7,
-  0xED,0xAB,0xB5,0xE4,0xEA,0xF4,0xFF,0xFA,0xFF,0xFF,0xF9,0xFF,0xFF,0xE9,0xEC,0xFF,
-  0xBB,0xAB,0xF3,0x39,0x23,0xC4,0x1A,0x09,0xDF,0x16,0x08,0xF5,0x12,0x07,0xFD,0x15,
-  0x0A,0xF8,0x19,0x07,0xFD,0x1C,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x08,
-  0xFA,0x1B,0x08,0xFA,0x18,0x08,0xFA,0x16,0x11,0xF3,0x15,0x0A,0xFA,0x17,0x00,0xF8,
-  0x28,0x1B,0xD5,0xE5,0xDF,0xFF,0xFB,0xFF,0xF0,0xFF,0xFE,0xF6,0xFF,0xFB,0xFF,0xFF,
-  0xFF,0xFB,0xFD,0xFE,0xFE,0xFE,0xFA,0xFF,0xFE,0xFC,0xFE,0xFC,0xFE,0xF2,0xF8,0xFC,
-  0xED,0xFE,0xFF,0xFD,0xA0,0x9C,0xF2,0x13,0x00,0xD8,0x1B,0x08,0xFF,0x17,0x04,0xFF,
-  0x1A,0x0A,0xF5,0x1C,0x08,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1B,
-  0x09,0xF9,0x21,0x05,0xFE,0x1E,0x0C,0xF1,0x18,0x0F,0xF1,0x15,0x05,0xFA,0x18,0x05,
-  0xFD,0x19,0x04,0xC8,0xC8,0xCA,0xF7,0xFB,0xFF,0xF9,0xFD,0xF8,0xFC,0xFE,0xFD,0xFA,
-  0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFC,0xFE,0xF8,0xFD,0xF9,0xFF,0xFF,0xFC,0xF2,0xFF,
-  0xFE,0xFD,0xA6,0x9E,0xEC,0x0D,0x09,0xCF,0x15,0x09,0xF4,0x16,0x06,0xF8,0x19,0x0C,
-  0xF3,0x19,0x0A,0xF9,0x1A,0x07,0xFC,0x1C,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xF9,0x1A,0x08,0xFB,0x18,0x08,0xFB,0x1A,0x09,0xF7,0x17,0x0B,0xFE,0x14,
-  0x00,0xE1,0xCE,0xC5,0xFA,0xF3,0xF3,0xFF,0xF5,0xFF,0xE7,0xFD,0xFB,0xF9,0xFF,0xFF,
-  0xFC,0xFF,0xFF,0xFC,0xFF,0xFF,0xFE,0xFE,0xF9,0xFE,0xFF,0xFB,0xFC,0xFF,0xFF,0xF5,
-  0xFF,0xFF,0xEB,0xF2,0xF4,0xFC,0x56,0x46,0xD9,0x18,0x04,0xE8,0x13,0x10,0xEE,0x16,
-  0x09,0xFB,0x1B,0x07,0xFD,0x1C,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1B,0x09,
-  0xFA,0x1B,0x08,0xF9,0x1C,0x0D,0xF0,0x16,0x10,0xEC,0x13,0x07,0xFF,0x17,0x0F,0xF1,
-  0x09,0x00,0xE6,0x61,0x51,0xD6,0xF8,0xFF,0xFF,0xFF,0xFE,0xF6,0xFF,0xFA,0xFD,0xFD,
-  0xFE,0xF9,0xFC,0xFE,0xFD,0xFE,0xFE,0xFE,0xFC,0xFC,0xFE,0xFC,0xFD,0xFE,0xFD,0xFA,
-  0xFB,0xFF,0xFC,0xF8,0xFE,0xFF,0xFF,0x47,0x38,0xCF,0x13,0x04,0xED,0x16,0x05,0xFF,
-  0x1B,0x0D,0xF5,0x1C,0x08,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1B,
-  0x09,0xF9,0x1E,0x06,0xFC,0x1B,0x0A,0xF6,0x19,0x10,0xEC,0x17,0x0F,0xEC,0x1B,0x10,
-  0xF5,0x12,0x02,0xEB,0x49,0x43,0xCF,0xEF,0xF6,0xFF,0xFB,0xF7,0xF8,0xFE,0xF9,0xFD,
-  0xFC,0xFF,0xFB,0xFF,0xFF,0xFF,0xFA,0xFE,0xFC,0xFE,0xF9,0xFF,0xFF,0xFF,0xF5,0xF5,
-  0xF4,0xFF,0x32,0x24,0xCE,0x0E,0x05,0xEC,0x14,0x04,0xF4,0x21,0x09,0xFE,0x1E,0x08,
-  0xF8,0x19,0x07,0xFD,0x19,0x07,0xFD,0x1C,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x08,0xFA,0x1B,0x09,0xF8,0x18,0x06,0xFE,0x18,0x0F,0xED,0x10,0x06,0xF9,0x23,
-  0x0B,0xE0,0xFF,0xFF,0xF8,0xF8,0xFD,0xEE,0xFB,0xFB,0xFB,0xFB,0xFE,0xF5,0xFF,0xFF,
-  0xFD,0xFF,0xFD,0xFD,0xFD,0xFF,0xFA,0xFA,0xFB,0xFE,0xFC,0xFC,0xFE,0xF9,0xFC,0xF9,
-  0xF3,0xF6,0xF7,0xFB,0xFE,0xF0,0xE8,0xE4,0xFF,0x24,0x15,0xD1,0x14,0x09,0xF6,0x16,
-  0x0A,0xF6,0x1E,0x09,0xF8,0x1B,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1B,0x09,
-  0xFA,0x1C,0x08,0xF9,0x21,0x09,0xF6,0x1C,0x06,0xFB,0x19,0x0A,0xF9,0x14,0x08,0xF4,
-  0x15,0x06,0xF5,0x14,0x03,0xD0,0xCF,0xDC,0xF9,0xFF,0xFF,0xFD,0xFF,0xFC,0xFD,0xF9,
-  0xFF,0xF7,0xFA,0xFB,0xFF,0xFF,0xFE,0xFD,0xF8,0xFF,0xF9,0xF7,0xFD,0xFD,0xF8,0xF9,
-  0xFB,0xFD,0xF7,0xF6,0xFF,0xFF,0xFB,0xAC,0xB6,0xEA,0x08,0x00,0xD9,0x14,0x0D,0xF8,
-  0x17,0x0A,0xF6,0x1C,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x08,0xFA,0x15,0x0A,0xF7,0x16,0x06,0xFF,0x1A,0x06,0xFD,0x1A,0x0B,0xF3,0x1A,0x0B,
-  0xF5,0x11,0x05,0xFF,0x0D,0x00,0xDC,0xBE,0xBD,0xF3,0xFF,0xFF,0xF7,0xFB,0xF6,0xFF,
-  0xFA,0xFF,0xF5,0xFF,0xFF,0xFF,0xF9,0xFD,0xFF,0xFC,0xFC,0xF3,0xFC,0xFF,0xFC,0x99,
-  0x9A,0xED,0x0D,0x00,0xE1,0x19,0x08,0xFB,0x1C,0x09,0xFA,0x1F,0x08,0xFC,0x1D,0x07,
-  0xFA,0x1B,0x07,0xFB,0x1A,0x08,0xFA,0x1C,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x08,0xFA,0x1A,0x0A,0xF7,0x1A,0x07,0xFC,0x1A,0x08,0xFB,0x12,0x05,0xF6,0x38,
-  0x27,0xD9,0xFF,0xFF,0xFE,0xFB,0xFF,0xE9,0xFE,0xF9,0xFF,0xFE,0xFA,0xFF,0xFF,0xFF,
-  0xFE,0xFF,0xFB,0xFF,0xFF,0xFE,0xFA,0xFF,0xFF,0xFD,0xFF,0xFE,0xFD,0xFE,0xFE,0xFB,
-  0xFC,0xFC,0xFC,0xFF,0xFF,0xF3,0xFF,0xFF,0xFD,0x5E,0x53,0xE3,0x14,0x00,0xF6,0x18,
-  0x0E,0xF1,0x1D,0x07,0xFC,0x1B,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1B,0x09,
-  0xFA,0x1C,0x09,0xF9,0x1E,0x07,0xFC,0x1D,0x07,0xFB,0x1B,0x0A,0xF4,0x1B,0x08,0xFB,
-  0x1C,0x09,0xFC,0x12,0x00,0xEC,0x76,0x73,0xE0,0xF9,0xFF,0xFC,0xFF,0xFF,0xF2,0xFC,
-  0xFD,0xFB,0xFB,0xFC,0xFE,0xFE,0xFE,0xFE,0xFC,0xFE,0xFC,0xFC,0xFE,0xFE,0xFD,0xFE,
-  0xFE,0xFE,0xFC,0xFD,0xFB,0xFD,0xEF,0xF9,0xFF,0xFF,0x2A,0x1B,0xC8,0x16,0x06,0xF5,
-  0x18,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x08,0xFA,0x19,0x09,0xF8,0x19,0x07,0xFC,0x1C,0x07,0xFD,0x1B,0x08,0xF9,0x1C,0x09,
-  0xFA,0x17,0x05,0xFD,0x12,0x04,0xF2,0x41,0x39,0xD6,0xFB,0xFF,0xFA,0xFB,0xF5,0xF9,
-  0xFC,0xFE,0xF7,0xFE,0xFD,0xFF,0xFA,0xFA,0xFE,0xFE,0xFF,0xF0,0xF4,0xFD,0xFF,0x33,
-  0x2C,0xC7,0x14,0x04,0xF6,0x1B,0x09,0xFB,0x1C,0x08,0xFA,0x1B,0x09,0xF9,0x1B,0x09,
-  0xF9,0x1C,0x09,0xF9,0x1C,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xF9,0x1A,0x08,0xFA,0x1A,0x07,0xFD,0x1B,0x08,0xFB,0x14,0x04,0xFC,0x2F,
-  0x20,0xD4,0xFF,0xFF,0xFF,0xFA,0xF7,0xF4,0xFF,0xFA,0xFF,0xFE,0xFA,0xFF,0xFE,0xFE,
-  0xFF,0xFE,0xFF,0xFB,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFE,
-  0xFF,0xFF,0xFC,0xFF,0xFB,0xFD,0xFF,0xFF,0xFF,0x79,0x73,0xE1,0x1A,0x02,0xF1,0x17,
-  0x09,0xF3,0x19,0x08,0xF8,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1B,0x09,0xFA,0x1B,0x09,0xF9,0x1B,0x09,0xF9,0x1C,0x08,0xFA,0x1C,0x09,0xF9,
-  0x1B,0x08,0xFA,0x19,0x02,0xFA,0x3C,0x2D,0xCB,0xFD,0xFF,0xFF,0xFC,0xFE,0xEF,0xFD,
-  0xFC,0xFE,0xFC,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFD,0xFC,0xFF,0xFC,0xFF,0xF4,0xFD,0xFF,0xFF,0x70,0x65,0xE1,0x12,0x00,0xEB,
-  0x1A,0x09,0xFC,0x1C,0x08,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x08,0xFA,0x1C,0x09,0xF9,0x1C,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,
-  0xF9,0x1C,0x09,0xFE,0x14,0x04,0xFB,0x0C,0x00,0xCF,0xC7,0xCA,0xF2,0xFF,0xFF,0xFF,
-  0xFD,0xFD,0xF6,0xFF,0xFF,0xFF,0xFF,0xFE,0xFD,0xFF,0xFF,0xFA,0xB7,0xB8,0xF4,0x12,
-  0x01,0xD6,0x16,0x07,0xFC,0x19,0x06,0xFA,0x1C,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xF9,0x1B,0x07,0xFC,0x19,0x06,0xFE,0x1C,0x0B,0xF3,0x16,0x05,0xFF,0x14,
-  0x05,0xD0,0xF2,0xF8,0xFF,0xFA,0xFC,0xF2,0xFF,0xFE,0xFB,0xFD,0xFB,0xFF,0xFA,0xFB,
-  0xFF,0xFB,0xFF,0xF9,0xFE,0xFE,0xFE,0xFF,0xFF,0xFD,0xFF,0xFF,0xF9,0xFC,0xFF,0xF5,
-  0xFD,0xFF,0xF6,0xFF,0xFF,0xF5,0xFF,0xFF,0xFF,0x5E,0x55,0xD5,0x15,0x00,0xEE,0x1B,
-  0x0C,0xFC,0x1A,0x08,0xF9,0x1C,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xF9,0x18,0x03,0xFF,0x26,0x11,0xD2,0xEC,0xF3,0xFF,0xFA,0xFA,0xF2,0xFE,
-  0xFC,0xFD,0xFD,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFE,0xFC,0xFF,0xFC,0xFE,0xF6,0xFB,0xFF,0xF6,0xA6,0xA7,0xED,0x10,0x00,0xE2,
-  0x18,0x08,0xFD,0x1A,0x08,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x08,
-  0xFA,0x1A,0x09,0xF8,0x17,0x05,0xFD,0x15,0x05,0xE6,0x54,0x46,0xD4,0xFF,0xFF,0xFF,
-  0xFF,0xFE,0xF4,0xFE,0xFF,0xFB,0xFF,0xFE,0xF8,0xFD,0xFF,0xFF,0x5A,0x52,0xD5,0x14,
-  0x00,0xF9,0x16,0x07,0xFF,0x1B,0x09,0xFA,0x1C,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xF9,0x19,0x07,0xFB,0x18,0x08,0xFC,0x1E,0x0C,0xF2,0x16,0x06,0xFD,0x0D,
-  0x00,0xE1,0x9A,0x99,0xE3,0xFD,0xFF,0xFA,0xF5,0xFF,0xED,0xF9,0xFF,0xF6,0xFB,0xFB,
-  0xFF,0xFD,0xFD,0xFD,0xFF,0xFD,0xFE,0xFD,0xFF,0xFC,0xFD,0xFE,0xF6,0xFC,0xFF,0xF7,
-  0xF6,0xF5,0xF7,0xF9,0xFF,0xF4,0xD7,0xD7,0xFD,0x20,0x09,0xD6,0x17,0x04,0xFC,0x18,
-  0x0B,0xF8,0x1B,0x06,0xFE,0x1C,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xF9,0x14,0x05,0xFF,0x1B,0x00,0xE0,0xDB,0xE0,0xF6,0xFE,0xFD,0xF9,0xFF,
-  0xFD,0xFE,0xFC,0xFD,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFC,0xFD,0xFF,0xFA,0xFE,0xF9,0xFE,0xFF,0xF5,0xCC,0xD2,0xF6,0x10,0x00,0xDC,
-  0x18,0x09,0xFF,0x1B,0x08,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x08,
-  0xFA,0x1B,0x0A,0xF7,0x1A,0x0C,0xF5,0x13,0x04,0xED,0x11,0x00,0xD2,0xE3,0xE7,0xFF,
-  0xFC,0xFC,0xF0,0xFB,0xFD,0xF9,0xFF,0xFF,0xFA,0xE6,0xE5,0xFF,0x1E,0x09,0xCE,0x16,
-  0x05,0xFF,0x18,0x08,0xF7,0x1C,0x09,0xF8,0x1B,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x08,0xFA,0x19,0x0A,0xF8,0x17,0x0A,0xF8,0x1F,0x09,0xF7,0x15,0x08,0xFA,0x14,
-  0x04,0xF7,0x2C,0x19,0xCA,0xE7,0xE2,0xFF,0xF3,0xFC,0xFC,0xF7,0xFE,0xF2,0xFF,0xFB,
-  0xFF,0xFF,0xFC,0xFE,0xFF,0xFF,0xFF,0xFE,0xFF,0xFB,0xFE,0xFF,0xF7,0xFF,0xFF,0xFD,
-  0xFF,0xF8,0xFF,0xE4,0xE2,0xFF,0x3B,0x35,0xCD,0x13,0x00,0xF3,0x11,0x07,0xFB,0x19,
-  0x0D,0xF4,0x1E,0x09,0xF9,0x1B,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1D,0x08,0xFA,0x0F,0x09,0xF9,0x16,0x00,0xEA,0xD5,0xD8,0xF8,0xFD,0xFE,0xF9,0xFE,
-  0xFE,0xFC,0xFC,0xFD,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFC,0xFD,0xFF,0xFD,0xFF,0xFC,0xFF,0xFB,0xF9,0xE0,0xE5,0xFF,0x11,0x00,0xDC,
-  0x14,0x08,0xFD,0x1B,0x08,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x08,
-  0xFA,0x1A,0x08,0xFA,0x1B,0x09,0xF8,0x13,0x09,0xF3,0x0B,0x00,0xEB,0x97,0x8A,0xEF,
-  0xFF,0xFF,0xF9,0xF5,0xF6,0xF6,0xFF,0xFF,0xFC,0xA0,0xA2,0xE9,0x11,0x00,0xE9,0x17,
-  0x08,0xF9,0x1D,0x0A,0xF8,0x1C,0x08,0xF9,0x1B,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x08,0xFA,0x1A,0x09,0xF7,0x19,0x0A,0xF7,0x1D,0x07,0xFA,0x18,0x09,0xF8,0x15,
-  0x03,0xF9,0x1D,0x05,0xED,0x46,0x39,0xCD,0xD5,0xDA,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xF5,0xFF,0xFF,0xFD,0xFF,0xFF,0xFE,0xFF,0xFF,0xF7,0xFF,0xFF,0xF7,0xFF,0xFF,0xFF,
-  0xBF,0xB4,0xF2,0x36,0x27,0xC8,0x12,0x03,0xE9,0x15,0x08,0xFB,0x12,0x09,0xF8,0x18,
-  0x0C,0xF6,0x1C,0x0A,0xF6,0x1C,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x08,0xFA,0x10,0x0B,0xF8,0x17,0x00,0xEA,0xD2,0xD6,0xF5,0xFD,0xFF,0xF1,0xFF,
-  0xFD,0xF9,0xFD,0xFC,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFC,0xFD,0xFE,0xFC,0xFD,0xFE,0xFF,0xFC,0xF3,0xE6,0xE6,0xFF,0x11,0x00,0xDB,
-  0x14,0x0A,0xF7,0x1B,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x08,
-  0xFA,0x19,0x09,0xF7,0x1D,0x05,0xFE,0x17,0x0A,0xF7,0x11,0x05,0xFB,0x47,0x32,0xDE,
-  0xFF,0xFF,0xFE,0xFB,0xFA,0xF6,0xFF,0xFF,0xFF,0x50,0x51,0xD7,0x11,0x05,0xFA,0x1B,
-  0x0A,0xF5,0x1C,0x08,0xF9,0x1B,0x08,0xFA,0x1C,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x08,0xFA,0x1C,0x08,0xFA,0x1B,0x09,0xFA,0x1C,0x08,0xF9,0x1E,
-  0x0B,0xFC,0x18,0x06,0xFA,0x0E,0x00,0xF6,0x1B,0x08,0xDB,0x64,0x54,0xDF,0xB3,0xAA,
-  0xF2,0xD6,0xD8,0xF5,0xD6,0xDD,0xF8,0xC1,0xC2,0xF3,0x87,0x7E,0xD7,0x40,0x2F,0xCD,
-  0x14,0x00,0xDA,0x15,0x03,0xF9,0x18,0x08,0xFC,0x19,0x08,0xFA,0x19,0x08,0xFA,0x18,
-  0x08,0xFA,0x19,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x08,0xF9,0x14,0x09,0xFD,0x16,0x00,0xE1,0xDA,0xDE,0xF8,0xFE,0xFF,0xED,0xFF,
-  0xFE,0xF6,0xFE,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFC,0xFF,0xFE,0xFC,0xF7,0xFF,0xFF,0xFF,0xF0,0xDE,0xD9,0xFF,0x14,0x00,0xDF,
-  0x18,0x0A,0xF9,0x1B,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x08,
-  0xFA,0x19,0x0A,0xF6,0x1D,0x04,0xFD,0x1C,0x09,0xF8,0x14,0x0A,0xF8,0x1A,0x08,0xDD,
-  0xDE,0xEB,0xFC,0xFF,0xFF,0xF5,0xFB,0xFE,0xFF,0x1F,0x10,0xD0,0x13,0x0A,0xF0,0x1C,
-  0x0B,0xF5,0x1C,0x07,0xFA,0x1C,0x07,0xFC,0x1C,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1B,0x08,0xF9,0x1C,
-  0x08,0xF9,0x1B,0x09,0xFA,0x11,0x04,0xF7,0x1C,0x0A,0xFC,0x1A,0x04,0xF2,0x10,0x00,
-  0xE4,0x10,0x00,0xE4,0x0B,0x00,0xDE,0x0C,0x00,0xE3,0x14,0x00,0xF1,0x16,0x04,0xF5,
-  0x14,0x0B,0xF3,0x15,0x0A,0xF4,0x19,0x08,0xFA,0x19,0x09,0xFA,0x19,0x09,0xFA,0x18,
-  0x09,0xFA,0x19,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xF9,0x16,0x05,0xFF,0x1D,0x06,0xD8,0xE3,0xE6,0xFE,0xFF,0xFF,0xF6,0xFF,
-  0xFC,0xFB,0xFD,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFE,0xFF,0xFF,0xFA,0xF9,0xFD,0xFF,0xFF,0xF4,0xB7,0xB3,0xEF,0x15,0x00,0xE5,
-  0x16,0x04,0xFE,0x1B,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x08,
-  0xFA,0x19,0x0A,0xF9,0x1C,0x06,0xFC,0x1D,0x0A,0xF7,0x12,0x08,0xF5,0x13,0x00,0xE6,
-  0xA8,0xA7,0xED,0xFF,0xFF,0xFA,0xC8,0xC8,0xEE,0x12,0x00,0xE2,0x12,0x0A,0xF1,0x1C,
-  0x0A,0xF7,0x1C,0x07,0xFA,0x1C,0x07,0xFB,0x1C,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1B,
-  0x08,0xF9,0x1C,0x09,0xFA,0x1E,0x06,0xFD,0x17,0x07,0xF7,0x18,0x0E,0xF5,0x14,0x0D,
-  0xF3,0x14,0x0C,0xF4,0x1A,0x09,0xFE,0x18,0x09,0xF6,0x19,0x0F,0xEF,0x1A,0x0C,0xF2,
-  0x1C,0x06,0xFE,0x1B,0x06,0xFD,0x18,0x09,0xF9,0x19,0x09,0xFA,0x19,0x09,0xFA,0x18,
-  0x09,0xFA,0x19,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xF9,0x17,0x00,0xFF,0x2B,0x1C,0xCB,0xEE,0xF4,0xFF,0xFD,0xFA,0xF6,0xFF,
-  0xFE,0xFD,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFE,0xFF,0xFB,0xFC,0xFD,0xF7,0xFC,0xFF,0xF7,0x89,0x87,0xE4,0x11,0x00,0xE2,
-  0x19,0x07,0xFC,0x1C,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x08,
-  0xFA,0x15,0x0A,0xFA,0x1C,0x08,0xFA,0x1F,0x09,0xF8,0x15,0x0A,0xF3,0x10,0x00,0xF6,
-  0x72,0x67,0xE4,0xFF,0xFF,0xFF,0x94,0x8D,0xDE,0x17,0x05,0xEF,0x11,0x07,0xFC,0x1C,
-  0x07,0xFA,0x1C,0x07,0xFB,0x1C,0x09,0xF8,0x1C,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1B,
-  0x09,0xFA,0x1C,0x08,0xF9,0x20,0x0A,0xF5,0x19,0x0B,0xF4,0x15,0x0C,0xF5,0x16,0x09,
-  0xF9,0x1D,0x07,0xFD,0x21,0x07,0xFA,0x1D,0x07,0xFB,0x18,0x07,0xFC,0x18,0x08,0xFB,
-  0x1F,0x09,0xF6,0x1C,0x09,0xF7,0x18,0x08,0xFA,0x18,0x09,0xF9,0x18,0x09,0xF9,0x18,
-  0x09,0xF9,0x19,0x09,0xF9,0x1C,0x08,0xFA,0x1C,0x08,0xFA,0x1C,0x08,0xFA,0x1C,0x08,
-  0xFA,0x1C,0x08,0xFA,0x1C,0x09,0xF9,0x1C,0x09,0xF9,0x1B,0x08,0xFA,0x1C,0x09,0xF9,
-  0x1B,0x09,0xFA,0x17,0x00,0xF8,0x50,0x49,0xCE,0xFC,0xFF,0xFF,0xFE,0xF9,0xF9,0xFE,
-  0xFD,0xFB,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFD,0xFE,0xF9,0xFE,0xFF,0xF8,0xFC,0xFF,0xFF,0x44,0x3C,0xD2,0x19,0x0A,0xEF,
-  0x1B,0x0A,0xF8,0x1C,0x08,0xF8,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x08,
-  0xFA,0x15,0x0B,0xF7,0x1B,0x0B,0xF6,0x23,0x05,0xFD,0x16,0x0C,0xF4,0x13,0x02,0xFD,
-  0x3C,0x2D,0xCE,0xFF,0xFD,0xFF,0x64,0x59,0xD3,0x13,0x06,0xE5,0x13,0x03,0xFF,0x1E,
-  0x07,0xFB,0x1B,0x08,0xFA,0x1C,0x0A,0xF6,0x1C,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1B,0x09,0xFA,0x1B,0x08,0xFA,0x16,0x08,0xFB,0x13,0x09,0xFC,0x18,0x09,
-  0xF9,0x21,0x08,0xF6,0x21,0x07,0xF8,0x1A,0x09,0xF9,0x12,0x09,0xFB,0x11,0x09,0xFC,
-  0x16,0x07,0xFD,0x19,0x09,0xFA,0x1A,0x09,0xF9,0x19,0x08,0xFB,0x19,0x07,0xFB,0x18,
-  0x07,0xFC,0x19,0x08,0xFB,0x1B,0x09,0xF8,0x1B,0x08,0xF9,0x1B,0x09,0xF9,0x1B,0x09,
-  0xF9,0x1B,0x09,0xF9,0x1B,0x09,0xFA,0x1B,0x07,0xFB,0x1C,0x0A,0xF8,0x1B,0x08,0xFA,
-  0x1A,0x08,0xFA,0x12,0x00,0xEC,0x88,0x8B,0xE8,0xFD,0xFF,0xFF,0xFA,0xF6,0xF5,0xFC,
-  0xFD,0xF9,0xFC,0xFE,0xFB,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFE,0xFE,0xFE,
-  0xFD,0xFD,0xFD,0xF8,0xFF,0xFF,0xF9,0xE3,0xE8,0xFF,0x0D,0x00,0xC4,0x18,0x0B,0xF5,
-  0x1B,0x09,0xF8,0x1C,0x08,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x08,
-  0xFA,0x15,0x0B,0xF6,0x1A,0x0A,0xF5,0x21,0x04,0xFF,0x18,0x0B,0xF5,0x12,0x05,0xF8,
-  0x1A,0x08,0xC0,0xF8,0xED,0xFF,0x33,0x30,0xE8,0x18,0x06,0xED,0x1C,0x07,0xFE,0x19,
-  0x0A,0xF7,0x18,0x0A,0xF7,0x1B,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xF9,0x1C,0x08,0xF9,0x1C,0x08,0xFA,0x1C,0x08,
-  0xFA,0x1B,0x09,0xF9,0x1B,0x08,0xFA,0x1B,0x09,0xFA,0x1C,0x08,0xF9,0x1C,0x08,0xF9,
-  0x1C,0x08,0xF9,0x1E,0x08,0xF8,0x1F,0x08,0xF9,0x1E,0x06,0xFC,0x1C,0x06,0xFD,0x1A,
-  0x08,0xFB,0x19,0x09,0xF8,0x18,0x0B,0xF6,0x18,0x0B,0xF6,0x18,0x0A,0xF7,0x18,0x0A,
-  0xF7,0x18,0x0A,0xF7,0x19,0x08,0xFB,0x1A,0x09,0xF8,0x1A,0x0A,0xF5,0x1B,0x08,0xFB,
-  0x17,0x09,0xF5,0x1F,0x0E,0xD0,0xD8,0xE6,0xFD,0xFB,0xFF,0xFD,0xFF,0xFB,0xFC,0xFC,
-  0xFE,0xF4,0xFB,0xFB,0xFD,0xFE,0xFE,0xFD,0xFF,0xFC,0xFD,0xFE,0xFD,0xFE,0xF9,0xFB,
-  0xF8,0xFD,0xFD,0xF4,0xFF,0xFF,0xFA,0x7A,0x74,0xDC,0x0E,0x00,0xEC,0x16,0x12,0xED,
-  0x18,0x08,0xFC,0x1C,0x08,0xFA,0x1C,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xF9,0x1B,0x07,0xFB,0x19,0x07,0xFB,0x19,0x0A,0xF8,0x1A,0x09,0xF6,0x19,0x09,0xF9,
-  0x0E,0x00,0xE3,0xD1,0xD5,0xFE,0x25,0x1C,0xE8,0x19,0x04,0xF3,0x1A,0x05,0xFD,0x1A,
-  0x0A,0xF7,0x18,0x0A,0xF7,0x1B,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xF9,0x1C,0x09,
-  0xFA,0x1B,0x09,0xFA,0x1B,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1B,0x09,0xF9,0x1C,0x06,0xFC,0x1E,0x07,0xFB,0x1E,0x0A,0xF5,0x1B,0x0D,0xF0,0x1C,
-  0x0F,0xED,0x1B,0x0D,0xF0,0x18,0x09,0xF8,0x18,0x0A,0xF8,0x19,0x08,0xF9,0x18,0x08,
-  0xFA,0x18,0x09,0xFB,0x1A,0x08,0xFB,0x18,0x11,0xEA,0x15,0x05,0xFE,0x19,0x0B,0xF8,
-  0x0F,0x01,0xE9,0x65,0x57,0xD8,0xFB,0xFF,0xFF,0xFD,0xFB,0xF9,0xFF,0xF9,0xFE,0xFE,
-  0xFE,0xF9,0xFB,0xFD,0xFA,0xFF,0xFF,0xFD,0xFF,0xFA,0xFF,0xFF,0xFC,0xFE,0xFE,0xFB,
-  0xFA,0xFD,0xFE,0xF9,0xED,0xED,0xFF,0x29,0x16,0xC9,0x18,0x06,0xF8,0x11,0x09,0xF4,
-  0x1A,0x08,0xFC,0x1C,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xF9,0x1B,0x08,0xFB,0x19,0x07,0xFB,0x19,0x0A,0xF8,0x19,0x09,0xF6,0x19,0x09,0xF8,
-  0x10,0x00,0xE6,0xB2,0xB8,0xEB,0x1D,0x0F,0xEA,0x1E,0x06,0xFD,0x1C,0x07,0xFE,0x19,
-  0x0A,0xF6,0x18,0x0A,0xF9,0x1B,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1B,0x08,0xFA,0x1C,0x09,0xF7,0x1C,0x0B,0xF5,0x1C,0x0A,0xF6,0x1B,0x08,0xF8,0x1D,
-  0x04,0xFE,0x1A,0x04,0xFD,0x16,0x09,0xF4,0x19,0x0B,0xF8,0x18,0x08,0xF9,0x18,0x08,
-  0xFB,0x19,0x09,0xFB,0x1D,0x07,0xFD,0x17,0x0D,0xF8,0x12,0x09,0xFA,0x18,0x07,0xF6,
-  0x16,0x07,0xCE,0xD7,0xCF,0xFF,0xFF,0xFF,0xF7,0xFF,0xFD,0xF9,0xFF,0xF8,0xFF,0xFF,
-  0xFF,0xFF,0xFB,0xFF,0xFC,0xFB,0xFA,0xFE,0xFF,0xF8,0xFF,0xFF,0xFF,0xF3,0xF9,0xFC,
-  0xEE,0xFC,0xFF,0xFF,0x7C,0x76,0xE2,0x16,0x00,0xEA,0x18,0x0A,0xFC,0x13,0x06,0xFB,
-  0x1D,0x08,0xFB,0x1B,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xF9,0x1A,0x09,0xFB,0x18,0x09,0xFB,0x18,0x0A,0xF9,0x18,0x09,0xF6,0x17,0x0A,0xF7,
-  0x12,0x00,0xEF,0x94,0x98,0xE5,0x1E,0x0D,0xEF,0x1D,0x04,0xFC,0x1C,0x07,0xFD,0x19,
-  0x0B,0xF4,0x18,0x09,0xF9,0x1B,0x08,0xFA,0x1C,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x08,0xFA,0x1B,0x0B,0xF5,0x1B,0x0A,0xF4,0x1B,0x07,0xFC,0x1C,0x04,0xFD,0x1A,
-  0x03,0xF8,0x17,0x05,0xF1,0x13,0x06,0xEF,0x19,0x0C,0xF6,0x1A,0x0B,0xF8,0x18,0x08,
-  0xFA,0x19,0x09,0xFA,0x22,0x06,0xFC,0x18,0x09,0xFF,0x11,0x09,0xF2,0x16,0x02,0xD5,
-  0x88,0x7C,0xE0,0xFF,0xFE,0xFF,0xFD,0xFC,0xF6,0xFE,0xFE,0xFC,0xFE,0xFE,0xFF,0xFD,
-  0xFE,0xFE,0xFC,0xFE,0xFE,0xFC,0xF9,0xFF,0xFF,0xFD,0xFC,0xFC,0xFE,0xEB,0xF6,0xFD,
-  0xFD,0xC4,0xC4,0xFA,0x16,0x07,0xCE,0x19,0x03,0xFE,0x12,0x0A,0xF8,0x18,0x08,0xFD,
-  0x1D,0x07,0xFC,0x1C,0x09,0xF9,0x1B,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xF9,0x1B,0x07,0xFB,0x19,0x07,0xFB,0x1A,0x0A,0xF8,0x1A,0x0A,0xF6,0x18,0x08,0xF6,
-  0x12,0x00,0xF4,0x79,0x7F,0xDD,0x1D,0x0A,0xEE,0x21,0x0A,0xFF,0x19,0x06,0xF9,0x1A,
-  0x0C,0xF3,0x18,0x08,0xFB,0x1B,0x07,0xFB,0x1C,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xF9,0x1B,0x08,0xFB,0x19,0x06,0xFF,0x1C,0x05,0xFF,0x16,0x06,0xEA,0x25,
-  0x24,0xD6,0x2A,0x2D,0xD7,0x06,0x00,0xE6,0x15,0x08,0xF4,0x16,0x09,0xF5,0x18,0x0B,
-  0xF7,0x19,0x09,0xFA,0x24,0x07,0xF8,0x19,0x0F,0xEF,0x0F,0x00,0xF1,0x42,0x33,0xCE,
-  0xFC,0xFC,0xFF,0xF8,0xF9,0xEF,0xF8,0xF8,0xFE,0xF9,0xFF,0xFE,0xFA,0xFF,0xFA,0xFB,
-  0xFF,0xFE,0xFC,0xFF,0xFC,0xFE,0xFE,0xFF,0xFF,0xFF,0xFC,0xFE,0xFF,0xF8,0xE9,0xE8,
-  0xFF,0x33,0x21,0xBC,0x10,0x00,0xF3,0x17,0x0C,0xFB,0x10,0x0D,0xF5,0x17,0x09,0xF8,
-  0x20,0x06,0xFC,0x1D,0x09,0xF9,0x1B,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xF9,0x1A,0x07,0xFB,0x19,0x07,0xFB,0x19,0x09,0xF9,0x19,0x0A,0xF7,0x18,0x08,0xF5,
-  0x13,0x00,0xF7,0x69,0x75,0xCB,0x1A,0x0A,0xFA,0x18,0x08,0xF9,0x17,0x07,0xF9,0x19,
-  0x09,0xF9,0x18,0x08,0xFA,0x1B,0x09,0xF9,0x1C,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x08,0xFA,0x18,0x09,0xF7,0x16,0x0A,0xF8,0x14,0x03,0xF3,0x41,0x3C,0xD1,0xEA,
-  0xEE,0xFD,0xFF,0xFE,0xFF,0x92,0x90,0xE5,0x22,0x0E,0xCC,0x15,0x01,0xF0,0x16,0x09,
-  0xF6,0x14,0x08,0xF2,0x22,0x0E,0xEF,0x0E,0x00,0xED,0x2E,0x1E,0xD6,0xE4,0xDD,0xFF,
-  0xFF,0xFF,0xFA,0xFC,0xFF,0xF1,0xFB,0xFD,0xFE,0xFD,0xF8,0xFF,0xFF,0xFF,0xFB,0xFF,
-  0xFF,0xF7,0xF9,0xFC,0xF9,0xFB,0xFB,0xFA,0xF8,0xF5,0xF1,0xF5,0xF2,0xFF,0x42,0x37,
-  0xC6,0x18,0x00,0xEF,0x1C,0x09,0xFD,0x1A,0x08,0xF9,0x1B,0x08,0xF8,0x1B,0x09,0xF9,
-  0x1C,0x08,0xF9,0x1B,0x09,0xF9,0x1B,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xF9,0x1C,0x07,0xFB,0x1C,0x07,0xFB,0x1C,0x09,0xF8,0x1C,0x08,0xF6,0x1D,0x0B,0xF9,
-  0x15,0x02,0xF4,0x63,0x60,0xCE,0x1A,0x0A,0xFB,0x18,0x09,0xF9,0x17,0x07,0xF8,0x19,
-  0x09,0xFA,0x18,0x09,0xF9,0x1B,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1B,0x08,0xFA,0x1D,0x09,0xF3,0x22,0x07,0xFF,0x1A,0x00,0xF1,0x97,0x92,0xF2,0xFF,
-  0xFF,0xFF,0xFF,0xF9,0xF6,0xFE,0xFF,0xFA,0xEA,0xED,0xFF,0x6D,0x66,0xDE,0x14,0x00,
-  0xD1,0x1B,0x00,0xF6,0x10,0x05,0xF8,0x1C,0x09,0xE5,0xC9,0xC6,0xFC,0xFF,0xFF,0xEC,
-  0xFE,0xFD,0xF4,0xFA,0xFB,0xFF,0xF9,0xFE,0xEE,0xFC,0xFF,0xEB,0xFF,0xFC,0xFF,0xFF,
-  0xFB,0xFE,0xFF,0xFF,0xF1,0xFF,0xFF,0xF1,0xEA,0xE6,0xFF,0x3F,0x2A,0xD3,0x14,0x00,
-  0xF3,0x14,0x0B,0xF6,0x1B,0x07,0xF9,0x1D,0x0A,0xFB,0x1D,0x09,0xFB,0x1B,0x08,0xF9,
-  0x1B,0x09,0xF9,0x1B,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xF9,0x1C,0x07,0xFB,0x1C,0x07,0xFB,0x1C,0x09,0xF8,0x1B,0x08,0xF6,0x1C,0x0A,0xF8,
-  0x16,0x02,0xF4,0x65,0x61,0xD0,0x19,0x09,0xFA,0x19,0x09,0xFA,0x18,0x08,0xF9,0x19,
-  0x09,0xFA,0x18,0x09,0xFA,0x1B,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x08,0xFA,0x1A,0x09,0xF6,0x19,0x0D,0xEF,0x1C,0x0B,0xF5,0x17,0x00,0xD8,0x7A,
-  0x72,0xDA,0xFE,0xFF,0xFF,0xFF,0xFF,0xF1,0xFF,0xFF,0xF0,0xFF,0xFF,0xFA,0xD4,0xD6,
-  0xFF,0x50,0x3F,0xCE,0x10,0x00,0xE1,0x20,0x0F,0xDF,0x99,0x99,0xF0,0xFA,0xFF,0xFF,
-  0xFF,0xFF,0xFB,0xFE,0xF6,0xFC,0xFF,0xFA,0xFA,0xFE,0xF8,0xF5,0xFF,0xFC,0xFB,0xFC,
-  0xFE,0xF5,0xFF,0xFF,0xFF,0xC2,0xBE,0xF6,0x2A,0x1A,0xC8,0x18,0x07,0xEF,0x14,0x06,
-  0xFA,0x15,0x05,0xFE,0x1D,0x09,0xFA,0x1B,0x08,0xF9,0x1B,0x08,0xF9,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xF9,0x1C,0x07,0xFB,0x1C,0x07,0xFB,0x1C,0x09,0xF9,0x1B,0x08,0xF6,0x1E,0x0C,0xFA,
-  0x17,0x04,0xF5,0x63,0x5E,0xCE,0x18,0x08,0xF9,0x19,0x08,0xFA,0x19,0x09,0xFA,0x18,
-  0x08,0xFA,0x18,0x09,0xFA,0x1B,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x08,0xF9,0x16,0x08,0xFC,0x0E,0x0D,0xF6,0x0E,0x10,0xEF,0x14,0x06,0xFF,0x0E,
-  0x00,0xE5,0x59,0x57,0xDA,0xFA,0xF3,0xFF,0xFD,0xFE,0xF3,0xFF,0xFE,0xE8,0xFA,0xFC,
-  0xF9,0xFB,0xFF,0xFF,0xA1,0x97,0xED,0x26,0x11,0xCD,0x02,0x00,0xE6,0x51,0x55,0xD9,
-  0xEE,0xF0,0xFF,0xFD,0xFF,0xEA,0xFB,0xFA,0xF0,0xFD,0xFB,0xF4,0xFF,0xFF,0xFA,0xE1,
-  0xE5,0xFF,0x67,0x62,0xE3,0x15,0x05,0xD6,0x18,0x09,0xF3,0x17,0x0A,0xF5,0x1F,0x0A,
-  0xF6,0x22,0x09,0xF4,0x1B,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xF9,0x1C,0x07,0xFB,0x1C,0x07,0xFB,0x1C,0x09,0xF8,0x1B,0x08,0xF7,0x1D,0x0B,0xF8,
-  0x14,0x01,0xF3,0x62,0x62,0xD0,0x18,0x09,0xFA,0x19,0x08,0xFA,0x18,0x09,0xFA,0x18,
-  0x08,0xFA,0x18,0x09,0xF9,0x1B,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1B,0x08,0xFA,0x1E,0x0A,0xF7,0x1C,0x05,0xFE,0x19,0x0D,0xF2,0x16,0x0B,0xF2,0x17,
-  0x03,0xFF,0x13,0x01,0xE9,0x47,0x3C,0xD2,0xEE,0xF1,0xFF,0xFF,0xFF,0xEC,0xFF,0xFB,
-  0xF3,0xF8,0xF7,0xFC,0xFF,0xFF,0xFF,0xEA,0xE7,0xFD,0x4B,0x43,0xD2,0x02,0x00,0xD6,
-  0x28,0x18,0xCE,0xC8,0xC4,0xF2,0xFA,0xF9,0xFF,0xD3,0xD1,0xF5,0x6E,0x64,0xDB,0x19,
-  0x09,0xDD,0x0C,0x00,0xF1,0x18,0x0D,0xF6,0x15,0x06,0xF7,0x1A,0x04,0xFF,0x1E,0x08,
-  0xF8,0x1F,0x09,0xF7,0x1B,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xF9,0x1C,0x07,0xFB,0x1C,0x07,0xFB,0x1B,0x09,0xF9,0x1D,0x0A,0xF8,0x19,0x07,0xF5,
-  0x11,0x00,0xF1,0x68,0x6C,0xDB,0x1B,0x07,0xF8,0x16,0x0C,0xEE,0x1A,0x07,0xF8,0x1E,
-  0x0A,0xF7,0x17,0x07,0xFB,0x1A,0x0A,0xF8,0x1C,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1B,0x08,0xFA,0x1D,0x09,0xF8,0x1E,0x07,0xFA,0x1D,0x09,0xF9,0x1B,0x08,0xF7,0x1C,
-  0x07,0xFC,0x17,0x0B,0xF4,0x0D,0x03,0xEB,0x53,0x3E,0xE0,0xFC,0xFA,0xFF,0xFE,0xFF,
-  0xED,0xFD,0xF8,0xFC,0xF5,0xF9,0xFD,0xFE,0xFA,0xFC,0xFF,0xFF,0xFF,0x91,0x88,0xEA,
-  0x19,0x00,0xDA,0x17,0x06,0xE2,0x30,0x26,0xE6,0x0F,0x00,0xD7,0x17,0x00,0xF3,0x17,
-  0x07,0xF7,0x19,0x09,0xFC,0x18,0x06,0xF7,0x1D,0x0A,0xFB,0x1B,0x08,0xFB,0x1B,0x06,
-  0xFD,0x1B,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xF9,0x1C,0x07,0xFB,0x1C,0x07,0xFB,0x1B,0x09,0xF8,0x1D,0x09,0xF6,0x1B,0x08,0xF7,
-  0x19,0x00,0xF7,0x7F,0x81,0xE3,0x22,0x0C,0xF6,0x18,0x0A,0xF3,0x1B,0x06,0xFB,0x20,
-  0x09,0xF6,0x18,0x08,0xFB,0x19,0x0A,0xF7,0x1C,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1B,0x08,0xFA,0x1B,0x09,0xF9,0x1B,0x08,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xF9,0x1A,0x08,0xFB,0x19,0x0A,0xF8,0x18,0x07,0xD8,0x66,0x60,0xD2,0xF9,0xFF,
-  0xFF,0xFE,0xFB,0xFA,0xFC,0xFF,0xFF,0xFF,0xFC,0xF8,0xFC,0xFF,0xE8,0xFA,0xFF,0xFA,
-  0xC0,0xC1,0xF9,0x2B,0x17,0xD5,0x13,0x00,0xE5,0x16,0x0D,0xFA,0x13,0x0C,0xF5,0x19,
-  0x08,0xFB,0x1D,0x0A,0xF4,0x1C,0x09,0xFA,0x1B,0x08,0xF9,0x1C,0x09,0xF9,0x1C,0x09,
-  0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xF9,0x1C,0x07,0xFB,0x1C,0x08,0xFA,0x1B,0x09,0xF9,0x1D,0x07,0xF6,0x1C,0x08,0xF6,
-  0x12,0x00,0xEC,0x9B,0x9F,0xEC,0x2A,0x16,0xE8,0x1D,0x07,0xFE,0x18,0x06,0xFB,0x1D,
-  0x08,0xF9,0x18,0x09,0xF9,0x1A,0x09,0xF9,0x1C,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1B,
-  0x09,0xF9,0x1D,0x08,0xFA,0x1A,0x07,0xF4,0x15,0x0D,0xFD,0x02,0x00,0xDD,0x81,0x82,
-  0xDE,0xFF,0xFF,0xFF,0xFF,0xF6,0xFE,0xFD,0xF7,0xFF,0xF9,0xFA,0xF5,0xF8,0xFD,0xED,
-  0xFE,0xFF,0xF2,0xE1,0xD9,0xFF,0x3A,0x20,0xD7,0x0C,0x05,0xEB,0x0B,0x0E,0xF2,0x16,
-  0x0B,0xF5,0x1E,0x06,0xFD,0x1B,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xF9,0x1A,0x08,0xFA,0x1C,0x09,0xF9,0x1B,0x09,0xFA,0x1C,0x07,0xF6,0x1C,0x08,0xF6,
-  0x10,0x00,0xE0,0xB5,0xBE,0xEC,0x50,0x41,0xDF,0x1A,0x00,0xFB,0x1A,0x0B,0xFA,0x1B,
-  0x08,0xFA,0x1A,0x08,0xFA,0x1B,0x08,0xF9,0x1C,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1B,
-  0x08,0xFA,0x1E,0x0A,0xF6,0x1C,0x09,0xF9,0x0B,0x02,0xFF,0x0A,0x03,0xFF,0x14,0x06,
-  0xCE,0xB8,0xBA,0xF1,0xFF,0xFF,0xFB,0xF9,0xFD,0xF3,0xFC,0xFC,0xFD,0xFF,0xF8,0xFF,
-  0xFF,0xFB,0xFF,0xFF,0xFF,0xFA,0xEB,0xF1,0xFF,0x3E,0x35,0xE1,0x0B,0x00,0xE9,0x18,
-  0x07,0xFD,0x1A,0x06,0xFA,0x1C,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1B,0x09,0xF9,0x1C,0x09,0xFA,0x1B,0x08,0xFA,0x1C,0x06,0xF7,0x1C,0x0A,0xF4,
-  0x13,0x00,0xD3,0xDF,0xE9,0xFD,0x78,0x72,0xD9,0x14,0x00,0xF1,0x17,0x0E,0xF3,0x19,
-  0x08,0xFC,0x1C,0x06,0xFD,0x1C,0x07,0xFB,0x1C,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xF9,0x1C,0x09,0xF9,0x1C,0x09,0xF9,0x1C,0x09,0xF9,
-  0x1C,0x09,0xF9,0x1C,0x09,0xF9,0x1C,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x08,0xFA,0x1C,
-  0x08,0xFA,0x1B,0x09,0xF8,0x16,0x0C,0xF5,0x14,0x07,0xFA,0x18,0x03,0xFF,0x1C,0x07,
-  0xF2,0x28,0x21,0xCD,0xF3,0xF3,0xFF,0xF5,0xFD,0xF2,0xFD,0xFF,0xF2,0xFE,0xFB,0xFF,
-  0xFB,0xFD,0xFD,0xFD,0xFE,0xF7,0xFA,0xFF,0xEC,0xEA,0xEB,0xFF,0x3A,0x23,0xD2,0x17,
-  0x06,0xED,0x19,0x07,0xFD,0x1C,0x08,0xFA,0x1C,0x09,0xF9,0x1C,0x09,0xF9,0x1C,0x08,
-  0xFB,0x1C,0x08,0xFA,0x1C,0x08,0xFA,0x1C,0x08,0xFA,0x1C,0x08,0xFA,0x1C,0x08,0xF9,
-  0x1C,0x08,0xFB,0x1C,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xF8,0x1B,0x09,0xFA,0x1B,0x07,0xFC,0x1C,0x07,0xF7,0x18,0x06,0xF1,
-  0x1C,0x08,0xD3,0xF4,0xFD,0xF5,0xA4,0xA4,0xE2,0x19,0x00,0xEB,0x15,0x09,0xF7,0x18,
-  0x0B,0xF6,0x1C,0x08,0xFA,0x1C,0x06,0xFC,0x1C,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xF9,0x17,0x07,0xFD,0x17,0x07,0xFD,0x19,0x07,0xFC,0x1A,0x07,0xFC,
-  0x1B,0x06,0xFD,0x1B,0x07,0xFC,0x1A,0x08,0xFB,0x1A,0x09,0xFA,0x1A,0x09,0xF8,0x1A,
-  0x0A,0xF6,0x19,0x09,0xF7,0x15,0x0B,0xF6,0x19,0x0B,0xF3,0x1A,0x05,0xFB,0x1B,0x0A,
-  0xF4,0x10,0x01,0xED,0x74,0x6A,0xDF,0xFC,0xFD,0xFF,0xFF,0xFE,0xF5,0xFA,0xFD,0xFC,
-  0xF9,0xFF,0xF8,0xF9,0xFF,0xFC,0xFD,0xFA,0xFC,0xFF,0xFF,0xF7,0xD9,0xDC,0xFA,0x1D,
-  0x0F,0xCB,0x18,0x05,0xF8,0x1C,0x0B,0xF5,0x1B,0x08,0xFA,0x1A,0x06,0xFD,0x18,0x0F,
-  0xED,0x17,0x0A,0xF6,0x17,0x07,0xF7,0x14,0x04,0xF5,0x1A,0x0B,0xFA,0x19,0x0A,0xFC,
-  0x18,0x0E,0xEE,0x1B,0x09,0xF9,0x1C,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xF9,0x1B,0x08,0xFB,0x1C,0x09,0xF7,0x1E,0x0A,0xF5,0x1D,0x06,0xFF,0x12,0x06,0xE4,
-  0x49,0x3C,0xE5,0xFE,0xFF,0xF6,0xDD,0xE0,0xFC,0x14,0x00,0xD5,0x18,0x04,0xFF,0x19,
-  0x0B,0xF4,0x1C,0x0B,0xF4,0x1C,0x07,0xFC,0x1C,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x08,0xFA,0x1B,0x09,0xF6,0x1B,0x0A,0xF5,0x1D,0x09,0xF7,0x1D,0x09,0xF6,
-  0x1E,0x08,0xF9,0x1D,0x09,0xF5,0x1C,0x0B,0xF4,0x1E,0x08,0xF9,0x1F,0x06,0xFC,0x1E,
-  0x05,0xFD,0x1B,0x07,0xFC,0x18,0x08,0xFA,0x18,0x09,0xF8,0x19,0x0B,0xF7,0x18,0x0A,
-  0xF6,0x14,0x07,0xF6,0x15,0x08,0xC9,0xDB,0xD6,0xFB,0xFE,0xFC,0xF4,0xF6,0xF7,0xF7,
-  0xFD,0xFE,0xFA,0xFC,0xFE,0xF9,0xFF,0xFA,0xFF,0xFF,0xFD,0xF7,0xFA,0xFF,0xF7,0xA7,
-  0xA5,0xEF,0x17,0x06,0xD8,0x1A,0x0D,0xF1,0x17,0x05,0xFB,0x18,0x09,0xFA,0x19,0x0F,
-  0xEA,0x16,0x04,0xE6,0x26,0x14,0xDD,0x2D,0x24,0xDB,0x0D,0x00,0xE3,0x16,0x04,0xFA,
-  0x13,0x09,0xF6,0x1B,0x09,0xFA,0x1C,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xF9,0x19,0x08,0xFB,0x1C,0x0A,0xF7,0x1E,0x0C,0xF2,0x1A,0x04,0xFF,0x10,0x02,0xDE,
-  0x77,0x73,0xE4,0xFF,0xFF,0xFF,0xFC,0xFF,0xFF,0x2D,0x19,0xD3,0x17,0x02,0xFD,0x19,
-  0x07,0xFC,0x19,0x0B,0xF5,0x1C,0x08,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1B,0x09,0xF9,0x22,0x05,0xFD,0x21,0x05,0xFD,0x1E,0x07,0xFA,0x1C,0x0A,0xF7,
-  0x1A,0x0C,0xF4,0x18,0x0B,0xF6,0x1B,0x08,0xFA,0x1F,0x06,0xFC,0x20,0x06,0xFD,0x1D,
-  0x09,0xF7,0x19,0x0B,0xF5,0x19,0x0A,0xF8,0x18,0x09,0xF8,0x18,0x0A,0xF7,0x17,0x09,
-  0xF5,0x12,0x05,0xF2,0x15,0x00,0xEF,0x68,0x5B,0xD9,0xFE,0xFF,0xFF,0xFC,0xFA,0xFC,
-  0xFF,0xFC,0xFD,0xFE,0xFD,0xFE,0xFF,0xF8,0xFF,0xFF,0xFC,0xF7,0xF7,0xFE,0xE6,0xF7,
-  0xFE,0xFF,0x64,0x5C,0xE0,0x13,0x03,0xEC,0x15,0x07,0xFB,0x16,0x0D,0xEB,0x21,0x07,
-  0xE5,0x83,0x76,0xEC,0xED,0xEF,0xFB,0xEC,0xF4,0xF9,0xA3,0x9F,0xF3,0x1B,0x07,0xDB,
-  0x14,0x03,0xFE,0x1B,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x08,
-  0xFA,0x19,0x0A,0xF6,0x1A,0x08,0xFB,0x1A,0x09,0xF8,0x18,0x06,0xFC,0x16,0x00,0xE5,
-  0xB4,0xB4,0xF6,0xFB,0xFF,0xFB,0xFF,0xFF,0xFF,0x66,0x5F,0xD8,0x17,0x04,0xEF,0x1B,
-  0x08,0xFF,0x17,0x08,0xF5,0x1B,0x0A,0xF8,0x1C,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x08,0xFA,0x16,0x0B,0xF2,0x15,0x0B,0xF5,0x14,0x09,0xFA,0x12,0x05,0xFA,
-  0x10,0x05,0xF9,0x0E,0x03,0xF8,0x11,0x01,0xF8,0x17,0x04,0xF7,0x16,0x03,0xF8,0x13,
-  0x07,0xFD,0x12,0x09,0xFE,0x15,0x06,0xF2,0x1A,0x0C,0xF8,0x17,0x09,0xF6,0x18,0x09,
-  0xF7,0x18,0x09,0xF8,0x14,0x03,0xFF,0x20,0x13,0xCF,0xE0,0xE8,0xFF,0xF9,0xFB,0xF1,
-  0xFF,0xFE,0xFA,0xFD,0xFD,0xF9,0xFF,0xFB,0xFF,0xFF,0xFB,0xFD,0xFF,0xFF,0xF5,0xFD,
-  0xFE,0xF7,0xD9,0xD9,0xFF,0x20,0x0B,0xDC,0x0F,0x03,0xFC,0x10,0x02,0xF5,0x4E,0x3E,
-  0xD2,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xFA,0xF6,0xFF,0xFF,0xFF,0x69,0x66,0xDE,
-  0x12,0x05,0xEC,0x1B,0x09,0xFB,0x1C,0x09,0xFA,0x1A,0x07,0xF8,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x08,
-  0xFA,0x1A,0x0A,0xF6,0x19,0x07,0xFD,0x17,0x09,0xFC,0x16,0x07,0xF8,0x26,0x07,0xD8,
-  0xF1,0xF0,0xFF,0xFC,0xFB,0xF9,0xFF,0xFF,0xF9,0xAC,0xB2,0xEE,0x10,0x01,0xD8,0x19,
-  0x08,0xFB,0x17,0x09,0xFB,0x1B,0x09,0xF8,0x1C,0x08,0xFA,0x1C,0x08,0xFA,0x1C,0x08,
-  0xFA,0x1C,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xF9,0x1B,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x08,
-  0xFA,0x1C,0x08,0xFA,0x15,0x0A,0xFA,0x17,0x09,0xFA,0x14,0x02,0xEB,0x1C,0x06,0xDD,
-  0x3B,0x23,0xE5,0x56,0x44,0xE9,0x58,0x4D,0xDE,0x57,0x4A,0xD8,0x37,0x29,0xCF,0x10,
-  0x03,0xCF,0x12,0x06,0xEE,0x18,0x0B,0xFA,0x16,0x08,0xF4,0x19,0x0A,0xF8,0x19,0x09,
-  0xF8,0x17,0x09,0xF9,0x13,0x08,0xFB,0x0C,0x01,0xDF,0x98,0x95,0xEF,0xFE,0xFF,0xF1,
-  0xFE,0xFE,0xFA,0xFC,0xFF,0xFA,0xFC,0xFE,0xFE,0xFB,0xFC,0xFF,0xFE,0xFE,0xFF,0xFF,
-  0xFF,0xFA,0xFF,0xFF,0xFE,0x6B,0x59,0xE0,0x0C,0x00,0xF5,0x09,0x00,0xFA,0x83,0x78,
-  0xE6,0xFF,0xFF,0xFE,0xF6,0xFE,0xE0,0xFF,0xF8,0xF3,0xFF,0xFF,0xFD,0x8F,0x8E,0xE9,
-  0x10,0x00,0xF6,0x1D,0x09,0xFC,0x1C,0x09,0xFA,0x1A,0x07,0xF8,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xF9,0x1A,0x08,0xFB,0x18,0x09,0xFA,0x12,0x0A,0xFA,0x0F,0x00,0xF7,0x5F,0x4C,0xD9,
-  0xFF,0xFF,0xFB,0xF8,0xF5,0xF3,0xFF,0xFF,0xF3,0xE6,0xF1,0xFF,0x23,0x18,0xD5,0x14,
-  0x05,0xF2,0x18,0x09,0xFB,0x1A,0x09,0xF9,0x1B,0x09,0xF9,0x1B,0x09,0xF9,0x1B,0x09,
-  0xF9,0x1A,0x09,0xF9,0x1B,0x08,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1B,0x09,0xF9,0x1A,0x08,0xFA,0x1D,0x09,0xF8,0x1B,0x08,0xF8,0x1A,0x0A,
-  0xF8,0x19,0x08,0xF8,0x1C,0x03,0xF9,0x1C,0x06,0xD4,0x75,0x68,0xE6,0xD4,0xCF,0xFD,
-  0xFD,0xFF,0xFD,0xFF,0xFF,0xF9,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xF3,0xF0,0xFF,0xC3,
-  0xBD,0xFD,0x4F,0x45,0xD4,0x12,0x04,0xEB,0x19,0x08,0xFB,0x16,0x0B,0xF6,0x18,0x0C,
-  0xF5,0x1A,0x07,0xFC,0x13,0x0A,0xF5,0x0D,0x03,0xEB,0x56,0x49,0xE2,0xFE,0xFF,0xF8,
-  0xFB,0xFC,0xFA,0xFC,0xFE,0xFF,0xFD,0xFF,0xFF,0xF9,0xFE,0xFF,0xF8,0xFC,0xFE,0xF5,
-  0xFA,0xF2,0xFF,0xFF,0xF5,0xB7,0xAD,0xEF,0x0D,0x00,0xEA,0x08,0x02,0xF5,0x53,0x42,
-  0xD6,0xFF,0xFF,0xFF,0xF2,0xFF,0xE8,0xFF,0xFF,0xF1,0xFF,0xFF,0xFF,0x6F,0x63,0xE3,
-  0x12,0x04,0xE6,0x1C,0x09,0xFB,0x1C,0x09,0xFA,0x1A,0x07,0xF8,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xF9,0x1C,0x06,0xFF,0x15,0x07,0xF9,0x0F,0x0C,0xF7,0x07,0x00,0xEB,0xAC,0xA5,0xF0,
-  0xFF,0xFF,0xF5,0xFE,0xFB,0xFA,0xFA,0xFF,0xFB,0xFF,0xFF,0xFF,0x6D,0x61,0xD9,0x11,
-  0x00,0xED,0x19,0x0C,0xF3,0x16,0x07,0xF6,0x19,0x0A,0xF7,0x18,0x0A,0xF7,0x18,0x0A,
-  0xF7,0x18,0x0A,0xF7,0x1B,0x08,0xF8,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1B,0x08,0xFA,0x14,0x0A,0xFA,0x22,0x0B,0xF1,0x1E,0x09,0xFB,0x10,0x09,
-  0xF5,0x13,0x01,0xF1,0x2F,0x16,0xCF,0xC0,0xB9,0xF8,0xFF,0xFF,0xFD,0xFF,0xFF,0xFB,
-  0xFF,0xFE,0xFD,0xFE,0xFF,0xFA,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFD,0xFE,0xFC,0xFF,0x5B,0x51,0xCC,0x1D,0x04,0xF1,0x10,0x07,0xF6,0x17,0x10,
-  0xED,0x22,0x06,0xFC,0x1B,0x06,0xFC,0x11,0x0D,0xF0,0x25,0x1D,0xC9,0xEF,0xF7,0xFB,
-  0xFF,0xFF,0xFD,0xFE,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xF8,0xEA,0xE9,0xFF,0x1F,0x0D,0xD3,0x11,0x04,0xFD,0x16,0x06,
-  0xDB,0x92,0x8C,0xE5,0xEE,0xF7,0xFD,0xED,0xF8,0xFB,0xA6,0xA6,0xEF,0x20,0x10,0xD0,
-  0x1A,0x06,0xF9,0x1B,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1B,0x09,
-  0xF9,0x1E,0x07,0xFC,0x19,0x0B,0xFE,0x10,0x0A,0xF7,0x20,0x10,0xCB,0xF1,0xF4,0xFF,
-  0xFF,0xFF,0xFA,0xFF,0xFF,0xFF,0xFD,0xFB,0xFA,0xFF,0xFF,0xFA,0xC6,0xC7,0xF7,0x14,
-  0x00,0xDC,0x16,0x06,0xFA,0x1A,0x0A,0xFB,0x18,0x0A,0xF7,0x19,0x0A,0xF8,0x18,0x0A,
-  0xF8,0x18,0x0A,0xF7,0x1B,0x08,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1B,0x08,0xFA,0x17,0x0A,0xF9,0x20,0x0A,0xF4,0x1A,0x07,0xFD,0x14,0x07,
-  0xFE,0x15,0x01,0xDE,0xB8,0xB3,0xF7,0xF9,0xFF,0xFD,0xF9,0xFD,0xE6,0xFF,0xFC,0xF5,
-  0xFC,0xF9,0xFD,0xFC,0xFE,0xFD,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFC,0xFD,0xFD,0xFA,
-  0xFA,0xFB,0xF6,0xFB,0xF1,0xEC,0xF7,0xFF,0x2C,0x1D,0xCD,0x16,0x03,0xFB,0x1A,0x0C,
-  0xF8,0x20,0x0A,0xF5,0x1C,0x0C,0xF8,0x0D,0x03,0xF7,0x22,0x0E,0xDC,0xE9,0xEB,0xFF,
-  0xFF,0xFF,0xFA,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xF9,0xFF,0xFF,0xFF,0x2F,0x23,0xCC,0x0B,0x03,0xFD,0x16,0x0C,
-  0xF0,0x1C,0x05,0xDB,0x29,0x1B,0xE3,0x2F,0x24,0xD9,0x16,0x07,0xD3,0x18,0x07,0xEC,
-  0x19,0x0D,0xF4,0x1A,0x08,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x08,
-  0xFA,0x1C,0x09,0xF7,0x14,0x09,0xFA,0x0E,0x00,0xEC,0x6F,0x70,0xD1,0xFF,0xFF,0xFF,
-  0xFE,0xFD,0xF9,0xFF,0xFF,0xFF,0xFF,0xFB,0xFE,0xFC,0xFF,0xEA,0xFC,0xFF,0xFF,0x48,
-  0x37,0xCE,0x15,0x03,0xF5,0x17,0x09,0xFA,0x18,0x09,0xF7,0x18,0x09,0xF7,0x19,0x0A,
-  0xF8,0x18,0x0A,0xF7,0x1B,0x08,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1B,0x09,0xF9,0x19,0x07,0xFC,0x20,0x08,0xF8,0x18,0x09,0xF9,0x13,0x08,
-  0xEE,0x59,0x50,0xD8,0xFE,0xFF,0xFF,0xF9,0xFC,0xEA,0xFF,0xFF,0xF1,0xFF,0xFA,0xFE,
-  0xFE,0xFB,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFC,0xF9,
-  0xFA,0xF7,0xFD,0xFF,0xF1,0xFF,0xFF,0xF9,0x82,0x7B,0xE5,0x13,0x00,0xEB,0x18,0x08,
-  0xF9,0x1E,0x08,0xF9,0x1D,0x0E,0xF5,0x10,0x02,0xFF,0x19,0x00,0xE2,0xDC,0xDA,0xFB,
-  0xFF,0xFF,0xF9,0xFE,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xF9,0xFF,0xFF,0xFF,0xFF,0x3E,0x31,0xD0,0x09,0x00,0xFA,0x11,0x0E,
-  0xF4,0x17,0x00,0xFF,0x0E,0x00,0xF4,0x11,0x05,0xF2,0x1B,0x0A,0xFE,0x1C,0x09,0xFA,
-  0x1C,0x0F,0xEA,0x1C,0x09,0xFA,0x1B,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x08,
-  0xFA,0x17,0x09,0xF6,0x18,0x07,0xFB,0x10,0x00,0xD0,0xD7,0xE1,0xF7,0xFE,0xFF,0xF6,
-  0xFE,0xFB,0xFF,0xFF,0xFF,0xFF,0xFD,0xFA,0xF7,0xFB,0xFB,0xF4,0xFF,0xFF,0xFD,0xBC,
-  0xB8,0xEA,0x12,0x02,0xD8,0x15,0x09,0xF6,0x1A,0x0B,0xFA,0x18,0x09,0xF7,0x19,0x09,
-  0xF8,0x18,0x0A,0xF7,0x1B,0x08,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1B,0x07,0xFB,0x1D,0x08,0xF9,0x15,0x0A,0xF7,0x12,0x05,
-  0xE3,0xA8,0xA4,0xEC,0xFF,0xFF,0xFD,0xFF,0xFE,0xFA,0xFF,0xFC,0xFE,0xFF,0xFA,0xFF,
-  0xFD,0xFD,0xFE,0xFD,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,0xFF,
-  0xFF,0xFE,0xFF,0xFD,0xFD,0xFF,0xFF,0xFF,0xA2,0xA2,0xEE,0x13,0x00,0xE8,0x15,0x06,
-  0xF8,0x1A,0x08,0xFA,0x1A,0x08,0xF6,0x13,0x07,0xFF,0x1C,0x03,0xDE,0xE0,0xDE,0xFE,
-  0xFF,0xFF,0xFC,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0x3E,0x2A,0xCF,0x15,0x04,0xFF,0x11,0x0C,
-  0xF1,0x1B,0x05,0xFB,0x1F,0x09,0xED,0x1D,0x10,0xF0,0x17,0x07,0xF9,0x1D,0x02,0xFD,
-  0x22,0x07,0xFA,0x1C,0x09,0xF9,0x1B,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x08,0xFA,0x1C,0x09,0xF9,0x1C,0x09,
-  0xFA,0x18,0x07,0xFA,0x14,0x04,0xE9,0x5B,0x56,0xD1,0xFF,0xFF,0xFF,0xFF,0xFD,0xF8,
-  0xFD,0xFC,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xF5,0xF9,0xF6,0xFE,0xFA,0xF0,0xF3,0xFC,
-  0xFF,0xF8,0x3E,0x3C,0xD8,0x0F,0x01,0xF4,0x1B,0x0C,0xFB,0x18,0x09,0xF8,0x18,0x0A,
-  0xF7,0x18,0x0A,0xF7,0x1A,0x08,0xF8,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1B,0x08,0xF9,0x1F,0x0B,0xF4,0x1C,0x08,0xF7,0x13,0x09,0xFB,0x10,0x00,
-  0xEA,0xB9,0xAD,0xEB,0xFF,0xFF,0xF1,0xF8,0xFC,0xF5,0xFF,0xFE,0xFD,0xFE,0xFE,0xFD,
-  0xFB,0xFF,0xFA,0xFE,0xFF,0xFA,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFE,0x98,0x9F,0xE5,0x10,0x00,0xEF,0x11,0x03,
-  0xFC,0x19,0x0D,0xF2,0x1D,0x07,0xFF,0x12,0x08,0xFD,0x1A,0x09,0xD0,0xED,0xEE,0xFF,
-  0xFD,0xFC,0xFD,0xFF,0xFE,0xFF,0xFF,0xFF,0xFE,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFE,0xFF,0xFD,0xFF,0xFF,0xFF,0x33,0x1C,0xC7,0x1B,0x01,0xFF,0x17,0x07,
-  0xF6,0x16,0x00,0xE3,0x33,0x1D,0xE0,0x2B,0x25,0xDC,0x0C,0x06,0xD9,0x17,0x07,0xF8,
-  0x1D,0x06,0xFC,0x1C,0x08,0xF9,0x1B,0x09,0xFA,0x1B,0x08,0xF9,0x1C,0x09,0xFA,0x1C,
-  0x09,0xF9,0x1C,0x08,0xFA,0x1B,0x08,0xFA,0x1B,0x09,0xF9,0x1B,0x08,0xFA,0x1C,0x08,
-  0xFA,0x1A,0x06,0xFC,0x10,0x01,0xD3,0xC8,0xD3,0xF7,0xFC,0xFD,0xF7,0xFF,0xFC,0xFA,
-  0xFA,0xFF,0xFC,0xFF,0xFF,0xFF,0xFE,0xFF,0xF9,0xFF,0xF9,0xFF,0xFF,0xFE,0xFA,0xFE,
-  0xFF,0xFF,0xC2,0xBB,0xF0,0x14,0x04,0xCF,0x18,0x09,0xF5,0x17,0x06,0xFB,0x19,0x0C,
-  0xF4,0x1D,0x08,0xF9,0x1D,0x0A,0xF5,0x1B,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1B,0x09,0xF9,0x20,0x06,0xFB,0x1C,0x0B,0xF3,0x12,0x0C,0xFA,0x0D,0x00,
-  0xF1,0xAF,0xA9,0xF0,0xFF,0xFF,0xEA,0xF9,0xF9,0xF7,0xF8,0xFA,0xFC,0xFC,0xFE,0xF5,
-  0xFF,0xFA,0xF9,0xFC,0xF8,0xF7,0xF9,0xFC,0xF9,0xF5,0xFA,0xFF,0xF6,0xFE,0xFA,0xF8,
-  0xFB,0xEE,0xFD,0xFD,0xE6,0xFF,0xFF,0xFE,0x44,0x34,0xD4,0x17,0x04,0xF6,0x1B,0x0B,
-  0xFB,0x1F,0x09,0xF4,0x22,0x08,0xFA,0x0E,0x02,0xF6,0x33,0x25,0xCD,0xFC,0xF5,0xFE,
-  0xFF,0xFF,0xEF,0xFE,0xFB,0xFF,0xFE,0xFF,0xFA,0xFA,0xFF,0xFB,0xFB,0xFD,0xFF,0xF4,
-  0xFA,0xF1,0xFE,0xFF,0xE5,0xDC,0xD8,0xFB,0x14,0x05,0xDB,0x10,0x08,0xF4,0x17,0x00,
-  0xDF,0xA9,0xA0,0xEC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBC,0xB9,0xFB,0x1E,0x0A,0xDE,
-  0x12,0x09,0xF3,0x1B,0x07,0xF9,0x1C,0x08,0xF9,0x1D,0x0A,0xFB,0x1B,0x08,0xF9,0x1C,
-  0x09,0xF9,0x19,0x07,0xFE,0x1C,0x0C,0xF1,0x1F,0x0D,0xED,0x1D,0x04,0xFF,0x19,0x0F,
-  0xEC,0x0E,0x00,0xE8,0x61,0x62,0xD4,0xFD,0xFF,0xFF,0xFF,0xFB,0xFD,0xFF,0xFC,0xFA,
-  0xFC,0xFF,0xFA,0xFF,0xFF,0xFF,0xFC,0xFE,0xFC,0xFF,0xF9,0xFF,0xFE,0xFE,0xF8,0xF6,
-  0xFE,0xEC,0xFE,0xFF,0xFF,0x56,0x58,0xD2,0x16,0x00,0xF5,0x18,0x09,0xF9,0x17,0x0D,
-  0xF3,0x19,0x0A,0xF7,0x1B,0x06,0xFE,0x1C,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xF9,0x1B,0x08,0xFA,0x1E,0x05,0xFE,0x1D,0x0B,0xF3,0x13,0x0C,0xF6,0x0D,0x00,
-  0xF5,0x76,0x6A,0xE0,0xFF,0xFF,0xF7,0xF4,0xFA,0xF9,0xF8,0xF7,0xFF,0xFE,0xFD,0xFB,
-  0xFF,0xFF,0xF7,0xFF,0xFD,0xFE,0xFF,0xF9,0xFF,0xFF,0xFE,0xF9,0xFF,0xFF,0xF1,0xFF,
-  0xFF,0xF6,0xFF,0xFE,0xFF,0x86,0x7D,0xE0,0x1B,0x04,0xD9,0x17,0x04,0xFF,0x18,0x0A,
-  0xFD,0x1A,0x07,0xF8,0x1B,0x0B,0xFB,0x09,0x00,0xED,0x64,0x63,0xD9,0xFF,0xFF,0xFF,
-  0xFF,0xFB,0xFD,0xFD,0xFD,0xFF,0xFF,0xFD,0xFF,0xFD,0xFB,0xFF,0xFD,0xF8,0xFF,0xFC,
-  0xF8,0xFB,0xFF,0xFF,0xFC,0x9B,0x91,0xEC,0x0C,0x00,0xEB,0x10,0x09,0xEF,0x53,0x3A,
-  0xE4,0xFB,0xFF,0xF2,0xF8,0xFC,0xE5,0xFB,0xFA,0xE9,0xFF,0xFF,0xF6,0x6E,0x5F,0xED,
-  0x11,0x04,0xED,0x1A,0x07,0xF8,0x1C,0x08,0xFA,0x1D,0x0A,0xFB,0x1B,0x08,0xF9,0x1C,
-  0x08,0xFA,0x1A,0x09,0xFA,0x19,0x0C,0xF4,0x19,0x05,0xFF,0x1B,0x0C,0xF4,0x13,0x06,
-  0xF2,0x1C,0x0A,0xCB,0xDE,0xE0,0xFF,0xF9,0xFE,0xF6,0xFF,0xF8,0xFC,0xFE,0xFC,0xFC,
-  0xF9,0xFF,0xFC,0xFF,0xFF,0xFF,0xFA,0xFF,0xFA,0xFA,0xFB,0xFF,0xFC,0xFD,0xFC,0xFB,
-  0xFF,0xEE,0xFC,0xFF,0xF3,0xDA,0xE9,0xFE,0x20,0x0B,0xD0,0x1A,0x00,0xFF,0x13,0x0A,
-  0xF3,0x13,0x0A,0xF8,0x1A,0x09,0xFA,0x1C,0x08,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xF9,0x1B,0x08,0xFB,0x1A,0x05,0xFE,0x1F,0x0A,0xF4,0x16,0x0D,0xF6,0x13,0x07,
-  0xFA,0x27,0x15,0xCD,0xF4,0xF5,0xFF,0xFC,0xFD,0xF6,0xFF,0xFF,0xEF,0xEF,0xEF,0xFC,
-  0xAA,0xA2,0xE2,0xD4,0xD2,0xFF,0xF1,0xF5,0xFF,0xFE,0xFF,0xFF,0xEC,0xEE,0xFF,0xB7,
-  0xB6,0xF2,0x50,0x47,0xD0,0x15,0x01,0xD7,0x1D,0x06,0xFE,0x17,0x07,0xFF,0x19,0x0E,
-  0xF7,0x17,0x0A,0xF2,0x14,0x06,0xFF,0x0C,0x00,0xDF,0xB4,0xBC,0xEE,0xFF,0xFF,0xF4,
-  0xFF,0xF9,0xFF,0xFA,0xFE,0xFD,0xFD,0xFC,0xFF,0xFF,0xFC,0xFC,0xFE,0xFE,0xF5,0xFC,
-  0xFE,0xF7,0xF8,0xFF,0xFF,0x3B,0x23,0xE6,0x0F,0x09,0xF0,0x0B,0x00,0xF3,0x89,0x79,
-  0xE9,0xFF,0xFF,0xE4,0xF4,0xF2,0xEE,0xFB,0xED,0xE9,0xFF,0xFF,0xEE,0x97,0x92,0xF0,
-  0x13,0x00,0xF8,0x1A,0x08,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1B,0x08,0xF9,0x1C,
-  0x09,0xFA,0x1A,0x08,0xF9,0x19,0x0A,0xF9,0x14,0x09,0xFB,0x1A,0x0C,0xF6,0x11,0x00,
-  0xE6,0x9C,0x95,0xEB,0xFF,0xFF,0xFA,0xFE,0xFE,0xEE,0xFF,0xF8,0xFD,0xFD,0xFD,0xFE,
-  0xF9,0xFC,0xFE,0xFF,0xFF,0xFF,0xFD,0xFF,0xF8,0xFB,0xFE,0xFF,0xF9,0xFC,0xFF,0xFB,
-  0xFD,0xFC,0xFE,0xF7,0xFA,0xFC,0xFF,0xF8,0xA5,0xA0,0xED,0x19,0x00,0xE1,0x18,0x07,
-  0xF6,0x17,0x09,0xF4,0x19,0x0D,0xF0,0x1C,0x08,0xFA,0x1C,0x09,0xFA,0x1B,0x09,0xF9,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xF9,0x1B,0x09,0xFA,0x17,0x07,0xFC,0x20,0x09,0xF5,0x17,0x08,0xF8,0x10,0x0A,
-  0xF7,0x14,0x03,0xE7,0x8C,0x77,0xE6,0xFD,0xFF,0xEE,0xF9,0xF9,0xEC,0xF8,0xFB,0xFF,
-  0x79,0x77,0xC9,0x19,0x02,0xC4,0x24,0x11,0xD4,0x25,0x13,0xD5,0x1D,0x0D,0xD4,0x0F,
-  0x00,0xE3,0x12,0x01,0xF8,0x1A,0x09,0xFF,0x18,0x04,0xFF,0x1A,0x0A,0xFA,0x18,0x0C,
-  0xEE,0x17,0x0D,0xEE,0x12,0x01,0xE3,0x4C,0x3E,0xD5,0xF6,0xF9,0xFF,0xFA,0xFC,0xEF,
-  0xFF,0xFE,0xF8,0xF9,0xFE,0xFC,0xFE,0xFB,0xFF,0xFF,0xFD,0xF5,0xFA,0xFF,0xE4,0xF8,
-  0xFF,0xFE,0x96,0x98,0xE9,0x0F,0x00,0xE4,0x12,0x09,0xF8,0x18,0x07,0xF7,0x47,0x33,
-  0xD6,0xFC,0xFF,0xFE,0xF7,0xFF,0xF4,0xF7,0xF9,0xF6,0xFF,0xFF,0xFF,0x5D,0x54,0xDF,
-  0x15,0x00,0xF4,0x1B,0x09,0xF9,0x1C,0x09,0xFA,0x1B,0x08,0xF9,0x1B,0x09,0xFA,0x1B,
-  0x09,0xF9,0x1E,0x07,0xFB,0x19,0x0C,0xFB,0x12,0x0D,0xEE,0x14,0x01,0xEA,0x4E,0x42,
-  0xD8,0xFD,0xFF,0xFF,0xFF,0xFF,0xE9,0xFE,0xFD,0xF5,0xFC,0xFA,0xFF,0xFD,0xFF,0xFA,
-  0xFD,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0xFD,0xFD,0xFE,0xFF,0xF7,0xFE,0xFD,0xFA,
-  0xFD,0xFB,0xFE,0xF8,0xF9,0xFF,0xF3,0xF7,0xFF,0xFF,0xFC,0x5C,0x56,0xD7,0x11,0x00,
-  0xEB,0x1B,0x0B,0xF1,0x1E,0x09,0xF9,0x1C,0x08,0xFA,0x1B,0x08,0xFA,0x1B,0x09,0xFA,
-  0x1B,0x08,0xFA,0x1C,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1B,0x08,0xFA,0x14,0x0B,0xF6,0x22,0x07,0xF9,0x1B,0x07,0xFF,0x0B,0x0C,
-  0xF5,0x11,0x03,0xF9,0x1E,0x08,0xD6,0xC8,0xC8,0xFC,0xFF,0xFE,0xFD,0xFE,0xFD,0xF1,
-  0xF5,0xF4,0xFF,0x66,0x58,0xE7,0x0C,0x00,0xDB,0x13,0x01,0xFB,0x11,0x00,0xFF,0x13,
-  0x01,0xFE,0x15,0x04,0xFB,0x14,0x08,0xFC,0x1B,0x06,0xFB,0x1F,0x08,0xF9,0x1A,0x06,
-  0xF8,0x0D,0x00,0xF4,0x2E,0x27,0xBD,0xE9,0xE9,0xFF,0xFE,0xF8,0xF8,0xFD,0xF9,0xF6,
-  0xFC,0xFE,0xFE,0xF7,0xFF,0xFA,0xFE,0xFB,0xFF,0xFF,0xFE,0xF8,0xFF,0xFF,0xF9,0xD3,
-  0xCE,0xFE,0x1D,0x11,0xC6,0x17,0x06,0xFC,0x18,0x0D,0xF1,0x19,0x07,0xF9,0x15,0x00,
-  0xE4,0x77,0x7A,0xE6,0xE0,0xE0,0xFF,0xDB,0xE5,0xFF,0x96,0x9D,0xF0,0x18,0x04,0xE4,
-  0x16,0x05,0xF8,0x1B,0x09,0xF9,0x1C,0x09,0xF9,0x1B,0x09,0xF9,0x1B,0x09,0xFA,0x1B,
-  0x09,0xFA,0x22,0x07,0xFB,0x19,0x0C,0xF2,0x10,0x03,0xFB,0x21,0x10,0xDA,0xDB,0xE1,
-  0xFB,0xFF,0xFE,0xF7,0xFC,0xFB,0xF3,0xF7,0xF9,0xFE,0xF6,0xFA,0xFD,0xFC,0xFF,0xF3,
-  0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,0xFE,0xFE,0xFF,0xFC,0xFE,0xFE,0xFD,
-  0xFF,0xFD,0xFF,0xFE,0xFE,0xFD,0xFC,0xF8,0xFF,0xFF,0xFA,0xE9,0xE8,0xFF,0x38,0x22,
-  0xCD,0x17,0x0B,0xF0,0x11,0x08,0xFD,0x15,0x0A,0xF0,0x1D,0x0B,0xF3,0x20,0x06,0xFC,
-  0x1C,0x0A,0xF6,0x1A,0x09,0xF7,0x1C,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1B,0x08,0xFA,0x1A,0x09,0xF8,0x1D,0x08,0xFA,0x1C,0x07,0xFB,0x18,0x0A,
-  0xF8,0x1B,0x09,0xFC,0x18,0x05,0xF8,0x25,0x19,0xD4,0xCD,0xD9,0xFB,0xFA,0xFF,0xEB,
-  0xFF,0xFB,0xF7,0xFB,0xF6,0xFF,0xA4,0x9F,0xED,0x38,0x27,0xCA,0x0D,0x00,0xD5,0x0F,
-  0x04,0xEA,0x0B,0x06,0xF0,0x02,0x00,0xF8,0x0F,0x00,0xFC,0x10,0x00,0xE3,0x21,0x10,
-  0xC9,0x6B,0x5F,0xE6,0xF1,0xF5,0xFF,0xFA,0xFF,0xFD,0xFB,0xFE,0xFD,0xF8,0xFD,0xFD,
-  0xF5,0xFC,0xFB,0xFD,0xFE,0xF0,0xFF,0xFB,0xF8,0xFF,0xFF,0xFF,0xCF,0xD2,0xFB,0x2C,
-  0x20,0xCF,0x17,0x02,0xF3,0x1A,0x08,0xFB,0x1B,0x0A,0xF5,0x1B,0x07,0xFB,0x1A,0x08,
-  0xFA,0x12,0x00,0xE7,0x1E,0x08,0xE6,0x1E,0x0D,0xE5,0x10,0x00,0xE4,0x1B,0x06,0xFA,
-  0x1A,0x09,0xFA,0x17,0x07,0xFD,0x1B,0x06,0xFE,0x1E,0x06,0xFD,0x1D,0x06,0xF9,0x1D,
-  0x09,0xF8,0x1B,0x0A,0xF7,0x19,0x0A,0xEF,0x17,0x00,0xDA,0xAA,0xA5,0xF5,0xFF,0xFF,
-  0xF8,0xFF,0xFB,0xFC,0xFD,0xFE,0xFE,0xFC,0xFD,0xFF,0xFC,0xFE,0xFE,0xFE,0xFF,0xFC,
-  0xFF,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFF,0xF7,0xFC,0xFB,0xF4,0xFE,0xFA,0xFF,0xCE,0xD1,
-  0xF8,0x1B,0x0B,0xD3,0x0E,0x05,0xEC,0x17,0x0A,0xFA,0x18,0x05,0xFB,0x1C,0x0E,0xED,
-  0x1A,0x08,0xF9,0x19,0x08,0xFC,0x1C,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x08,0xFA,0x1B,0x09,0xFA,0x1C,0x09,0xF9,0x1C,0x08,
-  0xFA,0x1C,0x08,0xFA,0x18,0x09,0xFA,0x1A,0x06,0xF2,0x23,0x0B,0xD6,0xB1,0xB0,0xF2,
-  0xFF,0xFF,0xF8,0xFA,0xFF,0xE9,0xFC,0xFF,0xED,0xF3,0xF7,0xFE,0xC2,0xBF,0xF6,0x85,
-  0x7A,0xE7,0x67,0x58,0xDD,0x6D,0x59,0xE8,0x78,0x67,0xE0,0xA8,0x9C,0xEA,0xE8,0xE3,
-  0xF9,0xFF,0xFF,0xF5,0xFC,0xFE,0xFC,0xFB,0xFD,0xFB,0xFD,0xFF,0xFB,0xFF,0xFE,0xFC,
-  0xFF,0xFB,0xFC,0xFD,0xFF,0xF4,0xFD,0xFF,0xFB,0xA8,0xA8,0xE8,0x22,0x0D,0xCF,0x18,
-  0x01,0xF5,0x1A,0x07,0xFA,0x1E,0x0B,0xFC,0x1D,0x0A,0xFB,0x1B,0x09,0xF9,0x1C,0x08,
-  0xFA,0x1B,0x08,0xF9,0x19,0x07,0xF8,0x19,0x07,0xF8,0x1B,0x08,0xFA,0x1B,0x09,0xF9,
-  0x1C,0x08,0xFB,0x19,0x06,0xFE,0x19,0x0A,0xF7,0x18,0x09,0xF2,0x1A,0x0B,0xF6,0x19,
-  0x0C,0xF7,0x16,0x0B,0xF4,0x11,0x00,0xEB,0x83,0x7E,0xE2,0xF7,0xFF,0xFC,0xFB,0xFA,
-  0xFD,0xFE,0xFD,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFD,0xFE,0xFB,0xF9,0xFC,0xFC,0xEF,0xF8,0xFF,
-  0xF3,0xB1,0xAD,0xF2,0x1D,0x01,0xDF,0x15,0x05,0xEF,0x19,0x08,0xFA,0x16,0x07,0xFC,
-  0x18,0x0C,0xF4,0x19,0x09,0xF9,0x1C,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x08,0xF9,0x17,0x0A,0xFA,0x18,0x0A,0xF8,0x1E,0x0A,0xF0,0x19,0x00,0xD8,
-  0x5C,0x57,0xDD,0xDB,0xDD,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xFF,0xED,0xFF,
-  0xFF,0xF9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,0xFB,0xF7,0xFD,0xF1,0xFB,0xFE,
-  0xF6,0xFB,0xFA,0xF6,0xFF,0xF3,0xFE,0xFF,0xFD,0xFA,0xFF,0xFF,0xF7,0xFF,0xFF,0xFE,
-  0xFF,0xFF,0xFF,0xD1,0xD1,0xFE,0x5D,0x51,0xDA,0x15,0x03,0xD5,0x16,0x0A,0xEB,0x19,
-  0x0B,0xF5,0x1B,0x09,0xFA,0x1D,0x0A,0xFB,0x18,0x05,0xF6,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xF9,0x1C,0x08,0xF9,0x1C,0x08,0xFA,0x1C,0x08,0xFB,0x1C,0x08,0xFA,
-  0x1C,0x07,0xFC,0x1C,0x07,0xFC,0x19,0x0E,0xF2,0x14,0x0D,0xF4,0x12,0x06,0xFD,0x16,
-  0x07,0xFF,0x0D,0x00,0xE7,0x5E,0x5C,0xD9,0xF5,0xFF,0xFF,0xF6,0xF9,0xEF,0xFB,0xFC,
-  0xF8,0xFC,0xFE,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFB,0xFF,0xFF,0xFE,0xFA,0xFF,0xFC,0xFB,0xFF,0xFF,
-  0xF5,0xFF,0xFF,0xFE,0xA2,0x95,0xF5,0x1B,0x05,0xCE,0x1C,0x06,0xF7,0x16,0x08,0xFA,
-  0x19,0x0D,0xF5,0x1A,0x09,0xF8,0x1C,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x08,0xFA,0x16,0x09,0xF9,0x17,0x0C,0xF3,0x18,0x0D,0xF2,0x1B,0x07,0xFA,
-  0x12,0x00,0xF4,0x21,0x05,0xE0,0x69,0x52,0xE4,0xB5,0xB5,0xEE,0xEB,0xFB,0xEF,0xFF,
-  0xFF,0xF6,0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,0xFF,0xFF,0xF9,0xFF,0xFF,0xFB,0xFF,0xFF,
-  0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xF2,0xFF,0xFF,0xF9,0xE3,0xE8,0xFB,0xA3,0x9F,0xF0,
-  0x59,0x4F,0xDC,0x1D,0x07,0xDA,0x18,0x06,0xE5,0x16,0x08,0xF7,0x15,0x06,0xFF,0x18,
-  0x0B,0xF6,0x1B,0x0C,0xF3,0x1C,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xF9,0x1C,0x07,0xFB,0x1C,0x07,0xFB,0x1C,0x07,0xFB,0x1C,0x08,0xFA,
-  0x1C,0x08,0xFB,0x1C,0x06,0xFA,0x16,0x0B,0xF5,0x10,0x05,0xFD,0x16,0x03,0xFF,0x13,
-  0x00,0xE3,0x56,0x53,0xD1,0xF1,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFD,0xFD,0xFC,0xFF,
-  0xFA,0xFC,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFE,0xFB,0xFD,0xFB,0xFD,0xFE,0xF8,0xFF,0xFF,0xFF,
-  0xFA,0xF8,0xF9,0xF5,0xFF,0xFF,0xF6,0x9F,0x93,0xEC,0x18,0x05,0xD6,0x14,0x0C,0xEE,
-  0x17,0x08,0xF9,0x1E,0x05,0xFF,0x1C,0x09,0xFA,0x1B,0x08,0xFA,0x1B,0x09,0xF9,0x1B,
-  0x09,0xF9,0x1C,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xF9,0x19,0x06,0xFD,0x1A,0x0F,0xEE,0x19,0x0A,0xF6,0x17,0x03,0xFD,
-  0x1C,0x0B,0xFB,0x19,0x09,0xF9,0x12,0x01,0xEB,0x10,0x00,0xDB,0x1F,0x0D,0xDB,0x46,
-  0x36,0xE5,0x6B,0x61,0xE5,0x8D,0x88,0xDE,0x9E,0x98,0xE4,0x9F,0x99,0xE1,0x9C,0x98,
-  0xE2,0x89,0x85,0xDC,0x5F,0x52,0xEB,0x3E,0x31,0xDA,0x18,0x0A,0xCD,0x13,0x02,0xDE,
-  0x18,0x04,0xF2,0x13,0x07,0xF6,0x16,0x09,0xF8,0x1B,0x08,0xFA,0x1C,0x07,0xFB,0x19,
-  0x07,0xFD,0x1A,0x08,0xFB,0x1C,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xF9,0x1C,0x07,0xFB,0x1C,0x08,0xFA,0x1C,0x08,0xF9,0x1C,0x09,0xF8,
-  0x1C,0x08,0xF8,0x1B,0x0A,0xF7,0x12,0x09,0xF6,0x13,0x05,0xFF,0x14,0x02,0xDC,0x52,
-  0x50,0xC8,0xF1,0xF6,0xFE,0xF6,0xF8,0xF9,0xFA,0xFD,0xF5,0xFD,0xFD,0xFD,0xFC,0xFB,
-  0xFD,0xFE,0xFE,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xF5,0xFD,0xF9,0xFF,0xFD,0xFE,0xFD,0xFE,0xFD,
-  0xFF,0xFB,0xFA,0xFA,0xFC,0xFE,0xF4,0xFF,0xFF,0xFD,0xA2,0x9B,0xF4,0x19,0x02,0xD7,
-  0x16,0x03,0xFA,0x12,0x03,0xFF,0x17,0x0B,0xF4,0x1C,0x0B,0xF1,0x20,0x07,0xFD,0x1D,
-  0x05,0xFE,0x17,0x0C,0xF4,0x1B,0x08,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x08,0xFA,0x1C,0x0C,0xF2,0x1C,0x07,0xFB,0x1B,0x0A,0xF6,0x1A,0x0C,0xF2,
-  0x1B,0x08,0xFB,0x16,0x08,0xF7,0x16,0x09,0xF9,0x16,0x06,0xF9,0x17,0x06,0xF4,0x16,
-  0x05,0xF3,0x14,0x01,0xF1,0x0D,0x00,0xEC,0x10,0x00,0xE9,0x11,0x00,0xE9,0x11,0x00,
-  0xEC,0x14,0x01,0xF1,0x10,0x02,0xF2,0x12,0x04,0xF4,0x19,0x07,0xF9,0x17,0x05,0xF6,
-  0x1A,0x08,0xF6,0x15,0x09,0xF7,0x17,0x07,0xF9,0x1D,0x07,0xFA,0x1F,0x08,0xF9,0x1B,
-  0x09,0xF7,0x1A,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xF9,0x1B,0x08,0xFA,0x19,0x06,0xFD,0x1A,0x07,0xFC,0x1A,0x08,0xFB,0x1B,0x09,0xF8,
-  0x1B,0x0A,0xF5,0x15,0x09,0xF8,0x18,0x0B,0xFD,0x0F,0x00,0xE5,0x5A,0x54,0xD5,0xF4,
-  0xFF,0xFF,0xFC,0xFB,0xF8,0xFD,0xFE,0xF5,0xFB,0xFD,0xF6,0xFD,0xFC,0xFF,0xFE,0xFE,
-  0xFD,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFF,0xFC,0xFB,0xFD,0xFD,0xFF,0xFD,0xB7,0xB6,0xEF,
-  0x1A,0x0C,0xCC,0x12,0x06,0xEE,0x18,0x12,0xEB,0x19,0x06,0xFA,0x19,0x06,0xFA,0x19,
-  0x0B,0xF5,0x17,0x0A,0xF7,0x1B,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x08,0xFA,0x1C,0x08,0xFA,
-  0x1C,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x08,0xFA,0x1B,
-  0x08,0xFA,0x1B,0x08,0xFB,0x1B,0x08,0xFB,0x1B,0x08,0xFB,0x1B,0x08,0xFB,0x1B,0x08,
-  0xFB,0x1B,0x08,0xFB,0x1C,0x08,0xFA,0x1C,0x08,0xFA,0x1C,0x08,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x08,0xFA,0x1C,0x08,0xFA,0x1C,0x09,0xFA,0x1B,0x09,0xFA,0x1B,0x09,0xFA,0x1C,
-  0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xF9,0x1B,0x08,0xFB,0x19,0x08,0xF9,0x17,0x0E,0xF2,0x15,0x0C,0xF4,0x17,0x08,0xFA,
-  0x18,0x0B,0xF5,0x15,0x07,0xF2,0x0E,0x00,0xE4,0x73,0x6F,0xDE,0xF4,0xFF,0xFF,0xFC,
-  0xFD,0xFE,0xFF,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFC,0xFD,0xFB,0xFC,0xFC,0xF7,0xF6,0xF8,0xF1,0xF9,0xFF,0xF6,
-  0xD3,0xD7,0xF8,0x47,0x2F,0xD1,0x19,0x00,0xE8,0x14,0x09,0xFA,0x0B,0x0F,0xF7,0x14,
-  0x0F,0xEF,0x23,0x0A,0xF3,0x1C,0x08,0xF9,0x1B,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1B,0x08,
-  0xFA,0x1C,0x0C,0xF2,0x1B,0x0E,0xED,0x18,0x06,0xFF,0x13,0x0A,0xFA,0x13,0x0F,0xF0,
-  0x11,0x04,0xF4,0x1D,0x06,0xD5,0x9D,0x9D,0xEB,0xFA,0xFF,0xFB,0xF9,0xFA,0xF6,0xFB,
-  0xF9,0xFC,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFD,0xFE,0xF9,0xFE,0xFB,0xFD,0xFF,0xFC,0xFD,0xFF,0xFF,0xF9,
-  0xFF,0xFC,0xFF,0xF9,0xF3,0xFF,0x6E,0x5E,0xDA,0x12,0x00,0xE1,0x0B,0x02,0xFA,0x15,
-  0x0C,0xF5,0x25,0x05,0xFF,0x1C,0x08,0xFA,0x1B,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1B,0x09,
-  0xF9,0x1D,0x08,0xFB,0x1A,0x06,0xF9,0x16,0x04,0xFB,0x18,0x08,0xF5,0x10,0x03,0xD6,
-  0x33,0x27,0xD9,0xC6,0xC5,0xFA,0xFF,0xFF,0xFF,0xFF,0xFE,0xF7,0xFF,0xFE,0xF8,0xFE,
-  0xFF,0xF7,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFE,0xF6,0xFF,0xFE,0xFA,0xFB,0xFA,0xFE,0xF6,0xFC,0xFC,0xFF,
-  0xFF,0xFC,0xFB,0xFF,0xFF,0xF6,0xFE,0xFF,0xFB,0xB1,0xAC,0xF2,0x2C,0x19,0xD1,0x11,
-  0x00,0xEA,0x16,0x05,0xF7,0x1B,0x08,0xFB,0x1C,0x08,0xFA,0x1C,0x09,0xFA,0x1B,0x08,
-  0xF9,0x1C,0x09,0xF9,0x1B,0x09,0xFA,0x1B,0x08,0xFA,0x1C,0x08,0xFA,0x1C,0x08,0xFA,
-  0x1C,0x09,0xF9,0x1C,0x08,0xFA,0x1C,0x08,0xFA,0x1C,0x08,0xFA,0x1C,0x08,0xFA,0x1C,
-  0x08,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,0xFA,0x1C,0x09,
-  0xFA,0x1C,0x09,0xFA,0x1C,0x08,0xFA,0x1C,0x08,0xFA,0x1C,0x08,0xFA,0x1C,0x09,0xFA,
-  0x1C,0x09,0xF9,0x1C,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x08,0xFA,0x1C,0x09,0xFA,0x1C,
-  0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x09,0xF9,0x1C,0x09,0xFA,0x1C,0x08,0xFA,0x1C,0x08,
-  0xFA,0x1C,0x0A,0xFA,0x15,0x0B,0xEF,0x14,0x08,0xE7,0x17,0x02,0xD8,0x7A,0x6A,0xE1,
-  0xF5,0xFB,0xFC,0xFB,0xFF,0xEE,0xFF,0xFC,0xFF,0xFE,0xFC,0xF8,0xFE,0xF9,0xFF,0xFB,
-  0xFD,0xF4,0xFE,0xFF,0xFA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFA,0xFF,0xFE,0xFE,0xFB,0xFE,0xFF,0xFB,0xFE,0xFF,
-  0xFD,0xFB,0xFC,0xFE,0xFD,0xF6,0xFC,0xF9,0xF8,0xFF,0xFF,0xF5,0xEF,0xF8,0xFF,0x6A,
-  0x6C,0xDB,0x11,0x0B,0xD5,0x12,0x00,0xF2,0x18,0x07,0xF5,0x19,0x06,0xF8,0x1C,0x09,
-  0xFC,0x1B,0x08,0xFB,0x1C,0x08,0xFA,0x1C,0x09,0xF9,0x1B,0x09,0xF7,0x1A,0x09,0xF8,
-  0x19,0x08,0xFB,0x1A,0x09,0xF8,0x1C,0x0A,0xF5,0x1B,0x0A,0xF7,0x1A,0x0A,0xF8,0x19,
-  0x09,0xF9,0x1A,0x08,0xFA,0x1C,0x09,0xF9,0x1C,0x09,0xF9,0x1C,0x09,0xF9,0x1C,0x09,
-  0xF9,0x1C,0x08,0xF9,0x18,0x0B,0xF5,0x19,0x0A,0xF6,0x19,0x0A,0xF7,0x1A,0x08,0xF9,
-  0x1A,0x09,0xFA,0x1A,0x09,0xFA,0x1A,0x08,0xFA,0x1B,0x08,0xFA,0x1B,0x08,0xFA,0x1C,
-  0x08,0xFA,0x1C,0x08,0xF9,0x1C,0x08,0xFB,0x1A,0x07,0xFA,0x18,0x09,0xF7,0x1A,0x0B,
-  0xF9,0x15,0x04,0xF4,0x10,0x02,0xDD,0x39,0x37,0xD3,0xC3,0xD0,0xF7,0xFF,0xFF,0xF5,
-  0xFF,0xFF,0xEA,0xFF,0xFA,0xF8,0xFC,0xFC,0xF4,0xF8,0xFC,0xFD,0xFA,0xFF,0xF9,0xFC,
-  0xFD,0xFD,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFC,0xFE,0xFE,0xFF,0xF9,0xFF,0xF5,0xFE,
-  0xFF,0xFF,0xD2,0xCC,0xF6,0x57,0x56,0xD9,0x18,0x04,0xD3,0x18,0x00,0xEE,0x1B,0x08,
-  0xF8,0x18,0x0C,0xF5,0x18,0x0B,0xF4,0x1B,0x0B,0xF7,0x18,0x08,0xF6,0x19,0x09,0xF9,
-  0x1A,0x07,0xFB,0x1C,0x07,0xFA,0x1D,0x07,0xF9,0x1B,0x08,0xF9,0x1B,0x08,0xFA,0x18,
-  0x09,0xF9,0x18,0x0A,0xF8,0x1C,0x08,0xF7,0x1C,0x09,0xF7,0x1C,0x09,0xF7,0x1C,0x09,
-  0xF7,0x1B,0x08,0xF8,0x15,0x08,0xFB,0x16,0x08,0xFB,0x18,0x08,0xFC,0x1A,0x08,0xFC,
-  0x1B,0x07,0xFD,0x1C,0x06,0xFD,0x1A,0x09,0xF7,0x1B,0x0D,0xF0,0x19,0x0C,0xF4,0x18,
-  0x06,0xFE,0x18,0x07,0xF9,0x17,0x0D,0xF6,0x14,0x0C,0xF1,0x15,0x0C,0xEA,0x0E,0x02,
-  0xD8,0x33,0x25,0xDA,0xAD,0xA3,0xF1,0xF8,0xFC,0xFF,0xFF,0xFF,0xF9,0xFF,0xFC,0xFA,
-  0xFE,0xFD,0xF8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFD,0xFC,0xFF,0xFC,0xFB,0xFF,0xF6,0xFD,0xF0,0xF3,
-  0xFB,0xEC,0xF2,0xF6,0xF5,0xFF,0xFF,0xFF,0xD8,0xD8,0xFA,0x6D,0x65,0xD7,0x15,0x08,
-  0xCA,0x0D,0x00,0xEE,0x12,0x07,0xFA,0x14,0x05,0xFC,0x1A,0x04,0xFF,0x1F,0x05,0xFE,
-  0x22,0x0B,0xF3,0x1F,0x09,0xF6,0x1C,0x05,0xFF,0x1E,0x07,0xFB,0x20,0x08,0xF8,0x21,
-  0x0B,0xF3,0x21,0x0A,0xF3,0x1B,0x09,0xF8,0x1C,0x09,0xF8,0x1B,0x08,0xF7,0x1B,0x09,
-  0xF8,0x1D,0x09,0xF8,0x23,0x07,0xF6,0x23,0x07,0xF6,0x20,0x08,0xF8,0x1F,0x07,0xFB,
-  0x1E,0x07,0xFC,0x21,0x0A,0xF4,0x20,0x08,0xF8,0x1D,0x05,0xFF,0x17,0x06,0xFF,0x14,
-  0x0A,0xF9,0x11,0x0B,0xF6,0x0B,0x00,0xF0,0x0E,0x00,0xDC,0x48,0x3B,0xD8,0xAD,0xAB,
-  0xEE,0xF0,0xF6,0xFF,0xF8,0xFF,0xFB,0xF6,0xFF,0xE6,0xFD,0xFE,0xF1,0xFE,0xF5,0xFF,
-  0xFE,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFE,0xFF,0xFD,0xFC,0xFE,0xFB,0xFD,0xFB,0xFF,0xFE,0xFC,0xFD,0xFD,
-  0xFE,0xF6,0xFE,0xFF,0xF7,0xFD,0xFD,0xF0,0xFF,0xFF,0xFC,0xFE,0xFF,0xFF,0xE6,0xEE,
-  0xFF,0x90,0x88,0xEB,0x3A,0x2C,0xDE,0x13,0x03,0xCE,0x14,0x00,0xE5,0x18,0x02,0xF7,
-  0x18,0x04,0xFA,0x16,0x0A,0xFB,0x12,0x0A,0xF9,0x13,0x08,0xF7,0x16,0x09,0xF8,0x15,
-  0x06,0xF6,0x19,0x07,0xF9,0x19,0x06,0xF5,0x1A,0x07,0xF6,0x1C,0x09,0xF8,0x1B,0x08,
-  0xF7,0x19,0x06,0xF5,0x1C,0x0B,0xF9,0x1C,0x0B,0xF8,0x18,0x0C,0xF5,0x15,0x0D,0xF2,
-  0x11,0x0C,0xED,0x14,0x0B,0xF6,0x17,0x0A,0xF9,0x15,0x03,0xF2,0x17,0x01,0xEC,0x15,
-  0x00,0xE3,0x2A,0x0F,0xDC,0x6D,0x5D,0xE0,0xCC,0xCF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFE,0xFF,0xFE,0xF8,0xFE,0xFD,0xFE,0xFE,0xFD,0xF6,0xFF,0xFD,0xFA,0xFF,0xFF,0xFA,
-  0xFE,0xFF,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFE,0xFF,0xFD,0xFD,0xFF,0xF9,0xFF,0xFE,0xFE,0xFE,0xFA,0xFF,0xFF,
-  0xFA,0xFF,0xFF,0xFD,0xFC,0xFD,0xFE,0xFA,0xFE,0xFF,0xFD,0xFD,0xFF,0xF4,0xFF,0xFF,
-  0xF5,0xFF,0xFF,0xF9,0xF9,0xFB,0xFF,0xD5,0xD3,0xFF,0x96,0x8A,0xF1,0x4D,0x3D,0xE0,
-  0x21,0x11,0xD1,0x0E,0x00,0xD8,0x11,0x00,0xEC,0x15,0x00,0xF0,0x12,0x01,0xF3,0x15,
-  0x05,0xF7,0x15,0x05,0xF7,0x1A,0x08,0xF6,0x1A,0x07,0xF6,0x1B,0x08,0xF7,0x1C,0x09,
-  0xF8,0x1C,0x0A,0xF9,0x0F,0x09,0xF0,0x0B,0x00,0xED,0x11,0x01,0xF3,0x13,0x00,0xF5,
-  0x10,0x00,0xF2,0x0A,0x00,0xE3,0x14,0x00,0xD7,0x3F,0x30,0xDB,0x81,0x76,0xDE,0xC1,
-  0xBE,0xF2,0xF7,0xF9,0xFE,0xFF,0xFF,0xFC,0xFF,0xFF,0xFD,0xFF,0xFF,0xF4,0xFF,0xFF,
-  0xF6,0xFF,0xFC,0xFD,0xFF,0xFD,0xFB,0xFF,0xFB,0xFF,0xFE,0xFA,0xFF,0xFD,0xFA,0xFF,
-  0xFE,0xFB,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFE,0xFE,0xFF,0xFD,0xFD,0xFD,0xFD,0xFF,0xF7,0xFE,0xFF,0xFB,0xFD,
-  0xFE,0xFD,0xFD,0xFF,0xF7,0xFD,0xFE,0xFA,0xFE,0xFB,0xFE,0xFF,0xFC,0xFC,0xFE,0xFC,
-  0xF4,0xFE,0xF5,0xF8,0xFD,0xFA,0xE9,0xFF,0xFF,0xEF,0xFF,0xFF,0xF6,0xFF,0xFF,0xFD,
-  0xF8,0xF5,0xFC,0xDB,0xD9,0xFA,0xB0,0xAC,0xEC,0x87,0x7E,0xDE,0x5F,0x52,0xD7,0x46,
-  0x35,0xE5,0x33,0x20,0xF0,0x1D,0x09,0xFB,0x1C,0x09,0xF8,0x1D,0x0A,0xF9,0x1B,0x08,
-  0xF7,0x17,0x04,0xF3,0x27,0x15,0xF4,0x3A,0x2D,0xEE,0x53,0x4B,0xDA,0x78,0x75,0xDB,
-  0x9B,0x9A,0xE9,0xCB,0xCD,0xF6,0xEE,0xF1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,
-  0xFF,0xFC,0xFB,0xFB,0xF8,0xF7,0xFA,0xF7,0xFD,0xFA,0xF9,0xFE,0xF8,0xFB,0xFD,0xFB,
-  0xFD,0xF9,0xFD,0xF8,0xFC,0xFF,0xFB,0xFC,0xFE,0xFF,0xF8,0xFE,0xFB,0xFB,0xFF,0xF8,
-  0xFC,0xFD,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,};
@@ -1,1207 +0,0 @@
-#pragma once
-#include <stdint.h>
-const uint8_t r4[] {
-  0x42,0x4D,0x36,0x4B,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x00,0x00,0x00,0x28,0x00,
-  0x00,0x00,0x50,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x01,0x00,0x18,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x4B,0x00,0x00,0xC4,0x0E,0x00,0x00,0xC4,0x0E,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFD,0xFE,0xFE,
-  0xFD,0xFF,0xFF,0xFC,0xFF,0xFE,0xFC,0xFE,0xFF,0xFD,0xFE,0xFF,0xFF,0xFE,0xFF,0xFE,
-  0xFE,0xFF,0xFD,0xFF,0xFF,0xFB,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFD,0xFF,0xFE,0xFC,
-  0xFB,0xFF,0xFF,0xFD,0xFE,0xFE,0xFA,0xFF,0xFD,0xFE,0xFF,0xFE,0xFD,0xFE,0xFE,0xFE,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFC,0xFE,0xFD,
-  0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xF5,0xF8,0xF2,0xEB,0xE8,0xE0,0xEF,0xE9,0xE1,0xF0,0xE9,0xE3,0xF0,0xE8,
-  0xE2,0xEE,0xE9,0xE1,0xE8,0xE5,0xDC,0xFD,0xFE,0xF9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFD,0xFF,0xFF,0xFB,0xFF,0xFF,0xFB,0xFF,0xFF,0xFD,0xFF,0xFF,0xFD,0xFF,0xFD,0xFF,
-  0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xD1,0xCB,0xBA,0xC1,0xA3,0x96,0xAA,0x7D,0x63,0x97,0x5B,0x33,0x89,
-  0x48,0x1A,0x90,0x49,0x1C,0x99,0x4C,0x1D,0x97,0x4B,0x1D,0x94,0x4B,0x1E,0x94,0x4A,
-  0x1E,0x94,0x4B,0x1D,0x97,0x4E,0x1F,0x8E,0x4A,0x1D,0x8A,0x4E,0x23,0x9C,0x62,0x40,
-  0xAE,0x82,0x6A,0xC8,0xB1,0xA1,0xE3,0xDD,0xD3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFC,0xFF,0xFF,0xFC,0xFE,0xFE,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFE,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFE,0xFE,0xFF,0xFD,0xFF,0xFF,0xFC,0xFE,
-  0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0xFC,0xF4,0xC9,0xB6,0xA7,0xA1,0x76,0x58,
-  0x8C,0x48,0x1F,0x9E,0x4E,0x21,0x9E,0x55,0x24,0x9F,0x57,0x28,0xA3,0x5B,0x2E,0xA2,
-  0x5D,0x30,0xA2,0x5D,0x32,0xA0,0x5D,0x32,0xA2,0x5D,0x31,0xA2,0x5E,0x30,0xA2,0x5D,
-  0x31,0xA2,0x5D,0x31,0xA5,0x5B,0x31,0xA5,0x5B,0x31,0xA5,0x5C,0x31,0x9F,0x59,0x2D,
-  0xA0,0x58,0x29,0x9A,0x54,0x21,0x96,0x4E,0x21,0x84,0x4A,0x27,0xB2,0x8C,0x72,0xDB,
-  0xCB,0xC2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,0xFB,0xFD,0xF8,0xFF,0xFF,
-  0xFC,0xFE,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFE,0xFF,0xFE,0xFE,0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xD9,0xDA,0xC8,0xA9,0x85,0x68,0x91,0x44,0x1E,0x95,0x52,0x23,0x9E,0x57,0x2E,
-  0xA7,0x5C,0x2F,0xA1,0x5D,0x30,0xA2,0x5C,0x32,0xA2,0x5D,0x32,0xA1,0x5C,0x32,0xA2,
-  0x5C,0x32,0xA2,0x5C,0x31,0xA2,0x5C,0x32,0xA2,0x5C,0x32,0xA2,0x5C,0x32,0xA2,0x5C,
-  0x32,0xA1,0x5D,0x32,0xA1,0x5D,0x32,0xA1,0x5D,0x32,0xA1,0x5C,0x31,0xA2,0x5D,0x32,
-  0xA1,0x5C,0x32,0xA2,0x5C,0x32,0xA4,0x5B,0x32,0xA7,0x5B,0x31,0x9F,0x54,0x2B,0x98,
-  0x50,0x1E,0x8B,0x4C,0x26,0xB5,0x95,0x81,0xF8,0xF5,0xEF,0xFF,0xFF,0xFF,0xFB,0xFF,
-  0xFF,0xFF,0xFF,0xFE,0xFE,0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFD,
-  0xFE,0xFF,0xF9,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE3,0xDA,0xD4,0xA1,0x6F,
-  0x51,0x98,0x49,0x1D,0x9F,0x55,0x2C,0x9E,0x5D,0x30,0xA8,0x5D,0x30,0xA5,0x5B,0x32,
-  0xA4,0x5B,0x34,0xA2,0x5D,0x31,0xA1,0x5C,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5C,0x31,0x9D,0x5D,0x32,0x9B,0x5E,0x31,0x9F,0x5E,0x30,0xA2,
-  0x5B,0x34,0xA7,0x5A,0x31,0x9D,0x56,0x27,0x86,0x48,0x18,0xA3,0x7C,0x62,0xF5,0xF3,
-  0xF0,0xFF,0xFF,0xFF,0xFB,0xFC,0xFD,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFE,0xFF,
-  0xFB,0xFD,0xFE,0xFF,0xFF,0xF5,0xF0,0xE7,0x9C,0x6E,0x55,0x91,0x48,0x1D,0xA6,0x57,
-  0x2A,0xA1,0x5C,0x33,0xA3,0x5D,0x30,0xA1,0x5C,0x33,0x9E,0x5C,0x32,0xA1,0x5D,0x31,
-  0xA1,0x5C,0x34,0xA3,0x5C,0x31,0xA1,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA1,0x5D,0x32,0xA7,0x5C,0x30,0xA2,0x5D,0x31,0xA4,0x5C,0x32,0xA3,
-  0x5D,0x30,0x9F,0x5E,0x31,0x9F,0x5D,0x32,0xA6,0x5B,0x31,0xA6,0x57,0x29,0x85,0x48,
-  0x1E,0xB1,0x91,0x7A,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFC,0xFD,0xFC,0xFF,0xFF,0xFD,
-  0xFE,0xFF,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFB,0xFF,0xFF,0xFA,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xC2,0xA4,0x96,0x85,0x43,0x19,0x9E,0x5A,0x2A,0xA1,0x5D,0x31,0xA1,0x5D,
-  0x32,0xA2,0x5D,0x31,0xA1,0x5C,0x32,0xA2,0x5D,0x31,0xA2,0x5D,0x31,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x31,0xA1,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,0x32,0xA1,0x5C,0x32,0xA1,0x5D,0x32,0xA1,
-  0x5D,0x32,0xA2,0x5C,0x32,0xA2,0x5D,0x31,0xA2,0x5B,0x32,0xA4,0x5B,0x33,0xA5,0x5B,
-  0x32,0xA3,0x53,0x27,0x85,0x4D,0x24,0xDB,0xCA,0xBD,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,
-  0xFF,0xFD,0xFF,0xFF,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFE,0xFC,0xFF,0xFF,0xFF,0xF7,0xF4,0xEC,0x94,
-  0x60,0x3F,0x96,0x50,0x1E,0xA6,0x5E,0x2F,0xA5,0x5B,0x32,0xA6,0x5B,0x31,0xA3,0x5D,
-  0x32,0xA1,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,0x31,0xA2,0x5B,0x33,0xA2,0x5B,0x34,0xA2,0x5B,
-  0x34,0xA0,0x5B,0x34,0xA4,0x5D,0x2C,0x92,0x48,0x18,0xA2,0x8B,0x6F,0xFF,0xFF,0xFF,
-  0xFE,0xFF,0xFF,0xF7,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFD,0xFE,0xFE,
-  0xFE,0xFF,0xFD,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xDD,0xD4,0xC8,0x84,0x47,0x23,0xA7,
-  0x59,0x25,0xA2,0x5C,0x34,0x9F,0x5C,0x32,0xA1,0x5D,0x30,0xA1,0x5D,0x32,0xA1,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5C,0x32,0xA1,0x5D,0x31,0xA1,0x5D,0x31,0xA1,0x5D,
-  0x31,0xA3,0x5D,0x32,0x9F,0x5D,0x32,0xA8,0x5C,0x31,0xA2,0x52,0x25,0x95,0x5D,0x3C,
-  0xF8,0xFA,0xF5,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFE,0xFE,0xF8,0xFE,0xFE,
-  0xFF,0xFD,0xFD,0xFF,0xFF,0xFF,0xBC,0xA6,0x97,0x91,0x46,0x1C,0xA5,0x5B,0x31,0xA1,
-  0x5B,0x33,0xA1,0x5D,0x31,0xA2,0x5D,0x31,0xA2,0x5C,0x32,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5C,0x32,0xA2,0x5C,0x32,0xA2,0x5C,
-  0x32,0xA1,0x5D,0x31,0xA2,0x5C,0x32,0xA1,0x5D,0x32,0xA1,0x5C,0x32,0x9E,0x59,0x29,
-  0x87,0x46,0x21,0xE9,0xE8,0xDE,0xFB,0xFF,0xFF,0xFB,0xFB,0xFC,0xFF,0xFE,0xFD,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFE,0xFD,0xFE,0xFE,0xFD,
-  0xFF,0xFF,0xFF,0xC0,0xA7,0x94,0x90,0x49,0x1C,0xAA,0x5D,0x2E,0x9D,0x5C,0x33,0xA1,
-  0x5C,0x33,0xA2,0x5D,0x31,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5C,0x32,0xA2,0x5C,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5C,0x32,0xA2,0x5D,0x32,0xA2,0x5C,0x32,0xA2,0x5D,0x32,0xA2,0x5C,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,
-  0x5D,0x32,0xA2,0x5C,0x32,0xA2,0x5D,0x31,0xA1,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5C,0x32,0xA6,0x5C,0x30,
-  0xA4,0x5C,0x2C,0x90,0x48,0x23,0xD4,0xC9,0xBD,0xFF,0xFF,0xFF,0xFB,0xFE,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xBF,0xA6,0x93,0x97,0x49,0x1C,0xA4,0x5C,0x31,0xA0,0x5C,0x34,0x9F,0x5D,0x31,0xA3,
-  0x5C,0x31,0xA1,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5C,0x32,0xA1,0x5D,0x31,0xA2,0x5C,0x30,0xA2,0x5C,
-  0x30,0xA2,0x5C,0x30,0xA2,0x5C,0x30,0xA2,0x5C,0x30,0xA2,0x5C,0x30,0xA2,0x5C,0x30,
-  0xA2,0x5C,0x30,0xA2,0x5C,0x30,0xA2,0x5C,0x30,0xA2,0x5C,0x30,0xA2,0x5C,0x30,0xA2,
-  0x5C,0x30,0xA1,0x5D,0x31,0xA1,0x5C,0x32,0xA2,0x5D,0x32,0xA1,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x31,0xA1,0x5D,0x32,0xA2,0x5B,0x34,
-  0xA3,0x5C,0x30,0xA3,0x5D,0x2E,0x8C,0x43,0x18,0xD7,0xD0,0xC3,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFC,0xFF,0xFF,0xFF,0xFE,0xFE,0xF8,0xFD,0xFC,0xFF,0xFF,0xFF,0xBB,0xA7,0x96,
-  0x95,0x48,0x1C,0xA2,0x5C,0x32,0xA1,0x5D,0x31,0xA2,0x5D,0x32,0xA2,0x5C,0x32,0xA1,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,0x31,0xA5,0x5A,0x30,0x90,0x4E,0x22,0x8F,0x4B,
-  0x28,0x94,0x4D,0x22,0x92,0x4C,0x26,0x92,0x4D,0x24,0x92,0x4C,0x26,0x92,0x4D,0x24,
-  0x92,0x4C,0x26,0x92,0x4C,0x25,0x92,0x4C,0x26,0x92,0x4C,0x26,0x92,0x4C,0x26,0x92,
-  0x4F,0x2B,0xA3,0x5D,0x2F,0xA2,0x5B,0x35,0xA3,0x5C,0x31,0xA1,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x31,0xA1,0x5D,0x31,
-  0xA2,0x5C,0x32,0xA0,0x5C,0x32,0xA3,0x5D,0x2F,0x90,0x49,0x24,0xE8,0xE7,0xDC,0xFF,
-  0xFF,0xFF,0xFF,0xFD,0xFE,0xFB,0xFF,0xFC,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFE,0xFF,0xFE,0xFD,0xFF,0xFF,0xFE,0xFF,0xFF,0xD9,0xCC,0xBD,0x92,0x47,0x1B,
-  0xA0,0x5E,0x2D,0xA3,0x5B,0x35,0xA1,0x5D,0x31,0xA2,0x5D,0x31,0xA1,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA3,0x5D,0x31,0x88,0x46,0x24,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,
-  0xE9,0xDF,0x93,0x4A,0x23,0xA7,0x5D,0x30,0x9E,0x5E,0x2F,0xA2,0x5C,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA1,0x5D,0x32,0xA2,0x5C,0x32,0xA3,0x5D,0x2F,0xA3,0x5B,0x2C,0x8C,0x4A,0x27,0xF7,
-  0xFD,0xF2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xF5,0xF2,0xE8,0x8D,0x49,0x1F,0xA7,0x5B,0x30,
-  0xA1,0x5C,0x33,0xA2,0x5C,0x32,0xA1,0x5D,0x31,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x31,0x8F,0x47,0x1D,0xFF,0xFF,0xFF,0xFE,0xFF,
-  0xFD,0xFD,0xFD,0xFF,0xFE,0xFC,0xFF,0xFE,0xFD,0xFF,0xFE,0xFC,0xFF,0xFE,0xFD,0xFF,
-  0xFE,0xFC,0xFF,0xFE,0xFD,0xFF,0xFC,0xFD,0xFF,0xFC,0xFE,0xFF,0xFF,0xFF,0xFF,0xE3,
-  0xDC,0xD6,0x95,0x4C,0x21,0xA7,0x5C,0x31,0x9E,0x5D,0x33,0xA2,0x5C,0x31,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA1,0x5C,0x32,0xA2,0x5D,0x31,0xA5,0x5C,0x2F,0x9E,0x58,0x2C,0x96,
-  0x60,0x43,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFB,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0x91,0x61,0x38,0xA2,0x58,0x2D,0xA0,0x5C,0x32,
-  0xA2,0x5C,0x33,0xA1,0x5D,0x31,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA3,0x5D,0x31,0x8A,0x48,0x1E,0xFF,0xFF,0xFF,0xFD,0xFE,
-  0xFF,0xFD,0xFF,0xFE,0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,
-  0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,0xFE,0xFF,0xFE,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xE6,
-  0xDC,0xD5,0x94,0x4C,0x1E,0xA5,0x5B,0x34,0xA1,0x5C,0x32,0xA2,0x5D,0x31,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5C,0x32,0xA1,0x5D,0x32,0xA2,0x5D,0x32,0x9E,
-  0x50,0x26,0xA9,0x94,0x7A,0xFF,0xFF,0xFF,0xFA,0xFD,0xFC,0xFD,0xFE,0xFE,0xFD,0xFF,
-  0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFD,0xFF,0xFD,0xFE,0xFD,
-  0xFF,0xFF,0xFF,0xFF,0xB9,0x9A,0x80,0x99,0x50,0x24,0xA0,0x5F,0x2F,0xA2,0x5C,0x32,
-  0xA2,0x5D,0x31,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA3,0x5D,0x31,0x8B,0x48,0x1E,0xFF,0xFF,0xFF,0xFC,0xFE,
-  0xFF,0xFE,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,
-  0xDC,0xD6,0x94,0x4B,0x1E,0xA4,0x5C,0x34,0xA1,0x5D,0x31,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,0x31,0xA6,
-  0x5C,0x31,0x90,0x47,0x18,0xE5,0xD4,0xC9,0xF8,0xFF,0xFF,0xFD,0xFE,0xFF,0xFC,0xFF,
-  0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFA,0xFF,0xFF,0xFE,0xFF,
-  0xFF,0xEE,0xE6,0xE2,0x88,0x46,0x19,0xA9,0x5B,0x31,0xA0,0x5D,0x32,0xA2,0x5C,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,0x32,0xA1,0x5D,0x32,0xA1,0x5C,0x32,0xA1,0x5C,
-  0x32,0xA1,0x5C,0x32,0xA1,0x5C,0x32,0xA1,0x5C,0x32,0xA1,0x5C,0x32,0xA1,0x5C,0x32,
-  0xA1,0x5C,0x32,0xA1,0x5C,0x32,0xA1,0x5C,0x32,0xA1,0x5C,0x32,0xA1,0x5C,0x32,0xA2,
-  0x5C,0x32,0xA2,0x5C,0x32,0xA3,0x5D,0x31,0x8B,0x48,0x1E,0xFF,0xFF,0xFF,0xFD,0xFE,
-  0xFE,0xFE,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,
-  0xDC,0xD6,0x94,0x4B,0x1E,0xA5,0x5B,0x34,0xA1,0x5D,0x31,0xA1,0x5C,0x32,0xA1,0x5C,
-  0x32,0xA1,0x5D,0x32,0xA1,0x5D,0x32,0xA1,0x5D,0x32,0xA1,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5C,0x32,0x9F,
-  0x5E,0x30,0xA2,0x5C,0x2A,0x8F,0x59,0x35,0xFF,0xFF,0xFF,0xFB,0xFE,0xFF,0xFD,0xFF,
-  0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,0xF8,0xFE,0xFE,0xFF,0xFF,
-  0xFF,0x99,0x6A,0x49,0x9F,0x58,0x2D,0xA1,0x5C,0x32,0xA1,0x5C,0x34,0xA2,0x5D,0x31,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,
-  0x5D,0x32,0xA1,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5C,0x32,0xA2,0x5C,0x32,0xA2,0x5C,
-  0x32,0xA2,0x5C,0x32,0xA2,0x5C,0x32,0xA2,0x5C,0x32,0xA2,0x5C,0x32,0xA2,0x5C,0x32,
-  0xA2,0x5C,0x32,0xA2,0x5C,0x32,0xA2,0x5C,0x32,0xA2,0x5C,0x32,0xA2,0x5C,0x32,0xA0,
-  0x5D,0x32,0xA1,0x5D,0x32,0xA2,0x5D,0x31,0x8C,0x47,0x1F,0xFF,0xFF,0xFF,0xFC,0xFE,
-  0xFF,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE6,
-  0xDD,0xD6,0x95,0x4E,0x20,0xA4,0x5B,0x33,0xA1,0x5D,0x31,0xA2,0x5C,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5C,0x32,0xA3,0x5C,0x32,0xA3,0x5C,0x32,0xA3,0x5C,0x32,0xA1,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,0x32,0xA4,
-  0x5C,0x31,0x9F,0x5B,0x32,0x9D,0x51,0x24,0xBB,0xA1,0x8E,0xFF,0xFF,0xFF,0xFC,0xFF,
-  0xFD,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xD8,0xC4,
-  0xBB,0x97,0x4D,0x1C,0xA2,0x5C,0x31,0xA2,0x5D,0x31,0xA2,0x5D,0x31,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,
-  0x5D,0x32,0xA1,0x5D,0x31,0xA4,0x5B,0x32,0xA2,0x5C,0x31,0xA0,0x5D,0x31,0xA0,0x5D,
-  0x31,0xA0,0x5D,0x31,0xA0,0x5D,0x31,0xA0,0x5D,0x31,0xA0,0x5D,0x31,0xA0,0x5D,0x31,
-  0xA0,0x5D,0x31,0xA0,0x5D,0x31,0xA0,0x5D,0x31,0xA0,0x5D,0x31,0xA0,0x5D,0x31,0x9F,
-  0x5D,0x32,0x9E,0x5D,0x31,0x9F,0x5D,0x31,0x8A,0x47,0x20,0xFF,0xFF,0xFF,0xFD,0xFE,
-  0xFF,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDD,
-  0xD2,0xCE,0x97,0x4F,0x22,0xA4,0x5A,0x35,0xA0,0x5D,0x31,0xA0,0x5D,0x31,0xA0,0x5D,
-  0x31,0xA2,0x5D,0x31,0xA3,0x5C,0x32,0xA3,0x5C,0x32,0xA3,0x5C,0x32,0xA1,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,
-  0x5D,0x32,0xA2,0x5D,0x31,0xA2,0x5C,0x2F,0x8D,0x4B,0x26,0xF7,0xFE,0xFB,0xFF,0xFF,
-  0xFF,0xFC,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFD,0xFD,0xF7,0xFE,0xFC,0xFF,0xFF,0xFF,0x91,0x5E,
-  0x40,0xA4,0x5B,0x2A,0xA1,0x5C,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,
-  0x5D,0x31,0xA4,0x5D,0x31,0xA6,0x5C,0x31,0xA7,0x5C,0x30,0xA7,0x5D,0x30,0xA7,0x5C,
-  0x30,0xA7,0x5D,0x30,0xA7,0x5C,0x30,0xA7,0x5D,0x30,0xA7,0x5C,0x30,0xA7,0x5D,0x30,
-  0xA7,0x5C,0x30,0xA7,0x5D,0x30,0xA7,0x5C,0x30,0xA7,0x5D,0x30,0xA7,0x5C,0x30,0xA5,
-  0x5D,0x32,0xA5,0x5D,0x31,0xA6,0x5C,0x30,0x89,0x45,0x1D,0xFF,0xFF,0xFF,0xFB,0xFE,
-  0xFF,0xFE,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,
-  0xD3,0xCE,0x9A,0x4F,0x21,0xA7,0x5B,0x33,0xA5,0x5E,0x30,0xA7,0x5D,0x31,0xA7,0x5C,
-  0x30,0xA5,0x5C,0x30,0xA4,0x5C,0x31,0xA2,0x5C,0x32,0xA3,0x5C,0x32,0xA1,0x5D,0x31,
-  0xA2,0x5D,0x32,0xA2,0x5C,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,0x32,0xA5,0x52,0x23,0xAE,0x97,0x7D,0xFF,0xFF,
-  0xFF,0xFB,0xFF,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFE,0xFE,0xFF,0xFF,0xFF,0xD5,0xC8,0xBB,0x99,0x4B,
-  0x21,0xA3,0x5D,0x32,0xA1,0x5C,0x31,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5C,0x32,0xA2,0x5C,0x32,0xA2,0x5D,0x31,0x9F,
-  0x52,0x2B,0x89,0x44,0x22,0x8F,0x45,0x20,0x8D,0x45,0x21,0x8E,0x45,0x1F,0x8E,0x45,
-  0x20,0x8E,0x45,0x20,0x8E,0x45,0x20,0x8E,0x45,0x20,0x8E,0x45,0x20,0x8E,0x45,0x20,
-  0x8E,0x45,0x20,0x8E,0x45,0x20,0x8E,0x45,0x20,0x8E,0x45,0x20,0x8E,0x45,0x20,0x8C,
-  0x47,0x1D,0x8F,0x46,0x1F,0x8C,0x46,0x1D,0x8C,0x51,0x31,0xFF,0xFF,0xFF,0xFE,0xFD,
-  0xFE,0xF9,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD9,
-  0xCC,0xC3,0x7C,0x39,0x11,0x8A,0x45,0x20,0x8C,0x46,0x1F,0x8E,0x45,0x20,0x8E,0x45,
-  0x20,0x8E,0x46,0x1F,0x88,0x48,0x23,0xA8,0x5D,0x2E,0xA0,0x5D,0x31,0xA2,0x5C,0x32,
-  0xA2,0x5D,0x31,0xA2,0x5D,0x31,0xA2,0x5C,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5C,0x32,0xA6,0x5C,0x30,0x8E,0x4C,0x21,0xFA,0xFF,
-  0xFD,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFE,0xFE,0xFF,0xFF,0xFF,0xA1,0x77,0x57,0x9F,0x59,
-  0x2B,0xA2,0x5B,0x31,0xA1,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5C,0x32,0xA2,0x5D,0x31,0xA2,0x5D,0x31,0x9E,0x56,0x28,0xBA,
-  0x95,0x7C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xF5,0xF9,0xFD,0xEC,0xEA,0xEB,0xFF,0xFF,0xFF,0xF7,0xFD,0xFE,0xFA,0xFE,
-  0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,
-  0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFE,0xFD,0xF6,0x92,0x48,0x1D,0xA6,0x5B,0x33,0xA1,0x5B,0x34,
-  0xA2,0x5D,0x31,0xA2,0x5E,0x30,0xA2,0x5C,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,0x31,0xA1,0x5C,0x32,0x9D,0x51,0x25,0xC4,0xAF,
-  0x9D,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xED,0xF4,0xEE,0x96,0x45,0x1A,0x9D,0x5F,
-  0x2D,0xA4,0x5A,0x35,0xA1,0x5D,0x31,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5C,0x32,0xA2,0x5D,0x31,0xA2,0x5D,0x31,0x9E,0x56,0x27,0xBB,
-  0x94,0x7B,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFE,0xFB,0xFF,0xFF,0xCD,0xC7,0xBC,0xA7,0x89,0x7D,0xFF,0xFF,0xFF,0xF9,0xFF,
-  0xFF,0xFC,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,
-  0xFF,0xFD,0xFF,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xF8,0xFA,0xFA,0x8C,0x49,0x1B,0xA6,0x5F,0x2D,0xA1,0x5B,0x34,
-  0xA2,0x5D,0x31,0xA2,0x5E,0x30,0xA2,0x5C,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5C,0x32,0xA0,0x5E,0x2F,0xA7,0x59,0x2F,0x96,0x5A,
-  0x38,0xFF,0xFF,0xFF,0xFD,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,
-  0xFF,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xC5,0xAB,0x93,0xA1,0x51,0x24,0xA3,0x5B,
-  0x34,0x9F,0x5D,0x31,0xA2,0x5C,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5C,0x32,0xA2,0x5C,0x32,0x9E,0x55,0x28,0xBD,
-  0x94,0x7C,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0xFD,0xFD,0xFF,0xFE,0xFD,0xFE,
-  0xFE,0xFD,0xFF,0xFE,0xFD,0xFE,0xFE,0xFD,0xFF,0xFE,0xFD,0xFE,0xFE,0xFD,0xFF,0xFE,
-  0xFD,0xFE,0xFE,0xFD,0xFF,0xFE,0xFD,0xFE,0xFE,0xFD,0xFF,0xFE,0xFD,0xFE,0xFE,0xFD,
-  0xFE,0xFE,0xFD,0xFE,0xFF,0xFF,0xFF,0xFF,0xDF,0xCC,0xBB,0x86,0x4D,0x35,0xFF,0xFF,
-  0xFC,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFF,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,
-  0xFF,0xFE,0xFE,0xFD,0xFF,0xFA,0xFF,0xFE,0xFE,0xFF,0xFD,0xFD,0xFF,0xFE,0xFD,0xFE,
-  0xFE,0xFF,0xFF,0xFF,0xF9,0xFA,0xF7,0x8C,0x47,0x1C,0xA5,0x5C,0x30,0xA1,0x5B,0x34,
-  0xA2,0x5D,0x31,0xA2,0x5E,0x30,0xA2,0x5C,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,0x31,0xA3,0x5B,0x32,0x9E,0x5D,0x33,0x9A,0x49,
-  0x19,0xE6,0xE1,0xDC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,
-  0xFF,0xFE,0xFF,0xFD,0xFE,0xFF,0xFF,0xFF,0x9C,0x66,0x44,0xA3,0x59,0x2E,0xA3,0x5C,
-  0x31,0xA0,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5C,0x32,0xA2,0x5C,0x32,0x9E,0x55,0x28,0xB8,
-  0x91,0x77,0xFF,0xFF,0xFF,0xFE,0xFF,0xFC,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0x99,0x81,0x86,0x4B,
-  0x2C,0xFD,0xFF,0xFF,0xF7,0xFF,0xFF,0xFE,0xFE,0xFD,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xF8,0xFA,0xF6,0x8C,0x48,0x1B,0xA5,0x5D,0x30,0xA1,0x5B,0x34,
-  0xA2,0x5D,0x31,0xA2,0x5E,0x30,0xA2,0x5C,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,0x31,0xA2,0x5D,0x33,0xA2,0x5E,0x2F,0x9A,0x54,
-  0x2A,0xBA,0x9F,0x8B,0xFF,0xFF,0xFF,0xFC,0xFD,0xFF,0xFB,0xFF,0xFE,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,
-  0xFF,0xFE,0xFF,0xFF,0xFF,0xF3,0xF2,0xE9,0x8A,0x46,0x1E,0xA3,0x5D,0x32,0xA1,0x5D,
-  0x31,0xA2,0x5D,0x32,0xA1,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5C,0x32,0xA2,0x5E,0x30,0xA2,0x5E,0x30,0x9F,0x57,0x27,0xB2,
-  0x8A,0x71,0xFF,0xFF,0xFF,0xFE,0xFF,0xFC,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFD,0xFF,0xFF,0xFF,0x8E,0x4F,
-  0x1A,0x99,0x5A,0x42,0xFF,0xFF,0xFF,0xFE,0xFD,0xFF,0xFB,0xFE,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xF9,0xFA,0xF6,0x8C,0x48,0x1C,0xA5,0x5D,0x30,0xA1,0x5B,0x34,
-  0xA2,0x5D,0x31,0xA2,0x5E,0x30,0xA2,0x5C,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x31,0xA1,0x5C,0x33,0xA1,0x5D,0x31,0xA7,0x57,
-  0x2E,0x91,0x5F,0x3E,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xCE,0xC1,0xB1,0x9F,0x4E,0x21,0xA0,0x5D,0x32,0xA0,0x5D,
-  0x32,0xA3,0x5B,0x32,0xA1,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5C,0x32,0xA2,0x5C,0x32,0x9F,0x56,0x29,0xB3,
-  0x8B,0x72,0xFF,0xFF,0xFF,0xFE,0xFF,0xFC,0xFD,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0xFF,0xFF,0xFF,0xFF,0xFF,0xBD,0x9F,
-  0x90,0x98,0x48,0x1A,0xB7,0x8F,0x78,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xF9,0xFA,0xF6,0x8C,0x48,0x1C,0xA5,0x5C,0x30,0xA1,0x5B,0x34,
-  0xA2,0x5D,0x31,0xA2,0x5E,0x30,0xA2,0x5C,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,0x31,0xA4,0x5B,0x33,0x9F,0x5B,0x34,0xA7,0x5E,
-  0x31,0x84,0x47,0x16,0xF7,0xF7,0xF4,0xFF,0xFE,0xFE,0xFD,0xFD,0xFD,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFE,0xFF,0xFF,0xFF,0xFF,0xB3,0x8C,0x78,0xA1,0x58,0x28,0xA1,0x5C,0x32,0xA2,0x5D,
-  0x32,0xA1,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0x9F,0x56,0x29,0xB3,
-  0x8B,0x72,0xFF,0xFF,0xFF,0xFD,0xFF,0xFD,0xFE,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,
-  0xFE,0xFF,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFB,0xFE,0xFE,0xFF,0xFF,0xFF,0xE6,0xDF,
-  0xD3,0x94,0x4C,0x21,0x8E,0x47,0x1A,0xEA,0xE0,0xD8,0xFB,0xFF,0xFF,0xFE,0xFF,0xFC,
-  0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xF9,0xFA,0xF7,0x8C,0x48,0x1B,0xA5,0x5D,0x30,0xA1,0x5B,0x34,
-  0xA2,0x5D,0x31,0xA2,0x5E,0x30,0xA2,0x5C,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,0x31,0xA2,0x5D,0x31,0xA1,0x5C,
-  0x31,0x99,0x52,0x21,0xD7,0xCB,0xC0,0xFD,0xFF,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFD,0xFF,0xFF,0xFF,0xFF,0xA2,0x6D,0x47,0xA0,0x59,0x28,0xA2,0x5C,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0x9F,0x56,0x29,0xB3,
-  0x8C,0x73,0xFF,0xFF,0xFF,0xFD,0xFF,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFE,0xFF,0xFC,0xFE,0xFF,0xFD,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0x89,0x4D,0x27,0xA4,0x5C,0x26,0x9B,0x69,0x45,0xFF,0xFF,0xFF,0xFE,0xFF,0xFD,
-  0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xF9,0xFA,0xF6,0x8C,0x48,0x1C,0xA5,0x5D,0x30,0xA1,0x5B,0x34,
-  0xA2,0x5D,0x31,0xA2,0x5E,0x30,0xA2,0x5C,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5C,
-  0x32,0xA0,0x54,0x25,0xBF,0xA5,0x92,0xFF,0xFF,0xFF,0xFC,0xFE,0xFE,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,
-  0xFE,0xFB,0xFF,0xFF,0xFF,0x91,0x4D,0x23,0xA1,0x5C,0x30,0xA2,0x5C,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA0,0x58,0x2B,0xAB,
-  0x7B,0x5A,0xFF,0xFF,0xFF,0xFC,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,
-  0xFE,0xFF,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0xD3,0xC6,0xC5,0x9F,0x86,0xA6,0x80,
-  0x63,0xA0,0x5C,0x2F,0xA3,0x5D,0x31,0x8D,0x49,0x19,0xE6,0xE0,0xD8,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xF9,0xFA,0xF7,0x8C,0x48,0x1B,0xA5,0x5D,0x30,0xA1,0x5B,0x34,
-  0xA2,0x5D,0x31,0xA2,0x5E,0x30,0xA2,0x5C,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,
-  0x32,0xA2,0x56,0x29,0xA6,0x7F,0x63,0xFE,0xFF,0xFF,0xFE,0xFF,0xFD,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,
-  0xFF,0xFF,0xF3,0xF6,0xEE,0x8B,0x49,0x1C,0xA3,0x5C,0x34,0xA2,0x5D,0x31,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5C,0x30,0x8A,
-  0x4E,0x23,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFD,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xF8,0xF9,0xF1,0x98,0x65,0x48,0x94,0x48,0x1F,0xA0,0x53,0x26,0xA0,0x58,
-  0x2A,0xA5,0x5C,0x31,0x9D,0x5D,0x31,0xA0,0x57,0x2B,0xB2,0x8D,0x73,0xFF,0xFF,0xFF,
-  0xFE,0xFE,0xFD,0xF9,0xFD,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0x8E,0x47,0x1C,0xA3,0x5F,0x2D,0xA1,0x5C,0x32,
-  0xA2,0x5D,0x31,0xA2,0x5D,0x31,0xA2,0x5C,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,
-  0x32,0xA1,0x5A,0x2E,0x9D,0x61,0x3C,0xFF,0xFF,0xFF,0xFC,0xFF,0xFC,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,
-  0xFF,0xFF,0xEB,0xE7,0xDE,0x95,0x4B,0x1F,0xA4,0x5C,0x32,0xA1,0x5D,0x31,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x31,0x98,
-  0x4F,0x24,0xCB,0xB1,0xA0,0xFB,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,
-  0xFF,0xFE,0x8C,0x57,0x2F,0xA3,0x56,0x25,0xA3,0x5C,0x32,0xA1,0x5D,0x31,0xA1,0x5C,
-  0x32,0xA2,0x5C,0x32,0xA0,0x5E,0x30,0xA1,0x5B,0x30,0x8F,0x56,0x35,0xFF,0xFF,0xFF,
-  0xFE,0xFE,0xFD,0xFB,0xFE,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEC,
-  0xEB,0xEB,0xC0,0xA2,0x92,0xC6,0xAB,0x99,0xC6,0xAB,0x9B,0xC4,0xAC,0x9A,0xC5,0xAB,
-  0x9B,0xC3,0xAC,0x9B,0xC2,0xAB,0x97,0x99,0x51,0x28,0xA4,0x5B,0x32,0xA1,0x5D,0x31,
-  0xA2,0x5D,0x32,0xA2,0x5C,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,
-  0x31,0xA3,0x5C,0x30,0x94,0x50,0x28,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFE,0xFD,0xFF,
-  0xFF,0xFF,0xF0,0xE8,0xE1,0x96,0x4B,0x20,0xA3,0x5B,0x33,0xA1,0x5D,0x31,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,0x31,0xA3,
-  0x5B,0x30,0x8B,0x48,0x22,0xFA,0xF4,0xE8,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBB,
-  0xA5,0x92,0x9A,0x4F,0x25,0x9F,0x5E,0x30,0xA4,0x5B,0x35,0xA1,0x5D,0x31,0xA2,0x5C,
-  0x32,0x9F,0x5D,0x32,0xA6,0x5C,0x31,0x9F,0x5D,0x32,0x8F,0x44,0x1F,0xFE,0xFF,0xFD,
-  0xFF,0xFF,0xFF,0xFD,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE1,
-  0xDA,0xD0,0x95,0x45,0x11,0x98,0x53,0x26,0x9E,0x53,0x22,0x9C,0x53,0x24,0x9D,0x52,
-  0x23,0x9E,0x53,0x22,0xA3,0x51,0x29,0xA2,0x5F,0x2E,0xA0,0x5D,0x30,0xA2,0x5C,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,
-  0x31,0xA3,0x5C,0x33,0x88,0x45,0x1B,0xFF,0xFF,0xFF,0xFC,0xFF,0xFD,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,
-  0xFF,0xFF,0xEE,0xE8,0xE1,0x97,0x4B,0x20,0xA2,0x5D,0x32,0xA2,0x5D,0x31,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5C,0x32,0xA0,
-  0x5D,0x31,0xA3,0x59,0x2D,0x92,0x5B,0x3E,0xFF,0xFF,0xFF,0xFE,0xFE,0xFF,0xFF,0xFF,
-  0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFD,0xFE,0xFE,0xFF,0xFF,0xFF,0x9C,
-  0x65,0x41,0xA3,0x59,0x2C,0x9E,0x5D,0x32,0xA7,0x5C,0x30,0xA1,0x5D,0x32,0xA2,0x5C,
-  0x32,0xA1,0x5E,0x31,0xA3,0x5C,0x31,0xA1,0x5C,0x33,0x97,0x46,0x1C,0xF2,0xF4,0xEF,
-  0xFD,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE4,
-  0xDB,0xD7,0x9C,0x4D,0x1E,0xA4,0x5B,0x34,0xA3,0x5D,0x31,0xA3,0x5C,0x32,0xA3,0x5C,
-  0x33,0xA1,0x5D,0x31,0xA0,0x5C,0x33,0x9F,0x5D,0x32,0xA4,0x5B,0x34,0xA1,0x5D,0x31,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5C,
-  0x31,0xA2,0x5E,0x32,0x8B,0x46,0x1C,0xFF,0xFF,0xFF,0xFC,0xFF,0xFE,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFF,
-  0xFF,0xFF,0xEE,0xE8,0xE1,0x99,0x4A,0x20,0xA2,0x5D,0x31,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5C,0x32,0xA0,
-  0x5D,0x32,0xA0,0x5D,0x31,0xA2,0x52,0x26,0xB6,0x89,0x76,0xFF,0xFF,0xFF,0xFE,0xFA,
-  0xFF,0xFC,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFE,0xFD,0xFE,0xFF,0xFF,0xFF,0x8C,
-  0x4C,0x2B,0xA9,0x5C,0x2F,0x9F,0x5C,0x34,0xA2,0x5E,0x30,0xA1,0x5C,0x32,0xA2,0x5C,
-  0x32,0xA2,0x5D,0x31,0xA2,0x5D,0x32,0xA4,0x5B,0x32,0x8F,0x46,0x1D,0xF4,0xF8,0xF4,
-  0xFD,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,
-  0xDC,0xD7,0x95,0x4D,0x20,0xA4,0x5B,0x34,0xA2,0x5D,0x32,0xA3,0x5C,0x33,0xA3,0x5C,
-  0x33,0xA2,0x5C,0x32,0xA1,0x5D,0x31,0xA2,0x5D,0x31,0xA1,0x5D,0x31,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5C,
-  0x32,0xA1,0x5E,0x31,0x8D,0x45,0x1C,0xFF,0xFF,0xFF,0xFE,0xFE,0xFD,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFF,
-  0xFF,0xFF,0xEE,0xE8,0xE1,0x99,0x4A,0x20,0xA2,0x5D,0x31,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,0x32,0xA6,
-  0x5C,0x30,0xA0,0x5C,0x34,0x99,0x61,0x2C,0x91,0x48,0x1D,0xDA,0xC6,0xB6,0xFF,0xFF,
-  0xFF,0xFB,0xFE,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFD,0xFE,0xFE,0xFF,0xFF,0xFF,0x9A,
-  0x66,0x49,0xA3,0x59,0x2A,0xA0,0x5C,0x33,0xA2,0x5D,0x31,0xA1,0x5D,0x31,0xA2,0x5D,
-  0x31,0xA1,0x5D,0x31,0xA5,0x5C,0x30,0xA4,0x5C,0x32,0x89,0x4B,0x27,0xFF,0xFF,0xFF,
-  0xFF,0xFD,0xFE,0xFB,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,
-  0xDC,0xD6,0x94,0x4B,0x1E,0xA4,0x5C,0x34,0xA2,0x5D,0x31,0xA3,0x5C,0x31,0xA3,0x5C,
-  0x31,0xA2,0x5C,0x31,0xA1,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5C,
-  0x32,0xA1,0x5E,0x31,0x8D,0x45,0x1C,0xFF,0xFF,0xFF,0xFE,0xFE,0xFD,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,
-  0xFF,0xFF,0xEE,0xE7,0xE3,0x97,0x4B,0x20,0xA2,0x5D,0x31,0xA2,0x5C,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5C,0x32,0x9D,
-  0x5E,0x31,0xA7,0x5A,0x34,0xA4,0x5C,0x31,0xA8,0x5C,0x2D,0x8B,0x46,0x22,0xF5,0xF8,
-  0xED,0xFD,0xFF,0xFF,0xFF,0xFF,0xFE,0xFB,0xFF,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,0xFE,0xFD,0xFF,0xFF,0xC0,
-  0xA4,0x90,0x97,0x52,0x24,0xA5,0x5C,0x31,0xA3,0x5C,0x32,0xA2,0x5C,0x32,0xA1,0x5C,
-  0x33,0xA4,0x5B,0x34,0xA2,0x5D,0x31,0x9E,0x57,0x27,0xAA,0x7E,0x64,0xFF,0xFF,0xFF,
-  0xFE,0xFD,0xFE,0xFB,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,
-  0xDC,0xD6,0x94,0x4B,0x1E,0xA4,0x5A,0x34,0xA2,0x5D,0x30,0xA3,0x5D,0x31,0xA3,0x5D,
-  0x31,0xA2,0x5D,0x31,0xA1,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5C,
-  0x32,0xA2,0x5E,0x31,0x8C,0x45,0x1C,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,
-  0xFF,0xFF,0xEF,0xE6,0xE4,0x96,0x4A,0x20,0xA2,0x5D,0x30,0xA1,0x5C,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5C,0x32,0xA1,0x5D,0x31,0xA1,0x5D,0x31,0xA0,0x5B,0x33,0xA1,0x5C,0x2A,0x91,0x5D,
-  0x40,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFC,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0x91,0x54,0x35,0xAA,0x56,0x25,0xA1,0x5E,0x32,0xA0,0x5C,0x32,0xA0,0x5B,
-  0x34,0x9E,0x5D,0x32,0xA0,0x5E,0x2C,0x91,0x43,0x18,0xE9,0xE7,0xDE,0xFE,0xFF,0xFF,
-  0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,
-  0xDC,0xD6,0x94,0x4B,0x1E,0xA5,0x5C,0x34,0xA1,0x5D,0x31,0xA1,0x5D,0x32,0xA1,0x5D,
-  0x32,0xA1,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x31,0xA3,0x5D,0x32,0x88,0x45,0x1A,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFE,0xFE,0xFF,
-  0xFF,0xFF,0xEE,0xE6,0xE2,0x96,0x4B,0x20,0xA5,0x5D,0x30,0xA1,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x31,0xA0,0x5C,0x35,0xA6,0x5E,0x2C,0x9F,0x52,
-  0x25,0xB1,0x8E,0x78,0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,0xFB,0xFF,0xFD,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFC,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFA,0xFE,0xF1,0x90,0x63,0x44,0x94,0x47,0x21,0x9E,0x54,0x24,0xA1,0x54,
-  0x25,0xA5,0x50,0x24,0x88,0x41,0x20,0xD5,0xC6,0xB2,0xFF,0xFF,0xFF,0xFC,0xFF,0xFF,
-  0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,
-  0xDC,0xD6,0x94,0x4B,0x1E,0xA5,0x5C,0x34,0xA1,0x5D,0x31,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5C,
-  0x31,0xA2,0x5C,0x30,0x90,0x51,0x28,0xFF,0xFF,0xFF,0xFD,0xFE,0xFE,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,
-  0xFF,0xFF,0xF6,0xF6,0xF2,0x8D,0x48,0x1C,0xA4,0x5E,0x31,0xA1,0x5C,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5C,0x32,0xA6,0x5D,0x2E,0x9B,0x5D,0x33,0xA4,0x5A,
-  0x34,0x96,0x47,0x1E,0xD4,0xC9,0xB8,0xFF,0xFF,0xFF,0xFE,0xFE,0xFD,0xFE,0xFF,0xFF,
-  0xFE,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFD,0xFF,0xFF,0xFB,
-  0xFF,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDD,0xD1,0xC6,0xBE,0xA2,0x8D,0xBC,0x9B,
-  0x84,0xC3,0xB3,0xA1,0xFD,0xFE,0xFA,0xFF,0xFF,0xFF,0xFD,0xFC,0xFE,0xFD,0xFF,0xFF,
-  0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,
-  0xDC,0xD6,0x94,0x4B,0x1E,0xA5,0x5A,0x34,0xA1,0x5D,0x31,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5C,
-  0x32,0xA1,0x5A,0x2D,0x9E,0x63,0x3B,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,
-  0xFE,0xFE,0xFF,0xFF,0xFF,0x93,0x4D,0x25,0xA0,0x5B,0x2F,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5C,0x32,0xA2,0x5C,0x31,0xA1,0x5D,
-  0x31,0xA0,0x5C,0x2D,0x91,0x47,0x27,0xF8,0xF7,0xF0,0xFE,0xFF,0xFF,0xFD,0xFF,0xFF,
-  0xFC,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,0xFF,0xF9,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,
-  0xDC,0xD6,0x94,0x4B,0x1E,0xA5,0x5C,0x34,0xA1,0x5D,0x31,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5C,
-  0x32,0x9F,0x58,0x28,0xAD,0x7E,0x62,0xFD,0xFF,0xFF,0xFF,0xFD,0xFE,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,
-  0xFE,0xFF,0xFF,0xFF,0xFF,0xA2,0x67,0x4C,0xA4,0x5A,0x2C,0xA1,0x5C,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,
-  0x31,0xA3,0x5C,0x33,0xA5,0x58,0x29,0x9B,0x61,0x42,0xFF,0xFF,0xFF,0xFB,0xFE,0xFE,
-  0xFD,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFB,0xFD,
-  0xFD,0xFD,0xFE,0xFE,0xFD,0xFF,0xFF,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,
-  0xDC,0xD6,0x94,0x4B,0x1E,0xA5,0x5C,0x34,0xA1,0x5D,0x31,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,0x31,0xA1,0x5D,
-  0x32,0x9E,0x53,0x24,0xBE,0xA5,0x92,0xFF,0xFF,0xFF,0xFD,0xFE,0xFE,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,
-  0xFC,0xFF,0xFF,0xFF,0xFF,0xB5,0x8C,0x7C,0xA0,0x57,0x26,0xA1,0x5C,0x32,0xA1,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,
-  0x31,0xA3,0x5B,0x35,0x9D,0x5E,0x30,0x9B,0x52,0x24,0xB4,0x90,0x7A,0xFF,0xFF,0xFF,
-  0xFC,0xFE,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,
-  0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,
-  0xDC,0xD6,0x94,0x4B,0x1E,0xA5,0x5B,0x34,0xA1,0x5D,0x31,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5C,0x32,0xA2,0x5C,0x31,0xA1,0x5D,
-  0x31,0x9F,0x4F,0x21,0xD7,0xCB,0xC1,0xFF,0xFF,0xFF,0xFB,0xFD,0xFE,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFE,0xFF,0xFF,0xFF,0xC7,0xBF,0xAF,0x9E,0x50,0x23,0xA3,0x5D,0x31,0xA4,0x5B,
-  0x32,0xA1,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,
-  0x31,0xA2,0x5D,0x32,0xA3,0x5C,0x32,0xA2,0x5D,0x31,0x90,0x47,0x1E,0xDF,0xCC,0xC0,
-  0xFB,0xFF,0xFF,0xFF,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,
-  0xDC,0xD6,0x94,0x4B,0x1E,0xA5,0x5B,0x34,0xA1,0x5D,0x31,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5C,0x32,0x9E,0x5E,0x30,0xA8,0x59,0x36,0x9F,0x60,
-  0x2E,0x8C,0x43,0x1F,0xF8,0xF8,0xF2,0xFD,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0xF3,0xE9,0x89,0x46,0x20,0xA4,0x5D,0x31,0xA4,0x5B,
-  0x32,0xA1,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,
-  0x32,0xA3,0x5D,0x31,0xA3,0x5D,0x32,0xA1,0x5D,0x32,0xA4,0x5B,0x2E,0x8C,0x4A,0x24,
-  0xFE,0xF9,0xF8,0xFC,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,
-  0xDC,0xD6,0x94,0x4B,0x1E,0xA5,0x5C,0x34,0xA1,0x5D,0x31,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,0x32,0xA4,0x5C,0x30,0xA0,0x5C,0x33,0xA0,0x5B,
-  0x2C,0x97,0x5C,0x41,0xFF,0xFF,0xFF,0xFB,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,
-  0xFD,0xFF,0xFC,0xFE,0xFE,0xFF,0xFF,0xFF,0x9A,0x66,0x44,0xA0,0x59,0x2E,0xA5,0x5B,
-  0x32,0xA1,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,
-  0x32,0xA3,0x5D,0x32,0xA3,0x5D,0x32,0xA2,0x5C,0x32,0x9F,0x5D,0x31,0xA2,0x57,0x2A,
-  0x94,0x64,0x44,0xFF,0xFF,0xFF,0xFE,0xFE,0xFF,0xFD,0xFD,0xFD,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,
-  0xDC,0xD6,0x94,0x4B,0x1E,0xA5,0x5B,0x34,0xA1,0x5D,0x31,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5C,0x32,0xA3,0x5D,0x30,0xA3,0x5D,0x31,0x9D,0x52,
-  0x27,0xBB,0xA3,0x8C,0xFF,0xFF,0xFF,0xFD,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFD,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xA7,0x93,0xAA,0x52,0x25,0x9B,0x5E,
-  0x30,0xA3,0x5C,0x32,0xA1,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x31,0xA0,0x5D,0x33,0xA0,0x5C,0x32,
-  0x9E,0x50,0x24,0xB4,0x95,0x82,0xFF,0xFF,0xFF,0xFC,0xFD,0xFC,0xFC,0xFF,0xFF,0xFE,
-  0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,
-  0xDC,0xD6,0x94,0x4B,0x1E,0xA5,0x5B,0x34,0xA1,0x5D,0x31,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,0x31,0xA3,0x5B,0x34,0xA1,0x5C,0x32,0x95,0x4C,
-  0x16,0xE5,0xE4,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFE,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xF4,0xF6,0xEC,0x90,0x47,0x1E,0xA7,0x5C,
-  0x30,0xA1,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA1,0x5D,0x32,0xA1,0x5D,0x32,0xA1,0x5D,0x31,0xA4,0x5B,0x32,0xA5,0x5B,0x33,
-  0xA4,0x5F,0x2F,0x8D,0x45,0x1D,0xE0,0xCF,0xC1,0xFC,0xFF,0xFF,0xFF,0xFD,0xFE,0xFD,
-  0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,
-  0xDC,0xD6,0x94,0x4B,0x1E,0xA5,0x5C,0x34,0xA1,0x5D,0x31,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5C,0x31,0x9C,0x5D,0x32,0xA8,0x58,0x30,0x92,0x5D,
-  0x36,0xFF,0xFF,0xFF,0xFC,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFD,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0x9E,0x76,0x55,0xA3,0x57,
-  0x2C,0xA4,0x5C,0x31,0xA1,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,0x32,0xA2,0x5C,0x31,0x9D,0x5D,0x33,
-  0xA1,0x5C,0x32,0xA5,0x5E,0x29,0x90,0x4B,0x26,0xFF,0xFC,0xF7,0xF4,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,
-  0xDC,0xD6,0x94,0x4B,0x1E,0xA5,0x5B,0x34,0xA1,0x5D,0x31,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5C,0x32,0xA0,0x5D,0x31,0xA2,0x4F,0x27,0xC0,0xB1,
-  0x9F,0xFF,0xFF,0xFF,0xFD,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFE,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xD7,0xCA,0xBA,0x96,0x4B,
-  0x1F,0xA0,0x5B,0x35,0xA2,0x5D,0x31,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,0x31,0xA2,0x5D,0x32,
-  0xA7,0x5B,0x33,0xA4,0x5D,0x2F,0x9B,0x58,0x2A,0x9B,0x64,0x47,0xFF,0xFF,0xFF,0xFE,
-  0xFD,0xFE,0xFF,0xFF,0xFE,0xFC,0xFF,0xFD,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,
-  0xDC,0xD6,0x94,0x4B,0x1E,0xA5,0x5B,0x34,0xA1,0x5D,0x31,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,0x32,0xA3,
-  0x5C,0x32,0xA1,0x5D,0x32,0xA0,0x5D,0x32,0xA6,0x5A,0x2F,0x8C,0x4D,0x22,0xFF,0xFF,
-  0xFD,0xFC,0xFF,0xFF,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0x96,0x5E,
-  0x3A,0xA1,0x5C,0x27,0xA2,0x5C,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,0x31,
-  0xA1,0x5D,0x31,0xA1,0x5C,0x32,0xA1,0x5D,0x32,0x9D,0x4E,0x25,0xBC,0x9A,0x89,0xFF,
-  0xFF,0xFF,0xFE,0xFD,0xFF,0xFD,0xFF,0xFB,0xFD,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,
-  0xDC,0xD6,0x94,0x4B,0x1E,0xA5,0x5C,0x34,0xA1,0x5D,0x31,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,0x32,0xA4,
-  0x5B,0x32,0xA1,0x5D,0x32,0xA0,0x5C,0x31,0xA2,0x55,0x26,0xB3,0x94,0x78,0xFF,0xFF,
-  0xFF,0xFE,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,0xFF,0xFE,0xFF,0xFF,0xD3,0xC8,
-  0xBA,0x98,0x4E,0x1C,0xA2,0x5C,0x32,0xA1,0x5D,0x31,0xA1,0x5C,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x31,0xA0,0x5C,0x34,0xA8,0x5C,0x2D,0x8F,0x45,0x1D,0xE4,
-  0xD7,0xC6,0xFE,0xFF,0xFF,0xFF,0xFE,0xFC,0xFC,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,
-  0xDC,0xD6,0x94,0x4B,0x1E,0xA5,0x5C,0x34,0xA1,0x5D,0x31,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,0x32,0xA4,
-  0x5B,0x31,0xA1,0x5D,0x31,0xA2,0x5C,0x30,0x89,0x49,0x25,0xFF,0xFF,0xFE,0xFC,0xFF,
-  0xFF,0xFF,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFC,0xFF,0xFC,0xFF,0xFF,
-  0xFF,0x9D,0x63,0x4B,0x9D,0x5A,0x2A,0xA2,0x5C,0x35,0xA2,0x5D,0x30,0xA1,0x5C,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA1,0x5D,0x31,0xA4,0x5C,0x32,0x9E,0x5E,0x2F,0xA4,0x5D,0x30,0x91,
-  0x4B,0x27,0xFA,0xFF,0xF6,0xFA,0xFF,0xFF,0xFF,0xFE,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,
-  0xDC,0xD6,0x94,0x4B,0x1E,0xA5,0x5A,0x34,0xA1,0x5D,0x31,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,0x31,0xA4,
-  0x5C,0x32,0xA5,0x5B,0x32,0x97,0x52,0x22,0xC2,0x9D,0x8E,0xFC,0xFF,0xFF,0xFF,0xFF,
-  0xFA,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0xFD,0xFC,0xFF,0xFF,
-  0xFF,0xED,0xE8,0xDF,0x8F,0x45,0x1A,0xA3,0x5C,0x2E,0xA1,0x5C,0x32,0xA2,0x5D,0x31,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,0x31,0xA2,0x5C,0x32,0xA1,0x5D,0x31,0x9F,
-  0x55,0x2C,0x9C,0x6B,0x4A,0xFF,0xFF,0xFF,0xFA,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,
-  0xDC,0xD6,0x94,0x4B,0x1E,0xA5,0x5C,0x34,0xA1,0x5D,0x31,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x31,0xA0,
-  0x5C,0x33,0x9D,0x5C,0x2B,0x90,0x5A,0x34,0xFF,0xFF,0xFF,0xFE,0xFE,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFC,0xFE,
-  0xFD,0xFF,0xFF,0xFF,0xB9,0x9A,0x86,0x9F,0x53,0x22,0xA1,0x5B,0x35,0xA2,0x5D,0x31,
-  0xA2,0x5D,0x31,0xA1,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,0x32,0xA3,
-  0x5C,0x31,0xA3,0x4F,0x21,0xBD,0x9E,0x87,0xFF,0xFF,0xFF,0xFE,0xFD,0xFD,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,
-  0xDC,0xD6,0x94,0x4B,0x1E,0xA5,0x5C,0x34,0xA1,0x5D,0x31,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x31,0xA1,0x5D,0x31,0xA1,0x5D,0x31,0xA2,
-  0x5C,0x32,0x99,0x46,0x1C,0xDB,0xD4,0xCA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,
-  0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0x93,0x5E,0x3F,0xA3,0x58,0x2E,0xA2,0x5C,0x33,
-  0xA1,0x5C,0x32,0xA4,0x5C,0x31,0xA1,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x31,0xA1,
-  0x5D,0x32,0xA1,0x5B,0x33,0x8A,0x49,0x1A,0xE6,0xDA,0xD0,0xFF,0xFF,0xFF,0xFD,0xFF,
-  0xFF,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,
-  0xDC,0xD6,0x94,0x4B,0x1E,0xA5,0x5A,0x34,0xA1,0x5D,0x31,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x31,0xA1,0x5C,0x32,0xA2,0x5C,0x32,0xA1,0x5D,0x31,0x9F,
-  0x50,0x23,0xAC,0x92,0x78,0xFF,0xFF,0xFF,0xFC,0xFD,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFE,0xFF,0xFE,0xFD,0xFF,0xFF,0xF0,0xEE,0xE7,0x88,0x4C,0x23,0xA2,0x5A,0x30,
-  0xA0,0x5D,0x30,0xA1,0x5D,0x31,0xA2,0x5C,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA0,
-  0x5D,0x31,0xA0,0x5D,0x31,0xA2,0x5B,0x2F,0x88,0x4D,0x25,0xFF,0xFF,0xFC,0xFE,0xFF,
-  0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,
-  0xDC,0xD6,0x94,0x4B,0x1E,0xA5,0x5C,0x34,0xA1,0x5D,0x31,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x31,0x9F,0x5C,0x34,0xA5,0x5D,0x2F,0xA2,0x5A,0x2B,0x90,
-  0x63,0x42,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0xFD,0xFF,0xFF,0xD4,0xCA,0xBA,0x91,0x49,0x1E,
-  0xAB,0x5D,0x2A,0x9F,0x5B,0x34,0xA2,0x5D,0x31,0xA2,0x5D,0x31,0xA1,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,
-  0x5D,0x32,0xA1,0x5D,0x32,0xA1,0x5D,0x31,0xA5,0x57,0x29,0x98,0x6A,0x53,0xFF,0xFF,
-  0xFF,0xF8,0xFE,0xFF,0xFB,0xFE,0xFE,0xFD,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,
-  0xDC,0xD6,0x94,0x4B,0x1E,0xA5,0x5C,0x34,0xA1,0x5D,0x31,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5C,0x32,0x9D,0x5E,0x31,0xA4,0x5A,0x2B,0x86,0x48,0x24,0xFF,
-  0xFC,0xF0,0xFB,0xFF,0xFF,0xFF,0xFF,0xFD,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFC,0xFF,0xFF,0xFF,0xFE,0xFE,0xF9,0xFE,0xFD,0xFF,0xFF,0xFF,0xBA,0xA7,0x96,
-  0x95,0x4C,0x1A,0xA4,0x5C,0x31,0xA2,0x5D,0x31,0xA2,0x5C,0x32,0xA2,0x5C,0x32,0xA1,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,0x32,0xA4,
-  0x5B,0x32,0xA3,0x5C,0x32,0xA4,0x5C,0x31,0xA2,0x5A,0x35,0xA5,0x50,0x1B,0xB5,0x9B,
-  0x8A,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,
-  0xDD,0xD7,0x94,0x4B,0x1E,0xA5,0x5B,0x34,0xA1,0x5D,0x31,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5C,0x32,0xA1,0x5D,0x31,0xA3,0x5C,0x2D,0x8B,0x4A,0x24,0xE9,0xE8,0xDE,0xF9,
-  0xFF,0xFF,0xFF,0xFD,0xFF,0xFB,0xFF,0xFB,0xFD,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFC,0xFE,0xFF,0xFF,0xFF,0xFF,
-  0xBC,0xA6,0x94,0x91,0x49,0x1D,0xA1,0x5D,0x31,0x9E,0x5C,0x34,0xA0,0x5D,0x31,0xA4,
-  0x5C,0x32,0xA1,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,
-  0x5D,0x32,0xA1,0x5D,0x32,0xA1,0x5D,0x32,0xA1,0x5D,0x31,0xA5,0x5D,0x2F,0x91,0x4F,
-  0x24,0xA6,0x7B,0x60,0xE8,0xDF,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xED,
-  0xE5,0xDD,0x96,0x4E,0x1F,0xA1,0x5A,0x36,0xA6,0x5D,0x2F,0xA1,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,0x32,0xA2,0x5C,0x32,0xA2,0x5C,0x31,
-  0x9E,0x5D,0x31,0xA3,0x5A,0x31,0x91,0x45,0x1A,0xDA,0xD1,0xC4,0xFF,0xFF,0xFF,0xFD,
-  0xFE,0xFE,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFA,0xFF,0xFD,
-  0xFF,0xFF,0xFF,0xBC,0xA7,0x95,0x91,0x4B,0x19,0xAA,0x5D,0x2B,0xA2,0x5D,0x30,0xA2,
-  0x5D,0x32,0xA1,0x5D,0x31,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x31,0xA0,0x5C,0x33,0xA3,0x5B,0x33,0xA6,0x5C,
-  0x31,0xA1,0x56,0x2B,0x98,0x4B,0x23,0x8B,0x48,0x23,0x8A,0x46,0x25,0x8D,0x48,0x20,
-  0x8D,0x47,0x20,0x8D,0x48,0x20,0x8D,0x47,0x20,0x8D,0x48,0x20,0x8E,0x47,0x20,0x84,
-  0x4B,0x2A,0xAC,0x5E,0x2E,0x9E,0x5C,0x34,0xA0,0x5D,0x31,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5C,0x32,0xA1,0x5D,0x32,0xA2,0x5E,0x2D,
-  0xA7,0x5C,0x2D,0x8C,0x48,0x25,0xD8,0xC9,0xBD,0xFD,0xFF,0xFF,0xFC,0xFE,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFD,
-  0xF9,0xFE,0xFD,0xFF,0xFF,0xFF,0xBB,0xA6,0x97,0x91,0x48,0x1D,0xA6,0x5A,0x30,0xA1,
-  0x5B,0x33,0xA1,0x5D,0x31,0xA1,0x5D,0x31,0xA1,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5C,0x32,0xA1,0x5E,0x2F,0xA2,0x5D,0x32,0xA4,0x5B,
-  0x33,0xA2,0x5E,0x2E,0xA0,0x5F,0x2D,0xA5,0x5C,0x2F,0xA6,0x5B,0x31,0xA2,0x5B,0x33,
-  0xA2,0x5A,0x33,0xA2,0x5B,0x33,0xA2,0x5A,0x33,0xA2,0x5B,0x33,0xA2,0x5A,0x34,0xA6,
-  0x5C,0x31,0xA2,0x5A,0x35,0xA4,0x5C,0x30,0xA1,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA1,0x5D,0x32,0xA2,0x5C,0x32,0xA1,0x5D,0x31,0xA1,0x5C,0x31,0xA6,0x59,0x2B,
-  0x84,0x43,0x1F,0xE7,0xE5,0xDB,0xFF,0xFF,0xFF,0xFB,0xFC,0xFE,0xFD,0xFF,0xFE,0xFE,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,
-  0xFF,0xFE,0xFD,0xFC,0xFD,0xFF,0xFF,0xFF,0xFF,0xDC,0xD1,0xC1,0x88,0x48,0x22,0xA7,
-  0x58,0x29,0xA3,0x5C,0x34,0xA3,0x5C,0x32,0xA4,0x5C,0x31,0xA1,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5C,0x32,0xA2,0x5D,0x31,0xA1,0x5C,0x31,0xA1,0x5C,
-  0x32,0xA2,0x5C,0x31,0xA2,0x5C,0x32,0xA1,0x5D,0x32,0xA0,0x5D,0x32,0xA2,0x5D,0x30,
-  0xA2,0x5D,0x30,0xA2,0x5D,0x30,0xA2,0x5D,0x30,0xA2,0x5D,0x30,0xA2,0x5D,0x30,0xA2,
-  0x5D,0x31,0xA1,0x5C,0x33,0xA3,0x5C,0x31,0xA1,0x5D,0x32,0xA1,0x5D,0x32,0xA1,0x5D,
-  0x32,0xA3,0x5C,0x31,0x9E,0x5E,0x31,0xA6,0x5C,0x33,0x9D,0x52,0x25,0x8E,0x5F,0x3C,
-  0xFC,0xFE,0xF3,0xFD,0xFF,0xFF,0xFD,0xFE,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFE,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xF8,0xFD,0xFD,0xFD,0xFF,0xFF,0xF9,0xF6,0xF2,0x93,
-  0x5F,0x3E,0x98,0x51,0x1D,0xA3,0x5C,0x31,0xA3,0x5C,0x35,0xA1,0x5D,0x31,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5C,0x32,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x31,0xA1,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x31,0xA2,0x5D,0x31,0xA1,0x5C,0x32,
-  0xA1,0x5D,0x32,0xA1,0x5C,0x32,0xA1,0x5D,0x32,0xA1,0x5C,0x32,0xA1,0x5D,0x32,0xA1,
-  0x5D,0x32,0xA2,0x5D,0x31,0xA1,0x5D,0x32,0xA3,0x5C,0x31,0xA4,0x5C,0x31,0xA4,0x5C,
-  0x31,0xA3,0x5C,0x33,0xA9,0x5A,0x2D,0x97,0x45,0x18,0xA9,0x8E,0x6F,0xFE,0xFF,0xFF,
-  0xFD,0xFE,0xFF,0xFD,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,0xFD,0xFD,0xFF,0xF9,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xBF,0xA6,0x92,0x8B,0x46,0x1A,0x9C,0x5A,0x2A,0xA2,0x5C,0x31,0xA1,0x5C,
-  0x32,0xA2,0x5D,0x31,0xA2,0x5D,0x31,0xA2,0x5C,0x32,0xA2,0x5C,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x31,0xA1,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,
-  0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5C,0x32,0xA1,0x5D,0x31,0xA2,0x5D,0x31,0xA2,
-  0x5C,0x32,0xA2,0x5D,0x31,0xA2,0x5D,0x31,0xA1,0x5D,0x31,0xA1,0x5D,0x31,0xA2,0x5C,
-  0x30,0x9E,0x53,0x24,0x83,0x4F,0x27,0xDB,0xCA,0xBF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,
-  0xFE,0xFC,0xFF,0xFA,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFE,0xFD,0xFF,0xFE,0xFE,
-  0xFD,0xFF,0xFF,0xFF,0xFF,0xF4,0xEF,0xE9,0xA0,0x6C,0x52,0x93,0x4B,0x1A,0xA4,0x5A,
-  0x27,0x9F,0x5C,0x34,0xA2,0x5C,0x33,0xA1,0x5D,0x31,0xA0,0x5E,0x30,0xA1,0x5D,0x31,
-  0xA1,0x5C,0x34,0xA3,0x5C,0x31,0xA1,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,0x32,
-  0xA1,0x5D,0x32,0xA0,0x5D,0x32,0xA4,0x5D,0x2F,0xA2,0x5B,0x34,0xA1,0x5C,0x32,0xA1,
-  0x5D,0x31,0x9E,0x5D,0x32,0xA1,0x5B,0x34,0xA5,0x5B,0x36,0xA0,0x57,0x27,0x87,0x4A,
-  0x1C,0xB4,0x94,0x7C,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFD,0xFD,0xFF,0xFD,
-  0xFC,0xFF,0xFE,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,
-  0xFF,0xFF,0xFC,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xE2,0xDA,0xD0,0x9E,0x6D,
-  0x4E,0x93,0x4B,0x1B,0x9F,0x57,0x28,0xA4,0x5C,0x32,0xA5,0x5B,0x33,0xA5,0x5C,0x32,
-  0xA4,0x5B,0x34,0xA2,0x5D,0x31,0xA1,0x5C,0x32,0xA2,0x5C,0x32,0xA2,0x5C,0x32,0xA2,
-  0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,
-  0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA2,0x5D,0x32,0xA1,0x5D,0x32,0xA2,0x5C,0x32,
-  0xA2,0x5C,0x32,0xA3,0x5C,0x31,0x9D,0x5D,0x33,0x9F,0x5C,0x34,0xA0,0x5E,0x30,0x9F,
-  0x5D,0x32,0xA8,0x5C,0x2F,0x9D,0x56,0x22,0x88,0x49,0x18,0xA6,0x7D,0x61,0xF5,0xF1,
-  0xED,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFF,0xFE,0xFF,0xFF,0xFB,0xFF,0xFD,0xFE,0xFE,0xFD,0xFD,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xE1,0xD9,0xCF,0xA5,0x84,0x6C,0x85,0x49,0x1E,0xA0,0x52,0x1D,0x9F,0x58,0x30,
-  0xA7,0x5B,0x2F,0xA1,0x5E,0x30,0xA2,0x5E,0x31,0xA2,0x5E,0x30,0xA2,0x5E,0x30,0xA1,
-  0x5C,0x32,0xA1,0x5D,0x31,0xA1,0x5D,0x31,0xA1,0x5C,0x31,0xA2,0x5C,0x32,0xA2,0x5C,
-  0x32,0xA2,0x5C,0x32,0xA1,0x5D,0x31,0xA1,0x5D,0x32,0xA1,0x5D,0x32,0xA2,0x5C,0x31,
-  0xA2,0x5C,0x32,0xA2,0x5C,0x31,0xA5,0x5B,0x31,0xA6,0x5C,0x2F,0x9F,0x53,0x29,0x9B,
-  0x4D,0x22,0x87,0x48,0x27,0xB4,0x95,0x83,0xFB,0xF7,0xF0,0xFF,0xFF,0xFF,0xFA,0xFF,
-  0xFF,0xFD,0xFD,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFE,0xFF,0xFE,0xFF,0xFE,0xFE,0xFE,
-  0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFC,0xF7,0xC7,0xB8,0xAC,0xA0,0x75,0x56,
-  0x8C,0x4A,0x20,0x9D,0x4D,0x22,0x9C,0x55,0x21,0x9F,0x59,0x2A,0xA0,0x5B,0x2D,0xA4,
-  0x5D,0x31,0xA4,0x5C,0x32,0xA4,0x5D,0x33,0xA3,0x5D,0x32,0xA2,0x5E,0x31,0xA1,0x5D,
-  0x31,0xA2,0x5D,0x31,0xA5,0x5C,0x32,0xA5,0x5B,0x31,0xA3,0x5C,0x30,0xA1,0x5B,0x2E,
-  0xA2,0x56,0x29,0xA1,0x51,0x23,0x98,0x4D,0x21,0x85,0x4D,0x25,0xB2,0x8C,0x70,0xDD,
-  0xCD,0xC6,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFA,0xFE,0xFF,0xFD,0xFD,0xFD,0xFF,0xFF,
-  0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFD,0xFF,0xFC,0xD3,0xCC,0xBE,0xC1,0xA5,0x94,0xA6,0x7A,0x60,0x9D,0x5C,0x39,0x89,
-  0x44,0x1B,0x91,0x4B,0x1F,0x96,0x4C,0x1E,0x98,0x4B,0x1F,0x98,0x4B,0x1F,0x99,0x4B,
-  0x20,0x96,0x4B,0x1E,0x95,0x4D,0x1E,0x8F,0x47,0x1C,0x8E,0x4F,0x24,0x96,0x64,0x3C,
-  0xA4,0x86,0x6B,0xC1,0xB1,0xA3,0xE1,0xDF,0xD4,0xFF,0xFF,0xFF,0xFA,0xFF,0xFF,0xFE,
-  0xFF,0xFF,0xFD,0xFF,0xFF,0xFB,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFE,0xFE,
-  0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xF0,0xF0,0xEB,0xEB,0xE6,0xDD,0xEC,0xE8,0xDF,0xEC,0xE8,0xE2,0xEC,0xE9,
-  0xE2,0xEB,0xE9,0xE0,0xE9,0xE7,0xDE,0xFB,0xFB,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFD,0xFE,
-  0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFD,0xFF,
-  0xFC,0xFF,0xFF,0xFE,0xFF,0xFD,0xFE,0xFE,0xFE,0xFD,0xFE,0xFF,0xFB,0xFE,0xFD,0xFA,
-  0xFF,0xFE,0xFC,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,0xFD,0xFD,0xFE,0xFE,
-  0xFE,0xFF,0xFF,0xFD,0xFE,0xFE,0xFD,0xFF,0xFD,0xFD,0xFE,0xFE,0xFD,0xFD,0xFE,0xFE,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,};
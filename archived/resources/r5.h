@@ -1,1207 +0,0 @@
-#pragma once
-#include <stdint.h>
-const uint8_t r5[] {
-  0x42,0x4D,0x36,0x4B,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x00,0x00,0x00,0x28,0x00,
-  0x00,0x00,0x50,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x01,0x00,0x18,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x4B,0x00,0x00,0xC4,0x0E,0x00,0x00,0xC4,0x0E,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xE9,0xB8,0xEC,0xD0,
-  0x55,0xDF,0xB8,0x12,0xDB,0xB1,0x00,0xE2,0xB7,0x00,0xE1,0xB7,0x00,0xE1,0xB7,0x00,
-  0xE1,0xB7,0x00,0xE1,0xB7,0x00,0xE1,0xB7,0x00,0xE1,0xB7,0x00,0xE1,0xB7,0x00,0xE1,
-  0xB7,0x00,0xE1,0xB7,0x00,0xE1,0xB7,0x00,0xE1,0xB7,0x00,0xE1,0xB7,0x00,0xE1,0xB7,
-  0x00,0xE1,0xB7,0x00,0xE1,0xB7,0x00,0xE1,0xB7,0x00,0xE1,0xB7,0x00,0xE1,0xB7,0x00,
-  0xE1,0xB7,0x00,0xE1,0xB7,0x00,0xE1,0xB7,0x00,0xE1,0xB7,0x00,0xE1,0xB7,0x00,0xE1,
-  0xB7,0x00,0xE1,0xB7,0x00,0xE1,0xB7,0x00,0xE1,0xB7,0x00,0xE1,0xB7,0x00,0xE1,0xB7,
-  0x00,0xE1,0xB7,0x00,0xE1,0xB7,0x00,0xE1,0xB7,0x00,0xE1,0xB7,0x00,0xE1,0xB7,0x00,
-  0xE1,0xB7,0x00,0xE1,0xB7,0x00,0xE1,0xB7,0x00,0xE1,0xB7,0x00,0xE1,0xB7,0x00,0xE1,
-  0xB7,0x00,0xE1,0xB7,0x00,0xE1,0xB7,0x00,0xE1,0xB7,0x00,0xE1,0xB7,0x00,0xE1,0xB7,
-  0x00,0xE1,0xB7,0x00,0xE1,0xB7,0x00,0xE1,0xB7,0x00,0xE1,0xB7,0x00,0xE1,0xB7,0x00,
-  0xE1,0xB7,0x00,0xE1,0xB7,0x00,0xE1,0xB7,0x00,0xE1,0xB7,0x00,0xE1,0xB7,0x00,0xE1,
-  0xB7,0x00,0xE2,0xB7,0x00,0xE0,0xB5,0x00,0xDA,0xB1,0x02,0xE9,0xC7,0x35,0xF1,0xDE,
-  0x8D,0xFD,0xFA,0xF2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xE9,0xB9,0xE5,0xBD,0x14,0xDD,0xB0,0x00,0xD7,0xAC,
-  0x00,0xD8,0xAE,0x00,0xD7,0xAE,0x00,0xD6,0xAE,0x00,0xD6,0xAE,0x00,0xD6,0xAE,0x00,
-  0xD6,0xAE,0x00,0xD6,0xAE,0x00,0xD6,0xAE,0x00,0xD6,0xAE,0x00,0xD6,0xAE,0x00,0xD6,
-  0xAE,0x00,0xD6,0xAE,0x00,0xD6,0xAE,0x00,0xD6,0xAE,0x00,0xD6,0xAE,0x00,0xD6,0xAE,
-  0x00,0xD6,0xAE,0x00,0xD6,0xAE,0x00,0xD6,0xAE,0x00,0xD6,0xAE,0x00,0xD6,0xAE,0x00,
-  0xD6,0xAE,0x00,0xD6,0xAE,0x00,0xD6,0xAE,0x00,0xD6,0xAE,0x00,0xD6,0xAE,0x00,0xD6,
-  0xAE,0x00,0xD6,0xAE,0x00,0xD6,0xAE,0x00,0xD6,0xAE,0x00,0xD6,0xAE,0x00,0xD6,0xAE,
-  0x00,0xD6,0xAE,0x00,0xD6,0xAE,0x00,0xD6,0xAE,0x00,0xD6,0xAE,0x00,0xD6,0xAE,0x00,
-  0xD6,0xAE,0x00,0xD6,0xAE,0x00,0xD6,0xAE,0x00,0xD6,0xAE,0x00,0xD6,0xAE,0x00,0xD6,
-  0xAE,0x00,0xD6,0xAE,0x00,0xD6,0xAE,0x00,0xD6,0xAE,0x00,0xD6,0xAE,0x00,0xD6,0xAE,
-  0x00,0xD6,0xAE,0x00,0xD6,0xAE,0x00,0xD6,0xAE,0x00,0xD6,0xAE,0x00,0xD6,0xAE,0x00,
-  0xD6,0xAE,0x00,0xD6,0xAE,0x00,0xD6,0xAE,0x00,0xD6,0xAE,0x00,0xD6,0xAE,0x00,0xD6,
-  0xAE,0x00,0xD6,0xAE,0x00,0xD7,0xAE,0x00,0xD8,0xAE,0x00,0xD7,0xAD,0x00,0xDA,0xAE,
-  0x00,0xDF,0xB3,0x00,0xEE,0xD5,0x6D,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xEF,0xD9,0x7D,0xDF,0xB2,0x00,0xD7,0xAD,0x00,0xD6,0xAD,0x00,0xD7,0xAE,
-  0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,
-  0x00,0xD6,0xAD,0x00,0xD9,0xAC,0x00,0xE8,0xC4,0x27,0xFB,0xF8,0xEC,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEB,
-  0xD4,0x6C,0xDE,0xAE,0x00,0xD5,0xAC,0x00,0xD7,0xAE,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD8,0xAC,0x00,0xE6,0xBE,0x15,0xFB,0xF8,0xEC,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF1,0xDF,0x95,0xDE,
-  0xAF,0x00,0xD6,0xAD,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAE,0x00,0xD9,0xAC,0x00,0xE8,0xC2,0x26,
-  0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0xF3,0xE0,0xE0,0xB3,0x00,0xD6,
-  0xAC,0x00,0xD7,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD6,0xAE,0x00,0xDA,0xAD,0x00,
-  0xEC,0xD3,0x6C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE8,0xC9,0x47,0xD9,0xAD,0x00,0xD7,
-  0xAE,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAE,0x00,0xD7,
-  0xAD,0x00,0xD7,0xAC,0x00,0xD6,0xAB,0x00,0xD5,0xAA,0x00,0xD5,0xA9,0x00,0xD5,0xA9,
-  0x00,0xD5,0xA9,0x00,0xD6,0xAA,0x00,0xD6,0xAC,0x00,0xD7,0xAD,0x00,0xD7,0xAE,0x00,
-  0xD7,0xAE,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAE,0x00,0xD6,0xAD,0x00,
-  0xDF,0xB2,0x00,0xFB,0xF9,0xF3,0xFC,0xFA,0xF2,0xE0,0xB4,0x00,0xD6,0xAD,0x00,0xD7,
-  0xAE,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD7,0xAE,0x00,0xD6,0xAC,0x00,0xD4,0xA8,0x00,0xD4,0xA7,0x00,0xD6,0xAA,0x00,0xD9,
-  0xB1,0x15,0xDD,0xB9,0x25,0xE1,0xC1,0x3C,0xE3,0xC7,0x51,0xE5,0xCA,0x5B,0xE5,0xCC,
-  0x5C,0xE5,0xC9,0x56,0xE2,0xC4,0x46,0xDE,0xBC,0x2C,0xDA,0xB4,0x1D,0xD6,0xAC,0x08,
-  0xD5,0xA8,0x00,0xD4,0xA8,0x00,0xD5,0xAA,0x00,0xD7,0xAD,0x00,0xD7,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAE,0x00,
-  0xDA,0xAD,0x00,0xEE,0xDC,0x8C,0xF0,0xE2,0xA9,0xDC,0xAF,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD6,0xAC,0x00,0xD4,0xA8,0x00,
-  0xD6,0xAA,0x00,0xDC,0xB8,0x20,0xE7,0xD0,0x70,0xF3,0xE7,0xB3,0xFA,0xF4,0xDD,0xFD,
-  0xFC,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFB,0xFB,0xF7,0xE7,
-  0xF6,0xEE,0xC9,0xED,0xD9,0x8D,0xDF,0xBF,0x3C,0xD8,0xAE,0x08,0xD4,0xA7,0x00,0xD5,
-  0xAA,0x00,0xD7,0xAE,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAE,0x00,
-  0xD8,0xAD,0x00,0xE8,0xC5,0x34,0xED,0xD4,0x69,0xD7,0xAB,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD5,0xAA,0x00,0xD2,0xA5,0x00,0xDA,0xB5,0x1D,0xEC,0xD8,0x8A,
-  0xFA,0xF5,0xE0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFC,0xF6,0xF4,0xE7,0xB3,0xE1,
-  0xC2,0x48,0xD5,0xA8,0x00,0xD4,0xA8,0x00,0xD7,0xAE,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAE,0x00,
-  0xD7,0xAF,0x00,0xD9,0xB0,0x02,0xEA,0xCA,0x43,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD5,0xAA,
-  0x00,0xD2,0xA3,0x00,0xE0,0xC1,0x3F,0xF7,0xEF,0xD0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFE,0xFD,0xF9,0xEA,0xD4,0x7D,0xD5,0xA9,0x00,0xD4,0xA7,0x00,0xD7,0xAE,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD7,0xAE,0x00,0xE0,0xB5,0x00,0xE9,0xC7,0x3B,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD6,0xAC,0x00,0xD2,0xA4,0x00,0xE0,0xC0,
-  0x3F,0xFA,0xF5,0xE0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEA,0xD7,0x83,0xD5,0xA9,
-  0x00,0xD4,0xA9,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD4,0xA8,0x00,0xD8,0xB2,0x16,0xF4,0xE8,0xB8,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFA,
-  0xEE,0xE2,0xC5,0x4D,0xD3,0xA5,0x00,0xD7,0xAD,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,
-  0xAD,0x00,0xD3,0xA6,0x00,0xE4,0xC7,0x56,0xFE,0xFE,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xF2,0xE3,0xAB,0xD5,0xAA,0x00,0xD6,0xAB,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAD,0x00,0xD4,
-  0xA6,0x00,0xEE,0xDD,0x97,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0xF6,0xE0,0xDA,0xB3,0x1D,0xD5,0xA9,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD6,0xAC,0x00,0xD5,0xA8,0x00,0xF6,
-  0xED,0xC5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0xBE,0x3D,
-  0xD3,0xA5,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD6,0xAB,0x00,0xD7,0xAE,0x07,0xFB,0xF8,0xE9,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xF8,0xE9,0xF3,
-  0xE7,0xB5,0xEC,0xD8,0x84,0xE6,0xCA,0x5D,0xE1,0xC2,0x4A,0xE1,0xC1,0x47,0xE1,0xC2,
-  0x47,0xE4,0xC7,0x58,0xEB,0xD8,0x80,0xF4,0xEA,0xBB,0xFD,0xFD,0xF8,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xE4,0xC9,0x5B,0xD3,0xA4,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD6,0xAC,0x00,0xD6,0xAC,0x02,0xFC,0xF8,0xEA,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFB,0xF8,0xE9,0xEA,0xD4,0x7F,0xDB,0xB6,0x1C,0xD5,0xA8,0x00,0xD4,
-  0xA7,0x00,0xD4,0xA8,0x00,0xD5,0xAA,0x00,0xD6,0xAB,0x00,0xD6,0xAB,0x00,0xD6,0xAB,
-  0x00,0xD6,0xAA,0x00,0xD5,0xA8,0x00,0xD4,0xA7,0x00,0xD5,0xAB,0x00,0xE0,0xC0,0x41,
-  0xF4,0xE8,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xE5,0xC8,0x5A,0xD2,0xA5,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD7,0xAD,0x00,0xD3,0xA6,0x00,0xFA,0xF5,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xF9,0xEC,
-  0xE6,0xCC,0x64,0xD5,0xAA,0x00,0xD4,0xA7,0x00,0xD6,0xAC,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAF,0x00,0xD7,0xAE,0x00,0xD5,0xAA,0x00,
-  0xD5,0xA7,0x00,0xDC,0xB8,0x2B,0xF8,0xF0,0xD2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xBC,0x38,0xD5,0xA9,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAE,0x00,
-  0xD4,0xA6,0x00,0xF3,0xE6,0xB0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF1,0xE4,0xAB,0xD7,0xAE,0x09,
-  0xD4,0xA7,0x00,0xD7,0xAE,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD7,0xAF,0x00,0xD5,0xAB,0x00,0xD4,0xA6,0x00,0xEB,0xD8,0x88,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD9,0xB2,0x16,0xD6,0xAB,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD4,0xA7,0x00,
-  0xE7,0xD0,0x6E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE9,0xD3,0x7B,0xD2,0xA3,0x00,0xD7,0xAD,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAE,0x00,0xD2,0xA4,0x00,0xE3,0xC6,0x51,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0xF3,0xDA,0xD5,0xA9,0x00,0xD7,
-  0xAE,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD5,0xAA,0x00,0xDD,0xB9,0x2C,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xEA,0xD4,0x7D,0xD1,0xA2,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD4,0xA6,0x00,0xDF,
-  0xBF,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xE0,0x9C,0xD2,
-  0xA5,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAE,0x00,0xD5,0xA9,0x00,0xFA,0xF4,0xDE,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xF4,0xE9,0xB9,0xD1,0xA2,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD4,
-  0xA6,0x00,0xE6,0xCC,0x62,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE1,
-  0xC0,0x40,0xD5,0xA9,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD3,0xA6,0x00,0xEA,0xD4,0x7B,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFD,
-  0xFA,0xD8,0xB0,0x0F,0xD7,0xAD,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAE,0x00,0xD1,0xA4,0x00,0xF5,0xEB,0xC2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,
-  0xF5,0xE2,0xD4,0xA8,0x00,0xD7,0xAE,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD7,0xAD,0x00,0xD7,0xAE,0x09,0xFF,0xFE,0xFC,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xED,0xD9,
-  0x87,0xD2,0xA5,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAD,0x00,0xD7,0xAD,0x00,0xD7,0xAE,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD6,0xAC,0x00,0xD9,0xB2,0x15,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xE7,0xCF,0x6B,0xD4,0xA7,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD2,0xA5,0x00,0xED,0xDB,0x8D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDB,0xB4,
-  0x1C,0xD7,0xAD,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD6,0xAB,0x00,0xD3,0xA6,0x00,0xD7,0xAD,0x00,0xD9,0xB1,0x0B,0xD6,0xAA,
-  0x00,0xD4,0xA7,0x00,0xD7,0xAD,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD2,0xA3,0x00,0xF1,0xE4,0xA8,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xD3,0xA6,0x00,0xD7,0xAE,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD7,0xAE,0x00,0xD5,0xA8,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xEF,0xCB,0xD4,0xA7,
-  0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,
-  0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD3,
-  0xA6,0x00,0xDE,0xBD,0x35,0xF9,0xF3,0xD8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xF2,0xE5,0xB0,0xD6,0xAB,0x02,0xD5,0xAA,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAD,0x00,0xDC,0xB9,0x2C,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,0xCB,0x62,0xD6,0xAA,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD5,0xA9,0x00,0xE9,0xD1,0x72,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEA,0xD4,0x7F,0xD1,0xA3,
-  0x00,0xD6,0xAA,0x00,0xD5,0xAA,0x00,0xD5,0xAA,0x00,0xD5,0xAA,0x00,0xD5,0xAA,0x00,
-  0xD5,0xAA,0x00,0xD5,0xAA,0x00,0xD5,0xAA,0x00,0xD5,0xAA,0x00,0xD4,0xA5,0x00,0xE7,
-  0xCF,0x6F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD9,0xB1,0x12,0xD7,0xAC,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAE,0x00,0xD4,0xA7,0x00,0xFA,0xF5,0xE0,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0xF7,0xE4,0xD4,0xA6,0x00,0xD7,0xAE,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAF,
-  0x00,0xD3,0xA6,0x00,0xFB,0xF6,0xE0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFD,0xF8,0xFD,0xFC,
-  0xF6,0xFE,0xFD,0xF8,0xFE,0xFD,0xF8,0xFE,0xFD,0xF8,0xFE,0xFD,0xF8,0xFE,0xFD,0xF8,
-  0xFE,0xFD,0xF8,0xFE,0xFD,0xF8,0xFE,0xFD,0xF8,0xFE,0xFD,0xF8,0xFD,0xFC,0xF6,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0xF3,0xD9,0xD5,0xA9,0x00,0xD7,0xAE,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD3,0xA6,0x00,0xEE,0xDD,0x97,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDD,0xBA,0x2B,0xD6,0xAB,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD6,0xAC,
-  0x00,0xDB,0xB6,0x1E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE1,0xC4,0x48,0xD5,0xAA,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD5,0xA8,0x00,0xE5,0xCA,0x5B,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xDD,0x97,0xD4,0xA8,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD4,0xA8,
-  0x00,0xEB,0xD5,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF2,0xE4,0xAA,0xD5,0xA8,0x00,
-  0xD7,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD6,0xAC,0x00,0xE0,0xBF,0x35,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0xF6,0xE2,0xD5,0xAB,0x00,0xD7,0xAE,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAE,0x00,0xD4,0xA8,
-  0x00,0xF7,0xEF,0xCA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0xF2,0xD4,0xD5,0xAA,0x00,
-  0xD7,0xAE,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD6,0xAC,0x00,0xDD,0xB9,0x26,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDC,0xB7,0x1F,0xD6,0xAC,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAE,0x00,0xD8,0xAE,
-  0x0A,0xFF,0xFE,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0xF2,0xD7,0xD5,0xAA,0x00,
-  0xD7,0xAE,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAD,0x00,0xDD,0xB9,0x25,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0xCD,0x69,0xD4,0xA8,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD6,0xAB,0x00,0xDF,0xBD,
-  0x31,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0xEB,0xC0,0xD4,0xA9,0x00,
-  0xD7,0xAE,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD6,0xAC,0x00,0xDE,0xBC,0x2B,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF1,0xE3,0xA8,0xD4,0xA7,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD4,0xA8,0x00,0xE6,0xCC,
-  0x65,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,
-  0xFB,0xFF,0xFF,0xFD,0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,
-  0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,0xFE,0xFE,0xFC,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE9,0xD1,0x73,0xD4,0xA9,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD6,0xAA,0x00,0xE2,0xC3,0x44,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0xF2,0xD5,0xD5,0xA9,
-  0x00,0xD7,0xAE,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD4,0xA7,0x00,0xEE,0xDB,
-  0x91,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0xF5,0xE0,0xD9,0xB4,
-  0x24,0xDB,0xB5,0x21,0xDB,0xB6,0x23,0xDB,0xB6,0x23,0xDB,0xB6,0x23,0xDB,0xB6,0x23,
-  0xDB,0xB6,0x23,0xDB,0xB6,0x23,0xDB,0xB6,0x23,0xD9,0xB0,0x17,0xF2,0xE4,0xAA,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD8,0xB0,0x0A,0xD7,0xAD,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD4,0xA7,0x00,0xE7,0xD0,0x6D,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xF8,0xE8,0xD7,0xAE,
-  0x0A,0xD7,0xAE,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD4,0xA7,0x00,0xF3,0xE7,
-  0xB2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFD,0xFB,0xD9,0xB3,
-  0x16,0xD6,0xAB,0x00,0xD7,0xAD,0x00,0xD7,0xAD,0x00,0xD7,0xAD,0x00,0xD7,0xAD,0x00,
-  0xD7,0xAD,0x00,0xD7,0xAD,0x00,0xD7,0xAD,0x00,0xD6,0xAC,0x00,0xD4,0xA9,0x00,0xF8,
-  0xF0,0xD1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE2,0xC5,0x4E,0xD5,0xA8,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD3,0xA6,0x00,0xF2,0xE4,0xAD,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFD,0xF8,0xDA,0xB3,
-  0x1B,0xD7,0xAD,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAE,0x00,0xD4,0xA8,0x00,0xF6,0xEE,
-  0xCA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE2,0xC4,
-  0x44,0xD5,0xA9,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAD,0x00,0xD3,
-  0xA7,0x00,0xEC,0xD9,0x8C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xF9,0xF3,0xDA,0xDE,0xBC,0x31,0xD4,0xA6,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAE,0x00,0xD5,0xA9,0x00,0xFD,0xFA,0xEE,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDC,0xB9,
-  0x25,0xD7,0xAD,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAE,0x00,0xD5,0xA9,0x00,0xF8,0xF2,
-  0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEB,0xD6,
-  0x81,0xD4,0xA7,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,
-  0xAE,0x00,0xD5,0xA8,0x00,0xD6,0xA9,0x00,0xDA,0xB5,0x18,0xDC,0xB6,0x21,0xD8,0xB0,
-  0x09,0xD4,0xA6,0x00,0xD6,0xAB,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD6,0xAB,0x00,0xDF,0xC1,0x41,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xBC,
-  0x2B,0xD6,0xAC,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAE,0x00,0xD5,0xA9,0x00,0xF8,0xF2,
-  0xD7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0xE9,
-  0xBE,0xD4,0xA5,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAE,0x00,0xD6,0xAC,0x00,0xD6,0xAC,0x00,0xD7,0xAD,
-  0x00,0xD7,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD1,0xA3,0x00,0xF5,0xEA,0xBD,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xBD,
-  0x2D,0xD6,0xAC,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAE,0x00,0xD5,0xA9,0x00,0xF8,0xF2,
-  0xD7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xF9,
-  0xEC,0xD5,0xA9,0x00,0xD7,0xAE,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD6,0xAC,0x00,0xDC,0xB7,0x27,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xBD,
-  0x2C,0xD6,0xAC,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAE,0x00,0xD4,0xA9,0x00,0xF7,0xF0,
-  0xD0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,
-  0xFD,0xDA,0xB4,0x1F,0xD7,0xAD,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,
-  0xAE,0x00,0xD2,0xA3,0x00,0xF9,0xF4,0xDC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDD,0xBA,
-  0x28,0xD6,0xAC,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD4,0xA7,0x00,0xF4,0xEA,
-  0xBB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xE2,0xC4,0x47,0xD6,0xAB,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD3,
-  0xA4,0x00,0xED,0xDA,0x8D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFD,0xDB,0xB5,
-  0x1E,0xD7,0xAD,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD4,0xA7,0x00,0xEF,0xDF,
-  0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xEC,0xD8,0x85,0xD4,0xA6,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAD,0x00,0xD2,0xA4,0x00,0xEA,
-  0xD6,0x81,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFA,0xEE,0xD8,0xB0,
-  0x10,0xD7,0xAE,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD4,0xA8,0x00,0xE9,0xD1,
-  0x75,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xF5,0xEB,0xC2,0xD3,0xA4,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,
-  0xAE,0x00,0xD7,0xAE,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD7,0xAE,0x00,0xD5,0xA9,0x00,0xD5,0xAA,0x00,0xF0,0xE0,0x9F,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0xF4,0xDC,0xD6,0xAB,
-  0x00,0xD7,0xAE,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD5,0xAA,0x00,0xE2,0xC2,
-  0x43,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFE,0xFD,0xF8,0xD4,0xA7,0x00,0xD7,0xAE,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAE,0x00,0xD7,0xAE,0x07,0xD4,0xA8,0x00,0xD6,0xAB,0x00,0xD7,0xAE,0x00,0xD7,0xAE,
-  0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD6,0xAB,0x00,
-  0xD5,0xA9,0x00,0xD4,0xA8,0x00,0xE2,0xC3,0x47,0xFA,0xF6,0xE4,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0xE9,0xBA,0xD4,0xA8,
-  0x00,0xD7,0xAE,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAD,0x00,0xDA,0xB4,
-  0x13,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xD9,0xB1,0x14,0xD7,0xAD,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAE,0x00,0xD5,
-  0xA9,0x00,0xF4,0xE9,0xB6,0xEB,0xD7,0x86,0xDC,0xB7,0x21,0xD6,0xAC,0x00,0xD4,0xA8,
-  0x00,0xD4,0xA8,0x00,0xD4,0xA8,0x00,0xD4,0xA8,0x00,0xD7,0xAC,0x00,0xDC,0xB7,0x21,
-  0xE8,0xD0,0x72,0xF9,0xF2,0xD5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEA,0xD5,0x80,0xD4,0xA7,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAE,0x00,0xD5,0xAA,
-  0x00,0xFA,0xF4,0xDD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xE1,0xC2,0x48,0xD6,0xAB,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD5,
-  0xA9,0x00,0xF0,0xDF,0x99,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFD,0xFA,0xF5,
-  0xDF,0xF7,0xF0,0xD0,0xF7,0xF0,0xD0,0xFA,0xF5,0xDE,0xFE,0xFE,0xFD,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xBF,0x38,0xD6,0xAB,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD5,0xA8,
-  0x00,0xF0,0xDF,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xEC,0xD9,0x86,0xD4,0xA7,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD6,
-  0xAA,0x00,0xE3,0xC5,0x53,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFC,0xF5,0xD7,0xAC,0x05,0xD7,0xAE,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD5,0xAA,
-  0x00,0xE0,0xBE,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xF5,0xEC,0xC0,0xD3,0xA5,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,
-  0xAC,0x00,0xD9,0xB2,0x14,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xE7,0xB4,0xD4,0xA8,0x00,0xD7,0xAE,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAE,
-  0x00,0xD5,0xA9,0x00,0xFE,0xFE,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFD,0xFD,0xF8,0xD3,0xA6,0x00,0xD7,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,
-  0xAE,0x00,0xD4,0xA6,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE3,0xC5,0x4E,0xD5,0xAA,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD4,0xA7,0x00,0xEF,0xDF,0x98,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD8,0xAF,0x0A,0xD7,0xAC,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD4,0xA8,0x00,0xEE,0xDD,0x96,0xF5,0xEA,0xC0,0xF4,0xE8,0xBB,0xF4,0xE8,
-  0xBB,0xF4,0xE8,0xBB,0xF4,0xE8,0xBB,0xF4,0xE8,0xBB,0xF4,0xE8,0xBB,0xF4,0xE8,0xBB,
-  0xF4,0xE8,0xBB,0xF4,0xE8,0xBB,0xF4,0xE8,0xBB,0xF4,0xE8,0xBB,0xF4,0xE8,0xBB,0xF4,
-  0xE8,0xBB,0xF4,0xE8,0xBB,0xF3,0xE6,0xB5,0xFA,0xF4,0xDD,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD5,0xA9,0x00,0xD7,0xAE,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD7,0xAD,0x00,0xDA,0xB3,0x1A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0xC0,0x43,0xD6,0xAA,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD4,0xA8,0x00,0xD3,0xA5,0x00,0xD3,0xA5,0x00,0xD3,0xA5,
-  0x00,0xD3,0xA5,0x00,0xD3,0xA5,0x00,0xD3,0xA5,0x00,0xD3,0xA5,0x00,0xD3,0xA5,0x00,
-  0xD3,0xA5,0x00,0xD3,0xA5,0x00,0xD3,0xA5,0x00,0xD3,0xA5,0x00,0xD3,0xA5,0x00,0xD3,
-  0xA5,0x00,0xD3,0xA5,0x00,0xD1,0xA1,0x00,0xE2,0xC4,0x45,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xEE,0xDD,0x92,0xD4,0xA7,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD1,0xA2,0x00,0xF6,0xED,0xC5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEB,0xD8,0x83,0xD5,0xA9,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAD,0x00,0xDB,0xB6,0x25,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xD7,0xAD,0x06,0xD7,0xAE,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD6,0xAB,0x00,0xDC,0xB9,0x2B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xEB,0xBC,0xD4,0xA8,0x00,0xD8,0xAE,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAE,0x00,0xD5,0xAB,0x00,0xFC,0xFB,0xF1,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xF0,0xE0,0x9F,0xD2,0xA4,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD3,0xA5,0x00,0xF3,0xE5,0xB0,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xF8,0xE8,0xD6,0xAA,0x00,0xD7,0xAE,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD4,0xA6,0x00,0xF7,0xED,0xC9,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFE,0xFE,0xD8,0xAF,0x0E,0xD7,0xAD,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD6,0xAC,0x00,0xDA,0xB3,0x18,0xFE,0xFD,0xFA,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDA,0xB3,0x13,0xD7,0xAD,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD3,0xA6,0x00,0xED,0xDA,0x8F,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEA,
-  0xD3,0x7A,0xD4,0xA7,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD3,0xA6,0x00,0xE7,0xD0,0x6D,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE1,0xC3,0x48,0xD5,0xAA,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD5,0xA9,0x00,0xE4,0xC8,0x53,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0xF1,0xD6,0xD4,
-  0xA9,0x00,0xD7,0xAE,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAE,0x00,0xD3,0xA6,0x00,
-  0xF4,0xEA,0xBC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEB,0xD7,0x86,0xD4,0xA8,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAD,0x00,0xDC,0xB7,0x23,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDB,0xB5,0x1E,0xD6,
-  0xAB,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAD,0x00,
-  0xD5,0xA9,0x00,0xFE,0xFD,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0xEC,0xC1,0xD4,0xA8,0x00,
-  0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,
-  0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,
-  0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,
-  0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,
-  0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAD,0x07,0xFB,0xF7,
-  0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE2,0xC4,0x4B,0xD4,0xA8,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAB,0x00,0xD9,0xB3,0x1A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xF6,0xE3,0xD4,0xA8,0x00,
-  0xD4,0xA8,0x00,0xD5,0xA9,0x00,0xD5,0xA9,0x00,0xD5,0xA9,0x00,0xD5,0xA9,0x00,0xD5,
-  0xA9,0x00,0xD5,0xA9,0x00,0xD5,0xA9,0x00,0xD5,0xA9,0x00,0xD5,0xA9,0x00,0xD5,0xA9,
-  0x00,0xD5,0xA9,0x00,0xD5,0xA9,0x00,0xD5,0xA9,0x00,0xD5,0xA9,0x00,0xD5,0xA9,0x00,
-  0xD5,0xA9,0x00,0xD5,0xA9,0x00,0xD5,0xA9,0x00,0xD5,0xA9,0x00,0xD5,0xA9,0x00,0xD5,
-  0xA9,0x00,0xD5,0xA9,0x00,0xD5,0xA9,0x00,0xD5,0xA9,0x00,0xD1,0xA1,0x00,0xF5,0xE9,
-  0xBC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEB,0xD6,0x83,0xD3,0xA6,0x00,0xD8,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD4,0xA7,0x00,0xE1,0xC1,0x42,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xF1,0xD1,
-  0xF7,0xF0,0xCD,0xF7,0xF0,0xCE,0xF7,0xF0,0xCE,0xF7,0xF0,0xCE,0xF7,0xF0,0xCE,0xF7,
-  0xF0,0xCE,0xF7,0xF0,0xCE,0xF7,0xF0,0xCE,0xF7,0xF0,0xCE,0xF7,0xF0,0xCE,0xF7,0xF0,
-  0xCE,0xF7,0xF0,0xCE,0xF7,0xF0,0xCE,0xF7,0xF0,0xCE,0xF7,0xF0,0xCE,0xF7,0xF0,0xCE,
-  0xF7,0xF0,0xCE,0xF7,0xF0,0xCE,0xF7,0xF0,0xCE,0xF7,0xF0,0xCE,0xF7,0xF0,0xCE,0xF7,
-  0xF0,0xCE,0xF7,0xF0,0xCE,0xF7,0xF0,0xCE,0xF7,0xF0,0xCE,0xF6,0xEE,0xC9,0xFC,0xF9,
-  0xEC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xF2,0xE5,0xB0,0xD2,0xA3,0x00,0xD8,0xAE,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD4,0xA6,0x00,0xE3,0xC6,0x50,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xF3,0xE7,0xB6,0xD3,0xA4,0x00,0xD7,0xAE,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD4,0xA6,0x00,0xE0,0xBF,0x40,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0xE1,0xA5,
-  0xD3,0xA5,0x00,0xD7,0xAE,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD4,0xA8,0x00,0xDA,
-  0xB1,0x18,0xFD,0xFB,0xF1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE6,0xCE,0x69,0xD2,0xA4,0x00,
-  0xD7,0xAE,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD6,
-  0xAB,0x00,0xD4,0xA8,0x00,0xF2,0xE6,0xB2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFE,0xFD,0xF8,0xDD,0xBA,0x2D,0xD4,0xA7,0x00,0xD7,0xAE,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD7,0xAD,0x00,0xD3,0xA6,0x00,0xE6,0xCB,0x61,0xFD,0xFC,0xF4,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xF2,0xE3,0xAC,0xD6,0xAC,0x04,0xD5,0xAA,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC7,0x3C,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAF,0x00,0xD4,0xA7,0x00,0xD9,0xB0,0x12,0xF0,0xE0,
-  0xA1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0xF3,0xDB,0xE0,0xC0,
-  0x40,0xD3,0xA6,0x00,0xD7,0xAD,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB6,0x00,0xE9,0xC6,0x3B,0xD8,0xAD,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAD,0x00,0xD3,0xA5,
-  0x00,0xDA,0xB5,0x20,0xF3,0xE6,0xB2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xF8,0xE9,0xE3,0xC6,0x55,0xD4,0xA6,0x00,0xD5,0xAA,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD6,0xAE,0x00,0xE2,0xB7,0x00,0xED,0xCE,0x50,0xD8,0xAC,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD7,0xAD,0x00,0xD1,0xA3,0x00,0xD8,0xAF,0x0B,0xEB,0xD7,0x83,0xFC,0xF8,0xEA,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF2,
-  0xE6,0xB1,0xDF,0xBD,0x38,0xD2,0xA3,0x00,0xD5,0xAA,0x00,0xD7,0xAE,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD7,0xAE,0x00,0xDD,0xB2,0x00,0xEE,0xDA,0x81,0xD7,0xAB,0x00,0xD7,0xAE,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAD,0x00,0xD5,0xA8,0x00,0xD4,0xA7,0x00,
-  0xDC,0xB8,0x26,0xEA,0xD5,0x80,0xF7,0xEF,0xCD,0xFE,0xFC,0xF7,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xF9,0xF4,0xDE,0xF1,0xE2,0xA2,0xE2,0xC4,0x4C,0xD6,0xAB,0x00,0xD4,
-  0xA6,0x00,0xD6,0xAC,0x00,0xD7,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAE,0x00,
-  0xD8,0xAE,0x00,0xDE,0xB7,0x11,0xF4,0xEC,0xC6,0xE0,0xB3,0x00,0xD6,0xAD,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAE,0x00,
-  0xD6,0xAB,0x00,0xD4,0xA8,0x00,0xD5,0xA9,0x00,0xD7,0xAF,0x08,0xDD,0xBB,0x29,0xE4,
-  0xC8,0x57,0xEA,0xD4,0x7F,0xEF,0xE0,0x9D,0xF2,0xE6,0xB0,0xF4,0xE9,0xBA,0xF5,0xEA,
-  0xBE,0xF3,0xE7,0xB4,0xF0,0xE2,0xA6,0xED,0xD8,0x8B,0xE7,0xCD,0x67,0xE0,0xC0,0x3B,
-  0xDA,0xB3,0x12,0xD5,0xAA,0x00,0xD4,0xA8,0x00,0xD5,0xAA,0x00,0xD7,0xAD,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAE,0x00,
-  0xD7,0xAD,0x00,0xEC,0xCF,0x55,0xFF,0xFF,0xFF,0xDF,0xB6,0x09,0xD7,0xAE,0x00,0xD7,
-  0xAE,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD6,0xAB,0x00,0xD5,
-  0xA9,0x00,0xD4,0xA8,0x00,0xD4,0xA8,0x00,0xD4,0xA8,0x00,0xD4,0xA8,0x00,0xD5,0xA8,
-  0x00,0xD4,0xA8,0x00,0xD4,0xA7,0x00,0xD4,0xA8,0x00,0xD4,0xA8,0x00,0xD5,0xAA,0x00,
-  0xD7,0xAD,0x00,0xD7,0xAE,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD6,0xAD,0x00,
-  0xDD,0xB0,0x00,0xF2,0xE7,0xB8,0xFF,0xFF,0xFF,0xF0,0xDC,0x89,0xDA,0xAD,0x00,0xD7,
-  0xAE,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAE,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAE,0x00,0xD7,0xAD,0x00,
-  0xE2,0xBB,0x11,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE6,0xC0,0x1F,0xD8,
-  0xAC,0x00,0xD7,0xAE,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD5,0xAC,0x00,0xE0,0xB1,0x00,
-  0xF4,0xE9,0xBA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0xF5,0xE3,0xE0,
-  0xB4,0x00,0xD7,0xAC,0x00,0xD7,0xAE,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD7,0xAE,0x00,0xD6,0xAD,0x00,0xDD,0xAF,0x00,0xED,0xD7,0x7B,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,
-  0xEE,0xCB,0xE0,0xB4,0x00,0xD7,0xAC,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,
-  0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,
-  0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,
-  0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD8,0xAF,0x00,0xD7,0xAE,
-  0x00,0xD7,0xAE,0x00,0xD6,0xAC,0x00,0xDE,0xB1,0x00,0xEC,0xD3,0x6C,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xF9,0xF4,0xE1,0xE8,0xC3,0x20,0xD9,0xAD,0x00,0xD7,0xAD,0x00,0xD6,0xAD,
-  0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,
-  0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,
-  0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,
-  0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,
-  0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,
-  0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,
-  0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,
-  0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,
-  0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,
-  0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,
-  0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,
-  0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD7,0xAE,0x00,0xD6,0xAD,
-  0x00,0xD9,0xAD,0x00,0xE1,0xB4,0x00,0xF2,0xE1,0x95,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF1,0xDD,0x88,0xE2,0xB9,0x0D,0xDF,0xB3,
-  0x00,0xD7,0xAB,0x00,0xD7,0xAD,0x00,0xD8,0xAD,0x00,0xD8,0xAD,0x00,0xD8,0xAD,0x00,
-  0xD8,0xAD,0x00,0xD8,0xAD,0x00,0xD8,0xAD,0x00,0xD8,0xAD,0x00,0xD8,0xAD,0x00,0xD8,
-  0xAD,0x00,0xD8,0xAD,0x00,0xD8,0xAD,0x00,0xD8,0xAD,0x00,0xD8,0xAD,0x00,0xD8,0xAD,
-  0x00,0xD8,0xAD,0x00,0xD8,0xAD,0x00,0xD8,0xAD,0x00,0xD8,0xAD,0x00,0xD8,0xAD,0x00,
-  0xD8,0xAD,0x00,0xD8,0xAD,0x00,0xD8,0xAD,0x00,0xD8,0xAD,0x00,0xD8,0xAD,0x00,0xD8,
-  0xAD,0x00,0xD8,0xAD,0x00,0xD8,0xAD,0x00,0xD8,0xAD,0x00,0xD8,0xAD,0x00,0xD8,0xAD,
-  0x00,0xD8,0xAD,0x00,0xD8,0xAD,0x00,0xD8,0xAD,0x00,0xD8,0xAD,0x00,0xD8,0xAD,0x00,
-  0xD8,0xAD,0x00,0xD8,0xAD,0x00,0xD8,0xAD,0x00,0xD8,0xAD,0x00,0xD8,0xAD,0x00,0xD8,
-  0xAD,0x00,0xD8,0xAD,0x00,0xD8,0xAD,0x00,0xD8,0xAD,0x00,0xD8,0xAD,0x00,0xD8,0xAD,
-  0x00,0xD8,0xAD,0x00,0xD8,0xAD,0x00,0xD8,0xAD,0x00,0xD8,0xAD,0x00,0xD8,0xAD,0x00,
-  0xD8,0xAD,0x00,0xD8,0xAD,0x00,0xD8,0xAD,0x00,0xD8,0xAD,0x00,0xD8,0xAD,0x00,0xD8,
-  0xAD,0x00,0xD8,0xAD,0x00,0xD8,0xAD,0x00,0xD7,0xAC,0x00,0xDC,0xAF,0x00,0xE1,0xB5,
-  0x00,0xEB,0xCC,0x48,0xF9,0xF4,0xE0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0xED,
-  0xC7,0xEF,0xDA,0x81,0xED,0xCF,0x50,0xE9,0xC7,0x3B,0xE9,0xC7,0x3C,0xE9,0xC8,0x3C,
-  0xE9,0xC8,0x3C,0xE9,0xC8,0x3C,0xE9,0xC8,0x3C,0xE9,0xC8,0x3C,0xE9,0xC8,0x3C,0xE9,
-  0xC8,0x3C,0xE9,0xC8,0x3C,0xE9,0xC8,0x3C,0xE9,0xC8,0x3C,0xE9,0xC8,0x3C,0xE9,0xC8,
-  0x3C,0xE9,0xC8,0x3C,0xE9,0xC8,0x3C,0xE9,0xC8,0x3C,0xE9,0xC8,0x3C,0xE9,0xC8,0x3C,
-  0xE9,0xC8,0x3C,0xE9,0xC8,0x3C,0xE9,0xC8,0x3C,0xE9,0xC8,0x3C,0xE9,0xC8,0x3C,0xE9,
-  0xC8,0x3C,0xE9,0xC8,0x3C,0xE9,0xC8,0x3C,0xE9,0xC8,0x3C,0xE9,0xC8,0x3C,0xE9,0xC8,
-  0x3C,0xE9,0xC8,0x3C,0xE9,0xC8,0x3C,0xE9,0xC8,0x3C,0xE9,0xC8,0x3C,0xE9,0xC8,0x3C,
-  0xE9,0xC8,0x3C,0xE9,0xC8,0x3C,0xE9,0xC8,0x3C,0xE9,0xC8,0x3C,0xE9,0xC8,0x3C,0xE9,
-  0xC8,0x3C,0xE9,0xC8,0x3C,0xE9,0xC8,0x3C,0xE9,0xC8,0x3C,0xE9,0xC8,0x3C,0xE9,0xC8,
-  0x3C,0xE9,0xC8,0x3C,0xE9,0xC8,0x3C,0xE9,0xC8,0x3C,0xE9,0xC8,0x3C,0xE9,0xC8,0x3C,
-  0xE9,0xC8,0x3C,0xE9,0xC8,0x3C,0xE9,0xC8,0x3C,0xE9,0xC8,0x3C,0xE9,0xC8,0x3C,0xE9,
-  0xC7,0x3C,0xEA,0xC8,0x3B,0xEA,0xCA,0x43,0xEE,0xD5,0x69,0xF2,0xE4,0xA9,0xFC,0xFB,
-  0xF2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,};
@@ -1,1207 +0,0 @@
-#pragma once
-#include <stdint.h>
-const uint8_t r6[] {
-  0x42,0x4D,0x36,0x4B,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x00,0x00,0x00,0x28,0x00,
-  0x00,0x00,0x50,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x01,0x00,0x18,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x4B,0x00,0x00,0xC4,0x0E,0x00,0x00,0xC4,0x0E,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFF,0xFD,0xFE,0xFE,0xFE,0xFC,0xFB,0xFE,0xFE,
-  0xFB,0xFF,0xFD,0xFE,0xFD,0xFF,0xFE,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFE,0xFF,0xFE,0xFD,0xFF,0xFD,0xFD,0xFF,0xFE,0xFF,0xFD,0xFD,0xFD,0xFF,0xFE,
-  0xFE,0xFD,0xFE,0xFF,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFD,0xFD,0xFE,0xFE,
-  0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFD,0xFE,0xFC,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xF4,0xE4,0xE5,0xC9,0xCC,0xCC,0xA4,0xB7,
-  0xB4,0x8D,0xAE,0xA5,0x78,0xA5,0x99,0x6B,0x9C,0x91,0x64,0x9B,0x91,0x64,0x9B,0x90,
-  0x63,0xA0,0x95,0x68,0xA8,0x9F,0x72,0xB1,0xB0,0x85,0xC3,0xC3,0x9C,0xDB,0xDC,0xBD,
-  0xF6,0xF3,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,
-  0xFD,0xFF,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFD,0xFE,0xFD,0xFD,0xFE,
-  0xFE,0xFD,0xFE,0xFD,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFD,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xF7,0xFD,0xCC,0xC6,0xB1,
-  0xA2,0xA3,0x69,0x7E,0x7D,0x38,0x6C,0x68,0x26,0x6C,0x69,0x1D,0x76,0x6C,0x18,0x71,
-  0x6C,0x17,0x70,0x6F,0x12,0x73,0x70,0x0F,0x71,0x6F,0x0F,0x71,0x70,0x10,0x72,0x70,
-  0x10,0x74,0x6F,0x10,0x73,0x6F,0x11,0x72,0x6E,0x13,0x72,0x6C,0x18,0x72,0x6B,0x18,
-  0x69,0x69,0x22,0x70,0x70,0x2C,0x92,0x93,0x56,0xBC,0xB8,0x94,0xEF,0xE4,0xE4,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFD,0xFF,0xFE,0xFD,0xFE,0xFE,0xFD,
-  0xFD,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,0xFC,0xFD,0xFE,0xFE,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFE,0xF9,0xC4,0xC3,0xA7,0x91,0x86,0x4D,0x76,0x6D,0x14,0x77,0x6E,0x15,
-  0x74,0x68,0x21,0x6D,0x68,0x20,0x6F,0x6C,0x21,0x8A,0x80,0x47,0xA3,0x98,0x6C,0xB9,
-  0xAD,0x84,0xC8,0xC1,0xA3,0xD1,0xCB,0xB4,0xD6,0xD6,0xBF,0xD4,0xD5,0xBD,0xD0,0xD5,
-  0xBD,0xD4,0xD1,0xBB,0xCC,0xC4,0xAD,0xC3,0xB8,0x95,0xAF,0xA4,0x79,0x97,0x8E,0x5B,
-  0x7D,0x78,0x32,0x72,0x6B,0x1E,0x6E,0x64,0x1F,0x72,0x66,0x1D,0x6F,0x6B,0x16,0x81,
-  0x72,0x37,0xAD,0xA4,0x91,0xEE,0xEC,0xE0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFD,
-  0xFB,0xFF,0xFE,0xFC,0xFF,0xFC,0xFE,0xFD,0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,
-  0xFE,0xFE,0xFC,0xFD,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xF1,0xED,0xE8,0xA7,0x9C,
-  0x76,0x6C,0x6D,0x1F,0x75,0x71,0x12,0x6E,0x6A,0x1B,0x68,0x6A,0x1E,0x8B,0x90,0x53,
-  0xBF,0xBD,0x96,0xEA,0xE4,0xE2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFE,0xFA,0xFC,0xE0,0xDD,0xCB,0xB7,0xB6,0x87,0x88,0x83,0x47,0x75,
-  0x66,0x12,0x7D,0x6B,0x0E,0x69,0x68,0x0E,0x8B,0x81,0x4D,0xD9,0xD0,0xBD,0xFF,0xFF,
-  0xFF,0xFF,0xFE,0xFF,0xFE,0xFD,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFD,
-  0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFA,0xFF,0xFC,0xFE,
-  0xFF,0xFE,0xFF,0xFF,0xFF,0xEE,0xE9,0xE0,0x9B,0x93,0x60,0x69,0x68,0x0F,0x78,0x72,
-  0x15,0x74,0x6C,0x19,0x94,0x89,0x59,0xD1,0xC9,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFE,0xFE,0xFF,0xFD,0xFD,0xFF,0xFD,0xFE,0xFF,
-  0xFC,0xFE,0xFF,0xFD,0xFE,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,
-  0xFC,0xFC,0xCD,0xC9,0xB2,0x95,0x8B,0x56,0x72,0x6A,0x1B,0x66,0x66,0x09,0x74,0x79,
-  0x31,0xD1,0xC7,0xB3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFE,0xFE,0xFD,0xFF,0xFC,
-  0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFE,
-  0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFE,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xF7,0xA0,0x9C,0x71,0x6C,0x66,0x15,0x7F,0x6F,0x19,0x79,0x70,0x1E,0xA4,0xA5,
-  0x7A,0xF3,0xF0,0xE8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,0xFE,0xFD,
-  0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFE,0xFD,0xFD,0xFD,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFD,0xFD,0xFD,0xFD,0xFD,0xFE,0xFD,0xFD,0xFE,0xFD,0xFE,0xFE,0xFD,0xFD,0xFE,
-  0xFD,0xFD,0xFE,0xFD,0xFD,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,
-  0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFF,0xFE,0xFC,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0xF7,0xEC,0xB3,0xB0,0x92,0x7D,0x6C,
-  0x31,0x67,0x67,0x0A,0x7F,0x78,0x38,0xE2,0xDF,0xCC,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,
-  0xFE,0xFE,0xFB,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFC,0xFD,0xFE,0xFE,0xFE,0xFD,
-  0xFD,0xFE,0xFD,0xFC,0xFE,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC5,0xC6,0xB1,0x69,
-  0x6F,0x23,0x79,0x72,0x16,0x71,0x70,0x15,0x9E,0xA2,0x75,0xFA,0xF8,0xF6,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFE,
-  0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,0xFD,
-  0xFE,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,0xFD,0xFD,0xFD,0xFE,0xFE,
-  0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,0xFC,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFE,0xBD,0xC3,0xA0,0x7D,0x76,0x24,0x63,0x5E,0x0C,0x98,0x9C,0x68,0xFE,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFD,0xFD,0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,0xFC,0xFE,0xFE,0xFD,0xFE,
-  0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,0xFA,
-  0xFC,0xFF,0xF9,0xFE,0xFF,0xFF,0xFF,0xFF,0xF9,0x9C,0x8D,0x5C,0x78,0x6B,0x18,0x74,
-  0x6B,0x18,0x88,0x8D,0x4D,0xF4,0xF2,0xEB,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,
-  0xFD,0xFE,0xFF,0xFA,0xFD,0xFE,0xFD,0xFD,0xFE,0xFE,0xFD,0xFD,0xFE,0xFE,0xFE,0xFD,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,
-  0xFD,0xFE,0xFD,0xFE,0xFD,0xFD,0xFE,0xFD,0xFD,0xFE,0xFD,0xFF,0xFE,0xFE,0xFF,0xFE,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC1,0xBE,0x91,0x60,0x65,0x13,0x6D,0x69,0x25,
-  0xE3,0xDD,0xCF,0xFF,0xFF,0xFF,0xFA,0xFE,0xFC,0xFD,0xFD,0xFC,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,0xF9,0xFB,0xFE,
-  0xFF,0xFF,0xFF,0xEE,0xE5,0xD9,0x7C,0x70,0x2A,0x6E,0x70,0x19,0x6D,0x6D,0x1E,0xCF,
-  0xCA,0xB1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFD,0xFD,0xFE,0xFD,0xFD,0xFD,
-  0xFE,0xFD,0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFC,0xFE,0xFD,0xFC,0xFD,
-  0xFE,0xFC,0xFE,0xFD,0xFC,0xF8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xA4,0x98,0x5B,
-  0x68,0x59,0x09,0xBF,0xAF,0x93,0xFF,0xFF,0xFF,0xFB,0xFB,0xFF,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFD,0xFE,0xFD,0xFF,0xFD,0xFE,0xFD,0xFE,0xFE,0xFB,0xFC,0xFF,0xFF,0xFF,0xFF,
-  0xCC,0xC9,0xAE,0x79,0x62,0x1F,0x86,0x6E,0x1B,0x87,0x85,0x48,0xFF,0xFD,0xEF,0xFF,
-  0xFF,0xFF,0xFB,0xFE,0xFF,0xFB,0xFE,0xFE,0xFC,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,
-  0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFA,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xD1,0xD5,0xB6,0x6E,0x5F,0x0E,0x9B,0x92,0x56,0xFF,0xFF,0xFF,0xFC,0xFF,0xFF,0xFD,
-  0xFC,0xFC,0xFE,0xFC,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,
-  0xFE,0xFE,0xFD,0xFE,0xFD,0xFD,0xFD,0xFB,0xFE,0xFF,0xFF,0xFF,0xFF,0xBA,0xB3,0x97,
-  0x6E,0x6B,0x18,0x76,0x71,0x11,0xB0,0x9E,0x85,0xFF,0xFF,0xFF,0xFC,0xFF,0xFF,0xFD,
-  0xFD,0xFF,0xFD,0xFE,0xFD,0xFD,0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,
-  0xFE,0xFD,0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,0xFD,0xFD,0xFE,0xFD,0xFD,
-  0xFE,0xFD,0xFE,0xFD,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFD,0xFD,0xFE,0xFF,0xFE,0xFD,0xFD,0xFE,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFA,0xF7,0x7E,0x79,0x41,0x80,0x79,0x37,0xFF,0xFF,0xFB,0xFF,
-  0xFD,0xFF,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFD,0xFE,0xFE,0xFE,0xFD,0xFD,0xFF,0xFF,0xFF,0xFF,0xB6,0xB0,0x82,0x7E,0x6C,0x0E,
-  0x73,0x6A,0x16,0xC4,0xC2,0x9E,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFD,0xFE,0xFF,0xFD,
-  0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,
-  0xFD,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFC,0xFE,0xFE,
-  0xFC,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFC,0xFD,0xFE,0xFE,0xFE,0xFD,
-  0xFF,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0x92,0x93,0x62,0x7F,0x6E,0x2D,0xFF,
-  0xFF,0xFC,0xFF,0xFF,0xFF,0xFD,0xFE,0xFD,0xFD,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFD,
-  0xFF,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xB3,0xB5,0x8A,0x72,0x6D,0x14,0x71,0x65,0x21,
-  0xC8,0xCC,0xB2,0xFF,0xFF,0xFF,0xFB,0xFD,0xFF,0xFF,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,
-  0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFF,
-  0xFE,0xFE,0xFF,0xFD,0xFF,0xFF,0xFD,0xFF,0xFE,0xFD,0xFE,0xFF,0xFD,0xFD,0xFF,0xFD,
-  0xFF,0xFF,0xFE,0xFE,0xFF,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFE,
-  0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xAE,0xAD,0x73,0x7B,
-  0x70,0x31,0xFF,0xFF,0xFE,0xFD,0xFE,0xFF,0xF4,0xFE,0xFD,0xFD,0xFD,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFD,0xFC,0xFA,
-  0xFF,0xFF,0xFF,0xFF,0xCD,0xC3,0x9E,0x77,0x6D,0x18,0x6F,0x6E,0x12,0xD4,0xCE,0xB7,
-  0xFF,0xFF,0xFF,0xFF,0xFA,0xFF,0xFE,0xFE,0xFC,0xFD,0xFD,0xFF,0xFE,0xFE,0xFD,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,
-  0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFC,0xFF,0xFC,0xFF,0xFF,0xFF,0xB4,
-  0xAA,0x8C,0x81,0x76,0x49,0xFF,0xFF,0xFF,0xFD,0xFD,0xFF,0xFE,0xFE,0xFE,0xFB,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFD,0xFE,0xFE,0xFF,0xFE,0xFE,0xFF,0xFE,0xFE,0xFC,0xFD,0xFE,0xFF,0xFF,
-  0xFF,0xE4,0xDF,0xD1,0x7A,0x65,0x1D,0x7D,0x64,0x21,0xCC,0xC3,0xA9,0xFF,0xFF,0xFF,
-  0xFE,0xFD,0xFF,0xFD,0xFD,0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFD,0xFD,0xFE,0xFC,0xFB,0xFE,0xFC,
-  0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFD,0xE1,0xD9,0xCF,0xC0,
-  0xBD,0xA1,0xAA,0xA5,0x77,0x97,0x95,0x66,0x8E,0x8E,0x5B,0x8F,0x91,0x57,0x96,0x97,
-  0x5E,0xA9,0xA4,0x7F,0xC1,0xBD,0x97,0xDE,0xDE,0xC4,0xFF,0xFF,0xFA,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFB,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xA8,0xA3,0x7A,0x9F,0x97,0x63,0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,0xFF,0xFE,
-  0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFD,0xFE,0xFE,0xFF,0xFD,0xFE,0xFF,0xFE,0xFE,0xFF,0xFF,0xFF,0xFE,0xFD,
-  0xF1,0x70,0x6F,0x19,0x76,0x70,0x15,0xB3,0xAA,0x87,0xFF,0xFF,0xFF,0xFC,0xFE,0xFF,
-  0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,
-  0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFC,0xFE,0xFD,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xC7,0xC5,0xA6,0x8B,0x8C,0x5B,0x6B,0x6C,0x24,0x76,0x70,0x1A,0x78,
-  0x73,0x1D,0x81,0x74,0x22,0x81,0x75,0x27,0x82,0x76,0x27,0x82,0x77,0x27,0x82,0x76,
-  0x25,0x7F,0x74,0x23,0x7D,0x71,0x1E,0x72,0x70,0x16,0x6D,0x6D,0x1F,0x8F,0x87,0x55,
-  0xC0,0xC3,0x9C,0xFF,0xFF,0xFA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFD,0xFD,0xFE,
-  0xFE,0xFE,0xFD,0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,
-  0xFC,0xFF,0xFF,0xFF,0xFF,0x92,0x89,0x5D,0xCC,0xC5,0xA4,0xFF,0xFF,0xFF,0xFE,0xFE,
-  0xFC,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFD,0xFE,0xFC,0xFE,0xFE,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0x80,0x85,
-  0x49,0x80,0x71,0x1B,0x8C,0x87,0x5F,0xFF,0xFF,0xFF,0xF9,0xFF,0xFE,0xF6,0xFE,0xFD,
-  0xFD,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFC,
-  0xFE,0xFE,0xFD,0xFD,0xFE,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xAD,0xA7,0x83,
-  0x68,0x6C,0x23,0x77,0x6E,0x22,0x82,0x78,0x24,0x82,0x81,0x1F,0x80,0x7C,0x2B,0x82,
-  0x79,0x33,0x85,0x79,0x2F,0x84,0x7B,0x2D,0x84,0x7B,0x2D,0x84,0x7B,0x2E,0x84,0x7A,
-  0x2F,0x84,0x7A,0x2E,0x85,0x79,0x2F,0x87,0x7C,0x28,0x8C,0x7A,0x29,0x85,0x77,0x25,
-  0x74,0x72,0x22,0x6C,0x65,0x24,0xA3,0xA7,0x72,0xFA,0xFE,0xEB,0xFF,0xFF,0xFF,0xFF,
-  0xFE,0xFF,0xFE,0xFE,0xFD,0xFE,0xFE,0xFC,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,
-  0xFE,0xFD,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0x72,0x6C,0x32,0xEE,0xF4,0xD3,0xFF,0xFF,
-  0xFF,0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFD,0xFE,0xFC,0xFF,0xFD,0xFF,0xFF,0xFF,0xB7,0xBA,0x99,0x6E,0x71,
-  0x0C,0x7E,0x71,0x2F,0xFF,0xFF,0xF8,0xFF,0xFE,0xFF,0xFC,0xFE,0xFE,0xFD,0xFD,0xFD,
-  0xFF,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFF,0xFE,0xFE,0xFF,0xFD,0xFE,0xFF,0xFD,
-  0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xC0,0xC0,0x99,0x70,0x67,0x25,0x80,0x73,0x21,
-  0x85,0x7A,0x2A,0x86,0x7A,0x2F,0x84,0x79,0x32,0x83,0x7B,0x2C,0x83,0x7A,0x2F,0x85,
-  0x7A,0x2F,0x84,0x7A,0x2F,0x85,0x7B,0x2E,0x85,0x7B,0x2D,0x85,0x7B,0x2D,0x85,0x7B,
-  0x2D,0x85,0x7B,0x2D,0x83,0x7B,0x2D,0x84,0x7A,0x2E,0x87,0x7A,0x2E,0x83,0x7A,0x2E,
-  0x85,0x7B,0x2D,0x87,0x7A,0x2B,0x78,0x77,0x1F,0x6F,0x65,0x24,0xBD,0xB0,0x97,0xFF,
-  0xFF,0xFE,0xFD,0xFF,0xFF,0xF9,0xFD,0xFF,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xF3,0xF3,0xE6,0x6C,0x7A,0x3E,0xFF,0xFF,
-  0xFE,0xFF,0xFE,0xFF,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xF3,0xF1,0xEA,0x6E,0x68,0x24,0x77,0x63,
-  0x1F,0xDB,0xD6,0xCB,0xFF,0xFF,0xFF,0xFC,0xFE,0xFD,0xFF,0xFD,0xFE,0xFD,0xFE,0xFE,
-  0xFC,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFE,0xFC,0xFF,0xFC,0xFF,0xFF,0xFF,
-  0xFF,0xF8,0xFD,0xE8,0x79,0x85,0x3B,0x71,0x6D,0x1C,0x87,0x7B,0x29,0x85,0x7A,0x2F,
-  0x84,0x79,0x2F,0x85,0x7B,0x2D,0x85,0x7B,0x2D,0x85,0x7A,0x2E,0x85,0x7B,0x2D,0x85,
-  0x7A,0x2E,0x85,0x7B,0x2D,0x85,0x7B,0x2E,0x85,0x7B,0x2D,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x84,0x7B,0x2E,0x85,0x7B,0x2E,0x86,0x7A,0x2E,0x85,0x7A,0x2E,0x84,0x7A,0x2E,
-  0x84,0x7B,0x2D,0x83,0x79,0x31,0x83,0x7D,0x2A,0x7D,0x7B,0x2E,0x75,0x6C,0x21,0x83,
-  0x7C,0x34,0xF5,0xF2,0xEA,0xFF,0xFF,0xFF,0xFD,0xFE,0xFF,0xFE,0xFE,0xFE,0xFE,0xFD,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,
-  0xFE,0xFE,0xFC,0xFD,0xFD,0xFC,0xFE,0xFE,0xFF,0xFF,0xFF,0xB5,0xBA,0x93,0xBB,0xBA,
-  0xA6,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFA,
-  0xFE,0xFD,0xF8,0xFD,0xFE,0xFF,0xFF,0xFF,0x98,0x85,0x5B,0x7E,0x6F,0x17,0xA5,0x9D,
-  0x71,0xFF,0xFF,0xFF,0xFD,0xFD,0xFD,0xFE,0xFE,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFD,0xFC,0xFE,0xFE,0xFE,0xFB,0xFF,0xFF,0xFF,0xFF,0xE7,0xE4,
-  0xCD,0x65,0x68,0x26,0x7A,0x76,0x27,0x8B,0x79,0x33,0x88,0x78,0x31,0x83,0x7B,0x2C,
-  0x85,0x7B,0x2D,0x84,0x7B,0x2D,0x85,0x7B,0x2D,0x85,0x7B,0x2D,0x85,0x7B,0x2E,0x85,
-  0x7B,0x2D,0x85,0x7B,0x2E,0x85,0x7B,0x2D,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x84,0x7B,0x2E,0x84,0x7B,0x2E,0x84,0x7B,0x2E,0x85,0x7B,0x2E,
-  0x85,0x7A,0x2E,0x84,0x7C,0x2D,0x82,0x7C,0x2C,0x83,0x7C,0x2C,0x80,0x7C,0x29,0x86,
-  0x78,0x2B,0x6B,0x63,0x24,0xDB,0xD9,0xC1,0xFF,0xFF,0xFF,0xFB,0xFE,0xFD,0xFD,0xFE,
-  0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFE,0xFD,0xFF,0xFF,0xFF,0xFF,0xFE,
-  0xFF,0xFE,0xFF,0xFD,0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFA,
-  0xFD,0xFE,0xFF,0xFF,0xFF,0xDA,0xDA,0xC3,0x74,0x69,0x1B,0x6E,0x70,0x24,0xFF,0xFF,
-  0xF5,0xFC,0xFF,0xFF,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFE,0xFF,0xFF,0xFF,0xFF,0xDD,0xD7,0xC1,0x75,0x66,
-  0x23,0x81,0x7B,0x27,0x84,0x7C,0x2D,0x82,0x7A,0x2F,0x82,0x7A,0x2E,0x80,0x7B,0x2D,
-  0x85,0x7A,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,
-  0x85,0x7A,0x2E,0x84,0x7B,0x2D,0x84,0x7B,0x2D,0x84,0x7B,0x2D,0x84,0x7A,0x2F,0x85,
-  0x7A,0x2D,0x84,0x7A,0x2B,0x6B,0x67,0x1A,0xCF,0xCC,0xB9,0xFF,0xFF,0xFF,0xFD,0xFD,
-  0xFF,0xFE,0xFE,0xFC,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,
-  0xFE,0xFD,0xFF,0xFF,0xFF,0x85,0x7A,0x40,0x6D,0x6C,0x13,0xB9,0xC3,0x8D,0xFF,0xFF,
-  0xFF,0xFD,0xFD,0xFF,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFD,0xFE,0xFF,0xFF,0xFF,0xE1,0xDE,0xC5,0x6D,0x63,0x24,0x7D,0x7D,
-  0x26,0x83,0x7C,0x2B,0x85,0x7A,0x2D,0x85,0x7B,0x2D,0x85,0x7B,0x2D,0x86,0x7A,0x2E,
-  0x84,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,
-  0x85,0x7B,0x2D,0x85,0x7B,0x2E,0x85,0x7A,0x2E,0x85,0x7A,0x2E,0x85,0x7B,0x2D,0x84,
-  0x7B,0x2D,0x86,0x7A,0x2F,0x85,0x7A,0x2C,0x6B,0x64,0x19,0xD7,0xD3,0xBB,0xFF,0xFF,
-  0xFF,0xFC,0xFD,0xFF,0xFC,0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFC,0xFD,0xFE,0xFC,0xFD,0xFD,0xFD,0xFE,
-  0xFE,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFF,0xFB,0xFF,
-  0xFF,0xFF,0xD7,0xD7,0xBD,0x73,0x6C,0x19,0x75,0x75,0x31,0xFF,0xFF,0xFF,0xFE,0xFE,
-  0xFF,0xFE,0xFD,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFD,0xFE,0xFE,0xFF,0xFF,0xF3,0xF6,0xE4,0x69,0x6B,0x1E,0x88,0x76,0x30,0x84,0x7B,
-  0x2D,0x85,0x7A,0x2E,0x85,0x7B,0x2E,0x84,0x7B,0x2E,0x84,0x7B,0x2E,0x84,0x7B,0x2E,
-  0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,
-  0x85,0x7B,0x2E,0x85,0x7B,0x2D,0x85,0x7B,0x2D,0x85,0x7B,0x2D,0x84,0x7B,0x2E,0x84,
-  0x7B,0x2D,0x85,0x7B,0x2E,0x85,0x7A,0x2D,0x84,0x7B,0x2A,0x72,0x68,0x21,0xED,0xEA,
-  0xDE,0xFF,0xFF,0xFF,0xFD,0xFF,0xFC,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFB,0xFB,0xFB,0xFC,0xFC,0xFC,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFD,0xFF,0xFF,
-  0xFF,0xFF,0x83,0x89,0x4F,0x72,0x6A,0x18,0xC3,0xBD,0x95,0xFF,0xFF,0xFF,0xFC,0xFE,
-  0xFF,0xFE,0xFE,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,0xFD,0xFE,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0x7E,0x77,0x42,0x81,0x79,0x24,0x8B,0x76,0x33,0x82,0x7B,
-  0x2D,0x85,0x7A,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,
-  0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,
-  0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,
-  0x7A,0x2D,0x83,0x7B,0x2E,0x83,0x7A,0x2E,0x88,0x7A,0x2E,0x82,0x76,0x29,0x7F,0x73,
-  0x35,0xFF,0xFF,0xF4,0xFF,0xFE,0xFF,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,0xFA,0xFF,0xFD,0xFF,0xF1,
-  0xED,0xE4,0x64,0x6B,0x13,0x6B,0x71,0x1E,0xFF,0xFF,0xFB,0xFD,0xFD,0xFF,0xFD,0xFD,
-  0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFF,0xFC,0xFE,0xF9,0xFE,0xFD,0xFF,
-  0xFF,0xFF,0xAB,0xB1,0x8D,0x7D,0x6D,0x21,0x87,0x7B,0x28,0x84,0x7B,0x2E,0x84,0x7A,
-  0x2D,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,
-  0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x84,0x7A,0x2D,0x84,0x7A,0x2D,0x84,0x7A,0x2D,0x84,0x7A,
-  0x2D,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,
-  0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,
-  0x7B,0x2E,0x85,0x7A,0x2D,0x85,0x7B,0x2D,0x84,0x7A,0x2E,0x85,0x7C,0x2B,0x7A,0x71,
-  0x1E,0xAC,0xA1,0x7A,0xFF,0xFF,0xFF,0xFF,0xFC,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFC,0xFE,0xFA,0xFF,0xFF,0xFF,0xAE,
-  0xA6,0x80,0x73,0x6D,0x15,0xA2,0xA8,0x78,0xFF,0xFF,0xFF,0xFD,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFC,0xFF,0xFF,0xF6,
-  0xF7,0xE7,0x63,0x64,0x1D,0x85,0x7D,0x29,0x84,0x7A,0x2F,0x85,0x7B,0x2D,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,
-  0x84,0x7B,0x2E,0x85,0x7A,0x2D,0x85,0x7A,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x84,
-  0x7B,0x2E,0x85,0x7B,0x2C,0x84,0x79,0x2B,0x84,0x7A,0x2B,0x84,0x7A,0x2C,0x84,0x7A,
-  0x2C,0x85,0x7B,0x2D,0x85,0x7B,0x2D,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x84,0x7A,0x2E,
-  0x85,0x7B,0x2D,0x84,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7A,0x2E,0x84,0x7B,0x2C,0x7E,0x7C,
-  0x2E,0x72,0x63,0x29,0xEC,0xEB,0xD9,0xFF,0xFF,0xFF,0xFC,0xFC,0xFD,0xFE,0xFE,0xFE,
-  0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFC,0xFC,0xFC,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFC,0xFC,0xFF,0xFE,0xFF,0xFF,0xFF,0x77,
-  0x72,0x2E,0x6F,0x69,0x1E,0xE7,0xE6,0xD2,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFD,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFE,0xFF,0xFF,0xFF,0x9E,
-  0x9A,0x6D,0x7F,0x78,0x20,0x86,0x79,0x2F,0x86,0x7B,0x2D,0x84,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x84,0x7B,0x2E,
-  0x86,0x7A,0x2D,0x84,0x7A,0x2E,0x83,0x7B,0x2E,0x83,0x7B,0x2D,0x83,0x79,0x29,0x7E,
-  0x73,0x20,0x75,0x6A,0x22,0x80,0x77,0x2C,0x8D,0x84,0x3D,0x8F,0x86,0x3E,0x7F,0x77,
-  0x2E,0x76,0x6A,0x20,0x7D,0x71,0x23,0x81,0x79,0x28,0x85,0x7B,0x2D,0x87,0x7B,0x2B,
-  0x83,0x7A,0x2E,0x85,0x7B,0x2D,0x84,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x84,0x7A,0x2E,0x80,0x7C,
-  0x2C,0x7E,0x79,0x21,0x8B,0x90,0x58,0xFF,0xFF,0xFF,0xFD,0xFD,0xFF,0xFE,0xFE,0xFE,
-  0xFD,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,
-  0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFC,0xFF,0xFF,0xFF,0xE5,0xE1,0xD6,0x6E,
-  0x6C,0x17,0x78,0x73,0x39,0xFF,0xFF,0xFF,0xFC,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFF,0xFF,0xFF,0xFA,0xF7,0xF1,0x6D,
-  0x5D,0x2B,0x80,0x7D,0x29,0x84,0x7A,0x2C,0x86,0x7B,0x2E,0x84,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x84,0x7B,0x2E,
-  0x86,0x79,0x2E,0x81,0x7D,0x2A,0x82,0x7E,0x28,0x71,0x71,0x22,0x76,0x73,0x32,0xBB,
-  0xBB,0x8F,0xF1,0xEE,0xF1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xF4,0xF1,0xE5,0xBB,0xBC,0x92,0x70,0x74,0x31,0x75,0x70,0x23,0x8D,0x7D,0x24,
-  0x85,0x7A,0x2D,0x84,0x7A,0x2E,0x85,0x7B,0x2D,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7A,0x2E,0x83,0x7B,0x2C,0x83,0x7B,
-  0x2D,0x86,0x7A,0x2C,0x6F,0x6A,0x1D,0xEE,0xEC,0xE1,0xFF,0xFF,0xFF,0xFD,0xFE,0xFE,
-  0xFC,0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFC,
-  0xFC,0xFC,0xFD,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFF,0xFF,0xFF,0xFF,0xAE,0xAF,0x7F,0x72,
-  0x6D,0x19,0xB0,0xAC,0x87,0xFF,0xFF,0xFF,0xFB,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFD,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xB4,0xB0,0x9A,0x77,
-  0x72,0x21,0x7E,0x7D,0x2B,0x82,0x7B,0x2D,0x85,0x7A,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7A,0x2E,
-  0x84,0x7C,0x2B,0x80,0x7C,0x2C,0x6F,0x62,0x27,0xA4,0x9D,0x7D,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFA,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFF,
-  0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA8,0xA6,0x86,0x6E,0x6B,0x1C,
-  0x87,0x7B,0x2B,0x84,0x7A,0x2E,0x84,0x7A,0x2E,0x84,0x7B,0x2E,0x85,0x7B,0x2E,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2D,0x84,0x7A,0x2E,0x85,0x7A,
-  0x2E,0x84,0x7A,0x2F,0x7D,0x74,0x24,0xA2,0xA5,0x76,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,
-  0xFC,0xFD,0xFF,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFD,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0x8C,0x86,0x40,0x6B,
-  0x6E,0x19,0xDA,0xD9,0xC0,0xFF,0xFF,0xFF,0xFE,0xFF,0xFC,0xFC,0xFD,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,0xFC,0xFA,0xFE,0xFF,0xFF,0xFF,0x79,0x75,0x42,0x82,
-  0x7A,0x27,0x85,0x7A,0x2E,0x85,0x7A,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x84,0x7B,0x2D,
-  0x87,0x7A,0x2F,0x75,0x6A,0x1E,0xC3,0xB7,0xA1,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFD,
-  0xFE,0xFE,0xFD,0xFD,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,0xFD,0xFD,0xFD,0xFE,0xFD,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFB,0xFF,0xFD,0xFC,0xFD,0xFF,0xFF,0xFF,0xFF,0xC6,0xC7,0xA9,
-  0x70,0x6B,0x1D,0x89,0x7C,0x26,0x86,0x7B,0x2B,0x85,0x7A,0x2E,0x84,0x7B,0x2E,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2D,0x85,0x7B,
-  0x2D,0x83,0x7A,0x2E,0x83,0x7A,0x28,0x74,0x72,0x2E,0xFF,0xFF,0xFF,0xFC,0xFF,0xFE,
-  0xFF,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0x7C,0x6A,0x1F,0x6F,
-  0x70,0x1F,0xFF,0xFE,0xFA,0xFF,0xFD,0xFF,0xFD,0xFF,0xFD,0xFC,0xFD,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFD,0xFE,0xFC,0xFF,0xFF,0xFF,0xFF,0xF4,0xF2,0xE7,0x6B,0x68,0x17,0x88,
-  0x79,0x2E,0x84,0x7B,0x2D,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7A,0x2E,0x84,0x7B,0x2E,0x85,0x7B,0x2D,
-  0x78,0x70,0x20,0xB7,0xA9,0x86,0xFF,0xFF,0xFF,0xF8,0xFB,0xFE,0xFF,0xFE,0xFC,0xFD,
-  0xFD,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,0xFD,0xFE,0xFD,0xFE,0xFD,0xFC,0xFF,0xFF,0xFF,0xFF,
-  0xB8,0xB8,0x8B,0x76,0x6D,0x25,0x87,0x7B,0x29,0x85,0x7B,0x2E,0x84,0x7B,0x2E,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x84,0x7B,0x2E,0x8B,0x7B,0x2B,0x6F,0x6A,0x18,0xE3,0xE1,0xD2,0xFF,0xFF,0xFF,
-  0xFE,0xFE,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xDE,0xDE,0xD6,0x77,0x66,0x1E,0x85,
-  0x89,0x44,0xFF,0xFF,0xFF,0xFD,0xFC,0xFD,0xFE,0xFE,0xFD,0xFD,0xFD,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFD,0xFD,0xFE,0xFE,0xFE,0xFC,0xFF,0xFF,0xFF,0xC8,0xC8,0xAD,0x73,0x72,0x1C,0x86,
-  0x7A,0x2E,0x84,0x7B,0x2D,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7A,0x2E,0x83,0x7B,0x2D,0x86,0x7B,0x2D,0x7F,0x77,0x27,
-  0x82,0x7A,0x37,0xFF,0xFF,0xFF,0xFE,0xFE,0xFF,0xFF,0xFE,0xFE,0xFC,0xFE,0xFE,0xFE,
-  0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFD,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,0xFF,
-  0xFF,0xFF,0xFF,0x7A,0x7D,0x49,0x7D,0x77,0x2A,0x86,0x7A,0x2E,0x84,0x7B,0x2D,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2D,0x84,0x7B,0x2E,0x86,0x7B,0x2C,0x7A,0x75,0x1A,0xBA,0xBB,0x8C,0xFF,0xFF,0xFF,
-  0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xC2,0xC0,0x9F,0x7A,0x66,0x18,0xA6,
-  0xA8,0x74,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFF,0xFF,0xFF,0xA4,0xA6,0x75,0x76,0x72,0x21,0x88,
-  0x7A,0x2E,0x84,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x82,0x7A,0x2E,0x87,0x7A,0x2D,0x73,0x73,0x1A,
-  0xCA,0xC7,0xB4,0xFF,0xFF,0xFF,0xFE,0xFD,0xFF,0xFD,0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,0xFC,0xFE,0xFD,
-  0xFF,0xFF,0xFF,0xD7,0xD8,0xB7,0x73,0x6F,0x1D,0x86,0x79,0x2F,0x84,0x7B,0x2D,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2D,0x85,0x7A,0x2F,0x84,0x7A,0x2F,0x7F,0x74,0x24,0xA6,0x9D,0x5F,0xFF,0xFF,0xFF,
-  0xFE,0xFD,0xFF,0xFD,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xA6,0xAA,0x74,0x7F,0x67,0x1C,0xC1,
-  0xBE,0x9E,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFD,0xFD,0xFE,0xFE,0xFE,0xFD,0xFF,0xFF,0xFF,0x8C,0x8C,0x5A,0x7B,0x78,0x24,0x88,
-  0x79,0x30,0x84,0x7B,0x2D,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x83,0x7B,0x2D,0x86,0x78,0x2F,0x6D,0x6E,0x26,
-  0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFD,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFC,0xFE,0xFC,
-  0xFE,0xFC,0xFF,0xFF,0xFF,0xFF,0x76,0x70,0x2C,0x86,0x79,0x2B,0x84,0x7B,0x2D,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2D,0x85,0x7B,0x2E,0x85,0x7A,0x2E,0x83,0x78,0x2A,0x88,0x7F,0x40,0xFF,0xFF,0xFF,
-  0xFE,0xFE,0xFE,0xFC,0xFC,0xFC,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0x9B,0x96,0x57,0x79,0x66,0x16,0xD3,
-  0xD3,0xBE,0xFF,0xFF,0xFF,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFD,0xFE,0xFD,0xFF,0xFF,0xFF,0xFF,0x84,0x7F,0x41,0x80,0x79,0x29,0x83,
-  0x7B,0x2D,0x85,0x7B,0x2D,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2D,0x81,0x76,0x2D,0x8F,0x89,0x55,
-  0xFF,0xFF,0xFF,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFD,0xFD,0xFD,0xFF,0xFF,0xFF,0x9C,0x91,0x5B,0x80,0x76,0x29,0x85,0x7B,0x2D,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2D,0x85,0x7B,0x2D,0x84,0x7A,0x2B,0x79,0x74,0x2F,0xFF,0xFF,0xFF,
-  0xFF,0xFD,0xFF,0xFE,0xFF,0xFD,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFC,0xFC,0xFC,0xFA,0xFA,0xFA,0xFB,0xFB,0xFB,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0x8C,0x81,0x43,0x7D,0x68,0x18,0xE7,
-  0xE8,0xD4,0xFF,0xFF,0xFF,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFD,0xFE,0xFD,0xFF,0xFF,0xFF,0xFF,0x7A,0x79,0x2D,0x83,0x79,0x2C,0x85,
-  0x7A,0x2F,0x84,0x7B,0x2D,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x84,0x7B,0x2D,0x86,0x7A,0x2E,0x7B,0x72,0x26,0xA1,0x9F,0x6F,
-  0xFF,0xFF,0xFF,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,
-  0xFE,0xFD,0xFD,0xFF,0xFF,0xFF,0xB3,0xAD,0x7A,0x7C,0x70,0x23,0x85,0x7B,0x2E,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7A,0x2C,0x74,0x70,0x27,0xFF,0xFF,0xFC,
-  0xFF,0xFD,0xFF,0xFE,0xFF,0xFE,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFD,0xFE,0xFE,0xFD,0xFE,0xFD,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFF,0xFF,0xFF,0x7A,0x79,0x34,0x7A,0x69,0x18,0xF2,
-  0xF5,0xE7,0xFF,0xFF,0xFF,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0x77,0x74,0x2D,0x83,0x78,0x2E,0x85,
-  0x7A,0x2F,0x84,0x7B,0x2D,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x84,0x7B,0x2D,0x86,0x7A,0x2F,0x79,0x73,0x23,0xA3,0xA2,0x73,
-  0xFF,0xFF,0xFF,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xB5,0xB2,0x7F,0x7F,0x72,0x25,0x85,0x7B,0x2D,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7A,0x2C,0x73,0x6D,0x29,0xFF,0xFF,0xFF,
-  0xFF,0xFD,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,
-  0xFE,0xFD,0xFD,0xFC,0xFE,0xFE,0xFF,0xFF,0xFF,0x6E,0x74,0x23,0x79,0x69,0x20,0xF9,
-  0xFC,0xFC,0xFE,0xFF,0xFF,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0x7F,0x7A,0x39,0x82,0x78,0x2D,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2D,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2D,0x85,0x7A,0x2E,0x7D,0x77,0x26,0x97,0x97,0x60,
-  0xFF,0xFF,0xFF,0xFC,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFF,0xFE,0xFE,
-  0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xA7,0xA4,0x68,0x7E,0x72,0x22,0x85,0x7B,0x2E,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2D,0x85,0x7A,0x2B,0x74,0x6F,0x2B,0xFF,0xFF,0xFF,
-  0xFF,0xFE,0xFB,0xFD,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFF,0xFD,0xFE,0xFF,0xFB,0xFE,0xFF,0xFF,0xFF,
-  0xFF,0xFC,0xFF,0xFD,0xFE,0xFE,0xFF,0xFF,0xFF,0x6E,0x75,0x20,0x79,0x6A,0x22,0xF9,
-  0xFF,0xFD,0xFE,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0x8E,0x88,0x46,0x82,0x76,0x2D,0x84,
-  0x7B,0x2E,0x85,0x7B,0x2D,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2D,0x85,0x7A,0x2F,0x7F,0x7A,0x28,0x74,0x77,0x3A,
-  0xFF,0xFF,0xFF,0xFD,0xFE,0xFF,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFF,0xFE,0xFE,
-  0xFF,0xFE,0xFE,0xFF,0xFF,0xFF,0x7E,0x7D,0x40,0x85,0x77,0x2C,0x84,0x7B,0x2D,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x84,0x7B,0x2D,0x85,0x7B,0x2D,0x84,0x79,0x2A,0x80,0x79,0x36,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xF8,0xFD,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFF,0xFC,0xFE,0xFF,0xFF,0xFF,0xDC,0xE1,0xC6,
-  0xFD,0xFB,0xF8,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0x73,0x73,0x25,0x7B,0x69,0x1F,0xFB,
-  0xFD,0xFC,0xFE,0xFF,0xFF,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFF,0xFF,0xFF,0x9A,0x95,0x72,0x7A,0x75,0x20,0x88,
-  0x79,0x30,0x84,0x7B,0x2D,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2D,0x83,0x7B,0x2E,0x88,0x7A,0x2E,0x6E,0x65,0x23,
-  0xEF,0xEC,0xDD,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFE,0xFE,
-  0xFF,0xFC,0xFF,0xF7,0xF4,0xE6,0x6E,0x69,0x20,0x87,0x7A,0x2D,0x84,0x7B,0x2D,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x84,0x7B,
-  0x2E,0x86,0x7B,0x2C,0x81,0x75,0x37,0x7E,0x7B,0x22,0x93,0x8C,0x53,0xFF,0xFF,0xFF,
-  0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFC,0xFF,0xFF,0xFF,0x88,0x8E,0x5B,
-  0xF3,0xF1,0xEA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x76,0x74,0x27,0x7C,0x67,0x1F,0xFA,
-  0xFA,0xF9,0xFF,0xFF,0xFF,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFD,0xFD,0xFE,0xFE,0xFE,0xFC,0xFF,0xFF,0xFF,0xBA,0xB5,0x9D,0x76,0x74,0x1C,0x84,
-  0x7A,0x2E,0x85,0x7B,0x2D,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x84,0x7B,0x2D,0x8B,0x76,0x33,0x7F,0x74,0x23,
-  0x98,0x9A,0x6A,0xFF,0xFF,0xFF,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFF,
-  0xFF,0xFF,0xFF,0xA6,0xA4,0x76,0x7E,0x73,0x25,0x85,0x7B,0x2E,0x85,0x7B,0x2D,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x84,0x7B,
-  0x2D,0x86,0x79,0x2E,0x80,0x79,0x31,0x79,0x77,0x20,0xAF,0xA7,0x84,0xFF,0xFF,0xFF,
-  0xFD,0xFE,0xFF,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFB,0xFE,0xFE,0xFF,0xFF,0xFF,0x92,0x93,0x5E,
-  0xF7,0xF6,0xEA,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0x81,0x7E,0x34,0x7B,0x66,0x1A,0xF2,
-  0xF1,0xEC,0xFF,0xFF,0xFF,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,0xFF,0xFF,0xFF,0xE2,0xE1,0xCB,0x6E,0x6E,0x13,0x85,
-  0x7A,0x2F,0x85,0x7B,0x2D,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x83,0x7B,0x2D,0x86,0x77,0x35,0x85,0x7C,0x26,
-  0x66,0x68,0x1E,0xDE,0xDE,0xD9,0xFF,0xFF,0xFF,0xFE,0xFD,0xFC,0xFD,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFD,0xFD,0xFD,0xFE,0xFD,0xFF,0xFF,0xFF,0xFF,
-  0xEE,0xEB,0xDF,0x66,0x66,0x1F,0x81,0x79,0x2E,0x85,0x7B,0x2D,0x85,0x7B,0x2E,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2D,0x84,0x7A,0x2F,0x82,0x80,0x26,0x6E,0x71,0x15,0xD3,0xCE,0xB8,0xFF,0xFF,0xFF,
-  0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFA,0xFD,0xFF,0xFF,0xFF,0xFF,0x88,0x89,0x51,
-  0xFA,0xFD,0xF4,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0x86,0x46,0x7D,0x6B,0x1A,0xE4,
-  0xE4,0xD3,0xFF,0xFF,0xFF,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFC,0xFE,0xFD,0xFD,0xFF,0xFF,0xFF,0xFF,0xFE,0x70,0x6E,0x21,0x86,
-  0x79,0x2D,0x84,0x7B,0x2D,0x84,0x7B,0x2D,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2D,0x84,0x79,0x30,0x85,0x7A,0x2E,
-  0x82,0x7A,0x29,0x71,0x71,0x29,0xFD,0xFA,0xF3,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFD,0xFE,0xFE,0xFF,0xFD,0xFD,0xFC,0xFB,0xFF,0xFF,0xFF,0xFF,0xFC,0xFE,0xEF,
-  0x7F,0x6C,0x47,0x7B,0x7A,0x2B,0x83,0x7B,0x2C,0x83,0x7A,0x2E,0x85,0x7B,0x2E,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x84,0x7B,
-  0x2D,0x85,0x7A,0x2F,0x84,0x7D,0x27,0x6B,0x6C,0x1D,0xFE,0xFC,0xF4,0xFE,0xFF,0xFF,
-  0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFB,0xFE,0xFD,0xFF,0xFF,0xFF,0x7B,0x7A,0x41,
-  0xFF,0xFF,0xFF,0xFF,0xFD,0xFE,0xFF,0xFF,0xFF,0xA2,0x9C,0x59,0x78,0x67,0x12,0xCF,
-  0xD0,0xBF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFC,0xFE,0xFD,0xFC,0xFD,0xFF,0xFF,0xFF,0xFF,0x9F,0x97,0x65,0x83,
-  0x75,0x26,0x84,0x7A,0x2D,0x84,0x7B,0x2E,0x84,0x7B,0x2D,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2D,0x85,0x7B,0x2D,0x84,0x79,0x30,
-  0x85,0x7B,0x2C,0x87,0x78,0x26,0x78,0x72,0x2F,0xF2,0xF1,0xE5,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,0xFD,0xFD,0xFE,0xFD,0xFD,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0xF7,0xE2,0x83,0x76,0x31,
-  0x7C,0x76,0x28,0x7E,0x7C,0x2C,0x83,0x7A,0x2C,0x83,0x7B,0x2E,0x85,0x7B,0x2D,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x84,0x7B,
-  0x2D,0x87,0x79,0x2D,0x83,0x74,0x2D,0x8D,0x8B,0x50,0xFF,0xFF,0xFF,0xFC,0xFE,0xFE,
-  0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFB,0xFD,0xFE,0xFF,0xFF,0xFF,0x73,0x74,0x38,
-  0xFF,0xFF,0xFF,0xFF,0xFC,0xFE,0xFF,0xFF,0xFF,0xAE,0xAF,0x7B,0x78,0x63,0x14,0xBB,
-  0xBA,0x9B,0xFF,0xFF,0xFF,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xE1,0xDD,0xCC,0x6F,
-  0x6B,0x17,0x8A,0x79,0x2F,0x86,0x79,0x2F,0x86,0x7B,0x2D,0x84,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2D,0x84,0x7B,0x2D,
-  0x87,0x79,0x2F,0x87,0x78,0x32,0x85,0x7A,0x23,0x62,0x67,0x1D,0xAC,0xAE,0x89,0xFF,
-  0xFE,0xFA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0xBA,0xB6,0x8B,0x74,0x6A,0x24,0x86,0x78,0x27,
-  0x84,0x7C,0x2C,0x82,0x7B,0x2D,0x85,0x7A,0x2E,0x85,0x7B,0x2D,0x85,0x7B,0x2E,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2D,0x84,0x7B,0x2E,0x70,0x6E,0x1C,0xCA,0xCB,0xB0,0xFF,0xFF,0xFF,0xFE,0xFD,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFC,0xFF,0xFF,0xFE,0xFD,0xED,0x81,0x7A,0x46,
-  0xFF,0xFF,0xFF,0xFD,0xFD,0xFD,0xFF,0xFF,0xFF,0xC4,0xC1,0xA2,0x7F,0x69,0x18,0x9C,
-  0xA1,0x6B,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFF,0xFF,0xFF,0xFF,0x80,
-  0x7D,0x46,0x87,0x77,0x29,0x86,0x79,0x2F,0x86,0x7B,0x2D,0x84,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7A,0x2D,
-  0x84,0x7B,0x2D,0x84,0x7A,0x30,0x84,0x79,0x30,0x82,0x7C,0x2D,0x77,0x75,0x21,0x70,
-  0x6C,0x1C,0x96,0x8D,0x68,0xBB,0xB8,0x90,0xCD,0xCB,0xAB,0xCC,0xCC,0xAF,0xBE,0xBB,
-  0x9B,0x97,0x94,0x61,0x6A,0x6F,0x28,0x75,0x71,0x22,0x83,0x7B,0x2C,0x86,0x79,0x30,
-  0x84,0x79,0x30,0x84,0x7B,0x2F,0x85,0x7B,0x2D,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x84,0x7B,0x2D,0x84,0x7B,
-  0x2E,0x84,0x79,0x2A,0x73,0x71,0x2D,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFE,0xFD,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFC,0xFF,0xFF,0xE3,0xDE,0xC4,0xA0,0x98,0x60,
-  0xFF,0xFF,0xFF,0xFF,0xFE,0xFC,0xFE,0xFF,0xFF,0xEB,0xE6,0xD7,0x77,0x6A,0x15,0x7D,
-  0x81,0x39,0xFF,0xFF,0xFF,0xFE,0xFD,0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xDB,
-  0xD7,0xC0,0x76,0x68,0x1D,0x88,0x7A,0x2D,0x84,0x7B,0x2D,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7A,0x2E,
-  0x83,0x7B,0x2D,0x83,0x7B,0x2E,0x84,0x7A,0x2F,0x87,0x7A,0x2E,0x89,0x78,0x31,0x87,
-  0x75,0x35,0x81,0x76,0x27,0x7C,0x72,0x1E,0x78,0x6E,0x20,0x75,0x6E,0x22,0x78,0x70,
-  0x24,0x81,0x77,0x26,0x83,0x7B,0x2A,0x85,0x7B,0x2D,0x86,0x7A,0x2D,0x84,0x7B,0x2D,
-  0x84,0x7B,0x2D,0x85,0x7B,0x2D,0x84,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x84,0x7B,0x2D,0x85,0x7A,0x2E,0x89,0x7A,
-  0x2C,0x78,0x6F,0x1B,0xC7,0xC1,0xA6,0xFF,0xFF,0xFF,0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xBC,0xB8,0x94,0xBD,0xBB,0x91,
-  0xFF,0xFF,0xFF,0xFE,0xFD,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0x6D,0x70,0x1F,0x72,
-  0x6B,0x1E,0xFF,0xFA,0xF7,0xFE,0xFD,0xFF,0xFD,0xFE,0xFE,0xFE,0xFD,0xFD,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFC,0xFC,0xFD,0xFF,0xFF,
-  0xFF,0xFF,0x8F,0x87,0x55,0x84,0x77,0x29,0x84,0x7B,0x2D,0x85,0x7B,0x2D,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,
-  0x85,0x7A,0x2E,0x85,0x7B,0x2D,0x85,0x7B,0x2E,0x86,0x7A,0x2F,0x85,0x7A,0x2E,0x86,
-  0x7A,0x2E,0x86,0x7A,0x2F,0x85,0x7A,0x2E,0x85,0x7B,0x2D,0x85,0x7B,0x2D,0x85,0x7A,
-  0x2D,0x85,0x7A,0x2D,0x85,0x7A,0x2E,0x85,0x7B,0x2E,0x84,0x7B,0x2E,0x85,0x7B,0x2E,
-  0x85,0x7B,0x2E,0x84,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x84,0x7B,0x2D,0x89,0x77,0x32,0x86,0x77,
-  0x27,0x7B,0x79,0x3A,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0x99,0x8D,0x52,0xE0,0xE0,0xCB,
-  0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFF,0xFF,0xFF,0x8C,0x8A,0x4F,0x74,
-  0x69,0x1D,0xD4,0xD6,0xB1,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,0xFD,0xFD,0xFD,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,0xF8,0xFE,0xFE,0xFA,
-  0xFF,0xFF,0xF4,0xF2,0xE1,0x6F,0x65,0x17,0x85,0x79,0x2C,0x84,0x7B,0x2E,0x84,0x7A,
-  0x2D,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,
-  0x85,0x7B,0x2E,0x85,0x7A,0x2E,0x84,0x7B,0x2D,0x83,0x7B,0x2D,0x83,0x7B,0x2D,0x83,
-  0x7A,0x2D,0x83,0x7B,0x2D,0x84,0x7B,0x2D,0x85,0x7A,0x2E,0x84,0x7A,0x2D,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,
-  0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,
-  0x7B,0x2E,0x84,0x7B,0x2D,0x85,0x7A,0x2E,0x85,0x7B,0x2E,0x81,0x79,0x2C,0x69,0x6D,
-  0x1E,0xE1,0xE5,0xC6,0xFF,0xFF,0xFF,0xFE,0xFE,0xFC,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFD,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0x75,0x68,0x24,0xFF,0xFF,0xFF,
-  0xFC,0xFE,0xFF,0xFE,0xFE,0xFE,0xFC,0xFF,0xFD,0xFF,0xFF,0xFF,0xBA,0xB4,0x9A,0x71,
-  0x70,0x13,0xA2,0xA0,0x77,0xFF,0xFF,0xFF,0xFC,0xFF,0xFB,0xFF,0xFC,0xFF,0xFD,0xFE,
-  0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFC,0xFE,0xFE,0xFB,
-  0xFD,0xFD,0xFF,0xFF,0xFF,0xA8,0xA1,0x7D,0x81,0x78,0x1B,0x8A,0x76,0x34,0x84,0x7C,
-  0x2B,0x85,0x7A,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,
-  0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7A,0x2E,0x85,0x7A,0x2E,0x85,0x7A,0x2E,0x85,
-  0x7B,0x2E,0x85,0x7A,0x2E,0x85,0x7A,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,
-  0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x84,
-  0x7B,0x2D,0x86,0x7A,0x2F,0x83,0x7B,0x2D,0x80,0x7D,0x29,0x6F,0x6E,0x1C,0xAA,0xB3,
-  0x85,0xFF,0xFF,0xFF,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,
-  0xFE,0xFF,0xFD,0xFC,0xFF,0xFE,0xFF,0xDF,0xDD,0xC8,0x7E,0x81,0x45,0xFF,0xFF,0xFF,
-  0xFD,0xFE,0xFC,0xFE,0xFD,0xFE,0xFC,0xFE,0xFE,0xFF,0xFF,0xFF,0xED,0xE9,0xDE,0x6D,
-  0x6B,0x18,0x71,0x70,0x34,0xFF,0xFF,0xFF,0xFD,0xFD,0xFF,0xFE,0xFE,0xFD,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0x6B,0x6E,0x22,0x84,0x7A,0x28,0x86,0x7A,
-  0x2E,0x84,0x7B,0x2D,0x85,0x7B,0x2D,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,
-  0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,
-  0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x84,
-  0x7B,0x2E,0x84,0x7A,0x2E,0x82,0x7D,0x29,0x77,0x70,0x28,0x94,0x8F,0x5A,0xFF,0xFF,
-  0xFF,0xFD,0xFD,0xFF,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,
-  0xFE,0xFF,0xFE,0xFB,0xFF,0xFF,0xFF,0xA0,0xA0,0x6B,0xB7,0xB8,0x93,0xFF,0xFF,0xFF,
-  0xFE,0xFD,0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFF,0xFC,0xFA,0xFF,0xFF,0xFF,0xFF,0x7C,
-  0x7A,0x38,0x70,0x6F,0x15,0xD7,0xD9,0xBE,0xFF,0xFF,0xFF,0xFD,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFD,0xFE,0xFE,0xFE,0xFD,0xFF,0xFF,0xFF,0xC4,0xC6,0xA7,0x6C,0x72,0x15,0x85,0x7A,
-  0x2F,0x85,0x79,0x31,0x85,0x7A,0x2F,0x85,0x7B,0x2D,0x85,0x7B,0x2E,0x85,0x7B,0x2E,
-  0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,
-  0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x84,0x7A,0x2D,0x88,
-  0x7A,0x2D,0x8A,0x79,0x2E,0x76,0x75,0x20,0x86,0x82,0x52,0xFF,0xFF,0xFF,0xFF,0xFD,
-  0xFF,0xFF,0xFD,0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,
-  0xFD,0xFF,0xFD,0xFC,0xFF,0xFF,0xFF,0x5B,0x61,0x12,0xF3,0xF1,0xE3,0xFF,0xFA,0xFF,
-  0xFE,0xFD,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,0xFB,0xFD,0xFF,0xFF,0xFF,0xB3,
-  0xB4,0x8A,0x78,0x72,0x11,0x9B,0x97,0x67,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,0xFD,
-  0xFD,0xFE,0xFD,0xFE,0xFD,0xFF,0xFE,0xFD,0xFF,0xFF,0xFF,0x7B,0x80,0x38,0x86,0x77,
-  0x2B,0x84,0x75,0x38,0x85,0x79,0x31,0x85,0x7B,0x2D,0x85,0x7B,0x2E,0x85,0x7B,0x2E,
-  0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,
-  0x85,0x7A,0x2E,0x85,0x7A,0x2E,0x85,0x7B,0x2E,0x84,0x7A,0x2E,0x85,0x7B,0x2E,0x88,
-  0x7D,0x25,0x79,0x71,0x1A,0x8E,0x8B,0x5B,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFE,
-  0xFD,0xFD,0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFD,
-  0xFE,0xFF,0xFF,0xFF,0xCF,0xCD,0xB4,0x7B,0x79,0x31,0xFF,0xFF,0xFF,0xFD,0xFF,0xFD,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFE,0xFF,0xFF,0xFC,0xFF,0xFF,0xFC,0xFC,
-  0xFA,0xED,0x6B,0x6B,0x24,0x75,0x64,0x1A,0xF8,0xF7,0xF6,0xFE,0xFF,0xFF,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFD,0xFD,0xFD,0xFE,0xFF,0xFD,0xFE,0xFF,0xFE,0xFF,0xE6,0xDF,0xC9,0x72,0x62,
-  0x1A,0x85,0x7C,0x2C,0x84,0x7A,0x2E,0x85,0x7A,0x2E,0x85,0x7B,0x2D,0x85,0x7B,0x2E,
-  0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7A,0x2E,
-  0x85,0x7A,0x2E,0x85,0x7A,0x2E,0x85,0x7A,0x2E,0x85,0x7B,0x2D,0x89,0x79,0x2B,0x73,
-  0x63,0x1E,0x9F,0xA4,0x7E,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFD,0xFE,0xFC,0xFE,
-  0xFD,0xFC,0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,
-  0xFF,0xFF,0xFF,0xFF,0x82,0x79,0x3D,0xC8,0xC5,0xA5,0xFF,0xFF,0xFF,0xFE,0xFE,0xFD,
-  0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,
-  0xFF,0xFF,0x8F,0x90,0x68,0x76,0x72,0x16,0xB6,0xAE,0x84,0xFF,0xFF,0xFF,0xFF,0xFE,
-  0xFD,0xFD,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFC,0xFD,0xFD,0xFE,0xFD,0xFE,0xFF,0xFF,0xFF,0x98,0x8F,
-  0x62,0x83,0x76,0x24,0x85,0x79,0x30,0x84,0x7B,0x2C,0x85,0x7B,0x2E,0x85,0x7B,0x2E,
-  0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x84,0x7A,0x2E,
-  0x80,0x7D,0x2A,0x7E,0x7F,0x29,0x85,0x7C,0x27,0x75,0x71,0x1C,0x6D,0x73,0x2D,0xD5,
-  0xD1,0xCF,0xFF,0xFF,0xFF,0xFD,0xFD,0xFF,0xFD,0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,
-  0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFF,0xFD,0xFF,0xFF,0xFF,
-  0xFF,0xDD,0xD9,0xCB,0x65,0x60,0x11,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFD,0xFE,0xFD,
-  0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFD,0xFE,0xFF,
-  0xFF,0xFF,0xE8,0xE4,0xD8,0x71,0x66,0x21,0x70,0x6E,0x18,0xFF,0xFF,0xFA,0xFF,0xFE,
-  0xFF,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFF,0xFF,0xF8,0xF7,
-  0xED,0x6A,0x68,0x23,0x85,0x7A,0x2D,0x85,0x7A,0x2E,0x84,0x7B,0x2E,0x84,0x7B,0x2E,
-  0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x84,0x7B,0x2D,0x85,0x7B,0x2D,0x85,0x7A,
-  0x2D,0x85,0x7A,0x2E,0x85,0x7A,0x2E,0x85,0x7A,0x2E,0x85,0x7A,0x2E,0x84,0x7C,0x2B,
-  0x7F,0x7B,0x27,0x76,0x69,0x2C,0x6F,0x68,0x27,0xB2,0xB1,0x85,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFE,0xFE,0xFE,0xFD,0xFF,0xFF,
-  0xFF,0x81,0x78,0x42,0xA9,0xAB,0x7D,0xFF,0xFF,0xFF,0xFE,0xFE,0xFD,0xFE,0xFF,0xFC,
-  0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,
-  0xFE,0xFA,0xFF,0xFF,0xFF,0x8F,0x87,0x5A,0x77,0x77,0x0E,0xAD,0xA6,0x88,0xFF,0xFF,
-  0xFF,0xFE,0xFD,0xFF,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFB,0xFE,0xFD,0xFF,0xFF,
-  0xFF,0xAD,0xB0,0x8D,0x75,0x74,0x1C,0x85,0x7B,0x2E,0x87,0x7A,0x2D,0x85,0x7B,0x2D,
-  0x84,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x84,0x7B,0x2D,0x87,0x79,0x2E,0x84,0x7A,0x2E,0x7F,0x7C,
-  0x2D,0x84,0x7C,0x2B,0x81,0x7A,0x29,0x7E,0x79,0x24,0x78,0x72,0x1F,0x74,0x6C,0x1D,
-  0x77,0x73,0x3B,0xBF,0xB5,0x9B,0xFF,0xFF,0xFA,0xFF,0xFF,0xFF,0xF9,0xFF,0xFF,0xFB,
-  0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFD,0xFF,0xFF,0xFF,0xC9,0xCD,
-  0xAB,0x5C,0x5F,0x0A,0xFD,0xFD,0xF5,0xFD,0xFE,0xFC,0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,
-  0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,
-  0xFE,0xFA,0xFF,0xFE,0xFF,0xEB,0xEE,0xDC,0x6D,0x68,0x16,0x70,0x69,0x24,0xF5,0xEF,
-  0xE6,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFF,0xFF,0xFF,0xFF,0x6F,0x75,0x30,0x80,0x7A,0x23,0x8A,0x79,0x2F,0x84,0x7B,0x2D,
-  0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x84,0x7B,0x2D,0x8A,0x79,0x2E,0x83,0x76,0x32,0x66,0x6B,
-  0x26,0x68,0x69,0x28,0x77,0x76,0x35,0x92,0x93,0x5C,0xB7,0xB9,0x95,0xEA,0xE7,0xDB,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFC,0xFF,0xFE,0xFE,0xFE,0xFE,
-  0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFC,0xFB,0xFF,0xFF,0xFF,0xFF,0x6C,0x6C,
-  0x24,0xAA,0xB2,0x7D,0xFF,0xFF,0xFF,0xFD,0xFF,0xFA,0xFE,0xFE,0xFD,0xFE,0xFD,0xFD,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,
-  0xFD,0xFE,0xFF,0xFB,0xFE,0xFF,0xFF,0xFF,0xA0,0x9D,0x70,0x71,0x75,0x10,0x97,0x85,
-  0x57,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFF,0xFF,0xFF,0xCD,0xCC,0xAF,0x76,0x71,0x12,0x8A,0x76,0x34,0x84,0x7A,0x2D,
-  0x84,0x7B,0x2D,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2D,0x84,0x7B,0x2E,0x89,0x79,0x2C,0x7D,0x6C,0x32,0xFB,0xFB,
-  0xE3,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFF,
-  0xFF,0xFD,0xFF,0xFE,0xFE,0xFE,0xFD,0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFD,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0x9D,0xA8,0x67,0x6A,0x66,
-  0x1A,0xFF,0xFF,0xFF,0xFD,0xFB,0xFF,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFD,0xFD,0xFD,0xFE,0xFE,0xFF,0xFF,0xFE,0xFB,0x71,0x6B,0x24,0x7F,0x6E,
-  0x1F,0xC3,0xC3,0xAE,0xFF,0xFF,0xFF,0xFD,0xFD,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0x8D,0x7D,0x4C,0x83,0x7C,0x1B,0x85,0x78,0x32,
-  0x84,0x7B,0x2D,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2D,0x84,0x7A,0x2F,0x85,0x7C,0x2A,0x7B,0x6E,0x27,0xB2,0xA6,
-  0x7D,0xFF,0xFF,0xFF,0xFF,0xFB,0xFE,0xFF,0xFE,0xFF,0xFD,0xFC,0xFF,0xFE,0xFE,0xFE,
-  0xFD,0xFE,0xFD,0xFD,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,
-  0xFE,0xFD,0xF5,0xFC,0xFF,0xFF,0xFF,0xFF,0xDD,0xD9,0xC7,0x63,0x5D,0x03,0xCF,0xC9,
-  0xB5,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xD1,0xCF,0xB1,0x69,0x67,
-  0x10,0x73,0x69,0x20,0xF4,0xF3,0xE5,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,
-  0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,
-  0xFE,0xFC,0xFE,0xFA,0xFF,0xFF,0xFF,0xE9,0xE4,0xD0,0x6F,0x6E,0x16,0x84,0x79,0x2F,
-  0x84,0x7B,0x2D,0x84,0x7B,0x2D,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2C,0x84,0x79,0x31,0x85,0x77,0x33,0x74,0x68,
-  0x1A,0xF2,0xF5,0xE1,0xFF,0xFC,0xFF,0xFF,0xFE,0xFB,0xFD,0xFD,0xFE,0xFE,0xFE,0xFD,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,
-  0xFE,0xFD,0xFB,0xFF,0xFF,0xFF,0xFF,0xED,0x6B,0x64,0x25,0x93,0x8E,0x52,0xFF,0xFF,
-  0xFF,0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFA,0xFE,0xFF,0xFF,0xFF,0xFF,0x9A,0x9D,
-  0x62,0x7D,0x73,0x10,0x88,0x78,0x3C,0xFF,0xFF,0xFF,0xFD,0xFC,0xFF,0xFA,0xFF,0xFC,
-  0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFD,0xFD,0xFD,0xFA,0xFE,0xFF,0xFF,0xFF,0xFF,0x9E,0x99,0x68,0x81,0x75,0x22,
-  0x8C,0x78,0x2F,0x84,0x7A,0x2F,0x84,0x7B,0x2D,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2D,0x85,0x7B,0x2E,0x85,0x77,0x35,0x85,0x77,0x34,0x7F,0x79,
-  0x21,0x84,0x8D,0x51,0xFF,0xFF,0xFF,0xFE,0xFC,0xFD,0xFD,0xFE,0xFD,0xFE,0xFD,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFF,0xFD,0xFE,0xFB,0xFE,0xFE,0xFA,
-  0xFD,0xFF,0xFF,0xFF,0xFF,0x80,0x84,0x39,0x69,0x6B,0x16,0xF9,0xFD,0xF0,0xFF,0xFF,
-  0xFF,0xFD,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFB,0xFF,0xFF,0xFF,
-  0xFF,0x74,0x73,0x35,0x7F,0x71,0x16,0x94,0x8C,0x60,0xFF,0xFF,0xFF,0xFB,0xFD,0xFF,
-  0xFE,0xFE,0xFD,0xFD,0xFD,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFE,0xFA,0xF3,0x73,0x6A,0x23,
-  0x90,0x77,0x2E,0x88,0x78,0x30,0x86,0x7B,0x2D,0x84,0x7B,0x2E,0x85,0x7B,0x2E,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2D,0x85,0x7B,0x2E,0x85,0x7A,0x2E,0x85,0x7A,0x2E,0x85,0x7A,
-  0x2C,0x6B,0x6E,0x19,0xD8,0xD8,0xC1,0xFF,0xFF,0xFF,0xFD,0xFE,0xFC,0xFE,0xFD,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFB,0xFF,0xFC,0xFF,
-  0xFF,0xFF,0x9B,0x95,0x6A,0x5C,0x60,0x0A,0xDD,0xDA,0xC4,0xFF,0xFF,0xFF,0xFD,0xFE,
-  0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,
-  0xFF,0xF2,0xF4,0xE4,0x65,0x68,0x25,0x7A,0x69,0x1A,0xAC,0xAD,0x75,0xFF,0xFF,0xFF,
-  0xFE,0xFF,0xFC,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFF,0xFD,0xFE,0xFF,0xFF,0xFF,0xB3,0xB5,0x87,
-  0x74,0x72,0x22,0x87,0x79,0x30,0x84,0x7B,0x2D,0x84,0x7B,0x2E,0x85,0x7B,0x2E,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2D,0x85,0x7B,0x2D,0x84,0x7B,0x2D,0x85,0x79,
-  0x30,0x88,0x78,0x29,0x79,0x75,0x33,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFE,0xFD,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFB,0xFE,0xFF,0xFF,0xFF,0xFF,0xB2,
-  0x9E,0x7C,0x75,0x59,0x13,0xB5,0xAE,0x86,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFD,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFC,
-  0xFF,0xFF,0xFF,0xFF,0xD7,0xDF,0xBC,0x77,0x68,0x1F,0x7C,0x6C,0x15,0xB8,0xAA,0x97,
-  0xFF,0xFF,0xFF,0xF9,0xFE,0xFF,0xFD,0xFD,0xFE,0xFE,0xFE,0xFC,0xFD,0xFD,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFC,0xFE,0xFD,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,
-  0x79,0x6F,0x2E,0x83,0x7A,0x28,0x83,0x7B,0x2F,0x85,0x7B,0x2D,0x85,0x7B,0x2E,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x84,0x7B,0x2E,0x85,0x7B,
-  0x2D,0x85,0x7B,0x2E,0x7B,0x6E,0x1D,0xBF,0xBB,0x96,0xFF,0xFF,0xFF,0xF7,0xFE,0xFE,
-  0xFC,0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,
-  0xFF,0xFE,0xFE,0xFC,0xFD,0xFD,0xFD,0xFB,0xFF,0xFF,0xFF,0xFF,0xA6,0xA9,0x79,0x68,
-  0x62,0x0B,0x9A,0x9B,0x68,0xFF,0xFF,0xFF,0xFD,0xFD,0xFF,0xFE,0xFE,0xFE,0xFD,0xFD,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFD,0xFC,
-  0xFF,0xFF,0xFE,0xFE,0xFF,0xFF,0xFF,0xD0,0xD1,0xB7,0x70,0x65,0x1D,0x75,0x63,0x1B,
-  0xB2,0xAD,0x85,0xFF,0xFF,0xFF,0xFE,0xFF,0xFD,0xFF,0xFD,0xFF,0xFE,0xFE,0xFD,0xFD,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFB,0xFA,0xFF,0xFE,0xFF,0xFF,0xFF,
-  0xD4,0xD0,0xB1,0x76,0x6B,0x1B,0x82,0x79,0x2D,0x84,0x7B,0x2E,0x85,0x7B,0x2D,0x85,
-  0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x84,0x7A,0x2D,0x82,0x78,0x29,0x72,0x6A,0x27,0xFF,0xFB,0xF9,0xFE,0xFF,0xFF,
-  0xFD,0xFE,0xFD,0xFD,0xFF,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,
-  0xFE,0xFE,0xFE,0xF9,0xFF,0xFF,0xFF,0xFF,0xFF,0xA5,0x9A,0x71,0x64,0x6D,0x05,0x8B,
-  0x8C,0x50,0xFF,0xFF,0xFF,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFD,0xFE,
-  0xFD,0xFE,0xFD,0xFE,0xFD,0xFC,0xFF,0xFF,0xFF,0xFF,0xCF,0xCF,0xA5,0x71,0x68,0x1B,
-  0x7C,0x6F,0x13,0xA9,0x9E,0x6D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFD,0xFD,0xFE,
-  0xFE,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xF9,0xFE,0xFD,0xFB,0xFC,0xFF,
-  0xFF,0xFF,0xFF,0x92,0x86,0x51,0x82,0x76,0x20,0x87,0x7B,0x2B,0x84,0x7B,0x2E,0x85,
-  0x7B,0x2D,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x84,0x7A,0x2D,0x85,0x7A,0x2F,0x7B,0x73,0x21,0x9E,0x9E,0x75,0xFF,0xFF,0xFF,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,0xFD,0xFC,0xFF,0xFD,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0x97,0x88,0x5B,0x7B,0x62,0x17,0x8C,0x8F,0x52,0xFF,
-  0xFF,0xFF,0xFD,0xFA,0xFF,0xFF,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,
-  0xFE,0xFD,0xFE,0xFD,0xFD,0xFE,0xFD,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xD5,0xD7,0xB4,
-  0x72,0x65,0x24,0x7C,0x6B,0x19,0x8C,0x88,0x50,0xFF,0xFF,0xFB,0xFF,0xFF,0xFF,0xFC,
-  0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,
-  0xFF,0xFF,0xFF,0xF0,0xEA,0xDE,0x73,0x69,0x20,0x88,0x7D,0x28,0x84,0x7A,0x2F,0x85,
-  0x7B,0x2D,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x84,0x7B,0x2E,0x85,0x7A,0x2E,0x87,0x7B,0x2C,0x6C,0x6C,0x15,0xEB,0xE9,0xDA,
-  0xFF,0xFF,0xFF,0xFE,0xFD,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xF8,0xFC,0xFD,0xFF,0xFF,0xFF,
-  0xF5,0xF3,0xD4,0x79,0x78,0x34,0x6A,0x67,0x15,0x9B,0x94,0x54,0xFF,0xFF,0xF9,0xFF,
-  0xFF,0xFF,0xFF,0xFC,0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFD,0xFD,0xFD,0xFE,0xFF,0xFD,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,
-  0xE0,0xE2,0xDA,0x80,0x70,0x22,0x7D,0x75,0x17,0x72,0x71,0x2D,0xE0,0xE1,0xCE,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFD,0xFE,0xFE,0xFE,0xFD,0xFD,0xFE,0xFD,0xFE,0xFE,
-  0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,
-  0xFB,0xFF,0xFD,0xFF,0xFF,0xFF,0x9C,0xA0,0x71,0x7A,0x76,0x1D,0x85,0x79,0x2F,0x85,
-  0x7A,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7A,0x2E,0x82,0x7B,0x2C,0x91,0x76,0x31,0x88,0x78,0x1C,0x8E,0x86,0x55,
-  0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC6,0xBF,0xAA,
-  0x73,0x66,0x1C,0x69,0x69,0x0E,0xA6,0xAA,0x7E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFC,0xFF,0xFF,0xFC,0xFF,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFE,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFF,0xFF,0xFF,0xFA,0xF8,0xF7,0x82,0x81,0x46,0x78,0x6E,0x18,0x7E,0x6B,0x10,0xB2,
-  0xA8,0x84,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFD,0xFF,0xFE,0xFC,0xFE,0xFD,0xFE,
-  0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFE,
-  0xFF,0xFE,0xFE,0xFF,0xFF,0xFF,0xFD,0xFF,0xF3,0x67,0x72,0x21,0x81,0x7C,0x28,0x7E,
-  0x7D,0x2B,0x85,0x7A,0x2C,0x83,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x84,0x7B,0x2E,0x85,0x7A,0x2E,0x76,0x6D,0x1C,
-  0xCF,0xCF,0xB3,0xFF,0xFF,0xFF,0xFA,0xFD,0xFB,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFE,0xFD,0xFC,0xFD,
-  0xFD,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xF6,0xF8,0xE9,0x8E,0x87,0x54,0x7B,0x6D,0x0E,
-  0x67,0x64,0x20,0xCA,0xCB,0xB9,0xFF,0xFF,0xFF,0xFE,0xFE,0xFF,0xFD,0xFE,0xFE,0xFD,
-  0xFE,0xFD,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB1,0xAD,0x86,0x76,0x67,0x1C,0x79,
-  0x6B,0x17,0x7B,0x7A,0x2D,0xD5,0xD5,0xBE,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFD,0xFE,
-  0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,
-  0xFF,0xFE,0xFE,0xFF,0xFC,0xFD,0xFF,0xFF,0xFF,0xBE,0xB9,0x9F,0x73,0x6A,0x27,0x7F,
-  0x7D,0x2B,0x85,0x7A,0x2C,0x83,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x84,0x7B,0x2D,0x84,0x7A,0x2E,0x84,0x7A,0x25,
-  0x7B,0x76,0x34,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFD,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,
-  0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,0xFF,0xFB,0xFF,0xFF,0xFD,
-  0xFF,0xFF,0xFF,0xFF,0xB1,0xB3,0x8F,0x6B,0x68,0x1F,0x76,0x6B,0x10,0x84,0x7D,0x41,
-  0xF6,0xF0,0xEC,0xFF,0xFF,0xFF,0xFB,0xFE,0xFF,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFD,0xFE,0xFE,0xFE,0xFE,0xFC,0xFC,0xFB,0xFF,0xFF,0xFF,0xFF,0xEA,0xE4,0xD6,0x83,
-  0x76,0x41,0x7D,0x6D,0x17,0x76,0x6E,0x16,0x92,0x84,0x4F,0xE9,0xE4,0xCD,0xFF,0xFF,
-  0xFF,0xFF,0xFB,0xFF,0xFE,0xFF,0xFF,0xFE,0xFE,0xFC,0xFE,0xFE,0xFC,0xFC,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0x7E,0x72,0x41,0x81,
-  0x78,0x24,0x85,0x79,0x2F,0x84,0x7B,0x2D,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x83,0x7A,0x2E,
-  0x78,0x71,0x19,0xBC,0xB2,0x93,0xFF,0xFF,0xFF,0xFE,0xFE,0xFC,0xFE,0xFD,0xFF,0xFC,
-  0xFE,0xFC,0xFB,0xFF,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC7,0xBF,
-  0x9B,0x7F,0x6A,0x2F,0x71,0x69,0x16,0x70,0x67,0x28,0xC1,0xB1,0x95,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFE,0xFE,0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFD,0xFC,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xC3,0xBD,0xA1,0x7B,0x6C,0x2B,0x77,0x6D,0x13,0x6C,0x6B,0x16,0x84,0x85,
-  0x4F,0xD4,0xD1,0xB4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFD,0xFD,
-  0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xDD,0xD9,0xBB,0x72,
-  0x69,0x1E,0x84,0x7A,0x2F,0x85,0x7B,0x2D,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2D,0x84,0x79,0x30,
-  0x80,0x7C,0x2A,0x70,0x68,0x21,0xFE,0xF9,0xF7,0xFF,0xFF,0xFF,0xFD,0xFF,0xFE,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0xF7,0xEB,0xB3,0xB3,0x87,0x6B,0x73,0x25,0x72,0x70,
-  0x11,0x77,0x67,0x19,0x9D,0x8E,0x65,0xF6,0xF4,0xEB,0xFF,0xFF,0xFF,0xFE,0xFE,0xFF,
-  0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xF9,0xFE,0xFE,0xF8,
-  0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFA,0xB0,0xAE,0x8B,0x72,0x6E,0x26,0x76,0x6E,
-  0x1A,0x73,0x6D,0x19,0x70,0x72,0x2D,0xAB,0xA7,0x84,0xE8,0xE4,0xDF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0x8C,
-  0x8F,0x52,0x80,0x76,0x26,0x85,0x7B,0x2E,0x85,0x7B,0x2D,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2D,0x84,0x7A,0x2E,
-  0x80,0x7D,0x2A,0x7B,0x79,0x1E,0x92,0x95,0x71,0xFF,0xFF,0xFF,0xFD,0xFC,0xF2,0xCA,
-  0xC4,0xAE,0x8B,0x8D,0x50,0x6C,0x68,0x1F,0x73,0x69,0x18,0x70,0x6C,0x11,0x94,0x88,
-  0x59,0xE4,0xE2,0xD2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xFD,0xFD,0xFF,0xFD,0xFE,
-  0xFC,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFE,
-  0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC4,0xBC,
-  0x9F,0x7F,0x7D,0x39,0x6D,0x65,0x1F,0x75,0x6D,0x1D,0x78,0x68,0x1C,0x79,0x71,0x32,
-  0x96,0x9A,0x6D,0xC4,0xC0,0xB4,0xE8,0xE8,0xD9,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xFE,
-  0xFA,0xF5,0x77,0x6F,0x23,0x83,0x79,0x2D,0x85,0x7B,0x2D,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7A,0x2D,
-  0x85,0x7A,0x2E,0x84,0x7D,0x2A,0x78,0x6A,0x30,0x90,0x8A,0x47,0x71,0x6D,0x19,0x75,
-  0x6E,0x1A,0x70,0x63,0x1C,0x6F,0x6E,0x26,0xA2,0x9E,0x73,0xEF,0xE9,0xDD,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFD,0xFE,0xFD,
-  0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFC,0xFE,0xFD,0xFB,0xFD,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xE7,0xE2,0xD6,0xA6,0xA8,0x73,0x7A,0x77,0x2D,0x77,0x65,0x16,
-  0x7C,0x68,0x15,0x7B,0x6D,0x16,0x76,0x6C,0x13,0x79,0x6F,0x27,0x84,0x7D,0x43,0x9E,
-  0x98,0x5D,0x8E,0x87,0x35,0x83,0x77,0x2B,0x85,0x7B,0x2E,0x85,0x7B,0x2E,0x85,0x7B,
-  0x2E,0x85,0x7A,0x2D,0x85,0x7A,0x2D,0x85,0x7B,0x2D,0x85,0x7B,0x2D,0x85,0x7B,0x2D,
-  0x84,0x7A,0x2B,0x82,0x77,0x28,0x7A,0x72,0x21,0x6D,0x66,0x1A,0x74,0x6E,0x25,0x8A,
-  0x91,0x51,0xCE,0xCA,0xB0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFC,0xFE,
-  0xFE,0xFD,0xFF,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFC,0xFE,
-  0xFE,0xFE,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEC,0xED,0xDB,
-  0xC5,0xC0,0x9F,0x9B,0x9B,0x66,0x78,0x79,0x35,0x6F,0x6B,0x1D,0x78,0x6A,0x18,0x76,
-  0x6A,0x1C,0x75,0x6E,0x1A,0x7A,0x73,0x1F,0x7B,0x74,0x20,0x7A,0x73,0x1F,0x7A,0x73,
-  0x1F,0x7B,0x74,0x20,0x7A,0x73,0x1F,0x79,0x70,0x1F,0x78,0x6E,0x1E,0x75,0x6A,0x1C,
-  0x79,0x6C,0x30,0x95,0x8C,0x50,0xB6,0xAD,0x8B,0xE0,0xD8,0xCB,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFC,0xFE,0xFD,0xFD,0xFF,0xFE,0xFE,0xFD,
-  0xFD,0xFE,0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,
-  0xFD,0xFE,0xFD,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xE1,0xEB,0xD7,0xCE,
-  0xD1,0xBB,0xC6,0xC5,0xAB,0xBC,0xB9,0x9C,0xB0,0xAC,0x92,0xAF,0xAA,0x90,0xAE,0xAA,
-  0x90,0xB8,0xB5,0x9A,0xC4,0xC0,0xA6,0xCB,0xCB,0xB4,0xDD,0xE1,0xCD,0xF6,0xFB,0xE9,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFE,0xFE,0xFD,0xFD,0xFD,0xFE,
-  0xFE,0xFD,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFD,0xFD,0xFE,
-  0xFF,0xFE,0xFB,0xFB,0xFF,0xF6,0xFC,0xFD,0xFE,0xFD,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFD,0xFF,
-  0xFE,0xFE,0xFD,0xFD,0xFD,0xFC,0xFE,0xFE,0xFD,0xFE,0xFE,0xFD,0xFD,0xFD,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,};
@@ -7,6 +7,7 @@
 #include "../../shared/utils/utils.h"
 #include "../../shared/utils/cLog.h"
 #include "../../shared/decoders/jpegHeader.h"
+#include "../decoders/cPixelConvert.h"
 
 #include "../common/usbUtils.h"
 #pragma comment (lib,"CyAPI")
@@ -480,18 +481,8 @@ uint8_t* cSensor::getRgbFrame (int bayer, bool info) {
     case eCaptureRgb565:
       //{{{  rgb565
       if (frameLen == mWidth*mHeight*2) {
-        uint16_t* src = (uint16_t*)framePtr;
-        auto dst = rgbaBuffer;
-        for (auto y = 0; y < mHeight; y++) {
-          for (auto x = 0; x < mWidth; x++) {
-            uint16_t rgb = *src++;
-            *dst++ = (rgb & 0x001F) << 3;
-            *dst++ = (rgb & 0x07E0) >> 3;
-            *dst++ = (rgb & 0xF800) >> 8;
-            *dst++ = 255;
-            }
-          }
-
+        cPixelConvert::convert (framePtr, cPixelConvert::eRgb565, mWidth * 2,
+                                rgbaBuffer, cPixelConvert::eBgra, mWidth * 4, mWidth, mHeight);
         ok = true;
         }
       break;
@@ -507,21 +498,16 @@ uint8_t* cSensor::getRgbFrame (int bayer, bool info) {
         auto rgbBuffer = (uint8_t*)malloc (mWidth * mHeight *3);
         bayerDecode8 (framePtr, rgbBuffer, mWidth, mHeight, COLOR_GBRG, tBayer(bayer));
 
-        auto bufferPtr = rgbaBuffer;
-        auto rgbPtr = rgbBuffer;
-        for (auto i = 0; i < mWidth*mHeight; i++) {
-          if (info)
+        if (info) {
+          auto rgbPtr = rgbBuffer;
+          for (auto i = 0; i < mWidth*mHeight; i++, rgbPtr += 3)
             mRgbHistogram.incValue (*(rgbPtr+2), *(rgbPtr+1), *rgbPtr);
-
-          *bufferPtr++ = *rgbPtr++;
-          *bufferPtr++ = *rgbPtr++;
-          *bufferPtr++ = *rgbPtr++;
-          *bufferPtr++ = 255;
+          mRgbHistogram.finishValues();
           }
-        free (rgbBuffer);
 
-        if (info)
-          mRgbHistogram.finishValues();
+        cPixelConvert::convert (rgbBuffer, cPixelConvert::eBgr, mWidth * 3,
+                                rgbaBuffer, cPixelConvert::eBgra, mWidth * 4, mWidth, mHeight);
+        free (rgbBuffer);
 
         ok = true;
         }
@@ -1,15 +1,17 @@
-// cImageWidget.h
+// cImageWidget.h - image decoded off the ui thread by cDecodeService, placeholder until ready
+// - prefetched at layout size when constructed, raised to visible when first drawn
+// - containers call setOnScreen as widgets scroll, off screen abandons a queued decode without waiting
+// - decodes also kept in a per user cPicDiskCache, the next run maps them instead of decoding
 //{{{  includes
 #pragma once
 
+#include <stdlib.h>
+#include <string>
 #include <functional>
+#include <memory>
 #include "cWidget.h"
 #include "../utils/cLog.h"
-
-extern "C" {
-  uint8_t* stbi_load_from_memory (uint8_t* const* buffer, int len, int* x, int* y, int* channels_in_file, int desired_channels);
-  void stbi_set_flip_vertically_on_load(int flag_true_if_should_flip);
-  }
+#include "../decoders/cDecodeService.h"
 //}}}
 
 class cImageWidget : public cWidget {
@@ -17,35 +19,96 @@ public:
   //{{{
   cImageWidget (const uint8_t* image, int imageSize, float width, float height,
                 std::function<void (cWidget* widget)> hitCallback = [](cWidget*) {}, const std::string& id = "")
-      : cWidget(width, height, "imageWidget:" + id), mHitCallback(hitCallback) {
-
-   stbi_set_flip_vertically_on_load (true);
-   mPiccy = stbi_load_from_memory ((uint8_t* const*)image, imageSize, &mPicWidth, &mPicHeight, &mPicComponents, 4);
-   //auto ptr = mPic;
-   //for (int i = 0; i < mPicWidth * mPicHeight; i++)
-   //  ptr[(i*4) + 3] = 0x80;
-   }
+      : cWidget(width, height, "imageWidget:" + id), mHitCallback(hitCallback), mImageBuffer(image), mImageSize(imageSize) {
+
+    // layout relative sizes aren't known until drawn
+    if ((width > kBorder.x) && (height > kBorder.y))
+      request (cDecodeService::ePrefetch);
+    }
+  //}}}
+  //{{{
+  virtual ~cImageWidget() {
+  // image buffer belongs to the caller, make sure no decode still reads it
+    getDecodeService().cancel (mRequest);
+    }
+  //}}}
+
+  //{{{
+  static cDecodeService& getDecodeService() {
+  // decoder pool, pic cache and disk cache shared by all image widgets
+  // - startup images, resource bmps, mondaine.jpg, channel logos, map the last run's decode from disk
+
+    static cPicDiskCache diskCache (getDiskCacheDirName(), kDiskCacheBytes);
+    static cDecodeService decodeService;
+    static bool diskCacheSet = (decodeService.setDiskCache (&diskCache), true);
+    (void)diskCacheSet;
+
+    return decodeService;
+    }
+  //}}}
+  //{{{
+  void setOnScreen (bool onScreen) {
+  // scrolled on raises a pending decode, scrolled off abandons a queued one, next draw requests it again
+  // - request kept, destructor still has to wait out a decode already reading the buffer
+
+    if (!mRequest || mRequest->isDone())
+      return;
+
+    if (onScreen)
+      getDecodeService().setPriority (mRequest, cDecodeService::eVisible);
+    else {
+      getDecodeService().abandon (mRequest);
+      mAbandoned = true;
+      }
+    }
   //}}}
-  virtual ~cImageWidget() {}
 
   virtual void onDown (cPointF point) {
     cWidget::onDown (point);
     mHitCallback (this);
     }
 
+  //{{{
   virtual void onDraw (iDraw* draw) {
 
     cVg* vg = draw->getVg();
 
-    // createImage firstTime
-    if (mImage == -1)
-      mImage = vg->createImageRGBA (mPicWidth, mPicHeight, 0, mPiccy);  // cVg::eImageGenerateMipmaps, mPiccy);
-
     // calc draw pos,size
     mScale = isPressed() ? 0.7f : 1.0f;
     cPointF drawSize = (mSize - kBorder) * mScale;
     cPointF drawCentre = mOrg + (mSize - drawSize)/2.f;
 
+    if (mImage == -1) {
+      //{{{  request decode at unpressed size, upload when done, placeholder until then or if it failed
+      if (!mFailed) {
+        // first draw, or abandoned while queued and now back on screen
+        if (!mRequest || (mAbandoned && (mRequest->getState() == cDecodeService::eCancelled)))
+          request (cDecodeService::eVisible);
+        else
+          getDecodeService().setPriority (mRequest, cDecodeService::eVisible);
+        mAbandoned = false;
+
+        auto pic = mRequest->getPic();
+        if (pic) {
+          mImage = vg->createImageRGBA (pic->mWidth, pic->mHeight, 0, pic->mPic);  // cVg::eImageGenerateMipmaps
+          mRequest.reset();
+          }
+        else if (mRequest->isDone()) {
+          // failed, or cancelled by the service shutting down, don't ask again
+          cLog::log (LOGERROR, "cImageWidget - %s %d byte image",
+                     mRequest->getState() == cDecodeService::eFailed ? "can't decode" : "cancelled", mImageSize);
+          mFailed = true;
+          mRequest.reset();
+          }
+        }
+
+      if (mImage == -1) {
+        draw->drawRect (kDarkGreyF, drawCentre, drawSize);
+        return;
+        }
+      }
+      //}}}
+
     // draw it
     auto imgPaint = vg->setImagePattern (drawCentre, drawSize, 0.f, mImage, 1.0f);
     vg->beginPath();
@@ -53,16 +116,46 @@ public:
     vg->setFillPaint (imgPaint);
     vg->fill();
     }
+  //}}}
 
 private:
+  static const uint64_t kDiskCacheBytes = 256 * 1024 * 1024;
+
+  //{{{
+  static std::string getDiskCacheDirName() {
+  // per user cache dir, current dir if none
+
+  #ifdef _WIN32
+    const char* dirName = getenv ("LOCALAPPDATA");
+    return dirName ? std::string (dirName) + "\\picCache" : "picCache";
+  #else
+    const char* dirName = getenv ("XDG_CACHE_HOME");
+    if (dirName)
+      return std::string (dirName) + "/picCache";
+    dirName = getenv ("HOME");
+    return dirName ? std::string (dirName) + "/.cache/picCache" : "picCache";
+  #endif
+    }
+  //}}}
+  //{{{
+  void request (cDecodeService::ePriority priority) {
+  // at unpressed draw size, flipped for cVg, a finished earlier request is likely a cache hit
+
+    cPointF size = mSize - kBorder;
+    mRequest = getDecodeService().request (mImageBuffer, mImageSize, (uint32_t)size.x, (uint32_t)size.y,
+                                           priority, true);
+    }
+  //}}}
+
   const cPointF kBorder = { 1.f, 1.f };
   std::function <void (cWidget* widget)> mHitCallback;
 
-  const uint8_t* mPiccy = nullptr;
-  int mPicWidth = 0;
-  int mPicHeight = 0;
-  int mPicComponents = 0;
+  const uint8_t* mImageBuffer = nullptr;
+  int mImageSize = 0;
+  std::shared_ptr<cDecodeService::cRequest> mRequest;
 
   int mImage = -1;
+  bool mAbandoned = false;
+  bool mFailed = false;
   float mScale = 1.0f;
   };